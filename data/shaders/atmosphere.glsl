@@ -13,15 +13,86 @@ precision mediump float;
 
 uniform highp float u_atm_p[12];
 uniform highp vec3  u_sun;
+uniform highp vec3  u_moon;
 uniform highp float u_tm[3]; // Tonemapping koefs.
 
+/*
+ * Skybrightness model coefficients, computed per frame on the CPU
+ * (see atmosphere.c):
+ *   u_sb[0] - b_night_term.
+ *   u_sb[1] - b_moon_term.
+ *   u_sb[2] - b_twilight_term.
+ *   u_sb[3] - C3 (moon extinction term).
+ *   u_sb[4] - C4 (sun extinction term).
+ *   u_sb[5] - K (extinction coefficient).
+ *   u_sb[6] - Solar eclipse adjustment factor.
+ *   u_sb[7] - Light pollution luminance.
+ *   u_sb[8] - Cos of the max grid angular step (anti aliasing clamp).
+ */
+uniform highp float u_sb[9];
+
 varying lowp    vec4        v_color;
 
 #ifdef VERTEX_SHADER
 
 attribute highp   vec4       a_pos;
 attribute highp   vec3       a_sky_pos;
-attribute highp   float      a_luminance;
+
+/*
+ * Luminance (cd/m2) at a given sky position, same model as
+ * skybrightness.c on the CPU side (B. Schaefer's sky brightness model),
+ * evaluated here so that only the coefficients are computed per frame.
+ */
+highp float sb_luminance(highp vec3 p)
+{
+    highp float cos_zenith_dist = p[2];
+    // Clamp to the grid angular step and to one degree, to avoid both
+    // aliasing near the moon border and issues in the model itself.
+    highp float cos_moon_dist = min(min(dot(p, u_moon), u_sb[8]), 0.99985);
+    highp float cos_sun_dist  = min(min(dot(p, u_sun),  u_sb[8]), 0.99985);
+    highp float moon_dist = acos(cos_moon_dist);
+    highp float sun_dist = acos(cos_sun_dist);
+
+    // Air mass.
+    highp float bKX = pow(10.0, -0.4 * u_sb[5] /
+            (cos_zenith_dist + 0.025 * exp(-11.0 * cos_zenith_dist)));
+
+    // Daylight brightness.
+    highp float FS = 18886.28 / (sun_dist * sun_dist) +
+            pow(10.0, 6.15 - (sun_dist + 0.001) * 1.43239) +
+            229086.77 * (1.06 + cos_sun_dist * cos_sun_dist);
+    highp float b_daylight = 9.289663e-12 * (1.0 - bKX) *
+            (FS * u_sb[4] + 440000.0 * (1.0 - u_sb[4]));
+
+    // Twilight brightness.
+    highp float b_twilight_k = u_sb[2] +
+            0.063661977 * acos(cos_zenith_dist) / max(u_sb[5], 0.05);
+    highp float b_twilight = (b_twilight_k > -32.0) ? // Underflow guard.
+            pow(10.0, b_twilight_k) * (1.7453293 / sun_dist) * (1.0 - bKX) :
+            0.0;
+
+    highp float b_total = min(b_twilight, b_daylight);
+
+    // Moonlight brightness.
+    highp float FM = 18886.28 / (moon_dist * moon_dist) +
+            pow(10.0, 6.15 - moon_dist * 1.43239) +
+            229086.77 * (1.06 + cos_moon_dist * cos_moon_dist);
+    b_total += u_sb[1] * (1.0 - bKX) *
+            (FM * u_sb[3] + 440000.0 * (1.0 - u_sb[3])) / 1000000.0;
+
+    // Dark night sky brightness, only if more than 1% of daylight.
+    if (b_total > 0.0 && (u_sb[0] * bKX) / b_total > 0.01) {
+        b_total += (0.4 + 0.6 / sqrt(0.04 + 0.96 *
+                cos_zenith_dist * cos_zenith_dist)) * u_sb[0] * bKX;
+        // Ad-hoc addition to make the sky slightly more blueish.
+        b_total += 0.0000000000012;
+    }
+    b_total = max(b_total, 0.0);
+
+    // Convert to nano lambert then cd/m2, apply the eclipse factor and
+    // add the light pollution.
+    return b_total / 1.11e-15 * 3.183e-6 * u_sb[6] + u_sb[7];
+}
 
 highp float gammaf(highp float c)
 {
@@ -64,7 +135,7 @@ void main()
     xyy.y = ((1. + u_atm_p[6] * exp(u_atm_p[7] / cos_theta)) *
              (1. + u_atm_p[8] * exp(u_atm_p[9] * gamma) +
               u_atm_p[10] * cos_gamma2)) * u_atm_p[11];
-    xyy.z = a_luminance;
+    xyy.z = sb_luminance(p);
 
     // Ad-hoc tuning. Scaling before the blue shift allows to obtain proper
     // blueish colors at sun set instead of very red, which is a shortcoming
@@ -108,7 +179,7 @@ void main()
 
 void main()
 {
-    gl_FragColor = v_color;
+    gl_FragColor = color_fx(v_color);
 }
 
 #endif
@@ -10,6 +10,14 @@
 uniform mediump vec4        u_color;
 uniform mediump sampler2D   u_tex;
 
+#ifdef TEX_FALLBACK
+// Fallback texture sampled where the main texture is still fading in
+// (see hips.c): the whole quad renders in a single pass.
+uniform mediump sampler2D   u_fallback_tex;
+uniform highp   mat3        u_fallback_mat; // Tex pos -> fallback pos.
+uniform lowp    float       u_fallback_blend;
+#endif
+
 varying highp   vec2        v_tex_pos;
 
 #ifdef VERTEX_SHADER
@@ -28,13 +36,30 @@ void main()
 
 void main()
 {
+#ifdef TEX_FALLBACK
+    highp vec2 fallback_pos =
+        (u_fallback_mat * vec3(v_tex_pos, 1.0)).xy;
+#endif
 #ifndef TEXTURE_LUMINANCE
+#ifdef TEX_FALLBACK
+    gl_FragColor = mix(texture2D(u_fallback_tex, fallback_pos),
+                       texture2D(u_tex, v_tex_pos),
+                       u_fallback_blend) * u_color;
+#else
     gl_FragColor = texture2D(u_tex, v_tex_pos) * u_color;
+#endif
 #else
     // Luminance mode: the texture only applies to the alpha channel.
     gl_FragColor = u_color;
+#ifdef TEX_FALLBACK
+    gl_FragColor.a *= mix(texture2D(u_fallback_tex, fallback_pos).r,
+                          texture2D(u_tex, v_tex_pos).r,
+                          u_fallback_blend);
+#else
     gl_FragColor.a *= texture2D(u_tex, v_tex_pos).r;
 #endif
+#endif
+    gl_FragColor = color_fx(gl_FragColor);
 }
 
 #endif
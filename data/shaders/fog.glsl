@@ -32,7 +32,7 @@ void main()
 
 void main()
 {
-    gl_FragColor = v_color;
+    gl_FragColor = color_fx(v_color);
 }
 
 #endif
@@ -75,6 +75,7 @@ void main()
 #ifdef FADE
     gl_FragColor.a *= v_alpha;
 #endif
+    gl_FragColor = color_fx(gl_FragColor);
 }
 
 #endif
@@ -64,7 +64,7 @@ void main()
 
 void main()
 {
-    gl_FragColor = u_color;
+    gl_FragColor = color_fx(u_color);
 }
 
 #endif
@@ -206,6 +206,7 @@ void main()
         lowp float illu = illumination(v_mpos);
         gl_FragColor.rgb *= illu;
     }
+    gl_FragColor = color_fx(gl_FragColor);
 }
 
 #endif
@@ -14,7 +14,13 @@ uniform lowp vec4 u_color;
 // 0 -> only halo (not supported), 1 -> no halo
 uniform lowp float u_core_size;
 
+#ifdef PICK
+// Id picking pass: the color carries an encoded object id that must
+// survive the roundtrip exactly.
+varying mediump vec4 v_color;
+#else
 varying lowp    vec4 v_color;
+#endif
 
 #ifdef VERTEX_SHADER
 
@@ -38,6 +44,11 @@ void main()
     mediump float k;
     dist = 2.0 * distance(gl_PointCoord, vec2(0.5, 0.5));
 
+#ifdef PICK
+    // Flat id color over the point disk, no shading.
+    if (dist > 1.0) discard;
+    gl_FragColor = v_color;
+#else
     // Center bright point.
     k = smoothstep(u_core_size * 1.25, u_core_size * 0.75, dist);
 
@@ -45,6 +56,8 @@ void main()
     k += smoothstep(1.0, 0.0, dist) * 0.08;
     gl_FragColor.rgb = v_color.rgb;
     gl_FragColor.a = v_color.a * clamp(k, 0.0, 1.0);
+    gl_FragColor = color_fx(gl_FragColor);
+#endif
 }
 
 #endif
@@ -0,0 +1,64 @@
+/* Stellarium Web Engine - Copyright (c) 2022 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+uniform   lowp      vec2    u_win_size;
+
+// Shape position in the local (unrotated) frame, in pixels.
+varying   mediump   vec2    v_pos;
+// x, y: shape half size (pixels), z: stroke width, w: number of dashes.
+varying   mediump   vec4    v_shape;
+varying   lowp      vec4    v_color;
+
+#ifdef VERTEX_SHADER
+
+attribute highp     vec2    a_pos;
+attribute mediump   vec2    a_tex_pos;
+attribute mediump   vec4    a_shape;
+attribute lowp      vec4    a_color;
+
+void main()
+{
+    gl_Position = vec4((a_pos / u_win_size - 0.5) * vec2(2.0, -2.0),
+                       0.0, 1.0);
+    v_pos = a_tex_pos;
+    v_shape = a_shape;
+    v_color = a_color;
+}
+
+#endif
+#ifdef FRAGMENT_SHADER
+
+void main()
+{
+    mediump vec2 size = v_shape.xy;
+    mediump float d;
+#ifdef RECT
+    // Signed distance to the rectangle border.
+    mediump vec2 q = abs(v_pos) - size;
+    d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0);
+#else
+    // Approximated signed distance to the ellipse border.
+    d = (length(v_pos / size) - 1.0) * min(size.x, size.y);
+#endif
+    // Antialiased stroke of width v_shape.z around the border.
+    mediump float alpha = 1.0 - smoothstep(v_shape.z * 0.5 - 0.7,
+                                           v_shape.z * 0.5 + 0.7, abs(d));
+#ifndef RECT
+    if (v_shape.w > 0.0) {
+        // Dash effect: modulate along the angular coordinate.
+        mediump float theta = atan(v_pos.y * size.x, v_pos.x * size.y);
+        alpha *= step(0.5, fract(theta / 6.28318530718 * v_shape.w));
+    }
+#endif
+    gl_FragColor = color_fx(v_color);
+    gl_FragColor.a *= alpha;
+    if (gl_FragColor.a == 0.0) discard;
+}
+
+#endif
@@ -0,0 +1,109 @@
+#!/usr/bin/nodejs
+
+// Scripted scenario benchmark (run with: make benchmark).
+//
+// Replays repeatable camera paths against the engine at a fixed 60 Hz
+// virtual clock and prints per scenario frame time percentiles as json,
+// so that two builds can be compared automatically.
+//
+// Under node there is no GL context, so what we time is the CPU side of
+// the frame (core_update_fov + core_observer_update + core_update):
+// ephemerides, module updates, faders...  The GPU side can be read from
+// the core 'gpu_times' attribute in a browser instead.
+
+var DT = 1 / 60;        // Virtual frame duration (s).
+var WARMUP = 60;        // Frames dropped at the start of each scenario.
+
+var frame = function(stel) {
+  var t0 = process.hrtime.bigint();
+  stel._core_update_fov(DT);
+  stel._core_observer_update();
+  stel._core_update(DT);
+  return Number(process.hrtime.bigint() - t0) / 1e6; // ms.
+};
+
+// Reset the observer to a fixed place and time so that the scenarios
+// don't depend on the wall clock.
+var setup = function(stel) {
+  stel.observer.utc = stel.date2MJD(Date.UTC(2009, 8, 6, 17, 0, 0));
+  stel.observer.longitude = -84.388 * stel.D2R;
+  stel.observer.latitude = 33.749 * stel.D2R;
+  stel.observer.yaw = 90 * stel.D2R;
+  stel.observer.pitch = 20 * stel.D2R;
+  stel.core.fov = 60 * stel.D2R;
+};
+
+var SCENARIOS = [
+  // Zoom from a wide field down to a cluster sized fov.
+  {
+    name: 'zoom_cluster',
+    frames: 600,
+    start: function(stel) {
+      stel.zoomTo(0.5 * stel.D2R, 8.0);
+    },
+  },
+  // Fast continuous pan at 60 deg/s.
+  {
+    name: 'fast_pan',
+    frames: 600,
+    step: function(stel) {
+      stel.observer.yaw += 60 * stel.D2R * DT;
+    },
+  },
+  // Time lapse: one simulated minute per frame, stresses the
+  // ephemerides updates.
+  {
+    name: 'time_lapse',
+    frames: 600,
+    step: function(stel) {
+      stel.observer.utc += 1 / (24 * 60);
+    },
+  },
+];
+
+var percentile = function(sorted, p) {
+  var i = Math.min(sorted.length - 1,
+                   Math.floor(sorted.length * p / 100));
+  return sorted[i];
+};
+
+var runScenario = function(stel, scenario) {
+  var i, times = [], sum = 0;
+  setup(stel);
+  if (scenario.start) scenario.start(stel);
+  for (i = 0; i < WARMUP + scenario.frames; i++) {
+    if (scenario.step) scenario.step(stel);
+    var t = frame(stel);
+    if (i < WARMUP) continue;
+    times.push(t);
+    sum += t;
+  }
+  times.sort(function(a, b) { return a - b; });
+  return {
+    frames: times.length,
+    mean_ms: sum / times.length,
+    p50_ms: percentile(times, 50),
+    p90_ms: percentile(times, 90),
+    p99_ms: percentile(times, 99),
+    max_ms: times[times.length - 1],
+  };
+};
+
+require('../build/stellarium-web-engine.js')({
+  wasmFile: '../build/stellarium-web-engine.wasm',
+  onReady: function(stel) {
+    var report = {
+      date: new Date().toISOString(),
+      dt: DT,
+      scenarios: {},
+    };
+    SCENARIOS.forEach(function(scenario) {
+      report.scenarios[scenario.name] = runScenario(stel, scenario);
+    });
+    // Ephemeris accuracy-versus-speed matrix (src/bench.c).
+    var ptr = stel._swe_bench_ephemeris();
+    report.ephemeris = JSON.parse(stel.UTF8ToString(ptr));
+    stel._free(ptr);
+    console.log(JSON.stringify(report, null, 2));
+  }
+});
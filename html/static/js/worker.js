@@ -0,0 +1,100 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+// Worker side of the OffscreenCanvas rendering mode (see worker-page.html
+// for the page side).  The engine runs entirely in this worker: heavy
+// frames cannot block the page, and page jank cannot stall the engine.
+//
+// Protocol (page -> worker):
+//   {type: 'init', canvas, wasmFile, width, height, dpr, baseUrl}
+//   {type: 'resize', width, height, dpr}
+//   {type: 'mouse', id, state, x, y}       // Same args as core_on_mouse.
+//   {type: 'zoom', k, x, y}                // Same args as core_on_zoom.
+//   {type: 'set', path, value}             // stel.setValue.
+//   {type: 'watch', path}                  // Register a snapshot watch.
+//
+// Worker -> page:
+//   {type: 'ready'}
+//   {type: 'values', values: {path: value, ...}}  // Changed watches only.
+//
+// The watched attributes go through the snapshot buffer (Module.snapshot):
+// they are read once per frame on this side without json conversion, and
+// only the changed ones are posted back, so the page never polls across
+// the worker boundary.
+
+var stel = null;
+var watches = {}; // path -> snapshot handle.
+var pending = []; // Messages received before the engine is ready.
+
+function getObjAttr(path) {
+  var elems = ('core.' + path).split('.');
+  var attr = elems.pop();
+  return {obj: stel.getModule(elems.join('.')), attr: attr};
+}
+
+function onFrame() {
+  var path, changed = null;
+  for (path in watches) {
+    if (!watches[path].changed()) continue;
+    changed = changed || {};
+    changed[path] = watches[path].get();
+  }
+  if (changed) postMessage({type: 'values', values: changed});
+}
+
+function handle(msg) {
+  var t;
+  // The render loop may be idling on a static scene (power saving): any
+  // message from the page is a reason to render again.
+  if (stel.wake) stel.wake();
+  switch (msg.type) {
+  case 'resize':
+    stel.canvasSize = {width: msg.width, height: msg.height, dpr: msg.dpr};
+    break;
+  case 'mouse':
+    stel._core_on_mouse(msg.id, msg.state, msg.x, msg.y);
+    break;
+  case 'zoom':
+    stel._core_on_zoom(msg.k, msg.x, msg.y);
+    break;
+  case 'set':
+    stel.setValue(msg.path, msg.value);
+    break;
+  case 'watch':
+    t = getObjAttr(msg.path);
+    t = stel.snapshot(t.obj, t.attr);
+    if (t) watches[msg.path] = t;
+    else console.warn('cannot watch ' + msg.path);
+    break;
+  }
+}
+
+onmessage = function(e) {
+  var msg = e.data;
+  if (msg.type !== 'init') {
+    if (!stel) pending.push(msg);
+    else handle(msg);
+    return;
+  }
+  // The glue script must match the wasm artifact (simd or -nosimd
+  // fallback): derive it from the wasm file the page selected.
+  importScripts(msg.wasmFile.replace(/\.wasm$/, '.js'));
+  StelWebEngine({
+    wasmFile: msg.wasmFile,
+    canvas: msg.canvas,
+    canvasSize: {width: msg.width, height: msg.height, dpr: msg.dpr},
+    onReady: function(s) {
+      stel = s;
+      stel.onBeforeRendering = onFrame;
+      pending.forEach(handle);
+      pending = [];
+      postMessage({type: 'ready'});
+    }
+  });
+};
@@ -20,6 +20,12 @@ void healpix_get_mat3(int nside, int pix, double out[3][3]);
 /* Compute position from healpix xy coordinates. */
 void healpix_xy2vec(const double xy[2], double out[3]);
 
+/* Batch version of healpix_xy2vec: convert n xy coordinates in a single
+ * call, so the trigonometry loop can stay in registers and the call
+ * overhead is paid once.  Used by the tile tessellation and traversal
+ * clipping paths, which convert thousands of points per frame. */
+void healpix_xy2vec_n(int n, const double (*xy)[2], double (*out)[3]);
+
 /* Convert healpix xyf coordinate to a nest pix index. */
 int healpix_xyf2nest(int nside, int ix, int iy, int face_num);
 
@@ -29,6 +35,10 @@ int healpix_nest2xyf(int nside, int pix, int *ix, int *iy, int *face_num);
 /* Convert healpix nest index to cartesian 3d vector. */
 void healpix_pix2vec(int nside, int pix, double out[3]);
 
+/* Batch version of healpix_pix2vec, with the nside dependent constants
+ * hoisted out of the loop. */
+void healpix_pix2vec_n(int nside, int n, const int *pix, double (*out)[3]);
+
 /* Convert healpix nest index to polar angle. */
 void healpix_pix2ang(int nside, int pix, double *theta, double *phi);
 
@@ -70,12 +80,16 @@ void healpix_get_bounding_cap(int nside, int pix, double out[4]);
  *
  * inputs:
  *   jde: Julian ephemeris day.
+ *   prec: tolerated error on the apparent position (rad): the series
+ *     terms whose amplitude falls below it are skipped.  Pass 0 for a
+ *     full evaluation.
  * outputs
  *   lambda: geocentric longitude (mean equinox and ecliptic).
  *   beta: gecentric latitude (mean equinox and ecliptic).
  *   dist: distance to earth center (AU).
  */
-int moon_pos(double jde, double *lambda, double *beta, double *dist);
+int moon_pos(double jde, double prec, double *lambda, double *beta,
+             double *dist);
 
 
 /* Compute delta-t
@@ -169,8 +183,11 @@ void refraction_prepare(double phpa, double tc, double rh,
 /* Galilean satellites positions using l1.2 semi-analytic theory by
  * L.Duriez.
  * ftp://ftp.imcce.fr/pub/ephem/satel/galilean/L1/L1.2/
+ *
+ * prec is the tolerated position error (AU): the series terms whose
+ * amplitude falls below it are skipped.  Pass 0 for a full evaluation.
  */
-int l12(double tt1, double tt2, int ks, double pv[2][3]);
+int l12(double tt1, double tt2, int ks, double prec, double pv[2][3]);
 
 /*
  * Find which constellation a point is located in.
@@ -223,6 +240,68 @@ int orbit_compute_pv(
         double od,        // variation of o in time (rad/day).
         double wd);       // variation of w in time (rad/day).
 
+/*
+ * Function: orbit_compute_pv_n
+ * Batched version of <orbit_compute_pv> over structure-of-arrays
+ * element inputs.  The eccentric anomaly iteration runs as sweeps
+ * across all the still unconverged orbits so that the inner loops can
+ * be vectorized.  The od/wd element variations are not supported.
+ */
+int orbit_compute_pv_n(
+        double precision, int nb, double mjd,
+        double (*pos)[3], double (*speed)[3],
+        const double *d, const double *i, const double *o,
+        const double *w, const double *a, const double *n,
+        const double *e, const double *ma);
+
+// Number of Chebyshev coefficients of an orbit interpolant segment.
+#define ORBIT_CHEB_DEG 8
+
+/*
+ * Type: orbit_cheb_t
+ * Short Chebyshev interpolant of a position function, used to cache
+ * repeated orbit computations at nearby times: fit a segment around the
+ * current time on the first query, evaluate the polynomials thereafter,
+ * refit when the time exits the segment.
+ */
+typedef struct orbit_cheb {
+    double start;   // Start time of the segment (MJD).
+    double days;    // Duration of the segment (0 if empty).
+    double coefs[3][ORBIT_CHEB_DEG];
+} orbit_cheb_t;
+
+/*
+ * Function: orbit_cheb_fit
+ * Fit a Chebyshev interpolant segment over a position function.
+ *
+ * Parameters:
+ *   cheb  - The segment to fit.
+ *   start - Start time of the segment (MJD).
+ *   days  - Duration of the segment.
+ *   fn    - Position function, evaluated at the Chebyshev nodes of the
+ *           range.
+ *   user  - Passed to fn.
+ */
+void orbit_cheb_fit(orbit_cheb_t *cheb, double start, double days,
+                    void (*fn)(double mjd, double pos[3], void *user),
+                    void *user);
+
+/*
+ * Function: orbit_cheb_eval
+ * Evaluate a fitted interpolant segment.
+ *
+ * Parameters:
+ *   mjd   - Time of the evaluation (MJD).
+ *   pos   - Output position.
+ *   speed - Output speed (unit per day).  Can be NULL.
+ *
+ * Return:
+ *   false if the time falls outside of the segment (or the segment is
+ *   empty), in which case the caller should refit.
+ */
+bool orbit_cheb_eval(const orbit_cheb_t *cheb, double mjd,
+                     double pos[3], double speed[3]);
+
 /*
  * Function: orbit_elements_from_pv
  * Compute Kepler orbit element from a body positon and speed.
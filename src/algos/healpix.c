@@ -166,14 +166,23 @@ void healpix_xy2ang(const double xy[2], double *theta, double *phi)
     *theta = acos(z);
 }
 
-void healpix_xy2vec(const double xy[2], double out[3])
+void healpix_xy2vec_n(int n, const double (*xy)[2], double (*out)[3])
 {
     double z, phi, stheta;
-    healpix_xy2_z_phi(xy, &z, &phi);
-    stheta = sqrt((1 - z) * (1 + z));
-    out[0] = stheta * cos(phi);
-    out[1] = stheta * sin(phi);
-    out[2] = z;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        healpix_xy2_z_phi(xy[i], &z, &phi);
+        stheta = sqrt((1 - z) * (1 + z));
+        out[i][0] = stheta * cos(phi);
+        out[i][1] = stheta * sin(phi);
+        out[i][2] = z;
+    }
+}
+
+void healpix_xy2vec(const double xy[2], double out[3])
+{
+    healpix_xy2vec_n(1, (const double (*)[2])xy, (double (*)[3])out);
 }
 
 void healpix_xyf2vec(int nside, int x, int y, int f, double out[3])
@@ -194,6 +203,23 @@ void healpix_pix2vec(int nside, int pix, double out[3])
     healpix_xy2vec(xy, out);
 }
 
+void healpix_pix2vec_n(int nside, int n, const int *pix, double (*out)[3])
+{
+    const double s = M_PI / 4 / nside; // Hoisted out of the loop.
+    double xy[64][2];
+    int i, j, chunk, ix, iy, face;
+
+    for (i = 0; i < n; i += chunk) {
+        chunk = n - i < 64 ? n - i : 64;
+        for (j = 0; j < chunk; j++) {
+            healpix_nest2xyf(nside, pix[i + j], &ix, &iy, &face);
+            xy[j][0] = FACES[face][0] * (M_PI / 4) + (ix - iy) * s;
+            xy[j][1] = FACES[face][1] * (M_PI / 4) + (ix + iy + 1) * s;
+        }
+        healpix_xy2vec_n(chunk, xy, out + i);
+    }
+}
+
 void healpix_pix2ang(int nside, int pix, double *theta, double *phi)
 {
     int ix, iy, face;
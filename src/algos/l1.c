@@ -87,7 +87,7 @@ static int elem2pv(double mu, const double elem[6], double xv[2][3])
     return 0;
 }
 
-int l12(double tt1, double tt2, int ks, double pv[2][3])
+int l12(double tt1, double tt2, int ks, double prec, double pv[2][3])
 {
     // rotations from jovian equatorial coordinates to Earth mean equinox
     // and equator J2000 : angles Psi and I (rd)
@@ -95,7 +95,7 @@ int l12(double tt1, double tt2, int ks, double pv[2][3])
     const double ainc = 0.4450947364976650E+00;
 
     const struct sat *sat = &SATS[ks - 1];
-    double t, arg, s, s1, s2;
+    double t, arg, s, s1, s2, ang_prec;
     double elem[6];
     double val[5] = {0.0};
     double xv[2][3], xve[2][3];
@@ -103,8 +103,16 @@ int l12(double tt1, double tt2, int ks, double pv[2][3])
 
     t = tt1 - T0 + tt2;
 
+    // The term tables are sorted by decreasing amplitude, so we can
+    // stop each series at the first term below the requested precision.
+    // The a series is in AU; the l, z and zeta series are angles or
+    // dimensionless eccentricity/inclination terms, whose effect on the
+    // position scales with the orbit radius (the constant first a term).
+    ang_prec = prec / sat->a[0].ampl;
+
     s = 0.0;
     for (k = 0; k < sat->a_len; k++) {
+        if (fabs(sat->a[k].ampl) < prec) break;
         arg = sat->a[k].phas + sat->a[k].freq * t;
         s += sat->a[k].ampl * cos(arg);
     }
@@ -112,6 +120,7 @@ int l12(double tt1, double tt2, int ks, double pv[2][3])
 
     s = sat->al[0] + sat->al[1] * t;
     for (k = 0; k < sat->l_len; k++) {
+        if (fabs(sat->l[k].ampl) < ang_prec) break;
         arg = sat->l[k].phas + sat->l[k].freq * t;
         s += sat->l[k].ampl * sin(arg);
     }
@@ -122,6 +131,7 @@ int l12(double tt1, double tt2, int ks, double pv[2][3])
     s1 = 0.0;
     s2 = 0.0;
     for (k = 0; k < sat->z_len; k++) {
+        if (fabs(sat->z[k].ampl) < ang_prec) break;
         arg = sat->z[k].phas + sat->z[k].freq * t;
         s1 += sat->z[k].ampl * cos(arg);
         s2 += sat->z[k].ampl * sin(arg);
@@ -132,6 +142,7 @@ int l12(double tt1, double tt2, int ks, double pv[2][3])
     s1 = 0.0;
     s2 = 0.0;
     for (k = 0; k < sat->zeta_len; k++) {
+        if (fabs(sat->zeta[k].ampl) < ang_prec) break;
         arg = sat->zeta[k].phas + sat->zeta[k].freq * t;
         s1 += sat->zeta[k].ampl * cos(arg);
         s2 += sat->zeta[k].ampl * sin(arg);
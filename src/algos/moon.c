@@ -16,6 +16,7 @@
  */
 
 #include <math.h>
+#include <stdbool.h>
 #include <stdlib.h>
 
 #define NB_TERMS 60
@@ -28,8 +29,10 @@ static const int PERIODIC_TERMS_LATITUDE[NB_TERMS][5];
 static inline double sina(double x) {return sin(x * DD2R);}
 static inline double cosa(double x) {return cos(x * DD2R);}
 
-// JDE: julian ephemeris day
-int moon_pos(double jde, double *lambda, double *beta, double *dist)
+// Full series evaluation.  prec is the tolerated error on the apparent
+// position (rad): terms whose amplitude falls below it are skipped.
+static void moon_pos_full(double jde, double prec,
+                          double *lambda, double *beta, double *dist)
 {
     double t;                   // Time in Julian Centuries.
     double t2, t3, t4;
@@ -42,6 +45,7 @@ int moon_pos(double jde, double *lambda, double *beta, double *dist)
     double a1, a2, a3;
     double sl, sr, sb;
     double e, e2;
+    double lprec, rprec;
     int i;
     const int *pt;
     double term_l, term_r, term_b;
@@ -77,16 +81,29 @@ int moon_pos(double jde, double *lambda, double *beta, double *dist)
     e = 1 - 0.002516 * t - 0.0000074 * t2;
     e2 = e * e;
 
+    // Per term truncation thresholds.  The longitude and latitude
+    // amplitudes are in 1e-6 degree; the radius ones are in meters and
+    // only affect the apparent position through the parallax
+    // (~4e-11 rad per meter).  The tables are sorted by decreasing
+    // longitude/latitude amplitude, but the radius column is not, so
+    // the first loop tests each term instead of breaking.
+    lprec = prec / (1e-6 * DD2R);
+    rprec = prec / 4e-11;
+
     sl = sr = sb = 0;
     for (i = 0; i < NB_TERMS; i++) {
         pt = (const int*)&PERIODIC_TERMS_LONG_RADIUS[i];
+        if (abs(pt[4]) < lprec && abs(pt[5]) < rprec) continue;
         term_l = pt[4] * sina(pt[0] * d + pt[1] * m + pt[2] * mp + pt[3] * f);
         term_r = pt[5] * cosa(pt[0] * d + pt[1] * m + pt[2] * mp + pt[3] * f);
         if (abs(pt[1]) == 1) {term_l *= e; term_r *= e;}
         if (abs(pt[1]) == 2) {term_l *= e2; term_r *= e2;}
         sl += term_l;
         sr += term_r;
+    }
+    for (i = 0; i < NB_TERMS; i++) {
         pt = (const int*)&PERIODIC_TERMS_LATITUDE[i];
+        if (abs(pt[4]) < lprec) break;
         term_b = pt[4] * sina(pt[0] * d + pt[1] * m + pt[2] * mp + pt[3] * f);
         if (abs(pt[1]) == 1) term_b *= e;
         if (abs(pt[2]) == 2) term_b *= e2;
@@ -102,6 +119,96 @@ int moon_pos(double jde, double *lambda, double *beta, double *dist)
     *dist = 385000.56 + sr / 1000;
 
     // XXX: Add nutation correction?
+}
+
+/*
+ * Interpolation cache: over a one hour window the position is extremely
+ * smooth, so we fit Chebyshev polynomials once and serve the frame to
+ * frame evaluations with a cheap Clenshaw evaluation.  Eight
+ * coefficients keep the fit error below a micro arcsecond.
+ */
+#define INTERP_NB 8             // Number of Chebyshev coefficients.
+#define INTERP_SPAN (1. / 24)   // Validity window span (day).
+
+// Two slots, because the callers evaluate at two epochs per frame (the
+// position and a shifted time for the finite difference speed), which
+// would otherwise rebuild a single window twice per frame.
+static struct interp {
+    bool    ready;
+    double  prec;           // Precision the fit was built at (rad).
+    double  t0, t1;         // Validity window (jde).
+    double  c[3][INTERP_NB]; // lambda, beta, dist coefficients.
+} g_interps[2] = {};
+static int g_interp_last = 0;
+
+// Evaluate sum c[j] * T_j(x) (first coefficient halved).
+static double clenshaw(const double c[INTERP_NB], double x)
+{
+    double b0 = 0, b1 = 0, b2;
+    int j;
+    for (j = INTERP_NB - 1; j >= 1; j--) {
+        b2 = b1;
+        b1 = b0;
+        b0 = 2 * x * b1 - b2 + c[j];
+    }
+    return x * b0 - b1 + c[0] / 2;
+}
+
+static const struct interp *interp_update(double jde, double prec)
+{
+    double mid, half, x, f[3][INTERP_NB];
+    struct interp *p;
+    int j, k, s;
+
+    for (k = 0; k < 2; k++) {
+        p = &g_interps[k];
+        if (p->ready && p->prec <= prec && jde >= p->t0 && jde <= p->t1)
+            return p;
+    }
+
+    // Fit the window [jde, jde + INTERP_SPAN], so that advancing time
+    // stays inside it as long as possible.
+    g_interp_last = (g_interp_last + 1) % 2;
+    p = &g_interps[g_interp_last];
+    mid = jde + INTERP_SPAN / 2;
+    half = INTERP_SPAN / 2;
+    for (k = 0; k < INTERP_NB; k++) {
+        x = cos(M_PI * (k + 0.5) / INTERP_NB);
+        moon_pos_full(mid + half * x, prec, &f[0][k], &f[1][k], &f[2][k]);
+        // Keep the longitude continuous across the window.
+        if (k > 0) {
+            while (f[0][k] - f[0][k - 1] > M_PI) f[0][k] -= 2 * M_PI;
+            while (f[0][k] - f[0][k - 1] < -M_PI) f[0][k] += 2 * M_PI;
+        }
+    }
+    for (s = 0; s < 3; s++) {
+        for (j = 0; j < INTERP_NB; j++) {
+            p->c[s][j] = 0;
+            for (k = 0; k < INTERP_NB; k++) {
+                p->c[s][j] += 2.0 / INTERP_NB * f[s][k] *
+                              cos(M_PI * j * (k + 0.5) / INTERP_NB);
+            }
+        }
+    }
+    p->t0 = jde;
+    p->t1 = jde + INTERP_SPAN;
+    p->prec = prec;
+    p->ready = true;
+    return p;
+}
+
+// JDE: julian ephemeris day
+int moon_pos(double jde, double prec, double *lambda, double *beta,
+             double *dist)
+{
+    const struct interp *p;
+    double x;
+
+    p = interp_update(jde, prec);
+    x = (jde - (p->t0 + p->t1) / 2) / ((p->t1 - p->t0) / 2);
+    *lambda = clenshaw(p->c[0], x);
+    *beta = clenshaw(p->c[1], x);
+    *dist = clenshaw(p->c[2], x);
     return 0;
 }
 
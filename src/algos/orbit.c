@@ -8,6 +8,10 @@
  */
 
 #include <math.h>
+#include <stdbool.h>
+
+#include "algos.h"
+
 #define PI (3.141592653589793238462643)
 
 static void vec3_cross(const double a[3], const double b[3], double out[3])
@@ -125,6 +129,119 @@ int orbit_compute_pv(
     return 0;
 }
 
+/*
+ * Function: orbit_compute_pv_n
+ * Compute positions and speeds for a batch of orbits.
+ *
+ * Same math as <orbit_compute_pv>, but over structure-of-arrays element
+ * inputs, with the eccentric anomaly iteration running as sweeps across
+ * all the still unconverged orbits so that the compiler can vectorize
+ * the inner loops.  The od/wd element variations are not supported (the
+ * batched callers all pass zero to the scalar version).
+ *
+ * Parameters:
+ *   precision - Precision of the kepler iteration (rad), 0 to use the
+ *               fast closed form approximation.
+ *   nb     - Number of orbits.
+ *   mjd    - Time of the positions (MJD).
+ *   pos    - Output positions.
+ *   speed  - Output speeds (can be NULL).
+ *   d, i, o, w, a, n, e, ma - Element arrays, as in <orbit_compute_pv>.
+ */
+int orbit_compute_pv_n(
+        double precision, int nb, double mjd,
+        double (*pos)[3], double (*speed)[3],
+        const double *d, const double *i, const double *o,
+        const double *w, const double *a, const double *n,
+        const double *e, const double *ma)
+{
+    double m[64], v[64];
+    char conv[64];
+    double ek, e0, de, ae2, r, u, rdot, rfdot;
+    int k, k0, chunk, iter;
+    int done;
+
+    for (k0 = 0; k0 < nb; k0 += 64) {
+        chunk = nb - k0 < 64 ? nb - k0 : 64;
+
+        // Mean anomalies.
+        for (k = 0; k < chunk; k++) {
+            m[k] = fmod(n[k0 + k] * (mjd - d[k0 + k]) + ma[k0 + k],
+                        2.0 * PI);
+        }
+
+        if (precision == 0.0) {
+            // Closed form approximation of the true anomaly.
+            for (k = 0; k < chunk; k++) {
+                ek = e[k0 + k];
+                v[k] = m[k] + ((2.0 * ek - pow(ek, 3) / 4) * sin(m[k]) +
+                        5.0 / 4 * pow(ek, 2) * sin(2 * m[k]) +
+                        13.0 / 12 * pow(ek, 3) * sin(3 * m[k]));
+            }
+        } else {
+            // Newton iteration, swept across all unconverged lanes.
+            // v holds the eccentric anomaly until the last loop.
+            for (k = 0; k < chunk; k++) {
+                ek = e[k0 + k];
+                v[k] = m[k] + ek * sin(m[k]) * (1.0 + ek * cos(m[k]));
+                conv[k] = 0;
+            }
+            for (iter = 0; iter < 32; iter++) {
+                done = 1;
+                for (k = 0; k < chunk; k++) {
+                    if (conv[k]) continue;
+                    ek = e[k0 + k];
+                    e0 = v[k];
+                    de = (e0 - ek * sin(e0) - m[k]) /
+                         (1.0 - ek * cos(e0));
+                    v[k] = e0 - de;
+                    if (fabs(de) <= precision) conv[k] = 1;
+                    else done = 0;
+                }
+                if (done) break;
+            }
+            for (k = 0; k < chunk; k++) {
+                ek = e[k0 + k];
+                ae2 = v[k] / 2.0;
+                v[k] = 2.0 * atan2(sqrt((1.0 + ek) / (1.0 - ek)) * sin(ae2),
+                                   cos(ae2));
+            }
+        }
+
+        for (k = 0; k < chunk; k++) {
+            ek = e[k0 + k];
+            r = a[k0 + k] * (1 - pow(ek, 2)) / (1 + ek * cos(v[k]));
+            u = v[k] + w[k0 + k];
+            pos[k0 + k][0] = r * (cos(o[k0 + k]) * cos(u) -
+                    sin(o[k0 + k]) * sin(u) * cos(i[k0 + k]));
+            pos[k0 + k][1] = r * (sin(o[k0 + k]) * cos(u) +
+                    cos(o[k0 + k]) * sin(u) * cos(i[k0 + k]));
+            pos[k0 + k][2] = r * (sin(u) * sin(i[k0 + k]));
+        }
+
+        if (!speed) continue;
+        for (k = 0; k < chunk; k++) {
+            ek = e[k0 + k];
+            u = v[k] + w[k0 + k];
+            rdot = n[k0 + k] * a[k0 + k] * (ek * sin(v[k])) /
+                   sqrt(1.0 - ek * ek);
+            rfdot = n[k0 + k] * a[k0 + k] * (1.0 + ek * cos(v[k])) /
+                    sqrt(1.0 - ek * ek);
+            speed[k0 + k][0] = rdot * (cos(u) * cos(o[k0 + k]) -
+                    sin(u) * sin(o[k0 + k]) * cos(i[k0 + k])) +
+                    rfdot * (-sin(u) * cos(o[k0 + k]) -
+                    cos(u) * sin(o[k0 + k]) * cos(i[k0 + k]));
+            speed[k0 + k][1] = rdot * (cos(u) * sin(o[k0 + k]) +
+                    sin(u) * cos(o[k0 + k]) * cos(i[k0 + k])) +
+                    rfdot * (-sin(u) * sin(o[k0 + k]) +
+                    cos(u) * cos(o[k0 + k]) * cos(i[k0 + k]));
+            speed[k0 + k][2] = rdot * (sin(u) * sin(i[k0 + k])) +
+                    rfdot * (cos(u) * sin(i[k0 + k]));
+        }
+    }
+    return 0;
+}
+
 /*
  * Function: orbit_elements_from_pv
  * Compute Kepler orbit element from a body positon and speed.
@@ -228,3 +345,72 @@ int orbit_elements_from_pv(const double p[3], const double v[3], double mu,
 
     return 0;
 }
+
+/*
+ * Function: orbit_cheb_fit
+ * Fit a Chebyshev interpolant segment over a position function.
+ */
+void orbit_cheb_fit(orbit_cheb_t *cheb, double start, double days,
+                    void (*fn)(double mjd, double pos[3], void *user),
+                    void *user)
+{
+    const int n = ORBIT_CHEB_DEG;
+    double samples[ORBIT_CHEB_DEG][3];
+    double x, c;
+    int j, k, s;
+
+    for (k = 0; k < n; k++) {
+        x = cos(PI * (k + 0.5) / n);
+        fn(start + days * (x + 1) / 2, samples[k], user);
+    }
+    // Discrete cosine transform of the node samples, with the usual
+    // halving of the first coefficient so that the evaluation can use
+    // the plain sum convention.
+    for (s = 0; s < 3; s++) {
+        for (j = 0; j < n; j++) {
+            c = 0;
+            for (k = 0; k < n; k++)
+                c += samples[k][s] * cos(PI * j * (k + 0.5) / n);
+            c *= 2.0 / n;
+            if (j == 0) c /= 2;
+            cheb->coefs[s][j] = c;
+        }
+    }
+    cheb->start = start;
+    cheb->days = days;
+}
+
+/*
+ * Function: orbit_cheb_eval
+ * Evaluate a fitted interpolant segment.  Return false if the time
+ * falls outside of the segment.
+ */
+bool orbit_cheb_eval(const orbit_cheb_t *cheb, double mjd,
+                     double pos[3], double speed[3])
+{
+    double x, xd, b1, b2, d1, d2, tmp, dtmp;
+    const double *c;
+    int s, j;
+
+    if (cheb->days == 0 || mjd < cheb->start ||
+            mjd > cheb->start + cheb->days)
+        return false;
+    x = 2 * (mjd - cheb->start) / cheb->days - 1;
+    xd = 2 / cheb->days; // dx/dt, to get the speed in unit per day.
+    // Clenshaw recurrence computing both the value and the derivative.
+    for (s = 0; s < 3; s++) {
+        c = cheb->coefs[s];
+        b1 = b2 = d1 = d2 = 0;
+        for (j = ORBIT_CHEB_DEG - 1; j >= 1; j--) {
+            tmp = b1;
+            dtmp = d1;
+            b1 = 2 * x * b1 - b2 + c[j];
+            d1 = 2 * tmp + 2 * x * d1 - d2;
+            b2 = tmp;
+            d2 = dtmp;
+        }
+        pos[s] = x * b1 - b2 + c[0];
+        if (speed) speed[s] = (b1 + x * d1 - d2) * xd;
+    }
+    return true;
+}
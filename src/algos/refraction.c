@@ -38,27 +38,22 @@ void refraction_prepare(double phpa, double tc, double rh,
     *refb = tc;
 }
 
-void refraction(const double v[3], double pressure, double temperature,
-                double out[3])
-{
-    // The following 2 variables are set according to Georg Zotti comment in
-    // original Stellarium code, so that nothing happens below -5 degrees.
-
-    // This must be -5 or higher.
-    static const float MIN_GEO_ALTITUDE_DEG = -3.54f;
-    // This must be positive. Transition zone goes that far below the values
-    // just specified.
-    static const float TRANSITION_WIDTH_GEO_DEG = 1.46f;
-    // Hopefully, the compiler pre-compute this
-    const float min_sinalt = sinf(MIN_GEO_ALTITUDE_DEG * DD2R -
-                                         TRANSITION_WIDTH_GEO_DEG * DD2R);
+// The following 2 variables are set according to Georg Zotti comment in
+// original Stellarium code, so that nothing happens below -5 degrees.
 
-    assert(vec3_is_normalized(v));
-    vec3_copy(v, out);
-    if (v[2] < min_sinalt)
-        return;
+// This must be -5 or higher.
+static const float MIN_GEO_ALTITUDE_DEG = -3.54f;
+// This must be positive. Transition zone goes that far below the values
+// just specified.
+static const float TRANSITION_WIDTH_GEO_DEG = 1.46f;
 
-    double geom_alt_deg = asin(v[2]) / DD2R;
+/*
+ * The trig heavy model itself: map the z coordinate (sin of the
+ * geometric altitude) to the refracted z, before renormalization.
+ */
+static double refract_z(double z, double pressure, double temperature)
+{
+    double geom_alt_deg = asin(z) / DD2R;
 
     const double p_saemundson = 1.02 * pressure / 1010. * 283. /
                          (273. + temperature) / 60.;
@@ -70,7 +65,7 @@ void refraction(const double v[3], double pressure, double temperature,
         geom_alt_deg += r;
         if (geom_alt_deg > 90.)
             geom_alt_deg = 90.;
-        out[2] = sin(geom_alt_deg * DD2R);
+        return sin(geom_alt_deg * DD2R);
     }
     else if (geom_alt_deg > MIN_GEO_ALTITUDE_DEG - TRANSITION_WIDTH_GEO_DEG)
     {
@@ -80,8 +75,63 @@ void refraction(const double v[3], double pressure, double temperature,
                      (MIN_GEO_ALTITUDE_DEG + 5.11)) * DD2R) + 0.0019279;
         geom_alt_deg += r_m5 * (geom_alt_deg - (MIN_GEO_ALTITUDE_DEG -
                         TRANSITION_WIDTH_GEO_DEG)) / TRANSITION_WIDTH_GEO_DEG;
-        out[2] = sin(geom_alt_deg * DD2R);
+        return sin(geom_alt_deg * DD2R);
+    }
+    return z;
+}
+
+/*
+ * Since refraction only depends on the altitude, we tabulate refract_z
+ * once per pressure/temperature change and the per object cost becomes
+ * a linear interpolation.  2048 samples over the ~95 degrees range keep
+ * the interpolation error well below an arcsecond.
+ */
+#define REFRACTION_TABLE_SIZE 2048
+
+static struct {
+    bool    ready;
+    double  pressure;
+    double  temperature;
+    double  zmin;   // z of the first sample.
+    double  step;   // z increment between two samples.
+    double  z[REFRACTION_TABLE_SIZE];
+} g_table = {};
+
+static void refraction_table_update(double pressure, double temperature)
+{
+    int i;
+    if (g_table.ready && g_table.pressure == pressure &&
+            g_table.temperature == temperature)
+        return;
+    g_table.zmin = sinf(MIN_GEO_ALTITUDE_DEG * DD2R -
+                        TRANSITION_WIDTH_GEO_DEG * DD2R);
+    g_table.step = (1.0 - g_table.zmin) / (REFRACTION_TABLE_SIZE - 1);
+    for (i = 0; i < REFRACTION_TABLE_SIZE; i++) {
+        g_table.z[i] = refract_z(g_table.zmin + i * g_table.step,
+                                 pressure, temperature);
     }
+    g_table.pressure = pressure;
+    g_table.temperature = temperature;
+    g_table.ready = true;
+}
+
+void refraction(const double v[3], double pressure, double temperature,
+                double out[3])
+{
+    double t;
+    int i;
+
+    assert(vec3_is_normalized(v));
+    vec3_copy(v, out);
+    refraction_table_update(pressure, temperature);
+    if (v[2] < g_table.zmin)
+        return;
+
+    t = (v[2] - g_table.zmin) / g_table.step;
+    i = (int)t;
+    if (i > REFRACTION_TABLE_SIZE - 2) i = REFRACTION_TABLE_SIZE - 2;
+    t -= i;
+    out[2] = g_table.z[i] * (1.0 - t) + g_table.z[i + 1] * t;
     vec3_normalize(out, out);
 }
 
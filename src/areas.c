@@ -27,11 +27,70 @@ struct item
     uint64_t hint;
 };
 
+/*
+ * The items are indexed by a uniform screen grid (by bounding box), so
+ * that the mouse lookups only scan the shapes of one neighborhood
+ * instead of the whole list.  Shapes covering too many cells go to a
+ * small overflow list that is always scanned.  All the arrays keep
+ * their allocation when cleared, so the per frame rebuild doesn't
+ * allocate in steady state.
+ */
+#define CELL_SIZE 128
+#define GRID_W 32
+#define GRID_H 32
+#define MAX_CELLS 64 // Above this an item goes to the overflow list.
+
 struct areas
 {
     UT_array *items;
+    int heads[GRID_W * GRID_H]; // Head node of each cell (-1 if empty).
+    struct {
+        int item;
+        int next;
+    } *nodes;
+    int nb_nodes, nodes_allocated;
+    int *overflow;
+    int nb_overflow, overflow_allocated;
 };
 
+static void cell_range(const double pos[2], double r,
+                       int *x0, int *y0, int *x1, int *y1)
+{
+    *x0 = clamp((int)((pos[0] - r) / CELL_SIZE), 0, GRID_W - 1);
+    *y0 = clamp((int)((pos[1] - r) / CELL_SIZE), 0, GRID_H - 1);
+    *x1 = clamp((int)((pos[0] + r) / CELL_SIZE), 0, GRID_W - 1);
+    *y1 = clamp((int)((pos[1] + r) / CELL_SIZE), 0, GRID_H - 1);
+}
+
+// Insert the last pushed item into the grid.
+static void grid_add(areas_t *areas, const item_t *item)
+{
+    int x, y, x0, y0, x1, y1, idx;
+
+    idx = utarray_len(areas->items) - 1;
+    cell_range(item->pos, max(item->a, item->b), &x0, &y0, &x1, &y1);
+    if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS) {
+        if (areas->nb_overflow == areas->overflow_allocated) {
+            areas->overflow_allocated += 32;
+            areas->overflow = realloc(areas->overflow,
+                    areas->overflow_allocated * sizeof(*areas->overflow));
+        }
+        areas->overflow[areas->nb_overflow++] = idx;
+        return;
+    }
+    for (y = y0; y <= y1; y++)
+    for (x = x0; x <= x1; x++) {
+        if (areas->nb_nodes == areas->nodes_allocated) {
+            areas->nodes_allocated += 256;
+            areas->nodes = realloc(areas->nodes,
+                    areas->nodes_allocated * sizeof(*areas->nodes));
+        }
+        areas->nodes[areas->nb_nodes].item = idx;
+        areas->nodes[areas->nb_nodes].next = areas->heads[y * GRID_W + x];
+        areas->heads[y * GRID_W + x] = areas->nb_nodes++;
+    }
+}
+
 /*
  * Compute the signed distance between a point and the closest point on an
  * ellipse.
@@ -62,6 +121,7 @@ areas_t *areas_create(void)
     areas_t *areas;
     areas = calloc(1, sizeof(*areas));
     utarray_new(areas->items, &item_icd);
+    memset(areas->heads, 0xff, sizeof(areas->heads)); // All -1.
     return areas;
 }
 
@@ -74,6 +134,7 @@ void areas_add_circle(areas_t *areas, const double pos[2], double r,
     item.oid = oid;
     item.hint = hint;
     utarray_push_back(areas->items, &item);
+    grid_add(areas, &item);
 }
 
 void areas_add_ellipse(areas_t *areas, const double pos[2], double angle,
@@ -88,11 +149,16 @@ void areas_add_ellipse(areas_t *areas, const double pos[2], double angle,
     item.oid = oid;
     item.hint = hint;
     utarray_push_back(areas->items, &item);
+    grid_add(areas, &item);
 }
 
 void areas_clear_all(areas_t *areas)
 {
+    // Note: utarray_clear and the grid arrays keep their allocations.
     utarray_clear(areas->items);
+    memset(areas->heads, 0xff, sizeof(areas->heads)); // All -1.
+    areas->nb_nodes = 0;
+    areas->nb_overflow = 0;
 }
 
 /*
@@ -127,10 +193,30 @@ static double lookup_score(const item_t *item, const double pos[static 2],
 int areas_lookup(const areas_t *areas, const double pos[2], double max_dist,
                  uint64_t *oid, uint64_t *hint)
 {
-    item_t *item = NULL, *best = NULL;
+    const item_t *item, *best = NULL;
     double score, best_score = 0.0;
-
-    while ( (item = (item_t*)utarray_next(areas->items, item)) ) {
+    int x, y, x0, y0, x1, y1, i;
+
+    // Only scan the shapes whose cells intersect the search disk, plus
+    // the overflow list.  An item can be visited once per cell it
+    // covers: the scoring is idempotent so this doesn't matter.
+    cell_range(pos, max_dist, &x0, &y0, &x1, &y1);
+    for (y = y0; y <= y1; y++)
+    for (x = x0; x <= x1; x++) {
+        for (i = areas->heads[y * GRID_W + x]; i != -1;
+                i = areas->nodes[i].next) {
+            item = (const item_t*)utarray_eltptr(areas->items,
+                                                 areas->nodes[i].item);
+            score = lookup_score(item, pos, max_dist);
+            if (score > best_score) {
+                best_score = score;
+                best = item;
+            }
+        }
+    }
+    for (i = 0; i < areas->nb_overflow; i++) {
+        item = (const item_t*)utarray_eltptr(areas->items,
+                                             areas->overflow[i]);
         score = lookup_score(item, pos, max_dist);
         if (score > best_score) {
             best_score = score;
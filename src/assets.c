@@ -10,6 +10,12 @@
 #include "swe.h"
 #include <sys/stat.h>
 
+#ifndef __EMSCRIPTEN__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 static const int DEFAULT_DELAY = 60;
 
 #ifdef __EMSCRIPTEN__
@@ -26,6 +32,7 @@ enum {
     FREE_DATA   = 1 << 10,
     LOGGED      = 1 << 11,
     CAN_RELEASE = 1 << 12,
+    REPLAY_SEEN = 1 << 13, // Arrival already reported to the replay log.
 };
 
 typedef struct asset asset_t;
@@ -34,6 +41,7 @@ struct asset
     UT_hash_handle  hh;
     char            *url;
     request_t       *request;
+    sys_file_req_t  *file_req;  // For async local file reads.
     int             flags;
     int             compressed_size;
     void            *compressed_data;
@@ -123,17 +131,103 @@ void asset_register(const char *url, const void *data, int size,
                     strlen(asset->url), asset);
 }
 
+/*
+ * Support for packed asset files, as an alternative to the compiled-in
+ * arrays: a small index (urls, offsets, flags) followed by the raw or
+ * zlib compressed blobs.  The file is mmapped, so entries don't consume
+ * memory until they are actually used, compressed entries are only
+ * inflated on first access, and the inflated copy can be evicted again
+ * with asset_release (the entry then points back into the mapping).
+ * Generated with: tools/make-assets.py --pack <file>.
+ */
+typedef struct {
+    uint32_t url_ofs;   // Offset of the NUL terminated url.
+    uint32_t data_ofs;  // Offset of the blob (4 bytes aligned).
+    uint32_t size;      // Stored size of the blob.
+    uint32_t flags;     // 1: zlib compressed (uint32 raw size prefix).
+} pack_entry_t;
+
+#ifndef __EMSCRIPTEN__
+static void *pack_map(const char *path, int *size)
+{
+    int fd;
+    struct stat st;
+    void *ptr;
+
+    fd = open(path, O_RDONLY);
+    if (fd == -1) return NULL;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) return NULL;
+    *size = st.st_size;
+    return ptr;
+}
+#endif
+
+int asset_load_pack(const char *path)
+{
+    const char *base = NULL;
+    const pack_entry_t *entries;
+    asset_t *asset;
+    char *url;
+    int size = 0, r;
+    uint32_t nb, i;
+
+#ifndef __EMSCRIPTEN__
+    base = pack_map(path, &size);
+#endif
+    // No mmap support: fall back to reading the whole file, we still get
+    // the lazy decompression.
+    if (!base) base = read_file(path, &size);
+    if (!base) {
+        LOG_E("Cannot open asset pack: %s", path);
+        return -1;
+    }
+    if (size < 12 || memcmp(base, "SWEPACK1", 8) != 0) {
+        LOG_E("Invalid asset pack: %s", path);
+        return -1;
+    }
+    memcpy(&nb, base + 8, 4);
+    entries = (const void*)(base + 12);
+    for (i = 0; i < nb; i++) {
+        r = asprintf(&url, "asset://%s", base + entries[i].url_ofs);
+        if (r == -1) continue;
+        // Compiled-in data takes precedence over the pack.
+        HASH_FIND_STR(g_assets, url, asset);
+        if (asset) {
+            free(url);
+            continue;
+        }
+        asset_register(url, base + entries[i].data_ofs, entries[i].size,
+                       entries[i].flags & 1);
+    }
+    LOG_I("Loaded asset pack %s (%u entries)", path, nb);
+    return 0;
+}
+
 const void *asset_get_data(const char *url, int *size, int *code)
 {
     return asset_get_data2(url, 0, size, code);
 }
 
+const void *asset_get_partial_data(const char *url, int *size)
+{
+    asset_t *asset;
+    HASH_FIND_STR(g_assets, url, asset);
+    if (size) *size = 0;
+    if (!asset || !asset->request) return NULL;
+    return request_get_partial_data(asset->request, size);
+}
+
 const void *asset_get_data2(const char *url, int flags, int *size, int *code)
 {
     asset_t *asset;
     int r, default_size, default_code;
     const void *data = NULL;
-    (void)r;
     char path[1204];
 
     size = size ?: &default_size;
@@ -175,14 +269,25 @@ const void *asset_get_data2(const char *url, int flags, int *size, int *code)
         *code = 0;
     }
 
-    // Special handler for local files.
+    // Special handler for local files, read in the worker pool so that
+    // local data sources (offline tile dumps...) don't block the caller.
     if (HAS_FS && !asset->data && !strchr(url, ':')) {
-        remove_url_parameters(url, path, sizeof(path));
-        if (!file_exists(path)) {
+        if (!asset->file_req) {
+            remove_url_parameters(url, path, sizeof(path));
+            if (!file_exists(path)) {
+                *code = 404;
+                goto end;
+            }
+            asset->file_req = sys_read_file_async(path);
+        }
+        r = sys_read_file_async_poll(asset->file_req, &asset->data,
+                                     &asset->size);
+        if (r == 0) goto end; // Still reading (*code stays 0).
+        asset->file_req = NULL;
+        if (r != 200) {
             *code = 404;
             goto end;
         }
-        asset->data = read_file(path, &asset->size);
         asset->flags |= FREE_DATA;
     }
 
@@ -200,7 +305,26 @@ const void *asset_get_data2(const char *url, int flags, int *size, int *code)
         }
         asset->request = request_create(asset->url);
     }
+    // Reapply the priority at each poll, so that a tile moving in or out
+    // of the visible set repriorizes its queued download.
+    if (flags & ASSET_PRIORITY_LOW)
+        request_set_priority(asset->request, REQUEST_PRIORITY_LOW);
+    if (flags & ASSET_PRIORITY_HIGH)
+        request_set_priority(asset->request, REQUEST_PRIORITY_HIGH);
     data = request_get_data(asset->request, size, code);
+    // Record or gate the arrival order when a replay is active, so that
+    // two runs surface the downloads at the same frames.
+    if (*code == 200 && data) {
+        if (!replay_asset_ready(url)) {
+            *code = 0;
+            *size = 0;
+            return NULL;
+        }
+        if (!(asset->flags & REPLAY_SEEN)) {
+            asset->flags |= REPLAY_SEEN;
+            replay_asset_arrived(url);
+        }
+    }
     if (*code && data && (flags & ASSET_USED_ONCE))
         asset->flags |= CAN_RELEASE;
 
@@ -221,6 +345,12 @@ static void asset_release_(asset_t *asset)
     }
     if (asset->request)
         request_delete(asset->request);
+    if (asset->file_req) {
+        // Drop the data if the read completed; if it is still running we
+        // leak the request rather than crash the worker.
+        sys_read_file_async_poll(asset->file_req, NULL, NULL);
+        asset->file_req = NULL;
+    }
     if (!(asset->flags & STATIC)) {
         HASH_DEL(g_assets, asset);
         free(asset->url);
@@ -279,6 +409,7 @@ void asset_set_hook(void *user,
 
 
 #include "assets/font.inl"
+#include "assets/hip.dat.inl"
 #include "assets/planets.ini.inl"
 #include "assets/shaders.inl"
 #include "assets/symbols.png.inl"
@@ -36,11 +36,16 @@
  *   ASSET_ACCEPT_404   - Do not log error on a 404 return.
  *   ASSET_USED_ONCE    - Hint that the data can be release after it has
  *                        been read.
+ *   ASSET_PRIORITY_LOW  - Download in the low priority lane (background
+ *                         imagery that should never delay catalog data).
+ *   ASSET_PRIORITY_HIGH - Download in the high priority lane.
  */
 enum {
     ASSET_DELAY             = 1 << 0,
     ASSET_ACCEPT_404        = 1 << 1,
     ASSET_USED_ONCE         = 1 << 2,
+    ASSET_PRIORITY_LOW      = 1 << 3,
+    ASSET_PRIORITY_HIGH     = 1 << 4,
 };
 
 /*
@@ -76,6 +81,14 @@ const void *asset_get_data(const char *url, int *size, int *code);
  */
 const void *asset_get_data2(const char *url, int flags, int *size, int *code);
 
+/*
+ * Function: asset_get_partial_data
+ * Get the bytes received so far of an online asset whose download is
+ * still in flight, so that stream capable decoders can overlap decode
+ * and download.  Returns NULL if no transfer is running.
+ */
+const void *asset_get_partial_data(const char *url, int *size);
+
 /*
  * Function: asset_release
  * Release the memory associated with an asset.
@@ -105,6 +118,21 @@ const char *asset_iter_(const char *base, void **i);
 void asset_register(const char *url, const void *data, int size,
                     bool compressed);
 
+/*
+ * Function: asset_load_pack
+ * Register all the entries of a packed asset file (see
+ * tools/make-assets.py --pack).
+ *
+ * The file is mmapped when possible, so that unused entries never get
+ * resident, and compressed entries are only inflated on first access.
+ * Entries whose url is already registered (compiled-in data) are
+ * skipped.
+ *
+ * Return:
+ *   0 on success, -1 if the file cannot be read or is not a valid pack.
+ */
+int asset_load_pack(const char *path);
+
 #define ASSET_REGISTER(id_, name_, data_, comp_) \
     static void register_asset_##id_(void) __attribute__((constructor)); \
     static void register_asset_##id_(void) { \
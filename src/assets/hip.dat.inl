@@ -0,0 +1,3488 @@
+// Auto generated from tools/makeassets.py
+
+static const unsigned char DATA_hip_dat[69862] __attribute__((aligned(4))) =
+{
+    96,214,1,0,120,218,44,152,215,142,226,216,22,134,201,38,56,220,182,64,
+    162,94,165,80,17,110,64,101,112,139,33,24,252,42,219,54,193,228,18,87,
+    136,126,216,62,223,239,62,51,61,213,5,182,247,94,235,79,107,123,254,142,
+    63,191,207,159,227,239,239,239,115,243,243,243,171,153,125,126,125,127,
+    143,207,227,207,243,215,231,249,220,28,55,191,190,191,198,103,243,229,
+    182,190,91,95,201,103,246,201,181,228,115,156,140,147,86,43,107,242,76,
+    150,124,235,233,47,247,251,252,205,58,95,95,95,205,239,79,247,235,220,
+    100,129,225,231,23,11,181,38,231,115,242,233,54,207,9,55,114,53,251,76,
+    190,154,231,239,196,109,177,152,59,254,108,177,239,240,187,249,229,38,
+    223,173,111,247,235,147,245,62,41,233,171,217,250,250,252,74,190,191,185,
+    33,251,102,239,111,183,217,106,54,249,238,171,213,252,28,143,199,95,227,
+    150,10,29,55,155,205,49,127,181,190,206,124,147,240,208,103,147,91,189,
+    108,252,237,113,219,215,167,247,173,61,93,151,165,123,60,166,197,90,227,
+    241,119,243,243,251,179,201,218,99,122,102,203,140,101,191,221,79,202,
+    229,251,86,171,217,154,140,179,79,143,66,63,63,221,108,124,254,108,142,
+    179,166,80,248,204,206,227,243,249,187,69,3,99,243,201,110,173,230,248,
+    155,93,190,212,70,107,220,226,110,30,249,226,190,22,91,157,91,231,230,
+    215,87,146,36,110,210,107,126,53,63,205,248,27,48,4,113,50,118,199,205,
+    207,225,248,219,253,30,127,54,155,212,72,221,173,239,239,86,235,139,79,
+    73,139,198,221,207,108,60,28,182,160,193,253,110,102,16,4,87,220,124,78,
+    0,129,74,191,178,204,208,206,183,64,119,225,43,3,221,79,225,156,157,155,
+    25,72,177,255,39,223,140,189,94,243,236,37,64,245,53,129,129,102,147,250,
+    120,166,213,52,160,56,252,244,62,191,40,53,251,26,158,51,16,119,63,123,
+    205,86,242,117,22,151,205,111,97,65,89,110,171,165,6,199,95,223,73,243,
+    211,157,124,159,41,60,99,43,90,105,81,241,184,55,110,121,124,252,28,83,
+    102,11,212,18,119,114,254,156,124,141,249,149,210,146,51,76,124,127,126,
+    103,223,38,107,162,152,102,50,100,161,236,76,105,104,11,85,157,207,95,
+    61,99,190,164,159,179,248,248,118,179,228,83,37,72,123,127,63,207,60,221,
+    163,232,113,243,140,42,62,169,225,107,50,110,245,154,9,154,59,155,177,
+    247,153,112,11,194,133,207,225,57,175,162,7,84,223,147,236,91,119,243,
+    245,231,4,37,179,114,115,2,206,67,16,134,150,137,7,209,227,243,176,57,
+    25,126,125,125,78,206,201,185,119,110,1,242,103,43,19,121,147,51,116,34,
+    175,140,77,199,95,230,60,150,72,144,128,201,216,221,120,223,222,55,56,
+    126,54,205,215,249,179,135,49,232,9,110,145,57,26,82,87,201,184,57,102,
+    53,152,203,240,9,154,27,2,112,11,85,125,38,2,2,126,191,224,250,60,236,
+    53,81,14,255,126,183,204,87,243,75,146,238,1,1,149,186,80,73,23,67,118,
+    197,144,189,49,146,253,52,61,196,61,166,202,47,104,65,135,227,30,64,53,
+    123,208,247,153,156,233,43,19,94,168,24,36,90,205,30,213,97,53,10,248,
+    202,154,64,49,214,194,223,95,19,163,178,191,36,230,108,120,158,32,87,26,
+    65,81,223,89,15,223,161,196,214,216,109,73,242,18,218,4,82,39,116,53,134,
+    203,214,164,7,176,124,236,141,13,238,154,176,245,48,223,246,243,187,153,
+    120,8,233,243,12,186,240,211,162,173,9,18,129,225,30,32,126,125,13,101,
+    70,40,63,179,50,81,34,115,101,95,73,235,115,152,245,216,236,147,21,206,
+    147,230,23,251,67,41,36,77,134,61,200,26,99,114,32,20,107,210,25,57,194,
+    162,159,114,185,11,142,216,67,44,34,207,201,183,71,46,200,179,220,235,
+    98,181,30,204,183,128,4,89,241,235,24,189,146,86,95,50,88,147,100,192,
+    238,208,13,140,231,222,88,247,142,19,37,83,230,125,201,223,159,45,147,
+    125,79,220,239,30,18,231,226,39,117,80,102,146,101,159,231,222,215,120,
+    50,228,231,112,44,129,246,206,223,19,252,74,232,156,193,226,220,244,190,
+    132,250,132,60,108,77,188,161,194,133,158,101,246,230,164,39,153,243,205,
+    185,53,28,126,39,147,9,96,34,181,4,175,53,155,61,18,240,59,203,20,177,
+    153,75,213,124,77,113,67,3,45,19,74,239,53,217,83,246,110,10,138,241,119,
+    47,57,155,79,41,34,251,110,185,137,60,7,27,249,66,100,105,211,155,100,
+    147,204,5,5,50,237,140,219,38,44,0,205,103,190,236,145,55,238,247,80,13,
+    161,133,22,34,108,246,36,238,137,249,202,38,160,51,25,186,176,246,57,100,
+    69,23,20,191,199,217,151,235,78,50,194,52,145,240,254,234,121,229,252,
+    119,211,229,121,183,7,132,227,150,146,120,50,252,108,102,189,33,249,219,
+    114,191,122,202,122,240,83,148,17,197,201,153,120,34,15,160,185,137,102,
+    199,194,11,185,1,184,129,8,138,81,86,245,134,104,197,244,20,71,124,137,
+    22,80,41,237,162,172,230,132,145,130,102,224,56,251,66,151,124,60,39,73,
+    30,216,164,95,179,5,24,180,237,185,89,171,215,227,15,141,211,240,215,119,
+    19,119,124,126,102,238,153,120,162,0,98,40,255,42,129,105,246,24,143,93,
+    208,67,124,227,12,235,77,8,30,60,133,153,206,95,32,150,49,227,206,40,0,
+    216,91,95,216,159,180,71,37,236,51,108,74,218,112,208,74,48,90,179,69,
+    205,216,102,172,25,209,34,151,200,30,216,203,176,200,176,9,6,92,31,102,
+    9,88,157,81,51,249,130,82,152,21,189,161,75,248,244,134,100,22,115,177,
+    201,13,231,172,199,64,24,194,116,107,236,13,91,45,92,208,130,42,180,107,
+    200,228,33,8,113,105,50,33,32,184,151,71,243,70,209,113,111,2,92,205,108,
+    72,164,105,102,208,118,194,158,147,111,66,150,212,199,179,227,51,15,157,
+    135,20,122,254,100,230,76,242,232,228,111,146,3,65,15,9,177,230,152,73,
+    72,130,51,169,63,135,67,25,124,200,82,44,73,78,48,89,105,125,210,107,129,
+    16,191,18,11,67,4,161,56,153,176,96,11,96,91,20,50,36,219,176,253,89,60,
+    48,150,12,58,29,186,232,7,101,39,77,58,202,190,123,36,234,16,1,122,95,
+    170,49,201,159,31,115,28,232,97,8,216,66,232,140,134,201,112,194,148,252,
+    156,112,41,233,161,50,48,233,181,90,136,186,55,81,66,82,5,6,26,50,185,
+    135,19,38,230,57,155,96,12,26,102,190,8,83,78,19,240,67,116,13,191,149,
+    155,60,144,209,105,143,102,90,66,119,76,29,26,54,217,103,79,41,198,32,
+    61,235,76,146,203,101,232,129,225,121,72,136,51,101,112,30,139,42,95,198,
+    19,84,75,124,13,57,134,76,228,8,152,192,166,82,47,53,37,92,202,134,61,
+    151,230,199,95,148,72,44,243,28,212,234,120,0,29,45,23,135,49,237,93,32,
+    227,46,124,15,160,36,60,36,126,254,59,114,80,63,16,159,93,143,68,212,141,
+    236,221,82,154,65,28,28,50,210,112,141,50,167,119,86,6,183,80,69,47,235,
+    185,231,22,141,157,135,220,207,240,58,179,200,80,159,209,241,132,169,66,
+    92,162,19,254,35,123,48,13,97,10,251,12,53,64,25,126,247,92,151,76,37,
+    37,145,38,150,71,8,223,200,168,169,70,123,249,49,129,28,164,114,230,23,
+    233,48,193,142,176,230,81,33,29,147,130,148,78,74,114,12,25,211,7,84,40,
+    66,229,149,113,70,101,153,57,231,253,247,114,142,92,52,74,156,55,225,133,
+    81,39,227,144,132,61,161,61,20,161,184,61,81,56,19,26,236,119,62,123,159,
+    195,137,251,111,180,13,69,87,235,60,97,19,140,51,1,224,175,230,208,229,
+    185,172,41,159,181,92,151,204,226,161,172,71,190,41,63,135,140,135,30,
+    114,202,164,36,6,15,225,51,201,68,76,139,63,134,246,91,61,55,175,9,197,
+    11,156,38,7,168,33,183,18,87,94,203,245,122,216,129,136,251,34,67,20,4,
+    220,8,17,61,22,110,114,218,234,49,98,134,236,64,77,28,21,41,238,91,9,197,
+    163,116,137,171,244,75,118,102,88,225,57,165,63,59,76,56,168,100,46,18,
+    110,33,125,197,69,179,55,97,38,163,10,118,111,38,19,210,133,159,44,201,
+    41,78,105,97,38,19,3,134,46,238,164,159,179,81,49,61,236,65,125,76,14,
+    232,150,5,181,114,179,231,78,134,112,65,35,160,62,108,14,105,214,244,208,
+    232,240,51,163,58,136,25,98,25,29,114,153,5,90,3,228,73,166,166,112,249,
+    98,80,33,96,150,51,84,4,203,16,135,138,209,210,196,124,43,229,49,0,212,
+    224,39,121,126,136,90,224,13,12,53,90,134,6,233,114,118,162,33,151,193,
+    65,167,137,162,149,35,69,115,98,200,10,138,29,243,56,176,120,147,166,241,
+    60,64,81,222,112,206,232,121,67,10,25,147,13,153,134,66,83,167,0,25,22,
+    42,137,13,101,18,91,244,62,9,201,51,199,8,120,224,246,204,197,113,124,
+    39,169,12,209,16,253,143,153,149,103,49,112,150,230,164,86,128,99,58,156,
+    91,137,16,147,59,168,103,66,118,194,27,39,152,12,118,221,100,162,179,12,
+    63,209,0,248,243,176,194,42,99,57,236,233,245,112,211,80,122,17,156,64,
+    57,145,116,224,245,156,127,228,80,53,81,144,209,59,135,102,34,114,34,213,
+    81,77,230,81,70,175,71,128,183,208,168,11,166,19,23,117,41,148,189,51,
+    113,55,148,246,207,154,229,132,58,235,225,138,179,78,209,19,105,190,73,
+    28,54,123,94,6,230,202,173,9,234,231,33,30,32,217,105,202,133,85,2,140,
+    141,89,143,170,197,15,18,225,64,153,121,10,80,183,169,144,130,188,97,43,
+    193,106,40,126,210,67,51,46,112,42,143,18,87,176,104,58,209,12,141,156,
+    213,156,98,153,170,52,193,134,168,186,53,33,106,36,152,115,95,1,211,51,
+    9,44,176,49,77,11,34,21,198,88,28,234,229,140,136,65,59,140,58,101,131,
+    88,100,173,158,170,149,34,18,176,35,120,38,102,66,33,189,126,79,203,78,
+    46,40,194,149,91,123,162,131,137,199,130,116,44,135,208,71,38,199,244,
+    72,119,89,75,217,161,243,12,152,52,149,133,23,250,111,141,38,146,77,50,
+    36,159,176,30,62,16,68,80,211,67,99,103,254,189,244,207,210,35,228,128,
+    2,235,77,120,243,27,81,231,16,220,71,103,57,90,237,35,100,56,6,232,68,
+    170,128,123,4,129,244,122,19,175,53,97,7,166,0,88,234,48,149,101,28,98,
+    154,100,110,75,206,18,103,19,157,28,160,140,209,173,140,238,73,161,204,
+    50,133,73,83,244,208,68,179,87,103,10,19,110,195,186,11,11,60,239,214,
+    39,80,0,184,46,251,82,156,225,43,166,8,165,246,47,134,157,134,125,87,50,
+    71,81,208,166,217,78,4,192,192,232,44,226,72,47,229,144,203,101,73,37,
+    27,113,7,137,116,25,141,64,10,26,57,115,226,223,161,202,189,136,102,132,
+    212,111,169,254,51,212,33,39,183,143,129,134,67,34,235,44,3,210,201,69,
+    90,236,107,220,210,129,203,98,189,254,255,59,190,176,244,80,162,198,39,
+    231,17,205,156,179,62,140,224,136,62,102,145,123,184,50,241,232,98,212,
+    68,154,23,90,174,243,161,85,111,213,169,173,73,255,217,100,164,101,57,
+    70,16,196,195,58,134,74,250,122,37,102,6,157,251,195,11,147,163,153,64,
+    78,210,171,211,14,89,194,237,195,4,10,91,106,130,225,167,145,138,198,80,
+    156,180,80,175,79,234,201,69,151,244,136,233,227,128,214,228,114,25,214,
+    71,58,46,208,192,68,227,3,69,178,65,207,228,217,217,187,40,213,200,146,
+    4,80,135,220,208,2,98,54,79,122,201,133,207,35,151,67,158,135,108,117,
+    74,226,93,121,162,172,239,121,200,168,222,210,152,212,49,96,40,165,247,
+    240,211,144,163,72,61,171,107,30,77,250,168,201,107,37,125,177,117,105,
+    234,226,5,100,12,201,222,235,93,8,29,9,184,63,172,15,1,170,46,181,183,
+    90,125,52,225,54,17,100,146,92,160,109,114,169,19,198,89,75,160,185,35,
+    244,77,12,147,48,147,58,122,164,222,145,228,219,84,97,9,116,140,220,17,
+    227,161,85,103,164,209,210,36,225,42,54,159,100,117,42,69,36,128,109,100,
+    96,86,157,244,123,122,49,239,83,8,162,105,94,70,138,151,75,82,31,38,73,
+    50,162,30,23,133,176,228,136,243,40,186,84,208,35,102,118,207,60,112,194,
+    72,124,211,106,94,134,147,81,38,61,40,112,46,163,186,11,28,217,229,12,
+    107,16,115,233,245,51,29,189,235,0,205,36,192,131,23,133,73,29,219,214,
+    165,23,79,211,128,87,16,101,231,132,187,17,55,59,2,230,176,55,202,248,
+    254,226,210,35,106,234,99,177,97,239,82,79,38,151,12,88,57,120,52,101,
+    249,86,235,130,75,134,35,136,215,169,25,208,18,217,115,66,167,253,17,121,
+    70,122,145,4,189,243,37,159,68,20,202,95,23,68,210,87,128,103,58,89,36,
+    195,75,29,33,129,121,207,3,191,58,88,142,128,224,162,243,114,111,116,25,
+    142,234,10,198,12,87,245,221,97,159,137,59,236,55,91,23,183,151,212,71,
+    220,138,165,91,58,155,202,155,28,75,71,125,77,110,78,73,35,62,101,44,204,
+    78,94,171,175,76,60,55,47,77,232,109,141,70,19,210,150,174,47,117,195,
+    219,135,140,153,140,18,41,126,164,83,73,253,60,58,215,93,193,121,198,24,
+    77,23,205,213,251,185,174,71,10,204,236,210,119,47,12,244,86,253,130,148,
+    243,23,138,75,54,84,114,76,100,92,157,141,90,172,145,143,147,179,231,229,
+    226,207,204,165,222,234,67,237,165,223,202,15,22,184,72,66,210,81,149,
+    33,117,161,204,58,198,224,193,140,156,209,73,89,103,160,236,66,95,67,197,
+    209,101,146,100,147,250,5,243,93,250,163,254,89,39,251,58,115,92,81,205,
+    127,70,221,79,234,180,133,232,47,125,108,97,160,171,57,234,131,41,47,251,
+    153,14,25,195,81,255,226,38,30,48,27,166,230,121,116,153,180,250,222,144,
+    174,121,29,57,235,160,66,184,184,173,139,94,101,38,23,250,189,184,151,
+    172,127,185,232,28,193,233,170,79,204,159,251,249,193,174,62,170,195,10,
+    55,161,174,179,250,78,206,23,239,140,173,254,246,50,68,127,65,249,110,
+    147,188,156,140,250,163,127,103,2,132,103,72,111,34,47,107,245,19,54,73,
+    90,8,155,216,171,227,22,96,24,142,122,250,10,141,38,122,195,235,187,166,
+    222,172,123,117,253,79,146,203,4,136,251,8,21,151,244,135,178,73,166,84,
+    39,180,243,67,62,226,198,221,180,128,50,196,108,95,211,133,16,38,183,47,
+    212,73,146,181,70,23,132,1,38,205,145,236,215,39,192,56,168,93,188,139,
+    206,106,89,29,149,92,250,205,4,181,129,120,159,229,177,58,176,18,194,163,
+    209,136,180,243,134,46,11,37,232,107,132,228,251,117,77,244,17,3,132,129,
+    143,250,251,125,98,166,62,212,169,175,62,17,89,245,62,197,244,161,171,
+    85,7,65,130,6,9,25,78,125,96,221,4,78,242,150,198,24,89,128,223,228,35,
+    1,65,243,45,178,240,236,162,50,240,232,195,98,63,233,185,151,214,8,61,
+    244,117,150,173,99,228,11,239,206,58,139,244,220,81,210,239,17,26,231,
+    132,166,90,117,88,197,41,189,126,29,89,101,68,45,41,218,239,121,128,59,
+    202,12,45,105,218,52,251,151,22,118,229,148,134,125,161,137,55,208,190,
+    87,111,178,43,225,147,93,154,184,14,72,250,117,6,44,51,185,222,50,228,
+    22,243,14,129,128,204,68,131,1,223,65,28,250,29,98,134,145,50,229,146,
+    36,110,61,209,216,78,232,85,122,33,208,216,132,248,170,243,197,165,142,
+    135,112,31,80,162,129,140,20,131,67,201,70,241,197,17,192,237,183,224,
+    161,223,231,69,166,95,231,253,160,63,25,98,37,134,208,164,127,166,16,60,
+    44,254,254,178,34,252,80,132,139,55,146,254,5,122,0,93,42,38,116,48,62,
+    218,110,142,4,195,176,217,31,113,70,32,24,50,205,140,81,189,78,130,195,
+    31,187,18,3,46,67,13,8,9,236,164,9,20,56,159,203,132,74,107,100,90,117,
+    158,206,18,170,236,213,177,33,185,230,142,76,189,197,211,42,15,4,234,104,
+    229,236,17,166,163,126,235,44,144,47,205,122,130,208,60,98,89,7,163,51,
+    249,124,33,87,234,166,78,184,50,9,57,15,48,139,72,147,166,38,1,22,173,
+    19,151,45,109,135,138,229,140,203,136,14,240,232,16,141,168,3,185,149,
+    40,149,6,123,164,28,120,37,242,16,101,181,120,32,163,144,186,209,255,146,
+    30,65,1,70,187,144,76,137,194,13,244,240,19,165,210,210,133,142,90,164,
+    126,159,92,2,126,157,207,46,174,123,209,241,248,194,94,76,84,178,244,2,
+    51,195,75,226,18,3,92,37,98,145,91,63,199,179,142,0,221,75,191,207,70,
+    124,227,114,116,101,244,185,46,6,84,218,93,164,36,134,252,8,33,78,70,201,
+    5,25,17,191,117,212,83,175,159,97,151,125,153,255,92,200,72,192,190,142,
+    10,9,176,163,252,58,42,232,93,96,5,89,143,234,73,198,57,32,67,253,136,
+    110,146,228,13,246,25,232,125,200,186,24,186,105,241,239,40,31,37,76,139,
+    209,196,5,96,224,230,170,218,36,78,104,157,131,249,104,228,37,245,164,
+    14,55,248,54,195,44,4,197,217,203,250,50,210,25,141,65,193,69,29,141,160,
+    253,210,79,4,177,206,91,158,71,248,152,17,166,191,32,163,250,5,85,241,
+    130,64,89,23,249,13,144,91,9,203,33,208,62,183,96,63,6,230,16,73,129,140,
+    59,106,34,3,148,116,73,120,203,97,8,99,79,150,208,221,98,178,62,225,205,
+    161,174,208,230,142,186,166,136,0,213,193,206,101,176,208,146,75,49,218,
+    148,169,116,198,1,184,202,80,148,199,10,16,65,176,152,122,162,34,184,79,
+    233,152,41,182,46,210,11,163,31,55,182,96,5,1,176,19,105,64,250,176,211,
+    133,169,212,207,191,71,119,245,204,173,35,130,9,151,242,47,0,117,50,226,
+    121,131,192,19,53,202,92,82,120,193,55,202,170,27,110,116,201,172,17,7,
+    154,81,63,235,27,86,102,0,95,116,78,169,107,81,180,74,131,176,128,185,
+    169,92,94,3,114,181,4,157,144,54,233,27,130,163,207,48,233,15,61,56,132,
+    5,140,73,234,115,230,70,122,238,72,123,82,80,175,213,231,185,122,29,214,
+    141,202,2,204,68,56,240,47,74,173,143,24,169,160,225,230,12,12,169,161,
+    121,161,126,225,63,82,36,213,129,51,247,12,128,185,134,132,160,48,164,
+    233,246,115,216,169,6,176,221,94,46,153,76,97,147,73,58,153,176,225,50,
+    70,165,3,228,222,50,125,105,172,159,40,140,53,205,196,16,53,203,33,96,
+    193,247,125,79,110,7,137,156,73,121,7,3,34,37,254,166,146,139,150,231,
+    23,44,65,159,148,135,247,136,23,69,237,72,235,224,60,192,7,128,81,223,
+    21,64,200,147,77,229,50,101,38,59,66,132,26,160,161,139,230,41,128,67,
+    62,64,176,4,154,103,247,132,136,162,150,139,226,138,217,13,81,25,88,98,
+    20,130,248,162,224,20,42,249,163,44,205,254,46,80,180,114,57,152,236,66,
+    208,161,212,68,250,72,250,68,186,208,162,92,80,113,141,185,104,93,158,
+    104,41,19,65,36,225,25,9,31,166,242,194,46,151,211,29,127,80,47,129,228,
+    178,0,220,211,10,219,223,85,2,74,28,157,70,39,182,167,149,18,123,115,69,
+    81,83,31,156,64,138,18,169,191,94,50,44,14,226,0,139,47,213,54,137,225,
+    54,192,140,62,176,91,163,159,140,26,180,58,50,202,3,220,132,151,16,62,
+    128,150,36,91,233,159,151,183,17,4,95,20,7,184,149,132,185,220,209,115,
+    206,56,210,17,87,82,238,169,238,185,151,129,49,245,190,215,111,80,168,
+    234,172,15,74,37,233,130,101,70,82,26,15,12,224,184,127,146,235,239,152,
+    21,206,153,255,121,146,186,45,79,31,250,151,211,69,69,128,163,219,106,
+    104,77,26,103,192,176,85,82,210,112,234,183,78,23,214,199,237,234,150,
+    149,91,228,231,189,158,251,136,31,46,71,3,87,57,167,196,60,245,33,223,
+    171,143,120,17,193,109,80,94,7,175,145,26,57,209,58,253,41,79,169,29,129,
+    15,16,230,96,148,157,116,24,209,40,198,48,253,187,203,183,39,126,201,188,
+    18,193,116,106,201,152,204,144,146,6,21,114,198,155,185,88,149,126,153,
+    135,4,6,125,80,55,89,105,148,159,12,168,217,109,96,209,59,81,83,71,9,37,
+    209,144,23,83,55,0,132,117,71,245,193,32,57,185,13,214,104,36,253,18,76,
+    157,26,13,182,68,223,245,70,150,193,173,11,212,201,136,22,46,217,169,81,
+    151,58,140,155,101,74,206,75,3,38,64,225,78,133,125,115,111,48,179,26,
+    131,139,210,71,235,54,178,126,131,101,235,151,147,84,234,222,209,102,118,
+    119,13,130,60,213,245,92,166,197,8,36,200,31,100,3,89,143,64,185,200,173,
+    151,198,192,67,167,12,46,216,72,146,83,253,50,96,202,36,201,93,27,34,198,
+    81,163,117,106,100,228,235,168,212,239,55,238,165,65,107,128,252,61,64,
+    103,21,198,178,119,57,209,110,127,116,87,108,37,64,98,234,119,186,53,131,
+    44,79,104,0,162,241,82,221,61,245,79,8,29,208,78,245,82,99,84,202,204,
+    189,222,96,115,6,253,165,209,168,39,141,198,160,4,186,119,106,63,185,232,
+    165,222,0,106,156,220,184,163,59,119,64,224,220,129,208,165,134,122,11,
+    16,189,145,209,177,181,196,151,163,187,36,1,30,20,202,146,250,165,164,
+    61,113,11,221,115,36,50,174,92,197,225,36,105,40,192,201,33,247,126,191,
+    35,242,122,163,196,125,46,169,63,32,69,188,228,116,231,200,4,95,36,5,150,
+    28,65,32,10,25,208,33,146,79,238,100,5,112,33,187,193,8,40,26,151,124,
+    71,142,101,35,100,67,174,1,64,253,228,142,32,161,209,72,78,240,68,74,113,
+    172,238,115,172,203,220,123,86,23,177,165,203,137,53,1,133,138,120,248,
+    146,12,144,250,157,18,238,116,160,105,143,210,79,89,253,52,232,143,128,
+    231,66,125,23,49,197,138,132,83,127,112,234,151,78,13,3,216,44,11,70,28,
+    191,220,6,234,104,213,61,175,85,106,156,78,167,250,137,246,26,141,147,
+    171,3,233,157,161,56,184,148,26,102,48,2,223,19,46,170,55,234,217,201,
+    189,156,12,126,66,114,3,2,104,80,2,64,183,196,62,144,238,182,178,251,8,
+    244,221,150,123,26,13,70,42,145,252,235,39,131,59,31,0,231,126,31,52,12,
+    146,61,1,80,131,99,13,91,26,118,109,148,78,119,83,106,12,26,173,6,132,
+    148,104,51,129,108,72,66,38,167,82,163,255,247,62,56,17,118,112,82,42,
+    149,112,122,201,156,104,180,193,154,12,102,138,206,131,239,46,65,92,78,
+    253,123,9,180,176,230,61,19,75,141,12,51,145,215,196,12,12,55,234,236,
+    77,60,182,148,179,184,18,183,16,50,253,147,65,141,122,133,185,195,55,132,
+    159,26,160,239,121,40,134,100,187,104,88,141,60,124,70,132,224,18,30,83,
+    62,155,6,91,74,91,230,14,52,253,214,160,81,146,158,249,142,136,235,15,
+    144,107,3,16,53,57,75,167,214,105,160,81,228,114,14,224,182,18,206,37,
+    173,224,1,118,78,245,132,189,117,47,174,62,33,190,251,160,126,58,129,195,
+    253,62,186,15,80,109,9,147,130,230,128,224,173,227,157,251,128,113,65,
+    123,23,105,132,219,153,25,247,146,215,7,115,117,118,42,153,68,182,60,225,
+    210,196,115,197,99,9,109,113,193,133,120,146,242,164,159,4,0,142,44,145,
+    123,13,214,225,231,8,172,243,243,83,99,48,40,225,219,60,27,80,214,253,
+    158,92,228,41,194,237,142,184,238,46,182,24,96,236,18,206,3,234,70,73,
+    160,146,216,119,214,71,144,30,11,213,239,89,105,192,105,244,68,121,88,
+    186,127,247,152,67,56,228,14,126,132,15,149,222,73,21,247,148,103,51,116,
+    210,26,215,70,134,153,61,194,245,184,2,36,144,70,67,112,54,26,158,236,
+    232,242,59,239,9,37,49,128,142,209,236,253,132,95,240,71,3,21,223,153,
+    48,37,30,27,13,88,250,158,176,249,192,187,227,84,210,145,176,68,118,230,
+    52,240,92,64,111,36,245,19,15,154,83,233,148,32,196,59,106,0,215,59,208,
+    222,27,165,134,135,242,213,194,169,209,186,187,116,8,8,120,58,33,125,136,
+    253,36,1,41,116,159,112,202,107,48,98,27,208,52,66,185,245,6,44,161,73,
+    68,106,70,188,255,64,3,26,4,218,75,3,253,186,3,217,177,116,191,107,199,
+    82,93,44,224,102,136,112,217,27,181,55,78,30,174,188,215,75,9,102,29,245,
+    129,212,187,228,49,6,13,128,171,120,104,12,8,31,130,172,113,247,136,217,
+    254,169,212,74,152,207,37,36,10,136,37,74,41,97,40,6,114,99,192,234,116,
+    208,80,20,128,19,235,215,185,142,216,78,110,253,222,144,220,213,35,208,
+    213,147,210,221,48,211,96,170,161,194,176,91,159,188,174,159,72,7,182,
+    189,187,94,255,78,141,23,233,134,81,84,146,159,49,83,233,162,1,196,198,
+    117,217,27,29,37,106,227,66,226,53,20,72,80,70,62,244,251,3,80,147,207,
+    47,247,83,130,166,128,116,192,109,64,15,178,164,72,169,47,163,38,148,66,
+    248,128,230,201,187,75,100,131,1,65,32,71,1,124,159,241,54,64,2,124,170,
+    75,194,152,224,78,87,73,105,96,46,152,95,75,81,247,160,225,33,213,134,
+    155,167,5,183,51,55,75,253,251,192,3,231,196,140,250,247,132,198,208,77,
+    114,199,61,136,0,225,122,18,30,232,158,78,158,125,151,121,224,225,82,234,
+    131,117,137,94,81,231,29,81,0,8,63,70,200,179,209,208,14,9,163,255,159,
+    125,136,186,1,134,68,101,119,111,132,245,169,81,210,73,26,118,227,111,
+    195,227,183,250,224,110,223,205,192,229,106,169,132,91,79,37,142,82,212,
+    72,140,160,16,156,203,167,191,228,90,67,165,187,218,13,164,74,58,122,113,
+    78,2,70,6,194,96,128,196,78,233,157,177,210,40,9,146,18,216,222,147,250,
+    61,45,37,41,134,113,93,251,126,34,38,12,41,134,69,93,141,91,206,158,20,
+    141,60,56,174,38,3,27,56,60,160,4,52,156,78,116,53,164,110,151,3,193,37,
+    185,159,250,178,11,86,73,7,156,78,238,162,14,52,243,158,33,132,56,160,
+    83,242,124,96,3,40,48,80,163,167,8,33,99,70,136,153,216,66,220,220,218,
+    47,165,174,60,143,246,82,30,29,33,49,64,57,113,7,151,120,150,46,234,37,
+    113,84,26,228,168,82,200,160,47,173,12,60,26,86,38,163,252,20,34,168,213,
+    92,12,147,142,139,30,66,41,113,208,48,124,63,56,73,163,131,156,62,238,
+    229,239,1,69,242,107,93,112,2,44,95,187,39,175,116,79,221,18,165,13,82,
+    182,66,234,136,168,209,112,7,117,121,243,196,227,90,9,131,136,117,190,
+    168,75,52,50,54,215,72,0,25,144,6,27,194,177,129,126,136,109,254,43,221,
+    109,54,46,209,253,169,228,217,232,238,174,116,106,240,145,7,201,142,82,
+    170,219,129,144,149,27,178,68,254,12,141,160,131,75,201,54,165,193,5,244,
+    109,247,110,147,155,73,35,29,156,112,19,68,179,246,41,77,7,230,100,147,
+    159,37,239,68,224,243,36,141,178,146,103,35,62,177,192,36,130,54,17,148,
+    164,134,137,72,185,141,188,115,224,97,106,48,105,74,242,13,155,144,197,
+    152,162,143,164,148,18,208,114,114,237,124,28,169,111,8,87,242,52,210,
+    187,185,27,27,21,97,55,196,48,96,11,155,202,88,161,52,208,114,40,150,223,
+    19,15,181,38,141,187,216,44,165,131,164,148,114,51,8,36,30,253,122,18,
+    27,55,53,108,87,43,107,246,178,48,229,216,57,198,116,173,184,144,5,121,
+    136,176,179,83,195,117,10,198,214,88,83,23,78,68,135,157,71,126,201,150,
+    40,217,26,213,97,58,163,0,86,224,12,88,70,14,54,130,137,159,64,233,218,
+    37,3,107,20,205,51,37,61,195,14,244,138,105,7,105,195,198,8,3,200,103,
+    127,232,58,209,35,64,178,223,192,213,70,242,204,93,90,184,151,12,24,166,
+    34,52,177,213,68,67,222,102,83,80,208,2,30,100,2,179,173,33,126,74,147,
+    18,110,87,109,132,166,55,208,121,68,3,43,189,139,66,49,140,33,211,7,62,
+    178,17,179,25,208,102,169,140,146,224,90,234,72,26,39,251,84,176,133,1,
+    153,230,217,101,173,195,114,118,129,72,224,75,91,106,209,141,233,189,100,
+    55,164,49,82,99,144,3,90,202,179,222,6,104,62,105,70,179,85,154,218,30,
+    226,65,100,182,168,224,113,0,191,210,130,93,242,224,144,149,12,126,107,
+    72,172,101,150,106,52,10,20,170,83,203,149,45,27,158,173,81,199,238,146,
+    195,160,112,45,149,140,68,146,251,195,195,185,218,22,67,52,82,193,0,231,
+    119,168,134,126,219,136,35,32,7,18,141,38,238,182,17,152,107,203,200,137,
+    236,77,48,37,148,0,44,52,149,202,159,41,127,97,120,20,102,55,30,64,133,
+    1,82,87,192,37,247,242,64,102,179,79,101,217,58,101,222,74,3,44,65,82,
+    222,7,87,212,120,5,161,146,66,222,78,116,170,185,151,109,219,46,36,133,
+    212,80,238,195,102,180,170,226,50,172,164,37,181,140,70,141,254,46,92,
+    221,194,233,106,236,147,109,159,210,70,194,82,247,187,103,0,10,103,50,
+    249,101,24,244,52,56,61,238,162,205,46,65,202,253,74,203,131,71,110,99,
+    1,108,240,235,41,29,160,164,171,204,46,39,122,84,49,96,187,187,14,98,233,
+    93,16,225,67,208,33,179,161,78,7,51,178,253,10,24,169,155,14,40,1,14,108,
+    28,82,178,175,3,247,175,139,183,31,87,22,74,10,87,224,107,60,216,149,227,
+    34,32,225,19,215,30,200,182,172,53,72,237,123,170,68,133,124,56,178,109,
+    104,66,228,3,147,138,113,44,118,135,72,0,129,68,15,62,27,15,16,70,64,73,
+    249,84,24,220,255,177,208,24,20,16,221,67,167,192,210,169,92,190,23,60,
+    250,247,174,133,100,224,149,221,7,230,192,218,167,244,161,124,82,33,72,
+    109,240,96,47,183,140,134,144,12,12,53,18,246,61,149,202,39,147,36,229,
+    235,221,78,75,168,198,46,148,74,101,183,160,4,65,71,13,175,244,120,12,
+    4,100,90,184,63,60,243,104,72,116,131,65,185,241,72,164,245,59,104,95,
+    129,75,65,9,105,247,211,131,190,248,3,2,152,210,45,240,13,125,51,60,8,
+    54,143,209,119,42,203,12,204,124,204,7,34,165,114,131,13,27,250,229,10,
+    186,229,193,21,118,10,232,39,57,61,78,15,234,103,208,97,135,146,7,203,
+    137,119,5,217,134,61,112,137,206,196,78,19,175,208,40,219,233,169,92,178,
+    133,111,158,49,96,239,22,6,15,157,117,248,82,205,51,209,175,215,71,217,
+    77,237,52,133,243,71,131,29,236,114,249,65,112,149,202,121,26,149,211,
+    83,129,158,33,12,38,81,50,250,106,92,17,39,37,161,35,60,49,40,63,216,64,
+    211,22,183,223,77,161,128,62,236,2,125,105,40,176,90,41,133,12,150,178,
+    13,218,187,187,15,228,158,50,87,52,78,210,43,218,162,45,84,213,176,31,
+    87,6,29,164,149,40,65,209,235,157,174,76,176,187,6,79,105,32,177,216,233,
+    195,35,208,30,12,248,211,233,106,23,174,87,50,25,253,243,61,48,225,68,
+    247,65,15,232,206,110,20,228,233,114,249,90,186,130,118,82,150,133,221,
+    127,106,190,203,166,87,68,204,113,153,61,82,122,32,104,20,50,4,136,77,
+    225,215,130,93,42,36,215,242,73,100,216,101,68,129,72,137,3,188,119,45,
+    161,35,49,160,236,0,127,219,70,49,58,17,232,47,2,125,80,40,201,141,247,
+    71,225,94,120,176,89,153,187,216,6,38,93,165,99,233,106,174,54,91,24,168,
+    73,74,170,139,135,175,222,61,53,180,142,147,254,94,175,105,233,113,181,
+    203,250,226,228,61,236,114,66,10,38,143,83,161,92,54,15,5,238,213,126,
+    216,176,101,176,216,95,64,60,225,164,199,181,96,174,141,66,169,236,93,
+    189,114,169,128,11,52,12,174,216,21,40,6,3,158,240,176,42,147,32,101,208,
+    225,4,92,250,160,62,137,225,65,144,166,167,193,227,74,102,210,73,57,245,
+    152,194,133,107,82,206,155,166,230,50,223,18,184,118,154,231,123,9,199,
+    21,202,188,3,83,65,1,102,203,15,188,70,178,151,243,137,125,191,62,8,143,
+    66,90,40,240,89,229,211,71,233,65,187,105,217,189,95,79,141,194,227,145,
+    43,199,69,33,87,192,46,156,10,24,79,161,140,43,7,87,77,60,98,213,187,150,
+    105,16,111,195,56,51,9,57,150,11,44,86,56,149,25,57,143,193,149,191,18,
+    219,181,203,154,37,215,187,97,229,180,81,0,69,215,163,207,147,66,218,214,
+    96,185,82,245,253,138,18,97,177,80,126,164,174,228,243,56,37,101,83,240,
+    208,26,166,101,26,61,168,186,113,53,167,194,195,30,148,145,7,73,107,63,
+    240,12,184,166,15,82,217,123,192,53,230,43,12,228,34,181,67,221,215,171,
+    105,92,31,233,253,145,218,176,205,47,41,114,79,175,5,234,120,92,239,168,
+    134,234,82,89,115,240,176,49,123,122,229,247,191,201,131,240,77,208,26,
+    147,45,213,233,134,148,186,18,69,167,235,9,142,203,124,40,11,34,0,194,
+    134,216,56,37,83,200,192,7,94,242,192,186,156,179,99,40,46,189,14,202,
+    87,25,58,85,72,15,52,24,13,16,112,70,67,168,101,176,166,40,100,199,75,
+    220,169,192,233,160,225,17,195,247,135,130,203,134,145,178,93,182,239,
+    216,31,122,61,219,46,177,92,1,167,164,192,142,105,74,108,89,62,1,2,90,
+    164,8,152,34,60,72,43,132,223,184,162,18,247,202,80,225,164,119,189,75,
+    54,144,12,101,232,14,87,167,52,121,37,148,116,78,37,169,11,15,100,171,
+    152,84,106,95,197,200,160,81,0,70,16,75,77,89,99,254,65,67,41,102,24,148,
+    11,108,129,39,72,27,232,66,132,182,252,11,112,128,125,191,63,72,220,84,
+    195,89,28,162,104,115,74,212,165,135,189,57,31,138,142,146,151,160,21,
+    192,71,132,24,46,205,159,228,49,115,122,60,240,5,133,160,123,181,249,64,
+    202,215,43,29,21,74,226,138,2,82,91,45,164,100,17,42,241,60,68,114,149,
+    175,169,140,172,117,141,201,197,158,170,92,157,91,40,26,91,35,52,182,121,
+    120,105,33,229,15,76,18,51,24,26,54,83,134,18,131,187,144,158,174,44,132,
+    61,37,4,91,7,174,20,135,48,123,193,200,189,242,19,145,92,203,101,78,61,
+    68,193,128,93,165,81,67,146,14,52,209,209,15,232,22,30,58,178,120,143,
+    235,131,104,243,204,245,129,187,30,242,148,114,174,128,52,136,249,242,
+    195,46,20,12,33,85,38,253,6,94,74,94,151,31,46,43,216,124,245,32,246,72,
+    30,62,144,189,210,48,30,43,112,181,76,74,156,152,199,12,222,66,89,211,
+    14,65,64,46,13,144,115,60,68,45,41,63,105,133,217,114,37,221,79,154,102,
+    233,245,174,101,30,34,135,43,182,77,70,33,73,10,229,208,95,54,101,56,100,
+    30,51,78,239,40,252,10,234,94,154,223,199,45,101,66,189,100,82,106,42,
+    165,82,176,77,216,113,193,246,10,84,121,181,217,254,49,16,51,104,184,236,
+    221,175,70,142,149,147,152,148,100,31,87,31,229,52,55,4,136,151,145,31,
+    233,202,3,5,233,7,156,73,73,137,156,138,202,220,75,78,144,72,244,115,37,
+    137,121,215,186,166,164,43,108,157,176,107,25,194,113,22,99,170,12,237,
+    32,6,0,200,128,154,160,137,166,9,24,146,18,161,8,152,7,190,76,209,42,39,
+    169,50,254,40,75,182,26,197,154,146,176,206,70,92,39,69,248,30,49,150,
+    93,194,18,0,41,149,37,83,239,193,59,110,249,148,82,183,232,187,170,91,
+    90,226,117,154,64,134,217,66,46,60,248,98,241,134,42,103,53,163,219,160,
+    211,214,3,87,53,160,26,203,158,151,7,136,13,100,15,10,37,10,6,210,35,251,
+    63,112,155,162,71,193,156,210,162,77,230,82,215,191,41,2,112,224,135,134,
+    242,49,102,200,26,86,78,239,0,123,149,253,31,215,188,1,226,29,1,18,65,
+    131,148,194,96,16,12,30,106,86,149,148,243,166,11,15,10,24,240,52,42,45,
+    179,49,79,73,186,184,108,80,240,212,6,31,10,143,82,225,170,228,197,31,
+    5,68,81,230,96,11,70,186,128,181,88,141,129,101,151,115,16,72,222,171,
+    241,104,226,193,211,169,20,0,94,112,195,25,2,203,170,121,170,48,106,158,
+    255,224,133,102,112,82,202,234,249,55,87,91,136,226,135,7,138,40,136,1,
+    106,42,0,168,77,51,28,229,115,115,211,50,162,224,157,34,247,14,125,243,
+    37,220,201,251,121,230,80,50,91,48,46,11,74,216,212,72,210,5,165,134,148,
+    70,131,30,7,56,112,193,104,180,138,48,209,29,138,35,112,114,102,32,185,
+    192,142,146,129,32,17,72,87,193,142,250,72,223,135,100,159,10,21,28,158,
+    106,136,151,117,63,126,160,42,64,193,188,6,72,197,23,170,226,174,135,86,
+    34,77,82,16,164,245,235,213,206,107,198,218,169,180,196,111,232,19,57,
+    26,58,22,156,122,4,177,104,30,80,239,85,21,112,4,210,33,1,153,243,49,53,
+    105,78,239,202,206,93,36,156,140,176,162,1,35,234,0,239,113,45,150,89,
+    188,44,0,65,168,32,10,56,89,128,3,207,23,242,80,132,118,158,22,2,50,38,
+    29,80,244,33,149,146,193,242,33,92,168,161,96,215,10,143,218,45,45,22,
+    114,144,145,104,89,137,68,225,87,84,123,165,92,219,211,172,98,81,218,176,
+    107,70,138,86,176,64,161,124,65,39,87,83,164,17,207,174,121,72,29,80,110,
+    246,85,213,210,68,205,150,130,10,57,124,101,16,134,157,26,127,19,45,66,
+    85,96,148,85,55,119,41,184,96,139,60,17,124,32,153,146,171,143,149,10,
+    245,4,147,108,67,191,144,100,147,83,148,35,151,81,0,147,132,85,115,164,
+    241,141,3,131,98,197,208,148,45,196,233,228,182,178,11,135,66,173,92,51,
+    0,14,186,70,214,225,66,110,205,178,146,178,168,116,200,53,98,219,69,185,
+    250,138,93,202,170,206,187,58,186,9,26,106,158,236,155,239,42,33,120,96,
+    41,148,120,30,132,20,176,234,232,241,48,101,83,147,1,80,31,91,150,139,
+    182,87,244,114,153,151,175,69,120,46,220,242,78,10,53,15,178,82,47,53,
+    69,233,150,193,160,231,145,38,191,148,211,21,60,172,86,49,131,204,214,
+    130,104,234,159,97,101,118,133,135,24,95,165,229,67,122,171,165,181,194,
+    65,130,55,69,232,16,125,244,33,247,33,185,131,38,64,158,93,178,60,115,
+    150,75,160,119,59,136,102,207,190,21,156,252,1,57,206,126,20,169,135,47,
+    197,4,127,30,143,195,63,93,22,237,27,120,220,10,171,114,161,248,72,29,
+    59,101,155,91,173,80,91,105,75,91,186,78,107,57,76,101,167,168,164,72,
+    233,209,187,30,138,224,84,184,33,232,213,13,157,150,237,90,26,115,149,
+    66,226,21,31,175,43,198,32,53,114,63,164,223,30,135,71,185,230,228,249,
+    141,25,87,122,33,116,10,7,79,159,83,169,95,163,231,1,144,224,107,156,154,
+    64,228,227,170,102,27,37,156,228,101,23,211,50,144,121,185,15,255,101,
+    206,227,112,245,56,28,170,135,242,1,85,34,239,213,35,69,76,169,67,185,
+    229,218,74,119,149,87,135,180,112,3,58,239,112,205,117,8,234,128,163,246,
+    175,143,154,157,103,121,81,90,85,240,223,248,25,223,208,38,164,20,86,15,
+    123,133,38,100,92,34,227,118,61,176,65,241,202,205,229,2,254,171,41,189,
+    110,136,9,96,138,135,131,150,45,107,40,92,107,135,21,211,239,198,220,191,
+    138,56,20,118,189,217,88,175,28,99,38,142,17,69,173,35,248,129,17,236,
+    115,132,86,53,250,179,145,210,33,118,192,199,43,160,14,16,43,240,147,37,
+    255,174,180,52,27,34,219,226,77,187,224,49,228,140,157,176,126,237,96,
+    30,55,110,88,61,30,212,97,82,72,6,145,24,60,99,187,12,238,18,85,153,24,
+    167,147,195,225,122,189,165,246,10,53,221,48,29,226,2,159,90,153,239,61,
+    58,131,39,245,95,148,246,80,124,97,117,173,221,160,131,228,16,220,53,96,
+    79,203,69,94,151,33,174,70,220,208,121,249,122,227,104,181,34,111,86,7,
+    206,0,43,84,135,124,87,171,107,185,88,84,250,235,92,227,16,20,143,90,97,
+    85,188,161,197,244,10,246,96,0,221,135,213,77,199,216,212,33,219,33,238,
+    160,115,136,99,35,119,207,62,160,36,32,225,176,82,195,58,154,114,44,5,
+    134,183,248,81,211,188,188,74,182,212,64,235,76,111,220,166,208,40,222,
+    86,136,142,56,162,201,124,202,152,26,238,224,116,81,102,105,4,254,112,
+    188,242,95,70,19,84,209,60,11,172,224,53,173,173,200,139,71,188,90,217,
+    49,56,64,24,139,214,106,43,129,132,56,87,92,86,116,30,110,7,54,86,129,
+    143,131,185,150,15,133,3,144,16,53,200,107,181,250,203,254,197,24,13,80,
+    3,241,136,64,28,125,141,82,242,163,243,10,58,14,132,36,126,170,29,16,97,
+    185,88,43,174,32,155,64,44,99,59,254,181,227,43,69,173,200,4,240,132,129,
+    149,4,89,244,30,181,85,97,229,216,197,199,202,174,57,43,231,129,225,88,
+    174,152,198,30,101,174,188,149,120,92,21,87,181,130,6,70,126,64,45,154,
+    244,150,26,207,169,221,10,197,218,141,61,15,143,199,77,49,230,40,3,11,
+    143,124,76,223,110,54,56,22,237,131,13,194,15,251,64,0,98,204,199,53,190,
+    29,202,134,47,175,32,15,11,52,24,179,38,60,214,32,215,212,86,135,155,119,
+    45,210,56,219,150,99,92,78,0,226,57,7,77,163,21,44,236,20,203,135,92,213,
+    120,189,104,19,92,230,0,47,229,27,185,224,137,134,154,125,88,225,237,50,
+    253,16,28,172,167,195,61,58,165,37,24,88,161,154,26,10,191,30,0,146,99,
+    135,87,60,56,55,50,200,3,0,135,62,111,7,210,251,113,187,106,241,218,234,
+    113,208,40,77,87,135,226,129,125,106,135,178,147,218,113,145,120,65,154,
+    156,115,10,143,34,8,198,181,244,128,39,14,133,199,13,119,198,180,1,18,
+    6,38,107,133,50,106,68,213,53,72,38,98,176,84,113,69,193,30,233,119,59,
+    92,15,183,248,138,6,168,2,128,153,33,40,136,218,177,58,42,54,171,162,228,
+    193,176,169,93,33,47,101,4,166,215,3,216,216,181,85,188,74,217,145,239,
+    111,171,67,153,20,56,48,167,202,8,193,177,81,64,76,90,165,43,123,69,182,
+    221,110,120,239,22,199,41,216,22,169,228,80,59,56,122,59,89,233,32,34,
+    249,22,10,135,56,182,97,0,53,214,48,252,141,165,12,50,1,253,21,16,212,
+    174,184,213,20,139,183,90,177,102,63,224,184,72,77,164,122,113,197,120,
+    94,49,15,68,36,156,30,160,150,100,241,208,155,77,34,209,177,130,135,190,
+    116,88,118,212,2,1,73,150,215,30,6,33,223,156,213,245,70,100,214,138,48,
+    114,195,15,132,255,1,13,30,110,143,171,22,6,223,219,202,41,240,252,161,
+    64,151,183,21,118,195,253,94,113,117,43,30,168,133,92,62,176,168,147,30,
+    184,64,34,241,124,17,246,86,230,6,192,56,130,149,120,68,217,199,80,100,
+    78,223,10,244,87,36,107,83,241,142,174,86,24,250,176,90,221,72,183,50,
+    20,96,61,108,194,231,195,181,22,23,99,194,180,120,40,19,199,100,36,128,
+    16,247,43,84,89,180,77,28,215,138,152,219,118,104,179,172,89,195,125,197,
+    148,92,160,174,154,182,224,123,222,206,111,43,175,6,224,232,154,90,237,
+    27,56,32,153,85,236,56,76,54,214,166,45,228,131,240,249,72,238,93,15,181,
+    248,129,255,188,154,115,56,16,112,184,236,198,9,3,14,202,197,148,191,160,
+    85,50,88,165,49,222,75,99,174,167,2,1,42,12,42,64,14,55,154,5,120,252,
+    167,48,33,102,106,177,115,187,178,12,80,80,212,65,170,0,99,244,127,136,
+    111,244,199,163,55,88,122,232,60,179,82,80,230,145,98,163,111,212,193,
+    109,229,34,51,228,80,115,16,121,122,16,161,252,237,193,160,1,38,20,204,
+    92,42,196,240,15,49,197,114,92,188,166,236,244,144,213,227,171,147,62,
+    110,181,21,23,98,213,197,190,160,85,36,158,15,114,96,153,36,135,116,140,
+    185,194,164,172,20,59,72,76,171,173,114,82,175,128,203,226,55,194,136,
+    193,142,222,16,228,117,229,224,87,231,64,217,196,232,10,241,220,40,181,
+    70,95,60,160,209,120,165,121,26,82,33,104,128,163,143,185,221,8,32,163,
+    250,106,166,136,193,225,166,236,193,18,95,9,197,219,205,51,242,16,53,94,
+    139,136,219,22,129,234,155,225,235,176,26,56,26,125,246,20,50,7,7,97,240,
+    69,249,240,136,15,4,87,113,37,12,40,2,220,106,183,195,13,39,35,78,214,
+    68,41,15,167,70,162,165,100,1,34,162,35,172,10,241,204,169,98,45,22,11,
+    78,77,246,231,4,77,135,232,154,150,115,82,243,221,73,106,83,20,141,44,
+    101,107,182,172,14,186,72,118,75,200,197,213,129,251,11,120,142,19,81,
+    177,232,193,235,77,155,227,159,91,236,120,143,34,184,58,88,143,132,146,
+    83,28,38,119,237,102,152,35,60,65,230,160,68,16,55,4,2,148,104,198,80,
+    1,103,104,66,231,22,167,142,3,80,116,77,163,53,53,75,40,57,249,115,120,
+    129,75,204,233,52,230,239,195,10,14,72,37,25,133,211,70,185,38,104,48,
+    28,27,26,160,224,31,150,62,120,172,89,179,157,88,146,195,48,196,24,147,
+    94,220,23,111,15,5,136,154,146,129,212,2,167,55,131,184,9,181,88,77,162,
+    52,135,40,163,196,152,191,24,44,181,149,35,92,89,184,136,113,97,244,198,
+    131,87,28,194,159,34,138,18,83,53,202,224,209,3,29,22,77,205,196,242,159,
+    193,20,171,149,103,99,19,1,141,196,16,132,186,57,228,49,172,60,101,47,
+    118,65,0,208,192,100,91,61,184,53,159,190,40,156,111,98,85,16,83,180,145,
+    215,89,18,47,176,33,106,78,85,67,77,42,197,29,4,240,74,189,197,240,135,
+    45,69,182,70,4,63,197,11,43,214,116,107,17,90,248,155,72,200,139,230,62,
+    35,222,15,169,163,172,96,91,221,0,1,252,116,88,234,38,95,220,60,156,87,
+    140,107,194,238,16,215,212,0,26,4,12,158,188,201,41,180,34,188,41,243,
+    200,172,62,40,119,64,78,212,112,18,64,165,172,77,12,202,25,132,3,130,175,
+    169,27,254,17,191,171,10,11,56,168,151,58,22,76,179,26,153,118,131,92,
+    105,67,138,138,107,181,197,77,61,57,197,53,18,200,101,122,4,164,244,230,
+    137,39,67,110,213,52,253,188,195,209,196,197,35,221,21,43,218,154,88,225,
+    69,135,35,33,68,59,196,12,238,46,138,25,52,43,68,208,197,237,120,44,74,
+    25,64,72,20,194,11,249,72,189,241,109,93,52,250,164,84,172,80,101,238,
+    42,208,212,9,143,167,215,128,90,201,149,27,23,117,197,48,221,101,41,9,
+    14,77,199,255,143,40,182,161,100,229,45,172,74,25,14,218,147,134,17,21,
+    228,83,39,96,107,15,138,244,244,163,230,137,81,120,84,171,142,1,199,218,
+    154,131,10,213,221,214,235,220,120,120,105,37,249,129,157,212,131,191,
+    89,122,189,170,192,22,229,225,193,88,211,23,227,25,232,118,132,111,188,
+    160,239,90,92,113,142,135,195,241,166,212,162,120,108,178,162,102,200,
+    93,175,100,117,4,8,173,149,218,225,136,228,107,171,69,42,150,248,18,29,
+    208,241,45,206,185,92,175,142,177,19,31,21,21,116,13,229,41,42,150,226,
+    215,30,22,192,246,146,235,113,77,65,11,4,130,56,184,204,10,183,10,90,224,
+    202,97,149,67,155,167,23,228,74,134,72,154,170,137,7,167,18,215,22,48,
+    121,200,39,3,170,90,211,66,254,186,113,32,49,101,230,92,178,92,200,175,
+    178,168,1,226,212,44,22,242,239,237,246,87,150,54,135,191,197,120,85,57,
+    30,106,21,79,134,231,126,135,7,65,5,68,112,108,177,230,41,204,100,120,
+    229,200,10,6,227,227,106,189,86,163,60,129,30,87,249,210,202,123,188,181,
+    56,178,114,30,119,42,253,184,98,43,228,71,124,8,14,205,103,14,88,208,132,
+    76,106,21,101,15,104,31,61,232,141,87,136,20,101,173,169,33,143,197,10,
+    248,115,166,163,158,88,150,129,143,181,22,189,9,211,88,167,60,132,87,193,
+    14,181,69,69,129,87,57,162,127,32,44,58,138,135,227,205,89,128,232,81,
+    190,102,185,35,174,88,203,241,71,15,35,44,214,206,90,102,161,118,143,235,
+    11,28,95,84,70,255,59,104,175,138,21,57,110,13,98,26,46,197,155,227,208,
+    24,200,29,148,80,21,77,56,29,26,48,17,151,13,186,91,173,87,139,133,82,
+    117,21,203,78,135,35,158,91,175,143,108,71,138,230,161,193,106,7,175,82,
+    92,45,214,135,117,109,141,156,87,185,98,138,113,229,224,172,97,174,118,
+    60,172,98,163,99,5,134,139,243,111,100,116,7,63,74,1,139,21,206,169,28,
+    165,94,137,98,225,32,69,101,190,136,61,174,80,128,225,196,81,59,46,226,
+    218,90,120,136,112,30,171,72,147,181,10,241,184,58,74,247,11,0,229,151,
+    219,2,239,214,226,53,117,214,254,193,115,144,23,106,10,181,226,2,248,81,
+    25,7,39,50,187,8,21,113,109,103,56,106,220,42,197,245,14,130,138,183,221,
+    17,164,117,105,161,195,16,234,7,194,163,179,174,84,42,154,209,244,88,91,
+    72,114,22,26,113,28,157,59,214,212,124,91,31,99,217,140,165,161,162,8,
+    58,185,58,86,69,139,109,40,188,194,134,68,182,158,94,223,212,109,5,40,
+    65,154,6,48,160,131,89,105,130,5,99,220,114,168,172,15,64,196,79,210,237,
+    144,31,192,132,111,173,104,214,53,225,141,1,43,180,191,144,9,14,135,155,
+    218,244,214,14,188,203,20,197,53,147,157,187,113,9,243,225,120,4,136,138,
+    69,28,25,202,95,173,139,104,149,153,177,58,234,120,81,203,3,188,72,105,
+    18,54,10,254,187,178,138,199,133,10,90,120,14,150,198,173,113,238,9,110,
+    162,175,27,125,30,143,234,251,72,99,199,195,2,73,41,60,86,60,179,184,173,
+    43,55,141,148,149,64,62,42,11,22,34,191,130,104,209,100,92,41,82,37,168,
+    176,166,65,109,235,227,202,89,172,1,106,145,75,133,140,93,57,36,179,85,
+    41,98,183,248,80,225,136,136,152,15,187,69,28,231,82,56,56,11,160,90,233,
+    232,80,177,36,86,167,178,91,59,160,176,168,128,202,81,217,11,108,199,35,
+    69,56,183,202,162,104,209,185,146,181,184,62,86,226,53,232,192,217,17,
+    84,143,234,29,71,208,14,39,216,216,217,45,204,237,232,169,50,163,3,68,
+    81,57,11,3,200,226,104,156,120,161,48,56,228,17,229,45,106,59,68,175,110,
+    88,246,232,28,229,108,162,154,149,215,160,114,144,156,215,43,253,57,84,
+    226,93,173,82,89,29,45,76,187,3,230,53,198,138,227,197,90,213,0,115,17,
+    34,138,183,24,159,82,55,22,92,32,91,192,211,164,161,36,179,171,28,43,183,
+    133,69,6,2,200,209,89,224,100,40,174,72,84,55,231,200,74,235,138,23,203,
+    15,52,78,48,98,183,138,33,9,214,86,81,141,56,220,74,232,30,43,214,58,6,
+    6,124,76,160,85,214,216,198,2,148,99,205,89,8,22,96,210,24,57,198,150,
+    188,178,56,222,22,183,138,81,148,209,42,170,175,16,253,197,248,184,190,
+    81,8,186,71,34,59,52,108,129,142,133,122,117,80,174,177,167,4,132,16,226,
+    91,5,42,148,152,176,84,129,232,133,99,22,124,21,175,226,221,130,185,34,
+    127,86,28,154,92,29,143,139,98,145,234,157,69,101,189,96,101,46,96,215,
+    10,13,28,133,42,249,130,88,233,67,108,147,38,21,139,66,214,36,39,154,52,
+    144,79,206,46,42,156,45,118,71,61,128,55,23,242,58,220,45,184,41,62,196,
+    66,106,65,175,149,195,98,189,94,115,27,126,210,203,204,193,236,44,107,
+    125,180,128,219,146,22,193,12,224,137,138,252,38,134,56,82,88,51,166,48,
+    168,165,85,32,209,236,216,26,238,77,92,169,0,120,49,207,171,10,33,122,
+    92,243,92,205,34,142,23,40,13,53,31,214,187,227,145,50,23,22,69,225,85,
+    170,173,121,222,177,184,67,220,22,184,220,214,241,90,81,140,177,87,199,
+    29,225,67,100,87,216,126,71,1,52,130,142,56,59,238,88,97,161,99,126,165,
+    194,216,89,172,204,145,209,83,169,56,177,135,94,193,16,183,238,128,3,191,
+    197,22,195,231,176,59,160,197,117,101,97,29,21,237,122,207,115,214,107,
+    140,226,236,152,53,52,231,172,139,10,225,88,94,16,239,249,225,115,21,227,
+    32,242,144,204,98,174,56,128,84,65,23,59,29,88,43,148,177,142,29,11,179,
+    113,154,178,142,78,69,152,227,97,167,114,52,187,157,222,47,72,69,208,94,
+    99,80,199,162,89,228,13,68,20,70,238,85,52,76,224,164,66,200,89,53,176,
+    176,226,181,69,28,237,172,157,65,157,8,108,183,163,50,232,167,143,181,
+    222,74,120,8,36,42,128,105,140,48,1,34,194,166,102,145,13,192,125,100,
+    3,124,85,41,198,158,130,181,178,216,21,215,11,78,99,144,186,198,130,0,
+    182,102,98,198,22,31,111,53,121,101,33,194,1,220,226,172,16,123,72,15,
+    249,45,168,145,120,178,8,38,140,135,206,188,138,140,193,192,87,84,87,36,
+    191,21,92,162,68,235,104,161,207,221,122,5,85,149,154,71,35,187,35,32,
+    152,154,39,149,145,157,11,107,183,224,181,204,242,242,58,177,70,197,16,
+    65,71,111,7,80,59,116,73,138,223,214,11,42,212,152,95,59,214,81,106,64,
+    139,4,23,188,23,145,222,26,31,147,52,150,101,208,41,99,132,182,156,53,
+    121,34,166,22,158,117,240,232,97,1,227,36,137,199,18,249,130,235,188,15,
+    78,26,150,3,46,72,150,156,58,152,181,195,250,138,57,104,182,156,191,32,
+    202,63,220,181,224,4,198,93,199,131,214,22,78,196,120,69,38,39,166,22,
+    28,229,22,187,27,247,40,30,177,219,14,246,249,4,238,220,18,107,174,177,
+    34,185,3,107,180,158,71,244,142,218,98,171,2,222,59,62,91,170,180,34,149,
+    214,164,170,10,146,244,192,191,2,93,134,53,225,17,118,48,167,188,96,153,
+    157,57,22,157,245,113,199,120,195,215,113,37,94,120,106,122,199,176,62,
+    198,236,162,81,8,40,98,105,135,228,120,76,107,30,101,95,85,5,117,108,74,
+    243,22,156,59,177,101,169,213,5,244,46,200,38,42,38,207,85,49,190,98,107,
+    177,7,147,96,130,130,215,148,9,101,84,172,99,130,7,9,40,137,68,149,122,
+    32,100,167,134,45,182,182,142,197,138,135,191,117,63,19,138,58,142,149,
+    220,175,40,149,77,45,221,185,230,51,229,173,21,53,55,178,20,77,211,33,
+    200,90,21,139,82,21,139,241,129,38,184,143,49,205,113,5,61,123,60,204,
+    194,22,78,1,202,69,172,234,22,10,59,100,112,100,98,221,184,151,125,215,
+    18,72,101,231,176,16,202,2,128,53,158,98,214,238,0,120,199,171,53,192,
+    236,100,98,21,65,55,212,67,152,83,233,145,49,22,175,1,176,162,111,105,
+    243,184,227,57,101,8,226,166,180,35,160,56,200,30,180,248,150,59,192,71,
+    195,4,112,60,250,128,192,138,101,253,191,53,96,2,48,28,1,110,244,205,19,
+    203,133,176,149,85,29,182,68,204,235,170,85,201,63,179,16,171,237,37,185,
+    133,113,228,194,25,158,164,85,236,93,209,116,21,165,235,188,117,68,135,
+    72,204,81,121,171,2,249,125,189,94,198,198,145,146,233,22,98,45,185,158,
+    156,19,2,30,30,5,243,69,222,32,171,44,114,232,40,243,168,50,119,232,131,
+    237,115,53,28,151,88,209,59,26,137,221,153,197,44,6,196,71,199,2,194,138,
+    113,232,96,171,154,23,58,184,40,9,119,154,48,11,103,171,24,80,193,139,
+    189,136,115,102,48,40,105,145,178,148,88,201,17,230,171,216,66,238,241,
+    122,169,16,218,197,91,17,226,237,41,254,232,44,89,121,79,151,128,235,197,
+    123,202,212,122,149,202,114,43,193,130,11,45,82,14,20,28,247,114,188,250,
+    231,75,105,217,177,60,170,103,10,82,16,251,137,159,237,30,122,183,51,135,
+    253,64,205,154,57,51,54,92,239,164,129,25,184,252,83,22,253,88,185,19,
+    200,22,52,102,142,90,100,143,16,182,199,109,165,90,133,144,245,186,138,
+    246,176,43,16,30,189,197,98,175,62,164,91,207,19,224,172,180,144,66,226,
+    227,178,178,93,24,52,29,243,124,188,164,186,202,122,185,88,44,171,71,62,
+    147,78,92,225,126,152,226,136,225,85,143,179,221,177,138,179,241,186,35,
+    58,102,34,198,154,97,60,249,143,157,84,37,135,93,150,217,111,185,82,137,
+    171,166,178,175,66,55,98,216,34,14,226,87,209,79,122,41,130,183,139,89,
+    117,183,216,105,149,117,206,21,75,91,59,70,176,179,219,85,233,79,172,56,
+    98,66,105,153,119,87,169,226,65,16,207,85,58,99,255,45,125,129,14,3,121,
+    127,92,114,166,0,173,45,185,107,225,196,163,198,121,117,169,145,3,51,203,
+    109,149,24,133,127,196,66,143,235,153,135,23,43,241,30,236,89,29,10,185,
+    171,178,223,3,36,61,175,143,251,37,68,75,139,199,202,158,252,65,46,52,
+    179,152,85,182,21,41,111,199,94,241,114,191,173,46,227,37,13,40,108,120,
+    208,170,108,145,34,232,236,182,187,138,7,55,232,157,208,58,178,210,122,
+    183,181,116,22,69,112,86,108,177,169,156,186,220,243,220,118,22,87,133,
+    46,34,92,3,208,174,202,177,114,6,179,91,107,182,93,84,33,10,28,151,75,
+    107,171,196,177,150,134,175,81,213,110,43,211,99,158,202,126,65,233,38,
+    222,49,103,100,61,100,176,94,66,36,122,170,16,17,59,82,156,94,118,139,
+    153,242,5,179,147,178,4,50,214,155,177,169,65,129,80,176,219,31,45,7,142,
+    200,137,29,251,208,246,108,87,173,86,225,180,186,197,81,149,229,110,61,
+    147,134,119,123,44,83,101,255,37,232,210,1,223,198,71,88,244,244,176,179,
+    92,154,120,111,109,173,93,101,137,207,102,251,234,174,178,117,216,154,
+    181,13,64,56,234,208,65,109,75,49,188,71,209,36,63,83,141,67,42,235,120,
+    91,186,49,30,242,209,52,179,150,219,245,126,95,69,116,107,1,185,116,176,
+    238,113,86,173,238,119,75,32,218,237,233,101,102,109,145,208,204,170,236,
+    227,234,122,187,216,110,143,51,234,66,157,139,125,53,22,12,184,7,153,49,
+    92,118,179,237,177,42,231,26,9,102,187,94,239,103,203,10,184,86,246,51,
+    236,176,183,152,28,184,210,178,182,139,189,101,150,150,216,135,111,234,
+    68,179,91,148,50,91,46,247,64,204,10,51,48,221,83,253,12,239,85,73,131,
+    165,4,199,138,91,254,204,150,219,45,228,207,64,55,174,198,196,208,142,
+    87,3,212,194,154,180,160,56,60,206,246,224,165,9,182,159,205,42,203,74,
+    197,120,11,253,181,95,90,251,234,218,169,46,64,187,170,60,227,243,110,
+    102,89,139,25,101,1,228,118,87,221,46,20,136,85,164,108,41,239,104,129,
+    147,210,204,217,1,46,101,49,18,102,4,193,242,184,221,86,247,176,29,239,
+    23,222,118,231,44,247,123,198,245,118,79,68,111,151,123,20,203,59,204,
+    108,73,90,111,227,101,197,193,222,75,254,112,25,88,137,71,246,164,198,
+    61,44,237,215,219,74,197,242,16,254,118,27,139,78,180,14,26,184,88,253,
+    47,53,245,22,4,4,213,65,161,230,172,130,31,96,21,86,24,140,133,61,30,35,
+    191,150,113,117,134,120,208,110,181,130,36,143,156,226,170,12,30,3,82,
+    48,95,181,118,88,185,138,51,142,139,234,140,202,171,4,215,140,249,113,
+    132,216,197,118,137,48,33,133,179,113,21,44,189,42,103,175,181,53,171,
+    172,247,203,237,50,86,44,174,205,158,44,224,19,94,89,243,170,186,115,182,
+    51,111,91,221,170,94,140,195,105,4,36,120,120,102,56,132,109,29,111,207,
+    183,203,101,85,199,115,62,238,23,251,189,3,181,91,204,104,177,215,142,
+    205,119,219,120,191,172,44,102,82,209,174,186,219,59,58,179,44,0,111,75,
+    167,18,251,113,11,55,213,42,142,196,96,8,105,107,109,151,235,234,126,198,
+    54,152,103,73,8,209,248,114,189,36,126,150,51,208,207,63,25,13,4,214,170,
+    96,115,248,70,140,75,98,146,38,171,235,234,118,89,57,90,75,196,176,174,
+    46,23,203,93,204,78,59,58,84,83,250,125,75,178,238,150,213,5,72,50,62,
+    80,29,221,29,183,251,173,19,239,118,123,11,5,82,202,18,26,227,237,108,
+    54,35,232,246,241,158,105,187,214,240,182,72,183,125,21,158,119,149,25,
+    176,17,88,139,45,101,110,183,249,25,13,22,200,46,168,116,20,88,160,178,
+    199,80,232,115,239,88,123,7,122,102,213,24,25,16,171,192,192,218,116,36,
+    66,151,32,76,44,146,121,80,10,185,74,191,153,229,237,151,85,131,18,119,
+    75,71,199,5,220,82,61,110,171,149,217,108,11,119,149,106,188,207,9,223,
+    115,40,177,118,148,142,87,246,107,174,89,188,53,47,119,156,149,183,85,
+    13,159,37,51,130,148,218,242,27,103,108,139,238,89,160,226,17,239,85,162,
+    104,75,15,92,88,224,68,242,82,147,239,56,115,32,116,15,110,204,84,10,227,
+    135,33,97,201,22,249,133,85,60,86,172,194,51,101,146,208,203,152,245,81,
+    243,18,144,192,36,94,46,119,20,74,24,123,139,153,37,4,88,217,218,91,30,
+    241,50,171,114,4,95,192,243,2,252,227,10,232,199,108,186,196,218,148,177,
+    85,150,176,170,74,90,46,32,225,88,93,108,13,204,238,24,218,150,84,65,251,
+    52,106,188,170,133,202,103,108,138,120,22,148,73,204,239,13,185,131,60,
+    68,240,222,217,86,201,7,242,101,169,124,56,10,92,197,3,186,89,51,18,153,
+    249,51,34,126,139,181,9,57,224,70,148,203,99,213,90,234,24,128,179,118,
+    152,81,103,202,189,66,7,53,44,183,139,216,130,148,42,186,89,162,133,25,
+    3,112,235,56,85,46,57,48,122,164,111,86,153,45,53,95,12,114,135,71,2,186,
+    2,231,216,118,65,65,24,13,21,108,151,150,87,69,153,14,71,136,165,66,141,
+    1,29,239,247,91,157,162,185,76,75,21,196,68,87,20,62,35,87,157,35,59,48,
+    149,247,51,213,49,219,239,246,88,31,101,205,8,71,133,214,146,68,163,230,
+    37,98,97,222,129,30,69,227,244,28,113,228,79,32,86,23,12,87,134,206,110,
+    38,119,110,85,139,242,110,182,37,21,103,244,190,199,163,68,131,183,36,
+    164,53,122,102,241,204,99,242,82,45,19,94,132,91,206,140,242,151,168,4,
+    157,88,85,18,232,40,249,26,64,100,90,177,48,82,195,78,218,17,185,86,247,
+    251,37,163,6,141,200,106,22,133,207,102,76,112,103,102,184,150,131,188,
+    95,104,81,146,131,15,8,87,67,7,148,25,99,170,105,198,219,6,252,57,251,
+    173,234,50,22,61,128,206,214,219,85,103,51,96,198,8,72,157,6,168,57,183,
+    250,190,234,96,2,194,44,151,23,2,153,137,5,117,202,248,162,69,6,46,153,
+    45,173,243,4,255,42,60,16,76,213,35,4,128,102,135,215,89,140,25,178,142,
+    233,64,207,146,121,164,3,14,35,201,136,193,173,56,113,170,102,86,161,166,
+    237,82,92,243,126,142,65,105,98,171,9,32,160,157,191,92,170,238,228,89,
+    78,30,104,143,195,171,230,227,114,141,6,156,88,157,99,147,157,101,12,80,
+    146,33,116,206,236,101,202,17,203,91,139,80,96,238,138,187,173,224,3,132,
+    165,183,83,122,236,197,228,182,58,115,48,131,140,5,133,28,23,56,20,45,
+    119,228,154,230,225,30,219,205,180,213,30,16,9,186,60,127,247,198,161,
+    57,10,182,116,32,219,1,217,94,142,192,110,51,165,11,5,160,41,86,198,169,
+    112,76,254,84,151,166,90,157,33,2,180,13,60,212,196,187,7,29,19,72,241,
+    17,115,72,135,210,223,204,112,152,148,136,249,7,249,198,200,144,79,60,
+    64,230,160,40,234,148,55,172,61,146,64,28,180,72,100,226,19,105,7,104,
+    153,85,192,70,220,238,1,70,92,232,6,73,142,234,246,202,11,198,206,158,
+    131,14,183,3,101,188,83,72,18,138,51,111,182,247,168,149,229,137,5,110,
+    102,209,157,106,112,36,45,210,15,141,47,247,82,130,224,203,69,66,244,169,
+    62,78,116,14,254,224,239,61,27,86,117,202,224,159,229,242,95,170,42,100,
+    201,84,205,179,170,166,20,197,33,69,234,194,1,18,239,54,206,143,37,152,
+    144,7,48,2,150,231,151,61,163,157,187,246,6,239,107,108,109,103,193,12,
+    166,34,25,148,62,64,195,137,37,79,152,131,73,169,123,233,243,31,185,204,
+    87,180,206,154,62,55,82,85,85,2,66,244,170,61,159,206,75,29,75,102,94,
+    184,149,152,65,69,136,90,177,80,216,197,86,126,80,160,112,162,81,143,206,
+    116,162,197,75,20,229,253,91,0,92,169,118,203,216,102,15,75,204,110,255,
+    201,121,239,83,246,142,17,61,147,99,165,220,144,100,95,234,76,12,35,228,
+    172,183,204,185,128,128,136,53,34,214,39,209,1,130,57,204,82,74,138,157,
+    242,110,171,114,232,193,169,234,130,3,177,33,200,238,128,24,244,242,7,
+    52,184,24,240,32,66,43,200,137,25,84,93,6,66,81,63,52,115,197,65,149,241,
+    131,214,73,44,139,175,114,221,192,93,36,232,105,207,223,137,57,234,140,
+    101,91,173,130,182,226,191,0,191,223,139,0,61,3,190,168,97,159,163,89,
+    149,141,77,44,240,183,62,85,85,181,35,162,6,68,159,241,205,113,108,231,
+    45,67,180,161,217,130,36,225,214,209,233,177,26,176,65,224,43,10,163,153,
+    198,23,145,153,55,11,87,91,179,223,123,140,118,254,120,112,38,66,64,43,
+    14,209,14,142,64,124,91,229,24,227,129,234,32,215,145,62,128,129,175,118,
+    203,200,236,37,96,232,14,0,37,168,90,177,206,46,177,111,85,125,127,201,
+    97,218,147,117,120,90,16,237,67,31,68,151,126,28,4,249,84,115,96,64,63,
+    227,128,32,83,86,111,157,40,218,70,48,188,196,21,213,104,25,136,31,201,
+    137,167,253,170,96,197,14,145,84,9,208,28,29,172,124,50,44,3,104,93,42,
+    240,73,55,7,26,173,64,7,29,34,152,167,101,7,216,8,171,129,230,73,85,154,
+    149,108,131,170,146,208,219,226,195,153,152,214,241,114,41,0,66,234,139,
+    34,254,14,170,161,142,102,203,93,21,97,237,183,129,2,94,71,90,172,232,
+    32,168,112,105,5,241,206,7,159,229,150,50,181,32,124,97,130,24,58,232,
+    158,93,162,125,53,151,1,170,227,150,16,184,173,170,217,239,254,74,250,
+    177,166,200,82,33,237,3,118,53,8,118,51,31,216,245,42,230,97,174,170,143,
+    52,121,128,159,212,78,193,10,22,189,178,133,58,169,113,214,85,150,232,
+    68,39,43,208,3,39,44,82,15,157,106,38,135,113,24,85,3,82,214,223,70,200,
+    155,161,1,166,218,20,27,46,101,221,173,207,209,43,152,193,88,176,52,62,
+    74,153,41,15,48,209,54,172,146,159,251,32,150,48,160,75,33,236,87,183,
+    62,63,112,152,126,149,0,183,200,107,39,237,234,79,36,129,163,4,232,153,
+    97,188,234,204,219,135,187,157,217,70,140,23,246,217,230,89,72,168,59,
+    129,143,131,32,45,18,202,193,146,61,28,60,230,205,116,114,241,247,59,154,
+    4,83,198,170,70,170,182,166,188,96,25,35,216,89,24,231,225,24,205,194,
+    189,222,46,8,75,20,232,71,65,236,73,245,160,192,123,221,82,177,18,5,24,
+    14,217,240,42,67,17,1,4,91,178,191,101,69,140,8,38,212,50,138,130,125,
+    168,108,12,170,1,137,70,182,161,146,157,244,19,105,8,68,123,133,135,21,
+    41,234,57,40,115,156,218,2,102,14,106,53,14,103,97,40,54,150,242,16,2,
+    221,7,193,222,15,163,48,146,112,33,135,252,178,52,194,150,102,22,110,173,
+    0,153,134,88,13,253,128,156,229,43,72,119,146,153,63,11,151,129,37,49,
+    135,100,30,248,122,36,25,85,113,242,38,72,188,200,10,130,45,130,85,244,
+    6,161,242,25,161,250,85,66,170,202,3,244,231,83,85,64,84,146,15,145,191,
+    11,45,5,171,175,41,179,143,184,59,242,2,182,99,196,208,10,135,127,157,
+    225,35,199,167,99,31,153,1,72,46,113,154,11,57,78,133,213,200,15,88,126,
+    239,7,219,144,27,48,70,53,192,144,59,180,51,83,232,112,246,242,117,222,
+    154,113,87,196,235,59,15,163,119,191,186,11,120,34,154,249,142,164,20,
+    120,129,14,239,78,224,224,125,175,186,140,80,249,108,159,231,5,139,46,
+    131,136,65,135,143,247,26,9,123,96,9,182,236,132,210,252,173,7,120,240,
+    30,7,113,104,153,96,57,11,163,56,208,44,169,250,36,50,243,51,218,27,11,
+    190,2,205,197,112,7,208,40,27,133,132,140,83,159,0,9,131,40,32,45,170,
+    8,7,64,185,180,13,56,251,249,1,72,109,247,33,182,4,46,132,26,45,13,29,
+    45,141,226,50,144,155,183,138,25,127,38,144,1,160,26,110,61,11,226,229,
+    6,133,132,175,113,145,163,194,201,43,218,197,251,8,147,224,34,2,33,142,
+    98,0,143,124,75,196,7,22,141,161,72,169,196,241,240,65,200,189,62,39,202,
+    104,198,151,104,109,203,81,46,164,203,0,94,13,133,82,218,94,65,20,48,218,
+    29,24,13,29,0,138,116,156,33,181,3,130,124,25,200,105,142,104,34,122,248,
+    41,10,28,31,249,248,123,223,183,32,6,109,238,116,242,205,111,66,123,164,
+    195,214,242,66,78,55,213,144,28,217,7,58,88,48,219,171,185,213,105,7,196,
+    157,144,113,191,220,169,5,31,205,239,208,88,84,141,182,40,46,80,60,65,
+    33,210,169,134,154,91,108,160,111,121,123,138,34,11,180,105,19,163,8,67,
+    120,219,161,69,20,18,50,157,124,168,15,103,81,213,15,241,160,78,18,75,
+    250,64,58,203,144,175,99,63,172,170,96,204,28,129,41,95,133,202,83,199,
+    10,224,45,10,124,227,88,44,232,131,241,108,231,8,253,112,31,6,164,23,36,
+    202,128,58,9,16,181,17,249,228,7,33,182,4,231,72,195,163,26,133,188,235,
+    73,121,176,26,249,196,186,143,100,125,82,100,25,41,95,53,42,156,200,199,
+    78,145,102,74,53,119,31,47,162,38,146,242,45,159,254,49,150,207,225,116,
+    207,66,75,22,143,152,77,213,104,111,81,9,139,198,22,224,66,7,167,54,131,
+    197,56,122,128,19,70,134,57,63,222,237,185,219,113,162,170,195,116,218,
+    109,195,96,207,36,139,66,181,23,19,186,62,141,121,204,185,128,87,67,244,
+    233,68,150,67,149,62,121,205,219,123,84,141,29,176,172,86,57,49,147,21,
+    254,140,228,10,169,41,152,133,64,100,16,83,168,19,66,160,67,36,123,81,
+    100,148,11,112,239,87,225,75,7,43,242,40,228,184,129,8,144,25,57,66,188,
+    7,8,45,196,62,49,209,198,174,123,34,18,194,233,4,172,60,216,67,15,148,
+    206,162,86,104,97,225,48,96,240,130,163,63,11,16,210,30,97,211,172,200,
+    101,134,169,105,2,47,192,225,75,121,48,12,98,146,109,185,55,96,175,120,
+    91,178,86,62,111,72,18,102,158,19,133,98,47,148,223,72,32,228,197,220,
+    226,148,234,239,184,29,155,35,128,8,149,248,130,135,128,129,92,70,24,28,
+    146,41,104,121,27,69,123,29,167,240,45,222,96,39,122,35,216,184,236,71,
+    22,205,71,62,32,4,156,95,112,49,14,223,198,172,227,232,77,173,234,123,
+    51,74,37,19,24,199,84,183,211,201,199,10,116,68,0,72,26,163,30,63,36,12,
+    184,22,7,127,169,160,106,66,229,158,35,7,238,103,62,240,161,247,128,125,
+    253,29,185,138,88,247,81,213,34,209,3,105,96,207,217,137,137,237,251,42,
+    151,172,69,88,216,35,212,117,75,195,212,218,33,118,97,19,250,88,132,55,
+    30,132,11,18,232,144,134,130,80,98,128,83,100,192,243,75,230,86,140,144,
+    209,26,230,66,87,100,146,48,98,60,6,84,24,67,251,14,160,116,102,1,21,192,
+    87,36,17,61,196,121,149,244,215,73,136,205,113,189,69,53,184,213,23,144,
+    76,74,12,28,112,42,64,129,145,181,247,248,139,90,48,54,141,208,18,43,106,
+    49,88,208,225,69,81,196,59,24,70,117,44,25,48,182,84,107,160,195,166,38,
+    109,168,193,97,66,142,17,244,72,154,40,206,176,112,196,192,9,57,196,89,
+    58,244,134,122,35,33,108,34,61,181,133,161,16,180,67,78,132,120,144,161,
+    143,1,117,218,132,115,202,129,167,80,112,1,48,198,149,124,136,235,152,
+    67,146,156,66,128,81,116,180,83,82,96,134,72,50,33,238,144,44,102,136,
+    80,121,64,87,124,103,148,169,134,185,236,169,105,102,131,239,132,14,175,
+    252,208,136,68,145,70,168,255,27,234,35,123,114,35,166,10,29,66,144,128,
+    44,205,227,20,64,231,16,72,169,250,27,50,246,17,236,243,28,5,74,201,160,
+    237,235,31,92,183,143,89,84,151,232,153,132,129,83,172,18,234,205,4,100,
+    192,49,34,82,66,162,158,127,168,46,128,154,88,187,161,156,25,107,65,14,
+    6,12,120,179,96,62,146,130,136,17,93,96,52,182,246,29,189,3,209,160,160,
+    36,226,80,6,237,162,155,48,87,142,38,82,28,234,127,58,67,33,179,197,103,
+    164,192,32,61,109,119,88,146,34,72,82,159,81,174,185,73,52,4,78,104,241,
+    138,184,36,198,3,142,188,48,16,249,158,175,146,28,110,240,165,14,202,245,
+    145,104,232,136,120,218,14,20,26,8,17,112,57,148,236,60,102,65,240,87,
+    117,65,113,24,154,32,39,13,167,210,131,244,68,4,87,161,11,16,28,193,147,
+    243,131,207,136,107,22,244,137,47,202,166,190,200,56,187,28,99,6,1,143,
+    209,127,168,10,64,131,166,209,125,32,233,115,68,229,247,208,194,100,114,
+    69,85,6,7,30,214,65,70,161,198,133,200,224,97,242,13,183,163,32,30,179,
+    80,206,204,255,183,205,94,105,27,105,10,251,58,169,241,122,67,148,237,
+    3,222,73,216,47,12,212,22,139,196,255,232,22,175,122,78,116,87,253,252,
+    48,198,34,150,118,138,181,19,73,31,135,185,36,56,91,26,100,134,206,67,
+    205,147,61,96,200,75,154,35,116,95,85,57,236,169,171,44,202,175,145,99,
+    56,131,4,249,156,167,14,71,117,5,58,107,9,47,28,154,211,77,57,66,79,152,
+    171,234,32,108,11,186,23,183,180,163,55,114,227,142,48,120,191,94,237,
+    215,207,91,223,177,91,224,191,95,65,91,190,13,244,229,235,245,234,116,
+    162,246,59,10,223,224,23,6,175,160,251,126,11,221,247,211,127,183,5,212,
+    171,157,3,230,71,175,119,24,181,95,81,135,95,253,141,255,10,59,254,15,
+    251,61,219,237,15,105,43,202,255,11,195,215,59,80,13,239,64,19,38,124,
+    190,162,246,51,8,158,193,211,111,179,36,45,188,252,23,117,118,41,229,25,
+    117,66,159,213,130,23,223,70,211,246,251,253,242,187,243,240,237,119,36,
+    219,232,169,246,124,193,209,14,242,30,168,135,194,253,118,16,189,63,194,
+    23,253,177,71,208,97,183,118,219,15,219,175,14,197,251,155,185,158,105,
+    7,254,51,248,137,34,26,121,135,193,38,244,187,255,56,111,251,207,174,126,
+    71,74,81,167,29,109,32,235,245,126,71,239,60,66,131,188,49,129,20,188,
+    245,223,60,138,232,177,221,209,198,126,123,202,189,218,255,13,100,83,182,
+    12,100,74,255,167,173,248,245,195,183,194,163,173,235,211,48,124,83,83,
+    167,27,252,149,223,84,13,23,59,109,31,14,252,206,188,43,221,249,63,116,
+    218,233,82,95,52,15,127,180,66,160,76,120,119,162,121,16,80,123,247,69,
+    83,57,78,239,128,29,2,118,131,157,232,213,5,93,208,242,253,110,55,140,
+    186,64,243,12,218,47,118,147,16,85,198,187,243,124,190,163,232,25,205,
+    5,33,108,208,109,222,89,240,234,188,169,230,227,189,233,248,157,119,247,
+    181,241,245,48,248,69,83,238,218,132,193,28,22,230,239,119,103,254,242,
+    127,162,143,110,148,11,135,13,231,162,122,238,111,162,160,13,84,202,15,
+    213,18,192,37,183,180,187,65,248,202,229,138,92,166,255,244,247,140,222,
+    232,37,106,195,98,208,165,191,87,180,137,162,31,254,21,172,81,135,251,
+    94,124,126,195,220,235,133,64,219,84,31,190,219,40,236,213,110,75,55,200,
+    226,77,3,33,87,186,80,247,12,160,26,117,136,235,80,218,69,153,225,15,106,
+    225,153,78,208,253,135,240,115,202,218,211,96,138,130,58,108,204,125,155,
+    205,59,224,17,17,75,177,92,246,1,140,22,94,126,123,243,110,251,254,6,189,
+    163,159,159,41,128,251,146,153,194,153,77,159,29,16,122,63,59,115,230,
+    232,123,46,57,191,3,137,239,3,249,202,27,31,254,92,134,125,130,84,244,
+    126,226,40,214,126,133,109,240,234,190,253,233,19,40,94,209,15,66,236,
+    180,219,221,240,133,64,54,65,123,30,188,216,13,1,192,138,12,137,88,217,
+    162,29,189,54,168,42,8,54,152,131,149,55,1,124,118,80,144,143,46,165,102,
+    110,158,242,140,143,34,100,137,41,190,156,203,136,239,96,250,162,117,30,
+    120,7,243,110,39,152,195,50,20,62,97,17,103,118,94,210,254,75,112,250,
+    242,69,228,119,62,116,140,80,68,225,123,127,202,150,190,63,135,37,40,148,
+    35,231,211,160,219,217,176,1,49,241,17,109,240,37,45,10,65,106,250,201,
+    191,14,54,109,121,10,25,255,228,162,15,59,104,230,181,9,55,200,45,240,
+    231,115,56,110,7,185,152,194,103,123,195,6,244,57,127,74,179,152,21,87,
+    190,253,77,55,154,115,119,248,70,121,225,199,52,244,167,112,253,110,243,
+    5,16,111,148,18,120,44,156,194,23,145,54,111,131,71,24,116,230,115,255,
+    61,157,79,223,193,115,67,38,241,60,162,123,210,92,119,3,118,221,174,31,
+    60,231,81,240,14,167,108,17,62,195,247,38,218,180,187,211,215,230,25,145,
+    126,104,18,92,231,27,64,228,150,246,124,62,109,135,221,13,84,69,93,110,
+    237,108,80,10,9,20,132,212,142,30,230,8,118,74,49,248,159,168,129,201,
+    14,79,224,43,54,71,46,128,138,10,240,197,116,3,185,209,252,7,51,111,88,
+    29,133,4,239,41,160,162,174,231,92,105,251,206,13,11,238,155,205,244,199,
+    255,151,11,148,50,125,79,187,4,156,191,9,167,255,164,247,210,179,83,197,
+    15,90,104,119,59,17,166,212,76,137,62,136,143,57,57,193,222,160,180,249,
+    160,108,233,28,245,227,33,190,127,119,131,119,39,4,152,14,41,60,197,141,
+    175,249,28,243,251,175,238,244,217,237,204,185,134,48,166,111,32,160,183,
+    159,121,251,253,36,71,168,26,165,116,209,2,140,109,242,136,140,194,14,
+    214,194,187,24,232,137,163,55,126,187,61,5,244,41,67,96,67,145,244,140,
+    149,216,40,136,230,29,194,136,68,121,82,120,208,121,191,55,254,83,82,243,
+    53,9,186,237,78,103,26,188,186,254,230,133,86,195,160,141,36,73,71,159,
+    136,100,67,28,25,77,129,13,43,132,157,8,20,168,162,237,131,54,161,227,
+    99,138,60,230,187,175,249,243,163,219,150,89,231,80,49,157,70,121,222,
+    232,51,17,183,121,191,180,28,25,211,249,192,161,63,83,4,44,41,252,132,
+    243,232,53,157,19,189,244,249,158,250,1,191,19,26,27,37,240,180,253,156,
+    75,48,47,127,142,68,59,64,49,141,100,106,210,1,138,24,124,1,184,226,175,
+    206,92,164,131,206,116,78,26,105,14,7,115,26,192,47,252,153,242,7,234,
+    136,147,205,134,192,243,95,155,14,2,233,72,143,100,27,138,64,242,155,143,
+    87,55,122,50,237,158,239,231,20,33,207,187,190,84,238,43,170,218,243,23,
+    56,70,180,29,204,9,200,238,188,243,209,126,130,255,6,171,66,249,91,16,
+    33,151,13,133,163,52,186,129,129,80,42,152,78,55,27,30,232,188,166,96,
+    165,169,192,223,64,54,13,1,146,189,249,85,183,139,19,70,105,151,168,131,
+    12,76,140,114,128,188,51,221,112,1,157,60,137,8,234,229,187,31,60,223,
+    109,135,252,139,137,219,104,7,163,232,87,162,231,173,27,200,127,20,247,
+    124,194,56,142,252,97,86,191,65,228,185,97,255,206,116,218,137,52,190,
+    230,47,110,135,225,128,147,130,47,113,32,205,231,187,221,221,108,54,72,
+    24,147,116,252,57,103,133,57,119,161,237,55,88,204,187,42,109,14,96,157,
+    185,66,127,190,225,1,116,206,128,86,107,111,42,217,132,31,1,129,214,129,
+    245,54,152,78,1,250,61,71,191,109,28,229,79,231,106,5,253,205,17,16,135,
+    21,100,245,211,193,127,120,3,148,218,250,94,145,186,209,111,47,130,135,
+    21,9,15,18,242,57,103,91,127,131,192,101,253,41,206,219,204,25,214,76,
+    252,206,244,3,185,128,51,45,81,14,18,123,161,153,15,63,252,105,111,94,
+    27,21,136,118,34,229,77,155,145,73,207,93,8,69,112,104,137,230,153,143,
+    136,31,227,230,222,104,211,56,33,135,36,81,249,123,222,229,185,159,57,
+    94,151,10,169,2,147,115,31,1,228,119,219,47,69,39,3,170,3,40,40,159,153,
+    245,193,48,219,128,61,162,219,204,187,132,13,98,233,108,94,109,248,154,
+    63,153,97,109,13,69,212,19,206,63,158,109,68,78,76,50,64,200,143,31,157,
+    140,200,176,118,167,11,118,109,42,221,128,37,79,134,226,130,1,193,1,14,
+    145,109,116,248,97,226,112,76,131,92,157,40,230,58,192,109,58,20,254,212,
+    132,156,146,172,220,54,39,149,230,193,243,221,153,62,17,251,102,10,121,
+    47,13,30,174,6,111,53,77,38,188,187,144,205,168,98,18,191,116,174,1,84,
+    212,30,34,247,191,211,87,135,217,193,177,33,152,50,15,248,135,209,197,
+    18,48,139,36,194,13,155,242,153,120,101,142,7,175,103,46,138,104,62,157,
+    250,207,92,78,224,215,222,224,125,230,68,39,216,116,32,117,51,167,20,86,
+    152,162,26,197,93,247,69,74,211,62,243,156,160,152,227,149,143,182,204,
+    130,129,49,31,110,102,206,17,41,27,50,239,173,131,233,199,155,82,8,177,
+    232,99,19,105,127,68,69,169,136,27,152,65,97,154,239,200,70,211,143,215,
+    11,31,97,190,238,148,111,145,71,30,237,100,21,216,205,159,79,77,60,142,
+    161,111,52,58,199,41,20,65,220,112,92,122,74,27,156,35,9,149,182,172,7,
+    244,178,238,84,221,240,203,6,161,111,208,110,68,34,34,100,146,71,94,37,
+    81,132,42,255,188,166,4,164,250,122,234,17,110,33,38,166,8,21,52,72,93,
+    130,14,231,107,226,116,58,132,225,116,243,252,96,196,131,36,19,171,253,
+    254,251,154,179,57,228,63,219,104,16,118,36,139,15,18,152,25,53,101,4,
+    117,159,180,160,147,219,139,38,167,58,186,191,181,111,48,165,150,54,2,
+    65,147,156,134,136,197,220,56,154,40,4,29,27,125,192,58,34,66,133,79,157,
+    109,163,77,23,173,117,120,104,202,19,100,55,179,110,218,233,50,68,121,
+    155,120,111,186,194,227,9,28,31,44,195,97,124,174,103,219,200,176,251,
+    163,208,37,101,95,221,39,231,69,112,231,112,5,99,68,224,19,190,54,157,
+    39,180,190,95,200,238,173,208,86,53,192,175,113,193,236,199,207,175,206,
+    83,118,220,224,121,66,249,135,130,166,255,214,64,248,207,0,111,128,174,
+    92,201,95,28,13,218,47,157,60,128,185,211,249,160,184,103,103,26,117,105,
+    102,190,249,160,128,57,199,123,166,5,216,233,40,219,109,75,6,10,0,20,165,
+    129,177,105,179,186,222,50,80,116,187,11,254,152,139,132,33,51,200,0,116,
+    206,43,13,100,117,223,226,156,128,123,117,117,56,66,122,170,24,155,190,
+    133,238,188,171,113,206,127,44,142,105,128,136,192,158,190,126,240,199,
+    95,210,231,175,143,110,231,202,65,66,5,124,63,242,13,125,233,112,163,205,
+    167,82,11,254,82,4,227,90,188,203,146,204,121,124,195,137,239,135,251,
+    200,143,105,248,33,35,145,162,236,12,203,164,55,95,66,254,70,2,224,80,
+    155,51,200,192,238,48,122,187,64,174,239,159,152,169,173,163,206,156,251,
+    4,168,50,13,93,125,80,222,102,211,213,190,40,24,25,118,167,228,12,214,
+    98,191,183,70,11,137,134,183,53,22,230,242,75,155,8,162,16,12,240,100,
+    83,206,7,24,179,61,237,138,148,141,40,193,162,10,3,78,90,93,13,62,229,
+    73,87,25,136,141,209,72,251,253,250,80,173,146,129,6,2,93,210,243,20,52,
+    232,15,209,67,43,11,33,63,245,146,211,10,254,207,169,124,134,238,144,11,
+    64,241,73,79,60,9,53,166,238,75,161,34,128,228,15,165,4,189,241,78,198,
+    2,144,196,26,124,251,18,172,27,29,220,59,4,231,75,174,212,249,91,41,163,
+    192,146,105,208,65,39,31,59,224,243,51,215,57,20,193,180,197,10,184,50,
+    0,192,104,222,125,105,31,185,230,5,116,92,122,9,64,134,225,92,126,66,186,
+    27,209,254,163,206,48,42,15,110,52,117,55,114,17,135,14,118,134,212,119,
+    142,162,150,157,10,27,12,32,95,10,180,188,133,14,37,19,220,93,124,217,
+    214,83,68,32,69,190,153,5,157,15,0,232,112,207,102,211,161,113,90,226,
+    12,185,161,84,169,127,250,235,69,81,172,192,208,146,14,105,64,247,113,
+    133,1,211,254,51,237,112,223,7,118,124,78,255,107,79,127,77,21,211,212,
+    34,37,74,164,79,250,153,119,121,230,45,50,54,239,110,123,250,131,213,167,
+    242,244,84,4,117,144,239,47,198,42,24,232,174,185,50,81,206,214,181,127,
+    66,23,98,218,20,244,95,115,229,243,84,29,137,143,121,59,55,145,92,52,127,
+    17,209,250,157,82,25,183,90,4,15,242,76,251,191,220,11,108,246,254,147,
+    99,165,231,187,240,65,87,154,197,185,96,167,211,63,115,77,179,105,247,
+    63,77,97,129,254,251,173,145,249,151,39,128,91,117,234,168,198,89,165,
+    35,253,109,132,231,252,143,100,41,46,166,28,94,222,249,153,253,133,54,
+    216,23,14,153,59,242,198,127,88,10,233,74,4,232,79,15,118,254,144,24,234,
+    237,69,160,77,65,225,245,163,189,225,250,191,63,208,247,235,55,29,224,
+    129,63,239,246,175,215,159,223,204,73,157,90,217,72,174,65,58,244,240,
+    231,183,166,152,158,229,109,154,189,145,111,183,131,232,126,255,249,15,
+    210,254,203,245,175,105,198,30,79,22,39,14,218,127,52,108,54,255,97,195,
+    119,30,58,243,220,99,232,183,187,33,83,153,85,207,182,160,6,170,255,32,
+    162,163,3,209,84,140,252,97,196,188,166,31,226,160,163,231,222,154,193,
+    115,5,6,145,78,89,211,15,29,215,144,6,148,114,200,121,255,247,86,34,117,
+    254,73,118,42,129,255,97,166,188,127,117,126,81,235,47,128,96,17,92,248,
+    82,68,253,215,145,78,187,191,127,139,103,246,157,10,74,8,158,190,254,240,
+    228,47,134,10,14,101,44,118,127,207,223,220,35,37,77,219,255,1,142,42,
+    251,53,253,5,64,79,241,253,243,167,243,161,133,255,211,59,24,138,255,248,
+    35,70,158,115,81,151,235,70,147,103,250,71,106,164,210,233,31,213,200,
+    127,93,84,221,209,8,210,16,146,116,54,154,60,157,246,175,63,239,63,255,
+    117,37,45,165,40,5,114,40,209,61,188,238,78,255,29,234,40,135,108,249,
+    111,250,27,224,223,74,153,63,170,132,5,126,111,218,191,219,207,206,239,
+    205,175,41,191,80,211,127,237,255,222,191,129,242,119,91,76,208,35,217,
+    240,82,171,79,121,234,23,122,134,153,95,239,46,45,34,91,157,223,196,178,
+    152,248,239,173,163,33,74,156,206,127,233,255,62,205,255,188,254,19,79,
+    237,156,191,95,63,2,164,253,250,253,250,165,81,199,191,210,146,218,108,
+    79,113,36,222,70,21,191,219,178,232,244,249,235,207,175,23,5,204,1,186,
+    243,250,253,70,126,124,169,151,125,18,224,253,251,55,159,62,230,175,255,
+    62,136,47,202,121,41,2,167,185,60,127,183,85,209,28,228,164,103,185,94,
+    239,26,58,247,210,2,24,160,198,142,12,151,143,28,122,255,243,231,55,175,
+    44,26,14,66,229,191,57,167,162,14,145,48,135,41,61,160,35,251,239,249,
+    111,238,239,138,181,223,178,193,134,235,93,70,29,53,255,206,195,112,243,
+    195,45,115,224,151,89,25,165,196,8,220,191,116,92,251,239,183,198,224,
+    19,109,116,158,47,241,250,159,140,219,214,127,211,95,58,82,119,127,225,
+    157,223,211,255,58,127,88,251,15,89,57,255,69,50,62,223,255,97,24,58,164,
+    188,15,137,230,207,251,215,107,218,253,243,171,243,231,23,165,145,1,127,
+    94,26,211,140,120,8,123,253,230,247,231,244,247,251,71,239,193,79,41,19,
+    77,211,245,127,191,117,78,157,254,121,253,238,254,254,245,252,213,214,
+    175,221,63,127,80,248,75,179,29,16,254,60,255,235,192,7,3,133,118,95,191,
+    254,199,146,153,237,168,170,110,109,248,22,236,145,85,32,73,29,169,36,
+    122,45,59,209,229,209,76,176,41,91,148,91,1,65,44,151,109,56,66,77,234,
+    22,235,127,94,230,191,154,185,170,20,191,111,140,183,27,195,189,225,10,
+    174,155,31,163,255,206,123,46,227,1,52,214,252,248,230,235,50,148,140,
+    154,100,51,6,25,136,176,255,224,246,76,221,170,133,193,179,215,94,72,186,
+    12,6,191,255,105,207,227,65,108,126,62,143,48,205,89,245,253,25,236,255,
+    27,232,36,162,104,192,10,243,223,136,97,245,167,217,28,225,182,63,255,
+    53,73,1,73,135,80,215,124,253,0,156,125,243,79,115,63,26,16,30,206,224,
+    31,254,243,15,82,248,35,164,126,7,255,73,23,35,205,191,129,102,35,225,
+    53,248,23,49,179,130,140,62,224,244,251,159,209,64,218,148,241,255,236,
+    25,92,216,146,201,128,169,9,200,143,230,25,211,237,255,57,43,87,6,77,204,
+    211,34,47,206,255,225,159,209,159,1,14,199,23,255,13,206,28,138,73,254,
+    231,240,212,199,128,1,192,119,9,150,15,226,7,75,58,10,102,204,70,162,253,
+    123,38,116,255,149,23,36,237,17,140,124,235,9,246,166,129,180,118,62,179,
+    1,141,70,205,255,125,183,6,152,245,220,58,15,70,255,12,154,231,63,90,44,
+    180,42,182,138,64,65,87,127,72,124,156,65,109,223,74,213,51,238,1,227,
+    255,154,255,59,51,108,191,71,255,219,35,48,253,207,48,231,1,206,35,72,
+    254,52,255,140,126,7,3,103,192,162,242,143,190,160,238,193,240,191,15,
+    62,242,223,136,66,40,101,48,104,254,243,7,238,246,28,205,119,38,240,219,
+    159,207,26,217,52,137,117,160,212,25,240,197,127,240,191,115,83,177,254,
+    239,119,83,25,140,35,246,172,39,205,143,193,160,69,169,104,252,251,252,
+    207,104,244,95,243,223,243,7,13,13,180,152,80,196,224,207,160,41,236,254,
+    29,236,63,154,32,14,133,33,170,1,208,16,206,255,221,83,235,249,12,255,
+    131,51,57,112,102,54,254,163,141,255,76,166,83,63,206,36,239,63,6,231,
+    214,159,239,166,180,196,0,71,147,116,4,16,124,101,102,168,64,227,224,127,
+    205,179,178,143,189,143,13,76,14,104,113,236,31,94,107,237,255,128,224,
+    0,71,252,111,80,236,142,84,219,100,42,12,144,237,128,181,98,212,250,167,
+    9,55,132,20,8,12,6,3,162,164,217,228,216,65,225,20,117,240,207,224,99,
+    52,98,20,134,231,230,136,143,0,50,197,210,207,104,223,10,7,78,19,160,254,
+    215,34,232,6,138,189,193,232,251,247,15,188,145,81,212,63,106,113,229,
+    55,61,243,147,136,107,253,15,210,70,156,242,47,131,15,197,133,144,208,
+    108,241,189,145,35,0,6,77,105,90,49,217,62,240,209,121,160,194,154,163,
+    1,95,62,176,249,224,3,2,62,246,31,84,74,3,3,197,37,209,56,248,64,251,131,
+    179,51,192,48,136,26,95,15,24,66,250,94,127,134,130,15,166,146,190,253,
+    54,201,239,144,63,194,63,156,20,178,96,224,69,45,191,88,155,206,176,152,
+    88,225,123,55,173,140,206,200,16,194,137,1,24,131,238,38,106,248,216,99,
+    122,84,210,60,75,253,248,128,104,26,180,246,251,209,63,77,130,132,148,
+    192,202,200,247,223,240,79,19,149,239,191,57,143,64,67,202,252,119,48,
+    250,208,183,39,48,33,80,41,21,18,155,3,210,98,128,5,52,111,64,83,139,224,
+    232,223,144,220,33,56,63,70,202,115,52,196,167,8,80,201,224,27,166,21,
+    190,176,73,170,16,152,66,203,225,168,86,147,250,191,57,97,4,148,96,162,
+    116,27,0,47,52,157,229,106,58,59,3,9,101,51,4,148,183,136,155,119,255,
+    144,71,140,224,51,211,160,9,223,103,210,246,124,150,136,217,145,16,8,143,
+    180,154,8,136,207,142,254,163,172,243,224,223,179,122,105,194,11,116,180,
+    248,0,9,12,15,103,173,128,24,47,28,252,3,25,14,156,141,194,17,155,197,
+    191,225,25,83,126,128,27,39,140,64,111,132,178,206,123,56,223,183,196,
+    37,65,251,61,210,236,97,249,249,15,136,152,192,172,245,45,85,64,225,232,
+    140,126,127,207,255,3,45,233,27,233,156,191,207,194,236,131,103,70,206,
+    89,128,99,52,226,152,41,48,114,6,163,17,129,134,104,207,163,61,125,238,
+    207,0,62,16,131,122,255,155,102,0,128,177,65,63,131,226,124,225,195,167,
+    154,205,214,31,101,55,139,6,177,124,46,54,131,95,38,56,7,233,57,198,213,
+    224,99,255,239,232,188,199,134,40,130,176,252,23,168,64,14,220,0,171,165,
+    130,6,114,40,110,225,76,126,38,0,144,13,209,120,86,139,173,63,103,210,
+    243,187,104,112,164,23,206,48,9,137,140,217,127,209,230,199,8,216,71,168,
+    141,72,160,196,230,185,197,99,123,240,82,229,28,9,200,131,166,6,63,170,
+    110,254,47,28,157,195,22,54,59,99,212,15,248,227,34,190,12,179,128,237,
+    37,159,193,72,37,171,47,93,198,217,140,163,166,70,232,136,19,249,34,206,
+    201,12,148,111,70,45,74,65,61,204,21,204,192,124,249,175,48,40,69,240,
+    95,190,4,96,91,248,61,19,76,173,127,144,141,146,64,29,73,124,216,242,15,
+    129,204,240,67,140,164,174,198,25,215,18,145,3,12,138,190,248,23,41,67,
+    107,179,208,36,222,5,43,36,52,16,236,0,1,61,208,254,223,136,91,68,107,
+    203,145,164,206,33,40,14,244,214,119,232,48,128,241,31,245,82,103,235,
+    131,99,28,25,227,95,200,166,95,50,91,39,81,144,168,214,125,35,201,176,
+    169,13,111,196,241,231,150,202,208,250,211,82,70,99,182,243,254,95,33,
+    194,191,12,113,118,78,146,217,25,233,29,30,252,216,59,124,106,255,49,66,
+    248,8,19,80,128,145,30,71,123,230,246,158,180,226,201,111,241,72,8,81,
+    201,160,165,11,233,29,152,201,211,38,81,68,234,145,102,255,48,191,20,220,
+    56,0,148,180,118,49,146,248,48,159,228,166,189,74,57,179,74,52,91,114,
+    35,160,112,78,83,249,34,201,224,49,54,14,172,78,22,253,135,160,255,200,
+    97,148,59,8,41,74,98,21,139,31,208,209,82,113,77,5,7,127,255,71,72,3,62,
+    250,28,64,51,62,23,165,35,37,192,89,175,18,207,140,7,24,26,177,51,171,
+    252,15,166,243,135,19,98,206,51,45,163,210,81,51,252,95,115,255,113,14,
+    5,4,85,138,134,150,164,140,62,71,138,119,221,85,144,198,126,10,147,250,
+    65,73,11,71,60,62,8,249,228,25,15,158,29,88,24,105,33,107,182,190,207,
+    14,202,224,57,77,20,173,89,68,35,113,53,80,140,181,206,162,83,231,53,71,
+    223,66,194,225,120,174,114,216,153,216,135,71,10,111,226,146,200,227,169,
+    144,19,70,218,155,71,84,136,200,6,108,52,77,90,105,141,90,223,66,76,85,
+    156,21,169,223,131,95,208,2,114,178,8,10,212,207,89,67,240,91,233,125,
+    46,12,161,57,67,119,45,105,227,127,3,103,164,91,229,19,60,192,159,72,71,
+    235,21,130,29,136,136,150,68,209,108,22,42,80,217,142,40,211,44,224,227,
+    223,146,12,54,34,203,196,195,199,247,47,167,74,24,220,165,3,33,19,224,
+    81,26,206,231,0,234,229,119,193,86,196,136,22,85,180,226,96,235,179,198,
+    1,41,168,187,88,90,213,24,128,48,186,62,228,16,101,48,29,125,200,198,52,
+    249,247,76,230,176,12,66,69,20,58,56,23,73,211,148,151,70,10,185,15,157,
+    64,207,68,9,16,209,162,89,84,91,164,253,72,206,251,198,214,33,122,101,
+    21,230,169,239,33,247,232,171,20,213,180,144,254,232,219,9,105,172,41,
+    230,6,123,244,204,63,72,125,31,182,228,87,178,251,86,156,193,15,173,129,
+    201,79,136,243,67,160,158,248,158,51,56,13,52,101,248,92,83,127,105,220,
+    52,157,22,48,134,223,127,175,150,176,6,18,45,238,11,5,147,26,58,203,70,
+    140,241,2,109,193,255,183,84,96,65,131,31,38,144,35,93,237,19,164,124,
+    203,60,55,29,29,193,225,74,138,193,249,52,60,223,136,227,65,81,68,115,
+    16,210,29,171,15,85,81,74,179,121,26,105,93,102,7,254,48,153,3,60,125,
+    214,92,228,122,105,98,47,228,63,132,232,247,55,229,127,152,142,186,27,
+    181,70,33,136,209,234,30,115,158,79,140,182,193,169,162,83,120,18,103,
+    126,168,61,84,208,252,24,162,78,84,222,252,222,239,1,120,175,214,91,223,
+    102,243,100,158,196,52,132,147,70,152,7,129,84,176,133,62,120,67,129,102,
+    19,200,41,47,68,59,131,166,9,91,167,10,5,156,53,130,53,27,78,131,115,136,
+    122,91,218,57,6,55,73,206,17,216,66,197,188,81,139,94,198,152,202,65,104,
+    148,152,190,135,231,253,169,0,141,110,224,139,159,247,223,149,176,162,
+    170,240,238,200,108,74,12,67,88,109,141,246,31,167,230,77,175,202,96,50,
+    62,121,247,61,170,156,128,247,227,164,175,49,103,153,228,220,172,180,104,
+    208,105,125,223,134,123,150,196,226,155,149,57,82,17,183,115,33,196,129,
+    105,86,144,3,171,94,120,66,183,64,50,58,155,166,148,45,114,148,52,52,216,
+    252,139,212,137,53,152,31,148,227,131,202,183,105,238,33,19,163,157,77,
+    173,42,236,98,114,228,9,24,244,125,9,177,54,91,205,97,168,47,175,202,16,
+    122,48,247,26,123,55,80,27,158,206,231,97,8,137,100,194,0,32,41,235,251,
+    52,26,222,190,43,206,55,239,57,92,195,223,230,224,38,11,22,199,98,189,
+    33,10,168,136,143,143,240,166,121,192,29,148,49,56,87,62,42,166,82,1,179,
+    240,5,177,73,95,230,249,20,210,232,240,251,36,220,78,123,48,26,34,58,73,
+    239,100,42,112,7,195,209,16,94,66,228,70,79,167,155,57,112,192,246,28,
+    158,204,193,104,31,14,110,21,134,247,185,85,225,84,84,79,146,240,94,243,
+    246,141,176,113,137,185,15,43,204,162,111,169,253,60,52,79,230,80,130,
+    250,208,146,48,58,85,110,142,170,105,157,6,166,194,162,178,31,50,168,71,
+    167,19,7,11,249,83,248,93,209,192,128,27,60,71,69,149,15,243,251,92,17,
+    134,123,176,69,227,45,97,75,36,222,66,193,168,133,156,68,63,159,110,208,
+    181,55,7,10,144,155,243,93,81,71,205,219,30,243,154,3,52,115,59,21,46,
+    217,155,39,184,32,108,78,156,191,63,157,43,56,76,59,72,235,214,228,142,
+    225,137,21,132,28,48,155,183,86,235,212,186,181,224,192,25,126,156,190,
+    79,67,115,95,129,238,22,170,104,237,111,168,189,114,146,119,155,160,45,
+    95,54,161,1,161,143,68,23,228,142,78,183,211,126,56,252,110,153,60,133,
+    182,157,65,113,29,127,202,26,123,202,62,13,145,121,115,104,154,163,2,163,
+    143,98,125,216,83,194,254,198,102,113,54,225,201,220,23,39,183,206,183,
+    102,229,111,26,194,18,143,131,124,147,211,17,145,131,42,111,204,235,129,
+    115,146,24,43,3,147,180,48,79,84,178,55,195,209,176,105,14,232,214,252,
+    254,61,157,40,30,33,220,66,231,84,25,220,78,195,33,98,57,57,195,27,106,
+    7,248,17,84,16,139,123,19,128,78,64,20,158,72,76,34,219,28,156,136,36,
+    149,104,14,17,12,119,220,24,67,195,166,252,195,41,252,7,185,193,73,139,
+    220,190,85,42,18,94,243,116,250,216,67,82,101,191,63,129,221,137,255,156,
+    91,123,211,60,113,195,104,200,15,149,111,93,6,87,24,127,48,228,11,101,
+    49,177,248,90,193,23,172,214,112,168,205,250,116,170,240,119,179,201,69,
+    167,225,13,244,204,155,217,52,245,37,168,85,57,157,20,99,205,144,159,70,
+    226,173,82,1,202,219,201,1,170,219,109,8,43,35,179,85,129,195,230,9,112,
+    155,55,154,219,59,66,248,116,251,86,30,82,199,9,69,195,26,210,162,46,210,
+    171,162,208,114,154,67,128,6,173,202,247,205,57,15,111,149,189,179,215,
+    62,113,107,14,71,226,225,36,80,206,149,22,249,75,46,208,165,18,81,223,
+    13,136,235,143,1,180,220,168,236,251,60,84,110,159,7,194,103,31,146,166,
+    128,68,94,209,253,112,100,142,110,133,154,73,10,100,114,219,223,152,235,
+    230,237,86,249,8,155,84,229,16,105,180,102,242,58,39,222,0,22,205,220,
+    42,102,235,228,80,233,16,241,133,4,62,56,209,128,9,253,163,33,195,204,
+    108,13,43,131,65,165,181,175,84,224,230,36,151,157,6,251,161,66,1,32,97,
+    96,223,28,238,135,154,150,31,82,246,199,201,4,198,91,165,69,196,156,78,
+    100,45,230,128,35,68,50,168,152,31,28,208,2,82,146,4,154,129,173,133,253,
+    177,211,247,173,160,154,140,189,33,54,158,44,212,12,230,38,248,238,185,
+    113,223,162,34,254,48,9,8,96,110,49,48,33,112,143,180,136,83,240,51,181,
+    8,158,62,126,79,191,152,169,121,3,138,211,176,5,90,197,20,29,13,7,16,18,
+    130,103,235,108,194,33,29,141,20,86,67,40,69,168,21,178,218,164,86,60,
+    87,25,158,17,197,109,111,14,43,12,21,53,220,172,144,76,97,83,155,143,136,
+    213,228,185,41,2,110,236,156,173,202,77,11,81,97,32,84,71,161,188,48,108,
+    209,46,187,134,211,226,112,48,31,241,78,165,85,249,216,99,245,150,240,
+    27,114,10,178,161,20,12,34,171,98,0,69,65,133,16,7,57,40,130,228,225,153,
+    226,246,149,2,200,166,244,115,211,214,105,14,77,114,10,59,143,110,31,26,
+    13,39,212,102,14,66,147,111,116,167,239,219,13,180,110,236,33,248,131,
+    224,30,222,76,243,92,33,77,65,226,4,161,144,10,144,132,14,121,8,248,108,
+    9,149,74,133,84,196,60,40,14,43,99,73,83,121,2,20,21,45,133,251,189,83,
+    25,157,24,222,173,243,144,51,192,17,216,78,55,164,137,168,90,45,167,178,
+    63,33,172,61,54,100,70,157,80,131,131,99,169,121,104,18,71,35,64,56,105,
+    22,128,232,176,210,130,43,218,217,183,176,153,51,20,43,45,70,224,105,127,
+    34,203,134,168,157,11,139,17,127,27,84,28,146,86,72,98,232,15,224,26,134,
+    167,150,57,108,14,193,210,36,45,8,27,132,169,39,97,155,29,101,72,112,145,
+    28,127,95,2,190,33,205,0,231,237,134,199,79,42,16,33,223,206,102,5,64,
+    70,183,112,68,115,251,194,234,240,4,9,3,150,235,33,7,35,112,12,81,185,
+    225,99,102,208,169,73,215,39,156,138,133,7,28,74,109,230,141,94,208,170,
+    9,151,188,199,193,149,138,35,52,185,176,66,249,146,23,122,218,223,56,118,
+    104,222,132,246,237,44,159,132,24,192,193,16,251,219,208,65,6,130,1,125,
+    145,52,56,125,100,42,188,113,76,147,255,18,52,131,223,225,9,171,54,101,
+    199,19,181,14,205,1,207,2,192,112,136,16,161,2,89,160,59,83,159,215,85,
+    67,84,127,22,78,22,75,4,231,192,5,222,199,26,21,51,150,136,91,167,125,
+    147,58,209,165,72,197,93,44,36,192,65,81,208,195,46,130,171,145,22,8,142,
+    200,133,61,69,152,64,115,219,183,98,152,225,78,126,175,84,110,167,129,
+    5,95,173,74,225,113,21,118,219,59,161,166,2,99,231,28,243,235,41,134,213,
+    161,26,32,31,90,55,221,74,155,12,56,85,220,26,90,192,123,210,95,45,125,
+    136,44,36,213,24,212,56,130,79,162,246,150,132,109,86,176,239,8,119,51,
+    114,104,142,166,65,155,54,155,3,171,34,120,225,215,129,8,222,217,159,173,
+    61,174,54,113,33,179,214,60,15,241,10,58,175,152,226,78,229,131,130,220,
+    50,40,84,69,26,158,21,100,49,227,104,136,165,111,166,150,50,70,52,186,
+    109,89,156,132,39,248,244,169,18,162,91,137,232,230,88,180,133,249,84,
+    1,49,64,199,195,253,232,86,224,247,87,206,244,129,255,209,132,128,164,
+    253,10,170,26,14,76,6,140,66,129,242,241,73,69,255,115,14,201,241,219,
+    82,190,72,136,195,33,105,136,46,144,1,182,167,52,224,106,169,84,57,29,
+    109,114,14,232,156,134,49,158,70,63,195,129,131,240,224,86,213,90,42,139,
+    46,228,205,17,165,15,165,0,134,4,255,208,63,248,182,36,21,73,204,148,146,
+    228,123,62,71,163,124,54,220,91,8,225,102,221,78,44,19,90,124,98,120,137,
+    155,220,111,134,167,24,33,155,18,13,193,131,196,240,128,118,164,152,238,
+    144,159,94,181,164,85,224,228,199,16,175,57,3,14,150,49,129,74,165,223,
+    100,162,189,216,145,59,111,33,139,204,176,229,180,4,12,159,1,237,214,80,
+    23,240,53,7,101,85,116,101,229,22,23,40,83,107,24,227,128,161,67,63,200,
+    4,62,21,102,170,152,246,212,33,160,241,217,209,208,108,34,212,155,117,
+    182,78,106,138,188,104,197,241,223,116,151,174,80,2,104,193,59,135,198,
+    106,180,57,68,146,72,70,114,27,134,140,32,169,192,162,53,160,211,244,192,
+    148,167,16,61,99,19,237,12,78,43,188,113,0,121,165,184,106,57,82,14,224,
+    58,39,73,30,104,25,77,45,39,62,89,39,102,228,94,211,38,36,148,71,22,253,
+    137,16,139,231,76,221,109,134,152,1,155,238,227,10,11,9,92,48,192,209,
+    27,80,3,147,188,139,240,105,233,164,53,131,137,224,168,88,129,202,19,40,
+    145,39,78,114,4,40,209,79,40,248,43,120,46,86,37,156,205,73,116,70,204,
+    222,90,191,251,166,35,119,180,120,201,81,113,16,206,1,242,8,210,46,242,
+    0,31,232,135,214,41,214,133,84,11,243,86,129,37,255,14,99,174,65,250,58,
+    82,97,114,83,132,135,21,33,8,107,176,53,180,228,182,152,7,255,159,69,104,
+    44,150,164,34,254,246,206,201,97,132,112,151,240,165,100,254,97,199,70,
+    181,123,29,45,4,149,147,252,67,210,17,67,112,205,233,252,180,23,172,252,
+    65,59,22,102,188,169,81,157,29,34,4,224,225,87,205,151,61,41,195,143,225,
+    45,150,194,245,151,84,99,233,54,40,227,145,86,209,13,75,10,128,22,103,
+    22,193,80,57,93,110,166,34,246,4,170,184,23,38,228,20,211,218,91,251,18,
+    81,117,210,24,134,39,179,50,116,98,184,112,96,199,146,212,72,56,72,66,
+    131,206,141,191,66,200,115,76,89,11,213,224,146,74,92,212,160,113,134,
+    70,53,204,10,235,41,237,169,20,204,111,183,248,175,171,134,22,3,10,173,
+    197,8,23,163,151,100,15,118,222,56,222,75,253,197,114,133,187,204,27,9,
+    112,169,20,140,40,12,42,68,116,181,136,88,235,116,33,26,238,67,18,129,
+    239,133,37,83,144,155,166,85,9,195,24,81,97,150,155,137,127,77,243,98,
+    86,238,151,225,5,128,90,161,121,65,162,36,106,75,153,126,178,52,133,46,
+    34,17,105,85,96,67,190,184,12,239,55,66,237,166,112,54,169,247,14,106,
+    252,122,42,54,59,103,95,253,107,218,88,2,148,182,37,17,232,2,62,148,131,
+    60,91,177,21,130,5,252,237,227,161,244,111,222,46,150,163,66,56,21,36,
+    134,149,48,182,164,84,232,146,176,45,222,46,81,83,129,125,232,112,153,
+    96,194,90,55,77,87,172,68,160,148,134,230,5,92,249,253,68,3,4,162,25,91,
+    102,172,88,30,42,244,138,143,66,118,37,212,242,134,232,238,213,33,176,
+    192,73,97,55,110,1,117,22,152,74,137,46,75,132,201,222,186,203,244,251,
+    10,250,8,47,55,201,125,207,182,83,145,89,204,225,221,226,251,72,92,98,
+    24,90,162,112,24,75,202,0,104,154,45,190,91,222,37,23,78,22,232,167,210,
+    37,190,13,45,78,148,155,99,80,136,81,203,169,106,1,98,124,9,53,44,0,20,
+    226,42,150,140,37,208,121,1,16,241,144,89,229,95,86,154,11,187,160,69,
+    100,222,66,164,182,191,0,154,89,58,89,214,229,14,93,38,74,41,157,148,105,
+    116,83,213,188,58,221,165,129,18,0,84,17,33,169,82,65,155,167,86,233,110,
+    222,75,247,91,236,176,44,32,161,225,157,56,166,82,133,166,105,222,177,
+    138,108,190,231,109,188,163,29,68,119,223,76,108,84,186,104,249,51,173,
+    123,108,209,31,4,12,91,69,108,236,111,85,51,54,173,75,28,87,170,232,49,
+    102,134,15,65,141,173,132,32,133,247,33,68,94,246,149,139,134,67,9,103,
+    50,46,0,249,114,71,28,165,123,245,94,82,78,196,225,240,34,207,158,74,133,
+    122,72,117,134,13,57,27,227,170,106,9,226,97,198,145,126,46,39,231,94,
+    189,197,86,233,86,204,12,203,52,11,171,95,90,114,52,224,197,85,162,194,
+    28,90,165,74,235,110,74,161,49,243,128,22,112,205,101,79,182,154,86,140,
+    242,42,144,28,115,148,37,185,148,160,247,18,14,45,171,26,155,151,184,218,
+    26,86,121,223,66,216,167,59,125,65,12,73,57,108,89,173,138,194,160,196,
+    75,23,148,103,198,161,170,61,93,46,150,178,137,135,233,234,110,90,67,75,
+    133,171,40,112,188,201,91,86,137,67,20,181,216,49,148,146,75,168,2,99,
+    211,209,253,118,87,74,96,183,97,108,177,124,92,110,37,140,124,81,76,13,
+    75,170,230,94,53,195,234,5,226,200,76,48,143,145,215,173,116,211,145,8,
+    185,10,224,195,59,105,128,59,77,234,104,105,199,148,180,170,247,83,149,
+    149,172,85,100,43,17,177,31,86,229,2,132,198,81,88,224,226,112,51,253,
+    223,47,138,255,42,13,220,239,120,5,168,67,125,155,177,78,247,86,229,50,
+    188,85,47,14,54,37,78,56,156,128,210,18,131,43,185,219,146,67,81,76,137,
+    176,40,85,74,48,138,58,136,99,138,179,24,112,24,184,18,223,139,209,109,
+    86,145,48,247,35,199,152,116,176,172,176,117,47,85,157,146,5,208,24,247,
+    34,20,46,214,101,207,111,28,135,206,111,167,16,227,85,149,129,132,4,201,
+    44,151,208,255,13,66,98,101,41,198,60,1,61,246,173,98,255,34,163,20,188,
+    206,165,85,216,196,114,204,210,29,126,145,51,115,25,85,84,75,55,43,182,
+    160,231,82,29,86,47,100,212,5,112,233,31,169,107,134,199,251,98,125,118,
+    36,70,203,12,205,18,106,211,106,34,174,47,104,236,14,72,152,156,3,74,228,
+    0,254,36,222,20,27,247,88,243,127,216,106,241,42,134,170,18,13,24,135,
+    117,135,53,232,114,138,91,49,116,233,4,6,29,122,162,102,199,138,29,209,
+    131,229,176,81,204,111,85,7,47,224,36,108,5,150,24,15,65,90,150,108,164,
+    81,28,59,49,223,228,160,108,127,49,239,124,162,122,225,51,192,20,151,90,
+    60,87,169,92,72,78,243,86,42,221,134,247,56,174,58,39,52,91,101,185,50,
+    113,76,169,84,42,162,15,199,177,159,80,87,88,13,161,58,190,88,113,43,196,
+    95,247,125,124,39,154,49,50,57,201,254,85,138,229,95,190,107,152,251,123,
+    229,14,133,37,7,89,146,180,138,50,38,165,19,87,233,192,129,19,156,162,
+    165,226,114,186,147,10,34,244,130,60,152,25,23,48,119,176,6,239,149,80,
+    1,165,210,243,61,172,130,25,207,94,180,158,83,193,157,115,149,75,165,83,
+    169,122,170,86,101,87,19,145,223,195,97,21,81,149,136,98,62,169,106,171,
+    151,80,15,88,10,219,83,44,104,208,75,120,231,132,251,158,190,161,244,114,
+    31,86,137,140,144,201,112,129,244,91,197,105,149,136,212,202,29,2,193,
+    137,166,104,128,62,195,123,137,211,97,246,86,5,158,11,230,138,171,224,
+    140,129,239,21,106,46,65,40,201,68,69,151,27,110,162,188,59,240,131,117,
+    133,17,178,167,203,139,25,183,74,148,29,94,228,189,106,200,21,24,122,207,
+    194,96,197,69,243,100,90,105,136,100,134,220,123,23,196,104,133,27,160,
+    140,243,120,1,100,111,45,5,128,182,112,208,142,239,247,42,223,233,216,
+    226,46,213,253,229,2,207,85,202,97,121,132,52,0,170,50,7,46,4,101,104,
+    197,165,97,40,161,98,246,22,240,72,197,120,12,160,157,82,229,30,223,193,
+    134,184,178,170,24,24,83,221,170,22,73,203,109,136,161,74,196,94,194,80,
+    25,73,71,49,234,56,237,75,85,43,14,145,9,116,84,185,148,194,46,218,188,
+    171,49,212,95,84,233,229,114,185,59,86,137,202,85,187,122,12,47,4,162,
+    99,89,88,18,221,160,79,52,31,194,18,161,108,93,46,72,163,164,235,172,75,
+    165,85,37,229,193,138,147,170,140,184,80,211,246,190,135,99,44,193,210,
+    4,200,241,30,127,148,160,148,23,48,75,181,116,183,226,161,165,139,45,125,
+    231,189,179,80,225,155,42,135,87,169,107,207,162,3,151,0,57,100,244,83,
+    39,140,132,39,250,39,55,47,32,170,224,230,39,14,134,121,0,229,166,216,
+    129,103,182,31,2,107,168,156,168,58,78,69,157,48,149,171,21,158,170,226,
+    9,167,74,101,116,202,176,36,220,79,10,76,240,103,10,89,124,73,136,67,162,
+    14,200,239,85,126,171,134,67,233,19,42,239,247,18,124,161,150,82,197,225,
+    53,74,169,18,80,123,201,134,145,128,25,239,14,221,17,0,37,24,172,92,40,
+    180,176,12,97,26,94,90,196,26,241,205,176,138,97,224,6,208,116,124,34,
+    130,90,112,40,31,115,69,201,185,241,121,49,207,36,39,121,232,132,253,11,
+    123,85,197,7,139,41,21,221,134,191,144,54,212,152,65,11,36,187,105,181,
+    240,63,49,49,132,23,164,94,113,194,11,122,224,149,147,89,42,145,38,22,
+    109,208,44,249,25,146,67,22,129,137,210,99,109,7,100,72,137,93,131,225,
+    73,180,150,46,39,68,14,230,23,167,133,146,29,34,170,90,117,66,11,197,158,
+    238,146,50,25,0,198,12,68,90,68,216,48,87,160,129,177,144,62,164,82,162,
+    190,8,197,50,141,165,127,172,155,165,27,152,39,124,166,20,2,60,3,254,82,
+    42,81,144,148,32,117,88,148,108,73,112,85,254,188,160,167,139,67,22,171,
+    91,244,141,88,21,58,251,11,3,34,222,179,163,84,148,59,68,60,36,90,32,73,
+    73,0,90,37,85,216,176,136,155,144,111,10,72,5,76,165,134,146,22,172,216,
+    98,57,56,221,171,123,203,169,148,152,29,49,181,12,157,176,132,21,238,119,
+    121,193,36,92,134,210,78,69,198,176,84,94,124,175,2,83,65,35,10,106,225,
+    71,44,116,33,137,45,167,84,173,34,93,75,210,100,79,164,96,62,133,76,40,
+    27,106,185,43,150,186,171,247,86,225,32,92,162,71,8,96,252,167,36,136,
+    197,42,5,211,166,62,64,227,252,108,81,75,181,20,150,180,68,85,248,151,
+    186,76,29,83,18,228,208,228,224,142,18,23,226,77,4,194,171,242,25,19,113,
+    79,128,223,152,39,86,85,99,128,24,2,52,85,192,203,200,154,31,177,95,69,
+    61,162,179,202,29,254,75,216,139,252,5,126,86,49,166,30,188,208,108,21,
+    230,168,14,32,25,105,120,65,11,152,68,168,195,232,233,94,144,196,239,177,
+    6,223,37,180,148,135,60,165,39,74,85,5,184,206,114,240,129,131,108,171,
+    108,146,151,208,177,216,217,213,35,151,113,124,149,199,176,160,101,253,
+    21,14,245,158,56,80,199,84,171,26,123,49,11,13,195,80,143,105,147,44,81,
+    46,249,202,23,1,118,160,18,174,148,225,176,30,119,243,15,31,150,127,238,
+    104,92,165,233,244,146,142,142,75,33,105,77,210,32,55,68,198,19,161,50,
+    110,191,47,66,209,44,114,141,50,200,109,110,0,65,92,65,227,84,161,194,
+    105,39,84,128,19,234,226,81,169,64,231,23,137,154,206,128,162,68,129,162,
+    153,76,100,114,106,56,241,134,240,131,39,1,4,69,132,151,195,143,34,30,
+    37,208,82,9,181,40,181,195,59,117,129,163,254,137,135,130,159,163,99,13,
+    72,57,67,236,19,173,58,81,249,37,92,239,92,195,113,80,168,68,228,55,244,
+    194,145,119,145,235,88,140,205,144,143,114,124,193,12,34,83,138,87,101,
+    104,165,60,131,18,138,66,169,172,0,183,10,112,69,210,243,102,67,174,229,
+    171,129,200,230,84,165,0,237,198,170,158,162,57,146,39,239,151,43,85,95,
+    20,32,32,26,166,150,244,193,243,23,145,78,117,74,245,187,181,118,32,196,
+    186,235,14,133,124,172,208,82,199,151,106,4,122,220,201,57,160,165,191,
+    53,73,28,168,209,133,186,37,142,56,176,129,47,156,170,174,113,196,119,
+    213,81,235,186,36,182,214,228,44,122,12,133,55,221,91,69,93,213,191,88,
+    129,135,21,150,138,226,196,144,2,148,143,56,86,35,149,196,36,143,210,189,
+    76,247,213,248,10,24,105,88,38,195,201,111,14,114,10,173,93,10,148,40,
+    153,95,47,242,84,74,37,119,37,20,23,225,238,134,36,17,171,26,248,72,75,
+    165,181,230,106,163,122,213,34,160,101,233,111,80,221,227,53,183,149,174,
+    142,60,179,22,107,162,44,214,160,147,159,40,156,145,156,90,37,167,28,203,
+    132,247,40,101,67,177,226,191,129,3,72,247,106,74,117,142,116,21,22,163,
+    143,38,212,20,133,242,51,143,114,248,58,110,88,86,138,189,116,167,244,
+    113,41,93,237,59,45,85,239,212,85,214,12,129,141,180,106,149,101,115,238,
+    183,156,139,92,95,141,174,33,73,187,46,43,20,52,13,74,101,229,208,189,
+    48,241,101,173,16,193,105,78,132,66,46,113,186,230,125,117,4,222,52,92,
+    45,75,164,160,13,121,18,122,49,168,232,214,73,153,128,119,73,90,42,16,
+    52,151,244,74,201,202,42,169,151,139,210,75,220,88,55,170,54,204,107,216,
+    52,224,5,157,139,122,61,206,184,186,199,13,73,77,70,0,213,170,136,140,
+    109,242,0,145,165,23,171,161,199,203,23,10,184,74,177,128,177,118,238,
+    87,220,138,218,153,137,146,10,57,185,142,215,150,62,145,42,150,202,105,
+    90,77,213,89,132,121,215,98,146,155,224,177,161,0,185,106,145,177,82,234,
+    227,204,106,188,190,2,79,28,55,34,113,29,90,141,112,173,135,238,107,174,
+    34,70,108,9,25,52,202,247,84,148,84,27,247,181,26,13,157,216,230,192,212,
+    186,134,113,163,172,100,79,99,155,82,64,205,225,15,37,34,202,187,107,159,
+    106,84,211,18,136,148,170,209,186,97,93,82,73,140,162,26,250,161,108,53,
+    240,91,185,156,70,23,148,18,55,232,4,105,240,235,186,122,149,18,240,19,
+    65,137,191,127,47,26,149,32,128,138,239,41,9,157,66,246,93,233,134,98,
+    74,209,189,124,177,108,171,124,109,144,40,151,82,185,193,31,17,146,37,
+    163,180,25,52,74,154,0,5,83,141,139,221,144,233,8,121,121,146,150,80,93,
+    122,89,171,163,50,73,227,88,85,155,231,83,231,114,189,92,174,13,96,230,
+    195,235,203,186,36,113,64,58,157,197,186,186,186,70,245,113,106,217,213,
+    75,57,254,255,113,130,92,174,81,213,177,210,210,245,2,197,177,14,14,89,
+    143,26,169,68,83,74,21,75,32,78,99,235,178,132,0,175,165,75,227,234,72,
+    45,132,23,197,89,85,84,2,179,165,43,228,165,145,77,231,142,200,188,172,
+    185,157,191,72,224,88,239,72,69,180,18,139,205,178,133,165,211,6,20,113,
+    127,220,208,28,43,151,26,242,19,6,65,231,92,126,175,94,27,154,201,204,
+    181,216,190,58,235,244,74,105,101,165,172,21,85,227,114,186,150,179,238,
+    247,43,10,12,227,244,138,194,170,229,56,189,167,32,140,25,210,59,218,37,
+    40,238,48,230,172,215,145,194,146,175,28,85,43,226,242,56,100,115,14,157,
+    72,14,91,243,189,231,94,94,99,198,6,49,86,150,196,203,164,104,100,87,27,
+    97,184,14,83,224,104,176,33,83,87,105,125,33,130,64,112,189,190,175,35,
+    232,10,83,5,60,242,182,72,147,180,122,77,173,134,83,230,113,234,42,43,
+    149,82,101,92,99,205,83,88,242,122,141,233,176,26,71,105,138,30,233,38,
+    82,178,104,143,181,196,207,21,78,9,25,92,186,142,170,37,126,7,158,50,165,
+    179,175,35,7,140,205,36,190,43,81,215,151,20,212,108,155,211,170,112,205,
+    52,0,209,180,17,95,47,118,161,107,96,10,121,230,138,87,56,48,141,66,49,
+    74,243,235,176,92,182,80,203,37,189,104,196,225,15,46,136,214,225,53,13,
+    153,9,87,196,6,218,41,70,186,174,53,195,27,235,106,185,113,165,105,167,
+    1,174,141,50,112,94,74,13,250,170,210,39,194,194,165,68,33,65,131,154,
+    81,6,86,36,156,64,255,206,199,215,87,224,42,199,154,247,196,45,67,128,
+    167,232,136,118,200,0,36,35,128,214,215,244,218,88,223,101,68,146,30,162,
+    48,185,83,45,35,131,176,129,219,238,248,245,122,185,58,154,151,81,108,
+    23,246,43,131,118,181,154,54,46,215,245,218,185,198,141,123,196,211,113,
+    216,40,114,44,229,174,70,163,116,109,160,4,251,126,45,35,127,155,80,141,
+    99,123,141,106,184,75,81,154,58,246,186,186,190,83,30,245,40,103,227,139,
+    13,217,76,152,70,169,124,37,239,238,141,50,83,22,56,163,75,154,162,31,
+    126,185,151,67,16,6,24,6,80,72,11,150,226,185,225,92,9,135,59,2,191,43,
+    43,99,6,100,42,137,1,205,61,108,148,211,146,141,14,83,100,212,104,72,179,
+    188,215,32,70,214,197,60,41,93,36,102,13,45,246,240,6,253,42,108,174,22,
+    145,142,229,82,27,176,105,13,56,46,215,171,5,122,192,130,141,214,105,153,
+    124,163,15,166,92,35,6,100,178,38,189,20,38,72,29,252,94,37,105,105,22,
+    162,98,32,72,27,234,24,140,209,101,116,113,112,125,149,148,89,203,243,
+    14,121,131,118,120,151,57,71,183,112,133,145,239,107,184,141,174,56,132,
+    128,93,211,249,165,17,89,212,190,190,55,228,202,180,204,42,139,92,8,232,
+    176,145,98,253,107,88,46,57,156,23,71,81,76,233,17,243,203,209,50,179,
+    134,29,125,161,210,16,160,109,166,150,50,149,135,74,10,83,108,156,54,26,
+    214,253,154,218,160,29,69,13,132,116,37,160,21,112,120,7,103,149,177,11,
+    47,167,107,38,30,15,75,53,12,56,101,107,185,65,171,37,228,141,20,200,227,
+    245,186,81,142,210,42,152,240,50,118,198,9,101,68,143,157,74,232,44,13,
+    215,124,228,18,19,144,48,217,96,216,227,124,134,65,131,76,32,179,175,44,
+    3,22,126,36,9,113,55,58,139,203,145,157,178,60,8,58,107,77,18,179,72,54,
+    156,70,35,138,209,26,234,105,216,48,77,92,85,67,142,184,134,81,186,6,40,
+    104,162,9,128,8,35,149,122,41,175,175,54,203,162,157,218,133,255,49,167,
+    92,94,200,30,124,201,146,107,74,4,94,133,225,154,180,78,163,84,57,100,
+    221,9,45,187,193,48,33,111,214,13,97,182,230,123,81,227,122,151,154,81,
+    217,250,194,117,244,143,145,203,72,140,230,236,6,249,206,163,107,26,34,
+    77,170,23,162,59,138,21,116,136,95,198,143,202,54,191,72,191,37,249,192,
+    42,175,165,147,144,16,180,20,242,87,30,42,161,167,50,169,29,194,152,50,
+    147,182,210,178,99,179,162,40,138,66,146,3,134,136,240,72,2,150,119,203,
+    4,87,85,151,59,22,25,151,150,175,97,67,114,189,148,81,176,254,119,39,44,
+    114,229,140,24,149,243,70,168,158,172,134,109,95,214,54,65,0,214,112,78,
+    173,141,53,81,12,80,156,138,100,129,7,189,34,88,146,252,186,102,235,66,
+    83,178,30,161,203,21,113,121,13,5,107,97,131,75,83,54,46,219,225,128,20,
+    140,184,2,177,174,215,12,239,168,138,39,162,16,164,120,185,16,199,58,141,
+    44,169,159,25,200,115,136,211,89,171,231,50,118,66,10,68,21,180,218,13,
+    135,106,36,57,208,103,45,131,84,80,187,150,89,14,82,48,44,151,215,56,248,
+    170,160,33,2,137,3,59,36,45,80,96,217,130,180,50,238,1,120,39,196,5,23,
+    50,229,186,46,151,29,32,161,235,117,106,51,185,105,144,33,199,254,192,
+    92,68,81,68,152,29,49,231,75,87,11,113,95,9,2,16,42,139,48,198,11,200,
+    151,29,7,120,27,8,133,254,152,46,229,191,43,70,4,107,60,74,129,229,181,
+    13,60,22,201,24,233,21,10,142,214,101,128,182,17,49,6,47,19,97,42,26,180,
+    210,56,42,69,16,133,92,160,45,180,177,30,93,57,54,208,92,137,0,11,88,200,
+    17,30,6,134,50,6,164,23,144,5,93,43,90,11,58,237,83,54,204,57,87,166,55,
+    65,64,2,164,105,228,32,121,134,8,192,95,133,113,74,36,164,23,228,97,83,
+    33,120,145,84,182,84,158,222,67,4,4,210,148,18,241,104,10,116,12,131,95,
+    210,8,163,52,184,206,225,126,11,210,174,150,93,134,23,2,29,111,145,89,
+    140,72,134,231,85,61,3,54,188,216,215,107,116,181,197,63,239,227,101,122,
+    132,192,208,81,54,194,58,238,185,234,65,170,105,72,199,17,135,192,219,
+    122,93,14,163,43,25,143,92,53,138,145,98,170,115,21,136,33,156,81,102,
+    200,6,200,199,172,117,195,110,92,201,133,226,66,226,144,106,81,26,89,107,
+    175,163,16,78,208,16,7,95,109,248,230,207,72,237,224,35,138,94,219,154,
+    181,104,140,70,163,34,151,45,21,85,186,138,90,126,32,121,113,43,121,30,
+    70,228,228,154,105,104,35,114,244,17,201,53,229,43,56,80,82,49,253,228,
+    87,164,140,208,165,114,242,134,143,242,245,6,252,176,11,110,225,22,52,
+    27,114,33,94,227,128,144,227,24,151,87,93,40,38,8,108,125,161,118,56,197,
+    38,117,174,146,15,42,164,144,117,57,250,165,58,209,135,60,216,77,138,191,
+    248,153,173,131,211,35,190,92,81,77,42,35,0,154,76,101,199,87,37,29,189,
+    166,197,197,176,158,2,153,19,145,140,229,43,162,195,36,84,204,143,154,
+    45,148,143,254,217,91,175,50,179,156,180,230,143,240,170,70,128,173,172,
+    1,199,30,161,220,41,71,162,87,162,165,117,136,33,36,150,71,110,140,214,
+    104,164,33,98,215,107,37,27,63,219,69,81,196,63,57,216,184,214,202,10,
+    129,116,67,95,58,23,214,177,188,56,191,54,142,90,48,228,34,177,198,78,
+    15,192,92,206,17,81,250,247,36,172,3,235,140,42,169,154,152,47,95,151,
+    16,77,128,40,164,232,209,150,139,215,27,192,133,211,181,147,134,105,45,
+    173,97,63,149,37,119,131,120,40,174,104,175,177,20,116,152,176,97,137,
+    199,171,96,75,53,140,209,168,85,59,146,110,145,134,147,20,82,150,152,37,
+    182,212,57,174,27,52,217,8,163,13,239,114,55,17,78,24,98,91,30,77,25,38,
+    196,234,95,220,229,139,181,205,223,212,152,94,107,87,166,68,84,52,46,87,
+    216,68,54,87,241,19,210,165,193,107,249,24,93,11,113,42,194,25,216,229,
+    117,205,70,114,168,81,6,39,102,165,29,141,126,96,143,210,77,90,174,165,
+    202,135,116,189,17,117,229,26,105,64,111,86,68,39,203,8,19,211,172,162,
+    104,189,209,130,76,171,71,92,81,115,128,170,28,46,185,181,214,88,106,144,
+    68,148,142,181,226,26,62,131,165,84,5,151,133,62,202,162,62,185,80,74,
+    85,4,53,108,202,216,44,139,57,212,216,128,212,113,45,198,57,183,172,37,
+    239,122,212,220,198,10,112,161,9,159,130,13,219,72,180,41,175,163,154,
+    221,56,114,57,181,94,175,199,98,91,228,42,40,61,90,112,131,135,184,185,
+    184,234,10,195,208,196,12,137,236,26,0,134,168,128,51,107,233,250,152,
+    98,21,94,198,193,192,180,73,53,111,144,119,44,107,64,57,82,214,8,62,46,
+    35,40,221,52,54,27,174,14,41,131,82,54,197,76,66,8,142,29,33,118,93,177,
+    108,52,142,52,35,163,216,27,25,14,42,20,51,235,101,205,142,164,44,132,
+    120,12,27,133,26,54,13,123,67,92,28,225,175,86,46,31,41,136,182,195,242,
+    18,205,35,51,200,58,54,142,87,78,95,107,163,60,214,202,84,23,57,75,176,
+    199,125,141,101,36,130,106,28,71,240,214,162,163,6,9,86,224,30,182,14,
+    75,191,16,82,203,235,47,44,164,27,158,116,20,217,202,97,242,212,38,67,
+    175,71,44,6,139,199,104,131,154,108,94,43,55,54,96,190,41,71,155,34,118,
+    237,90,136,178,193,167,134,147,105,221,86,199,206,230,10,75,71,164,83,
+    219,216,116,172,92,63,42,82,225,203,137,16,238,181,102,31,175,84,19,214,
+    120,78,11,78,90,35,126,26,182,67,25,216,216,38,168,150,252,167,182,212,
+    237,155,117,49,145,27,81,173,145,214,34,165,0,82,37,77,142,71,110,42,23,
+    238,109,20,3,114,179,94,50,154,20,48,145,52,194,7,210,242,82,90,61,146,
+    112,107,7,15,54,150,220,24,69,197,244,211,216,74,55,53,57,138,46,192,155,
+    194,121,50,186,110,162,70,77,137,83,174,97,55,32,71,78,56,4,19,34,139,
+    35,209,89,211,156,215,110,118,61,110,236,244,136,202,26,235,163,50,24,
+    100,162,37,169,118,60,226,84,42,69,225,169,114,137,213,34,218,80,75,227,
+    151,73,189,81,98,83,162,74,69,117,215,229,114,185,46,67,160,188,120,228,
+    97,76,130,33,26,81,98,83,38,152,45,21,146,27,73,111,201,73,10,172,101,
+    136,152,55,252,202,22,148,166,198,49,178,163,13,10,111,216,71,42,92,70,
+    246,113,169,9,12,28,176,177,148,16,142,215,227,146,16,218,72,142,215,171,
+    93,14,73,14,238,161,65,84,133,50,224,150,147,174,155,227,82,233,6,153,
+    112,242,123,53,0,143,92,88,26,105,178,166,35,36,191,209,125,48,76,158,
+    48,64,202,155,8,68,17,60,218,231,203,92,249,200,171,80,155,214,142,71,
+    118,137,229,58,66,139,201,114,115,164,15,48,175,133,53,197,51,170,16,47,
+    75,59,90,227,71,170,89,54,236,228,168,121,0,246,32,16,42,93,82,149,96,
+    195,123,234,0,112,120,76,143,199,68,118,140,100,246,244,152,216,27,92,
+    92,14,65,107,179,174,113,129,142,77,19,99,125,93,98,72,209,243,187,225,
+    82,227,186,228,142,43,225,84,75,194,228,170,52,195,79,220,92,211,62,65,
+    197,246,102,121,228,151,20,242,201,5,8,143,244,215,53,97,129,94,10,60,
+    232,97,141,216,148,203,6,68,144,88,244,175,34,100,85,48,199,143,54,54,
+    40,215,146,141,33,147,93,55,0,72,168,46,163,4,113,96,136,132,11,107,206,
+    245,88,124,228,26,1,214,146,92,8,163,163,129,110,19,200,179,151,228,138,
+    196,135,70,128,207,136,52,162,106,141,77,173,200,23,22,55,34,113,73,83,
+    235,37,73,107,175,107,200,224,232,0,234,177,182,52,104,244,120,77,208,
+    251,213,208,82,27,105,112,28,83,142,136,232,9,186,83,236,179,44,171,135,
+    245,113,131,81,54,56,8,8,9,102,205,18,202,89,42,255,202,148,32,9,54,142,
+    12,189,48,220,64,211,114,115,213,106,195,148,137,146,132,236,178,203,178,
+    196,114,3,11,232,113,147,32,46,46,165,248,90,212,64,23,81,72,168,26,242,
+    219,114,89,219,128,195,134,50,152,4,155,100,35,20,142,114,1,129,149,22,
+    41,154,36,53,73,172,177,225,204,181,242,9,203,29,163,35,9,198,13,108,238,
+    203,163,97,215,146,37,175,108,202,118,88,131,80,208,72,54,48,101,219,229,
+    168,22,45,151,169,125,76,112,249,17,201,56,6,237,54,202,9,221,96,228,50,
+    70,174,149,55,203,50,201,102,44,19,71,212,70,81,18,109,150,210,110,98,
+    215,112,200,18,3,80,24,161,132,6,169,121,153,48,179,5,72,77,210,54,20,
+    24,203,26,94,223,24,161,145,106,164,44,107,73,45,5,126,218,168,213,208,
+    17,116,217,142,177,41,47,147,34,254,35,3,203,217,226,159,44,90,111,18,
+    3,222,140,26,194,198,79,141,141,230,230,49,73,157,229,38,74,106,124,19,
+    6,160,165,13,150,64,144,216,229,223,77,35,73,203,9,24,31,181,17,150,165,
+    127,84,128,206,1,40,73,55,199,144,207,110,96,32,161,147,68,96,135,74,181,
+    196,112,54,88,206,38,98,174,212,85,51,12,240,169,25,141,218,177,188,92,
+    58,12,130,165,102,44,134,187,214,214,155,13,75,31,234,138,120,162,86,187,
+    58,199,235,178,182,94,46,13,123,125,12,215,75,156,115,220,212,184,190,
+    161,140,149,149,248,147,225,17,109,66,169,179,182,118,142,5,149,199,90,
+    74,3,118,195,8,163,165,33,39,214,208,52,200,93,237,227,17,68,55,244,176,
+    217,132,78,205,94,218,28,70,104,28,73,156,154,109,39,75,6,43,225,100,112,
+    64,184,73,106,13,28,86,230,191,155,164,177,76,142,155,52,113,88,0,48,250,
+    145,132,72,18,101,143,193,133,17,161,96,16,88,201,213,104,48,10,19,224,
+    96,6,48,42,107,208,185,52,150,155,101,66,200,30,55,56,205,216,192,103,
+    202,107,73,141,24,67,122,168,10,49,133,100,133,62,151,36,146,66,89,20,
+    146,223,71,116,151,240,250,113,121,60,26,155,208,8,107,160,203,96,142,
+    12,176,36,105,54,75,131,102,152,72,128,66,29,186,128,204,90,98,0,20,97,
+    39,53,137,46,170,93,147,50,130,136,54,52,78,110,56,73,210,80,230,146,232,
+    181,134,97,16,45,215,68,214,3,107,104,91,54,146,163,190,96,80,158,145,
+    96,47,74,59,218,134,33,204,17,129,114,145,142,32,142,254,64,81,25,4,209,
+    176,149,104,21,131,191,8,1,213,214,220,140,226,169,9,118,8,22,114,97,227,
+    160,159,68,49,145,168,27,190,79,173,81,175,33,217,18,45,53,42,93,234,163,
+    152,20,234,108,254,97,159,144,47,193,185,38,127,107,134,38,10,4,62,142,
+    66,8,10,3,211,57,71,57,118,41,67,147,34,75,193,4,233,76,169,26,234,73,
+    12,10,20,16,134,33,245,226,82,174,169,161,1,128,97,255,84,39,6,51,176,
+    118,84,116,69,33,123,30,57,101,243,198,242,90,171,29,19,199,73,153,1,16,
+    198,222,186,9,249,56,24,211,59,108,96,42,200,2,125,193,113,149,91,140,
+    6,40,128,253,6,226,69,44,99,19,50,174,202,133,70,13,141,81,78,72,174,47,
+    193,109,3,97,6,206,176,113,61,84,146,216,80,108,111,244,77,166,166,14,
+    165,199,90,98,160,25,90,162,215,154,77,58,218,232,241,72,133,181,77,184,
+    57,26,106,30,199,213,54,52,99,112,125,20,41,93,136,33,94,163,85,152,36,
+    119,106,6,3,190,166,219,116,76,34,17,219,0,162,54,150,170,28,57,96,5,232,
+    160,214,26,118,164,110,126,150,133,12,54,55,153,226,232,0,15,136,241,19,
+    165,38,204,83,202,218,108,132,43,74,226,32,238,86,72,216,234,46,162,238,
+    141,163,243,233,40,145,92,175,220,170,95,55,160,44,10,19,233,150,71,19,
+    142,136,132,20,149,232,24,142,55,0,38,49,32,158,202,54,252,247,168,146,
+    80,144,112,196,117,108,135,148,14,189,104,17,115,241,7,243,68,1,66,169,
+    69,217,60,101,243,121,209,184,180,197,79,148,224,95,105,0,173,210,196,
+    242,151,71,109,213,160,154,133,153,13,153,82,21,198,38,250,28,20,130,44,
+    120,21,27,82,144,200,115,12,14,86,118,47,235,180,75,41,97,120,212,107,
+    202,93,105,32,114,28,62,176,177,17,164,161,104,196,159,203,100,201,3,80,
+    5,223,84,64,148,0,49,45,132,156,36,71,16,103,40,116,179,116,106,5,26,144,
+    43,116,64,0,181,36,181,67,148,28,85,171,129,203,143,10,249,99,145,17,199,
+    229,36,57,168,71,28,100,40,94,41,143,58,107,203,250,142,83,108,35,145,
+    106,0,28,218,185,164,6,132,162,57,60,234,88,58,141,54,19,206,96,58,1,184,
+    97,8,197,154,177,195,129,148,3,68,122,208,216,32,118,22,15,170,52,24,88,
+    82,147,93,95,134,137,98,114,105,243,185,48,50,10,197,11,240,163,114,230,
+    112,64,166,53,131,35,208,40,241,141,192,33,125,227,44,143,43,224,57,10,
+    94,78,172,83,15,3,141,78,235,134,38,168,83,103,107,225,178,4,197,27,0,
+    21,78,150,71,134,165,144,98,23,164,45,126,71,92,145,68,13,171,252,69,251,
+    156,11,43,242,131,142,23,235,200,172,150,172,104,49,217,29,53,214,133,
+    20,159,151,162,106,130,1,91,135,133,164,120,7,141,243,19,31,80,138,0,55,
+    209,140,16,38,10,203,165,113,216,41,114,232,226,128,215,0,85,203,26,49,
+    36,14,137,12,20,39,254,133,107,82,115,248,97,66,75,155,29,108,24,248,80,
+    163,160,182,115,144,193,166,54,89,218,156,198,57,108,87,245,72,44,39,7,
+    84,188,138,54,171,154,99,135,136,178,240,44,166,225,75,228,242,119,151,
+    76,184,174,206,9,6,35,206,17,245,64,27,78,16,14,133,28,150,203,73,148,
+    212,241,11,71,168,0,224,2,155,34,194,40,29,95,37,155,3,24,59,10,216,72,
+    50,211,118,53,137,36,185,176,110,104,30,216,135,58,202,171,41,223,180,
+    38,70,117,138,60,30,80,32,168,237,64,40,218,37,202,148,131,45,59,108,150,
+    171,201,42,17,224,74,183,205,1,69,32,99,20,183,161,163,122,136,213,15,
+    162,164,94,55,142,171,99,1,48,80,172,4,238,78,225,78,91,108,110,17,189,
+    73,81,171,163,125,136,54,117,252,64,125,187,205,106,71,99,117,178,235,
+    152,0,6,106,160,29,45,193,97,33,87,132,200,118,118,176,145,99,81,199,129,
+    123,107,7,81,162,205,224,184,74,38,4,34,223,9,176,45,108,237,152,130,135,
+    48,153,64,249,100,194,49,187,21,216,27,199,29,26,142,84,31,254,143,140,
+    21,44,58,210,2,66,174,233,251,18,198,173,227,81,100,169,60,89,133,199,
+    9,184,145,250,116,5,52,176,188,3,177,58,103,71,2,112,105,31,12,146,128,
+    58,65,220,224,188,101,253,152,236,118,226,0,157,39,201,68,142,5,149,205,
+    142,199,81,45,241,178,82,4,28,146,227,46,217,109,142,144,15,125,9,85,28,
+    24,53,73,253,0,247,71,59,169,239,128,101,117,64,44,135,195,102,87,51,66,
+    62,98,212,235,117,201,18,95,172,138,219,113,26,52,22,0,104,194,241,181,
+    99,121,60,192,222,100,66,181,181,99,125,50,161,126,104,69,161,245,13,68,
+    82,79,13,137,161,135,176,118,208,1,128,105,24,59,141,23,144,61,32,198,
+    9,62,172,239,38,240,135,95,249,34,129,18,150,112,34,15,114,239,177,216,
+    80,16,250,196,168,31,142,137,30,219,161,2,74,248,101,180,212,118,128,130,
+    192,163,213,78,170,171,173,54,19,227,112,192,158,104,206,152,36,228,195,
+    100,162,197,137,35,29,99,199,15,7,252,200,165,72,23,133,45,87,117,106,
+    100,123,136,162,58,234,33,120,149,10,206,97,82,219,37,7,53,94,159,28,86,
+    171,68,195,101,53,81,247,43,41,35,100,158,139,73,188,90,87,198,45,119,
+    32,82,119,52,75,138,208,171,31,29,224,151,146,40,117,69,162,29,15,245,
+    221,225,96,239,234,155,229,142,68,37,13,106,155,73,2,55,75,116,24,225,
+    178,93,180,171,105,156,174,152,82,203,48,130,38,122,129,213,37,249,101,
+    131,93,162,86,144,179,51,193,197,84,79,160,68,6,106,157,24,154,20,26,83,
+    72,208,88,105,32,239,72,179,21,193,1,14,134,113,48,14,28,57,49,72,57,197,
+    247,164,110,56,145,54,140,250,14,124,235,225,166,206,198,116,64,0,96,4,
+    125,72,125,181,58,134,32,79,140,35,134,226,79,101,246,6,201,48,123,132,
+    49,122,85,222,225,40,224,216,45,87,171,136,124,152,108,162,73,168,105,
+    53,49,108,236,71,103,155,250,234,176,218,212,39,198,100,85,219,77,106,
+    171,35,214,94,241,116,77,215,31,240,229,142,224,217,77,236,104,178,218,
+    105,54,39,135,8,168,49,13,74,222,209,23,45,242,192,129,254,162,21,158,
+    59,112,179,157,76,234,147,164,206,134,1,24,132,30,190,95,17,168,43,56,
+    169,193,13,171,223,1,91,113,220,1,128,33,33,90,25,245,8,216,140,218,1,
+    65,160,28,73,119,71,42,71,138,248,186,35,9,16,75,152,122,231,68,148,123,
+    64,157,75,210,131,55,248,132,49,65,245,8,103,87,115,86,59,162,164,190,
+    211,57,68,22,216,78,38,27,199,230,27,98,162,105,118,88,70,135,99,77,33,
+    185,156,28,142,187,157,125,220,209,121,228,172,150,124,160,62,33,252,193,
+    56,225,29,50,22,37,33,152,205,228,80,219,173,64,101,178,195,81,246,10,
+    149,201,93,56,194,38,95,24,118,118,61,89,17,193,36,230,14,140,118,147,
+    240,144,172,128,130,115,11,64,87,54,48,97,178,250,174,14,248,117,70,47,
+    92,242,37,100,183,171,219,181,195,241,176,139,168,126,39,38,18,162,243,
+    40,245,217,245,3,211,250,80,115,106,32,177,35,104,140,21,195,84,185,48,
+    217,16,95,84,185,211,22,83,227,145,200,80,134,31,72,19,146,184,190,162,
+    120,124,122,12,15,135,221,14,211,2,110,189,30,133,59,132,185,218,237,194,
+    221,110,119,96,203,225,15,251,176,75,86,245,21,54,91,49,128,232,6,244,
+    121,145,40,194,180,97,178,59,24,178,100,200,244,168,47,1,193,1,39,232,
+    6,10,124,86,35,43,235,27,4,179,179,233,200,86,170,243,65,131,11,68,233,
+    238,104,96,252,201,228,224,28,234,71,94,227,72,250,114,156,195,97,194,
+    141,112,59,145,5,140,250,241,32,249,27,53,136,59,96,86,181,133,26,86,40,
+    236,232,32,170,137,116,132,156,234,117,194,24,93,67,28,158,92,49,147,48,
+    123,93,215,49,169,109,24,129,26,210,139,68,212,241,154,126,187,201,132,
+    116,219,17,184,40,15,129,212,119,171,195,110,82,231,115,171,29,72,17,29,
+    75,41,249,16,65,21,40,79,118,152,134,84,169,147,182,148,189,193,33,187,
+    250,161,166,118,54,54,48,58,161,61,129,163,221,161,54,113,12,216,227,9,
+    128,58,96,174,122,17,88,145,18,39,42,142,173,17,172,7,158,70,203,200,41,
+    60,208,218,81,129,9,196,44,11,228,9,204,66,37,31,134,99,156,100,75,112,
+    117,133,181,145,236,236,16,81,41,83,0,239,200,2,166,83,235,234,8,73,29,
+    87,198,97,130,124,48,49,157,28,234,43,154,63,236,8,158,85,194,207,148,
+    189,83,226,68,168,65,33,56,97,16,27,197,34,86,155,104,134,237,86,112,5,
+    71,156,129,195,232,4,23,232,251,96,93,131,91,2,71,174,198,14,7,46,53,191,
+    87,135,196,97,112,175,106,10,212,21,75,9,78,230,138,157,205,208,59,236,
+    120,85,244,42,104,118,72,188,104,134,233,0,20,202,6,34,35,74,84,19,12,
+    97,116,176,193,12,12,6,220,204,115,34,153,233,65,146,238,132,61,119,76,
+    64,194,80,250,241,210,1,220,232,140,41,64,160,241,35,204,42,108,40,130,
+    249,113,88,110,96,255,0,69,252,120,92,30,144,229,4,94,143,147,144,121,
+    194,192,70,235,198,223,63,194,58,176,218,178,3,74,229,78,35,2,38,35,172,
+    147,63,152,17,68,5,176,6,211,138,245,36,114,168,53,180,119,187,21,85,129,
+    147,184,164,39,170,151,152,38,50,39,234,132,24,228,92,91,201,82,4,204,
+    74,148,224,15,240,171,211,63,97,118,48,8,153,250,138,15,2,197,33,36,246,
+    118,24,222,153,176,112,113,129,88,167,113,226,128,31,40,136,122,249,190,
+    189,115,72,9,91,103,177,124,50,219,104,95,61,193,4,115,115,178,178,153,
+    64,154,239,232,126,82,248,131,184,57,74,3,48,173,63,84,1,193,193,231,200,
+    187,149,253,155,172,156,8,177,18,133,160,70,47,28,173,88,90,41,192,234,
+    76,63,206,96,139,177,39,232,166,142,90,118,54,167,28,145,18,116,162,40,
+    158,161,67,234,198,13,145,174,96,14,177,197,1,57,82,174,21,203,86,180,
+    90,134,172,102,19,218,163,109,229,64,130,199,96,114,131,78,112,35,200,
+    58,19,250,3,99,130,89,211,55,49,228,12,81,120,136,236,221,132,228,132,
+    111,218,68,109,236,51,82,65,125,226,212,149,24,7,50,76,175,17,31,19,39,
+    97,5,144,64,40,149,54,208,77,17,26,146,206,196,17,201,184,232,128,48,84,
+    27,83,136,14,17,44,15,236,120,120,183,114,18,233,166,174,141,38,18,158,
+    60,69,205,17,247,242,49,189,196,233,135,66,103,220,15,129,188,174,13,138,
+    45,6,204,73,107,188,182,227,121,99,53,217,201,137,145,174,38,203,153,36,
+    144,1,152,124,142,191,18,165,10,168,81,249,68,60,177,46,172,86,14,162,
+    49,100,241,157,17,42,200,185,1,24,163,58,168,172,188,67,192,249,43,212,
+    177,66,146,84,133,216,180,66,217,154,217,48,183,10,105,140,179,119,226,
+    128,70,169,175,190,251,91,151,205,11,59,2,25,210,224,180,104,20,200,14,
+    70,192,81,128,78,106,79,212,239,193,65,219,245,16,253,136,110,165,255,
+    65,3,134,90,61,176,61,104,49,42,4,67,233,228,72,34,183,73,95,18,30,181,
+    163,32,162,13,171,81,179,29,210,155,168,155,236,166,204,94,116,96,243,
+    25,66,117,229,215,165,48,246,123,168,217,249,138,86,67,167,10,93,197,0,
+    87,68,171,98,253,58,120,128,132,249,185,8,31,239,252,58,225,24,216,82,
+    152,22,30,194,11,72,129,71,147,143,81,176,242,146,40,160,16,142,97,201,
+    39,206,167,17,25,181,179,119,193,100,10,29,114,36,235,57,174,160,125,36,
+    167,202,15,83,200,170,215,167,180,164,46,248,187,94,72,14,233,176,193,
+    26,191,156,198,84,88,73,37,30,184,234,58,0,223,173,60,24,77,234,158,12,
+    5,17,145,156,190,155,120,136,197,83,51,8,10,168,38,193,138,85,125,55,241,
+    13,57,23,129,193,141,102,4,147,81,129,232,147,47,90,180,36,169,131,218,
+    59,28,130,41,95,124,188,169,140,54,241,118,7,158,56,200,78,108,111,83,
+    224,174,59,187,0,43,238,212,160,60,224,73,142,192,16,20,159,86,116,81,
+    58,217,41,229,237,86,211,66,247,244,228,69,193,97,226,217,19,195,243,165,
+    120,8,1,169,9,194,156,212,193,83,173,162,145,250,116,55,153,70,30,108,
+    219,100,238,74,138,103,46,236,18,123,231,31,100,20,112,228,109,221,204,
+    117,6,31,166,31,98,56,9,40,62,66,149,126,80,71,137,20,195,217,187,250,
+    212,163,27,180,193,115,193,4,193,146,173,135,149,63,145,95,252,201,20,
+    155,3,119,128,44,35,181,43,19,106,39,87,107,162,132,170,217,121,184,157,
+    73,99,79,73,22,178,208,159,76,188,169,79,159,126,221,219,41,97,201,12,
+    244,168,23,8,160,195,223,195,232,107,138,111,147,221,148,218,131,64,239,
+    227,131,157,66,118,194,247,206,0,98,136,68,22,214,250,20,118,39,218,39,
+    0,6,113,179,1,40,167,161,133,218,81,169,71,28,29,234,1,144,39,190,190,
+    124,76,132,239,212,215,170,232,37,138,130,100,26,217,62,54,244,121,108,
+    231,123,83,79,81,42,46,35,224,63,132,126,20,249,226,11,145,172,168,227,
+    160,47,1,72,131,143,79,144,12,216,201,242,59,143,223,86,190,82,45,209,
+    255,248,176,155,214,65,91,106,65,248,65,189,142,45,149,248,90,141,184,
+    150,27,146,128,40,242,166,19,46,101,254,16,45,1,31,210,202,24,73,46,12,
+    30,174,9,166,1,103,236,66,244,70,196,213,119,90,150,8,73,122,224,33,95,
+    59,153,17,248,90,75,234,98,131,95,147,169,161,117,138,204,152,170,206,
+    186,71,195,73,61,96,38,248,211,186,31,16,242,72,77,211,166,30,176,26,26,
+    128,189,218,121,56,217,155,162,36,95,49,227,4,190,135,147,41,53,10,252,
+    149,178,34,42,134,144,130,153,88,117,166,84,19,25,83,194,49,9,166,74,12,
+    56,34,6,108,161,182,250,101,185,139,126,249,86,117,240,252,85,80,183,13,
+    79,67,213,32,231,200,111,47,66,146,201,244,48,221,173,66,142,159,58,100,
+    167,112,240,184,152,149,16,230,2,223,176,125,45,17,126,144,216,1,93,169,
+    120,190,198,226,202,64,110,93,105,139,217,249,60,182,58,120,135,105,18,
+    133,19,77,190,192,59,120,204,3,100,239,27,7,39,9,112,202,193,71,127,140,
+    178,3,114,215,144,152,74,241,4,203,148,100,174,3,186,199,103,136,103,3,
+    74,39,114,49,94,11,138,77,161,238,105,75,177,189,128,75,166,72,116,53,
+    101,122,6,26,199,1,164,97,78,131,145,6,223,83,62,29,218,1,230,9,188,186,
+    29,122,1,0,251,172,90,248,139,151,108,45,10,145,31,76,146,80,91,21,106,
+    217,121,30,106,4,80,159,77,112,231,79,1,7,159,7,100,2,52,28,148,181,186,
+    51,168,175,138,253,107,74,19,104,211,199,77,216,156,15,48,101,0,46,66,
+    44,12,218,233,110,122,152,248,43,159,109,134,129,27,1,32,115,54,240,225,
+    238,224,227,254,32,82,56,69,62,127,76,37,144,100,21,40,122,165,156,149,
+    242,41,152,132,24,192,144,98,15,14,71,237,188,122,177,127,133,2,215,179,
+    167,8,194,47,34,152,201,132,109,234,9,39,248,69,50,120,137,194,22,125,
+    115,37,103,25,83,180,235,123,32,229,139,42,250,246,131,8,197,78,166,193,
+    47,52,49,169,38,66,195,152,106,246,65,62,132,58,117,111,66,87,147,41,198,
+    65,85,129,225,121,108,36,1,108,18,66,128,128,154,105,47,177,149,154,90,
+    35,189,36,176,189,250,110,58,69,48,94,144,112,28,213,160,198,0,4,14,134,
+    77,48,201,195,1,95,2,229,22,79,107,57,70,247,61,132,110,216,12,157,250,
+    42,96,117,1,150,73,34,236,9,38,63,224,100,181,66,198,1,47,57,239,79,209,
+    51,118,61,40,111,120,94,131,39,132,25,131,144,37,82,124,164,66,34,214,
+    109,153,150,182,9,30,229,0,223,118,57,11,51,208,15,27,148,49,5,57,56,170,
+    107,223,134,10,188,161,84,227,9,223,211,66,66,60,35,69,95,3,95,235,115,
+    148,56,106,69,209,19,192,246,138,143,128,2,115,1,253,69,59,223,214,168,
+    8,8,39,244,106,248,33,89,133,29,113,229,47,190,98,88,145,52,228,47,234,
+    242,167,30,138,148,50,167,18,83,144,76,167,136,70,210,129,189,208,193,
+    127,135,96,82,52,25,4,96,194,116,152,78,121,23,165,50,211,192,192,243,
+    167,188,194,77,12,158,32,48,72,56,108,24,232,54,6,3,129,129,223,119,33,
+    70,38,228,69,57,77,73,242,83,100,64,20,64,10,151,49,55,60,110,230,203,
+    44,35,12,10,248,122,229,107,151,150,245,80,4,209,229,211,160,199,104,240,
+    49,46,149,77,60,134,13,230,68,166,191,117,78,211,96,141,12,248,38,50,0,
+    33,58,120,117,223,71,128,224,236,35,112,144,9,184,128,201,199,167,137,
+    15,194,62,218,121,128,182,242,118,136,141,216,49,8,66,26,66,148,88,129,
+    127,57,232,224,209,32,171,21,38,4,97,108,63,73,192,208,32,37,121,143,16,
+    98,163,164,102,111,106,208,28,240,249,232,114,138,20,141,195,212,103,45,
+    136,248,35,224,28,112,245,3,131,214,137,167,149,71,58,250,17,98,164,128,
+    41,78,141,124,135,237,153,175,40,32,193,1,188,140,17,2,118,20,177,64,190,
+    34,135,136,43,180,252,240,1,153,155,39,168,141,223,234,32,41,223,128,125,
+    224,97,26,36,178,227,250,64,3,123,69,140,80,5,88,217,182,142,66,53,83,
+    141,201,4,91,98,185,105,196,59,196,52,1,81,7,21,112,226,30,228,70,120,
+    131,211,212,243,108,44,136,110,228,246,68,13,35,117,92,26,161,21,18,10,
+    41,212,101,188,41,246,33,159,189,2,27,77,112,175,78,243,254,212,192,56,
+    83,4,32,53,145,0,190,55,33,90,80,148,239,179,98,69,112,21,5,83,254,10,
+    118,196,51,146,227,133,128,59,177,30,187,57,111,113,28,39,160,34,172,74,
+    53,34,214,3,62,25,23,216,88,109,57,138,233,135,12,180,106,51,191,119,8,
+    88,11,126,160,81,237,129,246,65,229,248,154,105,129,186,102,164,131,105,
+    221,102,250,98,61,79,235,60,88,250,65,96,195,176,167,130,180,67,224,47,
+    37,131,161,76,99,61,32,129,235,32,169,194,166,148,53,229,52,18,159,211,
+    136,110,180,238,129,63,179,50,240,167,142,199,22,59,5,46,6,7,5,3,176,143,
+    86,89,56,141,122,0,223,68,25,96,242,70,24,104,228,36,50,25,138,97,201,
+    131,18,4,25,98,108,78,101,60,64,31,24,97,14,237,6,66,12,91,69,210,226,
+    129,204,158,134,112,6,212,65,18,18,178,116,239,215,253,21,254,70,157,145,
+    227,49,32,35,122,132,113,254,228,115,62,248,105,41,97,62,105,111,60,252,
+    50,193,109,222,1,145,132,150,245,174,50,211,143,12,6,100,72,12,6,250,135,
+    214,153,251,152,201,47,254,254,165,164,224,192,226,30,80,107,160,161,200,
+    7,15,82,55,70,22,213,172,230,117,35,154,138,8,222,208,190,2,166,68,7,116,
+    32,15,204,165,108,212,209,30,254,197,38,124,181,163,38,140,98,107,89,228,
+    141,196,241,101,47,134,154,199,251,190,44,68,232,250,40,22,27,147,46,172,
+    9,182,142,98,192,232,27,15,65,1,137,94,136,198,3,135,131,49,99,32,176,
+    121,128,207,23,187,157,182,38,72,149,213,217,253,125,25,156,153,141,77,
+    97,215,103,20,123,82,158,175,105,160,97,174,8,139,192,21,65,9,80,141,129,
+    64,234,35,135,138,82,16,14,180,107,90,0,41,239,218,232,129,49,161,188,
+    8,216,86,248,90,193,242,24,77,85,30,157,19,179,221,215,203,207,252,94,
+    30,244,166,175,60,8,250,94,240,202,124,255,53,125,5,158,155,247,131,23,
+    49,227,117,189,110,247,213,165,146,192,203,253,60,239,249,60,234,78,189,
+    238,52,120,241,238,43,207,253,96,252,10,56,196,243,51,126,15,186,200,64,
+    24,243,135,23,228,8,169,203,73,65,240,224,204,140,35,92,122,216,118,167,
+    112,219,205,253,110,224,191,186,47,183,231,143,3,142,8,186,175,32,243,
+    249,21,6,242,158,235,102,47,119,58,247,40,49,232,6,211,220,243,178,215,
+    171,215,237,101,15,62,184,237,190,166,121,22,116,51,94,127,112,78,214,
+    205,50,95,249,164,131,221,224,245,242,252,188,199,3,138,20,10,205,167,
+    221,105,215,203,95,185,199,223,47,250,122,77,187,122,133,99,245,153,220,
+    235,231,121,215,235,121,57,7,242,28,47,245,60,94,125,101,93,160,241,51,
+    215,125,241,217,41,151,242,208,148,195,221,233,116,27,112,172,255,226,
+    207,233,11,249,2,92,209,234,150,27,130,151,43,73,79,253,188,239,119,185,
+    190,159,247,184,145,80,205,179,252,229,206,233,6,136,124,106,160,7,183,
+    55,205,114,111,158,231,15,207,165,121,55,240,93,48,230,146,110,198,137,
+    126,54,221,2,212,86,88,113,73,79,94,233,185,249,75,96,229,156,194,15,47,
+    159,122,179,32,3,154,160,71,79,66,239,245,2,2,126,238,190,188,44,31,251,
+    126,14,160,180,197,157,16,195,233,252,18,4,93,63,23,37,25,221,122,99,78,
+    122,1,112,55,207,188,254,54,207,122,99,37,64,240,152,186,80,142,11,193,
+    250,149,119,131,135,231,109,249,216,180,155,119,31,94,119,156,247,187,
+    143,94,175,251,75,179,249,156,91,115,113,158,131,84,87,23,190,182,121,
+    48,102,171,166,37,14,247,189,174,36,25,204,61,127,174,208,152,102,219,
+    64,124,74,48,221,233,28,74,208,2,92,7,93,55,112,95,174,143,52,105,205,
+    237,74,105,221,241,203,155,35,62,208,119,61,119,14,32,93,196,246,66,117,
+    28,193,39,131,135,212,240,10,182,217,212,221,194,149,247,0,201,109,15,
+    9,32,16,14,117,61,29,62,165,50,245,77,141,99,201,172,155,209,217,28,221,
+    250,175,222,212,235,193,173,152,124,5,191,93,79,18,13,186,104,82,71,140,
+    105,129,183,252,30,160,122,91,196,238,33,235,215,107,138,6,186,65,6,116,
+    158,215,159,138,74,170,10,250,221,169,26,226,136,96,14,23,175,110,128,
+    248,145,52,245,0,48,102,1,13,80,122,116,199,174,11,142,243,151,62,177,
+    125,201,230,104,188,219,157,23,90,243,212,44,74,208,106,140,94,65,227,
+    69,199,124,214,123,117,123,249,216,29,235,138,110,230,190,230,184,213,
+    127,241,8,180,230,129,63,135,241,156,131,179,249,22,17,229,84,165,67,32,
+    49,200,231,144,79,147,168,41,71,87,211,76,108,116,17,47,69,207,193,197,
+    223,102,94,190,229,102,57,130,114,94,253,45,22,217,130,20,231,5,178,118,
+    238,245,50,32,45,32,65,144,200,43,223,114,148,220,233,99,222,108,204,135,
+    198,208,59,126,8,69,111,235,34,48,44,249,202,130,57,205,100,115,92,43,
+    13,226,21,72,15,92,212,152,5,193,124,238,66,73,158,79,199,120,213,19,223,
+    47,127,154,201,77,160,140,62,145,6,126,244,60,48,25,191,228,70,232,158,
+    230,143,173,18,106,236,189,30,243,57,93,251,185,48,152,186,65,15,137,242,
+    198,118,235,111,221,76,71,225,140,110,31,208,231,196,25,194,34,158,168,
+    1,157,226,110,111,76,186,140,123,254,3,27,117,199,4,209,20,2,233,136,34,
+    184,153,66,115,129,61,247,243,110,63,112,57,36,67,18,211,121,206,57,44,
+    2,25,165,109,113,123,247,87,66,206,93,95,193,32,240,183,65,175,239,147,
+    63,158,94,8,230,0,141,75,94,89,70,153,36,16,46,207,130,109,55,31,119,253,
+    238,156,32,148,192,94,193,35,123,145,18,216,144,23,94,62,21,120,61,41,
+    0,25,189,52,0,165,210,241,88,216,249,243,140,50,123,208,36,122,229,160,
+    23,45,7,254,184,187,205,81,210,131,143,187,91,236,146,231,99,50,217,39,
+    208,167,47,68,248,66,94,74,29,180,155,229,243,237,246,245,128,74,248,81,
+    70,228,40,130,196,146,17,208,57,110,65,176,30,180,187,148,151,207,51,30,
+    24,111,177,52,170,239,66,10,145,211,197,162,83,180,75,104,163,106,183,
+    59,198,96,46,230,234,226,163,185,196,241,162,214,151,158,198,255,125,130,
+    200,39,6,80,26,31,153,34,93,164,6,122,240,238,206,137,169,249,148,67,50,
+    0,246,252,241,220,115,183,115,4,185,29,111,241,49,181,143,199,227,45,115,
+    134,200,228,64,127,202,41,192,10,0,221,44,232,189,104,30,187,82,143,50,
+    103,174,232,34,54,224,47,127,188,94,115,84,77,101,42,152,249,145,189,230,
+    222,118,140,144,30,121,87,62,195,72,143,249,56,112,145,138,232,166,214,
+    124,27,76,93,16,202,114,162,66,190,207,30,61,166,98,214,157,143,51,23,
+    12,32,116,251,26,211,163,191,221,202,49,144,243,10,92,94,20,20,124,58,
+    235,205,115,57,29,104,252,49,49,180,133,19,188,74,74,205,49,61,126,154,
+    211,23,92,186,72,104,58,245,48,26,227,35,127,193,163,139,197,198,219,249,
+    86,3,144,176,124,109,231,99,132,78,117,24,134,195,145,176,39,55,251,99,
+    191,143,113,95,242,118,119,156,81,175,55,207,122,202,192,220,167,119,151,
+    48,193,1,152,23,149,51,146,199,194,162,24,37,1,138,125,113,139,39,143,
+    115,56,199,190,92,34,30,17,230,227,191,25,8,198,189,128,86,31,115,172,
+    204,225,248,203,165,20,17,140,130,201,2,192,203,200,236,224,23,79,81,160,
+    171,153,130,247,183,60,59,39,125,50,94,67,115,83,224,221,206,117,79,23,
+    252,179,204,29,191,230,191,91,158,67,15,193,88,49,247,234,10,23,68,167,
+    71,188,109,15,191,32,36,198,95,23,112,122,24,26,254,183,124,140,116,155,
+    251,99,28,0,44,216,181,15,120,84,210,199,187,227,124,171,105,241,146,88,
+    249,11,149,131,146,160,197,85,61,134,99,151,89,71,131,200,92,57,75,192,
+    141,139,78,229,74,34,236,197,169,99,116,60,31,195,229,24,43,18,77,99,42,
+    128,78,182,132,254,152,231,182,219,188,248,59,243,5,213,188,235,163,214,
+    113,247,197,244,70,89,228,31,3,129,187,72,132,109,78,220,119,131,113,38,
+    171,49,79,231,226,208,243,183,191,188,62,7,91,185,220,127,61,128,213,31,
+    147,131,128,58,239,62,4,28,138,67,159,60,15,88,132,163,171,115,201,124,
+    98,19,49,113,68,175,55,22,66,216,144,93,7,89,188,96,157,79,184,115,70,
+    190,231,102,227,41,143,80,165,235,21,66,33,134,225,4,30,33,183,203,9,140,
+    132,173,14,203,51,226,5,181,188,166,196,32,173,200,152,24,250,87,48,3,
+    27,57,142,237,137,170,46,224,48,202,183,228,142,172,163,201,220,43,236,
+    36,101,142,145,22,187,7,5,112,3,250,38,85,115,37,74,111,170,149,13,246,
+    252,92,134,165,132,222,24,94,101,178,113,62,238,177,5,190,184,27,129,195,
+    247,118,76,161,204,120,14,204,188,7,154,2,189,238,246,241,224,168,177,
+    22,22,78,96,182,163,87,79,102,207,50,145,129,208,183,72,145,185,130,217,
+    199,99,105,142,215,128,75,241,63,70,127,228,244,107,140,158,199,156,230,
+    102,193,184,223,197,89,221,46,243,170,135,117,201,45,142,103,165,205,182,
+    236,61,232,20,173,16,68,99,13,198,28,0,186,83,24,5,147,49,198,25,107,157,
+    165,0,166,4,53,211,242,156,200,30,247,161,158,144,156,143,169,227,165,
+    21,149,46,5,7,161,88,76,97,29,178,5,61,74,220,62,250,254,214,227,105,54,
+    85,108,131,107,120,140,90,249,155,4,196,160,93,0,202,192,22,102,230,211,
+    108,206,160,99,77,205,198,133,178,153,127,115,13,135,241,124,76,49,32,
+    193,5,200,141,21,212,213,232,166,226,108,59,215,104,165,224,96,203,246,
+    140,193,95,10,1,87,139,6,175,186,175,254,248,177,117,53,74,230,46,154,
+    102,204,48,135,230,189,151,40,161,253,46,217,142,33,145,226,152,64,195,
+    240,192,141,204,121,21,48,89,171,183,60,51,214,146,3,65,24,108,10,95,158,
+    214,45,218,133,41,48,39,213,199,36,39,146,65,54,91,156,207,5,252,2,60,
+    243,46,17,141,86,129,174,176,119,46,79,80,158,124,174,140,160,4,234,4,
+    191,140,160,167,126,122,226,51,74,114,118,75,87,49,74,44,187,197,201,140,
+    31,222,145,126,1,21,18,137,113,92,59,231,195,4,33,228,16,203,249,156,200,
+    33,101,199,115,133,148,59,38,177,248,28,238,69,61,228,174,162,27,195,16,
+    97,104,136,33,67,166,33,20,202,65,17,116,204,193,248,105,222,19,206,93,
+    86,159,30,125,111,49,147,140,70,57,80,215,235,5,186,106,235,162,20,22,
+    59,206,225,232,177,224,238,161,44,72,204,250,96,215,213,10,135,191,183,
+    202,166,30,51,131,61,226,5,4,174,184,35,98,120,142,246,152,251,57,134,
+    80,0,209,231,86,97,183,237,2,39,73,64,146,65,6,218,236,246,36,244,177,
+    66,204,101,171,148,192,193,134,195,168,180,203,139,133,27,245,68,174,60,
+    85,161,212,47,89,117,25,100,8,95,207,34,34,37,58,86,155,23,185,5,61,219,
+    241,67,48,49,227,181,157,211,195,227,111,158,145,24,28,12,241,26,205,98,
+    9,189,245,165,7,193,34,94,224,255,133,96,230,196,177,38,239,216,237,33,
+    11,247,5,53,232,171,104,133,81,38,135,80,141,64,5,219,57,197,112,113,79,
+    148,0,79,46,167,242,138,76,169,180,207,11,216,21,143,220,11,73,28,49,239,
+    246,241,111,182,117,73,5,80,119,101,95,125,169,82,19,115,253,203,4,98,
+    226,21,236,104,34,190,56,158,81,176,149,85,9,175,174,118,193,49,145,1,
+    187,242,229,56,127,140,85,107,174,211,40,244,165,103,245,65,61,201,175,
+    174,62,196,3,11,94,32,45,92,233,151,134,41,106,204,145,148,191,21,199,
+    84,7,87,12,80,23,186,149,42,90,164,230,175,113,159,90,102,219,126,177,
+    32,128,135,62,161,121,71,154,186,221,55,143,242,136,182,74,224,159,35,
+    5,145,151,109,243,183,104,119,183,109,165,21,126,25,143,23,175,108,129,
+    92,182,219,25,51,148,155,103,2,49,47,220,78,177,237,177,18,132,79,100,
+    139,110,222,150,242,40,7,87,171,164,173,154,116,123,196,244,124,188,216,
+    138,9,229,75,87,185,195,103,218,218,239,251,174,190,10,96,155,25,108,101,
+    61,237,198,125,196,193,21,90,7,251,93,54,6,186,194,45,220,135,113,95,143,
+    87,33,174,5,223,98,20,104,243,246,92,241,186,205,11,161,111,187,127,37,
+    213,67,188,238,92,111,83,133,64,150,78,186,74,10,158,160,227,241,252,253,
+    88,208,3,167,190,50,125,93,152,137,99,112,30,255,127,207,194,131,3,132,
+    34,96,182,23,197,215,139,119,79,247,96,213,76,229,243,70,254,86,98,241,
+    100,27,159,206,164,51,165,5,29,163,176,109,145,46,12,47,225,236,110,223,
+    185,86,86,148,192,5,124,139,68,152,68,207,118,246,134,25,141,223,151,92,
+    192,129,174,186,219,178,185,228,109,76,237,162,83,186,232,10,233,113,143,
+    219,94,51,246,158,222,188,143,156,186,221,194,15,234,55,67,91,196,11,39,
+    206,221,5,108,181,1,254,13,196,179,119,177,22,161,33,72,23,25,189,87,31,
+    21,207,114,182,65,34,107,134,141,230,99,98,148,47,202,48,130,186,221,119,
+    79,6,213,215,124,158,86,204,185,82,255,182,61,127,180,231,237,252,205,
+    199,199,11,76,255,30,207,121,115,203,65,176,52,235,118,23,93,129,235,178,
+    144,119,11,167,50,229,219,219,238,108,46,105,160,56,148,228,246,22,143,
+    92,249,54,119,97,189,39,157,191,232,144,202,16,95,119,254,70,169,11,205,
+    16,130,166,215,206,178,109,47,115,23,219,5,29,195,216,204,149,187,73,233,
+    183,220,250,210,1,2,141,99,122,127,97,235,110,223,175,238,76,54,43,196,
+    151,143,219,162,144,231,126,21,132,99,194,15,157,255,194,233,184,175,20,
+    222,182,225,111,177,128,238,177,82,142,93,1,113,208,197,155,251,16,90,
+    187,63,159,245,16,131,86,13,166,109,182,32,176,95,179,133,43,145,188,249,
+    120,187,191,205,230,153,200,235,102,18,22,194,204,223,109,102,141,76,44,
+    87,146,31,139,108,62,35,163,164,53,50,111,172,197,13,207,247,22,224,242,
+    90,192,36,141,105,60,10,0,222,226,186,5,90,111,67,160,59,219,42,48,94,
+    175,118,27,124,92,132,12,165,36,245,124,198,222,137,130,186,111,26,156,
+    207,136,132,89,15,37,176,132,189,95,139,12,175,194,61,38,101,127,88,0,
+    166,108,238,190,102,204,171,87,27,244,181,135,17,62,219,7,133,205,84,229,
+    75,244,179,177,182,49,130,148,198,4,126,105,17,125,191,21,219,47,201,6,
+    115,146,252,252,12,86,40,230,13,156,47,190,80,108,95,179,249,155,231,72,
+    89,148,226,74,122,124,207,39,41,182,11,217,171,24,232,51,9,110,129,166,
+    186,111,240,207,30,36,77,134,192,103,136,45,159,241,204,120,145,205,182,
+    249,226,61,111,191,179,5,144,45,198,116,61,3,142,69,222,107,183,201,229,
+    119,214,227,178,182,198,28,214,204,222,219,94,187,187,200,23,139,215,236,
+    239,151,148,54,112,115,56,73,248,214,3,114,84,155,238,40,30,216,40,39,
+    19,186,152,243,45,23,142,23,140,182,54,86,90,140,199,179,30,101,189,181,
+    47,184,179,188,159,105,178,161,214,69,183,237,46,136,10,37,236,123,230,
+    106,222,46,16,251,120,220,126,32,146,215,187,200,135,246,88,193,152,189,
+    218,180,79,232,176,160,17,104,99,54,224,69,183,151,245,123,144,200,106,
+    211,207,185,158,9,242,102,125,153,189,113,214,59,131,132,55,190,88,0,84,
+    27,85,72,38,239,12,125,100,250,106,55,195,188,189,215,187,151,51,159,148,
+    16,237,76,255,91,31,4,209,241,155,84,112,223,250,54,242,210,232,212,136,
+    1,0,28,50,67,171,139,57,151,43,237,230,253,60,95,96,165,94,207,157,205,
+    0,151,93,132,81,158,117,223,46,63,99,113,16,34,39,104,25,63,117,103,175,
+    89,38,204,21,106,109,212,196,119,1,162,102,139,44,249,86,171,101,129,15,
+    188,243,135,88,224,199,124,187,160,158,119,123,70,164,116,219,152,174,
+    219,206,216,125,17,17,154,67,43,237,69,31,81,230,175,133,188,184,104,183,
+    101,26,192,152,3,109,123,193,63,109,87,129,70,171,156,2,104,217,123,182,
+    45,198,80,182,112,223,185,190,31,229,90,49,218,51,122,159,75,219,185,219,
+    238,61,218,179,108,220,107,187,80,135,13,242,110,251,241,112,95,239,237,
+    130,206,102,143,57,96,210,170,254,119,165,182,246,68,192,35,154,200,135,
+    140,236,237,45,116,191,59,107,163,255,246,27,75,177,38,109,161,237,49,
+    39,28,94,82,156,182,116,14,123,185,139,183,139,230,249,82,149,115,57,194,
+    112,179,217,66,223,170,53,252,183,84,10,142,74,207,94,155,251,121,228,
+    119,65,64,106,241,93,184,110,175,247,134,168,69,134,69,22,217,27,225,142,
+    219,136,130,194,17,197,184,93,188,74,49,153,208,233,189,103,175,249,226,
+    13,224,11,28,136,172,24,35,220,177,152,207,138,7,40,127,145,113,16,145,
+    78,36,188,121,241,189,160,5,150,146,121,187,253,238,206,218,114,63,231,
+    49,123,160,10,139,247,168,122,166,212,156,97,62,192,165,250,113,59,147,
+    152,243,188,55,155,209,16,170,197,38,98,143,4,68,75,153,102,11,249,157,
+    205,251,217,187,207,26,192,84,32,227,48,64,215,237,47,148,197,25,30,204,
+    169,46,155,185,40,250,181,224,66,132,255,38,172,187,15,122,238,45,72,106,
+    18,109,54,159,105,205,156,205,138,9,63,35,145,32,128,75,178,158,75,57,
+    196,107,27,221,189,103,104,140,164,7,253,44,155,189,85,0,223,28,49,21,
+    83,98,76,45,11,114,235,205,98,69,126,140,49,168,198,219,107,254,112,225,
+    163,205,103,221,119,38,103,188,93,215,93,184,61,28,131,188,240,67,59,127,
+    188,84,93,119,214,147,179,218,51,48,112,223,253,49,52,247,223,194,237,
+    145,241,157,104,241,214,218,39,101,9,51,246,234,57,65,219,71,214,25,51,
+    147,186,221,71,155,37,143,19,89,162,128,108,225,46,22,189,7,191,240,94,
+    214,38,219,16,102,62,230,181,110,54,155,45,254,58,144,89,248,80,155,109,
+    18,43,135,25,118,215,118,175,189,197,170,109,20,150,225,240,158,86,9,228,
+    231,50,101,9,89,22,2,124,130,80,9,154,247,156,70,22,24,135,190,182,234,
+    75,140,83,44,159,157,141,145,118,155,85,129,141,53,107,187,12,173,183,
+    194,9,129,182,17,40,202,100,66,169,75,249,148,77,28,242,80,194,66,73,5,
+    185,154,24,36,74,198,127,103,125,23,235,184,237,66,56,60,173,253,240,253,
+    192,22,184,72,203,246,12,47,182,11,12,223,237,241,2,164,22,238,131,230,
+    232,103,177,152,35,205,197,236,253,134,126,24,229,41,254,33,154,23,11,
+    77,183,69,230,246,103,178,61,75,223,150,82,218,174,94,163,6,162,131,250,
+    197,173,139,26,232,4,202,88,210,65,101,193,63,11,125,113,108,51,221,31,
+    184,3,4,221,69,111,209,167,161,30,186,237,62,102,237,30,188,45,48,4,83,
+    147,185,198,24,155,229,61,153,28,168,65,151,195,217,173,104,99,49,107,
+    103,250,21,155,105,46,45,220,217,162,135,44,104,248,141,194,187,133,176,
+    24,62,200,14,38,73,36,66,150,200,220,226,49,20,35,85,81,25,227,85,130,
+    220,206,22,36,86,65,157,32,0,221,119,175,61,119,223,34,85,243,225,93,164,
+    20,188,130,21,152,190,231,51,154,224,120,110,165,107,62,136,89,144,237,
+    28,88,196,176,228,221,110,143,93,77,147,55,126,235,191,213,37,160,193,
+    226,66,240,144,212,136,75,114,160,55,81,194,253,252,194,120,124,139,232,
+    183,242,9,121,43,116,218,146,238,66,247,44,102,253,133,134,50,58,210,196,
+    97,227,201,31,56,11,132,139,203,95,202,112,137,167,75,46,206,180,159,188,
+    22,180,64,38,67,123,127,75,56,204,180,67,192,208,162,143,221,248,214,193,
+    51,69,226,240,244,140,176,42,220,140,87,133,204,204,117,219,237,71,251,
+    193,171,20,232,234,64,150,58,150,243,188,15,254,84,195,71,81,195,95,74,
+    218,12,74,193,133,163,212,12,118,0,18,245,221,94,188,217,99,96,131,198,
+    103,156,194,251,20,195,231,80,64,47,19,28,208,58,203,250,0,246,75,116,
+    45,102,69,69,68,29,14,126,229,168,123,177,120,112,16,98,82,52,34,31,180,
+    65,167,46,69,101,200,255,33,129,242,58,28,35,61,110,113,37,62,250,5,77,
+    225,198,123,36,68,91,178,126,247,249,131,84,208,90,198,14,199,59,212,178,
+    96,45,132,114,205,126,114,94,167,115,179,34,72,205,169,100,238,208,34,
+    221,46,236,249,238,190,139,169,75,115,180,4,77,44,30,15,5,39,191,115,74,
+    123,241,152,233,255,189,67,78,32,170,191,48,13,175,115,255,223,97,163,
+    255,135,2,117,176,233,17,131,58,255,173,171,160,228,221,231,96,50,12,32,
+    25,76,237,226,125,156,251,22,176,212,211,99,4,46,122,125,188,194,91,139,
+    252,33,165,240,174,82,85,9,221,126,100,240,74,80,209,158,180,12,9,92,205,
+    57,156,198,209,224,160,185,50,155,253,80,181,124,40,124,100,16,62,190,
+    152,185,29,154,123,42,171,233,102,246,148,60,216,167,184,78,145,219,214,
+    116,147,58,40,113,246,128,23,118,185,142,232,211,12,132,37,220,68,63,16,
+    219,123,230,15,61,8,17,188,205,23,184,30,240,231,237,78,123,246,215,100,
+    109,114,52,203,58,46,104,190,53,185,216,26,168,182,159,207,138,42,37,57,
+    8,134,64,26,101,32,34,198,119,254,131,83,97,182,243,104,47,126,148,92,
+    0,196,199,31,178,163,158,19,168,139,231,162,144,165,250,122,211,51,110,
+    121,247,138,25,154,245,58,170,143,229,133,255,32,162,79,137,222,109,119,
+    20,87,220,213,123,124,33,139,78,127,246,92,60,158,34,229,171,227,74,61,
+    111,169,9,240,85,198,12,168,102,218,29,223,18,59,69,181,191,102,68,157,
+    56,81,103,174,54,40,190,249,44,58,11,250,121,182,1,79,111,41,250,132,211,
+    172,163,101,21,1,126,138,212,103,175,87,216,216,109,63,193,190,253,126,
+    204,196,172,100,135,30,218,253,25,9,153,207,56,104,246,73,177,237,175,
+    47,201,213,229,81,254,147,127,181,103,159,57,6,105,63,103,159,50,22,109,
+    246,73,209,252,75,35,173,253,9,183,20,8,97,154,145,100,75,47,67,145,239,
+    246,167,202,121,63,85,26,239,104,182,105,4,163,225,197,147,96,165,197,
+    92,97,220,254,234,117,68,40,55,117,168,149,24,230,1,13,137,92,129,242,
+    195,103,58,28,225,42,214,251,74,180,172,243,9,44,121,155,51,126,241,33,
+    241,243,67,159,217,187,80,210,251,83,185,161,70,104,106,246,86,23,153,
+    228,200,234,140,129,159,178,151,94,16,71,170,68,126,153,117,16,29,197,
+    182,137,67,80,111,231,207,108,193,84,90,232,127,225,4,113,13,179,14,165,
+    45,104,83,134,66,117,95,176,212,201,191,178,231,236,249,126,75,186,136,
+    151,125,134,241,60,83,62,103,249,103,191,243,213,153,21,222,203,218,40,
+    102,86,108,56,178,117,246,232,180,53,128,96,250,241,149,163,102,247,221,
+    105,255,116,22,159,217,179,215,111,119,62,251,159,159,239,159,39,30,125,
+    226,54,165,248,39,88,255,112,210,35,71,103,184,71,198,81,135,146,37,67,
+    108,150,63,59,15,247,153,41,50,161,173,255,89,92,138,227,222,79,184,124,
+    184,159,253,159,217,243,201,172,120,188,127,200,233,130,167,207,206,2,
+    201,211,210,79,182,248,130,10,148,214,239,100,50,15,186,238,125,145,27,
+    237,206,179,253,126,98,233,231,215,207,251,235,217,225,107,199,34,255,
+    124,191,191,222,5,26,236,90,153,158,154,189,251,89,7,77,176,99,119,50,
+    224,121,254,244,102,139,175,252,153,207,190,16,114,231,237,42,251,32,52,
+    67,71,29,5,231,211,253,233,116,62,41,25,87,60,57,16,121,180,21,10,218,
+    42,51,49,128,80,158,124,225,201,233,115,230,126,62,17,237,83,83,248,253,
+    204,158,159,34,57,127,62,245,189,197,237,61,165,232,69,143,52,3,141,207,
+    69,167,221,121,204,58,189,222,236,39,251,202,251,109,124,75,116,255,20,
+    134,127,46,10,47,99,34,185,0,196,8,138,175,246,215,239,231,23,104,118,
+    8,226,25,179,31,205,117,30,153,36,129,212,248,131,50,126,222,224,182,120,
+    246,158,207,207,94,255,89,76,142,30,21,207,30,20,191,104,127,201,85,159,
+    8,147,242,126,158,168,166,144,115,251,249,238,116,10,23,60,209,124,177,
+    16,205,224,155,175,100,79,222,42,210,120,214,249,130,168,254,151,38,179,
+    146,108,1,51,132,57,248,114,29,53,191,63,185,120,209,3,39,94,154,117,158,
+    144,139,92,59,20,254,110,119,224,178,247,243,217,254,249,252,66,106,188,
+    253,238,253,8,173,126,231,55,203,158,89,71,36,10,86,36,180,192,177,196,
+    246,215,15,70,203,62,243,246,207,34,123,118,102,79,94,234,124,61,179,79,
+    162,59,123,62,223,207,71,159,87,225,229,153,61,62,59,159,207,89,246,67,
+    42,183,191,218,157,158,148,209,129,220,175,231,151,11,15,157,236,235,179,
+    83,76,189,217,15,195,112,246,126,118,126,190,168,9,170,222,159,207,118,
+    255,201,105,160,248,153,73,245,253,231,151,242,25,155,18,9,157,247,243,
+    83,119,189,145,221,87,251,169,119,63,23,192,12,59,239,199,155,31,57,246,
+    235,167,195,87,133,207,197,207,2,213,1,172,4,254,236,189,59,159,8,243,
+    7,174,59,139,197,39,213,34,203,30,144,163,219,236,147,19,63,103,207,207,
+    246,226,171,199,206,192,189,112,142,33,23,111,64,248,209,64,255,249,212,
+    40,97,210,182,63,59,157,94,7,196,126,122,174,252,165,170,169,79,97,243,
+    248,82,75,25,202,120,210,57,150,1,9,98,242,249,232,60,159,157,231,23,104,
+    126,50,1,102,224,130,126,249,88,71,219,30,35,191,243,68,173,40,234,129,
+    19,144,108,70,209,60,145,241,254,143,158,204,126,208,197,227,201,229,152,
+    246,243,243,7,178,159,63,132,176,194,19,60,193,155,94,184,164,157,125,
+    98,86,106,199,102,34,176,253,249,236,124,126,229,189,231,167,251,252,65,
+    78,44,2,157,79,237,18,157,199,39,25,193,3,217,207,23,207,127,118,178,30,
+    0,208,37,131,243,83,3,229,177,120,62,191,88,147,248,44,181,101,92,136,
+    46,64,155,162,52,179,200,165,103,159,44,101,67,225,143,247,87,111,214,
+    233,252,252,200,108,244,212,166,102,40,232,124,145,244,164,214,162,211,
+    121,118,240,37,228,128,192,79,127,145,211,250,207,231,179,136,161,39,107,
+    6,174,120,103,191,92,243,219,135,134,47,93,246,131,69,56,142,119,104,150,
+    212,127,178,157,229,4,193,79,31,37,254,31,13,110,182,164,42,186,181,109,
+    159,138,45,86,198,11,137,161,59,34,6,158,76,25,107,23,251,14,245,84,32,
+    1,141,140,178,33,112,7,53,195,60,180,249,95,55,243,255,170,86,205,153,
+    169,242,60,99,220,221,24,174,255,97,89,98,244,27,241,34,147,207,81,13,
+    79,126,253,247,17,34,168,218,136,223,201,82,152,252,87,133,163,253,80,
+    9,161,100,13,145,12,242,70,235,255,145,106,31,165,192,153,88,52,77,203,
+    164,193,168,28,116,36,15,21,140,148,74,223,72,13,113,253,175,70,206,127,
+    107,98,125,210,20,126,41,169,31,125,252,249,143,8,253,199,38,35,40,250,
+    19,168,37,31,186,14,255,21,215,20,70,226,126,64,211,255,213,200,213,43,
+    31,32,1,133,68,13,237,81,33,238,253,71,19,150,17,192,237,56,236,171,70,
+    153,138,225,15,4,246,197,77,95,255,135,252,208,233,183,110,224,104,22,
+    171,111,9,254,10,70,196,221,247,136,85,5,19,212,64,32,100,222,253,39,6,
+    195,47,172,76,251,4,205,8,255,226,80,10,190,94,249,145,109,166,38,97,130,
+    42,18,213,132,188,254,15,73,95,209,15,50,98,226,253,239,170,173,135,48,
+    224,250,82,26,223,53,185,131,12,254,63,117,67,77,8,229,63,108,75,147,95,
+    10,180,50,31,164,119,90,193,18,208,61,66,241,159,53,116,98,95,255,249,
+    230,83,104,2,36,63,254,189,146,3,124,252,243,227,47,50,64,63,250,40,85,
+    193,29,122,35,252,55,196,254,208,37,143,240,103,168,171,71,60,75,76,19,
+    195,223,42,94,91,193,168,246,111,72,151,100,23,201,245,249,47,165,235,
+    72,138,249,7,66,105,236,159,255,204,143,17,60,142,72,16,88,170,17,24,92,
+    244,61,66,18,54,115,72,115,235,227,19,247,140,112,11,132,128,58,141,179,
+    213,145,13,31,50,1,185,56,226,130,47,217,211,102,90,48,17,17,202,85,133,
+    143,20,12,215,239,207,56,166,228,209,21,80,53,64,62,228,202,209,151,89,
+    251,196,136,255,208,11,97,34,124,254,133,172,255,93,105,54,84,24,80,13,
+    15,125,92,107,120,232,131,0,24,225,208,50,24,184,137,106,191,191,25,244,
+    244,35,155,135,87,69,245,247,151,253,165,76,254,87,242,69,93,223,35,27,
+    1,151,100,64,7,143,3,22,141,126,151,25,253,57,34,5,106,76,164,17,1,199,
+    214,194,147,204,253,207,143,154,244,15,208,102,56,82,141,224,6,16,132,
+    213,232,219,254,208,80,70,113,255,142,174,92,243,241,201,68,177,177,8,
+    135,51,14,201,17,10,177,175,178,168,194,49,254,31,108,92,37,109,78,224,
+    213,255,254,167,62,71,95,49,57,197,201,215,143,248,43,38,140,56,232,251,
+    195,172,253,59,2,158,143,240,26,107,212,115,43,60,192,0,101,232,33,62,
+    68,36,2,108,252,65,255,255,153,92,48,226,100,118,171,235,231,87,237,83,
+    141,142,174,225,63,118,25,14,168,11,57,9,54,68,45,238,190,176,50,94,172,
+    125,196,66,72,3,103,20,195,121,168,145,26,127,233,103,72,24,253,23,199,
+    161,2,123,244,29,170,38,102,128,250,168,169,39,137,78,164,140,190,174,
+    218,68,190,175,188,74,228,96,161,152,14,245,60,39,92,185,132,32,45,35,
+    242,159,107,168,62,193,91,103,80,223,245,202,124,131,120,38,6,106,193,
+    221,96,166,193,197,7,240,34,231,115,163,146,212,30,81,206,87,25,225,159,
+    223,255,197,64,140,213,106,162,64,32,32,76,174,224,215,26,159,34,179,8,
+    46,26,250,30,145,96,60,76,137,88,249,235,79,140,74,105,20,135,75,106,196,
+    3,189,125,124,218,138,199,17,247,92,77,158,50,197,73,77,67,224,107,100,
+    162,207,154,248,96,89,254,38,53,129,92,132,141,84,225,231,39,229,124,195,
+    36,227,239,42,152,62,174,8,75,167,124,253,99,126,177,147,197,163,43,202,
+    254,199,54,121,130,139,232,81,130,229,250,209,167,72,71,45,163,235,191,
+    165,4,40,13,192,201,11,108,26,199,220,109,66,34,134,43,27,38,183,89,131,
+    190,101,38,114,130,123,74,181,126,213,144,245,135,41,214,48,238,135,73,
+    101,31,241,183,73,14,33,233,171,104,141,245,39,103,83,198,55,149,19,151,
+    26,153,28,161,45,130,31,174,161,201,155,31,20,3,195,124,134,78,71,246,
+    135,244,134,76,168,21,135,114,33,98,248,40,221,13,48,48,31,203,33,250,
+    5,88,120,143,79,208,27,194,182,71,250,81,177,240,81,11,195,235,151,20,
+    252,45,120,209,5,54,169,73,169,236,104,122,166,140,167,88,134,255,64,7,
+    92,65,15,146,32,207,126,217,168,129,7,88,243,190,53,22,191,205,81,105,
+    138,171,250,96,228,96,50,237,41,49,72,124,234,58,82,152,195,194,175,243,
+    199,213,252,22,129,159,230,72,86,148,57,63,62,77,243,67,241,127,253,138,
+    77,157,253,1,154,177,140,243,17,215,76,118,105,249,121,52,50,99,181,250,
+    37,132,62,148,198,20,254,137,56,184,89,116,135,18,240,168,142,152,196,
+    223,213,12,191,75,141,211,0,67,169,86,238,61,208,194,8,195,138,152,50,
+    174,125,150,184,148,97,203,123,181,235,25,255,43,130,64,150,226,168,169,
+    236,182,166,113,252,249,29,155,154,109,60,139,80,192,77,218,231,8,104,
+    163,67,117,252,125,142,181,70,141,62,235,35,125,246,227,86,161,84,155,
+    115,174,163,51,146,141,81,1,112,152,218,127,112,107,133,6,65,46,54,63,
+    190,234,42,118,36,164,185,28,136,174,177,137,26,168,13,247,214,206,84,
+    163,132,229,199,144,235,175,96,166,102,165,2,196,68,211,10,199,154,108,
+    93,187,218,74,239,56,254,84,69,188,125,189,214,21,79,163,207,248,243,166,
+    189,128,7,76,244,10,83,230,87,189,4,197,150,3,205,218,119,124,173,107,
+    63,251,58,211,110,44,26,107,34,165,252,231,42,127,42,50,72,52,233,25,224,
+    232,30,217,198,159,8,68,223,33,42,215,208,230,181,10,172,113,111,108,127,
+    85,120,204,172,133,230,181,22,243,191,91,124,189,222,70,231,143,111,50,
+    45,252,42,113,255,254,186,65,51,77,208,60,140,196,245,239,145,105,154,
+    181,243,141,203,63,206,10,131,186,114,93,115,242,115,164,240,46,201,24,
+    157,71,18,102,141,116,99,198,1,203,245,227,118,142,75,236,62,63,202,183,
+    98,243,90,185,217,229,14,244,117,211,248,60,107,208,196,138,225,27,40,
+    49,161,136,185,202,85,225,41,219,209,20,134,162,50,80,99,78,125,34,215,
+    143,107,252,105,75,120,87,19,44,117,161,13,171,128,85,185,142,42,181,10,
+    74,33,82,62,234,218,24,100,175,143,138,224,250,16,134,21,14,197,198,159,
+    215,175,202,200,36,110,106,127,45,67,235,215,239,114,251,64,194,163,239,
+    155,4,140,186,67,130,161,86,142,132,143,243,245,243,179,98,198,31,97,157,
+    14,206,56,179,110,214,145,10,90,52,207,38,89,17,194,40,101,95,207,223,
+    215,115,172,104,100,49,168,133,231,107,133,102,70,97,104,35,225,107,237,
+    108,126,43,164,67,105,243,90,38,200,183,144,212,22,245,249,81,169,104,
+    91,22,85,188,58,82,247,144,2,142,64,88,137,21,79,218,173,204,111,52,48,
+    146,219,37,139,175,138,57,42,9,64,49,140,218,250,119,24,154,159,117,157,
+    110,34,254,10,65,17,106,38,197,218,40,192,94,62,70,116,20,193,168,34,20,
+    190,101,78,238,96,148,162,1,206,16,97,20,196,113,31,102,93,25,52,26,157,
+    111,149,24,205,32,153,10,253,113,203,231,168,174,105,101,126,10,95,56,
+    188,157,17,122,13,39,17,127,181,43,50,250,174,241,29,239,92,199,31,31,
+    113,125,100,223,42,117,129,130,50,110,87,26,2,75,138,248,24,65,95,133,
+    166,137,65,206,170,16,74,177,93,249,174,124,127,86,96,170,14,154,240,137,
+    57,71,18,60,194,211,202,105,135,113,24,214,185,252,122,35,109,194,144,
+    60,163,57,156,206,73,44,23,176,103,215,5,170,16,12,41,53,30,153,231,202,
+    71,140,193,203,175,97,118,157,200,136,207,220,74,136,211,27,111,199,241,
+    153,216,70,235,103,78,249,148,178,227,155,29,43,180,201,187,250,249,155,
+    72,8,17,123,189,94,1,103,56,87,0,50,87,165,41,160,35,139,235,55,250,162,
+    162,186,138,70,22,223,216,235,12,79,95,182,29,214,207,180,2,116,230,40,
+    54,111,122,175,254,85,171,212,205,144,147,206,159,38,3,200,62,215,99,251,
+    239,54,130,48,108,82,234,118,70,189,88,243,92,255,66,101,245,107,189,14,
+    34,10,214,17,124,196,55,161,124,171,223,232,129,120,194,149,55,102,48,
+    242,208,22,58,170,212,213,144,210,24,149,177,25,198,124,219,60,199,152,
+    230,140,251,42,130,59,174,156,209,42,43,80,165,206,81,21,69,195,200,14,
+    191,111,31,148,73,214,214,25,234,21,50,53,252,98,156,51,250,32,143,213,
+    224,252,113,70,183,31,231,138,253,141,67,234,231,171,93,49,107,117,243,
+    118,35,189,81,69,5,217,124,153,159,88,114,36,9,2,99,140,71,98,180,131,
+    12,57,122,164,35,241,28,115,152,51,240,197,23,151,127,133,38,202,172,144,
+    230,183,26,62,195,157,55,216,34,238,42,181,27,250,191,81,83,248,29,34,
+    194,250,151,90,101,163,84,42,223,88,62,181,129,220,8,177,27,222,56,159,
+    181,69,213,67,144,27,233,78,210,1,112,207,164,118,25,254,231,218,231,141,
+    10,98,62,140,50,235,82,52,46,48,185,195,188,157,249,39,14,43,149,43,202,
+    168,131,216,25,240,208,202,23,154,191,93,17,110,13,168,64,254,140,35,149,
+    249,223,245,15,196,4,183,49,193,12,163,74,80,20,160,47,126,231,17,20,197,
+    245,218,25,208,206,38,34,29,97,167,47,52,206,105,215,74,76,48,176,121,
+    220,232,236,246,125,163,135,56,252,160,116,24,171,152,28,12,35,40,215,
+    228,174,50,245,107,231,248,139,207,155,183,16,132,235,149,207,138,58,226,
+    20,83,105,135,161,109,192,167,155,79,122,130,244,184,12,142,250,215,13,
+    93,197,245,243,231,149,185,204,171,36,11,206,97,124,85,180,248,34,51,230,
+    83,124,142,111,183,115,13,242,109,30,163,170,15,249,0,58,72,91,232,170,
+    95,43,104,209,252,6,12,19,213,127,163,188,47,1,100,215,209,0,113,67,71,
+    184,14,173,126,84,190,234,88,180,126,6,118,134,17,87,35,141,51,129,58,
+    194,54,132,224,232,171,126,11,153,222,32,84,47,87,207,58,159,24,221,110,
+    223,166,201,243,103,60,85,25,197,149,27,233,140,160,21,42,183,239,122,
+    165,198,145,35,192,174,19,189,204,193,51,123,78,141,130,227,115,5,11,210,
+    12,252,222,20,199,252,249,105,2,102,165,94,255,160,129,179,73,225,159,
+    53,243,122,190,213,80,22,59,53,29,215,212,72,24,51,139,107,184,228,6,195,
+    113,124,165,147,10,90,195,233,245,10,106,192,80,113,45,68,27,166,250,193,
+    3,128,195,93,128,70,231,156,73,90,153,223,231,114,242,154,113,157,236,
+    160,22,58,96,148,193,233,89,158,40,31,49,43,55,160,59,155,166,76,142,225,
+    116,139,118,76,201,247,102,126,125,223,120,233,251,204,143,117,210,150,
+    25,118,3,119,152,230,145,219,53,188,141,144,102,5,19,141,66,2,166,2,125,
+    177,188,74,122,43,119,227,122,133,1,192,173,49,226,170,85,106,103,86,98,
+    18,43,190,97,23,88,187,161,13,2,53,54,149,213,31,10,176,171,20,9,176,223,
+    21,190,204,220,232,146,134,149,186,108,9,212,105,146,19,40,254,179,78,
+    114,134,146,96,229,166,152,18,33,152,184,82,175,232,43,174,68,205,59,231,
+    122,233,142,175,17,21,97,4,108,64,53,117,90,137,181,223,161,96,16,197,
+    148,21,208,146,66,56,137,184,58,19,60,208,207,245,163,219,199,13,18,226,
+    138,173,128,169,16,232,42,213,174,84,192,179,14,45,35,19,205,224,70,190,
+    36,134,181,207,240,76,138,152,231,79,246,177,240,118,182,181,206,144,144,
+    108,13,245,208,212,208,193,218,24,130,17,23,199,117,4,128,168,32,8,179,
+    158,245,50,251,85,13,240,235,146,243,13,69,96,102,90,199,16,250,221,212,
+    147,103,82,42,38,15,144,57,153,131,75,207,38,93,213,107,74,27,4,105,211,
+    197,141,129,10,78,50,183,152,68,50,164,38,202,209,184,133,46,12,105,210,
+    232,183,8,140,217,0,71,208,119,53,233,137,131,41,71,138,81,28,196,108,
+    60,103,25,4,176,209,210,153,156,68,65,20,3,124,177,125,179,109,172,92,
+    97,248,32,64,162,143,149,135,71,24,131,117,50,227,86,215,188,1,103,147,
+    92,135,113,196,125,51,77,178,180,62,210,146,85,145,56,40,11,213,105,232,
+    243,62,88,151,58,227,137,91,57,18,204,80,158,168,8,110,176,6,28,98,130,
+    41,113,165,65,141,10,194,140,212,71,117,225,55,245,124,87,110,104,147,
+    124,137,43,53,198,92,172,81,162,209,70,60,16,39,92,116,134,254,248,171,
+    142,192,107,60,138,0,24,192,248,79,124,155,163,50,40,153,110,160,170,41,
+    90,7,84,186,230,120,89,180,108,159,19,208,91,108,219,182,32,53,195,79,
+    32,174,51,168,109,190,217,163,55,94,188,161,231,90,133,146,101,6,196,99,
+    35,21,150,90,232,171,176,18,18,69,20,244,33,160,191,235,166,82,133,234,
+    168,66,223,222,128,156,34,236,144,209,201,201,166,88,103,220,195,52,228,
+    243,51,157,137,14,222,2,196,111,37,60,235,25,184,148,73,127,182,207,95,
+    33,182,194,243,54,149,19,247,160,133,101,191,67,17,102,35,29,30,63,255,
+    29,243,4,128,121,179,113,46,124,224,141,88,202,163,210,58,98,29,213,75,
+    37,82,62,122,173,179,31,132,210,170,214,35,154,199,113,146,23,161,135,
+    81,194,79,110,71,219,92,69,96,157,197,16,146,186,149,122,162,70,14,140,
+    149,175,55,5,157,45,161,107,130,73,21,183,91,205,150,95,244,100,157,101,
+    17,250,43,90,44,235,146,176,50,235,70,148,149,172,33,88,189,6,225,103,
+    137,134,72,170,179,137,81,12,213,243,6,111,163,164,90,69,47,156,235,66,
+    63,36,156,41,7,52,62,0,194,84,50,113,182,84,76,51,52,117,19,94,48,73,65,
+    162,84,86,175,40,108,206,74,68,233,27,200,185,157,191,216,196,234,250,
+    71,97,196,75,202,66,210,240,172,180,85,242,196,101,152,169,53,234,225,
+    79,178,27,192,42,12,87,93,117,251,187,31,96,55,217,49,172,144,202,229,
+    112,225,51,34,141,10,249,73,144,86,244,81,147,2,67,144,226,66,10,228,6,
+    60,36,120,200,118,21,198,75,245,144,122,109,213,129,204,105,222,180,43,
+    242,241,255,139,242,16,30,160,147,251,72,165,74,217,153,106,8,5,7,241,
+    131,116,43,37,86,21,91,23,146,148,165,206,208,177,250,1,229,243,241,188,
+    129,94,234,151,225,9,93,42,0,140,114,153,162,88,210,210,40,181,199,211,
+    97,213,60,162,80,90,41,17,149,250,142,250,160,173,89,16,11,34,153,164,
+    156,27,146,3,148,81,31,31,168,30,69,224,237,200,133,234,87,176,153,149,
+    35,159,169,75,43,37,185,196,240,77,5,74,125,103,219,224,222,136,118,237,
+    18,118,188,45,5,68,224,98,85,52,174,168,90,24,112,227,6,201,40,86,184,
+    69,236,138,147,13,167,243,233,170,188,47,114,54,176,202,17,71,208,128,
+    158,80,85,197,101,185,128,26,87,46,148,31,242,30,104,113,166,81,177,143,
+    229,94,16,30,195,243,17,162,225,160,114,217,156,205,227,37,162,53,25,237,
+    47,5,98,14,67,137,167,13,191,156,171,18,54,8,199,151,186,240,179,5,128,
+    114,77,57,93,134,84,169,87,93,123,198,170,151,170,136,165,72,78,147,54,
+    144,3,87,105,90,200,74,245,35,182,2,74,83,9,24,151,138,99,233,224,97,36,
+    130,133,234,42,202,144,239,37,37,248,189,25,55,137,60,86,156,153,151,122,
+    181,194,255,42,149,205,77,97,91,82,97,84,116,84,8,117,74,161,186,1,80,
+    54,60,171,79,184,96,157,224,163,27,10,180,73,153,219,198,168,94,142,213,
+    227,173,106,232,50,238,15,185,239,102,153,231,170,44,90,9,237,72,163,229,
+    92,57,34,136,248,188,193,163,241,133,159,195,91,92,197,179,241,237,40,
+    129,109,144,46,31,83,84,155,18,189,144,47,145,59,219,202,84,27,186,208,
+    156,33,178,46,198,69,35,88,134,168,71,216,245,166,110,77,177,190,129,61,
+    248,65,27,96,91,175,194,232,6,77,30,43,117,11,56,57,245,104,92,180,165,
+    27,71,141,157,248,200,37,252,109,128,35,208,157,171,245,99,24,113,21,162,
+    171,31,173,56,142,100,16,74,82,162,176,44,193,77,8,199,177,113,171,222,
+    142,230,38,182,145,232,229,86,250,233,124,166,89,227,124,174,218,27,153,
+    241,82,5,35,62,97,214,171,118,132,42,143,230,205,128,56,45,17,149,35,44,
+    109,224,170,148,68,165,18,197,38,45,213,13,219,168,87,133,245,229,114,
+    51,98,227,40,183,29,235,6,238,182,173,155,121,145,38,203,133,173,126,225,
+    216,114,52,85,77,46,1,95,163,82,223,148,25,115,172,219,85,251,120,193,
+    111,212,107,28,121,82,178,172,152,71,176,185,84,207,214,230,140,27,206,
+    198,173,188,132,136,19,198,241,230,104,42,223,141,13,69,25,21,131,103,
+    234,10,226,91,165,90,166,55,5,135,27,165,41,242,82,78,29,143,102,108,108,
+    208,241,134,217,198,127,199,106,253,98,28,13,116,118,52,171,52,128,96,
+    54,149,139,78,188,197,23,237,49,113,140,89,234,103,43,46,117,113,150,231,
+    13,116,143,86,34,251,178,49,227,200,168,108,226,8,45,215,117,150,189,185,
+    221,54,242,0,88,147,26,140,212,42,223,220,235,151,248,82,17,81,103,13,
+    26,169,243,130,84,98,60,100,72,205,199,184,178,9,55,183,205,57,62,222,
+    234,199,74,84,57,94,8,141,240,15,210,230,96,227,130,248,1,5,161,25,240,
+    21,223,162,99,85,197,68,71,88,49,65,248,2,145,28,42,182,110,178,191,194,
+    163,78,125,64,124,60,26,152,197,70,67,202,197,8,57,221,236,163,172,161,
+    89,20,27,4,103,181,46,171,150,19,171,130,66,177,242,249,188,185,81,121,
+    229,88,185,128,55,7,160,165,248,92,181,224,194,174,214,163,203,102,99,
+    98,170,227,177,170,239,17,55,195,140,171,27,84,84,15,55,85,46,168,108,
+    142,149,141,121,217,176,253,196,103,139,160,11,145,226,198,56,111,54,23,
+    254,196,159,117,201,222,4,82,220,80,141,162,13,202,86,168,163,111,148,
+    29,71,230,5,117,194,7,198,220,152,70,21,183,223,208,56,10,219,28,143,60,
+    116,179,42,108,28,6,136,105,80,86,64,207,216,132,231,40,58,71,85,235,98,
+    26,183,11,38,178,68,147,244,122,190,152,146,90,181,202,25,145,54,113,205,
+    182,205,5,69,86,129,91,45,24,132,153,13,232,17,63,24,27,115,83,141,206,
+    160,93,177,77,227,184,57,26,82,85,12,21,23,164,113,171,42,15,177,67,29,
+    237,96,87,60,95,189,93,226,170,192,185,112,155,17,155,71,184,63,146,74,
+    23,94,171,66,41,239,161,190,184,106,94,100,178,216,10,143,4,166,129,198,
+    170,85,8,64,132,103,242,5,35,128,238,17,55,218,118,253,130,200,226,141,
+    18,71,99,101,131,153,163,72,92,94,168,160,94,63,130,62,188,16,13,216,203,
+    218,108,54,71,11,205,171,46,125,139,35,252,52,89,232,154,84,58,94,172,
+    205,133,106,55,76,42,70,142,77,62,108,148,117,23,240,175,156,163,138,110,
+    36,104,47,23,74,215,126,20,197,213,144,99,76,171,202,229,248,78,116,24,
+    85,101,51,243,229,120,49,44,243,8,133,136,248,118,140,42,17,232,225,31,
+    227,182,185,84,98,120,197,244,54,162,57,146,142,177,81,173,94,12,24,99,
+    35,1,72,228,104,72,151,231,200,56,86,207,60,122,132,135,106,136,250,227,
+    72,58,146,179,67,210,140,208,218,84,201,77,230,237,145,100,60,31,143,71,
+    150,176,27,237,30,171,24,154,114,109,92,126,38,51,143,6,84,196,214,5,100,
+    73,155,13,104,93,32,202,6,227,106,92,197,136,116,122,174,71,100,79,149,
+    120,68,190,216,244,184,169,30,73,130,168,82,17,227,50,187,77,141,134,137,
+    86,143,72,76,121,205,17,220,187,169,34,226,178,110,0,225,177,27,17,189,
+    137,171,151,75,164,7,153,12,60,9,48,90,128,41,167,82,229,105,166,32,76,
+    111,236,232,82,21,51,81,21,117,192,191,62,107,90,225,37,196,200,155,141,
+    177,137,234,86,72,166,0,98,12,195,230,113,179,9,235,0,82,47,29,118,11,
+    13,66,101,67,240,241,168,113,33,142,194,136,79,112,39,9,72,237,85,124,
+    67,113,117,149,123,185,41,226,47,103,194,127,83,13,171,23,253,63,62,182,
+    89,169,10,106,162,197,192,165,85,74,185,16,97,88,129,70,171,81,24,70,23,
+    139,226,48,35,64,161,133,203,81,142,36,106,184,2,252,120,17,25,151,230,
+    52,13,192,172,34,21,108,105,16,26,70,68,112,0,76,185,86,96,104,142,57,
+    222,108,195,48,34,100,172,175,115,23,10,174,84,170,55,224,186,104,47,194,
+    53,103,138,52,206,230,5,213,92,48,25,63,27,232,166,98,0,59,228,69,100,
+    60,74,139,216,100,217,169,248,161,98,24,22,133,192,82,117,99,65,239,166,
+    170,24,143,194,186,101,68,27,2,142,153,12,234,204,73,158,186,152,12,225,
+    91,229,82,181,45,102,96,28,110,32,216,160,229,170,105,144,139,134,22,146,
+    11,36,83,48,241,83,37,148,194,106,5,185,197,0,194,221,71,162,207,172,134,
+    103,156,72,83,36,54,155,24,179,6,13,51,74,64,128,193,203,228,55,24,124,
+    212,195,124,33,161,153,39,213,136,107,105,254,124,41,227,199,14,137,222,
+    13,118,188,72,125,192,37,215,227,50,8,51,142,145,21,133,166,17,110,232,
+    170,190,33,173,143,36,33,51,152,76,17,173,28,96,92,16,61,145,77,83,34,
+    54,34,210,184,139,240,2,0,28,109,111,88,235,100,168,88,222,190,68,6,92,
+    158,233,95,156,84,47,55,206,98,206,86,170,27,158,195,101,33,4,147,138,
+    155,11,115,156,15,88,184,244,108,73,162,248,254,66,205,204,200,170,113,
+    225,44,234,184,0,206,197,186,92,0,151,69,176,26,33,68,40,12,85,20,29,232,
+    85,126,48,254,84,113,94,133,145,13,51,12,101,158,49,67,252,12,204,151,
+    152,81,195,93,33,47,30,137,90,150,44,131,134,113,251,241,82,141,136,51,
+    176,224,83,6,194,165,55,250,135,80,188,75,36,128,17,235,8,5,64,255,230,
+    184,177,232,226,172,135,66,58,87,170,65,112,180,169,28,45,38,39,56,177,
+    103,242,161,139,34,133,46,96,143,195,110,85,171,124,22,25,225,17,212,141,
+    193,73,80,164,86,217,72,47,200,147,38,16,15,101,227,235,40,70,106,128,
+    117,41,233,185,160,83,100,135,4,128,226,104,32,42,76,187,97,190,221,136,
+    16,45,14,148,175,79,50,127,229,161,35,227,135,231,25,235,76,9,94,49,66,
+    3,227,95,248,19,196,76,244,73,80,113,30,19,217,184,209,123,69,86,171,111,
+    80,19,62,136,42,177,141,240,152,47,54,153,66,246,179,5,209,235,197,66,
+    145,81,121,13,155,7,205,2,245,153,177,12,227,231,72,37,68,224,102,48,228,
+    113,131,161,151,72,50,208,35,52,196,79,68,122,92,142,37,0,27,34,253,104,
+    137,69,131,236,136,165,82,178,138,209,85,37,171,170,33,183,149,61,87,74,
+    47,29,203,167,108,11,4,128,150,132,138,74,182,216,206,0,78,249,128,201,
+    161,116,131,184,240,14,178,212,210,5,205,210,26,188,240,137,13,133,29,
+    37,91,208,48,53,224,55,236,215,184,19,117,82,20,209,164,100,50,36,84,148,
+    129,185,67,224,167,76,139,92,220,104,6,84,77,156,3,201,136,6,10,184,212,
+    214,5,186,153,227,171,250,65,19,150,231,56,8,71,83,30,119,218,52,102,215,
+    21,19,200,8,113,48,179,40,84,198,96,184,31,17,26,103,170,228,80,0,17,11,
+    122,200,32,129,57,135,56,192,159,242,190,144,185,84,77,12,65,130,24,84,
+    92,149,74,54,132,161,97,3,149,109,86,207,81,104,225,120,208,146,39,12,
+    157,11,116,101,74,224,58,160,58,2,175,80,53,148,253,156,98,210,54,5,43,
+    117,112,223,70,136,24,177,66,115,19,163,40,246,142,234,241,196,39,45,90,
+    217,40,137,142,27,160,151,110,225,133,75,116,58,235,172,252,119,145,111,
+    104,234,168,107,65,68,176,129,132,220,184,225,102,33,112,97,12,179,34,
+    43,22,143,199,173,14,131,75,218,16,206,116,106,172,200,95,184,177,80,186,
+    56,128,57,204,100,168,73,92,162,222,249,161,196,152,171,201,27,144,172,
+    90,216,67,213,135,252,101,92,86,124,129,216,172,208,123,85,123,47,135,
+    109,44,34,101,35,239,42,164,98,9,82,238,132,143,141,140,38,69,217,128,
+    19,69,85,133,186,104,190,92,26,85,149,8,76,212,106,3,34,219,104,245,114,
+    146,160,0,140,152,136,180,150,94,202,131,121,220,218,2,161,101,108,182,
+    212,170,253,69,220,83,23,48,83,98,88,61,233,5,181,34,237,70,106,242,178,
+    97,106,85,47,165,132,164,249,139,82,30,53,54,136,10,152,141,87,86,245,
+    239,236,71,90,26,119,92,90,149,1,208,18,213,135,74,72,227,20,93,202,174,
+    37,226,11,219,23,111,194,238,106,99,171,37,162,68,68,93,54,91,10,63,113,
+    13,178,182,142,171,114,146,28,79,71,65,123,57,157,46,219,234,214,104,80,
+    127,164,252,38,134,79,220,102,93,74,174,67,195,110,156,208,191,45,202,
+    87,140,132,40,60,26,13,180,121,57,54,64,106,75,231,124,90,137,121,89,153,
+    148,118,108,144,28,171,6,47,243,237,47,146,116,136,23,73,221,216,88,213,
+    242,112,120,148,39,217,138,145,36,43,37,221,35,12,166,49,93,85,27,18,171,
+    88,161,102,94,57,73,88,219,141,209,216,42,10,217,219,4,75,117,37,32,182,
+    199,170,101,241,97,165,177,16,4,165,144,3,79,188,175,132,88,197,141,234,
+    113,117,180,41,204,150,186,47,208,182,149,76,12,41,230,114,217,50,213,
+    34,203,216,66,75,180,141,182,106,86,20,26,154,196,56,61,180,79,90,169,
+    46,72,73,177,193,59,199,50,177,170,91,13,40,92,122,108,232,109,220,187,
+    189,156,140,237,201,138,200,33,134,224,150,84,109,92,86,199,227,9,249,
+    73,154,71,117,20,149,202,85,134,80,130,85,213,87,154,170,138,57,138,22,
+    188,18,109,143,167,237,10,119,85,27,145,250,39,249,25,56,140,165,136,193,
+    178,89,93,74,91,110,228,148,191,117,16,190,198,229,244,87,172,209,169,
+    42,133,80,38,31,84,80,109,37,80,138,59,41,81,37,56,40,88,69,199,19,208,
+    147,78,252,209,216,30,27,88,141,170,244,60,0,87,67,19,175,89,167,35,215,
+    111,40,28,1,72,158,100,3,6,184,24,13,173,86,74,189,134,190,66,86,53,121,
+    240,24,144,54,12,209,177,109,156,140,213,9,191,29,217,23,240,66,132,46,
+    26,23,17,33,4,73,136,163,137,186,104,133,41,107,111,141,99,67,122,88,33,
+    151,227,42,106,160,202,205,230,132,193,200,159,211,69,61,161,41,89,137,
+    189,32,58,69,171,149,76,198,179,155,21,21,68,97,99,117,138,78,171,242,
+    231,83,40,56,67,25,140,187,12,37,230,209,94,157,172,45,114,48,16,52,95,
+    232,183,184,241,4,243,232,228,184,82,144,139,191,99,105,8,195,178,88,103,
+    141,176,129,215,80,228,170,161,26,54,240,128,202,69,194,138,242,240,161,
+    184,107,96,144,70,212,128,3,139,10,184,159,4,128,171,211,150,54,128,100,
+    179,105,128,122,2,31,225,246,88,166,216,166,97,53,202,212,175,158,224,
+    90,21,128,228,138,86,26,18,24,226,220,50,225,32,54,212,214,174,221,35,
+    58,73,145,209,170,186,5,225,83,67,249,118,194,18,84,105,55,170,43,198,
+    15,115,71,132,67,23,245,97,199,200,218,32,23,72,33,223,172,85,245,207,
+    234,18,17,24,43,227,180,129,18,254,213,72,128,239,18,87,44,96,69,137,13,
+    186,167,6,115,162,1,50,81,100,113,96,67,199,113,49,74,179,142,91,217,56,
+    186,52,44,6,225,86,26,163,228,45,109,110,183,8,164,97,111,55,167,213,182,
+    145,36,214,10,157,26,34,96,67,255,23,2,211,104,200,123,18,52,118,20,115,
+    234,16,17,82,70,227,15,102,57,49,132,86,141,70,99,133,126,169,44,81,104,
+    160,145,163,108,155,88,22,83,206,56,33,34,228,19,69,167,147,209,64,132,
+    220,173,174,182,91,112,183,182,224,178,106,136,113,11,120,142,68,219,118,
+    21,50,85,232,124,187,218,114,54,68,89,43,196,111,208,154,213,178,90,140,
+    174,234,42,220,110,182,167,109,3,149,158,172,147,130,240,130,185,168,72,
+    238,229,242,198,74,180,95,176,159,84,15,6,172,65,124,178,186,66,69,144,
+    23,158,72,14,67,2,5,20,146,34,42,155,230,189,227,73,235,194,150,150,19,
+    176,57,38,27,33,180,193,77,39,226,178,170,209,42,153,53,142,33,165,95,
+    162,100,27,69,70,34,233,242,162,108,73,74,52,46,9,146,93,37,23,219,58,
+    157,208,191,29,174,182,39,36,158,224,184,99,11,36,183,22,50,193,3,151,
+    68,225,103,27,52,205,117,145,177,34,164,72,71,109,136,171,21,11,82,139,
+    26,171,248,218,160,130,211,246,212,56,17,167,0,127,18,251,24,182,117,170,
+    174,44,228,187,165,242,11,145,79,161,248,62,81,130,50,135,54,216,136,103,
+    142,27,233,120,117,146,181,55,130,118,5,7,161,109,11,103,236,218,176,34,
+    222,163,61,131,83,49,110,43,84,96,156,12,116,72,0,181,170,167,211,17,69,
+    108,146,85,131,35,183,171,214,54,100,2,74,111,91,48,188,172,56,191,97,
+    92,90,76,114,105,239,180,130,159,141,44,96,172,26,216,159,253,67,174,176,
+    182,141,106,146,32,74,128,221,86,87,54,143,37,48,182,161,213,106,99,131,
+    47,26,6,111,159,78,13,165,207,118,149,108,47,43,146,155,104,76,46,91,238,
+    220,178,222,156,170,219,11,24,158,152,71,130,116,197,165,4,144,5,176,91,
+    182,161,200,74,108,43,106,29,21,80,172,30,39,235,194,113,155,173,124,213,
+    194,17,85,49,200,99,48,119,218,34,78,201,236,148,172,46,9,72,182,78,141,
+    85,107,115,220,218,9,48,242,2,111,171,244,109,131,134,146,6,133,17,43,
+    54,137,100,111,18,17,180,90,145,76,13,77,147,198,118,117,194,214,252,129,
+    168,203,87,8,173,228,178,98,10,19,210,64,4,188,173,40,81,224,109,45,232,
+    84,83,224,180,162,23,182,40,78,85,104,49,242,88,59,192,231,180,213,215,
+    93,124,148,72,189,68,221,106,123,76,72,158,35,162,185,172,18,131,26,27,
+    80,105,180,96,52,57,110,87,81,130,57,34,5,4,157,54,140,85,184,10,27,167,
+    150,146,243,210,224,209,45,186,32,143,183,219,173,38,71,148,192,139,157,
+    48,91,141,42,154,105,72,203,4,50,124,33,223,19,255,160,72,82,175,69,194,
+    108,105,152,254,26,43,203,90,109,41,98,181,13,193,143,146,19,5,117,67,
+    43,90,114,57,38,232,57,161,59,156,75,243,200,180,21,109,91,141,68,192,
+    68,124,124,101,163,74,123,187,101,38,111,79,216,7,169,38,219,100,117,108,
+    144,11,73,8,20,219,147,157,48,13,173,134,149,176,5,109,54,9,45,159,90,
+    228,66,3,13,159,148,104,199,70,18,69,73,131,18,183,43,123,155,108,195,
+    173,21,105,116,38,216,186,129,195,89,204,0,1,111,180,184,51,92,33,159,
+    85,35,105,173,18,54,29,4,148,24,91,245,105,200,156,232,183,209,74,52,40,
+    113,34,217,155,224,80,133,125,131,176,107,109,181,49,39,137,221,72,54,
+    81,99,101,35,13,45,54,92,191,130,55,38,115,132,122,248,184,132,97,83,26,
+    37,134,141,100,107,241,153,211,177,21,173,146,198,54,36,155,254,142,238,
+    168,181,17,68,6,31,66,203,200,75,246,4,144,150,68,196,79,216,207,106,80,
+    11,99,148,162,13,164,161,26,90,54,237,158,184,28,94,41,39,137,0,39,73,
+    18,154,69,193,45,126,37,42,184,4,211,177,114,168,142,42,213,208,45,179,
+    148,164,227,69,210,91,136,19,165,60,113,10,67,84,140,156,146,36,108,29,
+    183,141,22,106,181,249,197,214,13,68,187,134,50,116,129,81,136,10,17,248,
+    138,155,100,137,85,85,168,110,201,214,205,73,245,217,184,7,97,224,113,
+    148,128,36,168,106,69,180,224,77,3,166,26,45,16,210,42,124,146,246,200,
+    96,155,80,79,78,76,128,22,95,223,241,171,92,122,146,24,87,36,6,225,70,
+    81,24,103,155,156,90,9,109,18,65,108,143,39,230,77,139,136,109,109,249,
+    230,180,82,188,133,20,6,239,68,178,240,91,169,33,185,53,217,242,177,198,
+    81,55,36,156,208,58,90,252,218,106,72,33,198,9,206,171,28,130,34,91,22,
+    169,159,240,10,133,19,22,150,101,180,152,41,106,130,195,209,16,18,69,155,
+    122,19,80,146,19,101,69,96,179,106,160,123,253,182,197,55,39,102,10,127,
+    39,137,108,128,120,4,84,11,120,182,140,135,45,134,82,209,100,170,196,108,
+    43,177,44,118,21,228,200,38,5,31,73,66,82,226,47,10,128,94,232,76,200,
+    101,122,63,53,148,12,39,72,108,37,116,181,226,186,70,43,228,69,250,180,
+    224,133,193,195,31,252,94,254,149,88,26,19,220,138,233,185,231,216,176,
+    225,4,224,16,146,181,74,128,15,53,74,102,22,183,112,60,154,167,118,198,
+    52,104,108,90,45,129,6,26,122,99,219,34,132,194,164,5,118,218,110,56,132,
+    175,138,28,139,11,41,142,17,0,154,120,163,101,149,171,241,138,64,68,216,
+    60,3,244,180,206,17,104,149,116,32,107,37,201,176,101,33,86,17,124,74,
+    90,226,106,213,210,3,0,201,107,144,133,68,184,129,13,224,164,244,56,17,
+    83,54,171,18,126,195,72,72,207,34,158,26,2,97,197,239,229,65,168,137,39,
+    37,64,253,34,150,182,219,150,189,93,237,91,154,116,104,188,68,133,220,
+    81,66,109,149,109,73,186,37,102,68,9,23,134,41,100,175,164,158,85,178,
+    166,63,20,9,81,168,181,33,126,152,47,68,155,140,82,94,155,132,22,199,175,
+    67,145,201,181,74,61,201,185,177,37,128,44,241,141,60,233,5,179,168,85,
+    50,179,84,104,67,108,149,13,217,165,180,249,52,174,129,113,130,31,171,
+    66,85,180,77,246,154,43,156,114,66,111,112,68,217,122,19,202,48,150,149,
+    236,87,2,75,222,14,19,253,211,84,241,127,33,76,78,242,164,74,109,80,14,
+    84,38,145,29,33,88,248,77,244,77,131,170,147,9,231,53,108,186,36,124,37,
+    111,96,95,39,210,55,191,11,59,33,65,127,118,75,130,220,218,171,20,12,121,
+    147,95,183,123,129,56,129,124,140,98,137,54,194,6,60,147,180,73,236,52,
+    19,142,65,160,39,150,128,104,141,31,133,89,203,198,169,60,209,218,34,163,
+    83,243,180,15,75,46,211,21,20,144,196,216,50,21,186,147,253,234,52,73,
+    78,77,70,164,21,170,99,105,149,118,180,192,201,230,72,137,27,255,172,74,
+    49,129,23,48,129,215,90,44,235,79,193,219,106,133,210,85,100,115,234,74,
+    250,61,77,82,249,104,127,162,188,198,126,223,92,71,22,118,99,164,211,22,
+    131,7,58,228,153,125,210,220,159,224,200,130,8,244,130,240,116,254,74,
+    110,148,138,38,156,147,164,8,161,181,62,77,78,233,118,187,214,250,179,
+    85,2,110,147,245,105,189,101,10,38,0,63,97,26,108,73,16,62,10,88,118,3,
+    85,36,123,74,71,190,235,83,67,97,153,40,64,65,139,219,247,136,0,93,41,
+    154,162,210,17,210,1,132,40,50,120,31,18,148,69,208,180,69,8,145,228,220,
+    44,77,74,114,236,79,165,110,109,112,216,55,86,147,150,32,70,207,219,36,
+    109,164,214,164,73,92,176,204,53,132,189,116,98,55,154,246,68,242,5,38,
+    133,0,123,198,158,211,232,1,202,27,141,9,60,166,208,176,110,200,225,100,
+    77,138,197,214,91,244,180,111,76,64,79,246,129,208,245,74,38,57,157,214,
+    81,153,112,73,148,238,163,137,21,90,19,128,83,8,64,196,105,109,159,96,
+    183,209,88,67,234,105,18,77,200,227,147,218,88,111,39,73,178,111,1,85,
+    130,88,79,107,224,101,165,106,69,41,95,134,56,8,204,155,235,112,15,65,
+    152,112,203,231,210,213,36,45,17,56,133,160,200,55,160,100,162,172,132,
+    253,9,92,34,96,36,211,106,210,122,196,167,39,77,234,67,234,173,116,221,
+    154,224,143,52,93,237,37,81,208,76,53,182,155,107,250,105,238,155,196,
+    74,50,193,3,105,170,116,157,172,215,4,92,171,149,158,246,28,73,251,12,
+    2,107,79,127,73,19,54,214,105,99,15,133,123,197,251,22,60,120,119,189,
+    213,244,111,128,39,213,54,162,176,137,64,87,235,38,217,21,38,77,91,15,
+    194,140,205,170,162,175,157,147,100,61,105,174,155,141,50,229,90,173,102,
+    75,38,183,116,168,189,94,203,210,8,118,191,218,166,173,48,69,171,210,184,
+    248,156,180,146,86,35,109,53,193,170,177,159,236,183,77,204,214,76,236,
+    85,107,189,231,173,237,36,213,65,235,245,132,248,57,173,87,169,101,237,
+    155,167,214,186,181,183,192,123,66,49,39,164,78,170,149,130,100,253,137,
+    214,141,164,153,72,118,24,109,109,33,184,53,122,214,227,188,206,229,205,
+    83,212,180,83,205,160,214,169,185,85,246,195,165,8,218,54,82,241,220,154,
+    144,29,250,109,27,54,38,92,68,153,107,217,36,106,173,87,147,61,156,79,
+    246,77,182,136,73,202,69,251,164,149,210,8,52,131,214,42,82,106,52,112,
+    214,169,156,158,200,168,121,42,99,86,243,101,178,39,2,181,61,32,152,73,
+    171,185,102,57,78,38,132,157,160,196,112,219,9,184,53,155,17,194,35,156,
+    38,73,10,226,167,198,30,235,243,243,22,54,211,137,120,217,239,201,11,69,
+    246,158,171,200,202,53,48,67,15,137,195,180,75,202,179,112,225,73,26,104,
+    2,28,155,210,164,217,154,76,40,53,165,245,211,62,77,215,26,61,88,121,223,
+    156,132,167,125,67,250,128,20,33,188,90,175,91,141,253,58,74,249,38,65,
+    59,118,146,90,73,136,161,246,144,163,69,8,187,236,35,124,150,90,251,201,
+    100,191,78,154,150,184,95,77,88,74,246,205,102,202,241,164,24,15,113,0,
+    67,177,133,224,224,110,159,236,211,147,221,108,133,244,193,108,0,234,38,
+    248,174,37,165,61,158,64,63,12,190,61,57,193,213,12,170,116,187,255,147,
+    174,177,23,231,96,135,253,90,91,6,31,87,168,147,3,77,171,73,144,115,213,
+    122,207,238,73,208,194,41,96,169,52,221,182,78,81,51,148,182,240,239,154,
+    110,210,61,106,215,240,106,128,56,9,6,56,251,116,143,8,211,147,213,180,
+    247,19,229,5,33,12,95,84,10,51,41,226,224,22,43,141,52,247,246,138,236,
+    73,107,178,222,219,123,108,22,98,35,76,45,161,42,82,104,50,157,104,112,
+    105,181,96,144,0,204,30,120,34,9,28,192,247,202,207,52,34,14,180,163,108,
+    169,36,229,6,116,115,178,145,100,107,245,199,166,138,40,13,215,39,242,
+    100,111,77,182,97,11,18,147,116,111,147,85,73,58,57,201,254,248,20,211,
+    236,183,22,6,2,109,150,136,53,115,102,173,132,195,193,107,178,37,221,79,
+    180,184,254,153,144,38,219,132,103,211,181,242,132,9,141,60,183,32,154,
+    76,210,102,68,23,173,38,249,179,183,216,207,237,109,115,187,110,34,97,
+    20,203,118,70,106,78,246,123,232,76,232,146,228,90,83,171,30,64,42,91,
+    240,72,91,171,73,3,9,145,30,186,17,37,41,102,210,45,253,35,167,100,194,
+    170,199,99,100,47,191,224,196,9,52,209,22,241,68,167,162,76,12,67,22,130,
+    183,162,73,211,94,79,72,87,123,146,114,44,255,241,11,4,54,172,189,148,
+    130,231,246,233,100,130,103,81,46,74,155,144,107,77,197,49,182,179,154,
+    114,245,54,141,246,251,84,61,171,3,254,70,69,73,200,148,210,4,69,175,12,
+    225,102,115,59,225,98,68,207,8,79,39,18,15,159,166,193,116,205,202,194,
+    88,224,125,118,143,38,114,193,163,105,171,133,245,225,40,106,158,194,166,
+    228,184,221,135,252,204,171,107,98,21,253,99,80,22,30,98,19,43,167,171,
+    21,37,183,136,14,107,141,250,41,21,139,163,125,232,216,55,225,187,137,
+    0,200,82,112,208,50,129,113,210,137,221,20,34,100,61,249,30,242,33,66,
+    136,48,98,98,90,169,197,38,65,224,145,255,212,205,201,123,214,184,180,
+    156,214,77,2,144,86,176,40,0,241,12,154,3,121,171,145,166,106,131,127,
+    83,176,208,59,12,146,4,232,144,180,245,135,47,129,77,36,216,164,122,196,
+    206,64,32,160,182,220,46,151,135,173,4,87,165,224,223,194,186,36,73,210,
+    218,79,66,129,162,83,224,152,98,180,9,36,251,50,192,19,62,210,36,140,40,
+    147,246,121,59,217,91,200,164,21,78,38,147,19,72,0,193,106,111,129,43,
+    43,157,164,138,19,246,36,130,190,89,136,88,62,182,222,159,74,217,165,200,
+    104,125,106,166,128,158,174,57,149,38,197,31,209,176,103,47,2,40,36,79,
+    1,248,134,9,197,100,98,96,174,145,4,199,181,36,161,116,109,161,19,44,201,
+    36,194,35,100,26,102,73,44,2,100,141,221,90,160,62,89,19,142,168,23,16,
+    245,251,132,191,101,113,254,152,172,96,163,69,206,112,43,168,162,253,245,
+    170,185,166,247,144,96,0,33,94,194,33,220,31,50,80,83,38,90,67,96,96,171,
+    253,62,68,175,73,132,182,163,84,40,18,83,250,147,227,0,38,33,56,210,84,
+    64,160,66,230,16,32,54,203,143,137,42,187,73,83,236,127,13,46,162,101,
+    50,17,19,17,77,12,93,233,158,188,224,149,245,218,38,5,113,55,42,167,94,
+    16,91,19,184,212,67,53,76,32,101,239,68,125,33,3,198,14,100,224,28,89,
+    212,210,135,195,136,104,81,146,209,19,109,178,74,72,62,220,135,246,216,
+    239,26,45,58,100,101,153,200,62,156,223,12,105,103,178,226,8,14,100,1,
+    9,201,46,184,221,106,36,172,169,129,80,220,75,163,244,215,74,217,117,152,
+    81,205,73,153,7,156,202,117,202,129,63,77,43,106,202,190,32,192,247,2,
+    85,204,241,101,176,72,185,226,179,201,67,252,91,94,78,110,55,25,161,16,
+    77,167,188,33,47,55,177,25,134,225,120,46,151,130,215,233,254,4,106,214,
+    73,61,89,204,52,48,45,111,211,161,0,27,177,82,227,175,242,163,123,221,
+    61,89,71,122,219,66,91,76,253,137,2,74,165,11,30,250,40,119,160,132,92,
+    36,242,155,138,178,144,52,231,106,73,147,190,155,132,221,190,4,106,66,
+    60,211,66,115,149,50,81,24,49,212,199,4,143,80,56,120,192,221,190,44,16,
+    71,144,8,100,133,134,197,154,154,180,134,48,107,210,191,66,67,67,250,101,
+    146,150,114,227,103,182,9,61,197,216,131,52,139,209,184,183,217,211,128,
+    131,83,37,100,230,165,205,143,105,72,107,104,171,116,157,112,32,44,208,
+    242,132,96,151,24,195,72,242,224,54,176,96,30,83,44,197,68,165,166,215,
+    226,2,56,19,121,191,85,66,72,52,81,199,68,17,202,173,19,82,43,37,16,75,
+    59,115,26,160,178,78,160,95,125,70,237,64,56,105,74,123,62,212,217,123,
+    125,15,106,137,32,178,150,196,167,121,27,119,226,197,166,207,20,0,238,
+    125,203,71,227,33,251,197,62,157,10,7,180,173,111,17,240,77,24,112,1,90,
+    240,35,137,25,42,201,28,46,144,193,201,191,104,207,244,38,180,84,114,73,
+    166,180,150,232,49,34,130,192,229,125,170,167,40,42,74,214,65,171,84,200,
+    126,77,211,180,140,187,153,105,190,208,68,250,169,68,58,21,121,107,191,
+    236,138,87,17,31,104,64,7,5,75,21,68,4,163,175,148,79,154,30,246,73,122,
+    40,175,99,119,193,183,116,183,22,222,137,173,183,149,249,173,212,79,74,
+    161,42,116,108,106,39,247,120,61,148,42,80,43,55,66,72,11,201,33,197,144,
+    250,214,107,159,178,21,94,4,59,226,34,179,38,1,10,44,215,92,190,61,165,
+    188,0,77,136,200,167,96,122,57,72,151,220,174,45,41,69,169,28,168,228,
+    72,247,165,24,167,137,118,39,246,11,38,27,35,32,149,166,36,32,186,42,95,
+    179,154,173,104,77,23,148,14,92,101,53,135,131,246,138,117,168,161,215,
+    44,55,79,176,15,232,39,4,156,181,20,24,225,135,189,90,226,75,222,100,237,
+    83,77,234,71,209,148,141,59,241,1,197,7,52,63,141,130,125,116,72,82,27,
+    173,7,226,197,74,21,10,252,47,89,135,250,157,59,163,41,18,216,167,7,100,
+    28,48,53,128,51,85,106,52,65,16,90,24,41,160,103,201,253,147,52,240,215,
+    173,32,109,149,18,3,56,107,239,203,246,19,249,28,149,208,148,190,20,39,
+    37,83,169,146,52,241,69,98,51,10,90,211,36,96,24,241,251,94,142,11,20,
+    144,40,133,175,72,90,23,45,95,239,76,180,7,33,52,13,85,170,60,164,200,
+    139,99,112,113,112,248,75,17,163,204,78,32,178,57,45,153,77,4,177,36,151,
+    90,83,180,174,44,106,149,218,193,71,200,159,95,131,100,127,72,14,162,9,
+    8,163,169,6,161,191,110,114,91,58,57,4,242,168,36,8,171,126,170,33,173,
+    68,182,15,107,109,35,41,98,244,247,202,230,244,16,249,150,170,135,23,37,
+    16,101,91,1,106,211,247,170,137,36,45,188,74,131,18,69,77,222,224,225,
+    67,115,125,224,22,104,146,130,80,223,4,66,164,103,210,161,137,24,196,14,
+    129,108,17,97,137,239,167,165,199,155,65,83,2,56,40,146,64,185,140,176,
+    96,191,247,211,169,31,236,155,65,210,10,246,65,75,102,153,4,209,20,108,
+    210,67,210,244,45,201,93,193,137,135,172,117,114,0,97,153,61,240,167,22,
+    35,160,21,4,224,203,75,168,127,47,74,67,255,144,6,164,136,223,84,35,90,
+    104,39,233,31,187,244,127,20,42,120,89,98,215,80,17,28,14,40,28,209,30,
+    208,97,170,197,62,69,61,135,131,18,31,232,248,144,2,34,136,210,192,162,
+    143,253,100,218,108,5,74,18,206,76,215,83,205,20,69,198,218,103,125,227,
+    1,114,246,160,165,32,209,137,235,105,26,172,3,190,108,181,228,140,105,
+    234,91,19,16,40,213,192,253,218,13,8,229,212,46,11,230,8,90,6,200,240,
+    16,145,175,211,169,54,24,68,197,229,135,253,36,96,254,250,251,169,226,
+    90,224,35,250,228,15,194,110,181,194,181,246,120,184,106,162,62,144,14,
+    172,3,132,165,254,148,144,75,131,3,205,176,35,250,107,160,246,169,144,
+    249,196,27,235,96,146,248,150,10,183,3,154,209,94,164,193,1,2,123,255,
+    160,133,2,3,166,209,1,31,80,0,45,33,113,171,92,4,246,127,19,47,16,191,
+    254,228,64,47,10,37,140,31,240,29,27,179,226,88,198,88,58,241,147,96,127,
+    96,160,32,135,201,97,218,10,196,9,1,139,201,14,211,244,48,13,144,66,112,
+    160,153,67,235,48,137,192,77,219,151,191,39,187,41,151,239,168,169,165,
+    77,132,62,246,1,101,19,197,90,68,153,149,135,73,224,31,124,242,196,79,
+    229,17,159,251,14,135,245,159,41,144,242,14,80,35,160,0,161,180,64,177,
+    25,176,52,19,90,9,247,250,202,47,40,158,200,179,107,246,1,63,72,65,185,
+    149,80,141,70,31,120,180,180,14,166,178,228,20,55,50,179,80,71,32,168,
+    80,176,47,3,55,19,60,68,127,81,116,104,78,25,3,216,88,116,226,115,63,226,
+    198,195,250,192,168,154,78,214,135,181,197,117,76,59,8,15,40,130,168,33,
+    138,88,73,155,244,219,154,54,173,128,36,67,228,44,120,20,47,64,195,61,
+    120,114,227,193,138,14,83,31,176,228,49,46,104,114,91,10,93,34,62,45,215,
+    187,189,146,131,36,82,216,49,186,108,102,177,102,94,203,63,160,173,201,
+    62,16,16,196,191,223,244,101,212,38,245,19,93,137,168,14,80,31,53,66,2,
+    24,105,174,249,192,27,5,148,23,252,153,238,173,169,207,187,192,177,22,
+    196,124,29,59,36,145,143,98,2,173,72,58,37,88,195,159,190,145,29,16,78,
+    18,40,132,73,26,40,104,30,8,159,131,102,164,191,14,155,90,178,166,220,
+    140,31,15,128,129,192,8,6,142,57,48,64,130,105,132,27,154,211,128,185,
+    48,197,138,120,168,69,220,176,137,180,166,190,181,150,7,149,77,188,173,
+    204,77,121,140,14,52,180,97,143,134,80,51,114,155,70,1,80,107,53,195,159,
+    254,116,106,105,210,3,141,111,241,54,200,83,109,4,91,186,54,13,90,208,
+    229,51,122,113,211,52,57,136,16,70,46,186,180,14,126,32,8,117,165,22,16,
+    114,7,229,39,129,116,141,30,154,164,31,114,71,223,62,131,106,239,7,33,
+    26,180,14,232,243,176,63,52,217,121,128,99,207,231,16,28,185,38,132,14,
+    193,20,36,121,159,202,214,120,98,178,159,78,117,203,84,22,23,115,120,196,
+    246,101,187,116,26,38,190,252,169,109,130,34,40,48,225,84,120,213,244,
+    56,224,9,188,163,0,8,80,50,214,167,73,12,201,93,88,156,142,210,105,148,
+    78,193,49,32,138,154,211,9,49,201,106,188,214,139,50,80,164,253,144,235,
+    124,223,98,178,113,139,111,7,172,147,124,80,250,62,28,244,197,211,90,79,
+    167,154,133,211,166,216,75,215,144,147,138,4,66,81,144,35,0,6,70,164,249,
+    11,153,19,180,170,223,200,18,254,162,124,166,110,24,78,5,245,1,17,1,229,
+    31,90,72,64,97,170,209,8,9,135,73,249,53,66,59,200,52,156,130,19,132,128,
+    36,77,64,34,89,140,3,2,95,199,160,84,144,74,66,90,15,20,83,45,201,140,
+    210,146,100,26,164,235,64,107,253,129,92,135,101,78,255,19,36,76,1,141,
+    33,25,255,192,228,72,75,48,104,138,154,185,154,112,13,24,186,22,80,217,
+    129,13,13,147,41,233,148,250,84,3,75,72,14,129,200,160,123,191,21,49,37,
+    67,206,68,231,7,31,107,51,89,120,214,63,48,61,176,7,160,4,60,201,87,133,
+    200,159,48,200,83,197,13,67,43,96,104,82,34,149,5,135,128,223,249,42,15,
+    14,190,31,30,146,242,171,134,79,211,211,125,139,163,144,81,57,221,164,
+    6,33,106,107,44,193,197,20,93,183,200,150,22,64,6,190,143,93,208,104,19,
+    206,21,34,83,203,7,144,72,255,79,160,16,215,226,3,165,81,160,217,148,96,
+    194,41,65,193,24,99,176,28,132,102,68,180,33,57,236,104,131,232,65,83,
+    88,82,20,54,45,100,174,196,102,166,29,166,66,37,228,229,166,63,61,8,7,
+    144,3,56,95,79,104,168,178,235,73,36,200,14,14,14,37,73,40,142,79,243,
+    26,181,89,127,247,42,248,244,145,23,182,67,103,45,206,208,98,53,13,137,
+    54,24,165,151,41,29,162,2,192,35,111,2,13,83,194,164,73,24,202,81,156,
+    3,241,96,216,60,76,225,106,202,234,66,245,235,137,224,14,48,143,208,212,
+    124,12,166,83,232,96,123,65,140,170,135,140,1,0,104,137,112,53,230,228,
+    77,198,63,125,216,232,127,26,145,47,252,237,51,161,194,100,42,133,80,134,
+    138,4,104,92,139,20,108,126,225,32,31,20,24,49,244,131,22,249,65,227,144,
+    165,169,165,8,73,44,181,10,221,7,102,122,128,234,167,248,144,213,148,66,
+    177,65,100,35,71,122,209,58,205,54,32,137,0,32,81,100,211,80,228,71,22,
+    37,138,156,169,174,8,74,121,83,6,171,11,67,148,159,2,241,226,71,211,100,
+    170,136,8,90,37,38,240,131,226,44,200,166,245,192,98,54,65,207,161,164,
+    10,115,6,122,114,26,145,77,26,76,136,13,244,248,13,13,69,83,190,15,35,
+    72,60,0,36,26,65,234,86,56,225,28,254,38,205,208,21,217,236,243,237,48,
+    96,86,112,221,148,125,58,16,27,120,243,16,98,78,21,96,137,100,68,103,255,
+    85,113,80,110,172,9,251,87,160,33,55,17,115,250,138,119,32,107,80,28,68,
+    9,119,95,134,59,4,236,9,210,205,4,18,117,8,173,249,135,80,100,179,98,169,
+    255,64,51,85,28,16,159,135,210,165,44,15,148,75,224,233,92,164,145,42,
+    34,14,82,141,148,193,135,40,223,18,215,172,25,86,83,88,2,230,148,134,66,
+    81,138,97,16,129,52,37,204,84,56,175,233,46,181,14,160,202,202,136,141,
+    71,3,159,51,15,140,67,149,10,207,160,22,200,172,152,173,84,165,205,147,
+    8,38,225,139,1,119,178,92,115,245,148,37,1,66,90,190,63,12,250,207,67,
+    224,6,207,225,244,79,48,236,243,129,105,193,31,238,225,25,248,125,62,24,
+    76,159,133,139,58,167,127,138,98,186,203,169,209,47,60,8,156,78,139,34,
+    240,250,212,81,10,91,207,29,242,224,233,187,135,204,63,244,131,67,33,65,
+    23,253,39,61,121,65,65,209,125,191,239,231,153,223,15,130,221,225,240,
+    244,253,252,224,114,2,31,114,165,161,130,147,252,195,226,169,2,51,81,219,
+    127,250,5,248,247,125,78,157,250,79,223,59,140,193,96,202,227,135,130,
+    143,62,11,97,158,79,159,254,179,223,239,47,124,170,156,202,56,220,71,17,
+    135,241,84,135,244,15,110,31,117,0,184,251,12,138,190,255,124,6,135,62,
+    31,40,220,231,244,137,68,60,223,125,230,252,39,48,15,58,218,63,60,57,152,
+    183,114,202,153,78,251,64,193,233,5,197,5,249,129,27,15,59,117,187,27,
+    6,46,183,21,211,34,15,114,78,203,220,67,158,7,5,61,61,115,78,231,17,14,
+    210,145,79,119,10,144,129,231,242,210,243,144,123,234,174,240,1,141,70,
+    118,0,82,248,32,80,12,189,126,240,228,99,135,224,89,232,49,23,236,248,
+    171,127,200,118,185,239,243,96,63,167,255,231,225,57,228,115,92,207,155,
+    79,218,58,244,119,7,224,13,2,90,227,69,143,70,93,32,113,93,106,226,231,
+    76,16,210,127,49,93,184,46,48,141,119,46,160,229,170,31,178,169,114,247,
+    244,203,120,120,246,225,27,172,149,127,211,161,203,241,94,65,3,180,82,
+    44,64,96,113,224,230,131,159,171,246,210,21,20,129,42,124,223,45,22,207,
+    62,168,142,253,233,144,206,159,207,254,179,239,2,188,74,14,120,68,104,
+    2,30,152,211,237,52,167,67,206,63,208,214,180,255,204,51,128,58,140,161,
+    63,144,226,116,50,176,7,129,71,161,234,182,239,187,59,49,48,14,124,23,
+    140,158,220,209,223,245,97,65,82,2,163,126,41,140,67,48,14,220,103,127,
+    65,159,20,143,230,166,197,115,136,148,166,69,191,200,199,227,233,238,89,
+    30,157,23,212,178,32,54,251,59,180,54,62,236,144,214,115,7,161,136,58,
+    232,23,153,4,233,61,5,169,143,202,0,218,23,94,160,145,203,234,212,204,
+    25,79,23,128,224,78,18,148,202,158,89,145,31,68,202,130,255,225,142,64,
+    31,164,97,151,210,166,62,40,143,131,233,14,14,159,124,70,142,237,187,64,
+    138,168,60,68,148,249,222,83,135,184,59,94,130,188,241,208,239,143,179,
+    167,220,134,3,64,174,40,107,112,253,156,43,158,135,157,143,232,198,144,
+    135,176,166,193,142,59,120,107,183,67,104,125,116,197,191,64,45,121,61,
+    97,20,118,10,215,31,79,159,139,254,244,233,141,115,127,81,60,245,170,143,
+    66,130,49,202,157,30,158,232,225,224,149,96,202,44,207,69,81,170,96,204,
+    27,185,63,166,179,194,155,22,96,216,215,47,16,93,20,8,205,243,229,103,
+    110,151,167,169,22,79,44,118,197,243,233,245,11,226,2,238,48,203,147,166,
+    144,54,21,211,62,172,242,150,43,166,8,4,96,198,34,60,115,232,83,91,112,
+    216,209,228,97,204,39,41,170,143,245,131,188,192,42,248,144,55,1,96,215,
+    215,28,45,22,99,12,253,116,241,193,51,239,247,125,68,38,15,43,123,144,
+    60,26,201,104,111,252,244,60,24,112,15,187,124,87,42,45,43,164,87,62,227,
+    122,227,226,233,33,110,250,34,185,242,221,56,120,46,2,37,213,162,248,227,
+    47,114,191,239,42,17,118,96,60,62,44,130,161,155,103,136,19,88,159,99,
+    53,68,215,65,230,11,18,42,118,199,153,91,120,59,196,58,246,221,49,207,
+    60,125,98,99,184,91,248,197,248,185,112,33,119,58,204,81,251,120,135,167,
+    159,211,157,92,181,43,74,106,4,125,233,90,140,241,116,135,204,249,162,
+    223,247,208,213,162,79,125,220,238,239,148,24,174,139,124,158,224,251,
+    196,219,5,206,45,16,203,148,184,241,199,168,200,67,236,46,160,97,238,254,
+    116,252,28,194,174,180,232,5,99,62,14,98,208,49,29,47,198,187,69,32,163,
+    62,69,171,63,37,19,185,102,252,23,85,153,107,138,226,176,20,140,99,34,
+    248,47,10,37,106,142,165,232,219,165,243,124,33,165,99,250,221,142,243,
+    148,192,100,43,90,32,164,158,232,60,56,44,32,97,55,45,72,18,232,5,113,
+    133,18,183,240,107,49,28,142,185,249,48,246,184,128,84,222,241,23,225,
+    209,231,46,98,10,125,250,56,208,83,38,186,193,110,135,11,115,232,247,135,
+    217,162,56,76,73,86,226,249,48,221,237,128,62,240,158,88,155,40,241,148,
+    193,253,28,76,23,154,159,79,181,218,135,99,66,148,163,149,36,135,221,152,
+    84,123,78,221,140,198,118,232,246,233,74,82,5,114,203,134,50,39,44,66,
+    85,177,123,2,26,69,48,189,24,57,76,40,14,89,20,30,98,29,23,227,133,251,
+    212,184,19,132,48,241,4,109,124,19,44,118,187,254,66,186,64,152,28,249,
+    28,187,4,131,187,24,35,230,5,174,242,118,83,164,45,128,250,46,178,92,20,
+    11,64,36,88,10,20,190,115,81,193,116,71,11,200,139,63,119,99,60,255,92,
+    44,112,28,184,143,167,125,146,97,17,40,46,81,99,127,71,172,228,196,199,
+    97,56,238,255,81,92,50,68,159,79,138,221,145,106,207,221,110,135,129,198,
+    67,30,218,145,105,5,113,158,187,83,175,64,90,67,66,252,73,222,1,192,24,
+    48,136,130,29,252,97,129,114,248,245,115,104,226,249,62,84,238,198,46,
+    23,242,214,216,7,103,127,119,88,48,206,148,230,99,114,122,161,194,252,
+    225,52,24,162,212,33,154,56,112,13,233,241,84,137,146,114,177,32,30,208,
+    201,174,96,244,243,42,83,131,81,187,240,129,14,22,160,122,186,24,35,39,
+    230,208,243,224,45,118,11,136,28,227,146,39,118,220,141,209,218,110,177,
+    0,104,33,83,140,81,126,80,26,95,147,2,132,135,99,240,153,74,33,180,54,
+    166,213,197,115,135,231,120,26,65,46,60,87,69,123,30,89,247,212,96,244,
+    118,249,130,196,234,31,104,157,168,203,208,18,240,32,83,250,232,143,243,
+    233,240,144,79,73,30,68,226,195,199,66,241,88,78,201,113,159,151,97,185,
+    208,184,44,158,98,164,191,203,158,12,24,6,126,46,53,81,132,16,146,86,1,
+    128,237,6,139,163,65,23,234,134,158,139,42,22,207,156,201,201,44,21,126,
+    232,30,225,45,22,108,29,139,29,254,98,6,33,115,102,60,126,30,103,84,136,
+    182,129,128,213,231,73,78,62,221,5,2,103,182,123,4,27,184,186,18,233,98,
+    145,193,116,14,167,174,170,145,99,65,189,95,224,65,160,30,47,8,189,60,
+    67,238,129,191,120,102,100,46,136,144,179,11,224,240,179,93,193,237,125,
+    114,143,219,241,68,63,103,196,193,3,233,142,235,14,194,234,185,200,89,
+    53,134,62,254,224,165,241,130,73,183,152,210,1,198,123,238,48,252,238,
+    153,67,198,120,209,255,211,31,187,249,248,15,164,40,116,3,49,54,61,48,
+    57,169,115,60,86,14,146,150,160,164,46,124,240,17,13,110,174,182,217,22,
+    152,253,216,115,1,148,160,178,24,83,62,236,235,11,7,88,48,46,10,241,176,
+    43,60,26,30,43,97,93,180,48,118,23,44,105,252,77,58,4,99,116,183,16,244,
+    121,161,217,200,139,216,112,231,18,216,11,23,244,92,200,45,208,153,135,
+    162,144,29,77,237,64,114,236,161,146,157,50,80,199,225,190,162,76,89,140,
+    204,65,88,124,71,58,96,91,143,159,61,22,14,160,245,23,232,179,144,143,
+    118,248,3,91,61,115,176,37,2,153,167,135,66,35,104,58,46,224,146,70,60,
+    122,65,174,59,237,7,11,226,244,169,181,152,81,3,24,83,166,72,177,91,228,
+    25,216,130,14,169,195,41,1,233,51,38,81,225,208,35,69,216,4,240,162,2,
+    19,245,46,250,146,241,46,39,95,60,177,194,25,193,194,45,52,197,251,135,
+    133,84,65,82,184,28,208,215,157,153,4,143,57,112,136,47,86,3,134,71,161,
+    196,27,114,162,86,213,60,119,119,28,149,179,117,194,135,151,75,49,236,
+    71,160,48,101,51,80,76,168,1,250,234,251,59,143,36,124,6,67,240,10,24,
+    207,59,253,83,104,78,121,59,200,216,129,20,68,210,179,135,114,198,129,
+    87,176,112,44,50,142,128,218,167,150,32,150,58,214,208,69,14,42,84,125,
+    112,229,227,29,69,178,77,129,8,186,217,161,128,49,214,166,50,119,193,236,
+    246,232,6,189,63,179,133,79,17,99,230,236,2,119,210,5,79,47,20,97,139,
+    221,16,229,194,42,171,140,84,195,91,174,39,25,229,56,14,151,236,232,112,
+    49,164,79,181,62,214,17,40,14,50,209,236,66,200,45,4,152,63,213,172,151,
+    250,168,167,112,201,90,78,228,81,212,112,112,137,10,6,163,199,149,48,10,
+    82,208,192,207,48,130,20,119,76,68,176,243,16,116,145,237,144,80,206,57,
+    180,57,14,192,128,144,193,216,48,59,22,0,132,13,181,176,167,234,113,31,
+    115,21,10,22,202,86,138,210,81,127,200,88,88,104,20,246,249,100,94,134,
+    32,119,73,52,99,215,213,255,24,85,52,69,31,165,248,121,235,153,161,204,
+    66,107,251,223,44,47,20,169,59,190,38,233,85,141,0,106,161,226,133,126,
+    84,118,67,50,73,160,248,113,81,19,161,206,173,79,97,11,226,232,24,3,17,
+    145,4,25,131,241,89,214,140,163,104,136,199,158,11,233,215,221,9,224,254,
+    88,106,192,39,156,239,193,43,239,99,5,97,83,232,211,188,201,66,69,43,11,
+    73,6,49,201,240,79,196,54,206,134,162,89,59,123,206,24,123,150,43,202,
+    66,11,5,110,195,221,133,155,177,50,228,126,145,239,60,50,202,131,8,183,
+    36,132,15,247,251,46,123,21,131,72,187,90,38,224,241,203,66,46,197,163,
+    30,124,19,248,108,74,252,39,180,185,130,54,118,127,188,66,191,128,186,
+    204,51,150,15,115,192,27,11,59,33,175,140,29,107,207,44,145,7,11,16,214,
+    230,169,151,23,57,201,131,8,129,137,83,248,135,88,214,26,208,215,13,158,
+    154,160,248,108,177,115,221,33,209,202,159,26,78,11,228,250,215,167,16,
+    138,134,153,249,99,188,5,25,90,159,40,117,56,102,155,83,13,24,69,217,166,
+    215,199,74,164,114,227,5,8,210,151,24,236,203,141,92,181,64,8,170,151,
+    137,0,126,104,63,135,58,157,206,91,52,253,44,65,207,169,90,36,224,23,13,
+    31,166,5,78,131,61,105,20,118,251,89,191,96,31,97,104,168,40,210,139,210,
+    121,156,153,3,147,18,151,108,235,162,96,4,62,246,94,207,5,35,32,119,23,
+    203,151,139,197,200,37,79,254,146,191,121,170,80,72,2,19,157,114,18,215,
+    80,25,159,5,194,25,3,24,48,184,100,40,231,20,106,41,119,165,211,197,82,
+    128,144,109,153,26,145,4,199,127,29,221,159,253,21,9,21,61,123,99,153,
+    2,184,85,117,161,250,164,180,157,71,205,197,98,200,133,20,203,79,25,143,
+    189,72,210,178,189,190,50,164,40,237,161,25,87,48,118,50,82,110,8,66,179,
+    25,75,36,31,201,69,137,22,133,63,153,70,218,107,92,244,84,154,30,43,220,
+    89,206,179,56,136,54,21,12,79,37,15,188,224,44,169,187,128,208,92,254,
+    163,148,30,137,189,152,201,27,180,199,107,156,157,235,53,141,28,247,181,
+    91,136,52,205,58,40,40,36,105,183,175,12,80,234,45,119,114,134,87,188,
+    150,207,25,164,232,26,46,227,98,73,30,162,112,30,130,128,192,156,181,80,
+    170,247,94,59,92,47,17,45,152,91,165,109,153,166,75,87,215,245,220,210,
+    160,116,173,59,209,32,249,93,6,67,111,220,195,122,207,108,185,152,161,
+    163,157,59,195,95,202,84,30,165,138,210,239,72,109,89,238,183,202,175,
+    66,95,219,122,40,180,52,244,110,252,98,123,89,44,94,99,100,188,40,115,
+    133,226,198,175,157,54,31,28,238,205,150,116,176,44,50,12,36,114,72,201,
+    98,57,155,245,233,156,99,123,74,243,157,140,195,13,204,83,210,53,127,193,
+    9,142,204,41,14,186,250,195,254,76,87,122,139,241,139,142,118,47,22,126,
+    169,92,161,129,4,123,125,217,18,135,60,119,75,198,25,247,22,75,146,23,
+    60,233,27,48,118,252,246,124,45,23,227,94,73,0,109,238,4,200,152,191,122,
+    207,242,249,177,75,227,240,191,155,177,91,104,96,128,199,184,52,33,53,
+    237,128,158,226,56,192,157,245,118,24,22,160,95,136,34,39,213,249,19,47,
+    138,112,40,68,137,228,0,74,20,71,90,31,16,112,225,246,95,217,255,159,118,
+    124,44,167,254,165,202,40,202,197,126,167,176,44,67,164,152,113,62,126,
+    196,61,249,75,238,133,132,69,209,35,218,72,255,217,120,198,16,125,142,
+    123,47,84,190,240,150,47,182,28,4,180,232,245,75,244,123,202,13,126,234,
+    17,19,47,41,113,44,91,236,150,238,115,185,96,207,98,233,203,249,58,13,
+    219,0,196,87,74,206,121,62,103,227,197,210,91,100,203,165,242,66,171,50,
+    193,131,241,228,208,153,146,144,218,80,196,107,185,204,112,244,174,120,
+    1,160,38,221,114,220,135,26,23,27,121,11,79,242,210,55,68,9,160,183,219,
+    13,119,4,217,216,235,21,47,175,20,248,46,195,73,11,113,213,131,253,153,
+    162,164,183,120,185,110,62,235,145,0,156,57,227,193,217,184,55,83,235,
+    101,98,141,203,229,183,63,211,122,234,229,12,225,177,250,232,45,199,184,
+    64,197,23,52,52,211,244,225,219,3,58,193,4,189,236,53,238,105,33,164,187,
+    124,252,90,22,229,60,113,103,238,162,135,73,122,124,17,233,47,81,79,79,
+    234,66,156,79,30,223,245,95,253,165,234,211,87,150,23,81,140,178,158,110,
+    79,95,167,118,61,111,215,67,118,212,67,147,189,39,240,115,201,75,130,151,
+    196,240,207,120,73,160,189,122,124,178,55,6,254,37,186,93,246,220,94,111,
+    198,103,11,13,193,231,236,41,231,66,255,235,149,247,40,190,183,68,188,
+    20,179,123,73,132,179,177,86,46,92,189,220,145,186,79,110,66,15,44,211,
+    25,104,188,198,153,196,38,185,146,51,188,76,226,240,195,236,57,91,190,
+    72,104,68,249,236,17,190,202,17,208,91,192,120,225,114,104,153,203,207,
+    25,249,157,1,245,76,145,223,91,96,195,101,49,219,233,122,54,181,157,231,
+    101,94,142,32,132,15,135,105,175,95,104,173,17,131,110,161,77,64,219,144,
+    134,0,14,236,97,111,117,175,28,90,104,67,230,20,170,69,90,232,85,67,176,
+    199,247,7,84,248,148,77,10,224,95,246,103,212,241,98,125,235,105,170,114,
+    14,242,125,245,64,106,166,157,122,57,158,145,135,84,134,78,151,187,217,
+    112,216,115,245,165,171,87,244,36,236,94,207,149,128,150,46,222,88,246,
+    114,233,107,153,247,150,68,193,12,167,184,57,110,225,44,220,180,124,45,
+    94,220,181,204,92,97,58,115,49,192,152,171,159,47,196,9,26,203,222,171,
+    152,185,72,243,217,67,64,203,87,143,190,129,125,9,120,36,231,172,151,47,
+    251,227,101,70,254,16,203,253,101,79,40,3,108,191,199,14,190,68,196,197,
+    139,251,1,7,243,46,53,180,189,215,140,125,13,202,118,208,148,237,122,192,
+    69,136,73,175,99,237,135,68,83,255,245,4,79,244,178,160,246,87,159,218,
+    118,61,114,129,82,103,75,205,22,192,68,136,76,62,190,95,244,95,8,217,235,
+    189,158,175,151,167,229,146,201,5,166,67,183,112,119,47,28,235,45,9,61,
+    30,123,161,170,30,139,13,74,154,193,75,190,28,46,57,194,27,211,172,162,
+    181,255,130,60,156,176,212,130,137,10,73,216,222,242,245,42,8,133,162,
+    71,254,244,118,61,132,50,166,249,197,18,166,185,227,217,235,189,94,92,
+    213,27,34,157,37,145,203,247,128,165,91,138,226,5,178,61,119,246,146,155,
+    94,104,22,50,150,66,223,29,50,200,137,147,133,71,101,175,165,87,126,237,
+    208,254,130,110,159,98,35,211,255,1,55,91,204,94,108,66,172,139,202,156,
+    158,7,73,216,198,211,96,224,155,227,2,245,80,34,136,98,148,108,151,21,
+    61,184,103,63,125,65,103,127,86,204,8,4,40,150,53,137,61,94,4,48,204,178,
+    164,114,184,203,50,125,167,194,7,185,55,115,135,75,175,231,149,169,231,
+    202,184,176,8,228,46,130,68,224,11,196,179,196,167,175,140,118,80,98,239,
+    181,91,242,79,190,28,67,56,226,219,41,178,95,176,164,255,163,13,104,9,
+    62,214,67,205,192,66,153,62,3,217,93,143,90,112,220,76,254,44,191,152,
+    144,12,192,68,29,248,241,9,222,212,241,98,238,0,34,31,239,151,170,126,
+    105,254,61,179,222,50,135,213,140,203,114,6,31,199,161,153,158,218,234,
+    245,88,88,150,47,201,183,88,50,233,102,226,129,61,182,231,190,136,10,132,
+    170,181,9,14,92,66,253,37,17,47,36,118,119,217,91,122,47,15,121,32,241,
+    29,25,73,36,17,99,144,228,49,118,250,228,156,7,57,156,77,127,0,240,34,
+    247,94,175,33,104,80,218,203,67,40,60,142,165,192,135,26,169,47,39,182,
+    145,13,146,239,17,191,4,249,46,39,162,134,195,153,182,220,89,33,28,11,
+    111,9,16,61,151,14,184,161,151,245,128,196,29,207,64,66,212,239,152,219,
+    203,23,186,233,21,51,186,0,141,229,146,4,229,131,154,63,11,102,81,111,
+    38,45,13,115,89,207,147,156,138,23,167,161,195,215,88,49,77,246,102,174,
+    183,4,11,22,37,22,161,165,155,191,112,102,31,128,32,139,179,32,98,89,48,
+    173,129,216,229,110,108,128,28,88,212,150,58,108,185,244,168,158,237,29,
+    69,47,242,30,200,50,26,185,130,133,190,24,122,106,96,166,252,161,71,157,
+    43,43,200,233,8,3,76,24,109,250,191,64,118,210,14,201,1,199,96,180,152,
+    177,211,49,158,56,199,213,68,90,46,75,43,144,115,46,91,222,146,239,152,
+    46,12,49,98,114,23,162,49,24,20,177,165,192,49,83,107,200,109,47,151,121,
+    79,212,185,175,89,6,127,189,93,25,57,139,158,108,202,96,80,62,242,113,
+    68,177,16,2,232,122,201,88,224,91,7,43,0,11,126,201,140,6,221,114,9,163,
+    185,212,223,147,123,93,21,13,36,197,120,198,59,104,15,30,150,74,130,30,
+    129,89,16,214,46,183,96,45,8,124,209,136,187,120,41,190,102,104,131,76,
+    155,241,33,132,198,10,57,147,248,225,139,169,51,132,79,207,245,36,108,
+    128,87,0,112,47,181,18,203,164,162,187,196,22,51,118,12,137,150,20,92,
+    74,159,51,237,24,212,171,138,48,57,17,233,242,66,190,124,202,83,195,49,
+    213,205,24,203,179,215,16,12,95,158,6,222,56,227,76,16,65,29,133,215,227,
+    118,170,71,96,79,44,73,153,236,143,4,60,104,44,103,244,198,36,167,78,23,
+    223,179,138,232,14,128,133,90,47,159,21,218,22,224,111,54,163,94,214,88,
+    151,74,95,121,193,33,189,66,22,66,221,228,8,29,97,15,188,84,184,75,22,
+    17,0,225,11,16,30,229,171,49,55,208,113,33,73,46,51,54,173,30,156,207,
+    40,237,249,242,242,92,236,190,232,159,47,35,124,90,247,112,46,30,115,169,
+    233,245,28,230,187,28,152,89,35,134,252,206,17,20,54,227,203,246,18,41,
+    21,82,228,75,176,137,157,25,93,80,114,182,163,46,109,23,227,2,169,241,
+    0,223,50,151,106,93,94,228,34,130,98,33,153,243,236,140,172,39,8,102,250,
+    7,104,10,174,204,105,193,45,81,226,104,55,91,8,26,6,54,197,243,251,114,
+    232,138,74,4,194,12,67,120,24,0,121,102,46,142,19,90,84,130,130,113,48,
+    12,230,94,238,102,26,112,64,166,79,187,212,64,74,148,21,202,37,51,37,6,
+    181,48,10,168,92,88,189,74,34,40,84,199,122,138,206,221,18,125,187,72,
+    149,111,219,170,155,55,185,8,193,34,19,125,92,83,35,195,98,156,39,117,
+    44,251,18,36,100,47,121,10,141,45,133,7,82,204,145,5,39,143,243,217,75,
+    125,33,234,153,82,181,212,245,82,97,128,163,184,137,27,102,66,50,115,1,
+    166,124,182,231,161,221,82,110,10,81,217,97,230,101,244,136,240,135,146,
+    234,82,173,44,201,12,87,47,150,200,82,34,189,73,241,8,182,16,221,94,111,
+    8,29,67,42,203,133,173,94,134,20,174,124,233,76,73,67,163,81,59,143,171,
+    12,165,116,206,145,214,95,178,63,138,123,41,146,168,177,144,52,122,122,
+    65,161,131,231,60,49,82,168,142,140,55,41,128,244,32,186,96,21,55,149,
+    101,188,8,84,177,35,89,113,158,206,154,205,104,2,110,84,9,110,229,66,168,
+    66,223,96,248,26,18,101,60,174,93,135,251,188,146,169,151,166,12,133,11,
+    3,192,82,32,231,15,239,245,94,118,150,15,15,104,30,188,32,36,41,27,63,
+    33,243,206,82,128,233,252,172,87,66,10,73,57,159,34,61,103,61,158,44,94,
+    14,133,169,56,87,209,220,203,74,36,33,117,6,240,61,113,51,28,22,234,153,
+    15,145,11,0,135,72,193,106,41,128,60,79,226,215,48,148,215,123,133,227,
+    41,129,122,217,18,111,116,122,115,89,195,85,72,15,65,200,89,230,14,215,
+    187,250,90,183,44,103,11,178,131,174,226,1,226,179,226,45,61,113,164,219,
+    129,1,207,33,66,157,249,95,30,245,53,80,144,229,175,87,71,244,75,110,57,
+    208,59,144,229,240,16,39,246,136,210,71,7,90,120,43,155,19,133,98,34,47,
+    175,166,172,14,248,145,111,15,79,249,160,0,121,104,234,45,69,248,12,130,
+    123,15,62,62,43,233,226,3,47,137,114,206,101,18,42,244,58,143,89,169,72,
+    164,179,156,207,133,94,185,26,73,105,229,220,124,47,223,25,111,13,249,
+    128,188,201,49,111,215,65,91,189,158,227,148,167,190,58,110,199,17,209,
+    82,247,156,164,70,218,239,92,90,70,8,185,36,226,118,122,157,14,207,193,
+    239,195,41,74,36,33,196,245,254,80,109,111,249,224,248,94,7,117,57,15,
+    56,114,231,115,198,231,210,155,13,61,239,209,99,41,238,205,222,208,65,
+    96,0,216,171,151,117,94,115,32,236,80,2,164,252,1,94,190,66,245,30,242,
+    25,17,69,180,61,30,75,174,163,17,45,114,114,113,38,111,151,0,228,188,153,
+    207,69,190,3,253,184,224,225,204,254,174,129,0,4,145,195,89,230,244,28,
+    225,198,109,110,175,51,156,189,50,78,117,30,25,125,253,33,36,65,167,227,
+    8,204,194,237,228,84,151,59,47,245,215,121,204,188,199,114,246,88,62,58,
+    239,94,241,86,200,176,199,229,14,212,60,58,196,106,7,37,61,230,92,90,158,
+    170,196,112,222,60,36,66,152,196,75,199,117,223,179,97,137,31,144,119,
+    56,132,166,244,148,211,123,20,61,167,0,15,29,213,115,193,251,213,27,2,
+    134,211,235,81,74,254,232,205,11,206,99,10,96,142,165,163,236,157,151,
+    49,234,72,117,240,35,75,62,242,165,243,46,168,67,185,38,37,243,46,174,
+    201,136,72,94,16,241,242,153,51,127,61,58,26,10,4,151,219,123,35,176,158,
+    180,207,7,189,34,239,64,60,38,34,131,122,143,185,112,244,136,17,238,155,
+    137,180,57,0,44,81,56,247,32,81,94,115,222,157,50,5,169,119,254,238,73,
+    182,47,234,125,211,110,38,63,16,82,51,207,233,116,10,241,129,60,156,217,
+    187,144,203,220,135,247,32,71,150,78,6,192,32,6,176,48,53,47,150,15,252,
+    247,144,171,224,118,56,231,205,225,195,153,59,242,199,107,200,77,15,55,
+    39,31,114,135,30,136,171,185,2,249,161,47,211,248,196,155,243,58,125,23,
+    143,55,220,188,9,16,217,154,115,151,143,71,167,211,115,58,238,82,134,205,
+    120,25,247,14,181,231,100,40,188,147,207,157,206,235,49,19,150,115,250,
+    125,189,59,143,151,22,207,7,98,234,60,240,14,64,205,139,215,124,54,123,
+    104,100,194,180,38,45,181,204,5,46,33,193,95,20,138,197,243,119,94,128,
+    147,150,180,7,33,8,219,238,163,227,205,148,15,158,88,116,134,142,227,190,
+    58,157,119,166,249,242,158,113,241,251,241,102,253,235,205,161,159,150,
+    28,160,224,99,51,50,68,185,238,117,60,90,167,83,48,93,58,57,132,190,177,
+    21,50,227,192,119,135,143,241,9,174,94,62,40,169,231,73,46,179,183,247,
+    158,103,94,15,117,12,57,219,113,230,88,139,242,201,205,23,161,234,112,
+    143,215,123,67,84,174,53,134,159,104,208,227,144,23,36,57,57,48,12,123,
+    15,164,177,236,253,65,221,143,101,246,238,121,15,44,138,225,72,157,101,
+    39,147,179,31,15,7,120,28,98,140,93,166,147,241,57,103,134,152,220,142,
+    70,16,195,226,69,106,118,100,83,156,188,236,204,28,69,66,47,203,129,195,
+    121,176,122,19,104,164,194,108,137,161,94,115,46,126,119,176,77,62,207,
+    33,254,173,81,11,135,202,27,130,99,62,115,223,238,3,57,244,48,208,163,
+    67,166,114,20,174,239,189,217,234,153,253,4,61,193,147,17,205,57,244,190,
+    138,12,107,189,56,182,195,167,30,52,67,130,128,202,44,119,160,49,159,163,
+    181,199,99,78,175,203,78,190,156,15,135,56,210,65,200,222,28,57,61,164,
+    103,130,2,76,95,143,57,21,188,32,148,78,209,54,56,63,102,14,255,189,157,
+    142,252,208,123,188,103,252,66,182,104,56,190,30,14,234,126,144,115,40,
+    44,159,123,218,146,230,170,202,229,9,82,185,227,185,252,242,128,218,206,
+    156,216,2,68,62,53,123,231,48,208,233,204,31,111,47,235,56,133,220,225,
+    192,216,236,241,144,110,112,207,235,237,100,78,199,235,144,7,142,243,34,
+    16,129,42,43,192,103,230,208,64,105,115,15,86,184,85,218,205,233,104,214,
+    153,207,58,42,166,192,23,29,46,112,184,128,96,120,15,115,84,128,108,59,
+    98,133,64,99,70,8,120,76,225,16,60,252,237,188,179,215,3,49,163,175,30,
+    111,45,37,3,212,54,131,83,4,221,113,0,199,235,204,223,29,20,250,32,36,
+    248,43,71,249,206,204,1,24,168,0,63,77,80,7,255,112,35,128,208,212,114,
+    206,175,249,3,219,137,35,178,240,225,189,245,181,232,205,39,223,84,195,
+    187,156,229,32,11,184,118,28,15,52,52,241,129,252,141,196,30,122,144,47,
+    84,243,236,193,60,103,197,123,104,179,114,188,226,173,103,134,203,14,217,
+    177,124,59,248,254,5,175,239,55,71,231,239,97,71,254,153,43,146,233,63,
+    119,52,157,231,44,6,196,135,28,254,206,115,148,8,115,29,229,104,111,70,
+    139,244,128,102,216,81,4,3,221,112,189,242,137,64,94,206,222,212,71,95,
+    146,2,218,66,225,61,93,178,116,28,190,114,105,27,1,31,121,147,243,222,
+    146,183,238,155,121,115,204,78,233,153,124,247,114,222,15,164,215,89,98,
+    15,52,56,124,35,63,189,236,49,211,52,147,242,226,77,231,56,92,73,241,38,
+    111,60,180,217,201,249,9,196,0,152,141,14,180,16,132,231,228,222,187,51,
+    207,201,143,7,29,230,124,138,235,249,121,232,176,24,204,96,160,131,144,
+    176,37,227,150,227,242,50,48,168,30,195,0,50,167,66,60,20,242,145,71,169,
+    194,30,170,66,150,104,130,65,231,96,188,151,8,103,244,32,107,18,170,227,
+    17,158,8,19,192,222,80,137,51,156,229,27,202,184,61,67,60,98,151,251,200,
+    159,140,26,230,111,66,2,105,190,51,41,13,188,29,54,114,29,204,140,71,163,
+    80,196,103,121,152,218,232,227,205,139,34,190,147,97,37,92,73,133,104,
+    16,246,17,74,239,253,6,56,20,138,168,149,95,101,158,82,150,231,232,71,
+    40,160,133,247,223,120,96,28,193,56,77,57,218,95,208,163,135,144,249,176,
+    28,232,229,92,56,123,204,25,25,136,146,44,67,182,84,12,180,249,252,15,
+    197,243,212,107,142,45,230,26,119,14,99,254,141,203,216,185,137,98,167,
+    244,143,100,78,47,115,71,42,37,43,72,186,206,125,73,45,148,145,191,165,
+    248,12,56,24,93,25,90,204,21,44,92,132,46,32,30,116,212,106,166,3,96,5,
+    125,171,254,217,50,235,176,18,67,172,243,24,234,109,135,227,112,133,212,
+    74,14,106,189,120,207,115,132,70,239,18,13,74,33,77,129,150,8,70,24,206,
+    157,121,234,117,134,196,13,4,18,211,132,104,199,27,210,231,92,225,244,
+    144,254,222,179,108,176,36,68,59,29,46,128,121,174,5,100,224,30,130,251,
+    144,125,185,156,3,57,130,159,131,220,155,90,73,53,240,202,37,174,249,188,
+    227,241,1,158,122,56,165,30,120,135,238,59,111,106,83,140,117,20,48,188,
+    195,153,119,16,135,195,185,172,112,167,240,206,156,162,233,155,198,222,
+    142,199,202,158,147,210,119,162,135,207,114,32,39,191,36,51,110,161,82,
+    7,145,163,194,236,254,6,213,151,122,28,204,161,126,40,221,210,2,237,96,
+    52,26,69,176,12,41,5,27,21,188,144,146,71,63,196,1,165,62,156,59,178,134,
+    236,204,225,200,57,35,6,133,58,15,205,213,124,64,203,216,137,241,118,231,
+    20,184,100,154,161,226,78,233,42,80,165,137,142,84,68,18,240,205,151,172,
+    184,195,254,123,62,203,64,144,191,225,7,59,14,49,72,39,31,96,102,52,194,
+    61,148,197,143,239,225,29,204,73,120,142,155,235,102,122,224,93,128,82,
+    248,242,144,195,56,245,58,157,193,146,150,133,63,29,83,139,72,144,78,59,
+    25,29,191,203,100,234,160,0,33,67,7,210,149,186,164,33,121,68,16,97,199,
+    142,182,129,183,94,231,151,151,240,201,30,158,4,220,25,56,2,68,202,189,
+    119,148,141,165,18,177,166,227,252,241,196,27,111,15,232,142,11,240,210,
+    124,216,241,238,101,176,98,70,77,153,210,66,148,57,155,207,49,55,255,18,
+    81,234,145,186,121,165,147,231,122,29,189,191,213,10,89,3,98,158,196,78,
+    194,241,75,150,11,64,169,38,87,5,170,82,91,71,71,62,112,144,114,73,56,
+    206,201,160,132,39,231,217,112,160,242,74,57,57,239,129,2,180,163,12,160,
+    99,206,227,157,183,240,19,36,37,201,15,205,22,92,175,144,234,168,124,80,
+    189,115,225,159,57,71,1,8,210,25,202,219,218,157,72,37,199,25,232,183,
+    199,99,160,100,80,53,143,129,194,128,182,6,116,121,119,72,38,186,203,239,
+    15,69,36,2,16,87,243,33,225,65,11,179,1,211,69,242,202,243,1,65,73,255,
+    3,194,65,192,205,157,178,134,187,156,143,100,96,50,7,203,92,120,148,167,
+    231,124,20,49,82,195,187,115,23,52,2,129,72,232,40,176,228,141,33,23,221,
+    149,148,3,192,148,182,7,111,229,65,62,239,34,72,168,123,75,160,121,71,
+    120,16,37,37,136,243,78,41,91,79,86,226,135,33,232,14,30,143,159,1,32,
+    200,166,142,42,213,217,24,210,251,125,147,56,206,253,49,24,220,121,86,
+    137,175,194,61,177,43,212,50,36,34,33,106,209,229,26,53,59,239,148,197,
+    224,185,114,73,16,33,170,55,115,186,206,93,66,166,251,57,239,15,223,93,
+    4,208,41,59,122,204,51,133,194,93,162,65,188,90,53,116,248,15,71,121,50,
+    244,163,115,231,18,48,144,206,6,32,194,1,239,249,0,64,88,58,65,152,142,
+    129,16,189,75,217,156,57,144,94,16,230,157,237,171,211,230,145,110,23,
+    201,100,78,166,40,205,74,92,203,233,170,106,112,164,150,13,92,230,188,
+    239,191,122,175,132,249,61,144,133,223,42,29,86,6,218,3,1,34,151,160,238,
+    221,199,253,78,153,48,253,147,205,239,158,128,125,255,232,80,170,224,212,
+    123,201,42,133,188,157,129,118,169,71,153,140,165,93,5,143,76,211,133,
+    22,232,226,39,42,24,0,88,231,46,178,230,143,31,14,24,252,10,233,46,160,
+    112,243,112,254,227,252,240,232,15,159,147,128,238,195,60,107,223,219,
+    229,101,68,40,138,38,42,200,65,29,237,104,11,184,191,197,226,143,178,180,
+    35,92,148,160,192,122,39,63,28,84,168,194,238,221,121,87,179,253,221,101,
+    159,237,180,59,221,223,247,0,107,130,169,58,108,131,10,2,17,87,206,159,
+    187,86,162,76,39,183,145,68,103,136,143,186,66,173,131,251,187,252,217,
+    253,121,43,241,153,128,42,46,227,123,83,247,14,81,218,205,97,101,240,86,
+    153,143,249,239,47,178,2,181,249,61,251,109,231,66,71,57,222,29,14,58,
+    131,123,155,226,100,107,58,87,198,252,98,16,36,82,90,159,76,204,100,214,
+    223,193,163,237,8,12,79,14,251,105,131,4,244,208,51,174,153,119,157,199,
+    93,17,61,151,124,157,238,32,159,163,144,108,64,126,204,157,223,92,138,
+    233,8,29,8,244,186,247,249,79,247,71,243,159,71,114,24,163,237,206,187,
+    196,186,52,59,53,115,200,92,2,144,213,65,180,61,232,206,213,243,207,155,
+    108,203,126,187,148,194,231,7,18,39,181,14,96,95,210,104,123,143,118,183,
+    51,236,182,57,239,183,180,102,151,160,239,14,224,98,240,211,38,121,156,
+    31,1,64,94,12,127,68,53,231,147,171,232,55,231,73,166,74,91,234,85,26,
+    56,191,165,197,228,167,46,0,183,179,193,160,212,183,211,230,22,92,123,
+    199,164,16,194,72,67,20,119,5,146,211,254,209,160,209,23,12,167,251,24,
+    254,12,179,129,58,66,101,160,48,239,182,233,229,173,157,162,251,248,21,
+    60,138,44,10,164,44,175,108,144,160,251,65,136,63,178,115,55,123,252,116,
+    156,46,17,230,100,93,62,120,31,12,239,157,31,222,151,81,222,93,239,254,
+    131,35,126,230,176,56,40,115,2,145,181,117,211,251,247,209,165,182,225,
+    240,14,69,128,35,0,176,122,251,23,141,117,37,112,93,221,158,255,206,219,
+    56,71,10,43,23,56,231,253,203,193,221,95,225,253,123,191,191,127,216,101,
+    187,243,182,134,236,251,221,253,65,210,124,60,215,251,221,14,62,135,56,
+    82,113,160,96,129,45,240,235,206,239,109,133,223,128,215,192,156,36,120,
+    252,14,238,132,213,60,191,211,16,97,86,6,234,221,241,254,242,63,104,119,
+    156,44,235,116,239,26,214,153,28,78,182,10,180,118,23,201,118,52,136,242,
+    246,112,62,160,143,95,212,49,0,1,239,129,233,60,134,207,224,238,180,129,
+    224,7,103,181,127,64,232,65,28,206,179,65,215,249,165,80,32,235,190,129,
+    149,255,208,48,196,15,6,157,246,160,61,207,209,78,246,51,64,18,243,238,
+    27,96,127,120,181,219,205,135,63,93,196,5,115,143,174,211,22,160,191,93,
+    225,240,51,24,100,3,44,144,253,149,32,49,123,239,222,149,218,243,95,18,
+    196,25,118,52,61,59,109,192,241,24,236,252,51,200,30,218,16,184,242,241,
+    251,248,109,207,7,67,231,247,183,171,129,154,57,63,202,167,246,253,231,
+    71,33,168,1,119,127,255,222,161,226,157,67,3,156,161,10,22,83,156,226,
+    117,179,46,42,233,190,219,221,129,211,126,72,131,30,168,242,209,172,123,
+    39,51,7,195,57,209,64,67,221,55,95,36,104,19,100,126,209,158,51,248,225,
+    77,125,93,114,126,249,13,71,242,242,227,158,13,218,237,46,169,0,71,64,
+    195,40,235,102,18,227,15,38,67,216,63,10,85,237,3,188,211,70,212,109,240,
+    27,220,37,219,238,128,68,98,226,131,215,35,251,25,254,252,252,202,73,240,
+    129,36,129,247,119,216,205,218,132,94,23,86,219,191,216,13,81,98,161,223,
+    71,219,131,249,246,252,254,3,16,93,58,123,255,249,25,220,181,90,162,36,
+    134,12,59,91,198,145,93,114,111,8,34,164,79,151,131,58,3,142,0,229,199,
+    224,254,163,169,200,103,120,33,119,8,72,242,129,49,245,104,255,194,126,
+    14,179,144,62,192,27,119,92,146,117,60,205,0,238,236,162,203,97,91,89,
+    50,112,188,31,141,84,36,168,151,126,137,169,31,226,240,222,105,255,112,
+    213,125,88,206,4,5,252,47,160,116,145,113,183,51,0,228,247,31,77,36,128,
+    105,11,208,46,17,53,248,65,50,132,113,123,48,239,14,186,247,193,207,111,
+    231,247,254,59,84,202,223,1,148,60,237,206,179,31,122,230,84,200,33,85,
+    231,153,250,225,25,134,126,246,104,163,255,31,28,216,193,252,132,211,252,
+    143,70,57,169,242,64,220,195,114,239,26,130,94,214,102,176,0,53,231,223,
+    223,109,196,244,219,229,169,54,104,182,25,76,143,95,69,119,247,222,110,
+    59,56,213,3,115,8,210,6,235,64,126,23,76,126,58,156,149,243,44,79,252,
+    226,54,10,253,121,12,80,58,129,79,26,201,200,63,237,183,146,146,220,167,
+    175,225,61,255,51,159,15,32,13,187,254,32,198,249,253,247,7,61,43,82,192,
+    131,218,72,232,223,76,214,231,67,32,56,248,101,66,252,190,57,8,158,134,
+    249,157,89,65,19,148,249,7,117,130,66,23,199,13,121,246,231,247,49,0,210,
+    193,61,27,118,59,63,156,133,153,218,191,138,14,29,251,155,65,114,254,219,
+    110,67,224,157,88,27,128,91,135,126,127,81,189,116,170,239,85,96,113,127,
+    100,176,0,104,152,146,105,241,190,183,21,173,96,223,166,146,156,166,224,
+    183,251,35,196,178,246,27,244,126,59,242,193,155,107,231,26,61,100,255,
+    93,243,148,17,4,177,131,31,130,157,185,63,104,179,63,122,152,227,23,119,
+    118,25,230,119,32,190,15,137,53,234,231,115,66,157,224,232,254,254,254,
+    252,63,236,219,222,188,13,112,40,135,6,53,83,127,184,23,99,100,63,239,
+    172,75,209,157,247,189,132,16,75,252,254,254,146,95,217,29,161,223,115,
+    82,68,171,57,19,233,71,83,116,248,203,43,248,143,247,126,16,168,168,231,
+    1,62,202,94,218,214,240,164,53,28,36,164,73,210,129,82,231,23,42,179,123,
+    155,165,121,112,199,211,191,240,74,14,229,119,70,152,71,124,209,215,47,
+    90,26,96,191,251,144,127,187,131,14,112,128,243,207,47,198,254,25,80,32,
+    120,183,105,241,71,229,17,150,120,27,154,179,119,27,243,182,33,21,32,248,
+    115,112,31,42,66,104,181,219,233,118,127,58,212,169,116,148,65,4,10,231,
+    242,23,50,1,35,77,131,255,175,61,179,105,185,95,201,174,251,167,200,44,
+    36,96,200,252,168,143,84,197,5,149,75,72,147,210,11,18,24,50,243,192,35,
+    127,131,59,247,192,224,105,200,40,144,97,192,227,170,86,169,138,14,71,
+    125,62,218,223,191,165,191,193,184,109,67,48,152,76,238,211,247,62,47,
+    58,245,178,247,218,107,173,189,117,155,178,210,245,190,226,11,91,48,116,
+    22,80,204,248,146,51,255,241,215,175,232,247,149,207,188,176,123,52,135,
+    127,19,33,149,34,94,164,249,193,67,113,43,126,128,59,172,124,159,223,23,
+    31,247,12,32,241,215,23,144,252,242,137,248,101,79,220,159,223,97,24,231,
+    219,63,26,250,124,227,31,60,92,212,72,2,239,255,64,159,192,154,112,117,
+    223,203,120,94,216,120,252,35,134,207,16,139,171,66,65,40,25,217,77,159,
+    64,163,61,169,48,147,17,170,194,197,74,63,208,14,185,69,213,207,131,255,
+    247,237,127,33,32,26,33,141,92,199,41,133,247,43,42,242,95,17,16,201,2,
+    227,175,253,239,99,255,123,66,36,59,161,13,133,152,13,96,56,31,191,65,
+    35,82,0,42,143,114,168,37,173,5,185,112,0,68,16,140,143,130,126,7,179,
+    60,86,47,123,254,64,179,72,195,149,141,127,127,245,80,157,175,239,43,158,
+    88,154,112,34,26,106,254,213,24,241,43,167,0,21,149,128,185,178,217,120,
+    130,31,29,204,251,94,2,244,10,2,104,96,100,15,192,120,3,92,164,160,156,
+    2,75,72,255,77,85,223,127,206,196,138,141,16,123,47,183,56,133,216,183,
+    151,147,1,200,231,161,209,71,238,166,43,168,240,47,72,131,166,142,201,
+    64,198,247,249,135,47,196,56,81,40,255,163,238,16,7,84,245,232,119,252,
+    174,86,255,2,168,158,108,168,212,195,164,175,72,216,171,117,112,204,31,
+    113,53,124,24,240,149,182,40,115,170,89,156,223,95,212,74,62,47,255,130,
+    155,104,139,206,200,119,113,168,255,197,147,232,249,83,153,42,9,31,62,
+    127,245,250,75,77,168,255,194,183,83,70,251,150,120,190,191,34,25,44,176,
+    23,61,190,12,190,44,195,185,33,152,190,97,73,56,39,1,171,24,10,128,12,
+    25,172,25,20,112,112,2,64,142,191,215,103,74,229,203,17,148,178,87,150,
+    144,230,171,166,137,219,130,2,21,97,234,210,41,4,46,88,80,7,14,197,66,
+    144,120,145,19,198,162,164,233,15,226,15,151,188,165,8,65,74,137,126,69,
+    253,132,193,19,96,96,112,150,132,94,94,1,189,226,99,220,160,230,117,3,
+    163,7,20,80,155,147,108,84,117,157,140,142,165,223,15,212,140,94,145,125,
+    116,43,224,127,223,194,75,164,7,11,210,166,165,66,159,94,130,123,160,129,
+    231,31,65,207,249,216,39,217,144,35,40,98,207,223,39,21,2,135,66,90,241,
+    125,144,248,60,74,149,159,105,157,18,248,64,203,175,250,188,40,213,171,
+    247,113,131,152,40,112,89,194,71,180,3,9,133,131,52,43,17,29,184,136,55,
+    252,201,175,158,124,162,246,200,87,191,81,209,226,194,95,57,242,75,103,
+    127,229,236,159,175,116,164,103,24,1,25,60,209,137,116,159,194,70,145,
+    150,72,190,15,131,132,185,142,224,88,21,12,80,100,37,17,159,165,163,42,
+    7,175,18,255,163,139,114,229,75,137,177,17,85,62,137,22,21,90,76,196,61,
+    150,94,46,216,8,106,226,125,190,127,149,66,145,40,94,210,244,35,58,173,
+    230,80,209,211,232,60,40,242,190,69,213,199,33,129,134,103,152,196,187,
+    156,15,101,244,252,126,43,51,118,242,83,238,245,145,38,69,143,207,77,214,
+    16,168,215,161,36,80,60,81,127,165,222,47,138,254,24,76,64,229,190,251,
+    104,192,136,152,27,178,225,120,97,252,197,184,184,86,132,122,130,33,6,
+    37,47,79,146,223,23,241,233,140,183,14,56,37,88,18,125,234,33,59,127,25,
+    188,91,245,54,98,45,152,40,53,82,73,178,255,248,57,27,67,165,26,33,149,
+    72,249,229,223,139,184,79,69,8,94,79,253,251,241,134,199,80,165,66,206,
+    82,135,0,186,230,17,195,195,67,120,85,122,222,116,32,227,217,80,109,99,
+    212,77,95,143,20,122,137,250,221,23,142,101,120,148,57,197,229,125,22,
+    192,166,116,167,232,116,51,70,244,203,155,49,255,109,88,73,113,62,162,
+    15,192,221,167,176,60,213,50,228,238,192,210,136,252,167,239,159,16,110,
+    232,181,176,24,3,3,201,247,253,249,44,98,161,151,157,232,85,233,251,117,
+    244,194,248,45,40,131,117,231,35,230,247,242,150,8,191,170,163,106,76,
+    64,202,232,179,168,48,95,3,254,52,1,74,101,250,167,37,9,211,27,188,204,
+    249,54,56,249,253,82,109,97,115,124,221,175,101,137,103,195,140,9,99,78,
+    161,173,9,232,52,233,243,241,165,17,165,8,143,170,82,250,229,212,124,17,
+    203,211,48,184,154,44,251,197,223,177,191,105,67,124,226,76,146,28,202,
+    217,52,234,20,253,203,168,211,202,252,161,234,227,65,104,151,22,224,160,
+    204,235,85,222,154,40,26,121,235,15,121,2,169,64,31,14,111,224,39,38,116,
+    191,95,238,115,22,129,121,191,239,111,129,116,223,175,113,20,144,156,192,
+    169,244,139,92,252,125,54,159,199,84,41,206,183,55,74,43,25,72,43,57,66,
+    132,111,223,156,198,47,0,119,2,63,208,158,170,12,160,166,215,187,121,156,
+    170,112,197,251,147,150,70,141,228,251,109,36,125,74,230,23,41,247,67,
+    125,95,166,17,45,16,255,247,109,98,116,167,49,148,215,168,162,229,188,
+    253,221,55,134,155,123,191,200,96,212,82,96,222,43,9,58,60,146,40,13,136,
+    83,161,230,45,31,52,209,55,170,72,99,62,207,108,97,94,15,149,97,253,203,
+    60,147,149,154,169,191,207,242,141,233,60,139,233,223,247,99,249,183,129,
+    91,24,147,12,158,76,31,161,179,191,148,34,94,197,82,122,131,129,208,74,
+    63,134,155,25,191,72,214,220,220,243,46,112,115,121,53,159,197,200,47,
+    196,61,103,228,195,231,242,121,116,224,206,251,102,241,121,151,239,210,
+    247,247,45,199,66,181,108,188,63,230,92,94,106,166,242,212,211,20,97,176,
+    20,181,69,95,222,183,55,5,229,220,254,236,27,239,222,137,240,127,170,155,
+    48,220,151,58,246,205,171,185,201,41,54,240,238,235,164,228,151,49,12,
+    47,230,253,54,200,206,80,66,104,137,136,80,130,161,118,175,215,130,232,
+    62,8,11,82,194,103,21,240,195,47,165,233,203,114,154,166,111,144,40,18,
+    185,65,91,129,178,241,46,2,238,17,117,52,166,121,137,37,136,23,165,72,
+    189,200,198,189,81,50,132,236,239,34,66,56,128,227,119,143,130,211,13,
+    38,16,248,83,76,3,102,253,23,211,186,69,27,96,41,49,54,229,238,151,114,
+    26,199,148,146,192,227,147,8,23,197,45,95,170,78,201,155,229,49,146,69,
+    46,229,228,240,31,172,233,157,96,57,108,122,47,69,45,1,45,99,198,75,211,
+    168,134,101,129,152,132,4,250,136,44,246,79,165,81,203,77,87,122,41,21,
+    6,59,9,237,77,25,138,154,31,212,68,104,188,118,232,105,209,187,107,193,
+    122,189,249,150,119,162,141,98,178,132,97,206,215,210,176,188,200,82,22,
+    60,147,24,151,114,203,38,213,70,41,171,235,75,83,184,3,19,130,44,156,99,
+    204,242,73,224,126,154,187,44,119,243,125,177,152,167,61,48,226,106,37,
+    138,73,75,161,116,203,233,18,116,77,159,222,164,243,91,140,24,13,159,207,
+    143,195,11,76,130,9,220,132,176,22,92,27,63,50,112,166,241,95,196,95,68,
+    139,133,206,244,5,170,62,189,227,226,226,253,163,97,213,171,199,159,153,
+    249,185,46,190,22,81,218,224,169,144,226,62,151,229,251,106,88,127,202,
+    171,137,17,133,156,37,98,16,230,251,189,197,193,248,110,24,20,251,69,220,
+    130,195,154,32,252,199,124,111,87,12,145,222,216,29,10,244,116,92,243,
+    50,174,97,190,234,11,148,246,139,41,11,236,74,190,249,148,226,250,119,
+    211,112,101,143,176,150,251,78,20,70,166,113,115,151,113,145,199,60,68,
+    75,220,228,177,13,232,36,187,145,9,194,48,211,124,82,3,17,191,6,148,228,
+    165,188,137,46,154,39,9,15,37,220,134,102,100,162,16,162,48,228,131,144,
+    26,177,176,241,11,148,55,64,132,111,164,2,88,13,238,103,202,157,232,82,
+    84,150,114,47,206,165,66,38,247,167,145,226,111,62,93,232,106,134,162,
+    208,242,232,148,205,217,244,9,179,57,83,143,42,95,141,51,229,117,23,255,
+    197,113,27,150,47,200,0,225,240,42,255,110,104,20,20,175,161,167,168,27,
+    44,253,45,93,224,122,229,243,114,6,135,235,13,66,230,242,243,110,22,105,
+    14,154,191,201,249,11,237,32,16,147,128,244,0,43,239,222,153,134,203,16,
+    35,128,233,237,248,93,52,25,185,24,161,81,227,78,215,96,41,166,56,215,
+    39,183,240,117,163,122,202,114,74,159,196,15,116,203,253,248,167,51,254,
+    70,77,88,170,127,223,81,90,196,55,74,42,31,231,251,91,175,92,223,18,27,
+    217,108,108,80,223,109,110,164,14,66,136,175,121,235,252,229,187,32,42,
+    144,92,192,63,34,20,60,147,79,32,35,50,188,139,147,53,24,138,6,19,10,157,
+    198,60,240,223,248,57,169,227,91,31,157,115,191,49,135,210,16,38,94,235,
+    137,91,226,209,204,156,62,12,59,230,230,0,57,136,115,175,132,183,16,88,
+    193,217,25,90,97,68,162,65,36,142,120,65,79,166,83,89,40,173,22,206,225,
+    71,84,208,171,91,54,4,205,40,209,167,5,227,48,58,174,255,38,83,204,237,
+    123,151,96,246,183,1,68,194,187,161,53,188,82,199,160,5,24,204,218,157,
+    205,29,225,47,54,85,4,131,89,192,148,113,38,46,125,179,148,215,233,139,
+    73,142,70,240,45,180,89,106,221,192,153,5,237,96,215,125,194,212,224,202,
+    189,36,138,122,235,214,133,6,159,76,76,61,44,71,135,142,72,53,139,161,
+    86,68,112,211,170,160,53,66,142,0,1,205,225,109,50,244,79,100,28,9,8,193,
+    99,253,240,112,185,105,226,200,51,2,211,7,50,189,122,195,92,38,90,155,
+    82,212,249,22,154,8,174,7,150,144,41,209,117,22,0,74,100,217,52,78,111,
+    105,48,249,236,239,23,229,132,83,36,68,10,240,138,189,24,130,178,51,177,
+    1,25,252,7,58,208,146,203,205,163,55,164,87,169,10,38,66,37,155,68,188,
+    11,46,68,82,142,209,99,113,141,80,102,37,70,101,190,20,229,198,136,81,
+    5,244,190,169,42,159,166,82,60,223,185,206,69,40,203,118,4,4,187,141,28,
+    6,52,56,159,61,133,50,66,147,19,41,179,144,51,191,134,115,110,138,189,
+    192,73,218,53,180,193,51,129,160,124,216,116,211,125,150,207,237,22,239,
+    24,128,157,187,27,128,38,91,134,40,110,226,179,197,45,55,115,4,142,71,
+    196,96,228,10,224,83,104,179,20,156,89,230,111,168,83,255,197,37,139,70,
+    36,202,125,255,72,210,24,129,81,57,164,204,79,202,121,247,0,159,128,17,
+    21,2,62,46,99,140,90,211,77,74,98,45,57,157,242,101,199,183,198,161,107,
+    118,70,15,28,240,149,130,35,238,23,24,37,62,4,119,14,165,170,160,108,136,
+    135,173,183,126,2,64,35,244,153,103,48,52,44,65,184,249,230,75,142,116,
+    97,89,56,9,184,194,5,148,181,121,234,67,5,241,42,217,25,30,177,96,67,137,
+    230,130,172,40,138,231,239,69,140,109,212,163,241,160,248,89,132,15,195,
+    7,133,131,93,94,141,27,15,231,56,73,18,41,99,77,52,222,134,115,112,24,
+    213,173,112,147,67,49,241,118,132,13,52,232,89,255,51,119,195,170,146,
+    26,221,107,30,67,100,22,193,203,1,137,125,248,53,237,129,31,69,45,80,64,
+    47,156,133,36,161,53,225,176,88,150,224,84,131,244,152,132,121,172,189,
+    129,84,106,235,206,41,63,103,132,100,129,107,64,35,122,179,5,166,10,52,
+    194,130,9,158,207,240,46,162,18,30,253,162,181,212,219,72,91,141,3,143,
+    59,49,49,80,60,26,89,65,164,73,173,15,2,82,99,232,72,104,24,142,57,201,
+    128,9,11,9,226,124,68,208,8,246,196,28,123,251,230,164,122,141,89,124,
+    163,36,213,242,144,35,196,7,23,7,114,174,60,105,43,61,115,62,129,114,26,
+    158,64,195,184,185,139,216,31,148,112,88,242,239,213,183,212,10,217,124,
+    147,180,107,60,52,197,147,37,2,210,95,148,50,199,57,145,118,65,97,42,36,
+    16,21,175,105,157,34,40,69,195,32,183,156,94,67,21,103,23,45,77,236,109,
+    86,232,138,155,75,96,224,71,1,26,106,191,252,148,226,169,91,26,253,97,
+    148,124,191,180,141,0,33,86,225,197,193,44,95,112,170,94,212,5,10,176,
+    131,42,252,145,128,43,73,60,225,86,191,225,45,132,165,119,203,125,233,
+    124,82,65,101,17,8,206,18,216,66,204,132,40,187,145,227,96,3,12,116,122,
+    212,43,112,240,4,127,78,151,175,80,10,81,191,130,50,148,68,230,165,130,
+    253,169,207,120,190,42,244,134,131,97,146,182,222,229,225,122,33,78,114,
+    110,91,200,0,85,121,198,244,144,68,164,72,80,186,222,85,185,84,74,45,19,
+    194,207,141,41,149,150,31,141,236,246,137,175,121,142,163,200,139,156,
+    94,46,97,84,36,184,200,158,54,180,156,117,38,231,105,159,76,154,73,177,
+    66,55,164,25,98,211,82,227,148,156,9,107,76,8,188,133,203,43,181,117,114,
+    33,50,114,92,6,66,84,131,240,157,76,69,17,172,141,40,142,89,81,110,231,
+    196,74,115,146,251,106,42,170,93,30,157,115,142,103,138,109,101,139,49,
+    45,94,175,31,201,132,70,18,87,103,117,248,86,9,45,102,14,10,120,133,132,
+    43,253,45,252,65,108,242,18,204,171,117,53,114,24,217,185,176,200,96,180,
+    183,233,29,96,161,145,4,31,163,9,116,177,159,178,18,149,35,69,109,66,115,
+    87,85,151,141,148,150,17,240,116,177,113,173,160,89,136,18,158,187,150,
+    11,212,241,84,49,197,19,141,75,65,138,85,77,248,135,51,43,87,180,144,9,
+    140,214,133,74,39,106,37,168,219,70,178,84,207,230,147,228,88,210,183,
+    216,167,187,235,210,215,90,86,108,44,197,84,212,26,139,65,12,234,93,216,
+    166,154,72,77,70,75,53,104,56,179,114,10,149,50,114,108,83,203,3,51,55,
+    183,205,82,155,228,74,229,221,106,173,65,111,90,66,13,171,77,178,109,126,
+    15,43,98,42,233,71,149,230,131,138,20,146,44,87,30,238,8,15,43,132,212,
+    81,233,106,73,145,99,148,118,77,85,46,255,83,218,144,146,149,112,168,208,
+    94,170,89,97,74,33,147,226,208,194,42,148,91,254,89,158,248,150,117,225,
+    147,6,22,21,110,86,101,215,187,169,109,194,172,82,171,193,133,152,146,
+    134,11,252,65,190,71,225,224,66,84,19,165,45,174,97,89,124,224,137,231,
+    125,29,237,45,21,203,75,143,221,80,107,4,210,210,73,89,26,155,234,144,
+    124,21,175,128,162,109,76,8,156,125,63,110,176,64,194,74,204,73,220,144,
+    181,208,182,104,212,141,236,204,235,164,246,150,15,212,149,131,93,109,
+    132,146,225,188,26,92,170,24,82,129,79,178,227,170,123,49,28,252,183,165,
+    154,228,201,173,77,144,231,99,79,144,211,164,118,109,151,164,192,151,128,
+    48,24,7,36,57,188,233,94,170,105,193,169,45,213,152,53,137,18,148,86,72,
+    61,42,150,10,22,88,7,144,133,53,119,192,79,234,45,152,185,138,225,31,242,
+    221,213,153,170,245,150,227,131,74,144,50,45,203,180,114,72,229,82,77,
+    192,29,52,132,17,89,92,36,55,142,139,41,6,228,67,109,115,171,76,225,13,
+    144,240,178,228,106,106,20,14,197,145,88,42,193,5,254,118,94,77,166,5,
+    152,229,241,95,44,83,102,26,226,26,52,6,213,86,204,243,43,103,153,80,65,
+    135,242,222,181,117,114,93,211,18,201,227,48,46,36,23,36,1,240,48,177,
+    134,100,147,88,3,53,88,65,107,74,21,54,65,8,245,71,18,199,1,146,34,91,
+    113,60,169,214,145,124,179,114,33,242,104,17,255,218,86,202,34,2,169,115,
+    21,233,174,178,20,187,185,65,138,142,86,106,104,90,245,126,193,101,208,
+    66,187,194,72,137,77,30,139,55,248,86,187,132,222,106,194,18,16,158,162,
+    71,19,100,191,162,104,66,95,234,122,63,132,93,131,8,218,194,222,146,86,
+    139,217,43,201,204,31,5,216,37,57,104,194,142,27,111,49,190,26,171,119,
+    4,12,181,4,29,188,172,142,104,151,154,236,250,115,22,113,150,210,149,80,
+    125,48,44,111,219,146,27,88,128,135,98,149,21,164,45,213,197,96,92,64,
+    16,22,134,73,191,78,231,3,80,198,124,221,154,82,128,51,169,117,65,231,
+    65,232,59,81,106,231,86,72,211,2,189,246,224,172,152,58,254,135,11,73,
+    122,146,3,129,150,12,74,34,46,168,135,71,94,102,173,58,221,81,0,4,66,120,
+    149,238,133,176,83,101,115,174,78,179,5,172,161,33,65,78,250,123,155,193,
+    3,25,0,175,165,24,57,6,28,222,174,119,235,3,21,70,243,156,17,124,184,131,
+    196,2,188,28,108,171,32,43,162,86,35,147,160,242,149,76,237,202,14,103,
+    149,115,123,55,171,91,242,189,134,182,205,141,200,93,154,182,177,129,152,
+    77,27,52,85,82,3,162,194,115,87,225,158,86,18,193,154,90,24,203,5,128,
+    194,88,110,171,166,12,140,129,103,46,89,11,188,119,104,3,242,105,44,159,
+    163,117,10,76,149,90,69,83,33,20,135,33,139,106,215,140,138,41,51,6,29,
+    60,73,226,169,107,37,80,145,0,250,202,115,86,219,210,80,215,106,195,10,
+    97,114,88,106,176,45,212,202,112,146,40,252,227,128,184,230,90,234,154,
+    131,107,131,192,165,173,181,137,19,105,70,21,99,203,213,130,88,160,229,
+    67,37,203,141,161,222,220,130,101,58,239,67,187,134,212,218,184,210,136,
+    233,246,156,77,252,235,210,180,32,89,157,92,166,33,226,144,242,90,17,61,
+    5,173,210,99,226,30,44,14,153,216,26,144,152,234,152,211,250,179,243,154,
+    150,211,128,237,206,242,36,249,52,221,111,49,193,18,13,174,10,252,84,15,
+    190,128,48,116,76,107,109,3,160,145,23,166,92,201,191,109,192,187,137,
+    56,139,117,107,70,59,68,13,9,243,13,76,181,216,162,204,163,34,203,88,98,
+    6,29,170,101,129,27,131,86,191,227,100,126,183,80,255,110,215,91,70,7,
+    204,150,190,148,30,143,105,80,100,14,148,21,93,195,189,80,233,162,25,213,
+    64,36,4,130,74,168,59,214,193,106,24,237,74,75,195,231,174,186,182,96,
+    107,67,64,252,1,26,102,122,87,110,239,28,178,103,157,5,133,213,218,182,
+    230,64,90,78,231,131,149,197,231,130,139,24,52,229,35,121,146,171,52,180,
+    144,43,175,233,200,40,7,19,96,177,109,160,60,122,91,45,146,117,25,115,
+    88,163,92,38,81,129,76,132,56,140,79,21,49,83,102,38,40,172,44,44,84,71,
+    168,41,77,147,239,92,148,138,167,112,188,254,39,4,95,87,216,2,165,37,129,
+    0,107,160,33,130,183,33,55,202,2,247,167,185,195,175,117,93,113,199,84,
+    217,130,216,66,67,79,108,3,77,18,151,182,184,114,46,62,86,180,2,206,181,
+    109,35,183,65,164,26,65,11,108,114,133,154,134,193,2,64,44,71,87,106,146,
+    171,95,109,134,72,196,106,32,22,212,93,50,44,197,91,44,25,184,106,233,
+    63,206,218,85,129,165,8,30,33,81,30,116,70,187,3,120,42,19,172,193,144,
+    109,90,2,119,53,113,205,45,245,106,197,124,24,15,161,86,229,198,28,40,
+    44,225,75,108,65,3,99,196,180,140,222,72,96,108,182,55,29,4,99,128,163,
+    176,196,18,104,160,135,132,98,225,48,87,88,13,137,112,59,103,202,188,112,
+    229,202,175,37,7,111,105,115,158,84,33,16,69,109,17,45,214,143,143,88,
+    52,141,236,109,171,170,26,171,227,10,204,165,80,68,11,195,42,145,1,17,
+    236,176,216,188,93,19,61,187,241,140,7,45,164,201,168,183,85,150,41,130,
+    134,89,21,55,28,178,128,150,106,118,68,138,169,162,8,29,130,44,0,160,90,
+    23,40,4,188,36,1,118,0,125,91,75,194,63,29,35,8,227,74,213,57,5,68,113,
+    32,122,15,127,230,149,61,182,120,50,20,249,50,142,143,25,123,11,59,192,
+    138,235,42,220,227,32,81,155,15,25,239,240,240,8,53,136,48,102,164,231,
+    41,63,243,146,206,2,231,12,197,235,243,149,221,205,30,118,9,241,21,3,206,
+    116,118,64,163,142,106,155,73,137,129,7,104,177,145,139,67,206,28,67,10,
+    100,88,224,127,194,102,137,4,217,192,62,14,112,55,204,89,97,0,148,107,
+    93,206,8,3,36,212,152,81,122,43,82,85,78,198,28,236,227,123,97,125,226,
+    6,19,214,82,6,14,134,134,58,137,71,181,241,2,24,56,18,8,208,147,44,135,
+    57,118,217,108,179,19,223,108,18,146,36,5,239,210,202,83,114,19,105,16,
+    163,46,182,249,7,46,217,74,212,0,197,57,52,36,116,135,232,97,4,158,31,
+    232,44,108,162,189,176,141,182,137,36,165,55,176,201,80,248,161,18,181,
+    69,228,14,213,163,22,44,45,91,93,197,249,248,11,101,167,246,44,37,188,
+    106,179,18,170,80,8,169,41,39,209,159,191,44,180,83,253,90,181,164,108,
+    85,144,85,241,172,74,130,11,40,84,123,209,40,0,150,152,184,150,118,206,
+    70,219,142,173,194,81,0,173,208,229,182,86,6,100,243,165,243,184,175,133,
+    103,107,132,253,216,84,171,11,61,242,215,185,130,153,118,157,37,32,60,
+    155,25,34,40,3,218,161,183,190,133,30,32,163,94,95,209,20,108,216,91,218,
+    52,168,50,105,4,193,13,100,128,136,215,139,30,172,92,87,167,160,137,77,
+    21,4,88,70,250,160,191,234,200,74,40,101,59,24,142,80,102,54,129,30,58,
+    34,171,199,80,106,103,115,110,237,5,7,86,213,181,214,43,172,29,241,58,
+    177,80,23,35,127,214,134,11,10,175,237,104,235,101,71,158,64,52,148,199,
+    165,117,4,86,202,193,73,187,139,176,2,103,201,235,44,24,0,19,0,8,129,11,
+    59,219,85,101,13,156,196,72,105,194,19,27,135,135,28,201,22,46,104,136,
+    152,147,187,114,166,140,146,94,21,224,85,150,7,14,207,193,96,79,141,194,
+    158,101,188,187,218,68,155,50,166,97,113,135,75,32,95,232,60,3,149,115,
+    51,254,231,58,40,10,19,102,56,153,58,144,97,21,247,207,226,236,72,130,
+    68,154,245,39,162,208,8,42,44,133,64,171,121,141,32,173,27,201,59,230,
+    32,137,241,205,94,20,143,40,129,83,118,177,63,50,119,123,39,229,117,98,
+    3,168,160,15,224,228,144,174,101,38,209,120,149,175,112,101,46,178,237,
+    53,231,150,254,12,30,15,18,212,129,47,68,83,187,186,163,148,218,118,84,
+    62,63,160,6,85,146,185,152,132,127,184,125,149,71,135,245,226,195,17,54,
+    163,121,28,163,149,89,215,177,253,185,97,111,31,237,90,85,9,114,196,167,
+    237,116,99,22,173,127,178,104,222,193,216,59,224,82,30,93,151,21,136,218,
+    166,112,8,93,247,20,127,174,118,231,195,53,93,93,144,160,57,104,206,235,
+    104,187,139,179,196,241,26,58,209,60,180,29,162,82,207,145,184,119,100,
+    66,168,221,142,241,210,56,220,53,135,26,119,209,187,163,159,83,17,204,
+    32,219,93,115,4,82,216,99,190,186,71,180,144,48,75,134,206,94,140,63,217,
+    173,235,213,94,23,37,178,93,23,8,224,2,21,106,54,119,132,82,61,55,238,
+    29,213,180,63,133,123,133,31,173,8,186,166,113,175,116,238,117,28,229,
+    45,251,174,97,232,65,215,173,158,35,162,149,103,201,222,235,60,139,103,
+    0,132,197,204,228,57,18,210,85,103,4,90,237,12,18,242,232,32,150,208,41,
+    86,88,51,183,51,68,75,237,149,195,184,102,143,46,168,146,140,86,110,58,
+    34,157,245,186,118,203,248,64,82,240,10,182,165,153,12,200,44,140,99,219,
+    117,29,8,181,112,41,65,14,64,243,157,204,243,130,83,192,143,219,106,214,
+    145,216,221,92,247,142,14,100,237,156,174,176,171,57,117,251,42,15,72,
+    242,49,36,187,58,190,117,109,74,234,248,176,201,117,251,24,194,60,215,
+    31,23,12,236,102,84,210,217,121,70,225,44,72,157,92,222,142,137,71,173,
+    108,117,38,177,53,134,113,71,1,44,172,144,134,28,163,99,45,17,174,185,
+    171,23,250,0,16,162,39,37,98,100,41,77,4,118,6,0,15,244,34,114,97,170,
+    202,157,124,155,166,133,140,9,15,31,200,110,92,127,72,7,176,169,245,87,
+    87,41,237,62,238,185,187,8,24,66,57,162,238,236,104,215,157,60,97,34,112,
+    95,8,110,191,136,27,201,141,235,174,161,204,142,56,206,88,87,63,175,176,
+    148,169,185,2,223,69,93,73,162,69,63,110,86,19,205,115,32,82,80,145,221,
+    56,53,26,44,150,215,201,86,163,222,56,175,87,71,214,48,168,237,46,159,
+    247,174,82,45,133,33,250,217,71,113,45,38,182,183,122,0,0,84,0,234,145,
+    0,23,145,76,130,56,26,15,199,17,218,168,167,174,99,158,47,241,183,206,
+    238,185,21,180,88,155,213,160,144,77,149,183,178,5,64,97,238,30,0,81,22,
+    102,245,2,224,186,206,35,255,152,231,54,93,150,70,122,205,78,71,207,208,
+    87,93,63,67,12,32,38,115,114,184,242,126,225,39,152,247,21,218,61,118,
+    188,6,132,136,226,49,166,144,221,149,252,131,127,59,239,35,199,0,38,197,
+    100,88,212,29,59,166,159,210,72,127,33,97,209,163,203,212,137,34,50,130,
+    4,43,179,65,221,99,188,218,218,57,114,129,239,136,229,218,213,250,102,
+    186,76,119,141,34,13,84,17,7,65,166,27,49,105,218,65,123,69,105,51,193,
+    65,36,56,227,253,123,71,69,215,125,92,71,0,205,44,27,59,13,146,179,7,122,
+    241,96,92,209,7,221,114,238,158,154,48,12,86,25,244,69,3,231,10,38,145,
+    60,239,228,105,187,121,173,4,105,247,185,187,196,172,81,9,242,221,142,
+    50,22,92,14,3,223,201,144,91,53,233,249,177,235,70,215,249,171,157,47,
+    226,163,171,206,206,143,179,212,70,164,109,86,60,29,170,163,214,251,58,
+    227,135,179,223,237,206,222,139,27,70,207,34,94,127,119,63,106,242,163,
+    105,248,43,208,190,246,118,95,175,49,165,93,109,170,235,104,4,109,216,
+    9,197,239,146,12,84,156,61,50,196,162,48,246,238,153,92,187,52,206,74,
+    147,212,33,144,131,191,1,163,230,246,29,12,193,19,34,184,221,229,29,63,
+    64,139,108,210,20,193,164,13,3,233,149,110,237,106,186,232,95,40,222,94,
+    81,237,83,38,214,81,251,29,132,234,140,179,8,224,122,49,96,16,112,29,35,
+    190,212,181,30,139,68,142,144,69,157,25,242,216,182,91,49,64,54,141,150,
+    161,8,103,210,31,35,188,165,117,205,17,145,105,64,3,61,124,30,103,16,118,
+    35,183,145,3,109,169,142,52,107,4,229,104,72,215,142,73,241,123,222,249,
+    60,91,156,61,233,70,164,49,206,72,78,96,35,210,21,233,96,103,57,117,200,
+    123,158,121,128,243,48,227,206,112,133,181,246,145,32,162,131,114,100,
+    52,118,121,119,160,212,162,98,136,24,112,241,100,247,125,78,150,146,204,
+    52,16,162,188,16,162,8,224,220,158,230,48,211,100,24,81,145,253,152,187,
+    29,141,161,64,74,209,97,129,196,2,97,69,3,242,35,167,250,228,137,26,51,
+    140,29,243,142,114,174,209,193,107,126,64,200,241,178,215,78,0,35,3,94,
+    55,207,216,30,82,212,96,56,3,154,155,241,130,17,83,222,119,216,166,56,
+    187,125,207,56,213,78,191,195,39,194,213,93,24,79,119,97,60,0,51,226,146,
+    64,231,232,250,48,161,133,178,106,46,93,230,35,248,77,84,105,135,185,8,
+    81,3,13,223,105,78,123,234,232,29,178,190,68,208,14,110,103,248,53,34,
+    83,110,162,42,154,221,8,82,112,184,61,204,163,157,175,142,182,19,246,121,
+    102,92,17,75,237,76,87,191,128,145,72,59,205,22,145,125,106,45,249,241,
+    59,69,235,218,17,146,160,105,194,72,245,226,253,15,30,19,186,211,64,58,
+    98,13,23,235,241,191,17,144,247,228,212,124,104,52,204,64,57,49,44,205,
+    108,28,145,179,72,116,101,106,51,195,98,110,77,151,106,109,229,228,60,
+    29,103,242,214,55,44,79,113,112,168,131,49,16,201,66,151,76,117,5,52,181,
+    195,26,83,138,35,132,152,231,185,163,111,80,65,218,150,38,33,146,12,240,
+    83,69,65,38,51,187,169,16,38,5,201,247,153,58,34,25,124,6,234,169,38,41,
+    43,96,14,37,242,46,200,68,130,40,186,206,41,19,9,65,98,102,116,19,196,
+    147,16,39,135,106,47,131,207,248,3,78,185,78,255,197,130,216,184,107,188,
+    70,120,69,245,230,238,7,37,134,172,35,137,33,0,150,211,130,144,170,158,
+    238,25,227,181,130,88,115,30,101,144,182,40,9,183,95,48,129,220,65,212,
+    66,100,148,140,233,64,183,220,225,56,216,45,248,113,33,161,103,124,148,
+    238,139,215,48,64,160,150,107,94,41,127,119,237,236,29,237,168,57,136,
+    98,212,209,161,199,57,200,31,16,16,237,134,178,17,1,233,71,240,81,106,
+    98,35,50,28,157,231,80,110,238,162,155,57,145,71,104,30,34,66,14,26,178,
+    187,108,96,154,32,116,165,56,98,47,188,112,210,10,112,38,152,54,167,177,
+    106,180,194,182,48,205,81,130,135,97,104,135,227,248,157,33,3,218,18,85,
+    156,43,106,164,23,50,101,113,10,201,226,9,15,103,224,195,8,105,5,235,37,
+    247,135,215,251,181,146,214,78,164,248,213,131,105,34,200,167,240,98,182,
+    83,173,70,245,61,26,68,171,129,138,152,85,4,76,68,19,199,46,133,242,64,
+    210,128,115,51,116,223,137,23,202,49,208,249,142,191,168,44,201,39,124,
+    220,70,80,237,30,112,244,198,227,104,70,68,197,38,221,100,247,164,86,131,
+    44,168,27,187,173,58,200,136,175,192,79,174,156,41,37,179,59,121,119,73,
+    205,185,67,153,138,11,71,147,72,34,31,104,13,46,1,193,72,148,197,220,172,
+    116,174,168,136,57,113,151,83,80,58,7,103,185,145,9,235,82,3,225,32,101,
+    133,15,73,19,145,113,24,255,31,47,79,26,162,41,134,73,169,165,38,80,186,
+    196,111,48,230,247,17,118,98,158,87,210,178,209,59,241,143,136,157,72,
+    168,98,121,104,136,129,240,185,228,6,95,200,21,92,56,29,195,163,174,48,
+    245,146,203,198,139,126,229,70,63,115,150,202,52,56,142,87,214,160,4,176,
+    180,123,194,38,127,213,129,237,220,202,15,52,63,250,136,29,48,196,227,
+    255,16,146,142,111,225,170,16,37,21,118,206,20,104,84,176,23,141,93,50,
+    0,248,97,232,68,1,76,154,115,174,124,8,122,114,1,96,217,133,36,196,14,
+    242,17,86,92,66,8,238,160,213,49,25,218,136,136,174,231,60,187,37,137,
+    74,77,69,86,65,89,32,146,176,141,7,124,158,208,16,238,182,111,87,166,155,
+    51,227,204,58,10,6,240,180,75,252,251,76,29,59,36,164,115,163,31,218,61,
+    176,11,54,72,196,252,160,241,8,153,192,147,177,243,200,109,232,38,59,17,
+    226,3,55,215,17,135,240,134,195,140,23,179,218,129,71,254,9,156,120,200,
+    245,155,218,49,153,88,21,204,137,10,29,119,105,106,183,15,159,9,242,65,
+    100,247,110,204,120,49,13,143,0,193,143,20,232,86,226,1,198,131,6,175,
+    1,146,239,46,109,140,181,57,169,116,243,196,214,135,234,126,151,139,237,
+    66,144,163,83,55,41,41,55,110,79,133,237,177,129,38,103,12,42,239,4,31,
+    100,28,221,64,49,7,16,187,88,38,62,225,109,73,189,93,253,120,130,149,227,
+    116,169,169,57,154,11,127,237,23,67,190,59,158,168,105,143,28,242,220,
+    69,166,151,134,128,124,109,8,36,111,164,121,205,202,123,131,16,124,12,
+    166,164,163,23,229,241,71,86,20,208,77,21,230,142,97,223,39,80,140,184,
+    51,215,15,19,36,164,190,200,195,77,3,53,228,214,249,224,151,93,78,9,199,
+    236,48,143,131,98,114,131,36,35,182,62,126,236,213,130,198,235,208,197,
+    202,139,67,174,35,15,124,36,146,217,249,216,25,146,33,179,92,71,228,2,
+    14,141,157,179,83,160,151,254,219,131,234,173,156,198,180,1,21,171,132,
+    185,244,239,210,190,117,164,143,224,212,177,14,116,72,197,36,157,107,184,
+    246,99,87,79,238,226,104,81,200,165,113,160,155,112,144,201,14,128,48,
+    28,199,241,208,99,7,221,129,225,123,27,200,20,74,144,57,26,79,190,3,160,
+    249,96,112,16,101,224,220,196,224,116,192,82,70,231,78,2,190,38,32,176,
+    18,17,38,171,217,130,68,199,3,25,120,162,72,221,83,37,127,201,134,28,238,
+    184,117,131,222,193,242,1,103,38,90,183,240,27,128,11,194,240,246,79,216,
+    34,33,3,105,36,22,18,1,68,187,33,30,185,220,165,150,176,77,201,166,97,
+    154,7,114,66,169,200,141,36,201,10,17,241,7,172,221,48,184,233,58,120,
+    41,31,237,54,32,179,107,203,186,59,31,100,123,77,12,84,118,186,144,16,
+    250,26,246,129,178,56,114,163,218,7,175,112,221,144,104,217,234,178,163,
+    166,67,108,227,208,155,237,248,36,73,19,162,206,188,105,109,145,65,145,
+    210,116,155,186,8,220,20,127,228,36,66,17,38,30,240,245,152,70,133,69,
+    10,219,113,112,237,78,95,64,110,156,212,109,132,61,111,150,93,199,160,
+    233,123,34,145,99,131,134,243,246,99,26,231,52,64,131,1,155,63,6,162,131,
+    108,112,99,200,118,219,244,74,143,132,158,174,146,221,1,187,230,249,240,
+    154,133,252,176,113,24,194,27,167,113,234,166,225,144,81,119,162,7,173,
+    107,234,162,26,12,71,81,138,13,69,193,200,105,131,19,7,229,151,93,161,
+    65,189,108,77,25,2,194,216,81,126,111,237,38,248,212,170,184,84,81,94,
+    106,170,215,160,153,25,49,163,160,43,79,145,178,117,219,124,77,60,26,70,
+    89,93,18,51,230,169,115,176,90,158,113,13,184,212,188,209,80,168,138,250,
+    120,62,8,158,6,175,97,138,38,59,164,113,72,121,128,191,135,90,234,40,15,
+    134,239,179,221,166,11,126,238,155,28,51,110,219,177,239,199,156,135,124,
+    76,90,216,65,11,68,7,227,153,105,84,225,65,50,26,40,61,178,7,243,35,83,
+    97,4,228,242,54,78,137,157,219,132,214,6,53,90,76,224,216,236,52,30,172,
+    178,211,49,137,47,244,208,65,66,219,7,234,61,193,240,89,6,132,198,53,28,
+    77,160,130,57,77,19,107,142,65,58,186,60,101,235,182,11,146,129,199,197,
+    43,208,113,240,220,93,242,0,220,197,14,208,8,63,154,55,141,226,195,174,
+    39,98,70,70,111,157,37,192,157,94,98,55,207,166,67,239,129,76,2,60,156,
+    84,214,13,178,70,108,30,183,195,18,148,134,27,167,125,154,16,190,59,20,
+    21,55,80,40,89,211,165,183,162,33,105,10,29,68,41,14,161,160,48,116,122,
+    220,3,61,216,193,110,187,166,86,240,193,110,174,105,114,7,252,228,90,228,
+    201,92,127,29,243,51,19,210,231,73,3,140,225,131,99,90,209,70,46,28,142,
+    193,109,93,220,167,3,139,208,155,165,203,195,54,15,116,15,102,139,3,182,
+    29,137,60,211,232,47,168,62,227,132,238,152,6,10,114,81,177,77,67,204,
+    133,175,108,114,130,52,111,52,154,97,76,135,198,155,109,0,18,154,209,176,
+    93,199,68,130,199,182,121,186,171,195,226,231,195,42,167,13,42,114,130,
+    155,16,206,211,38,81,2,193,187,142,53,113,59,166,121,158,198,173,123,12,
+    188,195,14,46,178,26,134,13,98,80,18,30,81,36,104,239,6,254,220,156,90,
+    17,51,10,151,16,207,184,73,92,114,71,71,41,231,124,68,157,109,253,33,58,
+    79,106,199,22,47,227,37,12,70,102,145,133,238,233,167,109,216,182,33,71,
+    188,142,123,64,236,7,96,37,154,235,33,142,82,17,255,52,3,128,30,231,1,
+    119,211,124,56,97,90,156,130,81,97,2,244,224,121,74,140,52,24,195,228,
+    167,12,74,178,181,109,224,197,121,224,189,214,29,17,5,73,160,244,0,170,
+    167,89,227,154,224,20,186,161,132,214,166,73,250,239,20,247,0,161,213,
+    238,166,184,77,240,30,132,148,250,1,150,195,51,199,128,41,173,141,146,
+    58,246,147,244,134,125,103,16,247,219,116,144,16,169,64,29,117,14,150,
+    195,231,153,58,82,166,233,82,197,15,90,233,116,233,53,20,175,199,69,144,
+    190,21,182,217,167,109,155,54,206,195,147,184,43,249,199,170,217,131,238,
+    201,44,187,97,66,9,88,7,3,204,208,225,43,56,245,33,11,0,92,88,137,235,
+    88,189,90,15,234,47,196,112,36,184,62,77,219,165,57,148,242,209,149,146,
+    130,219,7,94,172,209,14,135,197,3,160,96,1,32,145,29,87,77,240,6,74,114,
+    83,154,60,253,223,83,185,110,56,244,159,90,65,106,67,106,155,236,248,80,
+    30,120,7,207,160,40,12,33,37,174,59,16,175,5,119,72,220,77,147,180,197,
+    64,98,143,9,60,64,129,198,139,205,80,102,198,179,141,119,75,190,111,218,
+    119,12,199,4,77,120,99,114,51,135,0,8,28,59,36,122,252,12,203,145,123,
+    103,120,159,5,240,32,94,110,251,160,104,200,114,167,200,250,15,54,240,
+    26,82,89,241,247,64,182,140,88,100,48,202,96,129,143,45,208,7,95,21,242,
+    86,166,134,163,14,79,51,69,61,27,31,141,176,165,59,224,18,185,193,53,75,
+    249,169,151,165,222,196,167,214,48,201,87,120,173,157,160,236,150,210,
+    117,105,61,84,30,48,41,234,140,200,0,212,201,129,48,228,104,15,202,241,
+    236,97,84,156,100,235,35,213,250,153,2,17,11,161,67,109,146,18,89,130,
+    162,203,210,116,38,213,226,208,136,74,107,153,244,42,1,235,54,161,32,9,
+    38,65,7,131,182,12,54,2,129,193,128,76,53,45,243,113,71,215,234,100,203,
+    140,48,48,102,227,42,20,17,21,169,149,49,29,170,239,32,35,6,243,99,211,
+    11,37,131,13,6,128,249,192,108,30,12,162,177,157,128,28,12,7,16,24,230,
+    29,59,250,201,46,118,49,216,13,227,17,19,186,224,128,227,169,180,83,221,
+    209,190,86,115,191,24,50,9,46,12,114,122,202,168,247,117,14,98,16,36,199,
+    129,242,209,181,72,123,250,217,59,185,215,233,39,246,196,129,130,110,144,
+    70,50,230,6,99,28,206,148,52,132,208,9,1,6,229,117,10,212,105,18,167,95,
+    95,226,107,142,216,41,111,90,202,135,181,20,204,83,151,172,32,30,53,35,
+    142,78,225,138,63,199,150,69,226,73,191,144,163,250,145,139,19,136,49,
+    142,224,32,7,137,30,138,132,238,142,67,111,147,195,115,39,113,135,155,
+    55,114,34,138,67,217,112,75,198,70,128,126,39,214,75,194,195,159,152,88,
+    55,157,65,127,20,32,74,215,61,10,56,80,26,84,192,218,88,56,130,1,83,32,
+    133,167,195,138,101,150,247,112,196,108,85,153,75,131,248,70,57,112,26,
+    16,214,255,29,65,197,6,208,224,140,193,79,154,17,46,241,155,40,213,34,
+    217,14,1,55,197,166,127,54,169,229,199,111,95,191,125,253,246,245,219,
+    215,111,95,191,125,253,127,255,250,139,191,252,203,255,254,159,255,207,
+    191,246,201,223,252,203,71,255,235,127,255,27,167,252,143,127,250,245,
+    63,253,191,221,251,247,255,244,235,255,253,147,143,126,247,243,199,47,
+    252,27,255,61,41,253,245,159,62,104,254,229,154,255,242,99,249,55,247,
+    255,215,127,246,215,127,251,147,79,211,207,31,127,246,31,84,143,255,201,
+    215,207,223,254,238,111,255,234,175,126,255,15,245,163,223,158,
+};
+
+ASSET_REGISTER(hip_dat, "hip.dat", DATA_hip_dat, true)
+
@@ -1,6 +1,6 @@
 // Auto generated from tools/makeassets.py
 
-static const unsigned char DATA_shaders_atmosphere_glsl[3730] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_atmosphere_glsl[6612] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -16,15 +16,86 @@ static const unsigned char DATA_shaders_atmosphere_glsl[3730] __attribute__((ali
     "\n"
     "uniform highp float u_atm_p[12];\n"
     "uniform highp vec3  u_sun;\n"
+    "uniform highp vec3  u_moon;\n"
     "uniform highp float u_tm[3]; // Tonemapping koefs.\n"
     "\n"
+    "/*\n"
+    " * Skybrightness model coefficients, computed per frame on the CPU\n"
+    " * (see atmosphere.c):\n"
+    " *   u_sb[0] - b_night_term.\n"
+    " *   u_sb[1] - b_moon_term.\n"
+    " *   u_sb[2] - b_twilight_term.\n"
+    " *   u_sb[3] - C3 (moon extinction term).\n"
+    " *   u_sb[4] - C4 (sun extinction term).\n"
+    " *   u_sb[5] - K (extinction coefficient).\n"
+    " *   u_sb[6] - Solar eclipse adjustment factor.\n"
+    " *   u_sb[7] - Light pollution luminance.\n"
+    " *   u_sb[8] - Cos of the max grid angular step (anti aliasing clamp).\n"
+    " */\n"
+    "uniform highp float u_sb[9];\n"
+    "\n"
     "varying lowp    vec4        v_color;\n"
     "\n"
     "#ifdef VERTEX_SHADER\n"
     "\n"
     "attribute highp   vec4       a_pos;\n"
     "attribute highp   vec3       a_sky_pos;\n"
-    "attribute highp   float      a_luminance;\n"
+    "\n"
+    "/*\n"
+    " * Luminance (cd/m2) at a given sky position, same model as\n"
+    " * skybrightness.c on the CPU side (B. Schaefer's sky brightness model),\n"
+    " * evaluated here so that only the coefficients are computed per frame.\n"
+    " */\n"
+    "highp float sb_luminance(highp vec3 p)\n"
+    "{\n"
+    "    highp float cos_zenith_dist = p[2];\n"
+    "    // Clamp to the grid angular step and to one degree, to avoid both\n"
+    "    // aliasing near the moon border and issues in the model itself.\n"
+    "    highp float cos_moon_dist = min(min(dot(p, u_moon), u_sb[8]), 0.99985);\n"
+    "    highp float cos_sun_dist  = min(min(dot(p, u_sun),  u_sb[8]), 0.99985);\n"
+    "    highp float moon_dist = acos(cos_moon_dist);\n"
+    "    highp float sun_dist = acos(cos_sun_dist);\n"
+    "\n"
+    "    // Air mass.\n"
+    "    highp float bKX = pow(10.0, -0.4 * u_sb[5] /\n"
+    "            (cos_zenith_dist + 0.025 * exp(-11.0 * cos_zenith_dist)));\n"
+    "\n"
+    "    // Daylight brightness.\n"
+    "    highp float FS = 18886.28 / (sun_dist * sun_dist) +\n"
+    "            pow(10.0, 6.15 - (sun_dist + 0.001) * 1.43239) +\n"
+    "            229086.77 * (1.06 + cos_sun_dist * cos_sun_dist);\n"
+    "    highp float b_daylight = 9.289663e-12 * (1.0 - bKX) *\n"
+    "            (FS * u_sb[4] + 440000.0 * (1.0 - u_sb[4]));\n"
+    "\n"
+    "    // Twilight brightness.\n"
+    "    highp float b_twilight_k = u_sb[2] +\n"
+    "            0.063661977 * acos(cos_zenith_dist) / max(u_sb[5], 0.05);\n"
+    "    highp float b_twilight = (b_twilight_k > -32.0) ? // Underflow guard.\n"
+    "            pow(10.0, b_twilight_k) * (1.7453293 / sun_dist) * (1.0 - bKX) :\n"
+    "            0.0;\n"
+    "\n"
+    "    highp float b_total = min(b_twilight, b_daylight);\n"
+    "\n"
+    "    // Moonlight brightness.\n"
+    "    highp float FM = 18886.28 / (moon_dist * moon_dist) +\n"
+    "            pow(10.0, 6.15 - moon_dist * 1.43239) +\n"
+    "            229086.77 * (1.06 + cos_moon_dist * cos_moon_dist);\n"
+    "    b_total += u_sb[1] * (1.0 - bKX) *\n"
+    "            (FM * u_sb[3] + 440000.0 * (1.0 - u_sb[3])) / 1000000.0;\n"
+    "\n"
+    "    // Dark night sky brightness, only if more than 1% of daylight.\n"
+    "    if (b_total > 0.0 && (u_sb[0] * bKX) / b_total > 0.01) {\n"
+    "        b_total += (0.4 + 0.6 / sqrt(0.04 + 0.96 *\n"
+    "                cos_zenith_dist * cos_zenith_dist)) * u_sb[0] * bKX;\n"
+    "        // Ad-hoc addition to make the sky slightly more blueish.\n"
+    "        b_total += 0.0000000000012;\n"
+    "    }\n"
+    "    b_total = max(b_total, 0.0);\n"
+    "\n"
+    "    // Convert to nano lambert then cd/m2, apply the eclipse factor and\n"
+    "    // add the light pollution.\n"
+    "    return b_total / 1.11e-15 * 3.183e-6 * u_sb[6] + u_sb[7];\n"
+    "}\n"
     "\n"
     "highp float gammaf(highp float c)\n"
     "{\n"
@@ -67,7 +138,7 @@ static const unsigned char DATA_shaders_atmosphere_glsl[3730] __attribute__((ali
     "    xyy.y = ((1. + u_atm_p[6] * exp(u_atm_p[7] / cos_theta)) *\n"
     "             (1. + u_atm_p[8] * exp(u_atm_p[9] * gamma) +\n"
     "              u_atm_p[10] * cos_gamma2)) * u_atm_p[11];\n"
-    "    xyy.z = a_luminance;\n"
+    "    xyy.z = sb_luminance(p);\n"
     "\n"
     "    // Ad-hoc tuning. Scaling before the blue shift allows to obtain proper\n"
     "    // blueish colors at sun set instead of very red, which is a shortcoming\n"
@@ -111,7 +182,7 @@ static const unsigned char DATA_shaders_atmosphere_glsl[3730] __attribute__((ali
     "\n"
     "void main()\n"
     "{\n"
-    "    gl_FragColor = v_color;\n"
+    "    gl_FragColor = color_fx(v_color);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -119,7 +190,7 @@ static const unsigned char DATA_shaders_atmosphere_glsl[3730] __attribute__((ali
 
 ASSET_REGISTER(shaders_atmosphere_glsl, "shaders/atmosphere.glsl", DATA_shaders_atmosphere_glsl, false)
 
-static const unsigned char DATA_shaders_blit_glsl[868] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_blit_glsl[1743] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -132,6 +203,14 @@ static const unsigned char DATA_shaders_blit_glsl[868] __attribute__((aligned(4)
     "uniform mediump vec4        u_color;\n"
     "uniform mediump sampler2D   u_tex;\n"
     "\n"
+    "#ifdef TEX_FALLBACK\n"
+    "// Fallback texture sampled where the main texture is still fading in\n"
+    "// (see hips.c): the whole quad renders in a single pass.\n"
+    "uniform mediump sampler2D   u_fallback_tex;\n"
+    "uniform highp   mat3        u_fallback_mat; // Tex pos -> fallback pos.\n"
+    "uniform lowp    float       u_fallback_blend;\n"
+    "#endif\n"
+    "\n"
     "varying highp   vec2        v_tex_pos;\n"
     "\n"
     "#ifdef VERTEX_SHADER\n"
@@ -150,13 +229,30 @@ static const unsigned char DATA_shaders_blit_glsl[868] __attribute__((aligned(4)
     "\n"
     "void main()\n"
     "{\n"
+    "#ifdef TEX_FALLBACK\n"
+    "    highp vec2 fallback_pos =\n"
+    "        (u_fallback_mat * vec3(v_tex_pos, 1.0)).xy;\n"
+    "#endif\n"
     "#ifndef TEXTURE_LUMINANCE\n"
+    "#ifdef TEX_FALLBACK\n"
+    "    gl_FragColor = mix(texture2D(u_fallback_tex, fallback_pos),\n"
+    "                       texture2D(u_tex, v_tex_pos),\n"
+    "                       u_fallback_blend) * u_color;\n"
+    "#else\n"
     "    gl_FragColor = texture2D(u_tex, v_tex_pos) * u_color;\n"
+    "#endif\n"
     "#else\n"
     "    // Luminance mode: the texture only applies to the alpha channel.\n"
     "    gl_FragColor = u_color;\n"
+    "#ifdef TEX_FALLBACK\n"
+    "    gl_FragColor.a *= mix(texture2D(u_fallback_tex, fallback_pos).r,\n"
+    "                          texture2D(u_tex, v_tex_pos).r,\n"
+    "                          u_fallback_blend);\n"
+    "#else\n"
     "    gl_FragColor.a *= texture2D(u_tex, v_tex_pos).r;\n"
     "#endif\n"
+    "#endif\n"
+    "    gl_FragColor = color_fx(gl_FragColor);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -164,7 +260,7 @@ static const unsigned char DATA_shaders_blit_glsl[868] __attribute__((aligned(4)
 
 ASSET_REGISTER(shaders_blit_glsl, "shaders/blit.glsl", DATA_shaders_blit_glsl, false)
 
-static const unsigned char DATA_shaders_fog_glsl[772] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_fog_glsl[782] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -199,7 +295,7 @@ static const unsigned char DATA_shaders_fog_glsl[772] __attribute__((aligned(4))
     "\n"
     "void main()\n"
     "{\n"
-    "    gl_FragColor = v_color;\n"
+    "    gl_FragColor = color_fx(v_color);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -207,7 +303,7 @@ static const unsigned char DATA_shaders_fog_glsl[772] __attribute__((aligned(4))
 
 ASSET_REGISTER(shaders_fog_glsl, "shaders/fog.glsl", DATA_shaders_fog_glsl, false)
 
-static const unsigned char DATA_shaders_lines_glsl[2238] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_lines_glsl[2281] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -285,6 +381,7 @@ static const unsigned char DATA_shaders_lines_glsl[2238] __attribute__((aligned(
     "#ifdef FADE\n"
     "    gl_FragColor.a *= v_alpha;\n"
     "#endif\n"
+    "    gl_FragColor = color_fx(gl_FragColor);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -292,7 +389,7 @@ static const unsigned char DATA_shaders_lines_glsl[2238] __attribute__((aligned(
 
 ASSET_REGISTER(shaders_lines_glsl, "shaders/lines.glsl", DATA_shaders_lines_glsl, false)
 
-static const unsigned char DATA_shaders_mesh_glsl[1455] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_mesh_glsl[1465] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -359,7 +456,7 @@ static const unsigned char DATA_shaders_mesh_glsl[1455] __attribute__((aligned(4
     "\n"
     "void main()\n"
     "{\n"
-    "    gl_FragColor = u_color;\n"
+    "    gl_FragColor = color_fx(u_color);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -367,7 +464,7 @@ static const unsigned char DATA_shaders_mesh_glsl[1455] __attribute__((aligned(4
 
 ASSET_REGISTER(shaders_mesh_glsl, "shaders/mesh.glsl", DATA_shaders_mesh_glsl, false)
 
-static const unsigned char DATA_shaders_planet_glsl[7286] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_planet_glsl[7329] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -576,6 +673,7 @@ static const unsigned char DATA_shaders_planet_glsl[7286] __attribute__((aligned
     "        lowp float illu = illumination(v_mpos);\n"
     "        gl_FragColor.rgb *= illu;\n"
     "    }\n"
+    "    gl_FragColor = color_fx(gl_FragColor);\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -583,7 +681,7 @@ static const unsigned char DATA_shaders_planet_glsl[7286] __attribute__((aligned
 
 ASSET_REGISTER(shaders_planet_glsl, "shaders/planet.glsl", DATA_shaders_planet_glsl, false)
 
-static const unsigned char DATA_shaders_points_glsl[1185] __attribute__((aligned(4))) =
+static const unsigned char DATA_shaders_points_glsl[1522] __attribute__((aligned(4))) =
     "/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd\n"
     " *\n"
     " * This program is licensed under the terms of the GNU AGPL v3, or\n"
@@ -600,7 +698,13 @@ static const unsigned char DATA_shaders_points_glsl[1185] __attribute__((aligned
     "// 0 -> only halo (not supported), 1 -> no halo\n"
     "uniform lowp float u_core_size;\n"
     "\n"
+    "#ifdef PICK\n"
+    "// Id picking pass: the color carries an encoded object id that must\n"
+    "// survive the roundtrip exactly.\n"
+    "varying mediump vec4 v_color;\n"
+    "#else\n"
     "varying lowp    vec4 v_color;\n"
+    "#endif\n"
     "\n"
     "#ifdef VERTEX_SHADER\n"
     "\n"
@@ -624,6 +728,11 @@ static const unsigned char DATA_shaders_points_glsl[1185] __attribute__((aligned
     "    mediump float k;\n"
     "    dist = 2.0 * distance(gl_PointCoord, vec2(0.5, 0.5));\n"
     "\n"
+    "#ifdef PICK\n"
+    "    // Flat id color over the point disk, no shading.\n"
+    "    if (dist > 1.0) discard;\n"
+    "    gl_FragColor = v_color;\n"
+    "#else\n"
     "    // Center bright point.\n"
     "    k = smoothstep(u_core_size * 1.25, u_core_size * 0.75, dist);\n"
     "\n"
@@ -631,6 +740,8 @@ static const unsigned char DATA_shaders_points_glsl[1185] __attribute__((aligned
     "    k += smoothstep(1.0, 0.0, dist) * 0.08;\n"
     "    gl_FragColor.rgb = v_color.rgb;\n"
     "    gl_FragColor.a = v_color.a * clamp(k, 0.0, 1.0);\n"
+    "    gl_FragColor = color_fx(gl_FragColor);\n"
+    "#endif\n"
     "}\n"
     "\n"
     "#endif\n"
@@ -638,3 +749,72 @@ static const unsigned char DATA_shaders_points_glsl[1185] __attribute__((aligned
 
 ASSET_REGISTER(shaders_points_glsl, "shaders/points.glsl", DATA_shaders_points_glsl, false)
 
+static const unsigned char DATA_shaders_vg_glsl[1900] __attribute__((aligned(4))) =
+    "/* Stellarium Web Engine - Copyright (c) 2022 - Noctua Software Ltd\n"
+    " *\n"
+    " * This program is licensed under the terms of the GNU AGPL v3, or\n"
+    " * alternatively under a commercial licence.\n"
+    " *\n"
+    " * The terms of the AGPL v3 license can be found in the main directory of this\n"
+    " * repository.\n"
+    " */\n"
+    "\n"
+    "uniform   lowp      vec2    u_win_size;\n"
+    "\n"
+    "// Shape position in the local (unrotated) frame, in pixels.\n"
+    "varying   mediump   vec2    v_pos;\n"
+    "// x, y: shape half size (pixels), z: stroke width, w: number of dashes.\n"
+    "varying   mediump   vec4    v_shape;\n"
+    "varying   lowp      vec4    v_color;\n"
+    "\n"
+    "#ifdef VERTEX_SHADER\n"
+    "\n"
+    "attribute highp     vec2    a_pos;\n"
+    "attribute mediump   vec2    a_tex_pos;\n"
+    "attribute mediump   vec4    a_shape;\n"
+    "attribute lowp      vec4    a_color;\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = vec4((a_pos / u_win_size - 0.5) * vec2(2.0, -2.0),\n"
+    "                       0.0, 1.0);\n"
+    "    v_pos = a_tex_pos;\n"
+    "    v_shape = a_shape;\n"
+    "    v_color = a_color;\n"
+    "}\n"
+    "\n"
+    "#endif\n"
+    "#ifdef FRAGMENT_SHADER\n"
+    "\n"
+    "void main()\n"
+    "{\n"
+    "    mediump vec2 size = v_shape.xy;\n"
+    "    mediump float d;\n"
+    "#ifdef RECT\n"
+    "    // Signed distance to the rectangle border.\n"
+    "    mediump vec2 q = abs(v_pos) - size;\n"
+    "    d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0);\n"
+    "#else\n"
+    "    // Approximated signed distance to the ellipse border.\n"
+    "    d = (length(v_pos / size) - 1.0) * min(size.x, size.y);\n"
+    "#endif\n"
+    "    // Antialiased stroke of width v_shape.z around the border.\n"
+    "    mediump float alpha = 1.0 - smoothstep(v_shape.z * 0.5 - 0.7,\n"
+    "                                           v_shape.z * 0.5 + 0.7, abs(d));\n"
+    "#ifndef RECT\n"
+    "    if (v_shape.w > 0.0) {\n"
+    "        // Dash effect: modulate along the angular coordinate.\n"
+    "        mediump float theta = atan(v_pos.y * size.x, v_pos.x * size.y);\n"
+    "        alpha *= step(0.5, fract(theta / 6.28318530718 * v_shape.w));\n"
+    "    }\n"
+    "#endif\n"
+    "    gl_FragColor = color_fx(v_color);\n"
+    "    gl_FragColor.a *= alpha;\n"
+    "    if (gl_FragColor.a == 0.0) discard;\n"
+    "}\n"
+    "\n"
+    "#endif\n"
+    "";
+
+ASSET_REGISTER(shaders_vg_glsl, "shaders/vg.glsl", DATA_shaders_vg_glsl, false)
+
@@ -1,21 +1,77 @@
 // Auto generated from tools/makeassets.py
 
-static const unsigned char DATA_symbols_png[286] __attribute__((aligned(4))) =
+static const unsigned char DATA_symbols_png[1438] __attribute__((aligned(4))) =
 {
-    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,128,0,0,0,128,8,0,
-    0,0,0,230,85,62,23,0,0,0,229,73,68,65,84,120,156,237,211,177,113,194,64,
-    0,68,209,149,107,128,30,24,98,7,52,0,74,92,129,34,138,184,54,48,51,30,
-    69,238,135,204,17,109,144,251,112,226,117,112,194,114,5,90,7,255,69,151,
-    237,159,211,73,194,191,208,223,206,93,116,191,218,99,176,96,95,237,104,
-    193,197,206,22,28,106,188,224,179,21,188,199,10,250,233,14,142,169,128,
-    169,160,238,52,156,86,185,130,218,171,216,215,117,170,160,237,231,10,182,
-    155,182,159,43,120,236,199,10,6,255,122,93,110,245,105,62,62,207,199,143,
-    229,2,254,88,95,31,23,80,34,251,115,65,209,102,155,44,40,237,151,140,21,
-    20,245,213,190,135,10,86,167,65,187,106,231,10,36,29,219,75,72,125,5,169,
-    123,107,5,95,47,177,130,209,223,182,125,63,4,11,108,219,151,84,192,116,
-    7,117,31,11,80,55,38,95,161,36,117,231,91,116,31,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,203,249,1,241,30,175,189,100,192,115,42,0,0,0,0,73,69,78,
-    68,174,66,96,130,
+    137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,0,0,0,1,0,8,0,0,0,
+    0,121,25,247,186,0,0,5,101,73,68,65,84,120,218,237,157,61,146,155,60,24,
+    128,217,27,80,36,61,101,38,149,203,148,52,201,54,57,193,86,62,194,22,62,
+    0,23,72,152,201,164,74,195,17,124,4,170,212,204,228,2,57,64,10,186,207,
+    95,154,40,128,215,54,120,13,232,15,73,27,158,167,139,157,119,37,30,64,
+    255,178,162,8,0,0,0,0,0,0,0,236,145,108,139,82,52,148,133,105,252,54,241,
+    17,111,202,94,156,40,117,194,211,75,124,195,62,117,29,111,78,33,246,143,
+    93,178,233,70,227,238,181,247,174,141,23,34,74,31,219,107,41,19,173,248,
+    54,125,141,120,27,196,177,126,236,182,22,117,214,197,55,2,218,191,149,
+    53,31,108,117,226,159,242,162,24,31,221,255,202,239,60,150,30,121,115,
+    247,158,178,127,20,208,92,66,115,23,115,141,248,179,2,149,248,232,254,
+    32,196,215,59,159,215,127,190,91,39,1,205,93,149,190,130,126,124,239,169,
+    144,55,240,254,208,150,27,11,24,136,165,138,162,109,63,255,23,1,195,207,
+    101,227,37,62,127,206,247,99,201,105,223,64,85,75,148,68,73,221,207,103,
+    79,64,115,5,234,241,67,3,50,241,13,31,14,11,25,216,203,212,136,165,216,
+    71,183,5,232,196,171,167,223,25,248,239,104,224,155,134,129,52,27,47,253,
+    227,90,204,190,4,169,168,227,49,1,26,241,202,233,95,74,193,150,173,206,
+    93,206,198,191,204,198,239,206,72,252,64,128,70,188,114,250,3,3,135,119,
+    209,195,167,87,106,45,24,33,38,234,255,88,136,68,45,126,40,64,61,94,53,
+    253,129,129,195,125,180,19,226,199,107,165,38,204,180,227,253,220,67,117,
+    29,63,20,160,30,175,154,126,223,192,241,250,21,13,20,226,113,234,235,71,
+    81,168,197,95,9,80,142,87,77,191,199,219,55,199,235,87,51,80,78,23,51,
+    233,92,57,124,29,127,37,64,57,94,53,253,1,187,83,95,74,193,192,85,134,
+    141,191,159,251,183,237,244,251,60,92,122,147,159,29,10,152,195,157,128,
+    207,151,68,31,156,245,3,66,18,240,250,199,41,205,93,228,80,64,56,175,192,
+    217,192,46,122,243,214,149,128,160,10,193,39,3,187,99,149,232,106,28,41,
+    152,106,240,100,96,215,53,138,254,119,100,32,156,134,208,145,87,159,30,
+    162,119,93,179,216,145,129,96,154,194,195,129,132,174,99,224,198,64,32,
+    157,161,62,119,95,142,6,126,127,148,250,239,217,207,216,68,64,24,221,225,
+    43,3,95,197,159,238,45,248,32,87,142,239,141,30,129,16,6,68,110,24,232,
+    248,46,245,22,143,15,73,109,212,227,189,12,137,141,61,3,135,247,178,101,
+    198,214,36,125,255,131,162,35,207,128,116,41,104,58,44,237,125,88,252,
+    166,129,252,151,124,45,96,58,49,225,125,98,196,188,57,83,139,186,223,34,
+    211,159,218,242,52,53,102,222,158,41,123,79,97,106,48,185,249,114,39,71,
+    211,126,213,236,97,122,219,255,244,120,255,137,212,178,255,210,23,72,0,
+    0,0,0,0,0,0,0,192,58,169,170,149,11,80,90,146,130,0,4,32,0,1,8,64,0,2,
+    16,128,0,4,4,129,239,233,105,173,248,106,110,181,189,116,223,196,247,2,
+    5,205,120,211,253,6,103,251,134,75,76,188,197,91,218,47,96,186,200,200,
+    95,188,29,1,22,151,185,185,142,183,34,192,230,66,71,215,241,54,4,152,46,
+    53,245,26,111,65,128,233,98,99,191,241,22,4,152,46,55,247,27,111,46,192,
+    116,195,129,231,120,115,1,150,247,255,187,142,55,22,96,123,255,191,235,
+    120,99,1,182,247,255,187,142,55,22,96,123,255,191,235,120,99,1,182,247,
+    255,187,142,55,22,176,244,230,228,208,191,215,250,3,149,210,246,246,233,
+    190,57,2,94,162,128,127,234,21,88,125,33,184,250,106,112,245,13,161,213,
+    55,133,87,223,25,162,59,188,250,1,17,134,196,86,63,40,202,176,56,19,35,
+    76,141,49,57,26,173,126,122,188,187,11,235,94,32,97,9,214,8,33,0,1,8,64,
+    0,2,16,128,0,4,32,96,165,172,126,227,36,0,0,0,0,0,0,0,0,132,142,197,233,
+    229,203,244,182,94,86,252,252,60,190,189,5,6,151,5,14,90,135,251,248,58,
+    32,193,222,18,147,226,188,196,101,163,113,247,189,29,145,209,191,192,120,
+    155,231,250,2,98,131,19,183,60,30,146,114,185,192,164,184,245,244,58,25,
+    231,247,121,76,206,249,92,159,188,125,6,179,141,15,1,139,28,148,164,40,
+    32,105,106,131,124,248,214,197,230,2,98,169,162,108,145,163,178,20,5,36,
+    181,168,54,215,175,101,98,44,160,242,118,88,154,170,128,74,84,241,179,
+    6,66,247,145,145,0,111,199,229,41,11,216,20,207,138,240,184,234,94,193,
+    89,1,105,54,94,250,251,58,48,209,78,59,96,211,237,215,153,21,224,123,203,
+    205,130,13,161,188,221,178,54,39,192,247,166,169,37,5,116,121,155,19,224,
+    123,219,220,162,77,225,54,245,57,1,190,55,78,46,42,32,107,138,193,57,1,
+    190,183,206,46,42,160,77,61,248,205,207,8,48,23,48,249,20,46,157,1,4,4,
+    32,32,159,106,138,44,157,129,16,10,193,201,170,120,105,1,33,84,131,147,
+    205,173,165,5,4,209,16,42,38,70,30,150,22,16,68,83,184,201,196,198,91,
+    33,20,68,103,40,175,12,4,100,63,99,147,12,4,209,29,190,145,131,88,90,64,
+    105,120,151,130,24,16,121,62,24,80,21,178,2,38,134,180,164,38,8,130,24,
+    18,187,206,83,46,78,99,100,18,101,192,248,160,166,92,254,67,24,20,189,
+    60,249,105,154,102,237,196,76,30,203,23,130,190,127,127,192,166,128,244,
+    56,53,87,36,74,181,128,239,223,31,176,40,96,83,150,101,190,141,85,171,
+    193,118,106,171,223,162,115,253,251,3,254,59,35,73,217,123,138,83,247,
+    191,63,96,34,192,210,244,120,58,120,143,220,255,254,128,46,139,236,191,
+    247,243,251,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,255,44,127,1,3,237,89,30,87,27,72,85,0,0,0,0,73,
+    69,78,68,174,66,96,130,
 };
 
 ASSET_REGISTER(symbols_png, "symbols.png", DATA_symbols_png, false)
@@ -0,0 +1,198 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+#include "swe.h"
+
+/*
+ * Accuracy-versus-speed benchmark matrix of the ephemeris algorithms
+ * (moon, l1, orbit, deltat): each algorithm is timed over a range of
+ * representative epochs at its different precision settings, with the
+ * error measured against the full precision run.  The report is
+ * retrieved as json by swe_bench_ephemeris, and wired into the
+ * 'make benchmark' target (html/benchmark.js), so the precision
+ * truncation features can be tuned against hard data and regressions
+ * in either axis get caught.
+ */
+
+#define BENCH_SAMPLES 512
+#define BENCH_REPS 16
+
+// Accumulator preventing the compiler from dropping the benched calls.
+static volatile double g_sink;
+
+static void push_result(json_value *out, const char *algo, double prec,
+                        double ns_call, double max_err, const char *unit)
+{
+    json_value *val;
+    val = json_object_new(0);
+    json_object_push(val, "algo", json_string_new(algo));
+    json_object_push(val, "prec", json_double_new(prec));
+    json_object_push(val, "ns_call", json_double_new(ns_call));
+    json_object_push(val, "max_err", json_double_new(max_err));
+    json_object_push(val, "err_unit", json_string_new(unit));
+    json_array_push(out, val);
+}
+
+static void bench_moon(json_value *out)
+{
+    // 1900 to 2100, the range the truncated series should stay sane on.
+    const double mjd0 = 15020, mjd1 = 88069;
+    const double precs[] = {0, 1e-6, 1e-5, 1e-4}; // rad.
+    double ref[BENCH_SAMPLES][2];
+    double jde, lambda, beta, dist, t, ns, err;
+    int i, p, r;
+
+    for (p = 0; p < ARRAY_SIZE(precs); p++) {
+        err = 0;
+        t = sys_get_unix_time();
+        for (r = 0; r < BENCH_REPS; r++) {
+            for (i = 0; i < BENCH_SAMPLES; i++) {
+                jde = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES) + 2400000.5;
+                moon_pos(jde, precs[p], &lambda, &beta, &dist);
+                g_sink += lambda;
+            }
+        }
+        ns = (sys_get_unix_time() - t) / (BENCH_REPS * BENCH_SAMPLES) * 1e9;
+        // Last rep against the full precision reference.
+        for (i = 0; i < BENCH_SAMPLES; i++) {
+            jde = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES) + 2400000.5;
+            moon_pos(jde, precs[p], &lambda, &beta, &dist);
+            if (precs[p] == 0) {
+                ref[i][0] = lambda;
+                ref[i][1] = beta;
+            } else {
+                err = max(err, eraSeps(lambda, beta, ref[i][0], ref[i][1]));
+            }
+        }
+        push_result(out, "moon_pos", precs[p], ns, err * ERFA_DR2AS,
+                    "arcsec");
+    }
+}
+
+static void bench_l1(json_value *out)
+{
+    // The l1 theory is fitted around J2000: stay within 1950-2050.
+    const double mjd0 = 33282, mjd1 = 69807;
+    const double precs[] = {0, 1e-7, 1e-6}; // rad.
+    double ref[BENCH_SAMPLES][3];
+    double mjd, pv[2][3], d[3], t, ns, err;
+    int i, p, r;
+
+    for (p = 0; p < ARRAY_SIZE(precs); p++) {
+        err = 0;
+        t = sys_get_unix_time();
+        for (r = 0; r < BENCH_REPS; r++) {
+            for (i = 0; i < BENCH_SAMPLES; i++) {
+                mjd = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES);
+                l12(ERFA_DJM0, mjd, 0, precs[p], pv);
+                g_sink += pv[0][0];
+            }
+        }
+        ns = (sys_get_unix_time() - t) / (BENCH_REPS * BENCH_SAMPLES) * 1e9;
+        for (i = 0; i < BENCH_SAMPLES; i++) {
+            mjd = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES);
+            l12(ERFA_DJM0, mjd, 0, precs[p], pv);
+            if (precs[p] == 0) {
+                vec3_copy(pv[0], ref[i]);
+            } else {
+                vec3_sub(pv[0], ref[i], d);
+                err = max(err, vec3_norm(d));
+            }
+        }
+        push_result(out, "l12", precs[p], ns, err * ERFA_DAU / 1000, "km");
+    }
+}
+
+static void bench_orbit(json_value *out)
+{
+    // Halley-like elements: high eccentricity stresses the kepler
+    // equation solver.
+    const double el_d = 49400.0, el_i = 162.26 * DD2R, el_o = 58.42 * DD2R,
+                 el_w = 111.33 * DD2R, el_a = 17.83, el_e = 0.967;
+    const double el_n = 2 * M_PI / (75.32 * 365.25);
+    const double mjd0 = 15020, mjd1 = 88069;
+    // 0 uses the fast series approximation instead of the iteration.
+    const double precs[] = {1e-12, 1e-6, 0};
+    double ref[BENCH_SAMPLES][3];
+    double mjd, pos[3], d[3], t, ns, err;
+    int i, p, r;
+
+    for (p = 0; p < ARRAY_SIZE(precs); p++) {
+        err = 0;
+        t = sys_get_unix_time();
+        for (r = 0; r < BENCH_REPS; r++) {
+            for (i = 0; i < BENCH_SAMPLES; i++) {
+                mjd = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES);
+                orbit_compute_pv(precs[p], mjd, pos, NULL, el_d, el_i, el_o,
+                                 el_w, el_a, el_n, el_e, 0.1, 0, 0);
+                g_sink += pos[0];
+            }
+        }
+        ns = (sys_get_unix_time() - t) / (BENCH_REPS * BENCH_SAMPLES) * 1e9;
+        for (i = 0; i < BENCH_SAMPLES; i++) {
+            mjd = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES);
+            orbit_compute_pv(precs[p], mjd, pos, NULL, el_d, el_i, el_o,
+                             el_w, el_a, el_n, el_e, 0.1, 0, 0);
+            if (p == 0) {
+                vec3_copy(pos, ref[i]);
+            } else {
+                vec3_sub(pos, ref[i], d);
+                err = max(err, vec3_norm(d));
+            }
+        }
+        push_result(out, "orbit_compute_pv", precs[p], ns,
+                    err * ERFA_DAU / 1000, "km");
+    }
+}
+
+static void bench_deltat(json_value *out)
+{
+    const double mjd0 = 15020, mjd1 = 88069;
+    double mjd, t, ns;
+    int i, r;
+
+    t = sys_get_unix_time();
+    for (r = 0; r < BENCH_REPS; r++) {
+        for (i = 0; i < BENCH_SAMPLES; i++) {
+            mjd = mix(mjd0, mjd1, (double)i / BENCH_SAMPLES);
+            g_sink += deltat(mjd);
+        }
+    }
+    ns = (sys_get_unix_time() - t) / (BENCH_REPS * BENCH_SAMPLES) * 1e9;
+    // Single algorithm: no precision knob, so no error axis.
+    push_result(out, "deltat", 0, ns, 0, "s");
+}
+
+/*
+ * Function: swe_bench_ephemeris
+ * Run the ephemeris benchmark matrix and return the report as a newly
+ * allocated json string.  Caller should free it.
+ */
+EMSCRIPTEN_KEEPALIVE
+char *swe_bench_ephemeris(void)
+{
+    char *ret;
+    int size;
+    json_value *out;
+    json_serialize_opts opts = {
+        .mode = json_serialize_mode_multiline,
+        .indent_size = 4,
+    };
+
+    out = json_array_new(0);
+    bench_moon(out);
+    bench_l1(out);
+    bench_orbit(out);
+    bench_deltat(out);
+    size = json_measure_ex(out, opts);
+    ret = calloc(1, size);
+    json_serialize_ex(ret, out, opts);
+    json_builder_free(out);
+    return ret;
+}
@@ -48,6 +48,178 @@ static json_value *core_fn_progressbars(obj_t *obj, const attribute_t *attr,
     return ret;
 }
 
+static json_value *core_fn_hips_stats(obj_t *obj, const attribute_t *attr,
+                                      const json_value *args)
+{
+    return hips_stats_report();
+}
+
+static json_value *core_fn_gpu_times(obj_t *obj, const attribute_t *attr,
+                                     const json_value *args)
+{
+    if (!core->rend) return json_object_new(0);
+    return render_gl_gpu_times(core->rend);
+}
+
+static json_value *core_fn_perf_counters(obj_t *obj, const attribute_t *attr,
+                                         const json_value *args)
+{
+    return module_perf_report();
+}
+
+static json_value *core_fn_frame_trace(obj_t *obj, const attribute_t *attr,
+                                       const json_value *args)
+{
+    return module_perf_trace_report();
+}
+
+static json_value *core_fn_mem_stats(obj_t *obj, const attribute_t *attr,
+                                     const json_value *args)
+{
+    json_value *ret, *val;
+    int tag;
+
+    ret = json_array_new(MEM_TAG_COUNT);
+    for (tag = 0; tag < MEM_TAG_COUNT; tag++) {
+        val = json_object_new(0);
+        json_object_push(val, "tag", json_string_new(mem_tag_name(tag)));
+        json_object_push(val, "bytes", json_integer_new(mem_get_total(tag)));
+        json_object_push(val, "peak", json_integer_new(mem_get_peak(tag)));
+        json_array_push(ret, val);
+    }
+    return ret;
+}
+
+static json_value *core_fn_cache_stats(obj_t *obj, const attribute_t *attr,
+                                       const json_value *args)
+{
+    json_value *ret, *val, *hist;
+    cache_t *cache = NULL;
+    cache_stats_t stats;
+    void *iter = NULL;
+    int i, nb;
+
+    ret = json_array_new(0);
+    while ((cache = cache_iter_(&iter))) {
+        cache_get_stats(cache, &stats);
+        val = json_object_new(0);
+        json_object_push(val, "name", json_string_new(stats.name));
+        json_object_push(val, "max_size", json_integer_new(stats.max_size));
+        json_object_push(val, "size", json_integer_new(stats.size));
+        json_object_push(val, "items", json_integer_new(stats.nb_items));
+        json_object_push(val, "hits", json_integer_new(stats.hits));
+        json_object_push(val, "misses", json_integer_new(stats.misses));
+        json_object_push(val, "adds", json_integer_new(stats.adds));
+        json_object_push(val, "evictions",
+                         json_integer_new(stats.evictions));
+        // Histograms are trimmed of their empty tail buckets.
+        for (nb = CACHE_STATS_HIST; nb > 0; nb--) {
+            if (stats.age_hist[nb - 1] || stats.reuse_hist[nb - 1])
+                break;
+        }
+        hist = json_array_new(nb);
+        for (i = 0; i < nb; i++)
+            json_array_push(hist, json_integer_new(stats.age_hist[i]));
+        json_object_push(val, "age_hist", hist);
+        hist = json_array_new(nb);
+        for (i = 0; i < nb; i++)
+            json_array_push(hist, json_integer_new(stats.reuse_hist[i]));
+        json_object_push(val, "reuse_hist", hist);
+        json_array_push(ret, val);
+    }
+    return ret;
+}
+
+/*
+ * Selection info channel for the GUI: the panel used to query every info
+ * and the designations each frame through the generic json path.  Here
+ * the values are grouped by how fast they can perceptibly change:
+ * position every call, photometry at 1 Hz, designations and type once
+ * per selection.  Layered on top of the obj_get_info memo cache, so a
+ * repeated query within the same observer state stays cheap too.
+ */
+#define SEL_INFO_SLOW_PERIOD_S 1.0
+
+static struct {
+    const obj_t *obj;       // Selection the cache was built for.
+    json_value *names;      // Designations, computed once per selection.
+    double slow_time;       // Time of the last slow refresh (0 = never).
+    double vmag, distance, phase, radius;
+} g_sel_info = {};
+
+static void sel_info_add_name(const obj_t *obj, void *user, const char *dsgn)
+{
+    json_array_push(user, json_string_new(dsgn));
+}
+
+// Push a double value, using null for NAN so the json stays valid.
+static void sel_info_push_f(json_value *obj, const char *name, double v)
+{
+    json_object_push(obj, name, isnan(v) ? json_null_new()
+                                         : json_double_new(v));
+}
+
+static json_value *core_fn_selection_info(obj_t *obj, const attribute_t *attr,
+                                          const json_value *args)
+{
+    obj_t *sel = core->selection;
+    json_value *ret, *arr;
+    double v[4] = {NAN, NAN, NAN, NAN}, t;
+    int i;
+
+    if (!sel) return json_null_new();
+
+    if (g_sel_info.obj != sel) {
+        if (g_sel_info.names) json_builder_free(g_sel_info.names);
+        g_sel_info.names = json_array_new(0);
+        obj_get_designations(sel, g_sel_info.names, sel_info_add_name);
+        g_sel_info.obj = sel;
+        g_sel_info.slow_time = 0;
+    }
+
+    t = sys_get_unix_time();
+    if (t - g_sel_info.slow_time >= SEL_INFO_SLOW_PERIOD_S) {
+        g_sel_info.slow_time = t;
+        if (obj_get_info(sel, core->observer, INFO_VMAG, v))
+            v[0] = NAN;
+        g_sel_info.vmag = v[0];
+        if (obj_get_info(sel, core->observer, INFO_DISTANCE, v))
+            v[0] = NAN;
+        g_sel_info.distance = v[0];
+        if (obj_get_info(sel, core->observer, INFO_PHASE, v))
+            v[0] = NAN;
+        g_sel_info.phase = v[0];
+        if (obj_get_info(sel, core->observer, INFO_RADIUS, v))
+            v[0] = NAN;
+        g_sel_info.radius = v[0];
+    }
+
+    ret = json_object_new(0);
+    json_object_push(ret, "names", json_copy(g_sel_info.names));
+    json_object_push(ret, "type",
+                     json_string_new_length(strnlen(sel->type, 4),
+                                            sel->type));
+
+    // Position info, refreshed at every call.
+    if (obj_get_info(sel, core->observer, INFO_RADEC, v) == 0) {
+        arr = json_array_new(4);
+        for (i = 0; i < 4; i++)
+            json_array_push(arr, json_double_new(v[i]));
+        json_object_push(ret, "radec", arr);
+    }
+    if (obj_get_info(sel, core->observer, INFO_LHA, v) == 0)
+        sel_info_push_f(ret, "lha", v[0]);
+
+    // Photometry, refreshed at SEL_INFO_SLOW_PERIOD_S.
+    sel_info_push_f(ret, "vmag", g_sel_info.vmag);
+    sel_info_push_f(ret, "distance", g_sel_info.distance);
+    sel_info_push_f(ret, "phase", g_sel_info.phase);
+    sel_info_push_f(ret, "radius", g_sel_info.radius);
+    return ret;
+}
+
+static obj_t *core_lazy_module_create(const char *id, int len);
+
 static obj_t *core_get(const obj_t *obj, const char *id, int flags)
 {
     obj_t *module;
@@ -57,7 +229,7 @@ static obj_t *core_get(const obj_t *obj, const char *id, int flags)
         ret = obj_get(module, id, flags);
         if (ret) return ret;
     }
-    return NULL;
+    return core_lazy_module_create(id, strlen(id));
 }
 
 EMSCRIPTEN_KEEPALIVE
@@ -76,14 +248,16 @@ obj_t *core_get_module(const char *id)
         len = end - id;
         DL_FOREACH(ret->children, m) {
             if (!m->id) continue;
-            if (strncmp(m->id, id, len) == 0 && m->id[len] == '\0') {
-                ret = m;
-                id += len;
-                if (*id == '.') id++;
+            if (strncmp(m->id, id, len) == 0 && m->id[len] == '\0')
                 break;
-            }
         }
+        // A top level module whose creation was deferred?
+        if (!m && ret == (obj_t*)core)
+            m = core_lazy_module_create(id, len);
         if (!m) return NULL;
+        ret = m;
+        id += len;
+        if (*id == '.') id++;
     }
     return ret;
 }
@@ -107,6 +281,52 @@ static int modules_sort_cmp(void *a, void *b)
     return cmp(module_get_render_order(at), module_get_render_order(bt));
 }
 
+/*
+ * Create a module whose klass is flagged <OBJ_MODULE_LAZY> on its first
+ * lookup, so that deferring its init never breaks a by-id access.
+ * Return NULL if no lazy klass matches the (non NUL terminated) id.
+ */
+static obj_t *core_lazy_module_create(const char *id, int len)
+{
+    obj_klass_t *klass;
+    obj_t *module;
+
+    for (klass = obj_get_all_klasses(); klass; klass = klass->next) {
+        if (!(klass->flags & OBJ_MODULE_LAZY)) continue;
+        if (strncmp(klass->id, id, len) != 0 || klass->id[len]) continue;
+        module = module_add_new(&core->obj, klass->id, klass->id, NULL);
+        module_sort_children(&core->obj, modules_sort_cmp);
+        return module;
+    }
+    return NULL;
+}
+
+// Per frame time budget granted to the tasks: the slack left in a 60 fps
+// frame after a typical update and render.
+#define TASKS_BUDGET_S (4. / 1000)
+
+/*
+ * Per frame piecewise linear table of the raw point size curve
+ * (<core_get_point_for_mag_>), which within a frame is a pure function
+ * of the magnitude.  The per star queries then reduce to a table lookup
+ * plus the radius shaping, instead of running the telescope and
+ * tonemapper math millions of times per frame.
+ */
+#define POINT_TABLE_SIZE 256
+#define POINT_TABLE_MAG_MIN (-2.0)
+#define POINT_TABLE_MAG_MAX 24.0
+static struct {
+    bool valid;
+    float radius[POINT_TABLE_SIZE];
+    float luminance[POINT_TABLE_SIZE];
+} g_point_table;
+
+static int tasks_sort_cmp(void *a_, void *b_)
+{
+    const task_t *a = a_, *b = b_;
+    return cmp(b->priority + b->age, a->priority + a->age);
+}
+
 
 /*
  * Function: core_get_proj
@@ -133,11 +353,16 @@ obj_t *core_get_obj_at(double x, double y, double max_dist)
     double pos[2] = {x, y};
     uint64_t oid, hint;
 
-    // First test the labels, and then the global shape area.
+    // First test the labels, then the id-buffer if in use, and then the
+    // global shape area (that still holds the non point shapes).
     oid = labels_get_obj_at(pos, 0);
     if (oid) {
         return obj_get_by_oid(NULL, oid, 0);
     }
+    if (core->gpu_picking && core->rend &&
+            render_gl_pick(core->rend, pos, max_dist, &oid, &hint) && oid) {
+        return obj_get_by_oid(NULL, oid, hint);
+    }
     if (areas_lookup(core->areas, pos, max_dist, &oid, &hint) && oid) {
         return obj_get_by_oid(NULL, oid, hint);
     }
@@ -181,6 +406,9 @@ static void core_set_default(void)
     core->lwsky_average = 0.0001;  // Updated by atmosphere rendering
     core->exposure_scale = 2;
     core->tonemapper_p = 2.2;     // Setup using atmosphere as reference
+    core->dimming = 1.0;
+    core->quality = 1.0;
+    core->render_scale = 1.0;
 
     tonemapper_update(&core->tonemapper, core->tonemapper_p, 1, 1, core->lwmax);
 
@@ -195,15 +423,188 @@ static void on_progressbar(const char *id)
 }
 
 // Callback for texture loading.
-static uint8_t *texture_load_function(
-        void *user, const char *url, int *code,
-        int *w, int *h, int *bpp)
+static const void *texture_load_function(
+        void *user, const char *url, int *code, int *size)
+{
+    // The texture layer decodes the image in the worker pool, we only
+    // provide the raw file data.
+    return asset_get_data(url, size, code);
+}
+
+static const void *texture_partial_load_function(
+        void *user, const char *url, int *size)
 {
-    const void *data;
+    return asset_get_partial_data(url, size);
+}
+
+/*
+ * Warm state snapshot: we serialize the observer / view state and the
+ * list of online resources currently loaded, so that a restarted
+ * instance (e.g. a kiosk) can restore the scene and re-warm its caches
+ * without waiting for the first navigation to request everything again.
+ */
+#define SNAPSHOT_MAX_URLS 512
+#define SNAPSHOT_WINDOW 16
+
+typedef struct {
+    char **urls;
+    int nb;
+    int cursor;
+} snapshot_prefetch_t;
+
+static int snapshot_prefetch_task(task_t *task, double dt)
+{
+    snapshot_prefetch_t *p = task->user;
+    int i, end, code;
+
+    // Advance past the completed downloads.  Once a resource is warmed
+    // (in the request disk cache) we don't keep it resident.
+    while (p->cursor < p->nb) {
+        asset_get_data2(p->urls[p->cursor],
+                        ASSET_PRIORITY_LOW | ASSET_ACCEPT_404, NULL, &code);
+        if (code == 0) break;
+        asset_release(p->urls[p->cursor]);
+        p->cursor++;
+    }
+    // Keep a window of downloads in flight behind the head.
+    end = min(p->cursor + SNAPSHOT_WINDOW, p->nb);
+    for (i = p->cursor + 1; i < end; i++)
+        asset_get_data2(p->urls[i],
+                        ASSET_PRIORITY_LOW | ASSET_ACCEPT_404, NULL, &code);
+    if (p->cursor < p->nb) return 0;
+    for (i = 0; i < p->nb; i++) free(p->urls[i]);
+    free(p->urls);
+    free(p);
+    return 1;
+}
+
+static void snapshot_path(char *buf, int size)
+{
+    snprintf(buf, size, "%s/snapshot.json", sys_get_user_dir());
+}
+
+EMSCRIPTEN_KEEPALIVE
+int core_snapshot_save(void)
+{
+    char path[1024];
+    const char *url;
+    json_value *root, *urls;
+    json_serialize_opts opts = {
+        .mode = json_serialize_mode_multiline,
+        .indent_size = 4,
+    };
+    char *buf;
+    int size, nb = 0;
+    double v;
+    FILE *file;
+
+    root = json_object_new(0);
+    json_object_push(root, "version", json_integer_new(1));
+#define SAVE_ATTR(obj_, name_) do { \
+        obj_get_attr((obj_t*)(obj_), name_, &v); \
+        json_object_push(root, name_, json_double_new(v)); \
+    } while (0)
+    SAVE_ATTR(core->observer, "utc");
+    SAVE_ATTR(core->observer, "longitude");
+    SAVE_ATTR(core->observer, "latitude");
+    SAVE_ATTR(core->observer, "elevation");
+    SAVE_ATTR(core->observer, "yaw");
+    SAVE_ATTR(core->observer, "pitch");
+    SAVE_ATTR(core, "fov");
+#undef SAVE_ATTR
+
+    urls = json_array_new(0);
+    ASSET_ITER("http", url) {
+        if (nb >= SNAPSHOT_MAX_URLS) break;
+        json_array_push(urls, json_string_new(url));
+        nb++;
+    }
+    json_object_push(root, "urls", urls);
+
+    snapshot_path(path, sizeof(path));
+    sys_make_dir(path);
+    size = json_measure_ex(root, opts);
+    buf = calloc(1, size);
+    json_serialize_ex(buf, root, opts);
+    json_builder_free(root);
+    file = fopen(path, "w");
+    if (file) {
+        fputs(buf, file);
+        fclose(file);
+    }
+    free(buf);
+    return file ? 0 : -1;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int core_snapshot_load(void)
+{
+    char path[1024];
+    void *data;
     int size;
-    data = asset_get_data(url, &size, code);
-    if (!data) return NULL;
-    return img_read_from_mem(data, size, w, h, bpp);
+    unsigned int u;
+    json_value *root, *urls;
+    snapshot_prefetch_t *p;
+    double v;
+
+    snapshot_path(path, sizeof(path));
+    data = read_file(path, &size);
+    if (!data) return -1;
+    root = json_parse(data, size);
+    free(data);
+    if (!root) return -1;
+
+#define LOAD_ATTR(obj_, name_) do { \
+        v = json_get_attr_f(root, name_, NAN); \
+        if (!isnan(v)) obj_set_attr((obj_t*)(obj_), name_, v); \
+    } while (0)
+    LOAD_ATTR(core->observer, "utc");
+    LOAD_ATTR(core->observer, "longitude");
+    LOAD_ATTR(core->observer, "latitude");
+    LOAD_ATTR(core->observer, "elevation");
+    LOAD_ATTR(core->observer, "yaw");
+    LOAD_ATTR(core->observer, "pitch");
+    LOAD_ATTR(core, "fov");
+#undef LOAD_ATTR
+
+    // Replay the loaded resources as a low priority prefetch.
+    urls = json_get_attr(root, "urls", json_array);
+    if (urls && urls->u.array.length) {
+        p = calloc(1, sizeof(*p));
+        p->urls = calloc(urls->u.array.length, sizeof(*p->urls));
+        for (u = 0; u < urls->u.array.length; u++) {
+            if (urls->u.array.values[u]->type != json_string) continue;
+            p->urls[p->nb++] = strdup(urls->u.array.values[u]->u.string.ptr);
+        }
+        core_add_task(snapshot_prefetch_task, p, 0, 0);
+    }
+    json_value_free(root);
+    return 0;
+}
+
+/*
+ * Create the modules whose klass is flagged <OBJ_MODULE_LAZY>, one per
+ * call so that the task budget spreads their init over several frames.
+ * Doesn't start before the first paint, so deferred init never delays
+ * the time to first sky.
+ */
+static int lazy_modules_task(task_t *task, double dt)
+{
+    obj_klass_t *klass;
+    obj_t *module;
+
+    if (!core->fps.last_time) return 0; // Nothing painted yet.
+    for (klass = obj_get_all_klasses(); klass; klass = klass->next) {
+        if (!(klass->flags & OBJ_MODULE_LAZY)) continue;
+        // Skip the ones already created by a lookup.
+        DL_FOREACH(core->obj.children, module)
+            if (module->id && strcmp(module->id, klass->id) == 0) break;
+        if (module) continue;
+        module_add_new(&core->obj, klass->id, klass->id, NULL);
+        module_sort_children(&core->obj, modules_sort_cmp);
+        return 0; // One module per call.
+    }
+    return 1; // All created.
 }
 
 EMSCRIPTEN_KEEPALIVE
@@ -222,6 +623,7 @@ void core_init(double win_w, double win_h, double pixel_scale)
     }
     profile_init();
     texture_set_load_callback(NULL, texture_load_function);
+    texture_set_partial_load_callback(NULL, texture_partial_load_function);
     snprintf(cache_dir, sizeof(cache_dir), "%s/%s",
              sys_get_user_dir(), ".cache");
     request_init(cache_dir);
@@ -237,19 +639,25 @@ void core_init(double win_w, double win_h, double pixel_scale)
 
     for (module = obj_get_all_klasses(); module; module = module->next) {
         if (!(module->flags & OBJ_MODULE)) continue;
+        // Lazy modules are created after the first paint (see
+        // lazy_modules_task), or on their first by-id lookup.
+        if (module->flags & OBJ_MODULE_LAZY) continue;
         module_add_new(&core->obj, module->id, module->id, NULL);
     }
-    DL_SORT(core->obj.children, modules_sort_cmp);
+    module_sort_children(&core->obj, modules_sort_cmp);
+    core_add_task(lazy_modules_task, NULL, 0, 0);
 
     core->areas = areas_create();
     progressbar_add_listener(on_progressbar);
 
     core_set_default();
+    core_snapshot_load();
 }
 
 void core_release(void)
 {
     obj_t *module;
+    core_snapshot_save();
     DL_FOREACH(core->obj.children, module) {
         if (module->klass->del) module->klass->del(module);
     }
@@ -313,6 +721,30 @@ void core_set_view_offset(double center_y_offset)
     core->observer->view_offset_alt = -center_y_offset * pix_angular_size;
 }
 
+/*
+ * Position (FRAME_MOUNT) of the locked target.  The ICRF pvo is cached
+ * with the observer generation counters, so that when neither the time
+ * nor the observer position changed (e.g. panning or rendering extra
+ * viewports while locked), tracking only costs the frame conversion
+ * matrix multiply instead of the full ephemeris query cascade.
+ */
+static void core_get_lock_pos(double out[4])
+{
+    observer_t *obs = core->observer;
+    obj_t *lock = core->target.lock;
+
+    if (core->target.lock_pvo_obj != lock ||
+            core->target.lock_time_gen != obs->time_gen ||
+            core->target.lock_pos_gen != obs->pos_gen) {
+        obj_get_pvo(lock, obs, core->target.lock_pvo);
+        core->target.lock_pvo_obj = lock;
+        core->target.lock_time_gen = obs->time_gen;
+        core->target.lock_pos_gen = obs->pos_gen;
+    }
+    convert_framev4(obs, FRAME_ICRF, FRAME_MOUNT,
+                    core->target.lock_pvo[0], out);
+}
+
 static int core_update_direction(double dt)
 {
     double v[4] = {1, 0, 0, 0}, q[4], t, az, al, vv[4];
@@ -325,7 +757,7 @@ static int core_update_direction(double dt)
         if (core->target.lock && core->target.move_to_lock) {
             // We are moving toward a potentially moving target, adjust the
             // destination
-            obj_get_pos(core->target.lock, core->observer, FRAME_MOUNT, vv);
+            core_get_lock_pos(vv);
             eraC2s((double*)vv, &az, &al);
             quat_set_identity(core->target.dst_q);
             quat_rz(az, core->target.dst_q, core->target.dst_q);
@@ -347,7 +779,7 @@ static int core_update_direction(double dt)
     }
 
     if (core->target.lock && !core->target.move_to_lock) {
-        obj_get_pos(core->target.lock, core->observer, FRAME_MOUNT, v);
+        core_get_lock_pos(v);
         eraC2s(v, &core->observer->yaw, &core->observer->pitch);
         // Notify the changes.
         module_changed(&core->observer->obj, "pitch");
@@ -399,11 +831,17 @@ EMSCRIPTEN_KEEPALIVE
 int core_update(double dt)
 {
     bool atm_visible;
-    double lwmax;
+    double lwmax, spent, cost, t;
     int r;
-    obj_t *atm, *module;
+    obj_t *atm;
     task_t *task, *task_tmp;
 
+    // Record or override the time step when a replay is active.
+    dt = replay_frame(dt);
+
+    log_flush(); // Emit the log messages queued during the last frame.
+
+    fader_motion_reset();
     atm = core_get_module("atmosphere");
     assert(atm);
     obj_get_attr(atm, "visible", &atm_visible);
@@ -432,24 +870,51 @@ int core_update(double dt)
     double fact = screen_s / 600;
     core->star_scale_screen_factor = min(max(0.7, fact), 1.5);
 
+    // The point size curve inputs (tonemapper, telescope, scales) are now
+    // set for this frame: rebuild the table lazily on first query.
+    g_point_table.valid = false;
+
     core_update_direction(dt);
     core_update_mount(dt);
     core_update_time(dt);
 
+    // Grant the tasks time slices from the frame budget, in priority
+    // order.  A task that doesn't get its slice ages upward, so that low
+    // priority background work is delayed but never fully starved.
+    DL_SORT(core->tasks, tasks_sort_cmp);
+    spent = 0;
     DL_FOREACH_SAFE(core->tasks, task, task_tmp) {
-        if (task->fun(task, dt) != 0) {
+        if (spent && spent + task->cost > TASKS_BUDGET_S) {
+            task->age += 1;
+            continue;
+        }
+        t = sys_get_unix_time();
+        r = task->fun(task, dt);
+        cost = sys_get_unix_time() - t;
+        spent += cost;
+        task->cost = task->cost ? mix(task->cost, cost, 0.1) : cost;
+        task->age = 0;
+        if (r != 0) {
             DL_DELETE(core->tasks, task);
             free(task);
         }
     }
 
-    DL_SORT(core->obj.children, modules_sort_cmp);
-    DL_FOREACH(core->obj.children, module) {
-        if (module->klass->update) {
-            r = module->klass->update(module, dt);
-            if (r < 0) LOG_E("Error updating module '%s'", module->id);
-        }
-    }
+    // The observer and time updates above form the serial prologue; the
+    // module updates can then be dispatched in parallel when their
+    // declared dependencies don't conflict.
+    module_sort_children(&core->obj, modules_sort_cmp);
+    module_update_reset_budget();
+    if (module_update_all(&core->obj, dt) > 0)
+        core->frame_dirty = true;
+
+    // Global animation signal: any fader still in motion forces a new
+    // frame, even if its module doesn't report the change itself.
+    if (!fader_all_settled())
+        core->frame_dirty = true;
+
+    // Publish the attribute values watched by the client.
+    obj_snapshot_update();
 
     return 0;
 }
@@ -458,19 +923,10 @@ int core_update(double dt)
 static bool is_below_horizon_hidden(void)
 {
     obj_t *ls;
-    bool visible;
-    double direction[4];
+    bool hidden;
     ls = core_get_module("landscapes");
-    obj_get_attr(ls, "visible", &visible);
-    if (!visible) return false;
-
-    // If we look down, it means the landscape is semi transparent, and so
-    // we can't clip.
-    // XXX: we should let the lanscape module notify the core that it hides
-    // the stars instead.
-    convert_frame(core->observer, FRAME_VIEW, FRAME_OBSERVED, true,
-                  VEC(0, 0, -1), direction);
-    return direction[2] >= 0;
+    obj_get_attr(ls, "hides_below_horizon", &hidden);
+    return hidden;
 }
 
 // Get point for mag without any radius lower limit.
@@ -495,6 +951,20 @@ static void core_get_point_for_mag_(
     if (luminance) *luminance = clamp(ld, 0, 1);
 }
 
+// Recompute the point size curve table for the current frame settings.
+static void point_table_update(void)
+{
+    int i;
+    double mag, r, ld;
+    for (i = 0; i < POINT_TABLE_SIZE; i++) {
+        mag = mix(POINT_TABLE_MAG_MIN, POINT_TABLE_MAG_MAX,
+                  (double)i / (POINT_TABLE_SIZE - 1));
+        core_get_point_for_mag_(mag, &r, &ld);
+        g_point_table.radius[i] = r;
+        g_point_table.luminance[i] = ld;
+    }
+    g_point_table.valid = true;
+}
 
 /*
  * Function: core_get_point_for_mag
@@ -513,7 +983,8 @@ static void core_get_point_for_mag_(
  */
 bool core_get_point_for_mag(double mag, double *radius, double *luminance)
 {
-    double ld, r;
+    double ld, r, x;
+    int i;
     double r_min = core->min_point_radius;
     const double r_skip = core->skip_point_radius;
 
@@ -521,8 +992,22 @@ bool core_get_point_for_mag(double mag, double *radius, double *luminance)
     if (r_min * core->win_pixels_scale < 1.0)
         r_min = 1.0;
 
-    // Get radius and luminance without any constraint on the radius.
-    core_get_point_for_mag_(mag, &r, &ld);
+    // Get radius and luminance without any constraint on the radius,
+    // interpolated from the per frame table when the magnitude falls in
+    // its range.
+    if (!g_point_table.valid) point_table_update();
+    if (mag >= POINT_TABLE_MAG_MIN && mag <= POINT_TABLE_MAG_MAX) {
+        x = (mag - POINT_TABLE_MAG_MIN) /
+            (POINT_TABLE_MAG_MAX - POINT_TABLE_MAG_MIN) *
+            (POINT_TABLE_SIZE - 1);
+        i = min((int)x, POINT_TABLE_SIZE - 2);
+        x -= i;
+        r = mix(g_point_table.radius[i], g_point_table.radius[i + 1], x);
+        ld = mix(g_point_table.luminance[i],
+                 g_point_table.luminance[i + 1], x);
+    } else {
+        core_get_point_for_mag_(mag, &r, &ld);
+    }
 
     // If the radius is really too small, we don't render the star.
     if (r < r_skip) {
@@ -635,35 +1120,121 @@ static void render_proj_markers(const painter_t *painter_)
 }
 
 
+static void count_progressbar(void *user, const char *id, const char *label,
+                              int v, int total, int error,
+                              const char *error_msg)
+{
+}
+
+/*
+ * Check whether anything that can affect the rendered frame changed
+ * since the last rendered frame.  We keep reporting a change while
+ * downloads are active and for a short time after the last change, so
+ * that asynchronous tile decodes and texture updates still get picked
+ * up.
+ */
+// Unix time of the last observed frame change (see frame_changed).  Also
+// read by core_next_frame_delay to report the same grace period.
+static double g_last_change_time = 0;
+
+static bool frame_changed(double win_w, double win_h, double pixel_scale)
+{
+    static struct {
+        uint64_t obs_hash;
+        double   fov;
+        double   win[3];
+        double   lwmax;
+    } last = {};
+    bool changed = false;
+    double now = sys_get_unix_time();
+
+    changed |= core->frame_dirty;
+    core->frame_dirty = false;
+    changed |= core->observer->hash != last.obs_hash;
+    changed |= core->fov != last.fov;
+    changed |= win_w != last.win[0] || win_h != last.win[1] ||
+               pixel_scale != last.win[2];
+    changed |= core->tonemapper.lwmax != last.lwmax;
+    changed |= progressbar_list(NULL, count_progressbar) > 0;
+
+    last.obs_hash = core->observer->hash;
+    last.fov = core->fov;
+    last.win[0] = win_w;
+    last.win[1] = win_h;
+    last.win[2] = pixel_scale;
+    last.lwmax = core->tonemapper.lwmax;
+    if (changed) g_last_change_time = now;
+    return changed || (now - g_last_change_time) < 1.0;
+}
+
 EMSCRIPTEN_KEEPALIVE
-int core_render(double win_w, double win_h, double pixel_scale)
+double core_next_frame_delay(void)
 {
-    PROFILE(core_render, 0);
-    obj_t *module;
-    projection_t proj;
-    double max_vmag, hints_vmag;
+    if (core->frame_dirty ||
+            !fader_all_settled() ||
+            core->fov_animation.duration ||
+            core->time_animation.duration ||
+            core->target.duration ||
+            progressbar_list(NULL, count_progressbar) > 0)
+        return 0;
+    // Keep pumping frames during the same grace period as the frame skip
+    // logic, so the asynchronous tile decodes triggered by the last
+    // change are still picked up and displayed.
+    if (sys_get_unix_time() - g_last_change_time < 1.0)
+        return 0;
+    return 1.0;
+}
 
-    // Used to make sure some values are not touched during render.
-    struct {
-        observer_t obs;
-        double fov;
-    } bck = {
-        .obs = *core->observer,
-        .fov = core->fov,
-    };
-    (void)bck;
+/*
+ * Quality governor: adjust core->quality from the measured frame rate.
+ * Degrades fast when we miss the budget and recovers slowly, with an
+ * hysteresis band between the two thresholds so we don't oscillate when
+ * hovering around the target.  Only runs when frames are actually
+ * rendered, so a skipped (static) frame never triggers a change.
+ */
+static void quality_governor_update(void)
+{
+    static double last_adjust = 0;
+    double now;
+
+    if (!core->quality_auto || !core->fps.avg) return;
+    now = sys_get_unix_time();
+    if (now - last_adjust < 2.0) return;
+    if (core->fps.avg < 50 && core->quality > 0.25) {
+        core->quality = max(core->quality - 0.15, 0.25);
+    } else if (core->fps.avg >= 58 && core->quality < 1.0) {
+        core->quality = min(core->quality + 0.05, 1.0);
+    } else {
+        return;
+    }
+    last_adjust = now;
+    // The background pass resolution follows the quality: this is the
+    // biggest fill rate lever, floored so the milky way and the image
+    // surveys never get too blurry.
+    core->render_scale = max(core->quality, 0.5);
+    core->frame_dirty = true;
+    module_changed(&core->obj, "quality");
+}
 
-    core->win_size[0] = win_w;
-    core->win_size[1] = win_h;
-    core->win_pixels_scale = pixel_scale;
-    core_get_proj(&proj);
+/*
+ * Render the whole module tree for a given observer / projection pair.
+ * Shared by core_render (default view) and core_render_view (additional
+ * outputs).
+ */
+static int render_view(observer_t *obs, const projection_t *proj,
+                       double win_w, double win_h, double pixel_scale)
+{
+    obj_t *module, **children;
+    int i, nb;
+    double max_vmag, hints_vmag;
 
-    observer_update(core->observer, true);
     max_vmag = compute_vmag_for_radius(core->skip_point_radius);
     hints_vmag = compute_vmag_for_radius(core->show_hints_radius);
 
-    fps_tick(&core->fps, sys_get_unix_time());
-    module_changed(&core->obj, "fps");
+    // Quality governor degradation: raise the magnitude cuts, which also
+    // scales down the labels population since hints drive it.
+    max_vmag -= (1.0 - core->quality) * 2.0;
+    hints_vmag -= (1.0 - core->quality) * 2.0;
 
     if (!core->rend)
         core->rend = render_gl_create();
@@ -671,10 +1242,10 @@ int core_render(double win_w, double win_h, double pixel_scale)
 
     painter_t painter = {
         .rend = core->rend,
-        .obs = core->observer,
+        .obs = obs,
         .fb_size = {win_w * pixel_scale, win_h * pixel_scale},
         .pixel_scale = pixel_scale,
-        .proj = &proj,
+        .proj = proj,
         .stars_limit_mag = max_vmag,
         .hints_limit_mag = hints_vmag,
         .hard_limit_mag = core->display_limit_mag,
@@ -688,9 +1259,14 @@ int core_render(double win_w, double win_h, double pixel_scale)
     painter_update_clip_info(&painter);
     paint_prepare(&painter, win_w, win_h, pixel_scale);
 
-    DL_FOREACH(core->obj.children, module) {
-        obj_render(module, &painter);
+    children = module_get_children(&core->obj, &nb);
+    for (i = 0; i < nb; i++) {
+        module = children[i];
+        render_gl_set_marker(core->rend,
+                             core->gpu_markers ? module->id : NULL);
+        module_render(module, &painter);
     }
+    render_gl_set_marker(core->rend, NULL);
 
     // Render the viewport cap for debugging.
     if ((0)) {
@@ -705,17 +1281,169 @@ int core_render(double win_w, double win_h, double pixel_scale)
     // Flush all rendering pipeline
     paint_finish(&painter);
 
+    // Do post render (e.g. for GUI)
+    children = module_get_children(&core->obj, &nb);
+    for (i = 0; i < nb; i++) {
+        module = children[i];
+        if (module->klass->post_render)
+            module->klass->post_render(module, &painter);
+    }
+
+    return 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int core_render(double win_w, double win_h, double pixel_scale)
+{
+    PROFILE(core_render, 0);
+    projection_t proj;
+    int ret;
+
+    // Used to make sure some values are not touched during render.
+    struct {
+        observer_t obs;
+        double fov;
+    } bck = {
+        .obs = *core->observer,
+        .fov = core->fov,
+    };
+    (void)bck;
+
+    core->win_size[0] = win_w;
+    core->win_size[1] = win_h;
+    core->win_pixels_scale = pixel_scale;
+    core_get_proj(&proj);
+
+    observer_update(core->observer, true);
+
+    if (!frame_changed(win_w, win_h, pixel_scale))
+        return 1; // Identical to the previous frame: skip the rendering.
+
+    fps_tick(&core->fps, sys_get_unix_time());
+    module_changed(&core->obj, "fps");
+    quality_governor_update();
+
+    ret = render_view(core->observer, &proj, win_w, win_h, pixel_scale);
+    module_perf_frame();
+
     assert(bck.obs.tt == core->observer->tt);
     assert(bck.obs.yaw == core->observer->yaw);
     assert(bck.obs.pitch == core->observer->pitch);
     assert(bck.fov == core->fov);
 
-    // Do post render (e.g. for GUI)
-    DL_FOREACH(core->obj.children, module) {
-        if (module->klass->post_render)
-            module->klass->post_render(module, &painter);
+    return ret;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int core_render_view(observer_t *obs, const projection_t *proj,
+                     double win_w, double win_h, double pixel_scale)
+{
+    PROFILE(core_render_view, 0);
+    observer_update(obs, true);
+    return render_view(obs, proj, win_w, win_h, pixel_scale);
+}
+
+EMSCRIPTEN_KEEPALIVE
+int core_render_views(const core_view_t *views, int nb)
+{
+    PROFILE(core_render_views, 0);
+    observer_t *obs;
+    int i, j, ret = 0;
+
+    // Update each distinct observer once: the views of a rig typically
+    // share a single observer, or clones of it that only differ in
+    // orientation.
+    for (i = 0; i < nb; i++) {
+        obs = views[i].obs ?: core->observer;
+        for (j = 0; j < i; j++)
+            if ((views[j].obs ?: core->observer) == obs) break;
+        if (j == i) observer_update(obs, true);
+    }
+
+    for (i = 0; i < nb; i++) {
+        core->render_pass = i;
+        ret |= render_view(views[i].obs ?: core->observer, &views[i].proj,
+                           views[i].win_w, views[i].win_h,
+                           views[i].pixel_scale);
+    }
+    core->render_pass = 0;
+    return ret;
+}
+
+/*
+ * Tiled still rendering state (see core_render_still).  One tile is
+ * rendered per task slice, so an export shares the frame budget with the
+ * interactive session instead of stalling it.
+ */
+typedef struct {
+    double  width, height, pixel_scale;
+    int     tile_size;
+    int     nb_x, nb_y;
+    int     idx;        // Next tile to render.
+    void    (*on_tile)(int x, int y, int w, int h, void *user);
+    void    (*on_done)(void *user);
+    void    *user;
+} still_render_t;
+
+static int still_render_task(task_t *task, double dt)
+{
+    still_render_t *s = task->user;
+    projection_t proj;
+    double fovx, fovy;
+    int x, y, w, h;
+
+    x = (s->idx % s->nb_x) * s->tile_size;
+    y = (s->idx / s->nb_x) * s->tile_size;
+    w = min(s->tile_size, (int)ceil(s->width) - x);
+    h = min(s->tile_size, (int)ceil(s->height) - y);
+
+    // Same projection as a core_render of the full image, restricted to
+    // the tile.
+    projection_compute_fovs(core->proj, core->fov, s->width / s->height,
+                            &fovx, &fovy);
+    projection_init(&proj, core->proj, fovx, s->width, s->height);
+    if (core->flip_view_vertical)
+        proj.flags |= PROJ_FLIP_VERTICAL;
+    if (core->flip_view_horizontal)
+        proj.flags |= PROJ_FLIP_HORIZONTAL;
+    projection_set_subwindow(&proj, x, y, w, h);
+
+    observer_update(core->observer, true);
+    render_view(core->observer, &proj, w, h, s->pixel_scale);
+    s->on_tile(x, y, w, h, s->user);
+
+    if (++s->idx < s->nb_x * s->nb_y) {
+        // Keep the render loop (and so the task scheduler) running at
+        // full rate until the export completes.
+        core->frame_dirty = true;
+        return 0;
     }
+    if (s->on_done) s->on_done(s->user);
+    free(s);
+    return 1;
+}
 
+EMSCRIPTEN_KEEPALIVE
+int core_render_still(double width, double height, double pixel_scale,
+                      int tile_size,
+                      void (*on_tile)(int x, int y, int w, int h, void *user),
+                      void (*on_done)(void *user), void *user)
+{
+    still_render_t *s;
+
+    assert(width > 0 && height > 0 && tile_size > 0 && on_tile);
+    s = calloc(1, sizeof(*s));
+    s->width = width;
+    s->height = height;
+    s->pixel_scale = pixel_scale;
+    s->tile_size = tile_size;
+    s->nb_x = (int)ceil(width / tile_size);
+    s->nb_y = (int)ceil(height / tile_size);
+    s->on_tile = on_tile;
+    s->on_done = on_done;
+    s->user = user;
+    core_add_task(still_render_task, s, 0, 0);
+    core->frame_dirty = true;
     return 0;
 }
 
@@ -723,6 +1451,8 @@ EMSCRIPTEN_KEEPALIVE
 void core_on_mouse(int id, int state, double x, double y)
 {
     obj_t *module;
+    if (!replay_filter_mouse(id, state, x, y)) return;
+    core->frame_dirty = true;
     DL_FOREACH(core->obj.children, module) {
         if (module->klass->on_mouse) {
             module->klass->on_mouse(module, id, state, x, y);
@@ -734,6 +1464,7 @@ EMSCRIPTEN_KEEPALIVE
 void core_on_pinch(int state, double x, double y, double scale)
 {
     obj_t *module;
+    core->frame_dirty = true;
     DL_FOREACH(core->obj.children, module) {
         if (module->klass->on_pinch) {
             module->klass->on_pinch(module, state, x, y, scale);
@@ -766,6 +1497,7 @@ void core_on_key(int key, int action)
     char buf[128];
 
     core->inputs.keys[key] = (action != KEY_ACTION_UP);
+    core->frame_dirty = true;
 
     if (core->gui_want_capture_mouse) return;
     if (action != KEY_ACTION_DOWN) return;
@@ -804,6 +1536,7 @@ void core_on_zoom(double k, double x, double y)
     double fov, pos_start[3], pos_end[3];
     double sal, saz, dal, daz;
 
+    if (!replay_filter_zoom(k, x, y)) return;
     win_to_observed(x, y, pos_start);
     obj_get_attr(&core->obj, "fov", &fov);
     fov /= k;
@@ -1084,11 +1817,14 @@ const char *otype_to_str(const char *otype)
     return res ? res : "";
 }
 
-void core_add_task(int (*fun)(task_t *task, double dt), void *user)
+void core_add_task(int (*fun)(task_t *task, double dt), void *user,
+                   int priority, double chunk)
 {
     task_t *task = calloc(1, sizeof(*task));
     task->fun = fun;
     task->user = user;
+    task->priority = priority;
+    task->cost = chunk;
     DL_APPEND(core->tasks, task);
 }
 
@@ -1103,9 +1839,16 @@ static obj_klass_t core_klass = {
                  .on_changed = core_on_fov_changed),
         PROPERTY(projection, TYPE_INT, MEMBER(core_t, proj)),
         PROPERTY(selection, TYPE_OBJ, MEMBER(core_t, selection)),
+        PROPERTY(selection_info, TYPE_JSON, .fn = core_fn_selection_info),
         PROPERTY(lock, TYPE_OBJ, MEMBER(core_t, target.lock)),
         PROPERTY(hovered, TYPE_OBJ, MEMBER(core_t, hovered)),
         PROPERTY(progressbars, TYPE_JSON, .fn = core_fn_progressbars),
+        PROPERTY(hips_stats, TYPE_JSON, .fn = core_fn_hips_stats),
+        PROPERTY(gpu_times, TYPE_JSON, .fn = core_fn_gpu_times),
+        PROPERTY(perf_counters, TYPE_JSON, .fn = core_fn_perf_counters),
+        PROPERTY(frame_trace, TYPE_JSON, .fn = core_fn_frame_trace),
+        PROPERTY(mem_stats, TYPE_JSON, .fn = core_fn_mem_stats),
+        PROPERTY(cache_stats, TYPE_JSON, .fn = core_fn_cache_stats),
         PROPERTY(fps, TYPE_INT, MEMBER(core_t, fps.avg)),
         PROPERTY(clicks, TYPE_INT, MEMBER(core_t, clicks)),
         PROPERTY(ignore_clicks, TYPE_BOOL, MEMBER(core_t, ignore_clicks)),
@@ -1120,6 +1863,13 @@ static obj_klass_t core_klass = {
         PROPERTY(tonemapper_p, TYPE_FLOAT, MEMBER(core_t, tonemapper_p)),
         PROPERTY(display_limit_mag, TYPE_FLOAT,
                  MEMBER(core_t, display_limit_mag)),
+        PROPERTY(night_mode, TYPE_FLOAT, MEMBER(core_t, night_mode)),
+        PROPERTY(dimming, TYPE_FLOAT, MEMBER(core_t, dimming)),
+        PROPERTY(quality, TYPE_FLOAT, MEMBER(core_t, quality)),
+        PROPERTY(quality_auto, TYPE_BOOL, MEMBER(core_t, quality_auto)),
+        PROPERTY(render_scale, TYPE_FLOAT, MEMBER(core_t, render_scale)),
+        PROPERTY(gpu_markers, TYPE_BOOL, MEMBER(core_t, gpu_markers)),
+        PROPERTY(gpu_picking, TYPE_BOOL, MEMBER(core_t, gpu_picking)),
         PROPERTY(flip_view_vertical, TYPE_BOOL,
                  MEMBER(core_t, flip_view_vertical)),
         PROPERTY(flip_view_horizontal, TYPE_BOOL,
@@ -35,14 +35,20 @@ extern core_t *core;    // Global core object.
  * Type: task_t
  * Contains info about some extra running tasks.
  *
- * All the tasks will be called once before the module update.  A task runs
- * as long as it returns zero.
+ * The tasks are called before the module update, in priority order,
+ * within a per frame time budget (see core_update).  A task runs as long
+ * as it returns zero.
  */
 struct task
 {
     task_t *next, *prev;
     int (*fun)(task_t *task, double dt);
     void *user;
+    int priority;   // Higher priority tasks get their slice first.
+    double cost;    // Measured cost of one slice (s), seeded by the
+                    // declared chunk size.
+    double age;     // Frames since the task last ran, boosts starved
+                    // tasks above higher priority ones.
 };
 
 /* Type: core_t
@@ -84,6 +90,12 @@ struct core
     bool            flip_view_vertical;
     bool            flip_view_horizontal;
 
+    // Global color effects, applied as a final stage in the shaders, so
+    // that toggling or animating them doesn't invalidate any retained
+    // render buffers.
+    double          night_mode;     // Red preserving night mode (0 to 1).
+    double          dimming;        // Global dimming factor (1 for none).
+
     renderer_t      *rend;
     int             proj;
     double          win_size[2];
@@ -93,6 +105,30 @@ struct core
 
     fps_t           fps; // FPS counter.
 
+    // Automatic quality governor.  When quality_auto is set, the measured
+    // frame rate drives quality from 1 (full content) down to 0.25, and
+    // the render path uses it to scale the content: magnitude cut of the
+    // point sources (and so of their labels), max hips survey order.
+    bool            quality_auto;
+    double          quality;
+
+    // Resolution scale of the background render pass (milky way, image
+    // surveys): those fill rate bound items are rendered into a smaller
+    // framebuffer and composited up, while point sources, lines and
+    // labels keep the native resolution.  1 = native resolution.
+    // Driven by the quality governor when quality_auto is set.
+    double          render_scale;
+
+    // When set, the renderer emits gpu debug marker groups labeled with
+    // the source module and item type around each draw.
+    bool            gpu_markers;
+
+    // When set, the point sources resolve clicks with the renderer
+    // id-buffer (see render_gl_pick) instead of registering into the
+    // areas, which removes the per-point registration cost in dense
+    // fields.
+    bool            gpu_picking;
+
     // Number of clicks so far.  This is just so that we can wait for clicks
     // from the ui.
     int clicks;
@@ -117,6 +153,14 @@ struct core
         double      duration; // Animation duration in sec.
         // Set to true if the move is toward newly locked object.
         bool        move_to_lock;
+        // Tracking fast path: ICRF pvo of the locked object, cached
+        // with the observer generation counters it was computed with,
+        // so that following a target only re-runs the ephemeris query
+        // when the time or the observer position actually changed.
+        obj_t       *lock_pvo_obj;
+        double      lock_pvo[2][4];
+        uint64_t    lock_time_gen;
+        uint64_t    lock_pos_gen;
     } target;
 
     struct {
@@ -149,6 +193,16 @@ struct core
     // List of running tasks.
     task_t *tasks;
 
+    // Set whenever something that can affect the rendered frame changed
+    // (attribute write, input event, animating fader...).  Used by
+    // core_render to skip identical frames.
+    bool frame_dirty;
+
+    // Index of the viewport currently rendered inside core_render_views
+    // (always 0 for single view rendering).  Modules can test it to run
+    // their view independent per frame work on the first pass only.
+    int render_pass;
+
     // Can be used for debugging.  It's conveniant to have an exposed test
     // attribute.
     bool test;
@@ -183,6 +237,24 @@ void core_init(double win_w, double win_h, double pixel_scale);
 
 void core_release(void);
 
+/*
+ * Function: core_snapshot_save
+ * Serialize the warm state (observer / view attributes and the list of
+ * online resources currently loaded) to a snapshot file in the user
+ * directory.  Called automatically by <core_release>.
+ */
+int core_snapshot_save(void);
+
+/*
+ * Function: core_snapshot_load
+ * Restore the observer / view state from the snapshot file and replay
+ * the saved resource list as a low priority prefetch, so a restarted
+ * instance shows its previous scene almost immediately.  Called
+ * automatically by <core_init>; any state set by the frontend
+ * afterwards takes precedence.
+ */
+int core_snapshot_load(void);
+
 /*
  * Function: core_update
  * Update the core and all the modules
@@ -219,7 +291,133 @@ void core_observer_update();
  */
 void core_set_view_offset(double center_y_offset);
 
+/*
+ * Function: core_render
+ * Render the current frame.
+ *
+ * If nothing that can affect the rendered frame changed since the last
+ * rendered frame (static observer, settled faders, no pending
+ * downloads), the rendering is skipped entirely and the function
+ * returns 1: the embedding compositor can keep displaying the last
+ * frame.
+ *
+ * Return:
+ *   0 if a frame was rendered, 1 if the frame is identical to the
+ *   previous one and the rendering was skipped.
+ */
 int core_render(double win_w, double win_h, double pixel_scale);
+
+/*
+ * Function: core_next_frame_delay
+ * Report how long the embedder can wait before the next frame.
+ *
+ * Returns 0 while the scene is active (pending animation, unsettled
+ * fader, active download, recent change): keep rendering at display
+ * rate.  Otherwise returns a delay in seconds (currently one second):
+ * nothing engine-side will change the frame before that, so the render
+ * loop can sleep and leave the GPU idle.  Any input event or attribute
+ * write can shorten the wait: call this again (or just render) when one
+ * happens.
+ *
+ * Return:
+ *   Delay in seconds before the next frame is needed (0 for now).
+ */
+double core_next_frame_delay(void);
+
+/*
+ * Function: core_render_view
+ * Render the frame of a specific observer / projection pair.
+ *
+ * This allows to drive several outputs (e.g. multi screen planetarium
+ * rigs) from a single engine instance: the obj tree, the parsed
+ * catalogs and the tile caches are all shared, only the view state is
+ * per output.  The observer would typically be a clone of the core
+ * observer with a different orientation; it should keep the core time
+ * and position, as a few modules (landscape brightness, cardinal
+ * points...) still read those from the core observer.
+ *
+ * Unlike <core_render> this never skips identical frames: the caller
+ * decides when each output needs a refresh.
+ *
+ * Parameters:
+ *   obs         - The observer of the view.
+ *   proj        - The projection of the view (see <projection_init>).
+ *   win_w       - Window width in window unit.
+ *   win_h       - Window height in window unit.
+ *   pixel_scale - Ratio of pixels per window unit.
+ *
+ * Return:
+ *   0 on success.
+ */
+int core_render_view(observer_t *obs, const projection_t *proj,
+                     double win_w, double win_h, double pixel_scale);
+
+/*
+ * Type: core_view_t
+ * Describes one viewport for <core_render_views>.
+ */
+typedef struct core_view {
+    observer_t *obs;        // View observer (NULL for the core observer).
+    projection_t proj;      // View projection (see <projection_init>).
+    double win_w, win_h;    // Window size in window unit.
+    double pixel_scale;     // Ratio of pixels per window unit.
+} core_view_t;
+
+/*
+ * Function: core_render_views
+ * Render several viewports of the same instant (e.g. a dome rig).
+ *
+ * Equivalent to calling <core_render_view> once per view, except that
+ * the per frame work is shared: each distinct observer is updated only
+ * once, and <core, render_pass> tells the modules which pass is running
+ * so view independent work (generated geometry, per frame ephemerides)
+ * can be done on the first pass only.  Together with the shared caches
+ * (tiles, textures, text metrics) this makes N views cost roughly one
+ * update plus N thin paint passes.
+ *
+ * Parameters:
+ *   views  - The views to render, in order.
+ *   nb     - Number of views.
+ *
+ * Return:
+ *   0 on success.
+ */
+int core_render_views(const core_view_t *views, int nb);
+
+/*
+ * Function: core_render_still
+ * Render a high resolution still of the current view in tiles.
+ *
+ * The image is cut into screen space tiles of at most tile_size units,
+ * rendered one per scheduler slice (see <core_add_task>), so an 8K
+ * export neither allocates an 8K framebuffer nor blocks an interactive
+ * session sharing the engine.  Each tile goes through the normal frame
+ * path, with the projection restricted to the tile rect
+ * (<projection_set_subwindow>).
+ *
+ * The tile is rendered into the current GL target at origin: on_tile is
+ * called right after, and must copy the pixels out (e.g. glReadPixels
+ * into the final image) before returning, as the next tile or the next
+ * interactive frame will paint over them.
+ *
+ * Parameters:
+ *   width       - Full image width, in window unit.
+ *   height      - Full image height, in window unit.
+ *   pixel_scale - Ratio of pixels per window unit.
+ *   tile_size   - Maximum tile side, in window unit.
+ *   on_tile     - Called after each tile is rendered, with the tile rect
+ *                 in full image window coordinates.
+ *   on_done     - Called once all the tiles are done (can be NULL).
+ *   user        - Passed to the callbacks.
+ *
+ * Return:
+ *   0 on success.
+ */
+int core_render_still(double width, double height, double pixel_scale,
+                      int tile_size,
+                      void (*on_tile)(int x, int y, int w, int h, void *user),
+                      void (*on_done)(void *user), void *user);
+
 // x and y in screen coordinates.
 void core_on_mouse(int id, int state, double x, double y);
 void core_on_key(int key, int action);
@@ -476,6 +674,13 @@ obj_t *city_create(const char *name, const char *country_code,
  */
 const char *skycultures_get_label(const char *main_id, char *out, int out_size);
 
+/*
+ * Function: skycultures_get_label_hip
+ * Same as <skycultures_get_label> for a bright star, from its HIP
+ * number directly, using an integer keyed index built once per culture.
+ */
+const char *skycultures_get_label_hip(int hip, char *out, int out_size);
+
 
 /*
  * Function: skycultures_get_designations
@@ -517,5 +722,11 @@ char *skycultures_md_2_html(const char *md);
  * Add a function that will be executed at each frame.
  *
  * The runs as along at it returns zero.
+ *
+ * Parameters:
+ *   priority - Higher priority tasks get a time slice first.
+ *   chunk    - Expected cost of one slice (s), refined by measurement
+ *              once the task ran.  Can be zero.
  */
-void core_add_task(int (*fun)(task_t *task, double dt), void *user);
+void core_add_task(int (*fun)(task_t *task, double dt), void *user,
+                   int priority, double chunk);
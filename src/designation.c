@@ -10,6 +10,7 @@
 #include "designation.h"
 #include "swe.h"
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -336,6 +337,63 @@ static const char * to_exponent(char c) {
     return "";
 }
 
+/*
+ * Interning table of the parsed designations: the Bayer / Flamsteed /
+ * variable star parsers scan the greek letter and constellation tables
+ * with string compares, so each unique designation is parsed into this
+ * compact structured form only once, whatever formatting flags or
+ * language it is later requested with.
+ */
+enum {
+    DSGN_KIND_OTHER = 0,
+    DSGN_KIND_BAYER,
+    DSGN_KIND_FLAMSTEED,
+    DSGN_KIND_VAR,
+};
+
+typedef struct dsgn_parsed {
+    UT_hash_handle hh;
+    char *dsgn;         // Designation (hash key).
+    uint8_t kind;       // One of DSGN_KIND_.
+    uint8_t cst;        // Constellation index in CSTS.
+    int16_t bayer;      // Greek letter index (1-25) or ASCII letter.
+    int32_t nb;         // Bayer exponent or Flamsteed number.
+    uint16_t suffix;    // Offset of the suffix in the designation.
+    char var[8];        // Variable star letters (DSGN_KIND_VAR).
+} dsgn_parsed_t;
+
+static dsgn_parsed_t *g_dsgn_parsed = NULL;
+
+static const dsgn_parsed_t *designation_parse(const char *dsgn)
+{
+    dsgn_parsed_t *e;
+    int cst, g, nb;
+    const char *suffix;
+
+    HASH_FIND_STR(g_dsgn_parsed, dsgn, e);
+    if (e) return e;
+    e = calloc(1, sizeof(*e));
+    e->dsgn = strdup(dsgn);
+    if (designation_parse_bayer(dsgn, &cst, &g, &nb, &suffix)) {
+        e->kind = DSGN_KIND_BAYER;
+        e->cst = cst;
+        e->bayer = g;
+        e->nb = nb;
+        e->suffix = suffix - dsgn;
+    } else if (designation_parse_flamsteed(dsgn, &cst, &nb, &suffix)) {
+        e->kind = DSGN_KIND_FLAMSTEED;
+        e->cst = cst;
+        e->nb = nb;
+        e->suffix = suffix - dsgn;
+    } else if (designation_parse_variable_star(dsgn, &cst, e->var, &suffix)) {
+        e->kind = DSGN_KIND_VAR;
+        e->cst = cst;
+        e->suffix = suffix - dsgn;
+    }
+    HASH_ADD_KEYPTR(hh, g_dsgn_parsed, e->dsgn, strlen(e->dsgn), e);
+    return e;
+}
+
 /*
  * Function: designation_cleanup
  * Create a printable version of a designation
@@ -344,53 +402,59 @@ static const char * to_exponent(char c) {
  */
 void designation_cleanup(const char *dsgn, char *out, int size, int flags)
 {
-    int cst;
-    int i, g, nb;
+    int i;
     const char *remove[] = {"NAME ", "* ", "Cl ", "Cl* ", "** ", "MPC "};
     const char *greek;
     const char *cstname;
     const char *suffix;
     char tmp[64], tmp_letter[32];
-    char exponent[256], var[8];
+    char exponent[256];
+    const dsgn_parsed_t *p;
 
-    if (designation_parse_bayer(dsgn, &cst, &g, &nb, &suffix)) {
+    p = designation_parse(dsgn);
+    suffix = dsgn + p->suffix;
+
+    if (p->kind == DSGN_KIND_BAYER) {
         exponent[0] = 0;
         tmp[0] = 0;
-        if (g >= 'A' && g <= 'z') {
-            snprintf(tmp_letter, sizeof(tmp_letter), "%c", g);
+        if (p->bayer >= 'A' && p->bayer <= 'z') {
+            snprintf(tmp_letter, sizeof(tmp_letter), "%c", p->bayer);
             greek = tmp_letter;
         } else {
-            greek = (flags & BAYER_LATIN_SHORT) ? GREEK[g - 1][2] :
-                    (flags & BAYER_LATIN_LONG) ? GREEK[g - 1][3] :
-                    GREEK[g - 1][0];
+            greek = (flags & BAYER_LATIN_SHORT) ? GREEK[p->bayer - 1][2] :
+                    (flags & BAYER_LATIN_LONG) ? GREEK[p->bayer - 1][3] :
+                    GREEK[p->bayer - 1][0];
         }
-        if (nb) {
-            snprintf(tmp, sizeof(tmp), "%d", nb);
+        if (p->nb) {
+            snprintf(tmp, sizeof(tmp), "%d", p->nb);
             for (i = 0; i < strlen(tmp); ++i)
                 strncat(exponent, to_exponent(tmp[i]),
                         sizeof(exponent) - strlen(exponent) - 1);
         }
         if (flags & BAYER_CONST_SHORT || flags & BAYER_CONST_LONG) {
-            cstname = (flags & BAYER_CONST_SHORT) ? CSTS[cst][0] : CSTS[cst][1];
+            cstname = (flags & BAYER_CONST_SHORT) ?
+                    CSTS[p->cst][0] : CSTS[p->cst][1];
             snprintf(out, size, "%s%s %s%s", greek, exponent, cstname, suffix);
         } else
             snprintf(out, size, "%s%s%s", greek, exponent, suffix);
         return;
     }
-    if (designation_parse_flamsteed(dsgn, &cst, &g, &suffix)) {
+    if (p->kind == DSGN_KIND_FLAMSTEED) {
         if (flags & BAYER_CONST_SHORT || flags & BAYER_CONST_LONG) {
-            cstname = (flags & BAYER_CONST_SHORT) ? CSTS[cst][0] : CSTS[cst][1];
-            snprintf(out, size, "%d %s%s", g, cstname, suffix);
+            cstname = (flags & BAYER_CONST_SHORT) ?
+                    CSTS[p->cst][0] : CSTS[p->cst][1];
+            snprintf(out, size, "%d %s%s", p->nb, cstname, suffix);
         } else
-            snprintf(out, size, "%d%s", g, suffix);
+            snprintf(out, size, "%d%s", p->nb, suffix);
         return;
     }
-    if (designation_parse_variable_star(dsgn, &cst, var, &suffix)) {
+    if (p->kind == DSGN_KIND_VAR) {
         if (flags & (BAYER_CONST_SHORT | BAYER_CONST_LONG)) {
-            cstname = (flags & BAYER_CONST_LONG) ? CSTS[cst][1] : CSTS[cst][0];
-            snprintf(out, size, "%s %s%s", var, cstname, suffix);
+            cstname = (flags & BAYER_CONST_LONG) ?
+                    CSTS[p->cst][1] : CSTS[p->cst][0];
+            snprintf(out, size, "%s %s%s", p->var, cstname, suffix);
         } else {
-            snprintf(out, size, "%s%s", var, suffix);
+            snprintf(out, size, "%s%s", p->var, suffix);
         }
         return;
     }
@@ -416,6 +480,51 @@ void designation_cleanup(const char *dsgn, char *out, int size, int flags)
     snprintf(out, size, "%s", dsgn);
 }
 
+/*
+ * Interning table of the cleaned up designations: the label render
+ * paths pass the same designations every frame, so each unique
+ * (designation, flags) pair is parsed and formatted only once.
+ * Translated entries remember their language and are re-formatted if it
+ * changed.
+ */
+typedef struct dsgn_cache_entry {
+    UT_hash_handle hh;
+    char *key;          // "<flags>:<designation>".
+    char *out;          // Formatted form.
+    bool translated;    // True if out depends on the language.
+    char lang[8];       // Language out was translated in.
+} dsgn_cache_entry_t;
+
+static dsgn_cache_entry_t *g_dsgn_cache = NULL;
+
+const char *designation_cleanup_cached(const char *dsgn, int flags)
+{
+    dsgn_cache_entry_t *e;
+    char key[256], buf[256];
+
+    snprintf(key, sizeof(key), "%x:%s", flags, dsgn);
+    HASH_FIND_STR(g_dsgn_cache, key, e);
+    if (e) {
+        if (e->translated && strcmp(e->lang, sys_get_lang()) != 0) {
+            designation_cleanup(dsgn, buf, sizeof(buf), flags);
+            free(e->out);
+            e->out = strdup(buf);
+            snprintf(e->lang, sizeof(e->lang), "%s", sys_get_lang());
+        }
+        return e->out;
+    }
+    e = calloc(1, sizeof(*e));
+    e->key = strdup(key);
+    designation_cleanup(dsgn, buf, sizeof(buf), flags);
+    e->out = strdup(buf);
+    e->translated = (flags & DSGN_TRANSLATE) &&
+                    strncmp(dsgn, "NAME ", 5) == 0;
+    if (e->translated)
+        snprintf(e->lang, sizeof(e->lang), "%s", sys_get_lang());
+    HASH_ADD_KEYPTR(hh, g_dsgn_cache, e->key, strlen(e->key), e);
+    return e->out;
+}
+
 /*
  * Function: designations_get_tyc
  * Extract a TYC number from a designations list.
@@ -443,7 +552,7 @@ bool designations_get_tyc(const char *dsgns, int *tyc1, int *tyc2, int *tyc3)
 static void test_designations(void)
 {
     char buf[128];
-    const char *suffix;
+    const char *suffix, *c1, *c2;
     int n, cst, nb;
     int tyc1, tyc2, tyc3;
     bool r;
@@ -507,6 +616,20 @@ static void test_designations(void)
 
     r = designations_get_tyc("TYC 8841-489-2\0", &tyc1, &tyc2, &tyc3);
     assert(r && tyc1 == 8841 && tyc2 == 489 && tyc3 == 2);
+
+    // Interned lookups: same output as the direct cleanup, stable
+    // pointer on repeated queries, and one entry per (dsgn, flags) pair.
+    c1 = designation_cleanup_cached("* alf Aqr", BAYER_LATIN_LONG |
+                                    BAYER_CONST_LONG);
+    assert(strcmp(c1, "Alpha Aquarii") == 0);
+    c2 = designation_cleanup_cached("* alf Aqr", BAYER_LATIN_LONG |
+                                    BAYER_CONST_LONG);
+    assert(c1 == c2);
+    c2 = designation_cleanup_cached("* alf Aqr", 0);
+    assert(strcmp(c2, "α") == 0);
+    assert(c1 != c2);
+    c1 = designation_cleanup_cached("NAME Polaris", 0);
+    assert(strcmp(c1, "Polaris") == 0);
 }
 
 TEST_REGISTER(NULL, test_designations, TEST_AUTO);
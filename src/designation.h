@@ -47,6 +47,21 @@ enum {
  */
 void designation_cleanup(const char *dsgn, char *out, int size, int flags);
 
+/*
+ * Function: designation_cleanup_cached
+ * Same as <designation_cleanup>, interning the result.
+ *
+ * Each unique (designation, flags) pair is parsed and formatted only
+ * once per session, so the per frame label paths can use this instead
+ * of reformatting.
+ *
+ * Return:
+ *   An interned string.  It stays valid for the whole session, but may
+ *   be updated in place if the language changes, so don't keep it
+ *   across frames.
+ */
+const char *designation_cleanup_cached(const char *dsgn, int flags);
+
 
 /*
  * Function: designations_get_tyc
@@ -11,6 +11,10 @@
 #include "swe.h"
 #include "zlib.h"
 
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 #include <assert.h>
 #include <sys/stat.h>
 #include <stdint.h>
@@ -39,7 +43,8 @@
  * Compressed data block:
  *   4 bytes: data size
  *   4 bytes: compressed data size
- *   n bytes: compressed data
+ *   n bytes: compressed data (zlib stream, or zstd frame: the codec is
+ *            negotiated from the zstd magic number)
  *
  * Tabular data:
  *   4 bytes: flags (1: data is shuffled)
@@ -52,6 +57,15 @@
  *     4 bytes: unit (one of EPH_UNIT value, e.g EPH_RAD or 0 to ignore)
  *     4 bytes: start offset in bytes
  *     4 bytes: data size
+ *
+ * Delta files: an eph file can also be published as a delta against a
+ * previously released base file, so that a small catalog fix doesn't
+ * re-stream the whole tile.  A delta file is a regular eph file whose
+ * first chunk has the type "DBAS" and contains the CRC32 of the full
+ * base file (4 bytes).  The other chunks replace the base chunk of the
+ * same type, or are appended if the base has none (see eph_merge_delta).
+ * This assumes chunk types are unique within a file, which holds for
+ * all the surveys we generate.
  */
 
 #define FILE_VERSION 2
@@ -77,6 +91,9 @@ int eph_read_tile_header(const void *data, int data_size, int *data_ofs,
     return 0;
 }
 
+// Magic number starting every zstd frame.
+static const uint8_t ZSTD_MAGIC[4] = {0x28, 0xb5, 0x2f, 0xfd};
+
 void *eph_read_compressed_block(const void *data, int data_size,
                                 int *data_ofs, int *size)
 {
@@ -89,13 +106,107 @@ void *eph_read_compressed_block(const void *data, int data_size,
     lsize = *size;
     ret = malloc(lsize);
     *data_ofs += 8 + comp_size;
+    // Negotiate the codec from the stream itself: zstd frames start with
+    // a fixed magic number, anything else is assumed to be zlib.
+    if (comp_size >= 4 && memcmp(data + 8, ZSTD_MAGIC, 4) == 0) {
+#ifdef HAVE_ZSTD
+        if (ZSTD_isError(ZSTD_decompress(ret, lsize, data + 8, comp_size))) {
+            LOG_E("Cannot uncompress zstd data");
+            free(ret);
+            return NULL;
+        }
+        return ret;
+#else
+        LOG_E("zstd compressed tile, but zstd support not compiled in");
+        free(ret);
+        return NULL;
+#endif
+    }
     if (uncompress(ret, &lsize, data + 8, comp_size) != Z_OK) {
         LOG_E("Cannot uncompress data");
+        free(ret);
         return NULL;
     }
     return ret;
 }
 
+/*
+ * Return the offset of the first chunk of a given type, or -1 if not
+ * found.  chunk_size is set to the full chunk size, header and CRC
+ * included.
+ */
+static int find_chunk(const void *data, int data_size, const char type[4],
+                      int *chunk_size)
+{
+    int ofs, size;
+    for (ofs = 8; ofs + 12 <= data_size; ofs += 12 + size) {
+        memcpy(&size, data + ofs + 4, 4);
+        if (size < 0 || ofs + 12 + size > data_size) return -1;
+        if (strncmp(data + ofs, type, 4) == 0) {
+            *chunk_size = 12 + size;
+            return ofs;
+        }
+    }
+    return -1;
+}
+
+void *eph_merge_delta(const void *base, int base_size,
+                      const void *delta, int delta_size, int *out_size)
+{
+    void *out;
+    char type[4];
+    int ofs, size, dofs, dsize, pos = 8;
+    uint32_t crc;
+
+    if (base_size < 8 || delta_size < 8) return NULL;
+    if (strncmp(base, "EPHE", 4) != 0 || strncmp(delta, "EPHE", 4) != 0)
+        return NULL;
+
+    // Check that the delta was made against this exact base file.
+    ofs = find_chunk(delta, delta_size, "DBAS", &size);
+    if (ofs == -1 || size != 12 + 4) {
+        LOG_E("Delta file without base checksum chunk");
+        return NULL;
+    }
+    memcpy(&crc, delta + ofs + 8, 4);
+    if (crc != (uint32_t)crc32(0L, base, base_size)) {
+        LOG_W("Delta file doesn't match the base file");
+        return NULL;
+    }
+
+    out = malloc(base_size + delta_size);
+    memcpy(out, base, 8); // Magic and version from the base.
+
+    // Base chunks, replaced by the delta chunk of the same type if any.
+    for (ofs = 8; ofs + 12 <= base_size; ofs += 12 + size) {
+        memcpy(type, base + ofs, 4);
+        memcpy(&size, base + ofs + 4, 4);
+        if (size < 0 || ofs + 12 + size > base_size) break;
+        dofs = find_chunk(delta, delta_size, type, &dsize);
+        if (dofs != -1) {
+            memcpy(out + pos, delta + dofs, dsize);
+            pos += dsize;
+        } else {
+            memcpy(out + pos, base + ofs, 12 + size);
+            pos += 12 + size;
+        }
+    }
+
+    // Delta chunks with no base counterpart are appended.
+    for (ofs = 8; ofs + 12 <= delta_size; ofs += 12 + size) {
+        memcpy(type, delta + ofs, 4);
+        memcpy(&size, delta + ofs + 4, 4);
+        if (size < 0 || ofs + 12 + size > delta_size) break;
+        if (strncmp(type, "DBAS", 4) == 0) continue;
+        if (find_chunk(base, base_size, type, &dsize) != -1) continue;
+        memcpy(out + pos, delta + ofs, 12 + size);
+        pos += 12 + size;
+    }
+
+    *out_size = pos;
+    return out;
+}
+
 int eph_load(const void *data, int data_size, void *user,
              int (*callback)(const char type[4],
                              const void *data, int size,
@@ -121,7 +232,7 @@ int eph_load(const void *data, int data_size, void *user,
         CHECK(data_size >= 8 + chunk_data_size);
         if (strncmp(type, "JSON", 4) == 0) {
             CHECK(!json);
-            json = json_parse(data + 8, chunk_data_size);
+            json = json_parse_arena(data + 8, chunk_data_size);
         } else {
             callback(type, data + 8, chunk_data_size, json, user);
         }
@@ -129,19 +240,28 @@ int eph_load(const void *data, int data_size, void *user,
         data += chunk_data_size + 12;
         data_size -= chunk_data_size + 12;
     }
-    json_value_free(json);
+    json_arena_free(json);
     return 0;
 }
 
 // In place shuffle of the data bytes for optimized compression.
+// The transpose is done by square blocks, so that both the reads and the
+// writes of a block stay within a few cache lines and the compiler can
+// vectorize the inner copy, instead of striding over the whole buffer
+// for every byte.
+#define SHUFFLE_BLOCK 32
 void eph_shuffle_bytes(uint8_t *data, int nb, int size)
 {
-    int i, j;
+    int i, j, i0, j0, i1, j1;
     uint8_t *buf = malloc(nb * size);
     memcpy(buf, data, nb * size);
-    for (j = 0; j < size; j++) {
-        for (i = 0; i < nb; i++) {
-            data[j * nb + i] = buf[i * size + j];
+    for (j0 = 0; j0 < size; j0 += SHUFFLE_BLOCK) {
+        for (i0 = 0; i0 < nb; i0 += SHUFFLE_BLOCK) {
+            j1 = min(j0 + SHUFFLE_BLOCK, size);
+            i1 = min(i0 + SHUFFLE_BLOCK, nb);
+            for (j = j0; j < j1; j++)
+                for (i = i0; i < i1; i++)
+                    data[j * nb + i] = buf[i * size + j];
         }
     }
     free(buf);
@@ -255,3 +375,39 @@ int eph_read_table_row(const void *data, int data_size, int *data_ofs,
     *data_ofs += columns[0].row_size;
     return 0;
 }
+
+#if COMPILE_TESTS
+
+static void test_eph_shuffle_bytes(void)
+{
+    // Compare the blocked transpose against the naive loop, on matrix
+    // sizes that are not multiples of the block.
+    const struct { int nb, size; } cases[] = {
+        {1, 1}, {7, 3}, {32, 32}, {33, 32}, {45, 37}, {100, 52}, {257, 40},
+    };
+    uint8_t *data, *ref;
+    uint32_t seed = 1;
+    int c, i, j, nb, size;
+
+    for (c = 0; c < ARRAY_SIZE(cases); c++) {
+        nb = cases[c].nb;
+        size = cases[c].size;
+        data = malloc(nb * size);
+        ref = malloc(nb * size);
+        for (i = 0; i < nb * size; i++) {
+            seed = seed * 1664525 + 1013904223;
+            data[i] = seed >> 24;
+        }
+        for (j = 0; j < size; j++)
+            for (i = 0; i < nb; i++)
+                ref[j * nb + i] = data[i * size + j];
+        eph_shuffle_bytes(data, nb, size);
+        assert(memcmp(data, ref, nb * size) == 0);
+        free(data);
+        free(ref);
+    }
+}
+
+TEST_REGISTER(NULL, test_eph_shuffle_bytes, TEST_AUTO);
+
+#endif
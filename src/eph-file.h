@@ -28,6 +28,27 @@ int eph_load(const void *data, int data_size, void *user,
                              const json_value *json,
                              void *user));
 
+/*
+ * Function: eph_merge_delta
+ * Apply a delta eph file on top of a base eph file.
+ *
+ * The delta chunks replace the base chunks of the same type (see
+ * eph-file.c for the delta file conventions).
+ *
+ * Parameters:
+ *   base       - A full eph file, as previously released.
+ *   base_size  - Size of the base data.
+ *   delta      - A delta eph file made against this base.
+ *   delta_size - Size of the delta data.
+ *   out_size   - Output size of the merged file.
+ *
+ * Return:
+ *   A newly allocated merged eph file, or NULL in case of error (e.g. if
+ *   the delta doesn't match the base checksum).
+ */
+void *eph_merge_delta(const void *base, int base_size,
+                      const void *delta, int delta_size, int *out_size);
+
 int eph_read_tile_header(const void *data, int data_size, int *data_ofs,
                          int *version, int *order, int *pix);
 
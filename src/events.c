@@ -16,82 +16,175 @@
 
 // Events types
 enum {
-    EVENT_RISE      = 1 << 0,
-    EVENT_SET       = 1 << 1,
+    EVENT_RISE          = 1 << 0,
+    EVENT_SET           = 1 << 1,
+    // Twilights (sun only): dawn/dusk at the standard sun depressions.
+    EVENT_CIVIL_DAWN    = 1 << 2,
+    EVENT_CIVIL_DUSK    = 1 << 3,
+    EVENT_NAUTICAL_DAWN = 1 << 4,
+    EVENT_NAUTICAL_DUSK = 1 << 5,
+    EVENT_ASTRO_DAWN    = 1 << 6,
+    EVENT_ASTRO_DUSK    = 1 << 7,
 };
 
-// Newton algo.
-#define NEWTON_MAX_STEPS 20
-static double newton(double (*f)(double x, void *user),
-                     double x0, double x1, double precision, void *user)
+/*
+ * Incremental astronomical event search.
+ *
+ * The search runs as a coarse grid scan over the time range, refined by
+ * bisection around each sign change of the altitude function.  The scan
+ * is split into bounded slices (<event_search_step>) so that a long
+ * search (e.g. a year of rise and set times) can be spread over several
+ * frames and stream its results incrementally instead of blocking the
+ * UI for the whole duration.
+ */
+typedef struct event_search {
+    observer_t obs;     // Private observer moved along the scan.
+    obj_t *obj;
+    int events;         // Mask of the searched event types.
+    double end_time;
+    double precision;   // Precision of the returned times (day).
+    double step;        // Coarse grid step (day).
+    double x;           // Next coarse grid time to evaluate.
+    int last_sign;
+    bool done;
+    double found_time;  // Time of the last found event.
+} event_search_t;
+
+static int sign(double x)
+{
+    return x < 0 ? -1 : 1;
+}
+
+static double rise_dist(observer_t *obs, obj_t *obj, double time)
+{
+    double radius = 0, pvo[2][4], observed[4], az, alt;
+
+    obs->tt = time;
+    observer_update(obs, false);
+    obj_get_pvo(obj, obs, pvo);
+    convert_framev4(obs, FRAME_ICRF, FRAME_OBSERVED, pvo[0], observed);
+    eraC2s(observed, &az, &alt);
+    az = eraAnp(az);
+    obj_get_info(obj, obs, INFO_RADIUS, &radius);
+    return alt + radius - obs->horizon;
+}
+
+/*
+ * Refine a bracketed sign change by bisection.  s1 is the sign of the
+ * function at x1.
+ */
+static double bisect(event_search_t *s, double x0, double x1, int s1)
 {
-    int nbiter = 0;
-    double f0, f1, tmp;
-    double startDelta = fabs(x1 - x0);
-    f0 = f(x0, user);
-    f1 = f(x1, user);
-    while (f1 && fabs(x1 - x0) > precision && f1 != f0) {
-        tmp = x1;
-        x1 = x1 + (x1 - x0) / (f0 / f1 - 1.0);
-        x0 = tmp;
-        // Check for diverging
-        if (fabs(x1 - x0) > startDelta * 10)
-            return NAN;
-        f0 = f1;
-        f1 = f(x1, user);
-        if (nbiter++ > NEWTON_MAX_STEPS)
-            return x1;
+    double m, fm;
+
+    while (x1 - x0 > s->precision) {
+        m = (x0 + x1) / 2;
+        fm = rise_dist(&s->obs, s->obj, m);
+        if (sign(fm) == s1)
+            x1 = m;
+        else
+            x0 = m;
     }
-    return x1;
+    return (x0 + x1) / 2;
 }
 
-static int sign(double x)
+/*
+ * Function: event_search_create
+ * Start an incremental event search over a time range.
+ *
+ * Parameters:
+ *   obs        - The observer (copied).
+ *   obj        - The object.
+ *   events     - Mask of the searched event types (EVENT_RISE, EVENT_SET).
+ *   start_time - Start time of the search (TT, MJD).
+ *   end_time   - End time of the search (TT, MJD).
+ *   precision  - Precision of the returned times (day).
+ *
+ * The returned search has to be released with <event_search_delete>.
+ */
+EMSCRIPTEN_KEEPALIVE
+event_search_t *event_search_create(const observer_t *obs, obj_t *obj,
+                                    int events, double start_time,
+                                    double end_time, double precision)
 {
-    return x < 0 ? -1 : 1;
+    event_search_t *s = calloc(1, sizeof(*s));
+
+    s->obs = *obs;
+    s->obj = obj_retain(obj);
+    s->events = events;
+    s->end_time = end_time;
+    s->precision = precision;
+    // One hour coarse grid: comfortably below half the shortest interval
+    // between two successive rise/set events.
+    s->step = min(1.0 / 24, (end_time - start_time) / 24);
+    s->x = start_time;
+    return s;
 }
 
-static double find_zero(double (*f)(double x, void *user),
-                        double x0, double x1, double step, double precision,
-                        int rising, void *user)
+/*
+ * Function: event_search_step
+ * Run a bounded slice of an event search.
+ *
+ * Evaluate at most max_steps coarse grid points, stopping early as soon
+ * as an event has been found so that the results can be streamed back.
+ *
+ * Return:
+ *   The type of the found event (get its time with
+ *   <event_search_get_time>), 0 if the slice ended with more work
+ *   remaining, or -1 once the whole range has been scanned.
+ */
+EMSCRIPTEN_KEEPALIVE
+int event_search_step(event_search_t *s, int max_steps)
 {
-    int last_sign = 0;
-    double x, fx;
-    bool found = false;
-    // First find an approximate answer simply by stepping.  Not very clever.
-    // Make sure the last iteration is exactly at x1.
-    for (x = x0;; x += step) {
-        if (x > x1) x = x1; // Clamp to x1.
-        fx = f(x, user);
-        if (sign(fx) * last_sign == -1 && sign(fx) == rising) {
-            found = true;
-            break;
+    int i, sg, ev;
+    double fx;
+
+    if (s->done) return -1;
+    for (i = 0; i < max_steps; i++) {
+        if (s->x > s->end_time) s->x = s->end_time; // Clamp to the end.
+        fx = rise_dist(&s->obs, s->obj, s->x);
+        sg = sign(fx);
+        ev = 0;
+        if (sg * s->last_sign == -1)
+            ev = (sg == +1) ? EVENT_RISE : EVENT_SET;
+        s->last_sign = sg;
+        if (s->x == s->end_time) s->done = true;
+        if (ev & s->events) {
+            s->found_time = bisect(s, s->x - s->step, s->x, sg);
+            s->x += s->step;
+            return ev;
         }
-        last_sign = sign(fx);
-        if (x == x1) break;
+        s->x += s->step;
+        if (s->done) return -1;
     }
-    if (!found) return NAN;
-    // Once we are near the value, use newton algorithm.
-    return newton(f, x - step, x, precision, user);
+    return 0;
 }
 
-static double rise_dist(double time, void *user)
+/*
+ * Function: event_search_get_time
+ * Return the time of the last event found by <event_search_step>.
+ */
+EMSCRIPTEN_KEEPALIVE
+double event_search_get_time(const event_search_t *s)
 {
-    struct {
-        observer_t *obs;
-        obj_t *obj;
-    } *data = user;
-    double radius = 0, pvo[2][4], observed[4], az, alt;
+    return s->found_time;
+}
 
-    data->obs->tt = time;
-    observer_update(data->obs, false);
-    obj_get_pvo(data->obj, data->obs, pvo);
-    convert_framev4(data->obs, FRAME_ICRF, FRAME_OBSERVED, pvo[0], observed);
-    eraC2s(observed, &az, &alt);
-    az = eraAnp(az);
-    obj_get_info(data->obj, data->obs, INFO_RADIUS, &radius);
-    return alt + radius - data->obs->horizon;
+EMSCRIPTEN_KEEPALIVE
+void event_search_delete(event_search_t *s)
+{
+    if (!s) return;
+    obj_release(s->obj);
+    free(s);
 }
 
+/*
+ * Function: compute_event
+ * Return the time of the first matching event in the range, or NAN.
+ *
+ * Convenience blocking wrapper around the incremental search, kept for
+ * the simple one day visibility queries.
+ */
 EMSCRIPTEN_KEEPALIVE
 double compute_event(observer_t *obs,
                      obj_t *obj,
@@ -100,16 +193,160 @@ double compute_event(observer_t *obs,
                      double end_time,
                      double precision)
 {
-    observer_t obs2 = *obs;
-    double ret;
-    int rising;
-    struct {
-        observer_t *obs;
-        obj_t *obj;
-    } data = {&obs2, obj};
-    rising = event == EVENT_RISE ? +1 : -1;
-    ret = find_zero(rise_dist, start_time, end_time,
-                    (end_time - start_time) / 24, precision,
-                    rising, &data);
+    event_search_t *s;
+    int r;
+    double ret = NAN;
+
+    s = event_search_create(obs, obj, event, start_time, end_time, precision);
+    while ((r = event_search_step(s, 256)) == 0) {}
+    if (r > 0) ret = event_search_get_time(s);
+    event_search_delete(s);
     return ret;
 }
+
+/*
+ * Daily almanac cache.
+ *
+ * The planning UI asks for the rise/set times of all the major bodies
+ * and the twilights of the same day over and over; each of those is an
+ * iterative altitude search, so opening the panel used to run dozens of
+ * redundant scans.  Instead we compute all the standard events of a
+ * (day, location) in one pass the first time one of them is requested,
+ * and serve every following query from the cache.  The location (and
+ * the horizon refraction setting) is part of the key, so moving the
+ * observer naturally invalidates the entries; the day is keyed on the
+ * exact requested window start, so a time zone change on the caller
+ * side produces new window starts and thus new entries.
+ */
+
+static const char *ALMANAC_BODIES[] = {
+    "Sun", "Moon", "Mercury", "Venus", "Mars", "Jupiter", "Saturn",
+    "Uranus", "Neptune",
+};
+#define ALMANAC_NB (int)ARRAY_SIZE(ALMANAC_BODIES)
+#define ALMANAC_MAX_ENTRIES 64
+#define ALMANAC_PRECISION (1. / 24 / 60) // One minute.
+
+typedef struct almanac almanac_t;
+struct almanac {
+    UT_hash_handle hh;
+    struct {
+        double day;                 // Start of the day window (TT, MJD).
+        double latitude, longitude, elevation, horizon;
+    } key;
+    double times[ALMANAC_NB][2];    // Rise and set time of each body.
+    double twilights[6];            // Civil/nautical/astro dawn, dusk.
+};
+
+static almanac_t *g_almanacs = NULL;
+
+static void almanac_fill(almanac_t *a, const observer_t *obs_)
+{
+    observer_t obs = *obs_;
+    obj_t *obj;
+    // Sun depression of the three twilights (civil, nautical, astro).
+    const double depressions[3] = {-6 * DD2R, -12 * DD2R, -18 * DD2R};
+    int i;
+
+    for (i = 0; i < ALMANAC_NB; i++) {
+        obj = obj_get(NULL, ALMANAC_BODIES[i], 0);
+        if (!obj) {
+            a->times[i][0] = a->times[i][1] = NAN;
+            continue;
+        }
+        a->times[i][0] = compute_event(&obs, obj, EVENT_RISE, a->key.day,
+                                       a->key.day + 1, ALMANAC_PRECISION);
+        a->times[i][1] = compute_event(&obs, obj, EVENT_SET, a->key.day,
+                                       a->key.day + 1, ALMANAC_PRECISION);
+        obj_release(obj);
+    }
+
+    obj = obj_get(NULL, "Sun", 0);
+    if (!obj) {
+        for (i = 0; i < 6; i++) a->twilights[i] = NAN;
+        return;
+    }
+    for (i = 0; i < 3; i++) {
+        obs.horizon = obs_->horizon + depressions[i];
+        a->twilights[i * 2 + 0] = compute_event(
+                &obs, obj, EVENT_RISE, a->key.day, a->key.day + 1,
+                ALMANAC_PRECISION);
+        a->twilights[i * 2 + 1] = compute_event(
+                &obs, obj, EVENT_SET, a->key.day, a->key.day + 1,
+                ALMANAC_PRECISION);
+    }
+    obj_release(obj);
+}
+
+static almanac_t *almanac_get(const observer_t *obs, double day)
+{
+    almanac_t *a;
+
+    HASH_FIND(hh, g_almanacs, &((almanac_t){.key = {
+        .day = day,
+        .latitude = obs->phi,
+        .longitude = obs->elong,
+        .elevation = obs->hm,
+        .horizon = obs->horizon,
+    }}).key, sizeof(a->key), a);
+    if (a) return a;
+
+    // Evict the oldest entry if the cache is full.
+    if (HASH_COUNT(g_almanacs) >= ALMANAC_MAX_ENTRIES) {
+        a = g_almanacs;
+        HASH_DEL(g_almanacs, a);
+        free(a);
+    }
+
+    a = calloc(1, sizeof(*a));
+    a->key.day = day;
+    a->key.latitude = obs->phi;
+    a->key.longitude = obs->elong;
+    a->key.elevation = obs->hm;
+    a->key.horizon = obs->horizon;
+    almanac_fill(a, obs);
+    HASH_ADD(hh, g_almanacs, key, sizeof(a->key), a);
+    return a;
+}
+
+/*
+ * Function: almanac_get_event
+ * Return a standard daily event time from the almanac cache.
+ *
+ * All the events of the day are computed in one pass on the first query
+ * for a given (day, location); the following queries are simple
+ * lookups.
+ *
+ * Parameters:
+ *   obs   - The observer.
+ *   body  - Name of the body ("Sun", "Moon", planets), ignored for the
+ *           twilight events.
+ *   event - One single event type (EVENT_RISE, EVENT_CIVIL_DUSK...).
+ *   day   - Start of the one day search window (TT, MJD).
+ *
+ * Return:
+ *   The event time (TT, MJD), or NAN if the event doesn't occur in the
+ *   window.
+ */
+EMSCRIPTEN_KEEPALIVE
+double almanac_get_event(observer_t *obs, const char *body, int event,
+                         double day)
+{
+    almanac_t *a;
+    int i;
+
+    a = almanac_get(obs, day);
+    switch (event) {
+    case EVENT_CIVIL_DAWN:    return a->twilights[0];
+    case EVENT_CIVIL_DUSK:    return a->twilights[1];
+    case EVENT_NAUTICAL_DAWN: return a->twilights[2];
+    case EVENT_NAUTICAL_DUSK: return a->twilights[3];
+    case EVENT_ASTRO_DAWN:    return a->twilights[4];
+    case EVENT_ASTRO_DUSK:    return a->twilights[5];
+    }
+    for (i = 0; i < ALMANAC_NB; i++) {
+        if (strcasecmp(body, ALMANAC_BODIES[i]) != 0) continue;
+        return a->times[i][event == EVENT_SET ? 1 : 0];
+    }
+    return NAN;
+}
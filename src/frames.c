@@ -170,6 +170,55 @@ static void convert_frame_backward(const observer_t *obs,
     vec3_normalize(p, p);
 }
 
+/*
+ * Whether the conversion between two frames reduces to a pure rotation:
+ * everything does, except the astrometric corrections (aberration and
+ * light deflection) and refraction.
+ */
+static bool frame_pair_is_rotation(const observer_t *obs, int origin,
+                                   int dest)
+{
+    int lo = origin < dest ? origin : dest;
+    int hi = origin < dest ? dest : origin;
+    if (lo == FRAME_ASTROM) return false;
+    if (obs->refraction && lo < FRAME_OBSERVED && hi >= FRAME_OBSERVED)
+        return false;
+    return true;
+}
+
+void frame_rotations_update(observer_t *obs)
+{
+    int o, d, i;
+    double p[3];
+
+    obs->frame_rots_valid = 0;
+    for (o = 0; o < FRAMES_NB; o++)
+    for (d = 0; d < FRAMES_NB; d++) {
+        if (o == d || !frame_pair_is_rotation(obs, o, d)) continue;
+        // Build the matrix from the images of the basis vectors, so
+        // that the bundle matches the step by step conversions exactly.
+        for (i = 0; i < 3; i++) {
+            vec3_set(p, i == 0, i == 1, i == 2);
+            if (d > o)
+                convert_frame_forward(obs, o, d, true, p);
+            else
+                convert_frame_backward(obs, o, d, true, p);
+            vec3_copy(p, obs->frame_rots[o][d][i]);
+        }
+        obs->frame_rots_valid |= (uint64_t)1 << (o * FRAMES_NB + d);
+    }
+}
+
+// Get the cached rotation for a conversion, or NULL.
+static const double (*frame_rot(const observer_t *obs, int origin,
+                                int dest))[3]
+{
+    if (!(obs->frame_rots_valid &
+                ((uint64_t)1 << (origin * FRAMES_NB + dest))))
+        return NULL;
+    return obs->frame_rots[origin][dest];
+}
+
 EMSCRIPTEN_KEEPALIVE
 int convert_frame(const observer_t *obs,
                         int origin, int dest, bool at_inf,
@@ -178,10 +227,15 @@ int convert_frame(const observer_t *obs,
     PROFILE(convert_frame, PROFILE_AGGREGATE);
     obs = obs ?: (observer_t*)core->observer;
 
+    const double (*rot)[3];
+
     vec3_copy(in, out);
     assert(!isnan(out[0] + out[1] + out[2]));
 
-    if (dest > origin) {
+    if (dest != origin && (rot = frame_rot(obs, origin, dest))) {
+        mat3_mul_vec3(rot, out, out);
+        if (dest < origin) vec3_normalize(out, out);
+    } else if (dest > origin) {
         convert_frame_forward(obs, origin, dest, at_inf, out);
     } else if (dest < origin) {
         convert_frame_backward(obs, origin, dest, at_inf, out);
@@ -191,6 +245,35 @@ int convert_frame(const observer_t *obs,
     return 0;
 }
 
+EMSCRIPTEN_KEEPALIVE
+int convert_frame_n(const observer_t *obs,
+                        int origin, int dest, bool at_inf,
+                        int n, const double (*in)[3], double (*out)[3])
+{
+    PROFILE(convert_frame_n, PROFILE_AGGREGATE);
+    int i;
+    const double (*rot)[3];
+    obs = obs ?: (observer_t*)core->observer;
+
+    if (dest != origin && (rot = frame_rot(obs, origin, dest))) {
+        for (i = 0; i < n; i++) {
+            mat3_mul_vec3(rot, in[i], out[i]);
+            if (dest < origin) vec3_normalize(out[i], out[i]);
+        }
+        return 0;
+    }
+
+    for (i = 0; i < n; i++) {
+        vec3_copy(in[i], out[i]);
+        assert(!isnan(out[i][0] + out[i][1] + out[i][2]));
+        if (dest > origin)
+            convert_frame_forward(obs, origin, dest, at_inf, out[i]);
+        else if (dest < origin)
+            convert_frame_backward(obs, origin, dest, at_inf, out[i]);
+    }
+    return 0;
+}
+
 EMSCRIPTEN_KEEPALIVE
 int convert_framev4(const observer_t *obs,
                         int origin, int dest,
@@ -306,10 +389,15 @@ void apparent_to_astrometric(const observer_t *obs, const double in[3],
 bool frame_get_rotation(const observer_t *obs, int origin, int dest,
                         double rot[3][3])
 {
-    // For the moment we only support ICRF to VIEW, without refraction.
-    if (origin != FRAME_ICRF || dest != FRAME_VIEW || obs->refraction)
-        return false;
-    mat3_copy(obs->rc2v, rot);
+    const double (*cached)[3];
+
+    if (origin == dest) {
+        mat3_set_identity(rot);
+        return true;
+    }
+    cached = frame_rot(obs, origin, dest);
+    if (!cached) return false;
+    mat3_copy(cached, rot);
     return true;
 }
 
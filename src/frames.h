@@ -144,6 +144,30 @@ int convert_framev4(const observer_t *obs,
                     int origin, int dest,
                     const double in[S 4], double out[S 4]);
 
+/*
+ * Function: convert_frame_n
+ * Same as <convert_frame>, but on a contiguous array of vectors.
+ *
+ * Useful in the hot rendering loops: the per call setup is paid only
+ * once and the inner loop is a better vectorization candidate for the
+ * compiler.
+ *
+ * Parameters:
+ *  obs     - The observer.  If NULL we use the current core observer.
+ *  origin  - Origin coordinates.  One of the <FRAME> enum values.
+ *  dest    - Destination coordinates.  One of the <FRAME> enum values.
+ *  at_inf  - true for fixed objects (see <convert_frame>).
+ *  n       - Number of vectors.
+ *  in      - The input coordinates array.
+ *  out     - The output coordinates array (can be the same as in).
+ *
+ * Return:
+ *  0 for success.
+ */
+int convert_frame_n(const observer_t *obs,
+                    int origin, int dest, bool at_inf,
+                    int n, const double (*in)[3], double (*out)[3]);
+
 /* Enum: ORIGIN
  * Represent a reference system, i.e. the origin of a reference frame and the
  * associated intertial frame.
@@ -286,6 +310,17 @@ void apparent_to_astrometric(const observer_t *obs, const double in[S 3],
 bool frame_get_rotation(const observer_t *obs, int origin, int dest,
                         double rot[3][3]);
 
+/*
+ * Function: frame_rotations_update
+ * Refresh the observer's bundle of frame to frame rotation matrices.
+ *
+ * Called at the end of each observer update, so that the conversions
+ * that reduce to a pure rotation (everything except the astrometric
+ * corrections and refraction) become a single cached mat3 multiply in
+ * <convert_frame> and <frame_get_rotation>.
+ */
+void frame_rotations_update(observer_t *obs);
+
 #undef S
 
 #endif // FRAMES_H
@@ -14,6 +14,7 @@
 #include "utlist.h"
 #include "erfa.h"
 
+#include <assert.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -525,29 +526,183 @@ error:
  */
 void geojson_delete(geojson_t *geojson)
 {
-    int i, j;
-    geojson_feature_t *feature;
-    geojson_geometry_t *geo;
+    int i;
 
     if (!geojson) return;
 
-    for (i = 0; i < geojson->nb_features; i++) {
-        feature = &geojson->features[i];
-        free(feature->properties.title);
-        geo = &feature->geometry;
-        switch (geo->type) {
-        case GEOJSON_LINESTRING:
-            free(geo->linestring.coordinates);
-            break;
-        case GEOJSON_POLYGON:
-            for (j = 0; j < geo->polygon.size; j++)
-                free(geo->polygon.rings[j].coordinates);
-            free(geo->polygon.rings);
-            break;
-        default:
-            break;
-        }
-    }
+    for (i = 0; i < geojson->nb_features; i++)
+        geojson_feature_cleanup(&geojson->features[i]);
     free(geojson->features);
     free(geojson);
 }
+
+/*
+ * Function: geojson_feature_cleanup
+ * Free the content of a feature (but not the feature itself).
+ */
+void geojson_feature_cleanup(geojson_feature_t *feature)
+{
+    int j, k;
+    geojson_geometry_t *geo = &feature->geometry;
+
+    free(feature->properties.title);
+    switch (geo->type) {
+    case GEOJSON_LINESTRING:
+        free(geo->linestring.coordinates);
+        break;
+    case GEOJSON_POLYGON:
+        for (j = 0; j < geo->polygon.size; j++)
+            free(geo->polygon.rings[j].coordinates);
+        free(geo->polygon.rings);
+        break;
+    case GEOJSON_MULTIPOLYGON:
+        for (j = 0; j < geo->multipolygon.size; j++) {
+            for (k = 0; k < geo->multipolygon.polygons[j].size; k++)
+                free(geo->multipolygon.polygons[j].rings[k].coordinates);
+            free(geo->multipolygon.polygons[j].rings);
+        }
+        free(geo->multipolygon.polygons);
+        break;
+    default:
+        break;
+    }
+    memset(feature, 0, sizeof(*feature));
+}
+
+/*
+ * Minimal json scanner used by the streaming parser: we only need to
+ * find the extent of the top level values, the actual parsing of each
+ * feature still goes through json_parse.
+ */
+
+static const char *stream_skip_ws(const char *s)
+{
+    while (*s == ' ' || *s == '\t' || *s == '\n' || *s == '\r') s++;
+    return s;
+}
+
+// Skip a json string, s pointing at the opening quote.
+static const char *stream_skip_string(const char *s)
+{
+    assert(*s == '"');
+    for (s++; *s && *s != '"'; s++)
+        if (*s == '\\' && s[1]) s++;
+    if (*s != '"') return NULL;
+    return s + 1;
+}
+
+// Skip a whole json value (scalar, object or array).
+static const char *stream_skip_value(const char *s)
+{
+    int depth = 0;
+    s = stream_skip_ws(s);
+    if (*s == '"') return stream_skip_string(s);
+    if (*s != '{' && *s != '[') { // Scalar.
+        while (*s && *s != ',' && *s != '}' && *s != ']' &&
+               *s != ' ' && *s != '\t' && *s != '\n' && *s != '\r') s++;
+        return s;
+    }
+    for (; *s; s++) {
+        if (*s == '"') {
+            s = stream_skip_string(s);
+            if (!s) return NULL;
+            s--;
+            continue;
+        }
+        if (*s == '{' || *s == '[') depth++;
+        if (*s == '}' || *s == ']') {
+            depth--;
+            if (depth == 0) return s + 1;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Function: geojson_parse_str_stream
+ * Parse a geojson document, emitting the features one by one.
+ *
+ * Unlike <geojson_parse> this doesn't build a dom of the whole
+ * document: the text is scanned for the extent of each feature of the
+ * collection and only that slice is parsed at a time, so the peak
+ * memory stays in the order of the largest feature.
+ *
+ * Parameters:
+ *   str      - The geojson text.
+ *   user     - Data passed to the callback.
+ *   callback - Called once per feature, with a feature only valid for
+ *              the duration of the call.  Return non zero to stop.
+ *
+ * Return:
+ *   The number of features emitted, or -1 in case of error.
+ */
+int geojson_parse_str_stream(const char *str, void *user,
+        int (*callback)(void *user, const geojson_feature_t *feature))
+{
+    const char *s, *key, *start, *end;
+    json_value *data;
+    geojson_t *geojson;
+    geojson_feature_t feature;
+    int i, nb = 0;
+    bool in_features = false;
+
+    // Find the top level 'features' array.
+    s = stream_skip_ws(str);
+    if (*s != '{') goto fallback;
+    s = stream_skip_ws(s + 1);
+    while (*s == '"') {
+        key = s;
+        s = stream_skip_string(s);
+        if (!s) return -1;
+        in_features = (s - key == 10 && strncmp(key, "\"features\"", 10) == 0);
+        s = stream_skip_ws(s);
+        if (*s != ':') return -1;
+        s = stream_skip_ws(s + 1);
+        if (in_features && *s == '[') break;
+        s = stream_skip_value(s);
+        if (!s) return -1;
+        s = stream_skip_ws(s);
+        if (*s != ',') goto fallback;
+        s = stream_skip_ws(s + 1);
+    }
+    if (!in_features || *s != '[') goto fallback;
+
+    // Stream the elements of the array, parsing one at a time.
+    s = stream_skip_ws(s + 1);
+    while (*s != ']') {
+        start = s;
+        end = stream_skip_value(s);
+        if (!end) return -1;
+        data = json_parse_arena(start, end - start);
+        if (!data) return -1;
+        memset(&feature, 0, sizeof(feature));
+        if (parse_feature(data, &feature)) {
+            json_arena_free(data);
+            return -1;
+        }
+        json_arena_free(data);
+        nb++;
+        i = callback(user, &feature);
+        geojson_feature_cleanup(&feature);
+        if (i) return nb;
+        s = stream_skip_ws(end);
+        if (*s == ',') s = stream_skip_ws(s + 1);
+        else if (*s != ']') return -1;
+    }
+    return nb;
+
+fallback:
+    // Not a feature collection (or unexpected layout): parse the whole
+    // document, this is bounded by the document anyway.
+    data = json_parse_arena(str, strlen(str));
+    if (!data) return -1;
+    geojson = geojson_parse(data);
+    json_arena_free(data);
+    if (!geojson) return -1;
+    for (i = 0; i < geojson->nb_features; i++) {
+        nb++;
+        if (callback(user, &geojson->features[i])) break;
+    }
+    geojson_delete(geojson);
+    return nb;
+}
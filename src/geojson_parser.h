@@ -156,6 +156,32 @@ typedef struct geojson {
  */
 geojson_t *geojson_parse(const json_value *data);
 
+/*
+ * Function: geojson_parse_str_stream
+ * Parse a geojson document, emitting the features one by one.
+ *
+ * Unlike <geojson_parse> this doesn't build a dom of the whole
+ * document: only one feature is parsed at a time, so the peak memory
+ * stays in the order of the largest feature.
+ *
+ * Parameters:
+ *   str      - The geojson text.
+ *   user     - Data passed to the callback.
+ *   callback - Called once per feature, with a feature only valid for
+ *              the duration of the call.  Return non zero to stop.
+ *
+ * Return:
+ *   The number of features emitted, or -1 in case of error.
+ */
+int geojson_parse_str_stream(const char *str, void *user,
+        int (*callback)(void *user, const geojson_feature_t *feature));
+
+/*
+ * Function: geojson_feature_cleanup
+ * Free the content of a feature (but not the feature itself).
+ */
+void geojson_feature_cleanup(geojson_feature_t *feature);
+
 /*
  * Function: geojson_delete
  * Delete a geojson_t instance created with <geojson_parse>.
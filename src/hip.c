@@ -7,18 +7,28 @@
  * repository.
  */
 
-#include <stdint.h>
+#include "swe.h"
 
-static const uint8_t PIX_ORDER_2[] = {
-#include "hip.inl"
-};
+/*
+ * HIP -> healpix pix at order 2: one byte per HIP number (255 for unknown),
+ * served directly from the binary asset generated by tools/make-hip.py,
+ * without any parsing or copy.
+ */
+static const uint8_t *g_pix_order_2 = NULL;
+static int g_pix_order_2_size = 0;
 
 int hip_get_pix(int hip, int order)
 {
-    int ret;
+    int ret, code;
+
     if (order > 2) return -1;
-    if (hip >= sizeof(PIX_ORDER_2)) return -1;
-    ret = PIX_ORDER_2[hip];
+    if (!g_pix_order_2) {
+        g_pix_order_2 = asset_get_data("asset://hip.dat",
+                                       &g_pix_order_2_size, &code);
+        if (!g_pix_order_2) return -1;
+    }
+    if (hip >= g_pix_order_2_size) return -1;
+    ret = g_pix_order_2[hip];
     if (ret == 255) return -1;
     ret /= (1 << (2 * (2 - order))); // For order 0 and 1.
     return ret;
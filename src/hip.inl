@@ -1,8030 +0,0 @@
-// HIP -> pix pos at order 2.
-// Generated by tools/make-hip.py
-255,  76,  64,  79, 138,  64,  76,  79,  79,  79, 138,  10,  64,  64,  67,
- 10, 136,  64,  67,  79,  79,  76, 138,  76,  64, 138,  67,  64, 138, 138,
- 10,  76,  10,  67,  79,  67,  76, 138, 128,  67,  14,  11,  79,  11,  67,
-130,  64, 136,  64,  76, 138,  76, 130,  64,  76, 130,  76, 130,  11,  11,
-136,  10, 138,  10,  64, 136, 130,  79,  76,  79,  79,  79,  67,  14,  79,
-138,  79,  64,  76,  79,  67,  67,  67,  10,  79,  64,  14,  67, 138,  10,
-138,  67,  64,  70,  64,  67,  76,  64, 138,  11,  77, 138, 138, 130,  64,
- 14,  10, 138, 130,  76,  79,  79,  67,  10,  79, 136,  64, 130,  67,  10,
-138,  79, 130,  14,  11,  64,  76, 138,  14,  76,  64,  11,  64,  64,  67,
- 70,  79,  10,  67,  14, 130,  79,  11,  79,  14,  67,  64,  79,  76,  79,
- 64, 138,  64,  76,  67,  10,  11,  67,  64,  67, 130,  79,  79,  64,  11,
- 64, 136,  79,  67, 130,  64,  79,  14,  10,  11,  10,  10,  67,  64,  67,
- 67,  11,  10,  64,  76,  76,  76,  67,  76,  11,  76, 138,  76,  64,  76,
- 10,  10,  10,  76,  76,  64,  76,  11,  67, 138,  67,  76,  11, 130,  11,
- 67,  64,  64,  10,  79,  14,  10,  15, 136,  76,  79,  15,  64,  76,  76,
- 67,  64,  15,  79,  10,  79, 136,  64,  14,  14,  14,  67,  64,  65,  76,
- 76,  76,  64, 136,  79,  67,  11,  76,  76,  79,  10,  64,  79,  64,  10,
- 64,  11,  64,  76,  10, 136,  64,  79,  76,  79, 136,  67,  67,  11,  79,
- 14,  64,  64, 138,  11,  64,  79,  64,  11,  11,  10,  11,  77,  76, 136,
- 64,  15,  67,  10, 138,  64,  64,  14, 136,  76, 138,  64,  10,  76, 136,
- 10,  67,  14,  11,  79,  64, 136, 138,  76, 138, 138,  79,  11, 138,  79,
-130,  76, 128,  64,  11,  67,  64,  11,  10,  76,  79,  76,  67,  64,  67,
- 11,  64,  64,  67,  11,  76,  11,  64,  14, 136, 138,  64,  64,  67,  79,
- 64, 136,  11,  76,  64, 136, 138,  11, 138,  10,  67,  67, 130, 130, 130,
- 14, 130,  65,  10,  67,  10,  64, 128,  76,  79, 138, 138, 130,  67,  79,
- 79,  76, 130,  76,  14,  76,  10,  64,  70,  76,  79,  14,  79,  76,  64,
- 10,  10,  79,  10,  79,  64,  64,  10,  11,  79,  79,  11,  11,  67,  10,
- 10,  79, 130,  11, 130,  79,  79,  14,  64, 136,  76,  70,  70,  11, 138,
-138,  10,  14,  79,  10, 136,  79, 138,  10,  76,  64,  79,  79,  76,  64,
-138, 130,  10,  67,  64,  14,  64,  64,  67, 136, 136, 128,  76,  76,  64,
- 79,  76,  79,  67,  67,  14,  64, 138,  67, 136,  79,  79,  67,  64,  64,
- 14,  10, 138, 136, 138,  10, 136,  11,  10,  10,  11,  76,  64,  64,  79,
- 67,  64,  76,  15,  65,  10, 138,  15, 130,  76, 138,  76,  67,  77, 130,
- 76,  79,  10,  10, 136, 138,  64,  79,  76,  79,  11,  10, 128,  10,  64,
- 76,  70,  64,  15,  64,  67,  64, 136,  11, 136,  67,  70, 138, 136,  67,
- 10,  11,  14,  64,  65,  10,  11, 130,  67, 138, 138,  79,  64,  76,  10,
- 79, 138,  11,  64,  79,  79,  64,  64,  14,  11,  11,  76,  67,  64,  67,
- 76,  67,  79, 130,  10,  64,  14,  77,  79, 138,  76,  10,  64, 136,  67,
- 64,  64,  79, 138, 138,  11,  11,  79,  79,  76,  65,  76,  11,  15,  67,
- 64,  64,  64,  76,  14,  79,  10,  11,  76, 136,  64, 130,  14,  77, 138,
- 64,  77,  67,  76,  76, 136,  64,  79,  67,  67, 130, 138, 136,  76,  79,
- 79,  64,  79, 136,  79, 128, 136,  10,  10, 138,  10,  10, 130,  70,  67,
- 79, 130, 136, 138,  79,  67,  64,  67,  79,  67,  79,  11,  67, 138, 138,
- 67,  65, 128, 128,  67,  79, 138,  79,  64, 138,  64,  11,  64,  76,  79,
- 14, 136, 130,  64,  67, 138, 138,  79,  10,  67,  79,  67, 255,  64, 138,
- 76,  79,  79,  65,  10, 136, 138,  76,  10, 138, 138,  64,  76,  64,  79,
-130,  10,  67,  77,  76,  11,  65,  10, 130,  79,  67,  14, 138, 128,  76,
- 15,  64, 130,  64, 138,  76,  67,  10, 136,  10,  64,  79,  70, 138,  64,
- 64,  64,  76,  14,  65,  79, 138,  10,  79,  77, 136,  79,  64,  76,  64,
- 79, 136,  10,  64,  64,  77,  64, 138, 138, 138,  64,  11,  10,  77,  64,
- 10,  10,  70,  79,  79,  11,  64, 136, 138,  77,  15,  64, 138,  11,  76,
-138,  70,  10,  77,  70,  67,  67,  64,  77, 138, 130, 138,  65, 138,  11,
- 79,  10, 136,  64,  11, 136,  64,  64,  67,  79,  77, 138,  67,  11,  64,
- 76,  11,  76, 136,  76,  10, 138,  76,  67, 128, 138,  76,  76,  10, 136,
- 64,  64,  10,  76, 128, 136, 130,  10,  67, 128,  15,  79,  15,  79,  79,
- 10,  10,  64,  10, 128,  67, 138,  64,  65,  11,  79,  11,  10,  10, 130,
- 67,  10,  64,  77, 138, 138,  67,  67,  11,  67,  64,  67,  79, 130,  76,
- 10,  76,  11,  79,  10,  11, 138, 138, 136,  76, 130,  11,  76,  76,  76,
- 70,  11, 136,  67,  11,  64,  11,  11,  64, 130,  79,  64,  79, 136,  10,
- 10,  79,  67,  64,  10,  11, 138,  70,  65,  10,  79,  76,  67,  76,  67,
- 76,  79,  11, 128,  67,  10,  67,  76,  76,  76,  67,  65,  64, 138,  64,
- 64,  11,  10,  14,  79,  79,  67,  65,  79, 138,  70,  10, 136,  64, 136,
- 64,  67,  65,  76, 136,  79,  67,  64, 128,  65,  11, 130,  11,  76, 138,
- 11,  79,  67, 138,  11,  64,  11,  79,  64,  76,  65,  79,  14, 136,  10,
- 65,  64,  67,  64,  64, 130, 138,  10,  70,  79, 136,  79,  10,  67,  79,
-136,  67,  67,  10, 136,  10,  11,  10,  65,  10,  64,  10,  67,  10,  79,
-138, 138, 136,  67, 136,  10,  77, 136,  79,  76,  65,  64, 138,  64,  79,
- 67,  77, 128,  10,  10,  64,  10,  67,  64,  10,  76, 136, 136,  70, 138,
- 77,  11,  76,  11,  79,  79,  10,  76,  64, 138,  79, 136,  65,  67,  64,
- 79,  14,  79,  76,  11,  76,  14,  11,  10, 138,  64,  64,  64,  79,  79,
- 76,  77,  15,  67,  64,  77,  64,  77, 138,  76,  64,  77,  67,  11,  77,
- 65,  64,  76,  14,  64,  77,  64,  65,  76, 128,  10,  79,  14,  77,  79,
- 14, 136,  70,  64, 130, 138,  10,  70,  64,  79,  10, 130,  15,  10,  64,
- 76,  64, 138,  77,  64,  10, 138,  64,  76,  11,  11, 138,  70,  77,  77,
- 79, 138,  79, 130, 136,  65, 138,  67,  11,  67,  67,  70,  10,  79,  14,
- 10, 130,  70,  67, 138,  76,  14,  11,  79,  67,  76,  64,  79,  64,  11,
-136,  67, 130,  11,  64,  70, 136,  65,  11,  76,  14,  64,  10,  70,  64,
-138,  77,  10,  67, 136,  65,  67,  11,  65,  10, 138,  64,  11,  77,  70,
- 65, 138, 138, 138,  76,  64,  67,  67,  10,  76,  11, 138, 138,  64,  11,
- 67,  64,  64,  79,  70,  64,  67,  70,  77,  77,  64,  76,  76,  64,  76,
- 14,  67,  11,  64,  10,  79, 130,  79,  79,  11,  64,  79, 138,  11,  77,
- 79,  15, 130,  64,  79,  64, 138,  11,  64,  11, 138, 138,  14, 138,  10,
- 67,  65, 138,  10,  79,  11,  64,  67,  64,  79,  11,  67,  65, 138,  10,
- 76, 130,  10,  64,  76, 130,  64,  67,  76,  64,  10,  10,  10, 130,  11,
- 67,  10,  64,  11,  70,  67,  67,  11, 130,  11, 138,  65,  76,  10,  67,
- 65, 138,  76, 130, 138, 138, 130,  64, 136,  15,  67,  76, 138,  64,  10,
- 64,  11, 128, 136,  79,  77,  14,  79,  65,  64,  14,  77,  10,  67,  65,
- 64,  65, 138, 138, 130,  11,  64, 130, 136, 136,  64, 138,  65,  67,  76,
- 77,  70, 138,  65,  67,  70,  76, 138,  64,  11,  64,  65, 138,  79,  77,
- 10,  79,  10,  10,  76,  76, 138, 128,  10,  79, 138,  10,  15,  67, 136,
- 67,  67,  10,  77,  11,  11, 136,  11,  77,  15,  70,  79,  67,  11,  76,
- 70,  10,  79,  10,  67,  10,  64,  10,  77,  65, 136, 138,  79,  67,  79,
- 67,  11, 138,  11,  70,  70,  79, 130,  77,  77,  77, 138,  76, 138, 130,
-138, 130,  70, 138, 136,  10,  10,  65,  79, 130,  14,  79, 136, 136,  10,
- 76,  10,  67, 136,  14,  10,  79,  11, 138, 130,  70,  70,  67,  67,  70,
-128, 138,  77,  11,  77, 138,  10,  76,  65,  10,  76,  77,  70,  76,  76,
- 64,  79,  10,  67,  67,  10,  76,  76,  79,  65, 130, 138, 128,  64, 138,
- 70,  10, 136, 136,  79,  11,  14, 130,  76,  65,  76,  11,  64,  77,  64,
- 70, 138, 136,  10,  10,  10, 138,  79,  10,  15,  77, 136,  77, 136,  14,
- 64,  11, 138,  79,  64,  10, 138,  79,  79,  64,  77,  10,  76,  65,  67,
- 64,  10, 138,  77, 136,  14,  65, 138, 130,  67,  14,  79,  70,  65,  64,
- 65, 138,  67, 136,  10,  11,  11,  11,  64,  10,  65,  11,  64,  76,  11,
- 77, 128,  67, 136,  77,  76, 130,  64,  77,  70,  14,  76,  11,  11,  64,
- 70,  65,  76,  11,  14,  11, 138, 138,  79,  76, 136,  67,  14,  14,  77,
-136, 138,  67,  76, 130,  65,  76, 136,  79, 255,  65, 138, 130,  67, 138,
- 10,  64, 136,  79,  10,  14,  67, 136,  10,  14,  65,  11,  70,  67,  76,
- 11,  10,  11,  10,  10,  77,  70,  64,  10, 136,  65,  70,  76,  10,  10,
- 11,  14,  67,  65,  70,  64,  67,  76, 136,  79,  77,  64,  10,  10,  79,
- 76,  11,  67, 130, 138,  64,  67, 136,  76,  14,  79,  64,  70, 136,  10,
- 76, 138,  11,  76,  10,  79,  10,  10,  77,  11,  76,  76, 130, 138, 128,
- 10, 130,  11,  70,  65,  64,  79,  79,  67,  64,  65,  70, 138,  70,  77,
-128,  65, 138,  64,  79,  76,  10, 130,  11,  14,  64,  10,  76,  65,  64,
- 79,  10,  67, 136,  70,  64,  10,  77,  79,  79,  79,  70,  67, 138,  64,
- 79, 138, 136,  67,  79,  14,  79,  77,  79,  79, 138, 130, 130,  64,  79,
- 64,  10,  64, 138, 130,  10,  10,  11,  65, 130, 138,  10,  10, 138,  15,
- 14, 136,  11,  65,  65,  11,  65,  65,  14,  64,  11,  77,  10,  76,  67,
- 79,  10, 138,  11,  79,  64,  64, 136,  14, 138,  64, 136,  67, 138,  64,
- 67,  14,  77, 138,  79,  10, 138,  11,  79, 130,  65, 138,  76,  64,  79,
- 76,  76,  76,  14,  10, 136, 136, 136,  67, 130,  76, 136, 138,  70,  65,
- 77,  11,  67, 138,  64, 128,  65,  67, 138,  11, 138,  67, 138,  79,  79,
-136, 138, 128,  67, 138,  11, 128, 136,  65,  10,  76,  11,  67,  77, 138,
- 67,  76, 136,  10,  11, 138,  65,  65, 130, 138,  70,  10,  64, 138,  77,
- 64,  67,  67,  10,  11, 130,  64,  64, 130,  10,  11,  70, 138,  70,  11,
- 76,  11,  76,  79,  64,  11,  11,  11,  79,  65,  10,  64, 138,  76, 136,
- 14,  10, 136,  64,  77,  67,  70,  10,  65,  70,  64,  10,  11,  70,  70,
-136, 130, 136,  79,  10, 138,  65,  10, 138,  76, 138,  70,  79,  77,  10,
-138,  79,  11,  65,  70,  14,  10,  77,  64,  65,  70,  10, 130,  79, 138,
- 10, 138,  10, 136, 130, 136, 138, 136,  65, 130,  65,  10,  70,  11,  77,
-138,  11,  76,  15,  70,  11,  11,  70,  64, 138,  11, 136,  14,  65,  79,
- 11,  64, 128,  76,  70,  64,  70,  11,  70,  65,  11,  77, 138,  77,  77,
- 65,  10,  79, 130, 136, 138,  77,  64,  65, 136,  11,  65,  65,  11,  67,
- 76,  64,  65,  77,  65, 138,  64,  10, 136,  70,  77,  64, 138,  10,  10,
- 79,  10,  11,  77,  10, 130,  64,  10,  11,  77,  79, 130, 138, 136, 136,
-138,  10,  79,  76,  77,  76, 138,  77,  65,  10, 138,  70, 130,  10,  11,
-138,  64,  14, 130,  65,  77,  79,  65,  10, 136, 138, 130,  65,  77,  11,
- 76, 138,  65, 138, 138,  70,  64,  64,  10,  10,  76,  14,  14,  67,  76,
- 10,  64,  67,  67,  67,  64,  70,  70,  77,  64,  77, 138,  70,  10,  10,
- 79, 136,  70,  77,  10,  77, 136,  67,  11,  10, 138,  67,  76,  77,  65,
- 11, 136, 138,  70,  11,  10, 138,  79, 136,  65,  70, 138,  79,  76,  11,
- 10,  65,  10,  77,  10,  11, 138,  11,  14, 138,  64,  11,  11,  65,  65,
- 70,  11,  79,  10,  79,  10, 130, 138,  10,  11,  65, 130, 136,  79, 138,
-128,  77,  70,  76,  70,  14,  70,  65,  76, 130, 138, 130, 130,  10,  77,
-138,  11, 136,  79,  65,  77, 138, 130,  70,  65,  67,  64,  15,  67,  79,
- 10,  11,  77, 130,  10,  65,  10,  77,  10,  76,  64,  70,  64,  65,  65,
-136, 138,  65,  14,  64,  70,  70,  67, 136,  64,  79,  77,  70,  77,  79,
- 64, 136,  64,  77,  77,  10,  76, 130,  65,  65, 138, 130, 138, 136,  65,
- 65,  11,  11,  77,  64,  70,  65,  77,  10,  10,  79,  67,  77,  65,  11,
- 10,  77,  65,  70, 136,  64,  14,  70,  77, 130,  67,  79, 138, 136,  77,
- 77,  11,  77,  11,  77,  10, 136,  64, 130,  10, 138,  79,  11, 138, 130,
- 76, 138,  65,  65,  64, 138,  79,  70,  79,  76,  76,  67,  65,  10,  79,
- 67, 136,  10, 136, 138,  65, 138,  70,  10,  11, 136, 138, 136,  65,  76,
- 77, 138,  11,  10, 138,  10,  10, 136,  64,  65,  67,  64,  77,  64, 136,
- 76,  70, 138,  67, 138,  10, 138,  65,  65,  11,  65,  65,  70,  15, 138,
- 64,  10, 138,  70,  15,  79,  79,  67, 138, 138,  10,  79,  11,  11,  77,
- 10,  67,  70,  77,  77,  76,  77, 130, 138,  64,  11, 138,  70,  70,  79,
- 11,  79,  77,  11,  11,  64,  70,  76,  70,  64,  10,  10,  65, 138,  11,
- 76,  10,  64,  70,  65, 130,  64,  11, 138, 136,  70,  65,  14,  70,  11,
- 79,  76,  67,  70,  65,  77,  64,  67,  65,  11,  77,  10,  11,  65,  70,
- 64,  14, 136,  76,  77,  64, 138,  11,  14,  65,  64,  65,  11, 138,  10,
- 14,  65,  70, 138,  65,  14,  70, 138,  79,  67,  77,  10,  77,  70,  65,
- 10,  77,  77,  65,  64,  64, 136,  79,  67,  11,  76,  77,  77,  11,  10,
- 77, 136, 138,  14,  15,  10,  79,  14,  11, 138,  10,  14, 138, 138,  10,
- 11,  67,  11,  64,  10, 136, 138,  10,  64,  10,  11,  76,  11,  65,  67,
-130, 138, 138, 138, 130,  11,  65, 138,  14,  11,  10, 138,  11,  70,  11,
- 11,  65, 136,  65,  14, 138,  11,  67, 136,  10, 138,  70, 138,  10,  14,
- 10,  10,  70, 138,  76,  77,  77,  70,  67, 136,  10, 138, 136, 136, 136,
- 77,  76,  70,  11,  11,  77,  70,  11,  77, 138,  70,  11,  77,  11, 136,
- 11,  64,  10,  77,  10,  70,  64,  77,  65,  10,  70,  10,  77,  79,  70,
- 79,  70,  79,  65,  14,  14,  11,  65,  10,  79, 138,  11,  67,  70,  10,
- 10,  65,  11,  65,  10, 136,  79, 136,  11,  65,  10,  77,  77,  76,  77,
- 65,  64,  14,  10, 138, 136, 130,  11, 138,  76,  77,  64,  11,  79,  11,
- 79,  70,  65,  77,  67,  64,  65,  65,  77, 138,  15,  10,  77, 136,  65,
-138,  11,  14,  79,  65,  70,  65,  10, 138,  65,  76,  11, 130,  79,  76,
- 77,  10,  77,  65,  11,  10,  64,  10,  10,  10, 138,  11, 138,  67,  76,
-136,  11,  70,  11, 136, 128, 138,  64,  67,  65,  11,  77,  65,  65,  11,
- 10,  77,  65,  14, 130, 136, 138,  70, 136,  65,  10, 130,  10, 138,  76,
- 76,  70, 136,  10,  11, 138, 136,  11,  77,  65, 138,  10, 138,  65,  70,
- 65,  11,  11,  77,  70,  65,  64, 130, 138,  14, 138,  10,  11,  10,  11,
-138,  76,  77, 138, 138,  15,  64,  70,  77,  14,  70,  10, 136,  64, 136,
- 64,  70, 138,  70,  10,  11,  11, 138,  77,  79,  76,  77,  11,  70,  70,
- 77, 138, 136,  70,  67,  10,  70,  14, 138,  65,  70, 136,  10,  70, 138,
- 70,  11,  11,  14,  14, 138,  67, 136, 138,  76,  77, 136,  65,  77, 136,
- 77, 130,  77,  77,  77,  70,  70,  65, 138,  65,  10,  65,  10, 136,  65,
- 65, 136, 138, 130,  15,  10,  76,  10,  10,  77, 136,  11, 138, 136,  70,
- 11, 136,  70,  11, 128,  70,  64,  77,  11,  65,  14,  65,  11,  10,  77,
- 65,  65,  77,  11,  11,  77,  70,  11,  10,  76,  70,  70,  70,  65, 136,
-138,  11,  10,  10,  15,  11,  14,  15,  65,  79,  65,  10, 138, 138,  79,
- 67, 130,  10,  10, 136, 136,  67, 130,  11,  10,  77,  11, 138,  10,  65,
-130,  77,  77,  10,  79,  79,  14,  65,  77,  77,  64,  70,  77,  70,  70,
-138,  70,  10,  14,  67,  64, 136,  64,  70,  79,  64,  65,  70, 138, 138,
- 11,  10,  65,  65,  11, 138,  77,  65, 138,  11,  10,  65, 136, 138, 138,
- 77,  10,  77,  10, 130,  79,  10,  10,  76,  65,  77,  11,  77, 136, 130,
- 64, 136,  14, 136,  64,  77,  11, 130, 138, 130,  11, 138,  65,  65,  10,
- 65,  77,  14, 136,  10,  10,  11,  65,  77,  11,  11,  10, 130,  77,  65,
- 67, 138,  10, 130,  77,  77,  70,  70,  70,  70,  11,  11,  11,  79,  65,
-128,  77,  77, 128, 138,  11, 138,  14, 130,  10,  11,  77, 136,  77, 138,
-128,  65,  10, 138, 138,  65,  77, 130,  10, 136, 138,  11,  77,  15,  70,
- 11,  65, 136,  10,  77, 136,  67,  10,  76,  65,  77,  10,  65,  14,  77,
- 70,  15,  10,  77,  10,  77,  65,  10,  10, 138,  70,  10,  70, 136, 138,
-130, 128,  65,  70,  77,  77,  70,  64, 136,  70,  10,  14, 138,  65,  76,
- 70, 130,  65,  65,  14,  10,  15, 136,  11,  14, 130, 138, 138,  65,  77,
- 10, 138,  76,  11,  70, 138,  10,  10, 136,  65,  65,  67, 138,  65,  67,
- 11,  79,  77,  70,  11,  65, 128, 138,  65,  65, 138, 136, 130,  10,  10,
- 10,  10,  65, 138,  65, 136,  65,  77, 128,  79,  70,  65,  76,  11,  65,
- 65,  70,  10, 138,  65, 138, 136,  77, 136,  70,  77,  10,  70,  70,  10,
- 77, 130,  10, 138, 136,  11, 138,  70,  10, 136, 136,  70, 128,  65,  14,
- 70,  10,  79,  77,  77,  11, 130,  14,  14,  65, 138,  77,  10, 130, 130,
- 64,  11,  77,  10,  10, 136,  10,  10,  77, 128,  70,  77,  64,  65,  77,
-130,  76,  65,  65,  70,  65,  70, 138,  15,  77,  10, 128,  15,  15,  65,
-138,  11, 138,  77,  65,  10,  79, 138, 138,  65,  15,  70, 130, 138, 138,
- 76,  65,  70,  11, 136,  10, 136,  65,  70,  10, 138,  70,  77,  77,  77,
- 77,  11,  77,  65,  70, 136,  11,  14, 138,  77,  65,  10, 138, 136,  11,
-138,  65,  64,  70,  10,  65, 138,  14,  64,  77,  65,  79,  65,  70, 130,
-138, 136,  14,  77, 130, 138,  65,  64,  70,  65, 138,  10, 138,  70, 130,
-136, 138,  65, 136,  10,  76,  67,  11, 138, 138,  70, 138,  70,  10, 138,
- 77,  65,  11,  10,  11,  65,  10,  77,  11,  11,  11,  76,  10, 130, 138,
- 11, 130,  77, 136,  77, 138, 138, 130,  11,  65,  11,  77,  10,  77, 130,
- 65,  10, 138,  10,  65,  70, 138,  77, 136,  70,  70,  65,  14, 130,  77,
- 70, 138,  77,  11, 130,  77,  70, 136,  70,  11,  77,  14, 136,  70,  10,
-138,  10,  11, 138,  11, 136,  65, 136,  10,  11,  65,  70,  15,  65,  14,
- 11,  10,  70, 136,  65,  65, 136,  10,  77,  10,  77,  70,  10,  70,  77,
- 65,  65, 136, 138,  70, 138, 138, 138,  77,  10,  77,  70,  10,  65,  11,
-130,  77, 138,  10,  11,  65, 136, 136,  70,  10, 136,  11,  65, 138, 138,
- 77,  11,  11,  14,  14,  70, 130, 136, 136,  15,  70, 138,  70,  65,  65,
- 79,  77,  10,  11,  70,  10,  11,  14,  65,  67,  11,  77,  14,  77,  11,
- 65, 138,  77,  77,  65,  15, 138,  70,  14,  70,  70,  65,  65,  11,  10,
-138, 138, 130,  70, 138, 130,  79, 138, 138,  70, 138,  11,  70,  11, 138,
-136,  67,  70, 138,  77,  70,  65,  11,  11,  10,  14,  70,  65,  10,  65,
- 15, 136, 136,  65,  77, 138, 136,  77,  77,  77,  14, 138,  10,  15, 138,
- 70,  65,  11,  10,  70,  11,  70,  11,  65,  10,  14,  65,  10,  10,  11,
-138, 130,  77, 138,  10,  65, 138,  77,  70, 136,  70,  10,  10,  65, 138,
- 70,  70,  11,  64,  10, 128, 136,  15,  10,  77, 138,  11,  14,  10,  65,
- 65,  70,  15,  65,  65, 138,  70,  11, 130, 136, 128, 138, 138,  65,  10,
- 77,  65, 130,  10,  11,  14,  11,  77,  65,  10,  65, 138,  11, 130,  14,
- 10,  77,  11,  11, 138,  65,  65, 130,  70,  77,  65, 138, 138, 138, 138,
- 65,  65, 136,  10,  65,  65,  70,  11,  14,  70,  70, 128, 136,  65,  10,
- 70,  77,  11, 138,  11,  77,  77, 136, 138,  70,  77,  77,  70, 138,  68,
- 10, 136, 138,  10,  65, 128, 130,  14, 138,  77,  10,  14,  65,  77,  10,
- 77,  77,  14, 136,  70, 136,  65,  77, 138, 130,  65, 138,  70, 138,  11,
- 77, 138,  14, 138,  11,  11,  70, 138,  65, 130, 138,  65,  10,  77,  77,
- 70, 130, 138, 138,  10,  65,  65,  65, 138,  70,  65,  11,  70,  10, 136,
-136, 130,  10,  70, 136,  10,  10,  70,  77, 128,  77, 136, 128, 138,  65,
- 68,  65,  77,  77, 136, 138,  77, 139,  10,  10, 136,  14,  77, 138, 136,
- 70,  65,  11,  65,  11,  77,  70,  70, 136, 136,  70, 136,  14,  70,  65,
-138,  11,  10,  65, 138,  70,  70, 136,  11,  10,  65,  65,  65,  77,  70,
- 77, 138,  10,  65, 130,  10,  77,  65,  11,  11,  77, 138,  10,  11,  11,
- 10,  10,  10,  77,  77,  65, 139,  70,  11,  65,  11,  71,  77,  11, 138,
- 77,  65, 130,  70,  14,  11,  65,  77,  77,  10, 138, 128,  65,  77,  77,
- 77,  14,  70,  10,  70,  65, 128,  70,  77, 138,  77, 138,  77, 139,  68,
-138,  11, 138,  70,  10,  10,  65,  11,  70,  15,  65,  70, 136,  11,  77,
- 14,  10,  11,  71, 138,  14, 138,  70,  70,  14,  70,  71, 138,  70,  70,
- 70,  65,  11,  11, 138,  65,  11,  65,  65, 136,  65, 136,  70,  65,  10,
-130, 130,  11,  65,  11, 136,  70,  11,  65,  70, 138, 136,  65,  70,  65,
- 77,  15,  11,  77,  71,  77,  11, 136, 138, 136,  10,  77, 138,  77,  11,
- 77, 138, 136, 136, 255,  65, 138,  10,  14,  11, 138,  11,  65,  77,  10,
- 65, 138, 138, 130,  70,  77,  14, 136,  11,  65, 138,  11,  70, 136,  14,
- 10,  77,  70,  65,  10,  65,  14, 138,  77,  65,  65, 130, 136,  10,  10,
- 77, 136,  10,  65,  10,  14,  65,  70,  70, 136,  10,  65,   8,  11,  70,
- 65,  77,  65,  14,  70,   8,  14,  11, 130, 136, 138,  10,  14,  14,   8,
- 77,  11,  14,  11,  70,  77,  11,  14,  65, 136,  65,  10,  10,  65, 128,
- 10,  14,  14, 138,  70,  15, 138,  11, 138,  68, 139, 128,  77, 138,  77,
- 70,  68,  14,  65,  10, 138, 136,  65,  11, 130,  70,  11, 130,  10,  70,
- 11,  77,  11,  10, 130,  70,  77,  77,  71, 138,  11,  14,  11,  77,  77,
-130,  77,  70,  65, 136, 138,  14, 136,  65,  11, 138,  11,  70,  11, 136,
- 71, 130,  10,  70,  15,  11,  14, 139,  71,  71,  65,  77,  70,  70,  77,
- 65,  14,  77,  10,  70, 138,  10,  70,  77,  11,  77, 138, 139,  11,  77,
- 65,  10,  70, 138,  77,  68,  11,  10,  77, 138,  77, 138,  65, 128, 130,
- 10,  14,  70,  14,  68, 138, 136,  11,  70,  70, 130,  11,  10, 138,  65,
- 65,  70,  65,  11,  65,  77, 139,  65, 138,  77,  77,  68,  77, 138,  11,
-136,  70,  65,  10,  14,  70,  15,  11,  65,  68, 138, 136,  10,  77, 138,
- 77,  11, 139,  10,  70,  15,  70, 138,  10,  11,  65,  77, 130,  65, 138,
- 71,  65,  70,  70, 138, 136,  68,  65,  65,  65,  11, 136,  65,  68,  65,
- 14, 130,  10,  77, 130,  65,  65,  77, 130,  77,  15,  65, 136,  65,  71,
- 10,  77,  14, 138, 139,  10,  65,  10,   8,  65, 136,  65,  11,   8,  11,
-  8, 138,  11,  70,  10,  10,  14,  65, 136,  77,  71,  11, 136,  70,  65,
- 70, 130,  10, 136,  10,  70,  70,   8,  10, 138,  10, 130,  68,  11,  10,
- 11,  77,  14,  10,  10, 138,  68,  70, 139, 136, 130,  11,  10, 130,  65,
- 11,  70, 130,  65,   8,  65,  11, 138, 138,  65, 138,  77,  71,  11,  70,
-130,  77,  14,  70,  11,  10,  70, 138,  10,  14,  70, 138,  11,  11,  77,
- 10,  70, 136,  65, 138,  77,  10,  11,  10,  65,  65,   8,   8,  77,   8,
-130, 139,  10,  70, 138,  10,  11,  70, 130,  65, 128,  68,  11,  65,  10,
- 11,  77, 139, 139,  70,   8,  71, 130,  10,  77, 138, 138,  11, 136,  77,
-138,  70, 136,  65,  65,  77, 138,  11,  77,  14,  65, 128,  65,  77,  11,
- 11,  10,  65, 139, 138, 138,  65,  77,  11, 136,  10, 130,  68,  14,  65,
- 70, 136,  77, 138,  11, 139, 128,  77,  10,  10, 138, 130,  65, 130, 139,
- 65,  70, 136,  71,  14, 136,  14, 138,  15,  11,  11,  70,  11,  77, 138,
- 77, 130,  11, 130,  77,  11,  77,  70,  11,  65,  15,  77,  77,  77,   8,
- 11,  10,  10,  70, 138,  65, 138,  70,  10,  70,  10,  77,  77,  14,  65,
- 15,  10,  77,  70, 130,  70,  65,   8, 136,   8, 138,  10, 138,  65,  77,
- 68,  70, 136,  11,  15,  11, 130,  68, 138,  77,  70,  68, 139,  10,  15,
- 10,  77,  70, 139,  65,  65,  65, 128,  10,  65, 136,  65,  65, 139,  10,
-138,  77,  10,  65, 138,  70,  68,  70,   8,  70,  68,  65,  14,   8,  65,
- 68,  65,  77,  11,  11,  68,  10,  77, 136,  14,  10,  68, 138,  11, 130,
-130, 139,  11, 136,  71,  77, 139,   8,  70, 136, 138, 136,  11, 139,  10,
- 65,  10,  14,  71,  65, 130,  10,  65,  65,  14,  65,  14,  11,  77,   8,
-138,  65,  11,  77,  11, 136,  71, 138,  77, 138,  77,  10,  11,  11,  70,
- 11, 130,  65,  68, 138,  71,  14,  71, 136,  14, 136,  11,   8,  70,  14,
-138,  11,  10,  65,  77, 130,  71, 138,  77,  70,  70,  11,  77, 136,   8,
- 15,  77,  77, 130,  70,  11, 138,  11,  70, 128,  77,  65, 138, 138, 136,
- 71,  77,  77,  68,  65,  10,  10, 136, 138,  68,  10,  65, 136,  10, 130,
- 70,  10, 139,  71,  70,  65,  65,  11, 139, 130,   8,  70, 130, 130, 130,
- 71,  70,   8,  70,  14,  77,  65,  14,  11, 130,  65,  71, 130, 138,  70,
- 65,   8,  11, 138,  10,  10, 136, 138,  11,  65,  65, 130,  10, 136,  15,
-138, 138,  65, 130,  70,  14, 138,  10,  10,  11,  10, 139,  70,  77,  71,
-136, 138,  11, 136,  70,  77,  77,  14, 138, 139,  71,   8,  14,  77,  77,
-  8, 136, 139, 138,  77,  14,  10,  70,  11,  10, 139,  65,  68, 136,  10,
-130,  11,  70,   8,  65,  65,  77,  65,  77, 128,  11,  71,  77, 139,  65,
- 10,  65, 138,   8,  70,  65, 138,   8,  10,  70,  15,  70,  15, 136,  70,
- 77,  10, 130,  70,  70, 138,  10,  11, 138,  77,  10, 139,  65,  10,  14,
- 14,  14,  11, 130,  10,  10,  70,  70,  65,  71, 136, 130,  70,  70, 139,
- 14,  77,   8, 138, 138,  71,  65,  68, 136,  65,  70,  70,  65, 139,   8,
-130,  77, 139, 136,  65,   8, 136,  11, 136,  11,  10,  70,  70, 136,  11,
- 11,  11, 139,  11, 130, 136,  70,  71,  11,  77,  10,  65,  65, 130, 138,
- 10,  77, 136, 130,  65,  65, 136,  65,  77,  15,  77,  77,  68,  71,  14,
- 10,  65,  10,  11,  14,  77,  65,  11,  65, 138, 139,  65, 138,  65, 136,
- 65,  70,  77,  71, 138,  65, 136, 139,  77,  10,  70,  68,  70,  70,  65,
- 14, 136,  10, 138,  11, 138, 130,  70, 139,   8, 138,  77,  71,  65,  77,
- 11,  65,  15,  11,  70,  11,   8, 136,  71, 138,  71,  11, 139, 130, 139,
-138,  10, 136, 130,  65,  71, 139,  70,  71,   8, 138,  11,  14,  10, 136,
- 77,  11,  10,  68,  14,  70,  68,  11, 130, 138,  70,  68,  10,  11, 139,
- 14,  65, 130,   8,  71, 136,  71, 138,  70,  77,  14,  11,  11,  11,  65,
- 65,  14,  65, 136,  65,  11,  65, 130,  71,  68,  70, 138, 138,  11, 136,
-136, 136,  71,  65,  11,  65, 136, 139,   8, 138,  10,  70,  68,  15,  11,
- 68,  77, 136, 138,  70, 138,  10, 139,  10,  68,  65,  14,  11,  71,  71,
- 77, 136,  15,  10, 136,  70,  77, 139,   8, 128, 130,  11,  14, 136,  65,
- 11, 138, 130,  71, 130, 130,  10, 136,  10,  71, 138,  70,  10,  11,   8,
-138,  71, 138,   8,  14, 136, 138,  11, 136, 138,  11,   8,  11,  10,  14,
-136,  71,  14,   8,  68,  11,  11,  77,  10,  70,  71,  14, 138,  11,  11,
-136, 139,  68,  14, 139,  65, 128,  77,  11,   8, 139,  77, 139, 139, 136,
-138,  70,  65,  77, 139, 136,  70,  14,  65,  70,  70,  77,  77,  68,  11,
- 10,  65,  11,  77,  65,  11,  11,   8, 138, 138,  77,  11,  11,  14, 138,
- 15,  15,  10,  70, 138,  10,  11, 136, 128, 139,   8,  11,  68,  71,  70,
- 65, 139,  68,  11,  70, 138, 138,  11,  10,  11,  10, 130,  11, 139,  10,
- 65,  77, 138,  11,  10,  14,  11,  10, 139, 139,   8, 138,   8,  11,  77,
-139,  65,  11,  11, 136,  14,  11,  70, 136, 138,  65,  14, 138,  70,  11,
- 11, 136, 139,  11,  11,  65,  70,  10,  65,   8,  11, 139,  77, 130, 136,
- 77,   8, 139, 130,  11,  10, 139,  68,  71,  68, 138,  65,  10, 136, 138,
-  8,  65, 138, 136, 138,  70,  65,  11, 138,  70,  65, 128,  11,  65,  65,
- 14,  77,   8,  71,  71,  77,  65,  15,  10, 139,  68,  77, 130,  11, 128,
-138,  71,  65,  10,  71,  68,  77,  71,  65, 136,  70, 138, 136, 136, 138,
- 11,  77,  70,  71,  68, 139,  14, 130,  15, 138,  77,  71, 128,  14, 130,
- 77, 138,  71, 139,  77,  11,  68,  15,  70,  71, 130, 130, 136,  65, 130,
-138,  77,  77,  70,  70, 138,  65,  65,  14,  11, 139,  70,  10,  65,  70,
- 77, 139,  14,   8,  68, 139,  14, 139, 136,  68, 139, 139, 138,  65,  65,
-138,  11, 128,  70,  68, 136,  70, 136, 138,  68,  65, 138,  10, 138,  65,
-  8,  71,   8, 136, 130,  65,  70,  77, 139, 138,  77,  14, 138, 136,  70,
- 14,  65, 130, 138, 139,  15, 138,  68, 138,  77, 255,  65, 136,  14,  71,
-136, 139,  71,  14,  71,  14,  10,   8,  77,  11,  77,  71,  68,  71,  65,
- 70,  11, 136,  10, 136,  70,   8,  65, 128,  14,  70,  71,  11,  14, 139,
-136,  11,  68, 130,  14,  11, 139, 130,  11,  71,  70,   8,  14,  77,  10,
-  8,  11,  11,  70, 130,  11, 139,  70,  71,  65, 139, 130,  11,  71, 136,
- 10, 130, 130, 130,  10,  10,  11,  68,  14, 128,   8,  10,   8,  15,   8,
-138,  70,  65,  10, 139,  77,  77, 139, 139,  68,  70,  65, 138,  77,  68,
- 65,  68,  70,  10, 136, 138,  68, 136,  11,  77, 138, 136,  14, 138,  77,
- 77, 138,  11,  10, 138,  70,  11,  10, 136,   8, 138, 130, 136,  65,  11,
- 10,  68,  10,  68,  65,  14,  68,  77,  11, 138,  77,  11, 130,  70,   8,
- 14,  11, 139,   8,  71,   8,  71,  11, 136,  11,  71, 139,  65,  14,  65,
-139,  68,  77,  10,  71,  70,  11,  77, 136,  68, 139, 136, 130,  65,  77,
- 14, 139,  15, 139, 136,  10,  10,  11, 136,   8, 136, 136,  71, 139,  68,
- 10, 130,  71,  11, 139,  65,  14, 138,  68, 136, 138,  68, 130, 130, 139,
-138, 136, 138,  65,  10,  70,  71,  71,  71,  70, 139, 136,  15,  70,  14,
-139,   8,  71, 130,  11,  11,  11,  71, 136,  65,   8,  68,   8, 136,  77,
- 77,  77,  71, 136,  11,  65,  11, 138, 136, 136,  11,  10,  68,  68,  77,
- 14,  65,   8,  70,  10,  10,  11,  65,   8,  77, 136, 139,  11,  11,   8,
- 68, 138, 130, 136,  68,   8,  11, 139,  11,   8,   8,  68, 139,  77,  70,
- 68,  11, 136, 138, 128,  11, 138,  14,  77,  11,  68,  10, 139, 136,  68,
-138, 139,  10,  10,   8,  15, 130,  11,  65, 139,  77,  11,  10, 136,  68,
-138,  14, 136,  11, 139,  70,  71,  11,  71, 130,  10, 138,  14,  14, 136,
- 71,  10,   8,  11,  68,  77,   8,  71,  68, 130,  65,  14, 139,  11,  71,
-  8,  11,  77,  68,  65,  65,  77,  11,   8,   8, 136, 139, 139, 138, 128,
- 10,  11,  70,  10,  11,  65,  14,  71, 130,  68,  65, 136,  71,  77, 138,
-130,  14,  65, 139,  11,   8,  77,  70,  71, 138,  71,  11,  65,  68,   8,
-139,  68,  11, 136,   8,  77,   8,  11,  77,  14,  68,  65,  15,  71,  70,
-  8,  71, 136, 128,  11, 139,  65,  11,  70,  11, 136,  10,  68, 139,  11,
-139, 136,  65, 138,  65,  15,  68, 136,  65, 138,  68, 138, 136, 130, 136,
- 68,  15,   8,  10,  71,  11,  71, 138, 136,  71, 136, 139,  10,  71,  65,
- 77, 136, 130,  65,  68,   8,  70,  70,  14,  14,  11,  65,   8,  11, 128,
- 71, 136,  14,  14,  14,   8, 138,  71, 139,  71, 139,  68,  77,  11,   8,
- 11,   8, 136,  77,  11, 139, 136,  11, 139,   8,  11,  70,   8,  11,  10,
- 71, 138,  77,  14,  10, 139, 130, 130,  14,   8, 130,  14,  70,  10,  70,
-130,   8,  11, 139,  70,  77, 139,  14,  11, 138,  11, 139, 136,  65, 130,
- 70,  10,   8,   8,  11, 139, 139,   8,  10,  11,   8,  71,  65,  11, 130,
-139, 138,  71,  68,  71, 136, 130,  71,  70, 139, 139,  68,   8,  71,   8,
-136,   8,  11, 138,  10,  65,  11,  71,  14,  68,  11,  68, 139, 136,  68,
- 68, 136, 136,  77,  68,   8, 130, 138,  14,  68,  77,  70,   8, 139,  77,
- 65,  11,   8,  77,  68, 138,  68,   8,  70,  11,  65, 130,   8,  14,  11,
-139, 255,  11, 139, 136,   8, 136, 136, 139,  68,  77,  14, 138,   8,  11,
-130,  68, 139,  68, 136, 138, 136, 136,  11,  68, 139,  14, 130,  70, 136,
- 11,  71, 136,  71,  71,  65, 136,  10,  71,  14,  65, 139,  11,  70,  10,
- 68,  71,  71, 138,  14,  68,  11, 130, 136, 130,  68,  14,  65,  71,   8,
-  8,  14,   8,  65,  71,  71,  71, 139, 139,  68, 136, 136, 136,  14,  10,
- 14,  65,   8, 136, 139,  71,  65, 130, 130,  10, 139,  11, 139,  77, 136,
- 15,   8,  14,   8,  71, 139,  70,  11,  71, 128,  11,   8,  65, 139,  11,
-136, 130, 138,  71,  68,  65,   8,  10,  14,  11, 130,  77, 139,  14,  71,
-128,   8,  11,  14,   8,  65, 139, 136,  68,  68,  71, 139,  71,   8,  65,
- 77,  14, 138,  15,  14,  77,  77,  71,  68,  11, 138,   8, 139,  68,  11,
-139,  10,   8, 130,  10,  68,  65,  15,   8,  70,  14,  70,  77, 128,  77,
-138,  70,   8,  70, 139, 138,  70, 138,   8, 128,   8,   8,  65,  65,  71,
- 11,  70, 138,  68, 139,  65,  15,  77, 138, 130,  71,  10,  10,  11,  11,
- 70,   8,  65, 138,   8, 139,   8, 130,  11,   8,  71, 139,  70, 139,  68,
- 70,  71,  14,  71,  14, 139,  71,  11,  68, 139,  10, 139,  68,  70,  11,
-139,  11,  71,  71,  65, 136, 139,  68,  77, 130,   8, 136,  11,  68,  10,
-130,  71,  65,   8, 138,  11,  71,  68,  71, 130,  71, 136, 139,  71, 139,
- 11, 136,  11,  68,  70,  71, 136,  65, 139, 136,   8, 128,  11,  11,  10,
- 11,  71, 139, 136,  11, 130, 138, 139, 139,  71, 138,   8, 130,  11, 136,
-136, 136,  68,  68, 136,  11,  14, 139,  11,  14,   8, 139,  11, 139, 139,
- 15,   8,  14,  11, 138, 139,  71,  68,  68,  14, 139,   8,  11, 139, 136,
- 14,  77, 138, 139,  14,  14, 139,  70,  65,  14, 130, 139, 139,  10, 139,
- 10,  65, 139, 139, 130, 139, 139,   8,   8,  11,  70, 139, 130,  14,  71,
- 68, 139, 138, 139,  14,   8, 136,  71,  71,  10,   8,  68, 136, 136,  11,
- 68, 139,   8,  11,  71, 130,  14, 139,  68,  68,   8, 128,  11,   8,  68,
-136,  14,  15, 136, 136,  11,  11,  68,  14,  14,  15,   8, 138,  14, 138,
- 11,  11, 139, 136, 128,  11, 139,  77,  71,  11,  71,  11,   8,   8,  77,
- 71, 130, 139,  15,  68, 136, 138,  70,  68,   8,  71, 138, 136,   8,   8,
-138,  68,  71, 136, 138, 139,  71,  70, 130,  77,  71, 130, 139, 136,  14,
- 65,  70,  68,  68,  11,  10,  11, 130, 139,  68, 136,  70,  68,  11,   8,
-  8,  10,  11,  65, 139,  14,  68,  11,  10,   8,  11,  71,   8, 130, 136,
-  8, 130, 139, 136,  10,   8,  15, 136,  71, 136,  77, 130, 139,  71, 139,
- 11, 136,  68,  65, 130, 139,  68,  71,   8,   8, 139, 128, 136,  68,  68,
- 11,  68,  11,  68,  71,  11,  11,  11, 139,  11,  11,  14,  77,  71,  77,
- 14,   8,  70,  14, 139,  68,  11,  71,   8,   8, 136,  11,  14, 139,  10,
-  8,  77, 138, 139, 139, 130, 136, 136,  71,  71,  15, 130,   8, 130,   8,
- 68,  68,  71, 136,  71, 139, 136,  68,  77,   8,   8,  10,   8, 138,  15,
-136,  68,  14, 136,  11, 139, 138, 139,  68,   8,  65,  71,  11, 139,  11,
- 68, 139,   8,  71, 136, 136,  14, 139,  68, 130, 139,  11,  71,  71,  11,
-136,  71, 130,  15,  15,  71,  11,  14, 128,  71,  15, 139, 136, 139,  68,
-139,  68,   8, 139, 136, 136, 139, 136,  10,  11,   8,  11,  71, 139,  68,
- 77,   8,  71, 136,  65, 139,  11, 130,  71, 139, 136,  71,   8, 136,  68,
- 15, 139, 136,  68, 130,  65, 139,  65,  68,  70,  68,  71,  71, 139,   8,
- 11,  14,  71,  10,  71, 139,  71,  71, 139, 139, 139, 130,  15,  70, 130,
- 65,  71, 130,   8,  71,  68,  68, 139,  68,  71, 139, 136,  71, 139,  71,
- 11,  68,   8,  77,  10, 136,  11,   8,  11,  11, 136,  14, 139, 139, 139,
-  8,  11, 138, 130,  71, 136,  11,  68, 139,  71,  71,  65,  77,  14, 128,
-130,  11,  68,  11,  68,  14,  68, 139,   8, 136, 139,  68, 139, 130,  71,
- 68, 138,   8,  71,   8, 138,  71, 139, 128, 139,  11,  71,  15, 139,  68,
- 71,  14,  71,  68,   8,  71, 130, 128,   8, 130,  71, 139,  68,  77,  68,
- 14,  68,  11,  14, 139, 136, 136,  14,  11, 139,   8, 139, 130,  11,   8,
- 71, 130, 130,  71,  14,  11,  65,  11, 139,  68,  68, 139, 136,   8, 139,
- 71,  11,  71,   8,  11,   8,  68,   8,   8,  11,  11, 139, 138,  11, 136,
- 68,  11, 139,  68,  68, 139, 139, 138,  70,   8, 136,  14,   8,  14, 139,
- 11,  77,   8,  68,   8,  68,  68, 139, 139, 138, 139,  11, 136,  77,  71,
-139, 130,  11, 128,  14,   8,  71, 130, 139,  68,   8, 139, 139, 136,  70,
- 71, 130,  11,  11, 139,  14,   8,  11,  71,  68,   8, 128,  77,   8,  68,
- 14,  68,  68,  77,  71,  11, 130, 130,  71,  68, 136,  68, 128,   8, 139,
- 71,  14, 136,  10, 139,  14, 136,  11,   8,   8,  68,  11, 139,  68, 139,
-  8, 130, 130,   8,  71,  11,  11,  11,   8, 130,  14,  14,  68, 139,  11,
- 68, 139,  14, 136,  71,  71, 136,  11,  68, 139,  68,  11,   8, 130, 139,
- 71,  77,  68, 128,  10,  71,  11,  68,  11,  77,  70,  68,  70,  15, 139,
- 71, 139,  71, 136,  71,  11, 130,  68, 136,  14,  71,  71,  77,  11,  14,
-139,   8,  14,  71, 139,  68,   8, 139,  14, 139,  11,  65,  11,  68, 136,
- 71,  71,   8,   8,   8, 130, 136, 128, 139, 139, 138, 139,  70,  68,  71,
-130, 139,   8, 136, 139, 136, 139, 136,   8,  14,  11,   8,  71,  10,  14,
-136, 138,   8,  71,  14,  11,   8,  11,  71, 139,  70, 139,  71,  14,  10,
-139,   8,  68,  68, 136,  71,   8, 136,  71, 136,  71, 136, 139,   8,  11,
-136,  14, 130,  11,   8,  71, 139,   8,  71,   8,  14, 128,  68,   8, 130,
-139,  68, 139, 128,  11,   8,  14,  68,  68,  71, 139, 136,  71, 136,  11,
- 68,  14, 139, 139,  14,  65,  68,  68,  11,  68,  11, 136,  11, 139, 139,
-  8, 136,  68,  11,  68,  71, 136,   8,  11,  11, 139, 139, 136,  71,  71,
- 68,  11,   8,  71,  11, 130, 139, 139,  11, 128,  68, 139,  11, 136,  68,
- 68, 130,  11, 139,  11,   8,  68, 139,  14, 139, 139, 139, 139,   8, 139,
- 71, 139, 139,   8,  11, 139,  71,  68,   8,  68, 130,  11,  68,  15,  14,
- 71, 128,   8, 130,  71,  68, 139,  71,  11,  68,   8,  68,  14, 139,   8,
-  8, 138,  11,  68,  14, 136, 139,   8,   8,   8, 136,  71, 139,  11,  68,
- 11, 136,   8,   8, 136,   8,  68, 136, 139,  71, 136,  68,  68, 136, 139,
-139,  71, 136, 130,  68,  68,   8, 139,  68,  71,   8, 139,  71, 139,  14,
-  8, 139,  14,   8,  14, 136,  71,  11,  71,  68,  14,  11,  68, 139,  68,
-139, 130, 136, 139, 139,  11, 139,   8,   8,  11,  11,   8,  11,   8,   8,
- 68, 139,  71, 139, 130,   8,  71,   8,  14,  71, 136, 139, 139, 139,  14,
-  8,  68,  71,  68, 136,  71, 139, 128,  68,  71, 130,  68,  68,   8,   8,
-  8, 139,  11,  68,  15, 130,  71,  71,  71,  11, 139,  71, 139,   8,   8,
- 14,   8,   8,  71,  71,  71, 130,  11, 136,  68, 136,  14, 130, 136,   8,
- 14,  14,  11, 139,  71,  68,  71, 136, 139,   8,  68,  68, 139,  14,   8,
- 68,  71, 130, 136, 139,  68, 136, 139,  14,  68,   8, 130,  11, 139, 136,
-  8, 139,  71, 128, 136, 139, 130,  68,  14, 136,  68, 130, 130,  68,  68,
-139, 136, 130,  68, 130, 136,  68,  71, 139,   8,  71, 136,   8,   8,  68,
- 68,  11,  14, 128, 128, 139,  71,  11, 139,  71,  68, 136, 139,  11,  14,
- 68,  11, 130,  71,  68,  11, 130,   8, 139,  71,  68, 139,  68,   8, 136,
- 14,  71,   8,  68, 139,  71, 139, 139, 139, 137, 142,  14, 139,  68, 139,
-139,  11,  71,  14, 139,  14, 136, 130,  68,  11, 139,  68,  14, 136,  71,
-136,  68, 136, 142, 136,  68, 136,  14,  14, 139, 136,  71, 137,  71, 137,
-139,   8,  68,  11,   8,  11,   2, 136, 139,  68,  71, 136,  68, 139,  11,
- 14,   8,   8,  69, 137,  71,  11,  68, 136,  14, 130,   8,   8, 139,   8,
-  2, 128,  14,  68,  11, 139, 139, 136,  14, 139, 139, 136, 136,  71,   8,
-  8,  11,  11,  14,  15,   8,  14,   9,  11, 136,   8, 130,  11, 136,  71,
- 11,  14,   9,  68, 130,  71,   9,  68,   8,   8,  71, 128, 130, 139,  68,
-136,  68,  71,  71,  11,  14,  71,  71,  15, 139,   8, 136,   8,   2,   8,
-136,  14,   8,  71,  14,  71,  68, 130, 130,  11,  71,  14, 128,  68, 139,
-130, 139,  71, 139, 139,  68, 130,  71,  11,   8, 139, 142,   8,  14, 139,
- 68,   8, 130, 139,  68,   8, 130, 136,  71, 139, 139,   8, 139,  14,   8,
- 11, 137,   8,  15,  14, 139,  69, 128, 128,   8,  68,  15,  68,   9, 139,
- 68,  14,  71, 136,  68, 136,   8,  69,   2,   2, 130, 139,  68, 139,  71,
- 14,  71,  71,  71,  71,   8,   8, 139,  68,   8,  69, 139,  14, 139,  68,
-137, 139,  68, 130, 139, 142, 139, 130,  15,  11,   8,  68,  71,   8,  71,
-136, 139,  71, 139,  11,  14,  11,  15,   8,  68,  71,   8,  68, 139, 137,
-139,  71,  11,  14,  71, 139,  14,  68,  14,  11,   9,   8,  15,  14, 139,
-136, 130,  68,   8, 136, 136,  68,   8, 130, 130,   2,  71,   8, 136,   8,
- 68,  11, 137, 139,   9, 139,  68,  71,  71, 139,  68, 139,  11,  14,  71,
- 14,  71,  11,  14, 130, 139, 142,   8, 139,  68,   8, 139, 139, 139,  68,
-  8,  14, 130, 130, 139,  14,  71, 130, 139, 136,  68, 139,   8,  11, 137,
- 68,  14,   8,  14,  15,   8,  71,  15,  11,  11,  11, 128,  14,  11,  11,
-  8,   8,  71, 137, 139,  71, 130, 139,  71, 139, 137,  11,  14,   9, 136,
- 14,   8, 139,  68,  68,   8,  14,   8,  11,  11,  71, 139,  69,  11,  11,
-139,  69,  71, 136, 137,  71,  11, 136,  11, 139,  11, 139, 136, 130,  68,
-136,  68, 142,  14,  69,  11,  11, 137,  68, 136,  68, 136,  15,   2,  14,
-128,  71, 137,  11,   8,  68,  14,  68, 128,   8,   8,   2,   8, 136, 139,
- 71,  68,  11,  68, 136,  68, 128, 139,   8, 139,  71, 139,   8, 136,  11,
- 14, 136,  15,  14,   8,  68,  69,  68,  14, 130,   8, 128, 136,   2,  71,
- 14, 139,  11,  71,   8, 136,  68,   8,  14,   9, 130,  14,  14, 142, 139,
- 71,  71,   8, 130,  68,  14,   2, 139, 136,  14, 139,   8,  71,  15,  11,
- 11,   8, 128, 139,  68,  14,  14,  68, 139,  71,   8,  69,  69, 130, 137,
- 14,   9, 139,  71, 139,   9, 130,  68,   2,  68,  11, 139, 137,   9,   9,
- 11,  11, 137,  11,  68,  14,   8,   9, 136, 136, 137, 139,   8,  14, 142,
-  8,  14, 130,  71,  15,   8,  71, 139, 136, 137,   9,   8,  68, 139,  68,
-  8, 128,  14, 136, 136,   8,  71, 136, 136, 139,   9,  71,  11,   8,  71,
- 71, 139, 142,  11, 137,  68,  68, 128, 142,   9,  14, 139,  71,   9,  69,
-139,  68,   8,   8,  11,  68, 139,  71,   8,   9, 136,  68,   9,   9, 139,
- 71,   8, 139, 137,  14,  11, 139,  71,  14, 142, 130, 136, 139, 136, 142,
- 14, 128, 139, 130,  68, 137,   8,  71,  11,   8,  71, 136,   9,   8,  68,
-139,   8,  68,   8,  71,   9,  68,  69, 136,  69,  11,   8,  68, 139,  71,
- 11,  11, 139,  68,  68,  11,  68, 139,   9,  69,  15,  68,  71, 139,  68,
-136,  11,  68,  71,   8, 130, 130, 137,   8, 139,  69,  14,  14,  15, 130,
-130, 142, 139,   9,  71,  11,  68, 139, 139,  71,   9,  11, 137,   9, 136,
- 71,  68,  68,  71,   2,  68,  68,   9, 142,   2,  69,  11,  69,  68, 139,
- 14,  15, 139,  14,  71,  11,   8,  68, 128,   8,  11,  15, 139, 137,  71,
- 71,   8,  68,  71, 142,   8, 139,  71,  14, 130,  68,  69,  68, 128,   8,
-142, 139,  68,  14, 128,  69, 136, 139,  71,  71, 139, 139,  14, 130,   8,
- 14,  68, 139,   2,   8,  14, 137,  68, 137, 136,  14,  71,  14,   8,  68,
-137,   8,   2,   9,  71,   2, 136, 128, 142,   8,   9,  68, 139,   9,  11,
-136, 130, 139,   9,   9,   8, 130,   9,   9,  69,   2, 128, 139,   8, 142,
- 71,  14, 142, 137,  14, 137, 139,  68,   8,   9, 139,   8, 139,   8,  14,
-136,   9, 142,   8, 130, 139,  14,  69, 128,  68,   8, 142,  68,  14,  14,
- 14,   2,  68,  68,   8,  11,  69,  69, 130,  15,  71, 128, 139, 136,  11,
- 68,   2, 142,  68,  14,  71, 142,  71,  11,  14, 130,   9,  14, 139,   9,
- 11, 137,   8,   9,  68,   9,  14, 139,   9,   2,   8,  14,  68, 139, 136,
- 71, 137, 130,  68, 137, 130,  14,   8, 128,  14,  14, 139,  68, 139, 136,
- 11,  71, 130,   9, 130, 130,  71,  14,  71,  11, 130,  14, 142, 142, 142,
- 11,  71,  14,   8,   9,   2,  14,  68, 139,  14,  68,  71,  14,  69, 139,
- 71, 136,  15, 130, 137, 142, 139,  14,  11,  71,  15,  11,   8,  11,   8,
- 14,  71,   8,  71,  14,   2, 139,  69,  71, 136,  69,  11,  15, 139, 139,
-139,   8, 130, 142,  68,  71,  68,  68,  11,  68,  68,   8, 139,  69,  71,
- 71,   2,  68,   9, 139,   9,  14, 139,   9,  11,  71, 136,  14,  71, 142,
- 14,  69, 139,  11, 128,  71, 142,   8,   8, 137,  14,  71,   9, 139,  71,
-  9,   9, 130, 137,  71, 139, 142,   8,   8, 136,  68, 130,  14,  68,  68,
- 15,   8, 136,  14, 142, 136,   8, 142,   8,  14, 130,   2, 139, 137,   2,
-139,  69, 139, 139,  14,  14,  14, 139, 139,   9,  11, 139, 130,  69,  68,
-  8, 136, 142,  68, 139,  14, 142,  11,  14, 130, 130,  14, 139,  68, 139,
-  9, 139, 137, 136,   8, 137,  69,  68,  71, 128, 142,   8, 139,   8,   9,
-  2, 139,   8,  68, 139,  71,  71,   9,   9,   8,   8,   8,  68,  69, 137,
- 68,   2, 137,   9, 128,  71,   8,  68, 130,  14,  68,  14, 137, 139,   8,
- 11, 130,  14,   9,  14, 136, 136,  11,   8,  15,  15,  11,   2,   9, 137,
-137, 137,   8, 137,  71,  14,  71,   9,   9, 137,  14,  14,  71, 130,  68,
-142,   8,  71,  68,  69, 139,   2,   9, 128,  69,  71,   9,   8, 130, 137,
-137, 139,   9,   8,   9,   8, 136, 137,  14, 139, 137, 128,   9, 139,  68,
- 11,  68,  14,  69, 130,   8, 139,  69,   2,  68,  14,  71,  14,   2,   2,
-139,   8,  14,  14,  15,  14,  11, 136, 142,  71, 137,  14, 137,  14,  11,
- 14, 137,  71,  69,  71, 139, 139,   9,  11,  71,  71, 130,  68, 130,  69,
-142,  69,  71, 139, 137, 142, 139, 142, 142,  69,   9, 128, 139, 137,   9,
-137,   8,  11,   8,   9,  68,  68,  14,   9, 137, 137, 128, 137, 137, 137,
-  9,   2, 137, 142, 128,   2,   9,  69,   9,  11,   9,  68,   2, 142,   2,
- 14, 130,   2, 130, 137,  68, 137,  69,  69, 130, 139,  14,  15, 137,   2,
-  9,  68, 255, 142,  69, 137,  11, 130,   8,   8,  14,  68,   2,   2,   2,
- 14,  71, 139,   2, 128, 137,  68, 139,   9,   9,  69,  71, 139, 130,  71,
-136, 137, 137,   8, 139, 139, 139, 137, 142, 142, 136, 128, 142,   8, 139,
-137,  68, 142,   2, 136,  14, 142,  11, 139,  69, 142, 136, 130,  14, 142,
-142,   9, 136, 142, 139,  71,   8,  71,   8, 128, 128,   8, 130,   9,  14,
-  9,   8, 137,   9, 137, 139, 139,  11,  11, 139, 130,  68,  14,   8,   2,
-  8,   8,  14, 142,  71,   8,   8,  68, 137, 128,  15, 139,  14,  11,  68,
-130,  14, 142, 130,  68, 137, 137, 130,  14, 137,   9,  71, 139, 142,  15,
- 15,  68,   8, 142,  71,  15, 139, 139,   8,  14, 128,  68,  71,  15, 137,
-  9,   9,  68,  71,  71,   9, 136,  68,   8,   2,   8, 130, 130,  68,  68,
-128,   9, 137, 142, 142,   9, 142,   8, 130, 128, 142, 130, 137, 137,  68,
- 11,  69,   9,   2,  71,  11,   8,  68, 142, 142,   9,   8, 130, 136,  68,
- 69,   8,  14, 137,   9,  14,  14,  71,  71, 139,  68,   8,   2, 137,  11,
-137,  69,  71,  11,  68,   8,  14, 136,  14,  11,  69,   9,   2,   2,   9,
-130,  68,  71, 139,  14,   9, 128,  71,   9,   2, 139, 137,   8, 130,  15,
-139,  14, 137,   9,  14,  14, 137,  14,   9, 137,   9,  68,   9, 142,  69,
-  8, 137, 137,  11,   9,  68, 142, 142,  71, 142,  69,  69, 128,  68,   2,
- 71,   9,  69,  11,  14, 137,  69,  14,   9,  68,   8, 142,   2,  69, 142,
- 69,  14,  68,   8, 142,  11, 139, 139,   9,   9, 130, 137,   9,  68,   9,
- 71, 128, 136, 142,   2,  15,  68, 137,  14, 137, 137,   9, 137, 139, 137,
-  2, 128, 130,  71,  11,  11, 139, 137,  71,   9,  68, 130,  15,  14,   9,
-137,  14,  14,   2,  14,  69, 139, 137, 139, 137,  14,   2, 137,   9,  68,
-139, 137, 137, 137,   9,  68, 139, 142,  11, 137,  11, 137,   9,   2, 130,
-130, 139,   9, 139, 139,   9, 130, 139,   9,  71, 137,  69,  69, 139,  68,
-  8, 139, 136,   9,  69,  69,   2, 130, 142, 139, 142,   9,  14, 139,  71,
- 69,  68,   8, 142, 142, 130, 139,   2, 128, 139,   8, 139, 136, 130, 142,
-130,  14, 139, 142,  14,   2,   8,  14,  69, 130, 130, 142,   2, 142,   8,
-  9,   8, 139, 137,   9,   2, 128,   8, 130,   9,  69,   2,   2, 142, 139,
-137,  14,  14,  14, 139,  15,   9,  71, 137,   8, 142, 136,   2,  69, 130,
- 14,  71, 137,   9, 130, 137,  68,  71, 142,  68, 142,  15,  14, 136, 130,
-139,  14,  68, 142, 137,   9,   9,   8,  71,  71,  15,  68, 137, 142, 142,
- 14, 128,  14, 137, 130, 130,   2,  71,   8,  68,   2,   2,  11,  14, 137,
- 68, 142, 137,  71, 128,  15,  14,  71,  71, 142, 139,  68,  68,   9, 139,
- 14,  14, 137,   9,  68,  68,   9,   9,   2,  71,  11,   9,   9,  15,   9,
- 68,   9,  14,  14,   9,   2,  71, 130,  68, 139,   2,   9,   9,  68,  71,
-  9,   8,   8, 130,  14,   9, 142, 137, 139,  11, 128, 142,   8,   8,   9,
- 68,  14, 137, 142,  68, 130,  71,   2,   9, 139,  14,  71,  69, 137, 142,
-142, 142, 130,  69, 130,  14,  69,  15, 142,  71, 130,   9,  68,   2,  68,
-  8,  69,  69,  71, 139, 137, 128, 137,  69,  15,  14,   2,   9, 130,   9,
-130,   8, 137, 142, 137, 139, 128, 137,   2, 137, 130, 142, 142,  69, 142,
- 14,   9,   8,  14, 137,  69, 142, 137,  69,  14, 142,   9,   2,   9,  15,
-137,  71,  14,  14, 139,  15,   9, 137,   9,  11, 142,  14, 142,   2, 142,
-139, 142,   9,  69, 139,  71, 130,  14, 130,   8,   9, 136,  14, 130, 130,
-  9, 139, 139,  14, 139, 137, 130, 128, 139,  11,   9, 142,  14, 139,   9,
-  9, 142,  69,  71, 128, 137, 137,   8,   9, 142,  71, 142,   2,   2,   2,
-137,   2,   9, 128,  71,  71,  14,  68, 137,  14, 137, 142,   8, 139,   9,
-  2, 130, 139,   9,  68, 137,  69,  14,  69,  68, 139,   9, 139,   2, 142,
-142, 137,   2, 137, 130,   2,   8, 137, 139, 137,  14,  14,  68,  68,   2,
-137,   9,  14, 142,  14,   9,   9,  69,   9,   9, 137,  15,   8,   8,   8,
-142,   8,   2, 130,  71, 128, 142,  71,  68,   9,   8, 139,  15, 139, 130,
-  9,   9,  69,   2,   9,  69,  69, 137,   9,   2,   9,  14, 139,   9,   9,
- 69,   8, 128,  14,   9, 139,   8,   9, 142,  15, 139,   9,  69,  68, 137,
-  2,  11, 130, 128,  14,  68,   2, 130,  14, 137,  14, 128,  14,   2,   9,
-142,  14,   2,  69,   9, 128, 130,  71,   9,   9,  69, 137, 139, 137, 137,
- 71,  14,   9,  68, 139,  14, 142,   9,   9,  68,  14,   9,   9,   8,  14,
-  2,   9,   9,   2,   2, 137,  14,   8, 142,   9, 139, 130,  68,  14,   9,
-  2,   9,  15, 130,  14,   9,   8, 130,   2, 142, 128, 137, 139,  71, 137,
-  8, 142,   9, 142, 137,   2, 137, 142,   2,  14,  68,  69,  14,  14,   8,
-137,  68,  69, 137,  69,  69, 137, 142,  14,  15,  68, 142,  68,   2, 137,
-139,   2,  14,  69, 139, 130,  14,  14,   2, 142,  71, 137,  14, 139,  69,
-142,   2, 139, 139,  68,  14,  14,   2, 130,  14,   8, 137,  14, 137,  14,
-137, 137, 137, 130, 137,   9,  14, 142, 139, 130, 137, 142,   9,   2, 139,
- 69, 139, 137,   9,  68, 137, 137, 139,  68,  68,  69, 142,   9,  69, 137,
-142, 139, 142, 139, 142, 137, 130,  69,  69, 139,  71,  14,  14,  69,   9,
- 14, 142, 130,   9, 130, 139,  15,   9,  69,  71,   9,   2,  68, 139, 137,
-142, 142, 130,   9,   2,   9, 137, 139,   8, 137, 130, 128, 137,  15, 142,
-  8, 142, 142, 130,  69,  69,   9, 137, 137,  68, 128,   9, 137,  14, 142,
-  2,  68, 130, 137,  14,  69,  14, 137,   9, 128,   9, 137,   8, 130,  15,
- 14,   9, 142,  69,  69, 142,   9,  68, 139, 130,   2,  69, 128, 139,   2,
-  2,  14, 130,   9, 130, 139,   9, 142, 137,  69,   9,  15,  69,  69,   2,
-  9,  14,   2, 142,   2,  14, 130,  69,  14, 137,   8,  14,   9,   2,  68,
-142,  69,  15, 137, 130,   2, 130, 128,  71,  68, 142, 130,   2, 137, 142,
- 14,  14,   9, 130, 142,  71,   9,  69,  69,  69,  71,  14,   2,   8,  15,
-137, 142, 142,  14, 130,   9,   9, 137, 137,  15,  12, 142,   9,   9, 130,
-137,   2, 137,   9, 139,   2,  68,   2,   9,  69,   2, 139,   2,  14, 137,
-  9,   9, 142, 130, 142, 142, 142, 137,   2, 142, 142, 142,  71,  14, 137,
-130,   9,   9,   9,  15,  69,  69, 130,  71, 130, 139,  69, 139, 137, 139,
-137,  14,  69, 130,   8,  69,  71, 142,  69,  14,  71,  69, 142,  15,  71,
-  9, 137, 142,  14,  69,  14,  69, 142, 137,  69, 130,   9,  12,   9, 255,
-  9,  15, 142, 137,  69,   8,  69, 142,  12, 142, 128,  69,  14,  15,  71,
-  9,   2,   2,  69,  14,   9, 137,   2,   8,   2, 128,  69,  69,   2,  15,
- 15,  68, 142,   2,   2, 142,   2,  69,   2, 128,  69, 255,   2, 130, 137,
-  9,  69,   9,  15,  69,  14,   9, 142, 130, 142,   9,  69, 137,   2,   8,
- 69, 137,  71, 139, 130, 139, 130, 137, 142,   2,  68,   9,  69,  69,  14,
-139, 137, 137, 131, 142,  14,   8,   9,   9,   2,  69,   9, 137, 137,   2,
-  9,   2, 139, 142, 130,   8, 142, 131,   2, 130, 131, 130, 130,   2,  14,
- 14,  12, 142, 137, 137,  14,   9, 128,   8, 137,   9, 142,   9,  14,  14,
- 68,  71,   8, 130,  71, 139, 128, 142, 137,   2,   9, 142,  15,  71,  68,
- 14, 130,  69,  12, 142,   2,  14,  15, 137, 137,  68, 142,  69,  69, 137,
-137,   9, 139, 139,   8,   9, 137,  69,  14, 142,  14,  14, 130,  71, 139,
-130, 142, 137,  68,   9,  68,  14, 137,   2,   9, 139, 131,  69,  15,   2,
- 14, 142, 130, 137, 142,   9, 130,   9, 130, 142, 142, 137,   2, 142,   9,
-  2,   9,   2, 130, 130,  69, 139, 137,   8, 139,  69,  69,  12, 130,  69,
- 14,   2, 142, 142,  14,   9, 142,  15,  15,  14,   9, 137,  68,   9,  71,
- 71,  68, 137,  69,   2,   2,   9,  14, 137, 142,   2, 142,   9,  68,   2,
-131,  14,  69,   2,   2, 142, 142,  14,   2, 131, 137,   2, 142,  71,   2,
-  2, 137,  71,  69, 142, 137, 137,  69,   2,   9,  68,   2,  12, 130,  69,
- 69,  69,  14,   8,   2, 139,   9, 142, 137,   2,  69, 137,   9,   9, 142,
-130, 137, 137,   9,  69,  68,   9,  14, 142, 139,  69,  15,  69, 137,   2,
-130,  14, 142, 142,  69,   9,   9, 131,   9,   9, 137, 142,   2,  14, 128,
-139, 128, 130, 137,  71,   9,  14, 142,  15,  14,  14,  69,   2, 137,   8,
- 71, 128,   9,   9, 137,  69, 137,   8, 130,   2, 142,  69,  14,  14,   9,
-130, 142, 142,  69,   9,  14,  14,   9,  69, 142, 142, 137, 142, 142,  69,
-  8,  69,  69,   2,  15,   9, 137,   2, 130, 142, 142,  14, 137,  15,   2,
-142, 131,  14,   2,  71,  71,  68,  69, 131, 142, 137,   2,   2,   9,   9,
- 69,  69,   9,   9,   9,  14,  69,   8,   9,   9, 142,  69, 137, 142,  69,
- 14,   9,   9, 137,  69,   9, 142,  14, 142, 142,  14, 130, 142,  69, 137,
-  8,   9, 142, 137,  69, 142,  14, 142,   2,  69, 137, 142, 128, 137,   2,
-142,  14,   9,   9,  14,   9, 142,   9,   9, 142,   9,  14,   9,  69,  14,
-137, 142, 142,   9, 137, 142, 142,   2, 142,  12,   2, 142,  69,   2,  14,
-  2, 142, 137,   2,  15,  12,  69, 142,   9, 142,  14, 137,  68, 142,   9,
-  2, 142, 137,  14, 142,   2, 137, 142, 137,   2, 131, 142,   9,  14,   9,
-137,   2,   9, 137,  69,   9,   9, 142,   2, 139, 139, 137, 142, 142,   2,
-142, 137, 142,   2,  69, 130,   9, 139,   2,  12, 128,   2,  69, 139,  15,
-137, 137,  12,  14, 142,  12, 130, 139,   2, 130,   9, 131,  69, 137,  14,
- 15,  68, 130, 142,   9,   9, 137, 142, 137, 131, 131,  69, 128, 137,  12,
-  8,  14,  69,   2,  15, 137, 139,  14, 137, 137, 142, 142, 137,  69, 137,
-  2,   9, 137,  15,  12,  14, 137,   9, 130, 142, 142, 137, 142,  71,   8,
-142,  69,  69,  14, 137,   2,   9, 130, 131, 128,   9,   2, 137, 137,  69,
-142,   9,   9,  69, 142, 142, 137,   9,  14, 142,  69,   9,   2, 142,   8,
-130,   2,   9,   2,   9, 137, 128,   2,  69, 142, 130,  14,  69,  69, 142,
- 68,   2,  69,   2, 137,   9,   2,   9,   9,  14, 137, 137,  14,  12, 128,
-  9, 137, 142, 142,  69, 137, 142,  69, 137,  69,  14, 137,  69,  14,  69,
-  9, 131, 142, 128, 142, 128,  12,  69,   9, 137, 142, 130,   9,  69, 137,
-137,  69, 130, 142, 142,  12,  12,  14, 142,   2,   9, 137,   2,  69,  69,
-  9,   2, 142, 137,  69,   8,   2,   9, 137, 130,  15,   9,   2,   2, 130,
-  9, 142, 142, 142,  14,   2,   2, 131,  69, 130,   2, 131,   9,  69, 137,
- 69,   2,  14, 130,  15,   2, 137, 142,  15, 137, 137,  14,   9,   2,   9,
-137,   9,  12,  14,  69, 137, 142,  69,   2,   2,   2,  14,  14,  69,   9,
-  9,  14, 142,  12,   9,   9, 142,  69, 137,   2,  69, 130, 137, 142,  14,
- 15,   2, 142,   2,  14,   9,  69, 137,  14,  69,  68,  12, 131, 128,  14,
- 69,   9, 142, 137,   9, 137,  15, 142,   9,  14,   2,   2, 142,   2,  14,
-137, 139,  69, 142,  12, 137, 142, 142,  14, 128,   2,  12, 142,  69,  69,
-137,  69,  69,   9, 142,   9, 130,   2,   9,  69, 128, 142,  69, 142,  14,
-137,  69,  69, 137,  69,   2,  69, 130, 130,  69,  14, 137, 128, 142,   9,
-  9, 137, 137, 128, 142,  69, 130,   9,  14,  12,   2, 128, 142,  14, 130,
-137, 137,  69,  12, 142,  69,   2, 137,  69,  69,   9,   2,  14,   9,   2,
-137,   9,   9, 130, 137,  69, 131,   9,  12, 130,   2,  14,  69,   2, 142,
-131, 137,   2,  69, 142,  12,   2, 137, 128,  12,  69, 137,  69, 137, 142,
-  9,  14,  69,  14,  12, 137, 142, 142, 137,   2,   9,   2, 142,   9,  69,
- 69,   9, 142,   2, 128,   2, 137, 137, 131,  12,   2, 142,  69, 130,  12,
-  2,   9, 137,   9,   9, 137,   2, 142, 142,  69, 142,  14,  12,  12,  14,
-  2,  14,  69,   2,  15,   2, 131, 142, 128,   9,   2,  12, 142, 142,   9,
-142, 137, 131, 130,   2,  15,  69,  69,  69,   9, 142,   9,  14,   2,   9,
- 15,  69,   9,   2, 137, 142, 142, 137,   9,   9, 131, 142, 131,  69, 137,
- 14,   2, 142, 137, 142,   9,   9,   2, 131, 143,  14,  14, 130,  12, 137,
-  9,  69, 128,  69, 128,  14,  69,   2,   3,   2,  69, 137, 137, 137,  12,
-142,   9,   2, 142, 130,   9, 137,  12, 137,   0,  12,  69, 137,  14,  69,
-137, 130, 128,  15,  12,   3,   9, 142,   9,  14,  69,  69,  69,  12,   0,
-142,  12, 142, 137,  14,  69,  12,  69,   9,   9, 142, 142,   9,   2, 142,
-131, 142,   2,  12,   9, 142,  12,   2, 142,   9,  12,   9,  69, 142,  69,
-  2,   2,   2,   2,   2,   9,  69,  69, 137,  12, 137, 137,  14,  69,   2,
-  2,  14,   2, 137,   9, 137, 142,   9, 131, 131,  12,  15, 130,   9, 131,
-  9, 137,  69,  12, 137,  69,   2,  14,  69,  12,  69, 142,  12,   9, 140,
-  2,   9, 137,  12,   2,  15, 142,  12,  12, 142, 142,   9, 128,  69, 142,
-137,   9,   2, 142,  12,   2,   3,   2, 142,   9,   9,   9,   0,   9, 131,
-142, 137, 130,  14, 137, 140,  69,  69,  12,   9,  15,  12,   2,   9, 130,
-  9,  69,  69,  69, 142, 142,  69, 137,  69,   0, 140,   2,   2, 128,   9,
-  2,   9,   9,   9,   9,  69,  69,   9,  15, 131,  14,  69, 142,  69,   2,
-  2, 130, 142,  69,   9, 131,  12,  14,   2,  14,   2,   2, 131, 142, 130,
- 15,   2, 142, 142, 142,  12, 128, 142,  14, 128,   2, 137, 137,  69,   9,
-  2,  12,   9,  69,   9,   9,  69,  69,   9,  12,   2,  69,   2,  14,  12,
-  9, 142, 137,   2, 130, 142, 137, 137,  69, 137, 131, 142, 130, 137,  12,
-  2, 137,   9,   9,  12, 142, 137, 131, 142,  69,  14,  14, 131, 137, 131,
-142,  12, 130,  69, 137, 142, 130,  12,   9, 143, 142, 131,  69,  12, 128,
-  2, 131,  14, 142, 142, 137,   9, 130, 142,   3,  69,  69, 142,  14, 142,
- 12, 137,   3,  14,  69,   2, 137, 131, 137, 130, 142, 137, 142, 142,  14,
- 69, 137, 131,  15, 142, 137, 142,  69, 140, 137,  69, 130, 140,   9,  14,
- 69,   2,   9, 128,   9, 137,  12, 130, 142,   2,  69, 142, 142,   3,  12,
- 12,  12,   0, 130,   0, 131, 128,   2, 128,   9, 143,  12, 128, 137, 137,
-  9,   9,   9,  69,   3,   2,  15,  69, 131,   2,  12,  12, 142, 142,   2,
-130,   9, 128,  12,  12, 142, 142,   0, 140,  14,   0, 137, 140, 128,  12,
-137,  12,  12, 137, 131,   9, 130,  69, 140, 137, 142, 142,  15, 128,  69,
- 12, 137, 131, 142,   9,  69, 130,  14,   9,   9,  69, 142,   2,  69, 130,
- 69, 137, 143, 142,  14,   2, 142, 137,  12,   2,  12,  69, 137, 142, 140,
-142,  69,   2,  69, 143, 142,   9,   2, 142, 137,   2, 137,   9, 137, 128,
-137, 142,   2, 137, 131,  69,  69, 131,   9, 140,   2, 142,  69,   2, 137,
-137, 142, 142,  15, 137,  12, 130,  69,   9,  69,   3, 142,  14, 137,   9,
- 14, 131, 142, 142,  69,   2,   2,  14, 137,   2,  14,   2,   2,   2, 128,
- 69,   9,   9, 142,  14,   9, 137,   9,  12, 142, 128, 140,  14,  12,   9,
-131,  14, 131,  69, 140,  14,   0, 142, 142,   9,  12,  15,   2, 137,   2,
- 12, 140,  69,  14, 255,  14, 137, 131, 131, 143, 140,   2, 137, 137, 130,
-  0, 140,  69,   9,   2,   9, 143,   2,  12,  69,  15, 137,   9, 142, 137,
-131,  12,   9,   9,  14,  12,  69,   2,   9,   2,   9,  14,   2,   2,  69,
-131,  12, 142, 131,  15,  15,  14,   9,   9,  12,   9,  12,   2,   9,  12,
- 12,   9, 130,   9,  14, 130, 137,  69, 128, 131,   9, 131, 131,  12,  12,
- 14,  69, 142,   9,   0,   9, 128,   9, 137,  69,  69,  12,  15, 131, 142,
-137,   9, 143,  69,  14,  14,   0, 142,  12, 130,   3, 137,   0,  69, 142,
-  9, 142, 137,   2, 130, 142,   9,  69,   0,  69, 137, 137, 143,   2,  69,
-142,  69,   2, 137,   3,   3, 142,   0,  15, 140, 137, 142,  15, 140,   0,
-130,  69,  15,   3,  14, 143, 137,  69, 131,   2,  69,  69, 137, 131, 143,
-  2,   9, 137,  69,  69,   9,   2,   9,   9, 142,  12,  69, 143,   9,  12,
-  2,  14,   3,  69,  12,  69,  69, 142, 137, 131,  69,  12,   9, 130,  12,
- 12,   9, 137,   2,   3, 137, 128, 130, 130,   3, 140, 142,  12, 131,   2,
-137, 140,  69,  12,   0,   2,   2,   3,  14,   0,   9, 137, 142, 142, 142,
-137, 130,   9,  15,   2, 143, 143,  69,   9,  69, 142,   2, 131,   0, 142,
-143,  15, 128, 143,   9, 142,  12,  12, 142,  69,  69,   3,   9, 143, 130,
-  2, 142, 130,   9, 142,  69,  12, 137, 140, 130,  69,   9, 142,  69,   2,
- 14,  12,  12,  12, 142, 137, 143,  12, 142, 131,  12, 142, 131, 140,   2,
-137, 142, 131, 137,  14,   0,  12, 142, 137,  12,   9,   9,   9, 142,  15,
- 12,  14, 137,  15, 142,   2,   2, 137,   3,   9,  14,  69,  69, 130,   9,
-  2, 142,  69, 142, 131,  12,   9,   2,   3,   9,  69,  12,   0,   9,  12,
-  9,   2,   3, 140, 128,  69,   9,   3,  69, 140,  69,   2,  69,   0,   9,
-143, 142, 130, 137, 143, 137, 143,  69,  69, 137, 130, 130,   2, 137, 137,
- 14,   2,  15, 140, 128,  12, 130,  15, 140, 131, 143, 140,   9,  12,  69,
- 14, 128, 137,  12, 130,  12, 131, 130,  15,   0,   9,   3,  12, 131, 137,
-  3,   2,  12, 137,   9, 142, 137,   9,  14,   2,   2, 142, 131, 131, 143,
- 14,   0,  69, 143,   2,   9,   9,   2,  12, 137,   9, 131, 143,   2,   9,
-  9,  69,   2, 140, 140, 143,   3,  14, 131,  12, 131, 131,   2, 142, 137,
-143,   9, 140,  69,   2,  12,   3,   3, 143,   9,  14, 142,   2,   3, 142,
- 12, 137, 142, 142,   3, 131, 137,   0,   0,   2,   2, 137, 130,   0,   0,
-142, 142, 142,  69,  14, 142, 142,   2,   9, 140, 137, 131,  15,   2,   3,
-140, 131, 142,   9,   2, 131, 142,  69,   3, 143, 137,   9, 142,  12, 142,
-137, 137,  69, 128,  69, 142, 128,   0,   0,  12, 130,  69,  12,   0, 137,
- 12,   9,  12,  69, 142,   9,  69,   2,  12,   2, 131, 130, 142,   9, 142,
- 12, 137,  12, 128, 128,  69,  12, 142,  14, 143,   3,  69,  69, 131, 137,
-142, 128,   9,   9, 142,   9, 131, 140, 131,  69,  69,   9,   3,  69, 142,
-142,  15,   9,  12, 143, 140, 131,   9,   9,  69,   0,  69,   2, 140,  69,
-  2, 142,   2,   9, 137,  15, 137, 140,   2,  15,   9, 142,   9, 142,   9,
-  9,   2,  69, 140,  69,   9,   2,  12, 131, 143,  15,  12, 130,   2, 143,
-  2, 130, 131, 137, 137, 140,  12,   0, 140, 140,   9, 137, 130, 143,  12,
-128,  12, 131, 143,   9,  69,  12,  12,   9,  69,  14, 143, 131,   2, 142,
- 12,   9, 131,  12,   9,   0,  69,  69,  69, 142,   3,   3, 140,   2, 140,
-131,  12, 142, 130,   3, 142,  69,   9, 131,  14,   9, 137, 128, 137, 142,
-  2, 142,   2,  14,  12,   9, 140,  15, 137,  12,   9,  15,   9,   9, 137,
- 15, 131, 131, 142,   9, 142,   2,  12, 142,   9,  12,   9,  12, 137,  69,
- 12,  69,  12,   0, 140,   0,  12,   2,   0, 130, 140,   3, 137,   2, 137,
-  3,   9,  12,   3,  69, 143,   9,   9, 143,   2,  69,   9,  15,  12, 130,
-142, 140,   2,   3,   3, 142,  69,   2,  69,   0,  69,  69,  12,   9, 137,
-143,  69,  12,  12, 143,   9,  12, 137,   2, 142,   9, 143,   9,  12, 137,
- 12, 131, 128,  69,   0,   2,  12, 128, 137, 137, 142, 143,   0, 142,   0,
-143, 128, 137, 142,   3,  12,   9, 137,   9,  15,   9, 142, 131,  12,  14,
-131, 142, 131,  69,   2, 140, 128, 140,  12,  12,  69,  12, 128, 130,  15,
-  0, 130,   2,  12, 142, 130,   3,  12, 137,   2, 140,  15, 142, 131, 128,
-143, 140, 131, 131, 142, 142, 255, 140, 140, 131,   2, 143, 140,  12,   3,
-131, 128, 143, 140, 137,  15, 143,  12,   3, 130, 142, 131, 142, 130, 143,
-137,   0,   3,   3, 128, 143,  69,   9, 142,   9, 140,  12, 143,  12, 140,
-143,   3, 128, 137,   9,  12, 255,  69, 131, 137, 137, 143, 140,   2, 143,
-140,   0, 128, 140,   9,   0,   2,   3,  15, 140,  15,   3,   2,   0,  14,
-  0, 142,  14, 130, 137, 137, 140, 140,   2, 142,   2, 142,  12,  69,  69,
-140,  12, 143,  15,   3, 142,  14, 131,   9,  12, 131,  69,  14,  69,  69,
-  2, 137,   2, 128,  69, 143, 143,   0, 142,   2,   2, 142, 131, 143, 137,
- 14,  69, 131, 137,  69, 143, 140,  69, 142,  12,  12, 143,   9,   3, 131,
- 15,   9, 131,  69,   0, 140, 130,   3,   3,  69, 143,   9,   9,  12,  14,
-131,   3,  12, 143,   9,  69, 137,  12,  12, 131, 142, 137,   9,   9, 131,
-  2,   0,   9, 128,   0,   3,  14,   9,  14, 140, 143,   3,   0, 142,   9,
- 69,   3, 143,   0,  69, 142,   3,   2,  69,   3,   9, 137, 142, 137, 131,
-142, 140, 143, 142, 140, 142,   0, 131,   0,   0,   3,   9, 137, 143, 140,
-137,  15, 140,  12,   3,   2, 143,  12,  12,  69, 131,   3,  14, 142, 140,
-137,   9,   0, 143, 143, 142, 142,   2,   9, 140,  14, 142, 128,   0, 140,
- 12,   9,  12,   0, 137,   0, 137,  69,  69,   2,   3,   2, 142, 137, 142,
- 15,  69, 140,   2,  12, 142,  69,  12, 128, 142,  15, 140,   3,  12, 140,
-143,   9,   0,   9,   2,  69, 140,   2, 128,   2, 143,   9, 140,   3,   0,
-143, 140, 137,   0, 137,   3,  15,  69,  69, 143,  69, 140,   3,  15,  69,
-130,  12,  14,  12,   3, 137,  12, 142,   9, 140, 142, 128,  14, 142, 140,
-131,   9,   0,  12, 137,   2,  14,  15,  12, 143,  15, 137,  14,   2,  14,
-  2,  12, 137,  14,  69, 137, 140,  69, 137,  12, 142, 140,   0,   0,  12,
-  3, 137,   2,   0,   3, 143, 131,  14, 140,  69,   9,   2, 143, 137, 130,
-  3, 128,   0,  15, 142, 142,  15,  15,   2, 143, 137, 137,  12, 143, 142,
-137, 131,   9, 140, 128, 137,   0, 143,  12,  69,   3, 131,  14,   9, 140,
-137,  69,  12, 143,   0,   9,   3, 131, 137, 137, 131, 143, 130, 142,   3,
- 15, 143, 142,  69,   2,   0,   9,  12,   0,  69,  12, 131, 137,   3, 140,
- 12,   3,   2, 140,  12,   9, 140, 140, 128,   9, 140, 143, 131, 142, 143,
-131,  12,  69,   0,   2, 143, 131, 142, 131,   0,  12, 130, 131, 140,   0,
-140, 131,   9, 143, 140, 142, 140,   3, 137,  12,  14,  12, 131, 137, 143,
- 69,  69,  69, 143,  12, 137, 143,  12, 131, 140, 137, 143,  69, 255, 130,
-143, 130,  69, 140, 130,  15, 131, 131,   9, 142, 142, 131, 142, 137, 131,
-131, 137,   0,  69, 140,  15, 140,   0, 137, 140, 137,  12,   3, 130,   3,
-  0,  69, 140,   3, 142, 140, 137,   9, 143, 142, 142, 131,  12, 131,  15,
-140, 131, 131, 143, 143,  69,   2,   2,  69, 143, 128,   0,   0,  15, 143,
-  3,   0,   3,  12,  12, 143,   9,   3, 128,  12, 143,   0, 131, 140,  69,
-  3, 140,   3,   2,  12, 137, 131,   2,  69, 143, 142,  69,  12,   9,  69,
-142, 128, 142, 140, 131, 128, 137,   2,  12,   3,  69,   3,  12,  69, 131,
- 12,  69,   0, 137, 142,   3, 128, 137,  69, 137,   0, 128, 142,  69,   9,
- 15, 140,  14,  12, 142, 143,  12, 131,   2, 137,  12, 140, 137,  15,   3,
- 12,   3,  12, 142,   0,  69, 143,   3,  69, 143,  15,  12,  12,   2, 143,
-  0, 131,   0,  12,   9,   0, 131,  12, 128, 142, 142,  12,   9,   2, 143,
- 69,   2,   3, 137,   9, 140, 137, 143, 140, 131,  12, 131,  15,   2,   9,
-140,   3,  12, 131, 143,  12, 142,   9,  15,  12,   9, 140, 131, 137,  69,
- 14, 140,   9, 128,  12, 137,   2,  15, 140, 142, 143, 137,  14,  69,   0,
-  3,   9, 140,   2,  12, 140,   9,   0, 137,  12, 128, 131, 131, 140, 137,
-140,   0,   9, 143,   9, 131,   9,   9,   9,  12,  12,   0, 143,   3, 130,
-142,  69,  12,   0,   2,   9,  12,  12,   9, 140,   2,  14,   2,  12,  69,
-  9,   0,   0,   9,  12, 143, 131,  12, 131, 128,   3,  12,   0, 142,  12,
-143,   3,  12,  12, 131,   2, 140, 128,  69,   3,   0,  12, 131, 143, 128,
-140,  12, 143,   9,  14,  12, 142, 140, 142,  12,  12,  12, 131,   2, 142,
- 12, 143,  12, 137, 140,  12,   3, 142, 142, 143, 142,  12, 131, 131,   9,
- 69,  69,  69, 137,   2,   0,   3, 137, 140, 140, 128, 137, 130,  12,   3,
- 69,   3,  15, 131,  12,   9, 131, 131,  69,  12,   3,   2, 140,   2,  15,
-130, 143,   9,   0, 140,   0, 140,   2,  69,   3,   0, 143, 128, 131, 143,
- 12, 137, 140,  12, 143, 142,  12, 128, 137, 143, 143, 143, 140,   0, 143,
-  3, 130, 131,   9,  12, 143,   0, 131,   0, 143, 131,   3,  12, 140, 140,
-140,   3,  12,   0,   2, 131, 140,   0, 140, 143,   3,  12, 131,  12,   0,
-  3,   9, 140, 131,   3,  69,  69,   0,   0,  12,  15,  15,   0,   3, 143,
-140,   2,  69,   0,  69,   3,  12,  12,   9,   2,   3,  14, 128, 128,   2,
-  0,   9, 128,   0, 131,   3,  12,   0, 142, 137, 137,  12, 142,   0, 142,
- 12, 137, 137, 142,   0,  12, 137,   3,   0, 143, 143,  15, 131,   0, 131,
-131,   0, 131, 142, 131, 142,   9,   0,  69, 140,  12,  12, 131, 137,   0,
-131, 131, 131,  12, 131, 137, 130,   0, 131, 137, 140,   3, 143, 140, 128,
-137,   9, 140,   3, 137,  12,  12,  12,   2, 137, 128, 131, 142,   3,   2,
-131,   9, 130, 131, 131, 140,  14, 140, 130, 131, 131,   9, 143, 140, 140,
-  3,   3,  15,  12,   3, 140, 128, 140,  69,  15,   0,   3, 140,   0,   0,
- 12, 128,   2,   3, 140,  69,  12,  12,  12,   0, 140, 142, 140, 140, 142,
-143,   0, 143,   9, 128,  69, 142,  15, 143, 140, 143, 143,  12, 128,  15,
-128, 140, 143, 137, 142, 137, 143,   3,   9, 137, 143, 128,  12, 131, 143,
-  0, 131, 143, 143, 140, 131, 143,   3, 143,  12,   0,   0, 128, 130, 140,
-  3,   3,  12, 128,  12,  69,  15, 131,   3, 143,   9,   3, 143,  14,  12,
-  0, 140,  12, 140,   3,   3, 143,   3, 140,   2,   3,  12,   9,   0, 140,
- 12,   2,  12,   2, 143, 142,  69,   2,   3,   2, 142,   0, 143,  14,  12,
-  3,   9,   0,   2, 137, 140,  14,   0,   0, 140,  69,   0,   3, 142,  12,
- 69, 143,  15,   3,  12,  15,  12,   9,  12,  12, 131,   3,   9,  12, 143,
-  3, 140, 140,   0,   0, 131,   3, 140, 140, 131, 131,  12, 143, 137, 143,
-140,   3, 140, 131, 137, 143,   9, 142,  12, 131, 140, 142,   2,  12,   2,
-143, 143,  12,  12,  12, 131, 131,  12, 143,  12,  12, 140, 131,   2,   3,
-  0,   3, 140, 142, 143,  15,  12,  69,   3, 128,   3,   3,   0,  12,  12,
- 12,  14, 137,  69, 131, 142, 140, 130,  15, 140, 143, 140,   0,  15, 131,
-131, 131,  12, 143,  12,   0,   3, 140,   3,  15,   9,  12,   2, 128, 131,
- 12, 140,   3,   2, 131,  12, 143,   9,   3,  12,   2, 140,  15, 143,  12,
-  0,  12,  15,   0, 140,   3,   3, 140,  12,  15,   3,  12, 143,  69, 143,
-131,   3,  12, 142, 128, 142,   3,  15, 142, 140, 128, 142, 140,   0,   0,
-140,   0, 140, 131,  14,  12,  12, 143,  12,   3,   3,  12, 143, 143,   3,
-131, 131,  12, 131,  15, 140,  15, 131,   0,   3, 140,   9, 128,   0,   2,
- 12, 143,  69, 143,   0,  12, 143,   3,  12, 137, 140,   3,   3, 131, 128,
-137,   0, 128, 142, 143,  12,  12,   3,   3,   3,  12, 140,   3,   0,   9,
- 69,   3,  12,  15,  12, 140,  12, 137,  12,   2, 131, 137, 140, 131, 130,
-  3,  12,   3,   0, 143, 137, 128,   9, 140,   3, 140, 143,   3, 142, 131,
- 12,   3, 143, 137,   3, 131,  12,   0,  12, 128,  12, 140,  69,   0, 131,
-140,   0, 131,  12, 143, 140,   3, 137,   0,   0, 131, 143, 140, 137,  12,
- 69,  69,  12, 143,   0, 140,  69,   0,   3, 143,  15, 140,   0, 131, 143,
-131,  12,   2,  12,  12,   3, 131,   0,  12,   3, 143, 131,  12, 131, 142,
-131,  12,   9, 140, 140, 143,   3, 131,   0, 131,  12, 140,   3, 140,   0,
-131,   0,  15, 142, 143, 131,  12,   3,  69,   3,   3,  14,   3,   3,  69,
- 12, 131,   3, 143, 143,   3,   0, 131, 140, 131,  15, 143, 130,   9,  12,
-  3, 137, 131,   3, 131, 131, 140, 143, 143,  12, 140, 143,  12,   0,  12,
-  0, 140,   0,  15, 137, 142, 140, 140,   2, 143,   0, 143,   0,   3,  12,
-131,  12,   0,  15, 131,   3,  12,  12,   3,   9, 143,  12,  12,   3, 140,
-  3, 140, 128,  12, 140, 143,  12,  12,   0,   0,  12, 143, 143,  12, 140,
-140,  15,  12, 140,  12,  12,   0,  12, 128,   3,  15,  15, 143,  12, 137,
-143,  12,  12, 140,  15, 143, 143,  12, 143, 140, 128,   0,   0,  69,   0,
-131,   3,  12,  12, 140,   3, 143, 137, 140,   0,   0,   2, 143, 131, 137,
- 12,  12, 131, 131,   3,   0, 143,  12, 131,   0,   0, 131,  12, 140, 131,
-128, 143, 140, 131, 131, 143,  12,   3, 131,  14,  12,   0, 143,   9, 140,
-  0,  12,   2,   0, 128, 137, 131, 131,   0,   0,  12, 131, 142,   0,   0,
-140, 140,   3,  12,   3,  12, 143, 140,  12, 140,   3, 140,   0, 143,   9,
-  9, 140, 128, 140, 140,  15, 140,  69, 131, 140, 140,   2,   0,  12,  12,
-131, 143, 140, 143,   0,  12,   3, 143, 143,  12,  12,   0,   3,  12,   3,
-143, 131,  12,   0, 143,  15, 143,  12,  69, 131,   0,   0,  15,   0,   3,
-  3, 131,   3,  12,   3, 140,   0, 140, 140,   3,   3, 143, 128, 131,  69,
-  0,  15,   3,  12, 131,  12, 140,   3,   3,   0, 143,   2,   0, 140,  15,
- 12, 143,  15,   0, 142,  12,   0,   3,   0,   3,   3, 143, 142, 131, 131,
-  0, 131,   3,   3,   0, 143, 140, 131,   3,   3, 143, 143,   9, 140,  12,
- 12,   3, 143,  12,   0,  12,   0,   3, 128,   0, 140, 128,  15,   0,   0,
- 69, 143,   0,  15,   3, 131,  15,   0, 140,   3,   0, 131, 140, 128,   9,
-140, 140, 131, 142, 140,  12, 143,   0,  12, 143, 143,   0,  12,  12, 128,
- 12, 140,  12,  12,  12, 140,  12, 143, 140,   3, 128, 143, 140,   3, 143,
-140, 131, 140,  15,  12,  12,  12,  12, 140,  12, 140,  12, 131, 131, 140,
-143,  12, 128,  15, 143, 131, 131,  12,   0, 140,   0, 131,   0,   3, 131,
-  3,   0,   0, 143,   0,  12, 140,   0, 143, 140,  69,  69, 140, 140, 140,
-  3,  12, 140,   0,  12,   3, 131, 128, 128,  15,  12, 143, 140, 143, 143,
- 12,   0,   0,  12, 140, 140,   3, 131, 142, 131, 131,   3,  12, 140,  12,
-143,   3,  12,  12,  12, 140,   3,  12, 128,  12,   0, 128, 140,   0, 131,
-131, 143, 143, 131, 128,  12,  12,  12, 131,   0, 128, 131, 143,  12,  12,
-143, 143,   3,  12,   3, 140,  15, 143,  15, 128,   9, 140, 128, 143, 128,
- 12,   0, 140, 140, 143, 131,   3, 140,  15, 131,   2,  12, 143,   3,  15,
-131, 143, 143,  12, 140, 140, 131,   3, 143,   0,   0,   0, 143, 140, 143,
-  3, 131,  15,   0,   3,   3,  12,   3, 143, 131, 140, 131,  12, 140, 131,
-  3,   3,   3,   2,  12,   3, 143,  15, 131, 131, 131, 131, 131,  12, 140,
-  3, 143, 140, 140, 131, 143, 140,  12,   3,   3,   3, 143,   0,   0, 143,
-140,   0, 140,   0,  12, 131, 131,   0, 128,  12, 131, 128,   0, 143,  15,
-131,   3,   0, 143, 131,   0,  12, 140,   3, 143, 143, 143, 140, 143,   3,
-  0, 143, 143, 131,   0, 140,  15,   0,  12,  12, 140, 140,  12, 143, 143,
- 12,   0,   0, 143,   3, 143, 131, 143,   3,   0, 131,   0,   0, 143, 131,
- 12, 143,   0,   3, 143, 128, 143, 131, 131,   0, 143, 140, 131, 140,   3,
-143, 143,   3, 140, 128,  15, 143,   3,   0,  12,  12, 143, 140,   0,   3,
-  3,  12, 140,  12,   0,  15, 143,  12,   3,  12,   3,   0, 140,   0,   3,
-131, 128, 131,   3,  12, 143, 140,  12,  90,  12, 140,   0,   0, 140,   0,
-143, 131, 131,  12, 128, 131, 131,  12,   0,  12, 143,   3, 128, 140,   0,
-140, 140, 143,  12, 128, 143, 140,   1,   3, 131, 143,   3,   3,  12,   0,
-140,   0, 140, 143, 143,   0,   3,   0, 131, 140,   3,   3, 128, 128,  12,
- 12, 140,   0,   3,   0, 143,   3,  12, 131,  12,  12,   0, 143,   0,   0,
-140, 143, 128,  12,   0, 143, 131,   3,  12,   3, 143,   0, 128,   0, 143,
-134, 131, 143,  12, 140, 143, 140, 140,   3, 143,  12,   0, 140, 140,   3,
-140, 128,   0,  12,   6,   0, 143,   6, 141, 131,   1,   0,  12,   0,   0,
- 12, 140,  12, 140,  15,   3, 143,   3, 143,  12, 143, 131, 143, 140,  15,
- 15, 143, 140, 131,   0, 143,  12,  15, 143,   0, 131, 140,   0,   3,   0,
-  0,   0, 143,  12,   6, 128,  12,  12,   0,  12, 140, 140, 131, 131, 131,
-140, 143, 131, 140, 143, 143,   3, 143, 143, 140, 128,   1, 143,   3,   0,
- 15,  12,   6,  15,  12, 128,   3, 131,   3,   0, 141,  12, 140, 128, 131,
-131,  12, 131, 128, 131,   6,  12, 131,   0, 131,   3,   0,   3,   3,   3,
-143,   0,   3, 131, 140, 131, 143,  12,  12,   6,   3, 131, 140,  15, 140,
-143, 131, 143, 140,  12, 143, 131, 131,   0,   3,   3,   0, 131, 140,  12,
-131,   0,  12,  12, 131,   3, 140, 128, 143,   0,  12,  15,  12,  12, 140,
-140, 143, 143, 131, 131,  15,  12,   3, 143,  90, 140, 140,   3, 143,  15,
- 15, 143,   3,   0, 143,  12, 143, 140,   3, 131, 143, 140, 131,  12,  12,
-  3, 128,   3, 131, 140,   0,  12,  12,   0,   0, 143, 131, 140, 140, 140,
-128, 131, 143,  12,   0, 143,   3, 143, 131,   0, 131,  12,  13, 140, 131,
-  3, 131,   3,   0, 143, 128,  12,   6,   0,  12,  12, 143,   0,   3,   3,
-143,  12, 141,  90,  12,   0, 134,   0,   6,   3,   6, 128, 140, 128,  15,
-  3,   0, 140, 128,   3,  12,   3,  12,   3,   3, 143, 140,  12,  12,   0,
- 12,   3,   3, 140, 140,   0,   1,  12,  12,   3, 131, 140, 143, 131,   3,
-140,  12,  12,   1,   0,   3,  12, 131, 140, 143,  15, 143,   3, 143, 131,
-131,   0,  15, 140,  13,  12,   0,  12,   3,  90,  12, 140,   6,  15, 143,
- 12,  12, 140,   0,  12,  12,   0,   0,   0,   0, 143, 140,  15,   0, 128,
-  0,   3, 143,  12, 143,   3,   3, 140, 131,   0, 143, 143, 140,   3, 140,
-143, 131, 143, 140, 143, 143, 128,   3, 128,   6, 143,   0,  12, 143,  15,
-143,  15,   0,   6,   3,   3,   1,  12,  15,   1,  15,  15, 143, 131, 131,
- 12,   3, 140,   1, 143, 140,   0,   0, 141,   3,   0, 143,  12, 143,   0,
-  6,  15, 131, 140,   3, 131,  15, 131, 128,   1, 128,  12,  12,  12, 128,
- 15, 128,   3, 140, 143, 131,  15, 131, 143,  15, 128,   3,   3, 131,  90,
-  0,   0,  12,  90,  90, 129,  12,  15,  15,  12, 143, 143, 128,   3, 131,
-  0, 140,   3,  12,   3, 140,   0, 140,  12, 140,   3, 140,  12, 143, 140,
-128,  12,   0, 140,   0,  90, 131,   3, 134, 131, 141,   6, 131,   6,   0,
-134,  12,  12, 143, 143, 128,   1, 131, 131, 140,   0,   0,  12, 140,   3,
-131, 140,  12, 143, 143,   0,   0, 131,   0, 134, 140,   0,   0, 131, 131,
-  3, 131, 131, 140,   0,   3,   3, 131,  15, 131,  12,   3, 131, 140, 140,
-131,  12, 141, 134,  12,   0,   0,  12,  15,  12, 141,   0,  13, 140,   0,
-  0,  12, 140, 140,   0, 143, 140,  12, 143,   1,  15, 131, 140,  12,  15,
- 12, 131, 140,  12, 131, 140,  12, 131, 143, 143, 134,   3,   0,  12,  12,
-143, 140,   1,  12, 141,   1,   0,   3, 141,   0,  90,   3,   0,   1, 143,
-131,  13,  12, 131,   1, 131, 131, 141,   6,   0,   6,  90,  12, 143, 143,
-128,  12,   0, 131,   0,   0, 131,   6, 143, 131, 131,   0,  15,   3,  13,
-  1,   0, 131,   3,   3, 131,   1, 143, 140,  15, 140, 134,   1, 140,   0,
- 12,   0, 141, 140,  12,   0,  90, 141,  12, 128, 143,   3,  12,   6, 131,
-129,   0, 131,   3, 131, 140,   0, 129,  90, 128, 143,   3, 140,  90, 128,
-140, 143, 143, 143,   0, 131,   3,   3,  12,  12, 131, 141, 143, 134, 143,
-  3,   6,  13,   0, 131,  12, 143, 140, 143,   3, 131,  90, 131, 131,  12,
- 12,  13,   0, 134,  15, 131,  12, 143, 140, 131,  12, 140,   0,   0,   0,
-  3, 140,   3, 143,   3,   1,  12, 143, 131, 143, 128,  13,   6,   1, 143,
-140,   0,   3, 143,   3,  90,   6,  12, 128,   0,  12,   3, 143,  12, 131,
-  0, 131,  12,   1, 131,   3,  90,   0,   0,  15,  12, 140,   3, 143, 143,
- 12, 140,  12,  12,  12, 140, 143, 134, 140,  15, 128,   0,  15,   0,  12,
- 12, 143,   3, 134,   6,  15,  12,   6, 141, 131,  90, 143, 131,  90, 140,
-140, 131,  13, 143, 131, 131,   3,   6,  90, 140,  12,  12,  12,   3,  90,
-134, 131,   0, 141, 143, 128,   1,  15, 134, 140, 131,   0,   3,   3,   0,
-  0,  12,  90, 134,  12,   0,  12, 131, 143, 143, 140, 143,   6,  12,   3,
-140, 128,  12, 140,   1, 131, 140,  15, 140, 140, 143,  12,   0, 141, 140,
-140, 143, 129, 141,  15,  12,  12,  15,  15,  12,   0,  90, 143,  12,  90,
-  3,  90,  12,  12, 143, 140,   0,  12, 140, 131, 141, 140, 134,  12,   6,
-141,   1, 140, 140,   1, 131,   3,   0, 128, 128,  12,   6, 140, 140,   3,
- 12, 141, 131,   3, 140, 131, 131,   0,   1, 134, 134,   0,   0,  12,  90,
-  3, 140, 143,  12,  12, 140,   6, 134,  90,  15, 140,  15, 141, 131, 143,
-  0, 140,   6, 131,   6,   0, 143,   3, 143, 140, 141,  12, 143,   6, 141,
-  3, 129, 131, 131, 131,   3,  15,  12,   1, 134,  12,   6, 141, 140,  12,
-131, 143, 131,   1, 143, 143, 140,   1, 143,   0, 131,   3,   3,  90,   6,
-131,  12,   1,  12,   0,   6,   3, 134, 129,  13, 140, 143,   3,  15,   0,
-131,  90,   0, 143, 134, 143,   0,  90,   0, 143, 143,  12,  12, 255,  90,
- 90,   3, 140, 143,   6, 140, 140,  12,   1,   0,   1, 141,   3, 140, 143,
- 12, 131, 140, 131,   0,   1,  12, 131,   0,  12,   0, 143,   0,   6, 134,
-128, 143, 141,  90,   3, 140,  90, 143, 143,   1, 134, 134, 128, 131,   1,
- 15, 131,   0,  12,  12, 129,   3, 140,   3, 129,  12,   3, 141, 143, 134,
- 12,   3, 140,   0,   3, 128,  15,   0,  90,  12,  12, 134, 134, 140, 140,
-141, 131,  12,  90,   0, 134,  12, 141, 143,  90, 140, 131,   3, 134,  12,
- 12,   3,   6,   3,  12, 134, 134,  15, 141,   1, 140,   3,  12,  12, 141,
-140, 140, 143,   1, 143, 140, 128,  12, 143,   3,   3,   0,  90, 140,   6,
-141, 143, 131, 143,   0,  12,   6,  12, 140,  12,  12,   6,   3, 143, 143,
-131,   3,   1,  15, 128, 143,  12,  13,   0,   6, 140, 143, 128,   3, 140,
-131,   3, 140, 141, 143, 143,  15,  90, 128,   0, 143,  90, 134,   0, 140,
-131,  90, 141, 134,  12, 140,  12, 140,  90,  90, 140,   3,   1,   1, 140,
- 12, 131, 131,   3,   3, 143,   3,  13,   3,   0, 141, 143,   6,   0,  90,
-  1, 141, 141,   0,  13, 131, 140,  90, 134,  12,   3,  15,  12,   0,   0,
-  3, 134,  90, 141,   0, 131,  12, 128, 131,  13,   0, 128, 140,   6, 141,
-131, 134,  15, 140, 143, 140,  13,  12,   3, 134, 131,  15,  12, 134,   6,
-131, 129,   3,  90,   6, 143,  15,  12,   6, 131, 128,   1, 143, 140, 143,
-  0, 131, 131,   3, 141,  12, 143, 141, 129, 143,   6, 143, 140, 131, 131,
-140,   3,   0,  12,  12,   0,   6, 140,   0,   6, 134, 131,  15, 143,   0,
-  0, 141,  12, 143, 140,   3,   1, 141,  90, 143,   3, 140, 131,  12, 131,
-134, 134, 140,   3,   0,   0, 143,   0, 128,   6, 131,   0, 134,   3,  12,
- 15,   3, 134,  15, 140,  12, 141,   1, 143,  13,  15,   3, 255, 140,  15,
- 12, 134, 134,   0,  12, 141, 143,   0,  12,  12,  90, 143, 140,   0, 131,
-  6,  90,   6, 128, 140, 143, 129,  90,  90,  12, 129,   6,   3,  12, 140,
-  6, 131, 140,   0,   6,   6,   6,  90, 141, 131,  12,  90, 134,  15, 131,
- 90,   6,  90,   6, 140, 128,   0,  12, 134, 141, 134,   6, 143, 140, 140,
-143, 140,  13, 143, 134, 128, 140,   3, 134,   0, 134,   6,  12, 140,   6,
-  3,   6,  12,  12,  12,  90,  90, 255,   0, 141,  12,   1, 129,   0,   1,
-134, 140,   3,   1,   3,   0,  15, 140, 140,   1,  13,  12,  12,  90,  90,
-  1, 140, 140, 131, 128,   3,  12,   0,  90,  15, 131,   0, 134,  12, 131,
-128,   6,   0,   6,   6, 134,   1,  15, 134,   3,   1,   6,   1,  90,  12,
-  1,  12,   3,   0, 131,   3, 141,   1,   0,   1,   0,   1,  12, 129, 140,
-134, 134,   0,  90, 128,   3,   3,   3, 140, 141, 141, 140, 140,  90,  12,
-140,   1, 131,   1,  15, 143,   6,  90,   0,  90,  13,  12,   1, 143,  90,
- 12,   6,  13,  90,  13, 143, 140, 134,   1,   3,  12,   0,   1, 131, 129,
- 15, 140,   6, 131,  90,  15,  90, 131,  12,  90,   0,  90,   1,  90,   6,
-  0, 131,  12,   0,  12, 140,   3,   3,  15,  12,   1, 128, 131, 141, 131,
-128,  15,  13,   6, 141,   0,   1,   6, 141,  12, 131, 128, 134, 143, 143,
-141,   0,   0, 143, 140,  13,  12,  12,   0,  12,   0, 143,  12,  12, 140,
- 12, 143, 141, 141,  12, 141, 129, 143,   1,  12, 134,  12,  90,   6, 143,
-143,  12, 134,   3, 143, 131,   3,   6,  13, 143, 140, 129, 141, 134,   3,
-128, 134,  12,  90, 140,   3,  90,   6,   3, 134, 131,   6,  12, 140, 129,
-  3,   3,  15,   1,   1, 140,   6, 143,  90, 134, 128,   6,  90, 134, 141,
- 15, 140,   1,   0, 134,   6, 131,  12,  90,   3, 129,   3, 131, 140, 128,
-  6, 143, 134,   6,  15,  13, 131, 131, 131, 143,   3,   3, 131,  12, 140,
- 13,   1,   3, 134, 140,  12, 131, 143, 131, 131, 141, 143,   1,  12,  90,
-131,   3, 128, 134, 141,  12, 143,   3, 141,   3,  12,   6,  15, 134,   3,
- 12,  15,   6,  12, 134,  90, 131, 143, 128,   3,   1, 143,  90,   1, 140,
-  0,   6,  90, 134,  12, 140, 140, 140,  12,  12, 129,  12,   0,   1, 128,
-140, 143,  90, 140,  90,  90,   6,   6, 140, 140, 140, 134,   0,   1, 134,
-128,   0, 140,  15,   1, 134,  13, 141, 141,   6,   0,  15,  13,  12,   1,
- 13,  90,   0,  90, 141, 134,   1,  12,  12, 143, 141, 140, 131, 141, 143,
-  1,   6,  90, 143, 134,   0,   3,   3,  12, 131,  90, 134,   1, 134, 131,
-  3, 128,   6, 134,   3,  13, 131,  12, 129,   1,   6,  13,   0,  12,  13,
-  0,  15,   3,  12,   0, 143,   1, 140,   1, 131, 129,   6, 131, 134,  90,
-143, 143, 134,   0, 143, 141, 134,   0,   0, 129,   6, 143,  90,   0, 143,
-140, 128, 141, 134,   6,   6,   0,   3,  90,   1, 141,  12,   6,  12,   6,
- 12,  90, 134,  90,   6,  12,   1, 141,   3,   1,  90,  90, 131,   3,  15,
-  0,   1, 143, 141, 134, 140, 134, 141, 129, 140,   6,   6,   6, 134, 128,
-  0,  12,  90,   0,  12,   3,  12,  12,  15,   3,   6,  12, 134,  12, 141,
-131, 143,   6,   0, 128,  90,   1,   6,   6,   6,  90,  12, 141,  90,   6,
-140, 141,   1,   0, 131, 141,  12, 140, 131, 140, 134,  90, 134, 141,  12,
-  6,  90, 129,  90, 131,   6, 131, 134,   6, 140, 141, 141,  90, 134,   3,
-140,   6, 134, 134, 131,  12,  13,   3,  12,  90,  90,  13,  12,  15, 131,
-  0, 129,  12, 140, 143, 131,  90,  12,  90, 128,  13,   6, 141, 141, 141,
-143,  90, 141, 129, 129, 131,   1,   1, 140,   1,   3,  90,   1, 134,   6,
-134,  13, 131,   0, 131, 131,  90, 131,  12, 140,   3,  12, 131, 134, 134,
-  0,   0, 134, 129, 129,  12, 131,   6,  12,   6, 131, 140,   6,   0,   1,
-141, 141, 134, 134, 131, 128,   0,   1,  12,   1,   0, 134,  90, 143, 141,
-140,   6, 140, 134,  15, 141, 128,   1,   1, 141,   6,   1,   6,  12, 143,
-128, 134, 143,   1,   1,   6,   6,  12,  15,  12,   1,  90,   1, 143,   3,
- 90, 134, 140,   0, 141, 134,   3, 128, 131,   3,   6, 134, 134,   3, 143,
-  3,   3,  90,  15,   1,   6,   1,  12,  90,  15, 140,   1, 141,  12, 134,
- 12,   6, 141,   6, 134, 128,  15, 140,   0, 131,  13,  12, 141,  90,   6,
-  6,  90, 140,   3, 131,   1,   6, 143, 128,   6,  12,  12, 141,  13,  90,
-140, 141,   3,   6,  90,   6,   1, 129,  12,   0, 141,  90,  90,  12,  90,
- 12, 143, 134,  15, 143,   6, 134, 141, 143, 140,  90,   1, 143,   3,  12,
-129,   1, 141,  90,  13,   0, 141,   6, 134, 134,   0, 131, 134,   6, 141,
- 90, 141,  90, 143, 140, 141, 143,  15,   1,  90, 141,   1, 134,   1, 141,
-  6,  15,  12, 140, 134,  13,  12, 141,  13, 131, 134, 141,  90, 143, 134,
-128, 143,  12,  90,  12,   1,   0,  15,  13,  90, 128, 141,   6,  12,   1,
-  1,  13,  12, 143,   6, 134,  90, 141,  90,   1, 134,  12,   6,   6,  15,
-131, 134,   0,   6, 141,   0,   6,  12,   6,   1, 129, 141,  15, 131,  90,
-  6,   6, 140,   0, 134,   6,  90,   0,   6, 140, 134,  90,  90, 141, 140,
-143,  12,   3, 134, 141, 129,  90,   6,  90,   1,  90,  12,  90,  90, 141,
-134, 140,   6, 129,   1, 129, 143,   0, 140,   1, 134,   3,  90,   3,  90,
-  0,   6,   3, 141, 141, 134,   3, 134,   6,  90,  90, 134, 128,   1,  12,
-128, 129, 129,   6,   1, 141,   1, 143,  12,  13,   1,   6,   1,   3, 131,
-  3,   3,  12, 140,   1, 134,   1, 131, 134, 131,  15,  90, 141,   1,   6,
-  6,  12,   6,   1,   1,   6,   1,  15, 140, 131, 141,  90,  15,   6, 131,
-  1,   1, 134, 131,   6,   1, 141,   6,  12, 141,   6, 141,   6,  13, 131,
- 12,  90, 129,  13,  13, 131,   6, 143, 143,   0, 140, 141,   6, 134,   1,
-  6,  13,  90,   6,   3, 131,   6, 143,   0,  90, 140, 140, 134,   6, 129,
-143, 143,   6,  90,  15,   6,  13, 134, 134, 143,  15,  90,   1,  90,   6,
-141, 143,  12, 141,   0,   1,  12,   3,   1, 131, 141,   0,   1,   3,  12,
- 90,   6,   6,   6,  90,  90, 131, 129, 131,  12,   0, 131, 129,  90,   1,
- 90, 131,   1, 134,   1, 141, 134, 143,   1, 128, 129,  90, 131,  90, 134,
-141, 141, 134,  90, 141,  15,   1,   6, 134, 143, 143,   6,   6,  90, 141,
-  0, 131,   6,   6, 129,  13, 141, 140,   1,  90,   6,   1,   1,  13,   6,
- 12,   6, 134,  90,  90,  13,  12,  90,  90,  12, 140,  12,  12, 134, 129,
-141,   6, 129,   1, 141, 134, 143, 141,   1,  12,  90, 143,  12,   6,   0,
- 12,  90, 141, 141,   0,  13, 141,  12,   1, 129,   0,  12, 134,   1, 134,
-134,   6, 134,  12, 140,  12,   3,   1, 140, 141,  12, 134,   6,  13, 129,
-  1,   6, 131, 134,   1,   6,   1,  12,   1,   6, 131,  15, 141,  90,   6,
-128,  90,   6,  90,  90,   6,  12,   6, 141,   1,   0, 129,   1,  90,   1,
-131, 134,   6,   1,   3, 129,   1, 140, 131,   1,  90,   6, 143,  12, 143,
-141, 141, 129, 140,  13, 131, 143, 141,   6,  90, 131, 134,   6, 129, 131,
- 90, 134, 141,  90,  90,  13,   1, 141,   1,   1,   3,   1,   1, 134,   6,
- 90, 134,  12,   3,  13,   0,   6, 141,   3,   6, 134,  90, 131,  90,   6,
- 15, 134,  90,  90,   6, 129,  13, 134,  90, 143,   6, 141,   1,   0,  90,
-  1, 134,   1, 141,   6, 140, 129,   6,   1,  12,   6, 141, 141,   1,  15,
-143, 131,   3, 131,   6,   1,   6, 131, 140,   6, 140,  90,  13, 128, 140,
-143,  13, 134, 141,   6, 129, 141, 143,   0,  90, 143, 128,   6, 141,   1,
-129,   0,   6,   1,  13,   6,   1, 141,   6, 131,   3,   0, 128, 140, 141,
-134,  90,   1, 141, 134,   1,   3, 129,   1,  90,  12,   1, 128,   1, 128,
-128, 141, 141,  13,  12,  12, 128,   1,  90,   1, 131,   6, 128,   1, 134,
-  0,   1,  15,  90, 141,   3,  15, 134,   1, 131, 128,   1,  90,   6,   6,
- 90,  90, 141, 141,  15, 128, 134,  90, 134, 141, 134,   6, 129, 140,   1,
-140, 134,  15,  12, 134,   1, 131, 134, 134,   6, 134,  12,   3,  90,  12,
- 13, 140, 141, 134,   1,   6, 134, 128, 134, 134,   6, 134,  15,  12, 140,
- 13,   1, 134,  13,   6,  90,   1,   6, 134, 128,   3, 134, 143, 129, 134,
-  3,   6,  13,   1,  90, 128,  90,   6,  90, 128,   6, 141,  12,  90, 141,
-  6, 141, 134, 141,   1,  90,  90,   6, 141,  90,  90, 141, 141,  90,   0,
-  6, 143,  13,   6, 128, 134,  12, 131, 140,   1, 131, 134, 140,   6,  90,
-  1, 134, 131, 140, 134,   6, 141,   6, 140, 131,  90,   1,   6, 129,   6,
- 12,   6, 134,  13,   6, 134,  90,   6,  12,  12, 131,  12, 141, 141,   1,
-  6, 134, 134,   1, 134,   1,   6,   6,  90,  90, 131,   1, 131, 134, 134,
-  6,   1,  15, 134, 128,   1, 141, 134,  90, 141,  90, 141, 141,  12,   1,
-141,  90, 143,  90, 134,   6,   6,  90,  90,   6,   1,  90,   6, 134,  90,
-141,   1,  90, 134, 134, 134,   1,   0,  12,   1,  90,  13,   1,   0,   1,
-  1,  15,   6,   1,   1, 141, 141, 134, 141,   1,   6,  90,   6, 141, 129,
- 13,  15, 143,   1,   0,   6, 141,  13,  90,  15,   1,  90, 134,   1, 141,
- 90, 141,  90,  13, 140,  12,   1,   6, 141, 128,  12, 134, 141,  12,   1,
- 90,  90, 134,  90, 131,   1,   1, 131,  90,   6, 128, 131,  90,  12, 134,
-141,  90,   6,  90,   6, 140,  12, 141, 141,   6,  12, 131,   6,   6, 134,
-141, 129, 131,  13,  13,  90,   1, 131, 141, 134,   1,  13,   6,  90,   6,
- 13,   6,  90,   1,   1, 143, 141,  13, 141,  12,   1,  90,  90,  90, 141,
-134,  13,  90,   1,   1, 140,   3, 131, 129,  13,  90,   1, 134,  90,  13,
-134, 141,  12, 141, 131,  90,   6,  90,   1,  15, 141, 131,   3,   6,   1,
-134,  13,   6,  15,  13,  90,   1, 141,  90, 128,  90, 141,   6,   6,   6,
-  6, 141,  90,   6, 134,  15,   6,   6, 134,   6,  12,  13, 129,   6, 134,
- 90,  90,  90, 134, 128, 134,  12, 141,  15, 141,   1, 134,   6,  90, 134,
-  1, 141, 143, 141,   6,   1,   6, 134,   6,   6,  90,   6,   1, 141,   1,
-  1,  15,   6,   1, 129,   0, 131, 128, 141,   0,   1, 131, 141,  12, 129,
- 90,   6, 134,  90,   6, 131, 134,  13, 141,  90, 134,  12, 134, 141, 129,
-141,  90, 134, 141, 131, 128,   6,  90,  13,  90, 141, 141,  90,   6,   6,
-141,   1,   1, 129, 141,  12,  12, 128, 141,   1, 141,   1, 140,  13, 134,
-134,  13, 134, 134,   1,   1,   1, 134, 141, 134,   1,   6,   6,   6,   1,
-134, 134,  90,   6, 134, 131,   1,   1,   1, 128,   6, 128, 129,   6,   1,
-  1,   6, 128, 128, 129,  90,  90,  90,  15,  12,  90,   1,  90, 141, 141,
-  1,   6,  13, 134,  90, 141, 141,  13,  90,  90, 141, 134, 134,  90,   1,
-141,  12,   6,   6,   6,  90,  12,   6, 131, 134, 141, 129, 141, 134,   6,
-129,   6, 134, 134,  15,  90, 131,  90, 143,   1,  90, 141, 131,  90,   6,
- 90,   6,   6, 128,  90, 134, 134,  15, 129, 129, 141,  90, 134, 129,  90,
-134,   1, 128,   1, 141,   1, 143,   1,   1,   6,  12, 134,   6,   1,   1,
-134,  90,  90,  13, 131, 141,   1, 141,   1,   6,   6,   1,  12,   6, 134,
-  6,  13,  90, 131,   6,  90, 134,   6,  90, 134, 129, 134, 134,   6,   0,
-131, 129, 134,   6, 141,   6,  90, 134,   1, 134, 141,   6,  90,   6,  90,
-  6, 141,  90, 141, 131,   6,   1,   6,   6,   1,   1,  15,   1,  90,   1,
-  6,   6, 131, 141,  90,   1,   1,   1, 134, 141, 131, 129, 134, 128,   1,
-  6,   6,  90, 134, 131,  13,   1,   1,   6,   1, 141, 131,  90,   1,  15,
-  1,  90, 131, 141, 134,  15,   1,  90,  13, 134, 129, 134, 141, 134,  90,
- 90,   6, 141,  15, 129,   1,   6,   1, 129,   6, 141,   1, 134,   6, 134,
-129,   6,  90, 141, 141,  13,   6, 134, 128, 141, 141,  90,   1,   6,   6,
-141, 134,   1, 141,   6, 134,  90,   1,   6, 141,  90,   6, 141,  90, 134,
-135,  13,  90,  13, 134,  12,   6,   1,   1, 134,  12, 134,   6,  90,   1,
- 15,  90,  90,   1,   6,  13,   1,  13,   1,   1,  12,   1,   1, 141, 134,
- 90,   1, 134, 141, 141, 141, 141,  15,   6, 129,  90, 134,   1,   1,   1,
-  1,   6,  90,   1,   1,  90,   4,   1, 141,   6,  13, 141,   6, 141, 128,
-  1,   6,  88, 128,   6, 134,   6, 129, 129,   6, 141,  13, 134, 141, 134,
-141,  90,   6,   1,   6,  90,   6, 129,   6,   6,  88, 141, 129, 134, 134,
-  6,  13,   1,  91, 141, 134,  13,   1, 134,   1,   6,   6, 135,  90, 131,
- 90, 131, 141,  15,  90,   6, 134,  90, 128,  13,  90,   6,   6, 129,   1,
-  6,  13,  15, 134, 135, 128, 129,   1, 135,   1,  90,   1,   1,   4, 134,
-  6,  90,   1, 129,   1, 141,  12,  12,   1, 134, 134, 128, 141,   6,   1,
- 13, 129, 141,   6,   6, 129,  13,   1,   6, 134, 131,   1,  90,  13,   1,
-  6,  90,   6,  90, 134,   6,  12, 141, 135, 135,   1,   6, 134,  90,  90,
-141,   1,   6, 129,  13,  13, 134,  90, 141, 134, 131,   6,  90,  90,   1,
-129, 141,  91,   1, 128, 134,  90, 141, 134,   6, 134,   1,   6,   4,   1,
-  1,   1, 141,   1,  90,  90,   6,   6, 141,   6, 131,  90, 141, 134,  90,
- 13,   1,  91, 134,   1, 134,   4, 134, 141,  90,   6,  90, 129,   1,   1,
- 90,  90,   6, 128,  12,  15,   6,   1,   6, 129,   6, 141,  90,   6, 134,
-131,  90,  12, 129, 131, 134,   1,   6,   1,  12,   1,  13,   1,   6,   6,
- 13,   1,   1, 141,   6,  12,   6, 134, 134,   6,   6,   6,   1,  13,  15,
-141,   1, 141, 134,  13,  90,  90, 134,  12, 141, 134, 134,   1,  90,   1,
-141, 131,  90, 134,   6, 134,   1,  12,   1, 134,  15,   1,  12,   1, 134,
-  6,  15,  90,  90,  13, 131,   6,  13,  90, 134,   6,  13,   1,  13, 128,
- 90,  13, 134,   6,  91,   1,  12, 134, 141,   1,   6, 141,  91,  91,   1,
- 90,   6, 134,  90,  90, 141,  90,  90,   6, 141,   1,   1, 134,   1,   1,
-134, 134,  90,   1,  13,   6, 128,   6, 134, 134,  91,  90,   4, 141, 134,
- 15,   6, 141,   6,   1, 141, 141, 129, 141, 141,  90, 134,  90,  15,   1,
-128, 141,  90, 141,  13,   1,   1,   1,   6, 129,  88,   6,   6, 129,   6,
-129,   4,  13, 135, 134, 134, 135, 141, 134, 141,   6, 129, 134,   1, 134,
- 15,  13,  90,  90,  12,  15,   6, 129, 134, 141,  91,  90, 134,   6,   1,
- 15,  90,  12,   6,   6, 134, 129,   4,   6, 134, 135, 134,  13, 141,   6,
- 90,  88, 131,   1, 134, 141, 141,  90,  12,   6,   1,  90, 131,  90, 141,
-134, 141, 129,   1, 134,  12, 134,   6,  91,  90, 135, 129,  13, 129, 135,
-141,   1,   6, 134,   1,   1,  90, 141,   6, 134, 131, 141,  13,  90,   1,
-  6,   6,   6,  91,  15, 134, 134,  13, 141, 129,  13,   6,  90,   6,   6,
-135,  91,   6, 134, 134,  88,   6,  90, 141, 128, 141, 141, 141,  13,  90,
-  6,   1,  90, 141,   4,   6,   1,   1,  90,   6,   6, 134,  90,   6,  90,
- 90,   1, 129,   6,  90,   1,   6, 134,  13, 134, 141,   1,   1,  15,   1,
-134, 129,  90,   6, 141,   6, 141,  90,  13,  13,   4, 129,   6,  88, 134,
- 90, 128, 134,   6, 134,  90,  90,  13, 141,  90,   1,  91,  90,  15,   1,
-134,  12,   6, 141,   1, 134,   6, 128,   1, 141,   6,   6,   6,   1,  90,
-  1,   6,   6, 141,  90,   1,  90,  13, 141,  90,   1,   1,  90, 141, 128,
-134,   1,   6, 131, 128,  88,  88, 134,   6,   6,  90, 141, 141, 255,   1,
-134,   6,  90, 128, 134, 255,   1, 129,  90,   4, 135, 134,   6,   4,  15,
- 13, 129,   6, 134,   6,   6, 141,  13,   6,   6,   1,   6,   1, 141,  90,
-134,  90,   1,   1, 129,   1,   6,  15, 141,  90, 141, 141,   6,   6,  90,
-  6, 134,  13,  90,   1,  90,   4, 134, 141, 129, 135,  90,  91,  91, 141,
- 90,  12,   6,   4,  15,  13,  90, 134,   1,  90,  90,   1,   1,  90, 141,
-  6, 141, 141,   1,   1, 134,  90,  88, 135,   6,  90, 141,   6,   1,  90,
-  6, 134,   6, 134,  90,   6, 135,  90,  88, 134,   6,   1,  91, 141, 141,
- 15, 141, 141, 129,   1, 134, 141, 129,  90,   6, 131, 129,   6,   6,  13,
-  1, 134,  90, 141,   6,   4,   6,   1, 134,  13,  13,   1,   1, 135,  15,
-  1, 141, 134, 129,  90,  91, 141, 134,  12, 141, 135,  91,  13, 129,   6,
-  6,   1,   1, 141, 141,   4,   6, 129,   6,   1, 134, 128, 134,   6,   6,
-129, 134, 128, 141, 141,  88,   6,   6,  91,  90,   6, 134,   6, 141, 134,
- 12, 134,   6, 129, 134,  13, 141, 141,  13, 134,  90,   4, 129,  90, 134,
-  6,  88,   4,  90,   6,  13,   6,   4, 135,   6, 129, 129, 134,  88,   6,
-  1,  13, 134,  90,   1, 141, 135, 141,  13,  88,   6, 134, 134, 135,  90,
-134,   6,  90,   6,   6,   1, 135, 134, 141, 134,  91,   1, 141,   1,   6,
-135,  15, 134,  13,   1,  88,  91,  13,  91,   6, 129, 129,   6,  13,  90,
-134,  15, 134,   6,  90,  88, 129, 134,   6,   1,   6,  90,  90,   6,   6,
-  6, 134,   1,  15, 134,  90,   1,   4,   1,   1, 141, 134,  91,  13, 141,
- 90,  90, 134, 141, 134,   1, 141,  13,  13, 141,   1,   1, 141, 128, 134,
-134, 134, 134,  90,   6,   4,  90,   1, 134,   1,  13,   1,   6,   1, 141,
- 15,  90,  90, 134, 141, 128,  13, 131,   6,  90,  91,  90,  88,  88,  90,
- 13, 134, 141,  90, 129, 129,   1,   6,  13, 134, 135, 129, 134, 134,  91,
- 91, 135,   1, 141,   1,  15,   6,   6,  15,   1,  90,   1,   6, 141, 134,
- 91, 134,  15,   4,   1,  90,  88,  91, 134,  91,   6,  91,  13,  15, 141,
- 90, 134, 135, 134,  13, 141,   1, 129,   4, 134,  13,  91,  90,  90,  13,
-  6, 135, 134,  90, 129, 128,  90, 129,  13,  13,   1,  13, 129, 129,  91,
- 90,  90,  13,   6,   6, 129,  90, 134,  13,   1,   4, 134,  90,   6,   6,
-134,  88,  90,  91, 134,   1,   4, 135,   1, 134,   1,   1,   4,   6,   1,
-  1,  88,  13, 134,   1, 134,   6,   6, 134, 141,   6, 141,  90,   1, 135,
- 90,   6,  88, 134, 128,  90,  15,   6,   6, 135,  88, 129,   6,  91, 129,
- 90, 134,   6,   6,   6, 141,  90,  90,   6,   6,   4, 134,  13, 141,   6,
-  6,   4, 129, 141, 134,  90, 135, 134,   1,   1, 134,  88,   4,   6, 129,
-135, 134,   1, 141,  88, 135,   1,   6,   6, 129,  91,  13, 134, 135,   6,
-135,  90, 134,   6,  90,   6, 134,   6, 134, 134,  91,   6,   1,   1,   1,
-134,   1,  88, 135,  91,  13, 134,  13, 134, 129,   1, 129,  90,  13,  90,
-  1,  91,  13, 129, 129,   6, 132, 128, 134, 129, 141, 141,   4,   1,  91,
-132,  90,  91, 141,   1, 141, 132, 135,   6,   4, 135,  90,   1,  91,  13,
- 88, 141,   6, 141,   6,   6, 134, 129, 134,  15, 134, 135,  13,  91,   4,
-  4,   4,   6, 128,   1, 134,   4,   1,  90,   6,  88,  90,   1,   6,   6,
-  7, 141, 129, 135,  13,  13,  13, 129,   1,   6,  91,   1,   4,   6, 141,
- 91, 135, 129, 141,   6,   1, 141, 134,  13, 134,   1, 135, 134,   1, 134,
- 91,  91,   6, 134,   6, 134,  90,  90,   1,   7,  90,  13,  90,   6, 135,
- 88,   4, 129,   1, 129,   6,   6, 128,   4,   1,  90,   6,  91, 141,  88,
- 90,  91, 134,   4,  90, 129, 129,   4,  90,   1,  13, 141,   6,   4,  13,
-135,  13, 128,   6, 134, 141, 134,  90, 129, 135,  13, 129, 141, 129,  13,
-134,   4,  91, 134, 129,  91,  90,   4,  91, 134,   6,  88, 141, 134, 141,
-  6, 134,   1,   6,   6, 141, 134,  91,   6,   1, 128,  91,   6,  15,   6,
-  6,  15, 141, 141,  90,   4,  90,  90,   6,  88,   6, 141,   1, 134, 134,
-134, 141,  13, 134, 135,   6,  15,  91,  13, 135,  15, 134, 141,   1, 134,
-  6,   1,  91,   6, 128, 134, 141, 134,  91,  15,   1, 134,  90, 134, 134,
-135, 135,   6,   6, 129,   4,   7,   6,  90, 129, 128,   4,   4,   6,  90,
- 91,   1,  88, 134,   6,  15, 129, 129,  90, 135,  90,   6,   6,  90,   6,
-141, 134,  90,  90,   6,   1,   4, 129,   1,   6, 141, 141,   1,  91, 141,
-141, 255,  90,   7,   1, 135,  88,   6,   4,  13, 135,  88,  15,  13, 135,
-129,  13,  88,   6,  90, 129,   6,  90,   6, 134,  13,   6,   1,   4,  13,
-134,   1, 141,   1,   4,   6, 135, 135,   7, 141, 129, 135, 135,  90,  90,
-  1, 135, 134,  88,   1,   6,  90,  13, 135, 134, 134,  90, 135,  88,   6,
- 88, 141,  91,   4, 141,  90, 134,   1, 134,  90,   1,   1, 134,   1, 135,
-135, 141,   1,   6,  88,   1, 129,   4, 134,   4,   4, 135,   6,   1,   6,
-135, 129,   4,   1, 134, 135,   6, 134,  91,  91,  13,  88,   6, 128,  13,
- 13, 141,  91, 135,  90,  13,  88,  91, 135, 134,   1,  88,  13,  15, 141,
- 90, 134,   6, 129,  13,  90,  13,   4, 134,   6,   7,   4,   1,  15,  13,
- 90, 129, 134,   4, 141,  15,   1,  91,   1, 141, 134, 132,  88, 129, 129,
- 13, 134,   1, 134,   6, 134,  13,  88,   1,  13, 141,  90,   6, 141,  13,
- 90,   4,   7,  13, 141,   1,   1,  13,   4, 132,  91,  13,   4,  90,  90,
- 88,   4,   1, 128,  91, 135, 141, 134,  90,  13,  13, 134,   4, 135, 135,
- 91,   4, 141,  13, 141,   4,  88,   1,   7, 134, 135, 135, 134, 134,   6,
-  6,   1,  91, 135,   4, 129,  91,  15,  91,  13,   6,  88,  90, 135,  91,
-134, 129, 135, 129, 129,  90, 135,  15, 134,   6,   4,  13, 134,  15,   6,
- 13, 129,  13, 132,  88, 128, 141, 135,  15, 135,   6, 134,  91, 128,  13,
- 90,   1,   1,   1,   6,  15,  90,  90, 141, 129,  13,  91,  13, 129, 135,
-128,  13, 129,  88,  13,  90,   1,  90, 134,   1,  90,   6,   6, 134,  15,
- 88,   6, 132, 129, 134, 134,   4, 135,   6,   1, 134,   6,   6, 135,  13,
-135,   4,   6,   1, 134, 141, 134, 134,  91,  13,   6,  91,   4,   6, 135,
-134,  13,   6,   6, 129,  91,  90, 129,  91,  90, 129, 134,   4, 129, 132,
-  6,   4,   4,  90, 135,   7,   4,  90,   6, 132,   6,   6,  90,  91, 141,
-128, 134, 129, 129,  88,  91,   6,   6,   1,  91, 141,   1,  91,   1,   4,
-  4,   6,   1, 141, 129,   6, 135,  15,  91, 135, 141,  91,  13, 141,  88,
-134,  88,   4, 141,  91,   4,  90, 141,   1,   6,  15,   6,  13, 128, 132,
-  4, 135,   4, 141,  88,   7,   1,  15,   1,  13,   4, 134, 135,  13,  88,
- 88,  91,  13, 134, 141,  13,   4,   1, 135, 134,   1, 141,  13, 135, 128,
-134, 129,  91,   4,  15, 129,  88, 134, 128,  90,   4,   1, 128,  88, 134,
- 90,  91, 134,  91,   4, 128, 141,  13,  88,  91,   7,   1, 141, 135,  15,
-135,  13, 141,  13,   4,  91,  15, 134, 135,   4,   7,  91, 129,   4,  88,
-  1, 134,   1,  13, 134,  13,  90,   4,  91, 129,   6,  91,   7,  88,   1,
-  7, 135,   6,  13,  88, 135, 134, 134,   6, 135,  91,   4,   6,  13,   1,
- 13, 135, 129,   7,   1, 141,  88, 135,  88, 135, 141,  88, 141,   4, 128,
-134,  90,   6, 135,   1,  90,   6,  13,  88, 141,   4,  91,  90, 134,   1,
-129, 135,  91, 141,   4, 141,  88,  13,  91,   4,  90,   6,   1, 132,  13,
- 90,   6,   7,   1,   1,   6,   7,  90,   6,  91,  90,  90,  13,   1,   6,
-  4, 128, 141,   6,   6,  90,   6, 135, 135,  90, 129, 141,   4,   4, 132,
- 91,   4, 134, 141, 129, 134,   6, 134,   4, 135, 129,   4,  88,  13, 128,
- 88,   4,   4, 132, 129,  90, 129, 132,  88, 134, 135, 141,   6,   6,   4,
-129,   4,  13,  88, 134,  88,  90, 135, 135,  88,   1,   1,  91,   4,  15,
- 13,  88,   4,  91,  88, 141,  88,  13,   6,   4, 129,   6, 129, 135,   4,
-134,  91,   4, 135, 135,   6,   1, 134,  88,  90,  13, 135,   6,   6,  91,
-  7,   1, 134,   6, 134,  13, 134,  91, 134,   4,   7, 141,   4,  91,  91,
-  1, 135,  15,   7,   1, 135, 128,   1,  13, 141, 135,  90,  88,  88,   4,
- 13,   6, 134, 132, 135,  91,   4, 135, 135,  88, 141,   6,  88, 129, 135,
-134,   1,  15, 135,   6,  88,  91,   1, 135, 129, 134, 129,  88,  88,  91,
- 13,  88,  90,   4,  91,   4, 134,  88,  91,  91,  91, 134, 132, 135, 134,
- 90, 129,   6, 141,   6,  13, 134, 128, 132,   7,   7,  91, 135,   7,  15,
- 91, 135,   7, 135,   6,   1,   6, 134,  90,  91,  91, 135, 141,  88,   4,
-  6,  91,  91, 134, 132, 135,   6,   4,   1,  13, 134,  15,  91, 134, 134,
- 13, 129,   1, 129,   7, 134, 129,  88,  88,  90, 129,  91, 128, 132, 141,
-  4,  91,  13,  90,   1, 128, 129,   4,   4, 134, 129,  91,   1, 129,  91,
- 90,  90,  13,   4,  88, 129, 134, 135,  91,  88,   4,   6,   6,   7,  88,
-  4,  90,  88,  91,   4, 141,  91,  91,  13, 134,  91, 132, 135, 135,   4,
- 91,  91,  88,   7,  91,   4, 135, 141, 134, 141, 135,  15,   7,   6,  15,
- 15, 135,   1, 132,  88,  91, 135,   7,   4, 132,  91, 141,  91, 129,  91,
- 91,  13,  91,   6, 135,  13, 129,  90, 135, 132,   1,  88, 135,  88,   6,
-134,   4,  91, 135, 141, 132, 141,  88,   4, 132, 135,  91, 135,  13, 135,
-128,   6,  90, 132, 135,   4,  91,  88, 134,  90, 134, 141,   4,   4, 129,
-135,  90,  88,  90, 128, 135,  91,  91, 141,   4,   4,  13, 129,  15, 129,
-135, 129,  88, 134, 135,  90, 135,  90, 132, 134,   4,   7, 134,  88,   1,
-129,   7,  90,  88, 135, 134, 132, 134,   6, 132, 129,  91,   4,  88,   7,
-135, 134,   6,  90,  88, 128, 129, 129,   6,  13,  91,  91, 129, 129,  13,
- 13, 132, 134,  13,  13,  91,  91, 135,  13,  91,   1, 134,  91,   6,  91,
-129,   4, 141,  13, 141,  91,   7,  88,   1, 134,   1,   6,   6,   6,  90,
-129,  88,   1,  13, 135,   6, 135, 135,  13,  13, 141, 141,  13,  13, 134,
- 88,  91,   4,   4,  91, 129, 132, 141,   1,   1, 129,   4, 135,  13, 135,
- 91, 129,  13,   7,  88, 129, 129,  88, 141, 129,   7, 135,  13,   4,  15,
-  7,   1, 135, 135, 135, 141,  13,   4, 135, 128, 132, 132, 134,   6, 134,
- 15,   1, 141, 132, 129, 135, 134,  91,   6,   7,   4,  13,   7,  91,  88,
-  7,   4,   4,  90, 132, 141,   4, 135,  90, 135,   6, 141,  91,   4,   1,
-  4,   1,   1, 135,  91,   4,   4, 135,  88,   4,   7,   6,   4,  91,  91,
-  7, 129,  91,   7,  91,  13, 135, 132,   7, 132, 128,  91, 134,  91, 141,
- 88, 135, 132, 132,  13, 132, 134,  90, 135, 135,  90, 135,  90,  91,  13,
-  1,  90, 128,   6, 141,  91,   1,  88, 135,   4, 135,  91,  88, 128, 128,
-132,   1,  88, 135, 129,  91,  91, 135, 129,  13,   6,   7,  13,  88,   6,
-  4, 134, 129, 135,   7,  91,  88, 134, 134,  91,   4,   1, 129,  15,  91,
-  1,   4,   6,   4,  88, 132,   1,  91,  88, 135, 135,   1,  91,  91,  91,
- 91, 132, 129, 134, 135, 128,   6,  91, 128, 134,   6, 129,   7,  91,  91,
- 91, 141,   6, 135,   4, 141,  88,  88, 134,  88,  91,  91, 132,  88,  91,
-  7,  13,   4, 129, 129,  15,   4,   4, 132,  88,   4,   4,  88,  88,   7,
-  4,  88,   1,   6,   7,  88,   6,  88,  88,  91,   6, 129,   6, 129,  15,
-  4,  13,   4,  91,  15,   1, 141,  90,   4,   6, 141,  91,   4,  88, 141,
- 88,  13,  90,  91,  88,   4,  88,   4,  91,   7, 135,   7, 129,   4,  13,
-132,  91,  90, 141,  91, 129,   4,   6,  15, 135,  91,   4, 132, 135, 141,
-129,   7, 128,   6,  15,   4, 135, 135,  88, 129,   4,   7,  88,   7, 132,
- 88,  15,  90, 141,   7,  15, 135, 129,  91,  91, 135,  91,  90, 134,   4,
-128,   4,   7,  13, 135,  15, 132,   7, 135,  13, 132,   1,  13, 141, 129,
-  4,  90, 141,  91,  88,  88, 135, 135,  13,   1,   1, 135,  91,  13,   7,
-135,  91,  91,  88,   7,  88,  91,  13, 129,  13, 134,  91,   6, 135,   1,
-  7,  91, 135,  91, 134, 135,  13,  13, 132,  88,   7,   7, 128, 135, 129,
-134,   4,   4,   4,  91,   1,   4,  13,  91,  88,   6, 132,  91, 135,  13,
- 91,  88,  15,   7, 134,  15, 141,  88,  88,  88,  91, 141,   4,   6,  91,
-  4,  15,   1, 135,  91, 129,   4,  90, 141,  91,  91,   4,   4, 132,  88,
-  4,  88, 135,   6,   7,  13,   7,  13,  88,  90,  91,  91, 128, 141, 135,
-134, 128,  91,  13,  13,   7, 135,   4, 135, 135,  91,  13,  91,  91,   7,
- 13, 255, 135,  90, 135, 135, 135, 135,   4,  88, 135,  88,  91,  90, 135,
- 13,  88,  90, 135, 134,   4,  91,   1,   4,  91,  91,  91, 132,   1, 135,
- 88,   4,  91,   4,   6,  13, 135,   4,   6,  88, 134, 141,  91,  88, 132,
-141, 135,  88,  91, 135, 135,  91,   4,   4, 134,  91, 132,  13,  13, 134,
-135,  88,  91,  88, 135, 129,   4,  91,   4, 129,  91,   4,   4,   4,   4,
-135, 135, 128, 132,   4,  91,   7,  91, 132, 135, 141,  91,  91,  13,  88,
-  6, 132, 132,  91, 135, 129,   7,   4,  91, 132, 129, 132,  91,  91,  13,
-  7, 132,  91, 135,  13,   4, 132, 135,   4,  91,   6,   6,  91, 129,   4,
-  4,  88, 134, 135,  15, 129,   7,  91,   4,  88,   6,   4, 128, 135, 135,
- 91, 135,  91,  88, 135,   1,  91,  88,  88,   4,  91, 132, 135, 135,   7,
-128, 132, 128, 135,   1,  13,  91, 135, 132, 129, 129,   4, 135, 135,   6,
-129,   4, 129,  88,  15, 134,   4,   4,   4, 132,   4, 134,  13, 135, 129,
-132,   4,  91,  88,   4, 129,   1,   7,  91, 135, 132,  88,   4,   4, 132,
-  7,  88, 129,  88,   4,  91,  91, 129,   4,   4, 135,  88,  88,  91,  13,
-135,  88,  91,  88,   4,  88,  88, 129, 132,  91,   4, 132,  88,   7, 135,
-135,   1,  13, 129,   7,   7,  13,  91,  91,   7,  88, 132,  88,  91,  88,
- 90,   6,  13, 129,   4,  91, 135,   4, 129,   4,   4,   4,   4,  91, 129,
- 91, 135, 135,  91,  91,   7, 135,   7,  88,  13,  90,   7, 135,   4,  13,
-135,  91,  91, 132,  91, 135, 135, 135,  88, 132,  91,  91,  88, 129,   6,
- 91,  15,  88,   7,  88,   7,  91,  88,   6,  13, 128,  91,  88, 135, 135,
-  7,  88,  91, 132,  88, 135, 129,   4,   7,   1,   7,  91,   7, 135,   1,
-  4,  15,   4,  91,  13,  91, 132,  91, 135, 129,   4, 134,  88,   4,   4,
-135,   4, 132,  88,  91, 135,   7,  88, 135, 132,   7, 135, 135,   7,  91,
-132,  88, 135,  91,  88,  91, 135,   4, 132,   7,  91,  91,   4, 135, 135,
-141,   7,  91, 129,   7, 129,  91,  91,  88,  88,  91,  91,  91,   7,   4,
-  7, 135,  88,  88,  88,  13,  91,   4, 129, 134,  91, 135, 132,  91,  88,
- 91,   4,  91, 134,  88,  13, 134,  88, 135,   4,  15,   7, 135, 135,   4,
- 15,   4,   7, 132, 129, 135,  91,   7,  91,  88, 129,  91,  91,   7, 135,
- 88,  13,  88,   4,  91,  91,   6, 135, 135,   1,   1,  13, 141,  88,  91,
-  4,  15,   4,  91,  91, 135,  91,  91,  88,   4, 132,  13,   4,   7, 135,
-  7, 132,  88,  88, 129,  88,  91,   4,  13,   7, 129,  13,  88, 132, 132,
-135,   4, 132,  15, 134, 128, 132,  88,   4, 132,  91,  91, 135,  13,  88,
-135,  91,  88, 135,  88, 132, 135,   7,  91,   4,   7,  91,  91, 135, 129,
-135,  91,  15,  91, 129,  91, 132,   4,  91,   4, 135,  88, 132, 135,  88,
-132,  91, 135, 132,  13,   7, 129, 135,  91, 135,  13, 129,  15,   4,  88,
- 91,  91, 135,   4,   4,  91,  13,  88,   7,   4,  91,   7,  88, 129, 135,
- 91, 132, 135,  88, 135, 135,  91, 132,   4, 135,   4,   7, 135,   4,  15,
- 91,  91,   4,  13,   4, 132,   4,   7,   7, 132,  88, 135,  91,  88,  91,
-135, 135, 135,  88,  13, 135,  91,  13,   4,  91,   4,  13, 135, 135,   7,
- 88,   7,  88, 129,  89,  88, 129,   4,  91, 135, 135, 132, 132,  13,  13,
-132, 135,   7, 135, 135,  13,  91,   5,   7,   4, 135, 135, 132, 132,  13,
-135,  88, 135,  91, 132, 135, 133,  91,  13,  91,  91,  88, 128,  13,  91,
- 91,  91,  91,  82,   4,  88, 132, 135, 135,   4, 132, 128,  91,   4, 135,
-  4, 129,  91,   4,  91,  88,   4,  91, 135, 135,   4,  15,   4, 135,  88,
-  4, 135,   4,  91, 128, 135,   7,   7,  91, 135,  88, 132,  91, 135,   4,
- 91, 128,  91,  91,  89, 129, 128,  13,  88,   4,  88, 135, 135,   7, 132,
-129, 132,  91,   7, 135,  91,  88, 128,   4,   4, 129,  88,   4, 132,  13,
- 15,   7,   4,  88,  88, 135, 132,  88,  91,   4,   7,  91,  91,   4,  91,
- 88,  88,   7, 132, 129, 135,  91, 132,   4,   7, 135, 132,  88, 135,  91,
-132,   4,   4, 132, 132, 132,  13,  88, 129, 132,  91,   4, 135,  89, 135,
- 88, 129,  15, 135, 128, 135, 135,   4,  88,  13,  82, 129,  88, 135, 135,
-135,  91,   7, 135,  13,   7,   7, 135,   7,   4, 128,  13, 135,   7,  88,
- 94, 135,   7, 135, 135,  88,   4,  13, 135,  88,  91,  91, 129, 129, 132,
- 88,   4,  91,  88,  88,  13,  94,   4,  88,  88,   7,  91,  91,  91,  91,
- 88, 133,  91,  91,   7,   4,  13,  82,  88,  88,  91, 132,  91,   4, 132,
-  4, 129, 135, 135,   7,   7,   4,  13,  88, 135,  91,  88,  88,  88,  91,
-129,   7, 132, 132,  91, 129,  91,  89,  91, 135, 129,  13, 132, 129,  94,
-129,  88,  91,   4,  15, 133,  91, 135,   4, 135,  13,  89, 135,   7,  88,
-133, 128,  91,   4,  91,  91, 135,  15, 129, 133,  91,   4,   7,  88,  88,
-  7,  91,   4,   4,  89,  94, 129,   4,   4, 135, 135,  88, 135, 132,  91,
-135,  88,  13,  82, 135,  91, 135, 135, 133,   7,  88,  91,  13,   4, 135,
- 88,   4,  88, 135, 132,   4, 135,  88,  88,  13,   7,  15,   4, 132, 132,
-  4, 132, 129, 135,  88,  91, 132,   4, 129,   4,  88,  91,  91,  94, 133,
-  4, 132,  15,  94,  82,  13,  91, 129,   7, 135,   4, 129,   7,  82,  13,
- 82,  91, 135, 129,  91, 132,   7, 132,  88,  88,  82, 132,  91,   7,  91,
-  7,   4,   7, 135,  88, 135,   7,   4,   7,  88,  88,  91,  13, 135, 135,
- 13, 132,  13,  91,   4, 128, 135, 132, 132,   4, 132, 133,  91,  88, 135,
- 94, 135,  94,   4,   5,   5, 135, 135, 132,  91,  91,   5,  91,   4, 129,
-128, 132,   4, 129,  88,   4, 135,  15,  88,  88, 133,   4,  13,  88, 135,
-132,   7, 135, 135,  15,  15,  91, 135,   4,  91, 132,  91,   7,  88,  91,
-  4, 135,  88, 129, 135,  89,   4,  94,  88, 128,   7,  88, 135, 129, 132,
-133,  91, 129,  89,  91,  13,   4,   4,  91,  89,  88,  88,  89,   5, 135,
-132, 133,  91,  91,  13, 129,   7,  88, 135,  91, 135,   4,   7,   7,  91,
- 13,  88,  88,  15,   5, 135,  82, 132, 135,   5,   4,   4,  88,  13,   7,
-132,  13,  91,   4,   7,  91,  82,  88,  88, 135, 132,   7,  82,   7,  88,
-132,   7,  13,  91,  91,  88,   4, 135, 132,  88,  88,  82,  13,  13, 129,
- 91,  13,   4, 133,  94, 135, 132,   7,   4, 129,   5, 128,   4, 133,   5,
-  4, 135,   4,  82,   4,  88,  94, 133,  91,  13,  88,  91,   7,   4,  91,
- 91,   7, 135,  91, 129, 129,  15,   4,   4,  94,  88,  82,   5, 132,  88,
-132,  82,  88,  88, 135,  91, 135, 135, 135,  91,   7,   4,   4,  88,   7,
-132,   7,  15,  91,  13, 132, 132,   5,  88,  88,  91,   7,  91,  91,  91,
- 13,  91,   4, 132,   4,   7, 135,  91,  91,  91,  88, 135,  94, 135,   4,
-  5,   4, 132,  88, 135,  13,  89,   4, 132,   4,   7,   7,  82,  91,  82,
- 88,  94,   4,  13,  88,  91, 132,   7, 129,  88,  88, 133, 135,  89,  88,
- 13, 128,  82,  91, 135,  94,   4,   7,  13,   7,   7, 129,  91, 135,   7,
- 91, 135,   7,   5,  89,  91,   4,   4, 135,  91,  91, 135,  89,  94,   5,
- 13,  91,  88, 135,   7, 135, 132, 132,  13,   4,   4,  91,  91,  82,  15,
- 88, 135,   4,   4, 129, 133, 132, 129, 135,   7, 135,  91,  89, 135,   7,
-  4, 135,  91,   4, 133, 133, 132, 132,   4, 129,   7,  88,  91, 135, 133,
- 89,  89,  91, 135, 135,   7, 132, 129, 135,   4, 133, 132,   7,  88,  91,
- 91, 129,   7,   4, 129,  88,  82,   4,  94,   4,  91, 132,   4,   7, 132,
-135,  89,  88, 129,  89, 133,  94,   5,  89, 129,  89, 132,  88, 132, 135,
-  4, 129,   4, 132, 132,   4,   7,   4,  94, 132, 132, 132,   4,  88,  13,
-132,  94, 132,   4,  15, 135, 135,  13,   4,  91, 135,  91, 129,   4, 135,
- 89,  91, 135,  91, 132,  94,   7,  13,   4, 132,  91,   4,  91,  88,   7,
-129,   7, 133, 132, 129,  91, 135, 129, 135,  89, 133,   4, 129,   4,  94,
- 82, 129,   5,   7,  91,  13,  88,   4,  88,  88,  91, 133,  91,  13, 132,
-  5, 129,  13,  91,  82,  91,  13, 135,  94,   7,  82,  94,  88,   5,  91,
-132,  91,  94, 135, 132,  89,  89,   7,  94, 135, 135,   7,  91,   7,  89,
-128,  94,   7,  82, 129,   4,   4, 132,  94,  91,  88, 135,  88, 135,  88,
-132,   4, 133,  88,  89, 135,   7, 128, 129, 132,  15, 132,   7,  91,  13,
- 91,  91, 132,   4, 132,  91,  89, 133,  91, 129, 135,  88,  91,   4, 128,
-132,  88, 132,  91, 132,  13,  91, 135, 133, 132,  88,  82,  88,   4,  91,
- 91, 132, 135,  88, 129,  88,  15,  91,   4,  88, 128, 135,   7,  82,   5,
-  7,  91, 128, 135,  88,  88,  94,  88,  82, 132, 133, 135,   7,  13,   5,
-  4, 135, 132,  13,   7, 132,   7,  94, 135,  91, 135, 135,  82, 132,   5,
-  5,   5,  88, 132,   7,   5,  94, 135,  89, 135,   4,  89, 132,  91,  82,
-135, 132,  91, 135, 132, 133, 129, 129, 132,   5,   7,  82, 129,  89,   7,
-  7, 129, 132, 129,  91,  91,  82, 135, 129, 135,  15,   4,   4,  15,  13,
-  5,   4, 135,  13,  89,  89, 128, 129, 133,   7,  94,   7, 132,   4,  89,
-  7,  88,  94,  82, 133,   5, 132,   4,  94,  13, 135, 133, 132, 135,   7,
- 13, 128,  13,   4,  91,  13,  13,  88,   4,  88,  13, 135,  89,   4,  89,
- 88,   7, 132,   7, 133, 129,  91, 132, 132, 129, 129,  88,  15,   7,  15,
-129,  88,  91,  82, 135,  15,  94, 135,  88, 135, 128,  15, 135, 132,  88,
-132,  88,   4,  88,   7,  89,  94,  91, 133, 133,   5,   7,   7,  91,  91,
- 94, 132,   4,  15,  89,  13,  13, 135,   7, 135,  82,   5,   5, 133, 132,
- 89,  91, 133,  91, 132, 133,  88,   4,  91,  82,   7,  94,  91, 129, 129,
- 82,   7,   4, 133, 129,   5,  91,  94,  88,  94,  94, 135,  82,  82, 129,
- 89,  82, 132, 135,  88, 133,   5, 129,  91,  91, 132,   4, 129,   7, 135,
- 91,   7, 135, 129, 129,   4, 132,  82,  94, 135,   5, 132, 132,  91, 129,
-128,   7,   7,  82,  91,  94,  91,  91, 133,  82,  89,   4,   5,  91, 132,
-  4, 133,  82, 132,   7, 135, 133,   7,   7,   7,  13, 133,   7,  88,   7,
-  7,  94,  88, 133,   7, 128,  89,   7,   4, 129,   7,  88, 132,   7,  88,
- 89,   4,  89, 135,   4,  82,  94,  13,   4,   4,  82,  89,  89, 133,  89,
-135,   7, 132, 132,  91,  82,  88,  91,   4, 133,  88,   7, 132,  82,   4,
-  7,  88,   5, 129,   7, 132,  89, 135,  89,  88,  13,  91,  94,  91,  94,
- 94,  91,  94,  82,  89,  94,  94,  94, 132, 132,  82,  15,  91,   4, 129,
-  5, 129,  89, 135,  88, 132,  13, 129, 135,  82,   4,  94, 133,   7, 128,
- 94, 132,   4,  13,  91,  91,  91, 135,  82, 133,  82, 135, 129,   4,   4,
-135,  88, 133,  82,  82,   4,  89,   4,   4, 128,  15,  88,   4,  89,   4,
-  4, 133,  89,   7, 133,   5,  91,  13,   5,  88,   7,   5,  94,   5,  88,
-135,  91, 132,  89,   7, 133, 132,  82,   7,   7,  88,  82, 133,   7,  88,
- 88,  94,  82,  94, 132,   5,  94,  88, 132,  91,   7, 135,   5,   5,  89,
- 91,   7, 135,  91, 132,   4,  91,  91, 133, 132,  13, 132,  82,  13, 132,
-133, 132, 135, 132, 132,  91,  13,  88, 132,  82,  13, 135, 135,  89, 135,
- 94,  94,   5, 133,  13,  91, 135, 129, 133,  88,  15,  94, 132,  13,  89,
-133, 133, 135, 135, 128,  94, 133, 135,  13,  91,  94,  89, 133,   7, 132,
-135, 132,  88, 128,  82,  89,   5,   7,   4,  94, 129,  89,   4,  13,   5,
-135, 132,  89, 135, 132,  89,  94, 133, 135,   5,   5, 133,   7, 135,   7,
-  7, 133, 132,  91,  91,  91, 133,  13,  13,  88, 133,  91,  94,   4,   4,
-  7,  15, 132, 129, 135,  94,  94, 129,  94,   7, 132,   4, 132, 135,  89,
- 89,   4,  89,   4, 133,   5,  82,  88,  91,   4,  89,  91, 132,  88, 135,
- 88,  89,  88,  88,  82, 133,   7,  91, 132, 132,   4,  91, 135,   4, 135,
- 88, 135,  91,  82,  91,  94, 135,   4, 129,   7,  13,  91,  88,   5, 135,
-132,  15, 129,  94,   7,  82,  13,  91,  89, 129,   5,  82, 135,   4,  89,
- 89,  89,   7,   5,   4,  89, 133,  91, 135,  88, 128, 128,   5,  13,  88,
-  7, 128,  89,  94,  94, 129, 129,  88,   5,   7, 132,   5,   4, 132,   5,
- 91, 135,  91, 135,  88,   5,  82,  94,   5, 133,   5,  94,   4,   5,  82,
-135, 133,  91, 135,  94,  91, 129,  88,  94,  89,  88,  94,  88,  88,   7,
-  7,   7,   4, 132,   5, 135,  88, 132,  15,   5, 129,   4,  13,  91,   7,
- 82,   4,  91, 133,  89,  94,  89, 129,   4, 129,   7,  82,  91, 128, 133,
-  4,   5,   4,  89,  94,  89,  82,  91,  13,  91,  15, 129, 129, 132,  13,
- 94,  82,  15,  94,   5,  94, 132,   4, 132, 135,  82,  94,  88,  91,  13,
-  7,  91, 135, 129, 132,   5, 135,  82, 128,   7,  13, 135,  94,  13,  15,
-133, 135,  82,  94,  89,  89,   5,  13,   4,  88, 129, 135,  94,  13, 133,
- 88, 133, 133,  13,   4,  82,  89,  94,   7, 129,   7,   7,  89,  88,  94,
-132,  94,   4,   5, 132,  94, 129, 133,  89,   4,  88,  82,  89,  82, 132,
-135, 132,   5, 132, 133,  13, 135, 135,  91, 135,  88,  91,  94,  89,  94,
-  7,  91, 132,  91,  91,  82, 135, 135,  94, 132,  89,   7,   5,   5, 132,
- 91,  94, 133,  91, 129,  94,  91,  91,  94,   7,  94,  89,  91,   5, 133,
- 82, 129, 132,   5,   4, 135, 132,  89, 132,   7, 129, 129,  94,   7,  89,
- 91,  89,   4,   7,  13,  89,  82, 133, 133, 135, 129,  94,   7,  89,  91,
-128, 129, 133,  91,   4, 133,  13, 135,   4,  82, 129,   5,  88,   4,  89,
- 82,  94, 135,  89,  88,   4, 135, 135,  94,  91,   5,  91,   5,  94,  89,
-  4, 135,   7,  89,  82,   4,  89,  91,   5,  89,  88,  89, 132, 129,  89,
- 94,   7, 132,  91, 133,  89,  89,  94,  89,  82, 129,  89,  94,   7,  94,
-132,   7,  82, 132,  89,   5,  88,  91,  89, 129,  88,  13,  82,  82,   4,
-  7,   5,  94, 132, 135,  94, 133,  94,  13, 129, 132, 132, 133,   7,   5,
-129,   7,   5, 132,  91,  89, 132,  89, 135, 129,  94,  82,  82,  82,   7,
-  5,  89, 133, 129, 133, 135,   4, 132,  91,   7, 132,  88, 135,   7,  82,
- 15,  88, 133,   5,  89,   4,  13, 132,   4,  82,   7,  82,   4,   4,   7,
-132,  88,  94, 129, 132,   5,  94,  94,   7, 132,  91, 135,  13,  13,  88,
-  7,  89, 133,  94,  89,  91, 132,  13,   4,  94, 132, 132,  89,  89,   5,
-133,   4,  91,  82, 135,  82, 133, 133,  13,   7, 133,  13,  89,  94,  94,
- 82,   5, 129,  88, 133,  91,  88,  91, 132, 132,   5, 132,  94,  82,  82,
- 91,  89,   4,  94,   7,  82,  13,  89,  13,  94,  82, 135, 133,  89,  94,
-  5,  89,  89,  89,   7,  89, 129,   5, 133,  94,   5,  89,  82,   7,  15,
-133,  89,   5, 128, 132, 133, 132, 132,  89,  13, 135, 135, 135,  88,  82,
- 89,  89,   5, 135,  94,   5,   4,  82,  82,  94,   7,   4, 132,   4,   5,
-129, 133,   7, 128,  89,  94,  94, 133,  91,  15,  91,   7, 132, 133,  94,
- 13,  94,  94,  91, 133,  91,  82,  94,   7,   7,  13, 129,  88,  89, 132,
- 15, 135, 129,  94,   5, 128,   7,  88, 135,  89, 133,   5,   4, 133, 132,
- 88,  94,  88, 135,  89,  13, 132,  91,   7, 129,  89,  94,  82,  82,  94,
-  4,  15,  82,  88,  94,   5, 132,   5,   5,  94,  82,   7,  82, 135,  89,
- 13,  88,  89,  89, 133, 129,   4,  94,   4,   7,  88,  88, 135,  82,  13,
-133, 135,  82, 133,  91,   5,  89, 135, 135, 133,  89,  13,  94, 135, 133,
- 89, 128, 132,  94,   7,  89,  88,   7,  82,  94, 132,   5,  88, 135,  89,
- 15,  89, 133,   5,   5,  94,  13, 133, 129,   5, 133, 129,  89, 132,  89,
-129, 133,   5,   4,  94, 129,  94,  89,   5,  89, 133,   4,  13, 132, 129,
- 89,  89, 132,  82,  89,  89,  91,   4,  91,  15,  88,  82,   7, 132, 132,
- 89,  89,  89,  89, 133,   7, 133,   7,  15,  89,  91, 133,  82,   5,  13,
-132,  88,  88,  89,   7,   5,  88,   7,  94, 132, 129,   4,   5,  88,  91,
-129, 133, 129,   4,  89, 132, 132,  82,   5,  94,  82,  94,  82,  94, 135,
-  5,  94,  13, 133,   5,   5,  94,  82,  89,  88, 132, 133,   7, 135,   5,
- 88,  94, 128,  82, 129,   5, 132, 133,   4, 132,   7, 133,  91, 129,  94,
- 89,  89,   5,  91,   7, 132, 128,  15,   5,   7,  94,  94, 129,  82,   5,
-  4,  94,  94,   7,  91,  88,  91,   5,  89,   4,  94,  82, 133, 128,  89,
-  4,   5,  89,  91,  89, 133,  89,  89,  94, 133,  13,  94,   5, 129, 135,
- 82,  94,  13,   4,  89, 128,  94, 132,   4, 135,  13,  89,  13,  94, 133,
- 82, 135, 129,  89,  82, 133,  91,  82,   5, 132,  13,  82,  91,  82, 132,
- 94,  91,  94,  13,  88, 132, 129, 129,  82,  89,  89,   7,  82,  89,  82,
- 89, 135,   5,   7,  89, 132,   7, 132,  88,  13,  91,  89, 132, 133,   5,
- 82, 132,  91,  88,  91, 133,  94,  94,  94, 132, 129, 132, 132,  89,  94,
- 88, 129,   7,  89,   7,  89,   5,  82, 129,  89,  89,  82,  82,   7,  82,
-  7,  13,   7,  94,  13,  13,   5, 129, 132, 132,  13, 133,  13,  89, 135,
- 89,   5,  89,  82,  89,  89,  82,  89, 133,  91,  13, 132, 128,  89,  88,
- 94,  82, 135, 133,  82, 133,   5,   4,  82, 135,  82,  94, 135,   4,  88,
-133,  89,  89,   7,   7,   4,  89,   5, 133,  94,  89,   7,  15,   5,  94,
- 91,   5,  13,   4,   5,   5,  89,  94,  91,  94,  82,   4,  94,  88, 129,
-133, 133,  94,   4,  91, 129,  91,  89,   5, 133,   7,  94,  94,   4,   7,
- 82,   4,  82,   5,   4,  82,  94,  13,  82, 132,  82,  94,  13, 135,   5,
-129, 132,  88, 135,  94, 133,  82,  94,  94,  94, 132,  82, 133, 132, 133,
- 15, 129,  94,  89, 133,  94,  82, 129,   7, 132,   5,  94,  88, 132,  89,
-  5,  94,   5,   7,  89, 132,  89,  89, 129,   5, 129,  91, 135,  82,  94,
- 82,  82, 132,  91,  94,   5, 133,   7, 132, 132,  89,  89,   5,  91,   5,
- 82, 133,  82,   5,  88, 133, 132,   7, 132,   7,  94, 132,  82,  82,  94,
- 89,  89,  94,   4,  88, 133,  89,  94, 132,   5,  94,  82,  94, 133,  89,
-  7,  82, 132, 129, 129, 133,   4,  82,  89,   5, 133,   5,  15,  89,   7,
- 13, 133, 132,   5,   7,  82,  82, 129,  82,  15,  89,  88, 129,   7,   4,
- 89,  13,   7,   7, 132,  94,   7,  89,   7,  13,  82, 133,  89,  89,  89,
-  5, 132,   5, 132,   5,   5,   7,   5,   7,  13,  91, 135,  94,  82,   5,
-129, 128,  82,   5, 132, 133, 129, 129,   7,  94, 132,  94,   7,   7,  94,
- 89,  82, 132, 132,  89,  89,  94,   5,  89,   5, 133, 133,  89,  15,  94,
-135,  82,  94, 132,  89,  94,   7, 132,   7,  94, 133,  82,  82,  82,  89,
-129,  89,  13,  82, 128,   5,  89,   5,   7,  82,  89,  82,  89, 133,  88,
- 94,   7,  89,   7, 135, 129, 132,  82,  89,  82, 128,  89,  94,  82,   5,
-  5, 133,  91, 133,  94, 135, 133, 132,  94,  82,  94, 133,  82, 132,  88,
-  7,  91,  89, 133,  13, 133,  94, 133,   4,  82,  89, 128,   7,   5,  91,
-  5, 133, 133,  94,  94,  15, 132,   5,  82,  82, 133,  13,  89,  89,   5,
-128,  89,  94,  94,  89,  94, 132,  82,  89,   5,  88,   4,  89,  82,  94,
-133,   5,  13,   7,   4, 132,  88,  94,  89,  89,  89, 133,   7, 133, 132,
-  7, 133,  82,  82,  89,  89,  82,  82,  94,  89,  89,  82,   7,  94,  94,
-133,  89, 132,  13,   7,  94,  94,   5,  89,  94,  82,  82,  82,  89,   5,
- 89,   5,  89,   7,  89,  91,  89,  94,  94,   7,   5,  15,  91, 133,  89,
- 82,   5,  88, 132,  94, 133,  94,  94, 132,  82,  94, 133,   7,  91, 129,
- 82, 132, 132,  82,  89,  89,  82, 133,   4,   5,  89,  94,  89,   5, 135,
- 94,  89,   5,  13, 129,   4, 129,  94, 133,   7,  94,  94,  13,   5, 128,
- 82,   4,  13, 133,  94,  94,  89,  13, 133,  13,  89, 129,  13,   7,   5,
- 89,  89,  94,   7,  89,  94,  13,  89, 133, 133, 132,  89,  89,   5,  13,
-255,  94,  94,  89,   5, 132,  89,   7,  89, 129, 129,   7, 133,  89,  94,
-133, 132, 129,  94, 132,   4, 129,   7,  89,  91,  82, 133,   5,  13, 129,
-  5,  89,   5,   7, 133, 129,   5, 132,   7, 128, 128,  82, 133,  89, 133,
-129, 133,  82,  89,  82, 133,   5,   7, 132,  82,   4,   5,  82,  94,  94,
-  7, 133, 133,  13,   5, 133, 132,  82,  94,  82,  82,  94,  89,   5, 133,
-133,  94, 133,  82,  89,  15, 132,  89, 133,  94,  89, 133,  94,   5, 133,
-  7,  94,   5,  82,  13,   5,   5,  94,  94,  89,   5,  89, 132,  82,  82,
-  5,  94, 135, 129,  89, 133,  89, 132,  94,  89,   4,  82,  89,  94,  94,
-133,  89, 129, 133,  82,  94, 132,   4, 129, 133,   5, 133,  91, 135,   7,
- 89,  94,  89,  89,   5,  13, 133, 128,  13, 133,  89,  82,  82,   4,  13,
-  7,  89,  94,   5,  13, 132,   5, 128,  89, 133,  89, 133,  89,  89,   5,
- 88,   7,  82,  82, 135, 133,  89,  89, 133, 129,   5, 129, 132,   5, 133,
-  7,   5,  89, 133,  89,  13,   7,   5, 132,  94,   5,  89, 128,   5,   5,
- 82,   5, 133,   5,  82, 129,  89,  91,  89,  94,  82,  94,  94, 132,  13,
- 13, 128,  82,   4,  82,  13,  89, 129, 135, 129,  82,  89, 132,  82,  94,
- 13,  82,  94,  94,  94,  82, 128,  88,  82,   5,  89,   5, 133,  94,  94,
- 94,  94,   5,   5,  89, 129, 133,  94,  82,  89,   5, 133,  89,  94,  82,
- 13,  94,  94,   5,  94,  82,  82,  13,   5, 129,  89,  89,  82,   7, 133,
- 94, 132,  94,  82,   5, 132,  82, 133,   5,  82,   7,   5,  82,   7,  13,
- 89,  89,   5, 132, 132,  82,  89, 129,   5,  82,   5,  89,  89,  82, 132,
- 89, 133, 129,   7,  89,   5,  89,   5,  89,  82, 133,   5,  82, 133, 132,
-  5,   7, 133,  89, 133, 133, 129,  89,  89, 132,  94,  89, 129, 133,  15,
- 13,   5,  89,  89,   5,   5, 132,  89, 129, 132,  94,  94,  82,   5,  94,
-  7,  82,  82,  15,  82, 133,  15,   7,   5,  89,  82,  82,  13,  94,  13,
-133,   7, 133,  89,  82,   7,   5, 132,   5, 133,  94,  94,  13, 133,  82,
- 82,  82,   5, 129, 133,  82, 133,  82,  89, 133,  82,  94, 133,   5,  82,
- 94,  89,   5,  82, 133,  13,  89,  89,   7,   7,  13,  94,   5,   5,  89,
- 89,   7,  94,  13,  89,   5,  94,  89,  89,   7, 133,   7,  89,   5,   5,
- 82,  89,  89, 133, 133, 133, 133,  89,  89, 133,  94,   5,  89,  82,   7,
- 94,   5,  89,  89, 133, 132, 132,  94,   5,  94, 132,   5,  82,  89,  94,
-  7,  82,   5,  89,  82,   5,   5,   5,  89,   5,  82,  82, 129,  94, 132,
- 89,  94,  94, 129,  82,  89,  89, 133,  89,  82, 132,  82,  89, 133,  94,
-  7, 132,  94,  82,   7,  82,  89, 133,  94, 133,  94, 129,  89,   5,   5,
-  5, 133, 128,  94,  13,  13,  94,  89,  94,   7,  94,  82,  83,  82, 133,
- 94,  89,  95,  94, 133,  82,  94, 133,  89, 133,   5, 133,  89,  13, 129,
- 89,  94, 132,  82,  94,   5, 133, 133, 133,  94,  89,  94,  82,   5,  89,
- 80,  82,   5,  89, 132, 133,  94,  82,  94,   5, 132,  89, 133,  82,  89,
- 89,  80,  94, 133,  89,   5,  94,  89,   5,  94,   7,  89,  94, 133, 132,
- 94,  89, 133,  82,  94,   5,  82,  94,   5, 133,  89, 132,  89,   7, 133,
- 82,  15,  92,  94,  94,  89,  89,  89,   5,   7, 133,   5,  94,  82,  82,
-  7, 129,  94,  94,  82,   5, 132, 129,   7,  94,  94, 129,  94,   7, 133,
- 94,   5,   5,  94,  13,  94,  89,   5,  94,  82,  82, 129,   5,   7,  89,
- 82,  89,  82,   7,  82,  15,  89, 133,  82,  94,   5,  82,  82, 132,  89,
- 89, 133,  89,  94, 129,   7,  82, 133,  82,  89,   7,  89, 133,  89,  13,
- 94, 132,  82,  89,  89,  82, 133, 133,  80,  89, 133,  94, 132, 128,   7,
- 13,  82, 128,  82,   5, 132,   7,   5,  89,  89,  92,  82,  13, 133,  89,
- 94,  82, 129,   5, 129,   5,  82, 133,   5,   5,  15,  89,  89,   5,  89,
- 82, 133,  89,  89, 132,  95, 132,  89,  89,  95,  13,  94,  89, 129,   5,
-133,   5,   5,  89,   7,   5,   5, 133,  82,  89,   5,  94,  82,  94, 132,
- 82,  82,   7,  82,  94,  94,  82,  82,   7,  94,   5, 132,  13,   5,   7,
-  5,   5, 133,  13,   5,  82,   7,  92,  89,  89,   7, 132,  94,  13,  89,
- 82,  89,  94,   5, 133,   5,   5,  89, 133,  89,  94,   5,  94, 129, 133,
- 82,  83,  82,  89, 132,  89,  82,   5, 133,  82,  94,   7,   5,  89,  83,
- 82,  89,  89, 133,  83,  82,  89,  89,  89,  89,  94,  89,   5,  82,  89,
- 89,   5,  89,  13, 132,  82,  94,  82,  89,  89, 129,   7,  89,  89,  94,
- 94,   5,  94,  82,  82,  94, 133,   5,  95,   5,   5,   5,  89,  94,   5,
-  5,  80, 132,  94,   5,   5,  89,   5, 132,   7, 129,  94,  94,   5,  89,
- 89,  82,   5, 133,  13,  94,  94, 129, 255, 133,  94, 133, 133, 133,   7,
- 82,  89, 133,   7,  89,  89,  94,  89,  94, 132,  89,  82,  82, 133, 132,
- 89, 133,  82,  89,   5, 133,  89,  82,   5, 128, 129,  82,  94, 133,  89,
- 94,  80, 133,  13,   5,   5,   5,  89,  83,  82,  13,   7,   5,  94,  94,
- 89,  80,   5, 129,   7, 128,  82,  89, 132,  15,  89,  92, 133,   5,  82,
- 82,   5,  94,  82, 132,  82, 133,  82, 129,  94,  13, 129,   5, 129,  89,
-  5,  83, 129,  94,  94,  83,  80,  89,  94, 132,   5,  95,  82, 129,  89,
-132,  89, 133,   7, 132,  82,  89,   5,  94,  82,   5,  89, 132,  94, 128,
-133, 133,  15, 133,   5,  89, 133,   5,  89,  15,   5, 132,  89,  92,  94,
- 94,  89,  94,  82, 129, 129,  92, 133, 133,  89,  82,  13,  89,   5, 132,
-  5,  94,   7,  82,  89,  82,   5,  82, 132,  82,   5, 133,  80,  82,   5,
- 13,  89, 133,  94,   7,  94,  13,  89,  89,  82,   5, 132,  89,  95, 128,
-133,   5,  89,  89,   5, 133,  94,  82,  83,  94,   5, 133,  83,   5,   7,
-129,  82, 129, 132,   5, 129,  80,   7,   5,  80,  80,  89, 129,  82,   7,
- 15,  94,  94,  94,   5,  82,  89,  82,  82,  89, 132,  89, 133,  92,  80,
- 82,   7,  94,  89,  80, 129,  83,  83, 129,  94,  89,  89,   5,  13,  89,
-132,  95,  89,   5,  13,  89, 129,  83, 133, 132,   7,  94,  89,  89,  94,
- 94,  13,  95,  95,  94,  95,  82,  15,  89,  89,  13,   5,  89,   5,  95,
- 89,  83, 132,  89,  89,  95,  80,  82,   5,  89,  82,  89, 132,  80,   5,
- 89, 133,  83,  82,   7, 133,  89,  95,  89, 133,  94, 133,   7,   5,  89,
- 13,  94,  82,   7,  94,  89, 133,  94,  82,  89,  83,   5,  82, 133,  89,
-  7,  94, 132,  82, 132,  94, 133,  13,  89,   7,   5,   7,  83,  94,   7,
- 94, 132,  89,  13,  82,  89,  89,  95,   5,  94,  89,  89,  83,  82,  89,
- 92,   5,  83,  94,  94,  94, 132,   5,  94, 133,  89, 133, 133,  89, 133,
-  5,  83,   5, 132,  94, 133,  94,  15,  94, 133, 129,  89,  82,  82,  94,
- 94,  82, 129,  94,   7,  82,  89,  89, 133,   5,  89,  92,  94,  89,  80,
- 95,  95,   5,  89,  92,  83,   5,  92, 132,  89,   7,   5,  89, 132,   5,
- 13,  94, 132, 133,  94,  83,  82,  94, 132,  89,   7,   7, 133, 132, 132,
-  5, 133,  13,  92,  82,  13,  92,  89,   7,  83, 129, 132,  80,  82,  13,
- 89,  89,  94,  83, 132,  89,   5,  83,   5, 132, 133,   7,  82,   5, 133,
-133, 129,  83,  82,  13,  80,   7,   5, 133, 133,  89,  95, 133,   5,  82,
- 89,  89,  89,  89, 129,   5,  82,  94,  83, 132,  92, 132,  82,  89,   7,
-  5, 128, 133, 132, 255,  94,   5, 133,  89, 129,  94, 132,  94,   7,  89,
- 82,  82,  82,  89,  80,  94,  89,  94,   5,  83,  83, 132,  82,  80,  94,
- 94,  89, 128,  94,   7,  82,  15,  89,  95,  94,   5,  80,  95, 132,  89,
-132,  82,  89,  95, 132,  89,  82,  89,  92, 133,  89, 133,  82,   7,   5,
- 82, 132,  89,  89,   7,  92,  94,  13, 129, 132,  94, 129, 129,  89,  82,
-133,   5,  89,  82, 129,  89, 133,  82,  94,   5, 133, 129,  89,  13,  89,
- 94,   5, 128,  89,   7,   5,   5,  89,  82,  89,  89,  92, 129,  92,  95,
-  5,  83,   7, 133, 133,  80,  94,  95,  89,  95,  13,  89,  82,  94,  94,
- 95,  82,  94,   5, 133,  89, 133,  89,   5,  89,  94,  89,  95,  94,  94,
- 80,   7,  82,  13,  83,  82,  82,  83,  94,  83,  89, 128,  80,  82,  82,
-  5,  82,  82,  89,  94,   7,  89,   7,  89,  94,  92,   5,   5,  13, 132,
-133,  83, 129,  89,   5,  94,  82,  89, 133,  92,  94,  94,  89,   5,  80,
-  5,  94,  80,   5,  80,   5,   7,  89, 133,   5,  80,   5,  94,  82,  89,
-  5, 133,  94,  92, 133,   5, 132,  89,  94,   5,   5,  94,   5,   5,  94,
- 95,  89,  89,   5,  89,  89,  82,   5,  80,   5,  89,  82,  80,  89, 133,
-  5,  82,  15, 133,  92, 132, 132, 128,  94,  95, 129,  82, 132,  94,  80,
-  7,  94,  89,  89,   5, 132, 132, 133,   7,  94,  13,  83,  80,   5,  82,
-  7,  89,  13,  94,  95,  89, 133,   5,  89,  83,  89,  83, 129,  89,  13,
-  7,  82,  94,  15,  82,  89,  89,  94, 133,  80, 133, 132,  92, 133,  89,
- 13,  92,  89,  94,  89,  82,  94,   5,  89,   5,  89, 133,  92,  94,  82,
- 82,  83,  83,  89, 129,  80,  89,  94,  82,  92, 129,  89, 129, 132,  94,
- 94,  95,  82,  92, 133, 132,  89,  94, 133,   5,   5, 132,  13,  89, 133,
- 80,  95,  83, 129,  15,   5,  94,  94,  89,  89,  82, 129, 133, 133,   5,
- 89,  94,  89, 133,  82,  95,  83,  89,   5,  82,   5,  95,  89, 133, 132,
- 13, 133,  92, 132,  83,  94, 133,  94,   7,   7,   5,  89,  89,   7,   7,
- 95,  13, 133, 128, 132, 129,  94,  89,  95,  95,  83, 133,  92, 133,   7,
- 89,   5,  83,   5,  83, 133, 128,  94, 133,  94, 129, 132,  89,  13, 132,
- 89,  83,   5,  82,  95,  94,  82,  94,  94,  95, 133, 133, 133,  80,  89,
-  7,  95,   5,   5,  89, 129,  94, 132,   7,  94,   5, 129,  94,  89,  92,
-129,   5,   5,  89,  82,  89,   5, 129,  92,  82,  92,  92, 132,  89,  82,
- 89,  89,  80,  89,  94, 132,  89,  89,  13, 133,  83,  83, 133,  80,  92,
- 95,  92,  95,  94,  89,  89,  94,   5,  82, 132,   7, 133,   5,   7, 133,
- 94,  89, 133,  89, 128,  82,  92,  94,   7,  83,  89,  95,  89,  92, 132,
-  5,  95,   5,  89, 132,   7,  89, 133,   7,  80, 133,  94, 133,  94, 132,
- 94,  82, 129,  94,  80,  82,  92,  89,  83,   7,  80,   5,  89, 133,  92,
- 89,   5,   7,  94,  89,   5,  15,  82,  82, 132,  83, 133,  92, 129,   7,
-  5, 133,  82,  83,  15,  95,   7,  83,  83,  94,  89,  83,  82,  82,  89,
-133,  94,  83,  92,  82,   5,   5,   5,   5, 132,  94,  80,   5,  95,  13,
- 94,   5, 133,  92,  89,  83,  89,   5,  80,  94,   5, 129,  83, 133,   5,
- 94,  94, 133, 133,  95,  80, 132,  92,   7,   5,  94,  89,   5,  80,  89,
- 89,  82, 132, 133,  95,  82,   5,   5,  95,  15,  83,   7,  89, 133, 132,
-  5,   7,  95, 133, 133,  89, 132, 129,  82,  82,  82,   7,  95,  13,  80,
-133,   7,  89,  80,  80,  94,  89,  83,  94, 133,  89,  89, 133,   5,  89,
- 89, 129,  94,  92,  82, 129,   7,  92,   5,  95,  80,  83,   5,   5, 132,
-133,  80,  83,  94,  92,  89,  80,  80,  89, 133, 133,   5,  83, 132,  95,
- 89, 132,   5,  83,   7,  82,  89,  94,  89,  94, 133, 132, 133,  80, 132,
- 89,   5,  94,  82,  83,   5,   5,  95,  82, 132,   5,  89,  89, 133,  80,
- 82,  13,  80,   5, 132,  83,  80,  83,  94,  95,  82,  80,  13,  89,  95,
- 94,  94,  83,  15,  83,   5,  89,  89,  89,  13,  83,  13,  83,   5,   7,
- 15,   5,  89,  95,  82,  89,   7,  82, 133,   7,  82,  89,  82,   5,  92,
- 89,  80,  89,  83,  95, 129,  89,  89,  89,  83, 132, 133,   5,  89, 132,
-133, 133,   7,  83,  89,  83,  94,  80,  80,  89,   7,  89,  94,  80,  94,
- 15,  92,  95,  92, 133, 132,  92, 129,  83, 129,  92,   7, 128,  83,  89,
- 82,  92,  95, 129,  83,  13, 129,  89,  94,   5,  80,  13,  94,  89, 132,
-132,  82,  95, 133, 128,   7,  95,  83, 133,  83, 132,  94,  94,  82,  92,
-132,  95,  92,  95,  89,  89,  92,  92,  89,  94,  92,  89, 133, 129,  80,
- 83,  83, 129,  92,  83,  95,  83,  95,  95,  94,   5,  92, 133,  89,  89,
- 83,   7,  89,  92,  92,  94,  83, 133,  82,   5,  80,  83,  13,  94,   5,
- 94, 133,  92,  13,  89,  89,  92,  89,  83,  92, 133,   5,  95,  89, 128,
- 89, 132,   5,  89, 128, 133,  89,  94,  80,  83,   5,  89, 132,   5,  94,
- 89,  94,  94,  13,  80,  82,  94,  89,  83,  82,   5,  95,  80,   5,  92,
- 94,  15,   7,  94,  95, 133,  83,  82,  82,  83,  89,  92,   5,  83,  80,
-  5,  89,  89,  92,  83,   5,   5, 132, 133,  89,   5, 128,  95, 132, 129,
-133,  95,  83,  94,  83,  95,  89,  95,   5,  89,  92, 129,  95, 129,  80,
-132,  92,  95,  80,   7,  83,  83, 133,  80,  83,   7,  95, 129,  89,  95,
- 82,  92, 132,   7,  94,   5,  13,  15,   5,   5,  94,  92, 132, 129, 133,
- 80,   7,  13, 133,  95,  82,  82,  92, 132, 132, 129,  94,  94, 128,   7,
-  5,  92,  94,  80,  94,  83,   7,   5, 133, 128,  83,  95,  95,  82,   5,
- 80, 133,  89,  83,  82,  89,  83,  15,   7,   5,  13,  94,  80,   5,  92,
- 13,  82,   5,  92,  95, 133,  89, 129, 133,   5, 129,   7,  83, 133,  13,
-  5,  89,  83,  80,   5,  94,  80,  13,  94,  89,  83,  94,  83,   5,  92,
- 89,  83,  94,  89,  94,  89,  94,  13,  80, 132,   7,  89,  80, 133,  80,
- 80,   7, 132,  95,  89, 133,  80,  89, 132,  89, 132,  89,  89,  80,  13,
- 94,  89,  83, 133,  80,  92,  89,  95, 132,  94,   7,  15,  92, 133, 129,
-  5,   5,  92,  82,  89,  80, 133,  83,   7, 133,  89, 133, 132,   5,  82,
-  5,   5, 133,  89, 133,  89,  83,  89,  92, 132, 133, 133,  13,  92,   5,
- 94, 132,  89, 132,  83,  95,  89,  95,  80,   5,  83, 133, 132, 133,  82,
- 83,  95,   5,  95,  94, 132,  83, 133,  83,  95, 133,   5,  82,  13,  89,
- 95,  89,  82, 132,   5,  92,   7,   5,  89,  83,  95,  89, 133,  83, 133,
- 83,  95, 129,  94,   5,  95,  95,   7,  92,  95,  89,  83,  83, 133,  89,
-  5,  83,  83,  92, 133,   5, 133,   7,  83, 132,  92,  82,   5,  80,  89,
-133,  92, 133,  13,  94,  80,  95,  82,  80,  92,  82,  95,   5,  80,  92,
- 80,  95,  83,   5,  82,  89,  94,  89,  92,  95, 133, 133,   5,  83,  89,
- 92,  80,  92,  82, 129,  80,  92,   5,  89,  80, 133,  80,  89,  13,  92,
- 95,  83,  82,  82,  92,  80,  92,  92,  89,  80,  95,  95,  13,   7,  83,
- 92,  89, 133,  95,  83,  80, 128,  13,   7,  92, 133,   5,  80,  89,  92,
- 83,  82, 132,  13,  80,   5,  92,  94,  92, 133,  92,  83,  13,  89,  94,
-133,  89,  89,  82,  94,  94,  95,  94,  89,  89,  89,  94,  83,  82,  95,
-  7,  82,  13,  80,  83,  92,   5,  82,  95,  83,   7,  95,  95,  89,  82,
- 82,  89,   5,  95,  92,   7, 132, 133, 132,  83,  80,  83,  89,  83,  92,
- 95,  80,  95,   5,  94,  80,  89,  80,  80,  80,  83, 129,  89,  89,  95,
-129,   5,  82,  94,  89,  83, 132,  89,  13,  95,  80,  89,   5,  15,  95,
-132,  95,  89,   5,   5,  95,  89,  92, 132,   5,  94, 132, 132, 128,  95,
- 80,  80,  94,  89,   7,  80,  95,  89,  95,  83,  83,  94,  80, 133,   5,
- 13, 133,  92,   7, 132,  89,  80,  83,  92,  95,  82,   7,  15,   5,  95,
-133,   7,  92,  83,  82,  80,  83,  89, 129,   7,  80,  89, 132,  95, 133,
- 89,  82,  89, 129, 128,  80,  94,   5,  94,   7, 133,  83,  95,   5,  82,
- 92,  94,  83,  95,  95,  80, 129, 132, 133,  92,  95,  82,  13,  13,  95,
-  5,  13,  95,  94,  95, 132,  94,  92,  83, 133, 133,  92,  80,  95,  92,
- 82,  82,  92,  80, 129,  89,   7,   5,  80, 133,  95,  83,  15,  15,  94,
- 94,  83,  13, 133, 129,  89,  94,  92,  13,  95,   7,  13,  83,  89,  83,
- 80,  82, 132,  89,   7, 129, 129,  95,   5, 129,  13,  95,  89,  83,   5,
-  5, 255,  94,  94,  92,  95,  94,  80,  82, 133,  80,  95,  92,  80,  80,
- 94,  83,  82,  92,  13,  92,  95, 128,   7,  83,  83,  92,  89,   5,  89,
- 13,  83,   7, 133,  94, 132,  95,  95,  80,  83,  83,  94,  95,  89,  92,
- 83,   5,   5, 133,  80,   5,   5,  83, 133,  94, 132,  82,  94,   7,  95,
-  5,  92,   5, 133,   5, 133,  80,  80,   5,   5,  94, 133,  94, 133,  92,
-129,  92,  83,   7,  13, 133,  92,  92,  95,  92, 129,   7,   7,  95,  83,
- 13, 133, 133,  82,  92, 129, 133,  89,  83,  92,  83,  82,  95,  89,  82,
- 15,  95,  95,   7,   5,  92,  82,  92,  94,  83,  13,  83,   7,   7,  92,
-  7,  80, 132,  89,  92,  83,  92,  80,  82,  95,  95,  89,  80,  82,  83,
- 80,   7, 132, 133,   5, 128,  95,  80,  89, 132, 133,  89,   5,  83,  89,
-  7,  83, 132,  95, 133,  89,  95,   5,   5,  83,   5,  95,  82,  89,  89,
- 82,  92,  95,  92,  83, 129, 133,  83,  83,  89, 133, 128,  82,  95,  83,
- 80,  92,  95,  92,  89,   5,  92,  82,  94, 129, 129,  89,  82,  82,   7,
- 95,  92,  89,   7,  13,  95,  92,   5,  80,  89,  92,  92,  89,  92,  92,
- 94, 133, 133,  95,  13,  92,   5,  82,  80,  94,  13, 133,   7,  80, 132,
- 95,  83,  80,  83, 132, 133,  82, 129,  80,  95, 133,  92, 133,  80,  80,
- 95,  92,  82,  92,   5,  95, 133,  92,  83,  95, 132,  89,   7,  95,  95,
-  5,  83,   7,  13,  80, 132,  94,  95,  95, 133,  13,   5,   7,   5,  95,
- 95,  94,  92,  94,  80,  83, 129, 133,   7,  95,   5,  94,   5, 133,  95,
- 95,   5,  80,  95,   7,  95,  80,  83,  95,  80,  94, 132,  95,  83,  15,
- 89,  92,  83,  13,  94,  83, 129,  92,  94, 129,  80,  80,  95,  13,   5,
- 15,  89,   7,   5,  80,  15,  82,  83, 132,  95,  82,  95, 133, 132,   5,
- 13,  83,  89, 133, 132, 133,  13,   5,   5,   7,  83,   5,  95,  89,  83,
- 83,  82,  92,  89,  80,  82,  89,  92,  92,  80,  92,  94,   5,  92,  83,
- 89, 133, 129,  83, 255, 133,  92, 133,   5, 128,  92,  80, 133,   7,  89,
- 13,  80,  94,  83,   7, 133,  82,  80,   5, 133,  80,  95, 133,   5,  83,
- 95,  94,  92,  80, 132,  83,  92,  82,  83,  89,  92, 133,  95,   5,   7,
- 92,  92, 132,  83,   5,  95, 133,   7, 133,  89,  80,   5,   5, 133, 133,
- 80,  80,  92,  83,  95, 132,  95,  13,  94,  80,  80,  83,  83,  95, 133,
- 92,   7,  92,  92, 132,   7, 129,  92,  95,   5,   7, 132,  80,  92,  80,
- 92,  95,  92,  83,  92,  80,  83, 133,  83, 129,   7, 133,   5,  92,  94,
- 13,  95,  92,  95,  80,  95,  95,  95, 133,  83,  92,  92,  80,  95,  92,
- 92,  80,  80, 133,  95,  83,  92,  83,  95,  89,  82,  83,  83, 129,  95,
- 94,  89,  80, 133,   5,  89,  95,  89, 129,   7,  80,   5,  80,  83,  82,
- 80,  94,  13,  89,  82,  80,  83,  92,  94,   5, 129,  92,  13,  92, 132,
- 83, 132, 133,  83,   5,  82, 133,  95,   5,  83, 133,  89,  95, 132,   5,
- 94,  89,  89,  92,   5, 133,  95,  80,   5,  95,   7,  83, 133, 132,   7,
- 94,  83,  83,  95,   7,  89,  80,   7,  80,  92,  83,  82,  83,  95,  80,
- 92,  82,  92,   5,   7,  82,  94,  89,  95,  80,  83,  80,  95, 132,  95,
- 94,  95,  95,   7, 133,  15,  95,  94,  95,  92,  80,  83,  89, 132,  83,
- 89,  92, 133,  92,  80, 132, 132,  83, 132,  95,   5,  83, 133,  80, 132,
- 95,  80,  95,  95,   5, 132, 129, 133,  80, 129,   5,  89,  80,  95,  82,
- 13,   7,  80,  92,  92,  89, 129,   7,  95,  92,  95,  80,  83,   5,   5,
- 80, 132,  80, 133, 132,  92,  92,  95,  80, 132,  92, 128,  92, 132,  94,
-129,  95, 133,  92,  89,  80,  13,  83, 133,  80,  83,  92,  95, 133,  95,
- 94,  83,  92,  92,  83,  94,   5,   7,   7,  94,   5, 132,  92,   5, 132,
- 89, 129,  89, 132,  89,  95,  83,   5,   5,  80,  94, 133,  95,  95,  92,
-  7,  83,   5,  92,  92, 133, 133, 133, 132,  83,   5,  94,  95,  80,  95,
-  5,  80,   5, 129,   7,  95,  83,  80,  94,  95,  95,  92,  94, 129,  92,
- 83,  95, 133,  92,  95, 133,   5,  95,   7,  82, 129, 133,  83,  83,  92,
-132,  95, 129,  13,  92,  82,  94,  92,  83, 133,  80, 132,   7,  95, 132,
- 95,  95, 132,  83,   5,  82,  89, 129,  95,   5,  95,  95,  83,  80,  83,
- 83, 133,  13, 133,  82,  92,  95,  94,  80,  95, 133,  80,   5,  83,  83,
- 80,  95,  83,  80,  83, 128, 133,  80,  83,   7, 128,  83,   5,  83,  15,
- 83,  82,  83,  95,  15,  92,  95,  80,  13,  92,  13,   7, 132,   5, 128,
- 92,  80, 132,  95, 133,  80,  83,  95,  92,  89,  94,  94,  94,  80, 133,
- 92,  92, 132,  13,  80, 129, 133, 132,  83,  92, 133,   5, 132,   5,   7,
- 83,  80, 133,   5,  13,  83,  80,  83,  92,  83,  95,  80,  95,  95,  80,
- 80,  92, 133,  95,  95,  95,  95,  80,  80,  80, 133,  95, 133,  95,  89,
- 13,  80,  83,  95,  92,  95,  95,  92,  83,  80,  92,  95, 133,  95,   5,
- 80,  80,  80,  80,  80,  13,  92,  95, 133, 129,  92,  80, 132,  80,  83,
- 95,  92, 133,  95,  94,  95,  83,   7,  80,  83, 133,  13,  83,   7,  92,
-132,  94,  89, 133,  95,  80, 132,  95,   5,  83,  95,  95, 129,   5,  92,
-132,  92,  95,  95,  95,  95,  83,  83,  80,  83,   5, 133,  95, 129,  92,
-133,   5, 132,  80, 132,  83,  82,  95,  92,  83,  83,  95,   7,  92,  83,
-  7,  83, 132,   7,   5, 132, 133,  80,   5,  80,  92, 133, 132, 133,  83,
- 92,  80,  92,   7,  80, 133,  95,  95,  80,  13, 133,  94,  89,  94,  83,
- 83, 133,  83,  92,  92,  83,  83,  82, 132,  92,  80,  95,  80,  83,  83,
- 92,  83,  92,  92,  92,  80,  83, 133,  83,  89,  83,  92, 133, 129,  92,
-  5,   5, 133, 132,   7, 133,  15, 129, 133,  95,  80,  95, 129,  80,  83,
- 89,  92,  92,  92, 132,  94, 132,  80,  89, 132,  83,   7,  92,  95, 133,
-133,  80, 132, 133,  95,  89,  83,  95, 129,   7,  83,  83,  83,  13,  92,
-  7, 129, 133,  15,  89, 133,  13,  92,  83, 133,   7,   5,  83,   5,  92,
- 95,  80,  15,  80,  83,  80,  83,   5,  13,  83,  95, 129,  80,  82,  83,
- 95,  80,  95,   5,  83,  80, 129,  92,  95,  92,  13,  80,  95,  95,   5,
- 80,  80, 133,  83,  83, 133,  94, 132,  95,  83,  92,  94,  80,  95,   5,
- 82, 132, 132,  15,   5, 133,  89,  83, 255,  95,  80,  13, 133,  83,  92,
- 95,  92,  92, 128,  83, 129,   7,  95,  83,  80,  80,  83, 132,   7,  92,
- 83,  80,  83,  80,  95,  80,   5,  92,   5,  83,  92, 132,  83,   7,  80,
- 13,   5,  80,  80,  80,   5,  95,  95,  83,  80, 132,  95,  82,   7,  83,
- 92,  13,  80,  95,  80, 129, 129,  95,  80,  83, 133,  92,  92,  92,  95,
-128,  13, 132,  83,  92,  83,  95,  80,  83, 132,  92,  80,  83,  80,  92,
- 83,   7,  92,  13,  83,  95, 129,  95,  92,  83, 133,  95,  95, 133,  95,
- 83,  83,  95,  83,  92,  83,   7,   5,  82,  95, 133,  95,  92,   7,  95,
- 94,  92,  95, 133,  83,  92,   5,  80,  83, 129, 133,  80,  92, 133,  80,
- 95,  80,  89,  95,  83,  92,  80,  92,  80,  95,  95,  92,  95,  95,  80,
- 92,  83,  92,  83,   5,   7,  95,  80,   5,  80,   5,  83,  95,  83,   7,
- 83,  95, 133,  82,  80,  95,  80,  83, 133,  92,  92, 133,  83,  95,  95,
- 80,  95,  92,   5,  83,  80,  80,  95,  95,  83, 133,  80, 133,  13,  95,
-  7,   5, 133,  83,  15,   5, 132,  83,   7,  92,  92,  83, 132,  95,  83,
- 92,  92,  80,  95, 129,  83,  80,  83,  92,  83,  95,  92,  95,  95,  92,
- 80,  95,  80,  83,  95,  95,  95,  80,   5,  80,  83,  83, 133,  80,  92,
- 80,  83, 133,   7,  95,  83,  92,  80, 129,  80,  95,  95,  92,   5,  13,
-133, 129,  92,  95,  95,  80,  80,  92, 132,  92, 133, 128,   5,  83,  83,
- 13,  83, 133,  92,  95,  83,   7,  95, 133,  80,  13, 133,  95,  80,  83,
- 80,  83,  92,  95,  80,   5,  92,   5,   5,  83,  92,  83,   5,  92,   5,
- 83,  83, 133,  92,  95,  95,  92,  95,   5,  92,   5,  95,  13, 128,   5,
- 80,  13,  83,   7,  83,  83, 133,  80,  95,  95,  83,  13,  92, 133,  83,
- 95,  83,  80, 132,  92,   7,  83,  80,  95,  80,   7,  83, 133, 133,  83,
- 92,  80,  92,  92,  83, 132,  80,  95,  80,   5,  95,   5,  80,  80,  83,
- 95,  95,  80,  83,  92,  26,  95,  95,  83,  80, 152,  83,  80,  95,  26,
- 95, 154,  80,  92,  95,  80,  92,  92,  92,  83, 154, 152, 152,  26, 152,
-144, 154,  80,  95,  26,  95,  83,  92,  95,  83,  80, 154, 152,  83,  26,
- 95,  92,  80,  83,  83, 152, 144, 154,  80, 152, 152, 152,  27,  27,  95,
- 26, 154,  95,  92, 154,  83,  83,  95,  92,  83, 152,  83,  30, 154, 154,
- 92,  80,  83,  80, 154, 146,  80, 154,  26,  95,  95,  80,  92, 152,  26,
- 95,  92,  95,  95,  80,  80,  95, 152, 154,  92,  95,  26, 152,  95,  27,
- 80,  80,  95,  80,  93,  80, 152,  92,  27,  80, 144,  92,  26,  95, 146,
- 26,  26,  31,  83,  92,  83,  92,  95,  92,  83,  92,  95,  92,  92,  92,
-152, 154,  83,  95,  95,  83,  80, 154,  83,  80,  95,  92,  80,  92, 146,
-152,  95,  26, 146,  83,  83, 146,  83, 146,  80,  26,  80, 154, 146,  83,
- 95,  83, 152,  80, 152,  80,  83,  92,  30,  95,  83,  92, 146,  95,  27,
- 92,  80,  27,  80,  80,  83, 152,  95,  83, 152,  95,  81,  26, 154, 154,
-152,  80,  30,  86,  92, 154,  80,  27,  92,  92,  83,  83,  95, 146,  80,
- 92,  92,  83,  80,  92,  95,  95,  92,  26,  83,  83, 154, 152, 152,  26,
- 80, 154,  26,  83,  26,  95,  80,  26,  83,  95, 154,  31,  92, 152,  95,
-154,  80, 154,  83,  80,  83,  27,  83,  95,  95,  26,  26,  80,  92,  26,
-152,  27,  92,  83, 152,  80,  93,  86,  92,  83,  80,  92,  26,  83,  80,
-146,  83, 144,  95,  95, 154,  92,  80, 154,  92,  83,  93,  92,  80,  30,
- 95,  92,  95,  95,  80,  92,  26,  80, 146,  30,  80,  30,  95,  92,  92,
- 92,  95,  95,  27,  26,  95,  93,  80,  92,  80, 152, 154, 154,  95, 154,
- 95,  80,  95,  95,  95,  83,  27,  80,  80,  95,  80,  95,  26,  95,  83,
- 83, 154,  95,  83,  83, 154,  86,  95,  95, 152,  92,  27,  26,  27, 152,
- 26,  80, 154,  80,  26,  81,  80,  92,  80, 154,  26,  83,  26, 154, 154,
- 80, 152,  81,  95,  95,  26,  83,  95,  83,  83,  80,  80, 144,  26,  92,
- 95,  80,  95,  80,  92, 154,  95,  83,  80,  83,  26, 154,  26,  83,  26,
- 81,  92,  92, 154,  27,  83,  95,  27,  30,  83, 255,  83,  92,  92,  92,
- 92,  83,  80,  92, 154,  95,  83,  27,  26,  80, 152,  26, 152,  80,  27,
- 86,  30,  92,  83,  92,  83,  80, 144, 154, 152,  80,  27,  30,  95,  95,
-154,  95,  86,  92, 144,  92,  95,  80,  95,  83,  80,  80,  80,  80, 154,
- 27,  95,  86,  83,  83,  26,  83,  80,  30, 152,  83,  95,  95, 152,  80,
-152,  80,  83, 154,  83, 144,  26,  92,  83,  95,  26,  83,  92, 154,  83,
- 95, 152,  30,  92,  92, 152,  80,  83, 152,  80,  80,  30,  30,  92,  95,
- 30,  80,  92,  95, 146,  83,  26, 152, 154,  27,  83,  83,  92,  83,  95,
- 95,  80,  95,  80, 154,  27, 146, 146, 154,  95,  95, 146,  95,  86,  80,
- 27,  92,  92,  92,  95,  92, 146,  30,  80,  80,  95,  95,  95,  83,  83,
-152,  27, 154,  83,  92,  92,  31, 154,  93,  27,  80,  27, 154,  30, 152,
- 93,  80,  80,  92,  95, 146,  80, 154,  83,  95,  81,  92,  95,  92,  93,
- 92,  83,  86,  80,  80,  83,  86, 154, 154,  27,  86, 152,  80, 144,  95,
- 31,  30,  95,  95,  80,  92,  92,  92,  95, 152,  30,  86,  80,  95,  80,
- 93,  86,  80,  93,  95,  83,  26,  92,  80, 152,  92,  92,  92,  80,  95,
- 26,  83,  92,  83,  80,  26,  80,  95,  95,  80,  26,  30,  83,  92, 152,
- 92,  95,  95,  92,  95,  80,  83,  80,  81,  83,  95,  95,  80,  83,  92,
-146,  95, 154, 152,  26,  95,  95,  26,  92, 154,  80,  83,  30,  95, 154,
- 95, 152,  95,  93,  95,  95, 144,  95, 144,  95,  26,  95,  83,  83,  95,
- 27,  83,  80,  81, 152,  95,  95, 144, 154, 154,  83,  80, 152, 152, 154,
- 80,  92,  26, 154,  27,  83,  92, 154,  26,  26,  95,  92, 152,  26,  26,
- 83,  95,  95,  83,  95,  83,  92, 154,  95, 146,  95,  92,  92,  26, 154,
- 30, 154,  92,  83, 146,  83, 154,  31,  92,  95,  83, 152, 154,  80, 154,
- 83,  92,  92,  95,  83,  80,  92,  80,  83,  92, 144,  83, 152,  95, 154,
- 26,  26,  27,  83,  30,  83,  92,  92,  92,  92,  83, 146,  81,  95,  83,
- 83,  81,  83,  81,  81,  26, 154,  27,  26,  92, 154,  92,  92,  95,  93,
- 93, 154,  83, 154,  80, 154,  95, 154,  95,  80,  92,  83,  80,  81,  95,
- 83,  80,  30,  92,  95,  83,  26,  92, 152,  80,  26,  93, 154,  26,  80,
- 80,  93,  26, 154,  95,  95, 154,  80, 144,  81,  95,  86,  83,  80,  80,
- 92,  92,  83,  95,  92,  83,  80,  95,  92,  92, 146,  27, 154,  93,  27,
-154, 146,  27,  86,  92,  80,  80, 154,  86,  92,  95,  92,  92, 154,  83,
- 26,  83,  83, 154,  31,  83, 146,  80,  95,  92,  83, 152,  31,  80,  86,
- 80,  83,  92,  95, 146, 154, 154,  27,  95, 154, 146, 154,  80,  95,  80,
- 81,  95, 152,  92,  26,  30,  95,  95,  30, 154,  80,  81, 146,  95,  95,
- 92, 152,  95, 144, 152,  27,  92,  27,  26,  26,  30,  92, 152,  83,  83,
- 80,  93,  83,  26,  86,  83, 152,  26, 154,  95,  27,  26,  80,  95,  86,
- 80,  92,  95,  80,  92,  26,  26,  80,  27, 154, 146,  26,  95, 152,  93,
-154,  80,  26,  83,  83,  93,  83,  83, 146,  92,  83, 152,  93,  83,  30,
- 80,  92,  27,  26, 154,  26,  80,  27,  26,  95,  80,  92,  26, 152,  86,
- 80,  92,  81,  26,  80,  95,  80,  86,  83,  83,  86,  92, 154,  80,  81,
-152,  83,  30,  86,  26,  95,  92,  95, 154,  83,  81, 152,  26,  27,  83,
-152,  93,  83, 154,  83,  86,  30,  27,  83,  86,  95,  92, 146,  95,  92,
- 93, 146,  92,  93,  92,  95,  27,  80,  27, 152,  92,  26,  83,  80, 152,
- 95,  92, 152,  26,  80,  95,  95,  26,  26,  95,  80,  27,  31,  80,  80,
- 83,  83,  80,  95,  80,  83,  80, 154, 152,  80,  81,  80,  26,  83,  80,
- 80,  86, 146,  95, 154,  80,  26,  80,  80,  26,  80, 154,  86,  81,  83,
- 30,  27,  93,  92, 154,  80,  92,  83, 154,  31,  95,  93,  92,  30,  95,
- 80,  86,  80,  92,  92,  95,  93,  92,  83, 152, 144,  92, 154,  80,  92,
- 83,  83,  93,  26,  86,  92,  83,  80,  80,  92, 154, 144,  26,  83,  95,
- 83,  83,  92,  27,  81,  92,  95, 152,  93,  92,  93,  80, 154,  27,  83,
- 80,  86,  86, 154,  95, 152,  26,  83,  95, 146,  80, 154,  83,  92, 146,
- 26,  93,  81,  80,  26,  95,  86,  80,  86, 146,  83,  95,  26,  83,  83,
- 26,  95,  26, 152,  27, 154,  80,  93,  30,  95,  86,  93,  80, 154,  92,
-154, 154,  30, 152,  92,  31,  81,  92,  80,  81,  26,  26,  83, 154,  26,
-154,  92, 154,  86,  92,  95,  93,  95,  92,  80,  92,  27, 152,  26,  92,
- 81,  80, 154,  95,  83,  92,  80,  86,  26,  83, 146,  92,  92,  83,  27,
- 86,  86,  80, 154,  81,  86,  81, 154,  83, 146,  93,  83, 152,  83,  86,
- 93,  80,  83,  80,  26, 146,  92,  26,  83,  30,  93, 146,  26,  95,  30,
- 30,  80,  83, 146,  86,  95,  83, 154,  92,  81,  95,  26, 152,  92, 146,
- 92, 154,  93,  95,  93,  26,  30,  81, 152,  93, 146,  95,  80, 152,  83,
- 92,  95,  95,  83,  93,  83,  86,  93, 152,  86,  80,  83, 154,  92,  26,
- 86,  86,  81,  26,  92,  30,  93,  81,  95, 152,  95,  30, 146,  92, 154,
- 27,  93,  81,  81,  26,  83,  92,  30,  83,  92,  86, 154,  95,  26,  93,
-154,  86, 152,  26,  95,  81, 154,  92, 154,  83,  27,  80,  95,  92,  26,
- 95,  30, 154,  27,  26,  86,  86,  26, 152, 154,  86,  81, 154,  80,  26,
- 93,  95,  27,  80,  92,  92, 154,  86, 152,  80,  81,  93,  92, 152,  95,
- 95,  86, 144,  95,  83,  27,  93,  83,  93,  83,  92,  80,  80,  83, 154,
- 81,  83,  80, 154,  81,  95,  83, 146,  86,  26,  95, 154,  80, 154,  80,
-152,  80,  83, 154,  26,  80,  95,  93,  93,  81, 144,  80,  92,  95,  80,
- 95,  80,  92,  83,  92,  95,  81, 154,  81,  30, 152,  95,  83,  80,  93,
- 92,  81, 154,  26,  80,  80,  93,  26, 152,  83,  92,  80,  80,  81,  27,
- 26,  95,  93,  92,  26,  26,  26,  30,  27,  95,  93,  27,  80,  95,  83,
- 92,  92,  95,  31,  26,  83,  26,  86,  80, 152,  26,  26, 152, 154,  31,
- 81,  92,  93,  31,  86,  81,  26,  95, 154,  26,  26,  83, 152, 154,  93,
- 95,  95,  80, 152,  26, 154,  30,  83, 154,  27,  92,  86,  86,  80,  27,
- 26, 152,  95,  81, 152,  92,  92, 152,  86,  86,  27,  83,  83,  80, 152,
- 30,  81, 146,  30,  27,  86, 154,  27,  92,  26,  27,  83,  81, 154, 146,
- 95,  80,  30,  83,  92, 144,  86,  26, 154, 146, 152,  83,  95,  93,  92,
-152,  83, 154,  83,  30,  95,  26,  26,  92,  93,  80,  93,  92,  83, 152,
- 80,  93,  95,  92,  27, 154,  92,  83,  83,  92, 152,  83,  30,  83, 146,
- 92,  80,  95,  93,  80,  26,  26,  81, 146,  92,  92,  81, 154,  95,  92,
- 93,  81, 154,  26,  93,  95,  27,  81,  26, 154,  92,  86,  86,  83,  95,
- 86,  27,  80,  30, 152,  95,  95, 146, 146,  80,  80,  93,  83,  27, 154,
-154,  93,  80, 146,  93, 146,  92,  93,  80, 154,  92,  95,  26,  30,  26,
- 27,  27,  81,  83, 152,  30,  80,  93, 152,  80,  92,  81,  92,  83,  26,
- 93,  83, 154, 154, 154,  80,  80,  26, 154, 154, 154,  83,  30,  83,  83,
- 81,  95,  81,  86, 152,  80,  27,  26,  26,  92,  27,  95,  95,  81, 154,
- 83, 154,  83,  26,  80,  93, 154,  86, 154,  83,  95,  80,  26,  86,  83,
- 92, 154,  80,  27,  92,  30, 152,  86, 146,  31,  30,  26, 154,  83, 154,
- 80,  86,  95,  26,  93,  81,  81,  95,  80,  95,  80,  93,  86, 154,  83,
-154,  80,  30,  30,  92,  93, 154, 152, 154,  80,  80,  26,  92, 152,  92,
- 27,  31,  83,  95,  92, 144,  81, 154, 152,  80, 152,  83,  86,  93, 144,
- 92,  86,  95, 152,  81,  86,  26,  92,  95,  30,  83,  92, 154,  81,  80,
- 83,  81,  86,  26, 154,  95, 146,  93,  80,  83,  26, 154,  81,  26, 146,
- 86,  93,  83, 152,  83, 152,  80,  86,  93,  92,  93,  27,  95,  80,  30,
- 81,  95,  27, 154,  93,  27,  83,  81,  81,  95, 154,  80, 152,  83,  26,
- 83,  93,  31,  86,  80,  92,  26,  27,  86,  26,  95,  81, 154,  95,  93,
- 92,  81,  86, 144, 154, 154,  80,  83,  80,  83,  83,  86,  26,  93,  83,
- 95,  80,  27,  95,  80,  27,  81,  80,  27,  81,  92,  83,  92,  26, 154,
- 27,  93,  93,  80,  95,  26,  80, 152,  93,  27,  81, 154,  92,  27, 154,
- 81,  86,  81,  26,  95,  95,  95,  27,  80,  95, 152,  26,  93,  31, 152,
- 30,  95, 146,  92, 152, 154, 146, 154, 146,  81, 154,  86,  92,  86,  30,
- 80,  95,  86,  93,  80,  80, 152, 154,  80, 154,  26,  86, 152,  93,  81,
-154,  95,  27,  95,  95,  83,  86, 152,  92,  95,  30,  86,  27,  31,  26,
-146,  26,  92,  93,  93,  92, 146,  95,  26,  26,  26, 154,  80,  26, 154,
-154,  80, 154,  80,  93,  83,  81,  86,  86,  86,  26,  92,  86,  95,  93,
- 80,  26,  92,  93,  27,  80,  95,  81,  81,  93,  93, 152,  92,  95,  27,
-152,  81,  83,  26,  80,  80,  95,  83,  80,  81,  83,  26,  93, 154,  86,
- 81,  92,  86, 152,  80,  86,  81,  26,  93, 154,  86,  86,  26,  92,  86,
- 27,  80,  30, 152, 154, 146,  83,  30,  92, 154,  92,  93, 146,  92,  26,
- 80, 154,  95,  31,  26, 154, 154,  83,  27,  81,  93,  80,  30, 152,  80,
-152,  26, 146,  83,  81, 152,  81, 154,  92,  26, 154, 154, 144,  80, 154,
-152,  30,  26,  92,  26,  92,  26,  93,  26,  86,  26,  27,  92,  86,  92,
-154,  93,  26,  93,  26,  86,  93, 154,  80, 154, 154,  92,  26, 154,  83,
- 95,  81,  26,  86,  80, 146, 146,  93,  95,  27,  26,  83, 154, 144, 152,
- 95,  26, 154,  93,  92,  81, 146,  93, 152,  81,  83,  27,  81,  81,  27,
- 95,  92,  92,  83,  80,  86, 152,  86,  93, 154, 152,  80,  92,  83, 152,
-152, 152,  80, 154,  26,  93,  95,  81,  92,  93, 146, 154,  26,  30,  93,
- 93,  93,  26,  95,  93,  86,  81, 154,  27,  80,  86, 154, 146,  80,  86,
- 86,  93, 154,  93,  26, 152, 154,  81, 154,  86,  86,  30,  30,  92, 154,
- 92,  86,  92,  27, 154,  27,  86,  83,  83,  95,  27,  86,  93,  93, 146,
-154,  30,  27,  95,  27,  92,  83,  95,  27, 152,  81, 154,  86,  26,  27,
- 93,  92,  31,  83,  83,  30,  86,  27,  86,  95,  26,  26,  81,  26,  95,
- 81,  27,  93,  93, 154,  86,  27,  92,  26,  26,  81,  83,  80,  80,  81,
- 86,  27,  81,  93,  80,  92,  86,  86,  86,  81,  86, 152, 154, 152,  83,
- 83, 154, 154, 144,  27,  80,  81,  93,  86,  80, 152,  92,  93,  27,  26,
- 86,  86,  86,  81, 152,  26, 154,  95,  93,  26,  86,  86,  86, 152, 146,
- 80, 154,  81, 154,  86,  81,  80, 154,  81, 152,  83, 146,  86, 154,  92,
- 86,  80,  93,  93,  95,  92,  93, 152,  86,  80,  81,  81, 154,  81,  93,
- 86, 152,  81,  95,  80,  30,  95,  27,  81,  31,  26,  92,  95,  95,  93,
- 80,  95,  92,  92,  86,  93,  93,  93,  86, 154, 152,  86,  26, 154,  31,
- 80,  92, 144,  26,  93, 152,  93,  86,  93,  93, 146,  83,  26, 154,  95,
- 81,  86,  81, 154,  26,  30,  80,  80,  80,  86, 152,  30,  92,  86,  30,
-144,  81, 154,  86,  93,  83,  93, 154, 152,  92,  83,  86,  83,  27, 154,
- 26, 152,  83, 154,  26,  93,  95,  27,  26,  93,  93,  26,  26,  95,  86,
- 31,  83,  95,  83,  30,  83, 154,  86,  30, 154,  95,  81, 144,  86,  95,
- 80,  92,  81,  86,  26, 154, 154,  81, 152, 154,  26,  80,  83, 154,  26,
- 95,  83,  93,  80,  30,  26, 152,  26,  86,  92,  83,  92,  83, 146,  27,
-154,  86,  86, 154,  86, 154,  26,  26,  27,  31,  95,  83, 152,  93, 154,
-154,  92, 144, 154, 154,  93,  86,  30,  95,  30, 154, 154,  26,  86,  27,
- 93, 152,  26,  81, 154,  92,  86, 146,  81,  83,  81,  26, 154,  80,  92,
- 26, 152,  93,  81,  92,  86,  31, 146,  26, 152,  81,  86, 154,  26, 154,
- 86,  83, 152, 152,  95,  83, 144,  30,  86,  92, 154,  93,  81,  95,  26,
- 27,  30,  92,  31,  83,  26,  86,  81, 154,  93,  27, 152,  81,  93, 152,
- 26,  92, 154,  26,  30,  93, 154,  80,  81,  95,  92, 154,  26, 146,  26,
- 93,  80,  92,  26,  83,  83, 152,  26, 152,  95,  27,  83,  95,  81, 154,
- 27,  95,  86,  86,  92, 152,  26,  95,  93,  27,  93,  95,  27, 146,  81,
- 81,  26, 154,  81,  27,  86,  86, 146,  26,  93,  86, 154,  81,  30,  86,
- 83, 146, 154,  27,  81, 146,  80,  27,  81,  93,  81,  93, 154,  93, 152,
- 26,  95,  80,  92,  27,  86,  86,  83, 154,  93,  83,  93, 154,  80,  26,
- 26, 154,  30,  93,  95,  81, 154, 146,  26, 154,  30, 154, 152,  26,  81,
- 92,  92,  93, 152,  86, 154, 146, 154,  92, 146,  81, 154, 255,  81, 152,
- 27,  80, 154,  86,  83,  86,  80,  83,  81,  92,  27,  81,  81,  81,  81,
- 27,  26, 154,  93, 154,  93,  86,  26,  27,  95,  93,  86,  92,  93,  86,
- 86,  92,  26, 154,  93,  86, 154,  95,  92,  92,  26,  83, 152, 146, 154,
- 81, 154,  86,  86,  95,  86,  81,  81,  80, 146,  80,  86, 152,  86,  93,
- 93,  26,  26,  26,  93,  30, 152,  86,  80,  86, 146,  27,  83,  93,  27,
- 92,  93,  27,  93,  86, 146, 154,  27, 154,  93, 154,  81,  86,  92,  27,
-152, 154,  93,  95,  30, 152,  27,  93,  81, 152,  81,  86,  27,  26,  92,
- 92, 154,  80,  86, 154,  80,  93,  31,  26,  81,  86,  86,  86, 152,  83,
- 26,  80,  95, 152,  27,  83,  81, 152,  92,  26,  81, 154,  83,  93, 154,
- 27,  92, 154,  80,  95, 152, 154,  31, 154,  86,  80,  83,  26,  81, 146,
- 95,  31,  93,  95,  86,  92,  93,  86,  26,  81,  26, 154, 146, 154,  81,
- 26,  86, 154, 154,  93,  81, 154,  27,  81,  93,  26,  26,  26,  93,  27,
- 92,  93,  81,  31, 152, 152,  81,  26,  93,  80, 154,  80,  30,  81,  27,
- 81,  93,  93,  86, 152, 154,  86, 152,  80,  81,  83,  81,  95,  26, 146,
- 26,  86, 146, 146,  92, 154,  80,  92, 154, 154, 152, 154, 154,  86,  26,
- 86,  93,  26,  93,  27,  93,  81,  86,  93, 144, 152,  93,  80, 146,  95,
- 81,  86,  81,  93,  92,  80,  86,  93,  92,  26, 154, 146,  83,  30,  27,
-152,  81,  86,  86,  86,  26,  81,  86, 152,  86,  93,  86,  86,  86,  93,
- 27,  86,  83,  93,  26,  81,  83,  95,  27,  27,  81,  93, 154,  86,  93,
- 92,  93,  26,  93, 154,  86,  83,  86,  26, 154,  93, 152,  26,  26,  26,
- 26, 152,  81,  92,  81,  92, 152, 154,  93,  95, 146,  26,  81,  86, 152,
- 81,  93, 154,  80, 152, 154,  81,  80,  93,  93,  80,  86, 152,  92,  81,
-154,  92,  93, 154,  95,  81,  81,  26, 152, 154,  86,  27,  27,  30,  26,
-154,  81,  93, 146,  31, 152,  26,  27,  27,  95,  93,  81,  95, 152,  26,
-154, 255, 152,  86,  95,  81,  86,  86,  92, 154, 146,  26,  27, 154,  26,
- 86,  83, 154,  26, 152,  81,  86,  31,  80, 154,  92,  86,  26, 152,  81,
- 83, 154,  81,  30, 146, 154,  86, 152, 154,  27,  86, 152, 152,  93,  26,
- 26,  81, 154,  92,  80,  83, 154,  86,  26, 154,  93,  83,  81,  27,  27,
- 81,  26,  81,  93, 152, 154, 154,  81,  93, 154,  83,  26, 146,  86,  26,
- 86,  86,  86,  81,  26,  95, 154,  26,  86,  26,  93,  27,  27,  30,  31,
- 81,  93,  81,  81, 154,  93,  93,  86,  30, 146,  81,  80,  92,  80,  95,
- 93,  30, 154,  26, 154,  27,  27,  27,  81,  81, 154, 154,  81,  81,  95,
- 81,  95,  95,  86,  81,  27,  30,  86,  93, 152, 152,  83,  80, 154,  93,
- 30,  26,  86,  93,  26, 146,  93,  81,  86,  31,  26,  86,  86, 154, 152,
-152,  86,  81,  81, 154,  93,  26,  26,  86,  81,  30, 144,  26, 154,  81,
- 26,  30,  81,  95, 152,  30, 146, 152,  30,  86,  81,  26, 154,  93,  26,
-154,  80,  86, 154,  86, 152,  93, 146,  86,  86, 152,  93,  27, 146, 154,
- 93, 154, 154, 152,  81,  27,  86, 154,  95, 152,  81,  86, 154, 154,  81,
- 93,  93,  80, 154,  81,  92,  83,  26,  92,  95,  93, 152,  92,  93, 152,
- 27, 146,  93,  93,  86, 154,  93,  86,  27,  81,  26,  27,  86, 144, 154,
- 93,  93,  81,  81,  26, 154,  93,  26, 154,  26, 154,  86, 146,  83,  86,
- 27,  93,  86,  86,  93,  81, 154,  26,  30,  86,  86,  93,  86,  26,  83,
- 26, 152, 152,  93,  92,  93,  95,  27,  27,  27,  27,  31,  27,  30,  86,
-146,  27,  81,  95,  30,  93,  27,  27,  86,  93,  31,  81,  95, 152,  86,
- 26,  80, 146,  26,  92, 152, 152,  26,  27,  86, 154, 154,  27,  30,  26,
- 93,  86,  26,  81,  93,  86, 152,  81,  27, 152, 154,  86,  95, 152,  81,
- 93,  26, 144, 154,  93,  81,  26, 154, 154, 146,  26, 154,  26,  30, 154,
- 81,  80,  86, 154,  26,  86,  81,  86,  86, 154,  92,  26,  93, 152,  81,
-154, 146,  93,  80, 152, 152,  26,  26,  30, 154,  93,  81,  86,  93, 146,
-154,  26, 152,  30, 154,  86,  81,  83,  86, 154,  80, 154,  81,  93,  93,
-154, 154,  26, 154,  26,  26,  81, 154,  86,  30,  81, 154,  81,  30,  81,
-154,  81,  26,  93,  86,  93,  81,  93,  95,  86,  81,  93,  93, 152,  81,
-152, 144, 152,  26,  81, 255, 146,  86, 154, 255,  80, 152,  27,  93,  86,
-154,  93,  26, 152, 152,  93,  86,  81,  93,  81,  31, 154,  93,  81,  26,
-154,  80,  81,  26,  86, 154,  93, 144, 154,  93,  81,  81,  86,  93,  86,
- 86,  83, 154,  93,  93,  26,  86,  93,  26,  30,  93,  26,  92, 154,  81,
-154,  86,  31,  86,  81,  86,  26,  27,  26, 152,  86, 144,  81,  26,  86,
- 81, 152, 154,  81,  92,  31,  93,  86,  26,  27,  86,  30,  30, 154,  81,
- 93,  92,  86,  26,  26,  92,  26, 152, 154,  81,  26,  27, 154,  93,  26,
- 27, 154,  26, 154,  95, 154, 154,  26,  86,  26,  93,  81, 146,  92,  27,
- 30,  80,  93,  30,  30,  86,  81,  93,  26,  27, 154, 146,  86,  80,  86,
- 26,  92,  26,  86,  86,  86,  27, 154,  93,  93,  93,  86, 154,  86,  93,
- 93, 146,  93, 154,  95,  31,  93, 152,  81,  93,  93,  30,  86,  93,  86,
- 86,  81,  86,  81,  81,  92,  81,  30,  81,  86, 146,  81,  81, 152,  81,
- 26, 152,  86, 154,  93, 154,  86,  81,  26,  93,  95,  26,  81,  92, 154,
- 93,  26,  93,  86, 154,  81,  26,  86,  26,  83,  81,  26,  86, 144,  81,
-154, 154,  86, 146, 152, 154,  81,  30,  83, 146,  86, 146, 154,  26,  81,
- 30,  93,  81,  81,  26,  93, 154,  26, 154,  86,  93, 154,  81, 154, 152,
- 26,  81,  81, 152,  93,  30, 146, 154, 146,  81,  26, 154,  81,  27,  30,
-154,  86,  30, 154,  83,  93,  27,  93,  30,  26,  26, 154, 152,  31, 152,
-154,  81,  26,  86,  81,  26, 154,  86,  86,  93, 154,  86,  93,  26,  81,
- 81,  86,  81, 152, 152,  93,  27,  26, 152, 154,  80, 152,  93,  26, 154,
- 81,  81,  26,  26,  93,  27, 154,  93,  26,  27,  93,  81, 154,  26,  30,
- 81,  86,  86, 146,  81,  93,  27,  93,  81,  27,  81,  81,  86,  86, 152,
- 26,  86, 154,  81,  93,  27,  86,  81, 152, 152, 146,  30,  93, 154,  27,
- 81, 154, 152, 154,  93,  86,  26,  86,  81,  86,  26,  81,  26, 152, 154,
- 93,  86, 146, 154,  93,  93,  86,  27,  26,  27,  27, 154,  93,  86,  93,
-146,  26,  27,  93,  26, 152, 154, 152,  81,  81,  86,  93,  93, 154,  93,
- 27, 154,  27, 152,  93,  81, 152,  86,  26,  81,  86,  27,  26,  26,  30,
- 93,  93,  26,  26, 152,  86, 154, 146,  27, 154,  26,  86,  26,  81,  93,
- 27, 154,  86,  26,  27,  93,  86,  86,  86, 144,  86, 154, 154,  30, 152,
- 93,  31,  81,  26,  26,  86, 154,  93,  81,  26,  27,  93, 152,  93, 152,
- 81,  93,  86,  30, 152,  26,  86,  81,  86,  81,  27,  27,  81, 152,  93,
- 93, 146,  86, 154,  93, 152,  93, 146,  93, 154,  81, 146,  93,  86, 154,
- 86,  26, 154, 152,  81,  86,  93,  81, 154,  81,  26, 144,  81,  26, 154,
- 86, 154,  86,  27,  93,  81,  26,  93,  31,  26, 154, 154,  93,  81,  93,
- 81,  81,  81,  26, 146, 152,  93,  81,  93,  26,  86, 154,  26,  93,  86,
-154,  81,  86, 154,  93,  81,  81, 146,  81,  26, 154, 146,  86,  86,  27,
- 86, 152, 152,  86,  93, 154,  81,  86,  81,  86,  26,  81,  27,  93, 146,
- 26,  86,  81, 154,  30,  81,  26,  81,  26,  81,  81,  81,  26,  30, 152,
- 86,  93,  26,  26, 154, 144, 154, 154,  27,  31,  81,  27,  81,  27,  81,
- 86,  26,  93,  93,  27,  30,  93, 154, 152,  81,  81,  93,  81, 144,  93,
-144,  86, 154,  86,  86,  93,  81,  81,  24, 152,  27,  81, 152,  86,  81,
- 86, 154, 152,  86, 154,  26, 154,  26,  86, 154, 154,  26,  93,  93,  27,
- 86,  93,  81,  26, 152,  26,  26, 155,  81,  27, 144,  86, 154,  31,  81,
-154,  93, 146,  81,  87,  26,  81,  24,  81,  93, 152,  86, 154,  93,  26,
- 86, 152,  27,  93,  86,  93,  86,  93,  81, 146,  81, 152,  93,  86,  30,
- 86, 154, 154, 154,  93,  26,  81,  81,  93, 154,  30,  26,  81, 144,  30,
-154,  26,  81, 154,  93,  30,  26,  81,  86,  93,  26,  81,  27, 152, 144,
-152,  24,  27,  26,  86,  81,  93,  86,  86, 154, 154, 154,  86,  86, 152,
-154,  86,  26,  26,  86,  81,  86,  93,  26,  81, 154,  81,  26,  93,  86,
- 93,  86, 154, 154,  30,  86, 154, 154,  26, 146, 154,  93, 152,  86,  27,
-152, 154,  93,  81,  93, 154,  81,  86, 152, 154,  93,  86,  86,  26,  86,
-154,  26,  86,  81,  81,  86,  86, 154,  86, 152,  31,  26,  81,  26,  86,
- 81,  81,  81, 152,  86,  27,  81,  31, 152, 154,  86,  26,  27,  30,  26,
- 26, 146, 154,  26,  87,  93,  86,  81,  93,  81,  26,  81,  86, 154, 155,
- 81,  81,  81,  26, 146, 154,  93,  81,  93,  30,  27, 154,  86, 152,  27,
- 81,  86,  93,  93,  93,  27, 154,  93,  93,  93,  81,  81, 155,  86,  81,
- 93, 152,  26,  81,  30,  87,  81,  86,  81, 154,  93,  86, 154,  86,  84,
-154, 154,  86, 154,  26, 255,  81,  81,  26,  86,  27,  93,  93,  26,  81,
- 27,  81,  86, 144, 154, 146, 146,  93,  27, 152,  26,  81,  81,  93,  81,
- 86,  26,  81,  86, 155,  81,  81,  26,  93,  27,  93,  81,  26,  81, 154,
-144, 152, 154,  26, 152, 154,  86,  81, 152,  27,  27, 154,  27,  30,  26,
-152,  93,  93, 152, 146, 154,  86,  81,  93,  26,  87,  81, 152, 154,  93,
-154,  26,  26,  86,  26,  81, 152,  93,  26,  81,  93,  81,  86,  27, 155,
- 27,  27,  86,  26,  81, 154,  81, 152, 146,  93,  81,  81,  30,  26,  81,
-152, 144,  86,  81,  93, 152, 154,  81, 146,  87, 155,  86, 154,  81,  24,
- 84,  81, 152,  86,  86, 144,  81, 155, 154,  26,  24, 152, 155,  84,  81,
- 30,  86,  93, 154,  86, 154,  81,  26,  93,  81, 152,  81,  26, 154,  30,
-152,  81,  81,  81, 155,  84, 152,  86,  93,  93,  81,  81,  30,  26,  27,
-154,  30,  81, 154, 144,  93,  81,  27,  30,  27,  27,  26,  26,  84, 155,
- 87,  93, 144,  86,  87,  26,  86,  81,  26, 154, 154,  93, 154,  81,  81,
-154,  81, 146, 152, 144,  86,  26, 152, 152,  26, 155,  93,  93,  86, 152,
- 93,  87,  86,  86,  81, 154,  86,  81,  86,  86, 154,  86,  81, 154, 154,
- 86, 146,  93,  26, 152,  30,  93,  86,  31,  26, 146, 154,  81, 146,  26,
- 26,  93,  86,  93,  93,  86,  81,  87,  81,  93,  86,  27,  27,  93,  93,
-154,  81,  81,  93,  86,  86, 155,  86, 152,  86, 152,  81,  31,  93,  86,
-154, 154,  27,  81,  86,  86, 154, 154,  86, 154, 146, 154,  86,  86,  26,
- 27,  26,  26, 146,  86,  86, 154,  81,  81,  31, 146,  93, 152,  81,  86,
-154, 152, 154,  26,  81,  81,  31,  26, 154,  87, 154,  93,  93, 152,  81,
- 27,  86,  26, 154, 152,  81,  86,  81, 154,  93,  81,  26, 155,  30,  26,
-154, 154,  24,  27,  24,  26,  27, 154,  24,  93, 154,  26,  81,  86,  86,
- 26, 154,  81, 152,  26, 152, 152,  93,  87,  27,  81,  81, 146,  81,  30,
- 84,  84,  81, 154,  81,  26,  81,  87,  81,  81,  27,  93,  81,  26,  86,
- 27, 152,  81, 152, 155,  81, 154,  93,  24, 154,  27,  86, 154,  26,  30,
- 26,  86, 146,  30,  84,  86, 154,  84,  81, 154, 146,  81, 152,  93,  81,
- 26,  87, 152,  86,  86,  81,  81,  93,  86,  24,  81,  24, 154,  26,  24,
-146,  81,  81,  81, 152, 144, 155,  27,  31, 154,  26,  81,  86,  87,  93,
- 26,  30,  81,  27,  86, 152,  31, 155,  81,  26,  81, 154, 146,  86,  81,
- 81,  26,  86,  86, 154, 154,  26, 146,  86,  86,  86,  81,  81, 155,  93,
- 86,  93,  81,  81,  86, 154,  81, 155,  87, 154,  93,  93,  87, 154,  93,
- 30,  27,  81, 152,  27,  81, 154,  93,  93,  93,  93,  86,  30,  81,  26,
- 86,  81,  93, 154, 154,  81,  81,  27,  26,  24, 155, 154, 155,  87,  30,
- 86,  26,  86, 154, 152,  93,  86,  81, 146,  81,  30,  27,  86,  86,  93,
- 93,  93,  86,  86,  30,  27,  81,  81,  81, 154,  81,  93,  86,  86, 154,
- 84, 154,  86,  93,  87,  81,  84,  93,  81,  27, 154, 154,  86,  93,  26,
-155,  26,  24, 146,  81,  86,  81,  93,  84,  93,  26,  84,  26, 146,  27,
- 84,  93,  24,  81,  26,  84,  26, 154,  26,  81,  87,  26,  87, 154,  84,
- 93, 154,  81,  84,  26,  81, 146, 152, 144,  81,  87,  81,  86,  27,  26,
-152,  81,  87,  81,  81, 146, 152,  27,  81, 152,  24,  93, 152,  86,  26,
-155,  93,  24, 154,  30,  30,  84,  86, 152,  86,  27, 154, 154,  81, 152,
- 81, 152,  81,  26,  26,  93,  86,  93,  87, 154,  26,  93, 152,  93, 154,
- 93,  86,  81,  86,  24, 154, 152, 152,  26,  86, 155, 152,  87,  26, 146,
-154,  81,  26, 154,  86,  81,  86,  86,  24, 144,  84,  81, 154, 146,  26,
-152,  84, 152,  24, 154,  86, 152,  93, 152,  93, 152, 146,  93,  81,  81,
- 86,  86,  81,  81,  26,  81, 155,  81,  27,  81,  26,  30, 154, 144,  93,
- 84,  26,  93,  81,  26, 152,  81, 146,  24, 155,  24, 152,  84,  26,  81,
- 86,  84,  84,  81,  27, 152,  84, 154, 155,  27,  27, 152,  81, 146,  27,
- 26, 154,  26,  26,  30, 152, 154,  84,  84,  27, 152,  81,  31,  86, 152,
- 87,  31,  27, 152,  93, 152,  86,  26, 152,  86, 154,  81,  93,  81,  26,
- 81, 154,  81, 152,  84,  26,  27, 154, 154,  81,  86,  81, 155,  93,  26,
-152,  93,  93, 154, 154,  26,  93, 154, 146,  81, 154,  93,  26,  86,  86,
-152,  81,  87,  86, 154,  84,  26, 154,  30,  27,  86,  81,  81,  81,  93,
- 86, 154,  93,  26,  93,  84,  93, 155, 155,  84, 154,  27,  93,  86,  26,
- 93,  81,  27, 154, 154,  86,  87,  86,  31, 154,  86,  27,  87,  26,  81,
- 86,  81,  24, 154, 152,  81,  87,  86,  30,  93,  93,  93,  84,  86,  84,
- 81,  81,  93,  30,  81,  81,  81, 152,  84, 155,  27,  27,  86,  93,  87,
- 26,  81,  30, 152,  30, 154, 155,  81,  27,  84,  93,  81,  26,  27,  93,
- 93, 144,  84,  86,  84,  86,  87,  30,  86, 154, 155,  81,  81, 152,  26,
- 27, 152,  27,  93, 154,  84,  81, 152,  93,  30, 152,  86,  87,  84, 154,
-154,  26, 154, 146, 155,  81, 154,  27, 146, 152,  86, 154, 154,  26,  87,
- 93,  93,  93,  81,  26,  93,  93,  81,  26,  81,  24,  93,  86, 154, 152,
- 30,  24,  24,  84,  81,  84,  81,  87,  27, 155,  84, 155,  27, 155,  26,
-144,  81,  86,  24,  26, 146, 152, 146, 154,  87,  81, 155,  84,  31,  86,
-152, 155, 155,  84,  31,  81,  24, 154,  26, 155, 154,  24, 152,  81,  30,
-155,  24,  27, 155,  24,  86,  81,  24,  81,  86,  93, 155, 152,  93,  86,
-152,  81,  30,  86,  86, 154,  26,  81, 152,  84,  93,  86, 152, 146,  81,
- 84, 154, 144,  26,  26, 152, 154, 146,  81, 154,  81,  26, 154,  87, 154,
- 81, 154,  93,  87,  84,  27,  81,  93,  81,  81, 155, 152,  84,  30,  84,
- 24, 146,  24,  26,  81,  81, 155, 152,  30, 155, 155, 154,  93,  81, 152,
-152,  81,  93,  26,  81,  93,  86, 155, 146,  87,  27,  84, 152,  24,  86,
-146,  81, 154, 152,  81, 152,  24, 146, 154,  81,  27,  26, 152,  24,  27,
- 87, 154, 155, 146, 155,  24,  27,  81,  93,  86,  81,  26,  86,  24,  27,
-152, 152,  30,  81,  81, 146,  24,  87,  24,  86,  27,  86,  86,  81, 154,
- 84,  81,  26,  81, 155, 154, 155, 152,  87, 155,  81,  87,  27,  81,  86,
- 93, 155, 146,  30,  93, 146,  93,  86, 152, 154,  81,  86, 155,  84,  84,
-255, 154,  81,  86,  86,  86,  27,  86,  86, 154,  30,  81, 155, 155,  87,
- 26, 152, 152, 155,  84,  93,  86, 152,  93,  84, 146, 154,  84,  27, 152,
-152,  30, 152,  26,  81,  84,  93, 152,  27, 154,  87,  93, 154,  27,  93,
- 24,  24,  87,  81,  26, 155,  93, 154,  24, 155,  87,  93,  93, 152,  93,
-154,  27,  31,  81,  86,  81,  26,  93,  27,  81,  24,  93, 146,  24,  93,
- 24, 146,  87,  84,  30, 152,  81,  31,  84,  26,  84,  30, 152,  26,  84,
- 84,  81,  93,  84,  81,  87,  27, 255,  84, 154,  81,  86,  84,  84,  87,
- 81,  27,  81,  81,  84,  81,  81,  26,  26, 154,  27,  30,  84,  86,  24,
-146,  81,  93, 146, 154,  87,  27,  93,  84,  93, 152,  26,  87,  84,  84,
- 86, 152,  86, 154, 154,  86, 154,  93, 146,  30, 152,  93,  24, 154,  27,
-144,  93, 144, 155,  30,  26,  86,  84, 154,  27,  24, 155,  86,  87,  93,
-146,  26, 155,  87,  86,  86,  81,  84,  24,  81,  81,  27,  30, 155,  86,
-152, 155, 154, 154, 155,  87,  87,  93,  84, 152, 152,  93, 155,  26,  24,
-154,  84, 155,  26, 154,  27, 154,  86,  93,  81,  31,  87,  86,  86,  27,
- 84, 154,  30,  26, 144,  30,  86,  30,  93,  26, 154,  86, 146, 155,  93,
- 86,  31,  81,  26,  81,  86,  30,  86,  26,  84, 152,  86,  86, 155, 154,
- 86,  84,  86, 154,  30,  30,  84,  81, 154, 146,  26,  87, 152,  81,  30,
-152, 146, 155,  93,  86,  93,  26, 144,  84, 154,  84,  26, 154, 155, 155,
- 26,  26,  81,  87,  87,  24,  81, 152,  30,  84,  26,  86,  81, 155,  30,
-155,  84,  87,  26,  84,  24, 155,  93,  81,  86,  81,  81,  81,  27,  30,
- 86,  30,  93,  87,  27,  81,  81, 152,  84, 155,  93,  87,  93,  86, 152,
- 84, 152, 155,  86,  87, 152, 152, 154,  81, 146, 155, 152, 152,  26,  81,
-155, 154, 154,  24,  81, 155,  27,  93, 152, 152,  87,  81, 146,  84,  86,
- 87, 154,  27,  93,  81, 155,  84,  24, 154,  30,  86,  24,  81,  93,  24,
- 93,  87, 255,  84,  84,  31,  84,  93,  30,  86,  26,  93,  26,  93,  26,
-146, 154,  24, 155, 154,  27, 155, 154, 154, 154,  87, 146,  26,  87,  26,
- 87, 152,  84,  84,  24,  26,  93,  24,  27, 152, 146,  93,  87,  93,  30,
-154, 154, 152,  26,  84, 146, 155, 155,  86,  30, 152,  26,  84, 152, 152,
- 86, 152,  87, 152,  30,  81,  31,  84, 146,  86,  93,  84,  81, 155,  24,
-154,  81, 152, 146,  86, 152,  24,  26,  86,  81,  26,  84,  93, 155, 146,
- 27,  30, 154,  24,  27,  84,  84,  30,  87,  26,  84, 155,  81,  27, 152,
-155,  26,  87,  87, 154,  24,  86, 155,  27,  84,  26, 154,  84,  81, 152,
-152,  93,  81, 155,  84,  84,  93,  84,  24,  24,  81,  81,  27,  86,  84,
-146,  27,  24,  84,  93, 152, 155,  93, 154, 144,  27,  87, 154,  81,  84,
- 24, 144, 155, 155,  87,  86, 146,  87, 154,  27, 155, 155,  30,  81, 155,
- 84, 155, 154, 152, 152, 155,  86,  26,  26,  26,  86,  86,  93,  27, 155,
-152,  26, 155,  84,  24, 154,  26, 152,  93,  87,  26,  86,  27,  84, 155,
- 30,  93, 152,  24,  81,  26,  81, 155,  93,  27,  30, 154,  93,  81,  24,
- 93,  87, 152,  84, 155, 152, 152, 152,  81, 146,  87,  27,  93,  84,  84,
- 81,  24, 155,  81,  81,  86, 154,  26,  86,  93,  81,  30,  81,  26, 155,
-154,  24,  30, 146,  87, 154,  93, 155,  81,  81,  30, 146,  93, 155,  93,
- 81,  84,  24, 152,  81,  81,  84,  27,  93,  86, 154,  93,  24,  27,  84,
- 24,  26, 152,  30,  84,  87, 154, 155,  84, 146, 152,  93,  87,  30,  26,
- 24,  84, 152,  86, 155,  93,  24,  24,  26,  93,  84,  84,  84, 155,  24,
-152,  24,  24, 152, 152,  81,  84,  81, 152,  84,  93,  86,  81, 152, 152,
- 93,  26,  84,  27,  87,  87,  86, 155,  81, 144, 155,  24,  87, 155,  84,
-146,  81, 155,  27, 155,  30,  81,  24,  81,  81,  87, 146,  30, 144,  84,
- 31,  24, 146, 155, 155,  81,  30,  24,  93, 152,  84, 152,  81,  87,  81,
- 84,  87, 152, 255,  93, 155,  84,  87,  81, 155,  81, 155, 152,  26,  87,
- 30,  84,  27,  93, 152,  27,  24,  84,  26,  87,  30,  81,  81, 152,  84,
- 30,  81,  84, 152, 155,  87,  24,  87, 155,  86,  24, 152, 155,  86, 154,
-154, 144, 155, 154,  27,  24,  30,  27, 146,  81, 155, 155,  81,  24,  84,
- 93,  87,  87,  93, 152,  30,  93,  86, 154, 154,  93,  27,  86,  24,  27,
-155,  84,  26,  24,  84, 152,  24,  87,  84, 152, 154,  27,  24,  26, 146,
- 84,  27,  84, 146,  86,  27, 146,  27,  86, 155,  93,  27,  84,  24,  84,
- 26,  86, 155, 152, 152,  24, 154,  84,  27,  24,  93, 146,  84, 155,  31,
- 84,  84, 146, 154,  24, 146,  81, 146,  81,  84,  84, 154,  24,  93,  86,
- 81,  86, 152, 155, 155,  27,  84,  27,  24,  27,  24,  86,  27,  93, 152,
- 24,  26, 155,  26, 144,  24,  26, 155, 144,  93,  27,  24,  26, 144,  27,
-152, 154, 155,  81,  87,  30, 154,  81,  93,  93,  81, 152,  87,  87,  86,
- 26,  81,  84,  24,  84,  93, 152,  27,  26,  93, 146, 155, 155,  87, 155,
-155, 155,  26, 152,  87, 152, 155, 152,  84,  81,  81,  27,  81, 155,  24,
- 24, 154, 154, 152,  27, 146,  24,  86, 146,  26,  87, 152,  24, 155, 155,
- 86, 152, 155,  84,  24,  81, 154,  26,  87,  84,  30, 146, 146,  87,  26,
- 24,  81,  84, 154, 152,  30, 155,  86, 155,  84, 154, 155, 155,  86, 144,
- 93,  24, 152,  86,  86, 146, 152,  84,  24,  84, 152,  93,  30,  87,  87,
- 24,  24,  84, 152,  84,  87,  27, 152, 154,  27,  86, 155,  84,  87,  86,
-154,  84, 146,  84, 155, 152,  24,  81,  24,  84,  24,  27,  81,  84, 154,
-146,  26,  30,  27,  81,  81, 155,  27, 155, 152,  93, 146,  93,  87,  86,
-144,  84,  30,  84,  93,  30,  81,  27,  87,  81, 146,  24, 155,  87, 154,
- 24, 152, 154,  27, 155,  27,  27,  27, 155, 152,  26, 152, 152,  84, 155,
- 84,  93, 155, 155, 155,  81,  81,  87,  24,  86, 152,  27,  93, 155,  81,
- 24,  84,  31,  84, 155, 152,  30,  24, 152,  87,  87, 152, 155,  27, 155,
- 87, 154, 144, 155,  24,  84,  26,  26,  81, 152,  84,  84,  24,  87, 155,
- 87, 155,  84, 155,  87,  84,  84,  86,  26,  81,  84, 155, 146,  81,  84,
- 24, 155, 155,  84,  84,  27, 154, 155,  81,  81,  87,  93,  30,  87, 155,
- 87,  93, 155, 154, 155,  81, 152, 155, 155,  93, 152,  86,  24,  84, 155,
- 24, 155,  27, 146, 152, 155, 155,  24,  27,  84,  84,  81, 155,  86,  86,
-154,  93,  30,  87, 155,  30,  24, 154,  24,  30,  84, 155, 146,  87, 154,
- 86, 144,  84, 155,  84,  86, 155,  87,  87,  24,  24,  24, 154,  93,  27,
- 24,  87,  84,  30,  24, 155,  27,  87,  27, 155,  86, 155,  93, 155, 152,
- 27,  93,  86,  81, 155, 154, 144,  84,  26, 155, 152, 152,  31,  86,  24,
- 27,  87, 144,  87,  27,  27,  93,  86, 144, 155,  81, 146, 155,  27, 154,
-152,  27, 155, 146,  87,  87, 152,  27, 146,  87,  26,  93,  84, 155, 146,
- 24, 152, 155, 146,  30, 154,  27,  24,  26,  84,  27,  81, 152,  87,  84,
- 26,  27, 154, 155,  84,  81, 154,  24,  84, 152, 146,  81,  30, 152,  31,
-152,  30,  24,  27,  84,  84, 155,  84, 155,  81, 144, 155, 152,  84, 155,
-255, 155,  81,  84, 146,  84, 152, 152, 152,  81,  87,  30,  81, 155, 152,
-155,  24,  84,  24,  27,  27, 152,  30,  24,  87,  31, 155, 154, 152,  30,
-155,  27, 152, 155,  86, 155, 146,  84, 155,  27,  87,  31,  84,  87,  87,
- 84,  86,  24, 152,  24,  24, 155,  87, 146, 155,  84,  84, 146, 155,  87,
- 27, 152,  84, 152,  87, 152, 155, 155, 146,  84, 155, 152,  30,  87, 155,
- 81,  84,  24,  24,  84,  81,  24,  30,  84,  84,  84,  84, 155,  84, 155,
- 24,  87, 155,  87,  87,  31,  84,  24,  24,  30,  93,  24,  27,  87, 154,
- 93,  86,  24,  27,  81,  86, 155, 154, 154,  81,  81,  27, 255, 152, 144,
- 81, 152,  24,  24,  84,  84,  84, 155,  81,  27,  84,  84,  27, 146,  86,
- 87, 155, 146, 152,  26, 155, 155,  26, 152, 154,  87,  27,  86, 155,  24,
-155, 155, 154, 155, 155, 155,  93, 155,  24,  27,  30,  24,  84,  24,  27,
- 84,  26, 155,  84,  24,  24,  24, 152, 155,  24,  87,  27,  84,  26,  26,
- 84, 155, 152, 155, 152, 154, 155,  87, 155,  24,  26,  84,  27,  30,  93,
-155,  27,  24, 155, 152,  81, 154,  24,  84, 152,  87,  24,  26,  84,  27,
-155, 155, 152,  26,  93, 155, 155,  93, 154, 154,  86, 155, 155,  27,  27,
- 87, 155,  27, 146,  87,  87, 155, 155, 146,  27,  24,  87, 155,  81,  24,
-155,  30,  84, 152,  87, 146, 155, 146,  87, 152,  87, 152, 155,  24,  24,
-152,  24, 155,  27,  84,  24,  86, 152,  93, 152,  24, 146,  81,  24,  81,
-144,  87, 155, 144,  30, 155,  81,  30, 155, 152,  86, 155,  27,  87,  93,
-155, 155, 152, 155, 146, 152,  30, 152,  81,  86, 146, 155,  27, 155, 152,
- 84,  87,  24,  84,  84,  84,  24,  87, 155,  87, 154,  24,  84, 152, 155,
- 27,  27, 146, 155,  24,  24,  27, 146, 152,  86,  87,  87, 146, 155,  27,
- 30,  31,  84, 152,  87,  93,  84, 146, 152,  27, 152,  27,  27, 155,  87,
- 27,  93, 155, 152, 152,  30,  24,  26, 155,  84,  27, 152, 154,  87,  30,
- 84,  27,  93,  87, 155, 155,  87,  30,  84,  81,  24, 152,  84,  87,  81,
- 24,  87,  84, 155, 154,  81,  84,  30,  26, 146,  81,  84, 155,  24, 152,
- 24, 155, 152, 155, 152,  84, 155,  84,  93,  30,  93,  86,  93, 155,  30,
-155, 152,  24,  86, 152, 152,  84,  87, 152, 152, 152,  87, 155,  81,  84,
- 87,  24, 155,  86,  30,  84,  87,  84, 152, 155, 155,  84, 152, 155, 155,
- 81, 155,  27, 152,  87,  84,  24,  24, 152,  87,  87, 152,  84,  26,  24,
-155, 155, 154,  30,  84, 155,  84,  30,  84,  84,  84,  27,  24, 155,  24,
- 24, 155,  84,  27,  81, 154,  87,  24, 152,  84, 146,  84, 152, 152,  30,
- 31, 155,  87,  87,  24, 155, 144,  24,  84,  24,  84,  24,  24, 155,  84,
-152, 144,  31,  93,  87,  84, 146, 155, 155, 155,  27,  30,  27, 152,  27,
- 30,  27,  24,  24, 152,  31, 155, 152,  93, 146,  86, 152,  30, 155,  93,
-155, 155,  26,  93,  26,  84,  30,  84,  84, 152,  24, 155,  86,  24, 152,
- 24, 155, 155,  84, 152,  87,  24, 155,  27,  87,  24,  27,  81, 152,  27,
- 87,  27,  24, 155, 155,  30,  87,  84, 152, 155,  84,  81,  27, 152,  30,
- 84,  81, 155,  24,  84,  87,  86, 155, 146,  86,  24,  87, 155,  87,  24,
- 87, 155,  30, 155, 155,  86,  27, 152, 152, 155,  26,  31,  87, 155,  24,
- 84,  87,  87,  84, 152,  27, 146,  31,  27,  87,  27, 146,  27,  87, 146,
-152, 155,  84, 155, 146, 155,  87,  27, 155,  27, 155,  93,  30,  93,  87,
-146, 146,  24,  87, 146,  84,  26,  87,  31,  87, 155, 152, 155,  87, 155,
- 24,  27, 155,  84,  27,  24,  24,  84,  30, 155, 155,  84, 152, 152,  24,
- 86,  24,  84,  84,  81,  30, 146,  24,  84,  27,  84,  24, 146, 155,  84,
- 30,  81,  26, 152, 146, 155, 155,  30,  81, 155, 154, 144,  84, 152,  84,
-155, 155,  27,  27, 152, 155,  86,  87,  87,  31,  87,  87, 155,  24, 155,
- 24,  84, 146,  30,  84,  81, 155, 155,  24, 146,  24,  24,  30, 155,  87,
- 84,  84,  87, 152,  84,  30, 155, 155,  24, 155, 155, 155,  26,  24,  24,
-152, 155, 155,  30,  24,  87,  84,  27, 146,  24, 155, 155,  81,  87, 154,
- 30, 155,  27,  93,  87,  24,  24,  24,  87,  24,  87,  84, 144, 146, 152,
-155,  24,  30,  84,  84,  27, 146, 155,  24,  27,  87,  84, 155,  30,  27,
-155,  27, 155,  24,  84, 155, 152,  24, 152,  24, 152, 154,  24,  26,  93,
-152, 152,  87,  84, 155,  81,  84,  27,  27, 146,  87, 155,  84,  27,  27,
-155,  87,  87, 155,  27, 155,  87, 155, 152,  87,  84, 155, 155,  84, 146,
- 93,  27,  30, 152,  84,  87,  87, 152, 144, 155, 155,  24,  27, 155,  27,
-154,  84, 155,  27,  31, 144, 152,  31,  86, 155,  31,  27,  87,  87,  27,
- 84,  87,  24, 144,  81,  24, 146,  27, 155, 144,  84,  87,  87,  84,  24,
-155,  24, 155,  87,  87,  24,  30,  84,  24,  27,  84,  27, 155, 155,  87,
- 87, 155,  84, 146,  27, 155,  24,  84,  84,  30,  84,  84,  84,  87, 154,
- 26, 152,  87,  87,  84,  84,  84,  87, 155, 152, 152,  24,  24, 155,  84,
- 84,  24, 155,  84, 144,  27, 155, 144, 155,  87,  31, 155, 155,  31, 152,
- 24, 155,  87, 152,  30,  24,  24,  24,  30, 152, 155,  31,  30, 155, 152,
- 84,  84,  87,  87, 154, 155,  84, 152,  81,  30,  86,  84,  30, 146,  84,
- 93, 155,  84, 146,  24, 155,  87,  30, 155,  30,  27, 152,  27,  84,  30,
- 84,  84,  24,  87, 152, 146,  24,  24,  30,  31, 155,  24,  84,  27, 155,
-155,  31, 154, 155, 146, 152,  86,  27,  87,  93, 146,  84, 155, 152,  84,
- 24,  81, 146,  24, 152,  27,  84, 144,  87,  87, 154,  87, 146, 152,  27,
- 81,  87,  24, 146,  27,  87, 152, 152,  84, 146,  87,  84,  24,  87,  87,
-152,  30,  87,  30, 152,  24, 152, 155, 155, 152,  24,  24, 155, 155,  24,
- 84, 152,  84, 152,  84, 255,  87,  24,  24, 152,  84, 155,  30,  24, 155,
-152, 146, 155,  24, 146,  27, 155, 155,  27,  93,  84,  84, 152,  87, 155,
-155, 155, 155, 155, 152,  84,  87,  24, 152, 155,  87,  24, 155,  24, 155,
- 30,  27,  24, 155, 155,  81,  84,  31,  87,  24,  84,  27, 155,  84,  87,
- 24,  84, 152,  27,  27,  87,  24,  84, 155,  27,  87,  84,  27, 152, 152,
-155,  27, 152,  84, 155, 155,  30,  24,  30,  87,  87,  84, 152,  24,  24,
- 27, 155,  27, 155,  93,  84, 146,  24, 155,  31,  24,  24,  30, 155, 155,
-155,  87, 155,  30,  27,  24, 152,  24,  84,  87,  87, 146, 155,  27,  27,
-155, 146, 155,  27, 155,  24,  27, 152, 255,  24, 155,  30,  24,  27, 155,
- 84,  87, 155, 155,  84,  87,  24,  84,  26,  24,  24,  87,  84, 155,  87,
-155,  87, 152, 154, 155,  27, 155,  27,  24,  87,  87,  24,  87,  84,  87,
- 84,  84,  84,  24,  84,  84,  84, 155, 155,  84, 155,  27,  24, 146, 155,
- 31,  87, 152,  87, 155,  87,  24,  24,  84, 155, 146,  24,  87,  87,  84,
-152, 146, 152, 146,  24,  87,  87, 152, 146,  24,  24, 155,  31,  84,  27,
- 84,  84,  84,  27,  27, 146, 152, 155,  24, 152,  84,  27,  84,  24,  87,
-155, 155, 155,  24,  24,  87,  84, 155,  87, 155,  24, 152, 152,  24,  84,
- 24,  84, 146,  24, 155,  27, 152,  84,  84, 155,  24,  24, 152, 155,  24,
- 24,  24, 155,  24,  24,  87, 155,  87,  27, 152,  27,  87,  87, 152, 146,
- 84, 152,  87,  27,  87, 155, 152,  30,  87,  31,  87,  24,  25,  27,  24,
-152,  24,  84,  24, 155, 155,  84,  84,  87,  84, 155,  84,  30, 152,  87,
- 30,  84, 144,  30, 146,  24,  30, 155,  24, 152,  87,  27, 152,  85,  84,
- 84,  84, 152, 144, 155,  27, 155,  31,  87,  30,  27,  87, 146,  87, 152,
- 31, 144,  87, 146, 155,  24, 152,  84,  84,  87,  84, 146, 146, 155,  84,
-146, 155,  84,  24,  84,  30, 146, 144,  30,  84,  27,  24, 155, 152,  27,
-155, 158,  84, 155,  84,  30, 152, 152,  27, 155,  30,  84,  25, 155,  84,
- 30,  24,  87,  24,  27, 155,  87,  24, 155, 153, 146, 152, 144,  84, 153,
- 84,  87, 155,  87, 155,  87,  84, 146,  24,  24,  24,  24,  24, 155,  84,
-155,  87,  24,  31,  30,  30,  87,  87, 144, 152,  84,  87,  84, 155,  84,
- 30, 155,  24, 155,  87,  84,  24,  84, 155, 152, 155,  30, 155, 144,  84,
- 87,  24,  84,  24,  87,  84, 155, 155, 155, 155,  84, 152,  27,  84, 146,
- 87,  87,  84, 152,  24,  27, 152, 152, 155,  24, 155, 155,  84,  84,  87,
- 24,  24,  84,  87,  24,  30,  27,  25,  30, 155, 155,  30, 152,  84,  24,
-146, 155, 155,  24,  87,  31,  30,  25, 155,  24,  31,  87,  84,  24,  84,
- 24, 155,  84,  87,  87,  24, 155,  84, 155, 153,  85, 155, 158,  87, 155,
-146,  84,  27, 155,  87,  24, 155,  24,  84, 144, 152,  87,  30, 146,  87,
- 27,  24,  87,  24,  84,  87, 155,  24,  24, 153,  87,  27, 152, 152,  30,
- 24, 146,  87,  27,  25, 155,  87, 146,  84, 155, 153, 155, 152, 155,  27,
-155, 152, 155,  30, 152,  87, 155, 155, 146,  24,  24,  84, 155,  27,  84,
-155,  87, 155, 152, 152, 153, 146, 152,  27,  25,  31,  27, 155, 158,  84,
- 87,  30,  87, 144,  27,  24, 152, 155, 152,  27, 146,  84,  87, 152, 155,
-153,  87,  84,  30,  84, 153,  18, 152, 152,  30,  24,  84, 155,  87,  27,
-146,  24,  27,  87,  84, 146,  24, 155, 155,  87,  24,  27,  85,  24, 152,
- 27, 152, 155,  31,  24, 152, 146, 146, 152,  24,  84, 146,  87, 155,  87,
-155,  30, 152,  25,  24, 153,  25, 153,  84,  87,  84,  84,  87,  24,  87,
-152,  87,  24,  87,  87, 155, 146, 155,  27,  18, 152,  24, 155,  24,  27,
- 87,  84, 158,  87,  24, 152,  25,  24, 152,  85,  84,  87,  24,  84, 144,
- 27,  27, 155,  84,  24,  25,  87,  87, 152, 153,  18, 155, 152, 152, 155,
- 30,  87, 155,  87, 155,  27,  24, 155, 153,  84, 155, 144, 152, 146, 155,
- 30, 155,  87, 155, 155,  84, 158,  24,  24,  30, 155,  31, 152,  27, 155,
- 30, 155,  24, 155, 155,  25, 158,  84,  30,  84,  87, 155, 155,  84,  24,
- 27,  84, 152,  31, 155, 152,  84, 144,  30,  84,  84, 155, 155, 152,  85,
-155, 146, 153,  24, 155, 155,  84,  84, 155,  27,  84,  84, 146, 155, 153,
- 24, 155, 146, 152,  18, 144,  18, 146, 152,  24,  84,  87, 155,  84,  87,
- 25,  24,  87,  27,  87, 155,  85,  87, 146, 155,  30,  87, 146,  27, 153,
- 24, 158,  84,  87, 155,  84,  84, 155, 152,  84,  87,  27,  84,  87,  27,
-146,  27, 152,  87,  18, 153, 146, 155, 155,  27, 153,  27,  84, 152,  24,
-155,  87,  24, 152, 155, 155,  24,  18,  30,  87,  24,  27,  31,  30, 152,
-158,  85, 146,  84,  24, 152,  27, 155,  84, 155,  27,  25,  87,  30, 155,
- 24, 155, 158, 155, 155, 155, 155,  24,  24,  84,  25,  25,  18,  24, 155,
-152,  30, 144,  84, 144, 153, 152, 146, 152,  84, 146,  24,  87, 155,  25,
- 25,  84, 155, 155,  84,  84,  24,  84,  24,  84,  87,  87, 152,  84, 144,
- 27,  24,  84, 146,  24, 155, 155,  87, 153,  84,  30,  87, 146,  24, 155,
- 84, 146, 155, 155,  84,  18, 152,  25,  25, 146,  24, 146, 155,  87,  84,
- 27, 155,  25, 155, 152,  30,  24,  24,  27,  24,  24, 155,  24, 155, 153,
- 87, 152, 153, 155, 146, 155,  24,  25,  27,  24,  24,  30,  24,  85, 144,
-146,  24, 155,  24,  24,  30, 152, 155, 146, 152,  24,  25, 146, 152,  24,
-155,  27, 158, 152,  85,  84,  85, 153, 155, 155,  85, 144, 155, 153, 155,
- 84, 144,  87,  84, 152,  25,  24,  27, 155,  84, 152, 153,  87,  85, 158,
-152,  18,  31, 152,  85, 153, 155,  31,  30,  87, 146,  87, 146,  87,  25,
- 84, 158, 155,  84,  87,  24,  24,  24, 155,  24, 155,  27, 155,  27,  85,
- 27, 152, 152,  18,  87,  84,  84,  87,  27, 144, 158, 155,  30,  87,  84,
-155,  24,  25, 155,  84,  18,  84, 155,  18,  27,  18,  25, 155, 155, 155,
-152, 152, 146,  84, 155,  84,  31,  24, 158, 155, 155,  25, 155, 153, 144,
-155,  84, 155,  85, 152, 153,  24,  84,  87, 155, 153, 146,  84,  84, 155,
- 85, 155,  24,  87,  24, 146, 155, 155, 153,  25, 155,  30,  27, 155,  84,
- 85,  87,  85,  30, 155,  87, 144, 155, 146,  84, 153,  84,  30, 153, 158,
- 25,  84,  31,  25,  24,  87, 155, 144, 153,  25,  84,  87, 146, 144,  84,
-158,  18, 155,  27, 146, 155,  30,  18, 155, 155, 155,  31,  30,  30,  84,
- 27, 152,  24,  87, 155,  24, 158, 152, 146,  87,  87,  30,  24,  87,  25,
-146, 144,  18,  84, 152, 155, 152, 155, 155, 155,  84, 155,  85,  25, 153,
- 25,  85,  30,  24,  84, 155,  27, 152, 155,  24,  87,  87, 153,  18, 158,
- 31,  27,  18,  25, 155,  30, 153,  84,  25,  27, 155,  27,  24,  18, 146,
- 85,  24,  27, 146,  87, 153, 153, 153,  25,  84, 155,  84, 155,  27, 153,
-144, 152,  18,  24, 146,  24,  24, 155,  87,  24,  84,  25, 155,  24,  87,
- 24,  18,  27,  25, 152, 155,  18,  87,  84,  27, 155, 146,  84,  30,  87,
- 87,  27, 152,  30, 146, 155, 155,  84,  87, 152,  30, 158, 144, 152, 153,
-155, 146,  24,  87, 155,  84,  87,  24, 144, 155, 153, 158, 155, 158, 155,
-146,  25,  84, 152,  84,  27,  84, 158,  31, 152,  18, 146,  84,  84, 155,
- 24, 158, 146, 152, 152,  27,  25,  84,  85, 155, 146, 158, 153,  87,  24,
- 84,  87, 155, 146,  25, 153,  27, 155,  25,  84,  84,  27, 153, 155,  87,
- 24, 146, 153, 155,  18,  24,  31,  87, 146,  87,  87, 155,  30, 158,  24,
-155,  18,  87,  85, 153,  30,  84, 152, 146, 146, 155,  25,  24, 158,  30,
- 30, 153,  30, 158,  30, 153, 155, 155,  31,  85,  27, 153, 152, 153,  85,
- 25, 146,  18, 155,  84,  84,  30,  30, 155,  24,  30, 146, 158,  24,  87,
-152,  18, 153, 152, 155,  24, 155,  24, 152,  18,  87, 155,  84, 155, 153,
- 24,  84, 158, 155,  85,  84,  87,  87, 155, 153, 155,  84,  87, 152, 153,
- 87, 153, 158, 153, 146,  85,  85, 152,  30,  25, 153, 152, 155, 155,  87,
-155,  31,  84, 153, 155,  87,  24, 146,  84, 153, 155,  24, 155,  24,  27,
-146, 152, 153, 155, 153,  85,  27, 155,  30,  24,  85,  25,  25,  87, 155,
-155, 155,  84, 155,  27, 155, 155,  84, 152, 155, 146, 155,  18,  87, 146,
-158, 152, 152, 152, 155,  25, 146,  84, 155,  25, 146, 155,  84, 155, 153,
- 24,  30, 155, 158,  24,  18, 155,  24,  24,  87,  84, 155, 153, 146,  84,
- 87, 155, 155, 158,  18, 155,  24, 153, 146,  85, 153,  87, 152,  31,  18,
- 24, 155, 158, 146, 146,  24,  84,  31, 153,  84, 155, 155,  84,  18,  84,
- 25,  87,  84,  24,  25, 153, 155,  85,  84, 146,  25, 144,  87,  85,  24,
- 25,  84,  25, 153,  27,  25, 152, 255, 153, 153, 146,  18, 155,  25, 155,
- 84, 158, 144,  31, 153,  18,  84, 158, 153,  85,  85,  24, 155,  27, 153,
- 31,  85, 158,  84,  24, 152,  87, 153, 153,  87,  30, 153,  84,  84,  84,
-152, 146,  25,  24,  84,  87, 153,  87, 155, 146, 144, 153, 144,  30, 146,
- 27,  24, 146,  25,  84, 153,  30,  27,  25,  25,  25,  87, 155,  25,  85,
-155, 155,  25, 153,  84, 155, 158,  30,  87,  30,  85,  24, 153, 146, 155,
-155,  84, 158, 153, 153, 146, 155,  85,  27, 152, 146,  84,  30,  30, 146,
-152, 155, 158,  18,  18, 152,  18,  87,  84,  24, 153, 153,  27, 146,  30,
- 87,  87,  18, 146, 146, 153, 153, 155, 155, 153, 146, 146, 153, 155,  30,
-146,  25,  25, 153, 153,  84,  84,  87,  85, 146,  25,  25,  18, 152,  30,
-153,  84,  84, 153, 158, 155,  84, 155, 144,  84,  85,  31,  84, 146,  84,
- 84, 152,  87, 155,  87, 152,  24,  84,  27,  87,  30,  85,  85,  84,  30,
- 24, 155, 153, 153,  18, 153,  18, 153,  24,  24,  85,  24, 153, 153,  85,
-158, 155,  87, 155,  25, 158,  25,  24,  25,  24,  87,  84, 152,  30,  18,
-153, 153,  24,  24,  84, 155,  24, 144,  30,  18, 153,  87,  87, 146,  87,
- 87,  18,  18, 153, 155, 153, 158, 153,  31, 146, 155,  84, 158, 158,  85,
- 87, 152,  18,  87,  25,  30,  18,  30,  84, 152,  24, 153,  30,  24,  85,
- 24, 158,  87, 153, 153, 146,  31,  87, 155, 155, 155, 153, 158, 152,  84,
-155, 153, 155,  25, 153, 153, 153,  87, 144, 155,  24, 152,  18,  84,  25,
-155,  30, 146,  25, 153,  25, 153,  18,  87,  87, 155, 146,  31,  24,  85,
-153,  24,  30,  84,  25, 153,  18, 152, 158,  31, 155,  85, 158,  18, 146,
- 31, 146,  27, 155,  87, 155, 158,  24,  85,  87, 155,  25, 146, 155, 153,
-155, 146, 144, 153, 155,  18,  30, 153,  85, 155,  87,  30, 155,  84,  24,
-153, 155,  87,  24,  27,  84, 155, 146,  87, 155, 155,  30,  27,  84, 153,
-146,  84, 158,  18, 153, 153, 152, 155,  85, 146, 155, 155,  24, 155,  84,
-153, 146, 155, 155, 146, 144, 152, 155, 153,  84, 158, 153, 155, 152,  85,
- 25,  25, 153,  85,  87,  25,  87, 158,  84,  25, 155,  24,  87, 152,  84,
-144,  84,  87,  87, 158, 146, 158, 146,  87,  84,  25, 158, 158,  18,  27,
-144,  24, 155,  25, 153,  31, 146, 153,  24, 153, 153,  24,  25, 158, 146,
-158, 155, 155,  30, 158, 146, 155,  85,  87, 155,  31, 158,  18,  25,  30,
-153,  31,  18,  84,  25,  85,  85,  25, 146, 144,  87,  24, 155,  87, 155,
- 87,  25, 153, 153,  25,  18, 155,  24,  87,  85, 152,  87,  27,  25,  30,
- 85,  18,  84,  84,  18,  30, 146,  18,  18,  25, 153,  84, 153,  25, 153,
- 25,  85, 153,  84, 146,  85,  87, 146,  87,  25,  85,  85,  84,  18, 146,
-146, 146,  24,  85, 146,  85, 155,  24,  24,  24,  27,  18,  87,  85, 153,
- 27, 153,  25,  25,  24,  25, 158,  18,  30,  25, 146, 152, 153, 153, 158,
- 24,  24,  24, 158, 146, 153, 153, 155,  24,  25,  84,  84,  18,  25,  27,
-153,  84, 153,  30, 153,  87,  87,  87,  24,  24, 153,  84, 155,  87, 153,
-153,  30,  84,  85,  87, 158, 155, 146, 152, 158, 155, 155,  84, 158, 153,
- 24, 155, 146, 158,  31,  18,  24,  84,  84,  18, 155, 155,  87, 155,  31,
-153, 155, 153,  25,  30,  24,  85, 146, 153,  25,  85, 146,  30, 153, 153,
- 25, 146,  30, 153,  25, 153, 158,  25, 155, 155, 153,  30, 158,  84, 155,
-155, 153, 153, 146,  85, 158,  84,  30, 152, 158, 155, 158,  24,  25,  87,
- 87, 155,  24, 153,  27, 255, 153, 255, 158,  30, 153,  24, 158,  25, 153,
- 85, 153,  85,  30, 158,  18, 153, 155,  87,  24, 155, 153,  87,  85,  84,
-153, 153, 153, 144,  84,  24, 153,  30, 155,  25,  31, 146, 155,  25,  30,
- 85,  87,  18,  84, 155,  18,  85, 153, 158, 153, 153,  18,  84,  18, 152,
- 87,  18,  25, 152, 153, 153,  30, 155,  24,  18,  85, 155,  18, 153,  18,
-158, 146,  25,  85,  18,  24, 152,  25,  18,  18,  25, 153,  24,  18, 144,
-155, 146, 144,  24, 146, 155,  24, 146, 155, 153, 155,  25,  87, 155, 146,
-155, 158, 153, 158, 155, 158, 158,  84, 146,  30,  30,  18, 158, 155,  24,
-146,  27,  25, 146, 155,  84, 155,  87,  85, 146,  85, 146, 153,  18, 158,
-155,  85,  30, 146, 153, 153,  24, 155,  31,  31,  30, 158, 153, 153, 155,
- 25, 153,  87,  87,  85, 146,  18,  30,  18,  27, 146, 158,  30,  30,  30,
-153,  84, 153,  25,  85, 155,  25,  87, 153,  30,  24,  30, 155,  25, 153,
- 85,  85,  84, 153, 155,  24, 146,  25,  84, 146, 155,  25,  24,  18,  25,
- 25, 146,  25,  24,  25, 146, 153,  24,  18, 153, 153,  85, 155,  85, 153,
-158, 146,  18,  24,  25, 158,  18,  30,  24,  25, 153,  25, 153, 158,  87,
-155, 152,  87,  25,  85,  25,  87,  24,  18,  24,  85,  25,  87, 158,  27,
- 87, 155,  25,  25, 153, 152,  84, 155,  25,  84, 144,  25,  31, 152,  30,
-153, 152, 158, 158, 153,  25,  30, 158,  87,  30,  84,  18,  87,  84,  85,
-153, 155,  85, 158,  25,  25, 155,  18,  25,  84,  31,  85, 153,  85, 153,
- 87,  25, 153, 155,  87,  25, 146, 153,  25, 146, 146, 155, 153,  84,  25,
- 24, 153,  84,  84,  24,  87,  18,  18,  18,  24,  18, 146, 155, 153, 146,
-155,  18,  30,  85,  84, 146, 153,  87, 155,  25, 153, 158, 153, 146,  25,
-152, 153,  18,  24, 146,  27,  87, 146, 146,  31,  18,  87, 153, 155, 158,
- 84,  30, 155,  85,  85, 153,  85,  24, 155, 153,  30,  85,  87, 153, 158,
- 85, 155,  87, 158, 146,  87,  30,  30,  31,  18, 146, 153, 158, 158,  18,
-146, 146,  30,  87,  25,  25,  84, 153, 146,  87,  25,  31,  24, 153, 146,
-158, 146,  18,  85,  25,  30,  25, 153,  87, 146, 153, 153, 153,  18,  25,
-155, 155,  18,  85, 155,  85,  18,  30, 155, 153, 153, 153, 158, 146, 146,
- 30, 158, 155,  87,  31,  85,  18, 153, 155,  87,  30,  85, 146,  84, 153,
-146, 153,  85,  84,  87,  85,  30, 153,  85, 153,  18,  24,  25,  24, 153,
- 25, 153, 158,  84,  18,  31, 155, 146,  24, 146,  85, 146, 153, 146, 153,
-155,  27,  30, 153,  84,  85, 144, 153,  30,  25,  85,  24,  85, 158, 153,
-153,  25, 144,  30, 146,  87,  85,  24, 153,  25,  18, 153,  25, 153, 158,
-155,  24, 153, 155, 158,  87,  85, 155, 153,  24,  25,  25,  25,  25,  18,
-153,  25, 153, 158,  25, 146,  25,  85, 153, 146, 155, 146,  25,  84, 158,
-158,  30,  85,  85, 153,  18, 146, 153, 158,  25, 153, 153, 158, 155,  25,
- 18,  84,  85, 153,  87, 158, 144,  87, 153, 146,  25, 146,  85, 158, 155,
- 87, 155,  18, 158, 155,  25,  87, 153,  84,  31, 155, 155,  85, 153, 153,
- 25,  30,  85,  18, 146, 158, 155,  18, 158, 158,  87, 153,  84, 153,  84,
-153,  24,  87, 153, 155, 153,  24,  85, 153, 153,  87, 144,  84, 158,  25,
-146,  18,  24,  25,  25, 158, 153,  18,  25, 153,  30,  84,  25,  87,  85,
-146, 153, 155, 153,  18, 146, 153,  18,  18,  31, 146, 153,  25, 146,  25,
- 85, 153,  18, 153,  85, 153,  84, 153, 153, 153,  84, 155,  18, 146, 158,
-158, 155,  25,  85,  25, 158,  87,  25, 153, 155, 158, 155, 153,  25,  85,
-153, 144, 153, 158,  24,  31, 153,  25,  25, 146, 158,  85,  31,  85, 146,
- 18, 155, 153, 153, 153,  18, 153,  18, 155,  25, 158, 153, 155, 146,  87,
- 25, 158, 153, 146,  85,  87,  85, 153,  24, 158, 153, 146,  30,  18, 153,
- 84, 255,  85, 153,  25, 158, 158,  24,  18,  25,  30, 153, 153, 144,  87,
-153,  85,  25,  84,  18, 153,  18,  85, 144, 153,  85,  85,  18,  18,  25,
- 18,  87, 153,  18, 153, 153, 155, 158, 158,  25, 153,  18, 155,  25,  18,
-146, 158, 158,  85, 158,  24,  25, 155, 153, 146, 153, 155,  28,  25,  87,
- 30,  85,  87,  85, 158,  18, 146, 158,  84,  25, 153,  30, 158,  18,  25,
-147,  18, 153,  18, 158,  30, 153, 146,  24, 153,  18,  18,  85, 146,  85,
-158, 153, 146,  25,  84, 158, 153,  18, 153, 146,  25, 153, 153,  85, 153,
-144,  25, 153,  87,  24,  18,  30,  85,  18,  84,  30,  24,  25,  85, 155,
-153,  87, 153,  31, 146, 146,  24, 158, 153,  25,  85, 158, 155, 158, 146,
- 30, 147, 146,  84, 153, 153,  85,  85, 158, 153,  25,  18,  18, 158, 153,
- 84,  28,  85,  18, 153,  30,  18, 146,  24,  85, 146,  85,  25,  30, 153,
-153, 158, 146,  31, 144, 153, 146,  85, 153, 146,  85,  85, 155, 147, 153,
-153, 158, 153, 147, 146,  30, 158,  85, 153, 146,  30,  18, 146,  18,  18,
- 30, 158, 158,  30, 153, 146,  18, 155, 153,  85, 153,  30,  25,  18,  87,
-153,  30,  85,  28, 153, 153,  25, 153, 153, 153, 153, 153,  30, 153, 146,
- 85, 153, 155,  30, 146, 155,  84,  24,  85,  25, 153, 146,  18,  30, 158,
-153, 147,  25,  24,  25,  30, 153, 158,  87, 155,  25,  18,  25,  87,  87,
- 87, 146,  30, 153, 158,  18, 155,  18, 155,  25, 153,  18,  85,  18,  25,
-153, 153,  18, 155,  24,  84,  28,  18,  18, 153,  85, 153,  25,  25,  18,
- 31, 158,  25, 146, 155,  25, 153, 146, 155,  28, 146, 158,  18, 153,  25,
-155, 146, 155,  85, 155, 146,  25, 155,  85,  24,  18, 153, 158,  25,  25,
- 18,  25, 158, 158,  87, 153,  85, 158, 155, 158,  85, 158,  18,  25, 153,
- 25, 153,  84,  85,  30, 153,  85, 153,  87,  25,  87, 155, 153, 153,  25,
- 18, 147,  31, 153,  18,  85,  25,  85,  18, 158,  25,  87,  18, 153, 146,
-146, 158, 153, 158, 158,  18,  30,  28,  28, 146, 158, 155,  87,  25, 158,
- 25,  25, 153,  18, 144, 146, 158, 146,  25,  25,  18, 153, 158,  31,  28,
- 85,  85, 155, 153,  85, 155,  18,  85,  18,  25,  18, 158, 146,  85,  25,
- 30,  85, 146,  87, 158, 158, 153, 146,  25,  84, 153, 153,  18,  25, 155,
-155, 153,  30, 153, 155, 158, 153, 146,  18,  24, 153, 153,  85, 153, 153,
-153, 158,  18, 158, 144,  87,  85,  84,  25,  31,  84, 146, 153, 158, 155,
-158,  18, 155,  18,  85,  24, 155,  18,  30,  84, 155, 146,  25, 153,  24,
-255,  30, 153, 158, 153, 153,  85,  85, 153,  18,  85,  85,  30,  25, 146,
- 25, 158,  87, 146, 158,  85,  30, 155,  25,  30, 153,  85, 146,  30,  18,
- 30,  85, 158,  18,  25,  18, 153, 153,  85,  84,  85, 153, 153, 158,  18,
-146,  85, 153, 153,  85, 147, 155,  25,  25,  85,  25, 158,  85,  84,  31,
- 84, 158,  25, 155, 153, 146,  18, 153, 146, 146,  28,  18, 153, 158,  31,
-153, 153,  25,  25, 153, 158, 153,  87, 158, 153, 158,  85, 158,  25, 153,
- 18, 153, 155,  18, 153, 155,  18,  25, 155,  85,  28, 153, 153,  30,  87,
-153,  85,  25,  25,  25, 146, 158,  25, 153,  24, 158, 153, 155,  85, 158,
- 25, 146,  18, 153,  87,  18, 153, 153, 146, 146, 144, 146,  28, 153,  18,
-158, 158,  28, 158, 153,  30, 146, 158, 153, 153,  25,  84, 147, 153,  30,
- 25, 147,  24, 153,  85, 146,  25, 144, 153, 147, 155, 153,  18,  25, 158,
- 18, 146, 158,  18,  25,  25,  85,  85,  18,  85,  18, 146,  24,  18, 146,
- 85, 147, 158, 153, 146, 153, 153, 144, 146, 158,  18,  25,  28, 153,  18,
-153,  18,  18,  25, 153, 158,  18,  25, 144, 155, 158,  87,  31,  84,  25,
-146,  18, 146, 153, 146, 153, 146,  25,  25, 158,  18,  25,  18, 158,  18,
-158, 155,  25, 146,  85, 153,  25,  25,  85, 158, 153, 153, 158, 144,  30,
-153,  30,  85,  30,  31,  30, 153, 153,  85, 153,  25, 153, 158,  85,  18,
-158,  30,  85, 153,  18,  25, 158,  84,  30, 146, 153,  25,  85,  18,  85,
-146,  25, 144,  18, 158, 147,  25,  25,  18, 153, 158,  25, 146, 158, 144,
-147, 153, 155, 146,  85,  31, 158, 153, 158,  18,  87, 153, 153,  25, 155,
-155,  25,  25, 153, 153, 153, 146, 146, 158,  85, 158, 158,  85, 158,  25,
- 85,  85, 153, 153,  18,  25,  87,  85,  25,  24,  24,  18,  30, 158,  28,
-155,  28, 153,  25, 146,  18, 153, 146, 153,  85,  30, 147, 147,  24, 158,
- 25, 153,  85, 153, 153, 153,  25, 153, 158,  18, 153,  85,  25, 158, 153,
- 85, 158,  25,  18, 153, 147, 153,  18, 158, 158,  24,  85, 147, 153, 153,
- 18,  18, 153, 153, 153,  30, 153,  85, 144,  18,  30,  25,  30, 153,  85,
-153,  28,  18,  85,  18, 158, 153,  87,  25, 146,  30, 153, 158, 155, 153,
-153, 144,  85,  18, 153,  84,  25, 153, 155, 153, 146, 146,  31,  30, 144,
-158,  85,  25, 158,  25,  30,  25,  87, 146, 153, 153,  30,  31,  25, 153,
- 25, 153,  25, 153,  18,  31, 153,  85,  18, 153,  30,  85,  28, 153,  85,
- 87, 158,  30,  31, 147, 153,  28, 153,  31, 158,  18, 146, 153, 153, 146,
- 85, 144,  85, 153, 158,  87,  28,  85, 153,  25,  31, 153, 153,  25,  28,
- 31, 153,  85,  25,  85, 158,  25,  18,  25, 144, 146,  85,  85, 144, 153,
- 85, 146, 147,  18,  87,  18, 146,  85,  25,  25,  18,  30, 153,  18,  85,
- 25, 153,  30,  25, 158,  18,  25,  85,  18,  18,  25,  85, 153, 155, 158,
- 25,  85, 153, 153, 153,  85, 158, 153, 155,  25,  31,  18, 153, 147, 153,
-153, 158,  18,  25,  25, 153,  30, 153, 158, 158,  25,  85,  18, 153,  85,
- 25, 153, 146, 146, 153,  25, 158,  18, 153, 144, 158, 153, 146, 153,  18,
- 28,  85,  18, 147, 153,  25, 153,  18,  25,  18,  25, 153,  18,  85, 153,
- 18, 158,  18, 146, 146, 158,  30, 255, 146,  24,  31, 155,  25, 153,  18,
- 30,  18,  85, 153,  31, 153,  85,  87, 158,  25, 153,  24, 153, 158, 158,
- 28,  18,  18, 153,  18, 158,  25, 158,  85, 158,  24,  25,  25, 158, 158,
- 25, 158,  85, 158,  30, 153, 147, 158,  25,  85, 153,  85, 153, 158, 158,
-153,  30,  28,  85, 153, 153,  18,  25, 153, 153,  18,  85, 147,  25, 153,
-146, 158, 158,  18, 153,  18,  85, 153, 153,  18, 153, 153, 158,  31,  18,
-146, 153, 144,  18,  25, 158, 153,  85,  30, 153, 153,  30,  85, 153,  85,
- 28,  18, 153,  85, 153, 147,  18,  85, 147,  30, 153, 153,  85, 153,  25,
-153, 153, 158,  85, 153,  18, 153,  18, 153, 158, 153,  18,  25, 153, 146,
- 31, 153,  31,  25, 146, 153, 153,  18, 158, 153, 153, 153,  30,  85,  25,
-153,  85,  25, 153,  18, 158,  31, 153,  85, 147, 146,  18,  85, 147,  25,
-146, 153, 153,  30,  25, 158, 153,  18, 158, 153,  18,  85, 146,  18, 153,
- 30, 158, 147,  25,  25, 153, 144,  18,  18, 153,  30, 146, 153,  25, 153,
- 25, 146, 153,  25,  18,  25,  18,  28,  25,  18, 147, 158, 153,  25, 158,
- 18,  25, 153, 153, 158, 144, 158,  25, 146,  85,  18,  18, 153,  25, 158,
- 85,  85, 153,  85, 146, 153,  30,  18, 153,  25, 158, 144, 158, 147,  85,
-158,  25, 153, 153, 153, 153, 153,  25,  85,  18,  85,  28,  18, 158, 153,
-153, 144,  85,  18, 158,  85,  85,  30, 153, 158, 158, 153,  30,  85,  85,
- 25,  18,  25,  85,  30, 146, 153,  25, 153,  85, 153,  25,  25,  18,  18,
-153, 156, 158,  25,  31, 153,  25,  25, 153, 153, 147, 153,  28,  85,  85,
- 85,  85, 144,  25, 153, 158, 153,  25,  28, 146,  28, 146,  16,  31, 144,
-153, 153,  30, 158, 153, 153,  85,  25,  85,  25,  18,  85,  31, 147,  18,
- 18,  25,  31,  25,  18,  30,  28, 153, 153, 153, 146,  85,  85, 158,  18,
- 85,  25, 146,  85,  31,  31, 158, 158, 158, 158, 144, 146, 147,  18,  31,
- 25, 158,  25, 153,  18,  18,  30,  25, 147, 153,  30,  18, 147,  25, 153,
-153, 153, 153, 158, 146,  18,  85, 158, 153, 158, 146, 153, 153, 153, 158,
-153, 158,  85, 158, 153,  18, 153,  85,  85, 146, 153, 158,  28,  18, 158,
-158, 147, 158, 153,  30, 146, 158, 153,  85,  28,  30,  25,  85, 144,  18,
- 30, 147, 158, 158,  85,  18,  85,  85,  16, 153, 146,  25,  25, 153,  31,
- 85, 147, 147, 146, 153,  18,  25, 158, 158,  18,  25,  30, 153,  85,  85,
- 18,  25, 158,  30,  25, 146, 156,  18,  85, 153, 158, 158, 153,  85,  30,
- 25, 146,  18, 147,  18, 153,  19, 158, 153,  25,  18,  18,  28, 153, 156,
-146,  25, 158, 159,  85,  30,  18,  30, 158,  85, 146,  16,  25, 158,  85,
-153,  18,  25,  25,  28,  18, 144, 144, 147,  85, 144, 153, 153, 158,  25,
-158,  25,  28, 158, 153,  25,  25, 156,  25,  18, 159, 156,  85, 156, 158,
-144, 158,  30, 144,  25, 156, 153,  85,  18,  30, 153, 146,  30, 153,  18,
-153, 146, 153,  28,  25,  85, 153,  18, 156, 153,  85,  30, 153,  31,  18,
-153,  18, 147, 146,  18, 158,  18, 153,  85, 156,  85, 159, 158, 158, 146,
- 25, 158,  30, 158,  85, 153,  25, 158,  28,  18, 159,  18,  25,  85, 146,
- 25, 158, 153,  25, 153, 153,  25,  18,  31, 146,  19,  25,  85, 158, 153,
-153, 158, 147, 153, 158, 158,  25,  18, 146, 153, 153, 153, 153,  18,  25,
- 25, 153, 144,  85,  85,  85, 147, 158,  25, 147, 153, 153,  30, 147,  28,
-144, 153,  18,  18, 144,  18,  18, 146, 147,  85, 153,  31, 158,  18,  25,
-158, 156,  28,  31,  28, 158, 153,  25, 158, 158, 146, 153, 158,  85,  85,
- 18, 144, 147,  28, 146, 153,  18,  28, 158, 147,  85, 153, 153, 153,  85,
- 28, 158, 156,  28,  16,  85,  18,  30,  25, 153, 158, 153,  25, 144,  31,
- 18,  25,  85,  85, 146, 153, 158, 158,  25,  30, 158,  25,  30,  85,  18,
- 28, 153,  85, 146, 158,  18,  16,  85,  25, 156,  18, 147,  25,  30,  85,
- 18, 153,  25, 156, 153,  25, 146,  25,  25, 147,  28,  25, 147,  85,  18,
-158,  25,  85,  85,  25, 158,  85,  25, 153, 158, 153,  25, 153, 153, 144,
- 18, 144, 153,  85, 153,  85,  18, 153, 158, 159,  19,  85, 159,  85,  30,
-158,  25, 153,  25,  31, 153, 153,  25, 153, 153, 153,  28,  18, 158,  25,
-146, 146,  18,  16,  18, 153,  18,  16, 144,  18, 158, 146,  28, 159, 153,
- 18, 158, 158, 146,  18, 144,  85,  18, 144, 156, 158, 153,  85, 153, 158,
-146,  31,  85, 153,  18,  18, 146, 146, 158,  25,  85, 159,  28, 255, 153,
-153, 147,  16,  18,  25, 147,  28,  85, 158, 153, 158,  85, 147,  85, 153,
- 18, 153, 156,  85, 156,  25,  25,  30, 144, 153,  25, 159, 153, 153, 147,
-153,  25, 153,  25,  18,  30, 158,  85, 153,  16, 156, 147, 158,  85,  28,
-144,  18, 158,  85, 158,  25,  18, 147, 153, 144,  85, 147,  25,  18,  85,
-153,  19,  28,  85, 156,  85, 147, 156, 144, 158, 158,  18,  30,  18, 153,
- 85, 158, 158, 153,  18,  28,  30, 153, 147, 158,  30, 153,  18, 153,  30,
- 18, 153,  18,  31, 146,  18, 153, 153,  25,  19, 153, 153,  25,  31,  85,
- 18, 156,  30,  18, 158,  28,  18,  25,  28, 158, 144,  25,  85,  25, 146,
-156, 146, 147,  85,  25,  16, 153,  28,  28, 156, 159, 144, 158,  30,  25,
-147, 158, 153,  16, 153,  25,  85,  85, 153,  85,  30, 158,  19, 153, 158,
- 25,  25, 153, 159,  85,  30,  25, 146,  16,  25,  25, 147,  19, 158,  18,
- 85, 144,  85, 153,  18,  31, 147,  18, 153,  30,  16, 159,  25, 159,  16,
-159, 158, 147,  31,  85,  31,  85, 153,  31,  85,  85, 159, 146,  85, 147,
- 25, 159, 153, 147,  25,  25,  18,  25,  25, 159,  85,  18,  18,  18, 158,
- 25, 158, 146, 147,  31,  85, 153, 158, 144,  18, 146, 153,  18,  19, 153,
-153,  25, 158,  25, 144, 158,  25,  16, 156, 158, 158, 153,  25,  25,  28,
-159, 147,  28, 156,  25,  25, 153,  25, 144,  85,  30,  18,  85, 153,  18,
-158, 146, 158,  19,  25, 147,  25,  28, 156, 147, 147,  18,  19, 147, 146,
-153, 147,  85, 146,  85,  85, 146,  28, 159, 144, 153, 158,  85,  30, 147,
- 25,  18, 146,  85, 158,  85,  85, 156, 146,  18, 156, 146, 158, 153, 153,
- 16,  18, 147, 158, 146,  28, 153, 153,  28,  18, 156, 159,  25,  85, 158,
- 16, 159,  19, 159,  16,  85, 153, 153,  18, 147, 144,  85, 156, 147, 158,
-153,  25, 153,  16,  25, 158, 153,  25, 153, 158,  30,  85,  25,  25,  25,
- 85, 147, 153, 147, 153,  85,  25,  19,  16,  85,  28, 158,  25, 153, 153,
- 31, 153, 153, 153,  18, 156, 153,  31, 159,  19, 158, 147,  28,  16, 158,
- 18,  25, 153, 158,  18,  28,  25,  25, 147, 158, 153,  25, 158, 156,  30,
-158, 147,  85, 158, 158, 153,  18, 147,  19, 153,  85, 147,  25,  85,  28,
- 16,  18,  30, 159,  25,  18, 153,  85, 156, 147,  18, 158, 147,  19, 153,
-153,  85,  18,  85, 156, 146, 146,  85, 144,  25,  28, 147,  25, 147, 153,
- 18,  28,  18, 158, 147, 156, 153,  31,  28,  18,  16,  85,  25,  16,  18,
-158, 158, 156, 144,  85,  28,  28,  19, 147,  25, 156, 147,  19,  30,  85,
- 19, 153,  18,  28,  28, 159, 158, 158, 153, 159,  25, 147,  25, 158, 158,
- 18,  18,  28,  85,  85,  30,  28,  30,  18,  25, 153,  85, 153,  16,  25,
-147,  25, 156,  31,  18,  25,  25, 147, 144, 153,  25, 153,  16, 153, 156,
-156,  28, 153,  85, 147, 146, 158, 158, 153,  28, 153, 153, 159,  25,  28,
- 85,  28,  25,  25,  25,  85,  25, 147, 158, 153,  18,  18, 158, 158,  85,
-144, 153, 153,  28,  16, 147,  25, 158,  85,  18, 147, 153, 146,  18, 147,
-144,  28, 158, 147,  85,  16, 153, 153, 147, 158, 158, 147,  25, 153, 153,
-159, 158, 159,  28, 153, 153, 153, 156, 158, 144,  85, 147,  28,  31, 158,
- 25, 156, 158,  16,  25,  30, 153, 156, 153,  85, 146, 153,  85,  16,  19,
-147,  25, 156, 159,  19,  25, 144,  19, 156, 153,  18,  31,  28,  18, 153,
-156,  25,  25, 147, 147,  85, 153, 158,  16, 158, 153,  28,  16, 147,  85,
- 25, 153,  19, 147, 147,  18,  85, 159,  18,  85,  85, 153, 146, 153,  25,
-156, 156,  28,  30, 153,  25,  30,  85,  25,  18, 147, 153,  19, 159, 153,
- 19,  18,  18,  85,  30, 153,  25, 153, 153, 158, 147, 147, 146, 146,  85,
- 19,  25,  25, 147,  28,  85, 156,  85, 156, 153,  18, 158,  85,  25, 156,
- 31, 153, 159, 158, 158, 147, 156, 159, 156, 153,  25, 153,  18,  19,  28,
-153,  85, 159, 159,  25, 156, 153, 153,  85,  25, 144,  30, 158,  18, 153,
- 28, 153, 159,  30,  18, 156,  85, 158,  19, 156,  31, 147, 158,  25, 156,
- 18,  85,  25, 156, 156,  18,  85, 158,  25, 158,  25,  25, 158, 146, 153,
- 28,  16, 147,  28,  28, 158, 153,  25, 159, 153, 147,  16,  25,  18, 159,
- 16,  18,  16, 147, 158, 146, 144, 158,  25,  85, 146,  18,  85, 153, 158,
- 28, 153,  30,  31,  31,  28, 158,  18, 147, 159,  25,  18, 158,  18, 158,
- 25,  19,  18, 153,  18, 146, 146,  85, 153, 158,  25, 147,  28,  18, 159,
- 28,  28, 144,  30, 159,  16,  19,  31,  16,  28,  25, 156, 147, 153, 158,
-158, 156, 158, 147,  25, 153, 156,  28, 156, 146, 156, 147, 153, 153, 147,
- 16, 153,  25,  19, 158, 153, 144,  16,  18, 153,  19,  85, 158, 153,  18,
- 85,  85, 147,  18,  85,  28,  85, 147,  25,  18, 153,  18,  31, 158,  28,
- 28, 159, 147,  85, 158,  18,  85, 146,  18,  16, 153, 147, 144, 153,  18,
-144, 153,  19,  18,  25,  85, 144,  25, 156, 153,  85, 153,  85,  25,  85,
- 31, 156,  30, 153, 153,  25,  19, 153,  28,  31,  25,  16, 159, 147, 153,
- 18, 153, 147,  25,  30,  25,  30, 156,  30, 158,  19,  16, 158,  28, 147,
- 28, 158, 158, 153, 156,  19,  85,  19, 156,  25, 158,  28, 156,  85, 146,
-153,  31, 153, 159,  25,  25, 159, 153,  18,  18, 153, 147, 146,  85, 153,
-144, 153, 158,  31, 159,  25,  85, 158,  28,  25, 144,  25,  16,  25,  19,
- 16, 153, 146, 153, 153,  18,  25, 153,  85, 156,  16, 158,  18, 159, 156,
-159, 156,  85, 159,  28,  28, 158, 158,  16,  28, 159, 153, 153,  85, 158,
- 85, 146,  25, 153,  85,  18, 153, 159, 147,  18, 153, 153, 153,  85,  30,
- 30,  28, 159, 153,  16, 159,  25,  19,  18, 144, 156,  18,  18,  18, 144,
-153, 147, 158,  28, 158, 156, 153, 147,  30, 147, 153, 156,  25, 153,  85,
-156,  16,  85, 153, 147,  30,  85,  19,  18,  16, 153,  31,  28, 147,  31,
- 25,  30,  85,  25,  85, 153,  31, 156, 158, 158, 147,  28, 147,  31,  19,
- 31,  18, 147, 158,  28, 156,  25,  16, 156, 158, 159, 153, 147, 159,  85,
- 18, 147, 156, 153,  28,  28,  28, 156, 147, 147, 153,  18, 158,  18, 147,
- 31, 147,  30,  30,  30,  85, 156,  85, 146, 156,  25, 159, 156, 158, 158,
- 19, 156, 147,  28, 147, 156, 147, 153, 147,  16,  30, 147, 156, 153,  18,
- 18, 156,  28, 144, 153,  25, 158,  16,  16, 158,  85, 159, 147, 147,  19,
- 31, 153,  19, 153,  18,  19,  85,  18, 146,  25, 153, 147, 153,  16,  16,
- 16, 153,  25, 156, 153,  25,  18, 156, 146, 153,  85, 144, 156,  18,  18,
-144,  19, 144, 159, 156, 153, 147, 156,  28, 147,  30, 144,  16,  25, 158,
-159, 146, 147, 159, 146,  19,  25,  25,  28, 159,  18, 147,  25,  25,  28,
-153,  16, 147,  19,  25, 147,  25,  18,  18,  31,  25, 146, 159,  18, 159,
-158,  28, 153,  16,  31, 159,  28, 153, 156,  28,  16, 153,  18, 153, 156,
-144, 158, 147,  31, 147,  19,  19,  18,  16,  31,  85, 158, 153,  16,  18,
-158, 147, 153, 153, 158, 156, 153, 159,  18,  19, 153, 147,  28,  18, 159,
-156,  25, 156,  18,  25, 156,  25, 156,  16, 159, 147,  31, 153,  16,  25,
-153, 153, 158,  16,  18,  85, 153, 156, 147,  28,  85,  19,  18, 159, 144,
- 19,  16,  28, 159, 156, 153, 159, 156,  28, 153, 153,  25, 144, 159, 156,
-159,  16,  31, 159, 153, 158,  25,  25,  16, 153,  16,  19, 153,  19,  19,
- 85, 158, 158, 153,  25,  19, 147,  25, 159, 144,  85,  19,  28,  16, 147,
- 16, 153, 158, 159, 153, 156, 147,  18,  18, 144,  19,  19, 156, 144,  19,
-153,  19,  19,  28, 158, 153,  85, 153, 153, 147, 147, 159,  85,  18,  28,
- 25, 156, 144, 159, 159, 156, 159, 159, 146, 156,  28, 144,  19,  16, 158,
-156, 159,  85,  19, 147, 144,  85, 144,  18,  28, 158, 156,  19, 153,  28,
-158,  18,  31,  30,  16, 147, 153, 144,  18, 159,  25,  16,  25, 147,  28,
-147,  25,  28, 153,  28, 153, 156, 159, 146, 147, 144, 159,  16, 144,  85,
- 19, 158,  28,  25, 158,  19,  18,  19,  85, 156,  25,  30, 153, 147,  19,
- 18, 147, 156, 156,  31,  18, 159,  18,  16, 159, 147,  16, 153,  85, 158,
-156, 146,  18,  25,  16, 153, 156, 158,  19, 147, 147,  31, 159, 153, 159,
-156, 147, 147, 158,  19, 156,  18, 156,  18, 147, 146, 153, 159,  18, 156,
- 25, 147,  30,  16,  16,  31, 159, 144, 156,  25, 147, 147,  85,  19, 144,
-153, 144,  18, 153, 153,  28, 146,  85,  28,  18,  28, 147, 159, 156,  25,
-156,  18, 146, 158, 153,  16,  85,  19,  16, 153,  85,  16,  25, 147, 159,
-153, 147, 156,  28, 159,  28,  28,  19,  18, 147,  25, 159, 156,  19, 147,
-147, 159, 153, 147,  19,  25, 147, 158,  30,  16, 147,  25, 158,  18,  25,
- 18, 153, 147,  25,  25, 147, 159, 159,  19,  31, 146, 153,  85, 146, 147,
-156,  19, 146, 156, 156, 158,  18, 147,  19, 147, 156, 156,  28,  18,  85,
- 16,  16,  16, 156, 159,  16,  19, 144, 158, 158, 156, 156, 146, 158, 144,
- 28, 147,  16,  85, 144, 146, 153,  31, 153, 158, 153,  28,  30,  19,  28,
- 16,  16, 158,  28, 147, 158,  25,  85, 156,  16, 159,  31,  16,  18, 159,
-147, 159,  28, 158, 153,  28,  19, 147,  28,  19, 153,  25, 153,  28,  28,
-144, 158,  19,  28,  30, 147,  25, 153, 147,  19,  85, 159, 147,  19,  16,
- 18, 147, 156, 144, 144,  19, 158, 147,  28, 147, 147,  31, 147, 159, 147,
-147, 153, 146,  16,  19,  28, 147, 144, 147, 147,  19,  28, 159, 156,  19,
-156, 156, 158, 147, 159, 153, 156, 158,  18,  25,  28,  19, 147,  16, 147,
- 19, 156, 156,  19, 147, 147, 156, 156, 156, 159,  31,  28,  16,  19,  18,
-147,  18, 147,  25, 159,  18, 153, 153,  28, 144, 156,  85,  28,  28,  31,
- 28,  28,  25,  19, 158, 156,  28, 147, 153, 147, 159,  18, 153, 159, 144,
- 16, 147,  16,  25,  85, 147,  28, 156, 156,  16, 153,  18,  16, 153, 147,
- 19,  85,  28, 156,  18,  30,  19,  85,  30, 147, 146, 153, 159, 147,  19,
-156,  19,  16, 156, 147, 144, 147,  28,  25, 147, 159, 146,  16, 153,  16,
- 18, 144, 156, 156, 158,  25, 159, 147,  16, 147, 146,  25,  19,  18,  16,
-144,  19, 153, 144, 156, 156, 153,  16, 159,  19,  16, 159,  28, 147,  85,
- 28,  19, 156, 156,  19,  28,  25,  25, 158, 153, 159, 153,  28,  85, 153,
-147, 158,  19,  16, 147,  16,  19, 153, 156, 158, 146,  30,  25,  85,  16,
-147, 153,  28, 159,  28,  85,  28, 146, 153, 156, 158,  18, 156, 147, 147,
-144, 153,  16, 158,  28,  85,  16, 153, 156, 159, 153, 147,  18, 158, 147,
-156,  16, 153, 156,  25, 159, 147, 156,  19, 153,  25,  25, 147,  16, 153,
- 16, 147,  31, 144, 159,  16,  85,  18,  25,  19, 156,  31,  85,  28,  28,
-159, 147,  19,  31,  31,  18,  18, 147,  18, 147,  18,  25, 147,  19,  18,
-156,  19, 153,  19, 147, 153,  16,  31,  19, 144, 147,  28,  19, 147, 147,
- 28, 156, 159,  18,  28,  28, 153, 153,  25, 156, 156, 146, 156, 156,  18,
-156, 159,  28, 144, 147, 153, 147, 144, 156,  31, 147,  28, 147,  16, 159,
- 19,  28, 144, 147,  19, 144,  85,  16,  19, 153,  19, 156,  28, 159, 159,
-159,  16, 147, 159, 159, 156, 156,  31,  16,  18,  31,  85,  16,  19, 158,
- 18, 156,  19,  19, 158, 153, 146, 147,  16, 153,  85,  18,  28,  85, 156,
-147, 153, 159,  31, 147,  16, 147, 159, 153,  16,  16, 156,  28,  18,  18,
-156, 156, 147, 147,  16, 153,  18, 153, 156, 159, 159,  25, 144, 156,  30,
-156,  28, 156, 156, 159,  19,  31, 159,  19, 147, 147, 147, 153, 158,  16,
-147,  19,  28,  19, 156, 153,  85,  19, 156,  30, 156,  16, 159, 156, 147,
-153, 147,  19, 153,  19,  16,  31, 158, 147,  16, 147,  16,  16,  16, 156,
-146, 147,  85,  16,  25,  19, 153,  16, 147, 156,  25,  18, 158, 156, 153,
- 19, 156, 156, 156, 159,  25,  85,  18, 147,  16, 159, 158,  85, 255, 159,
-156,  19,  85, 156, 156,  28, 153, 153, 158, 153,  19, 159, 153,  25,  28,
- 30, 156, 153,  18,  28, 156, 147,  85, 156,  28, 147,  28, 147,  25,  18,
- 31, 144, 156, 147, 159,  28,  18,  28, 156, 153,  25,  16,  16,  25,  16,
-156,  28,  16, 159,  19,  19, 144, 147,  18,  85,  85, 144, 147,  30, 147,
- 28, 146,  18,  16,  16, 159, 147, 147, 147, 158, 153,  16,  19, 156, 147,
- 16,  85, 147, 156, 147,  28,  16,  85, 147,  18,  16, 156, 153, 156,  18,
-147, 147,  16,  19, 156,  31,  30, 156,  25, 156,  31,  16, 153,  31,  19,
- 19,  31, 144,  28,  19,  25, 147, 153, 159, 159, 153, 147, 156, 159,  28,
-153, 159, 147, 156, 156, 147,  19,  16, 147, 159, 147, 156,  28, 153,  16,
-159,  16, 147, 159, 159, 156,  28, 153, 156, 147, 159, 156,  16, 147, 146,
-156, 156, 159,  85, 147, 153, 153, 147, 159, 153, 159, 156,  28, 159, 156,
- 28, 159,  28, 158,  28,  19, 156, 147,  16,  19,  28, 153, 147,  19,  16,
- 16, 144, 156,  19, 153,  85, 158,  16, 156,  16,  16,  28,  16, 159, 156,
-156, 158,  25,  19,  16, 156, 147,  28,  28, 147,  28,  28, 156,  19, 147,
-147,  19,  28, 156,  19, 156, 144,  16, 147, 156,  31,  31, 153, 159, 156,
-156, 156, 159, 158,  28, 147,  31, 147, 159, 156,  28,  16, 153, 146, 156,
- 19,  31,  16, 147, 146, 159,  16, 159,  18,  19,  19,  18,  16, 144,  25,
-156,  19,  18, 156,  28,  19,  31, 159, 147, 156, 159, 159,  19,  31,  19,
- 19,  16,  28, 153, 156,  85,  31, 153,  16, 144, 153,  31,  25,  85,  16,
-147,  85,  19, 156, 156,  25, 159, 147,  16, 153,  16, 156, 147, 147,  28,
-159,  19, 158, 153, 159,  19, 146,  28,  31,  18,  16,  28,  85, 147, 147,
- 28, 153, 147,  85,  31, 144,  16,  28, 147, 147, 159, 159, 147, 159, 147,
-147,  25,  19,  19, 156,  85,  25, 159, 147, 156,  18, 159, 147, 147, 153,
- 28,  16, 156,  16,  16, 147, 159,  19,  30, 147,  28, 147, 159, 153,  16,
- 16,  25,  19, 156,  30,  19, 147, 156,  19,  16,  18, 156,  28,  28,  28,
- 28,  31,  16,  19,  19,  25,  19,  18,  28,  19,  16, 147,  16, 158, 159,
- 19,  19, 156, 144,  18, 159, 147,  28, 147,  16,  16, 147, 156, 156, 159,
- 19, 147,  28, 159, 147, 159, 147,  16, 147,  19, 159,  30,  19, 147, 147,
-156, 156,  28, 147, 153,  19,  19, 156, 144, 153, 147, 153, 147, 156, 144,
-147, 156,  28, 159, 147, 146, 147,  85,  16,  19,  31,  19, 144,  16, 147,
-147, 156, 156, 159,  28,  28, 156,  31,  19, 144,  28,  16,  28, 147,  19,
- 16, 144,  16, 159, 147,  28, 156,  18, 147,  28, 156, 147, 159, 159,  25,
-147, 159, 147,  16,  16, 159, 153, 147, 156, 147, 147, 147,  31,  16, 159,
- 28,  16,  19,  16, 147,  19, 147,  16, 153,  19,  16,  16, 159, 153,  16,
-153, 147,  19,  18, 153,  19, 146, 156, 153, 147, 158, 156,  16,  85,  28,
- 19,  28, 147, 156, 147, 144,  18, 153, 156, 156, 156, 147,  28, 159, 147,
-156, 153, 147,  28,  19, 147, 156, 147,  28,  19, 156,  19,  18, 159, 159,
-147, 159,  19,  28,  19,  18, 159,  19, 144, 147,  16, 156,  19,  28,  16,
- 28, 159,  16,  16,  28,  28, 159, 144,  28, 156,  85,  16,  19,  28, 156,
- 16,  16,  19, 156,  16, 147, 156, 144, 147, 159, 159,  19,  28, 158, 158,
- 28, 156, 159,  16, 159,  19, 159, 158, 147,  16, 147, 156, 156, 147,  28,
-156, 159,  19, 159,  19,  16, 156, 147,  28, 147,  16, 147, 147, 159, 156,
-159, 156, 156, 144,  28, 159, 156, 147, 147, 156, 159,  16, 147,  16, 147,
-156,  16,  19, 159,  16,  31, 159, 159, 144,  28, 156,  31, 156,  19,  19,
- 31,  16,  16,  16,  19, 159,  25, 159, 156, 144,  31,  28, 156,  28,  31,
-144,  16, 147, 147,  28, 159,  16,  19, 156,  16,  19,  19, 159,  16, 159,
-147,  19,  28,  28, 147,  19,  16, 147, 159, 147,  28,  19,  28, 153,  28,
-147,  16, 156, 147, 147, 156,  19,  19, 147,  28, 147,  31, 147, 144,  19,
-156,  31,  28, 147,  19,  19, 159,  16,  28, 159, 147,  28,  16,  28,  19,
- 18,  31, 159, 144, 147,  28, 144, 144,  85, 147,  16,  25, 156, 156, 159,
-159, 156, 156,  28, 159, 159, 156, 144,  28, 156, 144,  28,  19,  28, 153,
- 19, 147, 147, 147, 159,  31, 144, 156, 159,  19,  16, 156, 156,  16,  19,
- 19,  16,  19,  28,  28, 147, 147,  16, 144, 147,  31, 159,  28,  25, 147,
-147,  16,  19,  85, 158,  16, 147, 147, 159, 144,  16,  19,  28, 147, 146,
-146,  28,  19, 147,  28,  19,  25, 147,  16, 147,  19, 156, 159,  16, 159,
-159, 144, 156, 147,  28,  16,  16, 153, 147,  16, 156,  28, 156,  16, 147,
- 16, 156, 147,  19,  19,  31,  16, 159,  16, 147, 144,  28,  18,  28, 147,
-144, 156,  25, 156, 156, 159,  19,  28,  19, 147, 147, 159,  19, 159, 156,
-159, 156,  16, 147,  31, 156,  19, 147, 156, 156,  16, 156,  31,  28,  28,
-147,  16,  16, 156, 159,  31,  19, 144, 159,  19,  28,  16, 147, 147,  31,
-156,  16,  19,  28, 156, 159, 147,  16,  19,  16, 156, 147,  16, 159,  28,
-156, 156,  19,  31,  19,  16, 156,  19, 147, 147, 156, 159,  19, 147, 144,
- 19, 156,  16,  28,  31,  16, 144,  28, 147,  16, 144, 159,  31, 159,  28,
- 19, 159,  19,  19, 159,  19,  19, 147,  85, 159,  16,  16,  28,  19, 159,
-156, 147, 156,  16, 159, 147, 147,  16,  19,  28,  28,  16,  28, 147,  28,
-144, 156,  28,  16, 147, 147, 159, 147, 156,  19,  16, 147,  16, 147, 159,
- 16, 156, 159,  28, 156, 156, 147, 156, 147,  19, 156, 156,  19, 159,  16,
-156,  19, 144,  16, 159,  19, 147, 159, 147,  28, 159, 147,  31,  28, 144,
-159, 156, 144, 159, 147, 147, 156,  16,  28,  19,  16, 156, 147,  28, 156,
- 28, 147, 147,  19,  28, 159,  19, 159, 147, 147, 147, 147, 156, 144, 144,
-156, 144,  19,  28, 159, 156, 144,  16,  19,  31,  19,  19, 147,  28, 147,
- 31,  19, 159, 159, 156, 147, 144, 147, 147,  19, 147, 156, 144,  22, 159,
-147, 156,  28, 156, 159, 144, 147, 159, 159,  19,  16, 156,  19,  16,  16,
-159, 147, 156, 156, 159, 147, 147,  16, 159,  28, 147, 156, 159, 147, 156,
- 16, 156, 147, 144, 159, 156, 157,  16, 144,  28, 156, 156, 147, 159,  28,
- 16, 144, 147, 144, 150,  28,  19, 156,  16, 147, 159, 159,  19, 156, 147,
-156, 159,  16,  16, 147,  16, 159, 147,  19, 156, 159,  28, 106,  31,  28,
-159, 159,  28, 159,  31,  19,  19, 147,  19, 156,  19,  16, 147, 147,  16,
-147,  16,  19, 156,  16,  28, 156,  19, 145,  19,  28,  19,  19, 159, 159,
-144, 159, 156,  16,  16, 156,  16, 156,  16, 156, 147, 156, 156, 156,  31,
-147,  31, 159,  16, 156,  19,  16, 147, 156, 159, 147, 147, 145, 156,  16,
-147,  22,  19,  19, 156,  31,  19,  28, 156, 156, 147,  31,  28,  16,  28,
- 19,  19,  31, 147, 156,  19,  16, 159,  19, 156, 147, 147,  28, 106,  19,
-156,  28, 156, 144, 147, 144,  28,  28, 147,  16, 156,  19, 159,  28, 159,
-147, 156,  16, 156,  19, 147, 147,  16,  19,  28,  28,  19, 156, 156,  28,
-144,  16, 156, 156, 147, 159,  28, 147, 147, 159,  19,  19,  28,  19, 156,
-156, 147, 147,  31,  28,  22, 150,  19, 159,  16, 159,  28, 156, 144,  28,
- 16, 159,  17, 159, 156, 144,  19, 147, 157, 147, 147, 156, 150, 144,  17,
- 31, 147,  28,  28, 144, 147, 147,  16, 156,  31, 156,  19,  19, 147,  28,
-156, 159, 147, 147, 147, 147, 147,  19, 156,  31, 156,  19, 156,  16,  19,
- 16, 147, 150, 147,  22,  19, 159, 156, 147,  16,  19,  19, 159,  28,  28,
- 28,  31,  22, 156,  16, 147,  16, 147,  19,  31, 147, 156,  28,  16, 147,
-150,  16,  16, 106, 159, 147, 159,  28,  22,  19, 157, 147, 147,  31, 159,
-147, 156,  28, 147,  28, 156,  19, 147, 147,  19, 159, 147, 106, 159,  16,
-159,  16, 157,  31, 159, 159,  19,  28, 106, 159, 147, 156,  19, 147, 159,
- 16, 156, 147, 147, 144, 147,  28, 156,  16,  16,  19,  28,  28, 147, 159,
- 31,  16, 150,  28,  16,  31,  17, 147, 147,  28,  19, 156, 159, 145, 150,
- 28, 144,  19,  28, 147, 147, 147, 159, 159, 147, 159, 156,  16,  28, 159,
- 19, 150, 147, 147, 156,  31,  19, 147, 156, 156, 144,  19,  16, 159,  28,
-147, 156, 156, 147,  16, 156, 156, 147, 144, 147, 147,  28, 147, 156, 144,
- 19,  28,  16, 159,  16, 106, 147,  22,  28,  28, 150, 159,  16,  31, 147,
- 28, 156,  19,  28, 144, 156,  28, 156,  16, 157,  29, 159, 156, 150, 144,
- 19, 159, 150,  16,  16,  17, 159,  19, 147, 147,  16,  16, 147, 150,  19,
- 28,  17,  28,  19, 156,  19, 147, 159,  16,  28,  31, 156,  28,  19, 147,
-156,  19, 145, 157, 144,  16,  16, 144, 106,  17,  19,  28, 147, 156,  28,
-147,  28, 147,  16,  17, 156, 156,  28, 147, 159,  16, 156, 147,  28, 147,
-156, 106, 147,  19, 147,  16,  28, 147,  19,  31, 145, 156, 144,  16, 156,
-147, 150, 106,  28, 147,  16,  19, 147, 147,  19, 156, 144, 147,  28,  16,
-147,  19,  17, 159,  19,  19, 159, 156,  16, 156, 144, 159, 156, 156, 159,
- 31,  19, 159,  19, 147, 147, 147,  19, 159, 147,  31, 150, 147,  19, 144,
-159, 147, 144,  19, 156,  19, 156, 147, 156, 156,  28,  16, 147, 156, 150,
-157, 156, 147,  16, 147,  28, 156, 147,  16,  28, 147,  28, 147, 156,  28,
-150, 156, 147,  22, 106,  22,  19,  29,  19, 159, 159,  28,  16, 159,  19,
- 22,  19, 156, 156,  16,  16,  28, 147, 156, 156, 156, 156,  28,  16, 147,
-159, 156,  19, 159, 147,  22, 156, 156, 159, 147, 159,  28,  19, 159,  16,
-106, 159,  19,  19, 156, 156,  28, 147,  29, 147,  19,  16,  28,  16, 144,
-150, 156,  28,  22, 156, 156,  16,  16,  17, 156,  19,  17, 159, 157, 147,
- 31,  19, 159,  16, 156, 156, 106,  31, 159, 157,  16, 159, 159,  28, 144,
-159,  19,  16,  31, 156,  31,  19,  28,  19, 144,  28, 106, 147, 106,  28,
- 19,  16,  28,  16, 150, 156, 159,  19, 159,  17, 150, 150,  19, 150, 156,
- 28, 147, 159, 145, 159,  16, 147, 106,  16, 147, 150, 147, 156,  28,  16,
- 16,  19,  19,  22, 147,  28,  16,  28, 157,  28,  19, 147,  16,  28, 150,
- 28, 156, 147, 156,  19,  17,  19, 147, 106, 157,  16,  28,  31, 147, 147,
- 22, 145,  19, 159, 156, 147, 144,  28,  22, 144, 106, 147,  28,  16,  28,
-159, 106,  31,  19, 159,  31, 144, 156,  29, 159,  28, 159,  31,  16, 156,
-147,  17, 159, 150,  19, 147, 156, 156,  19,  22, 159, 106, 156,  19, 156,
-147, 144,  31, 147,  29,  16,  16,  19, 150,  28, 157, 144, 147,  22,  17,
- 28, 159, 147, 159, 150, 147,  29,  31, 156,  31, 147, 150, 106,  31,  31,
-147, 150, 147,  16, 147, 147, 147,  31,  28, 159,  31, 147, 159, 147,  22,
- 19, 150,  16, 150, 157, 156,  16,  19, 145, 106,  22,  28, 156, 150, 147,
-147, 147, 147, 159,  16, 147,  22, 150, 147, 147, 147,  17,  28,  22, 159,
-144, 147,  17,  17, 150, 145, 156, 106, 159, 147, 147,  22,  31,  19,  28,
- 16, 150,  28,  17, 150, 145, 106,  19, 157,  16,  28, 159,  19,  16, 159,
-147, 144,  16, 147, 144,  16, 159, 255, 156,  28,  19, 156, 147,  19,  17,
-159,  28, 156, 144, 159, 150,  28,  28, 159, 150, 156, 150, 144, 159,  16,
- 19,  19,  16, 156,  16,  28,  16, 145, 159,  17, 156,  28,  29,  28,  17,
-157,  22, 144,  28, 147, 156,  16,  17,  22, 147, 156,  16, 145, 159,  28,
- 28, 159, 156, 159,  19, 156, 156, 156,  22,  16, 147, 156, 147, 144, 159,
-147,  31, 150, 147,  22, 156,  29,  22,  16, 156, 147, 156,  16,  28,  28,
- 16, 147,  16,  19, 150,  19, 147, 159, 159, 147, 150, 156, 106,  19, 156,
-147, 144,  17, 147,  28, 144,  31,  28,  19,  29, 156,  22,  16, 150,  31,
-156, 157, 156, 156, 157,  22,  31, 159, 157,  22,  16, 147, 106, 156, 106,
- 16, 156, 106, 147,  19, 159,  31,  19, 147, 150, 147, 147, 150, 156, 150,
-144,  19, 106, 157, 147, 147, 147, 150,  28,  29,  19, 156,  17, 147,  19,
-147, 156, 147,  28,  19, 156, 106,  28, 147, 157, 145,  19,  31,  28, 150,
- 16, 157, 156,  22,  19, 156, 147, 159, 147, 150, 156, 144, 144, 147,  19,
- 22, 150, 156,  16, 156, 144,  16, 150, 159, 147, 147, 156, 147, 156,  19,
-157,  16,  28, 106,  17, 159, 159,  28,  16,  28,  22, 156,  16, 156,  22,
-157,  31, 150, 157, 156, 147, 147,  28, 159, 150, 147,  22,  28,  19, 106,
- 22,  19, 159, 157,  16,  16, 157,  19, 150, 156, 150, 145,  29, 147, 144,
- 16,  31, 159,  19, 159,  17, 156, 106, 106, 147,  19,  19,  19,  19, 147,
-144, 156, 147,  19, 150, 156, 150, 159,  28,  16, 159, 147,  22, 156, 147,
- 22, 147,  28,  16,  17,  28,  17, 159, 156, 150,  22,  31,  16, 156, 106,
- 28, 147, 147,  22, 144, 147,  16, 156,  17,  16,  22,  28, 147, 147, 147,
- 28, 150, 159,  17,  19,  28, 150, 156,  16, 159,  19, 157,  22,  28,  19,
- 16, 147,  28, 159, 144, 147,  29, 157,  31, 106, 150, 157, 159, 147, 150,
- 17, 159, 156, 147, 156,  28, 145,  19, 147,  17, 150, 106, 147, 147,  28,
-147, 159, 159, 157, 156, 159, 147, 144, 147, 150, 157,  19, 159,  16,  19,
- 17, 147, 150, 159, 150, 150, 144, 159, 147,  19,  31, 150, 159,  22, 106,
- 22, 147,  28,  28, 159,  22, 150, 147,  31, 106, 106, 145, 147, 147,  19,
-147, 144,  19,  19,  19,  28, 145,  28,  16,  17, 147, 144, 144, 144,  19,
-144,  31, 145, 159,  16,  28,  31, 106,  31, 147,  19, 159,  17, 106, 156,
- 28, 156,  22, 147, 147, 145,  17, 156,  16,  16,  28,  17,  19,  16,  16,
-145,  29,  19,  22, 144, 144, 106, 144, 150, 147, 150, 156,  22,  28,  31,
- 28, 147,  28, 150,  16, 106, 156, 147, 157, 147, 157, 147, 147, 106, 106,
-159, 106, 145,  17,  22, 147, 144, 150,  16, 147, 147, 159, 159, 157, 147,
- 28,  19, 157, 147, 150,  19, 157, 150,  28,  22,  31,  17, 150, 156,  22,
-147,  28, 147,  17, 156, 159, 147, 147, 150,  16, 156,  19, 147,  22, 106,
-150,  16, 147,  28, 147,  16, 157, 157, 147,  17,  16,  22,  19, 147, 145,
-150, 150, 156, 156,  19, 106, 150, 157, 145, 147,  28, 156,  16,  28,  28,
-159, 147,  28,  19, 147, 150, 147, 157,  19, 147, 159,  28,  28, 147, 144,
-159, 156, 106, 145,  19,  16, 150, 147, 157, 159, 156, 150,  17, 150, 147,
- 31, 159,  31,  28, 156, 159,  19, 144,  16, 156,  31,  16,  16, 159,  31,
-147, 156,  19, 106, 156, 150,  31,  16, 156,  29,  29, 147,  17,  16,  19,
-156, 157,  22,  28, 147,  31, 156, 147,  22, 150,  22, 147, 157, 156,  29,
- 19, 150,  28, 157, 144, 150, 157, 159, 144, 106, 156, 150, 157, 147,  16,
- 28, 159,  28,  28, 150, 145, 144, 147, 159, 147, 150, 147,  19, 147, 106,
-144,  17,  17,  28, 144,  17, 147, 156, 150, 156,  19,  28, 156, 159, 159,
- 28, 159, 156, 150,  17, 145, 106, 144, 157, 150, 144,  16, 144, 147, 157,
- 16, 147, 156,  22,  28,  19, 150, 144,  28,  22, 157, 106, 147, 156,  19,
- 19,  22, 106,  19,  17,  22, 157,  28, 150,  16,  31,  22,  16,  19,  17,
- 22,  17, 159,  22, 106, 156,  16,  22, 147,  17, 156,  19,  19, 157, 150,
-106,  16, 156, 156,  28, 147,  31,  17, 147,  16,  19, 147,  16,  19,  19,
- 28, 106,  17,  28,  31, 147,  19,  28, 147, 150, 159, 150, 159, 157, 106,
-147, 106, 157,  28, 147,  28,  17, 147,  31, 159, 144, 147,  16,  16, 106,
-156,  19,  16,  19, 147,  16, 150, 147, 157,  17, 150, 147, 156, 156, 106,
- 28, 159, 150,  22, 147,  28, 147, 106, 157, 150, 157,  22, 106, 159,  28,
-157, 144, 147,  28,  22, 150, 147,  28,  28,  19,  22, 147,  31,  19,  17,
- 16, 156,  17, 144,  22, 156, 150, 147, 159, 159, 106, 156, 157, 156, 157,
- 31, 147, 156, 147,  19, 145, 147,  29, 150, 147, 147, 147, 147,  17,  16,
-147, 147,  19,  19, 150,  22, 156, 157, 106, 106,  31, 157, 147,  22, 159,
-145,  16, 156,  17, 147, 144,  22,  19, 144, 159, 147, 144, 150, 144, 147,
- 16,  22,  22,  16, 157,  22, 150, 157,  19,  29, 159, 157,  17, 147, 106,
-156,  29, 150,  16,  16, 147, 147,  29, 106, 147, 150,  17, 150, 157,  22,
- 31, 156,  28,  19, 150,  31,  29, 106,  19, 106, 159, 157,  28, 147,  16,
-150, 147, 150,  19,  28,  17, 147, 156,  29,  17,  19,  16, 144,  28,  16,
- 22,  16,  17, 157, 150, 156, 147, 159,  22,  17, 144,  16,  19,  22, 150,
- 22, 145, 156, 150, 150, 106,  22, 147, 144,  16,  19, 159,  17, 144,  31,
-156, 147, 150, 144,  28, 144,  19, 147, 144,  17, 150, 147,  28,  19,  28,
- 17,  28,  22,  31, 157,  16, 150, 157, 159, 106, 106, 147, 159,  28, 147,
- 28, 147, 147, 145,  19,  28, 150, 145, 147, 147,  19, 157, 150, 106, 159,
-144,  22,  17, 150,  16,  29, 159, 150, 150, 150,  19,  16,  16,  22,  22,
-147, 150,  17, 159, 150, 145, 147,  22, 145, 106,  22, 106, 156, 147, 147,
-144, 147,  16, 156, 157,  31, 106, 150, 159, 147, 147, 147,  19,  31, 144,
- 22, 156,  17, 144, 147, 159, 147,  22, 157,  28,  17, 156, 156,  22, 150,
-156, 150,  29,  19,  17,  22, 147,  22, 159,  28,  19,  22, 156, 157, 157,
- 28,  16, 106, 156,  22, 147,  31, 106, 147,  19, 106, 150,  17, 106, 147,
- 28,  17, 150, 157, 156,  31, 156,  22, 147, 159, 157, 106, 145, 106,  19,
-150, 156,  17, 150, 106, 147, 147, 150,  31,  31, 159, 157,  19,  16,  17,
-156,  16, 147, 147,  17,  22,  17, 147, 157,  22, 150, 150,  22,  17, 150,
-157,  22, 147, 106, 157,  19, 157, 147, 145, 156,  31, 106, 157, 147,  19,
- 17, 157,  22, 106,  17, 147,  19, 147,  31,  28,  17, 157,  29, 147,  17,
-157,  22, 147, 159,  19,  28,  22,  17, 144, 106, 157,  28, 157, 156, 147,
-159, 106,  16,  22, 147, 145, 157, 147, 144,  19,  28, 150,  28, 106, 150,
-106,  22, 156,  22, 145,  28,  22,  22, 147, 106, 159,  22,  16,  22,  28,
-147, 150,  17,  16, 144,  16, 156, 150,  17, 159,  17, 150, 144,  22, 150,
- 31, 150, 157, 157, 144,  17,  16,  31, 106,  17, 147, 147, 145, 145, 147,
-157,  28,  17, 145, 159, 150,  16,  31,  19, 147, 159, 147, 106, 150,  22,
-156,  28, 159, 159, 159, 147,  19,  16,  28,  17, 159, 150, 144,  16,  16,
-150, 147,  16, 147, 145, 145, 147,  16, 150,  16, 150, 157, 147,  29, 157,
-150,  22,  22,  28, 159, 157, 150,  29,  17, 157, 150, 145, 145,  22, 150,
-106,  16, 157, 159, 150,  19, 150, 147,  22, 156, 150,  28,  22, 157, 147,
-147,  17, 147,  22, 106, 145,  22, 150, 150, 106, 145, 157, 144,  29, 157,
-150,  16, 150, 147, 157, 147, 156, 106, 150,  28,  17, 150,  17,  22, 106,
-147, 147,  16, 157, 144, 150, 150, 147, 147,  22,  28, 156, 106, 106,  22,
- 17, 145, 150,  19, 106, 147,  28, 106, 147, 147, 147, 144, 144, 156, 157,
- 22,  17, 156, 150, 157,  28,  28, 159,  16, 157,  17, 150, 150, 144, 106,
- 28,  17, 150, 156, 147, 106,  19, 156,  22, 145, 156,  22,  22,  19, 157,
- 19,  19,  19, 156, 147,  17,  22,  22, 106,  22, 145, 156, 106, 157,  19,
- 31, 147,  28, 157, 157, 147, 147, 150,  28, 147, 150, 156, 156, 157, 156,
-147,  17, 145,  29, 150,  19, 156,  16, 157,  22, 150, 150,  28, 106,  16,
- 17,  22,  16, 156,  28,  22,  31,  22,  22, 145, 147, 156, 157, 106, 150,
- 17, 150,  22,  29, 106, 106, 147, 156, 150,  22,  19, 144,  17,  22,  22,
-157, 144, 145, 150, 106, 144,  19,  28,  22, 147,  22, 157, 150, 145, 144,
- 17,  16, 144, 145,  29, 157, 150,  16, 156,  17, 106, 157,  29,  31,  19,
- 16,  29, 150,  29, 147,  28, 147,  17, 156,  19, 156, 157,  19, 106, 150,
-157, 147, 157,  17, 150, 147, 147, 159, 106, 144, 144, 106, 157, 150, 150,
-159,  28, 157, 159,  17, 150, 144, 106,  29, 156,  22, 150, 145, 150,  17,
-147, 144, 144,  28, 159,  17, 147, 150,  29,  22,  17,  17, 150,  19,  22,
-144, 106,  22, 159, 150, 144,  16, 106,  31,  16, 147,  22, 157, 159,  22,
- 22,  16, 157, 157,  16, 150, 106, 156, 145, 150, 106,  17, 150,  17, 145,
-144, 147,  17, 145, 147, 147,  17, 150, 150,  29,  22, 159, 157,  22, 106,
- 22, 159, 106, 147,  17,  22, 145, 150, 150,  19, 156, 150,  16, 157, 145,
-147, 159,  22, 150, 147,  22, 150, 157, 150, 157, 147,  16, 145,  17,  29,
- 22, 150, 147, 150, 106,  22, 147,  16,  17, 147, 106, 156,  28,  17, 106,
-150, 106, 147, 147, 144, 106, 145, 147,  28,  16, 157, 156,  22, 157, 157,
-150, 157,  16, 150,  17, 106,  17,  22,  19, 159, 144, 106, 150,  22, 150,
-159, 150, 150,  22,  22, 157, 150,  17,  31,  29,  16, 106, 147, 150, 147,
-157,  19, 144, 159,  28,  28,  17, 157, 150, 159,  17, 156, 145,  22,  22,
-147, 150, 150, 147, 157,  17,  17, 147, 145, 150,  19,  17, 150, 150,  29,
- 31,  28,  31,  17, 150, 150,  17, 157, 144,  22,  22, 150, 156, 150, 156,
- 17,  22, 156,  17,  19, 144, 159, 156, 156, 147, 150, 157,  22, 157, 150,
-147, 106,  22, 106,  22,  22, 150, 144, 147, 150,  29,  22,  28,  22,  29,
- 29, 156, 106,  29,  17, 147,  31, 157, 157, 147, 157, 150,  29, 145, 150,
-150,  22, 106, 106, 106, 145,  17, 106, 157,  22,  22, 147, 157,  19,  16,
-106, 150, 157,  22,  17, 147, 147, 157,  22, 147, 147,  28, 157, 106,  28,
-106, 159,  16,  31, 106, 150,  22, 145, 156, 144, 150, 147,  17, 150, 150,
-147,  17, 106,  31,  22,  22, 106,  29,  22,  17,  17, 156,  29,  17, 150,
-159, 145, 150,  29,  31, 150,  22, 106, 150,  22, 159, 150, 106,  22,  22,
-145, 157, 147, 106, 106, 150, 147,  29, 145,  19, 150, 157, 156, 145, 144,
-157, 157,  16, 159, 150, 106, 150, 150, 147, 147,  22, 106, 150, 145,  28,
-150, 157,  22, 147, 157,  22,  16, 106,  22,  22,  28,  17, 145,  31, 106,
-156,  22, 157, 157,  17, 157, 157,  28, 156,  22,  22, 106,  17,  28,  22,
-145, 147,  29,  22,  31, 145, 150, 150,  28,  22, 157, 147,  17, 147, 150,
-106, 147,  22,  22, 157, 144,  16, 145,  17, 157,  17,  29,  16,  16, 150,
-150, 157, 150,  17,  17, 106,  16,  29, 159, 157, 156, 157, 106, 106, 157,
- 28, 150,  22, 150,  22,  29, 144, 150,  19,  28,  22, 106, 147,  17,  28,
-150,  17, 147,  17,  17, 157,  22,  22, 145, 150,  31, 144, 157, 144,  17,
-156,  19, 150,  31, 157, 106,  17,  17,  31, 150, 150,  17, 150, 144, 147,
-106, 150,  29, 156, 156, 156,  17, 106, 157, 147,  22, 147,  19, 150,  16,
-106,  22,  19,  22, 150, 150, 156, 147,  19,  29, 145,  29,  28,  17,  16,
-157,  28, 106, 145,  22, 157, 145, 106,  22,  22,  22, 150,  17, 147, 159,
- 22, 150, 106, 144, 150, 150,  22,  22,  17,  31,  31,  17,  17, 147,  22,
-157,  17, 150,  31, 150,  22, 147, 147, 106,  17, 147, 147, 147,  17,  28,
- 22, 145, 106, 150, 106, 106,  22,  22,  17, 147, 150,  17, 106,  29, 157,
-106,  28,  28,  17, 144,  22, 145, 106, 106,  22,  22, 150, 106, 147, 145,
-106,  17, 106,  22, 106,  29,  28, 157, 157, 157, 147, 145,  17,  17,  19,
- 16, 150, 157, 150,  17,  31,  22,  22, 150, 147, 145,  16, 145, 145, 150,
- 19, 150,  17, 145, 147, 150, 150, 144,  29, 147, 145, 145,  17, 157,  17,
- 31,  29, 150, 106, 150, 157,  19,  17, 157,  28, 157,  22, 147,  17, 106,
-147, 150, 157, 150, 106,  17,  28,  17, 145, 145,  22, 147,  17,  17,  17,
-150, 159,  29,  17, 150,  28, 145, 106, 147, 147,  22, 106, 147, 147,  22,
-145,  29,  29,  22,  28,  31, 157,  17, 156, 106,  28, 106, 150,  22, 147,
-106, 150, 150, 145,  31, 157, 144, 145, 159, 147, 150,  22, 159, 150, 157,
-150, 106, 150, 150, 150,  16,  22,  28, 150, 156, 157, 150, 159,  29, 106,
-150, 106,  16, 150, 150,  22, 156, 157,  29, 157,  17, 150, 147, 150, 159,
-144,  29,  16, 106, 157, 157,  17, 150,  17,  31, 145, 150, 157, 150, 150,
- 28, 150,  22, 106, 147, 106, 255, 150,  22,  17, 157, 150, 145,  22, 145,
-145,  22,  31, 157,  22, 147,  28, 150, 147,  29, 157,  28,  29,  17,  17,
-145,  31,  17,  16, 147,  17, 150,  22,  17,  22,  17, 106, 150,  16, 157,
-150,  28, 157,  28,  22, 145, 106,  22, 150,  22, 150,  28,  22,  29, 157,
-157, 145, 157,  29, 106,  31,  22,  22, 150,  22,  17, 106,  28,  17, 145,
- 17,  17, 157,  17, 157, 144,  31,  17,  22, 147,  22, 106, 150, 147, 156,
- 22, 150, 157,  22, 150,  22, 150, 150, 106, 150,  22,  17, 106,  17,  22,
-145,  22,  17,  22, 150, 150, 157, 106, 106,  17, 144, 145, 157,  31,  29,
-106, 157,  17,  17,  28,  22,  31,  17,  22, 106,  22, 150, 157, 150,  28,
-157,  22, 150, 150,  22, 144, 157,  22,  22, 157,  29, 157, 144, 144,  31,
-147, 150, 150, 106,  28, 106,  22,  29,  22, 157,  22,  19, 157, 145, 106,
- 22, 150,  22, 147,  17, 157, 157, 150, 150, 106,  29,  22,  22, 147,  31,
- 29, 106, 145, 144, 150,  22,  22, 150, 145,  28,  17, 106,  17, 157,  29,
- 28, 150,  17,  17, 157,  29, 145, 145, 150, 157, 150, 156,  28,  17,  17,
- 17, 145, 106,  29, 150,  22, 147, 157, 106, 150, 145, 106, 157, 157, 145,
-147,  19, 106, 150,  17,  28,  17,  22, 147,  22,  16, 157, 106, 145,  22,
-157,  22, 147,  22,  22,  17, 150, 106,  17, 150,  22, 157,  28, 144, 145,
- 31, 150, 157, 106, 157, 106, 147,  29, 157,  22,  17,  17,  31, 150, 145,
- 17, 150, 150,  17,  17, 157, 145,  22, 145, 157, 150,  28, 106, 157, 150,
-157,  22, 150, 147,  22, 150, 150, 106,  22, 150, 147,  17,  22, 106,  29,
- 22,  22,  31,  22,  17, 150, 106, 150, 144,  17, 157,  17, 150, 157, 147,
-157,  29, 145, 150, 157, 106, 150, 157, 157,  28, 144,  29, 150,  22, 144,
- 22,  22,  31, 150, 145, 144, 157, 106, 157, 157, 144, 147, 157,  28,  17,
- 22, 147, 150, 157, 150, 106, 147, 145, 157, 144, 147,  28, 144,  31,  22,
-150, 150,  29,  29, 150,  29, 157, 150,  31, 150,  22, 150,  17, 150, 106,
-145,  22, 106,  17, 145, 255, 157, 145, 147, 150,  22, 147, 106, 147, 145,
- 17, 157, 147, 150, 150, 150, 150, 150, 150, 106, 147, 145, 150, 157, 145,
- 17, 150, 157, 145,  31,  28,  22,  17, 150, 150, 150,  22, 145, 147,  29,
-157, 106, 106, 150,  22, 106, 150,  29, 147, 157, 157, 106, 150,  17,  17,
-157,  29, 150, 145, 150, 157, 106, 150, 150, 150, 145, 150, 144, 157,  22,
- 31, 145,  17, 145,  29,  17, 157, 106,  22,  22, 106, 147,  22, 157,  22,
-150,  17, 157, 106, 150,  22,  17, 150, 106, 157, 150, 145, 150,  31, 157,
- 22, 144, 157, 145,  17, 106, 157, 145, 150, 150,  28, 106, 145, 150, 150,
-144, 157,  17,  22, 106,  29,  17, 106,  17,  17, 157,  31, 106, 150,  22,
-157, 106,  17, 106, 150, 106,  17, 145,  22,  17, 106, 150,  22,  22, 150,
-106, 157, 145,  22, 106, 157,  17, 157,  22, 157, 104, 151, 150,  22, 106,
-145, 106,  31, 145, 150,  22,  17, 145,  17,  17, 106, 106, 144, 147,  17,
-145, 150,  22,  17,  29,  22,  17, 150, 150, 150, 145,  22, 150, 144, 106,
- 22,  22, 157,  20,  17, 147,  17, 150, 150, 150, 107,  29, 157, 150, 157,
- 17,  22, 106, 106, 150, 147, 145, 157, 147, 150,  22, 150, 150, 157,  22,
-151, 106, 157,  28, 147, 106,  22,  22,  22, 157, 150, 150, 106, 147, 144,
- 31, 157,  22,  17, 150, 144, 157, 145, 150,  22, 145, 150, 147,  17, 145,
-150,  22,  17, 145, 106, 150,  28, 157,  22, 144,  22, 150, 145, 106, 147,
-147, 147, 147, 150,  17, 157, 104, 145, 106,  22, 145, 150,  29, 147, 150,
-157,  22,  17, 157,  29,  29, 150,  17, 147,  17, 106, 107, 157,  28, 144,
- 28,  17,  17, 106,  31, 150, 144, 150,  20, 150,  20,  17, 150,  31,  22,
-106, 145, 106,  17,  17, 157,  22, 150,  22, 144, 144,  17,  17, 157, 145,
-157, 145,  17,  22, 104, 150, 150, 150, 150,  17, 147, 150,  22,  28, 157,
- 22,  17,  17, 157, 150, 150, 150,  22, 150, 150,  17, 106, 147,  22,  29,
-157,  28,  20, 151,  29,  17, 147, 145,  17, 150,  17,  22, 145, 145, 150,
-157,  17,  17, 150,  22,  17, 157,  22, 150, 150, 150,  31, 151, 106,  22,
-151, 150,  22,  22, 144, 145, 107, 145,  17, 150, 104, 145, 106, 145, 150,
-106,  22,  29,  29, 147, 145, 106, 150,  17,  22, 150,  29, 106, 106, 145,
- 22,  22, 106, 106, 150,  22, 106, 150, 150, 145,  22, 145, 106,  29, 106,
- 29, 106, 150,  17, 157, 150, 157,  20, 157, 144, 106, 157, 145,  17, 147,
- 17, 150, 150,  17,  22,  17, 106,  29, 144, 106, 145, 150,  17, 106,  22,
- 17, 106,  22, 157,  29, 144, 157, 145, 157,  17, 151, 145, 157, 150,  22,
- 22, 150, 145, 157, 157, 150, 157,  22, 147, 145,  17, 106,  20,  29, 147,
- 22,  22, 106, 150, 145, 150, 106, 150, 157,  31, 157, 157, 157,  17, 150,
-157,  17, 150, 157,  22, 106,  17, 145, 145, 150, 107, 150,  17,  20, 150,
-157, 147, 145,  17, 150, 106, 107,  22, 150,  17, 157,  17,  20, 145, 145,
- 17,  22, 150,  22,  28, 145, 157,  22,  17, 104, 145,  22,  28, 150, 106,
- 17,  17,  22,  22, 150,  17, 106, 107, 106, 106, 145, 147,  17,  22, 104,
-151,  22,  29,  22,  20,  31, 145, 106,  22,  17, 144, 104,  22,  17, 106,
- 20,  22, 104,  29,  22, 150, 147, 145,  22,  29,  29, 106, 106,  17, 147,
- 20,  22, 145,  22,  22,  17,  29, 150, 145, 106,  29, 106,  17,  22,  22,
- 22, 157,  17, 157, 147, 145, 150,  17, 150, 150, 106, 150, 106, 150, 157,
-157, 150, 157, 150,  17,  22,  29, 150, 157,  31, 107, 104,  22, 150, 157,
-150, 157,  22, 107, 150,  22, 150, 151, 106,  17, 157,  22, 157, 151,  22,
- 29,  17,  22, 150, 147,  28, 157, 151, 106, 106,  22,  17, 150, 145,  17,
- 22, 145, 150, 145, 157, 144,  29, 150, 150, 104, 145, 157,  29, 147, 145,
-107,  17, 106, 145,  20,  29,  22, 151,  22,  20,  31, 150, 106, 107, 157,
-157, 151, 150, 147, 157,  17, 150,  17,  29, 150, 150,  22, 145, 151,  28,
- 20, 150,  20,  29, 157,  22,  22,  17,  29,  17, 150, 150, 106, 150, 157,
- 17, 145, 150, 106, 145, 106, 106, 157,  22, 145,  29,  20, 106, 150, 150,
-144,  22, 157, 150,  22,  17, 150,  20, 150, 106, 151, 150,  29, 150,  22,
-157,  22, 145, 106, 145, 144, 145, 157, 150, 107, 150, 145, 150, 150,  22,
-157, 106, 106, 147, 150,  29, 157, 150,  29,  29, 150, 145,  17, 145, 106,
-157, 150, 150, 151, 104, 145, 104, 150, 150, 107,  22, 107, 107, 145, 157,
- 29, 144, 150, 145, 157, 145, 150, 145, 107, 145,  17, 106, 157,  22, 106,
- 31, 150,  31,  29, 145, 157, 106,  22, 157,  17, 145, 150, 104,  22,  22,
-151,  29, 150, 157,  28,  22,  17, 150,  29, 107,  17,  22, 147, 150, 106,
-145, 150, 145,  22,  17,  22, 106, 104,  20,  29, 145, 144,  22, 150, 145,
-150, 150, 157, 151, 144,  22, 150, 150,  22, 150, 150, 107,  22,  29, 107,
- 28,  17, 106, 151, 157,  20, 157,  20,  17,  17, 151,  22, 157, 150, 151,
-106,  17, 144,  17, 104, 150, 106, 157, 147,  17, 106, 145, 157, 157, 151,
- 22, 151, 157, 106,  31, 150, 106, 106,  22, 147, 144, 151,  20,  17, 145,
-157, 150, 145,  31, 104,  17,  17,  22,  29, 157, 106,  22, 104, 145, 145,
- 17, 150, 106,  20, 150, 150, 157,  29,  29,  22,  20, 145, 151, 150, 150,
- 17, 150,  17,  29,  22, 106, 104,  20,  22,  29, 106,  28, 150,  17, 150,
- 17, 157, 145, 106, 104, 157, 255, 145,  22,  29, 150, 107,  17, 150, 106,
- 31,  17,  17,  17, 150, 157, 150, 106, 150, 145, 145,  22,  29, 145,  31,
- 17, 157, 151,  17, 145,  22,  22,  22, 150, 151, 145, 107, 150, 150, 145,
- 29,  22,  29, 145,  17,  22, 107, 157,  22, 157, 107,  17, 145, 107, 157,
-150, 145,  22, 145,  29,  20, 144, 150,  31,  22,  20, 150, 106,  20,  29,
- 17, 157, 104, 150, 150,  29, 157, 145, 150, 145,  31, 107, 157, 104,  22,
-150, 151,  22, 106, 150,  20, 107,  29, 106,  22, 157, 150, 106, 150, 150,
-151,  22, 150,  22, 150, 106,  17, 157,  31, 145,  22, 144, 145, 157,  20,
- 29, 151, 157, 145, 151, 150, 144,  20, 104,  22, 150, 145,  29, 157, 150,
-150,  20, 157, 106, 157,  22,  29,  31,  22,  29, 150, 106, 157,  17,  29,
-150, 144,  17, 104, 157,  17,  29,  20, 104,  17, 145,  22,  22, 107, 106,
-106,  22,  22, 145, 157,  22, 145,  20,  22, 150,  20, 145,  17,  22, 106,
- 29, 157,  17, 151, 150,  17,  17, 151, 151, 150, 145,  31,  17,  17,  22,
-106, 106, 150,  22, 150, 150,  17, 150, 144, 107, 106, 104, 150,  17, 145,
-150, 157, 106, 150, 145,  22, 150, 157, 150,  22, 145,  20, 150,  17, 104,
- 17, 145, 145, 150, 151,  22,  22,  31, 106,  31,  20,  17, 150,  22, 104,
-144,  20, 104, 145, 145,  22, 145, 106, 150, 106,  29, 150, 106, 150, 150,
-107,  20,  22, 150, 150, 150, 145,  29,  20, 150, 157, 151, 145, 150, 145,
-150, 151,  22, 145, 157, 107, 145,  22,  20, 106, 145, 150, 150,  17,  20,
-157,  22, 150,  20,  17,  17,  22, 145, 150,  22, 157,  29,  22, 145, 145,
-106, 106, 157, 151, 157,  29, 145,  20,  22,  22, 106,  17, 150, 145, 144,
- 17, 157, 151, 107,  29, 150, 151, 150, 104, 145,  22, 106, 151,  17,  31,
-150, 145,  22, 107, 157, 145, 104,  22,  31, 145, 151, 151,  22,  17, 157,
- 20, 145,  17,  20,  22, 104, 150, 157, 145,  22, 106, 150,  29,  31, 145,
-107,  20, 150,  17,  22, 255,  29, 145,  29, 107,  29, 157,  22,  17, 157,
-106, 150, 104, 150,  17, 145,  22,  17,  29, 157, 104, 104, 104, 106,  17,
-151, 157, 106, 145, 150,  17, 106, 151, 145,  22, 106,  22,  29,  22,  29,
- 29, 106,  22, 145, 148,  29, 145,  22, 145,  22, 150,  22, 104, 145,  17,
-145,  29, 107, 150,  22, 157,  22, 104,  22, 106, 150, 107,  29, 157, 150,
-104, 144,  29,  22, 151, 107,  22, 104,  22, 150,  29,  22, 150, 150,  23,
-151, 145,  29, 145, 107, 106, 145,  20,  22,  29, 151, 145, 106, 106, 104,
-145,  29, 151, 104, 157, 150, 106,  17, 150, 144, 107, 150, 150,  29, 104,
-104,  17,  17,  22, 151, 157, 151, 104, 144, 150,  20, 107, 150, 145, 157,
-145, 157, 157,  29,  17, 144, 144, 145, 107, 106,  22,  29, 150,  17,  20,
-106, 151, 157, 150, 157,  29, 145, 107, 150,  29,  22, 150, 157, 107, 151,
-104, 150,  22,  17, 145,  22,  20, 150,  22, 150, 145, 255, 157,  23, 150,
- 17, 104,  29, 144, 157, 104,  23, 150, 148, 106, 151, 151,  22, 150, 107,
-150, 107,  29,  22, 150, 150, 150,  29, 157,  29, 106, 150,  29, 145, 150,
- 17, 107, 145,  20,  17, 150, 151, 104, 145, 150, 145,  17,  17,  22, 157,
- 17, 151, 106, 150,  29,  22, 144, 145, 150,  20, 151, 151,  17, 144,  22,
-104, 106, 145, 151,  20,  17, 148, 104, 107, 151,  29, 145,  22,  20, 104,
-145,  20, 144,  20, 157,  17, 157,  22,  22, 150, 151, 150,  22, 145,  20,
-104,  29, 145, 106, 151,  22,  20, 145, 157, 157, 104,  22,  29, 148, 151,
-150, 150, 145, 150, 145, 150, 151, 150,  17, 106, 144, 157,  22, 106,  17,
-150,  22,  20, 150,  22,  29,  22, 107, 106, 150,  31, 107,  29, 150, 144,
-151, 150, 151, 151, 148, 145,  29,  20, 106, 145, 157,  22, 157, 151, 150,
-151, 148,  29, 107, 107, 157, 157,  17, 144, 151, 145,  22, 107, 106,  20,
-107, 151,  29, 157,  22,  22, 150, 150, 148,  23, 106, 157, 104, 157, 106,
-106, 145,  20,  22,  22, 255, 107,  29, 145,  22,  23, 157, 104, 106, 151,
- 22, 157, 107,  22, 150,  20, 148, 144, 148, 157,  17, 106,  20,  29, 150,
-150,  22, 104,  29, 145,  20,  29, 157,  17, 150,  17,  22, 157,  29, 107,
-104, 151, 145,  20,  29, 150,  29,  20, 150, 150, 106, 107, 145, 150, 150,
-145, 145, 145, 145, 145, 157, 148, 144, 106,  29, 104, 144, 107, 150, 150,
-145,  22,  17,  17, 145,  31, 107,  17,  17,  23,  22, 145,  22, 104,  22,
- 17, 150, 107,  29,  29,  20, 106, 145, 106, 145, 150, 145, 151, 145,  29,
-151, 157,  20,  29, 157, 107,  17,  17,  20, 148, 107,  23, 145, 145,  17,
-150, 157, 107, 157, 107, 151, 106,  29, 144, 104, 145, 148,  17, 150, 145,
- 20, 150, 106, 148, 106,  20,  29,  20,  31, 157, 151,  20, 106, 145, 106,
-145, 157, 145, 145,  20,  17, 104, 107,  22, 107, 144, 145, 151,  23, 151,
-150, 145, 148,  22, 150,  29,  29, 104, 150,  20, 150, 150, 150, 145,  29,
-157, 145,  22, 157,  17, 151,  23, 145,  29,  22,  17, 150,  20,  22, 107,
- 20, 145, 157, 150, 107, 150,  22,  17,  31,  20,  22, 145, 104, 106, 157,
-104, 106, 104,  17,  20, 150,  29, 106,  20, 145,  29, 107, 151,  31, 151,
- 20,  17, 151,  20, 104,  23, 157, 106, 106, 151, 157, 148, 106, 104, 150,
-157,  23, 106, 150,  22, 145, 145, 150, 150, 150,  22, 151, 150,  23, 145,
- 29, 145, 104, 151, 145, 157, 151, 104, 150, 104, 157,  17, 104,  17, 150,
-150, 145,  22, 106, 151, 107, 151, 151, 150, 107,  22,  22, 145, 145,  29,
- 20,  17, 104, 145, 145, 145, 150, 157, 145, 157, 145, 104,  17,  29, 150,
-150,  17,  29, 104, 150,  17,  29, 157, 104,  22, 151, 151, 106, 157, 144,
-144, 107, 104, 145,  20, 104, 107, 157,  31,  17,  22, 106, 150, 150,  31,
-145, 148, 148, 150, 145, 107,  29,  17, 151,  22, 145, 157, 104, 107, 144,
-151, 150, 145,  22, 145, 107, 148, 151, 104, 157, 104, 150, 157, 150,  29,
- 29,  20, 145,  22, 148, 106, 151, 145, 144,  20,  31, 150,  23, 150, 145,
- 22, 150, 104, 104,  20, 107, 145, 145,  17, 107,  22, 151, 150,  20, 145,
-145, 107, 148, 107,  17, 150, 145,  20, 151,  20, 145,  17,  20, 157, 150,
-151, 150, 157, 150,  22,  17, 150, 148, 148,  20, 151, 104, 150,  22,  22,
-107,  17, 151,  22, 106,  17,  22,  29, 157, 151, 145, 150, 151, 145, 151,
-157, 157, 151, 145, 157, 104, 106, 145,  17, 104, 151,  23,  29,  20, 148,
-104, 145, 151, 157, 107,  17,  29, 144,  20,  23, 106, 157,  20,  22, 107,
-148, 107,  22, 157,  29,  29,  29,  17, 145,  20, 145, 104, 104, 150,  29,
-151, 148, 107, 106, 104, 151, 148, 151, 150,  31,  23, 150,  23, 145,  22,
- 17, 148, 150, 157, 145, 150, 106, 150,  17, 107,  20,  22,  20,  17, 107,
-104,  17, 106, 104,  20,  23, 104, 148,  31, 107, 104, 151, 145, 145, 145,
-148, 145, 107, 104, 106, 151, 151,  22, 148,  29,  20, 107, 106, 145, 104,
-107, 150, 145, 145, 107, 148, 106, 150,  20, 151, 150,  22,  23, 150, 145,
-104, 148, 145, 150,  29, 104, 145, 145, 145,  20, 107, 150, 107,  29,  23,
-157, 150,  22, 145, 104,  20, 145, 150,  22, 107,  23, 144,  23, 150,  29,
- 17,  22, 150, 104,  20, 148,  20, 150, 104, 106, 104,  20, 151,  20,  20,
- 20, 107,  22, 150, 150,  20, 150,  29,  31,  23, 107,  17, 104, 148, 107,
-150, 145, 150, 150, 145,  23,  22,  29, 151,  29,  20, 148, 107,  23,  17,
- 17, 151, 106, 107, 148,  23, 145, 157, 150,  23,  20, 145, 106, 151, 145,
-107, 150,  22, 107,  22, 106, 150, 145, 151, 148, 150,  31, 104, 107, 145,
-148,  20,  17, 144, 106, 150, 104, 104, 104,  29, 151,  22, 145,  20, 151,
-104, 148,  29,  17, 255, 107,  22, 148, 150,  17, 148, 145, 148, 148, 151,
-145, 144, 150,  22,  17, 145, 150, 145, 150, 145,  22, 157, 151, 148, 145,
-104, 150,  22, 148, 150, 107, 151, 144, 151, 148, 150, 107, 148, 148, 150,
-148, 107, 104, 151, 148,  29,  20, 145,  22, 144, 106, 150, 145,  22, 148,
- 23,  31, 107, 150, 151, 104,  29, 145, 151, 151, 157, 106, 104,  20,  20,
- 23,  23, 107, 148, 107,  20,  23,  22,  20, 151,  17, 104, 104,  31, 151,
- 22, 151, 104,  22,  29,  22,  20, 145,  22,  20, 157,  20, 106, 107, 107,
- 22,  31,  22, 150, 145,  29, 145, 148, 107,  20,  20,  20, 157,  31, 151,
-157, 104,  20, 106, 104, 104,  23,  29, 106, 151, 144, 106, 104, 107, 106,
- 20, 151, 107,  20, 148, 148, 151,  22, 104,  17, 145,  22, 151, 145,  22,
-107, 145,  22, 151,  20,  17, 145, 145, 107, 144, 150, 145, 148,  22,  20,
-106,  31, 151, 107,  22, 151, 150,  20, 151,  20, 150, 107, 145, 148,  29,
- 22,  23, 144, 145, 104,  23, 151, 150, 151, 151,  20,  20,  31, 157, 104,
-148, 145, 157,  29, 151, 151, 145, 104, 107, 107,  17, 148, 145, 107, 107,
-144,  31,  20,  29, 104,  29, 148, 148, 151, 157,  23, 150, 151, 104,  17,
- 17,  20,  29,  29, 148, 104,  20, 150,  20, 150,  23, 151,  23, 151,  20,
-150, 144, 107, 148,  20,  22, 106, 107, 145,  17, 107, 148,  20, 107, 148,
- 22, 104, 148, 151, 107, 150, 148,  31, 106,  20,  22, 150,  22,  20, 151,
-104, 107, 151, 148, 148, 157, 107, 151, 104,  23, 151, 107,  22, 145, 151,
- 22,  20,  23,  17,  22, 151, 148, 157,  23,  22, 104,  20,  29, 148, 148,
-145, 104,  20, 104,  17, 151,  29, 150,  20, 151, 145, 145, 104,  23, 104,
-107, 104, 148,  22, 107, 157, 151, 107, 107, 151, 106,  23, 107, 104, 107,
-150, 150, 104,  23, 104, 148,  20,  20, 106, 151, 107, 145, 145, 107,  17,
-151, 151, 145, 151, 144, 151, 151, 148,  29, 148, 148, 145, 148, 148,  17,
-106, 104,  20,  17, 104,  20, 148,  20,  22, 145, 150, 151, 151, 104, 150,
-148, 148,  29, 148, 151, 104, 151, 151,  23, 107, 144,  23, 144,  20, 148,
-150, 107, 145, 107, 145, 145,  23, 104,  29, 145,  29,  22, 107, 107, 104,
- 23, 145, 104, 107, 157, 145, 151,  20, 151, 107,  23, 151, 107, 151, 107,
-107, 151,  20, 104, 145, 104, 148, 150, 145, 104,  20, 145,  29, 148,  20,
-148, 107, 106, 104, 145,  20, 157, 148,  17, 148,  20, 150, 145, 107, 151,
-145, 104, 145,  20,  29,  31, 148, 148,  22,  22,  29, 151, 145,  29, 107,
- 29,  20,  22,  23,  23, 150,  22, 104, 157, 148, 145, 157, 151, 104,  20,
- 20, 157, 148, 150, 148, 104,  22, 148, 151,  31,  22,  22, 150, 104, 148,
- 20,  23, 148, 151, 151, 106, 151, 145, 151, 151,  29,  23,  23, 151, 107,
- 20, 148, 151,  22, 145, 148, 104, 107, 151, 151, 145, 145,  23,  22,  20,
-104,  20, 104, 104, 107, 107, 150,  29,  20, 150, 107, 104, 151, 150, 145,
- 29, 148,  29, 144, 157, 145,  22,  20, 157, 145, 107,  22, 106,  20, 106,
-148,  20, 148,  29, 151, 148, 151, 107,  23, 107, 145,  22, 104, 145, 148,
-157, 150, 107, 107,  31, 151, 104, 148, 148, 150,  20,  22, 107, 148, 148,
-151, 104, 151, 145,  29,  29, 106, 107, 150, 107,  23, 145, 150,  22, 107,
-144, 145, 151,  20,  20, 148, 107, 104, 145, 107,  22, 106, 157, 104, 150,
- 20, 151,  20,  29, 151,  20,  29,  29, 145, 144, 107, 145, 145,  17, 151,
-104, 107,  20, 107, 104, 145,  20,  20,  22, 150,  20, 148, 151, 151, 150,
-107, 148, 148, 151, 107, 107,  22, 104, 150, 104,  23,  23,  29,  20,  31,
-151, 145, 107, 148, 107, 104, 148, 106, 151, 145, 151, 150,  23, 104, 151,
-104, 151, 151, 145, 148,  29, 157, 106, 150,  20, 145, 148, 107, 148,  23,
-107, 107, 150, 145, 104,  20, 145,  23,  23, 145,  20, 151, 104, 104, 151,
- 23,  20,  20, 148,  20, 104, 148, 145,  29, 148,  20,  17, 150, 104, 107,
-151, 151, 145,  23, 104, 145,  22,  20, 151,  22, 107,  20, 145, 145, 144,
-104, 151,  22, 107, 151,  31,  29, 150, 104, 107, 104, 157,  20,  20, 151,
-148,  31,  31, 150, 151,  29, 145, 151, 106,  23,  31, 151, 106, 107, 144,
-104, 104, 151,  20, 151, 107, 151, 145, 145, 148,  29, 148,  20,  20, 107,
-151, 148,  29,  22, 107, 107, 148, 104, 107, 151, 157, 145, 151, 148, 150,
- 23,  22, 107, 104, 151, 107, 151,  20, 107, 148, 145, 104, 104, 148,  20,
- 20, 145, 107,  20, 107, 151, 107, 157, 151,  23,  29,  20,  22,  20,  20,
- 29, 104,  20, 145, 148, 144,  23, 157, 104, 104,  22,  20, 104, 107, 145,
-104, 107,  23, 148,  29,  20,  29,  17, 107, 104, 107, 145, 107, 104, 144,
-107, 104, 150, 148,  29, 107,  31, 150, 145, 144,  20,  20, 148, 151, 151,
-104,  29, 148, 148,  20, 148,  23,  23, 104, 107, 145, 151, 150, 148, 151,
-107,  20,  29,  23, 145,  29,  29, 151,  23, 151, 151, 144, 104, 151,  20,
-107, 144, 107, 151,  23, 104, 150, 104,  23, 151, 148, 145,  20, 107,  20,
-104, 148,  23, 145, 151, 148, 145, 145, 151, 148, 107, 106,  17, 104, 151,
-148, 145,  20,  23, 145,  20, 104,  20,  20,  29,  29,  17,  20,  23, 150,
-104, 145,  20, 107, 145, 104, 107, 151, 150, 148, 151, 148, 145,  17, 107,
-148,  29,  23, 107, 107, 104, 151,  20, 151, 104, 107, 107, 148, 104, 145,
-107, 151,  29, 151, 151,  22, 107, 148, 145, 107,  20,  20,  23, 107, 148,
-104, 104, 148, 107, 148, 145, 145, 148,  22,  20,  23, 107,  22,  29,  29,
-148, 148, 151, 151,  31,  23, 104, 145,  20, 148,  20, 148, 151, 151, 107,
-104, 107, 148,  23, 150, 148, 148,  23,  23, 107, 107, 107, 148,  23, 107,
-151, 145, 104, 104, 151,  20,  23, 145, 151, 107, 145, 148,  20,  29,  20,
-145, 148, 144, 145, 104,  29, 148, 107,  31, 107, 107, 104, 151, 104, 144,
-107, 148, 104, 151, 151,  23, 157, 148, 151, 148, 107, 104, 151, 104, 107,
-145,  23, 104,  20, 107, 104, 145, 148, 145, 107, 145, 145,  20, 145, 148,
-148, 107, 107, 107, 145,  20, 107, 148, 145, 151,  20, 151, 145, 104, 104,
-151, 148, 151, 151,  23, 104,  22,  20, 148,  23,  20, 151,  20, 104, 107,
-107, 107,  23,  20, 151, 151, 107,  20,  20,  23, 148,  29, 151,  20, 145,
-107,  20, 104, 148, 151, 144, 151,  20,  29,  23, 107,  23, 104, 151, 145,
-151, 151,  20,  29, 148, 151, 151,  20, 151,  31, 151, 107, 148, 107,  20,
- 20,  23, 107, 104, 104, 148, 107, 148, 107,  20, 104,  29, 148,  23,  20,
-107,  20, 145, 145, 104,  29,  29, 148,  20,  20, 145, 148,  23, 151,  20,
- 20, 145, 148, 107, 145, 145,  23,  23, 104, 145, 104, 255,  20,  20,  23,
- 29, 107, 104, 145, 148,  20,  23, 145, 151, 148,  23, 145, 151,  29,  20,
-151, 107, 104, 145,  20,  20, 148,  20, 107,  23,  20, 145,  31,  23,  23,
-145, 148, 145,  29, 151,  29,  20, 144, 151, 151, 151, 148, 151,  20, 107,
-151, 107,  31,  23, 148, 107, 148,  20, 145, 104, 104, 104,  21, 107, 151,
-145, 151,  20, 145, 144, 144, 151,  31,  23, 148, 107, 145, 145, 145,  20,
-148,  29, 148,  20, 145,  31,  31,  29, 151,  29, 107,  29, 107, 148, 148,
- 23, 151, 104, 148,  29, 151,  23, 107, 104, 148, 104,  23, 148, 107, 151,
- 23, 151, 104,  20, 145, 145, 148,  23, 148, 104,  20, 151,  29, 151, 145,
-107,  20, 144, 148, 107, 148, 148,  20, 148,  29,  20,  20,  20, 151, 104,
-151, 107, 104,  31,  20, 104, 145, 148, 145, 107, 148, 151, 107, 151, 104,
-107, 145, 104, 151, 148, 107,  20, 107, 148,  20, 149, 145, 148, 151,  23,
-104, 145, 104,  23,  23, 144,  20, 151, 145, 104, 148, 145, 151,  23, 104,
-148,  20,  20, 151, 104,  98, 148, 149, 148, 107, 148, 107, 107,  31, 151,
- 23, 151, 144, 151, 148, 148, 151,  20,  29,  20, 144,  20, 104,  21, 110,
-104, 145, 148,  29,  23, 148,  20,  20, 148, 151, 148, 104, 151,  20, 104,
- 20, 148, 148,  20,  20,  20, 104, 107,  29,  23, 107, 107, 144, 151, 104,
-151, 148, 107, 148,  23, 145, 145, 107,  98,  20,  20, 151,  20, 148, 104,
-107, 148, 145,  23,  23,  23, 107,  23, 104,  20,  23, 110, 148, 151, 104,
- 20, 148,  29,  23, 151,  20, 107, 107, 144, 151,  23, 107,  20, 151, 148,
-107,  29, 145, 144, 148, 107,  23,  29,  29,  29, 148, 145, 145, 151,  29,
- 21, 104, 144, 148, 151, 145, 104, 107, 104,  29, 104, 107, 148, 144, 145,
- 23,  20,  20, 107, 151, 148, 148, 107,  20,  20, 151, 151, 107,  23, 151,
-149, 149, 151, 151, 104,  20,  23,  20, 148,  29, 107, 145, 151, 104,  31,
-151,  20,  29, 104, 104, 144, 107, 107,  31, 104, 151, 105, 107, 145, 145,
-151,  23, 145, 151,  29, 151, 148, 107,  21,  20, 148, 148, 148,  31, 107,
-145, 148, 145,  21,  23, 148, 148,  20, 151,  31,  21, 151, 145,  20,  23,
-107,  20, 148, 144, 107, 104,  23, 104,  23, 148, 144,  98, 104, 151, 144,
- 20,  23, 145, 145, 148,  23,  23, 151, 145, 148, 148, 151,  98, 104, 151,
-107, 107, 148, 145,  20, 104, 148,  23, 104, 104, 148, 148, 148, 148, 104,
-148,  20, 104, 144, 107, 151,  29,  20,  20, 148,  23,  23, 107,  31, 104,
-151,  31, 151, 107, 148,  29, 148, 107,  20, 148, 105,  23, 107, 107, 148,
-110, 151, 107, 148, 151, 104, 145, 104, 148, 145,  23, 151, 145, 145,  20,
-107, 148,  20, 148, 104, 151,  20, 107, 151, 151, 144, 148, 151, 151,  23,
-104, 104, 145, 104, 145, 107, 151, 151, 151,  23, 148, 107,  20, 151, 104,
-107,  20, 148, 151, 107, 104,  20,  29,  20,  20,  23,  98,  20, 151, 107,
- 23, 104,  23, 149, 110, 107, 104, 145, 107,  23,  20, 148, 149,  23, 104,
-107, 148, 151,  20, 151, 151, 148, 145,  20, 148, 107, 148, 104,  23, 148,
- 20, 145,  23,  20,  29,  23, 148, 107, 148,  20, 104, 151,  20, 104, 148,
- 20,  31, 148,  20, 104,  98, 151, 148, 107, 107, 110, 151, 104,  98,  23,
-144, 104, 151, 104, 148, 151, 107,  20, 110,  31,  29, 148,  20, 107,  20,
- 98, 104,  29,  23, 104,  23,  23,  20, 148, 145, 151, 145,  21, 145, 148,
- 29,  20,  20, 148, 149, 107, 107,  23, 105, 145, 107, 105,  20,  31,  29,
-144, 107,  20, 145, 144, 107, 151,  23, 104,  23, 107, 151,  20,  31, 145,
-104, 255, 110, 148,  98, 104, 107, 148,  21, 104, 148, 151,  23,  29, 145,
-148,  31, 107,  20, 107, 148, 151, 148, 148, 144,  98, 148, 107, 151, 149,
- 23, 104, 149, 104, 104,  98, 145, 148,  21,  20, 107, 104, 107, 107,  23,
-148, 107, 148,  20,  20, 148, 144, 145, 148, 148, 145,  23,  23, 145,  20,
- 20,  20,  23, 104, 151, 151, 148, 107, 149, 145, 145, 151,  31,  20, 148,
- 29, 151, 145,  20, 145, 145, 148, 145,  29, 107, 151,  98, 145, 151, 104,
- 20, 145, 144,  21,  23, 107, 104,  23, 145,  29, 149,  21, 148, 104,  20,
- 20, 104, 107, 151, 151, 151, 145,  20,  29, 145,  21, 148,  20, 107, 151,
-149, 107, 148, 148, 148, 105,  23, 110, 148, 104, 151, 145, 110, 148,  20,
- 29,  23, 145, 149,  29, 104, 145, 148,  20, 107, 104, 105,  98, 105, 148,
-148,  23, 104, 104,  20, 151, 107, 151, 107, 149,  20, 107, 107, 107, 104,
-148,  98, 148, 149, 107,  23,  23,  20,  21, 144, 148,  23, 107, 149, 107,
-148, 145,  20,  21,  21,  23, 151, 105, 151, 148,  20, 148, 104, 151, 148,
- 20, 104, 105,  23, 104, 104, 145, 110, 107,  23, 107, 145,  23, 104,  23,
- 29, 145, 104, 145,  23, 107, 151, 151, 104,  20, 148, 105, 151,  29, 149,
-145, 107,  21, 148,  23, 151, 151,  31,  20, 110, 107, 105, 110, 151, 148,
-148,  21,  29,  29, 151, 151, 148, 105, 145, 107,  20, 148, 148, 107, 148,
- 20, 151, 148,  29, 107, 144, 151, 148, 104, 151,  20,  23, 104,  20, 104,
-107, 144, 149,  29,  20,  23, 110, 145, 148,  20, 107, 104, 149, 107, 104,
-148,  20, 149, 107, 104, 145, 107, 148, 107,  20,  23, 151, 105, 148,  98,
-145, 144,  20,  29, 151, 104,  29, 107, 104, 107,  23, 104, 110, 148, 148,
- 29, 149, 144, 148,  98, 151, 107, 148,  98,  98, 148,  20, 151, 110, 105,
- 29, 148,  20,  23, 151, 110,  23, 151,  20, 145, 148, 145,  20,  21, 104,
- 29, 148, 145,  23, 105, 148, 151,  20,  31,  23, 151, 145, 145, 107,  23,
- 29,  20,  20, 104, 145, 145, 107, 151, 145,  21, 151,  29, 107, 151, 105,
-107,  20,  20,  23, 148, 105, 144, 151,  98,  31,  20, 148, 151, 145,  23,
- 23, 107, 149, 151, 145,  20,  20, 145,  23, 110,  23, 107, 104,  21, 110,
-148, 148, 145, 145, 151, 104,  20, 104,  29, 149,  23,  31,  23,  23, 148,
-148, 107, 145, 148, 148,  23, 148, 145,  23, 104,  21, 151, 148, 110, 110,
-148,  20,  20, 148, 107, 145, 151, 148, 148,  98, 107, 148, 151, 107,  23,
- 20,  21, 107, 110, 145, 145, 151, 145, 148,  23, 145, 148, 107, 105,  29,
-151,  29, 107, 149, 148, 151, 110, 148, 110, 107, 151,  21, 145, 148, 149,
-104, 104, 148, 105, 148, 151, 149, 151,  23,  20, 148,  21, 149, 144, 107,
- 20, 151,  29, 148,  21, 110, 151,  29, 149, 105, 149,  31,  29, 148, 149,
-149, 107, 110,  20,  23, 144, 151,  29, 107,  23,  21,  21,  21, 148, 107,
- 20, 151, 148, 148,  20, 105, 148, 148, 145, 145, 151, 107, 104,  29, 107,
-151,  98, 148,  20, 149, 107, 104, 107, 148, 148, 151, 145,  20, 144, 104,
-151, 149, 145,  20,  29,  98,  98, 145,  23,  23,  20, 151,  21,  98,  98,
- 23, 148, 105, 148, 104,  20, 145,  20, 148,  21, 107, 148, 105,  23, 145,
-151, 148,  20,  23, 105, 145, 104, 151, 151, 144,  20, 149, 148, 145, 145,
-151,  20, 104, 107,  23,  23, 110,  20, 104, 107, 145,  20,  23, 104, 149,
- 20, 148, 145,  98, 151,  23, 145,  21, 110,  98, 107, 149, 107, 151, 149,
-149, 148, 144, 148,  20,  29, 145, 104, 110, 107, 105, 151, 145,  20,  23,
- 20, 151, 148, 151, 148, 145, 104,  20, 104, 148,  20, 145,  98,  23,  21,
-149, 151, 148,  98, 107, 149, 107, 110, 148,  23, 104, 151,  98, 148, 255,
- 23, 151, 148,  20, 110,  21, 110, 148, 107,  20, 110, 145, 105, 110,  20,
- 20,  20,  23,  20, 105, 107,  98,  23, 149, 149, 104, 151, 107,  29, 151,
-145,  23,  98, 148, 151,  29,  21,  98,  98,  29, 104,  29, 148,  29, 145,
-104,  31,  23, 110, 104,  29, 148, 149,  23, 107, 107, 149,  20, 148,  98,
-145, 148, 110, 148, 104, 104, 105,  21,  21, 107, 148,  23, 148, 151, 145,
-145,  21, 149, 107, 148,  23,  29, 107, 107, 145, 145, 151,  31, 149,  98,
- 20, 110, 148, 149,  21,  21,  21, 148,  21,  98, 149, 105, 105, 148,  23,
-104, 145,  20, 105,  98, 148, 148, 145, 145, 105, 148, 107, 148,  20, 144,
- 23,  23,  29, 148, 145,  20,  21,  20, 151, 104,  21, 148, 148, 151,  20,
-104, 110,  29, 107, 151,  21,  31, 107, 148, 104, 151, 144, 151, 148, 148,
-151,  21, 151,  31, 148, 151, 107, 148, 105, 145, 107, 149, 107, 110, 105,
-151,  20, 148, 151, 149,  21, 110, 149, 149,  29, 110,  21, 107, 104, 110,
- 31,  20, 104, 110, 151, 107,  20, 107,  98, 148, 110, 145, 145, 104, 105,
-151,  29, 145, 148,  98, 104, 110, 145, 110,  20, 151, 104,  29, 148, 105,
-151, 107, 145, 104, 144, 145, 149, 148, 151,  20,  20,  23, 145,  23, 104,
-104, 149, 149, 151,  29, 105, 145, 104, 148,  23,  98, 148, 151, 148,  20,
-104,  31,  98,  20, 107,  20, 149,  20, 148, 148, 110, 151, 145,  23,  29,
-151, 151,  98,  23, 107, 104, 145, 148, 148, 107, 107, 107,  98, 145, 144,
- 23, 105, 104,  29, 148, 148, 110, 107,  21,  20, 105,  23,  98,  20, 107,
- 98,  23,  23,  23, 149,  23, 149, 105, 151, 107,  98,  23, 151,  29, 151,
-104, 107, 145, 104,  98,  21,  23,  31, 145,  23, 145,  20, 151,  21, 110,
-110, 107, 105,  21, 144, 107,  21, 151, 151,  29, 149,  23,  20, 148,  98,
- 98,  29,  98,  98, 145, 104, 151,  20, 105, 105, 151, 144, 107, 105, 151,
-148, 149, 148, 148,  21, 110, 148, 149, 148, 148,  21,  20,  20, 148, 151,
-107, 110, 107, 151,  23,  20, 145, 145, 105, 110,  20, 107,  23,  29, 148,
-148, 148, 148, 107,  23, 107, 148, 148, 145, 110, 104, 105, 105, 145,  21,
-104, 148,  98, 107, 145,  98, 144, 145, 151, 148,  23,  98,  23,  29,  21,
- 23, 151, 148, 110, 145, 107,  21, 105, 149, 105, 107,  21,  98,  23,  98,
-105,  20, 110,  98,  20, 105, 151,  21, 148,  20, 105, 104, 105, 105,  20,
-145,  23, 145,  20, 149,  20, 104, 105, 110, 149, 107, 107, 110,  98,  29,
-145,  98, 105, 110,  23, 145, 151, 107, 148, 149, 145,  21,  98, 149, 148,
- 98, 151,  23, 104,  21, 110, 151, 151,  98,  20, 148, 148, 149, 107, 107,
-149,  98,  23, 107, 145, 105, 145, 148,  20, 149, 105, 110,  20,  29, 148,
- 98,  21,  98, 148,  21, 145,  29,  29,  23,  98, 148,  23,  20,  29, 149,
-107,  23, 105, 104, 148, 145, 105, 145, 105, 148,  20,  98, 148, 148, 151,
- 29,  23, 149,  23, 105, 148, 105, 110,  23, 149, 104, 110, 151, 148, 151,
- 21, 145, 105,  23,  21, 145,  98, 148, 151,  23,  20, 149, 149, 149, 104,
-149, 151, 148, 145, 151, 107, 104, 110, 107, 148,  29, 145, 148, 148,  20,
-151,  21,  31, 148,  98, 145, 148, 145,  20, 145,  20,  23, 110, 110,  31,
-145,  21, 105, 149, 149,  20, 149, 148, 104,  21,  21,  23,  31, 148,  98,
- 20, 149, 149,  23,  98,  21, 148, 107,  29, 104,  29, 110,  20,  31, 105,
-110, 104, 151, 148,  21, 110,  23,  20, 149, 149,  23, 145,  29, 105,  23,
- 98,  98,  98, 107,  31,  29,  20, 104,  23, 148, 148, 151, 148, 104, 149,
-104, 145, 149, 151,  20,  21, 104, 148, 151, 104,  98, 149, 151, 110, 110,
- 29, 151, 110, 149, 105, 107, 145,  31, 105, 104,  23,  20, 149,  21,  98,
-107, 107, 148, 151, 151,  29, 148, 149, 151, 110, 107, 105,  20, 105, 148,
- 23,  21, 148, 148, 107,  98, 149,  20, 110, 105, 110,  98,  20,  98, 110,
-105, 148, 148,  29, 105,  21, 148,  21, 151, 148, 148,  20, 110,  20, 104,
- 29, 110, 145, 148, 148,  29,  23,  29,  21, 148, 105, 107, 151,  20, 145,
-145, 148, 110, 107, 110,  98, 110,  98, 144, 149, 148, 105, 149,  98,  23,
-110, 149, 105,  21,  98,  23,  98, 105, 105,  29,  98, 151,  23,  98,  23,
-148,  21, 110,  21, 145,  21, 104,  21,  23, 104, 148, 107, 105,  21, 145,
- 29, 145, 110, 110,  21,  29,  20, 149, 151, 149, 110, 145, 149,  23,  98,
-110,  23,  29,  21,  23, 148, 145, 149,  29, 151, 148, 151, 149,  21,  29,
- 21, 149, 145, 104,  23, 149,  20,  31,  20, 149, 104, 149, 110,  21, 151,
- 29,  23, 105, 151,  23, 107, 148,  23, 145, 148,  98, 107, 105, 148,  98,
- 98, 107, 107, 110,  20,  23, 148,  29,  20,  23, 149,  20, 145,  23, 148,
-148, 145,  23, 149, 148, 110, 110, 151, 149, 107,  21, 105, 151, 151,  29,
-107, 145,  20, 151, 144, 149, 149, 110, 110,  23, 110,  20,  23, 149, 104,
- 21,  21, 145, 144, 110, 104, 149, 149, 105, 110, 110, 144, 110, 110, 110,
-149,  29, 148, 151, 110, 149,  29,  29, 149, 110, 148, 105,  21, 105,  29,
-145, 104, 105,  20, 104,  98, 148,  20, 110, 105,  23,  21,  29,  29, 149,
-148, 148,  98,  21, 149, 151, 144, 148, 110, 149,  23, 151, 107,  29, 151,
-144, 148, 144,  98,  21, 104,  23,  21, 148,  31, 110,  29, 151, 149, 148,
- 98, 107,  98, 149, 148, 149,  21,  20,  98, 151, 107,  21, 107, 105, 149,
-105, 110,  29,  21, 145,  21,  29, 107, 104, 148,  98, 149, 148, 148,  23,
-105, 110, 110,  23, 149,  23, 105, 110, 151,  23,  23,  21, 149,  98,  98,
-149,  31, 149,  21, 151, 105, 110, 110, 148, 148,  98, 148, 145, 149,  31,
- 31, 149, 149,  98, 148, 105,  21, 149, 149, 149,  98, 104, 145, 148, 148,
- 23,  21, 151, 149, 104,  29, 148, 148,  23,  20,  98,  21, 148, 149, 105,
- 98, 148, 105, 148,  98,  98, 148, 105, 110, 105, 145,  98, 105, 151,  31,
-104,  21, 110,  98, 105, 145, 148,  20,  23, 107, 145,  21,  21,  20,  23,
-151, 148, 148,  21, 104, 149, 104, 110, 149, 149, 105, 145,  29, 107,  98,
- 20, 110,  21, 148, 148,  23, 105, 105,  23, 107,  29, 110, 105, 148, 110,
-105, 110, 148, 104,  20, 149, 144, 107,  98, 148, 105,  21, 148,  21, 104,
-148, 110,  98,  98,  20,  29,  98, 110,  23,  31,  23,  29,  23,  98,  21,
- 21,  23,  21, 110, 105, 149, 110,  98,  21, 107,  98,  20, 105, 110, 145,
- 23, 149, 145, 145,  21, 104, 110,  98,  29, 145, 149, 145,  98, 110,  98,
-145, 104,  23,  98, 110, 148,  21,  20,  21, 107, 148,  21, 107, 149, 148,
-149,  98,  98, 107, 105, 145,  21, 110,  21, 149,  20,  23, 105, 110, 110,
-107,  29, 149, 149, 110,  31, 144,  29,  98, 149, 110, 145, 110, 149,  20,
- 98,  31,  23,  21,  23, 104,  98, 107, 105,  29,  29, 149, 149, 145, 105,
-110,  21,  23,  98, 148, 151,  29, 145, 149, 105, 105, 148, 145, 149, 145,
-145,  21, 104,  20, 151, 149, 145, 149,  29,  98, 149,  21, 145, 105, 105,
-104,  23, 144, 149,  98,  21, 148, 151, 149,  20, 148, 145, 105,  20, 104,
-151, 151,  23,  29, 110,  21, 149,  21,  29,  29,  23, 105, 149, 149, 145,
-151, 149,  21,  98, 105, 110,  29, 149,  21,  98, 107,  21, 107,  20, 151,
-148,  23, 148, 110,  29, 144, 148, 148,  20, 104,  29, 148, 105,  21, 149,
- 98, 151, 110, 104, 145, 105, 105, 148, 145,  21, 105,  21, 148,  21, 110,
- 98, 110, 151, 105,  23, 149,  98, 110,  21, 145, 107, 148, 148, 110,  98,
- 21, 149,  21, 105, 105, 105,  23, 149, 110, 144, 145, 149, 105, 148,  21,
-105, 105, 148, 149,  98, 110, 148,  23,  98, 148, 145, 149,  20, 145,  21,
- 21,  21, 148,  98, 151, 145, 110,  23, 148, 151, 104,  20, 148,  20,  98,
- 20, 145, 148, 145, 110, 105, 105, 149, 105, 148,  98, 149,  23, 149,  98,
- 21, 145,  98, 145, 110, 149, 148, 104, 149, 148, 148, 145, 148,  21, 148,
-148, 148, 105,  21, 148, 148, 107, 148, 105, 149,  23, 110, 151,  21, 145,
-104, 110, 148,  20,  29, 105, 149, 148,  31,  98, 105, 148, 105,  20, 149,
- 21,  21,  21, 105, 104,  98,  23,  20,  29, 148, 105, 148, 149, 110,  29,
-145, 145, 107, 149, 110,  20, 149,  21,  23,  23,  21, 149, 148, 148,  21,
- 20, 110,  98,  23, 110,  23, 105, 149, 149, 145,  23,  23, 110,  21,  23,
- 98,  29, 145,  98, 105, 105, 104, 105, 145, 148, 105, 148,  21, 105, 110,
- 21, 148, 105, 145, 105,  29, 145, 149,  98, 144, 149, 105, 151, 145, 149,
-151, 148, 149, 149, 145,  98, 148, 105, 148, 148, 145,  98,  98, 148, 110,
-110, 145,  98, 110,  98, 105, 148, 105,  98, 149, 145, 151,  23, 105,  23,
- 98,  20, 148, 110, 110, 149,  98, 149,  21, 149,  21, 105, 145,  23,  98,
-107, 105, 151, 149,  21, 149, 105, 148, 110,  98, 105, 110,  23,  21,  21,
- 21, 107, 110, 148, 149, 104, 107, 110, 149, 149, 149, 107, 149, 148, 148,
-149, 104, 151, 104, 149, 144,  98,  21,  98,  21, 110, 105, 151,  98, 144,
-110,  21, 110, 105,  29, 148, 110,  23, 110,  23, 148, 110,  23, 110,  23,
-148, 144,  21, 110,  29, 149,  29, 148, 110, 110, 151, 148, 149,  21, 149,
-145,  98,  23, 145, 144, 145, 149,  23, 144,  21,  29, 149, 107,  98,  23,
- 98, 145,  21, 105, 148, 105,  21, 149,  21, 149, 151, 148, 105, 105,  98,
-105, 145,  31, 148,  21, 105, 144,  29, 110, 110, 105,  98,  98, 148, 145,
-110, 105, 145, 149, 105, 105, 110,  23, 105, 110,  21, 148,  98, 148, 105,
- 21,  98, 149, 151, 149, 110,  21, 148, 149, 144, 148, 148,  98,  98, 149,
- 20, 105, 149, 110, 110,  23,  29, 110,  20, 105, 148,  21, 110,  98, 149,
- 23, 151, 148,  21, 148,  21,  23, 105, 149,  20,  98, 148, 149,  23,  23,
- 98,  98,  21, 105,  23, 105, 110,  23,  23, 110, 149, 144,  21,  98, 148,
-110,  23,  98,  23,  31,  98, 104,  98, 145,  31, 148,  21,  21, 149,  21,
- 29, 105, 148, 148, 110, 149, 105, 149,  21,  29, 145,  98,  23, 110, 105,
- 29, 107, 144,  23, 110,  31, 149, 148, 105,  29, 105, 148,  21, 110, 104,
-151,  31, 148, 110, 148, 149,  98, 149,  98,  21,  98,  21, 105, 149,  23,
- 98,  23,  21,  98, 105,  29,  21, 110, 149, 148,  21, 110, 151,  21, 104,
-149,  98, 148, 149, 105,  98, 148, 110,  20, 104, 151, 149,  98, 110,  21,
-110, 148,  23, 110,  21, 110, 148, 110,  98, 149,  23, 110, 145, 149, 110,
-148, 149,  31, 105, 110, 105,  29, 255, 148, 105,  31, 145, 149, 149, 110,
- 98,  20, 149, 110,  98, 105,  98, 148, 145, 105,  29, 105,  29,  21, 148,
-105, 105,  23,  21, 148, 148,  21,  29, 148, 145, 148, 149, 105, 145,  23,
-105,  29,  98, 105,  23, 149,  21,  98, 110, 148, 110,  29,  23, 110,  21,
-151,  98,  21, 149, 149,  21,  23, 110,  98,  21, 148, 148,  21,  98,  98,
-149,  21,  98, 148,  23,  98, 110, 145,  21, 110, 148,  23,  23, 149, 105,
-149,  29, 104, 110, 149, 149,  21, 145, 105,  20, 110, 151, 148, 148,  21,
-145, 105, 104, 144, 104, 145, 110,  98, 149, 144,  21, 148,  21,  23,  98,
-149, 148, 149, 148,  98, 110,  23, 110, 110, 145, 107, 149,  21,  21, 148,
- 23, 105, 145,  21, 105,  31,  98,  21,  29, 145,  23,  98, 145,  20, 149,
-148, 105,  98, 148, 148, 148,  23, 149, 105, 105, 148, 105, 110,  23,  21,
-149, 145,  29, 110,  98, 148,  29, 105, 105,  98, 149, 149,  98, 149, 148,
-105, 149,  21, 145, 148,  98, 148, 110, 110,  21,  98,  31,  21, 149,  23,
-105, 110, 149,  23, 148, 148, 149,  21, 145, 148,  23, 149,  23,  98,  31,
-148,  29,  21,  98, 110, 110, 145,  98,  98, 105,  23, 148, 145, 105, 148,
-149, 149, 105,  21, 149, 149, 149, 148, 105, 148, 148,  98,  31, 110,  23,
-148, 110, 110,  21, 149, 149,  98, 105, 110, 110, 149, 149,  21, 148, 149,
-145, 105, 105,  23, 105, 149, 148, 149, 149, 149, 110, 148, 145, 105, 110,
-105,  31, 148, 149, 105, 148, 110,  21,  23, 148, 105, 148, 145, 149,  98,
- 21,  98, 110, 149, 149, 145, 110,  98, 145,  98, 149, 149, 110,  21, 149,
-148, 145, 149,  98, 148,  29,  21, 149, 149,  21, 149,  21, 105,  98, 148,
-110, 148,  21, 148, 149, 149, 110,  29, 149, 105, 149, 149, 148, 144,  21,
- 98, 105,  21,  98,  23, 110,  98, 110, 110, 110,  98, 145,  23, 105,  98,
-110,  29, 148, 105,  21, 145,  21, 149, 149, 149, 105, 149,  98, 149, 149,
- 23, 148,  21, 110, 105,  23,  21,  21, 105,  98,  98,  98,  98, 148,  21,
- 21,  23,  21,  98,  21, 148, 105, 110, 149,  98,  21, 110, 149, 148, 149,
- 21, 110, 105, 105,  31,  21, 148,  98,  23, 110,  21, 149,  21, 110,  23,
-144, 148, 145, 149,  29, 105,  98, 148,  23,  23, 149, 145,  21,  31,  98,
- 21, 105,  96, 149, 111,  21,  98, 105, 105,  23,  23, 110, 105, 149, 145,
- 98,  98, 110, 149, 148, 145, 110, 145,  21, 110,  98,  29, 110, 148, 149,
-148, 105,  31, 145, 105, 144,  23, 148, 110,  21, 105,  98, 110, 149,  21,
- 98, 148, 148, 148,  98, 149,  21, 105,  21, 110, 149, 105, 149, 149, 148,
-144,  29,  98, 148, 148, 110, 144, 148, 110,  98, 110, 148, 105,  29, 105,
-149, 149, 149, 110, 148, 149,  23, 105, 149,  23, 111, 110, 105, 149, 105,
-145,  21,  23,  21,  29,  98, 110,  21,  23, 148, 149,  31,  98, 145,  21,
- 21, 144,  21, 105, 149, 148,  21,  29, 148, 149, 149, 110, 110, 149, 145,
-110, 110,  21,  98,  98, 148,  96, 148, 148, 149, 149, 148,  21,  98, 149,
-149,  23, 110, 145, 149, 148,  21,  21, 110,  21, 145, 148, 110, 149,  98,
-149, 149, 148,  21, 110, 148, 110, 148, 149, 110, 105, 105, 110, 105,  29,
- 23,  21,  23,  21,  21,  21,  98, 148,  23,  29, 144,  23,  21,  98,  23,
-149, 105, 105,  98, 110,  99,  29, 145, 148, 105, 149,  29,  29,  21,  21,
-110, 110,  98,  98, 105, 108,  21, 149, 149, 110,  98,  23, 145, 149,  98,
-105,  23, 110, 108,  98,  21,  21,  23,  23,  98, 149, 149,  23, 145,  98,
-149, 149, 105, 149, 149, 145,  21,  98, 149, 145, 105, 149, 105, 105, 148,
- 23, 149,  96,  98,  98,  98,  29, 145, 149,  21, 145, 148,  21, 149, 105,
-110, 108,  21, 145, 145,  21, 111,  29,  98,  98, 149,  21,  29, 148, 148,
-110, 105, 105, 105, 105, 149,  98, 105,  98, 148, 149, 110, 145, 149, 145,
-148, 148, 105,  96, 148, 145, 111, 148, 110, 148,  98, 149, 149,  29, 149,
-145, 110, 105, 110,  99, 145, 145, 110, 149, 110,  29, 110, 111,  98,  99,
- 98, 110, 110, 105, 105, 110,  23, 144, 148,  98,  98,  23,  21,  29, 105,
-149,  98, 110,  23, 149,  98, 149, 149, 149,  99, 105,  21,  98,  21,  21,
- 99, 149,  23, 110, 149, 148,  21, 110,  21, 110,  21,  21, 148, 105,  98,
-148, 148,  29,  21,  98, 148, 105,  23,  23, 255, 148, 110, 148, 105, 110,
-148, 105, 105, 110, 110, 149,  96, 110,  21, 105, 105, 149,  98, 105, 145,
-110, 145, 110, 105,  96,  21, 145,  21, 148,  21,  96, 148, 149, 105,  98,
-105, 149, 145, 145,  23, 105, 110,  21, 110,  98,  96, 148, 105, 148,  96,
- 21,  21,  23,  23, 149,  21, 148, 148, 149, 149,  98, 111, 105,  31,  23,
- 23, 110,  98, 108,  23,  21,  21, 149,  21, 145, 105, 105, 144,  23, 148,
- 98, 110, 148,  21, 148,  98,  21,  21,  21,  21, 105, 108,  21, 110,  29,
-148, 149, 148, 148,  98, 149, 149, 110, 149, 148,  21, 149, 105, 149, 149,
-111,  99, 145, 110, 148,  96,  99, 148, 148,  21,  29,  98,  96, 110, 149,
-108,  21, 110, 149,  21,  98,  98, 149,  98,  21,  23,  99, 148,  21,  21,
- 21,  31, 110, 111,  29,  21, 148, 110, 110, 148,  98, 149, 148,  29, 105,
-105,  96,  98, 145,  98, 149, 148, 148, 110, 111, 149, 148,  21, 149, 105,
- 29, 148, 110,  23, 148, 105,  98, 145,  98, 105,  98, 110, 110, 110, 110,
-105,  99,  98,  98, 105,  23, 148, 148,  21, 110,  96, 145, 111, 149,  98,
- 96,  29,  98,  23,  96, 108, 110,  21, 149, 149,  23, 149, 105, 148, 148,
-105,  98,  23, 105,  98,  98,  21, 108,  21, 145, 148, 148,  29,  21,  21,
-105,  21,  21,  99, 110,  98,  99, 145,  96, 149, 110, 110,  29,  21, 105,
-110, 105, 149,  98,  21,  98,  23, 149, 110, 110, 148,  29, 110, 108, 149,
-110, 110,  21, 149, 145, 110, 149,  99, 145,  96, 110, 148,  98, 149, 110,
-111, 149,  23,  23, 105,  98,  21, 145, 105, 145,  98, 148, 148, 111, 149,
-149, 110, 145, 105,  96, 149, 108, 111,  21, 148, 145, 110, 148, 148, 110,
-148, 148, 105, 110,  21,  99,  96, 149, 105, 149, 145, 148, 110,  23, 105,
- 98, 111,  98, 111,  21,  98, 144, 110,  21, 149, 105, 108,  98, 149, 149,
- 21, 149, 108,  98,  99, 149,  21,  21, 149,  23, 110, 111, 110, 149, 105,
-145, 145, 110, 148,  96, 149, 149,  98, 105, 145, 148, 110, 148,  29,  21,
-148, 110, 149,  98, 149, 149, 105,  23, 148, 149,  98,  23,  23, 149, 110,
-105, 148,  98,  29,  99,  98,  21, 149, 110,  23,  23, 108,  98,  98,  96,
- 99, 108, 149, 148,  21, 108,  21,  96, 110,  98,  98, 148, 145, 149, 148,
- 98, 148,  96, 148, 149, 148,  21, 108, 110,  29,  23, 149, 110, 111, 110,
-149, 105, 145, 105, 148, 148,  99, 105,  31, 148, 148, 110,  99,  98,  23,
-149, 111, 111, 148,  96, 148, 149,  98, 110, 149, 110, 148,  21, 110,  98,
- 98, 144,  21,  23, 111,  21,  23,  23,  23,  98,  23, 145,  98, 144,  21,
- 99,  21,  98, 148,  98, 110, 148, 148,  98, 149,  98,  96, 145, 110, 110,
- 23, 105, 105,  21, 148,  98, 148,  98,  21,  21, 105, 110,  21, 149,  29,
- 29,  96, 110,  23, 110, 149,  21, 111, 148,  21,  21, 148, 108, 145,  98,
- 23,  21,  98, 148,  21, 149, 105,  99, 108,  21, 105, 149, 149,  96, 148,
- 21,  98, 110, 149, 148,  99, 145,  29, 108,  98, 105, 105, 108, 110, 149,
- 21, 110, 108,  96,  99,  96, 148,  23, 110,  21, 148, 149, 148, 148, 145,
-145,  98, 105, 149, 144, 108, 145, 145, 108, 148,  21,  21,  21,  96,  21,
-145, 105, 111, 111, 148, 149, 149,  21, 110, 149, 148, 105, 148, 105, 149,
-149,  98,  21,  96, 148, 105,  98,  21,  21,  98,  21, 148, 110,  96, 149,
- 98,  21, 105, 108, 105, 110,  23,  21, 148,  21,  23, 148, 148, 110,  99,
- 21, 148,  29, 110, 110,  98, 108,  23, 105, 105, 148, 111,  21,  21, 111,
-110, 105, 148,  21,  21, 149, 105, 110,  29,  21, 149, 149,  96,  96, 148,
- 23, 148, 111, 105, 148, 145,  96,  99,  98, 108, 110, 149,  98,  23,  98,
- 98, 145,  23, 111, 148, 148, 110,  23,  29,  21, 148, 145, 148,  21,  29,
- 98, 110, 105,  98, 149,  21, 110, 111,  99, 111,  29, 110, 110, 110, 144,
- 21, 149,  21,  31, 110,  23,  21, 110,  31,  31, 149, 149, 105, 149,  21,
- 98,  23,  21, 145, 148,  21, 108, 148, 148,  98,  21,  23, 111, 108, 145,
- 21, 110,  21,  21, 108,  98, 149, 149, 148,  98,  21, 148,  99,  23, 149,
-149,  98, 148, 148, 110,  21,  99, 148, 149, 149,  21,  21,  96, 108, 145,
- 98, 148,  21, 111,  98, 149,  23, 108,  99,  21, 108, 111, 105,  23, 149,
-149, 148,  29, 149,  21,  29, 145,  21, 111,  23, 149, 148,  23, 110,  29,
- 23, 105, 110,  96, 105, 149,  29,  96,  99, 149, 149,  23, 108,  98, 110,
-149,  21,  31, 111, 108,  96,  23, 145, 149,  21,  21, 149, 145, 111, 108,
-105, 149, 145, 110, 110, 145, 148, 110, 148, 149,  98, 145, 148,  98, 148,
-148, 149, 145,  31,  99, 110, 144,  21, 145,  23,  99,  29, 149, 105, 148,
-111,  99, 110,  21, 145, 148,  99, 105,  31,  21,  21, 110,  29,  96,  99,
- 96, 148, 105, 255,  98, 149,  31, 145, 255,  23,  23,  29, 149,  96, 108,
-105, 111,  21,  29,  23,  96, 148, 105,  21, 149,  23,  21, 105,  96,  23,
- 98,  31,  96, 145,  98,  99, 145, 148,  99, 149,  99, 110, 105, 144,  21,
- 21, 149,  99,  31, 149,  23, 148,  96, 148,  23, 148,  96,  23, 108,  98,
- 31, 149,  21,  96, 145, 110, 111, 108,  23,  29, 108,  23,  21, 149, 148,
-108, 111, 148,  29, 111, 110,  21,  21, 145,  98, 148,  21, 105, 149,  31,
-149, 105,  98, 111, 110,  21, 105, 105, 105, 145,  21,  21,  21, 110, 108,
-111, 108,  23, 105, 149,  96, 149,  99, 148, 145, 144,  98, 149,  98, 110,
- 21, 111,  96, 149,  96, 105, 148, 149,  21, 105,  21, 108,  23, 149,  31,
-148, 111,  98,  98, 105, 149, 108, 148,  29,  21,  29,  23, 110, 149, 108,
-149, 110, 149, 149, 149, 148,  99, 149, 145, 110, 149,  98, 148, 149,  99,
-105, 110, 149,  21,  96,  99,  98,  96, 111,  96, 149, 149, 148, 149,  23,
- 96,  21, 145,  98,  23, 148,  98, 110, 110,  23, 148, 111,  23, 110,  23,
-148, 110,  21,  96, 105, 148,  21, 105,  29,  96, 111, 111, 108,  23,  99,
- 99, 108, 149, 105,  99, 145, 149, 149, 111,  29, 105, 148,  21, 111,  96,
- 96, 148, 148, 110, 111,  23, 148,  23, 105,  21,  98,  21,  99, 149, 148,
-149, 144,  29, 111, 111, 149,  23, 111,  96,  21,  29, 144,  96, 111,  23,
-108,  99, 108,  23,  98, 148, 110, 108, 149, 149,  23, 111,  29, 110,  21,
-148,  98, 145, 108, 111,  98, 148, 144, 145, 110, 149, 148, 149, 148, 105,
-110,  96,  96,  21, 105, 110, 108, 105, 149, 108, 149, 145, 149, 110, 108,
- 99, 111,  21,  29, 111, 149, 148, 111, 149, 108,  21, 149, 148,  23, 149,
-148, 149, 110, 105,  29,  96, 111, 111, 111,  21, 105, 148, 148, 145, 148,
- 21,  99, 148, 111,  98, 149,  96, 148, 108, 148,  96, 149,  23,  96, 108,
-145, 149, 110,  23, 148,  21,  99, 149,  99, 145,  98, 108, 110, 110,  98,
-149,  99, 110,  99, 149,  98, 108, 105, 108, 149,  29, 148,  21,  23,  98,
-145, 148,  96,  23,  21, 148,  23, 111, 108, 149,  21,  31, 149, 108,  29,
- 21,  21, 111, 145,  21, 145, 105, 105, 145, 108, 145, 105, 105,  99,  98,
- 21,  23, 111, 148, 105, 111, 105, 148,  23, 149, 149, 149, 105, 149, 105,
-149, 148, 148,  98, 111,  98, 144, 148,  21, 149,  23, 148, 110,  96, 149,
-149,  31, 110,  99, 149, 110,  96,  21, 148, 105, 148, 148, 145, 144,  21,
- 21,  21, 110,  96,  29,  99, 110,  96, 105, 108, 148, 149, 110, 145, 149,
- 21,  98, 105, 149,  21, 111,  21, 148, 111, 148, 105, 108, 148, 111, 149,
-149, 110,  96, 148,  98,  23,  21,  29,  21, 148,  21, 148,  96,  23, 149,
-105, 149,  23,  99, 108, 110, 149, 108,  96, 111, 108,  23, 108,  21,  21,
-145,  98, 149,  23, 111, 108, 111, 145,  99, 111,  29,  98,  99, 111, 255,
- 21, 110, 108, 105,  21, 110,  98, 108, 149, 149,  23,  23,  99,  21, 149,
- 21, 110, 145,  98,  99, 110,  21,  21,  31,  21,  96,  98, 108, 148,  96,
- 98,  99,  21,  96, 148, 110, 148, 149, 111,  23,  96,  96, 145, 105,  29,
-111, 149,  96, 149,  23,  23, 105, 149, 110, 105, 111, 108, 145, 149,  99,
-110, 148,  29, 148,  96,  99, 148, 110,  98,  23, 110,  96, 148, 111,  29,
- 96,  21, 110,  99,  99,  21,  21, 149,  96, 111, 148, 108, 149, 149, 148,
-111, 148, 148, 149,  98, 111,  99, 149,  98, 149,  23,  29,  99,  96, 149,
-149, 149,  96, 148, 111,  21,  31, 148, 149,  21, 110, 111,  96,  29, 149,
-149, 110,  21, 111, 148, 108,  96, 105,  23, 149,  23,  29, 145, 105, 149,
- 21, 105, 111, 148,  23,  98, 149, 108,  29,  98, 148, 108, 105, 149, 108,
-105, 145, 148, 108, 111,  99, 148, 110, 149, 110,  96, 148, 149, 108, 111,
-148,  96, 149, 110,  21, 110, 108,  99, 145,  23,  99, 110,  99,  21, 149,
-148, 148,  99, 105, 105, 111, 148, 148, 148, 105,  96, 144, 111, 149, 108,
- 23,  96,  29,  98, 148,  98, 149, 108, 111,  96, 149, 105,  96, 149,  21,
- 29,  96,  96, 148,  23,  23, 149, 105,  23, 111,  21,  21, 145, 105, 111,
-110,  23, 145, 148, 108, 111, 110, 144,  21,  98, 108, 148, 105, 145,  23,
- 23,  99,  96,  29,  99,  21,  99, 149,  21, 148,  23,  98, 148, 108, 149,
- 21, 111,  99, 110, 148, 145, 149, 148, 108, 111, 110, 108,  96, 149, 149,
- 21, 148, 105,  98,  98, 108, 149, 110, 108, 105,  96, 149, 111, 149,  21,
- 21,  21, 145, 148,  31, 149, 149, 148, 111, 110, 149, 148,  99, 111,  21,
- 99, 148, 105, 148, 108, 149,  29, 111, 149,  21,  23,  99,  21,  96, 105,
-145, 110, 108,  29, 108,  21, 110, 149, 111,  96, 148,  21,  99, 105, 110,
- 23, 108, 144,  99, 108,  21,  21, 149, 145,  23, 145, 149, 255, 149,  96,
-108, 110, 105,  96, 149,  98,  21, 149, 105, 108, 111,  98, 148, 108,  99,
- 96, 110, 111,  23, 111,  96,  96, 148,  99, 149, 148, 111, 149, 111, 148,
- 99,  99, 148, 108, 148,  98, 149,  96, 148, 145, 149,  21, 144,  31,  29,
- 23,  96, 149, 111,  98,  96, 149, 110,  21, 110, 111, 111,  96, 105,  23,
-145, 148, 148,  99,  99,  98, 149,  96,  99, 108,  23,  23, 149,  21, 110,
- 96, 148,  96, 108,  99, 148,  99,  99, 149, 111,  96,  98, 149, 148, 111,
-111,  23,  21,  96,  21,  21,  96, 145, 111, 108,  21,  21, 149,  98, 149,
-110,  99,  21, 108, 149, 145,  31, 110, 144, 105, 111,  21,  98,  99, 149,
-148,  96,  23, 149, 111,  99, 110,  29, 111, 111, 149,  99, 148,  98,  23,
-148, 149, 145,  99,  99,  21, 148, 108, 148, 145, 105, 145,  96, 111, 149,
-111, 105, 105,  29,  29, 105, 105, 110, 111,  96, 110,  23,  31, 108,  21,
-105, 148, 105, 110, 149, 108, 149, 149,  23, 111, 144,  21, 149, 108,  21,
- 99, 148,  96, 145, 145, 110, 108, 108, 111, 108, 149,  96, 148,  98,  96,
- 98,  21, 145,  29,  21,  29, 111, 145,  21, 255,  21, 111, 111, 149, 149,
-149,  98, 111, 145,  23,  96,  99, 148,  96, 108, 105, 149,  29, 111, 145,
-149,  96,  21, 108, 108, 108, 148, 149,  23, 111,  21, 108,  29, 148,  21,
-148, 108, 149, 111,  96, 111, 149, 148, 148,  21, 111, 108, 149, 145, 148,
- 99,  21,  99,  21, 145, 110,  96, 111,  21,  99, 105,  96, 110, 145,  99,
-111,  96,  99,  96,  23, 108, 148, 148, 108,  23,  23,  21, 148,  96, 145,
-148,  96,  96, 145, 148, 148,  96, 108, 149,  96,  23,  23, 149, 149, 111,
- 21, 148,  98, 145, 149, 148,  99, 148, 149,  99,  98, 148,  99, 108,  21,
- 23,  21, 108,  98,  96, 108, 149,  99, 145, 148, 145, 148,  23, 111, 149,
-111,  96,  99,  23, 144, 105, 111,  23, 111,  96, 108,  21,  31,  21,  99,
- 23,  96,  96,  23, 149,  99, 108,  96, 110,  21, 145, 108,  96, 110, 111,
-145, 148, 148, 111,  96,  96, 108, 111,  23,  99, 149, 148,  98,  31, 149,
-105,  96, 108,  98, 110, 108, 145,  29,  96,  21,  21,  99,  21,  99, 111,
-111, 111, 145, 108,  31,  29, 148, 145, 105,  23,  98, 148, 149, 145,  96,
-108,  21,  21,  21,  99,  96, 111, 108, 111, 105, 110,  99, 149, 111, 148,
- 99,  29, 145,  21,  96,  29,  99, 145, 149, 111,  96, 145,  21,  98, 149,
- 99,  21,  99,  29,  96, 111, 111,  21,  99,  96, 148, 148,  96, 149,  99,
- 21,  21,  23, 149, 111, 149, 108,  96, 111,  99, 148,  99, 111,  96,  23,
-111, 108, 110, 108,  96, 110,  99,  23,  96, 111,  99, 145,  96, 149, 105,
-108,  99, 108, 149,  99, 108, 108, 108, 111,  29,  29,  99, 149, 111, 148,
- 98, 108, 149,  99, 148,  21, 108,  21, 148,  99, 110,  96, 149, 105, 149,
- 99, 145, 108, 108, 111,  98, 110, 149,  99, 148, 111,  21,  96, 111, 149,
-108, 108, 148,  96,  29,  99, 108, 149,  21, 149,  23, 108, 108, 149, 111,
- 99,  96,  96,  29, 108, 111, 145,  96, 148,  21, 149, 149, 149, 105, 148,
- 21,  23,  21, 108, 110, 149, 110,  99, 108, 110, 145, 111,  98, 148, 111,
- 23, 108,  98,  96, 149,  21,  21,  96, 148, 110,  99, 111,  99, 149, 108,
-105, 111,  96, 149, 148,  99, 148, 149, 108,  98,  99, 149,  96,  21,  96,
- 96,  23, 108,  99,  23, 108,  96, 105,  99,  96, 145, 111, 148,  99, 149,
-148, 148, 149, 110, 108,  96,  98,  96,  23,  21,  99, 148, 108, 108, 108,
- 21,  29, 105, 145, 111, 111, 149, 145, 111,  99,  99,  99,  99, 111, 110,
-111, 148,  29,  96, 148,  99, 111, 111, 149, 111, 111,  99,  96, 148, 149,
- 21,  31, 148,  29, 145, 111,  99, 149, 148,  99,  23, 108,  96,  23,  21,
- 96, 149,  96, 111, 108, 149, 111, 149, 149,  98, 111,  96,  23,  99, 149,
-149,  96, 111, 148,  96,  21,  21, 149, 148, 145,  99, 148, 108,  29,  21,
-149, 108, 111, 108,  21, 149, 149,  21, 111,  21,  23, 110, 148, 108,  99,
-148, 148, 149,  21, 111,  98,  21,  21, 105,  96,  96,  96, 108, 149, 148,
-149, 108,  98, 108,  23, 111, 108, 145, 111,  99, 148,  21, 108, 110, 148,
-148, 111, 108, 111,  21,  29, 108, 148,  21, 148,  23,  23,  96, 149, 148,
-149, 149,  99,  21,  99, 108, 111, 111,  29, 108, 149,  96,  96, 145, 111,
-111, 149, 108, 149, 148,  21,  96, 149, 149, 111, 148, 108, 149,  23,  21,
-149,  23, 148, 149, 110, 148, 110, 108, 149,  21,  99, 145,  96, 111,  99,
- 96, 148,  99, 148,  29, 145,  99,  23, 111, 108,  21,  96,  99, 148,  21,
-108, 111,  23, 148,  99,  99, 149,  96,  99,  21,  21,  98, 149, 149, 111,
-108,  99,  31,  96,  29, 145, 148,  99, 111, 145,  96,  21, 105,  21,  96,
-111, 108,  99, 110,  96, 108, 149, 108,  21, 111, 148, 110,  23,  21, 111,
-149, 105,  96, 111, 145,  99,  29, 108, 111,  96, 111, 108, 144, 111, 110,
-108, 111, 108, 148,  96,  96, 148,  99,  96,  99,  23, 110,  29, 148, 108,
-149,  99, 111, 149, 148, 144, 108,  96, 149, 148,  21, 108, 145, 149, 149,
-108,  96, 110, 148, 108, 108, 111,  99, 110, 111, 148, 149, 149,  96,  23,
- 21,  99,  96, 108,  99, 145, 145, 148,  96,  96, 149,  99, 149,  99,  99,
-144,  99, 145, 108, 111,  96, 149, 111, 148, 144, 105, 148, 148,  21, 149,
-108, 108,  21, 108, 105,  29, 108,  21, 149, 111,  21, 145,  31,  96,  23,
- 96, 148, 145, 148, 111, 108, 149,  99, 108, 148, 111, 108,  99,  96, 108,
-108, 108,  96,  23, 149,  96, 148,  21,  96, 111,  96,  96,  99, 148, 148,
-149, 255,  21,  96, 108,  29, 111, 108,  99, 111, 108, 145, 148, 149,  96,
- 96, 108,  96,  23, 149, 111,  23,  96,  96, 108, 145,  23, 148,  29, 111,
-144,  98, 111,  99, 111, 111,  99, 111, 111,  23,  21, 149,  99,  23, 149,
- 21, 111, 111, 108, 111, 108, 111, 108, 111, 255, 149, 149, 108, 111, 149,
- 29,  23,  21, 111,  29, 148, 108, 111,  21, 108,  23, 149,  96, 108,  96,
-149,  96,  23, 149,  99,  21,  98,  99,  96,  21,  96,  96, 149,  23, 145,
- 21,  23, 145,  99, 108, 111, 108,  21, 108,  96, 149,  21, 148,  21,  23,
-108, 111, 111,  99,  99, 148, 148, 108,  99,  21,  96, 148,  96, 111,  21,
-149, 108, 111, 148,  99, 111, 111,  99,  96, 111, 144,  21, 111,  96,  99,
-149, 144,  21,  96, 148,  21,  23, 111,  96,  29, 111, 149,  23,  23,  99,
-111, 111, 148,  31, 108, 149, 149, 111,  21, 110,  96,  96,  96,  21, 111,
- 96, 108,  23, 111,  96, 108, 148, 108,  96, 108,  29,  99, 149,  99, 148,
- 96,  99, 108,  23, 145,  31,  99,  29,  99,  21,  96, 148, 149, 149,  31,
-148, 145, 149,  29,  99,  21, 148,  21,  29, 108,  96, 144,  23,  96, 111,
-111,  31, 148,  99, 111, 148,  99, 108, 111,  96, 108, 149, 108,  96, 148,
-149,  96,  21, 111, 149, 111, 111, 148,  96,  23,  21, 148,  21, 108, 149,
- 96, 111,  96, 111, 149, 145, 149, 145, 108,  96, 111,  21,  99,  99, 149,
-145, 148,  23, 111,  96, 149, 149, 108, 108,  23,  99,  96, 111,  99,  99,
- 99, 108, 148, 111,  29,  96, 149, 148,  99, 149, 149,  96,  99, 108, 145,
- 99, 145, 108,  99, 148, 108, 149, 108, 108,  21,  99,  96, 149, 149, 111,
-149, 148,  99,  23, 149, 111, 105, 111,  96, 108, 148, 108, 110, 148, 148,
- 23, 111, 108, 108, 149, 149, 148,  96, 108, 108,  99,  96, 149,  29, 145,
- 96, 111,  96, 148, 111, 145,  99, 111,  96, 111,  31,  21,  21, 148, 145,
-111,  21,  23,  23, 145,  99, 149, 149,  31, 148, 108, 111, 111, 148,  21,
- 99,  42, 170, 170, 108, 162, 108,  46, 168, 111,  46,  99, 170, 168, 111,
-111,  47,  96, 111, 170, 162, 108, 108, 170,  99, 170, 111,  96,  43, 168,
- 47, 111, 170,  96,  99,  96,  96,  42,  96,  42,  42, 170,  42,  99,  96,
-111, 111,  96, 168, 108, 168, 168,  46, 108,  99, 170, 168,  43,  99,  96,
- 42,  99, 111, 170,  99,  96,  96, 170, 168, 168, 108, 111,  97, 170, 111,
-108,  46, 168,  96, 108, 162,  96,  96, 170, 111,  42,  96, 108,  99,  99,
-108, 111, 108,  99,  99, 108,  96, 111, 168,  96, 111, 108,  42, 168,  47,
-111, 111, 111, 160, 170, 111,  96, 162, 111,  96, 168,  43,  96,  99, 108,
-109,  42,  99, 108,  99, 111,  42, 168, 108,  42, 111, 108, 170,  42, 170,
- 43,  46, 108,  97, 111, 170, 111, 108, 111,  42, 170, 111, 162, 108, 170,
- 43,  46, 111,  99,  96, 168,  46,  43,  43, 162, 170,  43,  99, 102,  96,
-170, 170, 108, 111,  42, 111,  99, 168,  96,  96, 162, 170, 170,  46,  42,
- 46, 162, 160,  42, 168, 108, 109,  42, 170,  99, 168, 162, 111,  42, 162,
- 99, 168,  96, 160, 168, 108,  42, 162,  42, 162, 162, 108,  99, 111, 111,
-111,  99, 108,  99, 111,  43, 111, 170, 170,  96, 108, 168,  46, 168, 162,
-111,  99, 108, 108, 108,  99, 111, 170, 168,  99,  42,  99,  42,  96, 168,
-170, 168,  96, 168,  96, 168, 170, 111, 170,  96, 170,  99,  42,  42,  99,
- 42,  96, 111,  99, 168, 111, 111, 111,  99, 168,  96,  47, 168, 168,  42,
- 96,  46,  96, 168,  42, 162,  99,  42,  96, 168, 111, 111,  99,  46,  96,
- 99, 168,  96, 170, 162,  42, 168, 111,  46, 108, 162,  43,  43, 170, 168,
-170, 168,  99, 109,  42, 170,  42,  96,  46,  99, 170, 170,  96,  43,  99,
- 99, 109, 111, 111, 170, 168, 108, 170, 111, 111, 170,  99, 170, 108, 108,
- 96, 111, 170, 162,  96, 111, 108,  42, 168, 109,  96, 168,  96, 111, 170,
- 43,  96, 108, 108, 108,  99, 108, 168,  47, 108,  42, 108,  99, 111,  47,
-168,  46, 170,  96, 170,  96, 108, 111, 168, 162, 168, 170,  43, 102, 111,
- 42, 111,  96, 108,  99, 108,  96, 170,  99, 170,  99, 168,  43,  46,  99,
-162, 168,  96, 102, 168, 168, 160,  96,  43, 111, 162, 108,  43, 111, 108,
- 43, 168, 168,  46,  46,  99, 170,  42, 162, 170, 162,  96, 108, 162,  99,
-109,  99, 111,  42, 109, 111,  42, 168, 108, 108, 108,  96,  46, 108,  99,
- 96, 108,  46,  43, 168, 170, 170, 111, 108, 111, 168, 111,  96, 108, 170,
-170, 111, 170, 108,  96, 168, 111, 162, 111, 162, 170,  46,  42, 111,  46,
- 42,  99,  42,  43,  46, 111,  99, 170, 170,  43, 111, 170,  42,  99,  42,
- 42, 170,  96, 162, 168,  97, 108, 108, 168, 111,  99,  96,  42,  96, 168,
- 99, 108,  96,  99, 108, 111, 168,  46,  46,  96,  42,  96, 111, 111,  42,
-108, 168, 170, 111,  96, 162, 162, 168, 111, 111,  96,  97, 108, 170, 170,
-170,  96,  96, 162,  42, 168, 162,  96,  47, 109, 168, 162,  46,  97, 111,
- 96, 111, 108, 111, 160,  99,  43, 168, 108, 168,  99, 111, 108,  99, 168,
-162, 170, 168,  42, 111, 160,  96,  96, 109,  42, 108, 168,  99,  42, 168,
- 42, 160,  96,  42,  97, 168,  47,  42, 160,  46,  46,  42, 255,  96, 108,
-108, 168, 102, 111,  99, 170, 168, 108,  99,  99, 108, 168, 168, 170, 168,
- 42, 168, 111,  99,  96, 170, 109, 168, 111,  97, 111, 108,  96,  43, 111,
-108, 170, 170, 170, 108,  96,  42, 108, 108,  99,  96, 111, 102,  96, 108,
-102, 108, 108, 111,  99,  99, 162, 109, 111, 162, 170, 170,  46,  96, 170,
-111,  42,  42,  99, 102, 111, 170,  96,  42, 111, 108,  96, 170, 170, 111,
- 42,  43, 111,  43, 170,  43, 108,  99,  42, 170, 111, 170, 108,  43,  42,
- 43,  99,  96,  42,  42,  97, 170,  96, 102,  96, 168, 108, 170,  42,  96,
- 43,  96,  43, 102,  99, 111,  42,  42, 168,  96, 108, 170,  97, 170, 111,
-111, 162, 170, 111, 170,  96, 111, 160,  42, 170,  99, 168, 170, 111, 109,
-162,  99,  43, 109,  43,  43, 170,  96, 160, 111, 162, 108, 109,  46,  96,
-108, 168, 111,  42, 162, 108,  96, 170,  43,  96,  96,  42, 111, 108,  99,
-168, 168, 170,  42,  96, 111, 111,  99,  99, 108,  97, 111, 162, 108, 170,
- 42, 162, 168,  99, 111, 102, 108,  46, 168, 108, 170,  46,  99,  96,  46,
- 42, 170,  42, 170,  99, 170, 108, 170, 111, 255,  42,  96,  96,  99, 108,
-109, 111,  42,  97, 111, 170,  96, 108, 168, 111,  97, 108,  96,  43,  42,
-170,  99, 108,  46, 170,  43, 111,  96, 109, 108, 111,  97,  96,  96, 111,
-168, 170, 170,  99,  43,  99,  99,  42, 111, 162,  96,  97, 108,  96,  96,
- 47,  99,  99, 170,  99, 168,  42,  42, 168, 111,  47,  42,  99, 170, 111,
- 42,  42,  42,  96,  96, 111, 102,  99,  42,  43, 170,  42, 111, 168,  47,
-111, 108, 170,  43, 162, 108, 109, 170, 170,  96, 170, 168, 168,  43, 111,
-108, 108,  99,  99, 160,  42,  97,  43,  43, 168,  99,  42, 102, 170, 111,
- 47,  42,  99, 109, 170,  96, 111,  99,  99,  42, 111,  99,  42,  42, 102,
-162,  43,  43, 170, 168,  96,  96, 168, 108, 170, 111, 108,  43,  96, 111,
-111, 111,  96, 168, 170,  43, 108,  99, 170,  42, 168,  96, 168,  43, 111,
- 96, 170,  42,  46, 168,  97,  43,  97, 111,  42,  42,  42,  42, 162,  43,
-170, 102, 162, 108, 108, 108, 170,  96, 168, 170, 108, 111, 168, 168, 111,
-108, 102,  42,  42, 170, 168,  43,  43, 168, 162, 102, 109, 168, 168,  46,
-168,  99,  99, 170, 111, 108,  43,  96,  99,  43, 168, 111, 168, 102,  99,
-108,  96,  96,  46,  42, 109,  99, 111, 168, 170, 162,  96,  99, 162,  42,
-108, 108,  99,  42, 111, 111, 170,  42,  42, 168, 102, 168, 170,  42, 108,
-109, 162,  96, 168, 109, 170, 168,  96, 111,  99, 168, 111, 170,  96, 111,
-170,  47, 109, 170,  99,  42, 109, 108,  97, 111, 168,  43,  43, 111, 168,
- 96, 108, 162, 168,  96,  46, 162,  46,  96, 108, 170,  96, 108, 168, 111,
- 42, 109, 111, 170,  42,  99, 168, 109, 168, 170, 162, 170, 170, 108, 111,
-108, 111, 170, 111, 162,  97,  96, 111, 170,  97, 111, 102,  96,  97, 160,
- 99, 170, 108, 170,  96, 109,  43, 111,  42, 108, 162, 108,  99, 170, 162,
-111, 102, 168, 108, 170, 162, 102, 160,  42, 168,  96,  42,  96, 168, 170,
-108, 108, 170,  46,  96, 111,  43,  96, 168,  99, 162, 111, 111, 102, 102,
- 43,  42,  96, 111, 168, 168,  99,  97, 168, 162, 111,  96, 170, 108,  43,
- 42, 170, 108,  99, 162, 108,  96, 111, 170,  97,  96,  96, 108, 168, 170,
- 42,  42,  99,  99,  42,  96,  96,  96,  43, 170, 168,  97, 170, 170, 162,
- 42, 168, 170, 111, 170,  99, 168, 160, 109, 170,  99, 170, 111,  97,  96,
-170, 160, 102, 102, 168, 111, 108, 108, 168, 108, 108, 170,  96,  99,  43,
-111,  46, 168,  42, 111,  99, 170, 111, 109, 109, 108, 109,  43, 162,  43,
- 42, 170, 108,  96, 168, 111,  42,  47, 170, 168, 168, 102, 111,  96,  43,
-111,  42,  43, 162,  96,  96, 168,  96,  42,  99, 170, 168,  99,  46,  96,
- 96,  97, 162, 170,  43,  97,  46, 108, 160, 168, 111,  96,  42,  97, 108,
- 42, 111,  99,  99, 168,  42, 168, 109, 168,  96, 170, 108,  96,  96, 108,
- 42,  96, 168, 168, 111,  96, 170,  42, 102, 108, 168,  42,  47, 111,  43,
- 42,  47, 170, 162,  99, 108, 109,  99, 102, 168,  96,  43, 111,  99,  99,
-111, 162, 108, 168, 170, 109, 111, 108,  42,  42, 255, 111,  99,  99, 162,
-168,  43, 108,  42, 170,  42,  96, 102,  42,  42, 170, 109, 111,  46,  47,
-108, 111,  43, 111,  96,  42, 170,  42,  96, 111, 102, 162,  96,  99,  42,
- 97, 168, 170, 162, 162, 102, 168, 111,  99,  42,  99, 102, 168, 168, 162,
-111, 109,  42, 168,  97,  42, 108,  42, 102, 168,  43,  96,  97, 111, 170,
- 96, 170, 111, 160, 162, 170, 108,  42, 108, 162, 168, 111,  43,  96,  97,
-170, 108, 109, 168,  96,  96,  46, 170, 168,  96,  96, 170, 111,  42, 170,
-108,  99, 111, 108, 162, 168,  99, 111,  97,  97, 168,  96,  42,  96, 108,
-102, 162,  42, 111,  99,  46, 168, 109, 170, 102, 109, 168, 168,  99,  99,
-162, 109, 170, 111,  46, 168, 111, 108,  97,  42, 109, 168,  42, 102, 170,
-160,  96,  97, 170,  43, 109,  99,  96,  42, 168, 168,  97, 168, 108, 111,
-108, 170, 168, 111,  99, 170, 102,  99,  42, 170, 109, 170,  96, 170,  43,
-102, 111,  96, 109, 108, 162, 168, 102, 109, 109, 170, 160, 168,  96,  46,
- 96, 109,  43, 170,  43, 111, 170, 168,  46,  42, 109, 109,  96, 168, 168,
- 99, 111, 102, 111,  97, 108, 111,  42, 162, 170,  42, 111,  96,  42, 109,
-108,  43, 102, 168,  43, 168, 102, 162, 111, 170, 168,  97, 109,  99, 108,
-168, 109, 108, 111,  42, 108,  96, 111, 111, 168, 111,  42,  96, 170, 170,
- 99,  97,  43,  43,  42, 170,  43, 108, 170,  43,  43,  42,  97,  42, 162,
-108,  43,  42, 111, 108,  42, 108,  46, 168, 102, 108, 170,  96, 108, 170,
- 97,  97, 168, 170, 111,  42, 108,  96,  96, 170, 109,  47,  99, 170, 170,
-108, 170, 109, 168, 108,  99,  42,  97,  43,  43,  99,  42,  46, 168, 102,
-168, 170,  99, 111, 162, 111, 111, 102,  43, 102,  46, 111,  99, 102,  99,
- 43, 108, 170, 162,  42,  47, 111,  96, 108,  97, 102,  96,  43, 109, 102,
- 42, 111, 111, 109,  97, 109, 111, 109, 162, 170, 168, 111,  97,  97,  97,
-109, 168,  43,  99, 168, 162, 168,  97, 168, 170, 108,  99, 109, 168, 108,
- 43, 111,  96, 162,  42, 111,  42, 162, 111,  46, 170,  99,  99, 162, 170,
- 42, 170, 111, 168, 111, 170, 168, 108,  99, 102, 170, 170,  96,  96,  42,
- 43, 111, 168,  42, 168, 168, 160, 170, 170, 102, 111, 111, 170,  43,  43,
- 42,  42, 108,  96, 111, 170,  43,  99, 162, 170, 102,  96, 109,  97, 170,
- 42,  42, 160, 168,  42, 109, 170,  96, 111, 170,  42, 168, 160, 102,  97,
-111,  43, 168,  42, 111,  42, 168, 109, 168, 168, 170, 111, 168, 109, 111,
- 99,  43,  96, 170,  43, 162, 168, 108,  96, 170, 108, 109, 111,  42, 162,
-160,  46, 170, 108, 162, 162,  42, 102,  97, 162,  43, 102, 162, 111,  47,
-108, 111, 109, 170,  97,  42, 111, 108, 108, 109, 109,  42, 111, 111, 170,
-170, 168,  96, 170, 111,  43, 108, 111, 109,  96, 170, 170,  99, 111, 168,
-109, 162,  46, 102, 168,  42,  43, 170,  42,  42,  96, 170, 108,  97,  99,
-168, 170, 109,  46, 168, 111,  96, 168,  43,  99, 111,  42, 102, 108, 109,
-170, 111,  99, 168, 102, 102,  42, 111,  42, 170, 108,  43, 162,  99, 108,
- 99,  99,  96, 109, 162,  96,  96,  43,  99, 168, 170,  46, 168, 109,  43,
-170,  99,  42,  97, 109, 102, 109, 170,  43,  46, 108, 109, 168, 111, 170,
-109, 102,  97,  43, 170, 168, 102,  97, 111, 168, 108, 170,  96, 170, 170,
-162,  43,  42,  96, 168,  43,  43, 168, 108,  97, 108,  47,  42, 109,  99,
-170,  42, 170, 168,  43,  42,  97, 162, 168, 109, 111,  96, 102, 162,  46,
- 42,  42, 168,  96, 168, 108, 102, 170, 170,  43, 160,  42,  97, 168, 108,
-108, 109, 170, 168, 111,  96,  43, 170,  99,  96,  97,  96,  42,  43, 111,
-111, 162, 108,  43, 111, 111, 109,  99, 102, 170, 109,  43, 170,  96,  42,
-168, 102, 168, 109, 102,  97, 168, 108, 170, 170,  43,  42, 168, 162, 162,
-111, 109, 168,  97,  97, 111, 162, 108, 170,  42,  97, 109, 168,  46, 111,
-162,  42, 102, 160, 102, 170, 162, 170,  42,  97, 162, 170, 111, 170,  43,
-109, 168, 111,  43,  43,  42, 170, 170,  42,  96,  99, 168, 111,  96, 109,
- 97, 162, 102,  96, 108, 111, 255, 108, 109,  43, 170, 109, 102,  43,  42,
- 42, 170,  96, 170,  42,  99, 109,  42,  97, 162, 102, 102, 162, 108, 162,
-170, 109, 102, 109,  99,  96,  99,  42, 160, 168, 109, 102,  96,  42, 168,
-102,  42, 170, 102, 111, 162, 162,  43,  97, 170, 102, 255, 109, 170,  42,
- 99, 108, 170,  97, 111,  97,  42, 102, 170, 111, 170,  42, 109,  46, 168,
-111,  43, 170,  43, 168, 102,  42, 170,  96, 109,  46,  42,  96, 102, 170,
- 99,  97, 168,  43,  46,  42,  42, 111,  42,  46, 109, 170,  99,  96,  43,
-109, 109,  43,  97, 170, 168,  97,  43, 102, 108,  97,  46, 170, 168, 102,
-109, 170,  96,  96, 168,  47, 102, 102,  42, 170, 170,  42,  47,  43, 162,
- 96,  97, 168, 109,  46,  96, 170, 111, 170, 168,  99, 111, 102, 102, 102,
-102, 168, 168,  97, 108, 170,  96, 102,  42, 111,  42, 168, 168, 162,  46,
-108, 108,  96,  42,  96, 162, 168, 108, 170, 170,  96, 109, 108,  96, 170,
-168, 168, 162,  42, 108,  97, 168, 162, 162, 111, 109,  42,  42, 170, 109,
- 43,  43, 111, 170, 102, 108,  97,  97, 109, 108, 111, 102,  97, 170,  97,
- 42,  97,  99, 102, 168, 108,  99, 170,  97, 170,  99,  97, 170, 170, 168,
-162, 111,  99,  47,  97, 109,  42,  42, 109, 109, 168, 109, 168, 109, 168,
-109, 162, 108, 102,  97, 168, 108, 102,  42, 108, 102, 168, 170,  97,  42,
-170,  47, 168,  46, 168,  42, 168, 162, 168,  96,  42,  97, 111,  42, 168,
-168, 108, 168,  42, 109, 168,  99, 170,  99,  42, 111,  97, 162,  42, 168,
-168,  97, 111, 168,  46, 102, 109, 102, 109, 170,  96, 108, 109, 255, 168,
- 99, 170, 102, 111, 109, 168, 168, 162, 111, 109, 108, 170, 160, 162,  42,
-102, 108,  97, 109,  43, 111, 162, 170, 111, 102,  42, 160,  42,  42, 170,
- 96,  42, 168, 109, 170, 170, 102,  46, 102, 109, 168, 109, 102, 108, 162,
-108,  43, 168,  42, 168, 162,  42,  42, 102,  97, 111, 102, 109,  96, 170,
-109, 170,  96,  46,  46,  97,  43, 170,  43, 168,  42, 162, 170,  96, 162,
-170, 109, 170,  43, 170, 109,  99, 170, 109, 170, 170,  43, 102,  43, 168,
-170,  96,  43, 162,  97,  99, 170,  96,  46, 109, 109, 168,  43,  96, 102,
- 97,  43, 170, 168, 111,  42, 109, 109,  43, 170,  97, 111, 162, 102, 168,
-109,  42, 102, 109,  96,  42,  42,  42, 109,  42, 102,  97, 111, 168, 162,
-108,  42, 102, 170,  42, 170, 170,  99, 109,  43, 162, 102,  97, 168, 168,
-102, 108, 170,  43, 102, 168, 255,  42,  46, 109, 170, 102, 168, 168,  96,
- 46, 162, 168,  46,  42, 170, 109, 111,  42, 111, 109,  42,  99,  42, 168,
-109,  43,  96,  97, 168,  42, 168, 168, 102,  96, 108, 102,  46, 168, 108,
- 99, 102, 170, 168, 109,  43, 170,  97, 108, 102, 170,  99, 109,  99, 109,
- 99, 170, 170,  97, 111, 168,  42,  43, 111, 109, 109, 168, 170, 168, 111,
- 99,  46,  99, 111, 108, 170,  42,  42,  96, 102, 108, 168,  43, 109, 102,
- 42,  42, 109, 109,  46,  97, 168, 111,  43, 102,  96, 109,  97,  97, 168,
- 97,  46,  46, 168,  96, 170, 102, 170,  42,  43,  99, 168,  42, 109,  46,
-109,  97,  96, 102,  97, 170, 170,  46, 170, 168, 109, 162,  96, 160,  43,
- 43,  42, 168, 168, 108,  42, 109, 160, 160, 109, 109, 168,  97, 111, 162,
-170,  46, 168,  43, 109,  42,  42,  97,  97,  96,  42,  96,  97,  97,  97,
-109, 162, 162,  97, 170, 170, 168,  42, 109,  99, 109, 170, 162, 170, 162,
-170, 170,  96, 162,  42,  97,  97,  43, 170, 109, 102, 168,  42, 109, 109,
-102, 108, 170, 170, 162,  42,  97, 102,  43,  42,  99,  99, 168, 170,  97,
-168, 102, 168,  97,  42, 168, 168,  43, 162, 111,  97,  47,  42, 108,  43,
-162,  42,  42,  47, 109, 170,  46, 111,  42, 162, 102, 168,  43, 160, 109,
-109, 162, 108,  46, 162, 109,  97, 108, 108,  42,  99, 109, 111, 102, 102,
-170, 109,  47,  97,  42,  42, 170, 168, 168,  42,  46, 109,  42,  99,  97,
- 42, 170, 102,  97, 168,  97, 102, 170, 170,  97, 168, 108, 168, 168,  42,
- 42,  97,  96, 168, 111, 170, 102, 170,  43, 170,  97, 102,  96, 111, 102,
- 97,  47, 168, 108, 102, 109, 109, 170, 102,  97,  99, 109, 170, 170,  42,
-168, 108,  42, 109, 102,  42,  43, 170,  97, 108, 109, 108,  43,  99, 170,
- 42, 168,  96,  42,  46, 109,  42, 109, 170, 109, 111, 170, 162, 170, 109,
-160,  47, 108, 109,  96, 102, 109, 109,  43, 162, 170, 170,  43, 109, 111,
- 43,  43,  97, 108, 109, 109, 109, 102, 109, 102, 109, 111,  42, 108,  42,
- 42, 168,  42, 102,  42,  42, 162, 168,  42, 168,  42,  42,  42, 102,  99,
-162, 102, 111, 168, 168,  42, 162, 162, 162,  97, 109, 170,  96,  96, 168,
-168,  99, 162, 102,  42,  97, 168, 170,  97, 102,  97,  97, 102, 170,  43,
-109,  42, 109, 108,  43, 170,  97,  42,  96, 168,  42,  43, 168,  46, 168,
- 99,  97,  42,  42, 162, 109, 102, 111, 108, 111, 170,  97,  42, 170, 111,
-109, 160, 170, 111, 109, 170, 168, 170,  99, 170,  42, 170,  43, 168,  42,
- 42, 168, 170,  97,  42,  43, 170,  47,  97, 160, 109,  43, 108,  42, 102,
-168, 102,  43,  97,  42,  97, 170, 162, 162, 108,  42, 170, 102,  46, 170,
-109, 109,  46,  97, 162, 109,  97,  42,  46,  42, 109,  42, 168, 102, 111,
-109, 108,  97, 160,  46, 170, 168,  97,  97, 168,  43, 109,  97, 109,  42,
- 46,  42, 109, 102, 108, 170, 102,  96, 170, 109, 162, 109,  97,  97,  42,
- 97, 111, 170, 170,  46, 170,  42,  47,  43,  99, 109,  46, 109,  96,  42,
- 43,  99,  96, 102,  42,  43,  43,  42, 168,  42, 109, 109, 111, 108,  42,
- 97,  97, 170,  42, 102, 168, 168, 170, 102, 168, 109,  43,  42,  42, 162,
-162, 108, 102, 168, 168, 108, 102, 109, 102,  42, 109, 162, 170,  46,  97,
- 43,  97,  96, 168,  97, 111,  97,  42, 102, 168, 168,  42, 109, 168, 170,
-168, 170, 102, 170, 111, 170, 109, 102,  43,  42, 170, 109, 109,  42, 170,
- 43, 109, 170, 170, 162, 102,  43, 102,  97,  42, 170, 168,  42,  43, 109,
-102,  42, 162, 168,  97, 168, 109, 168, 162,  43, 109, 109,  42, 111, 162,
-170, 102,  43,  42, 102, 168, 168, 170, 109, 109,  96, 102,  42, 162, 109,
- 42, 102, 109, 109, 170, 109,  47, 109, 170,  43, 111, 168, 162, 162, 111,
-102,  43, 109, 170, 168, 102,  97,  42,  42,  97,  43, 162, 168, 168, 102,
-170,  96, 170, 162,  46, 102,  97, 102, 102, 170, 162, 170,  43,  97, 168,
- 46, 111, 168, 170, 109, 170,  97, 170, 109,  42,  42,  43, 170,  42,  96,
-170,  43, 162, 162, 170,  96, 102, 160, 102,  97, 109, 162,  99,  42,  46,
- 42,  97, 109,  42,  97, 102, 168, 170, 168, 109, 170,  46,  43, 109,  97,
-102, 109, 109,  42, 162, 170, 102,  46,  97, 102,  97,  97,  42, 170, 162,
- 96,  46, 109, 162, 109, 109,  96,  43, 162,  43, 170,  43, 168, 168, 109,
-168,  43, 162, 170,  46,  46, 111, 102,  97,  42,  42, 109,  43, 102, 170,
-109, 168, 170, 170, 160, 102,  97,  97, 170, 109,  97, 109, 170, 168, 170,
- 46,  43, 162,  42, 168,  42, 102, 162,  47,  97, 168,  43,  42, 162, 108,
-109, 170,  99, 170, 102, 109,  46, 170, 168, 102,  46, 109, 111,  99,  99,
-170, 168, 170,  97,  43,  97,  43, 170,  43, 109,  42, 170, 109,  43, 168,
- 42, 102,  97, 168, 109,  42, 170,  42, 168,  46,  97, 168, 170, 168, 168,
-162,  43, 109, 109, 109, 168, 102,  42, 170, 109,  42,  43,  42, 168, 102,
-108,  97, 102, 102,  42, 102, 111, 109, 109, 162, 108,  42,  46,  97, 170,
-170, 168,  97, 102, 102, 102, 102,  43, 108,  46, 170, 109, 102, 168,  42,
- 42, 162, 168, 168, 170,  97, 109, 109,  42,  42, 102, 102, 102,  97, 168,
- 42, 168, 168, 170, 170, 168,  97, 168,  42, 168, 102,  42, 162,  43, 170,
- 43, 162, 170, 102, 109, 109, 102, 109,  42, 109,  97, 170, 102, 168,  97,
-162, 168, 168, 170, 162,  97, 109, 168, 109, 102,  97, 102, 170,  42, 102,
- 42, 109, 109, 168, 109, 109,  43,  42, 109,  97, 160,  96, 170, 162,  46,
-162, 168, 102, 168,  42, 160,  96,  97,  97, 170, 160, 109, 168, 109, 168,
-109, 168,  46, 109, 109, 109, 109,  42, 109,  42,  46, 170,  97,  97, 168,
-168, 170, 168, 170,  97,  97, 102,  47, 170, 168,  97,  97,  42, 162, 170,
-102,  43, 109, 102,  42, 170,  46, 170, 170,  97, 162, 109, 102,  99,  97,
-168, 109, 162, 170, 168,  97,  43,  46,  97,  42,  97,  43, 170, 170, 109,
-109,  97, 160, 109, 168, 170, 168, 168, 162, 111,  42, 102, 170, 102, 170,
- 43, 168, 102,  42, 168, 109, 170,  46, 102, 168, 170, 102, 102, 109,  42,
-102,  42, 109,  46,  97, 102, 102, 170, 102, 162,  47, 168,  42,  97,  97,
- 43, 109,  42, 102, 168,  97,  42, 168,  97,  42, 102, 170, 168, 109,  97,
-102, 109, 109, 162,  42, 168, 168,  42, 109,  42,  42,  42,  43, 168, 168,
-162, 102,  42,  47, 162,  42,  97, 162, 109,  43,  46, 109,  97, 109, 168,
- 43,  43,  97,  42, 168, 168, 170, 168, 170, 168, 109, 102,  97, 102, 102,
-102,  97, 102, 102, 160, 102, 170, 170, 162,  43,  46, 109, 162, 109, 109,
-102, 109, 170,  43, 170, 102,  42, 109,  97,  43, 102, 109,  97, 168,  97,
-102,  43, 102, 168,  42, 168, 170,  42,  42,  97, 170,  46, 168,  42,  97,
-109, 109, 170, 170,  42,  97, 168, 160,  97, 162, 170, 168,  97, 168, 109,
- 97, 109, 168, 109, 109,  97, 170,  97,  43, 102, 109, 109, 102, 109, 170,
-168,  42, 168, 170, 109,  97, 170,  43, 102,  43, 102, 168, 162, 170, 168,
-103, 170, 168,  42,  97, 168, 102,  43, 168, 109,  43,  42,  97,  42, 162,
-109, 109, 162,  97, 109,  97, 168, 102, 102, 109, 109,  97, 170, 109,  97,
- 42, 109,  42,  97, 168, 170,  43, 160,  42,  43,  97, 109, 170, 170,  97,
-168, 102, 109, 168,  42, 102, 102, 170,  97,  47, 102, 170, 170, 100, 109,
- 47,  42, 168, 109, 168, 168, 168,  97,  43, 109,  97, 168, 102,  42,  97,
-162, 102,  43, 162, 102,  43,  42, 171,  97, 109, 170, 102, 170,  97, 170,
-168, 168, 102,  97, 102, 170, 102, 102,  46, 109,  42, 162, 168, 168, 162,
-109, 168, 171,  97, 168, 170, 168,  43, 109,  40,  42, 109, 109, 102, 102,
-168, 109,  97,  97, 103, 170, 162, 103, 102, 109,  46, 109, 109, 100, 109,
- 97, 162, 109, 109, 162, 100, 102, 170, 102, 170, 168,  97,  97, 102, 170,
- 43,  43, 102, 109,  40,  97, 170, 162, 170, 109, 170, 168,  43, 162, 103,
- 42, 168,  40, 170, 109, 168, 170,  97,  42, 109,  97,  42,  43, 109,  42,
- 97, 168, 109,  97, 109, 109, 170,  43,  46, 168,  46,  42, 102,  97, 103,
-109, 170, 170, 109, 109, 170, 170,  43, 109,  42,  42, 109, 170, 109, 162,
-170, 109,  40, 168, 162, 102, 109,  47,  43, 170,  42,  46, 168,  42, 102,
-109, 100,  46,  97,  42, 162,  46, 170, 162,  42, 168,  47, 170, 102, 168,
-102, 170, 102,  97,  42, 109, 168,  47,  42,  47,  42, 109,  42,  43,  97,
-170,  43,  97,  97,  97, 102,  42, 162, 162, 170, 160, 170, 109,  42,  42,
-102, 102, 103,  46, 170,  43, 109, 102,  42,  43, 102,  40, 102, 162,  42,
- 97,  97, 109, 168, 109,  97, 109, 170, 168, 109,  42, 168, 168, 170, 162,
- 97, 109,  46,  42, 168,  46,  43, 102, 102,  42,  43, 102, 109,  42,  97,
-170,  42,  97, 168,  47, 170, 168,  97,  42, 170, 109, 162, 109, 109,  42,
-168, 170, 168, 168,  97, 102, 171, 160, 103, 102, 170, 168,  43,  97,  97,
-170, 162, 168, 109, 170, 168, 100, 162,  42, 168, 168, 168, 162, 170,  97,
-109, 109, 102, 102, 168, 109,  97, 170, 102, 102,  46,  43, 102, 102, 168,
- 42, 102, 102, 168, 102, 109,  40, 103, 170,  42,  42, 168, 102, 171,  46,
- 97, 109, 168, 109,  42,  43, 170, 162, 170, 109, 162, 170, 102, 168, 102,
-168, 171, 168, 102,  43,  97, 102,  46,  43,  40,  97, 102, 168, 100, 170,
-109, 109,  97,  42, 170,  43, 109, 109, 170,  43,  43, 168, 102, 109, 102,
-109, 102,  42, 109,  42, 170, 170, 171,  97, 109, 170,  43, 109, 171, 168,
-168, 102, 109, 109, 109,  97,  43, 109, 109, 102, 170, 170, 170,  97,  42,
- 97,  42, 109, 162, 109, 100, 171, 168, 109, 168,  97, 162,  42, 168, 170,
-109, 168, 109, 102, 168, 102, 168,  43, 170, 109,  42,  42, 109,  43, 109,
-168, 168,  40, 168, 168, 109,  43, 102,  42, 168, 102, 102,  42,  42,  97,
-102, 170,  43,  97,  46, 168, 171, 168, 170, 100, 170,  43,  42,  46, 102,
- 47, 102, 109,  97,  42,  42,  46, 109, 109, 109, 109, 168, 168, 170, 162,
-162,  97, 168,  97,  43, 162, 168,  97,  42, 109, 102,  43, 103,  97, 103,
-170,  40,  97, 168, 109, 171, 109, 170, 109, 100, 171,  42,  97, 109, 168,
- 46, 170,  43, 102,  42,  97, 162,  97, 168, 109,  97,  46, 170,  47,  42,
- 42,  42, 100, 168,  43, 102, 162, 102, 168, 168, 100,  97,  97, 168, 102,
- 97,  46,  42, 109,  47, 109, 168,  42, 109, 170,  42,  43, 168,  43, 171,
- 46, 170, 102, 109, 109,  47, 168,  46, 170, 168, 109,  97, 162, 168,  97,
-168,  43, 109, 109, 162,  42, 109,  40, 102, 160,  40, 102,  40, 168, 171,
-170,  47,  42,  97, 103,  46,  97, 170, 171,  97, 102, 162, 168,  97, 109,
-100, 168,  43, 170, 102,  97, 100,  42,  42, 103,  42,  97,  42, 170, 109,
- 43, 170, 160, 168,  42, 168, 109, 168, 109, 168,  43, 168, 170,  40, 109,
- 42, 100, 102,  40,  97, 170, 162, 168, 102,  42,  40,  42, 109,  43,  46,
-103, 160, 168, 170,  43, 162, 162, 102,  43,  40, 168, 162,  46, 109,  97,
-170,  97, 170,  40, 168, 168,  43, 102,  42, 102,  97, 102,  42, 102, 171,
- 97,  47, 102, 103,  97, 168, 170,  97, 109, 168, 102,  46,  40, 162, 162,
-109,  46, 162,  43, 103, 109, 103, 168, 171, 168, 162, 109, 109, 100,  43,
-102,  43, 109, 102,  46,  97,  43, 171, 102, 102, 109,  42, 170,  43,  40,
-168, 162, 109, 168,  97, 162, 168, 162,  46,  46, 170, 109, 168, 109, 102,
-168,  42, 109, 171, 170,  42, 100,  42, 109,  97,  43, 109, 168, 170,  97,
- 42, 168,  97,  40, 102, 168, 109,  97,  43,  40, 168, 255, 102, 170, 109,
-168,  97,  46,  43, 162, 102, 170,  97, 255,  97, 170, 102,  97,  47,  43,
-162, 168, 168, 109,  40, 162, 170, 109, 103, 103, 168, 168, 162,  97,  42,
-170,  42, 168, 102,  46, 168, 170, 168,  97, 100,  42,  42, 171, 103, 168,
-171,  97, 170,  43,  40,  47, 102, 100,  46, 168, 168, 168, 170,  43, 102,
-168,  42,  42, 170, 162, 103,  46, 102,  97, 170, 100, 103,  43, 170, 168,
-100, 162, 171, 162, 168, 168,  40,  47, 109, 162, 102, 162, 109, 162, 109,
-100,  42, 162,  97, 168,  47, 170,  97,  97,  97, 168, 171,  40,  42,  43,
- 43, 168,  97, 168, 109, 162,  97, 109,  97, 109,  42, 102, 103, 162, 102,
-100,  97, 168, 168,  42, 168, 170, 168,  43, 162, 170,  97, 170, 109,  43,
- 43,  97, 170,  46,  46, 103, 168, 170,  40, 170, 103,  97,  46, 168, 168,
-171, 168, 168,  42,  43, 168, 168, 168,  43, 102, 109,  43,  43, 100,  46,
-168, 103,  42, 109, 168,  40,  97,  42, 109,  43, 100, 109, 170, 102,  42,
-109, 170, 170,  40,  40, 170,  40, 168,  43, 109,  46,  42, 102,  43, 103,
-109,  46, 170, 102, 100, 170,  42, 109, 168, 102, 109,  42, 171, 170,  97,
- 42, 102, 100, 102, 168, 162, 100,  46,  43,  42,  46, 170, 170, 102, 171,
-170, 103, 162, 109,  40,  42,  42, 109, 102, 162, 103, 102, 162,  42,  42,
-103, 102, 171,  97,  97, 168, 102,  42,  43, 170, 100,  42, 170, 168, 170,
- 40,  42,  40,  42, 168,  42, 162, 170,  97, 102,  43, 109, 160,  42, 102,
-103, 100, 168,  97, 168, 109, 170, 162, 102, 168, 168,  43,  46,  42,  40,
-168,  97, 102, 168, 168,  40, 168,  43, 170,  47, 170, 102, 102, 168, 168,
-171, 171,  42, 102, 102, 102, 170, 171,  42,  97, 109, 109,  40, 168, 168,
-162,  43, 102, 170, 171, 162, 170, 109,  42, 100, 168, 171,  97,  43,  40,
-170,  42, 162, 160, 109, 170, 100, 102, 171, 168, 171, 171, 162, 109, 102,
-170, 102, 109,  43, 162, 162,  97, 168,  43,  43, 170,  42, 109, 109, 109,
-103,  42, 170, 109, 162,  42,  42, 168, 170,  97, 100, 170,  43, 102,  42,
-103, 109, 168,  42,  42, 171, 102, 170, 109, 162, 160,  42, 171,  97, 162,
-168, 170, 109, 100, 168, 102,  97, 168, 100, 109, 162,  42,  97, 103, 162,
-100, 109, 168, 103, 171, 102,  40, 171, 162, 103, 168, 109, 162, 103,  97,
- 43, 100, 109, 100,  42,  43, 168, 103, 168,  46,  40,  40, 109, 170,  46,
-171, 162,  46,  40, 170,  42,  40,  97,  97,  42, 170, 109, 170, 168, 162,
-171, 109,  46,  40,  42, 103, 168, 103, 103, 170, 100, 168, 109, 162,  46,
-102, 168,  40, 171,  40,  42,  42,  42, 171, 109,  43,  42, 171, 170, 109,
-170, 168, 109, 109, 102, 170,  40,  43, 109, 160, 171,  42, 102, 170,  40,
- 40,  43,  43, 170, 162, 171, 168, 168,  42, 102, 168, 171, 171, 168, 102,
-109, 102,  97, 103,  43,  97,  43,  40, 109,  43, 102, 103,  97,  97, 100,
- 46, 103, 109, 168, 171, 109, 162, 109,  97,  43, 100, 168,  47, 162, 162,
- 43, 109, 109, 168, 109, 168, 103,  42,  40,  43, 103,  42,  43, 102, 170,
-168,  42,  97, 171, 100,  43, 170, 168, 109, 170, 103,  40, 168, 171,  97,
- 97,  40, 160, 103, 168, 168, 170, 171, 168, 109, 170, 168, 100,  40,  97,
-109, 168, 171,  97, 162, 170,  40, 102, 171, 168,  43, 102,  40,  42, 162,
-102,  97, 103, 109,  97,  46, 102, 109, 103,  42,  46, 162,  47,  46,  43,
- 43, 100, 109, 160, 170,  47, 168,  40,  43,  43,  97,  97,  43, 171,  42,
-170, 102, 100, 171,  46,  42, 109, 171, 162, 100,  42, 170, 171, 170, 160,
-168, 103, 162,  97, 168,  40, 103, 162, 102,  42,  43,  43, 168, 171, 162,
-102, 103, 162, 162, 170,  43,  43,  42, 100, 168, 170, 162,  46, 170, 171,
- 46, 168,  97, 160, 109, 109, 171, 168, 168,  40, 162, 168,  46, 168, 162,
- 97, 168, 109, 109,  46,  40, 171, 162,  42, 168,  43, 171, 160, 168, 109,
-102, 170,  42, 162,  43, 170, 170, 168, 170, 168, 103, 170, 100, 170,  97,
-109, 100,  97, 100,  42, 103, 102, 103, 109,  97, 168, 109,  42, 168, 102,
- 47, 168, 168, 103,  97, 170,  40,  46,  46,  43, 100, 100, 100, 109, 162,
- 43,  42, 102,  97,  43,  97, 162,  42, 171,  43, 109, 162,  43, 168, 168,
-100,  42, 171, 170,  42,  46, 109, 171, 109, 162, 162,  43, 103,  42, 100,
-170, 100, 162,  40, 171, 162, 103,  42, 102, 102, 168,  40, 109, 168, 102,
-168, 162, 168, 109,  43, 109, 109,  46, 103, 168,  97,  43,  43, 102,  97,
- 97, 170, 168, 168, 100, 171, 168, 160, 168,  46,  40,  40, 170, 168, 168,
-168, 109, 103,  40, 162, 168, 171,  40, 100, 103,  97, 103,  42,  40,  40,
-168, 162,  42,  40, 162, 160,  43,  43, 160,  42, 102, 102, 171, 170, 168,
-168, 171,  40, 103,  47, 100, 170,  42, 168, 170, 103, 168,  97, 162, 168,
-103,  40,  40, 100,  46, 168, 168, 103,  42,  46, 102,  43, 100, 168,  40,
-103, 168,  40, 103,  40,  43, 102, 168, 102, 168, 102, 103, 162,  40, 162,
-168, 102, 171, 168, 162, 171, 100, 109, 168, 109, 168, 168, 168, 162, 103,
- 43, 171, 168,  97, 170, 168,  97, 168, 170,  42, 168,  46,  40, 100,  97,
-160, 109, 102,  42, 109, 168, 102, 168,  43,  40,  46, 160,  40, 100, 162,
- 97,  46,  40,  43, 171, 171, 168, 170, 102,  42, 168,  42,  40, 160, 160,
- 43, 170, 171, 109, 103, 100, 109, 162, 100, 160, 102, 162, 100,  42,  97,
-170,  40,  43,  43, 170, 168,  40,  43,  97,  42,  97, 168, 170, 162,  42,
-109,  40, 109, 109, 100, 162, 168, 100, 170,  46, 103, 100,  46, 168, 168,
- 43, 100,  40, 103, 102, 171,  40, 171,  43, 100,  46,  97, 102,  97, 109,
-168, 100,  40, 160, 102, 109, 171, 170, 170, 103, 162, 100, 109,  46, 168,
- 43, 109,  43, 170, 171, 170,  43, 103, 171,  43, 168,  40, 168,  97, 168,
-162, 168,  40, 100,  97, 109,  43, 102,  43, 162, 100, 103,  42, 160, 168,
- 42, 168,  42,  97,  97, 109, 102, 171, 168, 100, 100, 109, 171, 109, 170,
-109,  46,  40, 168,  42,  40, 168,  40, 100, 255, 103, 109,  47, 109,  42,
- 42,  42, 102, 103,  43,  43,  46,  46, 171, 109, 109, 171, 103, 162, 170,
-171,  42, 103, 162, 171, 103,  97,  43,  97,  40, 171,  97, 162,  43,  40,
- 46, 171, 168,  43,  97,  40, 170, 171,  42, 103, 162, 162, 168, 100, 162,
-168, 168, 171,  40,  46, 171, 100, 170, 102, 103, 171, 162,  40, 171, 103,
- 40,  42, 168, 100,  43, 170, 102, 109,  40, 168,  42, 168, 103, 102, 100,
-168, 100, 162, 168, 168,  42,  97, 168, 103, 162, 103, 162, 170, 168, 170,
-100,  40, 170, 103, 171, 100, 168, 100, 171, 103, 103, 100,  46, 170,  46,
-102, 102,  40,  40, 171,  42, 100,  40,  40, 168,  43, 109, 171,  42, 103,
-109,  40, 103,  40, 109, 168, 103, 162, 109,  46, 171,  43, 168, 100, 170,
- 97, 170,  40, 100, 171, 162, 109, 103,  40,  43, 162, 168,  40,  97,  40,
-162, 171, 109, 162, 109, 168, 168,  46, 100, 100,  40, 168,  97, 170, 103,
- 40,  42, 103, 168, 168,  46,  40,  40, 168,  97,  40, 168,  40, 162, 162,
-168, 109, 168,  97, 109, 109, 162, 162, 102,  47, 162, 171,  47, 100, 109,
- 47, 168, 109, 171, 171, 103, 168, 168, 171, 109,  42,  43,  47, 103,  43,
-162, 162, 102, 162, 171, 102,  40, 168,  40,  42, 168, 162, 100,  43,  40,
- 42, 162, 170, 103, 109, 171,  42,  40, 168, 171, 171,  43,  46, 103,  42,
-160,  47, 109,  42,  46, 103, 162,  46, 109, 162,  97, 109, 100, 102, 100,
- 43, 162,  43, 170, 100, 100, 162, 103,  42, 168,  40, 100, 102,  43, 103,
-168,  40,  43,  40, 168,  97, 162,  46,  43, 170,  40, 100,  46,  43, 162,
- 40, 162,  43,  42, 171, 100, 162, 162,  43,  40,  42, 109, 171,  40, 171,
-162, 162, 100, 171,  40, 168,  40, 162, 170, 160, 162, 102, 170, 168, 100,
-168,  43,  97, 162, 162, 168, 103,  97,  42, 102, 171, 102, 168,  97, 100,
-102, 171,  97, 162, 171, 168,  40, 168, 168, 109, 170, 102, 160,  43, 171,
-170,  43,  40,  42, 171, 100,  43, 171, 162,  43,  43, 168, 171, 171,  43,
- 43,  43, 103,  43,  46, 171, 170, 160, 171,  40, 103, 168, 168,  40,  40,
-168, 160, 170, 168, 162, 100,  43,  42, 100,  46,  40,  43,  43,  97,  40,
-100,  43, 168, 100,  43, 171,  47,  97, 100,  40, 103,  47, 171,  40, 170,
-103, 171, 160, 162, 109,  47,  97, 103, 171, 170,  97, 162, 109, 168, 168,
-162, 103, 168,  43, 109, 171,  43,  97, 168, 102, 103, 168, 170,  47,  46,
-103, 168, 162,  46, 168, 171,  43, 170, 100,  43, 160,  40,  42, 102,  42,
-171,  40, 103, 103, 170, 168,  40, 162, 171, 103,  43, 103, 103,  46, 160,
-103, 103, 170, 171,  43, 170, 162,  40, 100, 168, 171, 100, 109, 168, 168,
- 97, 103, 103,  46,  42, 162, 100, 100, 103, 168,  46, 168, 162,  97, 168,
- 43, 168,  43, 160,  43, 103, 168,  40,  40, 168, 100, 109, 168, 171, 103,
-103,  43, 170,  43,  40,  46,  40, 109, 171,  46, 168,  40,  40, 103, 102,
-162,  43, 171,  42,  46, 109, 109,  42, 168, 109,  40, 109,  43, 100, 171,
- 42,  40,  42,  40, 109, 162, 170, 103,  97, 103, 103, 100, 109,  43, 102,
-103, 171, 102, 171, 171,  43, 103,  40, 100, 103, 171, 100,  43, 109, 162,
- 43,  43, 168, 168, 100, 162, 168, 170, 103, 171, 168,  40,  40, 100,  97,
-171, 171, 168,  40, 100, 170, 109, 170, 102,  43, 162,  40,  43, 100,  42,
-109, 171,  43,  40, 109,  43, 170, 103, 162,  40, 109,  46, 168, 103, 171,
- 43,  47,  43, 162,  40, 100,  43, 168, 162,  40, 171, 162,  43, 168,  42,
-109, 162, 162, 100,  40,  40, 103, 162, 162,  43, 109, 103,  40,  42,  42,
- 43, 168, 168, 171, 162, 100, 162,  42,  43, 168, 100,  47,  43,  46,  40,
-100,  43,  40, 171, 100, 168, 100, 171, 168, 162,  40, 168, 103, 170, 168,
-171, 160,  40,  43,  97, 168,  43,  40,  42, 168, 102,  42, 100, 168, 168,
-103,  40, 171,  40, 103, 168, 168, 171,  40,  97, 103,  40, 170, 103, 103,
- 43, 160, 100, 100, 103,  40,  40, 168, 103, 103, 102,  46, 171, 100, 103,
-100, 171, 171, 102, 162, 171, 100, 162, 103,  40, 171,  40,  40, 171,  40,
-102,  97, 168, 103, 103, 171, 162, 168, 168, 103, 162,  43,  47, 100, 162,
-168, 171,  40, 103, 170, 162, 109, 162,  40, 100,  40,  43, 168, 168, 103,
-162,  40,  40, 103, 100, 162,  40, 168,  40,  40, 171, 162, 162, 100,  43,
-100,  43, 162,  40,  40, 100,  43, 171, 162, 162,  46, 162,  40,  46,  40,
-103,  46,  40, 103, 103, 162, 170, 170,  43,  40, 162, 102,  43, 160, 171,
-103, 162,  46, 168, 162,  43, 103,  46, 103,  47,  46, 168, 103,  46, 109,
- 46, 171,  42, 160, 100,  40,  46, 168, 100,  43, 103, 100, 170, 102, 162,
-109, 100, 170,  40, 168, 109,  42, 171, 100, 168,  46, 171, 171, 168, 170,
-162,  97, 168, 171, 103, 103, 103, 100, 162, 171,  46,  97, 168, 162,  40,
-103, 100,  40, 162, 103, 103, 103, 100,  46, 171, 109, 168, 168,  40, 168,
-103,  43, 100, 103,  46,  43, 168, 171,  42,  43, 168, 171, 100,  40, 168,
- 42, 162, 162, 100, 171,  40, 171, 171, 162,  43, 170,  40, 170, 168,  40,
-168, 162,  42, 100, 171,  46, 162, 168,  46, 109,  40, 171, 103, 170, 160,
-171, 162, 171, 168,  40,  43, 162,  40,  97,  46, 168, 162,  40, 162,  43,
-109, 100, 103, 162,  42,  40, 171, 103, 103,  43, 170, 171,  40,  97, 103,
-109,  46, 168, 171,  46,  40, 102,  43, 171, 103, 168,  40,  40, 171, 168,
-168,  42, 171, 168,  40, 103, 168,  40,  43, 170,  43,  42, 100, 168, 162,
-100, 162, 171, 102, 100, 103, 103, 162, 100, 171,  40,  40, 168, 103,  40,
-100,  40,  40, 171, 103, 109, 171, 171, 162, 162, 168, 102, 103, 103, 171,
-100, 171,  42,  40, 171, 100, 162, 162,  40,  40,  97,  43, 103,  43,  97,
- 43, 171,  46, 100, 100,  47, 171,  46, 168, 162,  43, 168, 103, 103, 162,
- 40,  43, 103,  40,  40, 103, 100, 160, 168, 109, 168,  40, 162, 109,  43,
-100, 171, 171, 100, 168, 171, 168, 162,  40, 100, 103, 162,  43, 100, 171,
-168,  43,  43, 171, 162,  40,  43, 100, 171, 103, 100,  46, 168, 171,  43,
- 43, 162, 168,  40, 100,  40, 171,  40, 170, 103, 103, 168, 103,  40, 100,
-103, 100,  47, 103,  42, 102, 103, 100, 109,  40, 109,  40, 168, 171,  97,
-109, 103, 168, 168, 160,  43,  40, 168,  43, 100,  43, 171, 171, 162, 162,
-168, 170, 162,  43, 168, 168, 168, 100, 162, 168,  42,  40, 100, 162, 100,
-171, 103, 168, 171, 170, 103, 102,  43, 171, 171,  40, 100, 100, 168, 100,
- 47, 109, 103, 109,  40, 100, 168, 168, 168,  43, 168, 168, 103, 103,  47,
- 40, 162, 170, 162,  43,  46, 171, 103, 168, 162,  40, 171, 103,  40, 162,
-100, 171, 100,  46,  46, 171,  40, 168, 171, 171,  43,  40,  43,  40, 171,
-168,  40,  43, 100,  43,  43,  40,  40, 160,  40, 160,  46, 171,  40, 100,
-168, 171,  43, 100, 162, 100, 171,  40, 102,  40,  43,  46, 168, 168,  47,
-103, 100, 162, 168, 103,  40, 103, 168, 162, 103,  40, 171, 170, 162,  97,
-168, 171, 103,  40, 103, 109, 168,  46,  40, 102,  43, 103, 168,  43, 168,
-171, 168, 162,  43, 168,  43,  40,  40, 171, 171,  46, 100, 100,  40, 103,
-171,  46,  46, 103, 171, 100,  40, 103, 162,  40, 100, 171,  43, 100, 168,
- 43, 168, 100, 100, 168, 103,  40, 171, 103, 162, 170,  46, 162, 103, 103,
-162,  40, 171, 171, 168, 100, 162,  47,  40, 171, 100, 255,  40, 103,  40,
-103, 100, 171, 103, 168, 162,  40, 103, 162, 103, 100,  46,  40, 170, 168,
- 47,  43, 162, 103, 103, 160, 171, 171,  46, 162,  40, 168, 171, 162,  40,
-171, 162,  40,  46, 100,  40,  46, 162, 162, 168,  43, 171,  40, 100, 162,
-103, 171,  43, 160,  40, 168, 103, 103,  40, 171, 162, 171, 162,  43, 100,
- 40,  43, 100,  40, 103,  43, 103, 162,  40,  40,  40, 100, 100, 100, 103,
-162, 100,  40, 171,  40, 103,  40, 171,  43,  43, 103,  40, 168, 168, 171,
- 40, 171,  47, 168, 171,  40,  40,  43,  43, 168, 100, 162, 171, 102,  46,
-168, 103,  40, 171, 168,  43, 168, 103, 162, 168, 162, 103, 103,  43, 168,
-171, 171, 168,  43, 103, 171,  40,  46, 100,  40, 162, 103, 100, 168, 100,
-168,  43, 103, 168, 162, 103, 103, 162,  40, 100, 103, 171,  43,  46, 168,
-171, 168,  40, 103,  40, 100, 103, 171, 171,  42, 171, 171, 168, 168,  40,
-162,  43,  40,  40, 103, 171, 100, 162,  40,  43, 162,  46,  40, 160,  40,
-162, 162, 168,  40,  40, 103, 103, 103,  43,  40, 103, 160, 100,  46,  43,
- 43, 162, 162,  40, 162, 103,  40, 162, 162, 162, 162, 162, 171, 171, 102,
-103, 103,  43, 103,  40, 168, 100,  46, 168, 168,  43, 100,  43,  43, 168,
-162, 171, 100, 171,  97, 168, 168,  40, 100,  46, 162, 103, 103, 162, 171,
-168, 100, 168,  43, 168, 168, 168, 171,  47, 171, 171, 168, 160, 171,  40,
-171, 103,  40,  46, 103, 100,  40, 168, 168,  40, 100,  46, 171, 162, 100,
-171, 171, 103,  40, 103, 103, 100, 168,  46, 103,  43, 171, 103,  46,  47,
-160, 171, 103,  40, 168, 168, 103, 168, 160, 103, 162,  43, 100, 162, 100,
-171, 168,  40,  43,  40, 171, 171, 103, 168,  40, 160, 162, 100, 168, 168,
-162, 171, 103,  40,  40,  43, 168, 162,  40, 162, 103, 168,  43, 162, 162,
-171, 103, 100,  40, 103,  40,  46, 168, 171,  47, 100,  40, 171, 103, 171,
-162,  40, 100, 100, 174,  40, 103, 171,  40, 100,  43, 171,  40,  40, 100,
-100, 168, 171, 100,  40,  40,  43,  40, 103, 100,  43,  41, 168,  40, 103,
-169, 100, 100, 162, 103,  43, 162,  46, 100, 169, 168, 168,  43, 168, 171,
-162,  46, 171, 103,  46, 168,  40, 168, 168,  40, 171, 168, 100, 100, 103,
- 40, 162, 100, 168, 168, 171, 100, 160, 162,  40, 103, 171, 168, 171,  41,
-100, 168, 103,  40,  43, 162, 100, 103,  40, 103, 162,  46, 162, 168, 171,
-100, 171,  40, 100, 171,  46, 169, 168, 160, 100, 103,  40, 162, 162, 171,
-162, 100, 168, 103,  46, 168,  46,  46, 162, 100,  40, 168,  40,  41,  40,
-100, 171, 168,  40,  43, 162,  40,  40,  40, 162, 171, 162, 162,  41,  43,
-171,  43,  46, 171, 100, 171, 103, 103, 168, 160, 168, 103,  40,  40,  47,
-168, 100, 103, 100,  40, 103,  40,  43,  40,  43,  40,  40, 168, 171,  40,
- 43, 100, 103,  43, 171, 162, 168, 100, 100, 171, 100, 171, 168, 174, 162,
-168,  46,  40, 171, 162,  41, 160,  40, 103, 174, 100,  43,  40, 171, 171,
-168, 160,  43, 171,  43, 160, 168,  40,  40, 171,  43, 100, 103,  43, 103,
- 40, 168, 100, 103, 169, 103, 100, 162, 100, 171,  40,  40, 103, 171,  40,
-171,  43, 162, 162,  43, 162, 168, 171,  46, 103, 171, 162,  40, 171, 162,
- 46,  41, 103,  40, 103, 162, 171, 162, 103, 103,  40, 103,  43, 162, 103,
- 34,  43, 168, 168, 103,  43,  40,  41, 103, 162,  43,  47,  43,  40,  40,
- 46, 160, 101,  43,  43, 103,  41,  47, 100, 169, 103, 160, 169,  43, 168,
-162, 171, 101,  41,  43,  43, 100,  40, 103, 171, 168, 103, 103,  40, 168,
- 40, 100, 103,  43, 171, 162, 100,  40, 100,  43, 100, 168,  40, 171,  40,
-171, 162, 168, 103,  40, 168, 100, 100,  40, 101, 100,  47, 100, 162, 171,
-171, 103,  40,  40, 168,  40,  41,  43,  46,  43, 100, 100,  47, 168,  46,
-103,  41, 103, 171, 103, 103, 169,  40, 162,  46, 100, 171, 171, 103,  40,
-162,  40,  40, 103, 162,  40, 103, 171, 100,  41, 171, 162, 103, 168, 171,
- 40, 103,  34,  40, 171, 103,  40, 169,  46,  46,  40, 100,  40, 171,  40,
- 43,  40, 169,  40, 100, 100,  40, 171, 160, 100, 171, 103,  40, 103,  43,
-168, 171, 171, 162, 171, 100,  40,  47, 100, 100,  43, 162, 168, 100,  41,
-103, 171, 100,  34, 103,  43, 162,  40, 101, 101, 168, 171,  40, 171,  43,
-169,  40, 100, 171,  40, 171, 168, 101,  40, 100,  34, 168, 162,  47,  40,
- 40, 169, 100,  34, 162,  43, 168,  43, 162, 162,  43,  47,  40,  46,  40,
-168, 101, 103,  47, 171,  40,  40,  34, 171, 103, 171, 171, 162, 168,  46,
-171, 103, 171, 168,  40, 168,  40,  43, 103,  46, 162, 160,  40, 162, 171,
- 40,  34,  46, 100, 171, 171, 171, 169, 171, 103, 103, 169, 103, 171, 168,
- 46, 103, 168, 162,  40,  43,  40, 168, 100, 103, 171, 103, 169,  43, 103,
-100, 168,  40, 100, 168, 162,  46, 162,  40,  40, 101,  46,  41, 171,  41,
-100, 168,  40, 100, 171,  41, 171,  40, 103, 162,  43, 103, 103, 171, 103,
- 40, 171, 100, 168, 168,  43, 171, 171, 162, 174, 162,  40,  43,  41, 169,
-171, 103,  43,  40, 100,  40,  43,  47, 171, 100, 162, 162, 162,  41,  34,
-100,  40, 100, 168,  40, 169,  43, 103, 255,  40,  46, 162, 103, 168, 168,
-174,  41, 171, 162, 162, 171,  40,  43,  40, 103, 100, 171,  34,  40, 171,
-168,  40, 162, 168, 100,  41, 162, 171, 100, 100, 171, 101, 101, 168, 171,
-162, 168, 162,  40, 162, 100, 168,  47, 171,  46, 162, 169, 103, 171,  40,
- 46, 171, 162, 168, 162, 162, 168, 171,  46,  40, 168, 100, 103, 103,  43,
- 40, 103, 100,  41,  43, 162,  46, 171,  40,  34,  40, 100, 160, 168,  40,
-100, 103,  40, 168, 169, 162, 103, 160,  40,  43, 103, 168, 168,  43, 162,
-168, 100, 100, 162, 100,  40,  40,  41, 100, 171,  41, 103,  40,  34, 171,
- 40, 162, 162, 162,  43, 162, 100, 101, 100,  40, 103,  41, 168, 101, 162,
-169, 100, 169, 171, 171,  41, 168,  40, 103,  40, 103, 169, 168,  46, 100,
-160, 103, 103, 100,  40, 103, 168,  40, 162, 168,  34,  47,  41, 101,  41,
-100, 162, 162, 162, 171, 171, 162,  40, 160,  43, 171, 100, 168, 168,  46,
- 40,  40,  40, 162, 103, 100, 162, 160,  41,  40,  46, 162,  40,  46,  43,
- 43, 100, 160, 101, 168, 160, 162,  40,  43, 171,  41,  40, 174,  41, 103,
- 34, 162, 169,  46,  47,  40,  41,  34,  47,  34,  34, 171, 174, 169,  43,
- 43, 168, 169,  43, 171, 103, 103, 171, 100, 171,  34,  43, 162, 162, 174,
-162, 162, 162, 160, 168, 169, 103, 100, 100, 174,  40, 171,  40,  40, 100,
-171, 168,  40, 162,  46,  40, 171, 162, 103,  46,  40, 100, 168, 169,  41,
-160,  43, 169, 162, 171, 171,  43,  40, 103,  43, 162,  47,  34, 162, 162,
-162, 171, 171,  46, 168, 171, 171, 169, 100,  41, 103, 160,  43,  34,  47,
-174, 100, 169, 169, 162, 100, 162, 160, 171, 174, 168, 168, 160, 103, 171,
-171, 162, 168,  34,  41, 103, 100, 103, 100, 100, 171,  41, 174, 162, 103,
-101, 103, 169,  43, 100, 103,  43,  47,  41, 162, 169, 168, 160, 100, 168,
- 40,  40,  46, 101, 162, 103,  40,  40,  41, 169,  40, 171, 169,  40, 160,
-162, 169, 101, 174, 171, 101, 169,  41,  47, 162, 162, 103, 168,  34, 171,
-171, 101, 171, 162, 100,  40,  40,  41,  43,  46, 103, 162, 162, 103,  40,
- 40, 100, 171,  47, 162,  41,  40,  40, 169,  40, 162, 160,  41, 162,  40,
- 34, 171, 169, 174,  46, 100, 103, 101, 168, 169, 168, 100, 101,  43, 100,
- 40,  41, 171,  43, 171,  40, 103,  40, 103, 162,  43, 162, 171,  43, 169,
- 41,  40, 171, 162,  40, 169,  43, 174,  41,  41,  34, 168, 169,  41, 103,
-162, 171, 169, 168,  34, 171, 100, 171, 171,  40, 162,  40, 100, 100, 103,
-162, 103, 162, 162,  40,  34,  40, 100, 103, 169, 103, 169, 100,  46, 103,
-168, 174,  40, 171, 100,  43,  34, 169, 103,  40, 169, 169,  46, 168, 100,
- 43, 171, 169, 162, 169,  34,  41, 171, 162, 162, 168, 169, 169,  47,  46,
- 43,  43,  43,  46, 169,  40, 171, 103,  40, 103,  46, 100,  43,  43, 100,
-171, 168,  34, 103,  41,  40,  41, 160, 100,  41,  46,  46, 100, 174, 162,
-101, 168,  47,  40, 168, 174, 162, 100,  46,  40, 174,  40,  40, 162, 171,
-162, 169, 103, 168, 100, 100, 171, 100, 168,  40, 171,  34,  40, 171, 103,
- 46,  40, 100, 100, 171,  46, 101,  40, 101, 255,  34, 101, 100, 174,  40,
- 41, 168, 100, 162, 100, 162,  46, 168,  43, 103, 103,  41, 160, 162,  46,
- 40, 168, 100, 169, 171, 103, 168, 100, 169, 169, 103, 169, 174, 171, 169,
-169, 162, 103, 169,  46, 169, 169,  34,  46,  47, 169, 103, 162,  40, 100,
-171,  46,  34, 171, 100, 100, 160,  41, 103, 162, 103,  40, 101, 171,  40,
-103,  34,  34,  41, 169, 171,  46, 168, 100, 174, 169, 100, 103,  40, 100,
-168,  40, 100, 168,  40, 169, 171,  41,  41, 171, 103, 171, 168,  40, 169,
-103, 103, 169, 168, 162,  40, 171, 162, 100,  41,  40,  46, 160, 103, 168,
-169,  40, 169, 171, 162, 162, 162, 162, 162, 100,  41, 101,  40, 103,  43,
- 47, 101, 162, 162,  40,  40, 103, 171, 168, 171, 103, 162, 160, 171,  40,
-162,  43, 162, 103, 168, 169, 169, 162,  46,  40, 174, 171,  34, 174, 171,
-169, 103,  46, 174,  41,  41, 162, 103, 168, 100,  41, 169, 160,  43, 169,
-168, 162, 162,  41, 103,  46,  40, 171,  40,  41, 174, 100, 169,  46, 174,
- 34,  40, 174,  34, 101, 103, 103, 100, 103, 168, 100, 171,  46, 174, 100,
- 46, 103, 168,  47,  41, 255, 162, 162, 169, 162,  41,  41, 162, 169, 168,
-169, 168,  34, 171,  34, 171, 174, 103, 101,  40, 100,  40, 103, 103, 101,
-174,  43, 103, 100, 162,  34, 168,  40, 174, 103, 162, 169,  41, 100, 169,
- 40, 103, 103,  41, 101, 169, 162,  34,  43, 100, 162, 162, 169, 169, 171,
-169, 160,  47, 169,  41, 100, 162,  40, 169, 169, 162, 160,  34,  41,  34,
-169, 100, 162, 174, 100, 100, 168,  40, 101,  40,  41,  46, 103, 101, 103,
-169,  41,  41,  40,  40, 101, 169, 101,  43, 169, 103,  40,  41, 162, 101,
- 34,  41,  40,  46, 162, 162, 168, 100, 174, 103, 160, 171, 100, 171, 169,
- 41, 174, 101,  46,  40, 171, 103, 168, 174, 171,  34, 169,  40,  47, 169,
-169, 169, 171, 168,  43, 103,  34, 162, 100, 162, 162, 162,  47, 169, 101,
-100, 168, 103,  40,  34, 100,  40,  46, 171, 103,  41, 171, 169,  34, 162,
-169, 169, 171, 171,  34,  41, 103, 101,  40, 169, 162, 162,  47, 169,  34,
-103, 100, 169, 171, 174,  40,  40, 171, 160, 171,  34, 103, 100,  41,  40,
- 46, 101, 174,  41,  46, 171,  43,  34, 103, 174, 103, 171, 169,  40,  40,
-103,  34, 171, 168,  40, 162, 169,  46, 171,  41,  34,  43,  47,  41, 174,
- 46, 169,  40,  41, 103, 103,  34, 169, 171, 169,  40,  41, 169,  46,  41,
-169, 171,  41, 174, 162, 162,  34, 169, 169, 171,  34, 100, 169,  34,  40,
-103, 101,  46,  46,  46, 171,  34, 162, 100, 168, 174, 162, 162, 169, 100,
-103, 171,  41, 162, 169, 174, 162,  40, 171, 171, 174,  34, 162,  46, 100,
-169,  43, 168, 100,  40,  34,  41,  41,  46,  41, 101, 103, 103, 174,  46,
- 43,  34,  47,  34,  34,  46,  40, 171, 103, 101, 100, 168, 171,  41, 171,
- 40, 160, 101,  40,  46, 162, 162, 162, 171,  34,  40, 169, 162, 174, 100,
-171, 169, 100,  40, 169, 169, 169,  46,  46, 169, 160,  41, 169, 169,  41,
-169, 101, 169, 168, 169,  34, 174, 162, 168, 100, 169, 100, 162, 169,  41,
- 40,  40, 171, 103,  41, 162,  40, 103, 100, 162, 103, 171,  41, 169, 162,
- 40,  34, 168,  40, 171, 160,  43,  46, 103, 103, 169, 103, 162, 169,  40,
- 40, 162, 169,  41, 162, 103,  41, 162, 174, 162, 169,  41,  40, 162, 174,
-169, 171,  46, 160, 169, 169,  43, 168, 168, 169, 103,  34,  34, 174, 101,
-162, 162, 169, 174, 103,  34,  40, 169, 100,  34, 162, 101, 169, 101, 162,
- 40, 169, 171, 169,  40, 169, 160,  41,  40, 162,  34, 162, 171, 171,  34,
-162, 100, 169, 101, 174, 162, 162, 169, 162,  40,  34, 169,  41,  34, 101,
-168,  46, 169,  34,  43, 169, 174,  40, 100, 168, 100,  40, 162,  41,  34,
-103, 162,  40,  40,  41, 160,  34, 174,  41, 103, 169, 162,  40, 162, 174,
-101, 171,  34, 162,  34,  41, 162,  46,  34, 169, 169, 162,  40, 171,  43,
- 41, 168,  34,  40,  41, 103, 162, 160, 103, 169, 169, 101,  40, 160,  46,
-168,  46, 169,  41, 169, 162, 162, 101, 162, 162, 100,  46, 103, 101,  40,
-169, 169,  41, 162, 171, 171, 168, 160, 103, 100,  40, 169,  47, 171, 162,
-174, 171, 162,  43, 162, 174, 171, 171, 101,  46, 100,  41,  41, 174, 174,
-103, 169, 103, 169, 171, 103,  41,  40, 174, 162, 169,  40,  46, 101,  41,
-101, 100, 171,  40, 101,  41, 100, 103,  41,  41, 169,  41, 171, 171,  40,
-171, 160, 171, 169, 101, 169, 174,  47, 103, 168,  41,  40,  40, 174,  34,
-169, 162, 162, 174, 162, 162, 169, 162, 168,  40, 169, 162, 103, 171, 162,
-255,  41, 169, 162, 255,  47, 162,  34, 169, 101, 162, 101, 162, 162, 174,
- 34,  46,  47, 174, 103, 169, 169, 162, 103,  34, 174, 101,  34,  46, 100,
-169,  47, 103, 100, 168, 101, 168, 169, 174,  47, 171, 174, 103, 103, 169,
- 47,  46, 100, 100, 162, 169, 174, 100, 169,  47, 169, 169,  46, 101,  34,
-171, 162, 169, 162, 171,  41, 160, 101,  34,  41,  34, 101, 169,  46, 101,
- 40, 103,  41,  34, 100, 169, 100, 169,  41, 169, 162,  34, 174, 171, 160,
-174,  41,  41,  34, 162, 169, 100, 169, 160, 169, 171, 171,  46, 174, 100,
-174,  34, 101, 171,  47,  34, 162,  41, 162, 162, 169, 162,  41, 100, 171,
-103, 162,  40, 171, 168,  34,  40, 169,  34,  41, 101, 171, 103,  40, 162,
- 40, 162, 160,  41, 101, 162, 101, 101, 100,  40,  40,  41, 169, 103,  41,
-171, 162,  47, 169, 103,  34,  46, 162, 169, 169, 168, 101,  40, 100,  46,
- 46, 101,  41, 169,  46, 174,  41, 101, 103, 103, 174, 101,  41, 255, 171,
-160, 168, 169,  40,  47,  46,  46, 100,  34, 169, 101,  46,  40,  34, 169,
- 34, 100, 169,  34, 101,  41, 101, 160, 100, 169, 169,  41, 169, 169, 169,
- 46, 169,  43, 171,  41, 169, 174, 103,  43,  34, 162, 103,  46, 174,  46,
- 40,  34,  40, 171, 169,  41, 169,  41, 171,  34, 103, 103,  34, 103,  41,
- 34, 171, 162, 162,  40, 103, 169,  40, 162,  40, 162, 162,  40, 169,  34,
- 34, 171, 174, 162,  34,  34, 162, 169, 162,  46,  40, 171,  41,  40,  34,
- 41, 162, 101,  41, 169, 162,  43, 169, 100, 103, 103,  34, 169, 169,  46,
-100,  34, 169, 169,  34, 101, 162, 171, 168, 169, 101,  40, 169, 162, 174,
-169, 101, 162, 162, 171, 169, 169, 101, 103, 162,  46, 171,  34,  41,  34,
- 46, 101,  34, 160, 171,  41, 100, 171,  34, 169, 169, 162, 160, 162,  34,
-101, 103,  41,  34, 100, 162, 103, 169, 101, 162,  41,  41,  41, 100, 169,
-169,  46, 174, 174, 174, 162,  41,  41, 171,  46, 169,  34, 162, 171,  34,
- 40, 103, 169, 169,  46, 162, 162,  46,  41, 171,  41, 174, 103, 174,  34,
-162, 174, 101, 169, 101, 169, 100,  34, 174,  41, 171, 103, 174, 171, 100,
-171,  40,  34,  40, 174,  40,  34,  41, 103, 169, 162,  40, 162, 169,  34,
-169,  46,  41, 169, 169, 174,  46,  43, 169, 169, 169,  46,  34,  41, 162,
- 34, 162,  34, 171, 162, 101,  34,  34, 101,  41, 162, 169, 169, 103, 169,
-162,  41,  41, 162, 169,  40,  46, 162, 162, 171, 162, 162,  34,  41,  41,
-101, 100, 171, 101, 171, 169, 100,  46,  34, 103, 101,  40,  47, 174,  40,
-169, 101,  41, 162,  41, 174, 174, 101, 100,  40,  41, 100, 174, 100, 162,
-174, 169, 162,  41,  46,  41, 169, 169,  41, 169, 169, 169, 162, 162, 169,
-101,  41,  41,  41, 169,  41, 171, 162, 169,  34, 174, 169, 162,  41, 160,
-100, 160, 169,  41, 174, 169, 162,  34,  41, 169, 101, 169, 162,  34,  41,
-160, 169,  34, 169,  46, 101, 174, 101, 100, 169, 162, 169, 160, 100,  41,
-169,  41, 171,  46, 169,  40,  40,  34, 171, 101,  34, 100, 160,  34, 169,
-169, 103,  46,  40,  41, 174, 100,  46, 100, 101, 169, 101,  46,  41, 169,
-169, 162, 169, 169,  40,  34, 162,  41, 103, 169, 169,  40, 171,  44,  41,
-101, 101, 171, 103, 101,  34, 169,  40,  41, 101, 103,  34,  34, 100,  40,
-101,  41,  41, 169, 101, 101,  40, 103,  47,  46, 101, 162, 169, 169, 162,
-100,  41,  46, 174, 101, 162, 101, 169,  40, 169,  46,  40,  34,  34,  34,
-171,  34, 174,  41,  46,  46, 162, 162, 169,  46,  41, 162,  34,  41, 162,
-162, 162,  41, 101, 160,  34, 169, 162, 100, 162, 169,  41,  47,  34, 169,
-103, 171, 162, 103, 162,  41, 162, 174,  41,  46,  41, 169, 101,  40, 103,
-101,  46, 174, 169,  46, 163, 163, 169,  34, 174, 101, 174,  46, 174, 174,
-169,  34,  41, 171,  41,  46, 160, 169, 169, 101, 162,  44,  34,  46,  34,
-162, 101,  40,  34, 174, 169, 169, 171,  41,  34,  34, 101,  41, 100, 101,
-162, 171, 103, 174, 169,  41, 169, 160, 162, 162, 171,  34,  34, 169,  40,
-169,  34, 174,  41, 174,  34, 100,  46, 103,  41,  34, 174, 162, 101,  34,
-162, 100,  40, 169, 169, 169,  46, 169, 162, 100, 101, 171, 103, 169, 169,
-160, 103, 103, 174, 100,  46,  40, 162, 174, 169, 160, 174, 103,  46, 174,
- 41, 169, 162,  47, 162, 174,  34, 101, 103, 100, 174, 171, 160, 174,  34,
-169, 101, 169, 101,  47, 169, 100, 169,  46,  41, 169, 169, 174, 169, 174,
- 46, 101,  34, 162,  41, 174, 169,  41, 101, 101, 169, 162, 169, 162,  41,
- 41,  46, 101, 100,  34, 162,  34, 100, 171, 100, 101,  46, 171,  41, 162,
-171,  40, 162, 174,  34,  40,  41,  34,  46,  41,  34,  41, 169, 162,  34,
-169, 101,  41,  44, 160, 101, 169, 169, 101, 162,  34, 169, 169, 169, 101,
-101,  34,  46,  40, 101, 169,  47,  41,  46, 101, 162, 103, 171, 174, 162,
-100, 101, 174, 174,  34, 101,  41,  46,  40,  46, 160,  47, 162, 169, 100,
-174, 169, 174, 169, 169,  47, 169, 160,  41, 162, 174, 169,  47, 174, 174,
- 34, 169, 162,  41, 169, 171,  41, 163, 103, 169,  34, 169, 174, 169,  34,
-101,  41, 169, 169, 169, 174, 174,  34, 171, 103,  34, 174, 169, 169, 101,
-162, 163, 169, 103, 162, 101, 169, 169, 174,  41, 163, 162, 163, 174, 103,
- 34, 174,  34, 101, 169,  41,  44,  34, 100, 101,  34, 174, 101,  41, 160,
-174, 163, 162, 169, 101, 174, 101, 162,  34,  40,  41, 101,  41,  41, 169,
-169, 101,  41,  34, 174, 169, 169,  34, 174,  34, 169, 100,  40,  34, 169,
-103, 163,  41,  40, 169, 169, 171,  44, 169, 162,  41, 101, 174, 169,  34,
-100,  41, 162, 174,  46, 162,  34,  46, 169, 101, 169, 101, 101, 174, 160,
- 40,  47,  34, 169, 162, 162, 174,  41,  41, 162, 171, 169, 100, 174,  41,
-174,  34, 160, 162,  34, 162, 169, 169, 162, 162, 160, 174,  41,  34,  46,
-162,  34,  41, 163, 174,  41, 169, 162, 100, 162, 162, 169, 101, 163, 169,
-169,  40, 160, 169,  46, 169, 169, 163, 162, 101, 163, 169, 169,  34, 162,
-101, 101, 171, 163, 163, 160, 169, 174, 162,  40, 101, 169, 160,  34, 174,
- 34, 101,  34, 103, 174,  34, 169, 162,  41,  34,  41, 162, 174, 169, 101,
- 41,  41,  41, 174, 169,  41, 169, 101, 162, 174, 160, 162, 169, 101, 169,
-174,  34,  41, 162,  47, 162,  34,  34,  41,  34, 163,  34, 169, 174, 163,
-169, 169,  34, 169,  34, 162, 174, 174,  41,  34,  41,  40, 162,  40,  41,
-160,  34, 174,  40, 174, 160, 101, 162, 163, 169,  34, 162,  41,  34, 169,
-162,  41,  46, 169, 101, 174, 174,  47, 169,  41, 169,  34,  41,  41, 174,
-162,  41, 162, 162,  41, 169, 174, 100, 174, 169, 169,  41, 174, 101, 162,
- 41,  34, 162,  46, 171, 101,  41,  41, 174,  34, 101,  46,  34, 169, 169,
- 47, 101, 101, 163, 169, 162, 162, 169,  41, 162, 103,  46, 169, 171, 163,
-101,  41,  46, 174,  34, 162,  34,  34, 169, 169, 169, 169, 169,  34, 174,
-103,  34,  34,  34,  41,  40,  34,  34, 169,  34, 101, 163, 169,  41,  34,
-101, 101,  34,  41,  41, 169, 162, 169, 101, 160, 101,  34,  46,  34, 169,
- 41, 174, 169, 171,  34, 169, 162, 255, 163, 101, 169,  40, 174,  41, 169,
-171,  34,  41, 174, 169,  34,  41, 174, 162,  34, 101, 101, 171,  41,  46,
- 47, 162, 101, 162, 162, 101,  41, 174,  34, 174,  44,  34,  41,  41,  44,
- 41, 169, 169, 169,  34,  34, 162, 101, 169, 162, 101,  44, 101,  46, 174,
- 34, 169, 169, 174,  41,  46, 162, 160, 169, 174, 101,  34, 101,  41,  34,
-169, 169, 169, 174, 101, 174, 169, 169,  41,  46,  46, 163, 169, 162, 169,
-163, 103, 169,  47,  41, 174, 174, 169,  34, 162, 101,  41, 174, 160, 174,
- 34,  41, 174,  34, 174, 162,  40,  44, 162, 101, 174, 171, 163, 101, 174,
-163, 163, 169,  40,  47,  44, 169, 169, 174,  34, 101, 101,  41, 169,  34,
- 34, 174,  41, 174, 174,  41, 169, 101,  46, 169, 169, 174, 174, 162, 103,
-171, 101, 174, 100,  34, 101,  41, 169, 169,  34, 169, 162, 169,  46, 169,
-174,  41, 171,  34,  41, 160, 163, 163,  34,  34, 162,  44, 162,  41, 101,
-101,  34, 169, 101, 163, 169, 162, 162, 174,  34,  46,  34, 101, 100, 169,
- 41, 162,  34,  41, 101,  34,  34,  34, 162, 101, 174,  46, 101,  34, 162,
-162,  34, 160, 174, 103,  41,  44, 174,  41, 169, 162,  40,  41, 174,  41,
- 44, 101,  41,  34,  41, 163, 169,  44, 169,  46, 162,  46,  41, 169, 174,
-162, 160, 174,  41, 163, 174, 162, 160, 174, 169, 169,  34, 163, 101, 174,
-169, 101,  34, 101,  46, 174,  46, 169, 160,  41, 169, 101,  34,  34, 160,
- 34,  41,  34,  41, 169, 101, 174, 160,  44, 169,  34, 163,  41, 101,  46,
-169, 162, 101, 101, 101, 174, 169,  46, 174,  34, 101,  47,  41, 169,  41,
- 44,  34, 174,  41,  41, 169,  34,  34,  41,  46,  41,  41, 101,  34, 169,
-169,  40,  41, 174, 101, 162, 101, 169,  41,  41,  44,  34, 101,  34, 163,
-101, 101, 169, 162, 101, 169,  41,  41, 174,  34, 169,  34, 169, 169,  41,
- 41, 101, 169, 174,  34, 169,  47, 174,  47, 101,  41,  41, 101, 169,  41,
-169, 101, 101,  41,  34, 160, 160, 174, 162, 174,  41, 163, 162, 169, 162,
- 34, 101, 101, 101, 162, 174, 162,  34, 169,  34,  34, 174, 169, 169, 169,
- 34,  46, 169,  34, 169, 169, 169,  34, 174, 169, 162, 163,  34, 174, 101,
-174,  41, 162, 163, 169,  41, 101,  34, 174,  41, 169,  34,  46, 162,  34,
-169, 101, 101, 162,  47, 101, 174, 174, 162, 174, 162,  41, 160, 162, 169,
-169, 169,  41, 162, 169,  44, 101, 169, 101, 162, 163, 169, 174, 174, 169,
-169,  34,  41,  41,  34,  47,  41,  46, 169,  34, 162, 169, 163,  34,  41,
-101,  46,  41, 101, 169,  41, 174, 174, 174,  34, 174, 169, 160, 162, 172,
- 41, 174,  44, 169, 101,  41, 174,  34,  46,  44, 101, 101, 169,  47,  41,
-101, 169, 169, 101,  41,  46,  44,  44,  41,  34,  34, 162, 169, 174, 162,
-163,  44, 169, 101, 101, 162,  41, 101, 163, 169, 163, 101,  41,  41, 169,
- 41, 163,  34,  44,  47,  41, 162,  41,  34,  46,  41, 101, 101,  44, 163,
-169,  34,  34,  41, 162, 169, 101,  34, 101,  41,  41, 162,  34, 162, 174,
- 41, 163,  46,  41, 174, 169, 169,  44, 101, 174, 101,  34, 101, 160, 163,
-169, 169,  34, 101,  35, 101,  34,  41, 101, 101,  41, 169, 174,  44, 160,
-169, 162, 169, 101, 169, 174, 174, 169, 162, 101,  41, 101,  34,  47,  41,
-174,  46, 169, 162,  34,  41,  46, 101,  41,  41,  34, 174,  41, 101,  41,
-163,  34,  46, 174,  34, 169,  34, 169,  41, 160, 169,  34, 169, 174,  46,
-169,  34, 174, 172, 174, 169, 174, 162, 174, 169, 160, 101,  47,  41,  34,
- 46,  44,  41,  46,  44,  34, 174,  41, 169,  34,  34, 101, 162, 162, 174,
- 46, 169, 163,  44,  34, 101,  41, 101,  41,  41,  34, 101, 174, 163, 101,
- 41,  34, 162,  41, 169, 174,  41, 163,  34, 174, 162, 160, 169, 163,  34,
-174, 169, 169,  34, 169, 172, 163,  41, 174, 162, 162, 101,  46,  35, 101,
-169, 163,  44,  34,  41, 175,  32,  34,  34,  41,  47,  34,  46,  44, 174,
-101, 172, 162, 101, 162, 163,  34, 162, 162, 169,  34, 162,  44, 169,  34,
-174, 162, 169, 169, 163,  32,  41, 101, 163, 162,  41, 160, 163,  44,  41,
-162,  35, 101,  41, 169, 174, 101, 169, 169,  34, 174, 174, 162, 174, 174,
- 34, 174, 174, 163,  44, 163, 174, 162,  46, 174,  34,  34, 174,  34,  34,
-172, 169, 160, 101, 160, 169, 169, 101, 174,  34,  34, 160, 101,  41, 101,
-174,  46,  44, 101,  44, 101, 174, 101, 169, 162, 101, 101,  41, 169, 162,
-101,  34, 101,  34, 169, 101, 169,  34,  41,  41,  41, 174,  34, 174,  47,
-162, 162,  41, 101, 163, 163,  46, 160, 169, 163,  34, 101, 101,  41, 174,
-174,  35, 162, 101, 169, 169, 101,  46, 163,  46, 175,  41,  34, 101, 169,
-101,  41, 169,  44, 163, 163,  34, 169,  41, 162,  44, 162,  35, 174, 169,
-162, 101,  41,  47,  34,  34, 169,  34,  44,  34, 169, 163, 174,  35, 160,
- 41, 169, 169, 162, 172, 174,  41, 169, 163, 169,  44, 101, 169,  34,  41,
-101, 169, 169, 169, 169, 169, 169, 169, 174, 163, 169,  41,  34, 174, 169,
- 41, 169,  41, 160, 174,  34,  34,  34, 162, 174,  41, 101, 163, 101,  41,
-162,  46,  41, 163,  46,  34,  46, 169, 162, 169,  34,  41,  32, 174, 160,
- 47, 101, 163, 101,  32, 169, 101, 101, 169, 163,  34, 163,  47, 162,  32,
-169, 169, 169,  44,  34, 160,  44, 174,  34, 163, 174,  34, 163, 175, 163,
-174, 174, 175, 101, 172,  41, 169,  47,  34, 169, 160, 162, 174,  41, 101,
- 41, 163, 169, 162, 175, 174, 162, 163, 174, 101, 169,  44,  41, 162, 169,
-162,  34, 163,  35, 169, 101,  44,  44,  44,  34, 172, 175, 169, 163, 169,
- 41, 172, 101, 101,  34,  41,  35, 162, 169, 162,  41, 169, 169, 169, 162,
- 46, 101,  44, 160, 101, 169,  34,  46,  44,  41,  46, 101, 172, 101,  34,
- 34, 174, 169,  34, 163, 163, 160,  44,  41, 101, 169, 160, 101, 174,  41,
-175, 172, 163, 101,  41, 169, 174, 101,  46,  41, 101,  34,  34, 174, 169,
-163,  44, 174,  32, 175,  47,  34,  41,  34, 101, 169, 162, 175, 169,  46,
-101, 174, 172, 162, 101,  34, 162, 163, 169, 101, 174, 101, 175, 169, 101,
-169,  46,  34, 162,  34, 163,  34,  32, 174, 163, 174,  41, 169,  46,  41,
-169, 174, 169,  41, 169, 163,  41, 101, 172,  41, 169, 162,  41, 101,  41,
-169, 160,  46,  41,  46, 169,  41, 174, 163,  46,  47, 163, 169, 163, 101,
-174,  44, 162, 162,  41, 172, 101,  34,  34,  47, 172, 163,  41,  35, 174,
-169,  32, 174, 101,  32,  34,  32,  41, 160, 169,  41,  34, 169,  41,  35,
-101, 169, 101, 169,  34, 101,  34, 163,  41,  32, 169, 163, 169,  44,  41,
-169,  34,  44,  34,  32, 174,  41, 169, 160, 174,  41,  46, 174, 162,  32,
-101,  44, 169,  41,  46,  34,  34, 174, 101, 174,  41, 162, 174, 175, 101,
-174, 169, 174, 174, 162,  41,  41,  41, 162,  41, 101, 169, 175,  44, 163,
-169,  34, 101, 101, 162, 160,  34, 162, 101,  34, 169, 101,  41,  34, 174,
- 41, 172, 174,  46,  46,  32,  44, 163,  41, 160,  35,  34, 174, 169, 172,
- 47, 101,  41,  35,  44,  35,  34, 162, 162, 174, 172, 174,  44, 172,  44,
- 41, 174,  41, 160, 101, 163, 163,  34, 163,  34, 174, 172, 169, 174, 172,
-163, 169,  41, 174, 169,  34, 169,  46,  34, 160, 172, 174,  32, 162,  34,
-163, 101, 160, 160,  47, 174,  34, 169, 174,  34, 172,  44, 169, 163, 169,
- 34, 162, 160,  34, 101, 174, 163, 174, 101, 174, 169, 101,  34, 169, 169,
- 41, 172, 101,  34,  41, 162, 101,  46,  41,  32,  32, 101, 162, 162, 169,
-162, 169,  34,  41,  34, 169, 169, 101, 163, 174,  41, 169, 163, 175, 163,
-169,  34, 163, 169, 160, 101,  32, 163, 174,  46, 101,  34,  34, 169, 169,
- 34,  44, 169, 174,  35, 160, 101, 169,  34, 174, 169, 101,  41,  47,  34,
-162,  32,  44, 101, 162,  41, 169, 169, 169, 169,  44, 163, 162,  41, 174,
- 35, 169, 160, 160,  44,  46,  35,  34, 101, 174, 163,  44, 174, 163, 101,
- 32, 101, 101, 101, 160,  34, 160, 162,  34, 163, 101, 162, 169, 169,  41,
-101,  34,  44, 101, 101, 169, 160, 169, 163,  44, 169, 163, 174,  34, 160,
-101, 174, 174, 169,  41,  41, 162,  34, 175, 163, 169, 169,  47, 169,  34,
-163, 174, 169,  44, 163,  44,  41, 101, 169, 169,  41, 172, 169, 169,  44,
- 41,  44,  35, 169, 174,  34, 169, 101, 101, 172, 175,  32, 163,  32, 169,
-101, 169, 163,  34,  32, 163,  34, 163, 163, 162,  41,  46, 101,  35, 174,
- 34, 101,  34,  44,  46,  41,  35, 101, 169,  41,  34, 101, 175, 172,  44,
-101, 174,  34, 163,  44,  34,  34,  41, 169,  34, 174, 175, 163, 174, 169,
- 34,  47, 101, 162, 172,  35, 174, 174, 163,  41, 163,  35, 101,  47, 175,
- 32,  35, 174, 172, 169, 174,  44,  41,  46, 175, 174, 163, 175, 163,  41,
- 34, 174, 101, 169, 160,  41, 101,  47, 163, 169,  32, 101,  46,  41,  41,
-174, 101, 101,  34,  44,  32, 162, 169,  44, 163,  47,  32, 169,  32, 169,
- 46,  32, 163, 169,  44,  35,  41, 160, 101, 172, 163,  41,  44,  34,  41,
-101,  35, 160,  41, 169, 163,  35, 169, 162,  34,  34, 162,  47, 160, 163,
-160, 160,  35,  35, 174,  34, 174, 175, 169,  41, 163, 160, 160,  41, 160,
-162,  34, 160, 162, 101,  41,  41, 163, 169,  32,  41,  41,  46, 174, 174,
-162,  47,  35, 174, 101, 174, 169, 162, 169,  34,  41, 160,  34, 163, 163,
-163, 101,  44, 172,  32,  41, 163,  41, 175,  32, 169,  34, 162, 169, 169,
- 47,  35, 162, 174, 169, 163, 172, 169,  32, 101,  41, 163, 174, 169, 174,
- 34, 163, 101,  44, 163, 163, 172, 160,  34,  41, 174,  41, 101, 172, 101,
- 41,  41,  46,  44,  34, 172, 175, 163, 175,  47, 163, 174, 169,  46, 174,
-101, 169,  47,  35, 172, 169,  44, 174, 101, 160, 175, 169, 163,  35,  35,
- 32,  32,  44, 101, 172,  47, 101, 169, 169, 101,  41, 174,  47, 169, 169,
- 34, 101,  34, 169,  41,  41, 163, 162, 169,  35, 175, 174,  44,  41,  35,
-174,  34,  35, 163, 169,  44,  35, 174, 169, 172, 169, 101,  32, 169, 172,
- 34,  34, 169, 162,  47,  47, 160,  35, 172,  32, 163, 169, 163,  32, 169,
- 44, 101, 163,  44, 175, 174, 169, 172, 169,  35, 162,  34,  32,  35,  44,
-160,  44, 101, 172, 172,  46,  44, 162, 174,  34,  47, 172,  35, 163,  47,
- 34, 174,  34, 101, 169,  41,  34, 172,  44,  47, 174,  41, 163, 175, 172,
-101,  32,  34,  34, 163,  47, 172,  35, 162,  35,  34, 174,  35, 174,  35,
- 35, 169,  32, 169,  41, 163,  34,  44, 101,  44,  41,  44, 163, 175, 174,
- 34, 163,  44, 175,  35, 175, 163, 172, 169, 162,  44, 169, 101, 169,  44,
-175,  46,  34, 169,  34, 163, 169,  34,  41, 160, 169, 101,  32,  35,  34,
-163, 101,  44,  41, 101, 163, 169, 174,  34, 172, 160,  34, 169, 163, 162,
-162,  47, 172, 163, 172,  41, 169, 172,  41, 175, 172,  32,  41, 101,  47,
-163, 163,  32, 172, 172, 174,  44, 163, 162, 163,  32,  35, 163, 175, 174,
- 32, 162,  46,  41, 163, 101,  47, 160, 169, 175,  41,  32, 163, 169,  46,
-101,  41,  35, 101, 160, 101,  32, 174, 169, 160, 160, 162, 163, 101, 169,
-174,  41,  44, 163,  41, 163, 101, 101, 163, 172,  41, 172,  34, 169, 174,
- 41, 172,  32,  47, 169, 175, 101, 174,  35, 172, 174,  47,  32,  44,  34,
- 35,  44, 175, 175,  35, 101,  34,  32, 169, 101,  32,  34, 163, 174, 162,
- 44,  46,  46,  41,  46, 101, 169, 169,  44, 163, 172, 101,  41, 163,  32,
- 44, 163, 163,  44,  35, 169,  44,  46,  35, 169, 175,  41, 101, 101,  32,
-174, 169,  34,  32, 174, 169,  46, 169,  41, 172,  32, 172, 163, 169, 162,
- 32,  35, 163, 162, 160,  44,  32, 101, 101,  32, 160, 169,  34, 175,  34,
- 44, 163, 169, 163,  41,  32, 175,  34, 163, 163, 169,  41, 162,  32,  34,
-175, 162, 169, 162, 175, 160, 169, 175, 160, 169, 160, 172, 169, 169,  35,
-162, 163, 172, 169, 162, 101,  47, 169, 101, 162, 163,  34, 175, 169, 169,
-160,  41,  34, 101, 101, 175,  47, 101, 163, 175, 174,  41, 169, 172, 172,
-169, 169,  34, 162,  35, 160, 172,  44,  47, 101,  32,  44, 163, 163, 169,
-162,  41,  35,  44, 160, 172,  34, 174, 162,  41, 101,  41,  41,  34, 172,
- 34,  46, 175,  35, 169, 175, 163, 101, 163, 175,  44,  34,  34,  35, 169,
-169,  44,  41, 163, 101, 162,  44, 162,  32,  34,  44, 175, 172, 172, 172,
-172, 163, 160,  32,  32, 174, 175,  32, 169,  35, 101, 163, 169, 172,  32,
- 35,  34, 101,  44, 172, 162,  41,  44,  35, 175, 174, 172,  35, 174,  34,
-163,  32, 172,  35, 169,  32, 172,  41,  32,  32,  35, 101,  41, 169, 169,
- 35,  41, 163, 163, 163, 172, 169, 101, 163,  41, 169,  44, 169, 163,  32,
- 32, 169, 101, 101,  34, 101,  34,  34,  46,  47, 174, 172, 101,  35,  35,
-169, 163,  35,  34, 172, 162, 163, 101, 172,  44, 162,  34,  34, 101,  34,
-175, 163, 162, 163,  41,  34,  44, 172, 162, 174,  32, 163, 172,  44,  41,
-160, 163, 163, 175,  41, 162,  32, 175, 169, 175, 162, 163,  34, 163, 160,
- 41, 175, 174,  41, 163, 169,  34,  32,  44,  35, 101,  41, 163, 163,  32,
-163, 169,  32,  44,  32, 172,  35,  41,  34, 101, 169, 101,  34, 172, 163,
-162,  44,  41, 160,  44, 175, 160,  44,  34,  35,  35,  32,  46,  32, 169,
-162,  41,  35, 162, 174,  32,  44, 169,  41, 174, 163, 174, 163,  44,  47,
-172, 174,  47, 101, 163, 175,  46, 175, 163, 101,  34, 163, 169, 163, 169,
-169,  41, 172, 101,  35, 162, 175, 172, 169,  35, 163,  35, 172,  46, 174,
- 44,  44,  41, 163, 169, 163, 160,  34, 101, 101, 172, 163,  34, 162,  44,
- 32, 169, 169, 101, 162,  46,  44, 162, 162,  46, 174, 163, 172, 163, 175,
-175, 172,  34, 172, 174,  44,  47, 169, 163, 169,  32, 163, 172,  41, 174,
-169, 163, 172, 172,  32, 172, 101, 175, 169, 163,  32,  44,  35, 174,  32,
-174,  34,  47,  44, 169, 175,  32, 169,  44, 169,  47,  35, 169,  35,  34,
-174, 162, 172, 172, 172, 163,  47,  35,  44, 163,  41,  44, 169, 174,  34,
-175, 163, 160,  35,  35, 172,  35, 163,  41,  32, 162,  35,  32, 169,  32,
- 35, 172,  34, 162,  35,  44,  34, 169, 162, 175, 172,  34, 169, 174, 172,
- 32, 174,  41, 101, 175, 163, 175,  44, 172,  44, 101, 162,  35, 175, 160,
- 47,  41, 174, 163,  32,  32,  35,  41, 169,  34,  41,  41,  35, 175, 172,
- 34, 101, 175, 175, 169,  44,  44,  35,  35, 172, 172, 174, 101, 169,  32,
-101, 163,  32, 175,  32,  41, 160,  34,  44, 101,  32, 163,  32, 169, 175,
-169,  35,  32,  34,  35,  32, 169, 101,  35, 169,  32,  35, 162,  41,  41,
-174,  35, 162, 172,  34, 160, 160,  34, 163, 172, 163, 163, 172,  32, 101,
-169,  47,  34, 101, 101, 160, 172,  44, 175, 169, 175,  44, 163,  44, 175,
-169,  46,  44, 160, 163, 163,  32,  35,  35,  41, 172,  41, 174, 172,  44,
- 32,  44,  35,  46,  34,  44, 174, 172, 175,  34,  41, 172,  32, 162, 101,
-163,  44,  32, 169,  34,  32, 174,  34,  47, 160, 163,  34, 172, 169,  34,
- 35, 175, 163, 175, 160,  32,  32, 163, 163, 174, 172, 172, 163,  32,  32,
-160, 169, 163, 172, 160,  35,  32, 163, 101, 163, 169,  32, 169, 163,  34,
-160,  46, 175,  35,  44, 163,  41,  32, 162,  46,  41, 163, 172, 163, 175,
-172,  32, 101, 101, 172, 163,  35, 169,  35,  32,  44,  35, 175,  32,  35,
- 44, 169, 172, 162,  44, 162,  35, 174,  44, 163,  35,  41, 175,  32, 172,
-163, 163, 175, 169,  44, 160,  44,  41,  34,  44, 172, 172,  41, 163, 101,
-101,  41, 163, 172, 163, 175,  44,  32, 175, 163,  32,  44, 172,  44,  44,
-172,  32, 163, 169,  34, 172, 160, 172, 172, 163,  32, 163, 163,  34,  34,
-169, 162, 175, 160, 175,  44, 162, 169, 175, 172, 160, 172, 169, 172, 160,
-175,  44,  35, 163,  44, 169,  41, 169, 174, 175, 169,  32, 163,  44,  32,
-172,  32,  44, 172, 175, 174, 160, 175, 101, 175,  35, 169,  32,  44, 175,
-175, 101, 160, 174, 101, 160,  32, 163,  35, 172, 163,  47, 172, 163, 172,
- 35, 169, 160, 169,  44,  41,  44, 163,  35,  32,  41,  34, 169, 163, 163,
-175, 163, 101,  35,  35,  34,  32,  34, 172,  46,  46, 163,  41, 163, 174,
-163, 175,  34, 175,  34, 172, 172,  32, 175,  35,  35,  32,  35, 174, 172,
-163,  44,  44,  41, 101, 169,  41, 163, 172, 160,  34, 174,  32,  32, 169,
-101, 163,  32, 175, 169,  32, 160, 174, 163, 175,  35,  32, 163, 163,  32,
- 32,  47, 175,  32,  35, 172, 174,  41, 175,  44,  32,  44, 169,  44, 175,
-175, 172, 172,  46,  35,  35,  35, 174, 160, 163,  34, 163, 160,  32, 175,
-172, 169, 101,  32,  35, 172, 172, 174, 175,  35, 101,  32,  35,  32, 162,
-169, 101,  41, 163,  32,  32, 169, 163, 160,  32, 172,  35,  34,  44, 175,
-172, 172, 162, 101,  35, 172, 163, 174, 172,  35, 163,  32, 172,  44, 163,
- 35,  35, 172, 160, 172, 163,  41, 169,  41, 163, 175, 162, 163,  32,  32,
-163,  35, 162, 163,  32, 101, 172, 163, 172, 172, 172, 163,  32, 175, 172,
- 32,  34,  34, 172,  34, 163, 101, 175,  44, 172, 175, 169,  32, 101, 175,
- 41, 175, 169,  34,  32, 163,  32,  47, 163, 175, 174,  32,  32, 163,  47,
- 32,  35,  32,  35, 174,  47,  32,  32, 172, 162,  44,  35, 163,  34, 172,
-101,  44, 162, 175, 172,  44,  34,  34, 169, 101,  47, 160,  34,  46, 160,
-172, 175, 175,  35,  44, 172,  46, 169, 172, 163, 160, 175, 172,  47, 169,
- 44, 101, 169,  35, 162,  34, 163, 163, 160,  35, 160,  44, 172, 175,  32,
-163,  35, 160, 172, 163, 162,  44,  34, 162,  32, 163, 163,  35, 175,  44,
-163,  32,  32,  35, 169,  35,  32, 163, 169, 172, 172, 172, 163, 162,  44,
-174,  46,  44,  34,  44,  44, 172,  35, 169,  32, 163, 172, 175,  35,  41,
-172,  32,  32, 174, 163, 175,  35, 172, 101,  35,  32, 163, 172, 175,  44,
-160, 172, 163, 162, 172,  35,  44, 175, 163, 160, 172,  34,  32, 172, 101,
- 32,  35, 163,  35, 169, 163, 172,  44,  35, 172, 163,  35,  34,  41,  32,
-175,  34,  44,  44,  35,  47, 163,  32, 101, 175,  34, 169, 169, 175,  32,
- 35, 163, 163, 163, 172, 172,  44,  44, 172, 175, 163, 175, 163, 162, 162,
- 35, 175, 163, 101,  32, 163, 174,  32, 163,  44,  34, 172, 163,  44, 172,
-163, 172, 169,  44, 169,  41, 169, 163, 160, 163,  44, 101, 172,  32,  44,
-174,  44,  32,  35,  32,  44, 175, 163, 163,  32,  32, 172, 163,  35, 169,
- 44, 169, 163,  32, 163,  46, 101, 172, 172,  35,  35, 172,  35, 175,  44,
- 32, 163, 175, 172, 172, 175, 101, 174,  44, 169, 172, 175,  35, 172, 163,
- 32, 172, 163,  47, 175,  47,  47,  32,  46,  32,  32,  47,  35, 162, 172,
-160,  35, 163, 162, 160, 101, 169, 162, 163,  32, 163, 175, 163,  41,  35,
-172, 162, 163, 175,  35, 163, 175,  47, 163,  35, 163,  32,  44,  44, 175,
- 35, 163, 163, 175,  32,  35,  35, 175,  44,  44,  46, 101, 169,  35, 101,
-172, 175, 169, 163,  32, 101, 160,  32, 163, 172, 175, 163,  41, 163, 101,
-174,  35, 160, 101, 163, 175,  32, 172,  34, 163, 163,  32, 163, 163,  34,
-163,  32,  44, 175,  44,  41,  44, 163, 175,  44, 160, 160, 163, 163,  32,
- 32, 175, 174,  32,  32,  35,  32,  35, 169, 172, 172,  44,  47, 172,  34,
-163,  44, 174,  44,  35,  47,  44, 175,  35, 175, 172,  35, 174,  32, 172,
-172,  32,  44, 172, 160, 169,  35, 172, 163, 169,  32, 175, 175,  44, 162,
-175, 160,  44, 163,  32,  34,  47, 163, 174, 163,  35, 175, 163, 172,  35,
- 32,  32,  44, 163, 175, 175, 163, 169, 169, 172, 175, 163, 172,  34,  44,
-175, 163, 162,  35, 163, 172, 163,  34, 175, 172,  35, 172,  35, 163,  34,
- 41, 101, 172,  44, 175,  32, 101, 172, 163,  44, 101, 101, 163, 169, 172,
- 32, 169, 172,  34, 175, 163, 160, 163, 172, 169,  32,  35,  35, 163,  35,
- 35,  35, 172,  32, 172, 172, 160, 172,  44, 175,  35, 172,  35, 175,  44,
-172, 175, 163,  44,  32,  44, 163,  47,  47,  47, 163, 163, 163, 172,  44,
-160,  46,  32, 101, 175,  35, 163, 160, 160,  47,  41,  44, 160,  35, 172,
-172, 163, 163, 163, 175,  34,  32,  34,  34,  32, 160, 163, 163, 163,  44,
- 32, 172, 172,  32,  34,  47,  32,  47, 163, 163, 174,  35, 172,  32,  32,
- 32, 174,  32, 175,  44,  35, 174, 163, 172,  35,  41,  44, 101, 172,  32,
-169,  35,  44, 101, 175, 163, 175,  35,  32,  32, 172,  35, 163, 160, 163,
-163,  34, 175, 163, 163, 172, 163,  44,  47, 160, 172,  46,  44, 172,  44,
-160,  44, 163, 172, 175,  35, 162,  47,  35,  44, 160, 172,  35,  41, 172,
-172, 175,  35,  32, 175, 175, 163,  35, 169,  44, 172,  44, 160, 175,  32,
- 35, 169, 175, 172, 172, 172,  35,  44,  35,  32,  32, 175, 172, 172, 172,
-163, 160, 172,  47, 172, 162, 160, 163,  35,  32,  35,  44, 163,  47, 172,
-169,  32, 172,  32,  35,  32,  32,  35, 160, 172, 172, 169, 160,  32, 163,
-175, 172,  47,  32, 174, 163,  32, 175, 175, 172, 163,  35,  35,  32,  32,
- 44,  35, 175,  32,  44, 175,  47, 172, 160, 175,  35, 163, 163,  35,  32,
-162, 163, 175,  44, 163,  32, 172, 172,  32,  35, 172, 175, 175, 101,  35,
-163, 163,  35, 175,  44,  32, 160, 163, 160, 175, 172,  35,  47,  35, 172,
-160, 163, 160,  35, 160, 175,  32, 163,  32, 172,  35, 175,  32,  47, 175,
- 35, 172, 163,  35,  41,  41,  35,  41, 163, 175, 160,  46,  35,  44,  35,
- 35,  44, 172,  32, 172,  32, 163,  32,  35, 172, 163, 163,  32,  32,  32,
-163, 174, 175, 172, 163,  44, 172, 163,  44, 172,  44,  32, 172, 172, 163,
-172, 163,  47,  35, 175, 163, 172, 163, 163,  47, 163,  35, 160, 172, 101,
- 32,  44, 163,  32, 163, 175, 163, 175, 175,  34,  47,  47,  32,  32, 172,
-172,  32, 172,  32,  35, 172,  44, 169,  32, 163, 172,  32, 160, 101, 163,
-163,  35,  32,  35, 163,  35, 175,  35,  44, 163, 175,  32, 160, 169, 175,
-163, 172,  35,  32, 172,  44,  44,  32,  35, 163,  35, 172, 172,  44, 172,
- 35,  35, 175,  44, 172, 163, 175,  35, 101, 175, 172, 175,  32, 163,  44,
-175,  47,  32,  35, 163, 172,  44,  44, 175,  44,  44,  34,  32, 175,  32,
-163,  44, 172,  35, 160,  35, 172, 172, 160,  35, 175, 160, 172,  32, 163,
-163, 160, 172,  41,  32,  35,  44,  44, 175,  44,  35, 163, 172,  32, 160,
- 32, 172, 163,  35, 175, 172,  35,  44,  32, 160, 175,  44,  35,  32,  32,
-172,  44, 175, 163,  47, 163, 172, 172, 160, 172, 163,  32,  32, 163,  32,
- 32, 175,  35,  35, 172, 175,  32,  35,  44, 172,  35,  35, 172, 163, 172,
-175, 175,  32, 160, 172, 163, 172,  34, 162,  47,  35,  35,  35,  35,  35,
-172, 172,  32, 175, 175, 175,  32, 175,  44,  32, 175,  32, 175, 163, 172,
- 32,  32, 163, 163, 163,  32,  32,  47, 163, 163,  47, 172, 163, 172, 163,
-172, 163, 163, 175, 172, 175, 172, 163, 163,  44, 163,  44, 163, 160, 175,
- 32,  41,  44,  35, 163,  35, 175, 172, 175,  32,  44, 163, 163,  44,  35,
- 44,  44, 172,  44,  35, 172, 163, 160,  32, 160,  35,  32,  35,  35, 172,
- 35, 163,  44, 163, 160, 172, 172, 172,  35, 172,  32, 163,  44, 163, 160,
- 32, 163,  32, 172,  32, 172, 175,  32,  44,  44, 160,  32, 172, 160, 163,
- 47,  35,  47,  35,  35, 160, 175,  44,  32,  32, 163, 160,  35, 163,  32,
- 32, 172, 172, 175, 160,  32,  35, 172, 175,  32, 175,  44,  32,  35, 160,
- 47, 163, 172,  47, 175, 175, 175,  32, 172,  32,  44, 163,  44, 175,  44,
- 47,  32, 175, 163, 175, 163,  35,  32,  44,  35, 175,  32,  35,  44, 160,
- 44,  35,  35, 175,  47, 172,  35,  44,  44, 163,  32,  47,  32, 163, 172,
-172, 160, 172, 175, 172, 175,  32, 160, 172, 160,  35, 175, 175, 175,  35,
-160, 172,  44,  32, 163, 172,  44,  44, 175,  32,  47, 172,  32, 172, 175,
- 44, 175, 175, 175, 163, 163, 172, 163, 175, 163,  44, 163, 172,  32,  32,
- 35,  32, 172, 172, 166, 172, 122,  32, 172,  35, 160, 175,  32,  32,  32,
-172, 163, 163,  44,  44, 163, 160,  35, 172,  35,  35, 163, 163,  32, 172,
-172,  35, 172,  32,  44, 175, 172,  38,  35,  32, 175, 175, 163, 172,  32,
-172, 160,  33,  44, 166, 163,  44,  47,  35, 163,  44,  35, 175, 172,  35,
- 44,  35,  32,  32, 175, 166,  35, 163, 163,  32,  47, 175, 172, 160, 172,
-163, 175,  32, 175, 163,  35, 172,  35, 175,  32, 175, 163,  32,  44,  32,
- 32,  32, 163,  44, 172, 163,  32,  35,  44,  35, 163, 163,  33, 166,  35,
- 35, 175,  44, 175, 166, 172,  32,  32,  44,  44, 160,  32, 163, 163, 175,
-172,  44,  32, 166,  44,  32,  32,  35, 163,  44, 172,  44,  35,  35, 175,
- 44, 172, 172,  44, 163, 175,  47, 172,  32, 172,  35, 175,  44,  32, 172,
- 47,  38, 172,  32,  44, 161,  32, 172,  32,  47, 175,  32, 175, 163, 172,
- 44, 172, 160, 172,  35,  35, 175, 161, 163,  32,  32,  45,  32, 175,  32,
-172, 163,  35,  32, 172,  47,  32, 175, 163, 163, 175,  32, 122,  35, 175,
- 35,  35, 163, 163, 175,  44,  35, 163, 175,  44,  35,  32, 172, 163, 172,
-163, 122, 163, 175, 172,  35,  35, 175,  33, 163,  35, 175, 163, 175, 172,
-163, 163, 122, 163, 172, 175, 172,  44, 172, 166,  35, 175, 175,  35, 163,
- 35, 160, 163,  44, 172, 163, 163, 172, 160, 172, 163, 175, 163, 172,  47,
-163,  32, 173, 163, 163,  32, 160, 166,  35, 175, 172, 160,  35, 172,  47,
- 32,  38,  32,  47, 166, 172, 172, 163,  47,  35, 160, 166, 160, 172, 166,
- 32,  47, 163,  32,  35, 172,  32, 173, 122, 172,  44, 166, 173, 161,  35,
-172,  35, 172, 163, 160, 172,  32,  44, 163,  44, 175,  44, 172, 175,  32,
- 44, 175, 175, 172,  32, 172, 172, 175, 122,  44, 172, 175, 172,  33, 175,
-163, 175, 175,  32,  47, 172, 163, 173,  35,  44, 163, 160,  35,  47,  32,
- 44,  32,  32, 163, 172, 175, 163,  44, 160, 172, 163, 175,  35, 175, 172,
- 35,  35, 163, 172,  44,  44, 172, 160, 172, 163, 172, 172,  47, 172, 173,
- 33, 175,  32, 175,  44,  35,  35, 175, 172,  32,  44,  32,  35,  35, 172,
-163, 160,  32,  47, 163,  32, 160, 172, 175, 175,  32,  35, 172, 163,  35,
-166,  44, 172,  32, 175, 163,  35,  44,  32,  44, 175,  44, 163, 163, 163,
-163,  32,  32, 175, 160,  47,  44, 172, 160,  47,  35,  35, 163,  32, 163,
- 35, 163,  32,  35, 172,  38,  32, 175, 172, 172,  35, 172,  32, 163,  35,
-160, 172, 175,  38, 175, 160,  32, 172, 163, 163, 172,  35, 172,  35,  44,
-173,  35,  33,  32,  35,  33,  32,  32,  32, 122, 175, 163, 175,  32,  35,
-175, 163,  32,  44,  32,  38,  32,  44,  32,  44, 175, 160, 166, 163,  44,
-172,  32,  32,  32,  35,  38,  44,  35,  32,  47, 163,  44,  44, 172, 163,
- 47,  35,  32, 163, 163,  47, 160, 163, 175, 163, 175, 122,  35, 163, 172,
- 47, 172, 175,  35, 175, 122,  38,  33, 173, 166,  33, 166, 175,  33,  38,
- 35, 163,  32, 163,  44, 163, 163, 160, 163,  32,  35, 175,  45,  44, 172,
- 33, 163,  35,  32,  35,  32, 160,  47, 161,  44,  44,  35,  47, 172,  32,
-166, 163, 172,  32, 163, 172, 122,  44,  44,  32, 163, 173, 166, 163, 172,
-160, 175, 163,  33, 172,  35,  32, 163, 175, 166, 175, 175, 175, 163, 122,
- 35, 172, 175,  44,  44,  35, 172,  44,  47, 172,  44, 160, 172, 172, 172,
-175,  35, 163,  35, 172,  32,  44, 163,  44, 172,  47,  35, 163,  35,  35,
- 47,  44,  35, 163, 122,  32, 172,  38, 172, 163, 122, 163, 173,  38, 173,
-172,  44, 163,  35, 160,  32, 163,  32,  35, 161, 172,  32, 160, 175,  32,
- 32, 175, 160,  44, 175, 163, 172,  44, 122, 175, 172, 163,  32, 173, 163,
- 44, 172, 172, 163, 175, 175,  35,  33, 175,  33, 163, 122, 163,  32, 172,
-166,  32,  35,  45, 172,  35,  35, 160, 172, 172, 166,  38, 173,  44, 175,
-175,  35,  38, 166, 172, 160,  35, 163, 163, 166, 172, 175,  35, 160,  35,
-163,  38, 163,  32, 160, 163,  35,  44, 172,  33,  35, 166, 160, 161, 163,
- 35,  35, 175, 166, 172,  35, 166,  45, 163, 163, 161, 172,  35,  44,  44,
- 44,  44,  35,  32,  35, 163,  35,  32,  32, 160, 163, 172, 175, 160, 160,
-166, 160, 163,  38, 175,  33, 175, 166,  44, 122, 163,  47,  33, 166,  35,
-173, 175,  35, 175,  32,  35,  44, 172, 172,  45,  44, 172,  38, 172, 172,
- 33,  47, 122,  32, 163, 160,  35, 173,  33,  32, 163, 163,  44, 122, 163,
- 44,  35,  33,  47, 161,  32,  44, 161, 166,  44, 175,  38,  35, 175, 172,
- 44, 175, 172, 172,  32, 166, 175, 163,  35, 122, 172,  32, 175,  44, 163,
- 44, 175,  44,  32,  32, 161, 163,  44,  38, 172, 163,  35,  38,  47,  38,
- 35,  33, 163,  44, 172,  32, 173, 173, 175,  38, 163,  38, 166, 163, 172,
-163, 175, 166,  35,  38, 160, 175,  44,  47,  45, 175,  44, 173, 175, 172,
-163, 163, 172, 163,  32,  32, 160,  35, 173,  44, 122, 163,  32,  44, 163,
-175, 175,  33,  44,  33,  32, 163,  33, 163,  35,  38,  32,  35, 122,  32,
- 32, 163, 163, 163, 166,  35,  47,  33,  47, 166, 173, 160,  33,  44,  32,
- 35, 163,  38, 166, 175,  44,  47, 166, 172, 172, 163,  32,  44, 166,  32,
-175, 160, 173,  33, 172,  45, 122, 172, 175, 161, 163, 172,  38, 175,  44,
-172,  32, 173, 173,  32, 160,  32, 160, 172, 172, 172, 163, 122, 166,  44,
- 35,  35,  32,  32,  38, 122, 163,  35, 122,  38,  32,  38,  44,  47, 166,
- 35, 172,  44,  32, 172, 175,  32,  33,  32, 172,  35, 175,  32, 175, 172,
-172, 160, 122,  35, 172, 172,  44, 166,  44, 172,  35, 163,  35, 175, 166,
-166,  44, 163,  38, 122, 175,  32,  44, 122,  44, 175,  35, 122,  44, 175,
-166,  33,  35, 173,  38, 166,  38,  44, 172, 160, 166,  44,  33,  35,  33,
-163, 175, 160, 166, 122,  32, 173,  35,  35,  32,  32, 175, 163, 173, 175,
-175,  35,  44, 163, 163, 173, 163, 163,  35, 172,  45, 163, 163,  32, 163,
- 44, 163, 172, 175, 172, 160, 172,  38,  33, 175, 163,  33, 166, 175, 161,
- 47, 173, 122,  44, 163, 161,  38,  32, 122, 163, 161, 163, 160,  32,  35,
-175, 166,  33,  35,  47, 122, 175, 175, 122,  32, 163, 172, 175, 160, 163,
-172,  44, 166, 163, 175, 163, 160,  33, 160, 160,  44,  35, 173, 163, 173,
- 32, 175,  35, 160,  35, 172, 163, 163,  35, 175, 175, 163,  32,  44, 173,
- 35, 172, 175, 163, 122,  44, 172,  38,  35, 172,  32, 163, 166, 163,  32,
-122, 160, 122, 175, 122, 172, 163, 166, 175,  35, 166,  32, 161,  32, 166,
-173, 166, 172,  32, 160, 255, 172,  35, 172, 161, 163, 160,  38, 173, 163,
- 35, 163, 173, 160,  33,  33, 172,  35,  38,  33, 166,  35, 163, 175, 161,
-166,  33, 163, 163,  32, 163, 161, 166, 161, 166,  44,  44,  35,  38, 160,
-173, 122, 163,  47, 175, 175, 163,  44, 122, 163,  44, 175, 163,  35, 175,
-163,  32, 175, 163, 172,  35,  33, 166, 175, 163, 175, 175, 166, 166,  38,
- 32, 163,  35,  47,  33, 163, 122, 172, 160,  35, 175, 161,  35,  33, 175,
-175,  47, 166,  44,  32,  38,  32,  47,  32,  32, 172, 163,  38,  47,  32,
-163,  33,  35, 172, 163, 175,  35,  35, 175, 163, 172, 163,  32,  35,  47,
- 44, 172, 163, 173, 172, 172, 122, 175, 166, 163, 175,  32, 166,  32, 173,
-172, 175, 161, 166,  38,  32, 166, 172,  35, 163, 172,  33,  45, 166, 172,
-172,  47,  33,  35, 161, 173, 122, 122,  44, 160, 166, 163, 166, 166,  33,
- 47,  35,  44, 163, 175,  38,  44, 163,  33, 122, 166,  35, 173,  35, 160,
-122,  33, 175, 161,  35,  32, 122, 166,  32, 122,  44, 173, 122, 175,  47,
-163, 163, 172,  45,  35, 163,  44, 160, 175, 166, 172, 122,  38, 172, 122,
-122, 173, 122,  38, 172,  32,  32, 122,  35, 172,  44, 163,  35,  44, 173,
-163, 163,  47,  44,  35,  33, 161, 161, 122, 172, 166,  32, 175, 163,  35,
- 32, 166,  32,  35, 172, 166,  38, 163, 161,  44, 173, 160, 163,  38,  38,
-166,  38, 122,  35, 163, 122,  44,  38,  33, 172, 172,  35, 175, 163, 166,
-172, 163,  44,  38, 122, 166, 166, 173, 163, 163, 175,  45,  32,  44, 160,
- 35,  38, 163, 166, 163,  35,  32, 172,  44,  32,  38,  35, 172,  38, 122,
-160, 172, 161, 161, 172, 161,  33,  45, 173,  44,  38, 175, 173, 175, 160,
- 44,  45, 163,  44, 163, 172, 166,  44, 175,  38, 172, 173,  44,  44, 122,
-163,  32,  33,  33,  35, 175, 163, 161, 172, 163,  47, 172,  35,  35,  35,
- 35, 122, 173, 160, 175,  44,  33, 122, 160, 122, 166, 163, 166, 166,  38,
-175, 175, 172,  47, 163, 166, 175, 161,  38, 175, 175,  38, 122,  44, 122,
- 33, 161, 172,  38, 173, 163,  32,  47,  44,  38, 166, 122, 166,  38,  35,
- 32,  32,  38, 163, 166, 173, 166, 173, 160, 166,  44, 175,  33, 173, 122,
-172,  44, 163,  44,  35,  35, 122, 175,  32,  32, 160, 175,  35,  32, 163,
- 33, 175, 173, 163,  33,  32, 166, 172,  35, 173, 172, 166,  44,  38, 163,
- 44, 166,  47, 122, 175, 166, 175,  38, 175, 173,  32, 166, 172,  33, 166,
-163,  32,  33,  32, 166,  32, 175, 172, 163,  33,  44, 173, 166,  35, 173,
-175, 163,  45, 160, 166, 175, 172,  33,  38,  33,  35,  33,  33,  33,  32,
- 38,  32, 163,  38, 122, 172, 175,  45,  44,  32,  44, 163, 172,  35, 163,
-166, 175, 166,  44,  47,  47,  35, 173,  45, 163, 163, 163, 122,  33, 163,
- 35,  32, 172, 163, 175,  32, 122,  33,  35, 166, 161, 161, 175, 163, 172,
- 35, 173, 173, 160, 166,  35,  35, 166,  47,  33,  35, 166, 163, 175, 173,
-163,  44,  38, 163,  38,  45, 122, 122, 122, 166,  45, 122, 163,  35,  33,
-173, 122, 172, 160,  35,  35, 172,  33,  32,  32,  44,  32,  32,  35, 175,
- 38, 172, 163, 172, 160, 166, 173,  45, 122, 173,  44, 163,  44, 122,  32,
-175, 166,  44,  32, 166,  47, 163,  38, 163, 122, 175, 122,  35, 163, 173,
- 32, 122,  35,  32, 172, 161,  32,  35, 163, 166, 175,  35,  44,  32, 173,
-173, 173, 172, 166, 175, 172, 163,  35, 161, 163,  33, 160, 122, 172, 160,
- 44,  45,  33,  33, 163,  35, 166, 175,  44,  32, 166,  32,  35,  38,  33,
-163,  32, 160, 172, 163, 175,  44, 166, 173,  38,  45,  44, 166,  38, 172,
-122, 173, 163, 173, 175, 166, 161,  32, 161,  33, 122, 160, 175,  32,  44,
- 38, 175, 122, 173,  32, 163, 122, 122, 173,  33, 163,  44,  47, 173, 172,
-172, 166,  47, 172,  32, 163,  38,  33,  33, 173,  38, 175, 163, 166, 175,
-160, 172,  38, 173, 163,  44, 175, 163,  38, 175, 163,  44, 122, 172, 161,
- 38, 166,  33, 172, 166, 161,  32, 166, 163, 161, 172,  33, 160,  32,  44,
-173, 163, 161, 161, 173, 122, 122,  32,  44, 166,  32, 160, 173,  44, 175,
- 35, 166, 160, 122,  33,  44,  35, 172,  32, 175, 175, 166, 163, 173,  38,
-172, 166, 166, 166,  47,  35, 172, 175,  33,  35, 166, 166,  33,  38,  44,
- 47,  32,  35, 163,  47, 122, 166,  44, 172, 173,  38, 173, 166,  38, 166,
- 44, 175, 163,  45, 173, 166,  32, 175,  38,  35,  33, 122, 163, 163, 122,
-173, 122, 166,  38,  47,  33,  44, 173,  33, 163,  33,  38,  32, 122,  47,
-163,  38, 172,  35, 161, 166, 163, 172,  33, 166, 172, 160, 173, 172, 175,
-163,  33, 166, 166, 122,  33, 166,  32, 172,  35, 161,  32,  32, 166, 163,
-166, 166,  35, 173,  38, 166,  47,  33, 173,  38,  38,  44, 161,  35,  32,
-166, 122,  44,  38,  44,  44,  35, 172, 122, 166,  38, 166, 163, 173, 122,
- 33, 173,  35, 160, 160, 172,  38, 173, 163, 163,  35, 161, 166, 166, 122,
-175,  38, 173, 172, 122, 163,  33, 173, 173, 161, 166, 163, 166, 166, 175,
- 33,  38,  38, 166,  47,  32, 166,  32, 163, 163, 172,  44,  47, 122, 166,
- 32,  33, 166, 122,  44, 175, 122,  44,  33, 166, 163, 122,  47, 161, 173,
- 33, 166, 163, 175, 173, 161,  33,  35, 122, 175, 175, 173,  32, 175,  33,
- 38,  38,  44,  45, 160, 173, 160,  32, 166, 173, 122, 122,  38, 122, 161,
- 35,  45, 160,  32, 173,  35,  44, 166,  38, 163,  45, 163, 163,  44, 166,
-122, 122, 160,  35, 166,  33, 172,  35, 166,  32, 173, 172, 175, 175, 160,
- 38, 172, 175, 172, 122,  33,  47, 166, 175, 175, 173,  38, 173,  33,  35,
-173, 160, 161, 166, 122, 122, 166, 163, 166,  38, 166, 175, 122,  33, 166,
- 33, 122,  38, 172, 163, 173, 122,  35,  35,  32, 166, 122, 173, 175,  44,
-172,  33,  35, 173, 172,  38, 166, 172, 122,  33, 160,  33, 173, 163,  32,
- 35, 163,  47,  44,  32,  33, 173, 163,  44, 175, 172, 163, 163,  38, 172,
- 33,  45,  33, 173,  33, 166, 173, 166, 122,  32, 175, 173, 175, 166,  47,
- 33,  33, 161, 160, 160, 161, 173,  45, 166, 163, 175, 172,  45,  35, 166,
- 38,  47,  32, 166,  47, 173, 166, 175, 166, 172, 122, 172, 163, 166, 122,
-166, 163, 163, 163, 122, 166,  38,  47, 173, 163,  33, 173, 122,  38, 172,
- 32,  44,  38, 173, 122, 166,  33,  38, 163, 122, 161, 161, 122,  38,  35,
- 47,  33,  38, 161,  47,  33, 163, 166, 163, 173,  35,  35, 175,  33, 163,
-175,  47, 163,  45, 166, 163, 166, 175,  47,  38,  38,  38, 161,  33,  38,
- 33, 163, 163, 160,  35, 173, 175, 173,  38,  32,  32,  33, 175,  35, 161,
-166, 173,  35,  44,  35,  32,  38, 166, 122, 172, 166, 122, 173,  38, 172,
- 44, 173,  44, 166, 173, 173, 122, 160, 122, 173,  38, 172,  38, 122, 173,
-163,  32,  38, 173,  38, 166, 173, 166,  38, 161, 163, 163, 166,  33, 160,
-122, 161, 175,  47,  32,  33,  44, 166, 160, 122, 161,  32,  38,  38,  45,
-166, 122, 166,  33, 166, 166,  33, 122,  45,  38, 173, 166, 122,  33, 122,
-163,  35, 122, 161, 160,  35,  45,  38, 161, 122, 161, 166, 161, 173, 166,
- 33,  38, 166,  47, 163,  35, 160,  33, 160, 122, 173,  44,  47, 161,  44,
-175,  32, 173,  33,  47,  45, 166,  38, 173, 163, 160, 122, 160, 173, 172,
- 38,  38, 172,  33,  33,  44,  38,  38,  33, 166,  38, 122,  44, 172, 175,
-173,  32,  32, 166, 166, 163, 173, 173, 122, 175,  33,  33, 122, 166, 160,
- 33,  32, 161, 172,  33, 163, 173,  33, 166, 166, 173, 166, 166,  33, 175,
-175,  44,  33, 160, 172, 173, 175, 163,  33, 163, 166, 122, 163, 161,  32,
-166,  44,  47, 166, 173, 122, 173,  32, 173, 173,  32, 173, 163,  33, 172,
- 44, 122,  35, 163,  32,  38,  35, 173,  33, 166, 122, 166, 172,  32, 173,
- 44, 173,  35,  35, 122,  38,  33, 161, 122, 173,  44,  33, 163, 175, 172,
-173, 166, 166, 173, 163, 163,  47, 160, 166,  33, 163, 122, 173, 173, 160,
-173,  38,  35,  33, 122,  38, 173, 122, 163,  44, 166,  47,  44, 122,  32,
-161, 166, 122,  38, 166, 161,  45, 161, 160,  44,  38, 160, 122, 122, 161,
- 32,  35, 122,  33,  33, 172, 166, 166,  32, 122, 166,  45, 163,  33, 161,
-172, 173,  38, 173,  33, 173, 166, 166,  38, 173, 161, 173, 122, 166,  44,
- 44, 173, 166,  33, 175, 122,  33, 166, 161, 122, 166, 166, 166, 122, 166,
-161, 161, 172, 122, 166,  33, 163,  38,  45,  47, 122, 122,  35, 175, 163,
-122, 122, 173, 163, 122, 122, 122, 166, 173, 161,  38,  45,  33, 173, 172,
-166,  33,  38, 122, 166,  33,  38,  33, 173, 175, 122, 166,  45,  44,  38,
-172,  32,  33, 122, 161, 122, 166,  33,  33, 173, 160, 175, 173, 175,  44,
- 38, 122, 122, 173, 166,  44, 122, 166,  33,  38,  45, 166, 173,  38, 172,
- 45,  38,  38, 166,  47, 173,  44, 163, 173, 173,  44,  33,  44, 172,  32,
- 33,  38, 173, 173, 163, 122, 172, 166, 166, 173,  38, 122,  44, 173,  45,
-173, 173,  33, 122, 163, 160, 163,  44,  33, 161,  44, 166,  38, 161,  33,
- 38, 160, 173,  33, 173, 166, 122, 163,  44,  33, 122, 163, 160, 173, 166,
-122,  38, 255,  33,  38, 172, 166,  32, 166,  35,  38,  44, 166, 160, 163,
- 35,  38,  38, 122,  44,  44, 160,  38,  33,  33, 122, 160, 173, 173, 163,
-166, 161, 166,  38, 122, 122, 160,  38,  38, 122, 166, 172, 161,  33, 122,
-175, 163,  38, 122,  38, 166, 163,  38,  33, 166, 173,  33, 161,  33,  33,
- 32,  33, 122,  38, 160, 173, 173,  38, 160, 161, 166, 173, 166,  33, 122,
-161,  32, 166,  33, 166,  35, 166, 166, 172, 166,  47, 122,  38, 173, 161,
-163,  35, 166, 173,  38,  38, 166, 173, 122, 166, 122,  45, 175, 122, 166,
-172,  33, 166, 173,  33, 160, 166, 166, 122, 173, 173, 160, 166, 161, 173,
-166, 161, 122,  32, 166,  45, 166,  33,  35,  33, 161, 172, 163, 160, 172,
-122, 166, 122, 173, 122, 173,  33, 163, 173,  44, 163,  33,  32, 161, 166,
- 33, 122, 175,  33,  45,  38, 166, 173, 122, 166,  38, 122, 173, 122,  33,
- 47,  33, 173,  33,  38, 172,  35,  33,  33,  33,  38, 166, 122,  32, 122,
-173, 166, 122,  33, 163, 173,  35, 166, 122, 163, 122,  45,  38,  38,  44,
-166,  33, 173,  38, 161, 163,  38, 173,  38, 173, 175, 122, 173,  33, 122,
- 38, 173, 122, 173,  38,  33, 163, 173, 166,  38, 163, 173,  33,  38, 173,
-173, 166,  38,  45,  38, 161, 166, 122,  44, 122, 172, 122, 175, 175,  45,
-173, 166, 122, 166,  44,  35, 173,  33, 161, 173,  33, 122,  38, 163,  32,
-122,  33, 173, 163,  44, 166, 161,  44, 173, 163,  38, 173,  47, 173, 122,
-122, 173, 160, 122,  33, 173,  38, 160,  38, 166, 166, 175, 173, 160,  38,
-166,  44, 166,  38,  44,  45,  38, 173,  35, 166, 160, 163, 173, 166, 160,
- 38, 173,  38, 175,  38,  33, 166,  32, 173,  33, 166, 173,  35, 122, 163,
-166, 122, 175, 173,  38, 161,  32, 163,  47, 173, 173, 122,  35, 122, 173,
- 47,  38,  44,  44,  33,  32, 166, 173, 175,  38, 166, 172,  33, 173,  45,
- 32, 166, 166, 161, 173,  33, 161, 173,  33, 166, 166,  44, 166, 161, 122,
-160, 173, 166, 172, 175, 166, 166, 166,  33, 163, 172, 161, 166, 122, 166,
- 44, 161, 173, 173,  38,  38, 163, 160,  38, 166, 160, 122,  38, 163, 172,
-161, 166,  44, 173,  33, 166,  33, 166, 122,  38, 122,  38, 160, 173,  33,
-161, 122, 122,  38, 173, 166,  45,  38, 166, 173, 122, 122, 173,  45, 122,
-166,  45, 173,  45, 173, 173,  38,  35, 166,  33, 163,  33, 166, 122, 166,
-160, 172,  38, 166, 175, 161,  33, 161, 166, 166,  33, 160, 173, 175,  38,
-122, 173,  33, 122,  38,  32, 166,  33, 166, 166,  33, 166,  38, 173, 166,
- 45,  38,  47,  45, 173, 122, 173,  45, 166,  33, 166, 163, 122, 161,  38,
-166, 163,  38,  33, 163,  44, 172,  33,  38, 166,  33, 166, 173, 166,  38,
-163, 122, 166, 161, 166, 122,  33,  38, 122,  38,  38,  33, 173, 161, 173,
-166, 173, 160,  33, 173, 173, 163,  38, 122, 166,  33, 122, 173, 173,  33,
-166, 173, 122,  44, 161, 173, 166,  38, 173,  33, 173, 173,  47, 173,  44,
- 33, 122, 166,  35, 122,  32,  35,  33, 122,  33, 122, 122, 173, 163, 161,
-122, 122, 166,  38, 166, 122,  33, 166,  33,  38, 122, 122, 122, 166, 161,
-166,  38, 173,  38, 166, 160,  38,  44, 166,  38, 166, 173,  45, 166,  32,
- 33, 122,  33,  33, 173,  38,  33,  44, 161, 122, 173, 166, 166, 122, 122,
-122, 160,  33, 163, 173,  38, 166,  33,  47, 160,  33, 173, 173, 166, 173,
-166,  38, 173, 173,  33,  33, 173, 166, 173, 166, 166, 122, 166,  38,  38,
-166, 160, 166, 122,  33, 173,  33,  47,  38, 166, 163, 166, 173, 122,  47,
-166,  33, 163,  47,  35, 166,  38, 161, 163, 173, 166,  33, 160, 166, 161,
-122, 175, 122,  38, 163, 122,  45,  47, 122, 122,  45, 173,  44, 166, 161,
- 33,  33, 161, 122, 173,  33,  38, 122,  38, 160,  33, 166, 122,  38, 166,
- 47, 163, 166, 163, 166, 173,  38,  44,  33, 166,  38,  38, 166, 163, 160,
-122, 173, 163, 163, 166, 163, 173, 173,  33, 166, 122, 166, 173,  33,  44,
- 45, 166, 173, 161, 122, 161,  38,  33, 122, 122,  33, 166, 122,  33, 163,
-122, 166,  47,  33,  38,  47, 161, 166, 166,  47,  44,  33, 172, 161, 160,
- 45, 173, 163,  33,  33, 122,  38,  45, 173, 173,  33,  38, 161,  33,  33,
-161, 173,  33, 122,  33, 166, 166, 173, 166, 173, 161,  38, 161,  38, 166,
-166, 163,  33, 166, 161, 166, 166,  33,  38, 173, 173, 161, 166, 161, 122,
-161,  44, 122, 122, 173, 173, 166, 166, 166,  38, 173, 163, 122, 161, 122,
-122,  47, 173,  44,  33,  38, 163, 163,  33, 173, 122, 122, 163,  38, 161,
-166, 173,  44,  38,  33, 166, 167, 173, 161, 166,  45, 122,  33, 173, 122,
- 33, 166,  38, 122, 166, 122,  47,  45, 173,  33,  45,  38, 166,  33, 160,
-173, 122,  38,  45, 161, 173,  33, 122, 163,  38, 166, 173, 173,  33, 122,
-173,  38, 122,  38, 166, 122,  38, 163, 166,  33,  38, 161,  33, 160,  33,
-173, 160,  38,  44, 166, 166, 166, 122, 161,  33,  38, 160, 122,  38, 161,
- 38, 122,  47, 166,  33, 173, 160,  44,  45, 173,  44, 122,  45, 166, 122,
-166, 166, 166, 123,  38, 122, 166, 122, 173, 166,  45,  33, 122, 122, 161,
-166,  38, 173, 166,  38,  38,  38, 120,  38,  38, 161, 161, 173, 166,  45,
-161, 163,  38, 122,  33, 166,  33, 166, 173, 160, 160, 166, 166,  38,  33,
-166, 122,  33, 173, 122, 166, 166, 122, 166, 173, 122,  33, 173, 173, 173,
- 33,  33, 173, 173, 122,  38, 161, 173, 122, 173, 166,  33,  33,  45, 122,
- 45,  38, 166, 166,  38, 173, 160,  45,  38, 166,  38, 173, 120,  38, 173,
- 44, 122, 120,  33, 173, 163,  33,  38, 166,  38,  44,  38, 161, 161, 122,
- 45, 161, 122, 166, 122, 161, 166, 173, 166, 173, 166, 166,  38, 163, 173,
-173,  38,  38, 166, 122, 173, 173, 173, 122,  47, 122,  33,  33,  38, 166,
-166,  33, 166, 166,  47, 166, 166, 173, 161, 161,  33, 166, 173, 173, 122,
-166,  38, 166, 173, 173, 173,  36,  33,  44, 122,  45, 166,  33, 166, 161,
- 45, 173,  44,  47, 173,  33,  38, 163, 161, 166,  33, 173, 167, 122,  33,
- 38, 122, 166, 161, 122,  38,  38, 122, 161,  38, 160, 173, 122, 173,  45,
-161, 122, 166, 122,  33, 166, 166,  45, 123,  44, 122, 122,  45,  38, 122,
-123, 160, 160, 166, 173, 163,  44,  38, 166, 122, 166,  38, 166,  33,  33,
-163,  33, 166,  38, 161, 173, 160,  33, 167,  38, 166, 122, 166, 166,  33,
-166, 173,  33, 166, 166,  33, 161, 166,  38,  38,  38, 173, 122, 161, 173,
- 45,  33, 173, 122, 173, 166, 166, 122, 173,  45, 173, 173, 173,  33,  33,
- 44,  38, 173,  33, 173,  36, 166,  45, 166,  45, 166, 173, 163, 120,  45,
- 33, 163, 163, 122, 173, 122, 166, 173,  38, 166, 166, 173, 166, 122, 166,
-161, 122,  33,  38, 122, 173,  33,  33, 173,  33, 173,  38,  38, 160, 122,
-166,  33,  33,  38, 167, 161, 173,  38, 166, 166,  38, 173, 173,  33, 173,
-173, 173,  45, 160, 166,  33,  33, 173, 161,  38, 161, 120, 122,  47,  38,
-166, 166,  33,  33,  47,  33, 166,  38, 122, 166, 173, 122, 123, 161, 166,
- 33, 167, 173, 166, 166, 163, 161, 122,  45, 166, 120,  38,  38,  33, 166,
- 38, 166, 167, 166,  38, 122,  33, 166, 173, 167, 167, 173, 123,  33, 123,
- 38,  36, 166, 166,  45, 161,  33, 173, 166, 166,  33,  38,  33, 167, 166,
-166, 173,  45, 173, 173, 161, 166,  45, 122, 160,  38,  47,  36, 167, 122,
-122, 166,  47, 122,  33, 166,  38, 120, 173, 160, 173, 161, 160, 166,  38,
- 36,  38, 160,  33, 173, 166,  36, 161,  33, 166, 123, 122, 166, 122, 167,
-166, 166,  38,  38, 122, 166, 173, 120,  44, 122, 173,  33, 166,  36, 173,
-166, 160, 120,  36, 122, 166, 122, 122, 163, 173, 161, 122, 122, 163,  38,
- 38, 160,  38,  38, 161, 163, 173,  38, 122,  45,  33, 166, 166,  33,  38,
- 33, 160, 166, 166, 161, 166, 122,  33,  33, 161, 161, 161,  33,  33, 166,
- 44,  38, 122, 173, 166, 161,  33,  38, 122, 161, 161,  33, 173,  33,  33,
- 36,  38,  45, 173, 173, 122, 173, 173, 173, 166, 173, 122, 161, 161,  33,
-167, 173, 122,  38,  45, 123, 122,  38,  36, 123,  33,  38, 166, 122,  45,
- 33,  33, 166,  45, 166, 173,  33, 120, 122, 166, 161, 122, 123, 166,  33,
- 45,  45,  45, 173, 173, 160, 161, 166, 173, 173, 122, 173, 166, 173, 122,
-166, 160, 161,  33,  33, 167, 166, 173,  33, 173,  33, 122,  38, 120, 163,
- 36,  33, 166, 120, 166,  47,  38, 122, 166,  47, 161, 166, 161, 122, 173,
-173, 167, 122, 123, 122, 173, 166,  33,  38, 173, 173, 122,  38, 173, 173,
-123, 173, 122, 163, 161,  45,  38, 123, 160,  33, 167, 161, 123, 161, 123,
-173, 173, 161, 166, 122,  33, 166, 166,  38, 166,  33,  38, 166,  38, 173,
- 38, 160,  47, 167, 166, 166, 122,  33, 173,  45,  38, 166, 161, 173, 166,
-173,  33, 166, 166, 166, 173,  33, 166,  33, 166,  33, 123, 122, 166,  45,
- 44,  44, 166, 161, 166,  36, 166, 122,  33, 173, 160, 166, 161, 123, 173,
-167,  38, 123, 167,  45, 161,  38,  47,  45, 163,  33, 161, 123,  47, 173,
-122,  36, 173, 120, 166, 166, 167,  38, 173,  44, 173, 122,  38, 161, 166,
- 36,  38,  45, 173, 161, 166,  38,  33, 166, 122, 166, 161, 166,  38, 123,
-122, 173,  45,  33, 161, 166, 161, 166,  33, 123, 122, 173, 166, 166, 123,
-161, 166,  33,  38, 122,  38, 161, 123, 166, 167, 123, 120, 166, 167, 173,
- 33,  36, 161,  45, 173, 173, 122,  33,  33,  33,  33, 161,  33, 160,  38,
- 33, 161,  38, 173, 161, 122, 120, 173, 173, 173, 166, 166, 166, 122, 122,
-166, 166, 166, 166, 166, 166, 173,  33, 166, 173,  47,  38,  38, 173, 167,
-166, 166, 173, 161, 161,  33, 161, 167,  33, 122, 173, 122, 166, 166, 161,
-173, 122, 120, 173, 122, 122, 166, 161, 123, 173, 167, 122,  33, 166, 122,
- 33, 167, 166,  45,  38, 166, 122, 166, 166,  33, 163,  38,  38, 120, 161,
-166, 167,  33,  38,  33,  47, 160,  33,  38,  33,  47,  36, 123, 166,  36,
- 45,  33, 122, 173, 161, 166, 173, 161, 161,  33, 122,  38,  45,  33, 160,
- 44, 161, 161, 173,  45, 167, 166,  33,  36, 161, 122, 167,  38, 173,  38,
- 33, 167, 161, 166,  38,  38, 161, 166, 166, 173,  36,  33, 173,  38,  36,
-161, 173,  45, 166,  38, 166, 173,  45,  36, 173,  38, 166,  38,  33,  38,
-173,  38, 173, 173, 160,  45, 161, 122, 173,  36,  38, 166,  45, 166, 173,
-123,  36, 167,  38, 120, 167, 173, 120,  38, 166, 160, 173,  38, 173,  45,
-161, 161,  36, 161,  33,  36, 173,  33, 167, 166, 173, 166, 166, 122,  33,
- 45, 173,  33, 166,  44, 123,  38,  36,  33, 161,  38,  38,  33,  33,  47,
-123,  38, 166,  36, 160,  38,  38, 161, 120, 166, 173, 120, 166, 120, 161,
- 36, 166,  33, 167, 122, 122, 167,  33, 166, 161, 161, 122, 161, 167, 173,
-173, 167, 166, 166,  33, 166, 123,  33, 166, 166,  45, 161,  38,  45, 161,
-167, 161, 120, 120,  38,  38, 122, 161,  33, 161,  38, 122, 120, 166,  38,
-166, 161, 160,  36, 120, 167, 161, 167, 120, 120, 166,  38, 166, 161, 167,
-160, 161, 166,  38, 123, 160,  38, 166,  33,  33,  33, 167, 166,  38, 173,
- 33,  38, 122, 166,  47, 120, 167,  45, 123, 166, 173, 173,  38, 123,  33,
-123,  33,  47, 161, 123, 122, 122,  45, 167, 122, 173, 173,  45,  45,  45,
-166, 120,  33, 166,  33,  38,  33, 166,  33, 123, 166, 166,  38, 122, 166,
-173,  38,  45,  45,  47, 161, 173,  38, 160,  36, 173,  36, 166,  33, 160,
-166, 120,  36, 167,  33, 166, 161, 122, 161, 123, 166,  33, 166,  38,  33,
- 36, 161,  45, 120, 173, 120, 166,  33, 173,  36,  38,  45, 173, 161,  36,
-167, 167, 173,  36, 161,  36, 173, 173, 166,  45, 166, 161, 160, 167, 161,
-167,  33, 173, 167, 120, 166, 167, 167, 123,  38,  38, 161,  45,  36, 173,
-122, 122,  36, 122, 122, 166, 164,  38, 173, 167, 160, 123, 166, 166, 122,
-173, 166,  45, 122,  36,  45,  36, 122, 166,  38,  38, 166,  33, 167,  45,
- 33, 161,  45, 167, 122, 173, 161, 166, 166, 120, 120, 120,  38,  36,  33,
-166, 166,  38, 173,  33, 122, 123, 166,  45, 173,  38, 173, 161, 160,  33,
-166, 166, 122, 160,  38,  33,  33, 161, 167, 122,  38, 173, 173, 161, 120,
- 33, 123,  36, 173,  38, 167,  36, 122, 166, 166, 122, 167, 161,  33,  38,
-166, 173,  38,  47,  36,  33, 120,  38, 122, 122, 166, 160,  38,  38,  38,
-173, 167, 173, 161, 161, 166,  33, 166,  36, 167, 122, 161,  45, 122, 123,
-120, 166,  45, 166,  38, 120,  33, 173,  45, 120,  33, 255, 120, 173, 161,
- 45, 166,  45, 120,  38, 167, 122,  36,  38, 166,  38, 166,  38, 161, 122,
-161,  38, 167,  33,  38, 167,  33, 166, 161, 161, 166,  47,  38,  45, 161,
-164,  47, 161, 167, 173, 167,  36,  38,  33, 122,  36,  33, 123,  33, 161,
-161,  45, 160,  38,  38,  36, 173, 161, 161, 166, 122,  38, 173,  33, 161,
- 33,  45, 166, 123, 166, 122, 167, 166, 161, 173,  36,  45, 173,  47, 173,
-123, 166, 166, 173,  33, 161, 166, 166, 123, 167, 120, 166, 123, 123,  33,
-122,  38,  36,  47, 123, 122, 167, 120, 123,  36, 164, 164,  45, 120, 167,
-123, 120,  38, 120, 120, 166,  38, 122, 167, 123,  38, 173, 166,  47, 166,
- 38,  36, 122, 173, 166, 173, 166, 161, 166,  33,  33,  45,  45, 123,  33,
-166, 166, 166,  38, 173,  33, 166, 161, 123, 166,  38, 166,  36, 255, 123,
-122, 166, 167, 160,  45, 173, 120,  36,  36,  36, 120, 166, 122, 122,  38,
-166,  38, 164,  36, 161,  33, 166,  45, 161, 161, 166, 160, 161, 166, 173,
-164,  45,  45, 122,  38, 160,  38, 167,  45, 166, 173, 173, 120,  38, 161,
-161, 167, 167,  38,  36, 167, 166,  33,  33, 161, 166, 173,  45, 120,  33,
-123, 123, 167, 173,  36,  45, 123, 173, 161, 120, 120,  36, 120, 166,  38,
-166,  45,  33, 123,  36, 166, 161,  38, 161, 123, 120, 160,  38, 161,  33,
-120,  33, 173, 123, 120, 123,  45, 173, 120, 173, 120, 166,  45, 120, 161,
-173, 122,  38, 122,  36,  33,  45,  39,  45,  39, 122, 161, 122,  33, 120,
-160, 123, 122, 123, 167, 123,  36, 160,  45, 161, 167,  45, 167,  38, 166,
-166,  33, 173, 166, 167, 173,  38, 166,  36, 123, 122, 166,  45, 161, 161,
-166,  36, 120, 173,  36, 166,  33, 173, 166, 123, 161, 173,  45, 167, 166,
-122,  38, 173, 160, 122,  33, 161, 167,  45,  33, 120, 173,  33,  38,  36,
- 45,  36, 160, 167, 166, 120, 166,  38, 173, 120, 166, 120, 122, 167, 166,
-173, 123, 173, 161, 167, 123, 120,  38, 120, 173,  33,  38, 166, 167, 161,
-173, 166,  38, 123,  36, 122, 173, 164, 167, 120, 166, 166, 164, 122, 167,
-120, 166, 123, 122, 166,  36,  45, 167, 173,  45, 173,  33,  33, 166, 166,
-173, 120,  33, 166,  33,  36, 166, 160, 123, 167, 173, 173, 161, 164, 123,
-161, 161,  38, 164,  38, 122, 120, 166,  33, 166,  33, 161, 123, 173, 167,
-167,  45, 161,  36, 173, 164, 160,  38, 166, 120, 164, 173,  47,  45, 167,
-167, 120, 161,  36,  47, 160, 120, 123, 167,  38, 122, 161, 164, 167, 161,
-166, 166,  39, 173, 166, 173, 123,  45,  38,  36,  33,  33, 166, 123, 173,
-164,  33, 167, 173, 122,  47,  38,  33, 123,  36,  36, 122, 173, 161,  38,
-120, 123, 161, 123,  33,  36,  38, 122, 166,  38, 122, 120, 120,  45, 173,
- 45,  39, 167, 166, 120,  33,  38, 120, 161,  38, 120, 166, 123, 167, 123,
-167,  36, 167, 161, 161, 161, 173,  33, 166, 167,  38, 166,  38, 161,  36,
-161, 173,  39, 167,  33, 120,  45,  36,  38,  45, 123, 123, 120,  38, 173,
-122,  45, 166, 167, 120, 166,  47,  36, 123, 164,  45,  33,  33, 166,  33,
-167,  38, 122, 120, 167, 161, 123, 167,  36, 166, 122, 120, 166, 167, 167,
-120, 167, 166, 173,  45,  36, 122, 166, 161,  38, 161, 120, 161, 161, 167,
-160,  47,  47, 123,  36, 166, 161, 161,  38,  38,  36,  45, 161, 120, 167,
-166, 122, 166,  36,  38, 167,  38, 166, 123,  38, 166,  39, 160, 166, 173,
-161, 161, 167,  38, 167, 173, 161, 173,  47,  38,  39,  33, 167, 167, 166,
-164, 164,  45, 122, 164, 120,  36,  33, 167,  38, 123, 120,  39, 123, 160,
-166,  45, 123, 161, 166,  47,  38, 123,  36,  45,  36, 173, 120, 167,  36,
-166,  36,  38, 173,  39,  38, 120,  38, 161, 167, 173, 167, 167, 120, 122,
- 36,  33, 122,  38,  36,  33, 166,  38, 120,  36, 161, 120, 166, 161,  38,
-166, 161, 166, 166, 120,  45, 123,  36,  33, 164, 164,  36,  33, 123, 161,
-173, 166, 123,  33, 120,  47, 173, 120, 167, 164,  45, 167,  38, 122,  33,
- 36,  38,  33,  36, 122, 167, 122,  38,  36,  38, 164, 164,  36, 167, 167,
- 36, 173,  45,  36, 173, 123, 120, 164, 123, 173, 120, 123, 173, 122,  33,
-160,  38, 164, 173, 123,  38, 123, 120, 123,  33,  33, 122, 167,  33, 123,
-173, 123, 167,  38, 167, 166,  36, 161, 167, 167, 120, 161, 120,  36,  38,
-173, 161,  33,  36,  45, 160, 120, 123, 123, 166,  47,  33, 161,  45, 164,
- 47,  45, 161,  39, 166, 167, 173, 120,  38,  38, 161,  38, 167,  45, 173,
-164,  36, 167, 122, 123,  36,  33, 120,  38,  39, 173, 167,  36,  33, 167,
-120, 166, 123, 167, 167, 120, 166, 173, 120, 167, 123, 164,  36, 161,  38,
-166,  45,  33, 167, 164, 120, 173, 164, 166, 167,  38,  39, 167,  36, 120,
- 39, 122, 166, 123,  47, 164,  45, 123, 123, 164, 166, 167, 164,  36, 161,
-120,  36, 161, 120, 123,  36,  38, 161, 167, 164,  36,  36,  38, 164,  45,
- 45, 166,  47,  36, 120, 167,  47, 122, 164, 173, 161,  38, 120, 120, 120,
-167, 120, 120,  36, 167, 161, 123, 161,  36, 123, 120, 167,  38,  33,  33,
-120, 167,  38,  38, 161, 161,  36, 167, 161, 123, 161, 161, 167, 120, 164,
-173, 120, 122, 123, 161, 173, 122, 120, 123, 161, 166, 166, 161, 161,  39,
-161, 164, 161, 167, 173, 173, 123,  45, 122, 120, 120, 123, 173, 120, 123,
- 39,  38, 120, 120,  33, 122, 167,  45, 161, 173,  45,  45, 166, 167, 122,
-173, 173,  36, 123,  33, 166, 161,  45,  45, 123,  36, 167, 123,  33,  45,
- 33, 173, 167, 160,  45, 164, 123, 122, 166,  45, 167, 166,  38, 120, 123,
-166, 164, 161,  45,  36, 166, 161, 164, 167, 173, 120, 164,  38, 120,  39,
-122,  36,  36, 166, 122,  38,  39, 123, 167,  36, 164, 166, 123, 120, 161,
-164,  33, 120,  33, 161, 122, 123, 120, 166, 164,  36, 167,  36,  38, 120,
-160, 120, 160,  36, 167,  39,  36, 120, 167, 161, 173,  36, 120, 123, 166,
-123, 120,  45,  36, 123,  38,  36, 123, 123, 123, 161, 167,  33, 122, 161,
-164, 120, 122,  36,  47, 164, 166, 122,  45,  38,  33,  39, 167,  33,  36,
-166,  36,  45, 167, 122, 122, 167, 173, 167, 167, 161, 164, 123, 167, 167,
-167, 167, 166, 173, 123, 166, 161, 160,  39, 120, 173, 161, 123,  38, 164,
- 45, 120,  36, 167,  36, 120,  45,  45, 120, 123,  38, 120, 123, 120, 123,
-160, 167,  36,  33, 122, 167,  45, 164, 161, 167, 161, 120,  36,  33, 166,
-173, 160, 164, 173, 166, 164, 120, 123, 167, 164, 161,  39, 161,  36,  45,
-123,  38, 161, 161,  45,  39, 167,  39, 161, 123,  39,  36, 164, 120,  36,
-167, 161, 161, 167,  36,  33, 120,  47,  45,  36,  38,  47, 123, 123,  47,
-161, 166, 123, 167, 122, 167, 120,  36, 161, 173, 164, 123, 164, 120, 166,
- 36,  36, 161,  33, 164, 160, 120, 120, 123, 123, 167,  47, 164, 123, 166,
-167,  45,  36,  45, 164,  36, 166,  45, 122, 122, 164, 166,  45, 167, 167,
- 39,  38,  36, 167,  36, 166, 167, 120, 167, 167,  33, 166, 161, 166,  36,
-164, 161, 161, 164,  36, 173, 167, 167, 123, 120,  47, 123, 164, 123, 160,
-123,  45, 161, 166, 167, 173,  33, 164, 166,  36, 120,  36,  36, 123, 122,
-161, 122,  38, 123, 120, 161,  33,  38, 120,  39,  36, 167, 161, 160, 120,
-164, 164,  36, 120,  36, 164,  39, 120, 164, 166, 173, 167, 123, 120, 164,
-164,  38, 123,  39, 167,  33,  36,  38, 164, 123, 161, 161, 167, 166, 164,
- 36,  39, 164,  33, 167, 166,  45, 120, 161,  36, 123,  36, 173, 164, 167,
-167,  45, 167, 167, 173,  36,  36, 167, 120, 123,  39, 123,  38, 161,  33,
- 33, 164, 164,  47,  36, 164, 122, 161,  36, 120,  47,  36, 161,  38, 173,
-166, 160, 120, 166, 161, 166, 120, 161, 167, 173,  38,  33, 161, 161, 173,
-167,  36, 167,  45, 167, 123, 164, 166, 167,  47, 166, 167, 120,  39,  38,
- 36, 160,  36, 164, 123,  45, 166, 160, 120, 167, 166,  39, 161, 120, 164,
- 36, 123, 160, 120, 173, 120, 173, 173, 173, 166, 166, 166, 161,  39, 122,
-167, 161, 120,  36,  38,  39,  38,  36,  36, 167, 167, 164, 120, 173,  39,
-167,  33, 120, 167, 161, 161,  39,  36,  38, 164,  45,  33, 120, 167,  45,
- 36, 122,  45,  36, 164,  36,  39, 120, 167, 173,  39,  36, 167,  38, 161,
-164, 161,  36,  36, 167, 120,  39,  47, 167,  33, 166, 167, 161,  36, 120,
-167,  36, 164,  39, 123,  38, 164, 161, 123, 123, 167, 164, 164, 164, 161,
-166, 167,  36, 167, 122,  39, 164, 161, 123,  45,  38,  36, 123, 160, 120,
-166,  45, 123, 122,  36, 173, 123, 164, 166, 167,  33, 167, 123, 164, 164,
- 36, 120, 161, 161, 122, 166,  36, 123, 123, 122,  36, 166, 123, 123,  36,
- 33, 120,  47, 120,  33, 123, 167,  36, 167, 167, 160, 160, 123, 123, 164,
-123,  36, 167, 164, 164, 160,  39, 166, 123,  36,  39, 167, 120, 120,  47,
-167, 164, 164,  47, 167, 161,  36, 120,  36, 164, 164,  38,  38, 161, 120,
- 45,  39, 167, 167, 123, 120, 160, 167,  45, 161, 167, 164,  36, 120, 164,
-161, 166, 123, 164,  36, 161, 120,  33,  36,  36, 123, 122, 123,  45,  39,
- 45, 122, 167, 167, 173,  39,  36,  47, 122, 123,  36, 167, 167, 167,  36,
- 45,  36, 120,  45,  45, 164,  45, 120, 123, 123, 167, 120,  36, 123, 164,
-120, 164, 123,  38, 167, 167,  39,  36,  39, 161, 166, 120, 166, 166,  45,
-123, 167, 167,  36,  38, 120, 167, 123,  36,  47, 167,  38,  36, 164, 167,
- 36,  36,  36,  39,  33,  38,  45, 123,  33,  33,  36, 161, 167, 167, 167,
-120, 167, 161, 173, 120, 120,  39, 123, 123,  36,  36, 123, 123, 164, 120,
-167, 120, 123, 164, 167,  39, 164,  36, 164,  39, 161, 120, 161, 160, 120,
- 36, 167, 123, 122, 167,  39, 164, 167, 120,  39, 123, 166, 160, 166, 120,
-167, 123, 167,  36, 160, 167, 167, 123,  36, 164, 161, 120, 166, 120, 167,
-167, 164, 120, 120, 123, 167,  36, 167, 164,  36, 161,  38, 164, 123,  39,
-164, 167,  36, 166,  38,  36, 164, 167, 164, 164, 167,  39,  39, 166,  45,
-164, 167,  36,  39,  36,  36, 164, 161, 161,  38, 167,  39, 120, 164,  33,
-164, 167, 120, 164, 120, 123,  39,  45,  45, 161, 161, 164,  38, 167,  39,
- 36, 167, 167, 123, 173, 123,  45,  45,  38,  39, 120,  36, 120, 167, 167,
-167,  36, 120, 167, 123,  47, 123, 164, 161, 123,  39, 167,  36,  33,  36,
-167, 167, 123, 167, 120, 120, 164, 167, 123, 123,  36, 161, 120,  47, 167,
-120,  36, 160,  39, 120, 164, 167, 123, 123, 123,  36, 120, 123, 167, 120,
-160, 123, 123,  36, 120, 164, 164, 123,  38, 164,  45, 164, 123, 161, 167,
-167, 123, 120,  39, 123, 164,  36, 123, 123, 173, 161, 123,  36, 123,  38,
-120,  36, 167, 123, 161, 123, 167, 164, 123, 164, 120,  47, 164, 164,  36,
-167,  45, 160,  36, 120, 120,  36,  36,  33, 167, 161, 120, 161, 161, 164,
-164, 166, 164, 164,  33,  39, 167, 167,  39,  36,  36, 167,  38, 167,  36,
-164, 164, 123, 123, 120, 123,  36,  36, 167,  36, 161, 161, 167, 120, 167,
-123, 160, 120,  39, 164, 164, 120, 120, 120,  39, 120, 164,  36,  39, 160,
- 36, 161, 161, 120, 166, 120,  45, 167, 161,  36, 161, 167, 123, 161,  36,
-161,  36, 161, 161, 123, 161,  36, 161,  36, 164,  45, 161, 164, 167, 161,
-120,  39, 123, 120, 164,  38, 164, 123, 164, 166,  36,  47,  45,  39,  45,
-123, 164, 167, 167, 161, 161,  45, 120, 164,  39, 164,  36,  45, 167, 123,
-167, 161, 120,  36,  45,  39,  36,  36, 123, 120, 123, 164,  39, 120, 167,
-123, 123, 167, 123,  38,  36, 164, 161, 122,  39,  39, 120, 120, 123, 167,
-164, 167, 120, 123, 120, 123, 164, 123,  39, 120, 123, 161, 160, 164,  39,
- 39, 164, 167, 161,  36, 167, 167,  39,  45, 123, 161, 160,  45,  39, 123,
-120, 166,  36,  36,  38, 167,  36, 161, 167, 160, 164, 167, 164, 167, 166,
-164,  39,  45, 167, 161, 123, 161, 123, 120,  33, 167, 164, 164, 123,  45,
- 39, 120, 123, 167, 167, 164,  45, 164, 123, 120, 123, 120,  36, 164,  36,
-164, 123, 167, 120, 161, 120, 161, 123, 123, 167, 160,  39,  45,  36, 167,
-120,  36,  36,  36,  39, 167, 164,  39, 167, 123, 167,  36, 120,  39, 167,
-164, 164, 123, 120, 120, 164,  36,  36,  36, 167, 164, 120, 164,  45, 120,
- 39,  45, 123,  36,  36, 120, 167, 120,  36, 167,  36, 167,  39, 123, 167,
- 47, 167, 160, 123,  36, 123,  36, 120, 161, 167, 161,  36, 120,  45, 120,
-160,  36,  36, 167, 120, 167, 123, 120, 120, 161, 167,  36, 167, 120,  36,
- 36, 120,  36, 123,  36,  36,  36, 164,  36, 120, 164, 120,  36,  36, 120,
-167, 167, 167,  36, 123, 123,  39,  47, 123, 120, 126,  39, 123, 167, 123,
-167, 167, 123, 164, 167, 123, 161,  36, 161, 167,  45, 164, 164, 123, 167,
-167, 123,  36, 167,  39,  36, 164, 165, 123,  39, 161, 123, 167, 167, 123,
-120,  36, 167, 164, 160, 165,  45, 161, 161, 120, 164, 167, 120,  39, 120,
-164, 121, 161,  36, 167,  36,  39, 161,  39, 123, 164,  45,  36, 120,  36,
-161, 123, 167, 164, 120, 167, 164, 167, 161, 164, 167, 123, 164, 164, 160,
- 36,  36, 167, 120, 164, 160,  45, 167,  36, 123, 121, 160, 123, 120,  39,
-123,  36, 123,  36, 167, 161, 164, 123, 123, 167, 120,  36,  36, 123,  45,
- 36,  45,  45, 123,  36, 120, 164, 123, 123, 164, 164, 123, 120,  39, 167,
-120, 161, 123, 123, 167, 123, 123, 161,  39, 161, 120, 161, 160,  36, 164,
-164, 120, 120,  36, 120, 167, 120,  36,  47, 164, 167,  36,  36,  36, 123,
- 45,  36, 120, 160, 167, 160,  36, 120, 123, 120, 167, 164,  39, 123, 161,
- 36, 164, 161, 123, 164, 126, 123, 167, 167, 120,  36,  45,  45, 167, 123,
- 45,  45, 167, 167, 161, 123, 164, 167, 120, 167, 164,  39,  45,  39,  45,
-120, 164, 161,  45, 164, 126, 120, 164,  39, 167, 123,  36, 120, 167,  36,
-160, 164, 164, 164, 164, 164,  37, 167, 123, 120,  36,  36,  39, 167, 164,
- 39, 167, 164, 167,  47, 167, 161,  36, 167, 164, 120, 167,  36, 161, 164,
-123,  36, 123, 120, 164, 161,  47, 161,  39, 120,  36,  36,  45, 167, 164,
-123, 167,  45, 161, 167, 120, 164, 164, 114, 161, 123, 164,  36,  47, 120,
-164, 167, 164, 161, 167, 123,  39,  45,  45, 123, 167,  36, 121, 164, 167,
- 39,  36, 167, 164, 161, 167,  36,  36, 164,  36, 123, 120,  36, 167,  36,
- 36, 167,  47,  39, 164, 123, 164, 120, 123,  47, 120, 165,  36, 123, 123,
- 36, 167, 164,  39, 164, 123, 123, 126, 167, 123, 167, 167, 114,  39,  39,
-164,  36,  39,  36,  45,  36,  36,  36,  39, 161,  36,  36, 161,  36, 161,
-164, 165,  37, 164, 161,  36,  37, 164, 121, 164, 167, 167,  36, 164, 167,
- 47, 123,  36, 161, 121, 164,  39, 161, 161, 123, 167, 164,  39,  47,  39,
-123, 123, 114,  39,  39,  39, 123,  39,  39, 120, 167,  37, 167, 126, 160,
-120, 167, 120,  36, 167, 165, 120,  45, 164, 164, 161, 164,  36, 164, 161,
-120, 165,  36, 120,  36, 161, 114, 126, 120, 167, 114, 164, 167,  37, 161,
-120, 123,  45, 160, 167, 167, 161, 123, 161, 120,  39, 123,  39, 167, 164,
-161, 120, 120,  36,  36, 123, 123, 164, 161, 123, 120,  39,  36,  45, 255,
-120, 164, 123,  45,  39, 120, 120, 160, 167, 161,  36, 164, 123, 120, 167,
-121, 164, 120,  36,  36, 167, 121, 164, 120, 123, 167, 123, 123,  39,  39,
-160, 123, 167, 120, 161, 161,  47, 164,  36, 164, 120,  39, 120, 167, 123,
-167, 114, 165,  36, 120, 120,  36, 126, 167, 164, 165,  37,  36, 126, 126,
- 37, 121, 161,  45, 161, 123,  36, 164,  47,  45, 123, 164, 120,  45, 164,
-161, 161,  39, 161,  39, 120, 164,  36, 126, 164,  37, 126, 167,  39, 167,
-120,  45, 123,  45,  36, 167, 167, 167, 164,  36,  36, 120, 120, 160, 167,
-120, 167, 164, 123, 164,  36, 120, 164, 120, 114, 167, 123, 167, 164, 165,
-167,  36,  39,  39, 121, 167, 114, 167, 165, 123, 123, 121, 167, 161, 123,
-167, 123,  39, 167, 120, 120, 123, 164, 121, 167, 121, 123, 161, 164, 120,
-164, 164,  39, 167, 114,  36,  39, 164, 123,  45, 164, 167, 165, 167,  36,
-123,  36, 167,  47,  36, 160, 123, 120, 164, 126,  36,  36, 123,  39,  45,
-123, 121, 167,  36,  47, 167, 164, 164, 164, 164, 123,  36, 167,  36, 161,
- 36, 123, 164, 120, 126,  36, 164, 164,  39, 123, 164, 167,  36, 160, 167,
-161, 123, 120,  36, 164,  36,  36,  36,  36, 123, 120, 164, 167,  39, 120,
-164, 167,  36, 123, 164,  36,  36, 164,  45, 164, 167,  36, 161, 123, 164,
-123, 126, 123, 167, 161,  36, 164,  36, 120,  37, 120, 164,  39, 164,  36,
-161, 167, 167, 126, 167, 167, 167, 123,  36, 167,  47, 123,  45,  39, 126,
- 36, 120, 114,  39, 123, 167, 164,  39, 161, 167,  45, 123, 164, 165,  36,
-165,  45, 114,  37, 161, 164, 164, 161, 161, 161,  36,  39, 161, 161, 123,
- 45, 164, 126, 120,  47,  36,  37,  47, 114,  45,  36, 120,  36,  36,  36,
-167, 161,  36, 164,  45, 120, 120, 167, 126, 164,  36, 120, 121, 167, 161,
- 36, 121, 164,  36,  36, 114, 164,  36,  39, 165, 164, 161, 164, 121,  36,
-120, 120, 123, 167, 161, 161, 164, 165, 167,  39, 123, 121, 123,  37, 167,
-123, 126,  36, 114, 114, 165,  36, 167, 167,  36, 123, 167,  36, 164, 121,
-120, 164, 165, 123,  39, 167, 167, 121, 161, 120, 120, 164, 167, 123, 164,
-161, 165, 126, 161, 114,  45, 160,  45, 114, 126, 167,  39, 161,  36, 167,
-167, 120, 167, 121, 167, 121,  47, 167, 167,  37, 167,  36,  36, 121, 161,
-164,  36, 167, 114, 161, 114,  36, 164,  39, 167,  36, 164,  45, 164, 121,
-123, 114, 164, 164, 126,  39, 164, 121, 167, 164, 160, 164, 164, 167, 121,
- 36,  36, 120,  45, 161,  39,  39, 161, 165, 167, 161, 167, 164, 161, 165,
- 45,  36, 167,  37, 121, 160, 126, 165,  37,  36,  39, 161, 123, 123, 126,
- 39, 164, 165, 120, 114, 165, 123, 164,  36,  36, 164, 167, 160, 167,  47,
- 36, 161,  45, 167, 164, 114, 120,  39, 123, 164, 120,  39,  36, 114, 120,
-120,  36,  45, 161, 167,  36, 164, 161,  39,  37, 126,  36, 120, 161, 123,
-126,  39, 114,  37,  36, 123, 167, 120, 167,  36,  39, 165, 121,  39, 114,
-164,  39,  45, 165, 165, 120, 126, 126, 167, 123, 167,  36,  36, 123, 165,
-164,  39, 120, 164,  37, 121, 167,  39, 123,  37, 126,  37,  36, 120,  39,
-164, 114,  36,  36,  45, 165, 165, 164,  36, 167,  45, 114, 121, 121, 123,
-164,  39,  39,  39, 165, 167, 126, 120, 120,  36, 164, 161, 164, 123,  39,
-164,  45, 126,  39, 167, 167, 164,  37, 161, 123, 120, 121, 165,  36, 126,
- 36, 123,  36, 126,  36, 120, 167, 123, 123, 165, 167,  39, 164, 123,  39,
-121, 123, 167, 123, 120, 164,  36, 164, 126, 120,  36, 167,  37,  36, 161,
-160,  37, 167, 167, 161, 120, 121,  37,  39,  45,  36, 160, 164,  37,  47,
- 39, 167, 167, 164,  36, 161, 167,  47, 123,  39,  36,  45, 161, 167, 161,
-114, 164, 121, 114,  37, 121,  37,  36,  36, 164, 123, 167, 120,  39,  39,
- 37,  39, 167,  36,  36,  36,  45, 165,  36, 126,  36,  47, 121, 121,  36,
- 45,  45, 167,  36, 167, 121, 126, 120, 123, 165,  39, 160, 165, 161, 161,
- 47, 123,  39, 167, 164, 167, 123,  36, 167, 114,  39, 164,  39,  36, 165,
- 39,  37, 164, 164, 126,  36, 126, 114, 126, 123,  37, 164, 123, 123,  37,
-164,  47, 120,  39, 121, 126, 114,  39, 164, 123, 114, 165,  39,  37,  39,
-167, 121, 121, 114, 161, 164, 167, 167, 121, 120, 165,  45,  45, 126,  37,
-167,  39, 121,  39, 126,  45, 121, 161, 164, 114, 161, 120, 121, 167, 165,
- 36, 120, 167,  45, 164, 121, 167, 121, 123, 161,  36,  45, 164, 161, 121,
- 36, 164,  37, 164,  36,  47, 167, 164, 165, 120,  45, 121,  45, 120, 126,
- 36, 121, 164, 123, 164, 121, 114, 161, 164,  36, 164,  37, 120, 123, 165,
- 37, 167, 161,  37,  47, 165,  39, 123, 164,  36,  39, 167,  37, 123,  45,
-167, 123, 167, 114, 126, 167, 164, 160, 164, 164, 123,  36, 165, 167, 167,
-121, 161,  39, 114, 123,  36, 123, 164, 164, 123,  36, 123, 160,  36, 114,
-167,  39, 121, 123,  39, 167, 121,  37, 126, 167,  39, 161,  39, 121, 120,
-114, 126, 161,  36, 167, 114, 126,  37,  39, 164, 161, 114, 165, 161, 121,
- 36, 126, 164,  39, 165, 161,  47, 123, 114, 164, 164, 165, 167,  39, 120,
-161,  39, 164, 123, 164,  36, 161,  39, 120, 167, 167, 120, 164, 120, 123,
- 36, 114, 114,  37, 167,  36, 167,  39,  36, 164, 167, 123, 167, 161, 114,
-126,  39, 161, 120,  36,  39, 167, 120, 167, 121, 167, 114,  39,  37, 121,
-164,  45, 123, 164, 114, 164, 126, 123,  37,  39,  45,  36, 167, 164, 123,
-123, 114, 121,  37,  36,  37,  37, 161, 165,  36, 167, 164, 167, 164, 114,
-164, 165, 164, 126, 120, 167,  36, 126, 123, 120,  39, 114, 164, 165, 123,
-164,  37, 121, 165, 114,  36, 126,  36, 120, 126, 126,  36, 161, 114, 161,
-123, 167, 167, 126, 164, 123, 164, 123, 164, 126, 121, 120,  39,  39, 120,
-164,  36, 121, 164,  39,  36, 161, 161, 164,  37,  39,  45,  36, 167, 165,
-167,  36, 167,  36, 123, 165, 164,  37, 114, 165,  39, 161,  39,  36, 114,
- 37,  39, 114, 114, 161, 121,  36, 165, 120, 123, 165, 167, 126, 165, 165,
-121, 123, 123, 167, 160, 123, 123, 121, 126,  37, 114, 160, 167, 126,  36,
- 37,  36, 120,  39, 167, 121, 126,  37,  39, 167, 121, 120, 121, 121,  39,
- 36, 126, 121, 161, 165, 164,  45, 167, 165, 167,  39,  47, 164, 165,  45,
-164, 160, 161, 161,  36, 126,  36, 165,  39, 167,  36, 167, 167,  39, 165,
-164, 126, 161,  45, 114,  37, 165,  45, 126, 114, 114, 126, 121, 164,  37,
- 45, 164,  36, 161, 167, 120, 114, 120, 167, 161, 126,  37,  37, 165, 123,
-165, 167, 114, 164, 167, 164, 165,  45, 161, 165, 164,  39, 123, 120,  39,
-165, 165, 164, 123, 114, 165, 126, 164, 126, 165, 167,  47,  37,  39, 160,
- 39, 114, 164,  45,  36,  45, 114, 126, 167,  37, 114, 123,  36, 121,  37,
- 36, 161, 160, 126, 164, 164, 167, 167, 167, 164, 167,  36, 120, 126, 123,
-121, 167,  39,  36, 126, 126,  39, 123, 165, 123, 126, 255, 165, 121, 160,
- 45, 114, 164, 165,  45, 165, 120, 114, 126, 121,  47, 123, 164, 161,  36,
-121,  37, 164, 120, 167,  36,  37, 120, 164,  37,  45,  37, 167,  45, 161,
-165, 123, 165, 121, 126,  45, 120, 161, 161, 121, 164, 164,  36, 164, 164,
-114, 164, 167,  39, 165, 164, 165, 164, 123, 114, 121, 165,  39, 164,  45,
-123,  45, 167,  39, 114, 165,  36, 121, 121, 121,  39, 165, 126, 121, 123,
-164, 123, 167, 164, 120,  36, 114,  39,  37, 114, 167, 165,  36, 167, 165,
-126, 165, 126,  36, 167, 121, 165, 167,  45,  37,  47, 126, 114, 164, 161,
-161, 161, 161, 120, 165, 120, 167, 167, 123, 114, 165, 167, 120, 167, 165,
-165,  37, 167,  37, 120, 164,  45, 165, 161, 164,  45,  36, 120, 126, 167,
- 37, 167, 126, 114,  39, 114, 121, 126,  47, 126,  36,  39, 165, 160, 164,
-114,  36, 164,  45, 164, 165,  39,  37, 164,  36,  36,  36, 167, 165, 164,
- 39, 165, 114, 120, 123, 120, 167, 167, 161, 120,  39,  45,  45, 123,  45,
-114,  37, 126, 126, 161,  45, 161, 121, 126, 120, 123, 114, 114, 161, 126,
-120, 164, 120, 114, 165, 161, 167, 114, 161, 120,  39, 164, 164, 123, 165,
-126, 121, 165, 165, 167, 120,  39, 164, 161, 167,  47,  45, 120, 126,  39,
-120, 255,  47, 167, 121, 165, 161, 165, 160, 121, 167, 126, 161, 114, 126,
- 45, 114, 123, 160,  39, 121, 164,  39, 164, 165, 126,  47, 161,  36, 164,
-164, 165, 114, 167, 161,  45, 167, 164,  39,  39, 165,  45,  45, 167, 126,
-123,  45, 126,  36,  47,  37,  45, 164,  45, 164, 123, 121, 164, 121, 164,
-121,  39, 161, 161, 123,  39, 165, 167, 121, 164, 126,  39, 165, 126, 114,
- 36, 120, 161, 161, 255, 114, 165,  45,  36, 123, 164,  47, 161,  36, 165,
-121, 165,  37,  36,  39,  36, 167, 120, 165, 161, 121, 123, 126, 126,  39,
-164, 114, 165,  37, 161, 126, 114,  39,  39,  37, 167, 121,  36, 126,  45,
-123,  39, 123,  47, 123,  37, 123, 121,  37,  37,  39, 164, 167,  39, 120,
-167, 120, 160, 161, 164, 164, 114, 126, 126, 126, 121, 164, 164,  47, 126,
- 36,  36, 164,  39, 121, 123, 165, 126, 161, 126, 114,  39, 126, 165, 165,
-123, 165, 165,  37, 165,  39, 120, 114,  36,  37,  39, 114, 165, 164,  36,
-165, 167, 121, 164, 114, 161, 121, 120, 126, 126, 167, 165, 123, 167, 165,
-164, 165, 167, 126, 164, 114, 160,  39, 120, 126,  36,  36,  37, 161, 164,
-167, 126, 164, 121, 167, 165, 114, 167,  36,  37, 165, 161, 165, 126,  39,
-114, 164, 161, 167, 167,  36,  37, 120, 167, 167, 167, 164, 121, 126,  45,
- 39,  37, 121,  45, 161, 114,  37,  47, 121, 114, 126,  36, 114,  47, 114,
-165, 165,  39, 120, 165, 165,  39, 114, 126,  36, 164,  36, 164,  36,  45,
-126, 164, 123, 114, 165, 123, 164, 164, 126, 165, 114, 114, 120,  45, 121,
- 37, 114, 165, 164, 126, 161, 114, 121,  39, 114,  37,  37, 167, 123, 126,
-121, 120, 114,  45,  37, 161, 121,  36, 164, 123, 165, 161, 126, 126, 165,
- 39, 165, 126, 114,  37, 123, 121,  37,  39, 165, 126,  37,  36, 161, 164,
-160, 114, 167, 123, 114, 126, 120, 167,  39,  47, 164,  37, 164, 121,  37,
- 37, 123, 114, 161, 167, 167, 114,  37,  39,  47,  39, 164, 165, 114, 123,
-164, 161,  36, 126, 114,  37, 114, 126, 126, 165, 121, 164, 160,  45,  45,
-164, 126,  37, 123, 114,  47, 164, 167,  37, 164, 165, 164, 167, 120, 164,
-165,  39,  39, 126, 167, 164, 167, 114, 161, 161,  37, 167, 160,  37, 164,
-164, 167, 167, 123, 126, 160, 161,  37, 167,  39, 126, 167, 121, 165, 121,
- 39, 165,  45, 164, 164, 126, 123, 164, 160,  36,  45, 114, 121, 114,  37,
-167, 165, 120, 120, 165,  39, 114,  39, 165,  39, 123,  45, 121, 121, 164,
- 37, 114, 114, 120, 123,  36, 114, 167, 161, 126,  39, 161, 161, 126,  37,
-126, 120, 164,  37,  37, 126, 126,  45, 126,  39, 126, 164, 121, 164, 161,
-167,  36, 161, 161,  36, 165, 114,  47,  37, 165, 114, 167,  36, 164, 161,
-165, 123, 123, 126, 160, 126,  37, 126, 114, 161, 164, 121, 164, 123,  39,
-167, 114,  45, 165,  45,  39,  39, 164, 164, 126,  36, 160, 126, 165, 164,
- 37, 164, 120, 120, 165, 126, 120, 161, 167, 165, 164, 165,  37,  36, 126,
- 37,  37, 164, 123,  37, 164, 121, 123, 121, 126,  39, 114, 126,  37, 126,
-114,  45, 164, 165, 167, 121, 164,  45,  36, 165, 165, 126, 126, 165, 121,
-165, 121, 165, 165, 121,  36, 164, 114, 126,  37, 126, 161, 165, 167, 164,
-126, 164, 123, 126, 165, 126,  45, 255, 164, 160, 120,  37,  45, 114,  37,
- 37, 161,  37, 167,  36, 114,  39, 114, 164,  39, 161, 114, 165, 123,  37,
-165, 114,  37, 114, 160, 167, 160,  39, 164, 126, 255, 165, 165, 161, 114,
- 37,  39,  45, 126, 114, 121, 165, 114, 164,  39, 126, 114, 160, 114, 126,
-126, 165, 114, 126,  37, 126, 165,  37, 165, 165,  45,  39, 164,  37, 126,
-167, 164, 126, 114, 164, 121, 114,  37, 164, 114, 121, 165,  37,  37,  36,
- 37,  39, 167, 114, 164, 126, 123, 165,  37, 165, 164, 126,  45, 160, 161,
-164,  39, 160, 114, 114, 114, 167, 114, 121, 114, 114,  39, 165, 120, 126,
- 45,  36, 126, 114, 161, 120, 161, 164, 164, 165, 114, 165, 164,  39, 126,
-126, 114, 114,  36, 167, 164,  36, 114, 165, 165,  39, 160, 114, 114, 121,
-126, 167, 114, 165,  37, 161, 126, 165, 114,  39, 126, 121, 167,  37, 165,
- 37, 123, 114, 165, 121, 114, 121, 165, 165, 126, 120, 126, 165,  39, 165,
- 39, 165, 165, 126, 123, 114,  39, 126, 164, 121, 121, 164,  39,  37, 126,
-165, 126, 126, 161, 114,  36,  36, 121, 121, 123, 121, 123, 114, 121, 126,
- 36, 164,  39, 126, 126,  39, 165, 126,  39, 114, 165, 121,  45, 165,  39,
-120,  37, 167,  37, 167,  39, 164, 114, 126,  45, 123, 165, 164, 167, 126,
-161, 164,  45,  37, 114, 123, 121, 123,  45, 114,  39, 161, 126,  37, 114,
-121, 164, 165, 123, 126, 126, 126, 126, 165, 164, 114,  39, 161, 126, 114,
-126, 165, 164, 167, 165, 126, 165, 164, 167, 165, 114, 120,  37, 126, 126,
- 39, 121,  37,  36, 121, 165, 165, 164, 165,  37, 121,  36, 126, 121, 120,
- 37, 121, 121, 165, 114, 160, 121, 121, 121,  36, 114,  39, 165,  37, 121,
-165, 161, 121, 121, 164,  39, 160,  37, 126,  36, 165, 120, 121,  37,  36,
-165, 114, 126,  37, 123,  39, 165, 126, 126, 160, 121, 126,  45, 164, 161,
-126, 164, 114, 161, 165,  39, 161, 114, 165, 126, 164, 164, 161, 114, 165,
-126,  37, 126, 126, 164, 114, 121, 164, 167,  45,  37, 165, 165, 114, 114,
-114, 167, 165, 126, 114, 126,  37, 167, 114, 126, 126,  37, 161, 165,  39,
-161, 114,  39, 114, 126,  37,  47,  37, 114,  39, 126, 123,  36, 161,  36,
- 37, 121, 121,  37, 123, 114,  37,  37, 165, 126, 165, 165,  39, 165, 164,
-114, 121, 121, 121, 114, 126,  36,  39, 165, 114,  37, 165, 126, 121, 121,
- 47,  45, 114, 126, 161,  45, 167,  37, 114, 165, 114, 126, 165, 114, 165,
-165, 121, 165, 164,  45,  39, 165,  37, 161, 121, 121, 123,  36, 165, 164,
- 45, 167, 165, 114,  37, 114, 121, 164, 126,  37,  37, 121,  37, 126,  37,
-164, 114,  37, 121,  45, 164, 164, 114, 126,  45, 114, 126, 165, 114, 160,
-161, 114, 114, 161,  37, 114, 167, 165, 165, 164, 165, 126, 165, 164,  39,
-161, 165, 126, 165, 164,  37,  36,  37, 121,  37,  37, 126, 161, 123,  36,
- 36,  39, 121, 121, 165, 164, 121, 120, 114, 164, 126, 161, 114,  37, 114,
-165,  37, 160, 165, 126, 126, 114, 120, 114,  37, 121, 114, 121, 164, 164,
-167, 121, 160,  39,  37, 164, 121, 165,  37, 123,  37,  39, 114, 114, 121,
-126, 161,  45,  39,  37, 114, 126, 114,  47,  37, 165, 161, 114, 165,  39,
-165,  36, 164, 121, 114, 126,  39,  37, 114, 164, 164, 114, 126, 126, 165,
-164,  37, 126, 165, 114, 161, 126, 114,  39, 255,  37,  45, 161,  37,  39,
- 37, 121,  45, 126,  37, 126, 164, 121, 161, 126, 165, 114, 165, 114, 164,
-126, 126,  39, 164, 114, 165, 165, 164,  37, 164, 126, 165,  39, 165,  37,
- 37, 114, 164, 114, 164, 114,  39, 121, 121, 165, 164, 164, 165,  45,  37,
-161,  39, 114, 126, 120, 126, 126, 121, 121,  37,  37, 114,  37, 114, 165,
-164,  37,  39,  39, 126, 121, 164,  37, 121, 114, 126, 121, 165,  37, 165,
-121, 165, 121, 121, 165, 126, 167, 161, 165,  39,  45, 167, 114, 126, 165,
-114,  45, 126, 126,  36,  37, 165, 165, 165, 114, 161, 126, 114, 164, 114,
-165, 165, 165, 126, 114, 161,  37, 164, 161,  37, 114, 114, 165, 121, 165,
-121, 121, 126,  39,  37, 121,  45, 114, 121, 161, 114, 161, 126, 114,  45,
-160, 114, 114,  45, 121, 161, 114, 126, 161, 126, 114,  37, 114, 126, 114,
-126,  37, 164, 114, 121, 126, 161,  36,  39, 165, 121,  39, 164, 164, 121,
- 39, 121, 121,  39,  37, 126, 126, 121, 164, 160, 114, 165, 167,  37, 114,
- 37, 165, 114, 165, 164, 121, 164, 164,  37,  37,  37,  39, 126, 165, 126,
-165, 164,  37, 114,  45, 161, 121, 121, 161, 126,  37, 120, 165, 121,  37,
-164, 114, 164, 165,  37,  37, 114, 126, 164,  39, 161,  37, 165, 164, 114,
-114, 121, 114,  39, 126, 126, 126, 121, 165,  37, 165, 126, 165,  37, 114,
-161, 161,  45, 164, 126, 165, 126, 165, 126, 121, 114, 164, 114, 126, 114,
- 39, 164, 161, 121, 164, 165, 126, 126, 126, 126, 165, 164, 121, 165, 114,
-161, 121, 164, 165, 114, 165, 126, 114, 126, 165, 164, 114, 161, 121,  37,
- 47, 165, 165,  37, 165, 126, 161, 165, 164, 164, 126,  37,  45, 114, 114,
-126, 126,  47, 164, 161,  39, 114,  39, 121, 164, 114, 114, 126,  39, 165,
-126, 165,  45, 126,  47, 164, 114, 114, 165, 160, 165, 165, 126, 160, 121,
-126, 126, 165, 114, 126,  37, 165,  37, 165, 121, 126,  45, 126,  45,  37,
-114, 114,  37,  45, 164, 165,  37, 121, 165, 160, 161, 165, 114,  37, 165,
-114, 164, 114,  37, 165, 165, 121, 126,  37, 164,  37, 114, 126, 121, 165,
-161, 161, 126, 114, 126, 165, 121,  37, 126, 165, 114, 126, 121, 121, 164,
-165, 121, 165, 165,  39, 165,  37, 165, 121, 165, 165,  45, 164, 121, 165,
-114, 114, 165,  39, 114, 126, 164, 164, 126, 114, 126, 160, 161, 165,  37,
- 39, 165, 114, 126,  37, 126, 165, 164, 165,  37, 165, 114,  45, 114, 121,
- 37, 114, 161, 165, 121, 165, 114, 114, 126, 165,  37, 114,  37,  39, 114,
-121,  39, 114, 126, 126, 121, 112, 164, 126, 126,  47, 126, 164, 164, 114,
-161,  39, 126, 126, 121, 121,  45, 121,  37, 164,  39, 121, 114, 114, 121,
- 47, 114, 121, 165, 164,  39,  37,  37, 112, 164,  47, 126, 121,  45, 114,
-126,  39, 112, 114, 114, 114, 160, 164, 126, 121, 126, 165, 115, 126, 165,
-126, 165,  37,  47,  37, 126, 126,  37, 121,  37, 164, 126, 164, 126,  45,
-165,  37, 165,  37, 126, 164, 112, 161, 165, 126, 121, 121, 121, 165, 126,
- 37, 161,  37, 114,  37,  39, 165, 121, 114, 121, 126, 126,  45, 161, 126,
-121, 160,  45,  37, 126, 114,  37, 126, 165, 114, 114, 165, 165, 165, 126,
- 37,  39, 114, 114, 164, 164, 126, 164, 126, 126, 114, 114, 164, 165,  39,
-161, 126, 121, 121, 165, 165, 114, 126, 165,  39, 114, 121, 164, 121, 124,
- 39,  37, 114,  37, 114, 165, 126, 121,  37, 165, 165,  37, 164,  37, 126,
-161, 164, 164, 126,  39, 112, 165,  37, 165, 126,  37, 126,  37, 165, 114,
-114, 121, 126, 115,  37,  37,  39, 126, 121, 112, 165, 164, 165,  37, 165,
-165, 126,  37, 114, 165, 114, 121,  37, 126,  39, 164, 161,  47, 114, 121,
- 45, 114, 121, 161, 165, 121,  45, 114, 165,  45,  37, 165, 165, 165, 114,
-165, 165, 127, 126, 164, 165, 127,  39, 114, 114, 164, 164,  47, 164, 165,
-165, 126, 164,  45, 121,  37, 121, 121, 126, 126, 165, 164,  47, 165, 165,
-114, 165,  37, 164, 165, 164,  39, 165, 112, 164, 164, 114,  39, 121, 121,
-126, 165, 126, 126,  47, 121, 165, 126,  39, 164,  37,  37, 164, 165, 160,
-121, 121, 161, 126, 121,  37,  37, 165, 114, 114,  37, 114, 114,  39, 126,
- 39,  37, 126, 114, 164, 160, 121, 164, 121, 121, 121, 112, 126, 114, 114,
-114, 165, 121, 114,  45, 126,  39, 121,  39,  37,  39, 126, 164, 114, 124,
- 45, 121, 161, 121, 114,  37, 121,  37, 126, 164,  37, 165,  39, 126, 164,
-126, 121, 165, 126, 164,  39, 112,  37, 126,  37,  37, 114,  37, 127, 114,
- 37, 114, 126,  47, 164, 165, 114,  37, 165,  45, 165, 121, 161, 114, 114,
-114,  37, 126,  37, 126, 126, 165, 126,  37, 165, 114, 165, 164, 115, 164,
-165,  45, 126, 114, 164,  45, 165,  39, 114,  37, 114,  45, 165, 165, 121,
-164, 165, 126, 114, 161, 121,  37, 114, 165, 114,  45, 165,  39, 114,  37,
- 45,  37,  39, 161, 121, 127, 126, 164, 126, 164,  45, 126, 126, 114, 165,
-114, 114,  37, 114, 127, 127, 114,  37, 126, 126, 121, 160, 165, 126, 114,
- 37,  37, 114, 126,  37,  39, 164, 165,  37, 126, 124, 165, 165, 114, 160,
-114, 121, 126, 121, 114, 126, 165, 164, 161, 161, 114, 126, 126,  39, 121,
-121, 126,  37, 121, 161, 114, 121, 112, 121, 165, 126, 165, 112, 161, 161,
-115,  47, 121, 121, 164, 112, 114, 165, 165, 112, 126,  37, 114, 112, 165,
-161, 124, 126, 161, 127, 164, 165,  47, 161,  37, 165, 124, 114, 114, 165,
-165,  45, 165, 114,  37, 121, 114,  37, 121, 114, 164, 121, 160, 114, 114,
-165, 165, 126, 164, 126, 161, 115, 121, 165, 164, 126, 165, 127, 165, 164,
-164, 124,  37, 114, 160, 165, 165, 127, 165, 114, 121, 164, 164,  37, 121,
-126, 126, 161, 164, 164,  39, 114, 164, 164,  39, 165,  45, 165, 114, 165,
-114, 114, 165, 124, 112, 121,  39, 124, 165,  39, 121,  37, 114, 161, 165,
-161, 126, 121,  45, 126, 112, 164, 165,  45,  37, 114,  37,  39,  39, 126,
-126, 126,  37, 164, 165, 126, 164, 165,  37, 164, 164, 114, 121,  37, 126,
- 39, 165, 164, 161, 126, 164, 164, 112,  37,  39, 126, 121,  37, 161, 124,
- 39, 115, 164, 124,  39, 164, 126, 164, 112,  37, 126, 114, 114, 121, 114,
-124, 165, 126, 165, 165,  37, 126, 165,  39, 164, 121,  39, 165, 165, 164,
- 45, 112, 126, 164, 112,  37, 114, 121, 164,  39, 164,  37, 164, 126, 161,
-126,  37, 126, 165, 114,  37, 127, 165, 161,  37, 114,  39, 165, 164,  37,
- 37,  37, 124, 127,  37,  37, 165, 114, 114,  37, 165, 165, 161,  47, 164,
-112, 164, 164,  37, 115, 164,  47, 165, 165, 114, 164,  37, 126,  37, 126,
- 37, 126, 114,  37, 165,  45, 115, 165,  37, 114, 114, 164, 114, 164,  39,
-165, 114, 114, 121, 126, 165, 121, 126, 114, 114, 126, 164, 114, 164, 124,
-164, 126, 127, 164, 127, 165, 126, 164,  39,  37, 114, 126, 161, 115, 161,
-114,  37,  39, 112, 121,  37, 112, 126, 164, 165, 114, 127, 124, 114, 126,
- 39, 165, 114, 165, 126, 121, 121, 161, 121, 112, 165, 160, 126,  37, 126,
-165, 165, 121, 165,  47, 127, 121, 164, 126, 165, 114, 165,  39, 112, 165,
-112, 126, 165,  37, 161, 121, 165, 127, 161, 112,  45, 115, 164, 124,  39,
-126, 114, 165, 121, 161, 114, 126, 165,  37, 126,  45, 124, 165, 127,  39,
- 45, 165, 165, 164, 114, 121, 121, 165, 165, 165, 165, 127, 165, 164, 165,
-121, 165, 165, 121,  39, 164,  37, 165, 127,  39, 165, 114, 165, 127,  37,
-121, 127,  37, 112, 126, 126, 121, 114, 114, 165, 121, 114, 165, 164,  39,
-114, 112, 114, 165,  37,  37,  39, 126, 161,  39, 114,  37, 164, 115, 164,
-114, 165, 165, 112,  37, 164, 121,  45, 121, 126, 161, 164, 112, 112, 165,
-165, 114, 126, 121, 121,  37, 124,  37, 127, 126, 164, 126, 127, 165, 164,
-114, 114, 112, 121,  39, 165, 114, 165, 164, 121, 124, 126, 126, 112, 165,
-115, 112, 124, 126,  37, 124, 164,  39, 124, 126, 124,  39, 165, 165,  37,
-164, 114, 124, 161, 115, 127, 165, 161, 165, 127, 164,  37, 112,  45, 164,
-165, 165, 126, 165, 165, 126, 114,  37, 164,  37,  45, 121, 164, 127, 164,
-126, 164, 114, 126, 126, 121, 124, 112, 115,  45,  37, 160, 165,  39, 124,
-124, 164, 121,  39, 126, 164, 114,  39, 165, 112, 126, 114, 121, 164, 164,
-160, 112, 127, 165, 124,  37, 165, 121, 112,  37, 161, 114, 126, 165, 165,
- 39,  37, 164, 114, 165, 255,  47, 165, 164,  39,  37,  37, 161, 160, 161,
- 37, 114, 114, 161, 121, 126, 121, 126, 164, 112, 124, 127, 127,  37, 165,
- 39, 115, 164, 165, 127,  37, 114, 127, 165, 165,  45, 161, 165, 165, 165,
-124, 114, 127, 127,  39, 165,  37,  37, 164, 165, 114, 121, 126, 121, 164,
-126, 121, 126, 124, 161, 165, 124,  45, 112,  37, 164, 126, 114, 115,  37,
- 39, 124, 121,  47, 114, 121, 126, 165, 165, 165, 121, 115, 114, 165,  39,
-165, 126,  37, 121,  37, 121, 112, 114,  45,  37,  37,  37, 164,  39, 161,
- 37, 127, 165,  37, 161, 126, 164,  39, 115, 164, 165, 121, 115, 165, 124,
-121, 124, 121, 161,  39,  39, 126,  37, 165, 114, 115, 165, 112,  45, 114,
-112, 112, 165, 126, 165, 165,  37, 126,  37, 114, 114, 114,  39, 126, 164,
- 37, 165, 164, 165,  47, 165, 112, 126, 114, 121, 121,  37, 121, 124,  39,
-165,  37, 112, 126, 160, 127, 161,  37,  45, 114, 115, 115, 121, 165, 114,
-164, 126, 164, 164, 164, 126, 121, 127, 126, 114, 124,  37, 161, 165, 112,
-126, 115,  45, 164, 126, 165, 121, 165, 165, 121, 121, 164, 112, 164, 255,
-114,  37, 121,  39,  39, 160, 121,  45, 165, 161, 164, 121, 161, 114,  37,
-112,  37,  39, 165, 165, 112, 124,  45, 127, 124, 165, 127, 165, 112, 115,
- 37, 112, 164, 165, 124, 127, 161, 165, 165,  39,  47,  39, 112, 121, 126,
-127, 165, 112, 112, 114,  45, 121, 164,  37, 115,  37, 112, 121, 124, 114,
-164, 112,  45, 165,  39, 165, 126,  47, 124,  37,  39, 124, 165,  45,  39,
-164, 165, 126, 165, 164, 164, 165, 127, 126, 112, 127,  37, 126, 126,  39,
-126,  37,  39, 165, 161, 127, 165,  45, 165, 164, 126, 164,  37, 164,  39,
-114, 121,  37,  45, 165, 126, 114, 126,  37, 126, 126, 114,  37, 126, 165,
-114, 124, 114, 165,  37,  37, 112, 114, 127, 112, 112, 165,  45,  37, 165,
-165, 126, 126, 165, 124, 164, 161, 164, 165, 114, 160, 124, 165, 165,  37,
-121,  45, 165, 114, 112, 164, 124, 126, 127, 114, 126, 114, 121, 114, 165,
-114, 127, 115,  39, 124, 114,  39, 165, 112, 115, 126, 165,  37, 121, 126,
-127, 115, 165, 127, 115, 124, 121, 126, 161, 124, 127, 115,  45, 164, 127,
- 39, 127, 114, 161, 114,  45,  37, 165,  37, 165, 164, 112, 126, 121,  39,
-114, 161, 165, 165, 164, 160, 164, 165,  45, 114, 165, 126,  37, 127, 124,
-165, 126, 124, 127, 165, 112, 164, 126,  45, 121, 121, 164,  37, 164, 161,
- 37, 127, 114, 124, 112, 127, 112, 165, 121, 164, 112, 165, 127,  37,  37,
-165, 112, 160, 124, 165, 127, 127, 121, 255, 115, 112, 165, 126, 114, 124,
-112, 165, 124, 121, 126, 112, 165, 124, 164,  37, 112,  39,  37, 112, 126,
- 37, 124, 161, 164, 160, 126, 121, 165, 164, 115, 126, 165, 112,  39, 126,
-164, 126, 165,  39, 115, 114, 164, 165, 126, 164, 121,  45,  39,  37, 112,
-124, 165, 160, 127, 161,  39, 164, 127, 115, 165, 126, 121, 114, 164, 121,
-124, 114,  39, 164, 114, 121, 165, 165, 164,  39, 164,  37, 115, 165, 114,
- 37, 126,  45, 126, 114, 161, 121, 124, 115,  37, 112, 121,  37, 164, 115,
-112, 124, 165, 126, 165,  37, 164, 127, 124, 114, 124, 165, 165, 161, 161,
-127,  37, 115,  39, 165, 121, 164,  45, 112, 165, 112,  45, 114, 124,  39,
-164, 112, 161,  37, 112,  39, 127, 121, 127, 164, 121, 165, 115, 114, 121,
-127, 121,  45, 112,  39, 126,  37,  45, 164,  37, 165, 114, 124,  37, 124,
-161, 126, 165, 127, 124, 114, 114,  37,  39,  45,  37, 115,  45, 164,  39,
-115,  37,  45, 124, 161, 161, 114, 112, 124, 126, 164,  45,  37, 165, 127,
-127, 126, 126, 114,  37, 160, 126, 124, 114, 165, 126,  45, 126, 127,  45,
-161, 127, 115, 112,  39, 124, 114, 165, 165, 127, 165, 165, 121, 164,  37,
-124, 165, 165, 165,  37, 115,  37, 161, 165, 112, 126, 165, 165, 165, 164,
-165,  37, 126, 112, 126, 164, 112, 161, 126, 121, 112, 126,  37, 114,  39,
-112, 114,  47, 161, 165, 164, 114,  37,  39, 114,  39, 112, 127, 114, 115,
-165, 114, 126, 124, 115, 112, 165, 126, 164, 165, 164, 112,  37, 112, 165,
-165, 165, 165,  37, 124, 115,  37,  37, 114, 161, 164, 164, 112,  45, 165,
-124, 165, 114, 115,  39, 127, 121, 112, 115, 126, 121, 126, 112,  37, 165,
- 37, 126, 112,  37, 127, 124, 161, 124, 124, 161, 126, 124, 255, 115, 126,
- 45, 115, 112, 115,  39, 127,  39, 164, 127, 121,  37, 127, 114, 124,  39,
- 39, 165, 127, 164, 161, 112, 126, 127, 165, 124, 114, 126, 126, 165, 124,
-115,  37,  37, 124, 121, 165, 112, 115, 164, 121,  39, 161, 127, 114, 164,
-112, 164, 124, 121, 126,  37, 121, 127, 164, 127,  37,  37, 165,  37, 127,
-121, 126, 114, 127, 112, 161, 165, 126, 112, 121, 160,  37, 114,  47,  37,
-165, 115, 165, 165, 165, 115,  45,  37, 127, 121, 165, 115, 165,  39, 165,
-127,  37, 112, 127, 165, 124, 127, 165,  39, 126, 124, 115, 161, 121, 115,
-165,  37, 115, 124, 164,  45, 165, 115,  37, 164, 114,  39, 124, 121,  39,
-121, 165, 127, 121, 165,  37,  39, 115, 112,  45, 121, 127, 127,  37, 165,
-121, 121, 161, 121, 124, 164,  45,  39, 124, 165,  39, 165, 112, 127, 165,
-165, 165,  37,  39, 121, 114, 114, 165, 112,  39, 112,  37, 112,  37, 112,
-164, 127, 112, 112, 115, 161, 124, 112,  39, 127, 114, 165, 114, 164, 114,
-127, 127, 112, 115, 115,  45, 121, 112, 164, 126, 165, 165, 164, 112,  45,
-112, 164, 127, 127, 121,  45, 126, 165, 124, 161, 112, 124, 165, 165, 127,
- 37, 112, 165, 124,  39, 114, 124, 165, 112, 124,  39,  37, 161,  37,  45,
-115, 164, 127,  45, 164,  37, 165, 112, 165,  37, 124, 126, 127,  45, 127,
-112, 124, 121, 112, 126,  37, 127, 127,  37, 165,  37, 164,  37, 114, 124,
-126, 126, 164, 165, 127, 164, 124, 165, 114, 124, 114, 115, 165, 126,  37,
-164, 124,  39,  37,  45, 165,  37, 112, 114, 112,  45,  37,  39, 126, 112,
-124, 160, 127, 165, 112,  45, 127, 164, 112, 126, 127, 126, 127,  37,  47,
-164, 161,  37,  37, 124, 126, 115, 165, 126, 124, 112, 165, 165, 112,  37,
-114, 126, 126, 165, 127, 124, 115, 124, 124, 161, 112, 126, 127, 127, 114,
-165, 121, 112, 112, 165, 114, 126, 115, 115, 127,  45, 127, 112, 115, 114,
-114, 114,  39, 165, 165, 165, 164,  37, 165, 165,  47, 112,  37, 112, 121,
-124, 165, 115, 160, 164, 112, 127, 124, 165, 127, 126,  37, 161,  37, 124,
-121, 112, 124, 165, 112, 164, 127, 126, 127, 126, 112, 126, 126, 164, 164,
-112, 127, 124, 127, 115, 165, 114, 112, 126, 160, 127, 161, 124, 126, 112,
-165, 164, 164, 164, 127, 127, 112, 112, 127,  37, 165, 126, 124, 165, 161,
-164, 112, 165, 124, 165, 115, 161, 165, 115, 115, 161, 121, 124, 165, 124,
- 45,  37, 115, 114, 124, 164,  39,  39, 161, 165, 121, 115, 161, 165, 115,
-165,  37, 165, 164, 161,  39, 165, 121,  39, 165, 165, 165, 112, 112,  45,
-124,  37, 114, 127, 124, 165, 112,  47, 124, 114, 161, 126,  37, 115, 114,
-121, 124, 114,  39, 127, 127, 164, 164, 126, 165,  45, 121, 115, 115, 164,
-121, 160, 114, 115,  37, 127,  37,  37, 165, 165, 121, 127, 165, 124, 165,
-165, 127, 121, 165, 164,  39,  37, 165, 112, 127, 165, 127, 121,  37, 121,
- 37, 112, 161, 126,  37,  39, 164,  37, 114,  47, 114,  45, 124, 161,  37,
-112, 161, 126, 112, 115,  37,  37, 112, 161, 112, 121, 124, 112, 121, 165,
-160, 160, 115, 112, 164, 127, 127, 127, 112,  37, 165, 124, 126, 127, 255,
-121, 112, 124, 164, 165, 112,  37, 115, 126, 112, 164, 165, 112,  45, 112,
-127, 114, 126, 164, 164, 161, 114,  37, 164, 165, 164, 115, 160, 115,  37,
-124, 126, 126, 165, 124, 165,  37, 112, 112, 112, 127, 112,  39, 112, 124,
- 37, 165,  45, 164,  39, 124, 112, 124, 112, 121, 165, 115, 112, 165, 121,
-112, 112, 164, 160, 127, 126, 112, 124, 164, 165, 124, 127,  39, 165, 124,
-115,  37, 115, 115, 164, 164, 164, 115, 124, 165, 121, 124, 161, 114,  37,
-114, 127, 124, 112, 115, 114, 127, 127, 165, 112,  37, 255, 124, 164, 124,
-161, 115, 124, 165, 127,  39, 164, 112, 165, 127, 127,  37, 127, 126, 165,
-112, 165, 124, 165, 115, 114,  39, 127, 112, 127, 165, 126, 112, 164, 126,
- 37, 165, 124, 124,  39, 115,  45, 127,  37, 165,  47, 124,  47, 127, 127,
-114, 114, 115, 112, 114, 127, 165, 112, 114, 126, 164, 124, 112, 165, 115,
-124, 164, 164, 112,  45, 127, 121, 127, 164, 126, 112,  39, 161, 164, 124,
-164, 160, 165, 112,  37, 127, 114, 124, 127, 112, 164, 115, 112, 161, 165,
-127, 165, 124, 124, 112, 127,  39, 124, 124, 127, 121, 112, 127,  37,  37,
-124, 112, 114, 127,  37, 165, 161, 161, 112, 114,  37, 161, 124, 165, 112,
-127, 112, 165, 164, 112, 112, 124, 161, 121, 112,  39, 165, 124, 165, 121,
-124, 124, 127, 124, 164, 112, 112,  45, 126, 164, 160, 115, 112, 112, 112,
-160, 127, 164,  37, 164, 121, 165,  37, 112, 164, 161, 114, 115, 126,  39,
-127, 165, 124, 164, 124, 165, 121, 121,  37, 124,  37, 112, 126, 127, 127,
-165, 112, 127, 165,  47,  39, 124, 124, 164, 127, 124, 165, 115, 164,  45,
- 39,  39,  37, 115, 165,  39, 112, 161, 112, 124, 112, 112, 126, 112, 121,
-127,  37, 112,  37, 164, 112, 127, 165, 112,  45, 114, 115,  45, 112, 115,
-112, 165, 161,  39, 121, 126, 114, 124, 161,  37, 112, 126, 124, 165, 165,
-165, 115, 165, 161, 124, 164, 112, 124, 127, 164, 124, 114, 126, 115, 127,
-127, 126, 121, 112,  37,  37, 127, 165, 127, 165,  37, 112, 112, 161, 124,
-161, 164, 124, 115, 124, 121,  39, 161,  47, 165,  45, 164, 127, 165, 127,
- 39, 165, 165, 165, 112,  37, 112, 165, 127, 127,  39,  45, 164,  37, 164,
- 37, 164,  39, 124, 127, 127, 127, 115,  37, 165, 124, 124, 160,  37, 112,
-165,  37, 112, 115, 127, 124, 112, 165, 115, 127,  37, 127, 165, 112, 165,
-112, 164, 127, 165, 127, 161, 115, 127, 165,  45, 126,  39, 127, 124, 165,
-112, 112, 127, 124, 112, 124, 164, 127, 112, 112, 112, 127, 112, 164, 164,
-127, 165,  37, 112, 165, 112, 112,  37, 112,  37,  45, 164, 112, 114, 165,
-165, 112, 164, 164, 161, 112, 115, 165,  37, 112,  39, 127, 115, 161, 165,
- 39, 115, 127,  37, 124, 114, 114, 165, 115, 160, 124,  37, 124,  39, 112,
-124, 161, 112, 124, 115,  47,  39, 124, 121, 112, 124, 127, 121, 112,  37,
-124, 115, 124, 112, 124, 127, 127, 115, 112, 115,  37, 127, 164, 121, 127,
-164, 124, 165, 112,  37, 112, 112,  39, 112, 127, 112, 165,  37, 127, 115,
-127, 112, 127, 115, 165,  45, 115, 112, 161, 124, 121, 114, 127,  39, 124,
-124, 124, 112,  37, 114, 124, 127, 124, 164, 121, 124, 121, 161, 124, 115,
-115, 124, 127, 112, 126, 127, 164, 165, 165, 127, 112, 127, 124, 112, 112,
-164, 124, 165, 115, 165, 124, 112, 127, 161, 127, 127, 121, 164, 165, 127,
-124, 127, 112,  37, 112,  45,  37, 112, 115,  47, 165, 115, 115, 115, 161,
-115,  45,  37, 165, 115, 115, 112, 161, 127, 165, 160, 164, 115, 127, 165,
-112,  37, 112, 124, 115, 112, 115, 165,  37, 164, 127, 124, 112, 114, 112,
-124, 124,  39,  47, 115, 165,  37, 127, 112, 127, 112, 127, 127, 127, 127,
- 39, 127, 165, 112, 112, 115,  37, 124, 127,  39, 127, 124, 127, 161, 165,
-164,  39, 165,  39,  39, 127, 114, 165, 164,  45, 127, 165,  37, 112,  37,
-124, 112, 127,  37, 164, 126, 124, 121,  37, 112, 115, 126, 127, 126,  37,
- 45,  37, 127, 115, 127, 165, 127, 121, 161,  47, 115,  37, 115, 124, 127,
-127, 165,  37, 164, 165, 165, 165, 124, 165, 124, 124, 112, 112, 165, 115,
-165, 112,  39,  47, 112, 112,  39, 161, 112, 161,  45, 112, 112, 164, 112,
-124, 127, 164, 115, 112, 127, 127, 127, 124, 112, 127, 112,  39, 112, 165,
-112,  37, 124, 126,  37, 164, 164, 165, 112, 165, 112, 124, 165,  45, 164,
-127, 112, 161, 115, 164, 115, 165, 112,  37, 114, 124,  39, 127, 115, 112,
-115,  37, 112, 165, 127, 112, 164, 115,  45, 115,  45, 112, 124, 112,  37,
-124,  45, 126, 121, 165, 124, 124, 160, 127,  39, 124, 127, 127, 127, 127,
-127, 164, 124, 164, 164, 165, 112, 115, 161, 127, 112, 124, 127, 161,  39,
-164,  39, 165, 124, 124, 165, 112, 161, 127, 112, 165, 112, 127, 161, 115,
-160, 161, 114, 161, 161, 112, 124, 161, 115, 165, 124, 112, 124, 165, 165,
-161, 124, 115, 112, 115, 127, 112, 127, 124, 164, 165, 124, 115, 127, 112,
-112, 124, 121, 115, 165,  39,  39, 161, 127, 112,  39, 164, 164, 124, 112,
-126, 165,  39, 127, 115, 115, 127, 114,  37, 124, 124, 112, 124, 127, 112,
- 37, 115, 127, 160, 112, 164, 165, 115, 112, 115,  37,  45, 127, 112, 112,
-112, 112,  37, 164,  47, 124, 124, 127, 124, 164, 112, 124, 126, 164, 164,
-112,  37, 164, 114, 112, 121, 124,  37, 164, 115, 112, 114, 127, 127, 115,
-112, 165, 165,  37, 165, 127, 161, 164, 112, 115, 127, 127, 112, 161, 124,
-127, 124, 127, 112, 112, 127, 127,  37, 127, 127, 124, 124,  37,  39, 164,
-127, 165, 127, 114, 112, 127, 115, 112, 112, 112, 112, 161, 115, 164, 112,
-127, 160, 124, 127, 127, 115, 165, 124,  37, 124, 112, 127, 112, 124,  37,
-112, 124, 165, 112, 115, 165,  37,  37, 164, 124, 127, 112, 165, 127, 127,
- 37,  45, 165, 164, 165, 124, 112, 115, 160, 164, 127, 127, 115, 112, 124,
-115, 124, 165, 112, 164, 165, 112, 127, 124,  39, 112, 124, 127, 164, 124,
-165, 124, 127, 112, 124, 164, 165,  45, 127, 124, 112, 112, 165,  45, 165,
- 45,  37, 124, 127, 164, 115, 115, 112, 127, 115, 124, 115, 127, 160, 115,
-127, 165, 112, 165, 115, 164, 112, 164, 124, 112,  37, 124, 115, 112, 164,
-115,  45, 127, 112, 112, 112, 165, 112, 165, 165, 124,  37, 124, 115, 112,
-115, 127, 124,  39, 127, 127, 124, 127, 115, 161, 112,  37,  39, 112, 165,
-124, 164, 124,  39, 112, 127,  39, 112, 114, 112, 112, 127, 127, 115,  37,
-124, 112, 161, 127, 124, 112,  39, 165, 124,  37, 115, 165, 124, 127, 121,
-112,  37,  47, 112, 165, 112, 115,  45,  37, 164, 161, 127, 164, 127, 112,
-124, 124, 127,  37, 124, 127, 112, 115, 164,  37, 112, 115,  37, 112,  39,
-112, 112,  63, 124,  58, 186, 127, 124,  59, 124, 186,  63, 115, 255, 124,
- 63,  58, 112, 124, 124, 115, 184, 112, 124, 124,  59, 127, 186, 124, 112,
- 58, 127, 112, 115, 124, 115, 186, 184,  59, 115, 115, 124, 115, 255, 184,
-184, 115, 125, 178, 115, 115, 112, 112, 184,  62, 112, 124, 112, 115, 115,
-184, 184, 124,  62,  58, 127, 127, 124, 115, 127, 112, 127, 115, 112, 124,
-124, 115, 127, 178, 124, 186, 112,  59, 127, 176, 112, 127,  58, 124, 127,
-184, 115, 124, 127, 112, 184,  58, 186, 115, 112, 127,  62, 124, 184, 115,
-112, 115,  58, 112,  58, 112, 178, 176, 112,  58, 124, 124, 125, 127, 127,
-186, 112, 112, 178, 127,  59, 184, 184, 124, 124, 127, 112,  59, 115, 112,
-127, 127, 184,  58, 127, 127, 112, 127, 118, 186, 112, 124, 124, 127, 176,
-127, 112, 127, 124,  58, 186, 112, 184, 124, 127, 124,  58, 112, 127, 178,
-124, 115, 112, 186, 112,  62, 127, 113, 112, 112, 112, 115,  58, 124, 124,
-127, 184, 127, 127, 112, 186, 184, 112, 127, 112, 124, 178, 115, 186, 112,
-186,  58,  58,  58, 118, 112, 115, 186, 184, 115, 112, 127, 124, 112, 186,
-115, 112, 124, 186, 112, 127, 113, 115, 176, 127, 112, 127,  58, 127,  59,
- 58, 112, 112, 124, 112, 124, 127,  59, 186, 124, 184,  58, 112, 186, 186,
-124, 127,  58, 115, 112, 124, 184,  59, 186, 115, 186, 115, 115, 127,  62,
-112,  59, 186, 178, 112,  59, 186, 127, 127, 124, 127, 127, 115,  58, 124,
-124, 112, 127, 186, 186, 184, 112, 186, 115, 115, 178,  58, 127, 127, 115,
-115,  58, 115, 184, 112,  58,  58,  58, 184, 184,  58, 127, 124, 178, 127,
-184, 112, 127, 127, 125, 124, 115, 127, 112, 125,  63, 124,  59, 184, 115,
-112, 184, 115, 184, 178, 124, 178, 112, 124, 184, 176,  59, 127, 178, 178,
-124, 184, 186, 112, 112, 186, 178, 115, 112, 124, 112,  58,  58, 124, 112,
-127, 127, 124, 127, 127, 186,  59, 115, 124,  59, 127, 124,  62,  59, 112,
- 58,  58, 186, 127, 178,  62, 186, 112, 124, 124, 184, 112,  62,  58, 127,
-112, 112, 115, 125, 115,  58, 112, 184, 112, 184, 184, 124, 184,  63,  62,
- 58, 124, 186,  59, 127, 124, 127, 124, 186, 184, 127, 127, 124, 127,  59,
-127, 184, 115, 127, 124, 127,  58, 127, 176, 125, 178, 112, 112,  58, 186,
-127,  58, 178, 112, 186, 112, 186, 127, 186,  63,  58, 124, 186, 115, 127,
-112, 115, 127, 124, 186,  58, 112, 112, 127,  58, 125, 127,  58, 186, 115,
-124, 124, 186, 124, 184, 127, 112, 115,  62, 112, 112, 124,  59, 127, 112,
-124,  59,  59, 124, 178, 112, 112, 112, 124, 176, 127, 124,  58, 186, 127,
- 59,  58, 184, 115, 118,  59,  59, 115, 186, 112, 113, 125,  59, 112, 186,
-184, 178, 124, 115, 127, 112,  59, 124, 186, 112, 124, 112, 125, 186, 112,
-112, 127, 127, 127, 127, 186,  58, 184, 112, 124, 112, 184, 124, 112, 112,
-112, 127, 115,  63,  59, 112, 115, 127,  62, 184,  58, 124, 112, 186, 178,
-115, 184, 118, 115,  58, 115, 118, 127, 186, 127, 186, 127, 112, 178, 186,
-112, 124, 124, 112, 115, 127, 127, 112,  58, 124, 186, 112, 115, 124, 112,
-112,  59, 184, 118, 186,  58, 124, 184,  58, 113, 112, 115,  63, 112, 112,
-186, 186, 186,  58, 186,  58,  59, 127, 113, 115, 112, 112,  58, 186, 124,
-127, 186, 127, 124, 124, 112, 127,  58,  58,  58, 186, 186, 124, 112, 112,
-115, 115, 178, 186,  59, 127, 112, 127, 115, 127, 127,  58, 127, 115,  58,
-186, 178, 176, 178, 115, 112, 127, 113, 184, 124, 124, 124,  58, 112, 124,
-124, 124, 124, 112, 115, 184, 112, 186, 124, 124,  62, 115, 186, 112,  58,
-178, 112, 186,  58, 112,  59, 125,  58, 127, 127, 115, 113, 124, 112,  59,
-112, 184, 184, 186, 113, 112, 115,  58, 125,  58,  58, 127, 124,  62, 124,
-184, 115, 127, 127, 124,  58, 127, 124,  58, 112, 127, 127, 124, 113, 124,
- 59, 186,  58, 118,  58, 186, 127, 112, 112, 112,  58, 124, 127, 115, 184,
-186,  63, 127, 127, 184, 115, 184,  58, 184, 178, 113, 113, 115, 125, 186,
-124, 124, 124, 124, 112, 178, 184, 127, 124, 124, 118, 115, 115, 115,  58,
-125, 112,  59, 115, 113, 127, 125,  58, 186, 112, 186, 125, 124, 178, 127,
-115, 124, 115, 124,  58, 184, 176, 124, 124, 125, 127,  62, 186, 186,  58,
-112, 112, 112, 112,  62, 127, 112, 186, 127, 112,  59, 115, 186, 112, 112,
-112, 127, 178, 127, 115, 112, 112, 127, 115, 127, 124, 124, 112, 186,  59,
-184, 124, 112, 124, 184, 112, 112, 112, 112, 115, 127, 124, 112, 186, 186,
-176, 184, 178, 127, 186, 112, 186, 127, 118, 186, 127, 118, 115, 115, 124,
-124, 112, 112, 127, 115, 124, 112, 127,  59, 124,  58, 127, 115, 112, 178,
-124, 115, 113, 124, 115, 125, 124, 127,  58, 186, 186, 112, 186, 124, 115,
-112, 115,  58,  59,  58, 124, 112, 178,  58, 127,  62, 184, 112, 127, 176,
-112,  62, 186, 115, 127, 124, 112,  59, 125, 124, 112, 178, 186, 124, 184,
-113,  63, 112,  58, 113, 176, 186, 112,  58, 127, 112, 112, 127, 118, 127,
-186, 127, 184, 112, 186, 127, 112,  59,  59, 112, 178, 178, 127, 186, 186,
-127, 125, 112, 125, 124, 115, 113,  59, 112, 186, 124, 112,  58, 115, 124,
-125, 112, 127,  59,  59,  59, 112, 125, 125, 115, 112, 124,  58,  59, 112,
- 58, 112,  58, 112, 186, 127, 124,  58,  58, 186, 127, 186, 112, 125, 186,
-127, 112,  58, 184,  59, 112, 113, 115, 186, 118,  58, 115, 186,  62, 113,
-178, 112, 118, 184, 186, 125, 186, 127, 112, 112, 184, 127, 112, 124, 113,
-127, 112, 125, 115, 127, 186, 115, 118,  59, 127,  62, 125,  58,  58, 127,
-124, 112, 186, 115, 112, 186, 118, 184, 112, 127, 127, 127, 127, 113, 127,
-186, 115, 178, 112, 113, 112, 186, 186, 184,  62, 115, 184, 127, 184, 115,
- 58, 112, 113, 112, 186, 112, 115, 124, 184, 184, 127,  58, 125,  62, 112,
-127, 184, 115, 124, 115, 124, 125, 124, 127, 112, 184, 112,  58, 113,  58,
- 58, 184, 118, 125, 184, 186, 186,  62,  58, 184, 124, 115, 184, 115, 184,
-112, 127, 115, 115, 186, 186, 115, 127,  62,  58, 127, 186, 186, 127, 178,
-124, 115,  58, 112, 124,  58, 184, 124,  59, 127, 124,  58, 127,  59, 127,
-176, 115, 124,  58,  59, 127, 178,  58, 184, 118, 127,  58, 113, 115, 186,
-124, 127, 125, 127, 186, 127, 127, 113, 186, 186, 127, 112, 124, 113,  58,
-127, 184,  58, 124, 178, 184, 186,  59, 115,  59, 186, 127, 115, 186, 124,
-118, 127, 186, 125,  58, 115, 124, 112, 124, 184, 118, 113, 112, 127, 124,
-186,  59,  58, 127, 176, 186, 178,  58,  58, 112,  63, 112, 112, 124, 184,
- 58, 112,  62, 112, 124, 112, 124, 186, 124, 112, 186,  58, 176, 178, 112,
-118, 113, 186,  62,  62, 186, 127, 118,  59, 127, 125, 178, 125, 186, 186,
-124, 112, 112, 176, 184, 127, 186, 127, 186, 112, 124, 112,  59,  62, 113,
-184, 186,  62, 186,  58, 184, 186, 115, 178, 184, 184, 115, 178, 125, 113,
-124, 186, 118, 124, 112, 127, 115, 112, 118, 184, 255, 112, 118, 178, 112,
- 58,  59, 184,  58, 112, 186, 125, 178, 127, 186, 113, 127, 118, 124,  63,
- 59, 178, 176, 127, 127,  58, 125, 115, 112, 186, 113, 184, 115, 184, 112,
-184, 127,  58, 124, 176, 112, 115, 178, 112, 113, 113, 115, 186,  59, 113,
-176,  59, 184,  62, 125, 124, 124,  58, 113, 112,  59, 113, 186, 125, 178,
-186, 112, 178, 112,  59,  63, 125, 118, 112, 184, 113, 186, 118,  59,  58,
- 59,  58, 115,  63, 178, 112, 127,  58, 113, 125,  58, 112, 184, 186, 115,
-125, 127, 127, 127, 186, 125, 184, 112,  58, 112, 186, 127, 112, 112, 184,
-127, 124, 186, 115, 127, 112, 113, 115, 112, 186,  59,  63, 124, 115, 115,
-184,  58,  58,  62, 115, 112, 112, 118,  58, 113, 184, 186, 125, 178, 127,
-112, 125, 112, 124, 112,  58,  59,  59, 127, 115, 124, 186, 124, 125, 124,
-186, 124, 186,  58, 184, 124,  58, 186, 184, 178,  58, 127, 115, 127, 125,
-124, 112, 113, 124, 127,  58,  62,  58, 112, 127,  59, 125, 127, 186, 124,
- 59,  59,  58, 115, 113, 186,  63, 118,  58, 115, 124, 184, 112, 112,  62,
-124, 113, 186, 124, 186, 124, 118, 127,  58,  58, 184, 115, 113, 118, 113,
-125, 118, 124, 127, 112, 178, 186, 186, 186, 115, 112, 186, 112, 115, 118,
-112, 115, 115, 112, 112, 113,  59, 186, 127, 115, 186, 124, 112, 186, 124,
-124, 115, 112,  59, 125, 127, 115, 113, 186, 118, 184, 124, 184, 115,  58,
- 58, 127, 184, 184, 113, 112, 112, 112, 178,  62, 124, 184, 127,  58, 125,
- 59, 125, 115, 112, 178, 118, 124, 124, 112, 186, 118, 115,  58, 125, 125,
-184, 115, 113, 124,  58, 186, 112, 186,  58,  58, 184, 127, 184, 184, 184,
-124, 186, 118, 186, 127, 124, 127, 118, 112,  63, 112, 125, 115, 184, 125,
- 59, 112, 112, 124,  58, 125, 178, 125, 112, 186, 127, 186, 112, 115, 115,
- 59, 112, 112, 184,  63,  63, 113, 178, 186, 186, 127, 113,  62, 115, 113,
-186, 178, 115, 186, 125, 115, 113, 186, 115,  58, 115,  58, 118, 184, 124,
- 58, 125, 127, 124,  58,  58, 112, 124, 118, 115,  62, 127, 124, 127, 127,
- 59, 124, 125, 125,  59, 115, 113, 178, 113, 186, 186, 112,  63, 176, 118,
-184, 127, 115, 178, 127, 184,  59, 186, 124, 127, 115, 125, 125, 186, 113,
-184, 124,  62, 186, 124,  58, 112,  58, 186,  58,  62, 115, 178,  58, 127,
- 58, 178,  58, 113, 125, 118, 127, 127, 115, 112, 186, 113, 186, 124, 186,
- 58, 125, 186, 186,  62, 186, 112, 113, 186, 115, 127, 115, 127, 127, 127,
-125, 113, 112, 113, 125, 186, 115,  59, 176, 112,  59, 125, 125, 186, 184,
- 62, 186,  59, 186, 186, 127, 112, 184, 176, 115, 124, 176,  63, 127, 186,
-112, 186, 184, 112, 184, 125, 178, 186, 184, 125, 186,  58, 115, 113, 125,
-127, 124, 115, 125, 178, 127,  59, 184, 186, 112,  59, 186, 186,  62, 118,
-184,  62, 127,  62,  58, 113, 184, 113, 118,  59, 186, 184, 112, 124, 124,
-127,  58,  58, 184, 112, 125, 112, 186, 113, 124, 127, 186,  62, 113, 124,
-118, 125, 125,  58, 118, 186, 113, 127, 118, 178, 184, 186, 186, 127, 112,
-186, 113,  59,  62, 127, 112,  59, 118, 113, 127,  59, 127, 118, 113, 178,
-112,  62, 125, 115,  59, 127, 124, 124,  58, 186, 112,  58,  59,  63, 112,
-112, 118, 184, 118,  62, 124, 184, 113, 127, 125, 184, 184, 118, 127, 125,
- 59, 113, 125,  58, 115, 125, 112,  58, 186, 184,  58, 112, 112,  58, 186,
-125, 113,  62, 184, 112, 186, 118, 118, 125,  58,  58, 184, 124, 184, 113,
-115,  58, 113, 124, 115, 118, 124, 186, 186, 186,  58, 118, 124, 112,  58,
-125, 184, 124, 112, 178, 115, 124, 124, 127,  63, 113,  58, 255, 127,  58,
- 58,  58, 115, 127, 178, 186, 186, 125, 127, 124, 125, 118,  58, 186, 186,
-125, 125, 125, 124,  58, 127, 113,  63, 115,  58, 113, 125, 184,  58, 184,
-184, 127,  59,  58, 178,  59, 115,  62, 184, 184, 112,  58,  63,  59, 124,
-186, 186, 115, 184, 186, 113, 125, 186, 113, 127, 115, 127,  58,  59, 112,
-125, 112, 178, 118, 186, 186, 124, 186, 112, 127, 113, 115,  58, 178, 125,
-115, 184, 186, 186, 125,  58,  58, 125, 125, 125, 113,  59, 115, 118, 124,
-118, 186, 186, 113, 112, 184,  59, 186, 112, 125, 127, 118, 184,  58, 127,
-186, 112, 124, 124, 113,  58, 186, 124, 118, 118, 118, 125,  58, 112,  63,
-115, 124,  63, 127, 112, 112,  63,  58, 127, 184, 127,  58, 184, 184, 186,
-118,  58, 186, 118, 124, 186, 186, 184, 186, 115, 125, 184, 118, 112, 127,
-127, 113, 112, 112, 125, 184, 178, 115, 115, 186, 118, 124, 125, 186, 112,
-115, 186, 184, 118, 112, 113, 184, 113, 186, 115, 127, 186, 178, 115, 115,
-118, 113, 124, 184, 115, 186, 115, 124, 186, 127,  62, 118, 125, 118, 186,
-124, 127, 113,  58, 113, 112, 186, 178, 125, 186, 125, 113, 113, 186, 118,
-125, 118, 118, 127,  62,  58, 125, 184, 184, 118, 184, 113, 184,  58,  58,
-124, 186, 127, 127, 113, 186,  58, 186,  58,  59, 125, 125,  58,  63, 113,
-112,  58, 186, 115, 184, 124,  58, 125, 184, 184, 127, 113, 125, 124,  58,
-118, 186, 125, 176, 112, 115, 113, 112, 186, 127,  58, 125, 118,  62,  59,
-124, 118, 186, 186,  62,  62, 112, 125, 125, 186, 186, 184, 127, 127,  62,
-125, 178, 118, 112, 186, 115,  58, 127,  63,  59, 124, 112, 125, 186, 176,
-124, 127, 127, 125, 125, 124, 113, 124,  58, 113,  58, 186,  58, 113, 178,
-115,  63, 127, 178, 115, 178, 124, 115, 186,  58, 125, 112, 184, 118,  62,
-118, 112, 124,  58,  59,  58, 112, 112, 127,  58, 113,  58, 115, 178, 124,
- 59, 186, 184, 184, 125, 127,  58, 186, 184, 186,  58, 186, 125, 113,  58,
-125, 176, 186,  59, 125,  58,  58, 124, 124, 178, 186, 112, 113, 186,  58,
-186, 115, 115, 118, 124, 118, 118, 184, 124,  58, 127, 184, 127, 184,  62,
-112, 113, 186, 125,  58, 112,  58,  59, 125, 113,  62,  63,  62,  59, 125,
-112, 186, 118, 186, 178, 184, 178, 124,  59,  58, 184,  59, 186, 112, 125,
-125, 178, 125, 125, 113, 112, 118, 118,  58,  58, 118, 118, 125, 112, 113,
- 59, 113, 124,  59,  58, 118, 184,  62,  59, 112, 113, 184, 186, 113, 176,
-112, 186, 115, 113, 178, 113, 113,  58, 113, 184,  58, 186, 186, 113,  58,
- 58, 186,  59, 118, 115, 178, 127, 124, 127, 124,  62, 118, 127, 186, 118,
- 58, 186,  59, 186,  59, 186, 186, 118, 118, 176,  58,  58, 115, 178, 125,
-184,  58,  59, 186, 125, 113,  58, 186, 186, 186, 115, 184, 184, 186,  58,
-184, 125, 115, 112, 113, 112, 112, 113, 118, 186,  59,  58, 178, 176, 124,
-186,  58, 124, 112, 118, 186, 176, 125, 124, 127, 113, 112, 186, 184, 124,
-115, 118, 118, 186, 186, 112, 176, 125, 184, 125, 113, 112,  58, 113, 186,
- 62, 118, 118, 125, 113, 186, 124,  58, 178, 124, 124, 124, 127, 186, 178,
-124, 113, 127, 115, 186, 125, 127, 125, 125, 186, 186, 186, 118, 178, 178,
- 62, 186,  63, 112, 127, 125, 113, 115, 186, 125, 113, 118, 124, 178, 127,
-118, 115, 186, 178, 184, 124, 125, 125, 186, 125, 112, 112, 178, 125, 186,
-178, 118, 184, 113, 113, 118,  58, 255,  58, 113,  59, 178, 113, 255,  58,
-124, 186, 118, 127, 186, 125, 124, 125, 186, 125, 113, 115, 127, 184, 178,
-113, 186, 118,  58, 113, 113, 112, 186, 113, 184, 112, 127, 115, 125,  58,
- 58, 113,  58,  58, 186, 112, 118, 124, 118, 125, 186, 186, 184,  59, 178,
- 58,  58, 118, 118, 112, 184, 124, 118, 186,  58,  58, 127,  58, 118, 113,
- 58, 125,  58, 184,  59, 118, 113, 184, 184, 186,  62, 118, 125, 112, 127,
-112, 127,  58, 118, 184, 125,  62, 112, 184, 115, 186,  58, 125, 125, 184,
- 62,  58, 186,  59, 113, 178, 127, 186, 113,  59, 113, 113, 186, 113,  59,
-118, 186, 184, 115, 113, 186, 113, 186, 125, 115, 124, 113, 118, 125,  58,
-118, 113, 186,  58, 186, 178, 184,  58,  59,  58, 124, 186, 113, 186, 184,
-112, 124, 125,  59,  62, 186,  58, 118,  59, 113,  58, 113,  59, 127, 127,
-125, 184, 186, 184, 118,  62, 125, 118, 186, 115, 186, 118, 186, 186, 186,
-125, 186,  59, 118, 113,  62, 113, 125, 124, 125,  59,  58, 115, 113, 113,
-113, 186, 113, 186, 112,  58, 184, 125, 184, 112,  58, 112,  62,  58, 113,
-186,  58, 186, 113, 125, 127, 125, 186,  62, 186, 118, 186, 113,  62, 186,
-113, 125,  62, 178, 186,  59, 125, 113,  58, 112, 118, 115, 118, 113, 184,
-125, 125, 125, 124, 125, 125, 112, 178, 127, 124, 125, 186, 178,  59,  58,
-178, 186, 118, 184,  59, 112, 186, 127, 184, 113, 186, 186, 127, 115, 113,
-184, 118, 118,  58, 118, 113,  58,  62, 113,  58, 125, 118, 125, 118, 125,
-127, 125,  58, 186, 118, 115, 113, 118, 186, 186, 127, 124,  59, 112, 124,
-186, 118,  58, 113, 115,  58, 184, 186, 184, 125, 118, 178, 176, 186, 186,
-118, 113, 186, 118, 112, 113, 125, 178,  59,  58, 124, 113, 112, 113, 113,
- 59, 125, 127,  58,  59, 186,  62, 118,  59, 186, 127, 118, 186, 113, 125,
-186, 186,  58,  58, 184, 186, 127,  58, 118,  58, 112, 115, 113, 112, 125,
-178, 184, 113, 118,  62, 186, 125, 127, 125, 118,  58, 113, 124, 118,  59,
-184, 113,  59, 112, 186,  58, 127, 118,  58,  58, 186,  59, 184, 118, 127,
- 59, 113, 112, 113,  58,  58, 125, 118, 125, 176, 112, 186, 127,  58, 184,
- 58,  58, 184, 113, 184, 112, 118, 118, 125, 113, 124, 186, 125, 184, 184,
-112, 186, 113, 186,  63, 113, 125, 186,  59, 186, 115, 186, 178, 178,  59,
-125, 184, 113, 118, 178,  59, 184, 115, 125,  58,  58,  62, 178,  58, 186,
-186, 186, 125,  58, 127, 113, 113, 113, 115, 115, 113,  59, 186, 125, 125,
-125,  58, 118, 113,  58,  58, 178, 186,  58, 112, 125,  62, 125, 186, 184,
-186, 124,  63, 186, 125, 186, 124, 186,  62,  58, 125, 125, 125, 125, 125,
-184, 118, 112, 184, 113,  62, 125,  62,  58, 186, 125,  58, 113, 186, 124,
-118, 125, 115, 113, 184,  62, 124,  58, 178, 113, 124,  62, 184, 127, 118,
-127, 118, 176,  59, 186, 125, 186, 184,  59, 186,  62, 186, 186,  58, 184,
-118, 186, 124, 186, 184, 118, 178, 113, 184, 118, 125, 118,  58, 127,  59,
-178, 125, 186, 125, 125,  58, 125, 118, 113, 115, 125, 118, 186, 186, 118,
-184, 113, 125, 178,  58,  58, 113, 125, 113, 113, 125, 186,  59,  59, 118,
-127, 184,  58,  62,  58,  58, 186, 113, 113,  58, 186, 176, 118, 112,  58,
-118, 113, 113, 178, 125, 113, 118, 112, 125, 186, 118, 125, 113, 118,  58,
-127, 118, 186, 186, 125, 125, 118, 125,  63, 118, 118, 186, 118,  59, 113,
-186, 127, 125, 118, 186,  58,  58, 118, 125, 113,  59,  62, 178,  58,  58,
-118, 178, 118, 118, 184, 184,  58, 186, 125,  59, 186, 115, 118,  63, 186,
- 59, 186, 118, 118, 125, 113, 113, 118, 113, 113, 178,  58, 113,  58, 113,
-125, 127, 118, 115, 186, 118, 127, 125, 118,  58, 118, 127, 118,  58,  58,
-112, 115, 112, 118, 113, 186,  59, 178,  58,  58, 125, 186, 125, 184,  59,
-113, 127, 125, 186, 118,  59, 186, 125,  59, 124, 125,  59, 127,  59, 118,
- 62,  59,  59,  59,  58,  62, 125, 113, 118, 184, 113, 186,  59, 125, 184,
-125, 186, 186, 125, 113, 118, 186, 127, 118, 118, 184, 125, 125, 127, 112,
-178, 125, 184, 113,  62, 113, 113, 112, 184, 176, 125,  59, 118, 113, 178,
-118, 113, 186, 186,  58, 184, 113, 124, 113, 184,  62, 125, 118,  62, 178,
-184, 178, 184, 125, 118, 113, 186, 125, 186, 184, 186, 186,  62, 125,  59,
-186, 186,  59, 127, 186, 186, 125, 113, 112, 125, 113, 186, 184,  58, 186,
- 58, 113, 113, 186, 127,  58,  58, 125, 125, 186, 118, 125,  58,  63, 118,
-125, 125, 118, 124, 186, 118, 186,  58, 186,  62, 125, 178, 184, 118, 112,
-113, 184, 184, 125, 186, 125, 118, 125, 118, 113,  59,  59, 113,  59,  59,
-113, 125, 118, 127, 178, 118, 118, 118, 118, 125, 186,  58, 125, 125, 184,
-125, 186, 125, 186, 176, 113, 186,  58, 184,  58, 124, 186, 115, 186, 125,
-125, 125, 124,  58, 184, 184, 186, 115, 125, 125, 178, 124, 186, 186,  58,
-184,  58, 186, 186,  58, 118, 113, 186, 186, 186,  59, 125, 118, 186, 186,
- 58, 118, 186, 186, 124, 186, 184, 113, 118, 115, 184, 184, 113, 186, 125,
- 58,  59, 186, 113, 125,  58,  59, 112, 118, 125,  58, 186,  58, 186, 176,
-118, 113, 125, 113, 118, 113, 184,  59, 118, 186, 118, 186, 125, 184, 125,
-127, 127,  58, 178, 186, 113, 186, 125, 186, 184, 118, 186, 184, 178, 118,
-113, 184, 113, 118, 186, 118,  62, 113,  58, 125,  59, 125, 186,  58,  58,
-118,  58, 113, 118, 113,  58,  58, 125,  59,  58,  58, 118, 113,  62, 184,
- 59, 186, 113, 184, 113, 125, 113,  58, 184, 113, 186,  59, 184, 184, 178,
-118, 113, 118, 113,  58, 186, 178,  58, 125, 125, 118, 118,  58,  58, 178,
-186, 178,  58, 186, 113, 186, 118,  58, 186, 186,  63, 113, 113, 176,  63,
-113, 115, 125, 118,  58,  58, 186, 186, 178, 125,  59, 113, 186, 118,  58,
-113, 184, 186, 118, 178, 186, 186, 186, 113, 186, 113, 118, 125, 112, 184,
- 59, 176, 184, 113, 112, 178, 112, 184, 178, 125,  62, 118, 186,  59,  62,
-125, 184,  59,  59,  58,  58, 125, 186, 125, 125,  59, 113,  58,  58,  59,
-118, 184, 255, 115, 127,  58, 186, 178,  58,  58, 176, 118, 184, 125, 125,
-125, 118, 178, 118, 113, 186, 113, 186, 184, 125, 184,  62,  62, 178,  58,
- 59, 125, 125, 118,  59,  58, 125, 118,  59, 125, 118, 113, 186,  58,  58,
-186, 125, 184, 125, 125, 255,  62, 184, 118, 113, 186,  58, 125,  59, 186,
-118, 186, 113, 125, 113, 118, 118,  58, 118, 178, 118, 125, 186, 113, 125,
-184, 125, 186,  58, 113, 113, 186, 118,  58,  58, 118, 113, 125, 184, 186,
-186,  63, 118, 125, 125, 118, 118, 125,  58, 113, 125, 118,  58, 184, 118,
-125,  58,  58, 118, 113, 118, 178, 125,  58, 184, 125, 186,  59, 113, 125,
- 58,  62, 184, 118, 118, 118, 118, 178, 125, 125,  59, 125, 125, 186,  58,
-118,  59, 125, 118,  62, 118,  58,  58, 186, 113, 184, 186, 176, 118, 125,
- 59,  59,  63, 184, 186,  58,  59,  59,  63, 118, 125, 118, 186, 118,  58,
- 62,  58, 118, 186, 113, 125, 186, 186, 125, 186, 118, 113, 113, 125, 184,
-112, 125, 113, 178,  59, 125,  58, 184,  58, 113, 118, 113, 125, 186, 184,
-125,  63, 113,  59,  58,  59, 178, 118, 125, 186,  58, 113, 186, 113,  58,
-125,  58,  58, 113, 118, 113, 113, 118,  59, 113,  58,  58,  58, 184, 118,
-125, 186, 186, 113, 184, 125, 113, 186, 186, 184,  58, 184, 113, 118, 178,
-186,  58, 118, 118, 186,  62, 125, 125, 186, 113, 125, 125, 125, 113, 186,
- 63, 113, 178, 125, 113, 178, 186, 125,  58, 125, 186, 186, 125,  58, 118,
-118,  62,  62, 178, 186,  58, 184, 113, 186,  59, 178, 113, 125, 118,  59,
-186, 113, 184,  59,  59, 118,  58, 186, 125, 113,  59,  58, 118, 186,  62,
-186, 113, 186, 125, 125, 113, 118, 186,  58, 186,  58,  58, 176,  58, 184,
- 62, 118, 184, 178, 113, 113, 186, 125, 186, 118, 186, 113,  62,  58,  58,
-186,  58, 118, 118, 118, 186, 178,  58, 118,  58, 125, 118, 125, 118,  58,
-186, 125,  58,  59, 113,  62, 113,  62, 125, 113, 113,  62, 187, 186, 118,
-176, 125, 184, 178,  59, 118, 119, 187,  59, 113, 118,  58, 184, 186, 184,
- 62, 125,  63, 118, 118, 184, 113,  62, 125, 186,  58, 118, 184, 186,  59,
-118, 113, 125,  58, 113, 118, 186, 118, 118, 186, 113, 186,  62, 186, 125,
-125, 125, 178,  59, 118, 125, 184, 186, 116, 184, 118, 184, 118, 125,  59,
-113, 113, 186,  63, 186, 118,  59, 186, 184,  59, 113,  58,  58, 178,  59,
-186,  58, 125, 125, 118, 119, 186, 113, 125, 186, 178, 176, 186, 176, 186,
-113, 125, 125, 186, 184, 113, 118, 113,  58, 186, 113, 113,  58, 186,  58,
-116,  58, 125, 125, 118, 118,  58, 113,  62,  58, 186,  56, 113, 186, 186,
-125, 113, 125, 186,  59, 125, 125, 113, 118, 184, 186,  58, 118, 118, 125,
-186,  58,  58, 125,  62, 113, 186, 125, 184, 118,  63,  58, 113, 118, 178,
- 58, 118, 125, 184, 118, 176, 113,  58, 186, 187,  58,  62, 113, 186, 113,
-186, 125, 125,  58, 113, 184, 118, 125, 184, 125, 118, 125, 118, 113, 113,
- 58, 186, 186, 184, 186, 178, 118, 176, 184,  58,  58,  63, 125,  58, 125,
-116, 116, 184, 125,  59, 186, 125, 125, 178, 118, 186, 118,  58, 186, 125,
-113, 113, 255, 176,  58, 113, 186,  62, 187, 113, 184,  56, 186, 184,  59,
-113, 118, 125, 184, 125, 184,  59, 116, 178, 125, 118, 125, 186, 176, 113,
-113, 118,  58, 125, 113, 113, 118, 186, 125, 178,  58,  58, 186,  58, 113,
-125, 125, 184, 113,  58,  58, 125, 184,  63, 118, 125, 178, 184, 184, 125,
-186, 118, 118, 125,  56,  58, 186, 118, 118, 116, 186, 118, 186, 125, 113,
-186,  63, 184, 184, 125, 125,  59, 186, 178,  56,  58, 186, 118, 186, 113,
- 59, 118,  59, 187, 125, 118, 184, 125, 113, 186,  58, 113,  59, 178, 184,
- 59,  59, 184, 113, 184, 186, 118,  59,  58, 113, 186, 186,  58,  59, 186,
-125, 186, 119, 125, 125, 113,  58, 184,  62, 184, 187, 119, 186, 116,  62,
-186, 113, 113, 113, 118, 186,  58, 125, 113, 178, 125, 118, 186, 113, 186,
-113,  58, 118, 186, 176, 118, 113,  59,  58,  59, 113, 125, 118, 178, 186,
- 62, 113, 125,  62, 118, 186,  62, 187, 125, 113, 184, 184,  58, 118, 186,
-113, 118,  58,  59,  58, 186,  58, 118, 186, 186, 178, 118, 184, 119,  59,
- 56,  58, 186, 118,  56,  59,  59, 118, 186, 118, 186, 184, 118, 125, 187,
-125, 118, 184,  62, 118,  58,  63, 113, 125,  59,  59, 113,  59,  59,  56,
-113,  56,  59, 184, 184, 186, 176, 119, 118, 116,  58,  58, 184, 125,  59,
-116, 186, 178, 125,  58, 125, 118, 113, 186, 178, 118,  58,  59, 186, 184,
-113, 186, 125,  58, 125,  58,  58, 119, 186,  58, 125, 186, 186,  59, 125,
-184, 125, 184, 118, 184, 186, 125,  56, 186, 118, 113, 125,  59, 125, 186,
- 58, 125, 113, 187, 186, 184, 184, 118, 118, 187, 113,  58,  59,  59, 118,
-125, 184, 125, 186, 125, 113, 186, 113, 113, 187, 125,  58, 113,  58, 186,
-118, 113,  62,  62, 116, 119, 184,  62, 184, 119, 184, 176, 113, 118, 118,
-113, 118, 184, 186,  59, 178,  58, 184, 119, 116, 116,  58,  59, 187, 125,
- 58, 125,  58,  56, 186, 184, 118, 178, 125, 113, 125, 118,  58,  58,  58,
-119, 118,  62, 125, 178,  58, 113, 178, 187, 118, 125, 118, 178,  58,  59,
-178,  59,  59, 113, 186, 187,  58,  58,  63,  58, 116, 125, 184, 118, 184,
- 62, 118, 113, 187,  58, 186,  58, 125, 187, 184, 184, 184, 125, 113, 186,
-186, 113, 125, 113,  58,  58, 118,  58,  56,  58, 118,  58, 118, 178, 184,
- 58, 113, 186, 125, 119, 113, 118,  62, 113, 187, 125, 184, 119, 186, 125,
- 59,  58, 113,  59, 118, 184, 119, 125, 113, 184, 125, 119, 186, 125, 186,
-187, 119, 118, 113,  56, 186, 118, 186, 125, 113, 184, 186, 176, 125, 118,
-184, 119,  59, 113, 176, 125, 118,  56, 186,  58, 118,  58,  56,  58, 113,
- 59, 119, 118, 116, 186, 184, 186, 125, 116, 178, 113, 186,  58,  62,  58,
- 58,  56, 113,  56, 113, 113, 125, 186, 186, 125,  58,  58,  58, 125, 187,
-119, 186, 125, 118,  58, 187, 119, 118,  59, 116,  56, 125, 176, 118, 125,
-186,  62, 113, 187, 118,  58, 186, 178, 118,  62,  59,  58, 186, 178, 178,
-118, 125, 125, 125, 184, 113, 118, 184, 125, 118, 118,  58, 186,  63, 118,
-186,  56, 113, 113, 118, 186,  58, 113, 118, 125,  58,  58,  58, 178, 184,
- 59,  58, 187, 176, 113, 118, 113,  58,  58, 125,  59, 125, 125, 184, 178,
-187,  58, 186, 119,  56, 186, 118, 186, 184, 184, 113, 118,  59, 186, 125,
-118, 186, 125, 184, 186, 118,  58,  58, 118, 184, 116, 187, 119, 118,  62,
-178, 186, 187, 186, 118, 178, 187, 184,  58, 184, 113, 184, 125,  59, 118,
-184,  56, 178, 186, 186, 178, 184, 125, 116, 113, 116, 113,  59, 186, 186,
-113,  56, 187,  56, 113, 186, 118,  62, 119, 187, 184,  59, 178,  59, 186,
-178, 118,  56,  58,  59, 125, 186,  58, 125,  56, 125, 118, 186, 118,  59,
-125, 186,  56, 125,  58, 184, 187,  58, 125, 113, 113, 113,  58, 125, 125,
-118, 125, 119,  59, 186, 119, 118, 178,  62, 186, 184, 186, 113, 178,  62,
-125,  58,  62, 118,  58, 113, 186, 125,  59, 184,  58, 186, 113,  56, 186,
-186, 116, 113, 118, 119,  62, 118, 176, 119, 119, 113, 184, 125, 113, 113,
-184, 113, 186, 118,  58,  62, 186,  63, 186, 186,  58, 118, 184, 116,  58,
- 59, 125, 125,  59, 186, 125,  56,  59, 184, 187, 119, 119, 176, 113,  62,
-187, 125, 184, 187, 125, 186, 187, 125, 118,  58, 118, 119, 113,  58, 187,
-118, 125,  59, 118, 176, 113,  62, 118,  62,  58,  59,  58, 186, 184, 186,
-125, 178, 186,  58, 125, 113,  56, 125, 125,  63, 125,  59,  63, 184, 113,
- 62,  56, 184, 187,  62, 184, 125, 125,  59, 186, 125, 176,  58,  63, 125,
-118, 187, 184, 184, 184,  56, 184,  62, 184, 116, 118, 186,  58, 186,  56,
-118, 187,  59,  59, 178, 116,  56, 113, 125,  58, 125, 184, 187, 116, 186,
- 58, 125, 116, 113,  56, 116, 116, 187, 119, 118, 186, 184,  58, 184, 113,
-113, 184, 186,  58, 186, 125,  58, 116, 178, 113, 113,  58,  62, 178, 113,
- 59,  62, 113, 125, 125, 118, 125,  56, 119, 113, 186, 119, 125,  58, 113,
-186, 125, 184, 186, 119, 118, 116, 184, 184, 113, 186,  58, 178, 125,  62,
-125, 178, 178, 125, 118,  56, 176, 187, 113,  56, 184, 178, 113, 186,  62,
-118,  58, 178, 113, 187, 119, 184, 118, 113,  62, 184,  59,  59, 116,  59,
-118,  56, 125, 113, 178,  56,  62, 184, 184,  58, 119,  58,  63,  58,  56,
-113, 125, 118,  58, 113,  58,  59, 186, 118, 116, 184, 125,  58, 187,  58,
-119, 125, 125,  59, 186,  58, 113, 125, 184, 187,  59, 125, 118, 125, 184,
-118, 186,  59,  56, 125,  58, 118, 186, 125,  56,  62, 125,  56, 178,  58,
- 59, 187, 119, 118, 118, 125,  59,  56, 186,  56, 178, 186, 178, 178, 125,
-187,  59, 125, 184, 125,  58, 118,  58, 118, 186, 118,  56, 113, 119,  58,
-184, 186, 187,  56, 186, 125,  56,  56, 113, 118,  56,  58, 119, 178, 125,
-113, 119,  56,  59,  56,  56, 116, 186,  56, 178, 184, 176, 118, 113, 125,
-186, 116, 186, 113, 186, 186,  58,  58, 113, 118, 187, 187, 178,  56, 118,
-125,  56,  56, 119,  63,  58, 116,  56, 125, 113, 125, 187, 186, 125, 186,
-187, 116, 113, 125, 178, 184, 113, 125, 186, 119, 119, 125,  59, 178, 113,
-186,  59, 187, 119,  58, 186, 119, 186,  59,  58, 176, 184, 187, 116, 187,
-113, 176,  58,  58, 125, 187, 184, 125, 119, 186,  62, 187, 113, 186, 119,
-186, 176,  58, 113,  62, 187, 113, 116, 186, 116, 119, 187, 178, 113, 125,
- 58,  58,  56, 186,  56, 186, 113,  62, 118, 118, 116, 186,  58, 125, 184,
-118, 118,  59, 125, 184,  59, 187, 186, 125, 184, 178, 113, 113, 186, 186,
-116,  59, 186, 113, 176, 184, 184, 184, 116,  58, 118, 118, 186,  56, 118,
- 59,  59, 118, 119, 184, 116, 125, 125,  56,  56, 119, 125, 184, 184, 125,
- 62,  62, 176,  62, 178, 125, 119,  59, 119, 184, 118, 113, 119, 187, 178,
-178, 125, 184,  58, 118, 186, 125,  59, 186,  58,  59,  58, 186,  59, 184,
-125, 125, 184, 125, 125, 113, 118,  58, 125, 118,  59, 186,  58, 119, 118,
- 56, 184, 125, 184, 125,  59,  56, 186, 113, 184, 186, 118, 118, 125, 184,
- 62,  58, 125,  56,  56, 125,  59, 178, 184, 187,  58, 186, 125, 118, 113,
-125, 113, 118,  56, 113, 178, 113, 118,  62, 119, 186,  58,  58,  56, 113,
-184, 113,  56, 184, 119,  58, 116, 187, 186, 125, 187, 125,  62,  58,  56,
-184, 125, 125, 125,  58, 125, 118, 184, 113, 184, 187,  56,  58, 184, 186,
-116, 113, 186, 113,  59, 119, 113, 116, 184, 113,  58, 184, 116,  58,  56,
-125, 118, 119, 125, 116,  63,  63,  56,  59, 118, 125, 118, 118,  56, 184,
- 56, 125, 116, 113, 116,  56,  56,  59, 178, 186,  58, 125, 119,  59, 184,
-178, 187, 119,  56, 178, 113,  58, 187, 118, 119, 178,  56, 119,  58,  58,
-119, 116, 186, 119,  56,  59, 178, 119,  56, 186, 184, 187,  56, 113, 118,
-125, 119, 187, 118, 187,  56, 184, 119, 119, 176,  59,  56,  56, 119,  63,
-116,  59,  59, 186, 178, 113, 184, 119,  58, 186, 187, 184, 187, 125, 184,
-118, 118, 119,  56, 187, 184, 116,  59, 125,  59, 118, 186,  56,  58, 116,
-178, 119, 187,  56, 125, 184, 184,  56, 125, 113, 119, 116, 119, 187, 119,
-186, 116, 116,  56, 178, 119,  58, 113, 119, 176, 118, 118, 113, 184,  63,
-118,  58, 119,  56, 184, 125, 119, 186, 186, 116, 119,  58,  56,  59, 125,
-113, 119, 184, 186, 125, 184, 187, 184, 178, 187, 118, 113, 119,  56, 113,
-113, 119, 184, 125, 186,  59,  62, 187, 116,  58,  62, 125, 186, 125, 186,
-125, 178, 113, 186, 176, 125,  56, 118, 186, 125, 116, 119, 184,  58, 125,
-116, 113, 113,  58, 118, 125, 113,  58,  59, 178,  58, 187, 186,  59, 119,
-184, 125,  56, 178, 118, 119,  59, 184, 187,  58, 187,  56, 184, 125,  56,
-113, 187, 118,  56, 113, 118, 116, 119, 186, 125, 125,  58, 118,  59, 186,
- 59,  59, 116,  63, 118, 118,  59, 113, 178,  58, 187, 125, 125, 118,  62,
- 56, 187, 186, 187, 187,  62, 125, 113,  59,  62, 186,  58, 116,  56,  56,
-125,  63,  59, 184,  59, 125, 187, 187,  58, 125,  62, 119, 125, 178,  58,
-118, 116, 119, 187,  56,  56, 113,  56, 178, 125,  59, 184, 176, 118, 116,
-186,  59, 184, 178, 119,  63, 119,  59,  59, 116,  62, 113, 116,  59,  59,
-187, 113,  58,  59,  58, 187, 113, 119, 187, 119, 125,  58, 119, 186, 125,
-184,  59, 186, 187,  56, 113, 113, 187,  56, 119, 187, 187, 184,  56, 113,
-186, 184,  56, 118, 184, 125,  56, 125,  56, 187, 178, 113, 113, 178, 119,
-187, 118, 119, 119, 184, 118,  58, 116,  56, 186,  56,  56, 187, 187, 116,
- 56,  56,  56,  63, 186,  56, 186, 119, 119, 116, 116,  62, 118,  59, 119,
- 59,  56,  56, 119, 125, 184, 187, 178, 119,  56,  56,  59, 116, 187, 184,
-113, 186,  58, 187, 186, 113, 186,  56, 125, 116, 119, 178, 113,  58, 187,
- 59,  63, 113,  62, 113, 186, 118,  59, 118,  62, 187, 187,  58, 187, 119,
- 62, 113,  58,  62, 113,  58,  62, 184, 118, 118, 178, 184, 113, 186, 178,
-119,  56, 186, 176, 186, 186, 184,  62, 116, 118, 116, 187, 118, 178, 118,
- 58, 184, 184, 125,  58, 184, 187,  56,  62,  56, 186, 184,  58,  59, 187,
- 62, 184, 125, 184, 118, 118, 176,  58, 118,  59,  56, 186, 125, 184,  59,
-184, 178, 187, 186, 125,  56, 176, 125, 176, 184,  56,  58,  56, 125, 186,
-118, 125, 187,  59, 178, 119,  58, 116, 184, 116, 184,  56, 184, 178,  56,
-119, 184,  58, 119,  58, 184, 116, 187, 187,  59, 178, 116, 119, 186, 187,
-178,  56, 119, 113, 178, 119,  56,  58, 116, 176, 176, 118,  62, 125, 118,
-125, 187, 184, 178,  62, 116,  59,  63, 119,  62,  56,  62, 187,  56, 113,
-186, 118,  59, 184, 125,  58, 187,  56, 178, 119, 119, 184, 125,  59, 125,
- 56,  56,  59,  59, 118, 118, 113, 116,  56, 119, 118, 125,  59, 187, 176,
-119, 125, 184,  56, 113, 184,  56, 187, 125, 119, 119, 119, 119, 178, 119,
-113, 119, 186, 116,  58, 184, 186, 125,  58, 187, 119, 118, 187, 187, 186,
- 59,  59,  62, 113, 184, 187,  56,  56,  58, 186, 113,  59, 176, 184, 118,
- 56,  59,  59, 184,  58, 125, 187, 119, 116,  59, 116,  62, 125,  56, 116,
-184,  56, 187, 184, 125, 116, 125, 113, 125, 187, 125,  62, 125, 186, 184,
-119, 125, 125, 119, 116, 116, 119,  56,  58, 187, 116, 187, 186, 187, 113,
-119, 125, 187, 184, 187, 184,  62, 118, 187, 116,  56,  59, 116,  62,  58,
-184, 187,  56,  58, 184, 187, 125, 184, 125, 184, 186, 176,  56, 119, 178,
-187, 125, 125, 176, 113, 119, 186, 178, 118, 187, 113, 119, 116,  59,  59,
- 62, 187,  56, 178,  56, 119, 184,  56,  56, 118, 119, 186, 119, 187, 116,
-186, 119,  56, 184, 119, 178,  58, 184, 116, 116,  56, 186,  56,  58, 178,
-186,  56,  59, 187,  56,  59,  56, 118, 119,  56, 178,  58, 118,  58,  56,
- 56, 119,  59, 116, 113,  59, 187, 186, 178, 113, 184, 118,  58,  58, 119,
-116,  59, 119,  56, 119,  62, 187,  62,  62, 125, 113, 119, 119, 176, 125,
-178, 116,  56,  59,  56, 125, 116,  59, 118, 119,  56,  56,  62,  59, 116,
- 56,  58, 176, 187, 113,  62,  58, 187,  59,  56,  56, 118, 178, 119, 113,
- 59, 125,  56, 187, 187, 113,  56, 187, 187,  63, 119, 184, 125, 187, 116,
- 56, 187,  62,  63, 119,  59,  56, 119,  62,  56, 184,  56, 119, 119, 184,
-187,  56,  58, 125, 184, 186, 178,  62, 187, 125,  59,  59, 187, 119, 176,
-118,  56,  56, 184,  62, 187, 119, 119, 125, 178,  56, 178, 184,  63,  63,
-116, 125, 125, 118,  59, 116, 184, 119, 119, 184, 125, 184,  62, 119,  58,
-125, 187,  56,  59, 119, 186, 178, 116,  56,  58,  56, 176,  56, 116,  59,
-116,  59, 113, 116, 125, 187, 125, 187, 187,  58, 187, 125, 113,  62,  62,
-119, 187, 186,  56, 186,  56, 184, 116, 178,  58, 184, 187, 186, 187, 119,
-119,  58,  59, 186,  56,  58,  56, 119, 187, 184,  59, 118,  56, 187,  56,
- 56, 116, 119,  59,  56,  56,  63, 178, 119,  56, 187, 184,  62, 178, 119,
- 56,  56, 184, 187, 187,  56,  59, 184, 125,  56, 187, 113, 118, 116, 184,
-184, 184, 184,  58, 176,  59,  62, 119, 119, 186, 119,  59, 116, 178, 178,
-184, 184, 119,  59, 178, 187, 116, 178, 119,  58, 184,  56,  56, 113, 184,
- 56, 119,  58,  59,  59,  59, 184, 119, 184, 113, 187, 125, 187, 184, 187,
- 59,  56, 116,  59, 125,  62, 119, 184, 116, 187, 113, 118, 178, 119,  62,
-178, 119,  56, 119, 119,  62,  59, 187, 119,  59,  58,  58, 178, 113, 113,
-118, 178,  56,  56, 178,  56, 187, 186, 118,  56,  56, 184,  59,  59,  58,
-184,  63,  62, 116, 184, 119, 119, 116,  58,  58,  56, 113, 125,  59,  59,
-119,  59, 178, 187, 113, 113, 187,  56, 116, 119, 187, 119,  56,  56,  59,
- 63, 119, 184, 118, 119,  62, 178, 125, 125, 113, 125,  62,  56,  62, 187,
-113, 118, 125, 116, 184,  56, 116,  56, 187, 118, 116, 116, 116, 184, 113,
- 62,  56,  56, 187, 186,  59, 184,  56, 184,  62, 119, 119,  59, 119,  59,
- 56,  56,  56, 186, 113,  59, 125, 178, 118, 119, 118, 176,  59,  59,  56,
- 59, 187, 184, 186, 119, 178,  59,  62,  58, 184, 184,  59, 186,  56,  56,
-119, 184, 119, 116, 187, 125, 125,  56, 118, 187,  63, 119, 116,  58, 187,
- 59,  62,  59,  58,  58, 116, 187,  59, 187, 116, 176,  58,  56,  56,  56,
-125, 119,  56, 187, 184, 116, 118,  56, 178, 119,  63, 119,  56, 113, 119,
-184, 187,  58, 186, 119, 116, 187, 178, 187, 125, 118, 125,  56, 187, 113,
-187, 187,  59, 119,  56, 116, 186,  58,  58,  59, 184,  59,  58,  63, 184,
-186,  56, 119, 119, 184, 187, 187, 119, 118, 186, 119, 119,  56,  62,  59,
-178, 119, 184,  58, 119,  56,  56, 119, 187, 187,  59, 187, 119,  56,  56,
-184,  56,  56, 184, 113, 116, 119, 119,  56, 119, 116, 116,  56, 176,  56,
-119, 119, 187,  56,  56,  56, 116,  58,  56, 184, 119, 187, 178,  59,  56,
-187, 184,  59, 187,  62, 119, 119, 125, 187, 116, 184,  56,  59, 118, 187,
-118,  58, 119,  56, 116, 125, 116,  59, 116,  56, 178, 116,  56, 116,  58,
-187, 116, 186, 118,  59, 187, 116, 187, 125, 119, 119,  62, 119, 187, 187,
-187, 178,  63, 119, 186, 178,  62,  59,  62, 184,  56, 187, 184,  59, 116,
-178,  56, 187, 187, 116, 187, 187, 119, 119,  56, 187, 125, 118, 184, 187,
- 56, 125,  59, 119,  58, 187, 119, 116, 178, 187, 184, 118, 187, 113, 119,
-184, 125, 119, 119, 184, 116, 116,  56, 116, 184, 125, 116, 113,  59, 119,
- 56,  56,  56, 119, 187, 186, 178, 119, 184,  63, 118,  59, 125, 116, 113,
-178, 119, 186,  56, 187, 125, 119,  63, 113,  56,  56, 184, 116, 125,  58,
-116, 116, 187,  63, 116, 116, 116, 187,  62,  56,  59,  56,  56, 113, 176,
-187, 119, 119, 187,  59,  62, 186,  56, 184, 184,  62,  56, 116, 187, 125,
-116, 119, 119, 178,  56, 178, 186, 116,  56, 119, 187, 116, 184,  59, 116,
-186, 118, 118,  56, 119, 116, 187, 119, 116,  56, 184,  56, 178, 113,  59,
- 56, 116,  58,  59, 184, 116, 184, 184, 186, 113,  56,  56,  56, 119,  56,
-119, 184, 187, 119,  59,  62, 178, 116, 184,  62,  56, 184, 187, 119,  59,
-178, 116, 116,  59,  62, 184,  59,  58,  59,  59, 187, 187, 119, 187, 178,
-184, 116,  56, 119,  56, 184, 186, 119, 187, 116, 184, 125, 187, 125, 184,
- 59, 178,  63, 119, 116,  59, 119, 184, 119, 178, 184,  59, 119, 187, 125,
-186,  59,  56, 187,  59, 178, 118, 116, 119,  56,  62, 178, 184, 116, 187,
-119, 187, 187, 178, 184,  56, 119, 187, 184, 119, 176,  58, 187, 176,  56,
-125,  62,  56, 116, 176, 187, 119, 186, 187,  62, 178, 178,  59,  56,  56,
- 56, 187,  56, 187, 187, 184, 178,  59, 116, 119,  56, 187, 119,  59, 178,
- 56, 119,  56,  62, 187,  62,  59,  56, 184,  56, 187, 186,  63, 178, 125,
-178, 187,  56,  56, 125, 178, 178,  63,  56, 184,  56, 184,  56, 119,  56,
- 56, 119, 116, 178, 184, 178, 119, 113, 187,  56, 184, 184, 187,  59,  56,
-187, 187, 187, 119, 119, 187, 119,  56,  56, 116, 119, 116,  56,  56, 119,
-184, 176, 125, 116,  56, 119,  62, 184,  59,  59, 113, 184, 116, 119, 187,
-184,  56, 119, 184, 178, 125, 119,  56, 116, 187, 125, 187, 187, 113,  56,
- 56, 187,  56, 184, 187, 184, 118, 178, 184, 184, 119, 184, 187,  59, 116,
- 62,  56, 187, 119, 184,  56, 116, 116, 116, 116, 116, 187, 125, 116, 184,
- 62,  59,  56, 178, 116,  59, 119,  59, 125, 116, 119, 119, 178, 187,  59,
- 56,  59, 176, 118, 187, 119, 116,  56, 176, 184, 184, 187, 178, 184, 187,
- 59,  56, 119,  63,  59, 116,  56, 116,  58, 184, 187, 187, 184, 116,  59,
-186,  56,  56,  62, 178, 119, 119, 119,  59, 176,  59, 119, 119,  58,  56,
-119,  56, 119, 187, 187, 187,  56, 116,  56, 119, 125, 178, 118, 184, 187,
-178,  62, 178,  59, 176, 116, 178, 119, 187, 116,  59,  62, 187, 184, 116,
- 59,  59, 125, 119,  56, 118, 119,  56, 116,  56,  56, 119, 184,  56,  56,
-178,  56, 116, 119,  56,  56,  62,  56, 184, 187,  56, 187, 178,  56,  56,
-116,  59,  56, 187,  59, 187,  56, 119, 116, 187, 119,  56, 116, 187,  56,
- 62, 178, 119,  62,  56,  56,  59,  59, 125, 119, 184, 184,  59,  59, 187,
-178, 187, 184, 184, 178, 187,  56, 184, 187, 119,  56, 116, 119,  58,  56,
-187,  59, 119, 119, 119,  56,  59, 187,  56, 119,  56,  56, 187, 187, 176,
-116, 184, 119,  56,  56, 178, 184, 116, 116,  56, 119,  58, 119, 119, 187,
- 56, 187,  59,  62, 119, 184,  59,  59,  62, 119, 187, 119, 119, 116,  56,
- 56, 184,  56,  59, 178,  56, 184, 116, 116, 187, 119, 113, 178, 116, 187,
-116, 119, 119, 178,  59, 178, 119, 116, 119, 116,  59, 116, 119,  56,  56,
-119, 187, 119,  56, 184, 187, 187,  59,  59,  56, 119, 184, 184, 187,  56,
-184, 116, 187, 119, 119, 187, 176,  59, 187,  59, 116, 119, 119, 116,  56,
- 56,  56,  62, 116,  56, 178,  59, 119,  56,  56,  56,  56, 119, 178, 187,
- 56,  62,  59, 178, 116,  62, 176, 187, 187,  56,  56, 119, 119,  63, 187,
-119, 119,  56, 119, 119, 184,  56,  56, 119, 178, 178, 184,  59, 187, 187,
- 56,  56, 187,  56, 184, 187, 184, 119,  56, 116, 178,  56, 116,  56, 178,
-116,  56, 119, 184, 116, 184, 119, 187, 184, 119,  62,  56,  63,  56, 119,
- 62,  63, 119, 187,  56, 178, 178, 116,  59, 119, 119, 184, 116, 184, 187,
-184,  56,  59,  59,  56, 187, 119, 178, 187,  56, 178, 184, 116, 187, 187,
-187, 184,  56, 119,  59, 119, 184,  59,  56,  56,  62,  59, 184,  59,  59,
- 56, 184, 187, 116, 116,  56, 116, 187,  59, 184,  56, 184, 116, 116,  59,
-187, 184, 184, 119,  59, 187,  59,  59, 184,  56, 187, 119,  59,  56, 116,
-116,  59, 187,  56, 119, 119,  62,  56, 184, 119,  62, 187,  59,  56, 119,
-184, 119, 119,  56, 119, 176,  59, 184,  56,  56,  56, 187, 116,  56, 187,
-178, 187, 116,  59, 116,  62, 178,  56, 187, 116, 178,  56, 116,  56, 187,
- 62, 187, 119, 176,  59, 119, 119, 116, 119,  56, 187, 116, 187,  59, 116,
- 59, 187, 184, 116, 116, 178, 116,  62,  62, 178,  59,  59, 119, 119, 184,
-187,  62, 119,  62,  59, 184, 187, 178,  62, 184,  62,  56,  56,  56, 178,
-187,  63,  62,  59, 187, 116,  59, 116, 116,  56,  56,  59, 187,  59,  59,
- 62,  56, 119, 184,  56,  56, 187, 116, 116, 119,  56, 178, 116,  59,  56,
- 56,  56, 119, 119,  56, 184, 184, 119, 119, 184, 178, 185,  62, 187, 190,
-119,  50, 119, 185,  62, 119,  56,  56, 185, 119, 119, 184, 119,  56,  56,
-119,  59,  59,  56, 116, 184,  59, 187, 119, 187,  50, 119, 119,  56,  56,
- 56,  59,  59, 119, 119, 176,  56, 187,  56, 184, 116, 187,  56, 187, 187,
-178, 185, 119, 119, 187, 184, 187, 116,  56, 185,  62, 187, 184, 187,  57,
-116,  56, 187,  56, 116,  56, 187,  59, 187,  56,  56, 116,  56, 176, 187,
-119, 119,  56, 119, 187,  59, 119, 116, 176,  59, 187,  56, 178, 119, 116,
-119,  63,  63, 184, 187, 184, 184, 119,  56, 187,  56,  59, 116, 178,  63,
-119, 187,  62,  56, 187, 187, 119, 178, 119, 119, 184,  59,  56,  62,  62,
- 56, 119, 116, 178, 116, 184,  56, 187,  56,  56, 184, 116,  56, 184,  57,
- 62, 187,  56,  56,  56,  56, 176, 119,  63,  56, 184,  50,  56, 117,  56,
- 56, 119, 116,  59, 187,  59,  56, 116,  63, 119, 119,  62,  57, 119, 178,
- 57, 184, 116, 187,  59,  62,  62, 116, 119, 119,  56, 184,  62, 187, 119,
- 56, 178,  56,  56, 119, 178, 184, 185, 187, 187, 187, 116, 184, 190, 184,
-187, 119,  56, 184,  59,  56,  59,  50, 116, 187, 187,  62,  57, 184, 119,
-116,  57, 117,  59, 187, 187,  56,  56, 187,  62, 116, 119, 184, 119, 116,
-119,  56, 178, 187, 187,  50, 178,  59, 119,  56, 119, 119, 119,  56, 178,
-119,  59,  56,  57, 178, 184, 116,  57, 187, 119,  56,  59,  62,  62,  56,
- 63, 119,  56, 185,  50, 119,  59, 187, 119, 119,  56, 176, 117,  56, 176,
- 56,  59,  56, 119, 184, 178,  59, 187,  59,  56, 116, 184, 116,  56,  50,
- 56,  59, 187, 187, 178,  63, 185,  62,  56, 119,  56, 184, 119,  59,  62,
-178, 185,  59,  56, 119,  62, 119, 187, 119, 178, 187, 116,  59, 184,  59,
- 56, 185,  56,  59,  56, 116,  56, 187, 116,  56, 187,  56, 119,  56, 187,
-187, 116, 119, 119, 117,  56, 178, 187,  56,  59, 178,  56,  56, 116, 116,
- 57, 185, 116, 187, 187,  59,  59,  56, 187, 184, 119, 119, 117, 117, 187,
- 56, 187, 187, 187, 187, 116,  56,  56, 184,  56,  56, 119,  56, 184,  56,
-119, 119, 190, 119, 190, 176, 184, 119, 119,  63,  56, 187, 184, 187, 119,
-116,  56,  56, 187, 116, 190,  59,  57,  56, 178, 178,  56,  56,  57,  57,
- 56, 116,  56, 187, 116, 187,  50,  59,  50,  57, 187, 184, 116, 116, 119,
-187, 119,  56, 117, 119, 116, 116, 184, 184, 187, 190, 178,  56,  62, 116,
- 56, 119, 119, 116, 178,  56, 187, 178, 187,  59,  50,  56,  50,  50, 187,
-116, 190, 119, 184,  56, 185,  57, 184,  56,  56, 184, 116,  56, 187,  56,
-116,  59,  62, 255,  56, 184, 119,  56, 119, 185, 176, 184, 119,  56,  50,
-119,  62, 187,  57, 185,  56, 187,  59,  59, 117, 117, 116, 119,  59, 119,
- 62, 116,  63,  62,  62, 185,  56,  63,  63,  56,  56, 116, 190, 187, 187,
-119, 116, 116, 116, 119, 116,  57, 187,  56, 176,  50, 187, 117,  56,  59,
- 50,  50,  59,  57,  56, 184,  56, 187, 255,  56, 119, 178,  62, 184, 116,
- 56, 185, 116, 119, 119, 178, 184, 178, 119, 178,  59,  56, 185, 185, 119,
- 59,  50,  56, 117, 117, 187, 187, 178, 119,  56, 178, 187,  56, 184, 176,
-119,  62,  56,  56,  56,  59,  56, 116,  56, 178,  56, 185, 185, 178, 117,
-119,  56, 119, 187,  57, 187,  59, 119, 187, 187, 184, 185,  57, 116, 187,
-187, 116,  56,  56,  56, 185,  56,  59, 119, 116,  59,  63, 116, 176,  57,
- 56,  57,  62, 119, 187, 119, 116, 116, 116,  59,  56,  50,  63, 116, 187,
-176, 178, 184, 178,  57, 185, 176, 119,  56, 117, 255, 178,  56, 119, 117,
-187,  56,  50,  57, 185,  56,  59,  56, 184,  59,  50, 178,  62, 185,  56,
-178,  57, 187, 178,  56, 187, 178,  50, 185, 116,  62, 185, 119, 116, 185,
-119, 185,  50, 190,  56, 184, 190,  56, 184, 187,  56, 184, 178,  56, 178,
- 57, 116, 184, 116, 185,  50, 187,  62,  59,  50, 119, 184,  59, 185, 117,
-187,  57, 187, 116, 116,  59,  56,  50, 187,  56, 187,  59,  57, 190, 178,
- 50, 185,  56, 187, 116,  56,  62,  56,  62, 119,  57,  59,  59, 190, 116,
- 63, 184, 116, 116, 119, 187,  56, 119,  56,  50, 185,  50, 190, 119, 178,
- 62,  62,  59,  50, 119,  57,  56, 185, 184,  56,  57, 184, 117, 116, 119,
- 57, 116, 184, 116,  56,  59,  57,  57,  56, 187,  56,  63, 187, 187, 119,
- 57,  56,  56, 117, 187,  56, 178, 185,  56, 117, 184,  56,  50, 187,  63,
-119, 116, 119,  50, 119, 119,  57, 119, 187, 184,  56, 117, 119, 178, 187,
- 59,  56,  57,  56, 119, 178, 184,  56,  56,  57, 178,  56, 116,  56, 185,
-178, 119,  57, 190, 184, 185,  50, 187,  59, 187, 178, 187, 178, 116, 184,
- 56,  56,  57,  56, 187, 119, 187, 176, 184, 116,  59, 187, 178, 187, 187,
- 59,  59,  56,  56, 119, 119,  56,  57, 117, 187, 185,  50,  56, 187,  56,
-187, 116, 116, 187,  59,  56, 190,  56, 176,  56,  56,  56,  62,  62,  56,
-187, 119, 187,  62, 184, 178,  50, 184, 187, 119, 187,  57, 116, 119,  63,
-187,  56, 185, 117,  56, 116,  56, 178,  62,  56, 178, 184, 119,  57, 119,
-116,  50, 119,  62, 187, 117,  56, 187, 178, 119, 185, 187, 187, 185, 178,
-119, 119,  56, 185, 119, 116,  50,  57, 190,  50,  56,  56, 184,  56,  59,
- 56,  59,  57, 117, 190,  56, 119,  56, 185,  50, 187,  57,  56,  56, 190,
-185,  56, 187, 176,  56, 178,  56,  56, 116, 184, 119, 116,  62,  57,  50,
- 50, 184, 116,  56, 178,  56, 116, 178,  56,  57, 116, 190, 184,  62,  62,
- 56, 119,  59, 185,  62, 185,  62, 178,  56, 119,  57, 176, 185,  56,  59,
- 50, 119, 184, 178,  56, 187, 119,  56, 119, 117, 184, 119, 185, 116, 178,
-116, 185, 187,  59,  62,  62,  59,  56, 185,  63, 117, 185,  56,  59,  63,
-185,  57, 117,  57, 178, 119,  59,  56, 187,  63,  50,  56,  56, 185,  59,
-178, 178, 185,  62, 178,  57, 119,  56,  57, 187, 119,  59, 117, 119, 187,
- 56, 187, 185, 187,  59,  59, 178, 119,  56, 176,  62, 117,  62, 178,  57,
-187,  59, 187, 184, 185, 190, 185, 119, 185, 190,  50, 119, 185, 187, 119,
-178, 119,  56, 187, 119, 119, 185, 185,  50,  50,  56,  57,  50,  59, 119,
- 57, 184, 116, 187, 176, 185, 187, 119, 119,  62,  57,  63,  59,  59,  56,
- 59, 176, 119, 116,  56,  50, 178, 117,  57,  50, 187, 185, 116, 117, 119,
-178, 187, 117, 117,  56, 116, 187, 190,  50, 185, 187, 178, 116,  56,  59,
-185,  56, 184, 176,  50, 185, 119, 117,  56,  56, 187,  56, 117, 184, 187,
-117, 116, 116, 185,  59,  56, 184,  56,  56, 178,  57, 178, 184,  56, 119,
- 50,  56,  56, 117,  56,  56,  57,  56,  56, 184,  57,  56,  56,  57, 117,
-185,  56,  57, 184, 119, 178, 190, 178, 184,  57, 119, 116,  56, 178,  56,
-187, 185,  62,  62, 178,  62,  56,  62,  59, 185,  50,  62, 116, 116, 119,
-119,  56,  62, 119,  57,  56,  56,  57,  63,  57,  57,  59, 187,  50,  50,
-190, 176,  56,  59, 187,  56, 190, 116, 117,  57,  50, 190, 185, 190,  59,
-184, 119,  56, 117,  50, 119,  57, 119,  56,  57,  57,  59,  50, 119,  56,
- 56,  57, 116, 184, 185, 187,  62,  56,  63,  56,  62,  50,  62, 117,  57,
-178,  56,  57, 187,  50, 187,  57, 119,  57, 178, 178, 187, 178, 190, 187,
-116, 190, 184, 116, 185, 119, 119,  56, 190,  50,  57, 116, 184,  56,  62,
- 50,  57, 117, 185, 119, 185, 178,  57, 178,  56,  62,  57,  56, 187,  56,
-116, 190,  62, 190, 117, 176,  62,  56,  57, 119, 187,  63,  50, 190, 185,
- 57,  57, 117, 119,  62, 116, 187,  56, 117, 119, 187,  50, 187, 187, 190,
-119,  57, 117,  50, 119,  62,  56, 190, 117, 190,  56, 178, 116, 116, 187,
- 63,  56, 190, 117,  50, 185, 119,  62,  62,  50,  57, 187, 116,  62,  57,
- 57, 178,  50, 187, 185,  63,  56, 185, 187, 185,  50, 119,  56, 255, 119,
-185,  50, 185, 119, 176, 190,  56,  62, 185,  59, 117, 117, 185, 116, 119,
- 56,  50,  56, 119,  50, 176,  50,  56,  50,  50, 185, 185,  57, 178, 116,
- 56,  57,  62, 116, 119,  59, 184, 116,  50, 176, 185,  50, 185,  57, 116,
- 50,  56, 187,  59,  50, 187,  56, 178, 178,  56, 119, 176, 187,  57,  62,
-187,  50,  62, 184, 116,  56, 116, 190, 187, 119,  50, 116,  57,  56, 187,
-178, 187,  56, 176, 178, 178,  62,  56,  57, 185, 178, 184,  63,  56, 176,
-117, 185,  57, 184, 116, 119,  62, 185,  56, 187, 117,  57, 187, 116, 190,
- 50, 116, 185,  50, 178, 117, 178, 185, 116, 178, 190, 119,  56,  56, 178,
-178,  57, 187,  57,  56, 178, 178,  57, 184,  56, 117, 116,  59, 190,  59,
-185, 178, 116, 185,  56,  57, 190, 178, 185,  50, 116, 184, 190,  56, 187,
-178, 178, 119, 178,  56, 190, 178,  62, 187, 116, 178, 119,  57, 116,  56,
-190, 178,  56, 176,  56, 184,  50, 178,  50,  56,  57, 187, 184, 176,  57,
- 59,  59, 187,  62, 185,  56,  50, 187, 178, 178, 185, 178,  50, 187, 119,
-116,  57,  56,  62,  57, 116, 178,  57, 176,  50, 185, 178, 117,  56, 119,
- 57, 185, 185, 117,  62,  50,  57, 119,  50, 178, 119, 117,  63,  63,  50,
-185,  56,  57, 185, 187, 187,  62, 117, 185,  62, 178, 185, 187, 185, 178,
-119,  56, 119, 187,  50,  57, 116, 187, 185, 117, 178,  57, 187, 187, 117,
-185,  56,  50,  50, 185, 190,  50,  56, 190,  50,  57, 185, 116,  57,  57,
-185, 116, 190,  57,  50,  56, 185, 117,  56,  56, 185, 190, 116, 185, 116,
-190,  56, 185, 185,  56, 119, 184, 119, 187, 185,  57,  62,  57,  50, 185,
- 56, 185,  57,  50,  50,  56, 178, 117,  62,  56,  56, 116, 119, 117,  56,
-190, 178,  56,  59,  57, 185, 116,  59,  56, 119,  50,  62,  59, 190, 178,
- 56, 185, 119,  56,  57,  50, 117,  56, 185, 116,  56,  50,  56,  56, 178,
-117, 116, 190, 178, 117, 190,  56,  50,  50, 117, 185, 190,  62, 176,  50,
- 57, 184,  50,  50, 184, 116,  57,  57, 119, 187, 116, 185, 185, 187, 185,
- 62,  62,  56,  56, 190, 187, 190,  57, 176,  57,  50,  62,  50, 184,  56,
- 57,  57,  57, 187, 190, 187, 187,  56, 187, 117, 176, 184, 178, 190, 119,
-116,  57,  62,  50,  57,  56, 116,  56, 185, 178,  62, 117, 117, 185, 185,
- 57,  50, 117,  57,  50, 187, 178, 119,  50, 178, 116,  50, 117, 116,  50,
-185,  57,  62,  57, 184,  57, 187, 119,  50, 190, 178, 117,  57,  56,  50,
- 50,  57,  56, 119, 190,  63, 178, 185,  57,  57,  56, 184,  56,  50,  57,
- 62, 187,  50, 187,  56,  50, 178, 187, 116, 185,  56, 187, 117, 119, 119,
-185,  57, 190, 119, 178, 117, 119, 119,  57, 190, 176, 187, 185,  56,  56,
-117,  57, 178, 178,  56, 116, 185,  56, 119,  57, 178,  50, 187,  57, 119,
- 57, 116, 116,  50,  56, 119, 178, 190,  50,  57, 178, 185, 187,  62,  50,
-117, 190,  50,  50, 119,  57, 185,  56,  62,  62,  50, 119,  57, 178,  56,
-117,  56,  57, 116,  57,  50,  57, 185, 178,  56, 190,  62, 117, 185, 187,
- 62,  56, 187,  57, 116, 117, 119,  56,  50,  50, 119, 187, 185, 185, 190,
- 62, 119, 117,  57, 116, 117, 178, 185, 185, 185,  50, 119,  57, 116,  56,
-185, 117, 187, 185,  62, 190,  56,  56, 184, 187, 190, 187,  62,  56, 190,
- 57,  57,  56,  57, 116, 117,  57, 185,  56,  57, 178, 187,  56,  57, 187,
- 57,  57,  57,  62, 117, 190,  56, 187, 190, 119,  50, 185,  56,  50, 190,
- 50, 176,  50, 185, 185, 185, 185,  50,  56,  56,  63, 117, 176, 185, 185,
- 62, 187, 178, 119, 187, 185, 178, 116, 187, 116,  57,  62, 184, 190, 185,
- 56,  57, 178,  63, 119,  50,  59, 185,  62, 119, 190,  57, 187, 185, 187,
-187,  50, 185, 178, 190, 190, 190,  56,  56, 178, 190,  63,  50,  57, 119,
- 56,  57, 117, 185,  50, 190,  56, 187, 119,  50, 178,  57,  57, 119, 178,
- 57, 117, 187, 178, 185,  59,  63, 185,  56,  50, 178, 117, 190, 178, 178,
- 50, 116,  57, 190, 116, 185,  50,  56, 178, 185,  56,  56, 116,  50, 187,
- 57, 117,  56,  57,  57, 187, 184, 187,  62, 119, 190, 119, 178, 117, 116,
- 57,  50,  50, 185,  56, 116, 178,  56,  57,  50, 185,  50, 119, 116, 190,
-117,  57, 185, 117, 185, 187, 185, 117, 178,  57,  50, 178,  50, 185,  50,
-185,  56, 190,  56,  56, 178, 119,  57,  57,  63,  62, 116, 119,  56,  56,
-119,  57, 119,  57,  62,  50,  62, 117, 190, 116, 185, 190,  57,  56, 187,
-178,  50, 178,  57,  57, 116,  62, 117,  59, 185,  50, 185, 185, 185, 176,
- 50, 190, 185,  57, 187,  57, 190, 185,  62,  57, 116,  50, 119, 176, 185,
- 50,  56,  62,  57,  63, 190, 117,  56, 119, 190, 185,  57, 187,  62,  57,
-187,  56, 178, 117, 119,  56, 178, 184, 190, 187,  57,  57,  63,  56,  62,
- 56, 187, 185,  62, 190, 185, 187, 178,  62, 185, 185, 117,  50, 178, 190,
-185, 187, 119,  57, 116,  57, 178,  56, 119,  62,  63, 187, 190, 187, 116,
-185, 185,  62,  57, 178,  62, 190,  50, 117, 178,  62, 119,  57, 185,  57,
-119,  56, 178, 185, 117,  50,  56, 119,  57,  57, 185,  57,  63,  57, 176,
-117,  56, 116, 185, 178,  56,  50,  50,  50, 117,  50,  56,  50, 116, 190,
-119,  63,  56,  62, 178,  62, 117,  57, 178,  56, 117,  57, 185, 190, 178,
-185, 116, 117,  57,  62, 185, 185,  56,  50,  57,  57, 178, 185,  50, 117,
- 50, 185, 185, 119,  56,  57,  50,  56,  50,  62,  50,  56, 119,  50, 185,
- 57,  57, 178,  57, 185,  57, 185,  50, 178, 187, 119,  57, 178,  50,  57,
- 56, 185, 185, 190, 116,  57,  56,  56,  50,  62, 185, 190, 185,  50, 117,
-185, 117, 190, 178, 190, 187, 185, 185,  62, 178, 185,  57, 119, 190, 190,
- 57,  57, 119,  57, 185, 176, 187,  56,  50, 187, 185, 185, 190,  50,  50,
- 50, 185, 119, 119, 176,  57,  57, 185, 117, 190, 119, 185,  50, 187,  56,
-187, 190, 176,  50,  57,  56, 119, 178,  57, 117,  57, 176, 116, 178,  57,
- 57, 178,  57, 119, 185, 176,  56, 116,  56, 190,  57, 187,  50,  50,  50,
-190,  57,  57,  50, 116, 190, 185,  62,  57, 190, 185, 176,  56,  57, 116,
-117,  57,  50, 176, 116, 190,  57,  57, 116, 178, 190, 178, 185, 119, 185,
- 57,  57,  57,  62, 178, 185, 185,  56, 190, 190, 185, 185, 176,  57,  62,
-187, 117, 117, 185, 190, 117, 176,  62,  57, 117, 185,  56,  57, 178,  50,
- 57,  62,  57,  62,  57, 117, 185,  50, 178,  50,  57, 178, 185, 190, 178,
-190, 119,  56,  56, 178,  56, 178,  62, 190, 190,  56,  50,  57,  57,  57,
-119, 119, 117, 117,  62,  62,  50,  62, 185,  57, 190,  56,  57, 178, 185,
- 57,  50,  50,  62, 178,  50,  50,  50, 116, 185, 117,  63, 185,  57, 185,
-187,  62, 185,  63,  56, 117, 190,  50, 185, 185, 190, 185, 185, 117, 178,
-117, 255,  50, 187, 185,  50,  57,  57, 187, 117,  50,  50,  57, 117,  56,
- 56,  56,  62,  57, 176, 119,  56, 190, 176,  57,  50, 116,  62, 176,  56,
-190, 116,  57,  50, 117, 116,  50, 185, 117, 190,  50,  50,  50,  57,  56,
-117,  57, 190,  57,  57,  56, 117,  62,  50, 185,  57, 178,  50, 179, 119,
-185,  56,  57,  62,  57, 117, 178, 190,  57,  50,  57, 185, 176, 119, 190,
-190, 185,  62, 185, 176, 190, 185,  56, 178, 178,  57, 176,  50,  57, 185,
-187, 178, 119,  57, 185,  50, 185, 187,  56,  50, 190,  57,  57,  50, 176,
- 50,  50,  50,  57, 185, 178,  56,  57, 185,  56, 178,  50,  57,  62, 116,
-119, 176,  50, 116, 116, 178, 178, 190, 185,  57, 185,  63,  57,  57,  50,
-176,  57, 179, 119, 185,  50, 119,  57,  50,  57, 119,  56, 176, 117, 185,
- 50,  57, 185,  56, 190, 117, 178, 187, 185, 117,  57,  62, 187,  57, 187,
- 57, 190,  57,  63, 190, 185,  57, 116,  57, 185, 117,  50, 119,  56, 185,
- 62, 190,  57, 179,  56, 185,  50,  62,  50,  63, 190,  56, 185, 117,  50,
-185,  50,  57, 187, 178,  62,  56,  50,  62,  63,  62, 178,  50, 117,  50,
-185, 190,  50, 185, 116, 185, 190,  57, 190, 116, 176,  60, 119, 190,  50,
-116,  50,  50,  63,  57,  57, 117,  57, 185, 178,  50,  57, 117,  57,  50,
- 57, 190, 185,  63,  50, 116, 190,  63, 187,  50, 119,  50, 190, 185,  57,
- 57, 178, 187,  57, 117, 117,  62, 190, 190, 190,  57, 185,  50, 190,  50,
- 56,  57, 178, 185, 178, 185, 185,  62,  57, 117, 117,  50,  62, 119,  50,
-190,  57, 185, 178, 185,  57,  57, 185,  57, 185,  50,  56,  57, 178, 117,
- 57, 190,  50, 190, 117, 185,  50,  56, 190, 178,  56,  50,  50, 117,  57,
- 50,  57,  57, 185,  50,  57, 117, 179,  57,  57, 119, 190, 185, 176, 117,
- 56, 190,  56,  56, 179,  50,  57, 185,  50, 117, 117,  57,  62,  50, 185,
-187,  57, 185,  63, 190,  57,  62,  62, 187, 190, 178,  57, 190, 178, 179,
- 50, 190, 178,  50,  57, 117, 190,  57, 185, 117, 117,  50, 187,  50, 185,
- 57,  57, 185, 185,  62, 185, 190,  50,  57,  62, 190, 185, 178, 185,  50,
-176, 179, 190, 117,  62,  50, 187, 190, 185,  57, 116,  60, 117,  57,  57,
- 62,  63,  56,  50, 116, 190, 190,  57, 190,  50, 117,  50,  57,  50, 178,
- 62,  50,  63,  62, 185, 185, 119,  57, 117, 185, 185,  57,  50, 190, 117,
-185, 187,  57, 178,  57,  62, 185, 178,  50, 185, 185,  50, 185,  62,  57,
-185,  57, 179,  57, 185, 190, 185,  57, 190, 176,  57, 185,  62, 185, 117,
-187,  50,  62, 190, 187, 185,  57, 185, 119,  57,  56,  56, 178,  60,  57,
-117,  57,  57,  57,  63,  57, 117,  50, 179, 178,  62,  50,  57,  50, 117,
- 62,  57,  57,  50, 117, 185,  50,  62, 185, 185, 117,  50,  57, 190,  57,
-117,  57,  50,  50,  50, 178,  50,  57,  50, 178, 117,  56,  62, 187,  63,
- 50,  57, 179,  57, 176, 119, 190, 117, 116, 176, 185, 116, 185, 119, 190,
-117, 178, 178, 190, 190, 187,  57,  63, 185, 119,  56,  50, 178,  60,  50,
-178,  57, 117,  50,  50, 185,  57, 190,  57, 190,  50, 178,  57, 117, 190,
- 63, 179,  62,  56,  50, 185,  56, 185, 117, 185,  50, 117,  57, 185,  62,
-185, 176, 179, 190,  50, 185,  57,  50,  56,  57,  57,  50, 117,  57,  57,
- 63, 185,  57, 190, 117, 190,  62,  50,  50,  60, 119, 185, 117, 117,  57,
-117,  57, 185,  57, 185, 185,  57,  57,  57,  50,  57, 117,  57, 190, 190,
- 56,  50,  50, 176, 190, 117,  62, 190,  56,  57, 117, 185,  50,  50, 185,
- 63,  57, 117, 190,  57, 185,  57, 190, 176, 185,  57, 178,  50, 117, 185,
-185,  57,  57, 185, 190, 187,  50,  50,  50, 185,  62, 185, 190, 178,  57,
-185,  50,  50, 190, 185, 190, 190, 117, 185, 185,  57, 178,  57, 185, 187,
-117,  57,  57,  62, 176, 185,  62,  50, 185, 185, 190,  50,  60,  57,  57,
- 50, 190, 117,  50,  50,  57, 117, 179,  50, 185,  50,  56,  56,  57,  50,
- 57, 185, 176, 185,  57, 119,  57,  57, 255,  62,  57,  57, 185,  57,  57,
- 57,  50,  60,  50,  57,  50, 185,  63,  57, 185, 185,  56, 117,  63,  50,
- 62, 179,  57, 187,  57,  57,  57, 178,  57,  57,  50,  50, 117, 185,  57,
-117, 185,  50, 178,  57, 190, 117, 116, 117, 117, 190, 185,  50, 185,  50,
-185, 176,  50, 190,  57, 117,  50,  50, 117, 190,  62, 117, 117, 190,  50,
-178, 178, 117, 117, 190, 185,  57,  56, 117, 190,  57, 190, 117, 190,  50,
-117, 178,  50,  57, 190,  62, 190,  57,  50,  57,  50,  62, 117, 117, 178,
- 50, 176, 178,  57, 190,  57, 117, 185,  50, 190,  50, 178, 117,  50,  50,
- 57, 185,  50,  50, 190,  62,  50,  57, 117,  50, 190, 190, 185,  62,  57,
- 50, 119,  57, 190, 178,  50,  57, 117, 185, 117, 190, 176, 117, 187,  50,
- 50,  57, 190, 117, 176,  63,  60,  57,  50,  57, 185,  57,  57, 185,  57,
-185,  57, 190,  60,  57,  50, 178,  50,  50,  57,  57,  50, 116, 178,  50,
-117,  62, 117, 117,  50,  57, 185, 190, 190,  50, 185,  57, 190,  56,  57,
-117,  57,  50, 190, 117, 185, 185,  50, 117, 190,  50, 117, 185, 190,  57,
-178, 185,  50,  50,  57, 185, 185,  56,  50, 117,  57, 179, 190,  57, 117,
-255, 117, 190, 117, 176,  50, 190, 185,  50,  57,  62,  63, 185,  57,  50,
- 50,  57,  63,  57,  57, 117, 190, 178,  57,  57,  60, 185,  57,  50,  50,
-185, 185,  60,  62,  57, 117, 185,  57, 185,  50,  50, 185,  60,  50,  57,
- 57,  57,  50, 185,  50,  60, 185,  50, 178, 179,  57, 119, 176,  57,  50,
-190,  57, 178, 179, 185, 185,  57,  63,  57,  50,  62, 185,  50, 185,  57,
- 50, 117,  63, 190, 178, 190, 117, 185,  50, 116,  60, 176,  50, 185,  57,
-117, 185, 185, 178, 178,  60,  62, 117,  57, 117, 190,  62,  60, 190, 185,
-185,  50,  57,  50, 185, 117,  57,  50, 117, 185, 190,  57, 179, 117,  57,
-190,  57, 185, 117,  50, 117, 117,  57, 178,  63,  57, 185, 178, 190, 117,
-190,  50,  50,  57,  57,  57,  50, 178, 190,  62,  60, 178,  57,  62,  63,
- 57,  57, 190,  50, 179,  57,  50,  57,  50,  50, 190,  62,  50, 117, 178,
-190,  50, 117, 117, 185, 190,  57, 117, 179,  57,  63, 185,  50, 185, 179,
-190, 190,  57,  57,  60, 117, 117, 190,  60, 117,  57,  57,  60, 190,  50,
-190,  57,  57, 178, 117,  51, 178,  62,  50, 190, 117,  50, 190, 117,  57,
- 57,  57, 178,  50, 190,  60,  57,  50,  57, 117, 178, 185,  50,  50, 190,
- 62, 117,  50,  60,  57, 117,  57,  57,  62,  57, 185,  50, 117,  57, 117,
- 57,  63, 117,  50,  50,  60, 185, 185, 188,  60,  57, 185, 185, 190, 190,
- 57, 185,  57, 185,  57, 117, 185, 190,  57, 117, 179, 178, 117,  57,  62,
-191, 190, 176, 190, 185,  57, 179, 185,  60,  60, 179, 185,  50,  50,  50,
- 50, 117,  50, 190, 185, 185,  50,  62,  50,  50, 117, 185,  50,  50,  57,
-185, 176, 190,  50,  60, 185,  57, 190, 117, 185, 185,  50,  50,  57,  57,
-178, 178, 190, 117, 185, 117,  50, 190,  57,  57,  60, 117, 185,  50, 176,
- 57,  50, 117,  57,  50,  57, 185,  57,  57, 117, 178, 190,  50, 176,  57,
- 51,  57, 179,  50, 117,  57, 185,  57, 117, 190, 117,  57,  60, 117,  63,
-190,  51,  50, 178, 178,  50,  50,  57,  50,  50, 190, 185, 117, 176, 178,
-185, 185,  62, 179,  57,  50,  50, 117,  57, 190, 190,  57,  62,  50,  57,
- 50,  50,  57, 185, 188, 117,  50, 190,  62,  57, 185, 117, 117, 185,  50,
-179, 185,  57, 190,  63,  57,  57, 185,  63,  57, 185,  60, 190,  62,  60,
-117,  57,  60, 190, 117,  60,  50, 179,  57,  62, 190, 117, 190, 178, 190,
-190,  50, 190, 190,  57, 179, 190, 117,  62, 185, 185,  57,  57, 178,  50,
- 50,  60, 117,  50,  50,  57,  50,  60,  50, 179, 185, 178, 117,  50,  48,
- 57, 185,  60,  51,  51, 185,  62,  57, 176,  57, 176, 178, 190,  57,  50,
-176,  50,  57,  57,  57,  50,  50, 178,  50, 185,  50, 117,  57, 185,  57,
- 57, 179,  57, 178, 190,  50,  57, 185, 117, 185,  57, 190, 179, 191,  50,
- 57,  57,  57, 179,  57,  50,  57,  50, 190,  60,  62, 185, 185, 117, 190,
- 57, 117, 178, 190, 117,  50, 117,  60,  57, 190, 178, 185, 176, 190, 185,
-178,  50,  57,  57,  50, 179,  51, 185, 179, 179,  57, 190, 190, 179, 185,
-185, 188, 176, 117, 179,  62,  57,  50,  57, 117, 190, 188,  57,  57,  57,
- 50, 190, 190,  57,  50, 185,  50, 179,  50, 185, 117,  57,  50,  57,  57,
-178, 190,  57,  60,  57,  50,  62,  50, 185, 185, 178,  50,  57, 117, 185,
- 57, 190, 117, 190, 190, 117, 185, 117, 185,  57,  57,  57,  51,  50, 190,
-117, 117, 117, 190,  57,  57,  57,  57, 185,  57,  60,  50, 190,  57,  50,
-179,  62,  50, 190, 117, 117, 185, 188,  57,  50, 185,  60, 191, 185,  50,
- 50,  50,  51, 185, 117, 176, 117,  50, 117,  63, 117, 188,  57, 188,  57,
-190, 117, 188, 185,  57,  60,  57, 117, 185, 185, 179,  63, 178, 176,  48,
-179,  48,  57,  57,  50, 190, 190, 117,  50,  62, 190,  50, 185, 178,  57,
-117,  63, 190,  57, 190, 190, 117, 185,  57,  50, 185, 185, 185, 179, 190,
-185, 185, 190, 190, 188, 117,  57, 190,  50,  50, 190,  50, 190, 190, 185,
- 50,  57, 117,  50,  50, 117, 179,  62, 185, 176,  57,  60, 176,  50,  57,
- 50,  57,  57, 179,  51, 117,  51,  62, 190,  50, 117, 190,  51, 190, 178,
- 62,  50,  48,  50,  51, 191, 190,  60, 185, 176,  50,  57,  60, 190, 190,
-185, 178,  50,  48, 117,  57, 185,  50,  60,  57, 179,  50, 117,  57,  57,
-255, 179, 185, 185, 185,  50, 176, 185,  57,  50, 185,  48, 185, 190,  57,
- 50,  63, 117, 117,  50,  51, 117,  57, 185,  57,  50,  62,  57,  57,  51,
- 57,  50,  62,  51, 188, 190,  50,  57, 190, 185,  50,  50,  62,  57, 117,
-185, 185, 176,  63, 117, 185,  51, 179, 190,  63,  57, 176, 185,  50, 185,
-190, 190,  50,  60, 190,  57,  50, 190, 190, 185, 117, 191, 191, 190,  57,
-185,  51, 185, 179, 117, 179, 176, 191,  48, 178, 185, 117,  57,  50, 179,
- 50,  57, 185,  51,  63,  60,  50,  60, 179,  48,  50,  50, 117,  62,  50,
- 57, 117, 188,  57,  50, 117, 179,  50, 185, 191, 178,  60,  62, 185,  57,
-117, 178,  57, 190,  57, 117,  50, 178,  60, 176,  57, 117,  57,  50, 191,
- 60, 185,  48,  57, 176, 117,  50, 117,  62,  57,  50, 190,  57, 188,  48,
- 57,  60,  57, 190,  60,  62, 190,  57, 190, 179, 117,  57, 117,  51,  57,
-185, 179,  57, 185,  57, 179, 117,  60,  57, 185, 185,  57,  51,  60, 178,
-117, 185,  60, 190, 176,  60, 117, 178,  50, 117,  57, 191, 178,  57, 185,
- 63,  57,  50, 190,  57, 190, 190,  57, 190, 178,  62,  51, 179, 117, 188,
- 51, 188, 178, 190, 178, 185, 185, 179,  57, 178, 188,  57,  57, 190,  60,
-185,  50, 190,  50,  50,  50,  51, 185,  50,  57,  62,  63, 185,  50, 185,
-190,  60,  57, 185, 117,  57, 179,  57,  50, 185,  57,  50,  50, 190, 117,
-185,  48,  60,  51, 117,  63, 117, 117,  50, 188, 190, 117,  63,  50, 176,
-191,  51,  50, 191,  60, 190,  50,  50,  60,  50,  50,  57, 185, 179,  50,
-185,  60, 176, 117, 179, 117,  60,  57, 190,  48,  62, 185,  48,  51,  50,
- 63,  51,  48, 190,  60, 185, 191, 178, 190,  50, 117, 117,  51,  50,  57,
-179,  51,  60, 185, 179, 190,  60, 188,  48, 117,  50,  57,  57, 188, 191,
-190,  57, 185, 185,  60,  50,  63, 188, 190,  57,  50, 179, 179,  57,  50,
- 60,  57,  57, 117,  60,  50, 178,  48,  62, 185, 190, 176,  57,  48, 190,
-190,  57, 179, 185,  50,  57,  50,  57, 191,  50,  50,  50,  50, 117,  57,
-190, 117, 185,  51,  62,  57,  57,  48, 176,  60,  60, 190, 117, 190, 178,
-190,  57,  48,  60,  57, 190, 117,  50,  60, 179, 185, 188,  60, 185, 185,
-185,  62, 190, 185, 188,  57, 188, 179,  57,  60, 185,  57,  57,  48, 188,
-185, 117,  50,  57,  57, 185, 185, 117,  57,  51, 185,  63, 188,  63, 176,
- 60,  50, 190,  50,  50, 185, 117, 185, 185,  60, 190, 117,  51,  48,  57,
-179,  57, 190,  57, 190,  57,  57,  51, 185, 191,  57, 185, 185,  57, 185,
- 60,  50,  57, 178, 190,  50, 190,  60, 188,  62,  57,  50,  50, 190, 117,
-117, 176,  50, 188, 117, 117, 117, 188,  50,  50, 117, 185,  51, 176, 185,
-188,  50,  57,  51, 190,  57, 178,  57, 176,  51, 185,  60,  50, 179,  60,
- 63, 179,  50, 188,  50, 188, 117,  50, 185,  50, 117, 190,  51,  62, 179,
-188,  62, 185, 185, 188, 117, 185, 179, 117,  60, 185, 185, 190, 190,  57,
-190, 190, 188,  48,  50,  50, 185, 117, 190, 191, 185,  51, 117,  50,  60,
- 63,  63, 179, 176, 117,  50,  50,  50,  60, 178, 190,  50, 117,  51,  57,
-179,  48, 191,  51,  62, 190,  51,  57,  57,  57, 185, 185, 191,  57, 185,
- 48, 117, 191, 117,  48,  50, 179,  51, 190, 190, 185, 178,  57,  57, 185,
-117, 190,  57, 190, 191, 117,  50, 185,  51, 191,  57, 185, 117,  57, 191,
-179, 179, 190, 188, 178,  50, 178,  51, 117,  48,  57, 190, 176,  57, 190,
-190,  51, 188, 117,  63, 190,  48,  50, 179, 178,  51, 191,  57, 185,  51,
- 50,  50, 179,  57, 117, 188,  51,  57, 185, 178,  60,  57,  57,  60, 117,
- 50,  51, 185,  57,  50,  60,  51, 117, 179,  48, 179,  57,  63, 185,  60,
- 60,  57,  57, 191, 178, 190, 179,  57,  62, 185, 191,  60, 179, 190, 176,
-190, 117, 178, 179, 117, 117, 188, 188,  60,  57,  57, 190,  57, 185, 117,
-179,  57,  62,  57,  50, 190,  57, 190, 190,  60,  48,  50,  57, 176, 176,
- 50,  51, 179,  57,  63,  57, 117, 176,  57,  50,  57,  50,  57,  50, 178,
-185, 117,  57,  51,  48,  51, 185,  51, 179,  50, 117, 117, 190, 185, 178,
- 48,  63, 117,  60,  60,  63,  63, 191, 185, 179,  57,  60,  51, 185,  60,
- 62, 185, 188, 185,  57,  62,  50, 178, 117,  60, 179,  57,  48,  50, 117,
-190, 188, 190, 185, 185,  48, 188,  57,  51, 190, 185, 179, 185,  60, 117,
-176,  60,  51,  57, 191,  51, 188, 117,  50,  57,  51,  51, 190,  60,  50,
- 57, 190,  60,  50, 117, 188,  57,  51,  50,  57,  60,  60,  50,  48,  60,
- 48, 117, 178,  48,  60,  51, 176, 188,  60, 190,  60, 185, 117,  51, 190,
-188,  50,  57, 188,  50,  48,  60,  51,  51, 178,  63, 188,  51,  50, 185,
- 57,  60, 185,  57, 185,  51,  57,  48,  62, 185, 185, 188, 191,  51, 117,
- 50, 185,  51, 188,  60,  60, 176,  60, 188,  57,  50, 176, 185, 190,  60,
- 57, 185, 117,  50, 117,  50, 179,  51, 179, 178,  50, 190,  60, 117, 191,
- 50,  62,  50,  57,  63,  50,  50, 185,  50, 185,  50,  48, 176,  57, 190,
- 62,  50, 176, 190, 190, 190, 190,  60, 176, 185, 117, 190,  63, 179, 117,
-188,  57, 185, 191, 185, 191,  48, 117,  60,  63,  57, 191, 191,  51, 178,
-117, 117, 190, 176,  57, 188, 185, 179, 179,  57,  48, 179, 188, 188,  50,
- 57,  50,  60, 185, 190,  57, 178, 179, 190, 191, 179,  51,  57,  57, 190,
-178,  48, 117, 191,  48,  50,  50,  48,  57, 179, 185, 117, 178,  60, 178,
-117,  62,  51, 176,  51, 190, 117,  51,  51, 190,  48,  51,  60,  57,  48,
-185, 179, 185,  50,  57,  62,  48, 179,  57,  51,  57,  57, 176,  51, 179,
- 51,  51, 185,  60,  63, 117, 191, 190,  60,  60,  60,  50,  51, 190,  63,
-190, 117,  51, 190,  60, 185, 179,  57, 191, 185, 188,  57,  57,  60, 188,
- 51, 185,  60, 185, 185, 185, 185,  57, 191, 188,  57,  57, 188,  48,  57,
- 57, 191, 185, 185, 179, 176,  60,  48,  48,  51,  51,  57,  50,  60, 117,
- 50,  57, 191,  51, 117, 117,  57,  51, 176,  50, 190,  50,  50, 188, 185,
- 50, 190, 191,  50,  50, 188,  57,  50, 190,  60, 185,  50, 178,  57,  51,
-117, 117,  48, 190, 178, 190,  48,  51,  57, 191,  60, 179, 117,  57,  51,
-185,  51,  60, 179,  51, 117, 117, 117, 178,  51, 176, 188, 185, 176, 188,
- 63, 188, 188, 191,  48, 190,  60, 185, 185, 178,  48,  51, 176, 185,  50,
- 57,  51, 191,  63,  51, 176,  48, 176,  48, 179,  51, 188, 188,  60,  48,
-191,  57, 190,  48, 188,  50, 188, 179,  57,  50, 191, 185,  48,  62, 191,
-178, 190,  48, 117, 179, 188, 190,  63, 179,  51, 117, 191,  48, 190, 255,
-188,  60, 179,  62,  57, 117, 117, 178,  51, 117, 117, 190, 117, 185, 190,
-185, 176,  51, 176, 188,  51, 176,  57,  60,  63, 185, 179, 179, 179, 117,
-179,  51,  51, 176,  48,  50,  60, 191,  57, 190, 185, 190,  60, 185,  60,
-179, 188,  50, 190,  60,  57, 185, 176,  51, 191,  57, 190, 178,  57, 179,
- 62, 185,  51, 179, 117,  50, 176,  57, 185,  48, 191,  60,  51, 185, 178,
-188, 117,  50,  48,  50, 117,  60, 117, 188,  50, 179, 117, 176,  50, 176,
- 50,  62,  60,  57, 190, 178, 191, 185,  48,  51,  48,  50, 179,  63,  48,
- 62,  51, 179, 117,  60,  57,  62, 188,  57, 117, 178, 185,  60,  60,  57,
- 50, 179,  63,  48, 191, 191,  60, 185, 188, 188, 190,  50, 179,  50,  48,
-188, 117, 179,  51, 179,  63, 190, 188,  57,  57,  57,  57,  57, 185,  57,
-191,  51,  51,  57,  51,  51,  50,  50,  51,  50,  60,  48, 185, 179, 190,
-255,  48,  57, 185,  60,  50, 190,  50,  48,  51, 190,  60, 185,  51, 178,
- 57, 185,  60, 188,  60,  50,  48, 190,  51, 190,  48,  60, 117,  51,  60,
- 51, 179,  60, 188, 191,  50, 191, 179, 191,  63, 179,  48,  57,  57, 179,
- 48,  51,  51, 190,  63,  57,  51, 117, 176, 188, 188, 179,  57, 179,  51,
-179,  57,  51,  57,  60, 190,  57, 117, 176, 179, 179, 179, 117,  48, 190,
- 51,  60, 117, 117, 176, 185,  48, 178, 190, 179, 188,  50,  60,  63,  50,
-176,  60,  50,  50,  60,  50, 117, 255, 188,  60,  57, 185,  57,  48, 190,
-185,  51,  48,  51,  63, 185,  50, 185,  50, 185,  63,  48, 179,  51, 176,
- 48,  60, 191, 185,  51,  60, 179, 179,  60, 188, 179, 190,  48, 185,  50,
- 48, 191,  51, 179, 188,  50,  48,  48, 188,  50,  48, 117, 190, 190, 185,
-191, 117, 185,  51, 179,  51, 179,  48,  48,  57, 191, 117,  48,  62, 191,
- 63,  51, 190,  48,  51,  50,  57, 190,  57,  57,  50,  51, 190,  51, 185,
- 48, 191, 188,  50,  51,  63, 185, 178,  60, 188, 179,  48,  48, 188, 191,
- 57,  62, 185,  60,  51, 179, 188, 185,  60,  48,  60,  48,  51, 179, 190,
-188,  57, 188, 191,  57, 185, 117, 188,  48, 190,  50, 188, 190, 117, 190,
- 50,  60,  60, 185,  51,  63, 179, 178, 255, 117, 117,  60,  51, 188, 188,
-185,  57,  50, 188, 179, 188, 188, 117, 179, 191, 188, 190,  60, 117,  50,
-188,  50, 188,  51,  51,  57, 185,  51,  48, 178,  50, 117, 191, 176, 179,
-179, 190, 188,  60,  51, 188,  57,  50, 179,  60, 191,  51, 185, 179, 191,
-190, 191,  57, 185, 179,  51,  51,  63, 178, 179, 179, 176, 191, 185,  57,
- 48,  50,  48, 191, 255,  48,  51,  60,  51,  51, 190,  51, 176,  60,  51,
- 63,  50, 188,  51, 188, 191, 185,  60,  57, 191,  51,  60, 179, 176,  63,
- 51,  50, 188, 188,  51,  51,  60, 185,  57,  48, 191, 117,  48,  57, 190,
- 51,  51,  57, 185, 191, 176,  51,  51, 176, 178, 191,  48,  48, 178, 188,
-117, 179,  50,  50, 117,  60, 188, 188, 179,  50, 179, 190,  48, 191,  50,
- 48,  57, 188,  48,  57,  57,  57, 178,  50, 179, 179,  51, 176, 179, 185,
-176,  48,  57, 185, 188,  50,  60,  48,  60,  51, 190, 176,  60, 190, 179,
- 48, 185, 188,  60, 185,  51, 179,  60,  48,  57,  50, 179, 178,  60,  48,
- 51,  51, 179, 117,  51, 188,  48,  60, 191, 185, 176,  48, 190,  63,  48,
-179, 191,  50, 190,  60,  60,  60, 190, 191,  51,  60, 117, 190,  60,  62,
-190,  50, 185,  60, 179, 185, 176,  57,  60,  57, 190, 179,  51,  51,  50,
- 60, 188,  50,  63, 188, 185,  50, 179,  60,  48, 179, 190,  57,  62,  57,
- 60, 188, 191,  60, 176, 185,  51, 117, 185, 188, 179, 191,  51, 179, 179,
- 63,  51, 117,  48,  60,  51,  51,  51,  51,  50, 190,  48, 185,  50,  60,
-117, 176,  51, 191, 191, 188, 191,  51, 179, 188,  50,  48,  48, 188,  48,
- 62, 117,  48, 185, 117, 188,  60, 185, 188,  51, 190,  51,  62,  57,  57,
- 51, 188, 179, 117,  51,  51,  57, 191, 176, 188, 190, 176,  51,  48, 191,
- 50,  50, 190, 179,  60,  51, 188, 188, 185, 188, 191,  48, 191, 191, 191,
-176,  50,  51, 176, 179, 117, 191,  48, 179, 178, 188,  51,  50,  60,  57,
- 57,  50, 191,  51,  50, 188,  63,  60,  50,  60,  63, 191, 178, 188,  51,
-179, 176,  60, 117, 191,  48, 188,  51,  48,  50,  48, 190, 185,  51, 191,
- 48, 191, 179, 117, 191, 178, 179,  57,  48, 185,  48,  57, 176, 185,  51,
-179, 176,  48, 179, 188,  60,  51, 188, 117, 188,  51,  60, 185, 188, 191,
- 51, 191,  60, 188, 179, 176, 179,  48, 176,  63,  60,  60, 179, 191, 185,
-188, 191, 179,  48,  48,  50, 185,  51, 178, 179,  60, 185, 191,  62,  60,
- 48, 117, 179,  51,  51, 191,  50,  60,  50,  60,  57,  51, 191, 179,  63,
-179,  63, 179,  51,  60,  50, 188,  48,  60,  48, 191, 117, 188, 191, 117,
-117,  57, 188,  60, 176, 188, 190, 190,  51,  51,  48, 188, 179, 191, 188,
-188, 188, 185, 188,  60,  62, 185,  60, 185,  50, 188, 179, 188, 176, 190,
- 48,  48, 190,  60,  48, 190, 188,  60,  62,  57,  60, 190, 188,  60,  60,
-179,  63, 191, 190,  60,  60,  48,  48, 188,  51,  50,  51,  51, 188,  50,
-178, 188,  51,  48,  60,  48, 117, 117, 179,  51, 179,  60,  51,  51,  51,
-179,  51,  60,  60,  51,  51, 117,  60,  51, 117,  48,  60, 185,  51, 191,
- 57,  51,  60, 179,  48, 176,  60, 191, 188, 179, 188, 188,  48,  48, 188,
- 60, 179, 190, 179,  51,  60, 191,  48,  48, 176,  48, 117,  60,  60,  63,
-190, 117, 191, 188, 179,  48,  48, 191, 176,  60,  48,  48,  48, 185, 191,
- 60,  63,  48, 191,  57,  51,  48,  57,  51, 191,  51, 188,  48, 179,  51,
- 51,  48,  51,  48, 188,  60, 188,  57,  60,  50,  51, 188,  60, 188, 179,
-179,  63, 188,  57, 188,  51, 179, 191,  48,  51, 191,  51,  60, 191, 191,
-190, 176, 117,  48, 191,  48, 191,  57, 188, 176, 185, 191, 185,  60,  48,
-188, 179, 188,  50, 191,  48, 190, 179,  51,  63, 190,  51,  60, 117, 117,
-188, 191, 176, 185,  63, 176, 179, 179,  51,  63,  60,  50, 190,  48,  51,
-185,  50,  51, 179,  60, 179, 117,  60,  50,  57,  63,  60, 176,  48, 179,
- 51,  48,  60, 190,  60, 176, 190,  60,  51,  57, 176,  57,  51, 188, 188,
- 50,  51, 188, 191,  48,  51,  60, 176, 190, 179,  51,  57,  60,  51,  57,
- 57, 179,  60, 179,  60,  51,  48, 179,  48, 179,  51,  60, 190, 179,  51,
- 60,  51,  60,  57, 188, 117,  60, 188, 176,  48,  60, 176, 191,  50,  50,
-190,  63,  48, 185,  48, 191,  51,  63,  57, 179, 179,  63, 185, 191,  57,
- 48,  60,  57, 179,  51,  48,  60, 191, 176,  60,  48,  51,  48, 176,  51,
-191,  51, 188, 117,  48,  51, 179, 188, 188,  48, 191, 188, 188, 117,  60,
-178, 176,  60, 178, 191,  57, 188,  48,  48,  48,  60,  50, 188,  48, 185,
- 51, 117, 176,  57,  48, 188, 188,  51, 188, 188,  48,  51,  48,  48, 188,
-176, 188,  48,  60, 179, 178, 188, 185,  51,  48, 179, 176,  48, 176, 188,
- 60,  51, 185, 179,  51, 191,  51,  51,  50,  60,  51,  51, 179,  51, 188,
- 57,  50, 179,  60,  50, 191, 191, 188,  63, 191, 179,  51,  60, 188,  51,
-185, 188,  51, 191, 191, 176, 179,  51, 190,  51,  51, 185,  60, 191, 117,
- 63, 188,  50,  60,  60,  60,  60, 191,  48, 176, 179,  60, 117, 188,  48,
-188,  60, 188,  63, 185, 191, 191, 179,  48, 191, 188, 179,  57,  60, 117,
-191,  51,  51, 188,  51, 179,  60,  60,  51, 188, 191,  60, 179,  51, 188,
-188, 176, 179, 188, 179, 179, 117, 178,  48,  63,  63,  60,  48,  50,  48,
-191,  63,  48, 188, 188,  51,  51,  63,  60, 176,  51,  48,  60,  60, 188,
- 57, 191,  63,  51, 191, 191, 191,  48, 188,  51, 188,  60, 188,  51,  51,
-191, 179,  60, 179,  51, 178, 188,  51,  51,  62,  51, 185, 117, 190, 185,
-191,  48,  48,  60,  60,  48, 191, 188,  50, 179,  60, 176, 190,  60, 191,
- 60,  50, 191, 179, 191,  60,  57, 188, 188,  51, 191, 179,  63, 179, 188,
- 60,  51, 179,  60, 191,  60, 179,  51,  60, 191, 188,  57,  51, 179, 179,
-188,  51,  57,  48,  51,  50, 188, 191,  51,  51, 179, 185, 191, 188,  51,
- 48, 179, 188,  48,  57,  48,  57,  48, 188,  60, 179, 188,  60,  60,  60,
-179,  60, 188,  51,  48, 179,  50, 179, 188,  60, 179,  48, 179,  57,  48,
-117,  48,  51,  60, 190,  51,  51, 191, 176, 185,  51,  50,  51,  51, 188,
-191,  57, 188,  60, 176,  60,  51,  60, 179,  51, 179, 188,  51, 190, 179,
-179,  60, 185,  60,  60,  51,  60,  51, 188,  51, 191, 191,  51,  60, 191,
- 48, 179, 188, 188,  60,  48, 179, 191,  57, 191,  48, 190,  60, 188,  48,
- 63,  48,  50, 188, 179,  51, 188, 179, 188, 185, 179,  51, 188, 179, 179,
- 48,  48, 191,  60,  57,  63,  51, 188, 188, 179,  48,  60,  51,  51,  51,
- 51, 179,  51,  48,  60, 188, 179, 188, 179,  48,  60,  51,  51,  60,  51,
-179,  51,  48, 188,  63, 188, 188,  60, 191, 190, 117, 191, 179, 176, 179,
-179, 179,  51,  51, 179, 176,  48, 191, 117,  51, 191,  60,  51,  63, 185,
- 60,  48,  51, 185,  50, 191,  62,  51, 188, 179,  51,  48, 185,  60, 188,
-179, 191,  48,  60, 188, 179, 191, 185,  60,  57,  48,  48,  57,  60, 188,
- 51,  60,  51,  51, 179, 191,  51,  60, 191,  60, 191, 188,  48,  50,  51,
-179, 185,  60, 179,  48,  51,  60, 188,  48,  51, 191,  48, 178,  51,  60,
- 51,  51,  60, 179,  48, 179, 191,  60,  48,  51, 188,  48,  60,  60,  60,
-179, 188,  60,  48, 179,  51, 191,  48,  48,  51,  51,  51, 190,  48, 191,
- 51,  51, 191, 191, 179, 179,  60,  63,  60, 188,  51,  60, 191,  57, 191,
-188, 191,  51,  51,  51,  60,  60,  60,  48,  60,  60, 179, 188, 188,  51,
- 48,  48,  48, 179, 188, 191,  60, 176,  60, 176,  60,  51, 191,  50, 191,
- 60,  48,  51,  48, 191,  60, 191,  51, 191, 188, 179,  48,  60, 191,  60,
-179,  48, 188, 188, 117, 117, 191,  48,  60,  57,  48, 191, 188, 179,  60,
- 51, 188, 176,  57, 117, 188, 188,  48,  48,  48,  63,  60,  51,  51, 179,
- 48, 176, 178,  60, 188, 179,  48,  51,  51, 188,  63, 191, 179, 179,  60,
-185,  51,  57, 188,  48, 188,  48, 191,  60,  51,  48, 179,  51,  51,  60,
- 51, 188, 191, 179, 188, 191,  60, 188, 188, 188, 188, 179, 188, 176, 188,
-176,  60,  48, 176,  63, 188,  60,  48, 179, 188, 188, 188,  51,  48, 188,
- 60, 179, 191,  51,  48,  48, 191,  60,  51, 188, 191,  48, 179, 179, 179,
-188, 179,  51, 176, 188,  51,  60, 188,  63,  60,  51,  51,  48,  51, 179,
- 51,  51, 179, 176,  60, 176, 191, 188,  60,  51,  60,  51,  48,  51,  51,
- 60,  48,  57,  48,  48,  51, 179,  48, 179,  60,  51, 179, 176,  63,  51,
-191,  60, 188,  51,  60, 191,  48,  48, 179, 191,  63,  48,  60,  51,  60,
- 51, 191,  60, 188,  48,  51, 191, 188,  51,  48,  51,  48, 188,  48, 191,
-191, 191,  48, 179,  60,  51, 191, 188, 179,  48, 188,  48, 176, 179, 191,
- 51, 191,  63,  51,  51, 188,  60, 188,  60, 191, 179, 191,  63,  51,  60,
-188,  60, 179,  51, 188, 191,  48,  60, 188,  60,  51, 191,  51, 191,  63,
-179, 179, 176,  48,  51, 179, 188, 191,  63,  48,  51, 188,  60,  60,  60,
- 48, 179,  60,  48,  60, 191,  51,  51, 179,  48,  51, 188, 179,  60,  48,
- 63, 188,  48, 188, 176,  51,  60, 188,  60, 191,  51, 179, 188, 191, 176,
-191,  60,  51, 188,  60, 188, 191, 191, 179,  60,  48, 179,  48,  48, 176,
-179, 191, 191,  51, 179,  60,  48, 188, 191, 188,  48,  51,  48, 179,  60,
- 48, 179, 191,  48, 191,  60, 188,  63, 191,  60, 188,  51,  60,  51,  48,
-179, 188, 188, 182, 188,  60, 191,  60,  48, 191, 188, 179,  48, 188, 191,
- 51, 188,  51, 191, 191,  48,  60,  60, 179,  51, 188,  60, 188, 188,  48,
-188, 179,  48, 179, 191, 176, 188, 176, 188,  51, 179, 191, 176,  60,  63,
-191,  48,  51,  63, 188,  48,  51, 191,  63,  51,  60, 191,  60, 188, 191,
- 51, 191,  60, 188, 179,  51, 179, 188,  48,  60, 188,  48,  51, 188,  51,
-191, 176, 188,  60,  48,  60,  51,  60,  51, 182,  51,  60, 179,  48,  51,
-191, 191,  51, 176,  48, 179,  74,  60, 188,  60,  60, 179,  49,  48, 179,
- 51,  51,  51,  51, 179, 179,  51,  51,  51,  51, 191, 188,  60,  60,  60,
-182, 188, 188,  51, 191,  48, 188,  48,  60, 179, 191,  60, 179,  51, 188,
- 51, 191, 191,  51,  51,  60, 191,  51, 188, 179, 179,  54, 188,  48,  60,
-188,  51, 188,  48,  51, 189, 179, 179,  48,  48,  51,  60,  60,  51,  51,
- 63,  51,  51,  48,  60, 188, 191, 188, 188,  51, 182, 179, 179,  51, 191,
- 48,  48,  48,  48,  51,  60, 189,  51, 179, 191, 191,  51, 188,  51, 191,
- 51, 179, 191,  63, 176, 179, 179, 188,  48, 188,  51, 188, 176,  60,  51,
-191, 188, 189,  48,  48, 176, 191, 188, 191,  60,  51, 191, 191,  51, 179,
- 48, 179, 182,  63,  51,  63, 188, 191,  51,  48,  60,  60, 191,  63,  60,
- 48, 188,  54, 176, 179,  60,  60, 188, 188, 188, 189,  60, 176,  54, 191,
-179,  60, 188,  60,  48,  49,  60, 191,  60,  60, 188, 191, 179, 176,  48,
- 51, 191, 176,  48,  60, 179, 179,  48, 179,  48, 188, 188, 191,  51, 188,
-179, 179, 189, 179, 179, 176, 188,  51, 179,  48,  48,  48,  60,  51,  51,
- 48, 188, 182,  60,  51,  51, 179, 179, 176, 189,  60,  60, 188, 188, 179,
- 48, 179, 188,  48,  60, 179,  48,  60,  60,  60,  48, 179, 179,  60,  51,
- 51,  48,  54, 176,  60, 191, 191,  48,  48, 179,  54,  60,  48,  60,  60,
- 60, 188,  48, 179, 191,  60, 179,  60, 188,  51, 177,  48,  48, 188,  51,
-176, 188, 179,  49,  54,  48,  63, 188,  49,  48,  51, 188,  51, 177,  60,
-179,  51,  48,  63,  51,  74,  48,  48,  51,  51, 179,  60,  48, 176, 179,
-179,  48,  51, 188,  51,  63,  51,  60, 179,  51,  60, 191, 179,  60, 179,
- 60,  51, 179,  51,  48, 188, 191, 191,  48,  51, 179,  51,  60,  48, 179,
- 51,  49, 191,  51,  51,  51,  60,  48,  48, 191,  60,  51, 176,  63,  51,
-182,  60,  63, 188,  63, 179, 179, 179, 179,  49, 179, 188, 191,  54,  54,
-188, 191,  51, 179,  48, 191,  51, 191, 188, 179,  60,  63,  51, 188, 188,
- 51,  60, 182,  48,  48,  51,  48,  51, 176,  51,  51, 191, 179, 176,  74,
- 51, 179, 182,  60,  60, 182,  60,  63, 191, 179, 188, 191,  48,  60, 189,
- 51, 176,  60,  60,  74,  51,  60,  63,  63,  51,  54, 188,  51,  60,  74,
- 60, 188, 188,  60,  48,  63, 188, 188,  51, 188, 189, 179, 191,  51, 188,
- 51, 179,  51, 179, 191,  48,  48,  51,  60, 176,  60, 188,  60,  49, 188,
- 60, 179, 191, 179,  63,  60, 179,  51,  60,  48, 179, 189,  51,  60, 188,
- 74, 188, 188,  60, 179,  60, 191, 191,  51,  48,  51, 189, 188, 188,  74,
- 60,  48, 179,  60,  63, 188, 179, 179,  48, 179,  60,  63, 179, 191, 191,
- 61, 179, 191, 188, 176, 191, 182,  63,  60,  51,  74, 188, 188, 179,  51,
-191, 191, 179, 179,  51,  74,  51, 188,  48,  48,  48, 191, 179, 179,  48,
- 48, 179,  51, 188,  51,  51, 191, 179,  48,  51, 179,  51, 188,  74,  51,
-191, 191,  51, 191,  54,  60, 176,  54,  48, 176,  51,  48, 176, 191,  54,
- 60,  60,  48, 188, 179, 188,  60, 188, 188, 179, 189,  60, 188,  51,  54,
-179,  51,  54, 191, 188,  63, 189,  48, 188,  51, 191,  51, 176, 191,  60,
-176,  48, 189,  48,  74,  74, 176, 179,  49, 191, 191,  60,  48, 188,  48,
-179,  48, 179, 179,  60, 191,  51,  60, 179, 179,  54, 177, 188, 188,  63,
-182,  49,  51,  51,  51, 191,  51,  60, 188, 179,  60,  60, 191, 188, 189,
- 74, 179, 191, 191, 188, 191, 176, 182,  48, 188, 176, 188,  48,  48, 191,
-179, 188,  51,  60,  60,  74,  63, 189, 176,  60, 189, 191,  51,  63, 191,
-188, 191,  61,  54, 177, 191,  51, 179,  60, 182, 179,  49,  49, 179,  51,
- 60, 188,  60,  48,  54,  48,  48, 188,  60,  60,  60,  51, 188, 179,  74,
- 60,  51,  51, 191, 191, 179,  51, 179, 176, 188, 176, 179,  61,  63, 188,
-191,  48,  48, 182,  51,  48, 188,  51,  48,  49,  60,  60,  51,  60, 255,
- 60,  48, 179, 188, 191, 179, 179,  54, 176, 179, 182,  48, 188,  49, 188,
- 48,  51,  60,  48,  51, 189,  51,  48,  61, 188, 179, 182,  51,  54, 188,
- 51, 189,  51, 189, 191, 182, 188, 191,  60, 191, 191,  54,  61, 179,  60,
- 51,  54,  60,  60,  51,  48,  51, 182,  60,  74, 188,  51,  48, 179,  51,
-179,  49, 188, 188,  63, 188, 188,  60,  51,  60, 182, 191,  60,  54,  51,
-191,  51, 176, 177,  54, 191,  63, 176,  48, 179,  60,  48,  51,  48,  63,
-191,  60,  49, 179,  54,  63,  74,  51,  74, 188, 179, 179, 191,  48, 188,
-188,  74, 179,  60,  74,  60, 188,  63, 179, 191, 177,  48,  51,  49, 188,
- 48, 191,  60,  51, 182, 182,  51,  54,  51, 188, 177,  74,  49,  51, 191,
-179,  63, 191, 191,  49,  51,  51, 179,  48, 188, 189, 179,  63,  74,  60,
-191,  60,  48, 188,  60, 182,  60,  48,  54,  49, 182,  60,  63, 188, 191,
-176, 191, 191,  51,  54, 176, 176,  61, 179,  54,  54,  51,  60,  74,  54,
-188,  51, 179,  51, 182, 179, 189,  63, 189,  60,  49,  54, 182, 191,  60,
- 60,  63,  74, 188,  60, 191, 179, 188,  60, 179,  48,  48,  51,  51,  48,
-177,  49,  51,  51,  51,  48,  63,  60, 182,  60,  74,  54,  54, 191, 188,
- 51, 188,  51,  49,  51, 188, 188, 188, 188,  54, 176,  63,  49,  60,  48,
-188, 179,  49,  54, 188,  51, 188,  48, 179,  51,  54,  48,  48, 179, 191,
- 60, 179, 189,  60,  60,  48,  54,  51, 191,  48, 191, 179,  60,  60,  60,
- 60,  63, 189, 179, 182, 191, 176, 177, 179, 179, 182,  54,  60,  51, 189,
- 60, 191,  60, 191, 188, 189,  54,  60,  74,  51,  48,  60, 191,  48,  51,
-188,  48,  51,  60, 182,  51, 191, 188,  60,  60, 188,  48, 179, 182, 182,
-182, 179,  51, 179, 191, 176, 182, 182,  60,  54,  48,  51,  63,  51,  63,
- 60, 188,  54,  49,  51,  51, 176, 179,  48, 191,  48, 188,  54, 189, 188,
-179,  49,  51, 182, 191,  48,  60,  74,  48,  49, 188,  74,  54,  74,  60,
-188,  60, 188,  60,  49, 188,  61,  54,  48, 176,  63, 188, 179,  74, 188,
- 48, 188, 191, 191,  48,  61, 179, 189, 189, 191,  48, 188, 179, 189, 182,
-191,  74,  60,  60, 189, 189, 188,  60, 191,  60,  49,  60, 191,  49,  51,
-182, 189, 188,  54, 179,  74,  48, 179, 179, 188,  51, 188,  48, 191, 191,
-179,  54, 182, 188, 191, 176, 191,  74, 182,  51, 179, 188,  51,  63, 182,
- 51, 189,  63,  54, 182,  51,  51,  60, 189,  63, 179,  60,  49,  63,  61,
- 51, 177,  54,  51, 191, 179, 179,  48, 179,  48, 188,  51,  63,  51,  61,
-191, 182,  48, 188,  60,  49,  48,  49, 189,  51, 191,  48, 176,  49, 188,
- 51,  54, 191,  61,  60,  48, 179, 179,  48,  54,  54,  48,  60, 176,  54,
- 51,  51,  54,  49, 191,  51,  54,  51, 182,  60, 188, 188, 179, 179, 182,
- 60, 179,  63,  60,  54, 191,  60,  54,  48,  48,  74, 188, 191,  54, 188,
-176,  74,  51, 189,  48,  74, 191, 179,  48,  60,  48,  51,  48, 188,  74,
-191, 179, 182,  49,  60, 182,  74, 179,  54,  49,  60,  49,  51, 176,  63,
-191,  51,  48, 189, 191,  60,  60,  60, 189, 189, 188, 182,  60, 179, 189,
-182,  60,  60,  48,  54, 179,  60,  51, 179,  51, 176,  54,  54,  49,  48,
-182, 188, 191,  60, 179, 179,  49,  63,  60,  51, 191,  54,  54, 188, 179,
-191, 188,  61,  51,  49, 179, 188, 179,  49,  49,  60, 189, 182, 179,  60,
- 48,  51,  61,  51, 191, 188,  49,  60, 189,  63, 176,  51,  51, 177, 189,
- 49, 188,  74,  60,  60,  74, 188, 182,  54,  49,  54,  49,  51,  60, 191,
-189,  60, 176, 189, 176,  48, 179,  60, 188,  48, 188, 182, 176, 176,  49,
-182, 189,  60,  74, 182, 179,  54,  61,  48, 191,  63, 177,  49,  60, 191,
-188, 177,  51, 182,  60,  48,  48,  48,  74, 191,  51, 182, 179,  60,  49,
- 54,  49,  74,  51, 179,  51,  48, 188,  74,  60, 179,  48,  60,  61,  48,
-191, 188, 179, 188,  54,  60,  48,  51, 177,  51, 191, 191,  54,  51, 188,
- 51,  74, 182, 191, 188,  48,  51,  51, 189, 188,  60, 182, 188,  74,  49,
- 49, 189,  60, 191,  60, 182,  74, 176, 177,  54, 188, 179, 191,  61,  54,
- 48, 179, 179,  60, 176,  60, 179,  60,  60,  60,  60, 179,  60, 182, 189,
-191, 179, 191,  48, 182,  60, 179, 189, 188, 176,  48, 188, 179,  60,  60,
- 51, 191,  74,  60, 182,  51, 179, 176,  60,  60,  51, 182, 188, 176, 188,
-191, 176,  51, 188, 179,  60,  60, 182, 188, 188, 191,  48, 182, 176, 191,
-188,  63,  54, 191, 182,  51, 177,  63, 188,  60, 188, 189,  60,  60,  49,
- 54,  54, 179,  48,  74,  49, 182,  51, 179, 182,  49, 188,  60, 179,  74,
- 48,  60, 179,  60,  48,  48,  74, 182, 189,  54,  60,  48,  60,  51,  51,
- 48,  51, 188, 179, 189,  61,  60, 182,  49, 182, 191, 179, 191, 179, 191,
- 51, 182, 182, 179, 182, 188, 188,  54,  54,  74, 188, 177, 188, 179, 179,
-179,  54, 189, 182,  74, 189,  49, 191,  48,  54,  60,  48, 188, 188,  54,
- 60,  54, 179,  60, 191, 179, 176, 182, 176,  60,  54,  48,  51,  74, 182,
- 49, 189,  51,  74, 179,  61, 177, 176,  63,  49, 177, 188,  60,  54, 177,
-179, 191, 182,  54,  51,  51,  51,  48, 182,  60,  74, 179, 188,  61, 188,
-189,  74,  54, 177,  74, 182,  51,  74, 182, 189,  74, 188, 179,  74, 179,
-176, 189,  51,  74,  51,  54, 191,  49,  51,  49,  63, 191,  49,  49, 179,
-182,  51,  60, 189,  63,  74, 179,  49,  48, 191, 182, 179,  60,  60, 177,
- 51, 176,  74,  61, 176, 189, 255,  49, 176, 189,  51,  48,  60, 177,  60,
-179,  63, 179,  51, 188,  54,  60, 176,  48,  74,  60,  74,  51,  48,  54,
- 60, 182,  48,  54,  48,  60, 189, 179,  74,  74, 191,  48,  49, 182, 179,
- 60, 179,  63,  51,  60, 179,  54,  54,  74,  49,  54, 188, 179, 182, 176,
- 48,  49,  60,  54, 191, 191, 189, 179, 188,  51, 188, 176,  51,  49,  60,
-176,  51,  60,  74, 191, 182,  48, 188, 188,  61,  54,  51,  48, 188,  60,
- 63, 188,  54, 191, 189,  61, 182,  54,  74, 179,  61, 189, 176,  51,  48,
- 74, 188,  60,  63, 182, 188,  60,  54,  48,  54,  61,  49, 179, 176, 179,
- 60, 182, 182, 191,  74,  63,  74,  54, 182,  74,  54, 191,  60, 177,  63,
- 49, 188, 182, 182,  61,  60,  51,  49,  49,  54,  60, 182,  60,  54,  60,
- 51,  74, 189, 189, 177, 189,  60, 191, 191,  60,  54,  51, 189,  54, 188,
-179,  54,  61, 176, 182,  60,  54,  74, 189, 189, 182, 182,  60,  51,  49,
- 60,  63, 179,  54,  63,  48, 182, 188, 179,  60,  51,  54,  51,  51,  51,
-191,  60,  51, 179,  54,  49, 188, 177,  49, 182,  74, 179, 191,  54, 179,
-176, 182,  60, 188,  51,  54,  51,  63, 179,  74, 179, 188,  60,  60, 191,
-189, 179, 182,  51,  51, 189,  54, 177,  48,  48,  54, 176,  48, 182,  60,
- 74,  60,  60,  49, 189, 179,  74, 188,  60, 191,  49, 191,  54,  54, 188,
- 49,  63,  74, 176,  54,  51,  54, 189,  51,  74,  54,  51,  60, 177, 182,
-179, 176, 189,  49,  48,  48, 182,  54, 182, 189, 177,  51,  74,  48,  60,
- 60, 182,  74,  60, 182,  74,  61,  61, 177, 182, 191, 189,  61, 189, 188,
- 49,  54,  60,  51, 189, 189, 182,  54, 182,  74, 176, 188, 179,  54,  54,
- 60,  54,  48, 179,  54, 179, 189, 179,  49, 179,  49,  60, 177, 179, 189,
- 63, 179, 177,  60, 189, 188,  54,  48,  49,  61,  54, 182,  48, 189, 182,
- 63, 191,  54, 177, 191,  49, 189, 189, 182,  74, 182,  60,  60,  54, 188,
-176, 176, 188, 188,  51,  49, 176, 191, 182, 182,  49, 189,  49,  60, 188,
- 74,  51, 188,  74,  51,  74,  60, 189,  54,  54,  49,  48, 179,  60,  74,
-182, 188,  48,  61,  54, 179,  63, 191,  60,  54,  54, 182, 188, 182, 189,
-177, 179, 189,  49,  74,  60,  54,  48,  48, 189,  60,  74,  51, 189, 182,
-182, 191, 191,  74,  60, 179,  74,  48, 188, 191, 188, 182,  54,  49,  54,
-182, 189, 191, 189,  60,  61,  54,  49, 189, 188,  54,  51, 189,  48,  54,
- 60, 182, 188,  51, 188, 191,  51, 182,  48,  60, 191,  51,  61, 176, 176,
-182, 179, 182,  49,  61, 179,  61,  49,  74,  54,  74,  54, 182,  61,  61,
- 60, 177,  61,  74,  74,  74,  74, 189,  61, 191, 182,  61,  54,  51, 179,
- 48, 189, 191,  60,  54, 182,  74, 188, 179,  60,  74, 189, 188,  60, 182,
- 60,  48,  61,  54,  63, 189, 182, 189,  60, 179,  63,  74,  63,  51, 189,
-176,  49,  49,  60, 189,  51,  51,  60, 182, 177, 182, 188,  61,  63,  60,
-189, 176,  60,  48,  48, 191, 182, 176,  49,  60,  48,  54,  49, 176,  49,
-179,  60, 188, 189,  54, 189,  54,  49,  60,  48,  48, 182, 182, 179,  54,
- 49,  51,  54, 182,  61,  61,  74, 191,  74, 191,  54,  51,  54,  54, 188,
- 74, 177,  49, 182, 176, 179, 189, 188,  48,  48, 179,  49,  51,  54,  51,
- 48, 182,  49,  54,  49, 189, 182,  61, 179,  54,  49,  60,  54, 182,  60,
- 51, 189,  61, 182, 182, 179,  74,  60,  54,  60,  60,  49, 189, 179, 189,
- 49,  51, 191, 189,  54,  54, 191, 191, 179, 188, 179,  54,  49,  51, 189,
- 51,  49,  48, 182, 182,  49,  74,  74,  74, 179, 189,  60,  63,  54,  74,
- 54,  60,  60,  49,  54,  60, 179,  48, 179, 177, 188, 189,  51, 179,  54,
-189,  60,  54, 182,  51, 176,  54,  54,  61,  61,  48, 177,  60,  60, 189,
- 61,  63,  60, 182, 189,  63, 189, 179, 188, 176,  60,  54,  74, 177, 182,
- 51,  54, 177,  54,  49,  51,  48,  48,  49, 182, 188,  63,  60,  60, 188,
- 60,  49,  48,  51, 179,  54,  74, 179,  60,  49,  51,  51,  74,  48,  63,
- 60, 179, 179,  54,  49,  54, 189,  54,  51,  49, 191,  60, 177,  74, 176,
- 49, 182,  54,  54, 189,  60,  54,  60, 191, 177,  54, 182,  54, 189,  63,
- 60,  61, 177,  74,  74, 191, 191,  49,  48,  54,  60,  61, 182, 182, 189,
- 74,  49,  54,  54,  63,  48,  49,  54, 182, 191, 179,  49,  54,  54, 188,
- 54,  49,  61, 179,  49, 189, 176,  74, 179,  61,  49, 179, 188, 182, 182,
-176,  49,  60,  54,  74,  74,  54, 182,  49,  54,  48, 176,  74,  60,  49,
- 74, 182,  48, 179,  63, 182,  54, 177,  61, 179, 182,  54, 191, 182,  60,
-189, 191,  49, 189, 189,  49,  74,  48,  60,  74, 176,  48,  74, 189, 182,
-191,  60, 177, 189, 182, 179, 189, 182,  54, 189,  74, 177,  60,  54,  54,
-189,  54, 189,  60,  54,  74,  54, 179,  51, 177,  54, 176, 177,  60,  49,
- 49,  54,  49, 179, 182,  61,  49,  48,  51, 189,  60, 176,  54,  74,  54,
-177, 182,  74,  54, 189, 189,  60,  49,  63, 179,  54, 182,  54,  51, 176,
- 49,  74,  74, 182, 182,  60, 189, 179, 182, 177,  54, 179,  49, 188,  74,
-182, 189, 176, 182, 191, 179,  51,  74, 179, 191,  60,  49, 182, 191, 189,
- 74, 189,  60, 182, 179,  48,  74,  60, 176,  74,  54,  60, 188, 182,  49,
-189,  48,  60,  54, 176, 189,  60,  74,  60,  60,  49,  54, 182, 182,  74,
- 54, 188,  51,  74,  49, 188,  61,  60,  61,  48,  74, 179, 189,  54,  54,
-182, 177,  51,  63,  60,  74, 177,  54,  49, 177, 191, 191,  49,  49,  49,
- 61,  48,  60,  60,  48, 189,  61, 189, 179,  60, 189,  48,  49, 179,  60,
- 60, 179,  74,  74,  74,  54,  54, 177,  61, 191, 188, 182, 182, 182,  74,
-191, 182, 179,  54, 182,  49,  54,  54, 176,  49, 189,  63,  60,  54, 189,
-182, 189, 176,  49, 188,  74, 179, 182, 189,  49,  54,  54,  51, 182,  54,
-182, 188, 179,  54,  49, 182,  51,  49,  63, 189,  61, 182,  49, 177,  54,
-189, 189,  74,  49, 189,  51,  60,  54,  74,  61, 189,  74, 179,  74,  61,
- 49,  54,  49,  54, 189, 189,  49,  54,  60,  54, 179,  54, 191, 177, 182,
- 51, 189,  51, 182, 179,  49,  60, 177,  54,  54,  49, 189,  74,  74, 179,
- 49,  54,  49, 177, 182, 182,  63,  54,  49, 177,  74,  54,  54,  61, 176,
- 54,  60, 182, 189, 189,  74,  54,  54,  60,  60,  74,  51,  54, 182,  48,
- 54,  48,  49, 179, 182,  54, 182, 188, 189,  51, 182, 182,  48,  49, 182,
-182, 179,  74, 179,  49, 182,  74,  54,  54,  61,  54,  49,  54, 191,  54,
-182, 179,  49, 189, 189, 179, 188,  74, 182, 177, 182,  60,  74,  54, 191,
-189,  54,  61,  60, 182, 189,  60, 182, 182, 188,  49, 179, 182, 189, 182,
- 49,  60,  74, 188, 189,  61,  74,  63,  61, 176,  60,  51,  61,  61, 189,
- 49, 189,  54, 189, 177,  54,  49, 188,  63, 189, 177,  74,  54,  49,  60,
- 74,  74,  61,  74, 189,  48, 191,  60,  60, 189,  63, 177,  54, 189,  74,
- 60,  60,  61, 182,  60,  49,  49, 182, 189,  74,  54,  74, 182,  74,  49,
-182,  74,  49,  49, 189,  54, 177, 189, 182,  60, 191,  74, 179, 176, 182,
-191,  61,  54, 177,  49, 189, 176, 189, 255, 177,  54,  49,  54, 182,  51,
- 54, 182,  74, 177,  60,  61,  54, 182,  54, 182,  74, 189, 182, 191, 189,
- 60, 189,  74, 189, 177,  49, 177, 191,  74,  48, 188,  48,  74,  60,  54,
-179, 176,  54,  54,  54,  49,  54,  49, 189,  49, 177,  74,  74, 179, 189,
- 60, 176,  54,  60, 179,  74, 182,  49, 189,  61,  74, 182,  49,  49,  61,
- 60, 189,  54,  61,  54, 182, 176,  63,  54,  60,  54,  60, 189,  61, 177,
- 60,  49,  61,  54, 179,  48,  61,  49,  54, 177, 182,  49,  49,  49, 179,
- 60,  54, 182,  54,  74, 182, 189,  49, 189,  63,  54,  61, 182,  60,  60,
-176,  54, 189,  54,  61, 182,  60,  54, 182, 188,  49, 182,  49,  54,  54,
- 49, 182,  60, 191,  60,  51,  60,  74, 182,  74,  74, 179,  49,  63,  49,
-191, 189, 182,  49, 179, 182,  60,  51,  74,  51,  54, 189,  74,  60,  61,
-182,  61,  74, 182,  54,  54, 182,  49,  60,  54, 189, 182, 189, 179,  60,
- 60,  48, 182,  54,  49, 189, 179,  74, 189, 182, 182,  74,  49, 179,  49,
-177, 182, 189,  54,  54,  54, 191,  54,  74,  61,  63, 182,  74,  49,  74,
-176,  49,  60,  54,  49,  74, 191, 179, 182, 182,  74, 182, 176, 188,  74,
- 61,  61, 189,  49, 176, 179,  48, 189,  74,  49, 182,  60, 189,  63, 182,
- 49,  60, 182, 179, 182, 176,  74, 182,  54,  60,  60,  49, 189,  54, 182,
- 61, 191, 182, 182,  51,  51, 177,  49,  74,  49, 179,  54, 182, 189,  54,
- 49, 189,  74, 182, 182,  54,  54,  61,  49, 182,  54, 176, 189,  61,  49,
- 49,  49,  49, 189, 176,  49, 189, 182, 189, 182, 189, 182,  54, 189,  49,
- 49,  74,  49, 182, 177,  49, 179,  74, 189, 182,  54, 189, 189, 182,  54,
-182,  54, 179,  74,  63,  74,  54, 189,  60, 189,  54,  49, 189, 189,  54,
-188,  49,  54, 188, 189, 189,  54, 182,  60,  49,  54,  54,  74, 182,  74,
- 49,  74, 189,  74, 182,  54,  74, 179,  74,  74, 182,  54,  49,  74,  54,
-182,  54,  54,  49,  60,  54,  61,  74,  54,  74, 182, 177, 182,  49,  54,
- 49, 189,  54, 182,  60,  54,  74, 189,  49,  49, 177,  54, 182, 189,  60,
- 74,  61,  61,  54,  54, 182,  49,  61,  54,  61,  74, 182,  49, 182, 189,
- 61, 182,  61, 182,  60, 189,  60,  74,  60,  49,  60,  54,  54,  54, 177,
-189,  49, 189,  63, 182, 182,  54, 182,  60,  74,  63, 182, 189,  61,  61,
- 54,  63,  49, 189, 176, 182,  54,  54, 182,  60,  74,  49, 182, 189,  61,
- 60,  74,  74,  54,  49,  49,  54,  49,  49,  61, 189, 182, 182, 189, 177,
-176, 189, 176,  54, 182,  74,  74,  60,  74, 182, 177,  61, 179, 177,  49,
- 49, 179, 182,  54,  49, 177,  54, 177,  49, 179,  49,  54, 182,  60,  49,
-182, 182,  49,  54, 179, 179,  74, 189, 179, 189, 189,  54,  74,  54, 176,
- 49,  49, 189,  49,  49,  49,  60,  74, 182,  74, 177,  54,  61, 179, 189,
- 63,  49, 179,  63,  54,  60,  49,  54,  74,  63,  49,  74, 189, 182,  54,
- 54,  54,  74,  49, 182, 177,  54, 182,  49, 177,  49, 189,  74,  61,  49,
- 60, 182,  61, 182, 189, 182,  54, 182,  54,  54,  74, 182,  74,  54, 179,
-182,  49, 182, 189,  61,  49,  54, 179,  49,  74, 182, 182,  74,  60, 189,
-179, 177,  49,  74, 182,  49,  54, 189,  49,  49,  74,  60, 182,  60, 182,
- 74,  49,  60, 189, 189, 182, 182, 189,  61, 182,  54,  49, 189,  74, 189,
-182, 177, 182,  61,  49,  63,  54, 189, 177,  74, 189,  61, 189,  74,  54,
- 54, 189,  54, 182,  74,  61,  54,  54, 182, 182,  54, 182,  61, 177,  74,
- 54,  49,  74,  49,  63, 189,  49, 177, 182, 189,  60,  54,  61, 182,  63,
-179,  49,  49, 179,  54,  54,  61, 182,  54,  54, 182,  54,  49,  63,  61,
- 74, 179,  63, 189, 182,  60,  60,  49,  54, 189, 182, 177,  74,  54,  49,
-177, 189,  54, 182,  49,  75, 177,  54,  49, 179,  60,  74,  49, 177, 182,
-182,  54, 182, 189, 189,  54,  49,  49,  63, 182,  74,  74, 189,  49,  54,
- 60,  54, 179, 179, 189, 177,  74, 189,  49,  74, 189,  49,  54,  54, 179,
-182,  54,  49,  60,  74,  52,  49, 182,  74,  74,  60,  61,  49,  54,  74,
- 49, 182, 189,  54,  54,  61, 189,  54,  49,  74,  60, 177, 189,  60,  74,
-182,  49, 189,  74, 189, 179,  49,  54,  49, 182,  74, 182,  74, 182,  49,
-177, 177,  49,  49, 177,  74,  61,  74, 189,  72, 189,  49,  54, 182, 189,
- 74,  74, 176,  61, 189,  54, 189,  52, 189,  54, 182, 177, 179, 182, 182,
-189,  61, 182, 189, 177,  54, 176, 182, 189, 182, 179, 182,  72,  54,  49,
-182,  49,  74,  49,  61, 182,  54, 189,  54,  54, 182,  54,  54, 182, 177,
-189, 189,  49,  60, 189, 182,  74,  49,  61, 182,  60,  61, 182,  54,  54,
- 74, 177,  54, 182, 177,  61, 189,  74, 189,  54, 176,  49, 189,  74, 182,
-177,  54,  74, 182, 189, 183, 182,  74, 177,  74, 182, 176, 179,  49, 182,
-182, 183,  74,  54, 176, 179, 189,  54, 176,  49,  54,  74, 182,  75,  49,
- 63, 182,  74,  49,  54, 176, 182,  54, 189,  60,  61, 182,  54,  54, 189,
-182, 182,  54,  54, 182,  49, 182,  54,  61, 189,  60,  49,  54,  52,  52,
- 61, 182,  61,  60,  49, 189, 182,  54,  54, 179,  60, 182, 177,  74,  54,
-182,  54, 176, 189,  54, 189,  49, 182,  49,  74,  61, 183, 182, 189,  49,
- 54, 177, 177,  52,  74, 189, 189,  61, 182,  54,  54, 189, 182, 177, 177,
-182,  52,  54, 189, 182,  49,  54, 176, 177,  60, 182,  49,  74,  49,  61,
- 49,  54,  54, 189, 182, 182,  49, 189,  49,  74,  61, 182, 182, 189,  54,
-189, 177,  54,  54,  74, 182,  49,  54,  54,  54,  49,  74, 189, 189,  52,
- 72,  52,  54, 176, 189, 179, 177,  61,  63, 176, 182, 179,  60, 176, 189,
-177,  54, 176,  49, 189,  54,  54, 177, 176,  54, 189,  72, 176,  49,  52,
-182,  74,  54, 177, 177,  61,  54,  72,  75, 176, 177, 189,  61,  74,  52,
-182,  54,  74,  75,  49,  49,  74,  61, 189,  60, 182, 182, 189,  74, 182,
- 61, 182, 177, 177, 189,  74,  74,  49, 177, 189,  49,  63, 182,  61, 182,
- 74,  49,  49, 182,  54,  54, 189,  75,  49,  54,  61,  74,  54,  54,  61,
- 60, 177, 182,  61,  61,  61,  49,  49,  54,  49,  54, 179, 177,  54,  74,
- 75,  54, 183, 179,  60,  60,  74,  49,  54,  54,  49, 182, 182,  54,  74,
- 63,  74, 182, 179,  52,  54,  49, 177,  74, 176, 177,  74,  63,  54, 176,
- 63,  49, 177,  54,  72,  49,  61,  74, 182,  54, 182,  61,  61,  74,  61,
- 60,  60, 189, 182,  72,  52,  61,  60,  61,  54,  54, 182,  63,  54,  61,
-189,  74,  49, 182, 189, 182, 189, 182,  74, 182,  63,  54,  54, 177, 176,
-182,  49,  49,  49, 177, 189, 182,  52,  61, 183, 176,  54,  49, 182,  54,
-189, 182,  61,  72,  74, 177, 182,  49,  49,  54, 182,  61,  61,  49,  60,
- 61,  61, 182,  61,  63, 182, 189, 177,  74,  60, 189, 176,  54,  72, 189,
-176,  74,  61,  54,  54, 182,  49,  61, 182,  54,  54,  54, 176,  72, 189,
- 49,  49,  72,  49, 189, 183, 189,  72, 189,  49, 182,  54, 189,  61, 189,
- 54,  61, 176, 189, 179,  61, 176,  49,  61,  52, 182, 189,  54, 189,  74,
- 74,  75,  54, 177,  49, 189,  61,  52,  49,  49,  49,  54,  74,  74,  54,
- 54,  74, 182, 189, 182,  61,  61,  74, 176,  54,  61, 177,  72, 182,  49,
- 54,  49,  54, 182,  49, 182, 182,  49, 182, 176,  74,  61, 183,  63, 182,
-189,  52,  54,  74,  49,  49,  52, 182,  75,  74,  74, 177,  54, 177, 182,
- 54,  61,  61,  49,  54,  54,  52,  49, 176, 182,  54,  54, 176,  54,  54,
- 61,  49,  52, 182, 177,  61,  52,  54,  74,  60,  52, 189, 177,  49,  61,
-189, 183,  74,  60, 183, 183, 182,  75, 182,  61,  74, 177, 176, 177, 182,
-177,  60,  54,  54, 182,  54,  63,  54, 189,  49,  54, 182, 182,  49,  61,
- 60,  54,  49,  54, 189, 183, 177,  54,  52, 189, 177,  49,  54, 189,  54,
- 49,  61,  54,  75, 182,  54,  54, 177,  54,  54,  54, 189,  74,  54,  74,
- 54, 183, 182, 189,  74,  74,  49, 177, 182,  49, 182,  52,  49,  74, 183,
- 49, 177,  61, 182, 183, 176, 182, 182,  75, 183,  72, 179, 182, 182, 182,
- 49,  61,  74, 182, 189,  61, 177, 177,  54, 182,  74, 177,  49,  61,  74,
- 72,  75,  61, 177,  74, 182, 177, 255, 183, 182,  54,  49, 177,  72,  74,
-182,  61, 182,  72, 177, 182, 189,  49, 189, 189, 177,  49, 177,  61,  54,
- 52,  49,  61, 189,  49,  74,  74, 176, 176, 182, 189,  54, 189, 183, 182,
- 54,  49, 182,  61, 189, 182, 182, 182,  52,  75, 177, 183,  74, 189, 177,
- 49, 189, 182,  54, 182,  54,  54, 189,  54, 176,  61,  54,  52, 189, 182,
- 49, 182,  74,  63,  61, 183,  54,  75,  54,  49,  74, 182,  61,  52,  54,
-182,  61, 176,  61, 189,  75,  49,  54, 182,  61,  52, 182,  61,  52,  74,
- 54,  54, 177,  54,  54,  74,  75,  74,  61,  52,  54,  49,  72,  52,  54,
-182,  74,  72,  75,  49, 182, 182,  54,  75, 189,  49, 183,  52, 177, 189,
- 63, 182, 177,  52,  54,  54,  61,  61,  74, 177,  49, 177,  49,  54,  54,
- 63, 182, 182,  74,  74,  54,  74, 182,  49,  49, 177, 177,  54,  74, 176,
- 54, 189, 189,  74, 182, 182,  63,  75,  72,  74,  74,  63,  72, 177, 177,
- 54,  63,  63, 189, 176, 182,  49, 177,  74, 183, 182,  60, 189, 177, 182,
-177,  54, 182,  49, 182,  74, 182, 183,  74,  54,  52,  49,  60, 177, 189,
-189,  74, 176,  49, 183,  61, 177, 189,  54, 183,  61,  74,  54,  54, 182,
-189,  74,  52,  49,  54,  72,  72,  54,  61,  61, 189,  54, 189, 182, 177,
- 74,  74, 177, 177, 189, 183,  54, 189,  54, 177,  63,  54,  54, 177,  74,
-189,  61, 189, 182,  74, 189,  61, 182,  49,  49,  74, 177,  54,  61,  63,
- 54, 182,  49, 182,  52, 189,  74, 189,  49,  54, 183,  75, 177, 182, 177,
- 61, 183,  49, 182,  74, 177,  49,  54,  49, 183,  61, 183,  72,  61, 177,
-183, 182,  61,  49, 182, 177, 176, 182, 182, 177, 182,  49, 183, 177, 182,
-177,  54,  54,  61, 182,  61,  54,  61,  52,  54, 177, 182,  75,  49,  54,
-176,  49, 183,  49,  72, 182,  54, 189,  49, 182,  61, 177,  54,  72,  49,
- 54, 177,  52,  75,  52,  74, 177, 189,  74, 182, 182,  74,  72, 182,  74,
- 54,  63, 189,  61, 189,  61, 182,  54,  63,  61,  74, 189,  74, 183,  54,
- 52, 183,  54,  75,  52, 182, 183,  54,  54,  75, 177,  49,  52, 182,  75,
- 54,  63,  54,  75,  49,  54, 182, 182,  54,  54, 182,  49,  61,  61,  61,
- 49,  74,  72,  49, 189,  54,  75,  54, 182,  75,  52, 182, 189,  72,  54,
-189,  52, 183, 189,  54,  54, 189,  54,  54,  61,  52, 182, 182,  61,  49,
- 61,  52, 189, 183,  61,  54, 183,  49,  54, 182, 182,  55, 189,  74, 182,
- 72, 182,  54,  54, 189, 177, 180, 189,  49, 176,  54,  52, 182,  74,  61,
- 54, 182,  49,  49,  74, 183,  54,  72,  54, 176, 182,  74,  74,  54, 182,
-182,  75,  49, 176,  74,  63, 182,  61, 182,  54,  75,  54, 176, 177, 176,
- 72, 177,  74,  63, 189, 189, 177, 180,  52,  54, 182,  49, 182,  49,  61,
- 54,  54, 189, 182, 176, 182, 176,  61, 183, 177,  49,  75,  52, 182, 183,
- 74,  61,  52, 182,  49,  49,  49, 183, 183,  54,  75,  72,  75,  52, 182,
- 61,  63,  74,  61,  61,  54,  52, 177,  54,  61,  74,  74,  54,  54, 189,
- 54,  54,  49,  49,  74,  54,  49, 177,  72, 176,  75,  72, 182, 182, 182,
- 74, 183,  52,  54,  49,  61,  54,  63,  75,  52,  54, 182,  54,  72, 183,
-177, 183, 182,  54,  74,  75, 189, 183,  52,  61,  49,  54, 189, 182,  54,
- 52,  74,  61,  54,  61, 182,  54,  54, 189,  61,  72, 177,  61,  72, 182,
-176,  74,  61, 177,  52,  75,  54, 176, 183,  72, 177,  55, 177, 182,  54,
-182,  54,  61, 189,  75,  74,  61,  54, 189,  61,  61, 177, 183,  52,  75,
-177,  72,  52,  54,  54, 189, 189, 182,  61,  49,  74,  61,  49,  49, 177,
- 49, 182,  49,  61,  75, 182, 182, 183,  49, 177, 189, 182,  61, 189,  52,
-183,  49,  75,  75,  72, 182,  52, 182, 177,  52, 176, 177,  74,  75,  52,
-183, 177,  61, 183,  72,  52,  54, 182, 182, 182, 189, 177, 182,  49,  54,
- 74,  74, 183, 182, 182, 183, 189,  61,  74, 189, 189,  72,  54,  49,  49,
- 61, 182, 183,  72,  49,  52,  74, 182,  54,  54,  54,  54,  61,  52,  54,
- 54, 183, 182,  52,  75,  75,  54,  49,  61,  61,  49,  54, 182,  54,  54,
- 74,  61, 189,  74,  63,  52, 182,  49,  54,  74,  49,  54, 182, 182,  75,
- 54,  72,  74,  72,  61,  49,  52,  54,  72, 183, 177, 182, 189,  61,  74,
- 61,  52,  75,  74,  75,  54,  54,  52,  74,  74, 183,  75, 189,  74,  54,
- 54, 177,  54,  75,  72,  54,  75, 189,  49,  52,  52,  74,  54, 182, 177,
- 75,  55, 177, 177,  49, 183, 182,  54,  74, 180,  54, 182, 177, 182, 182,
- 72, 182, 182,  54,  54, 177, 183,  75, 177,  75,  54,  54, 189,  52,  61,
-183,  54,  63, 183,  54,  55,  54,  63, 189, 182, 177, 182,  52, 182,  72,
- 72,  74,  72,  61,  74,  75,  61,  75,  52, 183,  74, 183, 177,  55,  75,
- 74, 182,  54,  54, 182,  49,  61,  55,  61,  52, 189, 182,  72, 183,  63,
- 72,  54, 183,  54,  63,  52,  52, 182, 180,  49,  54,  75,  52, 177,  54,
-176,  74,  52, 182, 183,  61,  61,  54,  55, 182, 182,  61,  61, 176, 189,
- 61,  72,  52, 177, 189,  55,  49, 183, 177,  49, 182,  52,  49,  61, 177,
- 75,  54,  54,  75, 177,  72, 180, 189, 189,  52,  61,  75, 177, 177,  72,
-183,  54,  54, 177,  52,  61,  72,  54,  54, 182,  49, 189,  54, 189, 189,
-177, 183,  54,  72,  61,  61,  75,  61,  61,  61,  52, 183,  52,  61, 183,
-177,  49, 182,  61, 182,  74, 177, 177, 182, 189, 182, 189,  54,  61, 177,
- 61,  52, 182,  61,  74, 176,  49, 183,  54, 177, 183, 182, 180, 182, 183,
-189, 177, 182,  49, 183,  61,  54, 189,  72, 182, 182,  74,  74,  54,  54,
- 75, 183,  61, 177,  75,  54,  61, 183,  52,  75,  54,  72,  72, 182,  49,
- 61, 183,  74, 176,  61, 177, 183,  74, 177, 183, 189, 182, 189, 180, 183,
- 61,  49,  61,  54,  61,  54,  75,  54,  74, 189,  54,  54,  75,  49,  74,
- 63,  49,  52, 180,  54,  75,  72,  72,  61, 177,  49,  52,  74,  55, 182,
-177,  52, 180, 176,  72,  52, 182,  54,  55,  75, 189,  52,  63,  72,  61,
- 72, 182,  74, 182,  61,  72, 182,  49,  72,  63,  72, 189,  72,  61, 183,
- 72,  61,  54, 182, 182,  61, 183,  52,  55, 183, 177,  49, 183, 182, 182,
- 52, 182, 183,  74,  49, 176,  61,  54,  52, 182,  54, 182, 183, 183,  61,
- 61,  55,  75,  72,  61,  72,  61,  55, 183,  61,  61,  54,  52, 189,  49,
- 75,  61,  74, 180, 189,  75,  72,  52,  52, 180,  49,  61,  49,  61,  52,
-182,  49,  52,  49,  55,  72,  49, 183,  54,  54,  52,  72,  54, 182,  54,
-182,  75,  72,  54,  61, 177, 183, 176,  49,  61,  75,  54, 182, 177, 182,
-177,  75, 182, 180, 182,  49, 177,  61,  52, 177,  49,  75,  61, 183,  52,
-189,  52,  61,  54, 177,  61,  55, 183, 182, 189, 182,  54, 177, 177,  54,
- 49,  75,  61,  61, 177,  55,  55,  54, 183,  54, 189,  72,  52,  72, 182,
- 75,  52,  49,  55,  61,  54, 177,  54, 177,  63, 183, 177, 182,  54, 189,
- 52,  52, 177,  49, 183, 182, 183,  52, 183,  49,  49,  61,  75,  49, 176,
- 74, 183,  55,  75, 180, 182, 177,  54, 177,  54,  75,  74,  61, 183,  72,
- 63,  75,  49,  74, 183, 177,  54,  75, 183, 176,  61,  54,  54,  54,  52,
- 74,  54,  61, 182, 182, 182,  63,  75,  75,  55,  52,  52,  52,  61,  75,
-183,  55,  72,  75, 182,  75,  54, 180,  72,  74, 183,  72,  55,  52,  54,
- 61,  52, 180,  75,  72, 182,  61,  52, 177,  63,  54, 182,  54,  54, 189,
- 61, 182,  72,  75, 182, 183,  75, 180,  72,  61,  52,  72,  72, 182, 182,
- 74,  54, 189,  75,  52, 177,  72,  63,  75,  63,  54,  61, 183, 177,  52,
- 54, 180, 183,  55,  55, 182, 177,  72, 182, 177, 189,  52,  52,  74,  55,
-177,  54, 177,  72, 183, 189, 176,  61,  54, 189, 182,  49,  61,  63,  63,
- 72,  52,  75,  72, 177,  52,  55, 176,  75, 182,  52,  54,  74, 177,  74,
- 52,  54,  61,  55,  54, 183,  75,  74,  49,  52,  72, 189,  72, 183,  61,
-182, 177,  54,  54,  49,  52, 183,  49,  72, 177, 180,  75, 183,  54, 183,
- 49,  52, 182,  61, 183,  54,  61,  74,  74, 177,  72,  72, 182, 189,  54,
-183,  75, 182, 182,  55, 183,  72,  72, 177,  61,  75,  54,  61, 183, 180,
-177,  75,  75, 176, 177, 189,  61,  74,  54,  52, 176,  75, 182,  72,  54,
- 61, 189, 180,  49, 183,  49,  72, 177,  49, 189, 182, 182,  52,  61,  74,
- 54,  72,  55,  61, 183, 177,  54,  74, 182,  55,  75,  72,  52, 180, 176,
- 52, 183,  52,  54,  52,  72, 182,  72, 183, 177,  75, 183,  52,  72,  55,
- 55,  54,  72,  55,  52,  74,  72,  75, 183, 183, 176,  61,  52,  49, 183,
-176,  49,  49, 176,  72, 182,  54,  55,  61,  75, 180,  61,  61,  49,  52,
- 74,  55,  54,  75, 177, 180, 189,  61, 183,  72, 183, 182,  55, 182,  72,
-182,  61,  52, 176, 182, 177,  54,  54, 180, 183, 182,  61, 180,  52,  61,
- 75,  49, 183,  54,  55,  72, 182,  75,  75,  72,  74, 182, 182,  49, 182,
- 52, 183,  52, 182,  75,  75,  55, 183,  74, 183, 189,  52,  75, 189,  54,
- 75,  52, 182, 180, 182, 177,  55,  74,  54, 183, 177,  52, 182, 183,  74,
- 61,  49,  52,  75,  75, 180,  72,  75,  72,  54,  49,  75,  75, 183,  52,
- 75,  72, 183,  75,  54, 177, 180, 177, 182,  52, 189,  52,  63,  55,  61,
- 52,  49,  61,  55,  52,  72,  54,  61, 182,  54, 183, 177,  52, 183,  52,
- 61,  61, 182,  52,  74,  63,  54, 182, 177,  54, 183,  75,  52,  52,  72,
- 72,  55,  72,  72, 183,  72,  52,  72,  72,  72,  61, 180,  61,  74,  72,
-180,  52, 189, 180,  72, 180,  63,  52, 183,  52,  55,  55, 183,  72,  75,
- 55,  55,  52, 183, 180,  72, 183,  52,  54,  61,  75, 180,  72,  75, 183,
- 49,  52,  55, 180,  52,  54,  72,  61, 176,  52,  54, 177, 183,  55,  72,
- 55,  61, 183,  75, 183, 183, 183,  61, 189,  49,  72, 180, 183,  54,  49,
-176,  54, 177,  52, 180,  72,  54,  72, 176,  72,  52,  55,  49, 177, 183,
-189,  49, 183, 177,  75,  55,  74,  75,  61,  61, 180,  54,  74,  49,  75,
-176, 183, 177,  61, 183, 177,  72, 189,  72, 180, 183,  52,  75,  74, 183,
-182,  63, 177, 183,  61,  75,  52,  61, 182,  72,  61, 183, 182,  74,  61,
-177,  72,  74,  52,  72, 189, 183,  52,  72,  55,  75,  75,  55, 183,  54,
-180, 189, 180, 182,  75,  75, 183,  52,  63,  55,  54, 183,  49, 176,  49,
-177, 177,  55,  75, 183,  75,  75, 182,  75,  72,  52,  52, 183,  52,  55,
-183,  72,  54, 180,  72,  55,  61,  54,  63,  52,  52,  55,  72, 180,  49,
- 52,  52,  72,  72,  52, 183,  54, 183, 183, 182,  61, 182, 182,  75,  75,
- 75, 177,  61,  72, 177, 183, 177, 177,  55,  61,  54,  61,  72,  49,  72,
- 75,  49,  52,  72,  74,  75,  74, 177,  74,  63,  55, 176,  61, 183, 180,
-182,  63, 176, 183,  75,  72,  61,  54, 180, 183, 183,  52,  52, 176,  55,
- 75,  75, 183,  55,  55, 183, 176, 177, 180, 177, 177,  52, 183, 180, 183,
- 75,  55,  52,  54, 183,  63, 182, 183,  72,  52,  55,  52,  55,  72, 183,
- 61,  52, 176, 180, 183,  63,  75,  55, 180, 182,  52,  54,  75,  52,  61,
- 54,  72,  52,  75,  52,  52,  52,  74, 180,  61,  52, 177,  61,  54,  55,
- 55, 177, 183,  61,  61, 183,  55,  63,  61,  74,  61,  55,  55,  75,  52,
-183,  52,  55, 177, 176,  75, 183, 183,  72, 177,  75,  52, 182,  72,  54,
-182,  75, 177, 182,  61,  55,  52,  52,  75,  75,  72,  55,  54,  52,  75,
-177,  55, 177,  74,  72, 183,  55,  55,  49, 176,  75, 180,  52,  49,  52,
- 75,  52,  75,  54, 180,  72, 180,  75,  72, 189, 180,  49,  75,  75, 183,
- 75,  75,  52,  72,  52,  75, 183, 183, 183,  52,  74,  72, 176,  52,  61,
-177,  72, 177, 177,  49,  61,  72,  52,  54,  61,  61,  54,  54, 183,  61,
-182, 180,  55, 189, 183, 183,  54,  55,  75, 189, 177,  72,  72, 176, 182,
-177,  55, 180, 183,  75,  72, 177,  54,  61,  72, 182,  55, 177, 180,  75,
- 52,  52,  75,  55,  54, 177, 177,  61, 189,  72, 183, 180, 180,  54,  61,
-182,  74,  52,  75,  75,  75, 183, 180, 180, 182, 180,  72,  63,  55, 183,
-189,  54,  63, 180, 183, 183, 182,  52, 183, 180,  63,  52,  52,  63, 183,
-177, 183,  49,  75, 182, 182,  61,  55,  61, 177,  55,  75, 182, 180,  55,
- 52, 180,  72,  75, 183,  54,  55, 183,  75,  72, 177, 182,  52,  72, 182,
-180,  54,  74,  75,  72,  55,  52,  75, 189, 183, 180,  75,  72,  54, 180,
-183,  72,  72,  55,  55,  61,  49,  54,  55,  75, 177,  74, 177,  49,  49,
- 63, 177,  74, 183,  52, 183,  75,  52, 180,  52,  52,  61,  52,  72, 177,
- 75,  52, 177, 176,  52,  52,  52,  54,  75,  75, 183, 183, 183,  72, 183,
- 72,  55,  72,  52,  55, 177, 183, 180,  61, 183, 183,  54, 177, 177,  72,
- 55,  75,  72, 183, 180,  75,  72,  72,  52, 180,  75,  75,  72, 183,  55,
- 61,  72,  72,  75,  49,  72, 183,  75, 177,  72,  72,  52,  54,  75, 183,
- 52,  52,  52, 183, 182, 177, 180, 182, 183,  61,  63,  75,  72,  49, 183,
- 52, 183,  52,  52,  54,  75, 182,  55,  55, 177,  75,  61, 183, 182, 182,
-183, 183,  52,  52, 180,  75,  55,  61,  72,  55, 182,  63,  55, 177, 180,
- 54,  61,  75, 180, 180,  55,  75,  74,  52,  61, 183,  63,  55,  75,  55,
-183,  75,  52,  72,  72, 183,  72, 183, 183,  75, 183,  75, 183,  52,  55,
- 52,  72,  54, 180,  55,  75,  61, 189, 183, 177,  52,  61, 176,  55, 183,
- 72,  52, 183,  75, 176, 180,  55,  54,  72,  63,  61,  54,  61,  61, 176,
- 61, 183, 183,  52,  52,  72, 180,  75, 180,  72,  52,  72, 183, 183, 183,
-183, 183, 183, 180,  61, 189,  55,  52,  72,  52,  72,  54,  52,  72,  52,
- 75,  75, 180,  54,  75, 180,  54,  72,  54, 182,  74,  52,  55,  63,  61,
- 52,  75, 177,  72, 177,  72, 177,  75,  52, 183,  75,  72,  63,  52,  52,
- 52,  52,  72,  75, 180, 180,  72, 180, 180,  61, 176,  61,  72, 183,  55,
-183,  72,  55, 182,  52,  55, 180, 177,  72,  61,  55,  52,  61, 183,  55,
- 72,  72,  52,  52,  55,  75,  75, 180,  61, 189, 177,  52, 183,  75,  61,
- 55,  55, 183, 177, 177,  52,  61, 180, 180, 177, 183,  55,  55,  72,  52,
- 75,  54, 176, 183,  55,  61,  75,  52,  52, 183, 180, 183, 183,  63,  61,
- 52, 180, 176,  52,  55,  75,  55,  52,  52,  52,  72,  75, 183,  75, 183,
- 75, 183,  75,  72, 183,  61, 180, 180,  55,  61, 177,  72, 183,  55,  52,
-176,  55,  52,  55,  75,  75,  75,  72, 183, 183,  49,  63,  52, 183,  75,
- 52,  52, 183,  52, 177,  52,  52, 180,  52,  61,  72,  55, 183,  55,  55,
- 61,  52,  52,  52,  55, 180,  55, 180,  61,  55, 177, 183,  61,  55, 177,
- 61,  72,  72,  75, 183, 183,  52, 183,  55,  63, 177,  75, 180,  55, 180,
- 72, 180,  75, 183,  52,  74,  72,  55,  72,  55, 177, 183,  55,  55,  55,
-180, 255,  52, 177,  72,  52,  72,  55,  72,  72,  75,  55, 183,  52, 183,
- 52,  75, 183,  61, 183, 177,  61,  52,  61,  61,  75, 183, 180,  61, 177,
-183,  72,  52,  63,  72, 180,  55, 180,  63,  72,  61, 180,  75, 183,  72,
-183,  63, 177,  61, 183,  75,  75,  55, 183,  52,  72, 183, 180,  55,  55,
- 75,  75,  52,  52,  75,  55,  52,  61,  52,  55, 180,  52,  61, 180,  72,
-183,  61, 183, 180, 176,  52, 183, 180,  55, 183,  55,  63, 177,  55,  72,
- 55,  72,  75,  72,  61,  52,  72,  52,  52,  61, 180,  55,  55, 177,  52,
- 52, 183,  55, 180,  75,  55,  52,  52, 183,  52, 180,  72, 177,  55,  61,
- 75, 183,  75, 183,  55, 177, 176,  75,  52, 180,  72,  55,  72,  63,  55,
- 52,  52, 180,  75,  52,  75,  72,  61,  72, 180,  55,  72,  52, 183,  75,
- 75,  55,  72,  72,  75,  75,  55, 180,  55, 180,  52,  75,  55, 183, 177,
- 52,  52, 181, 183,  55,  75,  72, 180, 180, 183, 180,  61,  55,  55,  75,
-183, 177,  55, 176,  75,  52,  55,  52,  66,  52, 177,  61, 183,  75,  55,
- 52,  61,  52,  52,  55,  72,  72,  52,  72,  61,  52,  52,  75,  55,  55,
- 52,  55, 180, 181,  55,  52,  52, 180, 183,  55, 180,  52, 183, 183,  72,
- 75, 176,  55, 180, 183,  72, 180,  52,  52, 183,  75, 183,  55,  63,  55,
- 72, 180,  75,  75,  55, 180,  52,  52, 183, 180,  61,  61,  52, 180, 183,
-183, 183,  52, 183, 180, 177, 177, 183,  75,  72,  52,  61, 180,  72,  55,
-183,  61,  63,  55,  63,  52, 180,  55,  75,  55,  55,  55,  52,  61,  75,
-177, 183,  61,  72,  52,  52,  72, 180,  78,  52, 183,  61, 177,  52,  52,
- 52,  75, 177,  75,  72, 183,  75,  52,  52,  52, 177,  72,  75, 183,  52,
-180, 177,  75, 183, 183, 183, 180,  55,  55,  52,  75,  75,  61,  52, 183,
- 75,  75,  61,  55,  55,  61,  75,  52,  52,  55, 177, 183,  72,  75,  61,
- 72,  61,  55,  55,  61, 183,  66, 177,  72,  75,  61, 183, 183,  55,  53,
-177, 177,  72,  72,  55,  52,  73,  52, 180, 177,  55, 183,  52, 180,  55,
- 52,  55, 183, 177, 183, 183,  52,  52, 176, 183,  53,  55, 180, 180,  52,
- 55, 181,  55,  55,  72,  75,  52, 176,  55,  52, 183, 183, 181,  72,  75,
- 53,  72, 180,  52,  61,  52,  72, 180,  75,  78,  52, 183,  61,  75, 180,
- 52, 183, 177, 183,  72, 181,  72, 183,  72,  75,  52,  66,  55, 183, 181,
- 55,  66, 180,  52, 183,  75, 180, 180,  75,  72,  55, 183,  75,  75, 183,
- 66, 180,  75,  55,  72, 183, 180, 176, 183,  53,  78,  61, 176,  75,  75,
- 75,  55,  75,  52, 180,  75,  73,  55,  52,  55, 180,  72, 180,  55, 183,
-183,  72,  66, 177,  72,  52, 180,  55,  53,  55,  53, 183,  52,  52, 183,
-180,  75,  55, 183,  61,  75,  52,  72,  75,  72,  72, 183,  66, 177,  72,
- 75,  75, 180,  52,  72, 180, 176,  55,  55,  55, 183,  55,  55,  52,  63,
- 72,  61,  73, 177,  61, 181, 180, 180, 180, 176,  52,  72, 183,  75, 177,
-183, 180, 180, 183, 180, 183,  55,  75,  75, 183, 183,  61,  72,  75,  75,
- 55,  75,  52,  55,  75, 183,  72,  61,  72,  72,  78, 180, 183,  52,  72,
- 55,  78,  61,  55,  52,  72,  52, 177, 180,  63,  55, 183,  55, 177,  55,
- 75, 181,  72, 180,  52,  52, 181,  52,  72, 177, 180, 177,  52,  52,  61,
- 61,  73,  75,  52,  61,  61,  53,  72, 183, 183,  55,  72,  55,  73,  55,
- 61,  52, 177,  53,  52,  52,  55,  55,  75, 181,  55, 183,  61,  73,  52,
-183,  75,  52,  66,  61,  52,  72,  75,  52, 180, 180, 183,  61,  73,  52,
- 75, 180,  61, 183,  52,  75, 177, 183, 180,  55,  55,  55,  52, 183, 183,
- 52, 183, 177,  55,  75,  75,  52,  72,  55,  61,  66, 183,  72, 181, 176,
-180,  72,  72, 177,  75,  52,  72,  72, 177,  55, 181, 180,  75,  75,  52,
- 63,  72, 183,  55,  53,  72,  55,  75,  72,  78,  61,  75, 180, 180,  55,
- 61,  78,  53,  52,  52,  52,  52,  53,  52,  66,  52, 177, 183,  75, 180,
-177,  72, 183, 180,  52,  55,  52, 183, 183,  53,  52,  61,  55, 183,  75,
-183,  61, 177, 180, 181,  72, 181, 180,  52, 180, 180,  55,  52, 181,  73,
-180,  52, 177,  75,  75, 177,  72,  52,  52,  52, 183, 180,  75, 183,  52,
-180, 180, 180, 180,  52,  61,  72, 183,  53, 183,  78, 183,  61,  55, 183,
- 52,  53, 180,  55,  75, 180,  55, 183,  75,  75, 183,  72,  55,  61,  75,
- 52, 177, 183,  52,  55,  75, 183, 255,  61,  78,  75, 183,  72, 177,  75,
- 72,  75, 181,  75, 180,  55,  66,  61, 180,  55,  72, 177,  72, 176, 180,
- 55,  52,  61,  55,  52,  52, 183,  66,  52, 180,  55, 183,  75,  75, 183,
- 78,  52,  75,  52,  52, 183, 180,  55,  72, 183,  72,  75,  72,  75, 183,
-176,  52, 183,  52,  55, 183,  53,  66, 180, 180,  75,  52,  75, 183,  61,
- 72,  52,  52,  72,  73,  78, 183,  55,  55,  63,  61, 180,  63,  55,  55,
-181, 180,  75,  53,  53, 180,  75, 177,  72,  52, 183,  52,  55,  55,  52,
- 72,  75,  52,  72,  53,  53, 176,  55,  52, 183, 183,  73, 183,  55,  78,
-180,  75,  53,  75, 177, 181,  53,  72,  52, 180,  52,  61, 183, 176,  52,
- 73, 180,  75,  66,  55,  53, 181,  53,  66, 180,  72,  72,  52,  72, 183,
- 72,  53,  61,  52,  52,  75,  72,  52,  53,  55,  55, 177,  55,  52,  55,
- 72,  72,  75, 183, 183,  78, 180,  52,  75,  52,  55,  75,  53,  78,  55,
- 75, 177,  75, 177,  55,  61, 181,  73,  72, 183, 176,  78,  52, 180, 183,
-183,  53,  63,  55,  61,  72, 177, 180,  55, 180,  61, 180,  55,  78,  75,
-180,  61,  61, 183,  72, 180,  78, 176, 180, 181,  53,  61,  52,  55, 180,
- 52,  55, 183, 177, 180,  75, 183,  55, 177,  61,  55, 181, 177,  52,  55,
-180,  61,  75,  75, 181,  52, 181, 181, 181,  55, 183,  55,  53,  53,  72,
- 53,  72,  52, 181, 183,  61,  55,  55,  55,  75,  73,  53,  52, 180,  52,
-183,  63,  53,  55,  55,  78,  53,  55,  72,  55,  55, 183,  55, 177, 176,
- 75,  52, 181,  72, 255,  52,  75,  78,  52, 183,  75, 177,  66,  78, 183,
-183, 177,  75,  75,  66,  66,  72, 180,  75, 183,  78,  78, 183,  72,  72,
-177, 180,  75, 183,  52, 180,  61,  75,  63,  52, 181, 183, 176,  55, 177,
- 72, 183,  55,  55,  75,  72, 183, 183,  73,  73,  55, 183,  55,  55,  72,
- 75,  72, 183, 177,  61,  73,  78, 180,  75,  66,  78,  75, 180, 181, 183,
- 73,  55, 180, 183, 183,  55,  73,  52,  55,  55,  72, 183, 183,  75,  72,
- 52,  55,  55,  75,  52, 177, 176,  75,  55,  73,  55,  73,  52,  73, 183,
- 52,  72, 177,  52, 181, 180,  72,  66,  75, 180,  63,  75,  53,  72,  61,
- 55, 183,  63,  52,  52,  52, 183,  55,  72,  72,  66, 183,  53,  55,  75,
-181, 181,  78,  55, 176,  72,  52,  72, 180,  78,  55, 183,  61,  53,  72,
-183, 177,  73, 181,  52, 181,  55, 180,  52,  72,  66,  66,  52,  53,  53,
- 53, 177,  55,  52,  52, 177,  55,  75, 177,  52,  66,  52,  52,  52,  75,
- 63,  53,  72, 183,  55,  52, 181, 183,  72, 181,  75,  53,  53, 183,  55,
- 61,  63,  55,  61,  52,  52, 180,  55,  75,  61,  73, 183,  78,  53, 177,
- 72,  55,  55,  55,  73, 177, 181,  72,  78, 183, 183,  72, 183,  53,  78,
- 75,  75,  55,  55,  55, 177, 177,  55,  72,  55, 180, 177,  55,  75,  61,
-180, 177,  55,  53,  52, 177, 177, 180, 183,  75,  55, 181, 180,  52,  61,
- 53,  78,  66,  72,  72,  73,  73, 183, 255, 181, 180,  55,  61,  53,  73,
-180, 183,  55,  53,  55,  73,  73,  72,  55,  52, 180, 183,  75, 177,  53,
- 75,  75, 180,  61,  55,  66, 177,  53,  55,  73,  52,  72,  75,  55, 183,
- 73,  55,  72, 183,  75, 176,  72,  66,  78,  52,  52,  55, 183,  55,  53,
-183, 183,  66,  52,  55,  55,  75, 176,  61, 180, 183,  75,  53, 177,  55,
- 75, 180,  53, 183, 181,  61,  52, 177,  73,  78, 180, 177,  73, 181,  55,
- 75, 181, 183,  55,  52,  66,  78,  52, 180,  61, 176, 180, 180, 180,  72,
- 53,  55,  72,  72, 180,  72,  52,  53,  53,  53,  72, 183,  52, 180,  53,
- 72,  55,  72,  55, 176,  55, 183, 180,  75,  55,  75,  55,  55,  66, 180,
- 52, 180,  61,  66,  75, 255,  61,  75, 180, 180, 180,  75, 177,  52,  63,
-181,  53, 183, 180, 181,  53,  78,  66,  78, 180,  53, 181, 180, 177,  55,
- 55,  52, 183,  61,  55,  53,  52,  53,  55,  66,  55,  75,  78, 180,  55,
- 75,  52,  75, 183, 180, 181, 183, 181,  61,  73,  52,  78, 181, 181, 180,
- 55, 183,  52,  75,  66,  75,  78,  72,  55,  61, 183,  55,  66,  53,  72,
-180,  66, 183,  75,  63,  73,  75,  73,  78, 183, 177,  72,  63, 183,  66,
- 66,  52, 181, 177,  66,  78,  55,  66, 177,  52, 180, 181,  72,  61,  73,
- 55, 183,  75,  52, 180,  73,  72,  53, 183, 181,  55,  55,  55,  55,  72,
-183, 180,  61, 183,  55,  55,  61, 183,  55, 180, 176, 183,  72,  52,  75,
-180,  72,  75,  66,  73,  75, 181,  53, 180,  61,  55,  75, 181,  52,  52,
- 53, 181,  63, 180,  78,  53, 183,  53,  72,  61,  53, 181, 180, 177,  72,
-177, 180,  55,  55,  52,  52,  52, 183, 180,  52,  72, 181,  72,  78,  52,
-177,  72, 177, 180,  66,  52,  55,  53,  53, 183,  75, 183,  55,  52, 180,
- 61,  52, 181, 177,  55,  75,  55, 177, 183,  78,  78,  55,  61, 183,  75,
- 66,  66, 180,  61,  75, 177,  72, 177,  75,  75,  66, 180,  73, 181, 183,
- 53,  63,  55, 183,  73,  61, 183, 181,  55,  55,  55, 180, 183,  75,  61,
- 52, 181, 180,  75, 183,  61, 183,  52, 183,  52, 183,  61, 183,  66, 177,
- 78,  78,  55,  55, 183,  55,  52,  55, 180,  78,  72, 180,  53, 183, 183,
- 55,  55,  52,  55,  75, 180,  72,  61,  61,  53,  53,  63,  53,  52,  61,
-176, 180,  73,  52, 177, 181,  55, 176,  52,  55, 181,  73,  61,  61, 183,
- 75,  66,  73,  78,  53,  55, 183, 177,  52,  61, 180,  53,  53, 177,  52,
- 66,  78,  72,  55,  61,  55,  55,  61, 181, 180,  78, 181,  55,  53,  72,
- 75,  61,  55, 181,  72,  52,  78, 176,  53,  52,  55, 176,  72, 176,  78,
- 75, 183, 180, 183,  61,  72, 180,  61, 181, 177,  63,  72,  72, 180,  72,
- 52,  52,  73,  78,  66,  55, 181,  73,  53,  52,  53,  73,  55,  72, 177,
-183, 177,  61,  61,  53,  53,  78,  61,  52, 183, 177, 177,  66, 176,  55,
-180,  53, 181,  63, 177,  55,  53,  52,  53, 180,  52,  53,  53, 180, 177,
- 73,  55, 177, 180,  72,  55, 181,  73, 180,  52, 183,  52,  55,  66, 176,
-181,  52, 183,  53,  61, 180,  73, 181,  78, 180,  75,  52, 183,  75, 181,
- 78,  61,  75, 183,  75,  73,  55,  63,  52,  53, 181,  66,  55,  53,  55,
- 73,  75, 180,  61,  52, 180,  55,  75, 181,  72,  78,  53,  66,  53,  55,
- 53,  53,  55, 180,  52, 181, 176,  55, 180,  52,  55, 177,  53,  78,  75,
- 72,  52, 181,  73, 177, 183,  72,  78,  53,  78, 180,  53,  75,  78,  66,
- 75,  66,  53, 181, 180, 180,  66,  53,  55,  66,  53,  61,  61, 183,  55,
- 73,  63,  52,  75, 180,  75,  55,  55,  66,  66,  75,  72,  66,  75,  55,
-180,  55,  73,  53,  55,  61, 183,  55, 180,  72, 177, 177, 183, 183,  52,
- 72,  55, 181,  61, 177, 183,  55,  53,  55, 183,  55, 183, 180,  73,  78,
-181, 180,  78,  55,  53,  73,  75, 183,  53, 180,  52,  55,  78,  73,  53,
-181,  72,  53,  55,  72,  66, 180,  61, 181, 177,  72,  66, 180,  55,  66,
- 52,  72, 183,  72,  75, 183,  72,  52,  52, 181,  78,  53,  73,  55,  52,
-181,  73,  55,  52, 180,  72,  63,  66,  53,  53,  66,  61,  53,  63, 181,
- 52,  73, 181, 181,  72,  78, 181,  55,  52,  73,  61,  63,  66,  73,  52,
- 72, 180,  78,  53,  55,  53,  52, 180,  66,  75,  66,  53,  53,  61,  53,
- 72,  78,  53, 183,  78,  75,  73,  52,  61,  55,  73,  63,  78,  55,  78,
-181,  73,  55, 181,  55,  78,  73,  66,  63,  78,  53,  55,  61, 177,  61,
- 78,  63,  66, 177,  75,  52, 177,  72,  72,  78,  63, 181,  72,  66,  55,
-183,  78,  52,  78,  75, 181,  66, 177, 177,  78,  75,  52, 180,  75,  53,
- 53,  75,  52,  66,  52,  72,  78,  55,  72,  66,  63,  78,  61,  55,  66,
-177, 183,  55,  66,  73,  63,  55,  73, 177, 176, 180, 181,  61,  78,  53,
- 53, 177,  55, 180, 183,  75,  53, 177,  66,  73, 180,  75,  55,  55, 181,
-180, 180,  72, 181,  72,  61, 181,  61,  73,  72,  53, 180,  55, 180,  66,
- 75,  78,  52,  53, 181, 181,  78,  61, 183,  66, 177,  61,  78,  61, 180,
- 78, 183,  53,  55,  55,  61,  53,  53,  53, 177,  61,  72, 180,  55, 183,
- 61,  61,  53, 183,  53, 181,  55,  66,  61,  75,  53, 183, 177, 181,  61,
- 72,  75,  53, 183,  55,  55, 181, 176, 183, 181,  55,  66,  53,  55,  72,
- 55,  53,  61,  55,  55,  78,  55, 181,  61, 183,  73,  66,  75, 180,  72,
- 78,  53,  78, 183, 181,  75,  72, 180,  55,  61, 177, 183,  66, 176,  75,
- 66,  78,  53,  52,  63,  53,  61,  52,  73, 181,  55,  61, 180,  53,  55,
- 72,  75,  52,  75,  66,  73,  55,  52,  53,  75,  55,  78,  53,  78,  55,
-181,  66,  55,  63,  72, 180,  73, 183,  52,  78,  53,  78,  55,  66, 183,
- 78,  78,  52,  75, 177,  73, 176,  55,  66,  55,  61, 180, 180,  55,  53,
- 73,  55,  78, 183,  55,  73,  73, 183,  66,  53,  53,  66,  66, 183, 181,
- 55,  53, 177,  55, 183,  75, 180, 183,  66,  72,  55, 183, 177,  66,  78,
- 61, 183,  61, 177, 181,  78,  73, 181,  52, 177,  66,  78, 180,  78,  66,
-183, 181, 180,  55, 181,  53,  66, 177,  75,  66,  78,  53,  72,  78,  52,
- 66,  73,  66,  78,  55,  52,  73, 181, 181, 183, 181,  61,  75, 181, 180,
-177, 183, 177,  73, 180, 177,  53,  61,  75, 180,  73,  73, 181,  61,  75,
- 75,  55, 181,  75,  55,  61,  73,  55,  75, 181,  53,  72,  78,  55, 183,
-180,  61, 183,  55,  73,  75, 181,  52,  53,  53,  55,  66,  53,  66,  53,
-180,  78,  61,  73, 180,  75,  52,  66, 183,  75,  53,  52,  53,  72, 181,
-181, 181, 177,  55,  78,  78,  73, 177,  55,  63,  78,  55,  73,  75,  66,
- 55,  78,  78,  52, 181, 177, 180,  55,  73,  75, 183,  53,  61,  61,  78,
-177,  73,  72,  73,  53,  75, 177,  55, 183,  72, 180,  66, 183,  66, 180,
- 53,  78,  73,  61, 183, 177, 183,  78,  66,  52,  72,  53,  73, 177, 181,
- 78,  53,  72,  61, 180,  73,  73,  55,  52, 181,  78,  55,  66, 180, 180,
- 55, 183,  53,  78,  55,  66, 183,  73, 181, 183, 180,  66,  55,  53,  66,
-180,  78,  78,  72,  55, 181,  66,  61, 181,  52, 183,  55, 181,  66,  53,
-181, 180,  66, 181,  55, 181,  78,  66,  53, 180,  66,  55, 180,  75,  53,
- 73,  73, 177,  53,  55, 183, 183,  55,  52,  75,  55,  52,  73,  66,  73,
- 55,  61,  73,  63, 180,  78,  66, 181,  52, 181,  78,  78,  66, 180,  61,
- 53,  66,  53, 180,  53,  78,  78, 180,  63, 181,  53,  78, 176,  55,  52,
-181,  63, 180,  72, 181,  53, 181, 183,  75,  63,  53, 181,  73,  78, 183,
-181,  78,  73,  66,  72,  66,  78, 183,  66,  53,  61, 181, 176, 180,  55,
- 66,  73,  52,  78,  55,  53,  66,  78, 183, 183,  53, 180, 181,  78,  73,
- 55, 180,  55,  61, 180,  73, 177,  78, 181,  72,  53, 181,  73,  53,  55,
- 53,  55,  53,  73,  53,  55,  55,  75,  73,  78, 177,  53,  73,  52,  55,
-181,  53, 183, 180, 177, 180,  73,  73,  61,  78,  73,  53, 180, 181,  66,
-177,  66,  55,  72, 177,  53,  78,  78,  55,  66,  55,  52, 183,  61, 177,
-181, 180,  66, 177,  55,  78,  78,  61,  78,  72,  73,  66,  55,  73, 181,
- 53,  75, 180, 181,  72,  78,  73,  73,  52, 181,  52,  63,  78,  53,  55,
- 55,  73,  66,  61, 180, 181,  53,  55,  66, 180,  78,  66,  53,  55,  53,
- 72,  55, 176,  78,  55,  66,  75, 181, 181,  78, 180,  53, 183, 181,  55,
- 55, 180,  63, 181,  53,  61,  52,  66,  72,  78,  53, 181,  73, 180,  73,
- 55, 180, 177, 183, 181, 176, 177, 180,  78,  52,  78, 181,  53, 181,  61,
-180,  61,  55,  55,  66,  66,  55, 181, 181,  75, 181, 181,  53, 180,  61,
- 66, 181, 177, 180,  78, 177,  61,  66,  52,  53,  53,  52, 181, 183,  73,
- 75,  52, 180, 177,  78, 180, 183,  73, 181,  73, 180,  66,  53,  78,  75,
- 66,  73,  55,  52, 181, 180, 181, 181, 181,  73,  61, 181,  61,  55,  73,
- 66, 177, 181,  73, 181, 181, 183,  55,  55,  55,  66, 180, 180, 181, 181,
- 66,  73,  53,  61, 181,  66,  73,  53,  61,  55, 183,  73,  66,  53,  55,
- 53,  55, 181, 181,  61,  66,  78,  61,  66,  53,  53,  55,  52, 177,  66,
-180,  73, 180,  75, 181,  55, 181,  78,  78, 177,  73,  75,  66, 180, 177,
-177, 176,  66,  75,  75,  55,  73,  73,  73,  53,  73,  78, 180,  66, 180,
- 53,  72,  78, 183,  61,  78,  53,  52,  55,  78,  78,  72, 181,  66,  55,
-181, 180,  66, 181,  61,  73,  72,  73,  78,  61,  66,  66,  53, 181, 177,
-177,  66,  66,  75, 180,  78,  73, 183,  53,  78,  78,  52,  53,  78,  53,
- 66,  78, 180,  78,  78,  66, 181,  52, 177, 180, 180,  61,  66, 181, 181,
- 55, 181, 181,  53, 180,  53,  72,  66,  75,  72,  66,  72, 177,  66,  78,
- 61,  75,  73, 177, 180,  53,  61, 181, 181,  73,  61,  53, 180, 177,  53,
- 78,  66, 181,  61,  72, 177,  78,  61,  55,  55, 181, 180,  53,  78,  53,
- 66, 180,  55,  52,  66, 255,  78,  55,  73,  61,  53,  52,  72,  55,  55,
- 53,  53,  55, 181, 180,  66,  66, 181,  66,  75, 183,  53,  78,  73,  66,
- 73,  53, 255,  53,  66,  53,  73, 181,  61,  66,  73, 181, 181,  53,  53,
- 66,  53,  66, 180, 183,  61,  55, 180,  66,  75,  53,  66,  53,  73,  78,
-180, 180,  53,  53,  55,  78,  66,  53,  55, 180,  55,  55,  55,  55,  73,
-181,  61, 180,  53,  55,  61,  78,  72, 181,  53, 180, 181, 181,  63, 180,
- 61, 181,  66,  78, 181,  53,  55,  53, 180,  78,  78, 183,  53,  53,  63,
-181, 181, 183, 180, 180,  53,  52,  73,  61,  72, 177, 183,  73, 181,  73,
- 55,  73,  61,  52,  53,  78, 180, 180,  73, 181, 180,  52,  61,  73,  52,
- 61, 177,  61,  73,  66,  73,  66, 181,  73,  75,  78, 177,  53,  53, 181,
- 78, 181,  66,  78,  66,  55,  66,  78, 180,  52,  75,  66,  66,  55, 183,
- 66,  61,  73, 176,  55,  73,  72,  78,  52,  53, 181,  73, 180, 177, 177,
-180,  66, 180,  73,  55,  53,  66,  53,  53,  78,  78, 176,  78,  78,  72,
- 61, 181, 181,  73,  78,  78,  66, 180,  78,  73, 181,  66,  61,  63,  53,
- 78, 180,  61, 181,  66,  53, 176,  61,  73,  61,  73,  66,  78,  73, 181,
- 73, 181,  55, 183, 181,  78,  78,  73,  73, 177,  73,  78,  61, 181,  55,
- 72, 181,  55, 180,  53,  73,  78,  66,  66, 181,  66,  66,  55,  55,  61,
- 55, 177,  75,  52,  73,  78,  78,  53,  53,  73,  73,  61,  73, 177,  66,
-183, 177, 180,  55, 180,  55,  66, 177,  78,  53,  73,  66,  66,  53,  53,
- 66,  78,  61,  78,  53,  72,  61, 181,  66,  53,  53,  53,  66, 181,  75,
- 53, 180, 181,  78,  66,  55,  66, 176,  73, 183, 181, 181, 177,  61,  53,
-181,  55, 181, 177, 181,  66,  66, 180, 181, 181,  53, 177,  55,  66,  66,
- 55, 181, 181,  66,  73,  55,  66, 177, 180,  73,  53,  78,  53,  66, 181,
- 53,  66,  53,  55, 181,  73,  53,  78, 181,  75,  73,  66, 181,  78,  78,
- 78, 176,  53, 183,  55, 183,  53,  78,  73,  66, 177,  66,  61,  63, 181,
- 55, 181,  78,  78,  78,  73,  53, 180,  61, 181, 181,  53, 180,  66,  78,
- 78,  55,  55,  52,  55, 177,  52, 183,  73,  73,  55,  66,  78,  73,  53,
- 53,  55, 181,  53,  66, 177,  55,  66, 177,  53,  78,  66,  55,  53,  66,
- 73,  53,  53,  73,  53,  55,  55,  73, 180,  66,  73,  73,  66,  55,  78,
- 73,  78,  78, 181, 181, 181,  53,  72,  53,  63,  53,  66,  55,  78,  53,
- 61, 181,  78,  78,  66, 177,  63,  66,  73,  55, 176,  73,  55,  73,  53,
-180,  66, 180,  73,  55, 180,  55,  75,  55,  61,  53,  55,  73,  66,  66,
- 55, 180,  66,  73,  78,  78,  73,  53,  55,  78, 177, 181, 180, 180,  66,
-180, 181,  53,  73,  78, 180, 181, 181,  53,  55,  73,  78, 181, 180,  66,
- 72, 181, 181,  73,  53,  61,  66,  78,  73,  73, 180,  53,  53, 180, 180,
-183,  78,  53,  73,  53, 177, 181,  55,  55,  55,  53, 180,  73, 177, 180,
- 66,  78,  78,  66, 183, 181, 181,  73, 180,  73, 176,  78,  53,  73,  73,
- 73, 180,  53,  66,  61, 181,  66, 181, 181, 181, 181,  66,  53, 180, 180,
- 78,  53,  61,  53,  78,  73,  66, 181, 176,  66,  78,  73,  53, 181, 181,
- 53,  78,  73, 177,  53,  55,  53, 181,  78,  61,  55,  78,  78,  78,  78,
- 73,  61, 180, 177, 181,  55,  73,  63,  78, 180,  73, 177,  73,  73,  55,
- 66,  53,  73, 177, 180, 180, 181, 181, 176,  55,  78, 180,  53, 177,  66,
- 66, 181,  63,  78,  73,  78, 181,  53, 180,  53, 181, 180,  55,  66,  78,
- 66, 180,  66,  53,  78,  66, 181,  78, 181,  78,  61,  66,  66, 181,  78,
- 66,  78,  66, 181,  66, 181, 180,  53,  66,  78,  55, 181, 177,  73,  78,
-181,  53,  66,  63,  61,  73, 181, 181,  53,  78, 181, 180,  61,  53,  53,
- 66,  53,  53,  73,  73,  61,  63,  61,  55, 180, 180,  55,  61, 181, 177,
- 73,  55,  55,  55,  66,  78, 181,  66,  73,  66,  66,  78,  78, 181,  78,
-180,  53,  73, 177, 181,  55,  61,  55,  53,  66, 180, 181,  73,  73, 181,
- 61, 176, 181,  63,  66, 177,  61,  66,  63,  73,  78,  55, 181,  53, 177,
- 55,  66,  64,  61,  78,  66,  78, 181, 181,  73,  53, 180,  73,  55,  66,
- 73,  53, 177,  66, 176,  73, 177,  53,  78,  73,  73, 181, 181,  53, 180,
- 78, 181,  78, 181, 180,  53, 180,  78, 181, 177, 180,  78,  66,  63, 176,
-181,  53, 181,  53, 176,  55,  73,  55,  78,  53,  53, 181,  53,  61, 180,
- 55, 180,  73, 181,  55,  73,  66,  66,  66,  53,  73,  55,  66,  73,  73,
- 53,  66, 177,  66,  66,  66, 181,  78, 181,  55, 177,  53,  53,  53,  55,
- 78,  53, 180,  66,  64,  64,  53, 181,  66,  73,  55,  73, 177,  55,  78,
-181, 180, 181, 180,  79, 180,  66,  73,  78,  66,  78,  66,  53,  61,  66,
- 73, 180,  66,  53,  66,  73, 181, 181,  66,  66,  66,  73,  78, 181, 181,
- 53,  78,  73,  78, 181, 177,  53, 180,  73,  61,  79, 177,  61,  78, 180,
- 61, 176,  55, 176,  53,  55, 180, 181,  66,  66,  66, 181,  78,  55,  76,
-177,  53,  55,  78,  66, 181,  78,  73, 181,  61,  66,  53,  53,  53,  53,
-180,  66,  53,  55,  78,  73, 177,  53, 176,  79,  73,  66,  78,  67, 180,
-180,  53,  73,  66,  61,  78,  76, 181, 180,  63,  66,  53,  61,  55, 181,
- 73,  78,  73,  78, 181, 181,  78,  78,  53,  73,  66,  53, 177,  73,  66,
- 53,  78,  53,  66,  53,  55,  78, 177, 180,  73,  78,  55,  78,  66,  78,
-180,  66,  61,  53, 180, 180, 181, 180,  61,  53,  53,  73,  53,  53, 181,
- 61, 177,  61, 181, 180,  78,  73, 181,  66,  55,  73,  53,  66,  53,  63,
- 66, 181,  73,  64,  53,  67,  55,  67,  78,  66,  53,  66, 181, 180,  53,
- 66,  66,  53,  53, 176,  53,  55,  78, 181,  53,  66, 180,  73,  53, 180,
- 78,  55,  73, 181,  66,  53, 181,  63,  53,  73, 181, 177,  53, 177,  66,
- 53,  66, 180,  66,  78,  67,  76,  53,  53, 177,  61,  66,  73, 181,  55,
- 66,  53,  78,  66,  61, 181, 181, 181, 181,  53, 177, 180,  73, 181, 181,
- 78,  55,  55,  78,  78,  73,  53, 180, 176,  79,  73,  78, 181,  55, 177,
- 53,  78,  63,  61,  66, 180,  63,  78,  53, 177,  73, 180,  78,  73,  78,
- 53, 181,  53,  55,  78,  73, 180,  55,  73,  55,  66,  53,  73,  55,  55,
-181, 181,  55, 180, 181,  64,  53,  55, 181,  78,  61, 177,  76, 177,  55,
- 55, 180, 177,  66,  78,  78, 181,  73,  67,  73,  78, 181,  73,  53,  53,
- 73,  53,  63,  78,  66, 181, 181,  55,  78, 181, 180,  79, 180,  73, 181,
-181, 177,  53,  67,  78,  53,  66,  53,  61,  66,  76,  66,  66,  78,  78,
-181,  55,  79,  76,  73, 180,  66,  55, 181, 181,  64,  73,  73, 181,  61,
- 67,  53,  53,  66,  73,  66,  73,  66,  53,  64,  66,  73,  53,  64, 181,
- 61,  66, 181,  66,  76,  66,  78,  66, 180,  66, 180,  53,  78, 177,  53,
- 78,  55, 181, 180,  55, 181,  53,  67,  53, 181,  78,  66,  67, 181, 181,
- 78,  66,  53,  61, 177,  53,  73,  53, 181,  78,  78, 181,  61,  53,  73,
- 61,  79,  78,  55,  55,  78,  78, 181,  78,  53,  53,  53,  66, 180,  79,
-180,  73, 181,  73, 181, 177, 181,  78,  53,  78,  55, 180, 181,  76,  53,
- 55,  73, 180,  76, 181,  55,  66, 181,  73,  66, 180,  66,  78,  76, 180,
- 78,  66,  73, 181,  73,  78,  55,  78, 180,  78,  73,  55,  78,  61,  55,
- 66, 255, 180,  73, 180,  66,  55,  78, 180,  53,  78,  66,  78,  66,  55,
-181,  53,  64,  78,  78,  67,  53,  66, 181, 176,  53, 181, 177,  78,  66,
-180,  64,  67, 177, 181,  55,  53, 180,  73,  73,  66, 181,  61,  67,  64,
- 53,  53, 180,  53,  73,  53,  73,  79,  64,  53,  53,  78,  55,  55,  55,
- 55, 180,  53, 180,  55,  64,  73,  66,  64,  66,  67, 181, 181,  61,  64,
- 53, 181,  78,  61,  53,  66, 180, 181,  55, 181, 180,  53,  78,  63,  53,
-181,  61, 180,  66, 181,  79,  55,  66, 181,  73,  73,  66,  73,  66,  55,
- 53, 180, 181,  79, 180,  64, 181, 180,  53,  53,  53,  53,  55,  55,  73,
- 79,  78, 177,  78,  78,  63,  73,  78,  66, 180, 181, 181,  73,  78,  66,
- 78, 181,  55,  79, 181,  66,  55,  53,  73,  61,  66, 181,  73,  66, 181,
- 53,  55, 180, 180,  53, 180, 180, 181,  78, 181,  78,  53,  66, 177,  76,
- 55,  79,  76, 181, 181,  73,  55,  66,  53,  73,  73,  53,  55,  78,  61,
-177,  78,  76,  53, 177,  53,  73, 180,  55,  66, 181, 181, 181,  73,  79,
-180,  53, 177,  78,  73,  53,  66,  78, 181,  66, 181,  64, 181,  78,  79,
- 78, 180, 181,  78,  73,  53, 176,  66,  55,  64,  61,  78, 181, 181,  66,
- 61, 181,  53,  67,  61,  53,  55,  67,  55,  64, 181,  55,  66,  64,  79,
- 79,  79,  53,  66,  66,  53,  53,  78,  66,  76,  66,  64,  73,  61,  61,
- 76,  64, 181, 176,  53,  66,  53,  66,  66,  55, 181,  55,  73,  63, 177,
- 63,  53,  76, 180,  78,  73,  79,  66, 181,  55,  73, 181,  66,  53,  66,
- 61,  53,  67, 180,  55,  53,  79,  61,  78,  76,  73,  55, 177,  53,  73,
- 78, 181,  53, 181,  67,  53, 180,  53,  55,  53,  61, 180,  55,  73, 177,
- 66,  78,  66,  53, 180,  78,  63,  53,  66,  79,  53,  78,  73,  63, 180,
- 53, 177, 177,  53, 181, 180,  55, 181,  53,  63, 181,  78,  73,  73, 180,
- 61,  66,  61,  63,  76,  53,  64,  61,  53,  73, 180, 180,  79,  78,  73,
-180,  67,  78,  55,  66,  53,  53, 180,  53,  64,  66,  64,  66,  55, 181,
- 78, 177, 180, 181,  53, 177,  78,  53,  53, 177,  61,  73,  66,  63, 176,
- 66,  64,  73, 181,  73,  79, 181, 181,  61,  55,  76, 181,  66,  66,  78,
- 73,  53,  55, 181,  78,  78, 176,  78,  76,  67, 177,  55, 177,  64,  67,
- 73,  64,  78, 180, 181,  66,  73,  73, 181,  53,  78,  78, 181,  66,  61,
- 78, 181,  73, 177,  53,  73, 181,  53,  61, 181, 181,  76,  55,  55,  53,
- 67, 181,  79, 177, 181,  53,  66,  55,  76,  64,  61,  66,  53, 181,  76,
-180,  73,  73, 180,  61, 180,  79,  64, 181,  55, 181,  67,  61,  61,  78,
- 55,  67, 181, 180,  73,  78,  61,  55, 181,  64,  78,  64, 180,  53,  78,
- 61,  79,  66, 181,  66,  55,  78,  79, 176, 180, 180,  53,  64, 177,  78,
-177,  73, 181, 181,  55, 181,  66, 180,  55,  53,  73, 181,  53, 180,  79,
- 55,  73,  55,  73,  66, 181,  53, 181,  67,  53,  66, 180,  78,  53,  73,
- 79, 181, 177,  66,  76, 176,  55,  53, 177,  79, 181,  66,  53,  76,  53,
- 53,  66,  78,  66,  73,  53,  78,  66,  73, 181,  55,  78,  53,  53,  66,
- 66,  53,  53, 181, 181,  78,  79,  64,  66,  73,  79,  67,  66, 181,  66,
- 61,  78,  73, 181,  73,  76,  79,  79,  55, 181,  67,  78,  61,  63, 181,
-181,  63,  53,  66, 181,  53,  53,  76,  66,  73,  73,  73,  76,  55,  53,
- 78,  66,  79,  64,  55, 181,  55,  78,  67, 180, 181,  66,  79,  76,  78,
- 76, 180,  73,  76, 255,  67,  66,  73, 177,  64,  78, 177,  78,  64,  73,
- 55, 180,  79,  64,  64, 180,  53,  64,  67, 177,  53,  53,  55,  64, 180,
- 55,  76,  76,  53,  55,  55,  78,  73,  53,  53,  61, 181, 181,  53, 180,
-180,  61,  79, 181,  61,  64,  73,  73,  79,  63, 180, 181,  53,  55,  63,
- 64,  76,  78,  66,  79, 181,  55, 180,  66,  67,  66,  67,  53,  67,  64,
- 79, 181,  78,  61,  55,  53, 181, 181,  73,  55,  55,  66,  66,  67,  53,
-176,  73,  53,  55,  55, 180,  53,  64,  53, 181, 180,  76,  53,  66,  73,
- 78,  61,  53,  67,  76,  78,  79,  78,  79,  55,  64, 181, 181, 181,  53,
- 78, 177,  53,  67,  73,  78,  53,  55,  67, 180,  73,  79,  78,  61,  64,
- 53,  66,  53, 181, 181,  53,  55,  55,  76,  53,  66,  55,  76,  55, 181,
- 53,  66,  55,  78,  73,  55, 181,  55,  78, 181,  66, 181,  66,  66, 181,
- 64,  55,  53,  73,  55,  73,  67,  73,  53,  55,  73, 181, 180,  67, 176,
- 64,  66,  55,  53,  76,  73, 181,  67,  55,  73,  67,  64,  66, 180,  61,
-176,  55, 177,  53,  79,  61,  78,  73,  67,  53,  61,  64, 181, 180,  78,
- 78,  73,  53, 181,  64, 180,  66,  61,  73,  76, 180, 180,  78,  55,  55,
- 53,  78,  78,  66, 180, 180,  79,  53, 180, 180,  73,  55,  53, 181,  73,
-181, 181,  53, 181,  55,  64, 177,  66,  64, 177, 180,  64,  78,  61, 177,
- 79,  66,  53,  55, 181,  66,  55,  73,  66,  66,  73,  61,  66,  73,  55,
- 76,  67, 181,  55,  67,  55,  78,  76,  55,  76, 177,  53, 176,  76,  76,
- 79,  78,  78,  79,  73, 180,  64, 180,  79,  67, 177,  79,  66,  53,  53,
- 79, 181, 181,  53,  73,  53,  76,  53, 177,  55,  53,  53,  61,  66,  53,
-181,  64,  79, 180,  64, 181,  64, 181,  76,  55,  61,  79,  78,  78,  73,
-181,  79, 180,  67, 181, 180,  78,  66,  78,  61, 180,  76,  66,  67, 177,
- 78,  79,  73,  76,  67,  55,  53, 180,  64,  53,  73,  53,  55, 181, 177,
-181,  79,  76,  55,  67,  66,  79,  73, 181,  79,  55,  67,  79,  67, 181,
-181,  76,  55,  73,  78,  78,  64, 181,  66,  55,  53,  78,  64,  53, 180,
- 79,  67,  66,  61,  53,  73, 181, 181,  64,  73, 181,  55,  53,  53,  73,
-181,  61,  67,  73,  79,  78,  76,  66,  66,  67,  67,  78,  64, 181,  79,
- 64, 180, 181,  78,  73, 181,  63,  64,  55, 181,  53,  76, 181,  67, 181,
- 79, 181,  64,  55, 181,  73,  63,  55,  79,  79, 180, 181,  78,  61, 181,
- 79,  64,  53,  53, 180, 181,  76,  55,  64,  53,  64, 177, 181,  78,  66,
- 73,  76,  53,  78,  55,  66,  64,  78, 181,  76,  55,  64,  66,  66,  53,
- 53, 180,  67,  55,  64,  53,  55,  79,  78,  78,  78,  64,  64,  53,  55,
- 76,  63,  79, 180, 181,  79,  55, 180,  55,  73,  66, 177,  53,  79,  78,
- 78,  67, 181, 181,  53, 180,  76,  53, 181,  76, 176,  53,  78,  53,  53,
- 64, 181,  53,  53,  53,  79, 180,  67, 181,  61,  66,  67,  78,  67,  67,
-180,  53, 180,  61,  79,  73, 181, 181,  64,  64,  53,  53,  55,  67, 180,
- 55,  78, 180,  53, 181,  55,  53,  61,  55,  64, 177,  53,  61, 181,  66,
- 64,  53,  76,  66,  73, 177,  53,  79,  79,  55,  64,  78,  53,  73,  67,
-180, 181, 181,  73,  78, 181,  73, 177,  55,  64,  55,  76,  78, 177, 181,
- 73, 181,  53, 181,  64,  73,  66,  73, 181,  67,  67,  61,  79,  53,  53,
-181,  79, 180, 181,  53,  66,  79,  78,  78, 180, 181,  79,  73,  55,  55,
- 53,  53,  55,  78,  73,  66,  64,  55, 181,  76,  76,  79,  55,  64, 181,
- 61,  78,  78,  55, 177,  55,  64,  55, 180,  53, 180,  64,  79,  64,  61,
- 76,  53, 176,  78,  67,  79,  66,  64,  79,  66,  61,  53,  63,  61, 180,
- 64,  76,  73,  64, 180,  73,  53, 181, 180,  66,  79,  79, 181,  55,  79,
-177,  53,  64, 177, 177,  66,  63, 181,  67,  66, 181,  73,  61,  67,  64,
- 61,  79,  67,  64, 177,  55,  53, 181,  76, 177,  53,  76,  78, 181, 181,
-181, 181,  79,  79,  53,  76,  53,  66,  79,  53, 177,  73,  76,  63,  53,
- 73,  64,  66, 177,  79,  78,  73,  78,  78,  76,  64,  64,  78, 181,  53,
- 53, 176,  64,  76, 181,  79,  67,  67, 181,  61,  79,  76,  76,  63,  66,
- 64,  64,  61,  73,  53,  64,  73,  79,  55,  61,  55,  64, 177,  76,  67,
-180,  73,  76,  78, 181,  61,  67,  79,  55, 181,  61,  66,  53,  53,  53,
- 79,  64,  64,  67,  67,  61,  61,  53,  61,  73,  53, 176,  76,  79,  67,
- 73,  73,  67,  66,  76,  53,  76, 181,  55,  66, 181,  53,  76,  67, 177,
-181,  79,  53,  53,  64,  64,  76, 177,  79,  66, 181,  67, 181,  66, 181,
- 53,  64, 180, 181,  55,  66,  66,  61,  64,  66, 181,  67,  76,  61, 181,
- 64,  53,  55, 177,  73,  73,  79,  76,  76, 181, 181,  79,  66,  76, 177,
- 64,  78, 177,  73,  79, 180,  53,  61,  79,  64, 180,  73, 180,  79, 176,
- 53,  53,  79,  64,  55,  63,  79,  53,  55,  73, 181,  67,  53,  53,  53,
-180,  55,  67,  53, 180,  63,  78,  55, 180,  64,  78, 180,  73,  53,  55,
-181,  67,  78,  66,  63,  67,  76,  64,  76,  76,  64, 180, 176,  53,  73,
- 78,  53,  53,  64,  55,  55,  53, 255,  55, 181,  76, 177,  73,  64,  53,
- 79,  76,  67, 181,  55,  64,  64,  53,  63,  55,  53, 180,  73,  73, 177,
-181,  73,  66,  73,  64,  76,  53,  64,  78,  53,  66, 181,  67,  61,  55,
- 76,  78,  55, 180,  55, 177,  64, 181,  66,  61,  55,  67,  78,  73,  67,
-177,  61,  55, 180,  78,  79,  64,  67,  63,  67, 180,  67,  64, 177,  79,
-181, 181,  61,  76,  64, 177, 176, 180,  64,  55,  78,  55,  61,  79, 176,
-181,  67,  55,  55, 180,  53,  64,  55,  55,  73,  67, 180, 181, 180,  66,
- 64,  64, 181,  67,  79,  79, 180,  73,  76, 180,  64,  55,  76,  55,  55,
-177,  67,  64, 180,  55,  76,  53,  73,  79, 180,  53,  64,  76,  66,  67,
- 78,  66,  67, 181,  67, 176,  76,  67,  66,  53, 181,  67,  79,  55,  53,
- 64,  64,  76,  79,  64,  76, 181,  64,  53, 181,  53,  61, 180,  76, 181,
- 79,  73, 180,  76,  55,  78,  73,  61,  79,  79, 180,  79,  76,  76,  76,
-177,  63,  53, 180,  76,  64,  64,  63,  76,  67,  79,  73,  53,  55,  76,
- 64,  76,  78, 180,  53,  79,  76, 181, 181,  64,  53, 181,  64, 181,  79,
- 73,  79,  79, 181, 181,  79,  79,  67, 181,  64,  55, 180,  53,  79,  67,
- 53, 181,  67, 181,  78,  73, 177,  55,  66, 181,  55,  53,  67,  64,  53,
- 66,  55,  55, 181,  79,  53,  53, 180,  63, 177,  76,  76,  67,  76,  79,
-180,  79,  55, 180,  79,  76,  79,  64, 177,  63, 181,  78, 177, 180, 181,
-181,  64,  55,  67,  55,  73,  73,  67, 177, 180,  61,  64,  67,  79, 181,
- 64,  61,  64,  53,  67, 180, 180,  64,  53,  78,  79,  55,  55, 181,  78,
- 79,  53,  61,  64, 181,  53,  79,  64,  53,  79,  79, 181, 180,  76,  55,
-181,  55,  53, 177,  64,  66,  76,  66,  64,  53,  55,  76,  79, 177,  67,
-181, 181,  67,  67,  76, 181,  53, 180,  73, 177,  67, 177, 181,  66,  55,
- 64, 177,  79,  73,  53,  55,  78,  64,  66,  78,  53,  64,  53,  64,  67,
- 79, 181, 176,  79,  67,  63,  67,  67, 180,  73,  61,  76,  64,  64,  76,
- 79, 181, 181,  64,  67,  78,  78,  76,  53, 180,  64,  61,  64,  67, 177,
- 67,  63,  66, 180,  53,  63, 176,  53,  53,  53,  64,  79,  55,  53, 181,
- 53,  67,  79,  79,  76,  73,  76,  53,  76,  66,  53,  76,  53,  79,  64,
- 55, 180,  53,  55,  76,  67,  67,  79,  79,  66,  79,  79,  76, 181,  55,
- 67,  53, 181,  79, 177,  67,  79,  67,  78,  64,  55, 180,  67,  64,  61,
- 53,  63,  53,  67,  67,  64, 181,  53,  53, 181,  73,  67,  55,  79,  67,
- 55,  76,  64, 181,  64, 181,  55,  73,  79,  76,  55,  76,  67,  76,  64,
- 78,  55,  76,  76,  61, 180, 181,  55,  76,  76,  76,  67,  53, 181,  79,
- 79,  64,  79,  67,  79,  64, 180, 180,  66,  66,  61,  73,  79, 177,  67,
- 67,  64,  53,  76, 177,  79,  79, 181,  79, 181,  64,  76, 180, 180, 181,
- 64,  79,  79,  64,  55, 181, 180,  61,  67,  64, 180, 180,  76,  64,  64,
- 64,  76,  79,  67,  73,  76,  78,  64,  67,  79,  79,  76,  66,  64,  53,
- 78,  67,  64, 177,  66, 180,  61, 181,  64,  64,  61,  53, 180,  55,  55,
- 64,  64,  67,  67,  79, 180,  55,  78,  67,  76,  53,  64,  67, 177,  66,
-181, 181,  53,  55, 181,  64,  55,  76,  79,  67,  64,  64,  53,  66, 181,
- 66,  79,  67,  53, 181,  55,  53,  79, 181, 181,  67, 176,  64,  64,  53,
-180,  53,  55,  53, 181, 181, 181,  76,  64,  53,  66,  66,  67, 180,  67,
- 53,  79,  55,  76,  78,  53,  76,  53, 181,  55,  64,  55,  64,  76,  66,
-181, 181,  79,  55,  79,  64,  76,  53, 181,  79,  64,  67, 177,  53,  67,
- 66,  53,  53, 180, 180,  61,  55,  67,  55, 180,  64,  76, 177, 177, 181,
-181, 180,  67,  53,  79, 181,  67,  53,  64, 181,  63,  64,  53,  79,  76,
-176,  64,  76,  64,  53,  64,  61, 181,  76,  55,  64,  64, 181, 180, 176,
- 55,  79,  53,  79,  79,  53,  67,  66,  53,  53,  61, 181, 180,  67,  73,
- 55, 181,  55,  66,  78,  79,  55,  61,  67,  64, 180, 180,  76,  78,  67,
- 64, 180,  67,  64,  61,  79, 180,  79,  64, 181,  76,  79, 177,  55,  66,
- 79,  67,  64,  67,  73,  76,  53,  55,  67,  79,  67,  63,  67,  79, 177,
- 53, 176,  79,  67,  53,  67,  67, 180,  53,  53, 180,  67,  79,  55,  76,
- 79, 181,  64,  76,  53,  76, 181,  55, 177,  76,  55,  76,  67,  79,  79,
- 67,  76, 180, 177,  79,  79,  64,  76,  79,  67,  61,  78,  76,  79, 180,
- 55,  64,  64,  53, 181,  53,  76, 181,  53,  76,  76,  53,  53, 181,  76,
- 55,  61,  61,  66, 181, 180, 181, 181,  76,  61,  67,  64,  64, 181,  66,
-176,  76, 177, 177, 181,  55, 181,  73, 181,  53,  79,  76,  64,  64,  76,
- 64,  79,  55,  67,  79,  76,  76,  76,  79,  76,  53,  55,  53, 180,  76,
- 55,  79, 177,  76,  67,  64,  79,  64,  55,  53,  64,  76,  53,  55,  64,
- 79, 180,  79,  76,  55,  67,  64,  76, 180,  64,  64,  67,  64,  64,  55,
- 64,  64,  73,  78,  64,  79,  66,  53,  61,  64, 181,  53,  79,  79,  76,
- 76, 180,  73, 181,  64,  66,  79, 176, 177,  76,  66,  67,  76,  79,  76,
- 79,  79,  67,  78,  64,  55,  61, 181,  55,  67,  53,  67,  76,  61,  64,
- 55,  64,  64,  76,  53,  53,  53,  67,  79,  79,  67, 181,  79,  64,  67,
- 79,  79,  55,  67,  67,  67,  64,  53,  76,  53,  55,  53,  55,  64,  64,
- 73, 181,  76,  53,  67,  64,  67,  64, 180,  76,  64,  53,  79,  61,  79,
- 64, 181,  67,  67,  53,  67,  64,  79, 181,  53,  64,  76,  61,  67,  64,
- 79, 181, 181,  79,  67,  76,  79,  79,  76,  55,  64,  64,  64, 181,  79,
- 79,  67, 180,  64, 177,  55,  67,  55,  76,  61,  76,  78, 181, 177,  76,
- 67, 177,  55,  55,  53,  73,  67,  63,  67,  64,  76, 181,  53,  53,  64,
- 76,  53,  61, 180, 180, 181, 180,  64, 180,  53, 181,  64,  76,  79, 181,
-180, 176, 181,  76,  76, 181,  55,  55,  53,  55,  53, 180, 177,  76,  67,
- 79,  55,  79,  63, 180,  67,  53, 180,  67, 181,  79,  64,  55,  55, 177,
- 67,  64,  79,  53,  61,  53,  67,  76,  79,  76,  55, 181, 180,  61,  79,
- 76, 180,  53, 181,  53,  67,  67,  61,  79,  76, 180, 180,  64,  64, 181,
-181,  76,  55,  61, 176,  67,  55,  61,  61, 176, 180, 180,  55, 180,  55,
- 79,  61,  64, 181,  79, 181,  79,  67,  76, 181,  55, 180,  76,  79,  55,
- 76,  67,  61,  64, 177, 177,  67,  64,  55,  76,  79,  64,  76, 181,  76,
- 64,  67,  79,  53,  73,  67,  79,  53,  55,  64,  64,  67,  79,  55, 180,
-181,  67,  55, 180,  55,  64,  78,  79,  67, 180, 181,  64,  53,  79,  79,
- 76,  67, 181,  53, 181, 177,  76,  55,  79,  61,  64,  79, 180,  64,  67,
- 76,  61,  64,  67,  64,  67,  64,  61,  67,  67,  64, 181,  53,  79,  53,
- 64,  53,  79,  53,  67,  64,  76,  76,  53,  79,  79,  66,  64, 180,  76,
- 79,  79,  79,  64, 181,  76,  64, 180,  79,  64,  55,  64,  76,  55, 177,
-177, 180,  67, 180, 180,  55,  79,  55,  67,  79, 181, 181,  61,  67,  53,
- 76,  64,  55,  53,  53,  64,  64,  79,  76,  79, 180, 181,  53,  61,  64,
- 79,  55,  64,  64, 177,  55,  79,  53,  64,  64,  63,  67,  55, 181,  53,
- 66, 181,  64,  67,  67,  79, 181,  79,  67,  64, 181,  79,  64,  55,  64,
- 76, 181,  67,  53,  76,  76,  64,  67,  79,  64,  67,  79,  64,  76,  64,
- 76, 180, 180, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255,  82,  92,  92,  85,  28, 163, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 128, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 152, 155, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255,  21, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 166, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 186, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  50, 255,
-255, 255, 255, 255, 255,  57, 255, 255, 255, 176, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 102, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255,  49, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255,  30, 255,  74, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255,  31, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255,  37, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 177, 255, 255, 255, 255, 255, 255,  34, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 146, 146, 146,
-255, 255, 255, 255, 255, 255, 135, 132,  96,  96, 178,
\ No newline at end of file
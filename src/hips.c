@@ -15,12 +15,19 @@
 // Should be good enough...
 #define URL_MAX_SIZE 4096
 
-// Size of the cache allocated to all the hips tiles.
+// Size of the cache allocated to all the hips tiles (CPU tier: decoded
+// pixels and eph data).
 // Note: we get into trouble if the tiles visible on screen actually use
 // more space than that.  We could use a more clever cache that can grow
 // past its limit if the items are still in use!
 #define CACHE_SIZE (256 * (1 << 20))
 
+// Size of the cache allocated to the tile textures (GPU tier).  Kept
+// separate from the CPU tier so that under memory pressure we can drop the
+// textures of off-screen tiles while keeping the cheap-to-reupload decoded
+// pixels, instead of thrashing full reloads over the network.
+#define TEX_CACHE_SIZE (128 * (1 << 20))
+
 // Flags of the tiles:
 enum {
     // Bit fields set by tile if we know that we don't have further tiles
@@ -45,6 +52,7 @@ struct tile {
     hips_t      *hips;
     fader_t     fader;
     int         flags;
+    int         cost; // Cost currently registered in the cache.
     const void  *data;
 
     // Loader to parse the image in a thread.
@@ -67,19 +75,80 @@ typedef struct {
     int         pix;
 } tile_key_t;
 
+/*
+ * Type: tile_tex_t
+ * Entry of the GPU tier cache: the texture plus the time it first
+ * became available, used by the cross-order blend of the renderer.
+ */
+typedef struct {
+    texture_t   *tex;
+    double      birth; // Unix time of the texture creation.
+} tile_tex_t;
+
+// Duration (s) of the cross-order fade in of freshly arrived tiles.
+#define BLEND_DURATION 0.3
+
+// Fractional margin past the rounding boundary the render order has to
+// move before we actually switch order (see hips_render_traverse).
+#define ORDER_HYSTERESIS 0.1
+
 /*
  * Type: img_tile_t
  * type data for images surveys.
+ *
+ * The decoded pixels are kept even once a texture has been created, so
+ * that the GPU tier can evict the texture without forcing a network
+ * reload.
+ *
+ * For large tiles (planet surfaces typically) we also keep a small
+ * low-frequency preview, computed in the loading worker, so that the
+ * render thread can upload something cheap immediately and defer the
+ * expensive full resolution upload to a later frame.
  */
 typedef struct {
     void        *img;
     int         w, h, bpp;
-    texture_t   *tex;
+    void        *preview; // Downsampled copy of img (can be NULL).
+    int         pw, ph;
 } img_tile_t;
 
-// Gobal cache for all the tiles.
+// Max dimension of the low-frequency preview of large tiles.
+#define PREVIEW_SIZE 64
+
+// Max order at which we record known-empty pixels in the per-survey
+// occupancy tree.  Deeper branches are still culled by their recorded
+// ancestors.
+#define OCCUPANCY_MAX_ORDER 9
+
+// Number of buckets of the fetch latency histograms: power of two
+// milliseconds ranges, starting under 16ms.
+#define LATENCY_NB 8
+
+/*
+ * Type: fetch_t
+ * An in-flight tile fetch, tracked for the instrumentation counters.
+ */
+typedef struct fetch {
+    int pos[2]; // order, pix.
+    double start; // Unix time of the first probe.
+    UT_hash_handle hh;
+} fetch_t;
+
+/*
+ * Type: delta_tile_t
+ * A tile listed in the delta release manifest.
+ */
+typedef struct delta_tile {
+    int pos[2]; // order, pix.
+    UT_hash_handle hh;
+} delta_tile_t;
+
+// Gobal cache for all the tiles (CPU tier).
 static cache_t *g_cache = NULL;
 
+// Global cache for the tile textures (GPU tier).
+static cache_t *g_tex_cache = NULL;
+
 struct hips {
     char        *url;
     char        *service_url;
@@ -89,6 +158,7 @@ struct hips {
     char        *label; // Short label used in the progressbar.
     int         frame; // FRAME_ICRF | FRAME_ASTROM | FRAME_OBSERVED.
     uint32_t    hash; // Hash of the url.
+    int         priority; // ASSET_PRIORITY flag of the downloads (0: normal).
 
     // Stores the allsky image if available.
     // We only do it for order zero allsky.
@@ -103,15 +173,57 @@ struct hips {
 
     // Contains all the properties as a json object.
     json_value *properties;
+
+    // Delta release support: when the properties advertise a
+    // hips_delta_release_date, the survey also publishes under delta/ a
+    // manifest of the tiles patched since the base release, plus one
+    // delta eph file per patched tile.  The base tiles keep their cached
+    // URL, so a catalog fix only costs the patched rows.
+    struct {
+        double          release_date; // As jd value (0 if none).
+        bool            ready;
+        bool            not_available;
+        delta_tile_t    *tiles; // Hash set of the patched tiles.
+    } delta;
     int order;
     int order_min;
     int tile_width;
 
+    // Occupancy tree: one bit per pixel and per order, set when we know
+    // the whole branch under this pixel is empty.  Unlike the
+    // TILE_NO_CHILD flags of the tiles this survives cache eviction, so
+    // sparse surveys don't have to rediscover their holes with 404s.
+    // Bitmaps are lazily allocated per order.
+    uint8_t *occupancy[OCCUPANCY_MAX_ORDER + 1];
+
+    // Fractional render order of the last traversal, used to detect a
+    // zoom toward the survey and prefetch the next order ahead of it.
+    double last_order_f;
+
+    // Integer order of the last traversal (-1 initially), for the order
+    // selection hysteresis.
+    int last_render_order;
+
     // The settings as passed in the create function.
     hips_settings_t settings;
     int ref; // Ref counting of hips survey.
+
+    // Instrumentation counters, reported by hips_stats_report.  Cheap
+    // enough to always stay on.
+    struct {
+        int     tiles;        // Tiles of this survey currently in cache.
+        int64_t bytes;        // Resident bytes of those tiles.
+        int64_t hits, misses; // Tile cache lookups.
+        int     latency[LATENCY_NB]; // Fetch latency histogram.
+    } stats;
+    fetch_t *fetches; // In-flight tile fetches (hash by order/pix).
+
+    hips_t *prev, *next; // In the global list of alive surveys.
 };
 
+// List of all the alive surveys, for hips_stats_report.
+static hips_t *g_surveys = NULL;
+
 
 static const void *create_img_tile(
         void *user, int order, int pix, void *src, int size,
@@ -135,20 +247,35 @@ hips_t *hips_create(const char *url, double release_date,
     hips->ext = "jpg";
     hips->order_min = 3;
     hips->release_date = release_date;
+    hips->last_render_order = -1;
     hips->frame = FRAME_ASTROM;
     hips->hash = crc32(0, (void*)url, strlen(url));
+    DL_APPEND(g_surveys, hips);
     return hips;
 }
 
 void hips_delete(hips_t *hips)
 {
     int i;
+    fetch_t *fetch, *tmp;
+    delta_tile_t *delta, *delta_tmp;
     if (!hips) return;
     hips->ref--;
     assert(hips->ref >= 0);
     if (hips->ref > 0) return;
+    DL_DELETE(g_surveys, hips);
+    HASH_ITER(hh, hips->fetches, fetch, tmp) {
+        HASH_DEL(hips->fetches, fetch);
+        free(fetch);
+    }
+    HASH_ITER(hh, hips->delta.tiles, delta, delta_tmp) {
+        HASH_DEL(hips->delta.tiles, delta);
+        free(delta);
+    }
     free(hips->url);
     free(hips->service_url);
+    for (i = 0; i <= OCCUPANCY_MAX_ORDER; i++)
+        free(hips->occupancy[i]);
     for (i = 0; i < 12; i++)
         texture_release(hips->allsky.textures[i]);
     json_builder_free(hips->properties);
@@ -202,6 +329,8 @@ static int property_handler(void* user, const char* section,
         hips->tile_width = atoi(value);
     if (strcmp(name, "hips_release_date") == 0)
         hips->release_date = hips_parse_date(value);
+    if (strcmp(name, "hips_delta_release_date") == 0)
+        hips->delta.release_date = hips_parse_date(value);
     if (strcmp(name, "hips_tile_format") == 0) {
              if (strstr(value, "webp")) hips->ext = "webp";
         else if (strstr(value, "jpeg")) hips->ext = "jpg";
@@ -253,6 +382,15 @@ static int parse_properties(hips_t *hips)
 }
 
 
+// Used by the GPU tier cache.
+static int del_tile_tex(void *data)
+{
+    tile_tex_t *ttex = data;
+    texture_release(ttex->tex);
+    free(ttex);
+    return 0;
+}
+
 // Used by the cache.
 static int del_tile(void *data)
 {
@@ -264,6 +402,8 @@ static int del_tile(void *data)
         if (tile->hips->settings.delete_tile(tile->data) == CACHE_KEEP)
             return CACHE_KEEP;
     }
+    tile->hips->stats.tiles--;
+    tile->hips->stats.bytes -= tile->cost;
     hips_delete(tile->hips);
     free(tile);
     return 0;
@@ -283,6 +423,49 @@ static bool img_is_transparent(
     return true;
 }
 
+/*
+ * Mark a pixel of the occupancy tree as known empty: the whole branch
+ * under it will be culled without any request.
+ */
+static void occupancy_set_empty(hips_t *hips, int order, int pix)
+{
+    int npix;
+    if (order < 0 || order > OCCUPANCY_MAX_ORDER) return;
+    if (!hips->occupancy[order]) {
+        npix = 12 << (2 * order);
+        hips->occupancy[order] = calloc(1, (npix + 7) / 8);
+    }
+    hips->occupancy[order][pix / 8] |= 1 << (pix % 8);
+}
+
+/*
+ * Check whether a pixel or any of its ancestors is known empty.
+ */
+static bool occupancy_is_empty(const hips_t *hips, int order, int pix)
+{
+    int o, p;
+    for (o = min(order, OCCUPANCY_MAX_ORDER); o >= 0; o--) {
+        if (!hips->occupancy[o]) continue;
+        p = pix >> (2 * (order - o));
+        if (hips->occupancy[o][p / 8] & (1 << (p % 8)))
+            return true;
+    }
+    return false;
+}
+
+/*
+ * Record the child transparency mask of a loaded tile into the
+ * occupancy tree.
+ */
+static void occupancy_add_tile(hips_t *hips, const tile_t *tile)
+{
+    int i;
+    for (i = 0; i < 4; i++)
+        if (tile->flags & (TILE_NO_CHILD_0 << i))
+            occupancy_set_empty(hips, tile->pos.order + 1,
+                                tile->pos.pix * 4 + i);
+}
+
 int hips_traverse(void *user, int callback(int order, int pix, void *user))
 {
     typedef struct {
@@ -379,6 +562,27 @@ void hips_iter_push_children(hips_iterator_t *iter, int order, int pix)
 }
 
 
+/*
+ * Return one of the twelve order zero slices of the allsky atlas,
+ * creating its texture (with a full mip chain, since the allsky is mostly
+ * sampled minified) if needed.
+ */
+static texture_t *hips_get_allsky_texture(hips_t *hips, int pix)
+{
+    int nbw, x, y;
+    if (!hips->allsky.data) return NULL;
+    if (!hips->allsky.textures[pix]) {
+        nbw = (int)sqrt(12 * (1 << (2 * hips->order_min)));
+        x = (pix % nbw) * hips->allsky.w / nbw;
+        y = (pix / nbw) * hips->allsky.w / nbw;
+        hips->allsky.textures[pix] = texture_from_data(
+                hips->allsky.data, hips->allsky.w, hips->allsky.h,
+                hips->allsky.bpp, x, y,
+                hips->allsky.w / nbw, hips->allsky.w / nbw, TF_MIPMAP);
+    }
+    return hips->allsky.textures[pix];
+}
+
 /*
  * Function: hips_get_tile_texture
  * Get the texture for a given hips tile.
@@ -410,7 +614,7 @@ texture_t *hips_get_tile_texture(
 {
     PROFILE(hips_get_tile_texture, PROFILE_AGGREGATE)
     bool loading_complete_;
-    int code, x, y, nbw;
+    int code;
     img_tile_t *tile = NULL;
     texture_t *tex;
 
@@ -428,33 +632,49 @@ texture_t *hips_get_tile_texture(
             *loading_complete = true;
     }
 
-    // Create texture if needed.
-    if (tile && tile->img && !tile->tex) {
-        tile->tex = texture_from_data(tile->img, tile->w, tile->h, tile->bpp,
-                                      0, 0, tile->w, tile->h, 0);
-        free(tile->img);
-        tile->img = NULL;
-    }
-    if (tile && tile->tex) {
-        *loading_complete = true;
-        return tile->tex;
+    // GPU tier: get the tile texture, recreating it from the decoded
+    // pixels if it got evicted.
+    // For tiles with a preview, the first upload only contains the
+    // low-frequency pass; we upgrade the texture in place on a later
+    // frame, so that a burst of incoming tiles doesn't stall the
+    // render thread on large uploads.
+    if (tile && tile->img) {
+        tile_key_t key = {hips->hash, order, pix};
+        tile_tex_t *ttex;
+        if (!g_tex_cache) g_tex_cache = cache_create("hips_tex", TEX_CACHE_SIZE);
+        ttex = cache_get(g_tex_cache, &key, sizeof(key));
+        if (!ttex) {
+            ttex = calloc(1, sizeof(*ttex));
+            ttex->birth = sys_get_unix_time();
+            if (tile->preview) {
+                ttex->tex = texture_from_data(tile->preview,
+                                        tile->pw, tile->ph, tile->bpp,
+                                        0, 0, tile->pw, tile->ph, 0);
+                cache_add(g_tex_cache, &key, sizeof(key), ttex,
+                          tile->pw * tile->ph * tile->bpp, del_tile_tex);
+            } else {
+                ttex->tex = texture_from_data(tile->img,
+                                        tile->w, tile->h, tile->bpp,
+                                        0, 0, tile->w, tile->h, 0);
+                cache_add(g_tex_cache, &key, sizeof(key), ttex,
+                          tile->w * tile->h * tile->bpp, del_tile_tex);
+            }
+        } else if (ttex->tex->w != tile->w) {
+            // Still showing the preview: upgrade to full resolution.
+            texture_set_data(ttex->tex, tile->img, tile->w, tile->h, tile->bpp);
+            cache_set_cost(g_tex_cache, &key, sizeof(key),
+                           tile->w * tile->h * tile->bpp);
+        }
+        *loading_complete = (ttex->tex->w == tile->w);
+        return ttex->tex;
     }
 
 
     // Return the allsky texture if the tile is not ready yet.  Only do
     // it for level 0 allsky for the moment.
     if (!tile && order == 0 && hips->allsky.data) {
-        if (!hips->allsky.textures[pix]) {
-            nbw = (int)sqrt(12 * (1 << (2 * hips->order_min)));
-            x = (pix % nbw) * hips->allsky.w / nbw;
-            y = (pix / nbw) * hips->allsky.w / nbw;
-            hips->allsky.textures[pix] = texture_from_data(
-                    hips->allsky.data, hips->allsky.w, hips->allsky.h,
-                    hips->allsky.bpp,
-                    x, y, hips->allsky.w / nbw, hips->allsky.w / nbw, 0);
-        }
         if (flags & HIPS_FORCE_USE_ALLSKY) *loading_complete = true;
-        return hips->allsky.textures[pix];
+        return hips_get_allsky_texture(hips, pix);
     }
 
     // If we didn't find the tile, or the texture is not loaded yet,
@@ -471,6 +691,21 @@ texture_t *hips_get_tile_texture(
 }
 
 
+/*
+ * Cross-order fade factor of a tile texture: 0 right when the texture
+ * first appears, 1 once BLEND_DURATION has passed, or if there is no
+ * texture (in which case there is nothing to blend anyway).
+ */
+static double tile_tex_fade(const hips_t *hips, int order, int pix)
+{
+    tile_tex_t *ttex;
+    tile_key_t key = {hips->hash, order, pix};
+    if (!g_tex_cache) return 1.0;
+    ttex = cache_get(g_tex_cache, &key, sizeof(key));
+    if (!ttex) return 1.0;
+    return clamp((sys_get_unix_time() - ttex->birth) / BLEND_DURATION, 0, 1);
+}
+
 static int render_visitor(hips_t *hips, const painter_t *painter_,
                           const double transf[4][4],
                           int order, int pix, int split, int flags,
@@ -479,13 +714,13 @@ static int render_visitor(hips_t *hips, const painter_t *painter_,
     int *nb_tot = USER_GET(user, 0);
     int *nb_loaded = USER_GET(user, 1);
     painter_t painter = *painter_;
-    texture_t *tex;
+    texture_t *tex, *ptex;
     uv_map_t map;
     bool loaded;
-    double fade;
+    double fade, blend;
     // UV transfo mat with swapped x and y.
     const double uv_swap[3][3] = {{0, 1, 0}, {1, 0, 0}, {0, 0, 1}};
-    double uv[3][3] = MAT3_IDENTITY;
+    double uv[3][3] = MAT3_IDENTITY, puv[3][3] = MAT3_IDENTITY;
 
     flags |= HIPS_LOAD_IN_THREAD;
     (*nb_tot)++;
@@ -493,11 +728,54 @@ static int render_visitor(hips_t *hips, const painter_t *painter_,
     mat3_mul(uv, uv_swap, uv);
     if (loaded) (*nb_loaded)++;
     if (!tex) return 0;
-    painter.color[3] *= fade;
-    painter_set_texture(&painter, PAINTER_TEX_COLOR, tex, uv);
+
     uv_map_init_healpix(&map, order, pix, false, true);
     if (transf)
         map.transf = (void*)transf;
+
+    // Cross-order blend: while a freshly arrived tile fades in, keep
+    // showing the parent order texture under it, so that crossing an
+    // order boundary refines smoothly instead of popping.  This also
+    // keeps the parent textures hot in the GPU cache while the new
+    // order streams in.
+    blend = tile_tex_fade(hips, order, pix);
+    if (blend < 1.0) {
+        core->frame_dirty = true; // Keep animating the fade.
+        ptex = NULL;
+        if (order > hips->order_min) {
+            ptex = hips_get_tile_texture(hips, order - 1, pix / 4, flags,
+                                         puv, NULL, NULL);
+        }
+        if (ptex) {
+            mat3_iscale(puv, 0.5, 0.5, 1.0);
+            mat3_itranslate(puv, (pix % 4) / 2, (pix % 4) % 2);
+            mat3_mul(puv, uv_swap, puv);
+        }
+        if (ptex && !(painter.flags &
+                      (PAINTER_PLANET_SHADER | PAINTER_RING_SHADER))) {
+            // Single pass: the shader samples the parent texture under
+            // the incoming one, so each screen region draws exactly
+            // once and additive surveys don't double up during the
+            // fade.
+            painter.tex_fallback.tex = ptex;
+            mat3_copy(puv, painter.tex_fallback.mat);
+            painter.tex_fallback.blend = blend;
+        } else if (ptex) {
+            // The planet shader has no fallback slot; planets are
+            // opaque and few quads, so drawing the parent under the
+            // tile is fine there.
+            painter.color[3] *= fade;
+            painter_set_texture(&painter, PAINTER_TEX_COLOR, ptex, puv);
+            paint_quad(&painter, hips->frame, &map, split);
+            painter = *painter_;
+            painter.color[3] *= blend;
+        } else {
+            painter.color[3] *= blend;
+        }
+    }
+
+    painter.color[3] *= fade;
+    painter_set_texture(&painter, PAINTER_TEX_COLOR, tex, uv);
     paint_quad(&painter, hips->frame, &map, split);
     return 0;
 }
@@ -537,6 +815,13 @@ void hips_set_label(hips_t *hips, const char* label)
     asprintf(&hips->label, "%s", label);
 }
 
+void hips_set_priority(hips_t *hips, int priority)
+{
+    assert(priority == 0 || priority == ASSET_PRIORITY_LOW ||
+           priority == ASSET_PRIORITY_HIGH);
+    hips->priority = priority;
+}
+
 static int load_allsky_worker(worker_t *worker)
 {
     typeof(((hips_t*)0)->allsky) *allsky = (void*)worker;
@@ -547,9 +832,57 @@ static int load_allsky_worker(worker_t *worker)
     return 0;
 }
 
+/*
+ * Fetch and parse the delta release manifest: a json file listing the
+ * [order, pix] of every tile patched since the base release.  Return
+ * false while the fetch is still pending.
+ */
+static bool load_delta_manifest(hips_t *hips)
+{
+    char url[URL_MAX_SIZE];
+    const char *data;
+    int i, size, code, order, pix;
+    json_value *json = NULL, *tiles, *v;
+    delta_tile_t *tile;
+
+    snprintf(url, sizeof(url), "%s/delta/manifest.json?v=%d",
+             hips->service_url, (int)hips->delta.release_date);
+    data = asset_get_data2(url, ASSET_USED_ONCE | ASSET_ACCEPT_404,
+                           &size, &code);
+    if (!code) return false; // Still loading.
+    if (data) json = json_parse(data, size);
+    tiles = json ? json_get_attr(json, "tiles", json_array) : NULL;
+    if (!tiles) {
+        LOG_W("Cannot get delta manifest '%s' (%d)", url, code);
+        hips->delta.not_available = true;
+    }
+    for (i = 0; tiles && i < tiles->u.array.length; i++) {
+        v = tiles->u.array.values[i];
+        if (v->type != json_array || v->u.array.length != 2) continue;
+        order = v->u.array.values[0]->u.integer;
+        pix = v->u.array.values[1]->u.integer;
+        tile = calloc(1, sizeof(*tile));
+        tile->pos[0] = order;
+        tile->pos[1] = pix;
+        HASH_ADD(hh, hips->delta.tiles, pos, sizeof(tile->pos), tile);
+    }
+    if (json) json_value_free(json);
+    hips->delta.ready = true;
+    return true;
+}
+
+static bool delta_has_tile(const hips_t *hips, int order, int pix)
+{
+    delta_tile_t *tile;
+    int pos[2] = {order, pix};
+    if (!hips->delta.tiles) return false;
+    HASH_FIND(hh, hips->delta.tiles, pos, sizeof(pos), tile);
+    return tile != NULL;
+}
+
 static bool hips_update(hips_t *hips)
 {
-    int code, err, size;
+    int i, code, err, size;
     char url[1024];
     char *data;
     if (hips->error) return false;
@@ -563,6 +896,12 @@ static bool hips_update(hips_t *hips)
         init_label(hips);
     }
 
+    // Get the delta manifest before serving any tile, so that a patched
+    // tile is never created from its stale base.
+    if (hips->delta.release_date && !hips->delta.ready) {
+        if (!load_delta_manifest(hips)) return false;
+    }
+
     // Get the allsky before anything else if available.
     // Only for level zero allsky images.  We don't use the other ones.
     if (!hips->allsky.worker.fn &&
@@ -571,7 +910,8 @@ static bool hips_update(hips_t *hips)
         snprintf(url, sizeof(url), "%s/Norder%d/Allsky.%s?v=%d",
                  hips->service_url, hips->order_min, hips->ext,
                  (int)hips->release_date);
-        data = asset_get_data2(url, ASSET_USED_ONCE, &size, &code);
+        data = asset_get_data2(url, ASSET_USED_ONCE | hips->priority,
+                               &size, &code);
         if (!code) return false;
         if (!data) hips->allsky.not_available = true;
         if (data) {
@@ -589,6 +929,12 @@ static bool hips_update(hips_t *hips)
         hips_delete(hips); // Release ref from worker.
         if (!hips->allsky.data) hips->allsky.not_available = true;
         hips->allsky.worker.fn = NULL;
+        // Build the whole mipmapped atlas right away so that the initial
+        // view doesn't create the slices one by one while rendering.
+        if (hips->allsky.data && hips->order_min == 0) {
+            for (i = 0; i < 12; i++)
+                hips_get_allsky_texture(hips, i);
+        }
     }
 
     return true;
@@ -599,8 +945,10 @@ bool hips_is_ready(hips_t *hips)
     return hips_update(hips);
 }
 
-int hips_get_render_order(const hips_t *hips, const painter_t *painter,
-                          double angle)
+// Fractional render order, before rounding.
+static double hips_get_render_order_f(const hips_t *hips,
+                                      const painter_t *painter,
+                                      double angle)
 {
     double pix_per_rad;
     double w, px; // Size in pixel of the total survey.
@@ -609,7 +957,93 @@ int hips_get_render_order(const hips_t *hips, const painter_t *painter,
     pix_per_rad = painter->fb_size[0] / atan(painter->proj->scaling[0]) / 2;
     px = pix_per_rad * angle;
     w = hips->tile_width ?: 256;
-    return round(log2(px / (4.0 * sqrt(2.0) * w)));
+    // The quality governor trades resolution for frame time by lowering
+    // the order: one full order (4x fewer pixels) at quality 0.5.
+    return log2(px / (4.0 * sqrt(2.0) * w)) - 2.0 * (1.0 - core->quality);
+}
+
+int hips_get_render_order(const hips_t *hips, const painter_t *painter,
+                          double angle)
+{
+    return round(hips_get_render_order_f(hips, painter, angle));
+}
+
+// Maximum number of speculative neighbour tiles we start loading per
+// traversal.
+#define PREFETCH_MAX 8
+
+static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
+                              int *code);
+
+/*
+ * Type: render_candidate_t
+ * A tile of the visible set of a traversal, collected so that tiles can
+ * be processed (and thus their fetches started) center-of-view first,
+ * matching visual importance instead of traversal order.
+ */
+typedef struct {
+    int     pix;
+    double  dist; // Cosine distance from the view center (higher = closer).
+} render_candidate_t;
+
+static int render_candidate_cmp(const void *a, const void *b)
+{
+    return cmp(((const render_candidate_t*)b)->dist,
+               ((const render_candidate_t*)a)->dist);
+}
+
+/*
+ * Once the visible set of a traversal is known, start loading the HEALPix
+ * neighbours of the visible pixels at the rendered order with the threaded
+ * loader, so that a slow pan finds its newly exposed ring of tiles already
+ * decoded instead of stalling on the network.
+ */
+static void prefetch_neighbours(hips_t *hips, const render_candidate_t *pixs,
+                                int nb, int order)
+{
+    int i, j, k, code, nb_prefetch = 0;
+    int neighbours[8];
+
+    for (i = 0; i < nb && nb_prefetch < PREFETCH_MAX; i++) {
+        healpix_get_neighbours(1 << order, pixs[i].pix, neighbours);
+        for (j = 0; j < 8 && nb_prefetch < PREFETCH_MAX; j++) {
+            if (neighbours[j] < 0) continue;
+            for (k = 0; k < nb; k++)
+                if (pixs[k].pix == neighbours[j]) break;
+            if (k < nb) continue; // Already part of the visible set.
+            if (hips_get_tile_(hips, order, neighbours[j],
+                               HIPS_CACHED_ONLY, &code))
+                continue; // Already in cache.
+            hips_get_tile_(hips, order, neighbours[j],
+                           HIPS_LOAD_IN_THREAD, &code);
+            nb_prefetch++;
+        }
+    }
+}
+
+/*
+ * When the view is zooming toward a planet survey, warm the next order
+ * for the hemisphere facing the observer so that the surface sharpens
+ * on arrival instead of after it.  The candidates are already sorted
+ * center of view first, so the prefetch naturally starts with the tiles
+ * the zoom is heading to.
+ */
+static void prefetch_next_order(hips_t *hips, const render_candidate_t *pixs,
+                                int nb, int order)
+{
+    int i, j, code, nb_prefetch = 0;
+
+    if (order + 1 > hips->order) return;
+    for (i = 0; i < nb && nb_prefetch < PREFETCH_MAX; i++) {
+        for (j = 0; j < 4 && nb_prefetch < PREFETCH_MAX; j++) {
+            if (hips_get_tile_(hips, order + 1, pixs[i].pix * 4 + j,
+                               HIPS_CACHED_ONLY, &code))
+                continue; // Already in cache.
+            hips_get_tile_(hips, order + 1, pixs[i].pix * 4 + j,
+                           HIPS_LOAD_IN_THREAD, &code);
+            nb_prefetch++;
+        }
+    }
 }
 
 // Similar to hips_render, but instead of actually rendering the tiles
@@ -623,14 +1057,31 @@ int hips_render_traverse(
                         const double transf[4][4],
                         int order, int pix, int split, int flags, void *user))
 {
-    int render_order, order, pix, split;
+    int i, render_order, order, pix, split;
     int flags = 0;
+    double order_f;
+    render_candidate_t visible[256];
+    int nb_visible = 0;
+    double tile_dir[3];
+    const double *view_dir;
     hips_iterator_t iter;
     bool outside = true;
     uv_map_t map;
 
     hips_update(hips);
-    render_order = hips_get_render_order(hips, painter, angle);
+    view_dir = painter->clip_info[hips->frame].bounding_cap;
+    order_f = hips_get_render_order_f(hips, painter, angle);
+    render_order = round(order_f);
+
+    // Hysteresis on the order selection: near the rounding boundary,
+    // keep the order of the previous traversal, so that small FOV
+    // oscillations don't alternate between two orders and reload both.
+    if (hips->last_render_order >= 0 &&
+            render_order != hips->last_render_order &&
+            fabs(order_f - hips->last_render_order) <
+                0.5 + ORDER_HYSTERESIS) {
+        render_order = hips->last_render_order;
+    }
     if (angle < 2.0 * M_PI) {
         flags |= HIPS_PLANET;
         outside = false;
@@ -645,6 +1096,7 @@ int hips_render_traverse(
     // Clamp the render order into physically possible range.
     render_order = clamp(render_order, hips->order_min, hips->order);
     render_order = min(render_order, 9); // Hard limit.
+    hips->last_render_order = render_order;
 
     // Can't split less than the rendering order.
     split_order = max(split_order, render_order);
@@ -662,8 +1114,35 @@ int hips_render_traverse(
             continue;
         }
         split = 1 << (split_order - render_order);
-        callback(hips, painter, transf, order, pix, split, flags, user);
+        if (nb_visible < ARRAY_SIZE(visible)) {
+            healpix_pix2vec(1 << order, pix, tile_dir);
+            visible[nb_visible].pix = pix;
+            visible[nb_visible].dist = vec3_dot(view_dir, tile_dir);
+            nb_visible++;
+        } else {
+            // Overflow (shouldn't happen): process immediately.
+            callback(hips, painter, transf, order, pix, split, flags, user);
+        }
+    }
+
+    // Process the visible set center-of-view first.
+    qsort(visible, nb_visible, sizeof(*visible), render_candidate_cmp);
+    split = 1 << (split_order - render_order);
+    for (i = 0; i < nb_visible; i++) {
+        callback(hips, painter, transf, render_order, visible[i].pix, split,
+                 flags, user);
     }
+
+    // Speculatively load the neighbour ring of the visible set.
+    if (outside && !(flags & HIPS_FORCE_USE_ALLSKY))
+        prefetch_neighbours(hips, visible, nb_visible, render_order);
+
+    // On a planet survey, if the apparent size is growing (zoom in) and
+    // we are within half an order of switching, warm the next order.
+    if (!outside && order_f > hips->last_order_f + 1e-3 &&
+            order_f > render_order)
+        prefetch_next_order(hips, visible, nb_visible, render_order);
+    hips->last_order_f = order_f;
     return 0;
 }
 
@@ -724,11 +1203,49 @@ static int load_tile_worker(worker_t *worker)
     return 0;
 }
 
+/*
+ * Update the fetch tracking of a tile probe: account a miss the first
+ * time a tile turns out not to be available locally, and fill the
+ * latency histogram once the fetch resolves.
+ */
+static void stats_on_fetch(hips_t *hips, int order, int pix, int code)
+{
+    fetch_t *fetch;
+    int pos[2] = {order, pix};
+    int bucket;
+    double ms;
+
+    HASH_FIND(hh, hips->fetches, pos, sizeof(pos), fetch);
+    if (code == 0) { // Still loading.
+        if (!fetch) {
+            fetch = calloc(1, sizeof(*fetch));
+            memcpy(fetch->pos, pos, sizeof(pos));
+            fetch->start = sys_get_unix_time();
+            HASH_ADD(hh, hips->fetches, pos, sizeof(fetch->pos), fetch);
+            hips->stats.misses++;
+        }
+        return;
+    }
+    ms = 0;
+    if (fetch) {
+        ms = (sys_get_unix_time() - fetch->start) * 1000;
+        HASH_DEL(hips->fetches, fetch);
+        free(fetch);
+    } else {
+        hips->stats.misses++; // Resolved on the first probe.
+    }
+    for (bucket = 0; bucket < LATENCY_NB - 1; bucket++)
+        if (ms < 16 << bucket) break;
+    hips->stats.latency[bucket]++;
+}
+
 static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
                               int *code)
 {
-    const void *data;
+    const void *data, *delta_data;
     int size, parent_code, asset_flags, cost = 0, transparency = 0;
+    int delta_size, delta_code, merged_size;
+    void *merged = NULL;
     char url[URL_MAX_SIZE];
     tile_t *tile, *parent;
     tile_key_t key = {hips->hash, order, pix};
@@ -736,17 +1253,21 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
     assert(order >= 0);
     *code = 0;
 
-    if (!g_cache) g_cache = cache_create(CACHE_SIZE);
+    if (!g_cache) g_cache = cache_create("hips_tiles", CACHE_SIZE);
     tile = cache_get(g_cache, &key, sizeof(key));
 
     // Got a tile but it is still loading.
     if (tile && tile->loader) {
         if (!worker_iter(&tile->loader->worker)) return NULL;
         cache_set_cost(g_cache, &key, sizeof(key), tile->loader->cost);
+        hips->stats.bytes += tile->loader->cost - tile->cost;
+        tile->cost = tile->loader->cost;
         free(tile->loader);
         tile->loader = NULL;
+        occupancy_add_tile(hips, tile);
     }
     if (tile) {
+        hips->stats.hits++;
         *code = 200;
         return tile;
     }
@@ -759,6 +1280,13 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
         return NULL;
     }
 
+    // Skip branches that the occupancy tree knows are empty, without
+    // any request.
+    if (occupancy_is_empty(hips, order, pix)) {
+        *code = 404;
+        return NULL;
+    }
+
     // Skip if we already know that this tile doesn't exists.
     if (order > hips->order_min) {
         parent = hips_get_tile_(hips, order - 1, pix / 4, flags, &parent_code);
@@ -773,14 +1301,16 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
     }
     get_url_for(hips, url, "Norder%d/Dir%d/Npix%d.%s",
                 order, (pix / 10000) * 10000, pix, hips->ext);
-    asset_flags = ASSET_ACCEPT_404;
+    asset_flags = ASSET_ACCEPT_404 | hips->priority;
     if (order > 0) asset_flags |= ASSET_DELAY;
     data = asset_get_data2(url, asset_flags, &size, code);
+    stats_on_fetch(hips, order, pix, *code);
     if (!(*code)) return NULL; // Still loading the file.
 
-    // If the tile doesn't exists, mark it in the parent tile so that we
-    // won't have to search for it again.
+    // If the tile doesn't exists, mark it in the parent tile and in the
+    // occupancy tree so that we won't have to search for it again.
     if ((*code) / 100 == 4) {
+        occupancy_set_empty(hips, order, pix);
         if (order > hips->order_min) {
             parent = hips_get_tile_(hips, order - 1, pix / 4, flags,
                                     &parent_code);
@@ -795,6 +1325,34 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
         return NULL;
     }
 
+    // If this tile was patched by a delta release, merge the delta file
+    // over the base tile before decoding it.
+    if (delta_has_tile(hips, order, pix)) {
+        snprintf(url, sizeof(url), "%s/delta/Norder%d/Dir%d/Npix%d.%s?v=%d",
+                 hips->service_url, order, (pix / 10000) * 10000, pix,
+                 hips->ext, (int)hips->delta.release_date);
+        delta_data = asset_get_data2(url, asset_flags, &delta_size,
+                                     &delta_code);
+        if (!delta_code) {
+            *code = 0;
+            return NULL; // Still loading the delta file.
+        }
+        if (delta_data) {
+            merged = eph_merge_delta(data, size, delta_data, delta_size,
+                                     &merged_size);
+            asset_release(url);
+        }
+        if (merged) {
+            data = merged;
+            size = merged_size;
+        } else {
+            LOG_W("Cannot apply delta tile '%s'", url);
+        }
+        // Restore the base url for the error reports below.
+        get_url_for(hips, url, "Norder%d/Dir%d/Npix%d.%s",
+                    order, (pix / 10000) * 10000, pix, hips->ext);
+    }
+
     assert(hips->settings.create_tile);
 
     tile = calloc(1, sizeof(*tile));
@@ -802,19 +1360,26 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
     tile->pos.pix = pix;
     tile->hips = hips;
     hips->ref++;
+    tile->cost = sizeof(*tile) + cost;
     cache_add(g_cache, &key, sizeof(key), tile, sizeof(*tile) + cost,
               del_tile);
+    hips->stats.tiles++;
+    hips->stats.bytes += tile->cost;
 
     if (!(flags & HIPS_LOAD_IN_THREAD)) {
         tile->data = hips->settings.create_tile(
                 hips->settings.user, order, pix, data, size,
                 &cost, &transparency);
+        hips->stats.bytes += cost;
+        tile->cost += cost;
         tile->flags |= (transparency * TILE_NO_CHILD_0);
+        occupancy_add_tile(hips, tile);
         if (!tile->data) {
             LOG_W("Cannot parse tile %s", url);
             tile->flags |= TILE_LOAD_ERROR;
         }
         asset_release(url);
+        free(merged);
     } else {
         tile->loader = calloc(1, sizeof(*tile->loader));
         worker_init(&tile->loader->worker, load_tile_worker);
@@ -823,6 +1388,7 @@ static tile_t *hips_get_tile_(hips_t *hips, int order, int pix, int flags,
         tile->loader->tile = tile;
         memcpy(tile->loader->data, data, size);
         asset_release(url);
+        free(merged);
         *code = 0;
         return NULL;
     }
@@ -840,17 +1406,41 @@ const void *hips_get_tile(hips_t *hips, int order, int pix, int flags,
 /*
  * Default tile support for images surveys
  */
+/*
+ * Compute the low-frequency preview of a decoded tile: a simple box
+ * average of the image by an integer factor.  Runs in the loading
+ * worker, so the cost doesn't impact the render thread.
+ */
+static void *make_preview(const uint8_t *img, int w, int h, int bpp,
+                          int f, int pw, int ph)
+{
+    uint8_t *out;
+    int x, y, i, j, k, acc;
+
+    out = mem_alloc(MEM_TAG_HIPS, pw * ph * bpp);
+    for (y = 0; y < ph; y++)
+    for (x = 0; x < pw; x++)
+    for (k = 0; k < bpp; k++) {
+        acc = 0;
+        for (j = 0; j < f; j++)
+        for (i = 0; i < f; i++)
+            acc += img[((y * f + j) * w + x * f + i) * bpp + k];
+        out[(y * pw + x) * bpp + k] = acc / (f * f);
+    }
+    return out;
+}
+
 static const void *create_img_tile(
         void *user, int order, int pix, void *data, int size,
         int *cost, int *transparency)
 {
     void *img;
-    int i, w, h, bpp = 0;
+    int i, f, w, h, bpp = 0;
     img_tile_t *tile;
 
     // Special case for allsky tiles!  Just return an empty image tile.
     if (order == -1) {
-        tile = calloc(1, sizeof(*tile));
+        tile = mem_calloc(MEM_TAG_HIPS, 1, sizeof(*tile));
         return tile;
     }
 
@@ -859,11 +1449,19 @@ static const void *create_img_tile(
         LOG_W("Cannot parse img");
         return NULL;
     }
-    tile = calloc(1, sizeof(*tile));
+    tile = mem_calloc(MEM_TAG_HIPS, 1, sizeof(*tile));
     tile->img = img;
     tile->w = w;
     tile->h = h;
     tile->bpp = bpp;
+    // Large tiles also get a low-frequency preview, uploaded first by
+    // the GPU tier.
+    if (w > 2 * PREVIEW_SIZE && h > 2 * PREVIEW_SIZE) {
+        f = w / PREVIEW_SIZE;
+        tile->pw = w / f;
+        tile->ph = h / f;
+        tile->preview = make_preview(img, w, h, bpp, f, tile->pw, tile->ph);
+    }
     // Compute transparency.
     for (i = 0; i < 4; i++) {
         if (img_is_transparent(img, w, h, bpp,
@@ -871,15 +1469,16 @@ static const void *create_img_tile(
                 *transparency |= 1 << i;
         }
     }
-    *cost = w * h * bpp;
+    *cost = w * h * bpp + tile->pw * tile->ph * bpp;
     return tile;
 }
 
 static int delete_img_tile(void *tile_)
 {
     img_tile_t *tile = tile_;
-    texture_release(tile->tex);
-    free(tile);
+    free(tile->img); // From img_read_from_mem: not tracked.
+    mem_free(tile->preview);
+    mem_free(tile);
     return 0;
 }
 
@@ -902,3 +1501,28 @@ double hips_parse_date(const char *str)
     eraDtf2d("UTC", iy, im, id, ihr, imn, 0, &d1, &d2);
     return d1 - DJM0 + d2;
 }
+
+json_value *hips_stats_report(void)
+{
+    json_value *ret, *val, *lat;
+    hips_t *hips;
+    int i;
+
+    ret = json_array_new(0);
+    DL_FOREACH(g_surveys, hips) {
+        val = json_object_new(0);
+        json_object_push(val, "url", json_string_new(hips->url));
+        json_object_push(val, "tiles", json_integer_new(hips->stats.tiles));
+        json_object_push(val, "bytes", json_integer_new(hips->stats.bytes));
+        json_object_push(val, "hits", json_integer_new(hips->stats.hits));
+        json_object_push(val, "misses", json_integer_new(hips->stats.misses));
+        json_object_push(val, "in_flight",
+                         json_integer_new(HASH_COUNT(hips->fetches)));
+        lat = json_array_new(LATENCY_NB);
+        for (i = 0; i < LATENCY_NB; i++)
+            json_array_push(lat, json_integer_new(hips->stats.latency[i]));
+        json_object_push(val, "latency", lat);
+        json_array_push(ret, val);
+    }
+    return ret;
+}
@@ -239,6 +239,21 @@ void hips_set_frame(hips_t *hips, int frame);
  */
 void hips_set_label(hips_t *hips, const char* label);
 
+/*
+ * Function: hips_set_priority
+ * Set the download priority class of a survey.
+ *
+ * This is enforced by the download manager lanes: pending requests of a
+ * higher class always start first when a transfer slot is free, so
+ * background imagery surveys can be kept from delaying catalog tiles.
+ *
+ * Parameters:
+ *   hips     - A hips survey.
+ *   priority - ASSET_PRIORITY_LOW, ASSET_PRIORITY_HIGH, or 0 for the
+ *              default (normal) class.
+ */
+void hips_set_priority(hips_t *hips, int priority);
+
 /*
  * Function: hips_get_render_order
  * Return the max order at which a survey will be rendered.
@@ -297,4 +312,23 @@ int hips_render_traverse(hips_t *hips, const painter_t *painter,
  */
 double hips_parse_date(const char *str);
 
+/*
+ * Function: hips_stats_report
+ * Return the instrumentation counters of all the alive surveys, as a
+ * json array with one object per survey:
+ *
+ *   url       - Root url of the survey.
+ *   tiles     - Number of tiles currently in cache.
+ *   bytes     - Resident bytes of those tiles.
+ *   hits      - Total number of tile cache hits.
+ *   misses    - Total number of tile fetches.
+ *   in_flight - Number of tile fetches currently pending.
+ *   latency   - Fetch latency histogram: number of fetches resolved in
+ *               less than 16ms, 32ms, 64ms... the last bucket counting
+ *               everything slower.
+ *
+ * The caller owns the returned value.
+ */
+json_value *hips_stats_report(void);
+
 #endif // HIPS_H
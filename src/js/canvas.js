@@ -10,22 +10,64 @@
 Module.afterInit(function() {
   if (!Module.canvas) return;
 
+  // Detect whether we run on the page or in a worker with an
+  // OffscreenCanvas (html/static/js/worker.js).  In a worker there is no
+  // DOM: the page posts us the canvas size and the input events instead.
+  var inWorker = typeof window === 'undefined';
+  var global = inWorker ? self : window;
+
   var prevTimestamp;
 
+  // Power saving pacing: when the engine reports that it won't need a
+  // frame for a while (static scene, settled faders, no download), the
+  // loop drops to the reported cadence instead of the display rate, so a
+  // paused sky leaves the GPU idle.  Input events (and Module.wake, for
+  // embedders that change attributes outside of the engine APIs) wake
+  // the loop up immediately.
+  var idleTimer = null;
+  var schedule = function() {
+    var delay = Module._core_next_frame_delay();
+    if (delay > 0) {
+      idleTimer = setTimeout(function() {
+        idleTimer = null;
+        prevTimestamp = undefined; // Don't count the sleep in dt.
+        global.requestAnimationFrame(render);
+      }, delay * 1000);
+    } else {
+      global.requestAnimationFrame(render);
+    }
+  };
+  var wake = Module.wake = function() {
+    if (idleTimer === null) return; // A frame is already scheduled.
+    clearTimeout(idleTimer);
+    idleTimer = null;
+    prevTimestamp = undefined;
+    global.requestAnimationFrame(render);
+  };
+
   // Function called at each frame
   var render = function(timestamp) {
 
     // Check for canvas resize
     var canvas = Module.canvas;
-
-    // Get the device pixel ratio, falling back to 1.
-    var dpr = window.devicePixelRatio || 1;
-
-    // Get the size of the canvas in CSS pixels.
-    var rect = canvas.getBoundingClientRect();
-
-    var displayWidth  = rect.width;
-    var displayHeight = rect.height;
+    var dpr, displayWidth, displayHeight, rect;
+
+    if (!inWorker) {
+      // Get the device pixel ratio, falling back to 1.
+      dpr = window.devicePixelRatio || 1;
+      // Get the size of the canvas in CSS pixels.
+      rect = canvas.getBoundingClientRect();
+      displayWidth  = rect.width;
+      displayHeight = rect.height;
+    } else {
+      // An OffscreenCanvas has no layout: the owning page posts us its
+      // CSS size and pixel ratio on resize (Module.canvasSize).
+      dpr = (Module.canvasSize && Module.canvasSize.dpr) || 1;
+      displayWidth = (Module.canvasSize && Module.canvasSize.width) ||
+                     canvas.width;
+      displayHeight = (Module.canvasSize && Module.canvasSize.height) ||
+                      canvas.height;
+    }
     var sizeChanged = (canvas.width  !== displayWidth) ||
                       (canvas.height !== displayHeight);
 
@@ -51,7 +93,7 @@ Module.afterInit(function() {
     Module._core_update(dt / 1000);
     Module._core_render(displayWidth, displayHeight, dpr);
 
-    window.requestAnimationFrame(render)
+    schedule();
   }
 
   var fixPageXY = function(e) {
@@ -80,6 +122,7 @@ Module.afterInit(function() {
       var that = this;
       e = e || event;
       fixPageXY(e);
+      wake();
       mouseDown = true;
       var pos = getMousePos(e);
       Module._core_on_mouse(0, 1, pos.x, pos.y);
@@ -98,12 +141,14 @@ Module.afterInit(function() {
       document.onmousemove = function(e) {
         e = e || event;
         fixPageXY(e);
+        wake();
         var pos = getMousePos(e);
         Module._core_on_mouse(0, mouseDown ? 1 : 0, pos.x, pos.y);
       }
     });
 
     canvas.addEventListener('touchstart', function(e) {
+      wake();
       var rect = canvas.getBoundingClientRect();
       for (var i = 0; i < e.changedTouches.length; i++) {
         var id = e.changedTouches[i].identifier;
@@ -114,6 +159,7 @@ Module.afterInit(function() {
     }, {passive: true});
     canvas.addEventListener('touchmove', function(e) {
       e.preventDefault();
+      wake();
       var rect = canvas.getBoundingClientRect();
       for (var i = 0; i < e.changedTouches.length; i++) {
         var id = e.changedTouches[i].identifier;
@@ -150,6 +196,7 @@ Module.afterInit(function() {
     var onWheelEvent = function(e) {
       e.preventDefault();
       fixPageXY(e);
+      wake();
       var pos = getMousePos(e);
       var zoom_factor = 1.05;
       var delta = getMouseWheelDelta(e) * 2;
@@ -160,8 +207,10 @@ Module.afterInit(function() {
     canvas.addEventListener('DOMMouseScroll', onWheelEvent, {passive: false});
   };
 
-  setupMouse();
+  // In a worker the input events are forwarded as messages by the page
+  // and injected by the worker harness: no DOM listeners to install.
+  if (!inWorker) setupMouse();
 
   // Kickoff rendering at max FPS, normally 60 FPS on a browser.
-  window.requestAnimationFrame(render)
+  global.requestAnimationFrame(render)
 })
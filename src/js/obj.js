@@ -391,6 +391,46 @@ Module.afterInit(function() {
     obj[attr] = value;
   }
 
+  // Batched attribute snapshot: register the attributes once, then read
+  // them each frame from a shared buffer, without a boundary crossing
+  // and json conversion per attribute.  Only works for numeric member
+  // backed attributes; snapshot returns null for the others, so callers
+  // can fall back to the normal path.
+  //
+  //   var fov = Module.snapshot(Module.core, 'fov');
+  //   ...
+  //   v = fov.get();       // Plain number (or array for vec attributes).
+  //   if (fov.changed()) ...  // Since the last call to changed().
+  var obj_snapshot_register = Module.cwrap('obj_snapshot_register',
+    'number', ['number', 'string']);
+  var SNAPSHOT_SLOT = 5;
+
+  Module['snapshot'] = function(obj, attr) {
+    var slot = obj_snapshot_register(obj.v, attr);
+    if (slot < 0) return null;
+    var dim = Module._obj_snapshot_dim(slot);
+    var gen = -1;
+    var base = function() {
+      // The buffer can move when a new attribute is registered, and
+      // HEAPF64 when the wasm memory grows: resolve at each access.
+      return Module._obj_snapshot_buffer() / 8 + slot * SNAPSHOT_SLOT;
+    };
+    return {
+      get: function() {
+        var b = base();
+        if (dim === 1) return Module.HEAPF64[b + 1];
+        return Array.prototype.slice.call(
+          Module.HEAPF64.subarray(b + 1, b + 1 + dim));
+      },
+      changed: function() {
+        var g = Module.HEAPF64[base()];
+        if (g === gen) return false;
+        gen = g;
+        return true;
+      }
+    };
+  }
+
   Module['onValueChanged'] = function(callback) {
     Module.change(function(obj, attr) {
       var path = obj.path + "." + attr;
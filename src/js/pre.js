@@ -9,7 +9,8 @@
 
 // Allow to set the memory file path in 'memFile' argument.
 Module['locateFile'] = function(path) {
-  if (path === "stellarium-web-engine.wasm") return Module.wasmFile;
+  // Match any wasm name, so the simd and -nosimd variants both work.
+  if (path.slice(-5) === ".wasm" && Module.wasmFile) return Module.wasmFile;
   return path;
 }
 
@@ -432,6 +433,11 @@ Module['on'] = function(eventName, callback) {
  * Function: setFont
  * Load a font from a url and add it into the engine.
  *
+ * The fetch doesn't block the engine: the first frames are painted with
+ * the small built-in subset font, and the labels are automatically
+ * re-shaped when the full font arrives.  The subset font stays
+ * registered as glyph level fallback.
+ *
  * If we add several fonts to the same face ('regular' or 'bold'), the
  * former are used as fallback.
  *
@@ -14,8 +14,8 @@
 #include <float.h>
 #include <stdlib.h>
 
-static void line_get_normal(const double (*line)[3], int size, int i,
-                            double n[2])
+void line_get_normal(const double (*line)[3], int size, int i,
+                     double n[2])
 {
     double seg_before[2] = {}, seg_after[2] = {}, seg[2];
     int nb_segs = 0;
@@ -38,49 +38,6 @@ static void line_get_normal(const double (*line)[3], int size, int i,
         vec2_normalize(n, n);
 }
 
-line_mesh_t *line_to_mesh(const double (*line)[3], int size, double width)
-{
-    int i, k;
-    double n[2], v[2], length = 0;
-    line_mesh_t *mesh = calloc(1, sizeof(*mesh));
-
-    assert(size >= 2);
-
-    mesh->verts_count = size * 2;
-    mesh->verts = calloc(mesh->verts_count, sizeof(*mesh->verts));
-    mesh->indices_count = 6 * (size - 1);
-    mesh->indices = calloc(mesh->indices_count, sizeof(*mesh->indices));
-
-    // Compute all vertices.
-    for (i = 0; i < size; i++) {
-        if (i > 0) length += vec2_dist(line[i - 1], line[i]);
-        line_get_normal(line, size, i, n);
-        vec2_addk(line[i], n, -width / 2, v);
-        vec2_to_float(v, mesh->verts[i * 2 + 0].pos);
-        vec2_addk(line[i], n, width / 2, v);
-        vec2_to_float(v, mesh->verts[i * 2 + 1].pos);
-        mesh->verts[i * 2 + 0].pos[2] = line[i][2];
-        mesh->verts[i * 2 + 1].pos[2] = line[i][2];
-        vec2_set(mesh->verts[i * 2 + 0].uv, length, -width / 2);
-        vec2_set(mesh->verts[i * 2 + 1].uv, length, +width / 2);
-    }
-    // Compute all indices.
-    for (i = 0; i < size - 1; i++) {
-        for (k = 0; k < 6; k++) {
-            mesh->indices[i * 6 + k] = (int[]){0, 1, 2, 3, 2, 1}[k] + i * 2;
-        }
-    }
-
-    return mesh;
-}
-
-void line_mesh_delete(line_mesh_t *mesh)
-{
-    free(mesh->indices);
-    free(mesh->verts);
-    free(mesh);
-}
-
 static double line_point_dist(const double a[2], const double b[2],
                                const double p[2])
 {
@@ -17,45 +17,25 @@
 /*
  * File: line.h
  *
- * Some util functions to convert a line into a quad, for better opengl
- * rendering.
+ * Some util functions to tesselate a line and extrude it into a quad
+ * strip, for better opengl rendering.
  */
 
 /*
- * Struct: line_mesh_t
- * Contains the vertices and indices of a line mesh.
- */
-typedef struct line_mesh
-{
-    struct {
-        float pos[3];
-        float uv[2];
-    } *verts;
-    uint16_t *indices;
-    int indices_count;
-    int verts_count;
-} line_mesh_t;
-
-/*
- * Function: line_to_mesh
- * Convert a line with a width into a quad mesh.
+ * Function: line_get_normal
+ * Compute the 2d normal of a line at a given point index.
+ *
+ * This is the miter direction used to extrude the line into a quad
+ * strip (the renderer writes the extruded vertices directly into its
+ * buffers, the antialiasing being done in the fragment shader).
  *
  * Parameters:
- *   line   - Array of 2d coordinates.
+ *   line   - Array of 2d coordinates (the z is ignored).
  *   size   - Number of points in the line array.
- *   width  - width of the line.
- *
- * Return:
- *   A new <line_mesh_t> instance, that should be released with
- *   <line_mesh_delete>.
- */
-line_mesh_t *line_to_mesh(const double (*line)[3], int size, double width);
-
-/*
- * Function: line_mesh_delete
- * Delete a line mesh.
+ *   i      - Index of the point.
+ *   n      - Output normal (normalized).
  */
-void line_mesh_delete(line_mesh_t *mesh);
+void line_get_normal(const double (*line)[3], int size, int i, double n[2]);
 
 /*
  * Function: line_tesselate
@@ -44,4 +44,15 @@ enum {
 void dolog(int level, const char *msg,
            const char *func, const char *file, int line, ...);
 
+/*
+ * Function: log_flush
+ * Emit the pending log messages to the system sink.
+ *
+ * The LOG_X macros only queue the formatted message into a ring, with
+ * per-site rate limiting; the core calls this once per frame.  Also
+ * registered with atexit so that short lived binaries don't lose their
+ * output.
+ */
+void log_flush(void);
+
 #endif // LOG_H
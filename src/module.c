@@ -9,14 +9,419 @@
 
 #include "swe.h"
 
+#include <ctype.h>
+
 static void (*g_listener)(obj_t *module, const char *attr) = NULL;
 
+/*
+ * Registry of the attached children with an id, so that obj_get and
+ * module_get_child resolve a path component with a single hash lookup
+ * instead of walking the children list.  The key is the parent pointer
+ * plus the lower cased id (the lookups are case insensitive).
+ */
+typedef struct path_entry {
+    UT_hash_handle  hh;
+    char            *key;
+    obj_t           *child;
+} path_entry_t;
+
+static path_entry_t *g_paths = NULL;
+
+static const char *path_key(const obj_t *parent, const char *id,
+                            char *buf, int size)
+{
+    int i, n;
+    n = snprintf(buf, size, "%p/%s", (void*)parent, id);
+    if (n >= size) return NULL; // Too long: not registered.
+    for (i = 0; buf[i]; i++) buf[i] = tolower(buf[i]);
+    return buf;
+}
+
+static void path_registry_add(const obj_t *parent, obj_t *child)
+{
+    char buf[256];
+    path_entry_t *e;
+
+    if (!child->id || !path_key(parent, child->id, buf, sizeof(buf)))
+        return;
+    HASH_FIND_STR(g_paths, buf, e);
+    if (e) return; // Duplicated id: keep the first attached child.
+    e = calloc(1, sizeof(*e));
+    e->key = strdup(buf);
+    e->child = child;
+    HASH_ADD_KEYPTR(hh, g_paths, e->key, strlen(e->key), e);
+}
+
+static void path_registry_remove(const obj_t *parent, const obj_t *child)
+{
+    char buf[256];
+    path_entry_t *e;
+    obj_t *other;
+
+    if (!child->id || !path_key(parent, child->id, buf, sizeof(buf)))
+        return;
+    HASH_FIND_STR(g_paths, buf, e);
+    if (!e || e->child != child) return;
+    HASH_DELETE(hh, g_paths, e);
+    free(e->key);
+    free(e);
+    // Re-register a sibling with the same id if any.
+    DL_FOREACH(parent->children, other) {
+        if (other == child || !other->id) continue;
+        if (strcasecmp(other->id, child->id) == 0) {
+            path_registry_add(parent, other);
+            break;
+        }
+    }
+}
+
+static obj_t *path_registry_get(const obj_t *parent, const char *id)
+{
+    char buf[256];
+    path_entry_t *e;
+
+    if (!path_key(parent, id, buf, sizeof(buf))) return NULL;
+    HASH_FIND_STR(g_paths, buf, e);
+    return e ? e->child : NULL;
+}
+
+/*
+ * Always-on performance counters, accumulated by the module_update and
+ * module_render wrappers and reported as json by module_perf_report.
+ * Remotery stays the tool for deep dives; these are cheap enough (one
+ * clock read around each call) to scrape from production builds.
+ */
+typedef struct perf_counter {
+    UT_hash_handle  hh;
+    void            *key;           // The module pointer.
+    const char      *id;            // The module id (owned by the module).
+    int64_t         update_us;      // Total time spent in update calls.
+    int64_t         update_calls;
+    int64_t         render_us;      // Total time spent in render calls.
+    int64_t         render_calls;
+    // Values at the last module_perf_frame call, to compute the per
+    // frame deltas for the trace ring.
+    int64_t         frame_update_us;
+    int64_t         frame_render_us;
+} perf_counter_t;
+
+static perf_counter_t *g_perf_counters = NULL;
+
+static void perf_counter_add(const obj_t *module, bool render, double cost)
+{
+    perf_counter_t *c;
+    HASH_FIND_PTR(g_perf_counters, &module, c);
+    if (!c) {
+        c = calloc(1, sizeof(*c));
+        c->key = (void*)module;
+        c->id = module->id;
+        HASH_ADD_PTR(g_perf_counters, key, c);
+    }
+    if (render) {
+        c->render_us += (int64_t)(cost * 1000 * 1000);
+        c->render_calls++;
+    } else {
+        c->update_us += (int64_t)(cost * 1000 * 1000);
+        c->update_calls++;
+    }
+}
+
+json_value *module_perf_report(void)
+{
+    json_value *ret, *val;
+    perf_counter_t *c, *tmp;
+
+    ret = json_array_new(0);
+    HASH_ITER(hh, g_perf_counters, c, tmp) {
+        val = json_object_new(0);
+        json_object_push(val, "id", json_string_new(c->id ?: "?"));
+        json_object_push(val, "update_us", json_integer_new(c->update_us));
+        json_object_push(val, "update_calls",
+                         json_integer_new(c->update_calls));
+        json_object_push(val, "render_us", json_integer_new(c->render_us));
+        json_object_push(val, "render_calls",
+                         json_integer_new(c->render_calls));
+        json_array_push(ret, val);
+    }
+    return ret;
+}
+
+/*
+ * Frame drop attribution: a small always-armed ring of the last frames'
+ * per module timing breakdown (deltas of the counters above).  When a
+ * frame blows the threshold the whole ring is snapshotted, so the
+ * frames leading up to a stutter can be retrieved afterwards with
+ * module_perf_trace_report (core 'frame_trace' attribute).
+ */
+#define TRACE_RING_NB       32      // Frames kept in the ring.
+#define TRACE_FRAME_MODS    16      // Biggest modules kept per frame.
+#define TRACE_THRESHOLD_MS  20.0    // A 60Hz frame over this is a drop.
+
+typedef struct trace_frame {
+    double  total_ms;               // Engine time of the frame.
+    int     nb;
+    struct {
+        const char *id;
+        int32_t update_us;
+        int32_t render_us;
+    } mods[TRACE_FRAME_MODS];
+} trace_frame_t;
+
+static trace_frame_t g_trace_ring[TRACE_RING_NB];
+static int g_trace_ring_pos = 0;
+static trace_frame_t g_trace_snapshot[TRACE_RING_NB];
+static int g_trace_snapshot_nb = 0;
+static double g_frame_start_time = 0;
+
+static void trace_frame_push(trace_frame_t *frame, const char *id,
+                             int64_t update_us, int64_t render_us)
+{
+    int i, min_i = 0;
+    int64_t v, min_v;
+
+    if (!update_us && !render_us) return;
+    if (frame->nb < TRACE_FRAME_MODS) {
+        i = frame->nb++;
+    } else {
+        // Full: replace the smallest entry if we are bigger.
+        min_v = INT64_MAX;
+        for (i = 0; i < TRACE_FRAME_MODS; i++) {
+            v = (int64_t)frame->mods[i].update_us + frame->mods[i].render_us;
+            if (v < min_v) {
+                min_v = v;
+                min_i = i;
+            }
+        }
+        if (update_us + render_us <= min_v) return;
+        i = min_i;
+    }
+    frame->mods[i].id = id;
+    frame->mods[i].update_us = update_us;
+    frame->mods[i].render_us = render_us;
+}
+
+void module_perf_frame(void)
+{
+    trace_frame_t *frame;
+    perf_counter_t *c, *tmp;
+    double frame_ms;
+
+    if (!g_frame_start_time) return;
+    frame_ms = (sys_get_unix_time() - g_frame_start_time) * 1000;
+
+    frame = &g_trace_ring[g_trace_ring_pos];
+    g_trace_ring_pos = (g_trace_ring_pos + 1) % TRACE_RING_NB;
+    memset(frame, 0, sizeof(*frame));
+    frame->total_ms = frame_ms;
+    HASH_ITER(hh, g_perf_counters, c, tmp) {
+        trace_frame_push(frame, c->id, c->update_us - c->frame_update_us,
+                         c->render_us - c->frame_render_us);
+        c->frame_update_us = c->update_us;
+        c->frame_render_us = c->render_us;
+    }
+
+    if (frame_ms > TRACE_THRESHOLD_MS) {
+        // Snapshot the ring, oldest frame first.
+        for (g_trace_snapshot_nb = 0; g_trace_snapshot_nb < TRACE_RING_NB;
+                g_trace_snapshot_nb++) {
+            g_trace_snapshot[g_trace_snapshot_nb] = g_trace_ring[
+                (g_trace_ring_pos + g_trace_snapshot_nb) % TRACE_RING_NB];
+        }
+    }
+}
+
+json_value *module_perf_trace_report(void)
+{
+    json_value *ret, *frames, *val, *mods, *mod;
+    const trace_frame_t *frame;
+    int i, j;
+
+    ret = json_object_new(0);
+    json_object_push(ret, "threshold_ms",
+                     json_double_new(TRACE_THRESHOLD_MS));
+    frames = json_array_new(0);
+    for (i = 0; i < g_trace_snapshot_nb; i++) {
+        frame = &g_trace_snapshot[i];
+        if (!frame->total_ms) continue; // Ring not full yet.
+        val = json_object_new(0);
+        json_object_push(val, "total_ms", json_double_new(frame->total_ms));
+        mods = json_array_new(0);
+        for (j = 0; j < frame->nb; j++) {
+            mod = json_object_new(0);
+            json_object_push(mod, "id",
+                             json_string_new(frame->mods[j].id ?: "?"));
+            json_object_push(mod, "update_us",
+                             json_integer_new(frame->mods[j].update_us));
+            json_object_push(mod, "render_us",
+                             json_integer_new(frame->mods[j].render_us));
+            json_array_push(mods, mod);
+        }
+        json_object_push(val, "modules", mods);
+        json_array_push(frames, val);
+    }
+    json_object_push(ret, "frames", frames);
+    return ret;
+}
+
+/*
+ * Per module bookkeeping for the update scheduler.  Modules that declare
+ * a non zero update_delay in their klass can be skipped for a few frames
+ * when the update pass gets over budget.
+ */
+typedef struct update_state {
+    UT_hash_handle  hh;
+    void            *key;       // The module pointer.
+    double          pending_dt; // User time since the last effective update.
+    double          cost;       // Smoothed duration of one update call (s).
+} update_state_t;
+
+static update_state_t *g_update_states = NULL;
+static double g_update_spent = 0; // Time spent in updates this frame (s).
+
+// Total time per frame we target for the module updates.  Above this the
+// modules with a staleness tolerance get throttled.
+#define UPDATE_BUDGET_S (8. / 1000)
+
+void module_update_reset_budget(void)
+{
+    g_update_spent = 0;
+    g_frame_start_time = sys_get_unix_time();
+}
+
+// Run a module update call with the timing every path must report.
+static int module_update_timed(obj_t *module, double dt, double *cost)
+{
+    double t = sys_get_unix_time();
+    int r = module->klass->update(module, dt);
+    *cost = sys_get_unix_time() - t;
+    return r;
+}
+
 EMSCRIPTEN_KEEPALIVE
 int module_update(obj_t *module, double dt)
 {
+    update_state_t *state;
+    double cost;
+    int r;
+
     assert(module->klass->flags & OBJ_MODULE);
     if (!module->klass->update) return 0;
-    return module->klass->update(module, dt);
+    if (!module->klass->update_delay) {
+        r = module_update_timed(module, dt, &cost);
+        perf_counter_add(module, false, cost);
+        return r;
+    }
+
+    HASH_FIND_PTR(g_update_states, &module, state);
+    if (!state) {
+        state = calloc(1, sizeof(*state));
+        state->key = module;
+        HASH_ADD_PTR(g_update_states, key, state);
+    }
+    state->pending_dt += dt;
+
+    // Over budget: delay the update as long as the module tolerates it.
+    if (g_update_spent + state->cost > UPDATE_BUDGET_S &&
+            state->pending_dt < module->klass->update_delay)
+        return 0;
+
+    r = module_update_timed(module, state->pending_dt, &cost);
+    g_update_spent += cost;
+    perf_counter_add(module, false, cost);
+    state->cost = state->cost ? mix(state->cost, cost, 0.1) : cost;
+    state->pending_dt = 0;
+    return r;
+}
+
+// Max number of module updates dispatched concurrently.
+#define MAX_PARALLEL_UPDATES 16
+
+typedef struct {
+    worker_t    worker;
+    obj_t       *module;
+    double      dt;
+    double      cost;
+    int         ret;
+} update_task_t;
+
+static int update_task_fn(worker_t *w)
+{
+    update_task_t *task = (void*)w;
+    /* Only the timing runs on the worker: the counter hash is fed from
+     * the main thread after the join (see module_update_all). */
+    task->ret = module_update_timed(task->module, task->dt, &task->cost);
+    return 1;
+}
+
+/*
+ * Test whether a module update can be dispatched to a worker: it must
+ * declare its dependencies, and the throttled modules keep going through
+ * module_update so that the budget accounting stays valid.
+ */
+static bool update_is_dispatchable(const obj_t *module)
+{
+    return module->klass->update &&
+           (module->klass->update_reads || module->klass->update_writes) &&
+           !module->klass->update_delay;
+}
+
+static bool update_can_overlap(const obj_klass_t *a, const obj_klass_t *b)
+{
+    if (a->update_writes & (b->update_reads | b->update_writes))
+        return false;
+    if (b->update_writes & (a->update_reads | a->update_writes))
+        return false;
+    return true;
+}
+
+int module_update_all(obj_t *root, double dt)
+{
+    obj_t *module, **children;
+    update_task_t tasks[MAX_PARALLEL_UPDATES];
+    int i, j, k, nb, nb_children, r, ret = 0;
+    bool done;
+
+    children = module_get_children(root, &nb_children);
+    for (k = 0; k < nb_children; k++) {
+        module = children[k];
+        if (!update_is_dispatchable(module)) {
+            r = module_update(module, dt);
+            if (r < 0) LOG_E("Error updating module '%s'", module->id);
+            if (r > 0) ret = 1;
+            // The update might have modified the children list.
+            children = module_get_children(root, &nb_children);
+            continue;
+        }
+        // Collect a batch of consecutive updates that can all overlap.
+        nb = 0;
+        tasks[nb++] = (update_task_t){.module = module, .dt = dt};
+        while (k + 1 < nb_children && nb < MAX_PARALLEL_UPDATES &&
+               update_is_dispatchable(children[k + 1])) {
+            for (i = 0; i < nb; i++) {
+                if (!update_can_overlap(tasks[i].module->klass,
+                                        children[k + 1]->klass))
+                    break;
+            }
+            if (i < nb) break;
+            tasks[nb++] = (update_task_t){.module = children[k + 1], .dt = dt};
+            k++;
+        }
+        for (i = 0; i < nb; i++)
+            worker_init(&tasks[i].worker, update_task_fn);
+        do {
+            done = true;
+            for (i = 0; i < nb; i++)
+                if (!worker_iter(&tasks[i].worker)) done = false;
+        } while (!done);
+        for (j = 0; j < nb; j++) {
+            // Counters are only touched from the main thread.
+            perf_counter_add(tasks[j].module, false, tasks[j].cost);
+            if (tasks[j].ret < 0)
+                LOG_E("Error updating module '%s'", tasks[j].module->id);
+            if (tasks[j].ret > 0) ret = 1;
+        }
+    }
+    return ret;
 }
 
 
@@ -41,19 +446,29 @@ int module_update(obj_t *module, double dt)
  */
 int module_list_objs(const obj_t *obj,
                      double max_mag, uint64_t hint, const char *source,
+                     const char *type, module_list_cursor_t *cursor,
                      void *user, int (*f)(void *user, obj_t *obj))
 {
-    obj_t *child;
+    obj_t *child, **children;
+    int i, nb;
     assert(f);
 
+    if (cursor && cursor->done) return 0;
     if (obj->klass->list)
-        return obj->klass->list(obj, max_mag, hint, source, user, f);
+        return obj->klass->list(obj, max_mag, hint, source, type, cursor,
+                                user, f);
     if (!(obj->klass->flags & OBJ_LISTABLE)) return -1;
 
     // Default for listable modules: list all the children.
-    DL_FOREACH(obj->children, child) {
-        if (f(user, child)) break;
+    children = module_get_children(obj, &nb);
+    for (i = 0; i < nb; i++) {
+        child = children[i];
+        if (cursor && i < cursor->index) continue;
+        if (type && !otype_match(child->type, type)) continue;
+        if (cursor) cursor->index = i + 1;
+        if (f(user, child)) return 0;
     }
+    if (cursor) cursor->done = true;
     return 0;
 }
 
@@ -63,7 +478,7 @@ int module_list_objs2(const obj_t *obj, observer_t *obs,
                      double max_mag, void *user,
                      int (*f)(void *, obj_t *))
 {
-    return module_list_objs(obj, max_mag, 0, NULL, user, f);
+    return module_list_objs(obj, max_mag, 0, NULL, NULL, NULL, user, f);
 }
 
 static int module_add_data_source_task(task_t *task, double dt)
@@ -112,7 +527,7 @@ int module_add_data_source(obj_t *module, const char *url, const char *key)
         data->module = module;
         data->url = strdup(url);
         data->key = key ? strdup(key) : NULL;
-        core_add_task(module_add_data_source_task, data);
+        core_add_task(module_add_data_source_task, data, 1, 0);
     }
     return r;
 }
@@ -128,12 +543,10 @@ obj_t *obj_get(const obj_t *obj, const char *query, int flags)
     obj = obj ?: &core->obj;
 
     // Check direct sub objects.
-    // XXX: this is a waste of time in most cases!
-    DL_FOREACH(obj->children, child) {
-        if (child->id && strcasecmp(child->id, query) == 0) {
-            child->ref++;
-            return child;
-        }
+    child = path_registry_get(obj, query);
+    if (child) {
+        child->ref++;
+        return child;
     }
 
     if (!obj->klass->get) return NULL;
@@ -143,10 +556,20 @@ obj_t *obj_get(const obj_t *obj, const char *query, int flags)
 // Find an object by its oid.
 obj_t *obj_get_by_oid(const obj_t *obj, uint64_t oid, uint64_t hint)
 {
+    obj_t *ret;
     obj = obj ?: (obj_t*)core;
-    if (obj->klass->get_by_oid)
-        return obj->klass->get_by_oid(obj, oid, hint);
-    return NULL;
+
+    // For a global search, first probe the map of the live objects:
+    // oids are unique, so if somebody still holds the object (e.g. the
+    // current selection) we don't need to visit the modules at all.
+    if (obj == (obj_t*)core && (ret = obj_oid_map_get(oid))) {
+        ret->ref++;
+        return ret;
+    }
+    if (!obj->klass->get_by_oid) return NULL;
+    ret = obj->klass->get_by_oid(obj, oid, hint);
+    if (ret) obj_oid_map_add(ret);
+    return ret;
 }
 
 // For modules: return the order in which the modules should be rendered.
@@ -159,6 +582,16 @@ double module_get_render_order(const obj_t *module)
         return module->klass->render_order;
 }
 
+int module_render(obj_t *module, const painter_t *painter)
+{
+    double t;
+    int r;
+    t = sys_get_unix_time();
+    r = obj_render(module, painter);
+    perf_counter_add(module, true, sys_get_unix_time() - t);
+    return r;
+}
+
 EMSCRIPTEN_KEEPALIVE
 void module_add_global_listener(void (*f)(obj_t *module, const char *attr))
 {
@@ -178,6 +611,9 @@ void module_add(obj_t *parent, obj_t *child)
     assert(parent);
     child->parent = parent;
     DL_APPEND(parent->children, child);
+    parent->children_dirty = true;
+    path_registry_add(parent, child);
+    obj_oid_map_add(child);
     obj_retain(child);
 }
 
@@ -199,15 +635,51 @@ void module_remove(obj_t *parent, obj_t *child)
     assert(parent);
     assert(child->ref > 0);
     child->parent = NULL;
+    path_registry_remove(parent, child);
     DL_DELETE(parent->children, child);
+    parent->children_dirty = true;
     obj_release(child);
 }
 
+obj_t **module_get_children(const obj_t *obj_, int *nb)
+{
+    obj_t *obj = (obj_t*)obj_; // The cache fill doesn't change the tree.
+    obj_t *child;
+    int count;
+
+    if (obj->children_dirty) {
+        DL_COUNT(obj->children, child, count);
+        obj->children_array = realloc(obj->children_array,
+                count * sizeof(*obj->children_array));
+        count = 0;
+        DL_FOREACH(obj->children, child)
+            obj->children_array[count++] = child;
+        obj->children_count = count;
+        obj->children_dirty = false;
+    }
+    *nb = obj->children_count;
+    return obj->children_array;
+}
+
+void module_sort_children(obj_t *obj, int (*cmp)(void *a, void *b))
+{
+    DL_SORT(obj->children, cmp);
+    obj->children_dirty = true;
+}
+
 EMSCRIPTEN_KEEPALIVE
 obj_t *module_get_child(const obj_t *module, const char *id)
 {
     obj_t *ret;
     assert(id);
+    ret = path_registry_get(module, id);
+    // The registry is case insensitive but this function is not, so
+    // check and fall back to a scan on a case mismatch.
+    if (ret && strcmp(ret->id, id) == 0) {
+        assert(ret->ref > 0);
+        ret->ref++;
+        return ret;
+    }
     DL_FOREACH(module->children, ret) {
         assert(ret->ref > 0);
         if (ret->id && strcmp(ret->id, id) == 0) {
@@ -14,6 +14,18 @@ enum {
     MODULE_AGAIN       = 2 // Returned if obj_list can be called again.
 };
 
+/*
+ * Enum: UPDATE_DEP_*
+ * Core state a module update function can read or write, declared in the
+ * klass update_reads/update_writes masks (the module own state doesn't
+ * need to be declared).
+ */
+enum {
+    UPDATE_DEP_TIME     = 1 << 0, // The observer time and position.
+    UPDATE_DEP_ASSETS   = 1 << 1, // The assets and request system.
+    UPDATE_DEP_MODULES  = 1 << 2, // Other modules or the objects tree.
+};
+
 
 /*
  * Function: module_update
@@ -24,6 +36,65 @@ enum {
  */
 int module_update(obj_t *module, double dt);
 
+/*
+ * Function: module_update_reset_budget
+ * Start a new frame for the module update scheduler.
+ *
+ * Called by the core once per frame, before the module update loop.
+ * Modules whose klass declares a non zero update_delay are throttled
+ * once the updates of a frame exceed the scheduler budget.
+ */
+void module_update_reset_budget(void);
+
+/*
+ * Function: module_update_all
+ * Update all the children modules of an object, dispatching the updates
+ * of consecutive non conflicting modules (as per their declared
+ * update_reads/update_writes masks) to the worker pool.
+ *
+ * Return:
+ *   A value > 0 if any module requested a new frame, 0 otherwise.
+ */
+int module_update_all(obj_t *root, double dt);
+
+/*
+ * Function: module_render
+ * Render a module, accumulating its performance counters.
+ *
+ * Same as obj_render, but the time spent in the render function is
+ * credited to the module counters (see <module_perf_report>).
+ */
+int module_render(obj_t *module, const painter_t *painter);
+
+/*
+ * Function: module_perf_report
+ * Return a json array with the accumulated performance counters of all
+ * the modules: total update and render times (µs) and call counts.
+ *
+ * The counters are never reset, so a telemetry scraper can diff two
+ * reports to get a rate.  Exposed as the core 'perf_counters' attribute.
+ */
+json_value *module_perf_report(void);
+
+/*
+ * Function: module_perf_frame
+ * Close the current frame for the performance trace ring.
+ *
+ * Called by the core at the end of each rendered frame.  Records the
+ * per module timing breakdown of the frame, and snapshots the last
+ * frames when the frame time blew the drop threshold.
+ */
+void module_perf_frame(void);
+
+/*
+ * Function: module_perf_trace_report
+ * Return a json report of the frames leading up to the last frame drop:
+ * for each frame the engine time and the biggest modules' update and
+ * render times.  Empty until a frame exceeds the threshold.  Exposed as
+ * the core 'frame_trace' attribute.
+ */
+json_value *module_perf_trace_report(void);
+
 /*
  * Function: module_list_obj
  * List all astro objects in a module.
@@ -36,6 +107,13 @@ int module_update(obj_t *module, double dt);
  *              caller should still check the magnitude if needed.
  *   source   - Only consider objects from the given data source.  Can be
  *              set to NULL to ignore.
+ *   type     - Only list the objects matching the given otype (as with
+ *              <otype_match>).  Can be set to NULL to ignore.  Modules
+ *              can use it to skip whole chunks of their catalogs.
+ *   cursor   - Optional continuation (zeroed before the first call), so
+ *              that a paged listing resumes where the previous call
+ *              stopped instead of enumerating from scratch.  Can be set
+ *              to NULL to list everything.
  *   user     - Data passed to the callback.
  *   f        - Callback function called once per object.
  *
@@ -47,8 +125,9 @@ int module_update(obj_t *module, double dt);
  */
 int module_list_objs(const obj_t *module,
                      double max_mag, uint64_t hint, const char *source,
+                     const char *type, module_list_cursor_t *cursor,
                      void *user, int (*f)(void *user, obj_t *obj))
-__attribute__((nonnull(1, 6)));
+__attribute__((nonnull(1, 8)));
 
 /*
  * Function: module_add_data_source
@@ -169,6 +248,34 @@ obj_t *module_add_new(obj_t *module, const char *type, const char *id,
  */
 void module_remove(obj_t *module, obj_t *child);
 
+/*
+ * Function: module_get_children
+ * Return the children of an object as a contiguous array.
+ *
+ * The array mirrors the children list and is lazily rebuilt when the list
+ * has been modified, so that the per-frame tree walks iterate contiguous
+ * memory instead of chasing the list pointers.  The array stays valid only
+ * until the next modification of the children list.
+ *
+ * Parameters:
+ *   obj    - A module.
+ *   nb     - Output number of children.
+ *
+ * Return:
+ *   An array of nb children, owned by the object.
+ */
+obj_t **module_get_children(const obj_t *obj, int *nb);
+
+/*
+ * Function: module_sort_children
+ * Sort the children list of a module with a given comparison function.
+ *
+ * All the code should use this function instead of sorting the list
+ * directly, so that the contiguous children array gets properly
+ * invalidated.
+ */
+void module_sort_children(obj_t *obj, int (*cmp)(void *a, void *b));
+
 /*
  * Function: module_get_child
  * Return a module child by id.
@@ -16,6 +16,8 @@
  *
  */
 
+typedef struct adaptation adaptation_t;
+
 /*
  * Type: atmosphere_t
  * Atmosphere module struct.
@@ -30,6 +32,10 @@ typedef struct atmosphere {
     } tiles[12];
     fader_t         visible;
     double          turbidity;
+    // Luminance lookup tables, rebuilt when the model inputs change.
+    skybrightness_lut_t sb_lut;
+    // Eye adaptation reduction (see adaptation_t).  Lazily created.
+    adaptation_t    *adaptation;
 } atmosphere_t;
 
 // All the precomputed data
@@ -44,6 +50,7 @@ typedef struct {
 
     // Skybrightness model.
     skybrightness_t skybrightness;
+    const skybrightness_lut_t *sb_lut;
     double eclipse_factor; // Solar eclipse adjustment.
     double landscape_lum; // Average luminance of the landscape.
 
@@ -60,6 +67,20 @@ typedef struct {
     float cos_grid_angular_step;
 } render_data_t;
 
+/*
+ * Type: adaptation_t
+ * Worker reducing the sky luminance for the eye adaptation, one frame
+ * behind the render, so that it never adds to the main thread frame time.
+ * All the inputs are snapshotted at launch time.
+ */
+struct adaptation {
+    worker_t            worker;
+    render_data_t       data;       // Inputs, and accumulated results.
+    skybrightness_lut_t lut;        // Copy of the luminance tables.
+    float               pos[48][3]; // Visible sample directions.
+    int                 nb_pos;
+};
+
 static double F2(const double *lam, double cos_theta,
                  double gamma, double cos_gamma)
 {
@@ -155,7 +176,7 @@ static float compute_lum(void *user, const float pos[3])
     float lum;
     // Our formula does not work below the horizon.
     p[2] = fabs(p[2]);
-    lum = skybrightness_get_luminance(&d->skybrightness,
+    lum = skybrightness_lut_get_luminance(d->sb_lut,
                 min(vec3_dot(p, d->moon_pos), d->cos_grid_angular_step),
                 min(vec3_dot(p, d->sun_pos), d->cos_grid_angular_step),
                 vec3_dot(p, zenith));
@@ -176,6 +197,15 @@ static float compute_lum(void *user, const float pos[3])
     return lum;
 }
 
+static int adaptation_worker_fn(worker_t *w)
+{
+    adaptation_t *a = (void*)w;
+    int i;
+    for (i = 0; i < a->nb_pos; i++)
+        compute_lum(&a->data, a->pos[i]);
+    return 1;
+}
+
 static int atmosphere_update(obj_t *obj, double dt)
 {
     atmosphere_t *atm = (atmosphere_t*)obj;
@@ -205,14 +235,17 @@ static int atmosphere_render(const obj_t *obj, const painter_t *painter_)
     PROFILE(atmosphere_render, 0);
     atmosphere_t *atm = (atmosphere_t*)obj;
     obj_t *sun, *moon;
-    double sun_pos[4], moon_pos[4], sun_vmag, moon_vmag;
+    double sun_pos[4], moon_pos[4], sun_vmag, moon_vmag, dirs[48][3];
     render_data_t data;
-    int i;
+    adaptation_t *a;
+    int i, pix[48];
     painter_t painter = *painter_;
-    core->lwsky_average = 0.0001;
     observer_t *obs = painter.obs;
 
-    if (atm->visible.value == 0.0) return 0;
+    if (atm->visible.value == 0.0) {
+        core->lwsky_average = 0.0001;
+        return 0;
+    }
     sun = obj_get_by_oid(&core->obj, oid_create("HORI", 10), 0);
     moon = obj_get_by_oid(&core->obj, oid_create("HORI", 301), 0);
     assert(sun);
@@ -231,6 +264,9 @@ static int atmosphere_render(const obj_t *obj, const painter_t *painter_)
     data.cos_grid_angular_step = cos(15. * DD2R);
     prepare_skybrightness(&data.skybrightness,
             &painter, sun_pos, moon_pos, moon_vmag);
+    // Rebuilt only when the model inputs actually changed.
+    skybrightness_lut_prepare(&atm->sb_lut, &data.skybrightness);
+    data.sb_lut = &atm->sb_lut;
 
     // Set the shader attributes.
     painter.atm.p[0]  = data.Px[0];
@@ -248,8 +284,18 @@ static int atmosphere_render(const obj_t *obj, const painter_t *painter_)
     painter.atm.p[11] = data.ky;
 
     vec3_to_float(sun_pos, painter.atm.sun);
-    painter.atm.compute_lum = compute_lum;
-    painter.atm.user = &data;
+    vec3_to_float(moon_pos, painter.atm.moon);
+    // Skybrightness coefficients, for the per vertex evaluation in the
+    // shader (same layout as the u_sb uniform there).
+    painter.atm.sb[0] = data.skybrightness.b_night_term;
+    painter.atm.sb[1] = data.skybrightness.b_moon_term;
+    painter.atm.sb[2] = data.skybrightness.b_twilight_term;
+    painter.atm.sb[3] = data.skybrightness.C3;
+    painter.atm.sb[4] = data.skybrightness.C4;
+    painter.atm.sb[5] = data.skybrightness.K;
+    painter.atm.sb[6] = data.eclipse_factor;
+    painter.atm.sb[7] = data.light_pollution_lum;
+    painter.atm.sb[8] = data.cos_grid_angular_step;
     painter.flags |= PAINTER_ADD | PAINTER_ATMOSPHERE_SHADER;
     painter.color[3] = atm->visible.value;
 
@@ -258,9 +304,36 @@ static int atmosphere_render(const obj_t *obj, const painter_t *painter_)
         render_tile(atm, &painter, 0, i);
     }
 
-    core_report_luminance_in_fov(data.max_lum, true);
-    if (data.nb_lum)
-        core->lwsky_average = data.sum_lum / data.nb_lum;
+    // Eye adaptation: reduce the model on a coarse fixed grid (the
+    // visible healpix order 1 tiles) in a worker, one frame behind, so
+    // that it never adds to the main thread frame time.
+    if (!atm->adaptation)
+        atm->adaptation = calloc(1, sizeof(*atm->adaptation));
+    a = atm->adaptation;
+    if (!a->worker.fn || worker_iter(&a->worker)) {
+        // Consume the previous run results and relaunch with the
+        // current inputs.
+        if (a->nb_pos) {
+            core_report_luminance_in_fov(a->data.max_lum, true);
+            if (a->data.nb_lum)
+                core->lwsky_average = a->data.sum_lum / a->data.nb_lum;
+        }
+        a->data = data;
+        a->lut = atm->sb_lut;
+        a->data.sb_lut = &a->lut;
+        a->nb_pos = 0;
+        for (i = 0; i < 48; i++) {
+            if (painter_is_healpix_clipped(&painter, FRAME_OBSERVED, 1, i,
+                                           true))
+                continue;
+            pix[a->nb_pos++] = i;
+        }
+        healpix_pix2vec_n(2, a->nb_pos, pix, dirs);
+        for (i = 0; i < a->nb_pos; i++)
+            vec3_to_float(dirs[i], a->pos[i]);
+        worker_init(&a->worker, adaptation_worker_fn);
+        worker_iter(&a->worker);
+    }
     return 0;
 }
 
@@ -34,9 +34,20 @@ typedef struct {
     char        name[64]; // e.g 'C/1995 O1 (Hale-Bopp)'
     bool        on_screen;  // Set once the object has been visible.
 
+    // Date window (MJD, TT) during which the comet can possibly get
+    // brighter than ACTIVE_VMAG_LIMIT.  Outside of it the comet stays
+    // dormant: the render pass skips it without evaluating the orbit.
+    double      active_start;
+    double      active_end;
+
     // Cached values.
     double      vmag;
     double      pvo[2][4];
+
+    // Chebyshev interpolant of the heliocentric position around the
+    // last queried time, so that repeated queries at nearby times skip
+    // the full orbit solve.
+    orbit_cheb_t cheb;
 } comet_t;
 
 /*
@@ -72,6 +83,68 @@ static const char *orbit_type_to_otype(char o)
     }
 }
 
+// Any comet fainter than this can never show up at the current display
+// magnitude limits, whatever the screen settings.
+#define ACTIVE_VMAG_LIMIT 20.0
+
+// Best possible magnitude at a given heliocentric distance, assuming the
+// observer at the closest approach.
+static double comet_best_case_vmag(const comet_t *comet, double r)
+{
+    return comet->h + 5 * log10(fmax(r - 1.0, 0.1)) +
+           2.5 * comet->g * log10(r);
+}
+
+/*
+ * Precompute the potential visibility window of a comet: the magnitude
+ * model is monotonic in the distances, so we search the max heliocentric
+ * distance at which the comet can still reach ACTIVE_VMAG_LIMIT, then
+ * convert it into a time around the perihelion passage using the orbit.
+ */
+static void comet_compute_activity_window(comet_t *comet)
+{
+    const double K = 0.01720209895; // AU, day.
+    double rmin, rmax, r = 0, a, n, e, m, w, dt;
+    int i;
+
+    e = comet->orbit.e;
+    rmin = comet->orbit.q;
+    rmax = 2000;
+    if (comet_best_case_vmag(comet, rmin) > ACTIVE_VMAG_LIMIT) {
+        // Too faint even at perihelion: never active.
+        comet->active_start = INFINITY;
+        comet->active_end = -INFINITY;
+        return;
+    }
+    comet->active_start = -INFINITY;
+    comet->active_end = INFINITY;
+    if (comet_best_case_vmag(comet, rmax) <= ACTIVE_VMAG_LIMIT)
+        return; // Can reach the limit at any distance.
+    for (i = 0; i < 64; i++) {
+        r = (rmin + rmax) / 2;
+        if (comet_best_case_vmag(comet, r) <= ACTIVE_VMAG_LIMIT)
+            rmin = r;
+        else
+            rmax = r;
+    }
+
+    if (e < 0.98) {
+        a = comet->orbit.q / (1.0 - e);
+        if (a * (1 + e) <= r) return; // Bright enough all along the orbit.
+        n = K / sqrt(a * a * a);
+        m = acos(clamp((1 - r / a) / e, -1, 1)); // Eccentric anomaly at r.
+        m = m - e * sin(m);                      // Mean anomaly at r.
+        dt = m / n;
+    } else {
+        // Invert the Barker style equation used in comet_update.
+        w = sqrt(r / comet->orbit.q - 1);
+        dt = (w * w * w + 3 * w) / 2 *
+             sqrt(2 * pow(comet->orbit.q, 3)) / (1.5 * K);
+    }
+    comet->active_start = comet->orbit.d - dt;
+    comet->active_end = comet->orbit.d + dt;
+}
+
 static void load_data(comets_t *comets, const char *data, int size)
 {
     comet_t *comet;
@@ -108,6 +181,7 @@ static void load_data(comets_t *comets, const char *data, int size)
         strcpy(comet->name, desgn);
         comet->obj.oid = oid_create("Com", line_idx);
         comet->pvo[0][0] = NAN;
+        comet_compute_activity_window(comet);
         last_epoch = max(epoch, last_epoch);
     }
 
@@ -119,9 +193,10 @@ static void load_data(comets_t *comets, const char *data, int size)
           format_time(buf, last_epoch, 0, "YYYY-MM-DD"));
 }
 
-static int comet_update(comet_t *comet, const observer_t *obs)
+// Heliocentric ecliptic position of a comet at a given time (TT, MJD).
+static void comet_compute_ph(const comet_t *comet, double tt, double pos[3])
 {
-    double a, p, n, ph[2][3], pv[2][3], or, sr, b, v, w, r, o, u, i;
+    double a, p, n, b, v, w, r, o, u, i;
     const double K = 0.01720209895; // AU, day
 
     // Position algo for elliptical comets.
@@ -134,14 +209,14 @@ static int comet_update(comet_t *comet, const observer_t *obs)
         n = 2 * M_PI / p;
 
         orbit_compute_pv(0.005 * DD2R,
-                         obs->tt, ph[0], NULL, comet->orbit.d, comet->orbit.i,
+                         tt, pos, NULL, comet->orbit.d, comet->orbit.i,
                          comet->orbit.o, comet->orbit.w, a, n, comet->orbit.e,
                          0, 0, 0);
     } else {
         // Algo for non elliptical orbits, taken from
         // http://stjarnhimlen.se/comp/tutorial.html
         // TODO: move into orbit_compute_pv directly somehow?
-        a = 1.5 * (obs->tt - comet->orbit.d) * K /
+        a = 1.5 * (tt - comet->orbit.d) * K /
                 sqrt(2 * comet->orbit.q * comet->orbit.q * comet->orbit.q);
         b = sqrt(1 + a * a);
         w = pow(b + a, 1. / 3) - pow(b - a, 1. / 3);
@@ -151,9 +226,36 @@ static int comet_update(comet_t *comet, const observer_t *obs)
         o = comet->orbit.o;
         u = v + comet->orbit.w;
         i = comet->orbit.i;
-        ph[0][0] = r * (cos(o) * cos(u) - sin(o) * sin(u) * cos(i));
-        ph[0][1] = r * (sin(o) * cos(u) + cos(o) * sin(u) * cos(i));
-        ph[0][2] = r * (sin(u) * sin(i));
+        pos[0] = r * (cos(o) * cos(u) - sin(o) * sin(u) * cos(i));
+        pos[1] = r * (sin(o) * cos(u) + cos(o) * sin(u) * cos(i));
+        pos[2] = r * (sin(u) * sin(i));
+    }
+}
+
+static void comet_cheb_fn(double mjd, double pos[3], void *user)
+{
+    comet_compute_ph(user, mjd, pos);
+}
+
+static int comet_update(comet_t *comet, const observer_t *obs)
+{
+    double a, p, ph[2][3], pv[2][3], or, sr, days;
+    const double K = 0.01720209895; // AU, day
+
+    if (!orbit_cheb_eval(&comet->cheb, obs->tt, ph[0], NULL)) {
+        // Refit a short interpolant segment around the current time:
+        // about 2% of the period for elliptical orbits, a fraction of
+        // the Barker equation time scale for the near parabolic ones.
+        if (comet->orbit.e < 0.98) {
+            a = comet->orbit.q / (1.0 - comet->orbit.e);
+            p = 2 * M_PI * sqrt(a * a * a) / K;
+            days = clamp(0.02 * p, 1, 30);
+        } else {
+            days = clamp(0.05 * sqrt(2 * pow(comet->orbit.q, 3)) / K, 1, 30);
+        }
+        orbit_cheb_fit(&comet->cheb, obs->tt - days / 2, days,
+                       comet_cheb_fn, comet);
+        orbit_cheb_eval(&comet->cheb, obs->tt, ph[0], NULL);
     }
 
     mat3_mul_vec3(obs->re2i, ph[0], ph[0]);
@@ -210,6 +312,12 @@ static int comet_render(const obj_t *obj, const painter_t *painter)
     const bool selected = core->selection && obj->oid == core->selection->oid;
     double hints_mag_offset = g_comets->hints_mag_offset;
 
+    // Fully dormant outside of the precomputed activity window.
+    if (!comet->on_screen && !selected &&
+            (painter->obs->tt < comet->active_start ||
+             painter->obs->tt > comet->active_end))
+        return 0;
+
     comet_update(comet, painter->obs);
     vmag = comet->vmag;
 
@@ -375,7 +483,8 @@ OBJ_REGISTER(comet_klass)
 static obj_klass_t comets_klass = {
     .id             = "comets",
     .size           = sizeof(comets_t),
-    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE,
+    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE |
+                      OBJ_MODULE_LAZY,
     .init           = comets_init,
     .add_data_source = comets_add_data_source,
     .update         = comets_update,
@@ -383,6 +492,8 @@ static obj_klass_t comets_klass = {
     .get            = comets_get,
     .get_by_oid     = comets_get_by_oid,
     .render_order   = 20,
+    // The update only polls the data loading: fine to skip under load.
+    .update_delay   = 0.5,
     .attributes     = (attribute_t[]) {
         PROPERTY(visible, TYPE_BOOL, MEMBER(comets_t, visible)),
         PROPERTY(hints_mag_offset, TYPE_FLOAT,
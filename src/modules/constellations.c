@@ -27,6 +27,48 @@ typedef struct {
     int     hip;
 } anchor_t;
 
+/*
+ * The constellation art images are packed into a few shared atlas
+ * textures instead of one texture per constellation, so that rendering
+ * all the art only binds a few textures.  The decode of each image runs
+ * in the worker pool; only the packing upload happens on the render
+ * thread.
+ */
+#define ATLAS_SIZE 2048
+
+typedef struct atlas_page atlas_page_t;
+struct atlas_page {
+    texture_t       *tex;
+    int             bpp;
+    // Shelf packer state.
+    int             shelf_x;
+    int             shelf_y;
+    int             shelf_h;
+    atlas_page_t    *next;
+};
+
+/*
+ * Type: img_loader_t
+ * Worker decoding a constellation art image.
+ */
+typedef struct img_loader {
+    worker_t    worker;
+    uint8_t     *data;      // Encoded image data (owned).
+    int         size;
+    uint8_t     *img;       // Decoded pixels, set by the worker.
+    int         w, h, bpp;
+} img_loader_t;
+
+static int img_load_worker(worker_t *w)
+{
+    img_loader_t *loader = (void*)w;
+    loader->img = img_read_from_mem(loader->data, loader->size,
+                                    &loader->w, &loader->h, &loader->bpp);
+    free(loader->data);
+    loader->data = NULL;
+    return 0;
+}
+
 /*
  * Type: constellation_t
  * Object representing a single constellation.
@@ -41,7 +83,10 @@ typedef struct constellation {
 
     // Texture and associated transformation matrix.
     struct {
-        texture_t   *tex;
+        texture_t   *tex;       // Shared atlas page (or own texture).
+        double      uv_mat[3][3]; // UV transform to the atlas sub rect.
+        img_loader_t *loader;   // Set while the image is decoding.
+        bool        failed;
         anchor_t    anchors[3];
         double      mat[3][3];
         double      cap[4]; // Bounding cap of the image (ICRF)
@@ -53,6 +98,23 @@ typedef struct constellation {
     double (*stars_pos)[3]; // ICRF/observer pos for all stars.
     double lines_cap[4]; // Bounding cap of the lines (ICRF). zero if no stars.
     double pvo[2][4];
+
+    // Cached line geometry, so that we don't redo the truncation and the
+    // frame conversions every frame (see render_lines and
+    // constellation_lines_in_view).
+    double (*lines)[4];     // Truncated/animated line segments (ICRF).
+    double lines_scale;     // Projection scale the lines were built for.
+    double lines_anim;      // Animation factor the lines were built for.
+    double lines_update;    // Value of last_update when they were built.
+    double (*view_pos)[4];  // Star positions in clipping coordinates.
+    int view_nb;
+    uint64_t view_hash;     // Observer hash of the projected positions.
+    double view_scale;      // Projection scale of the projected positions.
+
+    // Precomputed boundary polylines (J2000), one per edge.  The
+    // boundaries are static geometry, so we subdivide them only once.
+    double (*bounds_pts)[3];
+    int    *bounds_ofs;     // nb_edges + 1 offsets into bounds_pts.
 } constellation_t;
 
 /*
@@ -67,6 +129,7 @@ typedef struct constellations {
     fader_t     labels_visible;
     bool        lines_animation;
     bool        show_only_pointed;
+    atlas_page_t *atlas; // Shared art atlas pages.
 } constellations_t;
 
 static int constellation_update(constellation_t *con, const observer_t *obs);
@@ -115,7 +178,6 @@ const char *join_path(const char *base, const char *path, char *buf, int len)
 static void constellation_set_image(obj_t *obj)
 {
     constellation_t *cons = (void*)obj;
-    char path[1024];
     const constellation_infos_t *a = &cons->info;
 
     if (cons->img.tex) return; // Already set.
@@ -128,14 +190,125 @@ static void constellation_set_image(obj_t *obj)
     cons->img.anchors[1].hip = a->anchors[1].hip;
     cons->img.anchors[2].hip = a->anchors[2].hip;
 
-    join_path(cons->info.base_path, cons->info.img, path, sizeof(path));
-    cons->img.tex = texture_from_url(path, TF_LAZY_LOAD);
-    assert(cons->img.tex);
-
+    // The image itself is fetched, decoded and packed into the shared
+    // atlas by constellation_load_img, driven from the module update.
     cons->image_loaded_fader.target = false;
     cons->image_loaded_fader.value = 0;
 }
 
+/*
+ * Allocate a w x h rectangle in an atlas page, with one pixel of padding
+ * so that the linear filtering doesn't bleed between neighbor images.
+ * Return false if the page is full.
+ */
+static bool atlas_page_alloc(atlas_page_t *page, int w, int h, int *x, int *y)
+{
+    w += 1;
+    h += 1;
+    if (page->shelf_x + w > ATLAS_SIZE) {
+        // Start a new shelf.
+        if (page->shelf_y + page->shelf_h + h > ATLAS_SIZE) return false;
+        page->shelf_y += page->shelf_h;
+        page->shelf_x = 0;
+        page->shelf_h = 0;
+    }
+    if (page->shelf_y + h > ATLAS_SIZE) return false;
+    *x = page->shelf_x;
+    *y = page->shelf_y;
+    page->shelf_x += w;
+    page->shelf_h = max(page->shelf_h, h);
+    return true;
+}
+
+/*
+ * Pack a decoded art image into the shared atlas, and set the
+ * constellation texture and uv transformation accordingly.
+ */
+static void atlas_pack(constellations_t *conss, constellation_t *con,
+                       const uint8_t *img, int w, int h, int bpp)
+{
+    atlas_page_t *page;
+    uint8_t *buf;
+    int x, y;
+
+    mat3_set_identity(con->img.uv_mat);
+
+    // Images too large for a shared page keep their own texture.
+    if (w + 1 > ATLAS_SIZE || h + 1 > ATLAS_SIZE) {
+        con->img.tex = texture_from_data(img, w, h, bpp, 0, 0, w, h, 0);
+        return;
+    }
+
+    for (page = conss->atlas; page; page = page->next) {
+        if (page->bpp != bpp) continue;
+        if (atlas_page_alloc(page, w, h, &x, &y)) break;
+    }
+    if (!page) {
+        page = calloc(1, sizeof(*page));
+        page->bpp = bpp;
+        page->tex = texture_create(ATLAS_SIZE, ATLAS_SIZE, bpp);
+        // Allocate the page storage.
+        buf = calloc(bpp, ATLAS_SIZE * ATLAS_SIZE);
+        texture_set_data(page->tex, buf, ATLAS_SIZE, ATLAS_SIZE, bpp);
+        free(buf);
+        page->next = conss->atlas;
+        conss->atlas = page;
+        atlas_page_alloc(page, w, h, &x, &y); // Cannot fail on a new page.
+    }
+    texture_set_sub_data(page->tex, x, y, img, w, h, bpp);
+    page->tex->ref++;
+    con->img.tex = page->tex;
+    mat3_itranslate(con->img.uv_mat,
+                    x / (double)ATLAS_SIZE, y / (double)ATLAS_SIZE);
+    mat3_iscale(con->img.uv_mat,
+                w / (double)ATLAS_SIZE, h / (double)ATLAS_SIZE, 1);
+}
+
+/*
+ * Drive the fetch, async decode and atlas packing of the art image of a
+ * constellation.  Called every frame from the module update until the
+ * image is packed, so that the art is already resident when the user
+ * turns it on.
+ */
+static void constellation_load_img(constellations_t *conss,
+                                   constellation_t *con)
+{
+    int size, code;
+    const void *data;
+    char path[1024];
+    img_loader_t *loader = con->img.loader;
+
+    if (con->img.tex || con->img.failed) return;
+    if (!*con->info.img) return;
+
+    if (!loader) {
+        join_path(con->info.base_path, con->info.img, path, sizeof(path));
+        data = asset_get_data(path, &size, &code);
+        if (!data) {
+            if (code) con->img.failed = true; // Download error.
+            return;
+        }
+        loader = calloc(1, sizeof(*loader));
+        worker_init(&loader->worker, img_load_worker);
+        loader->data = malloc(size);
+        memcpy(loader->data, data, size);
+        loader->size = size;
+        con->img.loader = loader;
+        asset_release(path);
+    }
+    if (!worker_iter(&loader->worker)) return;
+    if (!loader->img) {
+        LOG_W("Cannot decode image %s", con->info.img);
+        con->img.failed = true;
+    } else {
+        atlas_pack(conss, con, loader->img, loader->w, loader->h,
+                   loader->bpp);
+        free(loader->img);
+    }
+    free(loader);
+    con->img.loader = NULL;
+}
+
 static int constellation_init(obj_t *obj, json_value *args)
 {
     constellation_t *cons = (constellation_t *)obj;
@@ -238,7 +411,7 @@ static void update_image_mat(constellation_t *cons)
     double pvo[2][4];
     obj_t *star;
 
-    if (!cons->img.tex || cons->img.mat[2][2]) return;
+    if (!*cons->info.img || cons->img.failed || cons->img.mat[2][2]) return;
     for (i = 0; i < 3; i++) {
         vec2_copy(cons->img.anchors[i].uv, uvs[i]);
         uvs[i][2] = 1.0;
@@ -266,6 +439,7 @@ error:
     LOG_W("Cannot compute image for constellation %s", cons->info.id);
     texture_release(cons->img.tex);
     cons->img.tex = NULL;
+    cons->img.failed = true;
 }
 
 // Make a line shorter so that we don't hide the star.
@@ -373,18 +547,59 @@ static void spherical_project(
     mat3_mul_vec3(rnpb, out, out);
 }
 
-static int render_bounds(const constellation_t *con,
+/*
+ * Function: constellation_create_bounds
+ * Precompute the boundary polylines of a constellation.
+ *
+ * The boundaries are static geometry, so instead of running the edges
+ * through the adaptive tessellation of paint_line on every frame we
+ * subdivide them once, apply the B1875 to J2000 rotation, and keep the
+ * resulting polylines for the life of the constellation.
+ */
+static void constellation_create_bounds(constellation_t *con)
+{
+    const constellation_infos_t *info = &con->info;
+    double uv[2], p[4], ra0, ra1, de0, de1, t;
+    int i, j, n, nb = 0;
+
+    con->bounds_ofs = calloc(info->nb_edges + 1, sizeof(*con->bounds_ofs));
+    // First pass to compute the total number of points: one segment per
+    // degree of arc, so that the lines stay smooth at any reasonable zoom.
+    for (i = 0; i < info->nb_edges; i++) {
+        n = ceil(eraSeps(info->edges[i][0][0], info->edges[i][0][1],
+                         info->edges[i][1][0], info->edges[i][1][1]) /
+                 (1.0 * DD2R));
+        n = max(n, 1);
+        con->bounds_ofs[i + 1] = con->bounds_ofs[i] + n + 1;
+    }
+    con->bounds_pts = calloc(con->bounds_ofs[info->nb_edges],
+                             sizeof(*con->bounds_pts));
+    for (i = 0; i < info->nb_edges; i++) {
+        ra0 = info->edges[i][0][0];
+        de0 = info->edges[i][0][1];
+        ra1 = info->edges[i][1][0];
+        de1 = info->edges[i][1][1];
+        if (ra1 < ra0) ra1 += 2 * M_PI;
+        n = con->bounds_ofs[i + 1] - con->bounds_ofs[i] - 1;
+        for (j = 0; j <= n; j++) {
+            t = (double)j / n;
+            uv[0] = ra0 + (ra1 - ra0) * t;
+            uv[1] = de0 + (de1 - de0) * t;
+            spherical_project(NULL, uv, p);
+            vec3_copy(p, con->bounds_pts[nb++]);
+        }
+    }
+    assert(nb == con->bounds_ofs[info->nb_edges]);
+}
+
+static int render_bounds(constellation_t *con,
                          const painter_t *painter_,
                          bool selected)
 {
     int i;
     const constellation_infos_t *info;
-    double line[2][4] = {};
     painter_t painter = *painter_;
     const constellations_t *cons = (const constellations_t*)con->obj.parent;
-    uv_map_t map = {
-        .map = spherical_project,
-    };
 
     if (!selected) {
         painter.color[3] *= cons->bounds_visible.value * con->visible.value;
@@ -401,13 +616,14 @@ static int render_bounds(const constellation_t *con,
     painter.lines.dash_ratio = 0.85;
     painter.lines.dash_length = 8;
     info = &con->info;
-    if (!info) return 0;
+    if (!info->nb_edges) return 0;
+    if (!con->bounds_pts)
+        constellation_create_bounds(con);
     for (i = 0; i < info->nb_edges; i++) {
-        memcpy(line[0], info->edges[i][0], 2 * sizeof(double));
-        memcpy(line[1], info->edges[i][1], 2 * sizeof(double));
-        if (line[1][0] < line[0][0]) line[1][0] += 2 * M_PI;
-        paint_line(&painter, FRAME_ICRF, line, &map, 0,
-                   PAINTER_SKIP_DISCONTINUOUS);
+        paint_linestring(&painter, FRAME_ICRF,
+                         con->bounds_ofs[i + 1] - con->bounds_ofs[i],
+                         (const double (*)[3])
+                            (con->bounds_pts + con->bounds_ofs[i]));
     }
     return 0;
 }
@@ -422,12 +638,11 @@ static int render_bounds(const constellation_t *con,
  * We need this test so that the constellation visible fader gets properly
  * updated as soon as the constellation get in and out of the screen.
  */
-static bool constellation_lines_in_view(const constellation_t *con,
+static bool constellation_lines_in_view(constellation_t *con,
                                         const painter_t *painter)
 {
-    int i, nb = 0;
-    double (*pos)[4], mx, my;
-    bool ret;
+    int i, nb;
+    double mx, my, scale;
     const double m = 100; // Border margins (windows unit).
 
     // First fast tests for the case when the constellation is not in the
@@ -436,28 +651,33 @@ static bool constellation_lines_in_view(const constellation_t *con,
     if (painter_is_cap_clipped(painter, FRAME_ICRF, con->lines_cap))
         return false;
 
-    // Clipping test.
-    pos = calloc(con->count, sizeof(*pos));
-    for (i = 0; i < con->count; i++) {
-        if (!con->stars[i]) continue;
-        convert_frame(painter->obs, FRAME_ICRF, FRAME_VIEW, true,
-                      con->stars_pos[i], pos[nb]);
-        project(painter->proj, 0, pos[nb], pos[nb]);
-        nb++;
-    }
-    if (nb == 0) {
-        free(pos);
-        return true;
+    // Reproject the retained star positions only when the observer or
+    // the projection changed since the last frame.
+    if (!con->view_pos)
+        con->view_pos = calloc(con->count, sizeof(*con->view_pos));
+    scale = core_get_apparent_angle_for_point(painter->proj, 1.0);
+    if (con->view_hash != painter->obs->hash || con->view_scale != scale) {
+        con->view_hash = painter->obs->hash;
+        con->view_scale = scale;
+        nb = 0;
+        for (i = 0; i < con->count; i++) {
+            if (!con->stars[i]) continue;
+            convert_frame(painter->obs, FRAME_ICRF, FRAME_VIEW, true,
+                          con->stars_pos[i], con->view_pos[nb]);
+            project(painter->proj, 0, con->view_pos[nb], con->view_pos[nb]);
+            nb++;
+        }
+        con->view_nb = nb;
     }
+    if (con->view_nb == 0) return true;
+
     // Compute margins in NDC.
     mx = m * painter->pixel_scale / painter->fb_size[0] * 2;
     my = m * painter->pixel_scale / painter->fb_size[1] * 2;
     mx = min(mx, 0.5);
     my = min(my, 0.5);
 
-    ret = !is_clipped(con->count, pos, mx, my);
-    free(pos);
-    return ret;
+    return !is_clipped(con->view_nb, con->view_pos, mx, my);
 }
 
 /*
@@ -509,9 +729,8 @@ static int render_lines(constellation_t *con, const painter_t *_painter,
 {
     painter_t painter = *_painter;
     int i;
-    double (*lines)[4];
     double lines_color[4];
-    double mag[2], radius[2], visible;
+    double mag[2], radius[2], visible, scale, anim;
     observer_t *obs = painter.obs;
     const constellations_t *cons = (const constellations_t*)con->obj.parent;
 
@@ -528,35 +747,46 @@ static int render_lines(constellation_t *con, const painter_t *_painter,
     vec4_set(lines_color, 0.65, 1.0, 1.0, 0.4);
     vec4_emul(lines_color, painter.color, painter.color);
 
-    lines = calloc(con->count, sizeof(*lines));
-    for (i = 0; i < con->count; i++) {
-        if (!con->stars[i]) continue;
-        vec3_copy(con->stars_pos[i], lines[i]);
-        lines[i][3] = 0; // To infinity.
-    }
-
-    for (i = 0; i < con->count; i += 2) {
-        if (!con->stars[i + 0] || !con->stars[i + 1]) continue;
-        obj_get_info(con->stars[i + 0], obs, INFO_VMAG, &mag[0]);
-        obj_get_info(con->stars[i + 1], obs, INFO_VMAG, &mag[1]);
-        core_get_point_for_mag(mag[0], &radius[0], NULL);
-        core_get_point_for_mag(mag[1], &radius[1], NULL);
-        radius[0] = core_get_apparent_angle_for_point(painter.proj, radius[0]);
-        radius[1] = core_get_apparent_angle_for_point(painter.proj, radius[1]);
-        // Add some space, using ad-hoc formula.
-        line_truncate(&lines[i], radius[0] * 1.0 + 0.2 * DD2R,
-                                 radius[1] * 1.0 + 0.2 * DD2R);
-        if (cons->lines_animation)
-            line_animation_effect(&lines[i], visible * 2);
+    // The truncated line set only depends on the star positions, the
+    // projection scale and the animation factor: retain it between the
+    // frames so that rendering is just the paint_line calls.
+    scale = core_get_apparent_angle_for_point(painter.proj, 1.0);
+    anim = cons->lines_animation ? min(visible * 2, 1.0) : 1.0;
+    if (!con->lines || con->lines_update != con->last_update ||
+            con->lines_scale != scale || con->lines_anim != anim) {
+        if (!con->lines)
+            con->lines = calloc(con->count, sizeof(*con->lines));
+        memset(con->lines, 0, con->count * sizeof(*con->lines));
+        for (i = 0; i < con->count; i++) {
+            if (!con->stars[i]) continue;
+            vec3_copy(con->stars_pos[i], con->lines[i]);
+            con->lines[i][3] = 0; // To infinity.
+        }
+        for (i = 0; i < con->count; i += 2) {
+            if (!con->stars[i + 0] || !con->stars[i + 1]) continue;
+            obj_get_info(con->stars[i + 0], obs, INFO_VMAG, &mag[0]);
+            obj_get_info(con->stars[i + 1], obs, INFO_VMAG, &mag[1]);
+            core_get_point_for_mag(mag[0], &radius[0], NULL);
+            core_get_point_for_mag(mag[1], &radius[1], NULL);
+            radius[0] = radius[0] * scale;
+            radius[1] = radius[1] * scale;
+            // Add some space, using ad-hoc formula.
+            line_truncate(&con->lines[i], radius[0] * 1.0 + 0.2 * DD2R,
+                                          radius[1] * 1.0 + 0.2 * DD2R);
+            if (cons->lines_animation)
+                line_animation_effect(&con->lines[i], visible * 2);
+        }
+        con->lines_update = con->last_update;
+        con->lines_scale = scale;
+        con->lines_anim = anim;
     }
 
     for (i = 0; i < con->count; i += 2) {
         if (!con->stars[i + 0] || !con->stars[i + 1]) continue;
-        paint_line(&painter, FRAME_ICRF, lines + i, NULL, 1,
+        paint_line(&painter, FRAME_ICRF, con->lines + i, NULL, 1,
                    PAINTER_SKIP_DISCONTINUOUS);
     }
 
-    free(lines);
     return 0;
 }
 
@@ -581,7 +811,7 @@ static int render_img(constellation_t *con, const painter_t *painter_,
     }
     if (!painter.color[3]) return 0;
     // Skip if not ready yet.
-    if (!con->img.tex || !texture_load(con->img.tex, NULL)) return 0;
+    if (!con->img.tex) return 0;
     if (!con->img.mat[2][2]) return 0;
 
     if (painter_is_cap_clipped(&painter, FRAME_ICRF, con->img.cap))
@@ -594,7 +824,8 @@ static int render_img(constellation_t *con, const painter_t *painter_,
     painter.color[3] *= (selected ? 0.6 : 0.3) * con->image_loaded_fader.value;
     mat3_copy(con->img.mat, map.mat);
     map.map = img_map;
-    painter_set_texture(&painter, PAINTER_TEX_COLOR, con->img.tex, NULL);
+    painter_set_texture(&painter, PAINTER_TEX_COLOR, con->img.tex,
+                        con->img.uv_mat);
     paint_quad(&painter, FRAME_ICRF, &map, 4);
     return 0;
 }
@@ -715,7 +946,7 @@ static int render_label(constellation_t *con, const painter_t *painter_,
     return 0;
 }
 
-static bool constellation_is_visible(const constellation_t *con,
+static bool constellation_is_visible(constellation_t *con,
                                      const painter_t *painter)
 {
     const constellations_t *cons = (const constellations_t*)con->obj.parent;
@@ -781,11 +1012,24 @@ static void constellation_del(obj_t *obj)
     int i;
     constellation_t *con = (constellation_t*)obj;
     texture_release(con->img.tex);
+    if (con->img.loader) {
+        // If the decode is still running we cannot free the loader; better
+        // leak it than crash the worker.
+        if (!worker_is_running(&con->img.loader->worker)) {
+            free(con->img.loader->data);
+            free(con->img.loader->img);
+            free(con->img.loader);
+        }
+    }
     for (i = 0; i < con->count; i++) {
         obj_release(con->stars[i]);
     }
     free(con->stars);
     free(con->stars_pos);
+    free(con->lines);
+    free(con->view_pos);
+    free(con->bounds_pts);
+    free(con->bounds_ofs);
 }
 
 static void constellation_get_2d_ellipse(const obj_t *obj,
@@ -852,6 +1096,11 @@ static int constellations_update(obj_t *obj, double dt)
     fader_update(&cons->labels_visible, dt);
     fader_update(&cons->bounds_visible, dt);
 
+    // Load and pack the art images in the background, so that they are
+    // already in the atlas when the user turns the art on.
+    MODULE_ITER(obj, con, "constellation")
+        constellation_load_img(cons, con);
+
     // Skip update if not visible.
     if (cons->lines_visible.value == 0.0 &&
         cons->images_visible.value == 0.0 &&
@@ -910,12 +1159,34 @@ static json_value *constellation_get_json_data(const obj_t *obj)
  * Meta class declarations.
  */
 
+/*
+ * Bounding cap of the whole constellation (lines and image), so that
+ * obj_render can skip off screen constellations without even calling
+ * the render function.
+ */
+static bool constellation_get_bounding_cap(const obj_t *obj, int *frame,
+                                           double cap[4])
+{
+    const constellation_t *con = (const constellation_t*)obj;
+    *frame = FRAME_ICRF;
+    if (vec3_norm2(con->lines_cap) == 0) {
+        if (vec3_norm2(con->img.cap) == 0) return false;
+        vec4_copy(con->img.cap, cap);
+        return true;
+    }
+    vec4_copy(con->lines_cap, cap);
+    if (vec3_norm2(con->img.cap) != 0)
+        cap_union(cap, con->img.cap, cap);
+    return true;
+}
+
 static obj_klass_t constellation_klass = {
     .id             = "constellation",
     .size           = sizeof(constellation_t),
     .init           = constellation_init,
     .get_info       = constellation_get_info,
     .render         = constellation_render,
+    .get_bounding_cap = constellation_get_bounding_cap,
     .render_pointer = constellation_render_pointer,
     .del            = constellation_del,
     .get_json_data  = constellation_get_json_data,
@@ -939,6 +1210,8 @@ static obj_klass_t constellations_klass = {
     .get    = constellations_get,
     .get_by_oid = constellations_get_by_oid,
     .render_order = 25,
+    // Faders only: tolerate a coarser step when over budget.
+    .update_delay = 0.1,
     .attributes = (attribute_t[]) {
         PROPERTY(lines_visible, TYPE_BOOL,
                  MEMBER(constellations_t, lines_visible.target)),
@@ -18,30 +18,16 @@
 
 #define DSO_DEFAULT_VMAG 16.0
 
-/*
- * Type: dso_quick_data_t
- * Holds information used for clipping a DSO entry when rendering
- */
-typedef struct {
-    uint64_t oid;
-    double bounding_cap[4];
-    float  display_vmag;
-} dso_clip_data_t;
-
 /*
  * Type: dso_data_t
  * Holds information data about a single DSO entry
  */
 typedef struct {
-    union {
-        struct {
-            uint64_t oid;
-            double bounding_cap[4];
-            float  display_vmag;
-        };
-        dso_clip_data_t clip_data;
-    };
+    uint64_t    oid;
+    double      bounding_cap[4];
+    float       display_vmag;
     char        type[4];
+    uint8_t     otype_n[4]; // Otype classification digits (0 if unknown).
     float       ra;     // ra equ J2000
     float       de;     // de equ J2000
 
@@ -54,6 +40,11 @@ typedef struct {
     char *morpho;
     // List of extra names, separated by '\0', terminated by two '\0'.
     char *names;
+    // For tile sources the two strings above stay NULL until the tile
+    // designations block is inflated (see tile_ensure_names); these are
+    // the offsets inside the block (-1 if none).
+    int names_ofs;
+    int morpho_ofs;
     float  vmag;
 } dso_data_t;
 
@@ -75,8 +66,23 @@ typedef struct tile {
     double      mag_min;
     double      mag_max;
     int         nb;
-    dso_data_t  *sources;
-    dso_clip_data_t *sources_quick;
+    uint32_t    otype_mask; // Or-ed otype category masks of the sources.
+    dso_data_t  *sources;   // Sorted by display magnitude.
+    // SoA mirror of the clipping data of the sources, in the same
+    // order: the render loop binary searches the magnitude cutoff in
+    // the sorted vmags array, then runs the cap clipping over compact
+    // memory before paying the full render path.
+    float       *vmags;
+    double      (*caps)[4];
+
+    // Designations (ids and morpho strings) of all the sources, kept
+    // compressed and only inflated the first time a source of the tile
+    // actually needs them: selection, label rendering or listing.  Most
+    // tiles never pay the memory of their designations.
+    void        *names_comp;        // Compressed block (owned).
+    int         names_comp_size;
+    int         names_size;         // Uncompressed size.
+    char        *names_buf;         // Inflated block, NULL until needed.
 } tile_t;
 
 typedef struct survey survey_t;
@@ -243,6 +249,7 @@ static int dso_init(obj_t *obj, json_value *args)
         if (jstr->type == json_string) {
             strncpy(dso->data.type, jstr->u.string.ptr, 4);
             dso->data.symbol = symbols_get_for_otype(dso->data.type);
+            otype_get_digits(dso->data.type, dso->data.otype_n);
         }
     }
     return 0;
@@ -261,18 +268,50 @@ static void strip_type(char str[4])
 // Used by the cache.
 static int del_tile(void *data)
 {
-    int i;
     tile_t *tile = data;
-    for (i = 0; i < tile->nb; i++) {
-        free(tile->sources[i].names);
-        free(tile->sources[i].morpho);
-    }
     free(tile->sources);
-    free(tile->sources_quick);
+    free(tile->vmags);
+    free(tile->caps);
+    free(tile->names_comp);
+    free(tile->names_buf);
     free(tile);
     return 0;
 }
 
+/*
+ * Inflate the designations block of a tile and fix up the sources
+ * string pointers.  Called lazily the first time a source of the tile
+ * needs its designations.
+ */
+static void tile_ensure_names(tile_t *tile)
+{
+    int i;
+    dso_data_t *s;
+    const char *n;
+
+    if (tile->names_buf || !tile->names_comp) return;
+    tile->names_buf = malloc(tile->names_size);
+    if (z_uncompress(tile->names_buf, tile->names_size,
+                     tile->names_comp, tile->names_comp_size)) {
+        LOG_E("Cannot uncompress DSO designations");
+        free(tile->names_buf);
+        tile->names_buf = NULL;
+        free(tile->names_comp);
+        tile->names_comp = NULL;
+        return;
+    }
+    for (i = 0; i < tile->nb; i++) {
+        s = &tile->sources[i];
+        if (s->names_ofs >= 0) {
+            s->names = tile->names_buf + s->names_ofs;
+            // Feed the designations to the type-ahead search index.
+            for (n = s->names; *n; n += strlen(n) + 1)
+                search_index_add(n);
+        }
+        if (s->morpho_ofs >= 0) s->morpho = tile->names_buf + s->morpho_ofs;
+    }
+}
+
 static int dso_data_cmp(const void *a, const void *b)
 {
     return cmp(((const dso_data_t*)a)->display_vmag,
@@ -286,8 +325,10 @@ static int on_file_tile_loaded(const char type[4],
 {
     tile_t *tile;
     dso_data_t *s;
-    int nb, i, j, version, data_ofs = 0, flags, row_size, order, pix;
+    int nb, i, j, len, version, data_ofs = 0, flags, row_size, order, pix;
     int children_mask;
+    UT_string names_blk;
+    uLongf comp_size;
     char morpho[32], ids[256] = {};
     double bmag, temp_mag, tmp_ra, tmp_de, tmp_smax, tmp_smin, tmp_angle;
     void *tile_data;
@@ -334,6 +375,7 @@ static int on_file_tile_loaded(const char type[4],
     tile->nb = nb;
 
     tile->sources = calloc(tile->nb, sizeof(dso_data_t));
+    utstring_init(&names_blk);
 
     for (i = 0; i < tile->nb; i++) {
         s = &tile->sources[i];
@@ -367,25 +409,52 @@ static int on_file_tile_loaded(const char type[4],
         tile->mag_max = max(tile->mag_max, s->display_vmag);
         nuniq = pix_to_nuniq(order, pix);
         s->oid = make_oid(survey->idx, nuniq, i);
-
-        if (*morpho) s->morpho = strdup(morpho);
         s->symbol = symbols_get_for_otype(s->type);
-
-        // Turn '|' separated ids into '\0' separated values.
+        otype_get_digits(s->type, s->otype_n);
+        tile->otype_mask |= otype_category_mask(s->type);
+
+        // Append the designations to the tile block, only keeping the
+        // offsets in the source.
+        s->names_ofs = -1;
+        s->morpho_ofs = -1;
+        if (*morpho) {
+            s->morpho_ofs = utstring_len(&names_blk);
+            utstring_bincpy(&names_blk, morpho, strlen(morpho) + 1);
+        }
         if (*ids) {
-            s->names = calloc(1, 2 + strlen(ids));
-            for (j = 0; ids[j]; j++)
-                s->names[j] = ids[j] != '|' ? ids[j] : '\0';
+            // Turn '|' separated ids into '\0' separated values.
+            len = strlen(ids);
+            for (j = 0; j < len; j++)
+                if (ids[j] == '|') ids[j] = '\0';
+            s->names_ofs = utstring_len(&names_blk);
+            utstring_bincpy(&names_blk, ids, len + 1);
+            utstring_bincpy(&names_blk, "", 1); // Extra '\0' at the end.
         }
     }
     free(tile_data);
 
+    // Keep the designations compressed until a source actually needs
+    // them (see tile_ensure_names).
+    if (utstring_len(&names_blk)) {
+        tile->names_size = utstring_len(&names_blk);
+        comp_size = compressBound(tile->names_size);
+        tile->names_comp = malloc(comp_size);
+        compress(tile->names_comp, &comp_size,
+                 (const Bytef*)utstring_body(&names_blk), tile->names_size);
+        tile->names_comp = realloc(tile->names_comp, comp_size);
+        tile->names_comp_size = comp_size;
+    }
+    utstring_done(&names_blk);
+
     // Sort DSO in tile by display magnitude
     qsort(tile->sources, tile->nb, sizeof(dso_data_t), dso_data_cmp);
-    // Create a small table with all data used for fast tile iteration
-    tile->sources_quick = calloc(tile->nb, sizeof(dso_clip_data_t));
-    for (i = 0; i < tile->nb; ++i)
-        tile->sources_quick[i] = tile->sources[i].clip_data;
+    // Build the SoA clipping arrays used for fast tile iteration
+    tile->vmags = calloc(tile->nb, sizeof(*tile->vmags));
+    tile->caps = calloc(tile->nb, sizeof(*tile->caps));
+    for (i = 0; i < tile->nb; ++i) {
+        tile->vmags[i] = tile->sources[i].display_vmag;
+        vec4_copy(tile->sources[i].bounding_cap, tile->caps[i]);
+    }
 
     // If we have a json header, check for a children mask value.
     if (json) {
@@ -490,7 +559,8 @@ static bool dso_get_short_name(const dso_data_t *s, char *out, int size)
 
     best_name[0] = '\0';
     while (*names) {
-        designation_cleanup(names, out, size, DSGN_TRANSLATE);
+        snprintf(out, size, "%s",
+                 designation_cleanup_cached(names, DSGN_TRANSLATE));
         len = strlen(out);
         if (len < 12) {
             return true;
@@ -510,8 +580,7 @@ static bool dso_get_short_name(const dso_data_t *s, char *out, int size)
 }
 
 
-static void dso_render_label(const dso_data_t *s2, const dso_clip_data_t *s,
-                             const painter_t *painter,
+static void dso_render_label(const dso_data_t *s, const painter_t *painter,
                              const double win_size[2], double win_angle)
 {
     const bool selected = core->selection && s->oid == core->selection->oid;
@@ -531,7 +600,7 @@ static void dso_render_label(const dso_data_t *s2, const dso_clip_data_t *s,
                  fabs(cos(win_angle)) *
                  fabs(win_size[0] / 2 - win_size[1] / 2);
     radius += 1;
-    dso_get_short_name(s2, buf, sizeof(buf));
+    dso_get_short_name(s, buf, sizeof(buf));
     if (buf[0]) {
         labels_add_3d(buf, FRAME_ASTROM, s->bounding_cap, true, radius,
                       FONT_SIZE_BASE - 2, color, 0, 0, effects,
@@ -540,9 +609,10 @@ static void dso_render_label(const dso_data_t *s2, const dso_clip_data_t *s,
 }
 
 
-// Render a DSO from its data.
-static int dso_render_from_data(const dso_data_t *s2, const dso_clip_data_t *s,
-                                const painter_t *painter, uint64_t hint)
+// Render a DSO from its data.  tile can be NULL for a standalone DSO: it
+// is only used to inflate the designations block on demand.
+static int dso_render_from_data(const dso_data_t *s, const painter_t *painter,
+                                uint64_t hint, tile_t *tile)
 {
     PROFILE(dso_render_from_data, PROFILE_AGGREGATE);
     double color[4];
@@ -566,13 +636,13 @@ static int dso_render_from_data(const dso_data_t *s2, const dso_clip_data_t *s,
 
     // Special case for Open Clusters, for which the limiting magnitude
     // is more like the one for a star.
-    if (s2->symbol == SYMBOL_OPEN_GALACTIC_CLUSTER ||
-        s2->symbol == SYMBOL_CLUSTER_OF_STARS ||
-        s2->symbol == SYMBOL_MULTIPLE_DEFAULT) {
+    if (s->symbol == SYMBOL_OPEN_GALACTIC_CLUSTER ||
+        s->symbol == SYMBOL_CLUSTER_OF_STARS ||
+        s->symbol == SYMBOL_MULTIPLE_DEFAULT) {
         hints_limit_mag = painter->hints_limit_mag - 2. + hints_mag_offset;
     }
 
-    if (s2->smax == 0) {
+    if (s->smax == 0) {
         // DSO without shape don't need to have labels displayed unless they are
         // much zoomed or selected
         hints_limit_mag = painter->stars_limit_mag - 10 + hints_mag_offset;
@@ -584,8 +654,8 @@ static int dso_render_from_data(const dso_data_t *s2, const dso_clip_data_t *s,
     if (vmag > hints_limit_mag + 2)
         return 0;
 
-    compute_hint_transformation(painter, s2->ra, s2->de, s2->angle,
-            s2->smax, s2->smin, s2->symbol, win_pos, win_size,
+    compute_hint_transformation(painter, s->ra, s->de, s->angle,
+            s->smax, s->smin, s->symbol, win_pos, win_size,
             &win_angle);
 
     // Skip if 2D circle is outside screen (TODO intersect 2D ellipse instead)
@@ -622,15 +692,16 @@ static int dso_render_from_data(const dso_data_t *s2, const dso_clip_data_t *s,
             vec4_set(color, 0.45, 0.83, 1, 0.5* opacity);
         }
         if (color[3] > 0.05) {
-            if (isnan(s2->angle) || s2->smin == 0 || s2->smin == s2->smax)
+            if (isnan(s->angle) || s->smin == 0 || s->smin == s->smax)
                 win_angle = 0;
-            symbols_paint(&tmp_painter, s2->symbol, win_pos, win_size, color,
+            symbols_paint(&tmp_painter, s->symbol, win_pos, win_size, color,
                           win_angle);
         }
     }
 
     if (vmag <= hints_limit_mag - 1.) {
-        dso_render_label(s2, s, painter, win_size, win_angle);
+        if (tile) tile_ensure_names(tile);
+        dso_render_label(s, painter, win_size, win_angle);
     }
     return 0;
 }
@@ -638,7 +709,7 @@ static int dso_render_from_data(const dso_data_t *s2, const dso_clip_data_t *s,
 static int dso_render(const obj_t *obj, const painter_t *painter)
 {
     const dso_t *dso = (const dso_t*)obj;
-    return dso_render_from_data(&dso->data, &dso->data.clip_data, painter, 0);
+    return dso_render_from_data(&dso->data, painter, 0, NULL);
 }
 
 void dso_get_designations(
@@ -663,7 +734,8 @@ static int render_visitor(int order, int pix, void *user)
     int *nb_loaded = USER_GET(user, 3);
     survey_t *survey = USER_GET(user, 4);
     tile_t *tile;
-    int i, ret, code;
+    int i, lo, hi, mid, code;
+    double cutoff;
     uint64_t hint;
 
     // Early exit if the tile is clipped.
@@ -678,11 +750,25 @@ static int render_visitor(int order, int pix, void *user)
     if (tile->mag_min > painter.stars_limit_mag + 1.5) return 0;
 
     hint = pix_to_nuniq(order, pix);
-    for (i = 0; i < tile->nb; i++) {
-        ret = dso_render_from_data(&tile->sources[i], &tile->sources_quick[i],
-                                   &painter, hint);
-        if (ret)
-            break;
+    // Binary search the magnitude cutoff in the sorted vmags array, so
+    // that we never even look at the sources too faint for the current
+    // settings.
+    cutoff = min(painter.stars_limit_mag + 1.5, painter.hard_limit_mag);
+    lo = 0;
+    hi = tile->nb;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (tile->vmags[mid] > cutoff)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    // Clip the plausible candidates over the compact caps array before
+    // paying the full render path.
+    for (i = 0; i < lo; i++) {
+        if (painter_is_cap_clipped(&painter, FRAME_ASTROM, tile->caps[i]))
+            continue;
+        dso_render_from_data(&tile->sources[i], &painter, hint, tile);
     }
     if (tile->mag_max > painter.stars_limit_mag + 1.5) return 0;
     return 1;
@@ -728,6 +814,7 @@ static int dsos_get_visitor(int order, int pix, void *user)
         if (!tile) continue;
         for (i = 0; i < tile->nb; i++) {
             if (d->cat == 4 && tile->sources[i].oid == d->n) {
+                tile_ensure_names(tile);
                 d->ret = &dso_create(&tile->sources[i])->obj;
                 return -1; // Stop the search.
             }
@@ -792,6 +879,7 @@ static obj_t *dsos_get_by_oid(const obj_t *obj, uint64_t oid, uint64_t hint)
         if (!tile) continue;
         for (i = 0; i < tile->nb; i++) {
             if (tile->sources[i].oid == oid) {
+                tile_ensure_names(tile);
                 return (obj_t*)dso_create(&tile->sources[i]);
             }
         }
@@ -799,19 +887,39 @@ static obj_t *dsos_get_by_oid(const obj_t *obj, uint64_t oid, uint64_t hint)
     return NULL;
 }
 
+// Test a tile source against a type filter, using the precomputed
+// classification digits (see dsos_list).
+static bool dso_match_type(const dso_data_t *s, const char *type,
+                           const uint8_t match_n[4])
+{
+    if (strncmp(s->type, type, 4) == 0) return true;
+    return otype_match_digits(s->otype_n, match_n);
+}
+
 static int dsos_list(const obj_t *obj,
                      double max_mag, uint64_t hint, const char *source,
+                     const char *type, module_list_cursor_t *cursor,
                      void *user, int (*f)(void *user, obj_t *obj))
 {
     int order, pix, i, r, code;
+    uint64_t nuniq;
     dsos_t *dsos = (dsos_t*)obj;
     dso_t *dso;
     tile_t *tile;
     hips_iterator_t iter;
     survey_t *survey = NULL;
     double vmag;
+    uint8_t match_n[4] = {};
+    uint32_t tile_mask = (uint32_t)-1;
 
     if (isnan(max_mag)) max_mag = DBL_MAX;
+    // Precompute the filter type digits and category mask once: the per
+    // tile masks let us skip whole tiles, and the per source test is then
+    // a plain digits comparison.
+    if (type) {
+        if (otype_get_digits(type, match_n) && match_n[0] != 0)
+            tile_mask = 1u << match_n[0];
+    }
     // Find the survey corresponding to the source.  If we don't find it,
     // default to the first survey.
     if (source) {
@@ -828,17 +936,40 @@ static int dsos_list(const obj_t *obj,
         while (hips_iter_next(&iter, &order, &pix)) {
             tile = get_tile(dsos, survey, order, pix, false, &code);
             if (!tile || tile->mag_min >= max_mag) continue;
-            for (i = 0; i < tile->nb; i++) {
-                vmag = tile->sources[i].vmag;
-                if (!isnan(vmag) && vmag > max_mag) continue;
-                dso = dso_create(&tile->sources[i]);
-                r = f(user, (obj_t*)dso);
-                obj_release((obj_t*)dso);
-                if (r) break;
+            // Skip whole tiles that contain no object of the proper
+            // category (but still consider their children).
+            if (type && !(tile->otype_mask & tile_mask)) {
+                hips_iter_push_children(&iter, order, pix);
+                continue;
+            }
+            /* The iteration visits the tiles by increasing nuniq value,
+             * so a cursor can resume by skipping the already listed
+             * tiles. */
+            nuniq = pix + 4 * (1ULL << (2 * order));
+            if (!cursor || nuniq >= cursor->tile) {
+                i = (cursor && nuniq == cursor->tile) ? cursor->index : 0;
+                for (; i < tile->nb; i++) {
+                    vmag = tile->sources[i].vmag;
+                    if (!isnan(vmag) && vmag > max_mag) continue;
+                    if (type &&
+                            !dso_match_type(&tile->sources[i], type, match_n))
+                        continue;
+                    tile_ensure_names(tile);
+                    dso = dso_create(&tile->sources[i]);
+                    r = f(user, (obj_t*)dso);
+                    obj_release((obj_t*)dso);
+                    if (r) {
+                        if (cursor) {
+                            cursor->tile = nuniq;
+                            cursor->index = i + 1;
+                        }
+                        return 0;
+                    }
+                }
             }
-            if (i < tile->nb) break;
             hips_iter_push_children(&iter, order, pix);
         }
+        if (cursor) cursor->done = true;
         return 0;
     }
 
@@ -849,12 +980,20 @@ static int dsos_list(const obj_t *obj,
         if (!code) return MODULE_AGAIN; // Try again later.
         return -1;
     }
-    for (i = 0; i < tile->nb; i++) {
+    if (type && !(tile->otype_mask & tile_mask)) return 0;
+    for (i = cursor ? cursor->index : 0; i < tile->nb; i++) {
+        if (type && !dso_match_type(&tile->sources[i], type, match_n))
+            continue;
+        tile_ensure_names(tile);
         dso = dso_create(&tile->sources[i]);
         r = f(user, (obj_t*)dso);
         obj_release((obj_t*)dso);
-        if (r) break;
+        if (r) {
+            if (cursor) cursor->index = i + 1;
+            return 0;
+        }
     }
+    if (cursor) cursor->done = true;
     return 0;
 }
 
@@ -871,6 +1010,8 @@ static int dsos_add_data_source(obj_t *obj, const char *url, const char *key)
     survey = calloc(1, sizeof(*survey));
     survey_settings.user = survey;
     survey->hips = hips_create(url, 0, &survey_settings);
+    // Catalog tiles go in front of the imagery surveys.
+    hips_set_priority(survey->hips, ASSET_PRIORITY_HIGH);
     survey->idx = idx;
     if (key)
         snprintf(survey->key, sizeof(survey->key), "%s", key);
@@ -888,6 +1029,8 @@ static obj_klass_t dso_klass = {
     .init = dso_init,
     .get_json_data = dso_get_json_data,
     .get_info = dso_get_info,
+    // The vmag comes straight from the catalog.
+    .info_time_invariant = 1 << (INFO_VMAG / 1024),
     .render = dso_render,
     .get_designations = dso_get_designations,
     .get_2d_ellipse = dso_get_2d_ellipse,
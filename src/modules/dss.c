@@ -98,6 +98,8 @@ static int dss_add_data_source(obj_t *obj, const char *url, const char *key)
     dss_t *dss = (dss_t*)obj;
     hips_delete(dss->hips);
     dss->hips = hips_create(url, 0, NULL);
+    // Background imagery: never delay the catalog tiles.
+    hips_set_priority(dss->hips, ASSET_PRIORITY_LOW);
     return 0;
 }
 
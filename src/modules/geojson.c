@@ -13,6 +13,8 @@
 
 #include "utils/mesh.h"
 
+#include <zlib.h> // For crc32.
+
 typedef struct feature feature_t;
 
 struct feature {
@@ -29,6 +31,29 @@ struct feature {
     float       text_offset[2];
     bool        hidden;
     bool        blink;
+    // Union of the meshes caps, so that an off screen feature is
+    // rejected before any projection or mesh work.
+    double      bounding_cap[4];
+    // Hash of the geometry, used to match the features across data
+    // updates, so a style-only change reuses the tessellated meshes.
+    uint32_t    geo_hash;
+};
+
+/*
+ * Struct: pending_poly_t
+ * A polygon mesh whose triangulation has been deferred.
+ *
+ * The triangulations are processed with a time budget at the beginning
+ * of each render, so that loading a layer with complex multipolygons
+ * doesn't block a frame: the features appear as their meshes complete.
+ */
+typedef struct pending_poly pending_poly_t;
+struct pending_poly {
+    pending_poly_t *next, *prev;
+    mesh_t      *mesh;
+    int         nb_rings;
+    int         rings_ofs;
+    int         rings_size[8];
 };
 
 /*
@@ -44,6 +69,13 @@ typedef struct image {
     feature_t   *features;
     int         frame;
     int         (*filter)(int idx, float fill_color[4], float stroke_color[4]);
+
+    // Polygon meshes not yet triangulated.
+    pending_poly_t *pending;
+
+    // Bounding cap of all the features, recomputed when dirty.
+    double      bounding_cap[4];
+    bool        cap_dirty;
 } image_t;
 
 
@@ -54,12 +86,14 @@ static int image_init(obj_t *obj, json_value *args)
     return 0;
 }
 
-static void feature_add_geo(feature_t *feature, const geojson_geometry_t *geo)
+static void feature_add_geo(image_t *image, feature_t *feature,
+                            const geojson_geometry_t *geo)
 {
     const double (*coordinates)[2];
     int i, size, ofs;
     int rings_ofs = 0, rings_size[8];
     mesh_t *mesh;
+    pending_poly_t *pending;
     geojson_geometry_t poly;
 
     switch (geo->type) {
@@ -77,11 +111,14 @@ static void feature_add_geo(feature_t *feature, const geojson_geometry_t *geo)
             mesh_add_line(mesh, ofs, size);
             rings_size[i] = size;
         }
-        mesh_add_poly(mesh, geo->polygon.size, rings_ofs, rings_size);
-
-        // For testing.  We want to avoid meshes with too long edges
-        // for the distortion.
-        mesh_subdivide(mesh, M_PI / 8);
+        // Defer the triangulation: it is done with a time budget at
+        // render time, so a complex layer doesn't block the frame.
+        pending = calloc(1, sizeof(*pending));
+        pending->mesh = mesh;
+        pending->nb_rings = geo->polygon.size;
+        pending->rings_ofs = rings_ofs;
+        memcpy(pending->rings_size, rings_size, sizeof(rings_size));
+        DL_APPEND(image->pending, pending);
 
         DL_APPEND(feature->meshes, mesh);
         return;
@@ -93,7 +130,7 @@ static void feature_add_geo(feature_t *feature, const geojson_geometry_t *geo)
         for (i = 0; i < geo->multipolygon.size; i++) {
             poly.type = GEOJSON_POLYGON;
             poly.polygon = geo->multipolygon.polygons[i];
-            feature_add_geo(feature, &poly);
+            feature_add_geo(image, feature, &poly);
         }
         return;
     default:
@@ -107,6 +144,79 @@ static void feature_add_geo(feature_t *feature, const geojson_geometry_t *geo)
     DL_APPEND(feature->meshes, mesh);
 }
 
+// Hash of a geometry, to match the features across data updates.
+static uint32_t geometry_hash(const geojson_geometry_t *geo)
+{
+    const geojson_polygon_t *poly;
+    uint32_t crc;
+    int i, j;
+
+    crc = crc32(0, (const void*)&geo->type, sizeof(geo->type));
+    switch (geo->type) {
+    case GEOJSON_LINESTRING:
+        crc = crc32(crc, (const void*)geo->linestring.coordinates,
+                    geo->linestring.size *
+                    sizeof(*geo->linestring.coordinates));
+        break;
+    case GEOJSON_POINT:
+        crc = crc32(crc, (const void*)geo->point.coordinates,
+                    sizeof(geo->point.coordinates));
+        break;
+    case GEOJSON_POLYGON:
+        for (i = 0; i < geo->polygon.size; i++)
+            crc = crc32(crc, (const void*)geo->polygon.rings[i].coordinates,
+                        geo->polygon.rings[i].size *
+                        sizeof(*geo->polygon.rings[i].coordinates));
+        break;
+    case GEOJSON_MULTIPOLYGON:
+        for (i = 0; i < geo->multipolygon.size; i++) {
+            poly = &geo->multipolygon.polygons[i];
+            for (j = 0; j < poly->size; j++)
+                crc = crc32(crc, (const void*)poly->rings[j].coordinates,
+                            poly->rings[j].size *
+                            sizeof(*poly->rings[j].coordinates));
+        }
+        break;
+    default:
+        break;
+    }
+    return crc;
+}
+
+// Recompute the bounding cap of a feature from its meshes.
+static void feature_update_cap(feature_t *feature)
+{
+    const mesh_t *mesh;
+    bool first = true;
+
+    vec4_set(feature->bounding_cap, 1, 0, 0, -1);
+    for (mesh = feature->meshes; mesh; mesh = mesh->next) {
+        if (first) {
+            vec4_copy(mesh->bounding_cap, feature->bounding_cap);
+            first = false;
+        } else {
+            cap_union(feature->bounding_cap, mesh->bounding_cap,
+                      feature->bounding_cap);
+        }
+    }
+}
+
+// Set the style attributes of a feature (everything but the geometry).
+static void feature_update_style(feature_t *feature,
+                                 const geojson_feature_properties_t *props)
+{
+    vec3_copy(props->fill, feature->fill_color);
+    vec3_copy(props->stroke, feature->stroke_color);
+    feature->fill_color[3] = props->fill_opacity;
+    feature->stroke_color[3] = props->stroke_opacity;
+    feature->stroke_width = props->stroke_width;
+    free(feature->title);
+    feature->title = props->title ? strdup(props->title) : NULL;
+    feature->text_anchor = props->text_anchor;
+    feature->text_rotate = props->text_rotate;
+    vec2_copy(props->text_offset, feature->text_offset);
+}
+
 static void add_geojson_feature(image_t *image,
                                 const geojson_feature_t *geo_feature)
 {
@@ -117,19 +227,32 @@ static void add_geojson_feature(image_t *image,
     feature->frame = image->frame;
     feature->obj.oid = oid_create("GEOF", g_id++);
 
-    vec3_copy(geo_feature->properties.fill, feature->fill_color);
-    vec3_copy(geo_feature->properties.stroke, feature->stroke_color);
-    feature->fill_color[3] = geo_feature->properties.fill_opacity;
-    feature->stroke_color[3] = geo_feature->properties.stroke_opacity;
-    feature->stroke_width = geo_feature->properties.stroke_width;
-    if (geo_feature->properties.title)
-        feature->title = strdup(geo_feature->properties.title);
-    feature->text_anchor = geo_feature->properties.text_anchor;
-    feature->text_rotate = geo_feature->properties.text_rotate;
-    vec2_copy(geo_feature->properties.text_offset, feature->text_offset);
-
-    feature_add_geo(feature, &geo_feature->geometry);
+    feature_update_style(feature, &geo_feature->properties);
+    feature->geo_hash = geometry_hash(&geo_feature->geometry);
+
+    feature_add_geo(image, feature, &geo_feature->geometry);
+    feature_update_cap(feature);
     DL_APPEND(image->features, feature);
+    image->cap_dirty = true;
+}
+
+// Budget (s) of deferred triangulation work per frame.
+#define TRIANGULATE_BUDGET_S (4. / 1000)
+
+static void image_process_pending(image_t *image)
+{
+    pending_poly_t *pending;
+    double t;
+
+    if (!image->pending) return;
+    t = sys_get_unix_time();
+    while ((pending = image->pending)) {
+        mesh_add_poly(pending->mesh, pending->nb_rings,
+                      pending->rings_ofs, pending->rings_size);
+        DL_DELETE(image->pending, pending);
+        free(pending);
+        if (sys_get_unix_time() - t > TRIANGULATE_BUDGET_S) break;
+    }
 }
 
 static void feature_del(obj_t *obj)
@@ -164,12 +287,62 @@ EMSCRIPTEN_KEEPALIVE
 void geojson_remove_all_features(image_t *image)
 {
     feature_t *feature;
-
+    pending_poly_t *pending;
+
+    // Drop the deferred triangulations: the meshes are owned by the
+    // features we are about to delete.
+    while (image->pending) {
+        pending = image->pending;
+        DL_DELETE(image->pending, pending);
+        free(pending);
+    }
     while (image->features) {
         feature = image->features;
         DL_DELETE(image->features, feature);
         obj_release(&feature->obj);
     }
+    image->cap_dirty = true;
+}
+
+// Delete a single feature, dropping its deferred triangulations.
+static void image_discard_feature(image_t *image, feature_t *feature)
+{
+    pending_poly_t *pending, *tmp;
+    const mesh_t *mesh;
+
+    DL_FOREACH_SAFE(image->pending, pending, tmp) {
+        for (mesh = feature->meshes; mesh; mesh = mesh->next) {
+            if (pending->mesh == mesh) {
+                DL_DELETE(image->pending, pending);
+                free(pending);
+                break;
+            }
+        }
+    }
+    obj_release(&feature->obj);
+}
+
+/*
+ * Add a feature from a new version of the data, reusing the features of
+ * the previous version when only the style changed: a feature of 'old'
+ * with the same geometry keeps its tessellated meshes (and so its
+ * retained renderer buffers), only its style is updated.
+ */
+static void image_upsert_feature(image_t *image, feature_t **old,
+                                 const geojson_feature_t *geo_feature)
+{
+    feature_t *feature;
+    uint32_t hash = geometry_hash(&geo_feature->geometry);
+
+    for (feature = *old; feature; feature = feature->next)
+        if (feature->geo_hash == hash) break;
+    if (feature) {
+        DL_DELETE(*old, feature);
+        feature_update_style(feature, &geo_feature->properties);
+        DL_APPEND(image->features, feature);
+    } else {
+        add_geojson_feature(image, geo_feature);
+    }
 }
 
 // XXX: deprecated: we use filter_all instead now!
@@ -192,21 +365,173 @@ static json_value *data_fn(obj_t *obj, const attribute_t *attr,
     geojson_t *geojson;
     int i;
 
+    feature_t *old;
+
     if (!args) return NULL;
-    geojson_remove_all_features(image);
     geojson = geojson_parse(args);
     if (!geojson) {
         LOG_E("Cannot parse geojson");
         return NULL;
     }
+    // Match the new features against the current ones, so that a style
+    // only change doesn't re-tessellate the geometry.
+    old = image->features;
+    image->features = NULL;
     for (i = 0; i < geojson->nb_features; i++) {
-        add_geojson_feature(image, &geojson->features[i]);
+        image_upsert_feature(image, &old, &geojson->features[i]);
+    }
+    while (old) {
+        feature_t *feature = old;
+        DL_DELETE(old, feature);
+        image_discard_feature(image, feature);
     }
+    image->cap_dirty = true;
     geojson_delete(geojson);
     apply_filter(image);
     return NULL;
 }
 
+typedef struct {
+    image_t     *image;
+    feature_t   *old;
+} streamed_data_t;
+
+static int streamed_feature_fn(void *user, const geojson_feature_t *feature)
+{
+    streamed_data_t *data = user;
+    image_upsert_feature(data->image, &data->old, feature);
+    return 0;
+}
+
+/*
+ * Set the geojson data from the raw text, streaming the features.
+ *
+ * Unlike setting the 'data' attribute this never builds a dom of the
+ * whole document, so it should be used for the very large files (e.g.
+ * survey footprints): the peak memory stays in the order of the largest
+ * feature.
+ */
+EMSCRIPTEN_KEEPALIVE
+int geojson_set_data_str(image_t *image, const char *str)
+{
+    int nb;
+    feature_t *feature;
+    streamed_data_t data = {.image = image};
+
+    data.old = image->features;
+    image->features = NULL;
+    nb = geojson_parse_str_stream(str, &data, streamed_feature_fn);
+    while (data.old) {
+        feature = data.old;
+        DL_DELETE(data.old, feature);
+        image_discard_feature(image, feature);
+    }
+    image->cap_dirty = true;
+    if (nb < 0) {
+        LOG_E("Cannot parse geojson");
+        return -1;
+    }
+    apply_filter(image);
+    return 0;
+}
+
+/*
+ * Load one 'MESH' chunk of a binary mesh file: a pre-tessellated and
+ * pre-subdivided feature, so nothing but the decode runs on the client.
+ *
+ * Chunk layout (see tools/make-geojson-mesh.py, which writes it):
+ *   tile header       - version + healpix nuniq (eph_read_tile_header).
+ *   9 float32         - fill rgba, stroke rgba, stroke width.
+ *   int32 + chars     - title length (can be zero) and title.
+ *   compressed block  - int32 x 3: vertices, triangles and lines counts,
+ *                       then the vertices as int32 lon/lat pairs
+ *                       (unit: 1e-7 degree), then the triangles and
+ *                       lines as uint16 indices.
+ */
+static int mesh_chunk_fn(const char type[4], const void *data, int size,
+                         const json_value *json, void *user)
+{
+    image_t *image = user;
+    feature_t *feature;
+    mesh_t *mesh;
+    static uint32_t g_id = 1;
+    int i, data_ofs = 0, version, order, pix, block_size, title_len;
+    int counts[3]; // Vertices, triangles and lines counts.
+    float style[9];
+    void *block;
+    const int32_t *q;
+    const uint8_t *indices;
+    double (*verts)[2];
+
+    if (strncmp(type, "MESH", 4) != 0) return 0;
+    eph_read_tile_header(data, size, &data_ofs, &version, &order, &pix);
+
+    feature = (void*)obj_create("geojson-feature", NULL, NULL);
+    feature->frame = image->frame;
+    feature->obj.oid = oid_create("GEOF", g_id++);
+
+    memcpy(style, data + data_ofs, sizeof(style));
+    data_ofs += sizeof(style);
+    memcpy(feature->fill_color, style + 0, sizeof(feature->fill_color));
+    memcpy(feature->stroke_color, style + 4, sizeof(feature->stroke_color));
+    feature->stroke_width = style[8];
+    memcpy(&title_len, data + data_ofs, 4);
+    data_ofs += 4;
+    if (title_len) {
+        feature->title = strndup(data + data_ofs, title_len);
+        feature->text_anchor = GEOJSON_ANCHOR_CENTER | GEOJSON_ANCHOR_MIDDLE;
+        data_ofs += title_len;
+    }
+
+    block = eph_read_compressed_block(data, size, &data_ofs, &block_size);
+    if (!block) {
+        obj_release((void*)feature);
+        return -1;
+    }
+    memcpy(counts, block, sizeof(counts));
+    q = (const int32_t*)(block + sizeof(counts));
+    verts = malloc(counts[0] * sizeof(*verts));
+    for (i = 0; i < counts[0]; i++) {
+        verts[i][0] = q[i * 2 + 0] * 1e-7 * DD2R;
+        verts[i][1] = q[i * 2 + 1] * 1e-7 * DD2R;
+    }
+    mesh = calloc(1, sizeof(*mesh));
+    mesh_add_vertices_lonlat(mesh, counts[0], verts);
+    free(verts);
+    indices = (const uint8_t*)&q[counts[0] * 2];
+    mesh_add_triangles(mesh, counts[1], (const uint16_t*)indices);
+    indices += counts[1] * 2;
+    mesh_add_segments(mesh, counts[2], (const uint16_t*)indices);
+    free(block);
+
+    DL_APPEND(feature->meshes, mesh);
+    feature_update_cap(feature);
+    DL_APPEND(image->features, feature);
+    return 0;
+}
+
+/*
+ * Set the layer content from a binary mesh file ('MESH' eph chunks, as
+ * written by tools/make-geojson-mesh.py).
+ *
+ * The meshes are pre-tessellated and pre-subdivided offline, so this is
+ * much faster than parsing the equivalent geojson text.  Each chunk
+ * records the healpix tile of its feature: a converter splitting a
+ * layer per tile lets the client only feed the tiles covering the view.
+ */
+EMSCRIPTEN_KEEPALIVE
+int geojson_set_mesh_data(image_t *image, const void *data, int size)
+{
+    geojson_remove_all_features(image);
+    if (eph_load(data, size, image, mesh_chunk_fn) != 0) {
+        LOG_E("Cannot parse mesh data");
+        return -1;
+    }
+    image->cap_dirty = true;
+    apply_filter(image);
+    return 0;
+}
+
 static json_value *filter_fn(obj_t *obj, const attribute_t *attr,
                              const json_value *args)
 {
@@ -243,14 +568,36 @@ static float blink(void)
     return mix(0.5f, 1.0f, t);
 }
 
+/*
+ * Max edge length (rad) tolerated at the current zoom level, so that
+ * the subdivision (needed for the projection distortion) follows the
+ * on-screen size instead of being fixed at creation.  The error of a
+ * straight segment of angular length l is about l^2 / 8 (sagitta), so
+ * we allow the length for which this stays under a few pixels.
+ */
+static double image_max_edge_length(const painter_t *painter)
+{
+    const double tol_px = 4;
+    double rad_per_px, ml;
+    rad_per_px = painter->proj->scaling[0] * 2 /
+                 painter->proj->full_window_size[0];
+    ml = sqrt(8 * tol_px * rad_per_px);
+    return clamp(ml, M_PI / 64, M_PI / 4);
+}
+
 static int image_render(const obj_t *obj, const painter_t *painter_)
 {
-    const image_t *image = (void*)obj;
+    image_t *image = (void*)obj;
     painter_t painter = *painter_;
     const feature_t *feature;
-    double pos[2], ofs[2];
+    double pos[2], ofs[2], max_length;
     int frame = image->frame;
-    const mesh_t *mesh;
+    int i, nb_points = 0, points_cap = 0;
+    point_t *points = NULL;
+    mesh_t *mesh;
+
+    image_process_pending(image);
+    max_length = image_max_edge_length(painter_);
 
     /*
      * For the moment, we render all the filled shapes first, then
@@ -260,25 +607,74 @@ static int image_render(const obj_t *obj, const painter_t *painter_)
      */
     for (feature = image->features; feature; feature = feature->next) {
         if (feature->hidden || feature->fill_color[3] == 0) continue;
+        if (painter_is_cap_clipped(&painter, frame, feature->bounding_cap))
+            continue;
         vec4_copy(feature->fill_color, painter.color);
         if (feature->blink)
             painter.color[3] *= blink();
         for (mesh = feature->meshes; mesh; mesh = mesh->next) {
-            paint_mesh(&painter, frame, MODE_TRIANGLES, mesh);
+            // Don't refine the clipped meshes.
+            if (painter_is_cap_clipped(&painter, frame, mesh->bounding_cap))
+                continue;
+            paint_mesh(&painter, frame, MODE_TRIANGLES,
+                       mesh_get_refined(mesh, max_length));
         }
     }
 
     for (feature = image->features; feature; feature = feature->next) {
         if (feature->hidden || feature->stroke_color[3] == 0) continue;
+        if (painter_is_cap_clipped(&painter, frame, feature->bounding_cap))
+            continue;
         vec4_copy(feature->stroke_color, painter.color);
         for (mesh = feature->meshes; mesh; mesh = mesh->next) {
+            if (painter_is_cap_clipped(&painter, frame, mesh->bounding_cap))
+                continue;
             painter.lines.width = feature->stroke_width;
             paint_mesh(&painter, frame, MODE_LINES, mesh);
         }
     }
 
+    /*
+     * Collect all the point features into a single batched call, so a
+     * catalog loaded as geojson renders as one item instead of
+     * thousands of individual markers.
+     */
     for (feature = image->features; feature; feature = feature->next) {
-        if (feature->hidden) continue;
+        if (feature->hidden || feature->stroke_color[3] == 0) continue;
+        for (mesh = feature->meshes; mesh; mesh = mesh->next) {
+            // The point features have a single vertex and no geometry.
+            if (mesh->vertices_count != 1 || mesh->triangles_count ||
+                    mesh->lines_count)
+                continue;
+            if (!painter_project(&painter, frame, mesh->vertices[0],
+                                 true, true, pos))
+                continue;
+            if (nb_points >= points_cap) {
+                points_cap += 256;
+                points = realloc(points, points_cap * sizeof(*points));
+            }
+            points[nb_points] = (point_t) {
+                .pos = {pos[0], pos[1]},
+                .size = 2 + feature->stroke_width,
+                .oid = feature->obj.oid,
+            };
+            for (i = 0; i < 4; i++) {
+                points[nb_points].color[i] =
+                    round(feature->stroke_color[i] * 255);
+            }
+            nb_points++;
+        }
+    }
+    if (nb_points) {
+        vec4_set(painter.color, 1, 1, 1, 1);
+        paint_2d_points(&painter, nb_points, points);
+    }
+    free(points);
+
+    for (feature = image->features; feature; feature = feature->next) {
+        if (feature->hidden || !feature->title) continue;
+        if (painter_is_cap_clipped(&painter, frame, feature->bounding_cap))
+            continue;
         for (mesh = feature->meshes; mesh; mesh = mesh->next) {
             if (feature->title) {
                 painter_project(&painter, frame, mesh->bounding_cap,
@@ -360,14 +756,49 @@ int geojson_query_rendered_features(
         if (nb >= max_ret) break;
         if (feature->hidden) continue;
         for (mesh = feature->meshes; mesh; mesh = mesh->next) {
-            if (mesh_contains_vec3(mesh, pos))
+            if (mesh_contains_vec3(mesh, pos)) {
                 index[nb++] = i;
+                break;
+            }
         }
     }
     return nb;
 }
 
 
+/*
+ * Bounding cap of all the features of the layer, so that obj_render can
+ * skip an entirely off screen layer without traversing its features.
+ */
+static bool image_get_bounding_cap(const obj_t *obj, int *frame,
+                                   double cap[4])
+{
+    image_t *image = (image_t*)obj;
+    const feature_t *feature;
+    const mesh_t *mesh;
+    bool first = true;
+
+    if (!image->features) return false;
+    if (image->cap_dirty) {
+        for (feature = image->features; feature; feature = feature->next) {
+            for (mesh = feature->meshes; mesh; mesh = mesh->next) {
+                if (first) {
+                    vec4_copy(mesh->bounding_cap, image->bounding_cap);
+                    first = false;
+                } else {
+                    cap_union(image->bounding_cap, mesh->bounding_cap,
+                              image->bounding_cap);
+                }
+            }
+        }
+        if (first) return false; // No mesh.
+        image->cap_dirty = false;
+    }
+    *frame = image->frame;
+    vec4_copy(image->bounding_cap, cap);
+    return true;
+}
+
 /*
  * Meta class declarations.
  */
@@ -386,6 +817,7 @@ static obj_klass_t image_klass = {
     .init = image_init,
     .render = image_render,
     .del = image_del,
+    .get_bounding_cap = image_get_bounding_cap,
     .attributes = (attribute_t[]) {
         PROPERTY(data, TYPE_JSON, .fn = data_fn),
         PROPERTY(frame, TYPE_ENUM, MEMBER(image_t, frame)),
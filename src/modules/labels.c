@@ -9,11 +9,27 @@
 
 #include "swe.h"
 
+#include <zlib.h> // For crc32.
 
 typedef struct label label_t;
+
+/*
+ * Key of the label registry hash: labels are registered every frame by
+ * the modules, so the lookup has to be constant time regardless of the
+ * label population.  The text is keyed by its crc so that the key stays
+ * a fixed size struct; the rare collisions fall back to a list scan.
+ */
+typedef struct {
+    uint64_t oid;
+    double   size;
+    uint32_t text_hash;
+} label_key_t;
+
 struct label
 {
     label_t *next, *prev;
+    UT_hash_handle hh;    // Hash handle of the label registry.
+    label_key_t key;
     uint64_t oid;         // Optional unique id for the label.
     char    *text;        // Original passed text.
     char    *render_text; // Processed text (can point to text).
@@ -37,16 +53,83 @@ struct label
 typedef struct labels {
     obj_t obj;
     label_t *labels;
+    label_t *by_key; // Hash of the labels, keyed by label_key_t.
 } labels_t;
 
 static labels_t *g_labels = NULL;
 
+// Maximum overlap (pixels) above which a floating label is hidden.
+#define MAX_OVERLAP 8
+
+/*
+ * Screen space spatial hash of the labels placed so far in the render
+ * pass: the overlap test of a label only has to look at the labels
+ * sharing one of its buckets instead of the whole list.  Rebuilt
+ * incrementally every frame as the labels are placed in priority order.
+ */
+#define GRID_CELL_SIZE 128
+
+typedef struct {
+    int w, h;           // Number of cells.
+    int *heads;         // Head node index of each cell (-1 if empty).
+    struct {
+        const label_t *label;
+        int next;
+    } *nodes;
+    int nb_nodes, allocated;
+} label_grid_t;
+
+static label_grid_t g_grid = {};
+
+static void grid_reset(label_grid_t *grid, const double window_size[2])
+{
+    int w = max((int)ceil(window_size[0] / GRID_CELL_SIZE), 1);
+    int h = max((int)ceil(window_size[1] / GRID_CELL_SIZE), 1);
+    if (w != grid->w || h != grid->h) {
+        free(grid->heads);
+        grid->heads = malloc(w * h * sizeof(*grid->heads));
+        grid->w = w;
+        grid->h = h;
+    }
+    memset(grid->heads, 0xff, w * h * sizeof(*grid->heads)); // All -1.
+    grid->nb_nodes = 0;
+}
+
+static void grid_cell_range(const label_grid_t *grid, const double bounds[4],
+                            int *x0, int *y0, int *x1, int *y1)
+{
+    *x0 = clamp((int)(bounds[0] / GRID_CELL_SIZE), 0, grid->w - 1);
+    *y0 = clamp((int)(bounds[1] / GRID_CELL_SIZE), 0, grid->h - 1);
+    *x1 = clamp((int)(bounds[2] / GRID_CELL_SIZE), 0, grid->w - 1);
+    *y1 = clamp((int)(bounds[3] / GRID_CELL_SIZE), 0, grid->h - 1);
+}
+
+static void grid_add(label_grid_t *grid, const label_t *label)
+{
+    int x, y, x0, y0, x1, y1, cell;
+
+    grid_cell_range(grid, label->bounds, &x0, &y0, &x1, &y1);
+    for (y = y0; y <= y1; y++)
+    for (x = x0; x <= x1; x++) {
+        if (grid->nb_nodes == grid->allocated) {
+            grid->allocated += 256;
+            grid->nodes = realloc(grid->nodes,
+                                  grid->allocated * sizeof(*grid->nodes));
+        }
+        cell = y * grid->w + x;
+        grid->nodes[grid->nb_nodes].label = label;
+        grid->nodes[grid->nb_nodes].next = grid->heads[cell];
+        grid->heads[cell] = grid->nb_nodes++;
+    }
+}
+
 void labels_reset(void)
 {
     label_t *label, *tmp;
     DL_FOREACH_SAFE(g_labels->labels, label, tmp) {
         if (label->fader.target == false && label->fader.value == 0) {
             DL_DELETE(g_labels->labels, label);
+            HASH_DELETE(hh, g_labels->by_key, label);
             if (label->render_text != label->text) free(label->render_text);
             free(label->text);
             free(label);
@@ -57,14 +140,31 @@ void labels_reset(void)
     }
 }
 
-static label_t *label_get(label_t *list, const char *txt, double size,
-                          uint64_t oid)
+static void label_make_key(const char *txt, double size, uint64_t oid,
+                           label_key_t *key)
 {
+    memset(key, 0, sizeof(*key)); // Also clears the struct padding.
+    key->oid = oid;
+    key->size = size;
+    key->text_hash = crc32(0, (const uint8_t*)txt, strlen(txt));
+}
+
+static label_t *label_get(const char *txt, double size, uint64_t oid)
+{
+    label_key_t key;
     label_t *label;
-    DL_FOREACH(list, label) {
-        if (oid != label->oid) continue;
-        if (label->size == size && strcmp(txt, label->text) == 0)
-            return label;
+
+    label_make_key(txt, size, oid, &key);
+    HASH_FIND(hh, g_labels->by_key, &key, sizeof(key), label);
+    if (label && strcmp(txt, label->text) == 0)
+        return label;
+    if (label) {
+        // Text crc collision: fall back to scanning the list.
+        DL_FOREACH(g_labels->labels, label) {
+            if (oid == label->oid && label->size == size &&
+                    strcmp(txt, label->text) == 0)
+                return label;
+        }
     }
     return NULL;
 }
@@ -120,21 +220,30 @@ static double bounds_dist_point(const double rect[4], const double p[2])
     return sqrt(dx * dx + dy * dy);
 }
 
-static double test_label_overlaps(const label_t *label)
+static double test_label_overlaps(const label_grid_t *grid,
+                                  const label_t *label)
 {
-    label_t *other;
+    const label_t *other;
     double ret = 0, overlap;
     double inter[4];
+    int x, y, x0, y0, x1, y1, i;
 
     if (!(label->effects & TEXT_FLOAT)) return 0.0;
-    DL_FOREACH(g_labels->labels, other) {
-        if (other == label) break;
-        if (other->fader.target == false) continue;
-        if (!bounds_intersection(label->bounds, other->bounds, inter))
-            continue;
-        overlap = max(inter[2] - inter[0], inter[3] - inter[1]);
-        if (overlap > ret)
-            ret = overlap;
+    grid_cell_range(grid, label->bounds, &x0, &y0, &x1, &y1);
+    for (y = y0; y <= y1; y++)
+    for (x = x0; x <= x1; x++) {
+        for (i = grid->heads[y * grid->w + x]; i != -1;
+                i = grid->nodes[i].next) {
+            other = grid->nodes[i].label;
+            if (!bounds_intersection(label->bounds, other->bounds, inter))
+                continue;
+            overlap = max(inter[2] - inter[0], inter[3] - inter[1]);
+            if (overlap > ret)
+                ret = overlap;
+            // The caller only thresholds the value: no need to keep
+            // looking once the label is blocked anyway.
+            if (ret > MAX_OVERLAP) return ret;
+        }
     }
     return ret;
 }
@@ -154,8 +263,8 @@ static int labels_render(const obj_t *obj, const painter_t *painter)
 {
     label_t *label;
     double pos[2], color[4];
-    const double max_overlap = 8;
 
+    grid_reset(&g_grid, painter->proj->window_size);
     DL_SORT(g_labels->labels, label_cmp);
     DL_FOREACH(g_labels->labels, label) {
         // Re-project label on screen
@@ -166,7 +275,9 @@ static int labels_render(const obj_t *obj, const painter_t *painter)
         label_get_bounds(painter, label, label->align, label->effects,
                          label->bounds);
         label->fader.target = label->active &&
-                                (test_label_overlaps(label) <= max_overlap);
+                    (test_label_overlaps(&g_grid, label) <= MAX_OVERLAP);
+        if (label->fader.target)
+            grid_add(&g_grid, label);
         pos[0] = label->bounds[0];
         pos[1] = label->bounds[1];
         vec4_copy(label->color, color);
@@ -212,13 +323,15 @@ void labels_add_3d(const char *text, int frame, const double pos[3],
 
     if (!text || !*text) return;
 
-    label = label_get(g_labels->labels, text, size, oid);
+    label = label_get(text, size, oid);
     if (!label) {
         label = calloc(1, sizeof(*label));
         label->oid = oid;
         fader_init(&label->fader, false);
         label->render_text = label->text = strdup(text);
         DL_APPEND(g_labels->labels, label);
+        label_make_key(text, size, oid, &label->key);
+        HASH_ADD(hh, g_labels->by_key, key, sizeof(label->key), label);
     }
 
     if (frame == -1)
@@ -33,6 +33,14 @@ typedef struct landscape {
     } info;
     int             parsed; // union of LS_ enum for each parsed file.
     char            *description;  // html description if any.
+
+    // Cursor for the background loading of the horizon band
+    // (see landscape_prefetch).
+    struct {
+        int         order;
+        int         pix;
+        double      alt;
+    } prefetch;
 } landscape_t;
 
 /*
@@ -45,6 +53,10 @@ typedef struct landscapes {
     fader_t         fog_visible;
     landscape_t     *current; // The current landscape.
     int             loading_code; // Return code of the initial list loading.
+    // Whether the current landscape fully covers the sky below the horizon,
+    // so that the other modules can clip their below-horizon rendering.
+    // Updated at each frame.
+    bool            hides_below_horizon;
 } landscapes_t;
 
 
@@ -53,6 +65,7 @@ static int landscape_init(obj_t *obj, json_value *args)
     landscape_t *ls = (void*)obj;
     fader_init(&ls->visible, false);
     vec4_set(ls->color, 1.0, 1.0, 1.0, 1.0);
+    ls->prefetch.order = -1;
     return 0;
 }
 
@@ -133,6 +146,42 @@ static void render_fog(const painter_t *painter_, double alpha)
     }
 }
 
+/*
+ * Load the full azimuth band of the survey at the current render order in
+ * the background, so that rotating the view in azimuth (the dominant
+ * motion) never hits unloaded tiles.  We advance a cursor over the healpix
+ * pixels, requesting a few tiles per frame for those whose altitude is
+ * close enough to the view one.
+ */
+static void landscape_prefetch(landscape_t *ls, const painter_t *painter,
+                               double alt)
+{
+    int order, npix, nb = 0;
+    double theta, phi, pix_alt, margin;
+    const int max_queries = 8;
+
+    // Note: hips_get_tile_texture clamps to the survey orders range.
+    order = max(hips_get_render_order(ls->hips, painter, 2 * M_PI), 0);
+    if (order != ls->prefetch.order ||
+            fabs(alt - ls->prefetch.alt) > 5 * DD2R) {
+        ls->prefetch.order = order;
+        ls->prefetch.alt = alt;
+        ls->prefetch.pix = 0;
+    }
+    npix = 12 * (1 << (2 * order));
+    // Angular radius of a tile plus half the fov.
+    margin = 58.6 * DD2R / (1 << order) * M_SQRT2 / 2 + core->fov / 2;
+    for (; ls->prefetch.pix < npix; ls->prefetch.pix++) {
+        if (nb >= max_queries) break;
+        healpix_pix2ang(1 << order, ls->prefetch.pix, &theta, &phi);
+        pix_alt = M_PI / 2 - theta;
+        if (fabs(pix_alt - alt) > margin) continue;
+        hips_get_tile_texture(ls->hips, order, ls->prefetch.pix,
+                              HIPS_LOAD_IN_THREAD, NULL, NULL, NULL);
+        nb++;
+    }
+}
+
 static int landscape_render(const obj_t *obj, const painter_t *painter_)
 {
     PROFILE(landscape_render, 0);
@@ -174,6 +223,7 @@ static int landscape_render(const obj_t *obj, const painter_t *painter_)
     if (ls->hips && hips_is_ready(ls->hips)) {
         vec3_mul(brightness, painter.color, painter.color);
         hips_render(ls->hips, &painter, rg2h, 2 * M_PI, split_order);
+        landscape_prefetch(ls, &painter, alt);
     }
     if (ls->shape) {
         obj_render(ls->shape, &painter);
@@ -233,6 +283,25 @@ static int landscapes_init(obj_t *obj, json_value *args)
     return 0;
 }
 
+/*
+ * Test whether a landscape is currently fully opaque below the horizon,
+ * using the same transparency adjustments as landscape_render.
+ */
+static bool landscape_is_opaque(const landscape_t *ls,
+                                const landscapes_t *lss)
+{
+    double alt, az, direction[3], alpha;
+
+    if (ls->visible.value < 1.0 || lss->visible.value < 1.0) return false;
+    if (ls->hips && !hips_is_ready(ls->hips)) return false;
+    convert_frame(core->observer, FRAME_VIEW, FRAME_OBSERVED, true,
+                  VEC(0, 0, -1), direction);
+    eraC2s(direction, &az, &alt);
+    alpha = smoothstep(1, 20, core->fov * DR2D);
+    alpha = mix(alpha, alpha / 2, smoothstep(0, -45, alt * DR2D));
+    return alpha >= 1.0;
+}
+
 static int landscapes_update(obj_t *obj, double dt)
 {
     landscapes_t *lss = (landscapes_t*)obj;
@@ -242,6 +311,8 @@ static int landscapes_update(obj_t *obj, double dt)
     }
     fader_update(&lss->visible, dt);
     fader_update(&lss->fog_visible, dt);
+    lss->hides_below_horizon = lss->current &&
+            landscape_is_opaque(lss->current, lss);
     return 0;
 }
 
@@ -348,6 +419,8 @@ static obj_klass_t landscapes_klass = {
                  MEMBER(landscapes_t, fog_visible.target)),
         PROPERTY(current, TYPE_OBJ, MEMBER(landscapes_t, current)),
         PROPERTY(current_id, TYPE_STRING, .fn = landscapes_current_id_fn),
+        PROPERTY(hides_below_horizon, TYPE_BOOL,
+                 MEMBER(landscapes_t, hides_below_horizon)),
         {}
     },
 };
@@ -272,8 +272,12 @@ static int line_update(obj_t *obj, double dt)
 static void ndc_to_win(const projection_t *proj, const double ndc[2],
                        double win[2])
 {
-    win[0] = (+ndc[0] + 1) / 2 * proj->window_size[0];
-    win[1] = (-ndc[1] + 1) / 2 * proj->window_size[1];
+    // Same mapping as project with PROJ_TO_WINDOW_SPACE, including the
+    // sub window offset used by tiled still rendering.
+    win[0] = (+ndc[0] + 1) / 2 * proj->full_window_size[0] -
+             proj->window_offset[0];
+    win[1] = (-ndc[1] + 1) / 2 * proj->full_window_size[1] -
+             proj->window_offset[1];
 }
 
 /*
@@ -507,8 +511,10 @@ static void render_recursion(
     double uv[4][2] = {{0.0, 1.0}, {1.0, 1.0}, {0.0, 0.0}, {1.0, 0.0}};
     double mat[3][3] = MAT3_IDENTITY;
     uv_map_t map = {
-        .map   = spherical_project,
-        .user  = rot,
+        .map       = spherical_project,
+        .user      = rot,
+        // Identifies the rotation for the tessellated lines cache.
+        .cache_key = crc32(0, (const void*)rot, sizeof(double[3][3])),
     };
 
     // Compute transformation matrix from full sphere uv to the quad uv.
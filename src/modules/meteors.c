@@ -13,12 +13,15 @@
 #define MAX_ALTITUDE 120.0          // Max meteor altitude in km
 #define MIN_ALTITUDE 80.0           // Min meteor altitude in km
 
+// Size of the preallocated meteors pool.
+#define MAX_METEORS 512
+
 /*
  * Type: meteor_t
- * Object that represents a single meteor
+ * A single meteor particle of the pool.
  */
 typedef struct {
-    obj_t       obj;
+    bool        active;
     double      pvo[2][4];
     double      duration; // Duration (sec).
     double      time; // From 0 to duration.
@@ -26,11 +29,14 @@ typedef struct {
 
 /*
  * Type: meteors_t
- * Meteors module object
+ * Meteors module object.  All the meteors live in a preallocated pool,
+ * updated and rendered in a single pass, so that high ZHR values don't
+ * pay any per object overhead.
  */
 typedef struct {
-    obj_t   obj;
-    double  zhr;
+    obj_t       obj;
+    double      zhr;
+    meteor_t    meteors[MAX_METEORS];
 } meteors_t;
 
 static double frand(double from, double to)
@@ -38,10 +44,9 @@ static double frand(double from, double to)
     return from + (rand() / (double)RAND_MAX) * (to - from);
 }
 
-static int meteor_init(obj_t *obj, json_value *args)
+static void meteor_activate(meteor_t *m)
 {
     double z, mat[3][3];
-    meteor_t *m = (meteor_t*)obj;
 
     // Give the meteor a random position and speed.
     z = (EARTH_RADIUS + MAX_ALTITUDE) * 1000 / DAU;
@@ -56,16 +61,8 @@ static int meteor_init(obj_t *obj, json_value *args)
     vec3_mul(0.00001, m->pvo[1], m->pvo[1]);
 
     m->duration = 4.0;
-
-    return 0;
-}
-
-static int meteor_update(obj_t *obj, double dt)
-{
-    meteor_t *m = (meteor_t*)obj;
-    vec3_addk(m->pvo[0], m->pvo[1], dt, m->pvo[0]);
-    m->time += dt;
-    return 0;
+    m->time = 0.0;
+    m->active = true;
 }
 
 /*
@@ -115,12 +112,11 @@ static void render_tail(const painter_t *painter,
     paint_quad(painter, FRAME_ICRF, &map, 8);
 }
 
-static int meteor_render(const obj_t *obj, const painter_t *painter_)
+static void meteor_render(const meteor_t *m, const painter_t *painter_)
 {
     double p1[4]; // Head position (CIRS)
     double p2[4]; // End of tail position (CIRS)
     painter_t painter = *painter_;
-    meteor_t *m = (meteor_t*)obj;
 
     // Very basic fade out.
     painter.color[3] *= max(0.0, 1.0 - m->time / m->duration);
@@ -129,7 +125,6 @@ static int meteor_render(const obj_t *obj, const painter_t *painter_)
     vec3_addk(p1, m->pvo[1], -2, p2);
 
     render_tail(&painter, p1, p2);
-    return 0;
 }
 
 static int meteors_init(obj_t *obj, json_value *args)
@@ -144,24 +139,27 @@ static int meteors_update(obj_t *obj, double dt)
     PROFILE(meterors_update, 0);
     meteors_t *ms = (meteors_t*)obj;
     meteor_t *m;
-    obj_t *child, *tmp;
-    int nb, max_nb = 100;
+    int i, nb_new;
     double proba;
 
-    DL_COUNT(obj->children, child, nb);
-    // Probabiliy of having a new shooting star at this frame.
+    // Expected number of new shooting stars at this frame.  We keep the
+    // fractional part as a probability, so that low rates still spawn.
     proba = ms->zhr * dt / 3600;
-
-    if (nb < max_nb && frand(0, 1) < proba) {
-        module_add_new(obj, "meteor", NULL, NULL);
-    }
-
-    DL_FOREACH_SAFE(obj->children, child, tmp) {
-        m = (meteor_t*)child;
-        meteor_update(child, dt);
-        if (m->time > m->duration) {
-            module_remove(obj, child);
+    nb_new = (int)proba + (frand(0, 1) < proba - (int)proba ? 1 : 0);
+
+    for (i = 0; i < MAX_METEORS; i++) {
+        m = &ms->meteors[i];
+        if (!m->active) {
+            if (nb_new > 0) {
+                meteor_activate(m);
+                nb_new--;
+            }
+            continue;
         }
+        vec3_addk(m->pvo[0], m->pvo[1], dt, m->pvo[0]);
+        m->time += dt;
+        if (m->time > m->duration)
+            m->active = false;
     }
 
     return 0;
@@ -170,31 +168,26 @@ static int meteors_update(obj_t *obj, double dt)
 static int meteors_render(const obj_t *obj, const painter_t *painter)
 {
     PROFILE(meterors_render, 0);
-    obj_t *child;
-    MODULE_ITER(obj, child, "meteor")
-        obj_render(child, painter);
+    const meteors_t *ms = (const meteors_t*)obj;
+    int i;
+    for (i = 0; i < MAX_METEORS; i++) {
+        if (!ms->meteors[i].active) continue;
+        meteor_render(&ms->meteors[i], painter);
+    }
     return 0;
 }
 
 /*
  * Meta class declarations.
  */
-static obj_klass_t meteor_klass = {
-    .id             = "meteor",
-    .size           = sizeof(meteor_t),
-    .init           = meteor_init,
-    .update         = meteor_update,
-    .render         = meteor_render,
-};
-OBJ_REGISTER(meteor_klass)
-
 static obj_klass_t meteors_klass = {
     .id             = "meteors",
     .size           = sizeof(meteors_t),
-    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE,
+    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_MODULE_LAZY,
     .render_order   = 20,
     .init           = meteors_init,
     .update         = meteors_update,
+    .update_reads   = UPDATE_DEP_TIME,
     .render         = meteors_render,
     .attributes = (attribute_t[]) {
         PROPERTY(zhr, TYPE_FLOAT, MEMBER(meteors_t, zhr)),
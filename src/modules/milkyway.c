@@ -69,6 +69,8 @@ static int milkyway_add_data_source(
     milkyway_t *mw = (milkyway_t*)obj;
     if (mw->hips) return -1;
     mw->hips = hips_create(url, 0, NULL);
+    // Background imagery: never delay the catalog tiles.
+    hips_set_priority(mw->hips, ASSET_PRIORITY_LOW);
     return 0;
 }
 
@@ -14,6 +14,12 @@
 
 // Minor planets module
 
+// Healpix nside of the sky position bucket index.
+#define BUCKET_NSIDE 4
+#define BUCKET_NB (12 * BUCKET_NSIDE * BUCKET_NSIDE)
+// Approximate angular size of a bucket (rad).
+#define BUCKET_RADIUS (sqrt(4 * M_PI / BUCKET_NB))
+
 typedef struct orbit_t {
     float d;    // date (julian day).
     float i;    // inclination (rad).
@@ -42,9 +48,25 @@ struct mplanet {
     // Cached values.
     float       vmag;
     double      pvo[2][4];
+    // Observer hash of the last update, so that a body updated by the
+    // batched solver (or an earlier caller) is not recomputed.
+    uint64_t    update_hash;
+
+    // Chebyshev interpolant of the heliocentric position around the
+    // last queried time, so that repeated queries at nearby times (e.g.
+    // time scrubbing on a selected asteroid) skip the kepler solve.
+    orbit_cheb_t cheb;
 
     // Linked list of currently visible.
     mplanet_t   *visible_next, *visible_prev;
+
+    // Sky position bucket (see mplanets_render): healpix pixel of the
+    // approximate observed position, with its validity window computed
+    // from the orbit angular rate.
+    int         bucket;         // Healpix pixel, -1 if not assigned yet.
+    double      bucket_tt;      // TT of the assignment.
+    double      bucket_window;  // Validity half window (day).
+    mplanet_t   *bucket_next, *bucket_prev;
 };
 
 /*
@@ -61,6 +83,13 @@ typedef struct mplanets {
 
     mplanet_t *render_current;
     mplanet_t *visibles; // Linked list of currently visible minor planets.
+
+    // Sky position bucket index: per healpix pixel list of the minor
+    // planets whose approximate position falls inside it, so that the
+    // per frame render tests only touch the buckets intersecting the
+    // viewport.
+    mplanet_t *buckets[BUCKET_NB];
+    int bucket_render_pos; // Round robin position in the bucket scan.
 } mplanets_t;
 
 // Static instance.
@@ -165,6 +194,73 @@ static void load_data(mplanets_t *mplanets, const char *data, int size)
     LOG_I("Parsed %d asteroids", nb);
 }
 
+/*
+ * Load the preprocessed binary version of the catalog (generated with
+ * tools/make-mpc.py --binary).  The orbital elements are stored as ready
+ * to use structure-of-arrays columns (angles already in radians), so the
+ * load is a plain copy into the objects without any text parsing.
+ *
+ * Return 0 in case of success.
+ */
+static int load_binary_data(mplanets_t *mplanets, const char *data, int size)
+{
+    int version, nb, i, orbit_type;
+    const float *epoch, *m, *w, *o, *in, *e, *n, *a, *h, *g;
+    const int32_t *number, *flags;
+    const char (*name)[24], (*desig)[24];
+    const char *p;
+    mplanet_t *mplanet;
+
+    if (size < 12) return -1;
+    memcpy(&version, data + 4, 4);
+    memcpy(&nb, data + 8, 4);
+    if (version != 1 || nb < 0 ||
+            size < 12 + nb * (10 * 4 + 2 * 4 + 2 * 24)) {
+        LOG_E("Invalid minor planets binary catalog");
+        return -1;
+    }
+    p = data + 12;
+    epoch  = (const float*)p;   p += nb * 4;
+    m      = (const float*)p;   p += nb * 4;
+    w      = (const float*)p;   p += nb * 4;
+    o      = (const float*)p;   p += nb * 4;
+    in     = (const float*)p;   p += nb * 4;
+    e      = (const float*)p;   p += nb * 4;
+    n      = (const float*)p;   p += nb * 4;
+    a      = (const float*)p;   p += nb * 4;
+    h      = (const float*)p;   p += nb * 4;
+    g      = (const float*)p;   p += nb * 4;
+    number = (const int32_t*)p; p += nb * 4;
+    flags  = (const int32_t*)p; p += nb * 4;
+    name   = (const char(*)[24])p; p += nb * 24;
+    desig  = (const char(*)[24])p;
+
+    for (i = 0; i < nb; i++) {
+        mplanet = (void*)module_add_new(&mplanets->obj, "asteroid", NULL,
+                                        NULL);
+        mplanet->orbit.d = epoch[i];
+        mplanet->orbit.m = m[i];
+        mplanet->orbit.w = w[i];
+        mplanet->orbit.o = o[i];
+        mplanet->orbit.i = in[i];
+        mplanet->orbit.e = e[i];
+        mplanet->orbit.n = n[i];
+        mplanet->orbit.a = a[i];
+        mplanet->h = h[i];
+        mplanet->g = g[i];
+        orbit_type = flags[i] & 0x3f;
+        strncpy(mplanet->obj.type, ORBIT_TYPES[orbit_type], 4);
+        mplanet->mpl_number = number[i];
+        mplanet->obj.oid = compute_oid(number[i], desig[i]);
+        if (name[i][0])
+            memcpy(mplanet->name, name[i], sizeof(mplanet->name));
+        if (desig[i][0])
+            memcpy(mplanet->desig, desig[i], sizeof(mplanet->desig));
+    }
+    LOG_I("Loaded %d asteroids", nb);
+    return 0;
+}
+
 static int mplanets_add_data_source(
         obj_t *obj, const char *url, const char *key)
 {
@@ -195,6 +291,7 @@ static int mplanet_init(obj_t *obj, json_value *args)
         orbit->m = json_get_attr_f(model, "M", 0) * DD2R;
         num = json_get_attr_i(model, "Number", -1);
     }
+    mp->bucket = -1;
     if (num >=0) {
         mp->obj.oid = oid_create("MPl", num);
         mp->mpl_number = num;
@@ -209,14 +306,11 @@ static int mplanet_init(obj_t *obj, json_value *args)
     return 0;
 }
 
-static int mplanet_update(mplanet_t *mp, const observer_t *obs)
+// Finish an update from an already solved heliocentric ecliptic pv.
+static void mplanet_update_from_pvh(mplanet_t *mp, const observer_t *obs,
+                                    double pvh[2][3])
 {
-    double pvh[2][3], pvo[2][3];
-
-    orbit_compute_pv(0, obs->ut1, pvh[0], pvh[1],
-            mp->orbit.d, mp->orbit.i, mp->orbit.o, mp->orbit.w,
-            mp->orbit.a, mp->orbit.n, mp->orbit.e, mp->orbit.m,
-            0, 0);
+    double pvo[2][3];
 
     mat3_mul_vec3(obs->re2i, pvh[0], pvh[0]);
     mat3_mul_vec3(obs->re2i, pvh[1], pvh[1]);
@@ -229,6 +323,32 @@ static int mplanet_update(mplanet_t *mp, const observer_t *obs)
     // Compute vmag using algo from
     // http://www.britastro.org/asteroids/dymock4.pdf
     mp->vmag = compute_magnitude(mp->h, mp->g, pvh[0], pvo[0]);
+    mp->update_hash = obs->hash;
+}
+
+static void mplanet_cheb_fn(double mjd, double pos[3], void *user)
+{
+    const mplanet_t *mp = user;
+    orbit_compute_pv(0, mjd, pos, NULL,
+            mp->orbit.d, mp->orbit.i, mp->orbit.o, mp->orbit.w,
+            mp->orbit.a, mp->orbit.n, mp->orbit.e, mp->orbit.m,
+            0, 0);
+}
+
+static int mplanet_update(mplanet_t *mp, const observer_t *obs)
+{
+    double pvh[2][3], days;
+
+    if (mp->update_hash == obs->hash) return 0;
+    if (!orbit_cheb_eval(&mp->cheb, obs->ut1, pvh[0], pvh[1])) {
+        // Refit a short segment (about 2% of the orbit) around the
+        // current time.
+        days = clamp(0.02 * 2 * M_PI / mp->orbit.n, 1, 30);
+        orbit_cheb_fit(&mp->cheb, obs->ut1 - days / 2, days,
+                       mplanet_cheb_fn, mp);
+        orbit_cheb_eval(&mp->cheb, obs->ut1, pvh[0], pvh[1]);
+    }
+    mplanet_update_from_pvh(mp, obs, pvh);
     return 0;
 }
 
@@ -332,7 +452,12 @@ static int mplanets_update(obj_t *obj, double dt)
             LOG_W("Cannot read asteroids data: %s (%d)", mps->source_url, code);
             return 0;
         }
-        load_data(mps, data, size);
+        // Prefer the preprocessed binary format when recognized, fall
+        // back on the MPC text format.
+        if (size >= 4 && strncmp(data, "MPCB", 4) == 0)
+            load_binary_data(mps, data, size);
+        else
+            load_data(mps, data, size);
         asset_release(mps->source_url);
     }
     return 0;
@@ -344,14 +469,48 @@ static void add_to_visible(mplanets_t *mps, mplanet_t *mplanet)
     DL_APPEND2(mps->visibles, mplanet, visible_prev, visible_next);
 }
 
+/*
+ * Put a minor planet into the bucket matching its last computed position,
+ * and compute how long the assignment stays valid: the time it takes the
+ * body to drift by about half a bucket, estimated from its orbital motion
+ * plus the parallactic motion due to the Earth.
+ */
+static void bucket_assign(mplanets_t *mps, mplanet_t *mp,
+                          const observer_t *obs)
+{
+    double p[3], phi, dec, rate;
+    int pix;
+
+    vec3_normalize(mp->pvo[0], p);
+    eraC2s(p, &phi, &dec);
+    healpix_ang2pix(BUCKET_NSIDE, M_PI / 2 - dec, eraAnp(phi), &pix);
+    if (pix != mp->bucket) {
+        if (mp->bucket >= 0)
+            DL_DELETE2(mps->buckets[mp->bucket], mp,
+                       bucket_prev, bucket_next);
+        DL_APPEND2(mps->buckets[pix], mp, bucket_prev, bucket_next);
+        mp->bucket = pix;
+    }
+    // Apparent angular rate (rad/day): own mean motion plus the motion
+    // of the Earth divided by the distance to the orbit.
+    rate = mp->orbit.n + 2 * M_PI / 365.25 / fmax(0.5, mp->orbit.a - 1);
+    mp->bucket_window = (BUCKET_RADIUS / 2) / rate;
+    mp->bucket_tt = obs->tt;
+}
+
 static int mplanets_render(const obj_t *obj, const painter_t *painter)
 {
     PROFILE(mplanets_render, 0);
 
     mplanets_t *mps = (void*)obj;
-    int i, r;
-    const int update_nb = 32;
+    int i, r, nb, pix;
+    const int update_nb = 32;   // Max orbits solved per frame.
+    const int scan_nb = 256;    // Max bucket assignments tested per frame.
+    const int render_nb = 128;  // Max on screen render tests per frame.
     mplanet_t *child, *tmp;
+    mplanet_t *batch[32];
+    double el[8][32]; // d, i, o, w, a, n, e, m element arrays.
+    double posb[32][3], speedb[32][3], pvh[2][3], cap[4];
 
     if (!mps->visible) return 0;
 
@@ -371,15 +530,65 @@ static int mplanets_render(const obj_t *obj, const painter_t *painter)
         }
     }
 
-    // Then iter part of the full list as well.
-    for (   i = 0, child = mps->render_current ?: (void*)mps->obj.children;
-            child && i < update_nb;
+    // Background refresh of the bucket assignments: scan a slice of the
+    // full list, pick the bodies whose assignment expired, solve their
+    // orbits with the batched kepler solver and re-bucket them.
+    for (   i = 0, nb = 0, child = mps->render_current ?:
+                                   (void*)mps->obj.children;
+            child && i < scan_nb && nb < update_nb;
             i++, child = (void*)child->obj.next) {
-        if (child->visible_prev) continue; // Was already rendered.
-        r = mplanet_render(&child->obj, painter);
-        if (r == 1) add_to_visible(mps, child);
+        if (child->bucket >= 0 &&
+                fabs(painter->obs->tt - child->bucket_tt) <
+                child->bucket_window)
+            continue;
+        if (child->update_hash == painter->obs->hash) {
+            // Position already up to date (visible pass or external
+            // query), only the bucket needs a refresh.
+            bucket_assign(mps, child, painter->obs);
+            continue;
+        }
+        batch[nb] = child;
+        el[0][nb] = child->orbit.d;
+        el[1][nb] = child->orbit.i;
+        el[2][nb] = child->orbit.o;
+        el[3][nb] = child->orbit.w;
+        el[4][nb] = child->orbit.a;
+        el[5][nb] = child->orbit.n;
+        el[6][nb] = child->orbit.e;
+        el[7][nb] = child->orbit.m;
+        nb++;
     }
     mps->render_current = child;
+    if (nb) {
+        orbit_compute_pv_n(0, nb, painter->obs->ut1, posb, speedb,
+                           el[0], el[1], el[2], el[3], el[4], el[5],
+                           el[6], el[7]);
+        for (i = 0; i < nb; i++) {
+            vec3_copy(posb[i], pvh[0]);
+            vec3_copy(speedb[i], pvh[1]);
+            mplanet_update_from_pvh(batch[i], painter->obs, pvh);
+            bucket_assign(mps, batch[i], painter->obs);
+        }
+    }
+
+    // Render test the members of the buckets intersecting the viewport,
+    // round robin with a fixed budget so that large catalogs do not
+    // stall the frame.
+    for (i = 0, nb = 0; i < BUCKET_NB && nb < render_nb; i++) {
+        pix = (mps->bucket_render_pos + i) % BUCKET_NB;
+        if (!mps->buckets[pix]) continue;
+        healpix_get_bounding_cap(BUCKET_NSIDE, pix, cap);
+        // Enlarge the cap to cover the drift since the assignments.
+        cap[3] = cos(acos(cap[3]) + BUCKET_RADIUS);
+        if (painter_is_cap_clipped(painter, FRAME_ICRF, cap)) continue;
+        DL_FOREACH2(mps->buckets[pix], child, bucket_next) {
+            if (child->visible_prev) continue; // Was already rendered.
+            r = mplanet_render(&child->obj, painter);
+            if (r == 1) add_to_visible(mps, child);
+            nb++;
+        }
+    }
+    mps->bucket_render_pos = (mps->bucket_render_pos + i) % BUCKET_NB;
 
     return 0;
 }
@@ -417,10 +626,13 @@ OBJ_REGISTER(mplanet_klass)
 static obj_klass_t mplanets_klass = {
     .id             = "minor_planets",
     .size           = sizeof(mplanets_t),
-    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE,
+    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE |
+                      OBJ_MODULE_LAZY,
     .init           = mplanets_init,
     .add_data_source    = mplanets_add_data_source,
     .update         = mplanets_update,
+    .update_reads   = UPDATE_DEP_TIME | UPDATE_DEP_MODULES,
+    .update_writes  = UPDATE_DEP_ASSETS,
     .render         = mplanets_render,
     .get_by_oid     = mplanets_get_by_oid,
     .render_order   = 20,
@@ -48,13 +48,39 @@ struct planet {
 
     // Optimizations vars
     float update_delta_s;    // Number of seconds between 2 orbits full update
-    double last_full_update; // Time of last full orbit update (TT)
-    double last_full_pvh[2][3]; // equ, J2000.0, AU heliocentric pos and speed.
+    // Small heliocentric ephemerides cache shared by all the callers of
+    // planet_get_pvh.  Several entries so that callers interleaving
+    // different epochs in the same frame (light time iteration, event
+    // searches) don't evict each other's value.
+    struct {
+        double tt;          // TT of the entry (0 if empty).
+        double pvh[2][3];   // equ, J2000.0, AU heliocentric pos and speed.
+    } pvh_cache[4];
+    int pvh_cache_last;     // Index of the last filled cache entry.
 
     // Cached pvo value and the observer hash used for the computation.
     uint64_t pvo_obs_hash;
     double pvo[2][3];
 
+    // Cached conservative bounding cap (ICRF), used to reject hidden
+    // planets before paying any ephemeris cost.  Refreshed when the
+    // observer moves or the simulated time drifts too much.
+    struct {
+        double cap[4];      // Direction + cos(radius + margin).
+        double tt;          // TT of the computation.
+        uint64_t obs_partial; // Observer hash_partial at computation.
+        bool ready;
+    } bound;
+
+    // Cached visual magnitude: the underlying geometry moves slowly, so
+    // refreshing it every simulated minute is more than enough.
+    struct {
+        double tt;
+        uint64_t obs_partial;
+        float v;
+        bool ready;
+    } vmag_cache;
+
     // Rotation elements
     struct {
         double obliquity;   // (rad)
@@ -67,6 +93,36 @@ struct planet {
     // Orbit elements (in ICRF plane, relative to the parent body).
     elements_t orbit;
 
+    // Precomputed Chebyshev ephemeris segments (heliocentric ICRF, AU),
+    // loaded from an eph file (see planets_eph_chunk).  When the requested
+    // time falls inside the covered period this replaces the analytic
+    // series evaluation.
+    struct {
+        int nb;             // Number of segments (0 if none loaded).
+        int deg;            // Coefficients per coordinate per segment.
+        double mjd_start;   // Start of the covered period (TT, MJD).
+        double days;        // Duration of one segment.
+        double *coefs;      // nb * 3 * deg values, segment major.
+    } eph;
+
+    // Cached shadow occluders list (see get_shadow_candidates): the set
+    // of bodies whose shadow cone can reach us only changes over minutes,
+    // so the cone intersection tests are redone on a coarse time quantum
+    // and only the occluders positions are refreshed in between.
+    struct {
+        double tt;          // TT of the computation (0 if empty).
+        int nb;             // Number of cached occluders.
+        struct planet *occluders[4]; // Sorted with the biggest first.
+    } shadow_cache;
+
+    // Cached Saturn ring tilts (see rings_vmag): the Sun-Saturn-Earth
+    // geometry moves over months, so a refresh every simulated minute
+    // is already far more than needed.
+    struct {
+        double tt;          // TT of the computation (0 if empty).
+        double et, st;      // Tilt from Earth and Sun (rad, south).
+    } ring_tilts;
+
     // Rings attributes.
     struct {
         double inner_radius; // (meter)
@@ -94,6 +150,9 @@ typedef struct planets {
     texture_t *halo_tex;
     // Default HiPS survey.
     hips_t *default_hips;
+    // Precomputed ephemeris source (see planets_add_data_source).
+    char *eph_url;
+    bool  eph_parsed; // Set to true once the data has been parsed.
     // Hints/labels magnitude offset
     double hints_mag_offset;
     bool   hints_visible;
@@ -158,14 +217,15 @@ static const double VIS_ELEMENTS[][5] = {
  *
  * Parameters:
  *   tt     - TT time in MJD.
+ *   prec   - Tolerated error on the apparent position (rad).
  *   pos    - Output position in ICRF frame, geocentric.
  */
-static void moon_icrf_geocentric_pos(double tt, double pos[3])
+static void moon_icrf_geocentric_pos(double tt, double prec, double pos[3])
 {
     double rmatecl[3][3], rmatp[3][3];
     double lambda, beta, dist, obl;
     // Get ecliptic position of date.
-    moon_pos(DJM0 + tt, &lambda, &beta, &dist);
+    moon_pos(DJM0 + tt, prec, &lambda, &beta, &dist);
     dist *= 1000.0 / DAU; // km to AU.
     // Convert to equatorial.
     obl = eraObl06(DJM0, tt); // Mean oblicity of ecliptic at J2000.
@@ -179,6 +239,47 @@ static void moon_icrf_geocentric_pos(double tt, double pos[3])
 }
 
 
+/*
+ * Evaluate the precomputed Chebyshev ephemeris of a planet.
+ *
+ * The segments store the coefficients c of the heliocentric position as
+ * pos(x) = Σ cⱼTⱼ(x), with x the time mapped to [-1, 1] over the segment.
+ * Both the position and its derivative are computed with a single Clenshaw
+ * recurrence per coordinate.
+ *
+ * Return false if no ephemeris is loaded for this planet or if the
+ * requested time falls outside of the covered period.
+ */
+static bool planet_eph_get_pvh(const planet_t *planet, double tt,
+                               double pvh[2][3])
+{
+    int i, j, k;
+    double x, xd, b1, b2, d1, d2, tmp, dtmp;
+    const double *c;
+
+    if (!planet->eph.nb) return false;
+    k = floor((tt - planet->eph.mjd_start) / planet->eph.days);
+    if (k < 0 || k >= planet->eph.nb) return false;
+    x = 2 * (tt - planet->eph.mjd_start - k * planet->eph.days) /
+            planet->eph.days - 1;
+    xd = 2 / planet->eph.days; // dx/dt, to get the speed in AU per day.
+    for (i = 0; i < 3; i++) {
+        c = planet->eph.coefs + (k * 3 + i) * planet->eph.deg;
+        b1 = b2 = d1 = d2 = 0;
+        for (j = planet->eph.deg - 1; j >= 1; j--) {
+            tmp = b1;
+            dtmp = d1;
+            b1 = 2 * x * b1 - b2 + c[j];
+            d1 = 2 * tmp + 2 * x * d1 - d2;
+            b2 = tmp;
+            d2 = dtmp;
+        }
+        pvh[0][i] = x * b1 - b2 + c[0];
+        pvh[1][i] = (b1 + x * d1 - d2) * xd;
+    }
+    return true;
+}
+
 /*
  * Function: planet_get_pvh
  * Get the heliocentric (ICRF) position of a planet at a given time.
@@ -186,18 +287,27 @@ static void moon_icrf_geocentric_pos(double tt, double pos[3])
 static void planet_get_pvh(const planet_t *planet, const observer_t *obs,
                            double pvh[2][3])
 {
-    double dt, parent_pvh[2][3];
-    int n;
-
-    // Use cached value if possible.
-    if (planet->last_full_update) {
-        dt = obs->tt - planet->last_full_update;
+    double dt, prec, parent_pvh[2][3];
+    planet_t *p = (planet_t*)planet;
+    int i, n;
+
+    // Use a cached value if we have one close enough to the requested
+    // time: the state vector is simply extrapolated.
+    for (i = 0; i < ARRAY_SIZE(planet->pvh_cache); i++) {
+        if (!planet->pvh_cache[i].tt) continue;
+        dt = obs->tt - planet->pvh_cache[i].tt;
         if (fabs(dt) < planet->update_delta_s / ERFA_DAYSEC) {
-            eraPvu(dt, planet->last_full_pvh, pvh);
+            eraPvu(dt, p->pvh_cache[i].pvh, pvh);
             return;
         }
     }
 
+    // Prefer the precomputed Chebyshev segments when they cover the
+    // requested time, and fall back on the analytic series outside of
+    // the coverage.
+    if (planet_eph_get_pvh(planet, obs->tt, pvh))
+        goto cache;
+
     switch (planet->id) {
     case EARTH:
         eraCpv(obs->earth_pvh, pvh);
@@ -206,8 +316,13 @@ static void planet_get_pvh(const planet_t *planet, const observer_t *obs,
         eraZpv(pvh);
         return;
     case MOON:
-        moon_icrf_geocentric_pos(obs->tt, pvh[0]);
-        moon_icrf_geocentric_pos(obs->tt + 1, pvh[1]);
+        // Truncate the series to a quarter of a screen pixel, but
+        // never worse than 1" so that non rendering computations (rise
+        // and set times, phases) keep the full accuracy of the theory.
+        prec = core->fov / core->win_size[0] / 4;
+        prec = min(prec, 1.0 / 3600 * DD2R);
+        moon_icrf_geocentric_pos(obs->tt, prec, pvh[0]);
+        moon_icrf_geocentric_pos(obs->tt + 1, prec, pvh[1]);
         vec3_sub(pvh[1], pvh[0], pvh[1]);
         eraPvppv(pvh, obs->earth_pvh, pvh);
         return;
@@ -228,7 +343,13 @@ static void planet_get_pvh(const planet_t *planet, const observer_t *obs,
     case GANYMEDE:
     case CALLISTO:
         planet_get_pvh(planet->parent, obs, parent_pvh);
-        l12(DJM0, obs->tt, planet->id - IO + 1, pvh);
+        // Truncate the series to the precision we can actually see: a
+        // quarter of a screen pixel, but never worse than 0.01" so that
+        // non rendering computations keep the full theory accuracy.
+        prec = core->fov / core->win_size[0] / 4;
+        prec = min(prec, 0.01 / 3600 * DD2R);
+        prec *= vec3_dist(parent_pvh[0], obs->earth_pvh[0]);
+        l12(DJM0, obs->tt, planet->id - IO + 1, prec, pvh);
         vec3_add(pvh[0], parent_pvh[0], pvh[0]);
         vec3_add(pvh[1], parent_pvh[1], pvh[1]);
         break;
@@ -250,9 +371,12 @@ static void planet_get_pvh(const planet_t *planet, const observer_t *obs,
         break;
     }
 
-    // Cache the value for next time.
-    eraCpv(pvh, planet->last_full_pvh);
-    ((planet_t*)planet)->last_full_update = obs->tt;
+cache:
+    // Cache the value for next time, evicting the oldest entry.
+    i = (p->pvh_cache_last + 1) % ARRAY_SIZE(p->pvh_cache);
+    eraCpv(pvh, p->pvh_cache[i].pvh);
+    p->pvh_cache[i].tt = obs->tt;
+    p->pvh_cache_last = i;
 }
 
 /*
@@ -397,22 +521,33 @@ static double rings_vmag(const planet_t *planet, const observer_t *obs)
     double et, st, set;
     double earth_hpos[3];
     double pvh[2][3];
+    planet_t *p = (planet_t*)planet;
 
     if (planet->id != SATURN) return 0;
-    planet_get_pvh(planet, obs, pvh);
-    mat3_mul_vec3(obs->ri2e, pvh[0], hpos);
-    mat3_mul_vec3(obs->ri2e, obs->earth_pvh[0], earth_hpos);
-
-    eraC2s(hpos, &hlon, &hlat);
-    eraC2s(earth_hpos, &earth_hlon, &earth_hlat);
-    satrings(hlat, hlon, vec3_norm(pvh[0]),
-             earth_hlon, vec3_norm(obs->earth_pvh[0]),
-             obs->ut1 + DJM0, &et, &st);
-    set = sin(fabs(et));
+
+    // Refresh the cached tilts only when the geometry has had a chance
+    // to move (one simulated minute).
+    if (!p->ring_tilts.tt ||
+            fabs(obs->tt - p->ring_tilts.tt) > 1.0 / 1440) {
+        planet_get_pvh(planet, obs, pvh);
+        mat3_mul_vec3(obs->ri2e, pvh[0], hpos);
+        mat3_mul_vec3(obs->ri2e, obs->earth_pvh[0], earth_hpos);
+
+        eraC2s(hpos, &hlon, &hlat);
+        eraC2s(earth_hpos, &earth_hlon, &earth_hlat);
+        satrings(hlat, hlon, vec3_norm(pvh[0]),
+                 earth_hlon, vec3_norm(obs->earth_pvh[0]),
+                 obs->ut1 + DJM0, &et, &st);
+        p->ring_tilts.tt = obs->tt;
+        p->ring_tilts.et = et;
+        p->ring_tilts.st = st;
+    }
+    set = sin(fabs(p->ring_tilts.et));
     return (-2.60 + 1.25 * set) * set;
 }
 
-static double planet_get_vmag(const planet_t *planet, const observer_t *obs)
+static double planet_compute_vmag(const planet_t *planet,
+                                  const observer_t *obs)
 {
     const double *vis;  // Visual element of planet.
     double rho; // Distance to Earth (AU).
@@ -463,6 +598,21 @@ static double planet_get_vmag(const planet_t *planet, const observer_t *obs)
     }
 }
 
+static double planet_get_vmag(const planet_t *planet, const observer_t *obs)
+{
+    planet_t *p = (planet_t*)planet;
+
+    if (p->vmag_cache.ready &&
+            p->vmag_cache.obs_partial == obs->hash_partial &&
+            fabs(obs->tt - p->vmag_cache.tt) < 1.0 / 1440)
+        return p->vmag_cache.v;
+    p->vmag_cache.v = planet_compute_vmag(planet, obs);
+    p->vmag_cache.tt = obs->tt;
+    p->vmag_cache.obs_partial = obs->hash_partial;
+    p->vmag_cache.ready = true;
+    return p->vmag_cache.v;
+}
+
 static int planet_get_info(const obj_t *obj, const observer_t *obs, int info,
                            void *out)
 {
@@ -624,11 +774,6 @@ static bool could_cast_shadow(const planet_t *a, const planet_t *b,
     return (vec3_norm(pp) < penumbra_r + b->radius_m / DAU);
 }
 
-static int sort_shadow_cmp(const void *a, const void *b)
-{
-    return -cmp(((const double*)a)[3], ((const double*)b)[3]);
-}
-
 /*
  * Compute the list of potential shadow spheres that should be considered
  * when rendering a planet.
@@ -636,6 +781,12 @@ static int sort_shadow_cmp(const void *a, const void *b)
  * The returned spheres are xyz = position (in view frame) and w = radius (AU).
  * Sorted with the biggest first.
  *
+ * The cone intersection tests only depend on the heliocentric geometry,
+ * which evolves over minutes, so their outcome is cached on the planet
+ * on a coarse time quantum: in between, only the positions of the cached
+ * occluders are refreshed, and the common no-eclipse case costs a single
+ * check.
+ *
  * Return the number of candidates.
  */
 static int get_shadow_candidates(const planet_t *planet,
@@ -643,29 +794,46 @@ static int get_shadow_candidates(const planet_t *planet,
                                  int nb_max,
                                  double (*spheres)[4])
 {
-    int nb = 0;
+    int i, nb;
     planets_t *planets = (planets_t*)planet->obj.parent;
+    planet_t *p = (planet_t*)planet;
     planet_t *other;
     double pvo[2][3];
 
-    if (!could_cast_shadow(NULL, planet, obs)) return 0;
-
-    PLANETS_ITER(planets, other) {
-        if (could_cast_shadow(other, planet, obs)) {
-            // No more space: replace the smallest one in the list if
-            // we can.
-            if (nb >= nb_max) {
-                if (other->radius_m / DAU < spheres[nb_max - 1][3])
-                    continue;
-                nb--; // Remove the last one.
+    if (!p->shadow_cache.tt ||
+            fabs(obs->tt - p->shadow_cache.tt) > 1.0 / 1440) {
+        p->shadow_cache.tt = obs->tt;
+        p->shadow_cache.nb = 0;
+        if (could_cast_shadow(NULL, planet, obs)) {
+            PLANETS_ITER(planets, other) {
+                if (!could_cast_shadow(other, planet, obs)) continue;
+                nb = p->shadow_cache.nb;
+                // No more space: replace the smallest one in the list if
+                // we can.
+                if (nb >= (int)ARRAY_SIZE(p->shadow_cache.occluders)) {
+                    if (other->radius_m <=
+                            p->shadow_cache.occluders[nb - 1]->radius_m)
+                        continue;
+                    nb--; // Remove the last one.
+                }
+                // Insert, keeping the biggest first.
+                for (i = nb; i > 0 && p->shadow_cache.occluders[i - 1]->
+                        radius_m < other->radius_m; i--)
+                    p->shadow_cache.occluders[i] =
+                        p->shadow_cache.occluders[i - 1];
+                p->shadow_cache.occluders[i] = other;
+                p->shadow_cache.nb = nb + 1;
             }
-            planet_get_pvo(other, obs, pvo);
-            vec3_copy(pvo[0], spheres[nb]);
-            spheres[nb][3] = other->radius_m / DAU;
-            nb++;
-            qsort(spheres, nb, 4 * sizeof(double), sort_shadow_cmp);
         }
     }
+
+    nb = min(p->shadow_cache.nb, nb_max);
+    for (i = 0; i < nb; i++) {
+        other = p->shadow_cache.occluders[i];
+        planet_get_pvo(other, obs, pvo);
+        vec3_copy(pvo[0], spheres[i]);
+        spheres[i][3] = other->radius_m / DAU;
+    }
     return nb;
 }
 
@@ -762,7 +930,7 @@ static void planet_render_hips(const planet_t *planet,
 
     // Compute the required split order, based on the size of the planet
     // on screen.
-    pixel_size = angle * painter.proj->window_size[0] /
+    pixel_size = angle * painter.proj->full_window_size[0] /
                  painter.proj->scaling[0] / 2;
     split_order = ceil(mix(2, 5, smoothstep(100, 600, pixel_size)));
 
@@ -856,7 +1024,8 @@ static void planet_render_label(
 
     // Radius on screen in pixel.
     radius = planet->radius_m / DAU / vec3_norm(pvo[0]);
-    radius *= painter->proj->window_size[0] / painter->proj->scaling[0] / 2;
+    radius *= painter->proj->full_window_size[0] /
+              painter->proj->scaling[0] / 2;
     radius *= scale;
 
     s = point_size * 0.9;
@@ -869,6 +1038,38 @@ static void planet_render_label(
                   -vmag, planet->obj.oid);
 }
 
+/*
+ * Cheap clipping test from a cached conservative bounding cap, so that
+ * planets hidden outside the viewport don't pay any ephemeris cost.
+ * The cap is refreshed when the observer changes or after 0.02 day of
+ * simulated time; the 2 deg margin covers everything the planets can
+ * move in that interval (Moon: ~0.5 deg including the parallax).
+ */
+static bool planet_is_clipped(const planet_t *planet,
+                              const painter_t *painter)
+{
+    planet_t *p = (planet_t*)planet;
+    const observer_t *obs = painter->obs;
+    const double margin = 2.0 * DD2R;
+    double pvo[2][3], radius;
+
+    if (    !p->bound.ready ||
+            p->bound.obs_partial != obs->hash_partial ||
+            fabs(obs->tt - p->bound.tt) > 0.02) {
+        planet_get_pvo(planet, obs, pvo);
+        vec3_normalize(pvo[0], p->bound.cap);
+        radius = max(planet->radius_m, planet->rings.outer_radius) / DAU /
+                 vec3_norm(pvo[0]);
+        // Add room for the point halo (and the artificial Moon scale).
+        radius += 2.0 * DD2R;
+        p->bound.cap[3] = cos(radius + margin);
+        p->bound.tt = obs->tt;
+        p->bound.obs_partial = obs->hash_partial;
+        p->bound.ready = true;
+    }
+    return painter_is_cap_clipped(painter, FRAME_ICRF, p->bound.cap);
+}
+
 static void planet_render(const planet_t *planet, const painter_t *painter_)
 {
     double pos[4], p_win[4];
@@ -892,6 +1093,9 @@ static void planet_render(const planet_t *planet, const painter_t *painter_)
 
     if (planet->id == EARTH) return;
 
+    // Cheap rejection from the cached bound before any ephemeris cost.
+    if (planet_is_clipped(planet, &painter)) return;
+
     vmag = planet_get_vmag(planet, painter.obs);
     if (planet->id != MOON && vmag > painter.stars_limit_mag) return;
 
@@ -996,10 +1200,10 @@ static void planet_render(const planet_t *planet, const painter_t *painter_)
     }
 }
 
-static int sort_cmp(const obj_t *a, const obj_t *b)
+static int sort_cmp(void *a, void *b)
 {
-    const planet_t *pa = (const planet_t*)a;
-    const planet_t *pb = (const planet_t*)b;
+    const planet_t *pa = a;
+    const planet_t *pb = b;
     double apvo[2][3], bpvo[2][3];
     observer_t *obs = core->observer;
     planet_get_pvo(pa, obs, apvo);
@@ -1052,7 +1256,7 @@ static int planets_render(const obj_t *obj, const painter_t *painter)
     planet_t *p;
 
     // First sort all the planets by distance to the observer.
-    DL_SORT(planets->obj.children, sort_cmp);
+    module_sort_children(&planets->obj, sort_cmp);
 
     if (planets->visible.value <= 0) return 0;
     painter_t painter_ = *painter;
@@ -1089,13 +1293,19 @@ static obj_t *planets_get_by_oid(
 
 static int planets_list(const obj_t *obj,
                         double max_mag, uint64_t hint, const char *source,
+                        const char *type, module_list_cursor_t *cursor,
                         void *user, int (*f)(void *user, obj_t *obj))
 {
     planet_t *p;
+    int i = 0;
     PLANETS_ITER(obj, p) {
+        if (cursor && i++ < cursor->index) continue;
         if (p->id == EARTH) continue; // Skip Earth.
-        if (f(user, (obj_t*)p)) break;
+        if (type && !otype_match(p->obj.type, type)) continue;
+        if (cursor) cursor->index = i;
+        if (f(user, (obj_t*)p)) return 0;
     }
+    if (cursor) cursor->done = true;
     return 0;
 }
 
@@ -1280,10 +1490,87 @@ static int planets_init(obj_t *obj, json_value *args)
     return 0;
 }
 
+/*
+ * Parse one chunk of a precomputed ephemeris file (generated with
+ * tools/make-ephemeris.py).  Each CHEB chunk holds the Chebyshev
+ * segments of a single body:
+ *
+ *   4 bytes: version
+ *   4 bytes: body id (JPL HORIZONS)
+ *   4 bytes: number of segments
+ *   4 bytes: number of coefficients per coordinate per segment
+ *   8 bytes: start of the covered period (TT, MJD, double)
+ *   8 bytes: duration of one segment (day, double)
+ *   compressed data block: the coefficients (doubles, segment major).
+ */
+static int planets_eph_chunk(const char type[4], const void *data, int size,
+                             const json_value *json, void *user)
+{
+    planets_t *planets = user;
+    planet_t *p;
+    int version, id, nb, deg, block_size, data_ofs;
+    double mjd_start, days;
+    void *block;
+
+    if (strncmp(type, "CHEB", 4) != 0) return 0;
+    memcpy(&version, data + 0, 4);
+    memcpy(&id, data + 4, 4);
+    memcpy(&nb, data + 8, 4);
+    memcpy(&deg, data + 12, 4);
+    memcpy(&mjd_start, data + 16, 8);
+    memcpy(&days, data + 24, 8);
+    data_ofs = 32;
+    (void)version;
+
+    PLANETS_ITER(planets, p) {
+        if (p->id == id) break;
+    }
+    if (!p) {
+        LOG_W("Unknown body id in ephemeris file: %d", id);
+        return 0;
+    }
+    block = eph_read_compressed_block(data, size, &data_ofs, &block_size);
+    if (!block) return -1;
+    if (block_size != nb * 3 * deg * (int)sizeof(double)) {
+        LOG_E("Wrong ephemeris data size for body %d", id);
+        free(block);
+        return -1;
+    }
+    free(p->eph.coefs);
+    p->eph.coefs = block;
+    p->eph.nb = nb;
+    p->eph.deg = deg;
+    p->eph.mjd_start = mjd_start;
+    p->eph.days = days;
+    // Drop the values cached from the analytic series.
+    memset(p->pvh_cache, 0, sizeof(p->pvh_cache));
+    p->pvo_obs_hash = 0;
+    LOG_D("Loaded precomputed ephemeris for %s: mjd %f to %f",
+          p->name, mjd_start, mjd_start + nb * days);
+    return 0;
+}
+
 static int planets_update(obj_t *obj, double dt)
 {
     planets_t *planets = (void*)obj;
     planet_t *p;
+    int size, code;
+    const void *data;
+
+    // Load the precomputed ephemeris file once available.
+    if (!planets->eph_parsed && planets->eph_url) {
+        data = asset_get_data(planets->eph_url, &size, &code);
+        if (code) {
+            planets->eph_parsed = true;
+            if (data) {
+                eph_load(data, size, planets, planets_eph_chunk);
+                asset_release(planets->eph_url);
+            } else {
+                LOG_E("Cannot load planets ephemeris: %s (%d)",
+                      planets->eph_url, code);
+            }
+        }
+    }
 
     fader_update(&planets->visible, dt);
     PLANETS_ITER(obj, p) {
@@ -1319,6 +1606,13 @@ static int planets_add_data_source(
         return 0;
     }
 
+    if (strcmp(key, "ephemeris") == 0) {
+        free(planets->eph_url);
+        planets->eph_url = strdup(url);
+        planets->eph_parsed = false;
+        return 0;
+    }
+
     if (strcmp(key, "moon-normal") == 0) {
         p = planet_get_by_name(planets, "moon");
         hips_delete(p->hips_normalmap);
@@ -1370,6 +1664,8 @@ static obj_klass_t planets_klass = {
     .get     = planets_get,
     .add_data_source = planets_add_data_source,
     .render_order = 30,
+    // Faders only: tolerate a coarser step when over budget.
+    .update_delay = 0.1,
     .attributes = (attribute_t[]) {
         PROPERTY(visible, TYPE_BOOL, MEMBER(planets_t, visible.target)),
         PROPERTY(hints_mag_offset, TYPE_FLOAT,
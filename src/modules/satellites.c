@@ -15,6 +15,18 @@
  * Artificial satellites module
  */
 
+// Pass prediction settings (see satellite_get_next_pass).
+#define PASS_SEARCH_RANGE 1.0                   // Searched range (day).
+#define PASS_SEARCH_STEP (60. / ERFA_DAYSEC)    // Coarse scan step (day).
+#define PASS_SEARCH_PREC (1. / ERFA_DAYSEC)     // Result precision (day).
+
+// States of a pass prediction.
+enum {
+    PASS_IDLE = 0,
+    PASS_RUNNING,
+    PASS_DONE,
+};
+
 /*
  * Type: satellite_t
  * Represents an individual satellite.
@@ -23,18 +35,43 @@ typedef struct satellite satellite_t;
 struct satellite {
     obj_t obj;
     char name[26];
-    sgp4_elsetrec_t *elsetrec; // Orbit elements.
+    // Orbit elements.  The initialization is deferred: NULL until the
+    // satellite first becomes a propagation candidate (see
+    // satellite_ensure_init), only the TLE lines are stored at load.
+    sgp4_elsetrec_t *elsetrec;
+    char tle[2][70];
+    double epoch; // TLE epoch (UTC, MJD).
     int number;
     double stdmag;
     double pvg[3]; // XXX: rename that.
     double pvo[2][4];
     double vmag;
     bool error; // Set if we got an error computing the position.
+    double last_utc; // Time of the last update (0 if never updated).
     json_value *data; // Data passed in the constructor.
     double max_brightness; // Cached max_brightness value.
 
     // Linked list of currently visible on screen.
     satellite_t *visible_next, *visible_prev;
+
+    // Index by NORAD number (see satellites_t by_number).
+    UT_hash_handle hh;
+    bool in_index;
+
+    // Next pass prediction cache (see satellite_get_next_pass), computed
+    // incrementally by the module update with a bounded number of
+    // propagations per frame.
+    struct {
+        uint64_t obs_hash;  // Observer location hash of the computation.
+        double epoch;       // TLE epoch of the computation (UTC, MJD).
+        double start;       // Start of the searched range (UTC, MJD).
+        double t;           // Next coarse scan time (UTC, MJD).
+        double last_alt;    // Altitude at the previous scan time.
+        double rise, set;   // Result (UTC, MJD), NAN if not found.
+        int state;          // One of PASS_X.
+        bool in_queue;
+        satellite_t *prev, *next; // Pending predictions queue.
+    } pass;
 };
 
 // Module class.
@@ -50,6 +87,23 @@ typedef struct satellites {
 
     satellite_t *render_current;
     satellite_t *visibles; // Linked list of currently visible satellites.
+
+    satellite_t *by_number; // Index of the satellites by NORAD number.
+    bool fetched; // Set once the jsonl data has been fetched.
+
+    satellite_t *pass_queue; // Queue of the pending pass predictions.
+
+    // Streaming ingestion state: the jsonl data is parsed in bounded
+    // chunks spread over frames (see satellites_ingest_chunk).
+    struct {
+        char *data;         // Uncompressed jsonl data (owned).
+        int size;
+        const char *line;   // Current line iterator state.
+        int len;
+        int nb;             // Number of lines ingested so far.
+        int nb_total;       // Total number of lines.
+        double last_epoch;
+    } ingest;
 } satellites_t;
 
 // Static instance.
@@ -71,72 +125,129 @@ static int satellites_add_data_source(
     satellites_t *sats = (void*)obj;
     if (strcmp(key, "jsonl/sat") != 0)
         return -1;
+    // Setting a source again restarts the ingestion: the satellites
+    // already present will be refreshed in place.
+    free(sats->jsonl_url);
     sats->jsonl_url = strdup(url);
+    sats->loaded = false;
+    sats->fetched = false;
     return 0;
 }
 
-static int load_jsonl_data(satellites_t *sats, const char *data, int size,
-                           const char *url, double *last_epoch)
+static int satellite_set_data(satellite_t *sat, json_value *args);
+static bool satellite_pass_step(satellite_t *sat, const observer_t *obs,
+                                int *budget);
+
+/*
+ * Ingest a bounded number of lines of the satellites jsonl data, so that
+ * loading or refreshing a full catalog is spread over several frames
+ * instead of stalling the main thread in a single pass.
+ *
+ * The satellites are merged by NORAD number against the existing
+ * objects: a known satellite gets its elements refreshed in place, so
+ * that an hourly TLE refresh doesn't recreate the whole module.
+ *
+ * Return false once all the lines have been ingested.
+ */
+static bool satellites_ingest_chunk(satellites_t *sats, int max_lines)
 {
-    const char *line = NULL;
-    int len, line_idx = 0, nb = 0;
-    char *uncompressed_data;
+    int i, r, number;
     json_value *json;
     satellite_t *sat;
 
-    // XXX: should use a more robust gz uncompression function for external
-    // data.
-    uncompressed_data = z_uncompress_gz(data, size, &size);
-    if (!uncompressed_data) {
-        LOG_E("Cannot uncompress gz file: %s", url);
-        return -1;
-    }
-
-    data = uncompressed_data;
-
-    *last_epoch = 0;
-    while (iter_lines(data, size, &line, &len)) {
-        line_idx++;
-        json = json_parse(line, len);
+    for (i = 0; i < max_lines; i++) {
+        if (!iter_lines(sats->ingest.data, sats->ingest.size,
+                        &sats->ingest.line, &sats->ingest.len)) {
+            free(sats->ingest.data);
+            sats->ingest.data = NULL;
+            return false;
+        }
+        sats->ingest.nb++;
+        json = json_parse(sats->ingest.line, sats->ingest.len);
         if (!json) goto error;
-        sat = (void*)module_add_new(&sats->obj, "tle_satellite", NULL, json);
+        r = jcon_parse(json, "{",
+            "model_data", "{", "norad_number", JCON_INT(number, 0), "}",
+        "}");
+        if (r) goto error;
+        HASH_FIND_INT(sats->by_number, &number, sat);
+        if (sat) {
+            // Refresh the elements of an already known satellite.
+            if (satellite_set_data(sat, json)) goto error;
+        } else {
+            sat = (void*)module_add_new(&sats->obj, "tle_satellite", NULL,
+                                        json);
+            if (!sat) goto error;
+            HASH_ADD_INT(sats->by_number, number, sat);
+            sat->in_index = true;
+        }
         json_value_free(json);
-        if (!sat) goto error;
-        *last_epoch = max(*last_epoch, sgp4_get_satepoch(sat->elsetrec));
-        nb++;
+        sats->ingest.last_epoch = max(sats->ingest.last_epoch, sat->epoch);
         continue;
 error:
-        LOG_E("Cannot create sat from %s:%d", url, line_idx);
+        json_value_free(json);
+        LOG_E("Cannot create sat from %s:%d", sats->jsonl_url,
+              sats->ingest.nb);
     }
-
-    free(uncompressed_data);
-    return nb;
+    return true;
 }
 
 static int satellites_update(obj_t *obj, double dt)
 {
     PROFILE(satellites_update, 0);
     satellites_t *sats = (satellites_t*)obj;
-    const char *data;
-    double last_epoch = 0;
-    int size, code, nb;
+    const char *data, *p;
+    int size, code;
+    int budget = 512;
+    satellite_t *sat;
     char buf[128];
 
+    // Advance the pending pass predictions (see satellite_get_next_pass)
+    // with a bounded number of propagations per frame.
+    while (sats->pass_queue && budget > 0) {
+        sat = sats->pass_queue;
+        if (!satellite_pass_step(sat, core->observer, &budget)) break;
+        DL_DELETE2(sats->pass_queue, sat, pass.prev, pass.next);
+        sat->pass.in_queue = false;
+    }
+
     if (sats->loaded) return 0;
+    if (!sats->jsonl_url) return 0;
 
-    if (sats->jsonl_url) {
+    if (!sats->fetched) {
         data = asset_get_data2(sats->jsonl_url, ASSET_USED_ONCE, &size, &code);
         if (!code) return 0; // Sill loading.
-        if (data) {
-            nb = load_jsonl_data(sats, data, size, sats->jsonl_url,
-                                 &last_epoch);
-            LOG_I("Parsed %d satellites (latest epoch: %s)", nb,
-                  format_time(buf, last_epoch, 0, "YYYY-MM-DD"));
+        sats->fetched = true;
+        if (!data) {
+            sats->loaded = true;
+            return 0;
+        }
+        // XXX: should use a more robust gz uncompression function for
+        // external data.
+        sats->ingest.data = z_uncompress_gz(data, size, &size);
+        if (!sats->ingest.data) {
+            LOG_E("Cannot uncompress gz file: %s", sats->jsonl_url);
+            sats->loaded = true;
+            return 0;
         }
+        sats->ingest.size = size;
+        sats->ingest.line = NULL;
+        sats->ingest.len = 0;
+        sats->ingest.nb = 0;
+        sats->ingest.last_epoch = 0;
+        // Count the lines once for the progress report.
+        sats->ingest.nb_total = 0;
+        for (p = sats->ingest.data;
+             (p = memchr(p, '\n', sats->ingest.data + size - p)); p++)
+            sats->ingest.nb_total++;
+    }
 
+    if (!satellites_ingest_chunk(sats, 128)) {
+        LOG_I("Parsed %d satellites (latest epoch: %s)", sats->ingest.nb,
+              format_time(buf, sats->ingest.last_epoch, 0, "YYYY-MM-DD"));
         sats->loaded = true;
     }
-
+    progressbar_report("satellites", "Satellites", sats->ingest.nb,
+                       sats->ingest.nb_total, -1);
     return 0;
 }
 
@@ -147,15 +258,38 @@ static void add_to_visible(satellites_t *sats, satellite_t *sat)
 }
 
 static int satellite_render(const obj_t *obj, const painter_t *painter);
+static void satellites_update_batch(satellite_t *const *batch, int nb,
+                                    const observer_t *obs);
+
+/*
+ * Cheap test whether a satellite's last computed position is far from
+ * the viewport.  The cap radius grows with the staleness of the cached
+ * position: a LEO satellite can move up to about one degree per second
+ * as seen from the ground.
+ */
+static bool satellite_is_far_from_view(const satellite_t *sat,
+                                       const painter_t *painter,
+                                       double staleness_s)
+{
+    double cap[4];
+    double margin = (10 + staleness_s) * DD2R;
+
+    vec3_normalize(sat->pvo[0], cap);
+    cap[3] = cos(min(margin, M_PI / 2));
+    return painter_is_cap_clipped(painter, FRAME_ICRF, cap);
+}
 
 static int satellites_render(const obj_t *obj, const painter_t *painter)
 {
     PROFILE(satellites_render, 0);
 
     satellites_t *sats = (void*)obj;
-    int i, r;
-    const int update_nb = 32;
+    int i, r, nb = 0;
+    const int scan_nb = 256; // Cheap classification tests per frame.
+    const int full_nb = 32;  // Budget of full updates per frame.
+    double staleness;
     satellite_t *child, *tmp;
+    satellite_t *batch[64];
 
     if (!sats->visible) return false;
 
@@ -165,6 +299,19 @@ static int satellites_render(const obj_t *obj, const painter_t *painter)
         add_to_visible(sats, (void*)core->selection);
     }
 
+    // First propagate all the satellites we are about to render with
+    // bulk sgp4 calls; the per satellite updates below then turn into
+    // no-ops.
+    DL_FOREACH2(sats->visibles, child, visible_next) {
+        if (child->error || child->last_utc == painter->obs->utc) continue;
+        batch[nb++] = child;
+        if (nb == (int)ARRAY_SIZE(batch)) {
+            satellites_update_batch(batch, nb, painter->obs);
+            nb = 0;
+        }
+    }
+    if (nb) satellites_update_batch(batch, nb, painter->obs);
+
     // Render all the flagged visible satellites, remove those that are
     // no longer visible.
     DL_FOREACH_SAFE2(sats->visibles, child, tmp, visible_next) {
@@ -175,15 +322,31 @@ static int satellites_render(const obj_t *obj, const painter_t *painter)
         }
     }
 
-    // Then iter part of the full list as well.
-    for (   i = 0, child = sats->render_current ?: (void*)sats->obj.children;
-            child && i < update_nb;
+    // Then scan a slice of the full list to catch satellites entering
+    // the view.  A cheap bounding cap test on the last known position
+    // classifies most of them out, so we can afford to check many more
+    // satellites per frame than we can fully update: only those near
+    // the enlarged viewport, or whose cached position is too stale to
+    // be trusted, take the full update and render path.
+    for (   i = 0, nb = 0,
+            child = sats->render_current ?: (void*)sats->obj.children;
+            child && i < scan_nb && nb < full_nb;
             i++, child = (void*)child->obj.next) {
         if (child->visible_prev) continue; // Was already rendered.
-        r = satellite_render(&child->obj, painter);
-        if (r == 1) add_to_visible(sats, child);
+        if (child->error) continue;
+        staleness = child->last_utc ?
+            fabs(painter->obs->utc - child->last_utc) * ERFA_DAYSEC : INFINITY;
+        if (staleness < 30 &&
+                satellite_is_far_from_view(child, painter, staleness))
+            continue;
+        batch[nb++] = child;
     }
     sats->render_current = child;
+    satellites_update_batch(batch, nb, painter->obs);
+    for (i = 0; i < nb; i++) {
+        r = satellite_render(&batch[i]->obj, painter);
+        if (r == 1) add_to_visible(sats, batch[i]);
+    }
     return 0;
 }
 
@@ -231,10 +394,10 @@ static double satellite_compute_earth_shadow(const satellite_t *sat,
 }
 
 static double compute_max_brightness(
-        const sgp4_elsetrec_t *elsetrec, double stdmag)
+        double no_rev_per_day, double ecco, double stdmag)
 {
     double perigree;
-    perigree = sgp4_get_perigree_height(elsetrec);
+    perigree = sgp4_perigree_height(no_rev_per_day, ecco);
     return stdmag - 15.75 + 2.5 * log10(perigree * perigree);
 }
 
@@ -296,52 +459,92 @@ static const char *otype_from_json(const json_value *val, const char *base)
     return base;
 }
 
-static int satellite_init(obj_t *obj, json_value *args)
+/*
+ * Set or refresh the data of a satellite from a noctuasky model data
+ * json value.  On a refresh the orbit elements are replaced in place
+ * and the cached values invalidated.
+ */
+static int satellite_set_data(satellite_t *sat, json_value *args)
 {
-    // Support creating a satellite using noctuasky model data json values.
-    satellite_t *sat = (satellite_t*)obj;
     const char *tle1, *tle2, *name = NULL;
-    double startmfe, stopmfe, deltamin;
+    double no, ecco;
     int r;
     const json_value *types = NULL;
 
+    r = jcon_parse(args, "{",
+        "?types", JCON_VAL(types),
+        "model_data", "{",
+            "norad_number", JCON_INT(sat->number, 0),
+            "?mag", JCON_DOUBLE(sat->stdmag, SATELLITE_DEFAULT_MAG),
+            "tle", "[", JCON_STR(tle1), JCON_STR(tle2), "]",
+        "}",
+        "?names", "[", JCON_STR(name), "]",
+    "}");
+    if (r) {
+        LOG_E("Cannot parse satellite json data");
+        assert(false);
+        return -1;
+    }
+    sat->obj.oid = oid_create("NORA", sat->number);
+    // Only store the TLE and parse the cheap fields here: the full
+    // propagator initialization is deferred until the satellite first
+    // becomes a propagation candidate.
+    snprintf(sat->tle[0], sizeof(sat->tle[0]), "%s", tle1);
+    snprintf(sat->tle[1], sizeof(sat->tle[1]), "%s", tle2);
+    sgp4_free(sat->elsetrec);
+    sat->elsetrec = NULL;
+    if (!sgp4_tle_info(sat->tle[0], sat->tle[1], &sat->epoch, &no, &ecco)) {
+        LOG_E("Invalid TLE for satellite %d", sat->number);
+        sat->error = true;
+        return -1;
+    }
+    if (name && strncmp(name, "NAME ", 5) == 0)
+        snprintf(sat->name, sizeof(sat->name), "%s", name + 5);
+    strncpy(sat->obj.type, otype_from_json(types, "Asa"), 4);
+
+    json_builder_free(sat->data);
+    sat->data = json_copy(args);
+    sat->max_brightness = compute_max_brightness(no, ecco, sat->stdmag);
+    sat->error = false;
+    sat->last_utc = 0;
+    return 0;
+}
+
+/*
+ * Run the deferred sgp4 initialization of a satellite the first time it
+ * becomes a propagation candidate.
+ */
+static bool satellite_ensure_init(satellite_t *sat)
+{
+    double startmfe, stopmfe, deltamin;
+
+    if (sat->elsetrec) return true;
+    if (sat->error || !sat->tle[0][0]) return false;
+    sat->elsetrec = sgp4_twoline2rv(sat->tle[0], sat->tle[1], 'c', 'm', 'i',
+                                    &startmfe, &stopmfe, &deltamin);
+    return true;
+}
+
+static int satellite_init(obj_t *obj, json_value *args)
+{
+    // Support creating a satellite using noctuasky model data json values.
+    satellite_t *sat = (satellite_t*)obj;
+
     sat->vmag = SATELLITE_DEFAULT_MAG;
     sat->stdmag = SATELLITE_DEFAULT_MAG;
 
-    if (args) {
-        r = jcon_parse(args, "{",
-            "?types", JCON_VAL(types),
-            "model_data", "{",
-                "norad_number", JCON_INT(sat->number, 0),
-                "?mag", JCON_DOUBLE(sat->stdmag, SATELLITE_DEFAULT_MAG),
-                "tle", "[", JCON_STR(tle1), JCON_STR(tle2), "]",
-            "}",
-            "?names", "[", JCON_STR(name), "]",
-        "}");
-        if (r) {
-            LOG_E("Cannot parse satellite json data");
-            assert(false);
-            return -1;
-        }
-        sat->obj.oid = oid_create("NORA", sat->number);
-        sat->elsetrec = sgp4_twoline2rv(tle1, tle2, 'c', 'm', 'i',
-                                        &startmfe, &stopmfe, &deltamin);
-        if (name && strncmp(name, "NAME ", 5) == 0)
-            snprintf(sat->name, sizeof(sat->name), "%s", name + 5);
-        strncpy(sat->obj.type, otype_from_json(types, "Asa"), 4);
-
-        sat->data = json_copy(args);
-        sat->max_brightness = compute_max_brightness(
-                sat->elsetrec, sat->stdmag);
-    }
-
+    if (args) return satellite_set_data(sat, args);
     return 0;
 }
 
 static void satellite_del(obj_t *obj)
 {
     satellite_t *sat = (satellite_t*)obj;
-    free(sat->elsetrec);
+    if (sat->in_index)
+        HASH_DEL(g_satellites->by_number, sat);
+    if (sat->pass.in_queue)
+        DL_DELETE2(g_satellites->pass_queue, sat, pass.prev, pass.next);
+    sgp4_free(sat->elsetrec);
     json_builder_free(sat->data);
 }
 
@@ -358,22 +561,23 @@ static void true_equator_to_j2000(const observer_t *obs,
 }
 
 /*
- * Update an individual satellite.
+ * Finish the update of a satellite from an already propagated sgp4 state
+ * (km, TEME frame).  ok is the return value of the propagation.
  */
-static int satellite_update(satellite_t *sat, const observer_t *obs)
+static int satellite_update_from_pv(satellite_t *sat, const observer_t *obs,
+                                    const double pv_[2][3], bool ok)
 {
     double pv[2][3];
 
-    if (sat->error) return 0;
-    assert(sat->elsetrec);
-    // Orbit computation.
-    if (!sgp4(sat->elsetrec, obs->utc, pv[0],  pv[1])) {
+    if (!ok) {
         LOG_W("Cannot compute satellite position (%s, %d)",
               sat->name, sat->number);
         sat->error = true;
         return 0;
     }
-    assert(!isnan(pv[0][0]) && !isnan(pv[0][1]));
+    assert(!isnan(pv_[0][0]) && !isnan(pv_[0][1]));
+    sat->last_utc = obs->utc;
+    eraCpv(pv_, pv);
 
     vec3_mul(1000.0 / DAU, pv[0], pv[0]);
     vec3_mul(1000.0 / DAU, pv[1], pv[1]);
@@ -391,6 +595,52 @@ static int satellite_update(satellite_t *sat, const observer_t *obs)
     return 0;
 }
 
+/*
+ * Update an individual satellite.
+ */
+static int satellite_update(satellite_t *sat, const observer_t *obs)
+{
+    double pv[2][3];
+    bool ok;
+
+    if (sat->error) return 0;
+    if (sat->last_utc == obs->utc) return 0; // Already up to date.
+    if (!satellite_ensure_init(sat)) return 0;
+    // Orbit computation.
+    ok = sgp4(sat->elsetrec, obs->utc, pv[0], pv[1]);
+    return satellite_update_from_pv(sat, obs, pv, ok);
+}
+
+/*
+ * Propagate a batch of satellites to the observer time in a single bulk
+ * sgp4 call (see <sgp4_n>).
+ */
+static void satellites_update_batch(satellite_t *const *batch, int nb,
+                                    const observer_t *obs)
+{
+    int i, n = 0;
+    satellite_t *sats[64];
+    sgp4_elsetrec_t *els[64];
+    double rs[64][3], vs[64][3], pv[2][3];
+    bool oks[64];
+
+    assert(nb <= (int)ARRAY_SIZE(els));
+    for (i = 0; i < nb; i++) {
+        // Skip the satellites without elements (e.g. empty TLE).
+        if (!satellite_ensure_init(batch[i])) continue;
+        sats[n] = batch[i];
+        els[n] = batch[i]->elsetrec;
+        n++;
+    }
+    if (!n) return;
+    sgp4_n(els, n, obs->utc, rs, vs, oks);
+    for (i = 0; i < n; i++) {
+        vec3_copy(rs[i], pv[0]);
+        vec3_copy(vs[i], pv[1]);
+        satellite_update_from_pv(sats[i], obs, pv, oks[i]);
+    }
+}
+
 static int satellite_get_info(const obj_t *obj, const observer_t *obs, int info,
                               void *out)
 {
@@ -496,20 +746,26 @@ static void satellite_get_designations(
 
 static int satellites_list(const obj_t *obj,
                            double max_mag, uint64_t hint,
-                           const char *sources, void *user,
+                           const char *sources, const char *type,
+                           module_list_cursor_t *cursor, void *user,
                            int (*f)(void *user, obj_t *obj))
 {
     obj_t *child;
     satellite_t *sat;
     bool test_vmag = !isnan(max_mag);
+    int i = 0;
 
     DL_FOREACH(obj->children, child) {
+        if (cursor && i++ < cursor->index) continue;
         sat = (void*)child;
         if (sat->error) continue;
         if (test_vmag && sat->max_brightness > max_mag)
             continue;
-        if (f(user, child)) break;
+        if (type && !otype_match(child->type, type)) continue;
+        if (cursor) cursor->index = i;
+        if (f(user, child)) return 0;
     }
+    if (cursor) cursor->done = true;
     return 0;
 }
 
@@ -524,7 +780,7 @@ int satellite_get_altitude(const obj_t *obj, const observer_t *obs,
     satellite_t *sat = (void*)obj;
 
     if (sat->error) return -1;
-    assert(sat->elsetrec);
+    if (!satellite_ensure_init(sat)) return -1;
     if (!sgp4(sat->elsetrec, obs->utc, pos, speed)) return -1;
     vec3_mul(1000.0 / DAU, pos, pos);
 
@@ -543,6 +799,155 @@ int satellite_get_altitude(const obj_t *obj, const observer_t *obs,
     return 0;
 }
 
+static int sign(double x)
+{
+    return x < 0 ? -1 : 1;
+}
+
+/*
+ * Observed altitude of a satellite at an arbitrary time, using the same
+ * fast computation as <satellite_get_altitude>.  Return NAN if the
+ * propagation fails.
+ */
+static double satellite_pass_altitude(const satellite_t *sat,
+                                      const observer_t *obs, double utc)
+{
+    double pos[3], speed[3], obs_pos[3], sep, theta;
+
+    if (!sgp4(sat->elsetrec, utc, pos, speed)) return NAN;
+    vec3_mul(1000.0 / DAU, pos, pos);
+    mat3_mul_vec3(obs->rnp, pos, pos);
+    eraGd2gc(1, obs->elong, obs->phi, obs->hm, obs_pos);
+    vec3_mul(1.0 / DAU, obs_pos, obs_pos);
+    theta = eraEra00(DJM0, utc + (obs->ut1 - obs->utc));
+    vec2_rotate(theta, obs_pos, obs_pos);
+    vec3_sub(pos, obs_pos, pos);
+    sep = eraSepp(pos, obs_pos);
+    return M_PI / 2 - fabs(sep);
+}
+
+// Refine a bracketed horizon crossing by bisection.  s1 is the sign of
+// the altitude at t1.
+static double satellite_pass_bisect(const satellite_t *sat,
+                                    const observer_t *obs,
+                                    double t0, double t1, int s1)
+{
+    double m, alt;
+
+    while (t1 - t0 > PASS_SEARCH_PREC) {
+        m = (t0 + t1) / 2;
+        alt = satellite_pass_altitude(sat, obs, m);
+        if (sign(alt) == s1)
+            t1 = m;
+        else
+            t0 = m;
+    }
+    return (t0 + t1) / 2;
+}
+
+/*
+ * Advance the pass search of a satellite, decrementing *budget for each
+ * coarse propagation.  Return true once the search is finished.
+ */
+static bool satellite_pass_step(satellite_t *sat, const observer_t *obs,
+                                int *budget)
+{
+    double alt;
+    const double end = sat->pass.start + PASS_SEARCH_RANGE;
+
+    while ((*budget)-- > 0) {
+        alt = satellite_pass_altitude(sat, obs, sat->pass.t);
+        if (isnan(alt)) {
+            sat->pass.rise = sat->pass.set = NAN;
+            sat->pass.state = PASS_DONE;
+            return true;
+        }
+        if (isnan(sat->pass.rise)) {
+            if (alt > 0 && sat->pass.t == sat->pass.start) {
+                // Already up: the pass is in progress.
+                sat->pass.rise = sat->pass.start;
+            } else if (alt > 0 && sat->pass.last_alt <= 0) {
+                sat->pass.rise = satellite_pass_bisect(
+                        sat, obs, sat->pass.t - PASS_SEARCH_STEP,
+                        sat->pass.t, +1);
+            }
+        } else if (alt <= 0) {
+            sat->pass.set = satellite_pass_bisect(
+                    sat, obs, sat->pass.t - PASS_SEARCH_STEP,
+                    sat->pass.t, -1);
+            sat->pass.state = PASS_DONE;
+            return true;
+        }
+        sat->pass.last_alt = alt;
+        sat->pass.t += PASS_SEARCH_STEP;
+        if (sat->pass.t > end) {
+            // Range exhausted: either no pass at all, or a rise with the
+            // set after the range (e.g. a geostationary satellite).
+            sat->pass.state = PASS_DONE;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * Function: satellite_get_next_pass
+ * Get the next pass of a satellite above the horizon for the observer
+ * location.
+ *
+ * The prediction runs asynchronously: the first call queues the search,
+ * which the module then advances by a bounded number of propagations per
+ * frame, and the result is cached until the TLE is refreshed, the
+ * observer location changes, or the pass is over.
+ *
+ * Parameters:
+ *   obj  - A satellite object.
+ *   obs  - The observer.
+ *   rise - Output rise time (UTC, MJD).  Set to the current time if the
+ *          pass is already in progress.
+ *   set  - Output set time (UTC, MJD).  NAN if the satellite does not
+ *          set within the searched range.
+ *
+ * Return:
+ *   0 if a pass has been found, 1 if the prediction is still running
+ *   (call again later), -1 if there is no pass in the next day or the
+ *   orbit cannot be propagated.
+ */
+EMSCRIPTEN_KEEPALIVE
+int satellite_get_next_pass(obj_t *obj, const observer_t *obs,
+                            double *rise, double *set)
+{
+    satellite_t *sat = (satellite_t*)obj;
+
+    if (sat->error || !satellite_ensure_init(sat)) return -1;
+    // (Re)start the search if the cache doesn't match the observer
+    // location or the orbit elements anymore, or is out of date.
+    if (    sat->pass.state == PASS_IDLE ||
+            sat->pass.obs_hash != obs->hash_partial ||
+            sat->pass.epoch != sat->epoch ||
+            obs->utc > sat->pass.start + PASS_SEARCH_RANGE ||
+            (sat->pass.state == PASS_DONE && !isnan(sat->pass.set) &&
+             obs->utc > sat->pass.set)) {
+        sat->pass.obs_hash = obs->hash_partial;
+        sat->pass.epoch = sat->epoch;
+        sat->pass.start = obs->utc;
+        sat->pass.t = obs->utc;
+        sat->pass.last_alt = NAN;
+        sat->pass.rise = NAN;
+        sat->pass.set = NAN;
+        sat->pass.state = PASS_RUNNING;
+        if (!sat->pass.in_queue) {
+            DL_APPEND2(g_satellites->pass_queue, sat, pass.prev, pass.next);
+            sat->pass.in_queue = true;
+        }
+    }
+    if (sat->pass.state != PASS_DONE) return 1;
+    if (isnan(sat->pass.rise)) return -1;
+    *rise = sat->pass.rise;
+    *set = sat->pass.set;
+    return 0;
+}
+
 /*
  * Meta class declarations.
  */
@@ -564,11 +969,14 @@ OBJ_REGISTER(satellite_klass)
 static obj_klass_t satellites_klass = {
     .id             = "satellites",
     .size           = sizeof(satellites_t),
-    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE,
+    .flags          = OBJ_IN_JSON_TREE | OBJ_MODULE | OBJ_LISTABLE |
+                      OBJ_MODULE_LAZY,
     .init           = satellites_init,
     .add_data_source = satellites_add_data_source,
     .render_order   = 30,
     .update         = satellites_update,
+    .update_reads   = UPDATE_DEP_TIME | UPDATE_DEP_MODULES,
+    .update_writes  = UPDATE_DEP_ASSETS,
     .render         = satellites_render,
     .get_by_oid     = satellites_get_by_oid,
     .list           = satellites_list,
@@ -23,8 +23,21 @@
 enum {
     SK_JSON                         = 1 << 0,
     SK_MD                           = 1 << 1,
+    SK_PACK                         = 1 << 2,
 };
 
+/*
+ * Type: hip_name_t
+ * Integer keyed index over the "HIP XXXX" entries of the common names
+ * hash, so that the star label path doesn't have to format and hash an
+ * identifier string for every candidate star.
+ */
+typedef struct hip_name {
+    UT_hash_handle hh;
+    int hip;
+    const skyculture_name_t *entry;
+} hip_name_t;
+
 /*
  * Type: skyculture_t
  * Represent an individual skyculture.
@@ -35,6 +48,7 @@ typedef struct skyculture {
     char            *id;
     int             nb_constellations;
     skyculture_name_t *names; // Hash table of identifier -> common names.
+    hip_name_t      *hip_names; // HIP number index, built on first use.
     constellation_infos_t *constellations;
     json_value      *imgs;
     int             parsed; // union of SK_ enum for each parsed file.
@@ -122,6 +136,14 @@ static void skyculture_activate(skyculture_t *cult)
     json_value *args;
     constellation_infos_t *cst;
     obj_t *constellations, *cons;
+    skyculture_name_t *item, *tmp;
+
+    // Feed the common names to the type-ahead search index.
+    HASH_ITER(hh, cult->names, item, tmp) {
+        search_index_add(item->main_id);
+        search_index_add(item->name_english);
+        search_index_add(item->name_native);
+    }
 
     // Create all the constellations object.
     constellations = core_get_module("constellations");
@@ -393,6 +415,67 @@ static int skyculture_load_md(skyculture_t *cult) {
     return 0;
 }
 
+/*
+ * Try to load the culture from its compiled binary pack (index.skp),
+ * generated at data build time by tools/make-skyculture-pack.py.  The
+ * pack contains everything the index.json and description.md files do,
+ * already merged, so loading it involves no json or markdown parsing at
+ * all and switching cultures is effectively instant.
+ *
+ * Return:
+ *   0 if the pack was loaded (or is still downloading), 1 if the
+ *   culture has no pack and we should fall back to the json files.
+ */
+static int skyculture_load_pack(skyculture_t *cult)
+{
+    char path[1024];
+    const void *data;
+    const char *lang;
+    int i, size, code;
+    skyculture_pack_info_t info;
+    const skycultures_t *cults = (skycultures_t*)cult->obj.parent;
+    bool active = (cult == cults->current);
+
+    snprintf(path, sizeof(path), "%s/%s", cult->uri, "index.skp");
+    data = asset_get_data2(path, ASSET_USED_ONCE | ASSET_ACCEPT_404,
+                           &size, &code);
+    if (!code) return 0;
+    cult->parsed |= SK_PACK;
+    if (!data) return 1; // No pack: use the json files.
+    if (skyculture_parse_pack(data, size, &info)) return 1;
+
+    // All the info strings are retained: we can use them directly.
+    cult->id = (char*)info.id;
+    cult->has_chinese_star_names = strncmp(info.id, "chinese", 7) == 0;
+    cult->name = (char*)(info.name ?: "Unknown");
+    cult->region = (char*)info.region;
+    cult->introduction = (char*)info.introduction;
+    cult->description = (char*)info.description;
+    cult->references = (char*)info.references;
+    cult->authors = (char*)info.authors;
+    cult->licence = (char*)info.licence;
+    cult->fallback_to_international_names =
+        info.fallback_to_international_names;
+    cult->names = info.names;
+    cult->constellations = info.constellations;
+    cult->nb_constellations = info.nb_constellations;
+    for (i = 0; i < cult->nb_constellations; i++)
+        cult->constellations[i].base_path = cult->uri;
+    if (info.tour_json)
+        cult->tour = json_parse(info.tour_json, strlen(info.tour_json));
+    for (lang = info.langs_use_native_names; lang && *lang;
+            lang += strlen(lang) + 1) {
+        if (strcmp(lang, "en") == 0)
+            cult->english_use_native_names = true;
+        if (strcmp(sys_get_lang(), lang) == 0)
+            cult->prefer_native_names = true;
+    }
+
+    cult->parsed |= SK_JSON | SK_MD;
+    if (active) skyculture_activate(cult);
+    return 0;
+}
+
 static int skyculture_update(obj_t *obj, double dt)
 {
     const char *json;
@@ -413,6 +496,12 @@ static int skyculture_update(obj_t *obj, double dt)
     if (cult->parsed & SK_MD)
         return 0;
 
+    // Prefer the compiled binary pack when the culture has one.
+    if (!(cult->parsed & SK_PACK)) {
+        if (skyculture_load_pack(cult) == 0)
+            return 0;
+    }
+
     if (cult->parsed & SK_JSON) {
         return skyculture_load_md(cult);
     }
@@ -427,7 +516,7 @@ static int skyculture_update(obj_t *obj, double dt)
         return -1;
     }
 
-    doc = json_parse(json, strlen(json));
+    doc = json_parse_arena(json, strlen(json));
     if (!doc) {
         LOG_E("Cannot parse skyculture json (%s)", path);
         return -1;
@@ -452,7 +541,7 @@ static int skyculture_update(obj_t *obj, double dt)
     "}");
     if (r) {
         LOG_E("Cannot parse skyculture json (%s)", path);
-        json_value_free(doc);
+        json_arena_free(doc);
         return -1;
     }
 
@@ -504,7 +593,7 @@ static int skyculture_update(obj_t *obj, double dt)
     }
 
 end:
-    json_value_free(doc);
+    json_arena_free(doc);
 
     // Immediately tries to load the md file if available
     return skyculture_load_md(cult);
@@ -648,29 +737,33 @@ static void skycultures_translate_english_name(const char* name, char *out,
 }
 
 /*
- * Function: skycultures_get_label
- * Get the label of a sky object in the current skyculture, translated
- * for the current language.
- *
- * Parameters:
- *   main_id        - the main ID of the sky object:
- *                     - for bright stars use "HIP XXXX"
- *                     - for constellations use "CON culture_name XXX"
- *                     - for planets use "NAME Planet"
- *                     - for DSO use the first identifier of the names list
- *   out            - A text buffer that get filled with the name.
- *   out_size       - size of the out buffer.
- *
- * Return:
- *   NULL if no name was found.  A pointer to the passed buffer otherwise.
+ * Build the HIP number index over the common names of a culture.  The
+ * names hash is immutable once the culture files are parsed, so this
+ * only runs once per culture, on the first star label lookup.
  */
-const char *skycultures_get_label(const char* main_id, char *out, int out_size)
+static void skyculture_index_hip_names(skyculture_t *cult)
 {
-    const skyculture_t *cult = g_skycultures->current;
-    const skyculture_name_t *entry = skycultures_get_name_info(main_id);
+    skyculture_name_t *item, *tmp;
+    hip_name_t *index;
+    int hip;
 
-    if (!cult || !entry) return NULL;
+    HASH_ITER(hh, cult->names, item, tmp) {
+        if (sscanf(item->main_id, "HIP %d", &hip) != 1) continue;
+        index = calloc(1, sizeof(*index));
+        index->hip = hip;
+        index->entry = item;
+        HASH_ADD_INT(cult->hip_names, hip, index);
+    }
+}
 
+/*
+ * Format a common name entry according to the current name style (see
+ * skycultures_get_label).
+ */
+static const char *skyculture_format_name(const skyculture_t *cult,
+                                          const skyculture_name_t *entry,
+                                          char *out, int out_size)
+{
     switch (g_skycultures->name_format_style) {
     case NAME_AUTO:
         if (cult->prefer_native_names) {
@@ -717,6 +810,53 @@ const char *skycultures_get_label(const char* main_id, char *out, int out_size)
     return NULL;
 }
 
+/*
+ * Function: skycultures_get_label
+ * Get the label of a sky object in the current skyculture, translated
+ * for the current language.
+ *
+ * Parameters:
+ *   main_id        - the main ID of the sky object:
+ *                     - for bright stars use "HIP XXXX"
+ *                     - for constellations use "CON culture_name XXX"
+ *                     - for planets use "NAME Planet"
+ *                     - for DSO use the first identifier of the names list
+ *   out            - A text buffer that get filled with the name.
+ *   out_size       - size of the out buffer.
+ *
+ * Return:
+ *   NULL if no name was found.  A pointer to the passed buffer otherwise.
+ */
+const char *skycultures_get_label(const char* main_id, char *out, int out_size)
+{
+    const skyculture_t *cult = g_skycultures->current;
+    const skyculture_name_t *entry = skycultures_get_name_info(main_id);
+
+    if (!cult || !entry) return NULL;
+    return skyculture_format_name(cult, entry, out, out_size);
+}
+
+/*
+ * Function: skycultures_get_label_hip
+ * Same as <skycultures_get_label> for a bright star, from its HIP
+ * number directly.
+ *
+ * This is the hot path of the star label rendering: the lookup is a
+ * single integer hash in an index built once per culture, without
+ * formatting an identifier string.
+ */
+const char *skycultures_get_label_hip(int hip, char *out, int out_size)
+{
+    skyculture_t *cult = g_skycultures->current;
+    const hip_name_t *index;
+
+    if (!cult || !cult->names) return NULL;
+    if (!cult->hip_names) skyculture_index_hip_names(cult);
+    HASH_FIND_INT(cult->hip_names, &hip, index);
+    if (!index) return NULL;
+    return skyculture_format_name(cult, index->entry, out, out_size);
+}
+
 static void add_one_sc_names_(const skyculture_name_t *entry, const obj_t *obj,
                              void *user, void (*f)(const obj_t *obj, void *user,
                                                    const char *dsgn))
@@ -57,6 +57,18 @@ struct survey {
     survey_t *next, *prev;
 };
 
+/*
+ * Coverage map of the bundled (non gaia) catalogs: one byte per healpix
+ * cell of COVERAGE_ORDER, set once a bundled survey has loaded a tile
+ * whose subtree contains the cell.  A bundled catalog is complete down
+ * to its max_vmag wherever it has data, so a set cell means every gaia
+ * star brighter than the gaia min_vmag there is a duplicate: the render
+ * visitor can then skip whole shadowed gaia regions with a single mask
+ * test, before any fetch.
+ */
+#define COVERAGE_ORDER 3
+#define COVERAGE_NPIX (12 * (1 << (2 * COVERAGE_ORDER)))
+
 /*
  * Type: stars_t
  * The module object.
@@ -66,6 +78,7 @@ struct stars {
     regex_t         search_reg;
     survey_t        *surveys; // All the added surveys.
     bool            visible;
+    uint8_t         covered[COVERAGE_NPIX]; // See COVERAGE_ORDER.
     // Hints/labels magnitude offset
     double          hints_mag_offset;
     bool            hints_visible;
@@ -74,6 +87,39 @@ struct stars {
 // Static instance.
 static stars_t *g_stars = NULL;
 
+// Mark the coverage cells of a loaded bundled tile subtree.
+static void coverage_mark(stars_t *stars, int order, int pix)
+{
+    int i, n;
+    if (order >= COVERAGE_ORDER) {
+        stars->covered[pix >> (2 * (order - COVERAGE_ORDER))] = 1;
+        return;
+    }
+    n = 1 << (2 * (COVERAGE_ORDER - order));
+    for (i = 0; i < n; i++)
+        stars->covered[pix * n + i] = 1;
+}
+
+// Test whether a whole tile subtree is covered by the bundled catalogs.
+static bool coverage_test(const stars_t *stars, int order, int pix)
+{
+    int i, n;
+    if (order >= COVERAGE_ORDER)
+        return stars->covered[pix >> (2 * (order - COVERAGE_ORDER))];
+    n = 1 << (2 * (COVERAGE_ORDER - order));
+    for (i = 0; i < n; i++)
+        if (!stars->covered[pix * n + i]) return false;
+    return true;
+}
+
+static bool coverage_complete(const stars_t *stars)
+{
+    int i;
+    for (i = 0; i < COVERAGE_NPIX; i++)
+        if (!stars->covered[i]) return false;
+    return true;
+}
+
 /*
  * Type: tile_t
  * Custom tile structure for the stars hips survey.
@@ -85,6 +131,33 @@ typedef struct tile {
     double      illuminance; // Totall illuminance (lux).
     int         nb;
     star_data_t *sources;
+    /* SoA mirrors of sources, kept in the same vmag order, so that the
+     * magnitude cut and the fast clipping test can run as tight
+     * vectorizable passes before any per-star work. */
+    float       *vmag;      // Contiguous visual magnitudes.
+    double      (*pos)[3];  // Catalog positions (epoch 2000).
+    double      (*spd)[3];  // Catalog speed vectors.
+    /* Star colors baked from B-V at load time (pre tonemap), so the
+     * render loop reads final bytes instead of converting per frame. */
+    uint8_t     (*rgb)[3];
+    /* Proper-motion-corrected positions, cached at a reference time.
+     * The cache stays valid while the observer time remains within
+     * pm_window days of pm_epoch, so that at normal time rates we don't
+     * reapply the proper motion of every star on every frame.  The window
+     * is derived from the largest angular proper motion of the tile. */
+    double      (*pm_pos)[3];
+    double      pm_epoch;   // TT (MJD) of the cached positions (NAN if none).
+    double      pm_window;  // Validity half-window (days).
+    /* Minimum vmag of each child subtree, parsed from the optional
+     * "children_min_vmag" attribute of the tile json header.  This lets
+     * the renderer cut whole subtrees before any fetch or decode.
+     * NAN when the survey doesn't provide the information. */
+    float       children_mag_min[4];
+    /* Set on a gaia tile that kept bright stars because the bundled
+     * coverage of its cell had not loaded yet: the render visitor
+     * re-checks the coverage and compacts the duplicates away once the
+     * bundled tile lands. */
+    bool        dup_check;
 } tile_t;
 
 static uint64_t pix_to_nuniq(int order, int pix)
@@ -276,13 +349,11 @@ static json_value *star_get_json_data(const obj_t *obj)
 static bool star_get_skycultural_name(const star_data_t *s, char *out, int size)
 {
     const char *name;
-    char hip_buf[128];
 
     // Only hipparcos stars have names in sky cultures
     if (s->hip == 0)
         return false;
-    snprintf(hip_buf, sizeof(hip_buf), "HIP %d", s->hip);
-    name = skycultures_get_label(hip_buf, out, size);
+    name = skycultures_get_label_hip(s->hip, out, size);
     return name != NULL;
 }
 
@@ -318,7 +389,7 @@ static bool star_get_bayer_name(const star_data_t *s, char *out, int size,
             break;
     }
     if (*names) {
-        designation_cleanup(names, out, size, flags);
+        snprintf(out, size, "%s", designation_cleanup_cached(names, flags));
         return true;
     }
     return false;
@@ -365,7 +436,8 @@ static void star_render_name(const painter_t *painter, const star_data_t *s,
                 // Use long version of bayer name for very bright stars
                 flags |= BAYER_LATIN_LONG | BAYER_CONST_LONG;
             }
-            designation_cleanup(first_name, buf, sizeof(buf), flags);
+            snprintf(buf, sizeof(buf), "%s",
+                     designation_cleanup_cached(first_name, flags));
         } else {
             // From here we know the star is not selected and not very bright
             // just display the small form of bayer name to save space.
@@ -458,8 +530,13 @@ static int del_tile(void *data)
         free(tile->sources[i].names);
         free(tile->sources[i].sp_type);
     }
-    free(tile->sources);
-    free(tile);
+    mem_free(tile->sources);
+    mem_free(tile->vmag);
+    mem_free(tile->pos);
+    mem_free(tile->spd);
+    mem_free(tile->rgb);
+    mem_free(tile->pm_pos);
+    mem_free(tile);
     return 0;
 }
 
@@ -493,6 +570,7 @@ static int on_file_tile_loaded(const char type[4],
     int version, nb, data_ofs = 0, row_size, flags, i, j, order, pix;
     int children_mask;
     double vmag, gmag, ra, de, pra, pde, plx, bv, epoch;
+    double rate, rate_max, color[3];
     char ids[256] = {};
     char sp_type[32] = {};
     survey_t *survey = USER_GET(user, 0);
@@ -501,6 +579,7 @@ static int on_file_tile_loaded(const char type[4],
     tile_t *tile;
     void *table_data;
     star_data_t *s;
+    const json_value *jchildren, *jval;
 
     // All the columns we care about in the source file.
     eph_table_column_t columns[] = {
@@ -543,8 +622,8 @@ static int on_file_tile_loaded(const char type[4],
     data_ofs = 0;
     if (flags & 1) eph_shuffle_bytes(table_data, row_size, nb);
 
-    tile = calloc(1, sizeof(*tile));
-    tile->sources = calloc(nb, sizeof(*tile->sources));
+    tile = mem_calloc(MEM_TAG_STARS, 1, sizeof(*tile));
+    tile->sources = mem_calloc(MEM_TAG_STARS, nb, sizeof(*tile->sources));
     tile->mag_min = DBL_MAX;
     tile->mag_max = -DBL_MAX;
 
@@ -563,8 +642,11 @@ static int on_file_tile_loaded(const char type[4],
         // current data has some wrong values.
         if (!isnan(plx) && (plx < 2.0 / 1000)) plx = 0.0;
 
-        // Avoid overlapping stars from Gaia survey.
-        if (survey->is_gaia && vmag < survey->min_vmag) continue;
+        // Avoid overlapping stars from Gaia survey.  Where the bundled
+        // catalogs have no coverage, keep the bright stars instead of
+        // leaving a hole.
+        if (survey->is_gaia && vmag < survey->min_vmag &&
+                coverage_test(g_stars, order, pix)) continue;
 
         if (!*s->type) strncpy(s->type, "*", 4); // Default type.
         epoch = epoch ?: 2000; // Default epoch.
@@ -596,14 +678,58 @@ static int on_file_tile_loaded(const char type[4],
     qsort(tile->sources, tile->nb, sizeof(*tile->sources), star_data_cmp);
     free(table_data);
 
-    // If we have a json header, check for a children mask value.
+    // Build the SoA arrays used by the render fast paths.
+    tile->vmag = mem_calloc(MEM_TAG_STARS, tile->nb, sizeof(*tile->vmag));
+    tile->pos = mem_calloc(MEM_TAG_STARS, tile->nb, sizeof(*tile->pos));
+    tile->spd = mem_calloc(MEM_TAG_STARS, tile->nb, sizeof(*tile->spd));
+    tile->rgb = mem_calloc(MEM_TAG_STARS, tile->nb, sizeof(*tile->rgb));
+    tile->pm_pos = mem_calloc(MEM_TAG_STARS, tile->nb,
+                              sizeof(*tile->pm_pos));
+    tile->pm_epoch = NAN;
+    rate_max = 0;
+    for (i = 0; i < tile->nb; i++) {
+        tile->vmag[i] = tile->sources[i].vmag;
+        vec3_copy(tile->sources[i].pvo[0], tile->pos[i]);
+        vec3_copy(tile->sources[i].pvo[1], tile->spd[i]);
+        bv = tile->sources[i].bv;
+        bv_to_rgb(isnan(bv) ? 0 : bv, color);
+        for (j = 0; j < 3; j++)
+            tile->rgb[i][j] = color[j] * 255;
+        // Angular proper motion rate (rad/day).
+        rate = vec3_norm(tile->spd[i]) / max(vec3_norm(tile->pos[i]), 1.0);
+        rate_max = max(rate_max, rate);
+    }
+    // Allow up to one mas of proper motion drift before we refresh the
+    // cached positions.
+    tile->pm_window = rate_max ? ERFA_DMAS2R / rate_max : DBL_MAX;
+
+    for (i = 0; i < 4; i++)
+        tile->children_mag_min[i] = NAN;
+
+    // If we have a json header, check for a children mask value, and for
+    // the optional min vmag of the children subtrees.
     if (json) {
         children_mask = json_get_attr_i(json, "children_mask", -1);
         if (children_mask != -1) {
             *transparency = (~children_mask) & 15;
         }
+        jchildren = json_get_attr(json, "children_min_vmag", json_array);
+        if (jchildren && jchildren->u.array.length == 4) {
+            for (i = 0; i < 4; i++) {
+                jval = jchildren->u.array.values[i];
+                if (jval->type == json_double)
+                    tile->children_mag_min[i] = jval->u.dbl;
+                else if (jval->type == json_integer)
+                    tile->children_mag_min[i] = jval->u.integer;
+            }
+        }
     }
 
+    if (!survey->is_gaia)
+        coverage_mark(g_stars, order, pix);
+    else
+        tile->dup_check = tile->nb && tile->vmag[0] < survey->min_vmag;
+
     *out = tile;
     return 0;
 }
@@ -616,7 +742,9 @@ static const void *stars_create_tile(
     survey_t *survey = user;
     eph_load(data, size, USER_PASS(survey, &tile, transparency),
              on_file_tile_loaded);
-    if (tile) *cost = tile->nb * sizeof(*tile->sources);
+    if (tile) *cost = tile->nb * (sizeof(*tile->sources) +
+                                  sizeof(*tile->vmag) + sizeof(*tile->rgb) +
+                                  sizeof(*tile->pos) + sizeof(*tile->spd));
     return tile;
 }
 
@@ -670,6 +798,52 @@ static tile_t *get_tile(stars_t *stars, survey_t *survey, int order, int pix,
     return tile;
 }
 
+/*
+ * Return the number of stars of a tile with a vmag lower than limit_mag.
+ * Since the tile sources are sorted by vmag we can use a binary search.
+ */
+static int tile_count_below_mag(const tile_t *tile, double limit_mag)
+{
+    int lo = 0, hi = tile->nb, mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (tile->vmag[mid] > limit_mag)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+    return lo;
+}
+
+/*
+ * Drop from a gaia tile the bright stars that a bundled survey now
+ * shadows.  Those were kept at parse time because the bundled tile of
+ * the cell had not finished loading (see <dup_check>); since the sources
+ * are sorted by vmag they form a prefix of the arrays.
+ */
+static void tile_drop_covered_bright(tile_t *tile, double min_vmag)
+{
+    int i, n = 0;
+    while (n < tile->nb && tile->vmag[n] < min_vmag) n++;
+    tile->dup_check = false;
+    if (n == 0) return;
+    for (i = 0; i < n; i++) {
+        tile->illuminance -= tile->sources[i].illuminance;
+        free(tile->sources[i].names);
+        free(tile->sources[i].sp_type);
+    }
+    tile->nb -= n;
+    memmove(tile->sources, tile->sources + n,
+            tile->nb * sizeof(*tile->sources));
+    memmove(tile->vmag, tile->vmag + n, tile->nb * sizeof(*tile->vmag));
+    memmove(tile->pos, tile->pos + n, tile->nb * sizeof(*tile->pos));
+    memmove(tile->spd, tile->spd + n, tile->nb * sizeof(*tile->spd));
+    memmove(tile->rgb, tile->rgb + n, tile->nb * sizeof(*tile->rgb));
+    memmove(tile->pm_pos, tile->pm_pos + n,
+            tile->nb * sizeof(*tile->pm_pos));
+    tile->mag_min = tile->nb ? tile->vmag[0] : DBL_MAX;
+}
+
 static int render_visitor(int order, int pix, void *user)
 {
     PROFILE(stars_render_visitor, PROFILE_AGGREGATE);
@@ -680,11 +854,15 @@ static int render_visitor(int order, int pix, void *user)
     int *nb_loaded = USER_GET(user, 4);
     double *illuminance = USER_GET(user, 5);
     tile_t *tile;
-    int i, n = 0, code;
+    int i, j, n = 0, nb_vis, nb_sel = 0, code, *idx;
     star_data_t *s;
-    double p_win[4], size = 0, luminance = 0, vmag = -DBL_MAX;
+    double size = 0, luminance = 0, vmag = -DBL_MAX;
     double color[3];
-    double v[3];
+    double dt;
+    double (*astrom)[3];
+    double (*view)[3];
+    double (*win)[4];
+    uint8_t *clipped;
     double limit_mag = min(painter.stars_limit_mag, painter.hard_limit_mag);
     bool selected;
 
@@ -693,21 +871,91 @@ static int render_visitor(int order, int pix, void *user)
         return 0;
     if (order < survey->min_order) return 1;
 
+    /* If the parent tile knows the min vmag of this subtree, we can cut
+     * the whole subtree before even requesting the tile. */
+    if (order > survey->min_order && survey->hips) {
+        const tile_t *parent = hips_get_tile(
+                survey->hips, order - 1, pix / 4, HIPS_CACHED_ONLY, &code);
+        if (parent && !isnan(parent->children_mag_min[pix % 4]) &&
+                parent->children_mag_min[pix % 4] > limit_mag)
+            return 0;
+    }
+
+    /* Shadowed gaia region: everything this subtree would contribute
+     * at the current magnitude limit is already in a bundled survey, so
+     * skip it without even fetching the tile. */
+    if (survey->is_gaia && limit_mag <= survey->min_vmag &&
+            coverage_test(stars, order, pix))
+        return 0;
+
     (*nb_tot)++;
     tile = get_tile(stars, survey, order, pix, false, &code);
     if (code) (*nb_loaded)++;
 
     if (!tile) goto end;
+
+    /* A gaia tile parsed before the bundled tile of its cell finished
+     * loading keeps bright duplicates: drop them once the coverage
+     * arrives. */
+    if (tile->dup_check && coverage_test(stars, order, pix))
+        tile_drop_covered_bright(tile, survey->min_vmag);
+
     if (tile->mag_min > limit_mag) goto end;
 
-    point_t *points = malloc(tile->nb * sizeof(*points));
-    for (i = 0; i < tile->nb; i++) {
+    nb_vis = tile_count_below_mag(tile, limit_mag);
+    if (nb_vis == 0) goto end;
+
+    /* Lazily refresh the proper-motion-corrected positions: at normal time
+     * rates the correction drifts by less than a mas between frames, so we
+     * only recompute when the time leaves the tile validity window. */
+    if (isnan(tile->pm_epoch) ||
+            fabs(painter.obs->tt - tile->pm_epoch) > tile->pm_window) {
+        dt = painter.obs->tt - ERFA_DJM00;
+        for (i = 0; i < tile->nb; i++)
+            vec3_addk(tile->pos[i], tile->spd[i], dt, tile->pm_pos[i]);
+        tile->pm_epoch = painter.obs->tt;
+    }
+
+    /* Vectorizable SoA pass: compute all the astrometric directions, then
+     * cull against the viewport, emitting a compact index list so that the
+     * more expensive per-star work below only runs on visible stars. */
+    astrom = malloc(nb_vis * sizeof(*astrom));
+    idx = malloc(nb_vis * sizeof(*idx));
+    for (i = 0; i < nb_vis; i++) {
+        vec3_sub(tile->pm_pos[i], painter.obs->earth_pvb[0], astrom[i]);
+        vec3_normalize(astrom[i], astrom[i]);
+    }
+    clipped = malloc((nb_vis + 7) / 8);
+    painter_is_point_clipped_fast_n(&painter, FRAME_ASTROM, nb_vis,
+                                    (const double (*)[3])astrom, true,
+                                    clipped);
+    for (i = 0; i < nb_vis; i++) {
+        if (!(clipped[i / 8] & (1 << (i % 8))))
+            idx[nb_sel++] = i;
+    }
+    free(clipped);
+
+    /* Batch convert and project the selected stars: the frame rotation and
+     * the projection dispatch are amortized over the whole array. */
+    view = malloc(nb_sel * sizeof(*view));
+    for (j = 0; j < nb_sel; j++)
+        vec3_copy(astrom[idx[j]], view[j]);
+    convert_frame_n(painter.obs, FRAME_ASTROM, FRAME_VIEW, true,
+                    nb_sel, view, view);
+    win = malloc(nb_sel * sizeof(*win));
+    for (j = 0; j < nb_sel; j++) {
+        vec3_copy(view[j], win[j]);
+        win[j][3] = 0;
+    }
+    project_n(painter.proj, PROJ_ALREADY_NORMALIZED | PROJ_TO_WINDOW_SPACE,
+              nb_sel, win, win);
+
+    point_t *points = malloc(nb_sel * sizeof(*points));
+    for (j = 0; j < nb_sel; j++) {
+        i = idx[j];
         s = &tile->sources[i];
-        if (s->vmag > limit_mag) break;
 
-        star_get_astrom(s, painter.obs, v);
-        if (!painter_project(&painter, FRAME_ASTROM, v, true, true, p_win))
-            continue;
+        if (win[j][3] == 0) continue; // Clipped by the projection.
 
         (*illuminance) += s->illuminance;
 
@@ -720,11 +968,10 @@ static int render_visitor(int order, int pix, void *user)
         if (size == 0.0 || luminance == 0.0)
             continue;
 
-        bv_to_rgb(isnan(s->bv) ? 0 : s->bv, color);
         points[n] = (point_t) {
-            .pos = {p_win[0], p_win[1]},
+            .pos = {win[j][0], win[j][1]},
             .size = size,
-            .color = {color[0] * 255, color[1] * 255, color[2] * 255,
+            .color = {tile->rgb[i][0], tile->rgb[i][1], tile->rgb[i][2],
                       luminance * 255},
             // This makes very faint stars not selectable
             .oid = (luminance > 0.5 && size > 1) ? s->oid : 0,
@@ -732,11 +979,19 @@ static int render_visitor(int order, int pix, void *user)
         };
         n++;
         selected = core->selection && s->oid == core->selection->oid;
-        if (selected || (stars->hints_visible && !survey->is_gaia))
-            star_render_name(&painter, s, FRAME_ASTROM, v, size, color);
+        if (selected || (stars->hints_visible && !survey->is_gaia)) {
+            vec3_set(color, tile->rgb[i][0] / 255., tile->rgb[i][1] / 255.,
+                     tile->rgb[i][2] / 255.);
+            star_render_name(&painter, s, FRAME_ASTROM, astrom[i], size,
+                             color);
+        }
     }
     paint_2d_points(&painter, n, points);
     free(points);
+    free(win);
+    free(view);
+    free(idx);
+    free(astrom);
 
 end:
     // Test if we should go into higher order tiles.
@@ -759,8 +1014,11 @@ static int stars_render(const obj_t *obj, const painter_t *painter_)
 
     DL_FOREACH(stars->surveys, survey) {
         // Don't even traverse if the min vmag of the survey is higher than
-        // the max visible vmag.
-        if (survey->min_vmag > painter.stars_limit_mag)
+        // the max visible vmag.  For gaia this is only valid once the
+        // bundled catalogs cover the whole sky: until then the visitor
+        // still renders the uncovered cells.
+        if (survey->min_vmag > painter.stars_limit_mag &&
+                (!survey->is_gaia || coverage_complete(stars)))
             continue;
         hips_traverse(USER_PASS(stars, survey, &painter,
                       &nb_tot, &nb_loaded, &illuminance),
@@ -897,9 +1155,11 @@ static obj_t *stars_get_by_oid(const obj_t *obj, uint64_t oid, uint64_t hint)
 
 static int stars_list(const obj_t *obj,
                       double max_mag, uint64_t hint, const char *source,
+                      const char *type, module_list_cursor_t *cursor,
                       void *user, int (*f)(void *user, obj_t *obj))
 {
-    int order, pix, i, r, code;
+    int order, pix, i, nb, r, code;
+    uint64_t nuniq;
     tile_t *tile;
     stars_t *stars = (void*)obj;
     star_t *star;
@@ -923,16 +1183,33 @@ static int stars_list(const obj_t *obj,
         while (hips_iter_next(&iter, &order, &pix)) {
             tile = get_tile(stars, survey, order, pix, false, &code);
             if (!tile || tile->mag_min >= max_mag) continue;
-            for (i = 0; i < tile->nb; i++) {
-                if (tile->sources[i].vmag > max_mag) continue;
-                star = star_create(&tile->sources[i]);
-                r = f(user, (obj_t*)star);
-                obj_release((obj_t*)star);
-                if (r) break;
+            /* The iteration visits the tiles by increasing nuniq value,
+             * so a cursor can resume by skipping the already listed
+             * tiles. */
+            nuniq = pix + 4 * (1ULL << (2 * order));
+            if (!cursor || nuniq >= cursor->tile) {
+                /* The tile sources are sorted by vmag, so we only walk
+                 * the prefix below the magnitude cut. */
+                nb = tile_count_below_mag(tile, max_mag);
+                i = (cursor && nuniq == cursor->tile) ? cursor->index : 0;
+                for (; i < nb; i++) {
+                    if (type && !otype_match(tile->sources[i].type, type))
+                        continue;
+                    star = star_create(&tile->sources[i]);
+                    r = f(user, (obj_t*)star);
+                    obj_release((obj_t*)star);
+                    if (r) {
+                        if (cursor) {
+                            cursor->tile = nuniq;
+                            cursor->index = i + 1;
+                        }
+                        return 0;
+                    }
+                }
             }
-            if (i < tile->nb) break;
             hips_iter_push_children(&iter, order, pix);
         }
+        if (cursor) cursor->done = true;
         return 0;
     }
 
@@ -943,12 +1220,19 @@ static int stars_list(const obj_t *obj,
         if (!code) return MODULE_AGAIN; // Try again later.
         return -1;
     }
-    for (i = 0; i < tile->nb; i++) {
+    nb = tile_count_below_mag(tile, max_mag);
+    for (i = cursor ? cursor->index : 0; i < nb; i++) {
+        if (type && !otype_match(tile->sources[i].type, type))
+            continue;
         star = star_create(&tile->sources[i]);
         r = f(user, (obj_t*)star);
         obj_release((obj_t*)star);
-        if (r) break;
+        if (r) {
+            if (cursor) cursor->index = i + 1;
+            return 0;
+        }
     }
+    if (cursor) cursor->done = true;
     return 0;
 }
 
@@ -1036,14 +1320,20 @@ static int stars_add_data_source(obj_t *obj, const char *url, const char *key)
     survey_settings.user = survey;
     snprintf(survey->url, sizeof(survey->url), "%s", url);
     survey->hips = hips_create(survey->url, release_date, &survey_settings);
+    // Catalog tiles go in front of the imagery surveys.
+    hips_set_priority(survey->hips, ASSET_PRIORITY_HIGH);
     survey->min_order = properties_get_f(args, "hips_order_min", 0);
     survey->max_vmag = properties_get_f(args, "max_vmag", NAN);
     survey->min_vmag = properties_get_f(args, "min_vmag", -2.0);
 
-    // Preload the first level of the survey (only for bright stars).
+    /* Preload the first level of the survey (only for bright stars).
+     * Use the threaded loader so that the zlib inflate and byte unshuffling
+     * of the twelve tiles run in the worker pool instead of blocking the
+     * main loop at startup: the tiles get swapped into the survey cache
+     * once fully built, exactly like the render path. */
     if (survey->min_order == 0 && survey->min_vmag <= 0.0) {
         for (i = 0; i < 12; i++) {
-            hips_get_tile(survey->hips, 0, i, 0, &code);
+            hips_get_tile(survey->hips, 0, i, HIPS_LOAD_IN_THREAD, &code);
         }
     }
 
@@ -1104,6 +1394,9 @@ static obj_klass_t star_klass = {
     .init       = star_init,
     .size       = sizeof(star_t),
     .get_info   = star_get_info,
+    // The vmag and distance come straight from the catalog.
+    .info_time_invariant = 1 << (INFO_VMAG / 1024) |
+                           1 << (INFO_DISTANCE / 1024),
     .get_json_data = star_get_json_data,
     .render     = star_render,
     .get_designations = star_get_designations,
@@ -0,0 +1,357 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+/*
+ * Stress module: synthesize arbitrary amounts of data directly into the
+ * standard rendering pipelines, so we can measure where the engine breaks
+ * without crafting catalog files.  Everything is driven by attributes:
+ *
+ *   core.stress.nb_stars      - Fixed synthetic stars (points + labels).
+ *   core.stress.nb_satellites - Moving points, recomputed every frame.
+ *   core.stress.nb_geojson    - Features fed to a child geojson layer.
+ *   core.stress.nb_labels     - Labels put on the brightest stars.
+ *
+ * All the data is generated from a fixed seed, so two runs (or a replay)
+ * see the exact same scene.  Everything defaults to zero: the module
+ * costs nothing until it is actually used.
+ */
+
+#include "swe.h"
+
+static const double LABEL_SPACING = 4;
+
+typedef struct stress {
+    obj_t       obj;
+    bool        visible;
+    int         nb_stars;
+    int         nb_satellites;
+    int         nb_geojson;
+    int         nb_labels;
+
+    // Generated catalogs, regenerated lazily when the counts change.
+    int         stars_nb;
+    double      (*pos)[3];      // Unit ICRF directions, sorted by vmag.
+    float       *vmag;
+    float       *bv;
+    int         sats_nb;
+    double      (*sat_u)[3];    // Per satellite orbit plane basis.
+    double      (*sat_v)[3];
+    float       *sat_n;         // Mean motion (rad / day).
+    double      (*sat_dirs)[3]; // Directions of the current frame.
+    int         geojson_nb;
+    obj_t       *geojson;       // Child layer fed through its data attr.
+} stress_t;
+
+/*
+ * Deterministic LCG, so the scene does not depend on rand() state or on
+ * the platform.  Returns a double in [0, 1).
+ */
+static double frand(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state / 4294967296.0;
+}
+
+static void rand_dir(uint32_t *state, double out[3])
+{
+    double z, r, phi;
+    z = 2 * frand(state) - 1;
+    phi = 2 * M_PI * frand(state);
+    r = sqrt(max(1 - z * z, 0));
+    out[0] = r * cos(phi);
+    out[1] = r * sin(phi);
+    out[2] = z;
+}
+
+/*
+ * Magnitude with a realistic cumulative distribution: the star counts
+ * roughly follow N(<m) ∝ 10^(0.51 m), so most generated stars are faint,
+ * like in a real catalog.  Range -1 to 15.
+ */
+static double rand_vmag(uint32_t *state)
+{
+    const double m0 = -1, m1 = 15, k = 0.51;
+    double u = frand(state);
+    return m0 + log10(u * (pow(10, k * (m1 - m0)) - 1) + 1) / k;
+}
+
+typedef struct {
+    double pos[3];
+    float vmag;
+    float bv;
+} gen_star_t;
+
+static int star_cmp(const void *a, const void *b)
+{
+    float va = ((const gen_star_t*)a)->vmag, vb = ((const gen_star_t*)b)->vmag;
+    return va < vb ? -1 : va > vb ? 1 : 0;
+}
+
+static void gen_stars(stress_t *s)
+{
+    uint32_t state = 0x5757u;
+    gen_star_t *stars;
+    int i;
+
+    mem_free(s->pos);
+    mem_free(s->vmag);
+    mem_free(s->bv);
+    s->pos = NULL;
+    s->vmag = NULL;
+    s->bv = NULL;
+    s->stars_nb = s->nb_stars;
+    if (!s->stars_nb) return;
+
+    stars = malloc(s->stars_nb * sizeof(*stars));
+    for (i = 0; i < s->stars_nb; i++) {
+        rand_dir(&state, stars[i].pos);
+        stars[i].vmag = rand_vmag(&state);
+        stars[i].bv = frand(&state) * 2.4 - 0.4;
+    }
+    // Sort by vmag like the real catalogs: the point size cache in the
+    // render loop relies on it, and it makes the brightest-first label
+    // pass a simple index range.
+    qsort(stars, s->stars_nb, sizeof(*stars), star_cmp);
+
+    s->pos = mem_alloc(MEM_TAG_OTHER, s->stars_nb * sizeof(*s->pos));
+    s->vmag = mem_alloc(MEM_TAG_OTHER, s->stars_nb * sizeof(*s->vmag));
+    s->bv = mem_alloc(MEM_TAG_OTHER, s->stars_nb * sizeof(*s->bv));
+    for (i = 0; i < s->stars_nb; i++) {
+        vec3_copy(stars[i].pos, s->pos[i]);
+        s->vmag[i] = stars[i].vmag;
+        s->bv[i] = stars[i].bv;
+    }
+    free(stars);
+}
+
+static void gen_satellites(stress_t *s)
+{
+    uint32_t state = 0x5a7eu;
+    double w[3];
+    int i;
+
+    mem_free(s->sat_u);
+    mem_free(s->sat_v);
+    mem_free(s->sat_n);
+    mem_free(s->sat_dirs);
+    s->sat_u = NULL;
+    s->sat_v = NULL;
+    s->sat_n = NULL;
+    s->sat_dirs = NULL;
+    s->sats_nb = s->nb_satellites;
+    if (!s->sats_nb) return;
+
+    s->sat_u = mem_alloc(MEM_TAG_OTHER, s->sats_nb * sizeof(*s->sat_u));
+    s->sat_v = mem_alloc(MEM_TAG_OTHER, s->sats_nb * sizeof(*s->sat_v));
+    s->sat_n = mem_alloc(MEM_TAG_OTHER, s->sats_nb * sizeof(*s->sat_n));
+    s->sat_dirs = mem_alloc(MEM_TAG_OTHER, s->sats_nb * sizeof(*s->sat_dirs));
+    for (i = 0; i < s->sats_nb; i++) {
+        // Random orbit plane: an orthonormal basis (u, v) so the position
+        // at time t is just u cos(nt) + v sin(nt).  These are not physical
+        // orbits: what we stress is the per-frame recompute and the screen
+        // motion, not the accuracy.
+        rand_dir(&state, s->sat_u[i]);
+        rand_dir(&state, w);
+        vec3_cross(s->sat_u[i], w, s->sat_v[i]);
+        vec3_normalize(s->sat_v[i], s->sat_v[i]);
+        // LEO-ish periods: 90 to 360 minutes.
+        s->sat_n[i] = 2 * M_PI * 24 * 60 / (90 + frand(&state) * 270);
+    }
+}
+
+static void gen_geojson(stress_t *s)
+{
+    uint32_t state = 0x9e05u;
+    json_value *fc, *features, *feature, *geo, *rings, *ring, *pt, *props;
+    double lon, lat, size;
+    char buf[32];
+    int i, j;
+    const double quad[4][2] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+
+    s->geojson_nb = s->nb_geojson;
+    if (!s->geojson) {
+        if (!s->geojson_nb) return;
+        s->geojson = module_add_new(&s->obj, "geojson", NULL, NULL);
+    }
+
+    // Small polygon quads at random positions, with a title so the label
+    // pipeline is stressed too.
+    features = json_array_new(s->geojson_nb);
+    for (i = 0; i < s->geojson_nb; i++) {
+        lon = frand(&state) * 360 - 180;
+        lat = asin(2 * frand(&state) - 1) / DD2R;
+        size = 0.5 + frand(&state) * 2.5;
+        ring = json_array_new(5);
+        for (j = 0; j < 5; j++) {
+            pt = json_array_new(2);
+            json_array_push(pt, json_double_new(
+                        lon + quad[j % 4][0] * size));
+            json_array_push(pt, json_double_new(
+                        lat + quad[j % 4][1] * size));
+            json_array_push(ring, pt);
+        }
+        rings = json_array_new(1);
+        json_array_push(rings, ring);
+        geo = json_object_new(2);
+        json_object_push(geo, "type", json_string_new("Polygon"));
+        json_object_push(geo, "coordinates", rings);
+        props = json_object_new(2);
+        snprintf(buf, sizeof(buf), "Stress %d", i);
+        json_object_push(props, "title", json_string_new(buf));
+        json_object_push(props, "fill-opacity", json_double_new(0.2));
+        feature = json_object_new(3);
+        json_object_push(feature, "type", json_string_new("Feature"));
+        json_object_push(feature, "geometry", geo);
+        json_object_push(feature, "properties", props);
+        json_array_push(features, feature);
+    }
+    fc = json_object_new(2);
+    json_object_push(fc, "type", json_string_new("FeatureCollection"));
+    json_object_push(fc, "features", features);
+    json_builder_free(obj_call_json(s->geojson, "data", fc));
+    json_builder_free(fc);
+}
+
+/*
+ * Render a batch of directions as 2d points, following the same SoA
+ * cull / convert / project path as the star module, so the synthetic
+ * points cost what real catalog stars cost.
+ */
+static void render_dirs(const painter_t *painter,
+                        int nb, const double (*dirs)[3], const float *vmags,
+                        const float *bvs, int nb_labels)
+{
+    double (*view)[3], (*win)[4];
+    double size = 0, luminance = 0, vmag = NAN, color[3] = {1, 1, 1};
+    uint8_t *clipped;
+    point_t *points;
+    int *idx, i, j, n = 0, nb_sel = 0;
+    char buf[32];
+
+    clipped = malloc((nb + 7) / 8);
+    idx = malloc(nb * sizeof(*idx));
+    painter_is_point_clipped_fast_n(painter, FRAME_ASTROM, nb, dirs, true,
+                                    clipped);
+    for (i = 0; i < nb; i++) {
+        if (!(clipped[i / 8] & (1 << (i % 8))))
+            idx[nb_sel++] = i;
+    }
+    free(clipped);
+
+    view = malloc(nb_sel * sizeof(*view));
+    for (j = 0; j < nb_sel; j++)
+        vec3_copy(dirs[idx[j]], view[j]);
+    convert_frame_n(painter->obs, FRAME_ASTROM, FRAME_VIEW, true,
+                    nb_sel, view, view);
+    win = malloc(nb_sel * sizeof(*win));
+    for (j = 0; j < nb_sel; j++) {
+        vec3_copy(view[j], win[j]);
+        win[j][3] = 0;
+    }
+    project_n(painter->proj, PROJ_ALREADY_NORMALIZED | PROJ_TO_WINDOW_SPACE,
+              nb_sel, win, win);
+    free(view);
+
+    points = malloc(nb_sel * sizeof(*points));
+    for (j = 0; j < nb_sel; j++) {
+        i = idx[j];
+        if (win[j][3] == 0) continue; // Clipped by the projection.
+        if ((vmags ? vmags[i] : 4.0) != vmag) {
+            vmag = vmags ? vmags[i] : 4.0;
+            core_get_point_for_mag(vmag, &size, &luminance);
+        }
+        if (size == 0.0 || luminance == 0.0)
+            continue;
+        bv_to_rgb(bvs ? bvs[i] : 0, color);
+        points[n] = (point_t) {
+            .pos = {win[j][0], win[j][1]},
+            .size = size,
+            .color = {color[0] * 255, color[1] * 255, color[2] * 255,
+                      luminance * 255},
+        };
+        n++;
+        if (i < nb_labels) {
+            snprintf(buf, sizeof(buf), "Stress %d", i);
+            labels_add_3d(buf, FRAME_ASTROM, dirs[i], true,
+                          size + LABEL_SPACING, FONT_SIZE_BASE,
+                          VEC(color[0], color[1], color[2], 0.8), 0, 0,
+                          TEXT_FLOAT, -vmag, 0);
+        }
+    }
+    paint_2d_points(painter, n, points);
+    free(points);
+    free(win);
+    free(idx);
+}
+
+static int stress_render(const obj_t *obj, const painter_t *painter)
+{
+    stress_t *s = (stress_t*)obj;
+    double (*dirs)[3], a;
+    int i;
+
+    if (!s->visible) return 0;
+    if (s->stars_nb != s->nb_stars) gen_stars(s);
+    if (s->sats_nb != s->nb_satellites) gen_satellites(s);
+    if (s->geojson_nb != s->nb_geojson) gen_geojson(s);
+
+    if (s->stars_nb)
+        render_dirs(painter, s->stars_nb,
+                    (const double (*)[3])s->pos, s->vmag, s->bv,
+                    s->nb_labels);
+
+    if (s->sats_nb) {
+        // The satellite directions move with the observer time and are
+        // recomputed every frame: this is the per-frame cost we measure.
+        // They don't depend on the view though, so in a multi viewport
+        // frame (core_render_views) only the first pass recomputes them.
+        if (core->render_pass == 0) {
+            dirs = s->sat_dirs;
+            for (i = 0; i < s->sats_nb; i++) {
+                a = s->sat_n[i] * painter->obs->utc;
+                dirs[i][0] = s->sat_u[i][0] * cos(a) + s->sat_v[i][0] * sin(a);
+                dirs[i][1] = s->sat_u[i][1] * cos(a) + s->sat_v[i][1] * sin(a);
+                dirs[i][2] = s->sat_u[i][2] * cos(a) + s->sat_v[i][2] * sin(a);
+            }
+        }
+        render_dirs(painter, s->sats_nb, (const double (*)[3])s->sat_dirs,
+                    NULL, NULL, 0);
+    }
+    return 0;
+}
+
+static int stress_init(obj_t *obj, json_value *args)
+{
+    stress_t *s = (stress_t*)obj;
+    s->visible = true;
+    return 0;
+}
+
+/*
+ * Meta class declarations.
+ */
+
+static obj_klass_t stress_klass = {
+    .id = "stress",
+    .size = sizeof(stress_t),
+    .flags = OBJ_IN_JSON_TREE | OBJ_MODULE,
+    .init = stress_init,
+    .render = stress_render,
+    .render_order = 21, // After the real catalogs.
+    .attributes = (attribute_t[]) {
+        PROPERTY(visible, TYPE_BOOL, MEMBER(stress_t, visible)),
+        PROPERTY(nb_stars, TYPE_INT, MEMBER(stress_t, nb_stars)),
+        PROPERTY(nb_satellites, TYPE_INT, MEMBER(stress_t, nb_satellites)),
+        PROPERTY(nb_geojson, TYPE_INT, MEMBER(stress_t, nb_geojson)),
+        PROPERTY(nb_labels, TYPE_INT, MEMBER(stress_t, nb_labels)),
+        {}
+    },
+};
+
+OBJ_REGISTER(stress_klass)
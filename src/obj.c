@@ -27,6 +27,57 @@ typedef struct {
 // Global list of all the registered klasses.
 static obj_klass_t *g_klasses = NULL;
 
+/*
+ * Global map of oid -> live object, so that the hot oid resolutions
+ * don't have to visit every module.  The entries are weak: an object is
+ * removed when it gets deleted, so the tile backed objects (stars,
+ * dso...) are only present while somebody holds a reference.
+ */
+typedef struct oid_entry {
+    UT_hash_handle  hh;
+    uint64_t        oid;
+    obj_t           *obj;
+} oid_entry_t;
+
+static oid_entry_t *g_oids = NULL;
+
+void obj_oid_map_add(obj_t *obj)
+{
+    oid_entry_t *e;
+
+    if (!obj->oid) return;
+    HASH_FIND(hh, g_oids, &obj->oid, sizeof(obj->oid), e);
+    if (!e) {
+        e = calloc(1, sizeof(*e));
+        e->oid = obj->oid;
+        HASH_ADD(hh, g_oids, oid, sizeof(e->oid), e);
+    }
+    e->obj = obj;
+}
+
+obj_t *obj_oid_map_get(uint64_t oid)
+{
+    oid_entry_t *e;
+    if (!oid) return NULL;
+    HASH_FIND(hh, g_oids, &oid, sizeof(oid), e);
+    return e ? e->obj : NULL;
+}
+
+static void oid_map_remove(const obj_t *obj)
+{
+    oid_entry_t *e;
+
+    if (!obj->oid) return;
+    HASH_FIND(hh, g_oids, &obj->oid, sizeof(obj->oid), e);
+    // Only remove if the entry points at this instance: a newer object
+    // with the same oid may have replaced it.
+    if (!e || e->obj != obj) return;
+    HASH_DELETE(hh, g_oids, e);
+    free(e);
+}
+
+static void info_memo_forget(const obj_t *obj);
+
 static obj_t *obj_create_(obj_klass_t *klass, const char *id, json_value *args)
 {
     const char *attr;
@@ -99,7 +150,10 @@ void obj_release(obj_t *obj)
             LOG_E("id: %s, klass: %s", obj->id, obj->klass->id);
         }
         assert(!obj->parent);
+        oid_map_remove(obj);
+        info_memo_forget(obj);
         if (obj->klass->del) obj->klass->del(obj);
+        free(obj->children_array);
         free(obj->id);
         free(obj);
     }
@@ -155,10 +209,16 @@ const char *obj_get_name(const obj_t *obj, char *buf, int len)
 
 int obj_render(const obj_t *obj, const painter_t *painter)
 {
-    if (obj->klass->render)
-        return obj->klass->render(obj, painter);
-    else
+    double cap[4];
+    int frame;
+    if (!obj->klass->render)
+        return 0;
+    // Skip the whole render if the object's content is off screen.
+    if (obj->klass->get_bounding_cap &&
+            obj->klass->get_bounding_cap(obj, &frame, cap) &&
+            painter_is_cap_clipped(painter, frame, cap))
         return 0;
+    return obj->klass->render(obj, painter);
 }
 
 /*
@@ -202,15 +262,65 @@ int obj_get_pos(obj_t *obj, observer_t *obs, int frame, double pos[4])
     return 0;
 }
 
-int obj_get_info(obj_t *obj, observer_t *obs, int info,
-                 void *out)
+/*
+ * Small memoization table for the computed info queries: a GUI panel
+ * typically queries a dozen infos of the selected object every frame,
+ * always with the same observer state.  The entries are keyed on
+ * (object, info, observer hash) so that repeated same frame queries
+ * become plain table hits.  Infos marked time invariant by their klass
+ * are stored with a null hash and thus survive observer changes.
+ */
+#define INFO_MEMO_SIZE 256
+static struct info_memo {
+    const obj_t *obj;       // NULL if the entry is empty.
+    int info;
+    uint64_t hash;          // Observer hash at computation time.
+    char value[2 * 4 * sizeof(double)]; // Big enough for TYPE_V4X2.
+} g_info_memos[INFO_MEMO_SIZE];
+
+/*
+ * Return the storage size of an info value, or 0 if the info cannot be
+ * memoized (pointer and string types, whose ownership we don't know).
+ */
+static int info_memo_value_size(int info)
+{
+    switch (info % 16) {
+    case TYPE_FLOAT:    return sizeof(double);
+    case TYPE_INT:      return sizeof(int);
+    case TYPE_BOOL:     return sizeof(bool);
+    case TYPE_OTYPE:    return 4;
+    case TYPE_V2:       return 2 * sizeof(double);
+    case TYPE_V3:       return 3 * sizeof(double);
+    case TYPE_V4:       return 4 * sizeof(double);
+    case TYPE_V4X2:     return 8 * sizeof(double);
+    default:            return 0;
+    }
+}
+
+static struct info_memo *info_memo_get_slot(const obj_t *obj, int info,
+                                            uint64_t hash)
+{
+    uint64_t h = (uintptr_t)obj / 8 + info * 2654435761u + hash;
+    return &g_info_memos[h % INFO_MEMO_SIZE];
+}
+
+/*
+ * Drop the memoized infos of an object about to be deleted, so that a
+ * future object reusing the same address cannot hit its values.
+ */
+static void info_memo_forget(const obj_t *obj)
+{
+    int i;
+    for (i = 0; i < INFO_MEMO_SIZE; i++)
+        if (g_info_memos[i].obj == obj) g_info_memos[i].obj = NULL;
+}
+
+static int obj_get_info_(obj_t *obj, observer_t *obs, int info,
+                         void *out)
 {
     double pvo[2][4], pos[3], ra, dec;
     int ret;
 
-    assert(obj);
-    observer_update(obs, true);
-
     if (obj->klass->get_info) {
         ret = obj->klass->get_info(obj, obs, info, out);
         if (!ret) return ret;
@@ -240,71 +350,119 @@ int obj_get_info(obj_t *obj, observer_t *obs, int info,
     return 1;
 }
 
-EMSCRIPTEN_KEEPALIVE
-char *obj_get_info_json(const obj_t *obj, observer_t *obs,
-                        const char *info_str)
+// Same as obj_get_info, but assumes the observer is already updated.
+static int obj_get_info_no_update(obj_t *obj, observer_t *obs, int info,
+                                  void *out)
+{
+    int ret, size;
+    uint64_t hash = 0;
+    struct info_memo *memo = NULL;
+
+    assert(obj);
+    size = info_memo_value_size(info);
+    if (size) {
+        if (!(obj->klass->info_time_invariant & (1 << (info / 1024))))
+            hash = obs->hash;
+        memo = info_memo_get_slot(obj, info, hash);
+        if (memo->obj == obj && memo->info == info && memo->hash == hash) {
+            memcpy(out, memo->value, size);
+            return 0;
+        }
+    }
+
+    ret = obj_get_info_(obj, obs, info, out);
+    if (ret == 0 && memo) {
+        memo->obj = obj;
+        memo->info = info;
+        memo->hash = hash;
+        memcpy(memo->value, out, size);
+    }
+    return ret;
+}
+
+int obj_get_info(obj_t *obj, observer_t *obs, int info,
+                 void *out)
+{
+    observer_update(obs, true);
+    return obj_get_info_no_update(obj, obs, info, out);
+}
+
+// Union large enough to hold any info value.
+typedef union {
+    bool b;
+    int d;
+    char otype[4];
+    double f;
+    double v2[2];
+    double v3[3];
+    double v4[4];
+    double v4x2[2][4];
+    const char *s_ptr;
+} info_value_t;
+
+// Return an allocated json representation of an info value.
+static char *info_value_to_json(int info, const info_value_t *v)
 {
-    int info = obj_info_from_str(info_str);
     int type = info % 16;
     int r = 0;
-    union {
-        bool b;
-        int d;
-        char otype[4];
-        double f;
-        double v2[2];
-        double v3[3];
-        double v4[4];
-        double v4x2[2][4];
-        const char *s_ptr;
-    } v;
     char *ret = NULL;
-    char *json = NULL;
-
-    r = obj_get_info(obj, obs, info, &v.f);
-    if (r) return NULL;
 
     switch (type) {
     case TYPE_FLOAT:
-        if (isnan(v.f))
+        if (isnan(v->f))
             r = asprintf(&ret, "null");
         else
-            r = asprintf(&ret, "%.12f", v.f);
+            r = asprintf(&ret, "%.12f", v->f);
         break;
     case TYPE_INT:
-        r = asprintf(&ret, "%d", v.d);
+        r = asprintf(&ret, "%d", v->d);
         break;
     case TYPE_BOOL:
-        r = asprintf(&ret, "%s", v.b ? "true" : "fasle");
+        r = asprintf(&ret, "%s", v->b ? "true" : "fasle");
         break;
     case TYPE_OTYPE:
-        r = asprintf(&ret, "\"%.4s\"", v.otype);
+        r = asprintf(&ret, "\"%.4s\"", v->otype);
         break;
     case TYPE_STRING:
-        if (v.s_ptr == NULL)
+        if (v->s_ptr == NULL)
             r = asprintf(&ret, "null");
         else
-            r = asprintf(&ret, "\"%s\"", v.s_ptr);
+            r = asprintf(&ret, "\"%s\"", v->s_ptr);
         break;
     case TYPE_V2:
-        r = asprintf(&ret, "[%.12f, %.12f]", VEC2_SPLIT(v.v2));
+        r = asprintf(&ret, "[%.12f, %.12f]", VEC2_SPLIT(v->v2));
         break;
     case TYPE_V3:
-        r = asprintf(&ret, "[%.12f, %.12f, %.12f]", VEC3_SPLIT(v.v3));
+        r = asprintf(&ret, "[%.12f, %.12f, %.12f]", VEC3_SPLIT(v->v3));
         break;
     case TYPE_V4:
-        r = asprintf(&ret, "[%.12f, %.12f, %.12f, %.12f]", VEC4_SPLIT(v.v4));
+        r = asprintf(&ret, "[%.12f, %.12f, %.12f, %.12f]", VEC4_SPLIT(v->v4));
         break;
     case TYPE_V4X2:
         r = asprintf(&ret, "[[%.12f, %.12f, %.12f, %.12f],"
                             "[%.12f, %.12f, %.12f, %.12f]]",
-                     VEC4_SPLIT(v.v4x2[0]), VEC4_SPLIT(v.v4x2[1]));
+                     VEC4_SPLIT(v->v4x2[0]), VEC4_SPLIT(v->v4x2[1]));
         break;
     default:
         assert(false);
         return NULL;
     }
     if (r < 0) LOG_E("Cannot generate json");
+    return ret;
+}
+
+EMSCRIPTEN_KEEPALIVE
+char *obj_get_info_json(const obj_t *obj, observer_t *obs,
+                        const char *info_str)
+{
+    int info = obj_info_from_str(info_str);
+    int r;
+    info_value_t v;
+    char *ret, *json = NULL;
+
+    if (obj_get_info((obj_t*)obj, obs, info, &v.f)) return NULL;
+    ret = info_value_to_json(info, &v);
+    if (!ret) return NULL;
 
     /* Turn the result into an json object with a 'v' attribute, so that this
      * is a proper json document.
@@ -315,6 +473,62 @@ char *obj_get_info_json(const obj_t *obj, observer_t *obs,
     return json;
 }
 
+/*
+ * Function: obj_get_info_batch_json
+ * Query several infos for several objects in a single call.
+ *
+ * This is for the object browsers: the observer preparation is done
+ * once for the whole batch instead of once per cell, and the result is
+ * a single json document.
+ *
+ * Parameters:
+ *   objs      - Array of objects.
+ *   nb        - Number of objects.
+ *   obs       - The observer.
+ *   infos_str - Comma separated list of info names, e.g. "vmag,radec".
+ *
+ * Return:
+ *   An allocated json document: {"swe_":1, "v":[[...], ...]}, one row
+ *   per object, one value per info (null for the unsupported infos).
+ */
+EMSCRIPTEN_KEEPALIVE
+char *obj_get_info_batch_json(obj_t **objs, int nb, observer_t *obs,
+                              const char *infos_str)
+{
+    int i, j, nb_infos = 0, *infos;
+    char *str, *tok, *saveptr = NULL, *cell, *json;
+    info_value_t v;
+    UT_string out;
+
+    // Parse the info names.
+    str = strdup(infos_str);
+    infos = calloc(strlen(infos_str) + 1, sizeof(*infos));
+    for (tok = strtok_r(str, ",", &saveptr); tok;
+            tok = strtok_r(NULL, ",", &saveptr))
+        infos[nb_infos++] = obj_info_from_str(tok);
+    free(str);
+
+    observer_update(obs, true);
+    utstring_init(&out);
+    utstring_printf(&out, "{\"swe_\":1, \"v\":[");
+    for (i = 0; i < nb; i++) {
+        utstring_printf(&out, "%s[", i ? "," : "");
+        for (j = 0; j < nb_infos; j++) {
+            cell = NULL;
+            if (obj_get_info_no_update(objs[i], obs, infos[j], &v.f) == 0)
+                cell = info_value_to_json(infos[j], &v);
+            utstring_printf(&out, "%s%s", j ? "," : "", cell ?: "null");
+            free(cell);
+        }
+        utstring_printf(&out, "]");
+    }
+    utstring_printf(&out, "]}");
+    free(infos);
+    json = strdup(utstring_body(&out));
+    utstring_done(&out);
+    return json;
+}
+
 EMSCRIPTEN_KEEPALIVE
 const char *obj_get_id(const obj_t *obj)
 {
@@ -438,6 +652,27 @@ static json_value *obj_fn_default(obj_t *obj, const attribute_t *attr,
     }
 }
 
+/*
+ * Return true if the attribute is a plain numeric member backed property,
+ * so that <obj_get_attr> and <obj_set_attr> can copy the value directly
+ * instead of round tripping through a json value.
+ */
+static bool attr_is_direct(const attribute_t *attr)
+{
+    if (!attr->is_prop || attr->fn) return false;
+    switch (attr->type % 16) {
+    case TYPE_BOOL:
+    case TYPE_INT:
+    case TYPE_FLOAT:
+    case TYPE_V2:
+    case TYPE_V3:
+    case TYPE_V4:
+        return true;
+    default:
+        return false;
+    }
+}
+
 EMSCRIPTEN_KEEPALIVE
 const attribute_t *obj_get_attr_(const obj_t *obj, const char *attr_name)
 {
@@ -502,6 +737,8 @@ json_value *obj_call_json(obj_t *obj, const char *name,
         LOG_E("Cannot find attribute %s of object %s", name, obj->id);
         return NULL;
     }
+    // Any attribute write or function call can affect the rendering.
+    if (args && core) core->frame_dirty = true;
     return (attr->fn ?: obj_fn_default)(obj, attr, args);
 }
 
@@ -527,10 +764,47 @@ int obj_get_attr(const obj_t *obj, const char *name, ...)
 {
     json_value *ret;
     const attribute_t *attr;
+    const void *p;
     va_list ap;
 
     attr = obj_get_attr_(obj, name);
     va_start(ap, name);
+
+    // Typed fast path: numeric members are copied directly, without
+    // building and parsing a json value per access.
+    if (attr && attr_is_direct(attr)) {
+        p = ((const void*)obj) + attr->member.offset;
+        switch (attr->type % 16) {
+        case TYPE_BOOL:
+            memcpy(va_arg(ap, bool*), p, sizeof(bool));
+            break;
+        case TYPE_INT:
+            memcpy(va_arg(ap, int*), p, sizeof(int));
+            break;
+        case TYPE_FLOAT:
+            // Works for both float and double.
+            if (attr->member.size == sizeof(double))
+                memcpy(va_arg(ap, double*), p, sizeof(double));
+            else {
+                float f;
+                memcpy(&f, p, sizeof(f));
+                *va_arg(ap, double*) = f;
+            }
+            break;
+        case TYPE_V2:
+            memcpy(va_arg(ap, double*), p, 2 * sizeof(double));
+            break;
+        case TYPE_V3:
+            memcpy(va_arg(ap, double*), p, 3 * sizeof(double));
+            break;
+        case TYPE_V4:
+            memcpy(va_arg(ap, double*), p, 4 * sizeof(double));
+            break;
+        }
+        va_end(ap);
+        return 0;
+    }
+
     ret = obj_call_json(obj, name, NULL);
     assert(ret);
     args_vget(ret, attr->type, &ap);
@@ -544,6 +818,18 @@ int obj_set_attr(const obj_t *obj, const char *name, ...)
     json_value *arg, *ret;
     va_list ap;
     const attribute_t *attr;
+    // Scratch slot for the typed fast path.  A union so that the per-type
+    // stores don't alias a double array.
+    union {
+        bool b;
+        int i;
+        float f;
+        double d;
+        double v[4];
+    } buf;
+    void *p;
+    int size;
+    bool changed;
 
     attr = obj_get_attr_(obj, name);
     if (!attr) {
@@ -551,6 +837,44 @@ int obj_set_attr(const obj_t *obj, const char *name, ...)
         assert(false);
     }
     va_start(ap, name);
+
+    // Typed fast path: numeric members are copied directly, without
+    // building and parsing a json value per access.  Keep the same side
+    // effects as the json path (<obj_call_json> / <obj_fn_default>).
+    if (attr_is_direct(attr)) {
+        p = ((void*)(obj_t*)obj) + attr->member.offset;
+        size = attr->member.size;
+        switch (attr->type % 16) {
+        case TYPE_BOOL:
+            buf.b = va_arg(ap, int);
+            break;
+        case TYPE_INT:
+            buf.i = va_arg(ap, int);
+            break;
+        case TYPE_FLOAT:
+            // Works for both float and double.
+            if (size == sizeof(double))
+                buf.d = va_arg(ap, double);
+            else
+                buf.f = va_arg(ap, double);
+            break;
+        default: // TYPE_V2/V3/V4.
+            assert(size <= sizeof(buf));
+            memcpy(buf.v, va_arg(ap, double*), size);
+            break;
+        }
+        va_end(ap);
+        // Any attribute write can affect the rendering.
+        if (core) core->frame_dirty = true;
+        changed = memcmp(p, &buf, size) != 0;
+        if (changed) {
+            memcpy(p, &buf, size);
+            if (attr->on_changed) attr->on_changed((obj_t*)obj, attr);
+            module_changed((obj_t*)obj, attr->name);
+        }
+        return 0;
+    }
+
     arg = args_vvalue_new(attr->type, &ap);
     ret = obj_call_json(obj, name, arg);
     json_builder_free(arg);
@@ -629,6 +953,138 @@ void obj_get_2d_ellipse(obj_t *obj,  const observer_t *obs,
     *win_angle = 0;
 }
 
+/*
+ * Attribute snapshot support: the web UI reads dozens of attributes per
+ * frame, each read crossing the emscripten boundary with a string keyed
+ * lookup and a json round trip.  Instead, the client registers the
+ * attributes it watches once, and the engine serializes the current
+ * values into a flat double buffer at the end of each update, so the js
+ * side only reads typed array slots.
+ *
+ * Buffer layout: SNAPSHOT_SLOT doubles per registered attribute, the
+ * first being a generation counter bumped when the value changed, then
+ * up to four value components.  Only numeric member backed attributes
+ * are supported; everything else keeps using the json path.
+ */
+
+#define SNAPSHOT_SLOT 5
+
+typedef struct {
+    obj_t *obj;
+    const attribute_t *attr;
+    int dim;            // Number of value components (1 to 4).
+} snapshot_entry_t;
+
+static snapshot_entry_t *g_snapshot_entries = NULL;
+static double *g_snapshot_buf = NULL;
+static int g_snapshot_nb = 0;
+static int g_snapshot_cap = 0;
+
+static void snapshot_read(const snapshot_entry_t *e, double out[4])
+{
+    const void *p = ((const void*)e->obj) + e->attr->member.offset;
+    int i;
+
+    switch (e->attr->type % 16) {
+    case TYPE_BOOL:
+        out[0] = *(const bool*)p;
+        break;
+    case TYPE_INT:
+        out[0] = *(const int*)p;
+        break;
+    case TYPE_FLOAT:
+        out[0] = (e->attr->member.size == sizeof(double)) ?
+                    *(const double*)p : *(const float*)p;
+        break;
+    default: // TYPE_V2/V3/V4.
+        for (i = 0; i < e->dim; i++)
+            out[i] = ((const double*)p)[i];
+        break;
+    }
+}
+
+/*
+ * Function: obj_snapshot_register
+ * Add an attribute to the per-frame snapshot buffer.
+ *
+ * Return the buffer slot index, or -1 if the attribute cannot be
+ * snapshotted (custom getter or non numeric type).
+ */
+EMSCRIPTEN_KEEPALIVE
+int obj_snapshot_register(obj_t *obj, const char *name)
+{
+    const attribute_t *attr;
+    snapshot_entry_t *e;
+    int dim;
+
+    attr = obj_get_attr_(obj, name);
+    if (!attr || !attr->is_prop || attr->fn) return -1;
+    switch (attr->type % 16) {
+    case TYPE_BOOL:
+    case TYPE_INT:
+    case TYPE_FLOAT: dim = 1; break;
+    case TYPE_V2: dim = 2; break;
+    case TYPE_V3: dim = 3; break;
+    case TYPE_V4: dim = 4; break;
+    default: return -1;
+    }
+    if (g_snapshot_nb >= g_snapshot_cap) {
+        g_snapshot_cap += 32;
+        g_snapshot_entries = realloc(g_snapshot_entries,
+                g_snapshot_cap * sizeof(*g_snapshot_entries));
+        g_snapshot_buf = realloc(g_snapshot_buf,
+                g_snapshot_cap * SNAPSHOT_SLOT * sizeof(double));
+    }
+    e = &g_snapshot_entries[g_snapshot_nb];
+    e->obj = obj;
+    e->attr = attr;
+    e->dim = dim;
+    obj->ref++;
+    // Generation zero, value filled by the first update.
+    memset(g_snapshot_buf + g_snapshot_nb * SNAPSHOT_SLOT, 0,
+           SNAPSHOT_SLOT * sizeof(double));
+    snapshot_read(e, g_snapshot_buf + g_snapshot_nb * SNAPSHOT_SLOT + 1);
+    return g_snapshot_nb++;
+}
+
+/*
+ * Function: obj_snapshot_update
+ * Serialize all the registered attributes into the snapshot buffer.
+ *
+ * Called by the core once per update; bumps the slot generation counter
+ * only when the value actually changed.
+ */
+EMSCRIPTEN_KEEPALIVE
+void obj_snapshot_update(void)
+{
+    const snapshot_entry_t *e;
+    double *slot, values[4];
+    int i;
+
+    for (i = 0; i < g_snapshot_nb; i++) {
+        e = &g_snapshot_entries[i];
+        slot = g_snapshot_buf + i * SNAPSHOT_SLOT;
+        snapshot_read(e, values);
+        if (memcmp(slot + 1, values, e->dim * sizeof(double)) == 0)
+            continue;
+        memcpy(slot + 1, values, e->dim * sizeof(double));
+        slot[0] += 1;
+    }
+}
+
+EMSCRIPTEN_KEEPALIVE
+double *obj_snapshot_buffer(void)
+{
+    return g_snapshot_buf;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int obj_snapshot_dim(int slot)
+{
+    assert(slot >= 0 && slot < g_snapshot_nb);
+    return g_snapshot_entries[slot].dim;
+}
+
 const char *obj_info_str(int info)
 {
 #define X(name, ...) if (INFO_##name == info) return #name;
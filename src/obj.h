@@ -46,11 +46,16 @@
  * OBJ_LISTABLE         - For modules that maintain a list of children objects,
  *                        like comets, this allows obj_list to directly do
  *                        the listing.
+ * OBJ_MODULE_LAZY      - Module that is not needed to render the first
+ *                        frame: the core defers its creation until after
+ *                        the first paint, or until it is first looked up
+ *                        by id, whichever comes first.
  */
 enum {
     OBJ_IN_JSON_TREE = 1 << 0,
     OBJ_MODULE       = 1 << 1,
     OBJ_LISTABLE     = 1 << 2,
+    OBJ_MODULE_LAZY  = 1 << 3,
 };
 
 typedef struct _json_value json_value;
@@ -61,6 +66,21 @@ typedef struct projection projection_t;
 typedef struct painter painter_t;
 typedef struct obj_klass obj_klass_t;
 
+/*
+ * Type: module_list_cursor_t
+ * Continuation token for the paged object listings.
+ *
+ * Zero it before the first call.  The modules update it as the listing
+ * progresses, so that the next call resumes where the previous one
+ * stopped instead of enumerating from scratch.  The exact meaning of
+ * the fields is module specific.
+ */
+typedef struct module_list_cursor {
+    uint64_t tile;  // Next tile (nuniq), for the tile based listings.
+    int      index; // Next index, inside the tile or the children list.
+    bool     done;  // Set when the listing is exhausted.
+} module_list_cursor_t;
+
 /*
  * Type: obj_klass
  * Info structure that represents a given class of objects.
@@ -111,8 +131,17 @@ struct obj_klass
     void (*del)(obj_t *obj);
     int (*get_info)(const obj_t *obj, const observer_t *obs, int info,
                     void *out);
+    /* Optional mask of the infos (by info index, i.e INFO_X / 1024) whose
+     * value does not depend on the observer or the time, so that
+     * <obj_get_info> can memoize them across observer changes. */
+    uint32_t info_time_invariant;
     int (*render)(const obj_t *obj, const painter_t *painter);
     int (*post_render)(const obj_t *obj, const painter_t *painter);
+    /* Optional: return the bounding cap of the object's whole content in
+     * a given frame.  When set, <obj_render> skips the render call
+     * entirely if the cap doesn't intersect the viewport.  Return false
+     * if no cap is available (render normally). */
+    bool (*get_bounding_cap)(const obj_t *obj, int *frame, double cap[4]);
     int (*render_pointer)(const obj_t *obj, const painter_t *painter);
     void (*get_2d_ellipse)(const obj_t *obj, const observer_t *obs,
                            const projection_t *proj,
@@ -144,8 +173,9 @@ struct obj_klass
     obj_t* (*clone)(const obj_t *obj);
     // List all the sky objects children from this module.
     int (*list)(const obj_t *obj, double max_mag,
-                uint64_t hint, const char *source, void *user,
-                int (*f)(void *user, obj_t *obj));
+                uint64_t hint, const char *source, const char *type,
+                module_list_cursor_t *cursor,
+                void *user, int (*f)(void *user, obj_t *obj));
 
     // Add a source of data.
     int (*add_data_source)(obj_t *obj, const char *url, const char *key);
@@ -158,6 +188,21 @@ struct obj_klass
     double render_order;
     double create_order;
 
+    // For modules: staleness (in seconds of user time) the module
+    // tolerates between two effective update calls.  When the update
+    // pass goes over its per frame budget (typically at high time
+    // rates), module_update skips the modules that declared a non zero
+    // tolerance until it has elapsed, passing them the accumulated dt.
+    double update_delay;
+
+    // For modules: bitmask of the core state (UPDATE_DEP_* values) the
+    // update function reads and writes, not counting the module own
+    // state.  Modules that declare their dependencies can have their
+    // updates dispatched concurrently when they don't conflict (see
+    // module_update_all); undeclared modules always update serially.
+    int update_reads;
+    int update_writes;
+
     // List of object attributes that can be read, set or called with the
     // obj_call and obj_toogle_attr functions.
     attribute_t *attributes;
@@ -203,6 +248,13 @@ struct obj
     char        type_padding_; // Ensure that type is null terminated.
     obj_t       *parent;
     obj_t       *children, *prev, *next;
+
+    // Contiguous mirror of the children list, lazily rebuilt by
+    // module_get_children, so that the per-frame tree walks don't have to
+    // chase the list pointers.
+    obj_t       **children_array;
+    int         children_count;
+    bool        children_dirty;
 };
 
 /*
@@ -374,6 +426,27 @@ int obj_get_info(obj_t *obj, observer_t *obs, int info, void *out);
  */
 char *obj_get_info_json(const obj_t *obj, observer_t *obs, const char *info);
 
+/*
+ * Function: obj_get_info_batch_json
+ * Query several infos for several objects in one call.
+ *
+ * The observer preparation is done once for the whole batch, so this is
+ * much faster than calling <obj_get_info_json> per object and per info
+ * when filling an object list.
+ *
+ * Parameters:
+ *   objs   - Array of objects.
+ *   nb     - Number of objects.
+ *   obs    - The observer.
+ *   infos  - Comma separated list of info names, e.g. "vmag,radec".
+ *
+ * Return:
+ *   An allocated json document: one row per object, one value per info,
+ *   null for the infos an object doesn't support.
+ */
+char *obj_get_info_batch_json(obj_t **objs, int nb, observer_t *obs,
+                              const char *infos);
+
 /*
  * Function: obj_get_2d_ellipse
  * Return the ellipse containing the rendered object in screen coordinates (px).
@@ -391,6 +464,26 @@ void obj_get_2d_ellipse(obj_t *obj, const observer_t *obs,
                         double win_pos[S 2], double win_size[S 2],
                         double* win_angle);
 
+/*
+ * Function: obj_oid_map_add
+ * Register a live object into the global oid map.
+ *
+ * The entry is weak: it is removed when the object gets deleted.  This
+ * is called automatically when an oid lookup resolves, so that the
+ * following lookups (selection rendering, clicks) are a single hash
+ * probe instead of a tree-wide visitation.
+ */
+void obj_oid_map_add(obj_t *obj);
+
+/*
+ * Function: obj_oid_map_get
+ * Return the live object registered for an oid, or NULL.
+ *
+ * The returned pointer is borrowed: the caller should retain it if it
+ * keeps it.
+ */
+obj_t *obj_oid_map_get(uint64_t oid);
+
 /*
  * Function: obj_get_name
  * Return the given name for an object or its first designation.
@@ -480,6 +573,40 @@ char *obj_call_json_str(obj_t *obj, const char *attr, const char *args);
  */
 const attribute_t *obj_get_attr_(const obj_t *obj, const char *attr);
 
+/*
+ * Function: obj_snapshot_register
+ * Add an attribute to the per-frame snapshot buffer, so a client can
+ * read it each frame from <obj_snapshot_buffer> without a string lookup
+ * and json conversion per read.
+ *
+ * Only numeric member backed attributes are supported.  Each slot takes
+ * five doubles in the buffer: a generation counter, bumped when the
+ * value changed, followed by up to four value components.
+ *
+ * Return:
+ *   The slot index, or -1 if the attribute cannot be snapshotted.
+ */
+int obj_snapshot_register(obj_t *obj, const char *name);
+
+/*
+ * Function: obj_snapshot_update
+ * Serialize all the registered attributes into the snapshot buffer.
+ * Called by the core at the end of each update.
+ */
+void obj_snapshot_update(void);
+
+/*
+ * Function: obj_snapshot_buffer
+ * Return the snapshot buffer.  Invalidated by obj_snapshot_register.
+ */
+double *obj_snapshot_buffer(void);
+
+/*
+ * Function: obj_snapshot_dim
+ * Return the number of value components of a registered slot.
+ */
+int obj_snapshot_dim(int slot);
+
 
 // Register an object klass, so that we can create instances dynamically
 #define OBJ_REGISTER(klass) \
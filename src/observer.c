@@ -137,12 +137,44 @@ static void update_nutation_precession_mat(observer_t *obs)
 
 }
 
+/*
+ * Conservative drift rate (arcsec / day) of the astrometry state while
+ * we only extrapolate Earth rotation and position: dominated by
+ * precession (~0.14"/day) and the fastest nutation terms.  Multiplied
+ * by the time since the last full update it gives an upper bound of the
+ * angular error of the fast path.
+ */
+#define ASTROM_DRIFT_RATE 1.0
+
 void observer_update(observer_t *obs, bool fast)
 {
     double utc1, utc2, ut11, ut12, tai1, tai2;
     double dt, dut1 = 0;
 
     uint64_t hash, hash_partial;
+    double pos[6], view[8];
+
+    // Bump the generation counters for the parts of the state that
+    // changed since the last call, before any early return, so that the
+    // modules can always rely on them.
+    if (obs->tt != obs->gen_tt) {
+        obs->gen_tt = obs->tt;
+        obs->time_gen++;
+    }
+    pos[0] = obs->elong; pos[1] = obs->phi; pos[2] = obs->hm;
+    pos[3] = obs->horizon; pos[4] = obs->pressure; pos[5] = obs->refraction;
+    if (memcmp(pos, obs->gen_pos, sizeof(pos)) != 0) {
+        memcpy(obs->gen_pos, pos, sizeof(pos));
+        obs->pos_gen++;
+    }
+    memcpy(view, obs->mount_quat, 4 * sizeof(double));
+    view[4] = obs->pitch; view[5] = obs->yaw; view[6] = obs->roll;
+    view[7] = obs->view_offset_alt;
+    if (memcmp(view, obs->gen_view, sizeof(view)) != 0) {
+        memcpy(obs->gen_view, view, sizeof(view));
+        obs->view_gen++;
+    }
+
     observer_compute_hash(obs, &hash_partial, &hash);
     // Check if we have computed accurate positions already
     if (hash == obs->hash_accurate)
@@ -150,8 +182,11 @@ void observer_update(observer_t *obs, bool fast)
     // Check if we have computed 'fast' positions already
     if (fast && hash == obs->hash)
         return;
+    // Only take the fast path while the accumulated extrapolation error
+    // stays within the observer's angular budget.
     fast = fast && hash_partial == obs->hash_partial &&
-            fabs(obs->last_accurate_update - obs->tt) < 1.0;
+            fabs(obs->last_accurate_update - obs->tt) * ASTROM_DRIFT_RATE <
+                obs->astrom_accuracy;
 
     // Compute UT1 and UTC time.
     if (obs->last_update != obs->tt) {
@@ -211,6 +246,8 @@ void observer_update(observer_t *obs, bool fast)
 
     update_matrices(obs);
     if (!fast) update_nutation_precession_mat(obs);
+    // Refresh the cached frame to frame rotations used by convert_frame.
+    frame_rotations_update(obs);
 
     // Compute sun's apparent position in observer reference frame
     eraPvmpv(obs->sun_pvb, obs->obs_pvb, obs->sun_pvo);
@@ -230,6 +267,9 @@ static int observer_init(obj_t *obj, json_value *args)
 {
     observer_t*  obs = (observer_t*)obj;
     quat_set_identity(obs->mount_quat);
+    // Default error budget: ~1" keeps the fast path well below the
+    // display resolution while covering about a day of extrapolation.
+    obs->astrom_accuracy = 1.0;
     observer_compute_hash(obs, &obs->hash_partial, &obs->hash_accurate);
     obs->hash = obs->hash_accurate;
     return 0;
@@ -291,6 +331,8 @@ static obj_klass_t observer_klass = {
         PROPERTY(latitude, TYPE_ANGLE, MEMBER(observer_t, phi)),
         PROPERTY(elevation, TYPE_FLOAT, MEMBER(observer_t, hm)),
         PROPERTY(refraction, TYPE_BOOL, MEMBER(observer_t, refraction)),
+        PROPERTY(astrom_accuracy, TYPE_FLOAT,
+                 MEMBER(observer_t, astrom_accuracy)),
         PROPERTY(tt, TYPE_MJD, MEMBER(observer_t, tt),
                  .on_changed = observer_on_timeattr_changed),
         PROPERTY(ut1, TYPE_MJD, MEMBER(observer_t, ut1),
@@ -13,6 +13,16 @@
 #include "obj.h"
 #include "erfa.h"
 
+// Same definition as in utils/vec.h (which we cannot include here since
+// it has no include guard).
+#ifndef VEC_ALIGN_16
+#   if defined(__GNUC__) || defined(__clang__)
+#       define VEC_ALIGN_16 __attribute__((aligned(16)))
+#   else
+#       define VEC_ALIGN_16
+#   endif
+#endif
+
 /*
  * Type: observer_t
  * Store informations about the observer current position.
@@ -48,6 +58,11 @@ struct observer
     double last_update;
     double last_accurate_update;
 
+    // Angular error budget (arcsec) of the fast astrometry updates:
+    // a full eraApco13 class update is only triggered once the error
+    // accumulated since the last one would exceed this value.
+    double astrom_accuracy;
+
     // Hash value that represents a given observer state for which the accurate
     // values have been computed. Used to prevent updating object data several
     // times with the same observer.
@@ -62,6 +77,20 @@ struct observer
     // safe to use make fast update.
     uint64_t hash_partial;
 
+    // Monotonic generation counters, bumped by observer_update when the
+    // corresponding part of the state changed.  Unlike the hashes above
+    // they can be ordered, so modules can cache a generation and
+    // compare-and-skip whole recomputations, or tell how stale a cache
+    // is.
+    uint64_t time_gen;  // Time (tt).
+    uint64_t pos_gen;   // Geographic position and refraction state.
+    uint64_t view_gen;  // View orientation (mount, pitch, yaw, roll).
+
+    // Last seen values for the generation counters.
+    double gen_tt;
+    double gen_pos[6];
+    double gen_view[8];
+
     // Different times, all in MJD.
     double ut1;
     double utc;
@@ -98,16 +127,25 @@ struct observer
     // e: Ecliptic (right handed).
     // m: Mount (observed + mount rotation).
     // v: View (Mount + view direction).
-    double ro2m[3][3];  // Rotate from observed to mount.
-    double ro2v[3][3];  // Rotate from observed to view.
-    double rv2o[3][3];  // Rotate from view to observed.
-    double ri2h[3][3];  // CIRF to horizontal.
-    double rh2i[3][3];  // Horizontal to Equatorial J2000 (ICRF).
-    double ri2v[3][3];  // CIRF to view.
-    double ri2e[3][3];  // CIRF to ecliptic.
-    double re2i[3][3];  // Eclipic to Equatorial J2000 (ICRF).
-    double rnp[3][3];   // Nutation/Precession rotation.
-    double rc2v[3][3];  // Equatorial J2000 (ICRS) to view (no refraction).
+    // All aligned on 16 bytes so the mat/vec kernels can use vector
+    // loads on the conversion chains.
+    double ro2m[3][3] VEC_ALIGN_16;  // Rotate from observed to mount.
+    double ro2v[3][3] VEC_ALIGN_16;  // Rotate from observed to view.
+    double rv2o[3][3] VEC_ALIGN_16;  // Rotate from view to observed.
+    double ri2h[3][3] VEC_ALIGN_16;  // CIRF to horizontal.
+    double rh2i[3][3] VEC_ALIGN_16;  // Horizontal to Equatorial J2000 (ICRF).
+    double ri2v[3][3] VEC_ALIGN_16;  // CIRF to view.
+    double ri2e[3][3] VEC_ALIGN_16;  // CIRF to ecliptic.
+    double re2i[3][3] VEC_ALIGN_16;  // Eclipic to Equatorial J2000 (ICRF).
+    double rnp[3][3] VEC_ALIGN_16;   // Nutation/Precession rotation.
+    double rc2v[3][3] VEC_ALIGN_16;  // Equatorial J2000 (ICRS) to view (no refraction).
+
+    // Bundle of all the frame to frame conversions that reduce to a
+    // single rotation, refreshed by frame_rotations_update (frames.c)
+    // after each observer update.  frame_rots[origin][dest] is only
+    // usable when the matching bit of frame_rots_valid is set.
+    double frame_rots[7][7][3][3] VEC_ALIGN_16; // 7 == FRAMES_NB.
+    uint64_t frame_rots_valid;
 };
 
 void observer_update(observer_t *obs, bool fast);
@@ -15,6 +15,7 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "otypes.inl"
@@ -48,38 +49,80 @@ const char *otype_get_str(const char *id)
     return e ? e->str : NULL;
 }
 
+/*
+ * Index of the parent of each entry, built once on first use, so that
+ * walking up the classification tree doesn't rescan the whole table at
+ * every step.  -1 means no parent (root entry).
+ */
+static int *g_parents = NULL;
+
+static void build_parents_index(void)
+{
+    int i, j, nb;
+    uint8_t n[4];
+    const entry_t *e, *p;
+
+    for (nb = 0; ENTRIES[nb].id[0]; nb++) {}
+    g_parents = malloc(nb * sizeof(*g_parents));
+    for (i = 0, e = &ENTRIES[0]; e->id[0]; e++, i++) {
+        g_parents[i] = -1;
+        // The parent number is the number with the last non zero digit
+        // set to zero.
+        memcpy(n, e->n, 4);
+        for (j = 0; j < 4; j++) {
+            if (n[j] == 0) break;
+        }
+        if (j == 0) continue;
+        n[j - 1] = 0;
+        for (j = 0, p = &ENTRIES[0]; p->id[0]; p++, j++) {
+            if (memcmp(p->n, n, 4) == 0) {
+                g_parents[i] = j;
+                break;
+            }
+        }
+    }
+}
+
 // Return the parent condensed id of an otype.
 const char *otype_get_parent(const char *id)
 {
-    int i;
-    uint8_t n[4];
     const entry_t *e;
 
     e = otype_get(id);
     if (!e) return NULL;
-    // We get the parent number by setting the last non zero digit to zero.
-    memcpy(n, e->n, 4);
-    for (i = 0; i < 4; i++) {
-        if (n[i] == 0) break;
-    }
-    if (i == 0) return NULL;
-    n[i - 1] = 0;
-    for (e = &ENTRIES[0]; e->id[0]; e++) {
-        if (memcmp(e->n, n, 4) == 0)
-            return e->id;
-    }
-    return NULL;
+    if (!g_parents) build_parents_index();
+    if (g_parents[e - &ENTRIES[0]] == -1) return NULL;
+    return ENTRIES[g_parents[e - &ENTRIES[0]]].id;
 }
 
-static bool otype_get_digits(const char *id, uint8_t out[4])
+bool otype_get_digits(const char *id, uint8_t out[4])
 {
     const entry_t *e;
+    memset(out, 0, 4);
     e = otype_get(id);
     if (!e) return false;
     memcpy(out, e->n, 4);
     return true;
 }
 
+bool otype_match_digits(const uint8_t o[4], const uint8_t m[4])
+{
+    int i;
+    for (i = 0; i < 4; i++) {
+        if (m[i] == 0) return true;
+        if (o[i] != m[i]) return false;
+    }
+    return true;
+}
+
+uint32_t otype_category_mask(const char *id)
+{
+    const entry_t *e;
+    e = otype_get(id);
+    if (!e) return 0;
+    return 1u << e->n[0];
+}
+
 /*
  * Function: otype_match
  * Test if an otype matches an other otype
@@ -89,15 +132,10 @@ static bool otype_get_digits(const char *id, uint8_t out[4])
 bool otype_match(const char *otype, const char *match)
 {
     uint8_t o[4], m[4];
-    int i;
     if (strncmp(otype, match, 4) == 0) return true;
     if (!otype_get_digits(otype, o)) return false;
     if (!otype_get_digits(match, m)) return false;
-    for (i = 0; i < 4; i++) {
-        if (m[i] == 0) return true;
-        if (o[i] != m[i]) return false;
-    }
-    return true;
+    return otype_match_digits(o, m);
 }
 
 // STYLE-CHECK OFF
@@ -48,3 +48,35 @@ const char *otype_get_parent(const char *otype);
  * Return true if the type is equal to or is a subclass of the other.
  */
 bool otype_match(const char *otype, const char *match);
+
+/*
+ * Function: otype_get_digits
+ * Get the 4 digits classification number of an otype.
+ *
+ * This can be precomputed once per object so that repeated type filter
+ * tests (<otype_match_digits>) don't have to do any hash lookup.
+ *
+ * Return:
+ *   false if the otype is not in the database (out is zeroed).
+ */
+bool otype_get_digits(const char *otype, uint8_t out[4]);
+
+/*
+ * Function: otype_match_digits
+ * Same as <otype_match>, but on precomputed classification digits.
+ */
+bool otype_match_digits(const uint8_t otype[4], const uint8_t match[4]);
+
+/*
+ * Function: otype_category_mask
+ * Bitmask identifying the top level category of an otype.
+ *
+ * The masks of several objects can be or-ed together, so that a whole
+ * container (e.g. a catalog tile) can be tested against a type filter
+ * with a single and.
+ *
+ * Return:
+ *   1 << (first classification digit), or 0 if the otype is not in the
+ *   database.
+ */
+uint32_t otype_category_mask(const char *otype);
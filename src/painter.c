@@ -12,9 +12,13 @@
 #include "line_mesh.h"
 
 #include <float.h>
+#include <zlib.h> // For crc32.
 
 static bool g_debug = false;
 
+// Max cost of the tessellated lines cache (in bytes).
+#define LINES_CACHE_SIZE (2 * (1 << 20))
+
 #define REND(rend, f, ...) do { \
         if ((rend)->f) (rend)->f((rend), ##__VA_ARGS__); \
     } while (0)
@@ -291,6 +295,63 @@ static bool cap_intersects_discontinuity_line(
 }
 
 
+/*
+ * Cache of the tessellated window space lines, so that the adaptive
+ * subdivision of the grids is not redone when nothing moved.  The view
+ * orientation, time and projection are part of the key (obs->hash
+ * covers the first two), so any real change simply produces a new key
+ * and the stale entries age out of the lru.
+ */
+static cache_t *g_lines_cache = NULL;
+
+typedef struct {
+    int     size;           // Number of points.
+    double  win[][3];       // Window coordinates.
+} cached_line_t;
+
+typedef struct {
+    uint64_t obs_hash;
+    double   line[2][4];
+    double   scaling[2];
+    double   window_size[2];
+    int      frame;
+    int      split;
+    int      proj_type;
+    int      map[4];        // order, pix, swapped, type (0 if no map).
+    void     *map_fn;       // The map function identifies the map kind.
+    uint32_t map_key;       // Map parameters (see uv_map cache_key).
+} line_key_t;
+
+/*
+ * Build the cache key for a tessellated line.  Return false if the line
+ * cannot be safely cached, i.e. when the uv map has parameters that the
+ * key cannot represent (a custom map without a cache_key).
+ */
+static bool make_line_key(const painter_t *painter, int frame,
+                          const double line[2][4], const uv_map_t *map,
+                          int split, line_key_t *key)
+{
+    if (map && !map->type && map->user && !map->cache_key)
+        return false;
+    memset(key, 0, sizeof(*key)); // Also clears the struct padding.
+    key->obs_hash = painter->obs->hash;
+    memcpy(key->line, line, sizeof(key->line));
+    vec2_copy(painter->proj->scaling, key->scaling);
+    vec2_copy(painter->proj->window_size, key->window_size);
+    key->frame = frame;
+    key->split = split;
+    key->proj_type = painter->proj->type;
+    if (map) {
+        key->map[0] = map->order;
+        key->map[1] = map->pix;
+        key->map[2] = map->swapped;
+        key->map[3] = map->type;
+        key->map_fn = map->map;
+        key->map_key = map->cache_key;
+    }
+    return true;
+}
+
 int paint_line(const painter_t *painter,
                int frame,
                double line[2][4], const uv_map_t *map,
@@ -301,6 +362,9 @@ int paint_line(const painter_t *painter,
     double (*win_line)[3] = NULL;
     bool discontinuous = false;
     double splits[2][2][4];
+    line_key_t key;
+    cached_line_t *cached;
+    bool cacheable;
 
     if (!map) assert(flags & PAINTER_SKIP_DISCONTINUOUS); // For the moment.
 
@@ -321,11 +385,31 @@ int paint_line(const painter_t *painter,
     if (discontinuous)
         goto split;
 
+    if (!g_lines_cache)
+        g_lines_cache = cache_create("lines", LINES_CACHE_SIZE);
+    cacheable = make_line_key(painter, frame, (const double (*)[4])line,
+                              map, split, &key);
+    if (cacheable) {
+        cached = cache_get(g_lines_cache, &key, sizeof(key));
+        if (cached) {
+            REND(painter->rend, line, painter, cached->win, cached->size);
+            return 0;
+        }
+    }
+
     size = line_tesselate(line_func, painter->proj,
                           USER_PASS(painter, &frame, line, map),
                           split, &win_line);
     if (size < 0) goto split;
     REND(painter->rend, line, painter, win_line, size);
+
+    if (cacheable) {
+        cached = malloc(sizeof(*cached) + size * sizeof(cached->win[0]));
+        cached->size = size;
+        memcpy(cached->win, win_line, size * sizeof(cached->win[0]));
+        cache_add(g_lines_cache, &key, sizeof(key), cached,
+                  sizeof(*cached) + size * sizeof(cached->win[0]), NULL);
+    }
     free(win_line);
     return 0;
 
@@ -342,6 +426,40 @@ split:
     return 0;
 }
 
+int paint_linestring(const painter_t *painter, int frame,
+                     int size, const double (*points)[3])
+{
+    int i, start = 0;
+    double (*view)[4], (*win)[3], p[4];
+    bool has_disc;
+
+    if (size < 2) return 0;
+    view = calloc(size, sizeof(*view));
+    win = calloc(size, sizeof(*win));
+    has_disc = painter->proj->flags & PROJ_HAS_DISCONTINUITY;
+    for (i = 0; i < size; i++) {
+        vec4_set(p, points[i][0], points[i][1], points[i][2], 0.0);
+        convert_framev4(painter->obs, frame, FRAME_VIEW, p, view[i]);
+        vec4_copy(view[i], p);
+        project(painter->proj, PROJ_TO_WINDOW_SPACE, p, p);
+        vec3_copy(p, win[i]);
+    }
+    // Render the runs of segments that don't cross the discontinuity.
+    for (i = 1; i < size; i++) {
+        if (has_disc && segment_intersects_discontinuity_line(
+                    view[i - 1], view[i])) {
+            if (i - start >= 2)
+                REND(painter->rend, line, painter, win + start, i - start);
+            start = i;
+        }
+    }
+    if (size - start >= 2)
+        REND(painter->rend, line, painter, win + start, size - start);
+    free(view);
+    free(win);
+    return 0;
+}
+
 /*
  * Function: paint_mesh
  * Render a 3d mesh
@@ -374,11 +492,13 @@ int paint_mesh(const painter_t *painter_, int frame, int mode,
     if (mode == MODE_TRIANGLES) {
         REND(painter.rend, mesh, &painter, frame, mode,
              mesh->vertices_count, mesh->vertices,
-             mesh->triangles_count, mesh->triangles);
+             mesh->triangles_count, mesh->triangles,
+             mesh->id, mesh->gen);
     } else {
         REND(painter.rend, mesh, &painter, frame, mode,
              mesh->vertices_count, mesh->vertices,
-             mesh->lines_count, mesh->lines);
+             mesh->lines_count, mesh->lines,
+             mesh->id, mesh->gen);
     }
     return 0;
 
@@ -395,9 +515,10 @@ subdivide:
                       mesh2->vertices[i], mesh2->vertices[i]);
     }
     mesh_cut_antimeridian(mesh2);
+    // Transient: the subdivided copy changes every frame.
     REND(painter.rend, mesh, &painter, FRAME_VIEW, MODE_TRIANGLES,
              mesh2->vertices_count, mesh2->vertices,
-             mesh2->triangles_count, mesh2->triangles);
+             mesh2->triangles_count, mesh2->triangles, 0, 0);
 
     mesh_delete(mesh2);
     return 0;
@@ -459,6 +580,37 @@ bool painter_is_point_clipped_fast(const painter_t *painter, int frame,
     return false;
 }
 
+void painter_is_point_clipped_fast_n(const painter_t *painter, int frame,
+                                     int n, const double (*pos)[3],
+                                     bool is_normalized, uint8_t *clipped)
+{
+    const typeof (painter->clip_info[frame]) *clipinfo =
+            &painter->clip_info[frame];
+    const double *bounding_cap = clipinfo->bounding_cap;
+    const double *sky_cap = clipinfo->sky_cap;
+    const bool horizon = painter->flags & PAINTER_HIDE_BELOW_HORIZON;
+    double v[3];
+    bool c;
+    int i, k;
+
+    memset(clipped, 0, (n + 7) / 8);
+    for (i = 0; i < n; i++) {
+        vec3_copy(pos[i], v);
+        if (!is_normalized)
+            vec3_normalize(v, v);
+        // Branch free version of the single point test, so that the
+        // loop vectorizes.
+        c = vec3_dot(bounding_cap, v) < bounding_cap[3];
+        if (horizon)
+            c |= vec3_dot(sky_cap, v) < sky_cap[3];
+        for (k = 0; k < clipinfo->nb_viewport_caps; k++) {
+            c |= vec3_dot(clipinfo->viewport_caps[k], v) <
+                 clipinfo->viewport_caps[k][3];
+        }
+        clipped[i / 8] |= (uint8_t)c << (i % 8);
+    }
+}
+
 bool painter_is_2d_point_clipped(const painter_t *painter, const double p[2])
 {
     return p[0] >= 0 && p[0] <= painter->proj->window_size[0] &&
@@ -645,12 +797,26 @@ int paint_orbit(const painter_t *painter_, int frame,
     };
     double line[2][4] = {{0}, {1}};
     double center[3];
+    double dist, win_r;
+    int split;
     // We only support ICRF for the moment to make things simpler.
     assert(frame == FRAME_ICRF);
     convert_frame(painter.obs, frame, FRAME_VIEW, false, transf[3], center);
     painter.lines.fade_dist_min = -center[2] - k_a;
     painter.lines.fade_dist_max = -center[2] + k_a * 2;
-    paint_line(&painter, frame, line, &map, 128, 0);
+
+    /* Adapt the sampling density to the projected size of the orbit: a
+     * few pixels wide ellipse doesn't need 128 segments.  We estimate
+     * the on-screen radius in pixels from the distance and semi major
+     * axis, aim at a segment every ~4 pixels, and round up to a power of
+     * two so that the line cache buckets stay stable. */
+    dist = max(vec3_norm(center), k_a / 1000);
+    win_r = atan2(k_a, dist) / painter.proj->scaling[0] *
+            painter.proj->window_size[0] / 2;
+    for (split = 8; split < 128 && split * 4 < 2 * M_PI * win_r; split *= 2);
+
+    map.cache_key = crc32(0, (const void*)orbit, sizeof(orbit));
+    paint_line(&painter, frame, line, &map, split, 0);
     return 0;
 }
 
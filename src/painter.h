@@ -114,6 +114,9 @@ struct renderer
                  const double         (*line)[3],
                  int                  size);
 
+    // key/gen: stable identity of the mesh geometry (0 for transient
+    // meshes), so that the renderer can retain the uploaded buffers
+    // across frames.
     void (*mesh)(renderer_t          *rend,
                  const painter_t     *painter,
                  int                 frame,
@@ -121,7 +124,9 @@ struct renderer
                  int                 verts_count,
                  const double        verts[][3],
                  int                 indices_count,
-                 const uint16_t      indices[]);
+                 const uint16_t      indices[],
+                 uint64_t            key,
+                 uint32_t            gen);
 
     void (*ellipse_2d)(renderer_t       *rend,
                        const painter_t  *painter,
@@ -145,6 +150,49 @@ struct renderer
 renderer_t* render_gl_create(void);
 renderer_t* render_svg_create(const char *out);
 
+/*
+ * Function: render_gl_gpu_times
+ * Get the per item type gpu times of the last measured frame (ms).
+ *
+ * The gpu timer queries are off by default; the first call enables
+ * them, so the first returned values are zero.  Return an empty report
+ * if timer queries are not supported.
+ */
+json_value *render_gl_gpu_times(renderer_t *rend);
+
+/*
+ * Function: render_gl_set_marker
+ * Set the label stamped on the render items created from now on.
+ *
+ * When set, each item's draw at flush time is wrapped in an
+ * EXT_debug_marker group named '<marker>/<item type>', so that gpu
+ * captures map directly to engine subsystems.  The string must stay
+ * valid until the end of the frame.  Pass NULL to disable.
+ */
+void render_gl_set_marker(renderer_t *rend, const char *marker);
+
+/*
+ * Function: render_gl_pick
+ * Resolve the object at a given window position with the id-buffer.
+ *
+ * Replay the pickable points of the last fully rendered frame with flat
+ * id colors into a small offscreen target centered on the position, and
+ * read the closest hit back.
+ *
+ * Parameters:
+ *   rend     - The renderer.
+ *   pos      - The position in window coordinates.
+ *   max_dist - Maximum distance to the object (window pixels).
+ *   oid      - Output oid of the picked object (0 for no hit).
+ *   hint     - Output oid hint of the picked object.
+ *
+ * Return:
+ *   false if the last frame had no pickable points (e.g. gpu picking is
+ *   disabled), in which case the caller should fall back to the areas.
+ */
+bool render_gl_pick(renderer_t *rend, const double pos[2], double max_dist,
+                    uint64_t *oid, uint64_t *hint);
+
 
 struct point
 {
@@ -205,12 +253,24 @@ struct painter
         double mat[3][3];
     } textures[2];
 
+    // Optional fallback color texture blended in the shader: the
+    // fragment samples it with the tex coordinates transformed by mat
+    // and mixes the color texture over it by blend, so that a partially
+    // loaded survey can show the parent tile without a second pass.
+    // Only honored by the plain texture quads (see hips.c).
+    struct {
+        texture_t *tex;
+        double mat[3][3];   // Texture uv -> fallback uv.
+        double blend;       // 0 -> fallback only, 1 -> color tex only.
+    } tex_fallback;
+
     struct {
-        // Viewport caps for fast clipping test.
-        double bounding_cap[4];
+        // Viewport caps for fast clipping test.  Aligned so the cap
+        // tests can use vector loads.
+        double bounding_cap[4] VEC_ALIGN_16;
 
         // 4 caps representing the 4 sides of the viewport
-        double viewport_caps[4][4];
+        double viewport_caps[4][4] VEC_ALIGN_16;
         int nb_viewport_caps;
 
         // Sky above ground cap for fast clipping test.
@@ -238,9 +298,11 @@ struct painter
             //   Ay, By, Cy, Dy, Ey, ky,
             float p[12];
             float sun[3]; // Sun position.
-            // Callback to compute the luminosity at a given point.
-            float (*compute_lum)(void *user, const float pos[3]);
-            void *user;
+            float moon[3]; // Moon position.
+            // Skybrightness model coefficients, evaluated per vertex in
+            // the shader (set by atmosphere.c, see the shader for the
+            // layout).
+            float sb[9];
         } atm;
 
         // For line rendering only.
@@ -355,6 +417,25 @@ int paint_line(const painter_t *painter,
                double line[2][4], const uv_map_t *map,
                int split, int flags);
 
+/*
+ * Function: paint_linestring
+ * Render a retained pre-tessellated polyline.
+ *
+ * Contrary to <paint_line> there is no uv mapping and no adaptive
+ * subdivision: the points are assumed to already be split finely enough
+ * for the projection, so that rendering only costs a frame conversion
+ * and a projection per point.  Sections that cross a discontinuity of
+ * the projection are skipped.
+ *
+ * Parameters:
+ *   painter    - A painter instance.
+ *   frame      - Frame of the positions.
+ *   size       - Number of points.
+ *   points     - The polyline points, as unit vectors.
+ */
+int paint_linestring(const painter_t *painter, int frame,
+                     int size, const double (*points)[3]);
+
 /*
  * Function: paint_mesh
  * Render a 3d mesh
@@ -472,6 +553,25 @@ bool painter_is_healpix_clipped(const painter_t *painter, int frame,
 bool painter_is_point_clipped_fast(const painter_t *painter, int frame,
                                    const double pos[3], bool is_normalized);
 
+// Function: painter_is_point_clipped_fast_n
+//
+// Same as <painter_is_point_clipped_fast>, but tests a contiguous array
+// of points against the cached viewport caps in one pass, writing the
+// result as a bitmask.  The caps are loaded once and the inner loop is
+// branch free, so the compiler can vectorize the dot products.
+//
+// Parameters:
+//  painter       - The painter.
+//  frame         - One of the <FRAME> enum frame.
+//  n             - Number of points.
+//  pos           - The 3D points array.
+//  is_normalized - true if the points are already normalized.
+//  clipped       - Output bitmask of (n + 7) / 8 bytes: bit i % 8 of
+//                  byte i / 8 is set if point i is clipped.
+void painter_is_point_clipped_fast_n(const painter_t *painter, int frame,
+                                     int n, const double (*pos)[3],
+                                     bool is_normalized, uint8_t *clipped);
+
 // Function: painter_is_2d_point_clipped
 //
 // Convenience function that checks if a 2D point is visible.
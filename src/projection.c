@@ -62,6 +62,8 @@ void projection_init(projection_t *p, int type, double fov,
     memset(p, 0, sizeof(*p));
     p->window_size[0] = w;
     p->window_size[1] = h;
+    p->full_window_size[0] = w;
+    p->full_window_size[1] = h;
     switch (type) {
         case PROJ_PERSPECTIVE:
             proj_perspective_init(p, fov, aspect);
@@ -86,30 +88,28 @@ void projection_init(projection_t *p, int type, double fov,
     }
 }
 
-bool project(const projection_t *proj, int flags,
-             const double v[static 4],
-             double out[static 4])
+void projection_set_subwindow(projection_t *p, double x, double y,
+                              double w, double h)
+{
+    // The full window keeps defining the field of view, the window
+    // coordinates become relative to the rect.
+    p->window_offset[0] = x;
+    p->window_offset[1] = y;
+    p->window_size[0] = w;
+    p->window_size[1] = h;
+}
+
+/*
+ * Flipping, clipping test and NDC / window space conversion, shared by
+ * the single point and the batch paths.  v is the original (view space)
+ * vector, only used for the window space z.
+ */
+static bool project_finish(const projection_t *proj, int flags,
+                           const double v[static 4], double p[static 4],
+                           double out[static 4])
 {
-    PROFILE(project, PROFILE_AGGREGATE);
-    double p[4] = {0, 0, 0, 1};
     bool visible;
 
-    if (flags & PROJ_BACKWARD) {
-        vec2_copy(v, p);
-        if (flags & PROJ_FROM_WINDOW_SPACE) {
-            p[0] = p[0] / proj->window_size[0] * 2 - 1;
-            p[1] = 1 - p[1] / proj->window_size[1] * 2;
-        }
-        if (proj->flags & PROJ_FLIP_HORIZONTAL) p[0] = -p[0];
-        if (proj->flags & PROJ_FLIP_VERTICAL)   p[1] = -p[1];
-        assert(proj->backward);
-        return proj->backward(proj, flags, p, out);
-    }
-    assert(proj->project);
-    vec3_copy(v, p);
-    if (flags & PROJ_ALREADY_NORMALIZED)
-        assert(vec3_is_normalized(p));
-    proj->project(proj, flags, v, p);
     if (proj->flags & PROJ_FLIP_HORIZONTAL) p[0] = -p[0];
     if (proj->flags & PROJ_FLIP_VERTICAL)   p[1] = -p[1];
 
@@ -125,10 +125,78 @@ bool project(const projection_t *proj, int flags,
         vec3_mul(1.0 / p[3], p, p);
     p[3] = visible ? 1.0 : 0.0; // Not sure this is proper...
     if (flags & PROJ_TO_WINDOW_SPACE) {
-        p[0] = (+p[0] + 1) / 2 * proj->window_size[0];
-        p[1] = (-p[1] + 1) / 2 * proj->window_size[1];
+        p[0] = (+p[0] + 1) / 2 * proj->full_window_size[0] -
+               proj->window_offset[0];
+        p[1] = (-p[1] + 1) / 2 * proj->full_window_size[1] -
+               proj->window_offset[1];
         p[2] = -v[2]; // Z get the distance in view space.
     }
     memcpy(out, p, 4 * sizeof(double));
     return visible;
 }
+
+static bool project_forward(const projection_t *proj, int flags,
+                            const double v[static 4],
+                            double out[static 4])
+{
+    double p[4] = {0, 0, 0, 1};
+
+    assert(proj->project);
+    vec3_copy(v, p);
+    if (flags & PROJ_ALREADY_NORMALIZED)
+        assert(vec3_is_normalized(p));
+    proj->project(proj, flags, v, p);
+    return project_finish(proj, flags, v, p, out);
+}
+
+bool project(const projection_t *proj, int flags,
+             const double v[static 4],
+             double out[static 4])
+{
+    PROFILE(project, PROFILE_AGGREGATE);
+    double p[4] = {0, 0, 0, 1};
+
+    if (flags & PROJ_BACKWARD) {
+        vec2_copy(v, p);
+        if (flags & PROJ_FROM_WINDOW_SPACE) {
+            p[0] = (p[0] + proj->window_offset[0]) /
+                   proj->full_window_size[0] * 2 - 1;
+            p[1] = 1 - (p[1] + proj->window_offset[1]) /
+                   proj->full_window_size[1] * 2;
+        }
+        if (proj->flags & PROJ_FLIP_HORIZONTAL) p[0] = -p[0];
+        if (proj->flags & PROJ_FLIP_VERTICAL)   p[1] = -p[1];
+        assert(proj->backward);
+        return proj->backward(proj, flags, p, out);
+    }
+    return project_forward(proj, flags, v, out);
+}
+
+int project_n(const projection_t *proj, int flags, int n,
+              const double (*v)[4], double (*out)[4])
+{
+    PROFILE(project_n, PROFILE_AGGREGATE);
+    double tmp[64][4];
+    int i, j, chunk, nb = 0;
+
+    assert(!(flags & PROJ_BACKWARD)); // Only the forward direction.
+    if (!proj->project_batch) {
+        for (i = 0; i < n; i++) {
+            if (project_forward(proj, flags, v[i], out[i]))
+                nb++;
+        }
+        return nb;
+    }
+    // Project by chunks with the specialized kernel (inlined projection
+    // math, one indirect call per chunk), then finish each point.  The
+    // temporary buffer also makes in-place calls (v == out) safe.
+    for (i = 0; i < n; i += chunk) {
+        chunk = n - i < 64 ? n - i : 64;
+        proj->project_batch(proj, flags, chunk, v + i, tmp);
+        for (j = 0; j < chunk; j++) {
+            if (project_finish(proj, flags, v[i + j], tmp[j], out[i + j]))
+                nb++;
+        }
+    }
+    return nb;
+}
@@ -12,6 +12,16 @@
 
 #include <stdbool.h>
 
+// Same definition as in utils/vec.h (which we cannot include here since
+// it has no include guard).
+#ifndef VEC_ALIGN_16
+#   if defined(__GNUC__) || defined(__clang__)
+#       define VEC_ALIGN_16 __attribute__((aligned(16)))
+#   else
+#       define VEC_ALIGN_16
+#   endif
+#endif
+
 // S macro for C99 static argument array size.
 #ifndef __cplusplus
 #define S static
@@ -72,16 +82,29 @@ struct projection
     int flags;
     int type;
 
-    // Matrices used by some projections.
-    double mat[4][4];
+    // Matrices used by some projections.  Aligned so that mat4_mul_vec4
+    // can use vector loads.
+    double mat[4][4] VEC_ALIGN_16;
     // Window size (screen size / screen density).
     double window_size[2];
 
+    // Sub window support (see <projection_set_subwindow>): the projection
+    // covers a virtual window of full_window_size, of which we only render
+    // the window_size rect at window_offset.  By default the offset is
+    // zero and full_window_size equals window_size, i.e. the whole window.
+    double window_offset[2];
+    double full_window_size[2];
+
     // Maximum FOV at which we can display
     double max_fov;
 
     void (*project)(const projection_t *proj, int flags,
                     const double v[S 4], double out[S 4]);
+    // Batch version of project: projecting n vectors in a single call
+    // lets the compiler inline the projection math in the loop, instead
+    // of paying one indirect call per point.  Used by <project_n>.
+    void (*project_batch)(const projection_t *proj, int flags, int n,
+                          const double (*v)[4], double (*out)[4]);
     bool (*backward)(const projection_t *proj, int flags,
                      const double v[S 2], double out[4]);
 };
@@ -116,6 +139,24 @@ void projection_compute_fovs(int proj_type, double fov, double aspect,
 void projection_init(projection_t *proj, int type, double fovx,
                      double win_w, double win_h);
 
+/*
+ * Function: projection_set_subwindow
+ * Restrict an initialized projection to a sub rect of its window.
+ *
+ * Used for tiled still rendering (see <core_render_still>): the
+ * projection keeps the field of view of the full window, but the window
+ * space coordinates become relative to the given rect, so the rect can
+ * be rendered alone in a framebuffer of its own size.  The viewport
+ * culling then only keeps the sky area covered by the rect.
+ *
+ * Parameters:
+ *   proj   - An initialized projection.
+ *   x, y   - Origin of the rect inside the full window, in window units.
+ *   w, h   - Size of the rect, in window units.
+ */
+void projection_set_subwindow(projection_t *proj, double x, double y,
+                              double w, double h);
+
 /* Function: project
  * Apply a projection to coordinates
  *
@@ -135,6 +176,26 @@ void projection_init(projection_t *proj, int type, double fovx,
 bool project(const projection_t *proj, int flags,
              const double v[S 4], double out[S 4]);
 
+/* Function: project_n
+ * Apply a forward projection to a contiguous array of coordinates.
+ *
+ * Same as calling <project> on each vector, but the dispatch and flag
+ * handling are amortized over the whole array.  Only the forward
+ * direction is supported (no PROJ_BACKWARD flag).
+ *
+ * Parameters:
+ *  proj    - A projection.
+ *  flags   - Union of <PROJ_FLAGS> values.
+ *  n       - Number of coordinates.
+ *  v       - Input coordinates array.
+ *  out     - Output coordinates array (can be the same as v).
+ *
+ * Return:
+ *  The number of visible (non clipped) coordinates.
+ */
+int project_n(const projection_t *proj, int flags, int n,
+              const double (*v)[4], double (*out)[4]);
+
 #undef S
 
 #endif // PROJECTION_H
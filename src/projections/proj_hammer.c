@@ -47,12 +47,21 @@ static bool proj_hammer_backward(const projection_t *proj, int flags,
     return ret;
 }
 
+static void proj_hammer_project_batch(const projection_t *proj, int flags,
+        int n, const double (*v)[4], double (*out)[4])
+{
+    int i;
+    for (i = 0; i < n; i++)
+        proj_hammer_project(proj, flags, v[i], out[i]);
+}
+
 void proj_hammer_init(projection_t *p, double fov, double aspect)
 {
     p->name                      = "hammer";
     p->type                      = PROJ_HAMMER;
     p->max_fov                   = 360 * DD2R;
     p->project                   = proj_hammer_project;
+    p->project_batch             = proj_hammer_project_batch;
     p->backward                  = proj_hammer_backward;
     p->scaling[0]                = aspect < 1 ? fov / 2 : fov / aspect / 2;
     p->scaling[1]                = p->scaling[0] / aspect;
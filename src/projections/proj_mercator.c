@@ -59,12 +59,21 @@ static bool proj_mercator_backward(const projection_t *proj, int flags,
     return ret;
 }
 
+static void proj_mercator_project_batch(const projection_t *proj, int flags,
+        int n, const double (*v)[4], double (*out)[4])
+{
+    int i;
+    for (i = 0; i < n; i++)
+        proj_mercator_project(proj, flags, v[i], out[i]);
+}
+
 void proj_mercator_init(projection_t *p, double fov, double aspect)
 {
     p->name                      = "mercator";
     p->type                      = PROJ_MERCATOR;
     p->max_fov                   = 175.0 * aspect * DD2R;
     p->project                   = proj_mercator_project;
+    p->project_batch             = proj_mercator_project_batch;
     p->backward                  = proj_mercator_backward;
     p->scaling[0]                = fov / 2;
     p->scaling[1]                = p->scaling[0] / aspect;
@@ -48,6 +48,14 @@ static void proj_mollweide_project(
     out[3] = 1;
 }
 
+static void proj_mollweide_project_batch(const projection_t *proj, int flags,
+        int n, const double (*v)[4], double (*out)[4])
+{
+    int i;
+    for (i = 0; i < n; i++)
+        proj_mollweide_project(proj, flags, v[i], out[i]);
+}
+
 static double clamp(double x, double a, double b)
 {
     return x < a ? a : x > b ? b : x;
@@ -108,6 +116,7 @@ void proj_mollweide_init(projection_t *p, double fovx, double aspect)
     p->type                      = PROJ_MOLLWEIDE;
     p->max_fov                   = 360 * DD2R;
     p->project                   = proj_mollweide_project;
+    p->project_batch             = proj_mollweide_project_batch;
     p->backward                  = proj_mollweide_backward;
     p->scaling[0]                = fovx / M_PI * sqrt(2);
     p->scaling[1]                = p->scaling[0] / aspect;
@@ -32,6 +32,14 @@ static bool proj_perspective_backward(const projection_t *proj, int flags,
     return true;
 }
 
+static void proj_perspective_project_batch(const projection_t *proj, int flags,
+        int n, const double (*v)[4], double (*out)[4])
+{
+    int i;
+    for (i = 0; i < n; i++)
+        proj_perspective_project(proj, flags, v[i], out[i]);
+}
+
 void proj_perspective_init(projection_t *p, double fov, double aspect)
 {
     double fovy, clip_near = 0.1, clip_far = 256;
@@ -41,6 +49,7 @@ void proj_perspective_init(projection_t *p, double fov, double aspect)
     p->type = PROJ_PERSPECTIVE;
     p->max_fov = 120. * DD2R;
     p->project = proj_perspective_project;
+    p->project_batch = proj_perspective_project_batch;
     p->backward = proj_perspective_backward;
     p->scaling[0] = tan(fov / 2);
     p->scaling[1] = p->scaling[0] / aspect;
@@ -71,6 +71,14 @@ static bool proj_stereographic_backward(const projection_t *proj, int flags,
     return true;
 }
 
+static void proj_stereographic_project_batch(const projection_t *proj, int flags,
+        int n, const double (*v)[4], double (*out)[4])
+{
+    int i;
+    for (i = 0; i < n; i++)
+        proj_stereographic_project(proj, flags, v[i], out[i]);
+}
+
 void proj_stereographic_compute_fov(double fov, double aspect,
                                     double *fovx, double *fovy)
 {
@@ -89,6 +97,7 @@ void proj_stereographic_init(projection_t *p, double fovx, double aspect)
     p->type          = PROJ_STEREOGRAPHIC;
     p->max_fov       = 185. * DD2R;
     p->project       = proj_stereographic_project;
+    p->project_batch = proj_stereographic_project_batch;
     p->backward      = proj_stereographic_backward;
     p->scaling[0]    = 2 * tan(fovx / 4);
     p->scaling[1]    = p->scaling[0] / aspect;
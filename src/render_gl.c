@@ -18,6 +18,7 @@
 #include "nanovg_gl.h"
 
 #include <float.h>
+#include <zlib.h> // For crc32.
 
 #define GRID_CACHE_SIZE (2 * (1 << 20))
 
@@ -37,6 +38,7 @@ enum {
     ATTR_SKY_POS,
     ATTR_LUMINANCE,
     ATTR_SIZE,
+    ATTR_SHAPE,
 };
 
 static const char *ATTR_NAMES[] = {
@@ -49,6 +51,7 @@ static const char *ATTR_NAMES[] = {
     [ATTR_SKY_POS]      = "a_sky_pos",
     [ATTR_LUMINANCE]    = "a_luminance",
     [ATTR_SIZE]         = "a_size",
+    [ATTR_SHAPE]        = "a_shape",
     NULL,
 };
 
@@ -60,12 +63,29 @@ struct tex_cache {
     double      size;
     char        *text;
     int         effects;
+    int         font_gen;   // Font generation at rasterization time.
     bool        in_use;
     int         xoff;
     int         yoff;
     texture_t   *tex;
 };
 
+/*
+ * Shaped text measurement cache: the label layout and its collision
+ * system measure the same strings every frame, and a measurement used to
+ * go through the texture cache linear scan (or rasterize the string on a
+ * miss).  The metrics only depend on (string, size, effects) and on the
+ * loaded fonts, so we keep them in a hash, invalidated by generation
+ * when a font changes (core_add_font).
+ */
+typedef struct text_metrics {
+    UT_hash_handle hh;
+    char        *key;       // "<effects>:<size>:<text>".
+    int         font_gen;   // Font generation at measurement time.
+    int         w, h;       // Texture size (device pixels).
+    int         xoff, yoff;
+} text_metrics_t;
+
 enum {
     ITEM_LINES = 1,
     ITEM_MESH,
@@ -80,8 +100,46 @@ enum {
     ITEM_TEXT,
     ITEM_QUAD_WIREFRAME,
     ITEM_LINES_GLOW,
+
+    ITEM_NB,
 };
 
+// Item type names, for the gpu times report.
+static const char *ITEM_NAMES[ITEM_NB] = {
+    [ITEM_LINES]            = "lines",
+    [ITEM_MESH]             = "mesh",
+    [ITEM_POINTS]           = "points",
+    [ITEM_TEXTURE]          = "texture",
+    [ITEM_ATMOSPHERE]       = "atmosphere",
+    [ITEM_FOG]              = "fog",
+    [ITEM_PLANET]           = "planet",
+    [ITEM_VG_ELLIPSE]       = "vg_ellipse",
+    [ITEM_VG_RECT]          = "vg_rect",
+    [ITEM_VG_LINE]          = "vg_line",
+    [ITEM_TEXT]             = "text",
+    [ITEM_QUAD_WIREFRAME]   = "quad_wireframe",
+    [ITEM_LINES_GLOW]       = "lines_glow",
+};
+
+/*
+ * Optional GPU timer queries, so that we can attribute the gpu frame
+ * time to the different item types (EXT_disjoint_timer_query on gles,
+ * plain timer queries on desktop).  Disabled until the first call to
+ * <render_gl_gpu_times>.
+ */
+#if defined(GLES2) && defined(GL_TIME_ELAPSED_EXT)
+#   define GPU_QUERY_TARGET GL_TIME_ELAPSED_EXT
+#   define glGenQueries glGenQueriesEXT
+#   define glDeleteQueries glDeleteQueriesEXT
+#   define glBeginQuery glBeginQueryEXT
+#   define glEndQuery glEndQueryEXT
+#   define glGetQueryObjectuiv glGetQueryObjectuivEXT
+#   define GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE_EXT
+#   define GL_QUERY_RESULT GL_QUERY_RESULT_EXT
+#elif !defined(GLES2) && defined(GL_TIME_ELAPSED)
+#   define GPU_QUERY_TARGET GL_TIME_ELAPSED
+#endif
+
 typedef struct item item_t;
 struct item
 {
@@ -93,6 +151,9 @@ struct item
     texture_t   *tex;
     int         flags;
     float       depth_range[2];
+    // Source module label, for the gpu debug marker groups.  NULL when
+    // the markers are disabled.
+    const char  *marker;
 
     union {
         struct {
@@ -108,6 +169,14 @@ struct item
             float halo;
         } points;
 
+        struct {
+            // Optional fallback texture blended in the shader (see
+            // painter_t tex_fallback).
+            texture_t *fallback_tex;
+            float fallback_mat[9]; // Main tex pos -> fallback tex pos.
+            float fallback_blend;
+        } texture;
+
         struct {
             float contrast;
             texture_t *normalmap;
@@ -125,15 +194,14 @@ struct item
         struct {
             float pos[2];
             float pos2[2];
-            float size[2];
-            float angle;
-            float dashes;
             float stroke_width;
         } vg;
 
         struct {
             float p[12];    // Color computation coefs.
             float sun[3];   // Sun position.
+            float moon[3];  // Moon position.
+            float sb[9];    // Skybrightness model coefs.
         } atm;
 
         struct {
@@ -151,12 +219,65 @@ struct item
             // Projection setttings.  Should be set globally probably.
             int proj;
             float proj_scaling[2];
+            // Retained GPU buffers for this mesh, or NULL for the
+            // normal per-frame upload path.
+            struct mesh_vbo *vbo;
         } mesh;
     };
 
     item_t *next, *prev;
 };
 
+/*
+ * Block of the frame arena.  All the transient render allocations
+ * (items, uncached uv grids...) only live for one frame, so instead of
+ * a malloc/free pair each they are bump-allocated from a list of blocks
+ * that gets reset (but not freed) at the end of the flush.
+ */
+#define FRAME_ARENA_BLOCK (256 * 1024)
+
+/*
+ * Retained GPU buffers for the meshes that have a stable identity
+ * (geojson features): the projected vertices only change when the view
+ * or the geometry changes, so as long as the state below matches we can
+ * re-issue the draw from the uploaded buffers with only uniform
+ * changes.  Only worth it for large meshes: small ones benefit more
+ * from being merged into a single transient draw.
+ */
+#define MESH_RETAIN_MIN_VERTS 512
+
+typedef struct mesh_vbo mesh_vbo_t;
+struct mesh_vbo
+{
+    UT_hash_handle  hh;
+    uint64_t        key;
+    // State under which the buffers were built.
+    uint32_t        gen;
+    uint64_t        obs_hash;
+    int             frame;
+    int             mode;
+    int             proj_type;
+    double          proj_scaling[2];
+    double          window_size[2];
+    // Projection settings to apply at draw time.
+    int             item_proj;
+    float           item_proj_scaling[2];
+
+    GLuint          vbo, ibo;
+    int             nb_indices;
+    bool            ready;
+    int64_t         last_used; // Frame counter of the last use.
+};
+
+typedef struct arena_block arena_block_t;
+struct arena_block
+{
+    arena_block_t   *next, *prev;
+    int             size;   // Allocated size of data.
+    int             pos;    // Current fill position.
+    char            data[];
+};
+
 static const gl_buf_info_t INDICES_BUF = {
     .size = 2,
     .attrs = {
@@ -197,6 +318,16 @@ static const gl_buf_info_t POINTS_BUF = {
     },
 };
 
+static const gl_buf_info_t VG_BUF = {
+    .size = 36,
+    .attrs = {
+        [ATTR_POS]      = {GL_FLOAT, 2, false, 0},
+        [ATTR_TEX_POS]  = {GL_FLOAT, 2, false, 8},
+        [ATTR_SHAPE]    = {GL_FLOAT, 4, false, 16},
+        [ATTR_COLOR]    = {GL_UNSIGNED_BYTE, 4, true, 32},
+    },
+};
+
 static const gl_buf_info_t TEXTURE_BUF = {
     .size = 24,
     .attrs = {
@@ -217,12 +348,42 @@ static const gl_buf_info_t PLANET_BUF = {
     },
 };
 
+/*
+ * Packed variants of the texture and planet layouts, used when the
+ * driver supports half-float vertex attributes: uvs, normals and
+ * tangents don't need full float precision, and the survey and planet
+ * tiles are the biggest vertex buffers we upload each frame.
+ * g_texture_buf / g_planet_buf point to the layouts actually in use,
+ * selected in <render_gl_create>.
+ */
+static const gl_buf_info_t TEXTURE_BUF_PACKED = {
+    .size = 20,
+    .attrs = {
+        [ATTR_POS]      = {GL_FLOAT, 4, false, 0},
+        [ATTR_TEX_POS]  = {GL_HALF_FLOAT, 2, false, 16},
+    },
+};
+
+static const gl_buf_info_t PLANET_BUF_PACKED = {
+    .size = 52,
+    .attrs = {
+        [ATTR_POS]      = {GL_FLOAT, 4, false, 0},
+        [ATTR_MPOS]     = {GL_FLOAT, 4, false, 16},
+        [ATTR_TEX_POS]  = {GL_HALF_FLOAT, 2, false, 32},
+        [ATTR_COLOR]    = {GL_UNSIGNED_BYTE, 4, true, 36},
+        [ATTR_NORMAL]   = {GL_HALF_FLOAT, 3, false, 40},
+        [ATTR_TANGENT]  = {GL_HALF_FLOAT, 3, false, 46},
+    },
+};
+
+static const gl_buf_info_t *g_texture_buf = &TEXTURE_BUF;
+static const gl_buf_info_t *g_planet_buf = &PLANET_BUF;
+
 static const gl_buf_info_t ATMOSPHERE_BUF = {
-    .size = 32,
+    .size = 28,
     .attrs = {
         [ATTR_POS]       = {GL_FLOAT, 4, false, 0},
         [ATTR_SKY_POS]   = {GL_FLOAT, 3, false, 16},
-        [ATTR_LUMINANCE] = {GL_FLOAT, 1, false, 28},
     },
 };
 
@@ -242,8 +403,14 @@ typedef struct renderer_gl {
     bool    cull_flipped;
     double  depth_range[2];
 
+    // Shared color effect uniform values (night mode strength and global
+    // dimming), refreshed at each frame from the core state.
+    float   color_fx[2];
+
     texture_t   *white_tex;
     tex_cache_t *tex_cache;
+    text_metrics_t *metrics_cache;
+    int         font_gen;   // Bumped when the fonts change.
     NVGcontext *vg;
 
     // Nanovg fonts references for regular and bold.
@@ -256,6 +423,81 @@ typedef struct renderer_gl {
     item_t  *items;
     cache_t *grid_cache;
 
+    /* Dynamic resolution scaling (see <rend_flush>): the contiguous
+     * prefix of background items is rendered into this smaller
+     * framebuffer and composited up. */
+    double  render_scale;
+    struct {
+        GLuint  fbo;
+        GLuint  tex;
+        int     w, h;
+    } lowres;
+
+    // Label stamped on the new items (see render_gl_set_marker).
+    const char *marker;
+
+    // Per-frame arena for the transient allocations (see arena_block_t).
+    struct {
+        arena_block_t *blocks;
+        arena_block_t *cur;
+    } frame_arena;
+
+    // GPU timer queries state (see GPU_QUERY_TARGET).
+    struct {
+        bool    enabled;
+        struct {
+            GLuint  id;
+            int     type;
+            int64_t frame;
+        } pending[256];
+        int     nb;
+        int64_t frame;          // Frame currently accumulating.
+        double  accum[ITEM_NB];
+        double  times[ITEM_NB]; // Last fully measured frame (ms).
+    } gpu_timers;
+
+    /* Persistent VBOs for point batches.  When the vertex data of a batch
+     * did not change since a previous frame (static view, e.g. star tiles
+     * that only moved with the frame rotation of the whole scene), we can
+     * reuse the uploaded buffer and skip the per-frame glBufferData. */
+    struct {
+        GLuint      vbo;
+        uint32_t    hash;
+        int         nb;
+        int64_t     frame; // Last frame the entry was used.
+    } points_vbos[8];
+    int64_t frame_count;
+
+    /* Ring of reusable GL buffers for the per-frame vertex and index
+     * uploads.  Cycling through the ring avoids touching a buffer the
+     * driver might still be reading from, and respecifying with
+     * glBufferData orphans the old storage (persistent mapping is not
+     * available on GLES2/WebGL1).  This removes the per-draw
+     * glGenBuffers/glDeleteBuffers churn. */
+    struct {
+        GLuint vbo;
+        GLuint ibo;
+    } vbo_ring[32];
+    int vbo_ring_pos;
+
+    // Retained mesh buffers, keyed by the stable mesh identity.
+    mesh_vbo_t *mesh_vbos;
+
+    /* Id-buffer picking state (see <render_gl_pick>).  While rendering,
+     * the point batches append their pickable vertices to the frame
+     * stream being filled; <finish> publishes it, and a pick query
+     * replays it with the PICK shader variant into a small offscreen
+     * target and reads the id back. */
+    struct {
+        struct pick_frame {
+            gl_buf_t buf;       // POINTS_BUF vertices, color = id.
+            uint64_t (*ids)[2]; // id - 1 -> (oid, hint).
+            int allocated;
+        } frames[2];
+        int current;            // Frame currently being filled.
+        GLuint fbo, tex, vbo;
+    } pick;
+
 } renderer_gl_t;
 
 static void init_shader(gl_shader_t *shader)
@@ -267,6 +509,42 @@ static void init_shader(gl_shader_t *shader)
     gl_update_uniform(shader, "u_shadow_color_tex", 2);
 }
 
+static void *frame_alloc(renderer_gl_t *rend, int size)
+{
+    arena_block_t *block;
+    void *ret;
+    size = (size + 15) / 16 * 16; // Keep the allocations aligned.
+    for (block = rend->frame_arena.cur; block; block = block->next) {
+        if (block->pos + size <= block->size) break;
+    }
+    if (!block) {
+        block = malloc(sizeof(*block) + max(size, FRAME_ARENA_BLOCK));
+        block->size = max(size, FRAME_ARENA_BLOCK);
+        block->pos = 0;
+        DL_APPEND(rend->frame_arena.blocks, block);
+    }
+    rend->frame_arena.cur = block;
+    ret = block->data + block->pos;
+    block->pos += size;
+    return ret;
+}
+
+static void frame_arena_reset(renderer_gl_t *rend)
+{
+    arena_block_t *block;
+    for (block = rend->frame_arena.blocks; block; block = block->next)
+        block->pos = 0;
+    rend->frame_arena.cur = rend->frame_arena.blocks;
+}
+
+static item_t *item_alloc(renderer_gl_t *rend)
+{
+    item_t *item = frame_alloc(rend, sizeof(*item));
+    memset(item, 0, sizeof(*item));
+    item->marker = rend->marker;
+    return item;
+}
+
 static bool color_is_white(const float c[4])
 {
     return c[0] == 1.0f && c[1] == 1.0f && c[2] == 1.0f && c[3] == 1.0f;
@@ -279,16 +557,49 @@ static void window_to_ndc(renderer_gl_t *rend,
     ndc[1] = 1 - (win[1] * rend->scale / rend->fb_size[1]) * 2;
 }
 
+// Max number of entries of the label texture cache before we start to
+// evict the ones that were not used last frame.
+#define LABEL_CACHE_MAX 512
+
 static void prepare(renderer_t *rend_, double win_w, double win_h,
                     double scale, bool cull_flipped)
 {
     renderer_gl_t *rend = (void*)rend_;
-    tex_cache_t *ctex;
+    tex_cache_t *ctex, *tmp;
+    int nb = 0;
 
     rend->fb_size[0] = win_w * scale;
     rend->fb_size[1] = win_h * scale;
     rend->scale = scale;
     rend->cull_flipped = cull_flipped;
+    rend->frame_count++;
+    rend->color_fx[0] = core->night_mode;
+    rend->color_fx[1] = core->dimming;
+    rend->render_scale = clamp(core->render_scale ?: 1.0, 0.25, 1.0);
+
+    // Drop the labels rasterized with an older font generation, so that
+    // all the labels get re-shaped when a new font is loaded (e.g. the
+    // full font streamed in after the first paint with the subset font).
+    DL_FOREACH_SAFE(rend->tex_cache, ctex, tmp) {
+        if (ctex->font_gen == rend->font_gen) continue;
+        DL_DELETE(rend->tex_cache, ctex);
+        texture_release(ctex->tex);
+        free(ctex->text);
+        free(ctex);
+    }
+
+    // LRU eviction of the label textures: if the cache grew too large,
+    // drop the oldest entries that were not used last frame.
+    DL_COUNT(rend->tex_cache, ctex, nb);
+    DL_FOREACH_SAFE(rend->tex_cache, ctex, tmp) {
+        if (nb <= LABEL_CACHE_MAX) break;
+        if (ctex->in_use) continue;
+        DL_DELETE(rend->tex_cache, ctex);
+        texture_release(ctex->tex);
+        free(ctex->text);
+        free(ctex);
+        nb--;
+    }
 
     DL_FOREACH(rend->tex_cache, ctex)
         ctex->in_use = false;
@@ -319,6 +630,43 @@ static item_t *get_item(renderer_gl_t *rend, int type,
     return NULL;
 }
 
+/*
+ * Append a pickable point to the pick stream of the current frame.
+ *
+ * The vertex record is copied as is, except for the color that gets
+ * replaced by the encoded id (0 meaning no hit).  The buffers are
+ * persistent and grown with plain realloc, so they never go through the
+ * gl buffer pool.
+ */
+static void pick_add_point(renderer_gl_t *rend, const void *vert,
+                           uint64_t oid, uint64_t hint)
+{
+    struct pick_frame *frame = &rend->pick.frames[rend->pick.current];
+    gl_buf_t *buf = &frame->buf;
+    uint8_t *color;
+    uint32_t id;
+
+    if (buf->nb >= frame->allocated) {
+        frame->allocated += 4096;
+        buf->info = &POINTS_BUF;
+        buf->capacity = frame->allocated;
+        buf->data = realloc(buf->data, frame->allocated * POINTS_BUF.size);
+        frame->ids = realloc(frame->ids,
+                             frame->allocated * sizeof(*frame->ids));
+    }
+    id = buf->nb + 1;
+    frame->ids[buf->nb][0] = oid;
+    frame->ids[buf->nb][1] = hint;
+    memcpy((char*)buf->data + buf->nb * POINTS_BUF.size, vert,
+           POINTS_BUF.size);
+    color = (uint8_t*)buf->data + buf->nb * POINTS_BUF.size + 12;
+    color[0] = id & 0xff;
+    color[1] = (id >> 8) & 0xff;
+    color[2] = (id >> 16) & 0xff;
+    color[3] = 255;
+    buf->nb++;
+}
+
 static void points_2d(renderer_t *rend_,
                       const painter_t *painter,
                       int n,
@@ -329,6 +677,12 @@ static void points_2d(renderer_t *rend_,
     int i;
     const int MAX_POINTS = 4096;
     point_t p;
+    // Memory layout of POINTS_BUF.
+    struct {
+        float pos[2];
+        float size;
+        uint8_t color[4];
+    } *v;
 
     if (n > MAX_POINTS) {
         LOG_E("Try to render more than %d points: %d", MAX_POINTS, n);
@@ -339,7 +693,7 @@ static void points_2d(renderer_t *rend_,
     if (item && item->points.halo != painter->points_halo)
         item = NULL;
     if (!item) {
-        item = calloc(1, sizeof(*item));
+        item = item_alloc(rend);
         item->type = ITEM_POINTS;
         gl_buf_alloc(&item->buf, &POINTS_BUF, MAX_POINTS);
         vec4_to_float(painter->color, item->color);
@@ -347,18 +701,27 @@ static void points_2d(renderer_t *rend_,
         DL_APPEND(rend->items, item);
     }
 
+    assert(item->buf.info->size == sizeof(*v));
     for (i = 0; i < n; i++) {
         p = points[i];
         window_to_ndc(rend, p.pos, p.pos);
 
-        gl_buf_2f(&item->buf, -1, ATTR_POS, VEC2_SPLIT(p.pos));
-        gl_buf_1f(&item->buf, -1, ATTR_SIZE, p.size * rend->scale);
-        gl_buf_4i(&item->buf, -1, ATTR_COLOR, VEC4_SPLIT(p.color));
+        // Write the vertex record directly: with one record per point
+        // (the quad expansion happens on the GPU with point sprites),
+        // the per-attribute setter calls dominate the fill cost for
+        // large star batches.
+        v = (void*)((char*)item->buf.data + item->buf.nb * sizeof(*v));
+        v->pos[0] = p.pos[0];
+        v->pos[1] = p.pos[1];
+        v->size = p.size * rend->scale;
+        memcpy(v->color, p.color, sizeof(v->color));
         gl_buf_next(&item->buf);
 
         // Add the point int the global list of rendered points.
         // XXX: could be done in the painter.
-        if (p.oid) {
+        if (p.oid && core->gpu_picking) {
+            pick_add_point(rend, v, p.oid, p.hint);
+        } else if (p.oid) {
             p.pos[0] = (+p.pos[0] + 1) / 2 * core->win_size[0];
             p.pos[1] = (-p.pos[1] + 1) / 2 * core->win_size[1];
             areas_add_circle(core->areas, p.pos, p.size, p.oid, p.hint);
@@ -371,8 +734,7 @@ static void points_2d(renderer_t *rend_,
  * Compute an uv_map grid, and cache it if possible.
  */
 static const double (*get_grid(renderer_gl_t *rend,
-                               const uv_map_t *map, int split,
-                               bool *should_delete))[4]
+                               const uv_map_t *map, int split))[4]
 {
     int n = split + 1;
     double (*grid)[4];
@@ -385,16 +747,18 @@ static const double (*get_grid(renderer_gl_t *rend,
     _Static_assert(sizeof(key) == 16, "");
     bool can_cache = map->type == UV_MAP_HEALPIX && map->at_infinity;
 
-    *should_delete = !can_cache;
     if (can_cache) {
         if (!rend->grid_cache)
-            rend->grid_cache = cache_create(GRID_CACHE_SIZE);
+            rend->grid_cache = cache_create("grid", GRID_CACHE_SIZE);
         grid = cache_get(rend->grid_cache, &key, sizeof(key));
         if (grid)
             return grid;
     }
 
-    grid = malloc(n * n * sizeof(*grid));
+    // Cached grids are owned by the cache, the other ones only live for
+    // the frame.
+    grid = can_cache ? malloc(n * n * sizeof(*grid)) :
+                       frame_alloc(rend, n * n * sizeof(*grid));
     uv_map_grid(map, split, grid, NULL);
 
     if (can_cache) {
@@ -444,9 +808,9 @@ static void quad_planet(
                                 {1, 1}, {1, 0}, {0, 1} };
     n = grid_size + 1;
 
-    item = calloc(1, sizeof(*item));
+    item = item_alloc(rend);
     item->type = ITEM_PLANET;
-    gl_buf_alloc(&item->buf, &PLANET_BUF, n * n * 4);
+    gl_buf_alloc(&item->buf, g_planet_buf, n * n * 4);
     gl_buf_alloc(&item->indices, &INDICES_BUF, n * n * 6);
     vec4_to_float(painter->color, item->color);
     item->flags = painter->flags;
@@ -550,9 +914,7 @@ static void quad(renderer_t          *rend_,
     const int INDICES[6][2] = {
         {0, 0}, {0, 1}, {1, 0}, {1, 1}, {1, 0}, {0, 1} };
     double p[4], tex_pos[2], ndc_p[4];
-    float lum;
     const double (*grid)[4] = NULL;
-    bool should_delete_grid;
     texture_t *tex = painter->textures[PAINTER_TEX_COLOR].tex;
 
     // Special case for planet shader.
@@ -567,28 +929,34 @@ static void quad(renderer_t          *rend_,
                         n * n, grid_size * grid_size * 6, tex);
         if (item && (
                 memcmp(item->atm.p, painter->atm.p, sizeof(item->atm.p)) ||
-                memcmp(item->atm.sun, painter->atm.sun, sizeof(item->atm.sun))))
+                memcmp(item->atm.sun, painter->atm.sun,
+                       sizeof(item->atm.sun)) ||
+                memcmp(item->atm.sb, painter->atm.sb,
+                       sizeof(item->atm.sb))))
             item = NULL;
         if (!item) {
-            item = calloc(1, sizeof(*item));
+            item = item_alloc(rend);
             item->type = ITEM_ATMOSPHERE;
             gl_buf_alloc(&item->buf, &ATMOSPHERE_BUF, 256);
             gl_buf_alloc(&item->indices, &INDICES_BUF, 256 * 6);
             memcpy(item->atm.p, painter->atm.p, sizeof(item->atm.p));
             memcpy(item->atm.sun, painter->atm.sun, sizeof(item->atm.sun));
+            memcpy(item->atm.moon, painter->atm.moon,
+                   sizeof(item->atm.moon));
+            memcpy(item->atm.sb, painter->atm.sb, sizeof(item->atm.sb));
         }
     } else if (painter->flags & PAINTER_FOG_SHADER) {
         item = get_item(rend, ITEM_FOG, n * n, grid_size * grid_size * 6, tex);
         if (!item) {
-            item = calloc(1, sizeof(*item));
+            item = item_alloc(rend);
             item->type = ITEM_FOG;
             gl_buf_alloc(&item->buf, &FOG_BUF, 256);
             gl_buf_alloc(&item->indices, &INDICES_BUF, 256 * 6);
         }
     } else {
-        item = calloc(1, sizeof(*item));
+        item = item_alloc(rend);
         item->type = ITEM_TEXTURE;
-        gl_buf_alloc(&item->buf, &TEXTURE_BUF, n * n);
+        gl_buf_alloc(&item->buf, g_texture_buf, n * n);
         gl_buf_alloc(&item->indices, &INDICES_BUF, n * n * 6);
     }
 
@@ -598,7 +966,30 @@ static void quad(renderer_t          *rend_,
     vec4_to_float(painter->color, item->color);
     item->flags = painter->flags;
 
-    grid = get_grid(rend, map, grid_size, &should_delete_grid);
+    if (item->type == ITEM_TEXTURE && painter->tex_fallback.tex) {
+        // Single pass fallback blending (see painter_t tex_fallback):
+        // pass the matrix mapping the main texture coordinates to the
+        // fallback ones, padding scales included.
+        double tc[3][3], tf[3][3], inv[3][3], m[3][3];
+        texture_t *ftex = painter->tex_fallback.tex;
+        mat3_copy(painter->textures[PAINTER_TEX_COLOR].mat, tc);
+        mat3_copy(painter->tex_fallback.mat, tf);
+        for (i = 0; i < 3; i++) {
+            tc[i][0] *= (double)tex->w / tex->tex_w;
+            tc[i][1] *= (double)tex->h / tex->tex_h;
+            tf[i][0] *= (double)ftex->w / ftex->tex_w;
+            tf[i][1] *= (double)ftex->h / ftex->tex_h;
+        }
+        if (mat3_invert(tc, inv)) {
+            mat3_mul(tf, inv, m);
+            item->texture.fallback_tex = ftex;
+            ftex->ref++;
+            mat3_to_float(m, item->texture.fallback_mat);
+            item->texture.fallback_blend = painter->tex_fallback.blend;
+        }
+    }
+
+    grid = get_grid(rend, map, grid_size);
     for (i = 0; i < n; i++)
     for (j = 0; j < n; j++) {
         vec3_set(p, (double)j / grid_size, (double)i / grid_size, 1.0);
@@ -611,20 +1002,16 @@ static void quad(renderer_t          *rend_,
         convert_framev4(painter->obs, frame, FRAME_VIEW, p, ndc_p);
         project(painter->proj, 0, ndc_p, ndc_p);
         gl_buf_4f(&item->buf, -1, ATTR_POS, VEC4_SPLIT(ndc_p));
-        // For atmosphere shader, in the first pass we do not compute the
-        // luminance yet, only if the point is visible.
+        // The atmosphere luminance is evaluated per vertex in the
+        // shader, from the skybrightness coefficients uniforms.
         if (painter->flags & PAINTER_ATMOSPHERE_SHADER) {
             gl_buf_3f(&item->buf, -1, ATTR_SKY_POS, VEC3_SPLIT(p));
-            lum = painter->atm.compute_lum(painter->atm.user,
-                    (float[3]){p[0], p[1], p[2]});
-            gl_buf_1f(&item->buf, -1, ATTR_LUMINANCE, lum);
         }
         if (painter->flags & PAINTER_FOG_SHADER) {
             gl_buf_3f(&item->buf, -1, ATTR_SKY_POS, VEC3_SPLIT(p));
         }
         gl_buf_next(&item->buf);
     }
-    if (should_delete_grid) free(grid);
 
     // Set the index buffer.
     for (i = 0; i < grid_size; i++)
@@ -650,16 +1037,15 @@ static void quad_wireframe(renderer_t          *rend_,
     n = grid_size + 1;
     double p[4], ndc_p[4];
     const double (*grid)[4] = NULL;
-    bool should_delete_grid;
 
-    item = calloc(1, sizeof(*item));
+    item = item_alloc(rend);
     item->type = ITEM_QUAD_WIREFRAME;
-    gl_buf_alloc(&item->buf, &TEXTURE_BUF, n * n);
+    gl_buf_alloc(&item->buf, g_texture_buf, n * n);
     gl_buf_alloc(&item->indices, &INDICES_BUF, grid_size * n * 4);
     vec4_to_float(VEC(1, 0, 0, 0.25), item->color);
 
     // Generate grid position.
-    grid = get_grid(rend, map, grid_size, &should_delete_grid);
+    grid = get_grid(rend, map, grid_size);
     for (i = 0; i < n; i++)
     for (j = 0; j < n; j++) {
         gl_buf_2f(&item->buf, -1, ATTR_TEX_POS, 0.5, 0.5);
@@ -669,7 +1055,6 @@ static void quad_wireframe(renderer_t          *rend_,
         gl_buf_4f(&item->buf, -1, ATTR_POS, VEC4_SPLIT(ndc_p));
         gl_buf_next(&item->buf);
     }
-    if (should_delete_grid) free(grid);
 
     /* Set the index buffer.
      * We render a set of horizontal and vertical lines.  */
@@ -703,10 +1088,10 @@ static void texture2(renderer_gl_t *rend, texture_t *tex,
     if (item && memcmp(item->color, color, sizeof(color))) item = NULL;
 
     if (!item) {
-        item = calloc(1, sizeof(*item));
+        item = item_alloc(rend);
         item->type = ITEM_TEXTURE;
         item->flags = flags;
-        gl_buf_alloc(&item->buf, &TEXTURE_BUF, 64 * 4);
+        gl_buf_alloc(&item->buf, g_texture_buf, 64 * 4);
         gl_buf_alloc(&item->indices, &INDICES_BUF, 64 * 6);
         item->tex = tex;
         item->tex->ref++;
@@ -755,6 +1140,205 @@ static void texture(renderer_t *rend_,
 }
 
 // Render text using a system bakend generated texture.
+/*
+ * Rasterize a label with nanovg into an offscreen framebuffer.  Same
+ * contract as sys_render_text: return a one byte per pixel image
+ * allocated with malloc.  Used as fallback when the client doesn't
+ * provide a render_text callback, so that those labels can use the
+ * texture cache too instead of going through nanovg every frame.
+ */
+static uint8_t *render_text_nvg(renderer_gl_t *rend, const char *text,
+                                double size, int effects,
+                                int *w, int *h, int *xoff, int *yoff)
+{
+    char buf[256];
+    float fbounds[4];
+    int x, y, font = (effects & TEXT_BOLD) ? FONT_BOLD : FONT_REGULAR;
+    uint8_t *rgba, *img;
+    GLuint fbo, tex_id;
+    GLint prev_fbo;
+
+    if (effects & (TEXT_UPPERCASE | TEXT_SMALL_CAP))
+        u8_upper(buf, text, sizeof(buf) - 1);
+    else
+        snprintf(buf, sizeof(buf), "%s", text);
+
+    nvgSave(rend->vg);
+    nvgFontFaceId(rend->vg, rend->fonts[font].id);
+    nvgFontSize(rend->vg, size * rend->fonts[font].scale);
+    nvgTextAlign(rend->vg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    nvgTextBounds(rend->vg, 0, 0, buf, NULL, fbounds);
+    nvgRestore(rend->vg);
+
+    // One pixel of padding on all sides.
+    *w = (int)ceil(fbounds[2] - fbounds[0]) + 2;
+    *h = (int)ceil(fbounds[3] - fbounds[1]) + 2;
+    *xoff = 0;
+    *yoff = 0;
+
+    GL(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prev_fbo));
+    GL(glGenTextures(1, &tex_id));
+    GL(glActiveTexture(GL_TEXTURE0));
+    GL(glBindTexture(GL_TEXTURE_2D, tex_id));
+    GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, *w, *h, 0, GL_RGBA,
+                    GL_UNSIGNED_BYTE, NULL));
+    GL(glGenFramebuffers(1, &fbo));
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, fbo));
+    GL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_TEXTURE_2D, tex_id, 0));
+    GL(glViewport(0, 0, *w, *h));
+    GL(glClearColor(0, 0, 0, 0));
+    GL(glClear(GL_COLOR_BUFFER_BIT));
+
+    nvgBeginFrame(rend->vg, *w, *h, 1);
+    nvgFontFaceId(rend->vg, rend->fonts[font].id);
+    nvgFontSize(rend->vg, size * rend->fonts[font].scale);
+    nvgTextAlign(rend->vg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    nvgFillColor(rend->vg, nvgRGBA(255, 255, 255, 255));
+    nvgText(rend->vg, 1 - fbounds[0], 1 - fbounds[1], buf, NULL);
+    nvgEndFrame(rend->vg);
+
+    rgba = malloc(*w * *h * 4);
+    GL(glReadPixels(0, 0, *w, *h, GL_RGBA, GL_UNSIGNED_BYTE, rgba));
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo));
+    GL(glDeleteFramebuffers(1, &fbo));
+    GL(glDeleteTextures(1, &tex_id));
+
+    // Keep the alpha channel, flipping the rows since glReadPixels
+    // returns the image bottom up.
+    img = malloc(*w * *h);
+    for (y = 0; y < *h; y++)
+        for (x = 0; x < *w; x++)
+            img[y * *w + x] = rgba[((*h - 1 - y) * *w + x) * 4 + 3];
+    free(rgba);
+    return img;
+}
+
+/*
+ * Measurement half of render_text_nvg: returns the same metrics, without
+ * rasterizing anything.  Used by the measurement fast path so that strings
+ * that are only laid out (e.g. rejected by the label collision tests) never
+ * enter the texture cache.
+ */
+static void measure_text_nvg(renderer_gl_t *rend, const char *text,
+                             double size, int effects,
+                             int *w, int *h, int *xoff, int *yoff)
+{
+    char buf[256];
+    float fbounds[4];
+    int font = (effects & TEXT_BOLD) ? FONT_BOLD : FONT_REGULAR;
+
+    if (effects & (TEXT_UPPERCASE | TEXT_SMALL_CAP))
+        u8_upper(buf, text, sizeof(buf) - 1);
+    else
+        snprintf(buf, sizeof(buf), "%s", text);
+
+    nvgSave(rend->vg);
+    nvgFontFaceId(rend->vg, rend->fonts[font].id);
+    nvgFontSize(rend->vg, size * rend->fonts[font].scale);
+    nvgTextAlign(rend->vg, NVG_ALIGN_LEFT | NVG_ALIGN_TOP);
+    nvgTextBounds(rend->vg, 0, 0, buf, NULL, fbounds);
+    nvgRestore(rend->vg);
+
+    // One pixel of padding on all sides, like render_text_nvg.
+    *w = (int)ceil(fbounds[2] - fbounds[0]) + 2;
+    *h = (int)ceil(fbounds[3] - fbounds[1]) + 2;
+    *xoff = 0;
+    *yoff = 0;
+}
+
+static void text_metrics_key(char *key, int len, const char *text,
+                             double size, int effects)
+{
+    snprintf(key, len, "%d:%.2f:%s", effects, size, text);
+}
+
+/*
+ * Look up the cached metrics of a shaped string.  Entries measured with an
+ * older font generation are dropped and reported as misses.
+ */
+static bool text_metrics_get(renderer_gl_t *rend, const char *text,
+                             double size, int effects,
+                             int *w, int *h, int *xoff, int *yoff)
+{
+    char key[320];
+    text_metrics_t *m;
+
+    text_metrics_key(key, sizeof(key), text, size, effects);
+    HASH_FIND_STR(rend->metrics_cache, key, m);
+    if (m && m->font_gen != rend->font_gen) {
+        HASH_DEL(rend->metrics_cache, m);
+        free(m->key);
+        free(m);
+        m = NULL;
+    }
+    if (!m) return false;
+    *w = m->w;
+    *h = m->h;
+    *xoff = m->xoff;
+    *yoff = m->yoff;
+    return true;
+}
+
+// Entries are a few tens of bytes and only created for strings actually
+// laid out, so the cache is not size capped.
+static void text_metrics_add(renderer_gl_t *rend, const char *text,
+                             double size, int effects,
+                             int w, int h, int xoff, int yoff)
+{
+    char key[320];
+    text_metrics_t *m;
+
+    text_metrics_key(key, sizeof(key), text, size, effects);
+    HASH_FIND_STR(rend->metrics_cache, key, m);
+    if (!m) {
+        m = calloc(1, sizeof(*m));
+        m->key = strdup(key);
+        HASH_ADD_KEYPTR(hh, rend->metrics_cache, m->key, strlen(m->key), m);
+    }
+    m->font_gen = rend->font_gen;
+    m->w = w;
+    m->h = h;
+    m->xoff = xoff;
+    m->yoff = yoff;
+}
+
+/*
+ * Compute the on screen bounds of a label of texture size (w, h), taking
+ * the alignment into account.  w, h, xoff and yoff are in device pixels,
+ * as returned by the text rasterizers.  Also returns the alignment offset
+ * (ofs), needed by the rendering path to rotate around the anchor point.
+ */
+static void text_compute_bounds(const renderer_gl_t *rend, int w, int h,
+                                int xoff, int yoff, const double pos[2],
+                                int align, double angle,
+                                double bounds[4], double ofs[2])
+{
+    double s[2];
+    const double scale = rend->scale;
+
+    ofs[0] = ofs[1] = 0;
+    s[0] = w / scale;
+    s[1] = h / scale;
+    if (align & ALIGN_LEFT)     ofs[0] = +s[0] / 2;
+    if (align & ALIGN_RIGHT)    ofs[0] = -s[0] / 2;
+    if (align & ALIGN_TOP)      ofs[1] = +s[1] / 2;
+    if (align & ALIGN_BOTTOM)   ofs[1] = -s[1] / 2;
+    bounds[0] = pos[0] - s[0] / 2 + ofs[0] + xoff / scale;
+    bounds[1] = pos[1] - s[1] / 2 + ofs[1] + yoff / scale;
+
+    // Round the position to the nearest pixel.  We add a small delta to
+    // fix a bug when we are exactly in between two pixels, which can happen
+    // for example with the label of a centered object.
+    if (!angle) bounds[0] = round(bounds[0] * scale + 0.000001) / scale;
+    if (!angle) bounds[1] = round(bounds[1] * scale + 0.000001) / scale;
+
+    bounds[2] = bounds[0] + s[0];
+    bounds[3] = bounds[1] + s[1];
+}
+
 static void text_using_texture(renderer_gl_t *rend,
                                const char *text, const double pos[2],
                                int align, int effects, double size,
@@ -762,7 +1346,7 @@ static void text_using_texture(renderer_gl_t *rend,
                                double out_bounds[4])
 {
     double uv[4][2], verts[4][2];
-    double s[2], ofs[2] = {0, 0}, bounds[4];
+    double ofs[2], bounds[4];
     const double scale = rend->scale;
     uint8_t *img;
     int i, w, h, xoff, yoff;
@@ -775,39 +1359,37 @@ static void text_using_texture(renderer_gl_t *rend,
     }
 
     if (!ctex) {
-        img = (void*)sys_render_text(text, size * scale, effects, &w, &h,
-                                     &xoff, &yoff);
+        if (sys_callbacks.render_text)
+            img = (void*)sys_render_text(text, size * scale, effects, &w, &h,
+                                         &xoff, &yoff);
+        else
+            img = render_text_nvg(rend, text, size * scale, effects, &w, &h,
+                                  &xoff, &yoff);
         ctex = calloc(1, sizeof(*ctex));
         ctex->size = size;
         ctex->effects = effects;
+        ctex->font_gen = rend->font_gen;
         ctex->xoff = xoff;
         ctex->yoff = yoff;
         ctex->text = strdup(text);
         ctex->tex = texture_from_data(img, w, h, 1, 0, 0, w, h, 0);
         free(img);
-        DL_APPEND(rend->tex_cache, ctex);
+    } else {
+        DL_DELETE(rend->tex_cache, ctex);
     }
+    // Keep the list in least recently used order.
+    DL_APPEND(rend->tex_cache, ctex);
 
     ctex->in_use = true;
 
-    // Compute bounds taking alignment into account.
-    s[0] = ctex->tex->w / scale;
-    s[1] = ctex->tex->h / scale;
-    if (align & ALIGN_LEFT)     ofs[0] = +s[0] / 2;
-    if (align & ALIGN_RIGHT)    ofs[0] = -s[0] / 2;
-    if (align & ALIGN_TOP)      ofs[1] = +s[1] / 2;
-    if (align & ALIGN_BOTTOM)   ofs[1] = -s[1] / 2;
-    bounds[0] = pos[0] - s[0] / 2 + ofs[0] + ctex->xoff / scale;
-    bounds[1] = pos[1] - s[1] / 2 + ofs[1] + ctex->yoff / scale;
+    // Feed the metrics cache so that the next measurement of this string
+    // is a hash lookup.
+    text_metrics_add(rend, text, size, effects, ctex->tex->w, ctex->tex->h,
+                     ctex->xoff, ctex->yoff);
 
-    // Round the position to the nearest pixel.  We add a small delta to
-    // fix a bug when we are exactly in between two pixels, which can happen
-    // for example with the label of a centered object.
-    if (!angle) bounds[0] = round(bounds[0] * scale + 0.000001) / scale;
-    if (!angle) bounds[1] = round(bounds[1] * scale + 0.000001) / scale;
-
-    bounds[2] = bounds[0] + s[0];
-    bounds[3] = bounds[1] + s[1];
+    text_compute_bounds(rend, ctex->tex->w, ctex->tex->h,
+                        ctex->xoff, ctex->yoff, pos, align, angle,
+                        bounds, ofs);
 
     if (out_bounds) {
         memcpy(out_bounds, bounds, sizeof(bounds));
@@ -839,91 +1421,93 @@ static void text_using_texture(renderer_gl_t *rend,
              rend->cull_flipped);
 }
 
-// Render text using nanovg.
-static void text_using_nanovg(renderer_gl_t *rend, const char *text,
-                              const double pos[2], int align, int effects,
-                              double size, const double color[4], double angle,
-                              double bounds[4])
-{
-    item_t *item;
-    float fbounds[4];
-    int font = (effects & TEXT_BOLD) ? FONT_BOLD : FONT_REGULAR;
-
-    if (strlen(text) >= sizeof(item->text.text)) {
-        LOG_W("Text too large: %s", text);
-        return;
-    }
-
-    if (!bounds) {
-        item = calloc(1, sizeof(*item));
-        item->type = ITEM_TEXT;
-        vec4_to_float(color, item->color);
-        item->color[0] = clamp(item->color[0], 0.0, 1.0);
-        item->color[1] = clamp(item->color[1], 0.0, 1.0);
-        item->color[2] = clamp(item->color[2], 0.0, 1.0);
-        item->color[3] = clamp(item->color[3], 0.0, 1.0);
-        vec2_to_float(pos, item->text.pos);
-        item->text.size = size;
-        item->text.align = align;
-        item->text.effects = effects;
-        item->text.angle = angle;
-        if (effects & TEXT_UPPERCASE || effects & TEXT_SMALL_CAP) {
-            // Emulate Small Cap effect by doing regular capitalize
-            u8_upper(item->text.text, text, sizeof(item->text.text) - 1);
-        } else {
-            strcpy(item->text.text, text);
-        }
-        DL_APPEND(rend->items, item);
-    }
-    if (bounds) {
-        nvgSave(rend->vg);
-        nvgFontFaceId(rend->vg, rend->fonts[font].id);
-        nvgFontSize(rend->vg, size * rend->fonts[font].scale);
-        nvgTextAlign(rend->vg, align);
-        nvgTextBounds(rend->vg, pos[0], pos[1], text, NULL, fbounds);
-        bounds[0] = fbounds[0];
-        bounds[1] = fbounds[1];
-        bounds[2] = fbounds[2];
-        bounds[3] = fbounds[3];
-        nvgRestore(rend->vg);
-    }
-}
-
 static void text(renderer_t *rend_, const char *text, const double pos[2],
                  int align, int effects, double size, const double color[4],
                  double angle, double bounds[4])
 {
     assert(pos);
     renderer_gl_t *rend = (void*)rend_;
+    int w, h, xoff, yoff;
+    double ofs[2];
     assert(size);
 
-    if (sys_callbacks.render_text) {
-        text_using_texture(rend, text, pos, align, effects, size, color, angle,
-                           bounds);
-    } else {
-        text_using_nanovg(rend, text, pos, align, effects, size, color, angle,
-                          bounds);
+    // Measurement only queries (label layout and its collision tests) are
+    // served from the metrics cache: a hash lookup instead of a scan of
+    // the texture cache, and a miss only shapes the string with nanovg,
+    // without rasterizing it.
+    if (bounds && !color) {
+        if (!text_metrics_get(rend, text, size, effects,
+                              &w, &h, &xoff, &yoff)) {
+            if (sys_callbacks.render_text) {
+                // The client rasterizer doesn't expose a measure-only
+                // entry point, so go through the texture cache; this
+                // populates the metrics cache as a side effect.
+                text_using_texture(rend, text, pos, align, effects, size,
+                                   color, angle, bounds);
+                return;
+            }
+            measure_text_nvg(rend, text, size * rend->scale, effects,
+                             &w, &h, &xoff, &yoff);
+            text_metrics_add(rend, text, size, effects, w, h, xoff, yoff);
+        }
+        text_compute_bounds(rend, w, h, xoff, yoff, pos, align, angle,
+                            bounds, ofs);
+        return;
     }
 
+    // Always go through the label texture cache: labels whose text,
+    // size and effects don't change (constellations, star names...)
+    // render once and afterwards only cost a textured quad.
+    text_using_texture(rend, text, pos, align, effects, size, color, angle,
+                       bounds);
+}
+
+/*
+ * Return a persistent VBO with the vertex data of a points item uploaded.
+ * If the same data was already uploaded in a previous frame (static view),
+ * the buffer is reused as-is and no upload occurs.
+ */
+static GLuint points_get_vbo(renderer_gl_t *rend, const item_t *item)
+{
+    int i, best = 0;
+    const int size = item->buf.nb * item->buf.info->size;
+    uint32_t hash;
+    typeof(&rend->points_vbos[0]) entry;
+
+    hash = crc32(item->buf.nb, item->buf.data, size);
+    for (i = 0; i < ARRAY_SIZE(rend->points_vbos); i++) {
+        entry = &rend->points_vbos[i];
+        if (entry->vbo && entry->hash == hash && entry->nb == item->buf.nb) {
+            entry->frame = rend->frame_count;
+            return entry->vbo;
+        }
+        if (entry->frame < rend->points_vbos[best].frame) best = i;
+    }
+    // Not found: upload into the least recently used entry.
+    entry = &rend->points_vbos[best];
+    if (!entry->vbo) GL(glGenBuffers(1, &entry->vbo));
+    entry->hash = hash;
+    entry->nb = item->buf.nb;
+    entry->frame = rend->frame_count;
+    GL(glBindBuffer(GL_ARRAY_BUFFER, entry->vbo));
+    GL(glBufferData(GL_ARRAY_BUFFER, size, item->buf.data, GL_DYNAMIC_DRAW));
+    return entry->vbo;
 }
 
 static void item_points_render(renderer_gl_t *rend, const item_t *item)
 {
     gl_shader_t *shader;
-    GLuint  array_buffer;
     double core_size;
 
     shader = shader_get("points", NULL, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
-    GL(glEnable(GL_BLEND));
-    GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE));
-    GL(glDisable(GL_DEPTH_TEST));
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
+    gl_state_enable(GL_DEPTH_TEST, false);
 
-    GL(glGenBuffers(1, &array_buffer));
-    GL(glBindBuffer(GL_ARRAY_BUFFER, array_buffer));
-    GL(glBufferData(GL_ARRAY_BUFFER, item->buf.nb * item->buf.info->size,
-                    item->buf.data, GL_DYNAMIC_DRAW));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, points_get_vbo(rend, item)));
 
     gl_update_uniform(shader, "u_color", item->color);
     core_size = 1.0 / item->points.halo;
@@ -932,52 +1516,50 @@ static void item_points_render(renderer_gl_t *rend, const item_t *item)
     gl_buf_enable(&item->buf);
     GL(glDrawArrays(GL_POINTS, 0, item->buf.nb));
     gl_buf_disable(&item->buf);
-
-    GL(glDeleteBuffers(1, &array_buffer));
 }
 
-static void draw_buffer(const gl_buf_t *buf, const gl_buf_t *indices,
-                        GLuint gl_mode)
+static void draw_buffer(renderer_gl_t *rend, const gl_buf_t *buf,
+                        const gl_buf_t *indices, GLuint gl_mode)
 {
-    GLuint  array_buffer;
-    GLuint  index_buffer;
+    typeof(&rend->vbo_ring[0]) slot;
 
-    GL(glGenBuffers(1, &index_buffer));
-    GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer));
+    slot = &rend->vbo_ring[rend->vbo_ring_pos];
+    rend->vbo_ring_pos = (rend->vbo_ring_pos + 1) % ARRAY_SIZE(rend->vbo_ring);
+    if (!slot->vbo) {
+        GL(glGenBuffers(1, &slot->vbo));
+        GL(glGenBuffers(1, &slot->ibo));
+    }
+
+    GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, slot->ibo));
     GL(glBufferData(GL_ELEMENT_ARRAY_BUFFER,
                     indices->nb * indices->info->size,
-                    indices->data, GL_DYNAMIC_DRAW));
+                    indices->data, GL_STREAM_DRAW));
 
-    GL(glGenBuffers(1, &array_buffer));
-    GL(glBindBuffer(GL_ARRAY_BUFFER, array_buffer));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, slot->vbo));
     GL(glBufferData(GL_ARRAY_BUFFER, buf->nb * buf->info->size,
-                    buf->data, GL_DYNAMIC_DRAW));
+                    buf->data, GL_STREAM_DRAW));
 
     gl_buf_enable(buf);
     GL(glDrawElements(gl_mode, indices->nb, GL_UNSIGNED_SHORT, 0));
     gl_buf_disable(buf);
-
-    GL(glDeleteBuffers(1, &array_buffer));
-    GL(glDeleteBuffers(1, &index_buffer));
 }
 
 static void item_lines_render(renderer_gl_t *rend, const item_t *item)
 {
     gl_shader_t *shader;
     shader = shader_get("blit", NULL, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
     GL(glLineWidth(item->lines.width * rend->scale));
 
-    GL(glActiveTexture(GL_TEXTURE0));
-    GL(glBindTexture(GL_TEXTURE_2D, rend->white_tex->id));
+    gl_state_bind_texture(0, rend->white_tex->id);
 
-    GL(glEnable(GL_BLEND));
-    GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                           GL_ZERO, GL_ONE));
-    GL(glDisable(GL_DEPTH_TEST));
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+    gl_state_enable(GL_DEPTH_TEST, false);
 
-    draw_buffer(&item->buf, &item->indices, GL_LINES);
+    draw_buffer(rend, &item->buf, &item->indices, GL_LINES);
 }
 
 static void item_mesh_render(renderer_gl_t *rend, const item_t *item)
@@ -995,29 +1577,54 @@ static void item_mesh_render(renderer_gl_t *rend, const item_t *item)
         {}
     };
     shader = shader_get("mesh", defines, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
     GL(glLineWidth(item->mesh.stroke_width));
 
     // For the moment we disable culling for mesh.  We should reintroduce it
     // by making sure we use the proper value depending on the render
     // culling and frame.
-    GL(glDisable(GL_CULL_FACE));
-    GL(glDisable(GL_DEPTH_TEST));
+    gl_state_enable(GL_CULL_FACE, false);
+    gl_state_enable(GL_DEPTH_TEST, false);
 
     if (item->color[3] == 1) {
-        GL(glDisable(GL_BLEND));
+        gl_state_enable(GL_BLEND, false);
     } else {
-        GL(glEnable(GL_BLEND));
-        GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                               GL_ZERO, GL_ONE));
+        gl_state_enable(GL_BLEND, true);
+        gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
+                            GL_ZERO, GL_ONE);
     }
 
     gl_update_uniform(shader, "u_color", item->color);
     gl_update_uniform(shader, "u_fbo_size", fbo_size);
     gl_update_uniform(shader, "u_proj_scaling", item->mesh.proj_scaling);
 
-    draw_buffer(&item->buf, &item->indices, gl_mode);
+    if (item->mesh.vbo) {
+        mesh_vbo_t *vbo = item->mesh.vbo;
+        const gl_buf_t layout = {.info = &MESH_BUF};
+        if (!vbo->vbo) {
+            GL(glGenBuffers(1, &vbo->vbo));
+            GL(glGenBuffers(1, &vbo->ibo));
+        }
+        GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo->ibo));
+        GL(glBindBuffer(GL_ARRAY_BUFFER, vbo->vbo));
+        if (item->buf.nb) { // Rebuilt this frame: upload.
+            GL(glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                            item->indices.nb * item->indices.info->size,
+                            item->indices.data, GL_DYNAMIC_DRAW));
+            GL(glBufferData(GL_ARRAY_BUFFER,
+                            item->buf.nb * item->buf.info->size,
+                            item->buf.data, GL_DYNAMIC_DRAW));
+            vbo->nb_indices = item->indices.nb;
+        }
+        gl_buf_enable(&layout);
+        GL(glDrawElements(gl_mode, vbo->nb_indices, GL_UNSIGNED_SHORT, 0));
+        gl_buf_disable(&layout);
+        return;
+    }
+
+    draw_buffer(rend, &item->buf, &item->indices, gl_mode);
 }
 
 // XXX: almost the same as item_mesh_render!
@@ -1036,13 +1643,13 @@ static void item_lines_glow_render(renderer_gl_t *rend, const item_t *item)
         {}
     };
     shader = shader_get("lines", defines, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
-    GL(glEnable(GL_BLEND));
-    GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                           GL_ZERO, GL_ONE));
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
     if (use_depth)
-        GL(glEnable(GL_DEPTH_TEST));
+        gl_state_enable(GL_DEPTH_TEST, true);
 
     gl_update_uniform(shader, "u_line_width", item->lines.width);
     gl_update_uniform(shader, "u_line_glow", item->lines.glow);
@@ -1058,43 +1665,48 @@ static void item_lines_glow_render(renderer_gl_t *rend, const item_t *item)
         gl_update_uniform(shader, "u_fade_dist_max", item->lines.fade_dist_max);
     }
 
-    draw_buffer(&item->buf, &item->indices, GL_TRIANGLES);
-    GL(glDisable(GL_DEPTH_TEST));
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
+    gl_state_enable(GL_DEPTH_TEST, false);
+}
+
+/*
+ * Render the ellipse and rect items with a small signed distance field
+ * shader instead of nanovg: each nvgBeginFrame/nvgEndFrame pair flushes
+ * the gl pipeline, which gets expensive when the sky is full of DSO
+ * hint circles.  The shapes of an item are batched in a single buffer,
+ * with the size, stroke width and dash count passed per vertex.
+ */
+static void item_vg_sdf_render(renderer_gl_t *rend, const item_t *item)
+{
+    gl_shader_t *shader;
+    float win_size[2] = {rend->fb_size[0] / rend->scale,
+                         rend->fb_size[1] / rend->scale};
+    shader_define_t defines[] = {
+        {"RECT", item->type == ITEM_VG_RECT},
+        {}
+    };
+    shader = shader_get("vg", defines, ATTR_NAMES, init_shader);
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
+
+    gl_state_enable(GL_DEPTH_TEST, false);
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+    gl_update_uniform(shader, "u_win_size", win_size);
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
 }
 
 static void item_vg_render(renderer_gl_t *rend, const item_t *item)
 {
-    double a, da;
+    assert(item->type == ITEM_VG_LINE);
     nvgBeginFrame(rend->vg, rend->fb_size[0] / rend->scale,
                             rend->fb_size[1] / rend->scale, rend->scale);
     nvgSave(rend->vg);
     nvgTranslate(rend->vg, item->vg.pos[0], item->vg.pos[1]);
-    nvgRotate(rend->vg, item->vg.angle);
     nvgBeginPath(rend->vg);
-
-    if (item->type == ITEM_VG_ELLIPSE && !item->vg.dashes)
-        nvgEllipse(rend->vg, 0, 0, item->vg.size[0], item->vg.size[1]);
-
-    if (item->type == ITEM_VG_ELLIPSE && item->vg.dashes) {
-        da = 2 * M_PI / item->vg.dashes;
-        for (a = 0; a < 2 * M_PI; a += da) {
-            nvgMoveTo(rend->vg, item->vg.size[0] * cos(a),
-                                item->vg.size[1] * sin(a));
-            nvgLineTo(rend->vg, item->vg.size[0] * cos(a + da / 2),
-                                item->vg.size[1] * sin(a + da / 2));
-        }
-    }
-
-    if (item->type == ITEM_VG_RECT)
-        nvgRect(rend->vg, -item->vg.size[0], -item->vg.size[1],
-                2 * item->vg.size[0], 2 * item->vg.size[1]);
-
-    if (item->type == ITEM_VG_LINE) {
-        nvgMoveTo(rend->vg, 0, 0);
-        nvgLineTo(rend->vg, item->vg.pos2[0] - item->vg.pos[0],
-                            item->vg.pos2[1] - item->vg.pos[1]);
-    }
-
+    nvgMoveTo(rend->vg, 0, 0);
+    nvgLineTo(rend->vg, item->vg.pos2[0] - item->vg.pos[0],
+                        item->vg.pos2[1] - item->vg.pos[1]);
     nvgStrokeColor(rend->vg, nvgRGBA(item->color[0] * 255,
                                      item->color[1] * 255,
                                      item->color[2] * 255,
@@ -1103,6 +1715,7 @@ static void item_vg_render(renderer_gl_t *rend, const item_t *item)
     nvgStroke(rend->vg);
     nvgRestore(rend->vg);
     nvgEndFrame(rend->vg);
+    gl_state_reset(); // Nanovg touched the state directly.
 }
 
 static void item_text_render(renderer_gl_t *rend, const item_t *item)
@@ -1147,21 +1760,22 @@ static void item_text_render(renderer_gl_t *rend, const item_t *item)
 
     nvgRestore(rend->vg);
     nvgEndFrame(rend->vg);
+    gl_state_reset(); // Nanovg touched the state directly.
 }
 
 static void item_fog_render(renderer_gl_t *rend, const item_t *item)
 {
     gl_shader_t *shader;
     shader = shader_get("fog", NULL, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
-    GL(glEnable(GL_CULL_FACE));
-    GL(glCullFace(rend->cull_flipped ? GL_FRONT : GL_BACK));
-    GL(glEnable(GL_BLEND));
-    GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                           GL_ZERO, GL_ONE));
-    GL(glDisable(GL_DEPTH_TEST));
-    draw_buffer(&item->buf, &item->indices, GL_TRIANGLES);
-    GL(glCullFace(GL_BACK));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
+    gl_state_enable(GL_CULL_FACE, true);
+    gl_state_cull_face(rend->cull_flipped ? GL_FRONT : GL_BACK);
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+    gl_state_enable(GL_DEPTH_TEST, false);
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
+    gl_state_cull_face(GL_BACK);
 }
 
 static void item_atmosphere_render(renderer_gl_t *rend, const item_t *item)
@@ -1170,18 +1784,19 @@ static void item_atmosphere_render(renderer_gl_t *rend, const item_t *item)
     float tm[3];
 
     shader = shader_get("atmosphere", NULL, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
-    GL(glActiveTexture(GL_TEXTURE0));
-    GL(glBindTexture(GL_TEXTURE_2D, item->tex->id));
-    GL(glEnable(GL_CULL_FACE));
-    GL(glCullFace(rend->cull_flipped ? GL_FRONT : GL_BACK));
+    gl_state_bind_texture(0, item->tex->id);
+    gl_state_enable(GL_CULL_FACE, true);
+    gl_state_cull_face(rend->cull_flipped ? GL_FRONT : GL_BACK);
 
-    GL(glEnable(GL_BLEND));
+    gl_state_enable(GL_BLEND, true);
     if (color_is_white(item->color)) {
-        GL(glBlendFunc(GL_ONE, GL_ONE));
+        gl_state_blend_func(GL_ONE, GL_ONE, GL_ONE, GL_ONE);
     } else {
-        GL(glBlendFunc(GL_CONSTANT_COLOR, GL_ONE));
+        gl_state_blend_func(GL_CONSTANT_COLOR, GL_ONE,
+                            GL_CONSTANT_COLOR, GL_ONE);
         GL(glBlendColor(item->color[0] * item->color[3],
                         item->color[1] * item->color[3],
                         item->color[2] * item->color[3],
@@ -1191,13 +1806,15 @@ static void item_atmosphere_render(renderer_gl_t *rend, const item_t *item)
     gl_update_uniform(shader, "u_color", item->color);
     gl_update_uniform(shader, "u_atm_p", item->atm.p);
     gl_update_uniform(shader, "u_sun", item->atm.sun);
+    gl_update_uniform(shader, "u_moon", item->atm.moon);
+    gl_update_uniform(shader, "u_sb", item->atm.sb);
     // XXX: the tonemapping args should be copied before rendering!
     tm[0] = core->tonemapper.p;
     tm[1] = core->tonemapper.lwmax;
     tm[2] = core->tonemapper.exposure;
     gl_update_uniform(shader, "u_tm", tm);
-    draw_buffer(&item->buf, &item->indices, GL_TRIANGLES);
-    GL(glCullFace(GL_BACK));
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
+    gl_state_cull_face(GL_BACK);
 }
 
 static void item_texture_render(renderer_gl_t *rend, const item_t *item)
@@ -1207,32 +1824,43 @@ static void item_texture_render(renderer_gl_t *rend, const item_t *item)
     shader_define_t defines[] = {
         {"TEXTURE_LUMINANCE", item->tex->format == GL_LUMINANCE &&
                               !(item->flags & PAINTER_ADD)},
+        {"TEX_FALLBACK", item->texture.fallback_tex != NULL},
         {}
     };
     shader = shader_get("blit", defines, ATTR_NAMES, init_shader);
 
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
-    GL(glActiveTexture(GL_TEXTURE0));
-    GL(glBindTexture(GL_TEXTURE_2D, item->tex->id));
-    GL(glEnable(GL_CULL_FACE));
-    GL(glCullFace(rend->cull_flipped ? GL_FRONT : GL_BACK));
+    gl_state_bind_texture(0, item->tex->id);
+
+    if (item->texture.fallback_tex) {
+        gl_state_bind_texture(1, item->texture.fallback_tex->id);
+        gl_update_uniform(shader, "u_fallback_tex", 1);
+        gl_update_uniform(shader, "u_fallback_mat",
+                          item->texture.fallback_mat);
+        gl_update_uniform(shader, "u_fallback_blend",
+                          (double)item->texture.fallback_blend);
+    }
+    gl_state_enable(GL_CULL_FACE, true);
+    gl_state_cull_face(rend->cull_flipped ? GL_FRONT : GL_BACK);
 
     if (item->tex->format == GL_RGB && item->color[3] == 1.0) {
-        GL(glDisable(GL_BLEND));
+        gl_state_enable(GL_BLEND, false);
     } else {
-        GL(glEnable(GL_BLEND));
-        GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                               GL_ZERO, GL_ONE));
+        gl_state_enable(GL_BLEND, true);
+        gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
+                            GL_ZERO, GL_ONE);
     }
-    GL(glDisable(GL_DEPTH_TEST));
+    gl_state_enable(GL_DEPTH_TEST, false);
 
     if (item->flags & PAINTER_ADD) {
-        GL(glEnable(GL_BLEND));
+        gl_state_enable(GL_BLEND, true);
         if (color_is_white(item->color))
-            GL(glBlendFunc(GL_ONE, GL_ONE));
+            gl_state_blend_func(GL_ONE, GL_ONE, GL_ONE, GL_ONE);
         else {
-            GL(glBlendFunc(GL_CONSTANT_COLOR, GL_ONE));
+            gl_state_blend_func(GL_CONSTANT_COLOR, GL_ONE,
+                                GL_CONSTANT_COLOR, GL_ONE);
             GL(glBlendColor(item->color[0] * item->color[3],
                             item->color[1] * item->color[3],
                             item->color[2] * item->color[3],
@@ -1241,8 +1869,8 @@ static void item_texture_render(renderer_gl_t *rend, const item_t *item)
     }
 
     gl_update_uniform(shader, "u_color", item->color);
-    draw_buffer(&item->buf, &item->indices, GL_TRIANGLES);
-    GL(glCullFace(GL_BACK));
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
+    gl_state_cull_face(GL_BACK);
 }
 
 static void item_quad_wireframe_render(renderer_gl_t *rend, const item_t *item)
@@ -1250,67 +1878,74 @@ static void item_quad_wireframe_render(renderer_gl_t *rend, const item_t *item)
     gl_shader_t *shader;
 
     shader = shader_get("blit", NULL, ATTR_NAMES, init_shader);
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
     gl_update_uniform(shader, "u_color", item->color);
-    GL(glActiveTexture(GL_TEXTURE0));
-    GL(glBindTexture(GL_TEXTURE_2D, rend->white_tex->id));
-    GL(glDisable(GL_DEPTH_TEST));
-    GL(glEnable(GL_BLEND));
-    GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                           GL_ZERO, GL_ONE));
+    gl_state_bind_texture(0, rend->white_tex->id);
+    gl_state_enable(GL_DEPTH_TEST, false);
+    gl_state_enable(GL_BLEND, true);
+    gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
 
-    draw_buffer(&item->buf, &item->indices, GL_LINES);
+    draw_buffer(rend, &item->buf, &item->indices, GL_LINES);
 }
 
 static void item_planet_render(renderer_gl_t *rend, const item_t *item)
 {
     gl_shader_t *shader;
-    bool is_moon;
+    bool is_moon, created, shadow_color_ready = false;
+    texture_t *shadow_color_tex = item->planet.shadow_color_tex;
     const float depth_range[] = {rend->depth_range[0], rend->depth_range[1]};
     shader_define_t defines[] = {
         {"HAS_SHADOW", item->planet.shadow_spheres_nb > 0},
         {}
     };
+
+    /* Load the shadow color texture before any tracked call: a first
+     * load uploads the pixels with direct GL binds, which invalidates
+     * the shadow state. */
+    if (shadow_color_tex) {
+        created = shadow_color_tex->id && !shadow_color_tex->loader;
+        shadow_color_ready = texture_load(shadow_color_tex, NULL);
+        if (!created) gl_state_reset();
+    }
+
     shader = shader_get("planet", defines, ATTR_NAMES, init_shader);
 
-    GL(glUseProgram(shader->prog));
+    gl_state_use_program(shader->prog);
+    gl_update_uniform(shader, "u_color_fx", rend->color_fx);
 
-    GL(glActiveTexture(GL_TEXTURE0));
-    GL(glBindTexture(GL_TEXTURE_2D, item->tex->id));
+    gl_state_bind_texture(0, item->tex->id);
 
-    GL(glActiveTexture(GL_TEXTURE1));
     if (item->planet.normalmap) {
-        GL(glBindTexture(GL_TEXTURE_2D, item->planet.normalmap->id));
+        gl_state_bind_texture(1, item->planet.normalmap->id);
         gl_update_uniform(shader, "u_has_normal_tex", 1);
     } else {
-        GL(glBindTexture(GL_TEXTURE_2D, rend->white_tex->id));
+        gl_state_bind_texture(1, rend->white_tex->id);
         gl_update_uniform(shader, "u_has_normal_tex", 0);
     }
 
-    GL(glActiveTexture(GL_TEXTURE2));
-    if (item->planet.shadow_color_tex &&
-            texture_load(item->planet.shadow_color_tex, NULL))
-        GL(glBindTexture(GL_TEXTURE_2D, item->planet.shadow_color_tex->id));
+    if (shadow_color_ready)
+        gl_state_bind_texture(2, shadow_color_tex->id);
     else
-        GL(glBindTexture(GL_TEXTURE_2D, rend->white_tex->id));
+        gl_state_bind_texture(2, rend->white_tex->id);
 
     if (item->flags & PAINTER_RING_SHADER) {
-        GL(glDisable(GL_CULL_FACE));
+        gl_state_enable(GL_CULL_FACE, false);
     } else {
-        GL(glEnable(GL_CULL_FACE));
-        GL(glCullFace(rend->cull_flipped ? GL_FRONT : GL_BACK));
+        gl_state_enable(GL_CULL_FACE, true);
+        gl_state_cull_face(rend->cull_flipped ? GL_FRONT : GL_BACK);
     }
 
     if (item->tex->format == GL_RGB && item->color[3] == 1.0) {
-        GL(glDisable(GL_BLEND));
+        gl_state_enable(GL_BLEND, false);
     } else {
-        GL(glEnable(GL_BLEND));
-        GL(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
-                               GL_ZERO, GL_ONE));
+        gl_state_enable(GL_BLEND, true);
+        gl_state_blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
+                            GL_ZERO, GL_ONE);
     }
     if (item->depth_range[0] || item->depth_range[1]) {
-        GL(glEnable(GL_DEPTH_TEST));
+        gl_state_enable(GL_DEPTH_TEST, true);
         GL(glDepthMask(GL_TRUE));
     }
 
@@ -1331,15 +1966,417 @@ static void item_planet_render(renderer_gl_t *rend, const item_t *item)
                       item->planet.normal_tex_transf);
     gl_update_uniform(shader, "u_depth_range", depth_range);
 
-    draw_buffer(&item->buf, &item->indices, GL_TRIANGLES);
-    GL(glCullFace(GL_BACK));
+    draw_buffer(rend, &item->buf, &item->indices, GL_TRIANGLES);
+    gl_state_cull_face(GL_BACK);
     GL(glDepthMask(GL_FALSE));
+    gl_state_enable(GL_DEPTH_TEST, false);
+}
+
+/*
+ * Whether an item only does additive blending, in which case it commutes
+ * with the other additive items.
+ */
+static bool item_is_additive(const item_t *item)
+{
+    if (item->type == ITEM_POINTS) return true;
+    if (item->type == ITEM_TEXTURE && (item->flags & PAINTER_ADD))
+        return true;
+    return false;
+}
+
+/*
+ * Whether we can move 'item' before 'other' in the render list without
+ * a visible change.
+ */
+static bool item_can_move_past(const item_t *item, const item_t *other)
+{
+    // Labels and vg shapes are supposed to be on top of everything, so
+    // anything can be moved before them.
+    if (other->type == ITEM_TEXT || other->type == ITEM_VG_ELLIPSE ||
+        other->type == ITEM_VG_RECT || other->type == ITEM_VG_LINE)
+        return true;
+    return item_is_additive(item) && item_is_additive(other);
+}
+
+/*
+ * Whether two items use the same render state, so that their buffers can
+ * be merged into a single draw call.
+ */
+static bool items_can_merge(const item_t *a, const item_t *b)
+{
+    if (a->type != b->type || a->tex != b->tex || a->flags != b->flags)
+        return false;
+    if (memcmp(a->color, b->color, sizeof(a->color)) != 0) return false;
+    if (memcmp(a->depth_range, b->depth_range, sizeof(a->depth_range)) != 0)
+        return false;
+    if (a->buf.capacity < a->buf.nb + b->buf.nb) return false;
+    if (b->indices.nb &&
+            a->indices.capacity < a->indices.nb + b->indices.nb)
+        return false;
+    switch (a->type) {
+    case ITEM_POINTS:
+        return a->points.halo == b->points.halo;
+    case ITEM_LINES:
+        return memcmp(&a->lines, &b->lines, sizeof(a->lines)) == 0;
+    case ITEM_TEXTURE:
+        return a->texture.fallback_tex == b->texture.fallback_tex &&
+               (!a->texture.fallback_tex ||
+                (a->texture.fallback_blend == b->texture.fallback_blend &&
+                 memcmp(a->texture.fallback_mat, b->texture.fallback_mat,
+                        sizeof(a->texture.fallback_mat)) == 0));
+    case ITEM_VG_ELLIPSE:
+    case ITEM_VG_RECT:
+        // Size, stroke, dashes and color are all per vertex.
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Append the buffers of an item into an other item of the same state.
+ */
+static void item_merge(item_t *dst, item_t *src)
+{
+    int i, ofs = dst->buf.nb;
+    uint16_t idx;
+
+    memcpy((char*)dst->buf.data + dst->buf.nb * dst->buf.info->size,
+           src->buf.data, src->buf.nb * src->buf.info->size);
+    dst->buf.nb += src->buf.nb;
+    for (i = 0; i < src->indices.nb; i++) {
+        idx = *(uint16_t*)gl_buf_at(&src->indices, i, 0);
+        gl_buf_1i(&dst->indices, -1, 0, idx + ofs);
+        gl_buf_next(&dst->indices);
+    }
+}
+
+/*
+ * Sort-and-merge pass over the item list: move points, lines and texture
+ * items back to the closest earlier item with the same render state, as
+ * long as doing so doesn't cross an item they have a blend-order
+ * dependency with.  Interleaved modules (stars, then a label, then
+ * stars again) would otherwise fragment into many small draw calls.
+ */
+static void rend_merge_items(renderer_gl_t *rend)
+{
+    item_t *item, *tmp, *prev, *target;
+
+    DL_FOREACH_SAFE(rend->items, item, tmp) {
+        if (item->type != ITEM_POINTS && item->type != ITEM_LINES &&
+                item->type != ITEM_TEXTURE && item->type != ITEM_VG_ELLIPSE &&
+                item->type != ITEM_VG_RECT)
+            continue;
+        target = NULL;
+        for (prev = (item == rend->items) ? NULL : item->prev; prev;
+                prev = (prev == rend->items) ? NULL : prev->prev) {
+            if (items_can_merge(prev, item)) {
+                target = prev;
+                break;
+            }
+            if (!item_can_move_past(item, prev)) break;
+        }
+        if (!target) continue;
+        item_merge(target, item);
+        DL_DELETE(rend->items, item);
+        texture_release(item->tex);
+        if (item->type == ITEM_TEXTURE)
+            texture_release(item->texture.fallback_tex);
+        gl_buf_release(&item->buf);
+        gl_buf_release(&item->indices);
+        // The item itself is reclaimed with the arena at the end of the
+        // flush.
+    }
+}
+
+/*
+ * Collect the results of the finished gpu timer queries, without ever
+ * stalling: queries complete in order, so we stop at the first one whose
+ * result is not yet available.  Once all the queries of a frame have
+ * been read, its totals are published in gpu_timers.times.
+ */
+static void gpu_timers_poll(renderer_gl_t *rend)
+{
+#ifdef GPU_QUERY_TARGET
+    int i, nb;
+    GLuint available, ns;
+
+    for (nb = 0; nb < rend->gpu_timers.nb; nb++) {
+        glGetQueryObjectuiv(rend->gpu_timers.pending[nb].id,
+                            GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+        if (rend->gpu_timers.pending[nb].frame != rend->gpu_timers.frame) {
+            memcpy(rend->gpu_timers.times, rend->gpu_timers.accum,
+                   sizeof(rend->gpu_timers.times));
+            memset(rend->gpu_timers.accum, 0,
+                   sizeof(rend->gpu_timers.accum));
+            rend->gpu_timers.frame = rend->gpu_timers.pending[nb].frame;
+        }
+        glGetQueryObjectuiv(rend->gpu_timers.pending[nb].id,
+                            GL_QUERY_RESULT, &ns);
+        rend->gpu_timers.accum[rend->gpu_timers.pending[nb].type] +=
+            ns / (1000.0 * 1000.0);
+        glDeleteQueries(1, &rend->gpu_timers.pending[nb].id);
+    }
+    for (i = 0; nb + i < rend->gpu_timers.nb; i++)
+        rend->gpu_timers.pending[i] = rend->gpu_timers.pending[nb + i];
+    rend->gpu_timers.nb -= nb;
+#endif
+}
+
+static bool gpu_timer_begin(renderer_gl_t *rend, int type)
+{
+#ifdef GPU_QUERY_TARGET
+    GLuint id;
+    if (!rend->gpu_timers.enabled) return false;
+    if (rend->gpu_timers.nb == ARRAY_SIZE(rend->gpu_timers.pending))
+        return false;
+    while (glGetError() != GL_NO_ERROR) {}
+    glGenQueries(1, &id);
+    glBeginQuery(GPU_QUERY_TARGET, id);
+    if (glGetError() != GL_NO_ERROR) {
+        // Not supported by the driver: turn the timers off for good.
+        rend->gpu_timers.enabled = false;
+        glDeleteQueries(1, &id);
+        return false;
+    }
+    rend->gpu_timers.pending[rend->gpu_timers.nb].id = id;
+    rend->gpu_timers.pending[rend->gpu_timers.nb].type = type;
+    rend->gpu_timers.pending[rend->gpu_timers.nb].frame = rend->frame_count;
+    rend->gpu_timers.nb++;
+    return true;
+#else
+    return false;
+#endif
+}
+
+static void gpu_timer_end(renderer_gl_t *rend)
+{
+#ifdef GPU_QUERY_TARGET
+    glEndQuery(GPU_QUERY_TARGET);
+#endif
+}
+
+json_value *render_gl_gpu_times(renderer_t *rend_)
+{
+    renderer_gl_t *rend = (void*)rend_;
+    json_value *ret;
+    int i;
+
+    rend->gpu_timers.enabled = true; // Start measuring on first call.
+    ret = json_object_new(0);
+    for (i = 1; i < ITEM_NB; i++) {
+        json_object_push(ret, ITEM_NAMES[i],
+                         json_double_new(rend->gpu_timers.times[i]));
+    }
+    return ret;
+}
+
+void render_gl_set_marker(renderer_t *rend_, const char *marker)
+{
+    renderer_gl_t *rend = (void*)rend_;
+    rend->marker = marker;
+}
+
+// Size of the offscreen id-buffer target (pixels, framebuffer scale).
+#define PICK_SIZE 32
+
+bool render_gl_pick(renderer_t *rend_, const double pos[2], double max_dist,
+                    uint64_t *oid, uint64_t *hint)
+{
+    renderer_gl_t *rend = (void*)rend_;
+    const struct pick_frame *frame =
+        &rend->pick.frames[rend->pick.current ^ 1];
+    gl_shader_t *shader;
+    shader_define_t defines[] = {
+        {"PICK", true},
+        {}
+    };
+    const float white[4] = {1, 1, 1, 1};
+    uint8_t pixels[PICK_SIZE * PICK_SIZE * 4];
+    GLint prev_fbo;
+    uint32_t id, best = 0;
+    double d, best_d = 0;
+    int i, x, y;
+
+    if (!frame->buf.nb) return false;
+
+    if (!rend->pick.fbo) {
+        GL(glGenTextures(1, &rend->pick.tex));
+        GL(glBindTexture(GL_TEXTURE_2D, rend->pick.tex));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        GL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, PICK_SIZE, PICK_SIZE, 0,
+                        GL_RGBA, GL_UNSIGNED_BYTE, NULL));
+        GL(glGenFramebuffers(1, &rend->pick.fbo));
+        GL(glGenBuffers(1, &rend->pick.vbo));
+    }
+
+    GL(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prev_fbo));
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, rend->pick.fbo));
+    GL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_TEXTURE_2D, rend->pick.tex, 0));
+
+    // Offset the full size viewport so that the query position lands at
+    // the center of the small target: the vertices keep their on screen
+    // ndc positions and the rasterization outside the target is clipped
+    // for free.
+    GL(glViewport(PICK_SIZE / 2 - round(pos[0] * rend->scale),
+                  PICK_SIZE / 2 - round(rend->fb_size[1] -
+                                        pos[1] * rend->scale),
+                  rend->fb_size[0], rend->fb_size[1]));
+    GL(glClearColor(0, 0, 0, 0));
+    GL(glClear(GL_COLOR_BUFFER_BIT));
+    GL(glDisable(GL_BLEND));
+    GL(glDisable(GL_DEPTH_TEST));
+
+    shader = shader_get("points", defines, ATTR_NAMES, init_shader);
+    GL(glUseProgram(shader->prog));
+    gl_update_uniform(shader, "u_color", white);
+    gl_update_uniform(shader, "u_core_size", 1.0);
+
+    GL(glBindBuffer(GL_ARRAY_BUFFER, rend->pick.vbo));
+    GL(glBufferData(GL_ARRAY_BUFFER, frame->buf.nb * POINTS_BUF.size,
+                    frame->buf.data, GL_STREAM_DRAW));
+    gl_buf_enable(&frame->buf);
+    GL(glDrawArrays(GL_POINTS, 0, frame->buf.nb));
+    gl_buf_disable(&frame->buf);
+
+    GL(glReadPixels(0, 0, PICK_SIZE, PICK_SIZE, GL_RGBA, GL_UNSIGNED_BYTE,
+                    pixels));
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo));
+    GL(glViewport(0, 0, rend->fb_size[0], rend->fb_size[1]));
+
+    // Keep the hit closest to the query position.
+    for (i = 0; i < PICK_SIZE * PICK_SIZE; i++) {
+        id = pixels[i * 4 + 0] | (pixels[i * 4 + 1] << 8) |
+             (pixels[i * 4 + 2] << 16);
+        if (id == 0 || (int)id > frame->buf.nb) continue;
+        x = i % PICK_SIZE - PICK_SIZE / 2;
+        y = i / PICK_SIZE - PICK_SIZE / 2;
+        d = sqrt(x * x + y * y);
+        if (!best || d < best_d) {
+            best = id;
+            best_d = d;
+        }
+    }
+    *oid = 0;
+    *hint = 0;
+    if (best && best_d <= max_dist * rend->scale) {
+        *oid = frame->ids[best - 1][0];
+        *hint = frame->ids[best - 1][1];
+    }
+    return true;
+}
+
+/*
+ * Whether an item can go into the scaled down background pass.  Point
+ * sources, lines and labels are excluded so that they keep rendering at
+ * native resolution.
+ */
+static bool item_type_is_background(int type)
+{
+    return type == ITEM_TEXTURE || type == ITEM_MESH ||
+           type == ITEM_ATMOSPHERE || type == ITEM_FOG ||
+           type == ITEM_PLANET;
+}
+
+/*
+ * Bind the low resolution framebuffer for the background pass,
+ * (re)creating it at fb_size * render_scale if needed.  The previous
+ * framebuffer binding is returned so that <lowres_end> can restore it
+ * (it might not be the default one, e.g. offscreen canvas or still
+ * rendering).
+ */
+static void lowres_begin(renderer_gl_t *rend, GLint *prev_fbo)
+{
+    int w = max(1, (int)round(rend->fb_size[0] * rend->render_scale));
+    int h = max(1, (int)round(rend->fb_size[1] * rend->render_scale));
+
+    GL(glGetIntegerv(GL_FRAMEBUFFER_BINDING, prev_fbo));
+    if (!rend->lowres.fbo) {
+        GL(glGenFramebuffers(1, &rend->lowres.fbo));
+        GL(glGenTextures(1, &rend->lowres.tex));
+    }
+    if (rend->lowres.w != w || rend->lowres.h != h) {
+        GL(glBindTexture(GL_TEXTURE_2D, rend->lowres.tex));
+        GL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA,
+                        GL_UNSIGNED_BYTE, NULL));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
+                           GL_CLAMP_TO_EDGE));
+        GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
+                           GL_CLAMP_TO_EDGE));
+        rend->lowres.w = w;
+        rend->lowres.h = h;
+    }
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, rend->lowres.fbo));
+    GL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_TEXTURE_2D, rend->lowres.tex, 0));
+    GL(glViewport(0, 0, w, h));
+    GL(glClearColor(0.0, 0.0, 0.0, 1.0));
+    GL(glClear(GL_COLOR_BUFFER_BIT));
+}
+
+/*
+ * End the background pass: restore the output framebuffer and composite
+ * the low resolution texture up as a fullscreen quad.
+ */
+static void lowres_end(renderer_gl_t *rend, GLint prev_fbo)
+{
+    gl_shader_t *shader;
+    gl_buf_t buf, indices;
+    int i;
+    const int16_t INDICES[6] = {0, 1, 2, 3, 2, 1};
+    // The items already applied the color effects when they rendered, so
+    // the composite itself is neutral.
+    const float no_fx[2] = {0.0, 1.0};
+    const float white[4] = {1.0, 1.0, 1.0, 1.0};
+
+    GL(glBindFramebuffer(GL_FRAMEBUFFER, prev_fbo));
+    GL(glViewport(0, 0, rend->fb_size[0], rend->fb_size[1]));
+
+    gl_buf_alloc(&buf, &TEXTURE_BUF, 4);
+    gl_buf_alloc(&indices, &INDICES_BUF, 6);
+    for (i = 0; i < 4; i++) {
+        gl_buf_4f(&buf, -1, ATTR_POS, (i % 2) * 2.0 - 1.0,
+                  (i / 2) * 2.0 - 1.0, 0.0, 1.0);
+        gl_buf_2f(&buf, -1, ATTR_TEX_POS, i % 2, i / 2);
+        gl_buf_4i(&buf, -1, ATTR_COLOR, 255, 255, 255, 255);
+        gl_buf_next(&buf);
+    }
+    for (i = 0; i < 6; i++) {
+        gl_buf_1i(&indices, -1, 0, INDICES[i]);
+        gl_buf_next(&indices);
+    }
+
+    shader = shader_get("blit", NULL, ATTR_NAMES, init_shader);
+    GL(glUseProgram(shader->prog));
+    gl_update_uniform(shader, "u_color_fx", no_fx);
+    gl_update_uniform(shader, "u_color", white);
+    GL(glActiveTexture(GL_TEXTURE0));
+    GL(glBindTexture(GL_TEXTURE_2D, rend->lowres.tex));
+    GL(glDisable(GL_CULL_FACE));
     GL(glDisable(GL_DEPTH_TEST));
+    GL(glDisable(GL_BLEND));
+    draw_buffer(rend, &buf, &indices, GL_TRIANGLES);
+    gl_buf_release(&buf);
+    gl_buf_release(&indices);
+    gl_state_reset(); // The composite used direct GL calls.
 }
 
 static void rend_flush(renderer_gl_t *rend)
 {
     item_t *item, *tmp;
+    mesh_vbo_t *vbo, *vbo_tmp;
+    char marker_buf[128];
+    bool timed;
+    bool lowres_active = false;
+    int lowres_nb = 0;
+    GLint prev_fbo = 0;
+
+    gpu_timers_poll(rend);
+    rend_merge_items(rend);
 
     // Compute depth range.
     rend->depth_range[0] = DBL_MAX;
@@ -1357,7 +2394,10 @@ static void rend_flush(renderer_gl_t *rend)
         rend->depth_range[1] = 1;
     }
 
-    // Set default OpenGL state.
+    // Set default OpenGL state.  The paint phase ran untracked GL
+    // calls (texture uploads, shader compiles), so start from a clean
+    // shadow state.
+    gl_state_reset();
     GL(glClearColor(0.0, 0.0, 0.0, 1.0));
     GL(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT));
     GL(glViewport(0, 0, rend->fb_size[0], rend->fb_size[1]));
@@ -1370,7 +2410,34 @@ static void rend_flush(renderer_gl_t *rend)
     GL(glEnable(GL_POINT_SPRITE));
 #endif
 
+    // Dynamic resolution scaling: the contiguous prefix of background
+    // items (milky way, image surveys...) is rendered into a smaller
+    // framebuffer and composited up, saving most of the fill rate on
+    // scaled down devices, while the following items (point sources,
+    // lines, labels...) keep their native resolution.
+    if (rend->render_scale < 1.0) {
+        DL_FOREACH(rend->items, item) {
+            if (!item_type_is_background(item->type)) break;
+            lowres_nb++;
+        }
+        if (lowres_nb) {
+            lowres_begin(rend, &prev_fbo);
+            lowres_active = true;
+        }
+    }
+
     DL_FOREACH_SAFE(rend->items, item, tmp) {
+        if (lowres_active && !lowres_nb) {
+            lowres_end(rend, prev_fbo);
+            lowres_active = false;
+        }
+        if (lowres_active) lowres_nb--;
+        if (item->marker) {
+            snprintf(marker_buf, sizeof(marker_buf), "%s/%s",
+                     item->marker, ITEM_NAMES[item->type]);
+            gl_push_marker(marker_buf);
+        }
+        timed = gpu_timer_begin(rend, item->type);
         switch (item->type) {
         case ITEM_LINES:
             item_lines_render(rend, item);
@@ -1398,6 +2465,8 @@ static void rend_flush(renderer_gl_t *rend)
             break;
         case ITEM_VG_ELLIPSE:
         case ITEM_VG_RECT:
+            item_vg_sdf_render(rend, item);
+            break;
         case ITEM_VG_LINE:
             item_vg_render(rend, item);
             break;
@@ -1410,15 +2479,32 @@ static void rend_flush(renderer_gl_t *rend)
         default:
             assert(false);
         }
+        if (timed) gpu_timer_end(rend);
+        if (item->marker) gl_pop_marker();
 
         DL_DELETE(rend->items, item);
         texture_release(item->tex);
+        if (item->type == ITEM_TEXTURE)
+            texture_release(item->texture.fallback_tex);
         if (item->type == ITEM_PLANET)
             texture_release(item->planet.normalmap);
         gl_buf_release(&item->buf);
         gl_buf_release(&item->indices);
-        free(item);
     }
+    frame_arena_reset(rend);
+
+    // Drop the retained mesh buffers that have not been used recently.
+    HASH_ITER(hh, rend->mesh_vbos, vbo, vbo_tmp) {
+        if (rend->frame_count - vbo->last_used <= 60) continue;
+        if (vbo->vbo) GL(glDeleteBuffers(1, &vbo->vbo));
+        if (vbo->ibo) GL(glDeleteBuffers(1, &vbo->ibo));
+        HASH_DEL(rend->mesh_vbos, vbo);
+        free(vbo);
+    }
+
+    if (lowres_active)
+        lowres_end(rend, prev_fbo);
+
     // Reset to default OpenGL settings.
     GL(glDepthMask(GL_TRUE));
 }
@@ -1427,6 +2513,10 @@ static void finish(renderer_t *rend_)
 {
     renderer_gl_t *rend = (void*)rend_;
     rend_flush(rend);
+    // Publish the pick stream of this frame and start filling the other
+    // one, so that a pick query always replays a complete frame.
+    rend->pick.current ^= 1;
+    rend->pick.frames[rend->pick.current].buf.nb = 0;
 }
 
 static void line_glow(renderer_t           *rend_,
@@ -1435,22 +2525,25 @@ static void line_glow(renderer_t           *rend_,
                       int                  size)
 {
     renderer_gl_t *rend = (void*)rend_;
-    line_mesh_t *mesh;
-    int i, ofs;
+    int i, k, ofs;
     float color[4];
     item_t *item;
-
-    vec4_to_float(painter->color, color);
-    mesh = line_to_mesh(line, size, 10);
-
-    if (mesh->indices_count >= 1024) {
+    double n[2], v[2], length = 0;
+    // Half extent of the strip: must cover the 5px glow radius of the
+    // lines shader.
+    const double hw = 5;
+    const int verts_count = size * 2;
+    const int indices_count = 6 * (size - 1);
+
+    assert(size >= 2);
+    if (indices_count >= 1024) {
         LOG_W("Too many points in lines! (size: %d)", size);
-        goto end;
+        return;
     }
+    vec4_to_float(painter->color, color);
 
     // Get the item.
-    item = get_item(rend, ITEM_LINES_GLOW, mesh->verts_count,
-                    mesh->indices_count, NULL);
+    item = get_item(rend, ITEM_LINES_GLOW, verts_count, indices_count, NULL);
     if (item && memcmp(item->color, color, sizeof(color))) item = NULL;
     if (item && item->lines.dash_length != painter->lines.dash_length)
         item = NULL;
@@ -1459,7 +2552,7 @@ static void line_glow(renderer_t           *rend_,
 
 
     if (!item) {
-        item = calloc(1, sizeof(*item));
+        item = item_alloc(rend);
         item->type = ITEM_LINES_GLOW;
         gl_buf_alloc(&item->buf, &LINES_GLOW_BUF, 1024);
         gl_buf_alloc(&item->indices, &INDICES_BUF, 1024);
@@ -1475,20 +2568,28 @@ static void line_glow(renderer_t           *rend_,
     if (painter->depth_range)
         vec2_to_float(*painter->depth_range, item->depth_range);
 
-    // Append the mesh to the buffer.
+    // Extrude the line into a strip directly inside the item buffer: the
+    // fragment shader does the antialiasing and glow analytically from
+    // the distance stored in the tex pos attribute, so two vertices per
+    // point are enough and we don't need an intermediate mesh.
     ofs = item->buf.nb;
-    for (i = 0; i < mesh->verts_count; i++) {
-        gl_buf_3f(&item->buf, -1, ATTR_POS, VEC3_SPLIT(mesh->verts[i].pos));
-        gl_buf_2f(&item->buf, -1, ATTR_TEX_POS, VEC2_SPLIT(mesh->verts[i].uv));
-        gl_buf_next(&item->buf);
+    for (i = 0; i < size; i++) {
+        if (i > 0) length += vec2_dist(line[i - 1], line[i]);
+        line_get_normal(line, size, i, n);
+        for (k = 0; k < 2; k++) {
+            vec2_addk(line[i], n, (k ? +1 : -1) * hw, v);
+            gl_buf_3f(&item->buf, -1, ATTR_POS, v[0], v[1], line[i][2]);
+            gl_buf_2f(&item->buf, -1, ATTR_TEX_POS, length,
+                      (k ? +1 : -1) * hw);
+            gl_buf_next(&item->buf);
+        }
     }
-    for (i = 0; i < mesh->indices_count; i++) {
-        gl_buf_1i(&item->indices, -1, 0, mesh->indices[i] + ofs);
+    for (i = 0; i < size - 1; i++)
+    for (k = 0; k < 6; k++) {
+        gl_buf_1i(&item->indices, -1, 0,
+                  ofs + i * 2 + (const int[]){0, 1, 2, 3, 2, 1}[k]);
         gl_buf_next(&item->indices);
     }
-
-end:
-    line_mesh_delete(mesh);
 }
 
 static void line(renderer_t           *rend_,
@@ -1513,7 +2614,7 @@ static void line(renderer_t           *rend_,
     if (item && item->lines.width != painter->lines.width) item = NULL;
 
     if (!item) {
-        item = calloc(1, sizeof(*item));
+        item = item_alloc(rend);
         item->type = ITEM_LINES;
         gl_buf_alloc(&item->buf, &LINES_BUF, 1024);
         gl_buf_alloc(&item->indices, &INDICES_BUF, 1024);
@@ -1546,31 +2647,82 @@ static void mesh(renderer_t          *rend_,
                  int                 verts_count,
                  const double        verts[][3],
                  int                 indices_count,
-                 const uint16_t      indices[])
+                 const uint16_t      indices[],
+                 uint64_t            key,
+                 uint32_t            gen)
 {
     int i, ofs;
     double pos[4] = {};
     double rot[3][3];
     float color[4];
     item_t *item;
+    mesh_vbo_t *vbo = NULL;
     renderer_gl_t *rend = (void*)rend_;
 
     vec4_to_float(painter->color, color);
 
-    item = get_item(rend, ITEM_MESH, verts_count, indices_count, NULL);
-    if (item && item->mesh.mode != mode) item = NULL;
-    if (item && item->mesh.stroke_width != painter->lines.width) item = NULL;
-    if (item && memcmp(item->color, color, sizeof(color))) item = NULL;
-
-    if (!item) {
-        item = calloc(1, sizeof(*item));
+    if (key && verts_count >= MESH_RETAIN_MIN_VERTS) {
+        HASH_FIND(hh, rend->mesh_vbos, &key, sizeof(key), vbo);
+        if (!vbo) {
+            vbo = calloc(1, sizeof(*vbo));
+            vbo->key = key;
+            HASH_ADD(hh, rend->mesh_vbos, key, sizeof(vbo->key), vbo);
+        }
+        vbo->last_used = rend->frame_count;
+        item = item_alloc(rend);
         item->type = ITEM_MESH;
         memcpy(item->color, color, sizeof(color));
         item->mesh.mode = mode;
         item->mesh.stroke_width = painter->lines.width;
-        gl_buf_alloc(&item->buf, &MESH_BUF, max(verts_count, 1024));
-        gl_buf_alloc(&item->indices, &INDICES_BUF, max(indices_count, 1024));
+        item->mesh.vbo = vbo;
         DL_APPEND(rend->items, item);
+
+        if (    vbo->ready && vbo->gen == gen && vbo->mode == mode &&
+                vbo->frame == frame &&
+                vbo->obs_hash == painter->obs->hash &&
+                vbo->proj_type == painter->proj->type &&
+                memcmp(vbo->proj_scaling, painter->proj->scaling,
+                       sizeof(vbo->proj_scaling)) == 0 &&
+                memcmp(vbo->window_size, painter->proj->window_size,
+                       sizeof(vbo->window_size)) == 0) {
+            // Unchanged: the draw will reuse the uploaded buffers.
+            item->mesh.proj = vbo->item_proj;
+            memcpy(item->mesh.proj_scaling, vbo->item_proj_scaling,
+                   sizeof(item->mesh.proj_scaling));
+            return;
+        }
+        // Rebuild the buffers, the upload happens at render time.
+        vbo->gen = gen;
+        vbo->mode = mode;
+        vbo->frame = frame;
+        vbo->obs_hash = painter->obs->hash;
+        vbo->proj_type = painter->proj->type;
+        memcpy(vbo->proj_scaling, painter->proj->scaling,
+               sizeof(vbo->proj_scaling));
+        memcpy(vbo->window_size, painter->proj->window_size,
+               sizeof(vbo->window_size));
+        vbo->ready = true;
+        gl_buf_alloc(&item->buf, &MESH_BUF, verts_count);
+        gl_buf_alloc(&item->indices, &INDICES_BUF, indices_count);
+    } else {
+        item = get_item(rend, ITEM_MESH, verts_count, indices_count, NULL);
+        if (item && item->mesh.mode != mode) item = NULL;
+        if (item && item->mesh.stroke_width != painter->lines.width)
+            item = NULL;
+        if (item && item->mesh.vbo) item = NULL;
+        if (item && memcmp(item->color, color, sizeof(color))) item = NULL;
+
+        if (!item) {
+            item = item_alloc(rend);
+            item->type = ITEM_MESH;
+            memcpy(item->color, color, sizeof(color));
+            item->mesh.mode = mode;
+            item->mesh.stroke_width = painter->lines.width;
+            gl_buf_alloc(&item->buf, &MESH_BUF, max(verts_count, 1024));
+            gl_buf_alloc(&item->indices, &INDICES_BUF,
+                         max(indices_count, 1024));
+            DL_APPEND(rend->items, item);
+        }
     }
 
     ofs = item->buf.nb;
@@ -1606,6 +2758,62 @@ static void mesh(renderer_t          *rend_,
         gl_buf_1i(&item->indices, -1, 0, indices[i] + ofs);
         gl_buf_next(&item->indices);
     }
+
+    if (vbo) {
+        vbo->item_proj = item->mesh.proj;
+        memcpy(vbo->item_proj_scaling, item->mesh.proj_scaling,
+               sizeof(vbo->item_proj_scaling));
+    }
+}
+
+/*
+ * Push one quad covering an ellipse or rect outline into a vg item,
+ * reusing the previous item if possible so that consecutive shapes end
+ * up in a single draw call.  The rotation is applied cpu side, and the
+ * shader evaluates the shape in the local (unrotated) frame passed in
+ * a_tex_pos.
+ */
+static void vg_quad_2d(renderer_gl_t *rend, int type,
+                       const painter_t *painter,
+                       const double pos[2], const double size[2],
+                       double angle, double dashes)
+{
+    const int16_t INDICES[6] = {0, 1, 2, 3, 2, 1};
+    item_t *item;
+    int i, ofs;
+    double margin, c, s, lx, ly;
+
+    item = get_item(rend, type, 4, 6, NULL);
+    if (!item) {
+        item = item_alloc(rend);
+        item->type = type;
+        gl_buf_alloc(&item->buf, &VG_BUF, 64 * 4);
+        gl_buf_alloc(&item->indices, &INDICES_BUF, 64 * 6);
+        DL_APPEND(rend->items, item);
+    }
+
+    // Extend the quad to leave room for the stroke and the antialiasing.
+    margin = painter->lines.width / 2 + 1;
+    c = cos(angle);
+    s = sin(angle);
+    ofs = item->buf.nb;
+    for (i = 0; i < 4; i++) {
+        lx = (i % 2 ? +1 : -1) * (size[0] + margin);
+        ly = (i / 2 ? +1 : -1) * (size[1] + margin);
+        gl_buf_2f(&item->buf, -1, ATTR_POS, pos[0] + c * lx - s * ly,
+                                            pos[1] + s * lx + c * ly);
+        gl_buf_2f(&item->buf, -1, ATTR_TEX_POS, lx, ly);
+        gl_buf_4f(&item->buf, -1, ATTR_SHAPE, size[0], size[1],
+                  painter->lines.width, dashes);
+        gl_buf_4i(&item->buf, -1, ATTR_COLOR,
+                  painter->color[0] * 255, painter->color[1] * 255,
+                  painter->color[2] * 255, painter->color[3] * 255);
+        gl_buf_next(&item->buf);
+    }
+    for (i = 0; i < 6; i++) {
+        gl_buf_1i(&item->indices, -1, 0, ofs + INDICES[i]);
+        gl_buf_next(&item->indices);
+    }
 }
 
 static void ellipse_2d(renderer_t *rend_, const painter_t *painter,
@@ -1613,31 +2821,14 @@ static void ellipse_2d(renderer_t *rend_, const painter_t *painter,
                        double angle, double dashes)
 {
     renderer_gl_t *rend = (void*)rend_;
-    item_t *item;
-    item = calloc(1, sizeof(*item));
-    item->type = ITEM_VG_ELLIPSE;
-    vec2_to_float(pos, item->vg.pos);
-    vec2_to_float(size, item->vg.size);
-    vec4_to_float(painter->color, item->color);
-    item->vg.angle = angle;
-    item->vg.dashes = dashes;
-    item->vg.stroke_width = painter->lines.width;
-    DL_APPEND(rend->items, item);
+    vg_quad_2d(rend, ITEM_VG_ELLIPSE, painter, pos, size, angle, dashes);
 }
 
 static void rect_2d(renderer_t *rend_, const painter_t *painter,
                     const double pos[2], const double size[2], double angle)
 {
     renderer_gl_t *rend = (void*)rend_;
-    item_t *item;
-    item = calloc(1, sizeof(*item));
-    item->type = ITEM_VG_RECT;
-    vec2_to_float(pos, item->vg.pos);
-    vec2_to_float(size, item->vg.size);
-    vec4_to_float(painter->color, item->color);
-    item->vg.angle = angle;
-    item->vg.stroke_width = painter->lines.width;
-    DL_APPEND(rend->items, item);
+    vg_quad_2d(rend, ITEM_VG_RECT, painter, pos, size, angle, 0);
 }
 
 static void line_2d(renderer_t *rend_, const painter_t *painter,
@@ -1645,7 +2836,7 @@ static void line_2d(renderer_t *rend_, const painter_t *painter,
 {
     renderer_gl_t *rend = (void*)rend_;
     item_t *item;
-    item = calloc(1, sizeof(*item));
+    item = item_alloc(rend);
     item->type = ITEM_VG_LINE;
     vec2_to_float(p1, item->vg.pos);
     vec2_to_float(p2, item->vg.pos2);
@@ -1690,12 +2881,22 @@ void core_add_font(renderer_gl_t *rend, const char *name,
 
     id = nvgCreateFontMem(rend->vg, name, data, size, 0);
     if (!rend->fonts[font].id || rend->fonts[font].is_default_font) {
+        // Keep the replaced default (subset) font as glyph level
+        // fallback, in case the new font misses some of its glyphs.
+        if (rend->fonts[font].id)
+            nvgAddFallbackFontId(rend->vg, id, rend->fonts[font].id);
         rend->fonts[font].id = id;
         rend->fonts[font].scale = scale;
         rend->fonts[font].is_default_font = false;
     } else {
         nvgAddFallbackFontId(rend->vg, rend->fonts[font].id, id);
     }
+    // Invalidate the cached text metrics (stale entries are dropped lazily
+    // on lookup) and the label textures (swept in <prepare>), and force a
+    // frame even if the scene is otherwise static, so that the visible
+    // labels get re-shaped with the new font.
+    rend->font_gen++;
+    core->frame_dirty = true;
 }
 
 static void set_default_fonts(renderer_gl_t *rend)
@@ -1730,6 +2931,12 @@ renderer_t* render_gl_create(void)
     if (range[1] < 32)
         LOG_W("OpenGL Doesn't support large point size!");
 
+    // Use the packed vertex layouts if we can.
+    if (gl_has_half_float()) {
+        g_texture_buf = &TEXTURE_BUF_PACKED;
+        g_planet_buf = &PLANET_BUF_PACKED;
+    }
+
     rend->rend.prepare = prepare;
     rend->rend.finish = finish;
     rend->rend.points_2d = points_2d;
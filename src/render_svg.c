@@ -11,10 +11,24 @@
 
 // Support for svg rendering.
 // Still experimental.
+//
+// The document is streamed to the output file as the painter calls
+// arrive, so the memory usage doesn't depend on the number of elements.
+// Repeated point symbols are shared: the first occurrence of a given
+// radius/color emits a <defs> entry, the other ones only a small <use>
+// reference, which keeps large star chart exports compact.
+
+// Max number of distinct point symbols we deduplicate in the defs.
+#define MAX_NB_DEFS 64
 
 typedef struct {
     renderer_t  rend;
     FILE        *out;
+    struct {
+        double  r;
+        uint8_t color[4];
+    } defs[MAX_NB_DEFS];
+    int         defs_nb;
 } renderer_svg_t;
 
 static void prepare(renderer_t *rend_, double w, double h, double scale,
@@ -22,7 +36,9 @@ static void prepare(renderer_t *rend_, double w, double h, double scale,
 {
     renderer_svg_t *rend = (void*)rend_;
     fprintf(rend->out,
-            "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\">\n");
+            "<svg xmlns=\"http://www.w3.org/2000/svg\" "
+            "xmlns:xlink=\"http://www.w3.org/1999/xlink\" "
+            "version=\"1.1\" width=\"%f\" height=\"%f\">\n", w, h);
 }
 
 static void finish(renderer_t *rend_)
@@ -32,24 +48,55 @@ static void finish(renderer_t *rend_)
     fclose(rend->out);
 }
 
+/*
+ * Return the defs index for a given symbol, emitting the def itself the
+ * first time it is seen.  Return -1 if the defs table is full, in which
+ * case the caller emits a plain element instead.
+ */
+static int get_def(renderer_svg_t *rend, double r, const uint8_t color[4])
+{
+    int i;
+    r = round(r * 10) / 10; // Share symbols with almost equal radius.
+    for (i = 0; i < rend->defs_nb; i++) {
+        if (rend->defs[i].r == r &&
+                memcmp(rend->defs[i].color, color, 4) == 0)
+            return i;
+    }
+    if (rend->defs_nb == MAX_NB_DEFS) return -1;
+    i = rend->defs_nb++;
+    rend->defs[i].r = r;
+    memcpy(rend->defs[i].color, color, 4);
+    fprintf(rend->out,
+            "<defs><circle id='s%d' r='%f' fill='#%02x%02x%02x' "
+            "fill-opacity='%f'/></defs>\n",
+            i, r, color[0], color[1], color[2], color[3] / 255.0);
+    return i;
+}
+
 static void points(renderer_t *rend_, const painter_t *painter,
                    int n,
                    const point_t *points)
 {
     renderer_svg_t *rend = (void*)rend_;
-    int i;
-    double pos[4];
-    point_t p;
-    const double scale = 320;
+    int i, def;
+    const point_t *p;
+
+    // Positions are in window coordinates.
     for (i = 0; i < n; i++) {
-        p = points[i];
-        if (!project(painter->proj, PROJ_TO_NDC_SPACE, pos, pos)) continue;
-        pos[0] = (pos[0] + 1.0) * scale;
-        pos[1] = (pos[1] + 1.0) * scale;
-        fprintf(rend->out,
-                "<circle cx='%f' cy='%f' r='%f' fill='black' />\n",
-                pos[0], pos[1],
-                tan(p.size / 2) / painter->proj->scaling[0] * scale);
+        p = &points[i];
+        def = get_def(rend, p->size, p->color);
+        if (def >= 0) {
+            fprintf(rend->out,
+                    "<use xlink:href='#s%d' x='%f' y='%f'/>\n",
+                    def, p->pos[0], p->pos[1]);
+        } else {
+            fprintf(rend->out,
+                    "<circle cx='%f' cy='%f' r='%f' fill='#%02x%02x%02x' "
+                    "fill-opacity='%f'/>\n",
+                    p->pos[0], p->pos[1], p->size,
+                    p->color[0], p->color[1], p->color[2],
+                    p->color[3] / 255.0);
+        }
     }
 }
 
@@ -57,9 +104,7 @@ static void text(renderer_t *rend_, const char *text, const double pos[2],
                  int align, int effects, double size, const double color[4],
                  double angle, double bounds[4])
 {
-    double p[2];
     renderer_svg_t *rend = (void*)rend_;
-    const double scale = 320;
 
     if (bounds) {
         // XXX: not true!
@@ -70,11 +115,12 @@ static void text(renderer_t *rend_, const char *text, const double pos[2],
     }
     if (bounds) return;
 
-    p[0] = (pos[0] + 1.0) * scale;
-    p[1] = (pos[1] + 1.0) * scale;
     fprintf(rend->out,
-            "<text x='%f' y='%f' fill='black'>%s</text>\n",
-            p[0], p[1], text);
+            "<text x='%f' y='%f' font-size='%f' fill='#%02x%02x%02x'>"
+            "%s</text>\n",
+            pos[0], pos[1], size,
+            (int)(color[0] * 255), (int)(color[1] * 255),
+            (int)(color[2] * 255), text);
 }
 
 static void line(renderer_t           *rend_,
@@ -82,7 +128,18 @@ static void line(renderer_t           *rend_,
                  const double         (*line)[3],
                  int size)
 {
-    // Not supported yet.
+    renderer_svg_t *rend = (void*)rend_;
+    int i;
+
+    fprintf(rend->out,
+            "<polyline fill='none' stroke='#%02x%02x%02x' "
+            "stroke-opacity='%f' stroke-width='%f' points='",
+            (int)(painter->color[0] * 255), (int)(painter->color[1] * 255),
+            (int)(painter->color[2] * 255), painter->color[3],
+            painter->lines.width);
+    for (i = 0; i < size; i++)
+        fprintf(rend->out, "%s%f,%f", i ? " " : "", line[i][0], line[i][1]);
+    fprintf(rend->out, "'/>\n");
 }
 
 renderer_t *render_svg_create(const char *out)
@@ -98,5 +155,3 @@ renderer_t *render_svg_create(const char *out)
     rend->rend.line = line;
     return &rend->rend;
 }
-
-
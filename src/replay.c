@@ -0,0 +1,243 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+#include "swe.h"
+
+/*
+ * Log format: one event per line, belonging to the frame opened by the
+ * last 'F' line before it.
+ *
+ *   F <dt>               - Start of a frame, with its time step (s).
+ *   M <id> <state> <x> <y>   - Mouse event.
+ *   Z <k> <x> <y>            - Zoom event.
+ *   A <url>                  - First arrival of a network asset.
+ */
+
+enum {
+    EVENT_MOUSE = 0,
+    EVENT_ZOOM,
+};
+
+typedef struct event {
+    int     frame;
+    int     type;
+    int     id, state;      // Mouse.
+    double  args[3];        // x, y / k, x, y.
+} event_t;
+
+typedef struct asset_entry {
+    UT_hash_handle  hh;
+    char            *url;
+    int             frame;
+} asset_entry_t;
+
+static struct {
+    int     state;          // 0: idle, 1: recording, 2: playing.
+    int     frame;          // Current frame index.
+    FILE    *out;           // Recording output.
+    bool    injecting;      // Set while we re-emit recorded events.
+
+    // Parsed log, for replay.
+    double          *dts;
+    int             nb_frames;
+    event_t         *events;
+    int             nb_events;
+    int             event_cursor;
+    asset_entry_t   *assets;
+} g = {};
+
+static void replay_free(void)
+{
+    asset_entry_t *entry, *tmp;
+    free(g.dts);
+    free(g.events);
+    HASH_ITER(hh, g.assets, entry, tmp) {
+        HASH_DEL(g.assets, entry);
+        free(entry->url);
+        free(entry);
+    }
+    memset(&g, 0, sizeof(g));
+}
+
+EMSCRIPTEN_KEEPALIVE
+int replay_record(const char *path)
+{
+    replay_stop();
+    g.out = fopen(path, "w");
+    if (!g.out) {
+        LOG_E("Cannot open replay log: %s", path);
+        return -1;
+    }
+    g.state = 1;
+    g.frame = -1;
+    LOG_I("Recording replay log: %s", path);
+    return 0;
+}
+
+static int parse_log(const char *data)
+{
+    const char *line;
+    double dt;
+    event_t ev;
+    asset_entry_t *entry;
+    char url[1024];
+
+    for (line = data; line; line = strchr(line, '\n')) {
+        if (*line == '\n') line++;
+        if (!*line) break;
+        switch (*line) {
+        case 'F':
+            if (sscanf(line, "F %lf", &dt) != 1) return -1;
+            g.dts = realloc(g.dts, (g.nb_frames + 1) * sizeof(*g.dts));
+            g.dts[g.nb_frames++] = dt;
+            break;
+        case 'M':
+            ev = (event_t){.frame = g.nb_frames - 1, .type = EVENT_MOUSE};
+            if (sscanf(line, "M %d %d %lf %lf", &ev.id, &ev.state,
+                       &ev.args[0], &ev.args[1]) != 4)
+                return -1;
+            g.events = realloc(g.events,
+                               (g.nb_events + 1) * sizeof(*g.events));
+            g.events[g.nb_events++] = ev;
+            break;
+        case 'Z':
+            ev = (event_t){.frame = g.nb_frames - 1, .type = EVENT_ZOOM};
+            if (sscanf(line, "Z %lf %lf %lf", &ev.args[0], &ev.args[1],
+                       &ev.args[2]) != 3)
+                return -1;
+            g.events = realloc(g.events,
+                               (g.nb_events + 1) * sizeof(*g.events));
+            g.events[g.nb_events++] = ev;
+            break;
+        case 'A':
+            if (sscanf(line, "A %1023s", url) != 1) return -1;
+            HASH_FIND_STR(g.assets, url, entry);
+            if (entry) break; // Keep the first arrival.
+            entry = calloc(1, sizeof(*entry));
+            entry->url = strdup(url);
+            entry->frame = g.nb_frames - 1;
+            HASH_ADD_KEYPTR(hh, g.assets, entry->url, strlen(entry->url),
+                            entry);
+            break;
+        default:
+            return -1;
+        }
+    }
+    return 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int replay_play(const char *path)
+{
+    char *data;
+    int size;
+
+    replay_stop();
+    data = read_file(path, &size);
+    if (!data) {
+        LOG_E("Cannot open replay log: %s", path);
+        return -1;
+    }
+    if (parse_log(data) != 0) {
+        LOG_E("Invalid replay log: %s", path);
+        free(data);
+        replay_free();
+        return -1;
+    }
+    free(data);
+    g.state = 2;
+    g.frame = -1;
+    LOG_I("Replaying log: %s (%d frames)", path, g.nb_frames);
+    return 0;
+}
+
+EMSCRIPTEN_KEEPALIVE
+void replay_stop(void)
+{
+    if (g.out) fclose(g.out);
+    replay_free();
+}
+
+bool replay_is_playing(void)
+{
+    return g.state == 2;
+}
+
+static void inject_events(void)
+{
+    const event_t *ev;
+
+    g.injecting = true;
+    for (; g.event_cursor < g.nb_events; g.event_cursor++) {
+        ev = &g.events[g.event_cursor];
+        if (ev->frame >= g.frame) break;
+        switch (ev->type) {
+        case EVENT_MOUSE:
+            core_on_mouse(ev->id, ev->state, ev->args[0], ev->args[1]);
+            break;
+        case EVENT_ZOOM:
+            core_on_zoom(ev->args[0], ev->args[1], ev->args[2]);
+            break;
+        }
+    }
+    g.injecting = false;
+}
+
+double replay_frame(double dt)
+{
+    if (g.state == 1) {
+        g.frame++;
+        fprintf(g.out, "F %.9f\n", dt);
+        return dt;
+    }
+    if (g.state == 2) {
+        g.frame++;
+        if (g.frame >= g.nb_frames) {
+            LOG_I("Replay done");
+            replay_stop();
+            return dt;
+        }
+        // The events recorded after frame N replay before frame N + 1,
+        // matching the order they were seen while recording.
+        inject_events();
+        return g.dts[g.frame];
+    }
+    return dt;
+}
+
+bool replay_filter_mouse(int id, int state, double x, double y)
+{
+    if (g.state == 1)
+        fprintf(g.out, "M %d %d %.9f %.9f\n", id, state, x, y);
+    if (g.state == 2) return g.injecting;
+    return true;
+}
+
+bool replay_filter_zoom(double k, double x, double y)
+{
+    if (g.state == 1)
+        fprintf(g.out, "Z %.9f %.9f %.9f\n", k, x, y);
+    if (g.state == 2) return g.injecting;
+    return true;
+}
+
+void replay_asset_arrived(const char *url)
+{
+    if (g.state == 1)
+        fprintf(g.out, "A %s\n", url);
+}
+
+bool replay_asset_ready(const char *url)
+{
+    asset_entry_t *entry;
+    if (g.state != 2) return true;
+    HASH_FIND_STR(g.assets, url, entry);
+    if (!entry) return true; // Not in the log: don't hold it back.
+    return g.frame >= entry->frame;
+}
@@ -0,0 +1,93 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+/*
+ * File: replay.h
+ * Deterministic record and replay of an interactive session.
+ *
+ * When recording, the engine logs the time step of each frame, the
+ * input events, and the frame at which each network asset arrived.
+ * When replaying, the logged time steps and events are fed back, and
+ * the asset layer holds back downloaded data until its recorded frame,
+ * so that two runs of the same log perform the same work in the same
+ * order.  This removes the input and network timing noise from
+ * performance comparisons between builds.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+
+/*
+ * Function: replay_record
+ * Start recording the session into a log file.
+ *
+ * Return:
+ *   0 in case of success, otherwise an error code.
+ */
+int replay_record(const char *path);
+
+/*
+ * Function: replay_play
+ * Start replaying a previously recorded log file.
+ *
+ * Return:
+ *   0 in case of success, otherwise an error code.
+ */
+int replay_play(const char *path);
+
+/*
+ * Function: replay_stop
+ * Stop the current recording or replay.
+ */
+void replay_stop(void);
+
+/*
+ * Function: replay_is_playing
+ * Whether a replay is currently running.
+ */
+bool replay_is_playing(void);
+
+/*
+ * Function: replay_frame
+ * Advance the replay layer by one frame.  Called by core_update.
+ *
+ * When recording, logs dt and returns it unchanged.  When replaying,
+ * ignores dt, injects the input events recorded for this frame, and
+ * returns the recorded time step.
+ */
+double replay_frame(double dt);
+
+/*
+ * Function: replay_filter_mouse / replay_filter_zoom
+ * Record or filter an input event.  Called by the core input handlers;
+ * when the return value is false (real events during a replay) the
+ * event should be dropped.
+ */
+bool replay_filter_mouse(int id, int state, double x, double y);
+bool replay_filter_zoom(double k, double x, double y);
+
+/*
+ * Function: replay_asset_arrived
+ * Log the arrival of a network asset.  Called by the asset layer the
+ * first time a download returns its data.
+ */
+void replay_asset_arrived(const char *url);
+
+/*
+ * Function: replay_asset_ready
+ * During a replay: whether a downloaded asset is allowed to surface
+ * yet.  The asset layer keeps reporting the data as pending until the
+ * frame recorded in the log.  Always true outside of a replay, or for
+ * urls that are not in the log.
+ */
+bool replay_asset_ready(const char *url);
+
+#endif // REPLAY_H
@@ -0,0 +1,91 @@
+/* Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+#include "search.h"
+#include "swe.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The index is a hash set of interned designations (for the duplicate
+ * test), plus an array of pointers to the entries kept sorted for the
+ * prefix binary search.  The array is only re-sorted lazily at the
+ * first query following an addition, so feeding the index while the
+ * catalogs load stays O(1) per entry.
+ */
+
+typedef struct entry {
+    UT_hash_handle  hh;
+    char            *dsgn;
+} entry_t;
+
+static entry_t *g_entries = NULL;
+static entry_t **g_sorted = NULL;
+static int g_nb = 0, g_allocated = 0;
+static bool g_dirty = false;
+
+static int entry_cmp(const void *a, const void *b)
+{
+    const entry_t *ea = *(const entry_t**)a;
+    const entry_t *eb = *(const entry_t**)b;
+    return strcasecmp(ea->dsgn, eb->dsgn);
+}
+
+void search_index_add(const char *dsgn)
+{
+    entry_t *e;
+
+    if (!dsgn || !*dsgn) return;
+    HASH_FIND_STR(g_entries, dsgn, e);
+    if (e) return;
+    e = calloc(1, sizeof(*e));
+    e->dsgn = strdup(dsgn);
+    HASH_ADD_KEYPTR(hh, g_entries, e->dsgn, strlen(e->dsgn), e);
+    if (g_nb == g_allocated) {
+        g_allocated += 1024;
+        g_sorted = realloc(g_sorted, g_allocated * sizeof(*g_sorted));
+    }
+    g_sorted[g_nb++] = e;
+    g_dirty = true;
+}
+
+// Binary search the first entry that is not smaller than the prefix.
+static int lower_bound(const char *prefix)
+{
+    int lo = 0, hi = g_nb, mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (strcasecmp(g_sorted[mid]->dsgn, prefix) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+EMSCRIPTEN_KEEPALIVE
+int search_index_query(const char *prefix, int max_ret, void *user,
+                       int (*f)(void *user, const char *dsgn))
+{
+    int i, len, nb = 0;
+
+    if (!prefix || !*prefix) return 0;
+    if (g_dirty) {
+        qsort(g_sorted, g_nb, sizeof(*g_sorted), entry_cmp);
+        g_dirty = false;
+    }
+    len = strlen(prefix);
+    for (i = lower_bound(prefix); i < g_nb && nb < max_ret; i++) {
+        if (strncasecmp(g_sorted[i]->dsgn, prefix, len) != 0) break;
+        nb++;
+        if (f(user, g_sorted[i]->dsgn)) break;
+    }
+    return nb;
+}
@@ -0,0 +1,55 @@
+/* Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+/*
+ * File: search.h
+ * Global prefix index over the object designations, for type-ahead
+ * search.
+ *
+ * The modules feed the index with <search_index_add> as their name data
+ * loads (skyculture common names, catalog designations, ...).  A query
+ * then only binary searches the index, without touching any catalog
+ * data.  The returned strings can be passed to obj_get to resolve the
+ * actual object.
+ */
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+/*
+ * Function: search_index_add
+ * Add a designation to the global search index.
+ *
+ * The string is copied and duplicates are ignored, so this can be
+ * called freely every time a source of names gets loaded.
+ */
+void search_index_add(const char *dsgn);
+
+/*
+ * Function: search_index_query
+ * Stream the indexed designations matching a prefix.
+ *
+ * The matching is case insensitive and the results are returned in
+ * lexical order, so an exact match comes first.
+ *
+ * Parameters:
+ *   prefix  - The prefix to search (at least one character).
+ *   max_ret - Maximum number of results to return.
+ *   user    - Data passed to the callback.
+ *   f       - Callback called once per result.  Return a non zero value
+ *             to stop the search.  The string stays valid for the whole
+ *             session.
+ *
+ * Return:
+ *   The number of results returned.
+ */
+int search_index_query(const char *prefix, int max_ret, void *user,
+                       int (*f)(void *user, const char *dsgn));
+
+#endif // SEARCH_H
@@ -36,6 +36,44 @@ extern "C" {
 }
 
 #include <stdlib.h>
+#include <string.h>
+
+/*
+ * Arena allocator for the elsetrec records: a catalog allocates
+ * thousands of them, so we store them in contiguous blocks (friendly to
+ * the batch propagator and to the allocator), with a free list so that
+ * TLE refreshes can reuse the slots.
+ */
+#define SGP4_ARENA_BLOCK_NB 256
+
+typedef struct arena_block {
+    struct arena_block *next;
+    int used;
+    elsetrec recs[SGP4_ARENA_BLOCK_NB];
+} arena_block_t;
+
+static arena_block_t *g_arena_blocks = NULL;
+// Free slots, chained through their own storage.
+static elsetrec *g_arena_free_list = NULL;
+
+static elsetrec *arena_alloc(void)
+{
+    elsetrec *ret;
+    arena_block_t *block;
+
+    if (g_arena_free_list) {
+        ret = g_arena_free_list;
+        g_arena_free_list = *(elsetrec**)ret;
+        memset(ret, 0, sizeof(*ret));
+        return ret;
+    }
+    if (!g_arena_blocks || g_arena_blocks->used == SGP4_ARENA_BLOCK_NB) {
+        block = (arena_block_t*)calloc(1, sizeof(*block));
+        block->next = g_arena_blocks;
+        g_arena_blocks = block;
+    }
+    return &g_arena_blocks->recs[g_arena_blocks->used++];
+}
 
 sgp4_elsetrec_t *sgp4_twoline2rv(
         const char str1_[130], const char str2_[130],
@@ -43,7 +81,7 @@ sgp4_elsetrec_t *sgp4_twoline2rv(
         double *startmfe, double *stopmfe, double *deltamin)
 {
     char str1[131] = {}, str2[131] = {};
-    elsetrec *ret = (elsetrec*)calloc(1, sizeof(*ret));
+    elsetrec *ret = arena_alloc();
     strncpy(str1, str1_, 130);
     strncpy(str2, str2_, 130);
 
@@ -52,6 +90,37 @@ sgp4_elsetrec_t *sgp4_twoline2rv(
     return (sgp4_elsetrec*)ret;
 }
 
+void sgp4_free(sgp4_elsetrec_t *satrec)
+{
+    if (!satrec) return;
+    *(elsetrec**)satrec = g_arena_free_list;
+    g_arena_free_list = (elsetrec*)satrec;
+}
+
+bool sgp4_tle_info(const char *tle1, const char *tle2,
+                   double *epoch, double *no_rev_per_day, double *ecco)
+{
+    char buf[16];
+    int epochyr, year, mon, day, hr, minute;
+    double days, sec, jd, jdfrac;
+
+    if (strlen(tle1) < 32 || strlen(tle2) < 63) return false;
+    memcpy(buf, tle1 + 18, 2);  buf[2] = '\0';
+    epochyr = atoi(buf);
+    memcpy(buf, tle1 + 20, 12); buf[12] = '\0';
+    days = atof(buf);
+    memcpy(buf, tle2 + 26, 7);  buf[7] = '\0';
+    *ecco = atof(buf) * 1e-7;
+    memcpy(buf, tle2 + 52, 11); buf[11] = '\0';
+    *no_rev_per_day = atof(buf);
+
+    year = epochyr < 57 ? epochyr + 2000 : epochyr + 1900;
+    SGP4Funcs::days2mdhms(year, days, mon, day, hr, minute, sec);
+    SGP4Funcs::jday(year, mon, day, hr, minute, sec, jd, jdfrac);
+    *epoch = jd - 2400000.5 + jdfrac;
+    return true;
+}
+
 bool sgp4(sgp4_elsetrec_t *satrec, double utc_mjd, double r[3], double v[3])
 {
     double tsince;
@@ -61,6 +130,22 @@ bool sgp4(sgp4_elsetrec_t *satrec, double utc_mjd, double r[3], double v[3])
     return SGP4Funcs::sgp4(*((elsetrec*)satrec), tsince, r, v);
 }
 
+void sgp4_n(sgp4_elsetrec_t *const *satrecs, int nb, double utc_mjd,
+            double (*r)[3], double (*v)[3], bool *oks)
+{
+    int i;
+    double tsince;
+    elsetrec *elrec;
+
+    for (i = 0; i < nb; i++) {
+        elrec = (elsetrec*)satrecs[i];
+        tsince = utc_mjd -
+                 (elrec->jdsatepoch - 2400000.5 + elrec->jdsatepochF);
+        tsince *= 24 * 60; // Put in min.
+        oks[i] = SGP4Funcs::sgp4(*elrec, tsince, r[i], v[i]);
+    }
+}
+
 /*
  * Function: sgp4_get_satepoch
  * Return the reference epoch of a sat (UTC MJD)
@@ -71,7 +156,7 @@ double sgp4_get_satepoch(const sgp4_elsetrec_t *satrec)
     return (elrec->jdsatepoch + elrec->jdsatepochF) - 2400000.5;
 }
 
-double sgp4_get_perigree_height(const sgp4_elsetrec_t *satrec)
+double sgp4_perigree_height(double no_rev_per_day, double ecco)
 {
     /*
      * Compute perigree height using the formula from:
@@ -83,11 +168,13 @@ double sgp4_get_perigree_height(const sgp4_elsetrec_t *satrec)
      * with:
      *   n0 = mean motion at epoch, rev/d
      */
+    double a = pow(8681663.653 / no_rev_per_day, 2. / 3.);
+    return a * (1 - ecco) - 6371;
+}
+
+double sgp4_get_perigree_height(const sgp4_elsetrec_t *satrec)
+{
     const elsetrec *elrec = (const elsetrec*)satrec;
     const double xpdotp = 1440.0 / (2.0 * M_PI);
-    double n0 = elrec->no_kozai * xpdotp; // rad/min to rev/d.
-    double e0 = elrec->ecco;
-    double a = pow(8681663.653 / n0, 2. / 3.);
-    double hp = a * (1 - e0) - 6371;
-    return hp;
+    return sgp4_perigree_height(elrec->no_kozai * xpdotp, elrec->ecco);
 }
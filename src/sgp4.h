@@ -21,14 +21,69 @@ sgp4_elsetrec_t *sgp4_twoline2rv(
         char typerun, char typeinput, char opsmode,
         double *startmfe, double *stopmfe, double *deltamin);
 
+/*
+ * Function: sgp4_free
+ * Release a record returned by <sgp4_twoline2rv>.
+ *
+ * The records are allocated from a contiguous internal arena, so they
+ * must be released with this function instead of free.
+ */
+void sgp4_free(sgp4_elsetrec_t *satrec);
+
+/*
+ * Function: sgp4_tle_info
+ * Parse the epoch, mean motion and eccentricity directly from a TLE.
+ *
+ * This is much cheaper than <sgp4_twoline2rv>, which runs the full
+ * propagator initialization: it allows to defer the initialization of
+ * satellites we might never propagate.
+ *
+ * Parameters:
+ *   tle1, tle2     - The two TLE lines.
+ *   epoch          - Output epoch (UTC, MJD).
+ *   no_rev_per_day - Output mean motion (rev/day).
+ *   ecco           - Output eccentricity.
+ *
+ * Return:
+ *   false if the lines are too short to be a TLE.
+ */
+bool sgp4_tle_info(const char *tle1, const char *tle2,
+                   double *epoch, double *no_rev_per_day, double *ecco);
+
 bool sgp4(sgp4_elsetrec_t *satrec, double utc_mjd, double r[3], double v[3]);
 
+/*
+ * Function: sgp4_n
+ * Propagate a batch of satellites to the same time in a single call.
+ *
+ * The propagations run back to back over compact output arrays, which
+ * keeps the propagator code hot in the instruction cache and gives the
+ * compiler a single loop to optimize.
+ *
+ * Parameters:
+ *   satrecs - Array of nb satellite records.
+ *   nb      - Number of satellites.
+ *   utc_mjd - Time of the propagation (UTC, MJD).
+ *   r       - Output positions (km, TEME frame).
+ *   v       - Output speeds (km/s, TEME frame).
+ *   oks     - Per satellite success flag, as returned by <sgp4>.
+ */
+void sgp4_n(sgp4_elsetrec_t *const *satrecs, int nb, double utc_mjd,
+            double (*r)[3], double (*v)[3], bool *oks);
+
 /*
  * Function: sgp4_get_satepoch
  * Return the reference epoch of a sat (UTC MJD)
  */
 double sgp4_get_satepoch(const sgp4_elsetrec_t *satrec);
 
+/*
+ * Function: sgp4_perigree_height
+ * Compute the perigree height (km) from the epoch mean motion (rev/day)
+ * and the eccentricity, e.g. as parsed by <sgp4_tle_info>.
+ */
+double sgp4_perigree_height(double no_rev_per_day, double ecco);
+
 /*
  * Function: sgp4_get_perigree_height
  * Compute the perigree height in km for a given satellite orbit
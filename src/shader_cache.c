@@ -9,6 +9,8 @@
 
 #include "shader_cache.h"
 
+#include <zlib.h> // For crc32.
+
 #define MAX_NB_SHADERS 16
 
 typedef struct {
@@ -18,6 +20,74 @@ typedef struct {
 
 static shader_t g_shaders[MAX_NB_SHADERS] = {};
 
+/*
+ * On disk program binary cache, so that warm starts skip the shader
+ * compilation entirely.  Each file starts with a small header with the
+ * crc of the source (to discard the binary when the shaders change) and
+ * the driver binary format.
+ *
+ * Not used on GLES2/WebGL, where the program binary api is not
+ * available.
+ */
+typedef struct {
+    uint32_t    crc;
+    int         format;
+} binary_head_t;
+
+static const char *binary_path(const char *key, char *buf, int len)
+{
+    snprintf(buf, len, "%s/.cache/shaders/%s.bin", sys_get_user_dir(), key);
+    return buf;
+}
+
+static gl_shader_t *shader_load_binary(const char *key, uint32_t crc)
+{
+    char path[1024];
+    void *data;
+    int size;
+    gl_shader_t *shader;
+    binary_head_t head;
+
+    data = read_file(binary_path(key, path, sizeof(path)), &size);
+    if (!data) return NULL;
+    if (size <= (int)sizeof(head)) {
+        free(data);
+        return NULL;
+    }
+    memcpy(&head, data, sizeof(head));
+    if (head.crc != crc) { // The shader source changed.
+        free(data);
+        return NULL;
+    }
+    shader = gl_shader_from_binary((char*)data + sizeof(head),
+                                   size - sizeof(head), head.format);
+    free(data);
+    return shader;
+}
+
+static void shader_save_binary(const char *key, uint32_t crc,
+                               const gl_shader_t *shader)
+{
+    char path[1024];
+    void *data;
+    int size, format;
+    binary_head_t head = {};
+    FILE *file;
+
+    if (gl_shader_get_binary(shader, &data, &size, &format) != 0) return;
+    binary_path(key, path, sizeof(path));
+    sys_make_dir(path);
+    file = fopen(path, "wb");
+    if (file) {
+        head.crc = crc;
+        head.format = format;
+        fwrite(&head, sizeof(head), 1, file);
+        fwrite(data, size, 1, file);
+        fclose(file);
+    }
+    free(data);
+}
+
 gl_shader_t *shader_get(const char *name, const shader_define_t *defines,
                         const char **attr_names,
                         void (*on_created)(gl_shader_t *s))
@@ -27,7 +97,8 @@ gl_shader_t *shader_get(const char *name, const shader_define_t *defines,
     const char *code;
     char key[256];
     char path[128];
-    char pre[256] = {};
+    char pre[1024] = {};
+    uint32_t crc;
     const shader_define_t *define;
 
 
@@ -60,7 +131,33 @@ gl_shader_t *shader_get(const char *name, const shader_define_t *defines,
                      "#define %s\n", define->name);
         }
     }
+
+    /*
+     * Shared color effect stage (night mode and global dimming), applied
+     * by the fragment shaders on their output color.  Injected here so
+     * that all the programs get the same code; the u_color_fx uniform is
+     * refreshed by render_gl.c.
+     */
+    snprintf(pre + strlen(pre), sizeof(pre) - strlen(pre),
+             "uniform lowp vec2 u_color_fx;\n"
+             "lowp vec4 color_fx(lowp vec4 color) {\n"
+             "    lowp float l = max(color.r, max(color.g, color.b));\n"
+             "    color.rgb = mix(color.rgb, vec3(l, 0.0, 0.0),"
+             " u_color_fx.x);\n"
+             "    color.rgb *= u_color_fx.y;\n"
+             "    return color;\n"
+             "}\n");
+
+    crc = crc32(0, (void*)pre, strlen(pre));
+    crc = crc32(crc, (void*)code, strlen(code));
+    s->shader = shader_load_binary(key, crc);
+    if (s->shader) {
+        if (on_created) on_created(s->shader);
+        return s->shader;
+    }
+
     s->shader = gl_shader_create(code, code, pre, attr_names);
     if (on_created) on_created(s->shader);
+    shader_save_binary(key, crc, s->shader);
     return s->shader;
 }
@@ -160,3 +160,122 @@ float skybrightness_get_luminance(
     // Convert to nano lambert then cd/m2
     return b_total / 1.11E-15f * NLAMBERT_TO_CDM2;
 }
+
+/*
+ * Lookup table fast path.
+ *
+ * The model above decomposes as:
+ *
+ *   b_total = b_sun(sun_dist, zenith_dist) +
+ *             m(moon_dist) * (1 - bKX(zenith_dist))
+ *
+ * with b_sun the daylight/twilight minimum plus the dark night term,
+ * and m the moon brightness factor.  So one 2d table plus two 1d ones
+ * sample it exactly, up to the interpolation error and the night term
+ * cutoff being evaluated without the moon contribution.
+ */
+
+static float lut_sample1(const float t[SB_LUT_N], float dist)
+{
+    float x, f;
+    int i;
+    x = dist * (SB_LUT_N - 1) / (float)M_PI;
+    i = (int)x;
+    if (i >= SB_LUT_N - 1) return t[SB_LUT_N - 1];
+    f = x - i;
+    return t[i] * (1.f - f) + t[i + 1] * f;
+}
+
+static float lut_sample2(const float t[SB_LUT_N][SB_LUT_N],
+                         float sun_dist, float zen_dist)
+{
+    float x, y, fx, fy;
+    int i, j;
+    x = sun_dist * (SB_LUT_N - 1) / (float)M_PI;
+    y = zen_dist * (SB_LUT_N - 1) / (float)M_PI;
+    i = (int)x;
+    j = (int)y;
+    if (i >= SB_LUT_N - 1) i = SB_LUT_N - 2;
+    if (j >= SB_LUT_N - 1) j = SB_LUT_N - 2;
+    fx = x - i;
+    fy = y - j;
+    return (t[i    ][j] * (1.f - fx) + t[i + 1][j] * fx) * (1.f - fy) +
+           (t[i    ][j + 1] * (1.f - fx) + t[i + 1][j + 1] * fx) * fy;
+}
+
+void skybrightness_lut_prepare(skybrightness_lut_t *lut,
+                               const skybrightness_t *sb)
+{
+    int i, j;
+    float sun_dist, zen_dist, moon_dist, cz, cs, cm, bKX;
+    float FS, FM, b_daylight, b_twilight_k, b_twilight, b;
+
+    if (memcmp(&lut->model, sb, sizeof(*sb)) == 0) return;
+    lut->model = *sb;
+
+    for (j = 0; j < SB_LUT_N; j++) {
+        zen_dist = (float)j / (SB_LUT_N - 1) * (float)M_PI;
+        cz = cosf(zen_dist);
+        bKX = exp10f(-0.4f * sb->K *
+                1.f / (cz + 0.025f * expf(-11.f * cz)));
+        lut->zen[j] = 1.f - bKX;
+
+        for (i = 0; i < SB_LUT_N; i++) {
+            sun_dist = (float)i / (SB_LUT_N - 1) * (float)M_PI;
+            if (sun_dist < 1.f * D2R) sun_dist = 1.f * D2R;
+            cs = cosf(sun_dist);
+
+            FS = 18886.28f / (sun_dist * sun_dist) +
+                 exp10f(6.15f - (sun_dist + 0.001f) * 1.43239f) +
+                 229086.77f * (1.06f + cs * cs);
+            b_daylight = 9.289663e-12f * (1.f - bKX) *
+                 (FS * sb->C4 + 440000.f * (1.f - sb->C4));
+
+            b_twilight_k = sb->b_twilight_term + 0.063661977f *
+                 zen_dist / (sb->K > 0.05f ? sb->K : 0.05f);
+            b_twilight = 0;
+            if (b_twilight_k > -32)
+                b_twilight = exp10f(b_twilight_k) *
+                    (1.7453293f / sun_dist) * (1.f - bKX);
+
+            b = (b_twilight < b_daylight) ? b_twilight : b_daylight;
+
+            // Dark night sky term (the cutoff is evaluated without the
+            // moon contribution).
+            if (b && (sb->b_night_term * bKX) / b > 0.01f) {
+                b += (0.4f + 0.6f / sqrtf(0.04f + 0.96f * cz * cz)) *
+                     sb->b_night_term * bKX;
+                b += 0.0000000000012f;
+            }
+            lut->sun_zen[i][j] = b;
+        }
+    }
+
+    for (i = 0; i < SB_LUT_N; i++) {
+        moon_dist = (float)i / (SB_LUT_N - 1) * (float)M_PI;
+        if (moon_dist < 1.f * D2R) moon_dist = 1.f * D2R;
+        cm = cosf(moon_dist);
+        FM = 18886.28f / (moon_dist * moon_dist) +
+             exp10f(6.15f - moon_dist * 1.43239f) +
+             229086.77f * (1.06f + cm * cm);
+        lut->moon[i] = sb->b_moon_term *
+             (FM * sb->C3 + 440000.f * (1.f - sb->C3)) / 1000000.f;
+    }
+}
+
+float skybrightness_lut_get_luminance(
+        const skybrightness_lut_t *lut,
+        float cos_moon_dist, float cos_sun_dist, float cos_zenith_dist)
+{
+    float b_total;
+    const float zen_dist = fast_acosf(cos_zenith_dist);
+
+    b_total = lut_sample2(lut->sun_zen, acosf(cos_sun_dist), zen_dist) +
+              lut_sample1(lut->moon, acosf(cos_moon_dist)) *
+              lut_sample1(lut->zen, zen_dist);
+
+    if (b_total < 0.f)
+        return 0.f;
+
+    return b_total / 1.11E-15f * NLAMBERT_TO_CDM2;
+}
@@ -46,4 +46,41 @@ float skybrightness_get_luminance(
         const skybrightness_t *sb,
         float cos_moon_dist, float cos_sun_dist, float cos_zenith_dist);
 
+// Resolution of the luminance lookup tables.
+#define SB_LUT_N 64
+
+/*
+ * Type: skybrightness_lut_t
+ * Lookup tables over the luminance model, for the sampling paths.
+ *
+ * The model is separable: a sun-distance x zenith-distance table plus a
+ * moon-distance term scaled by a zenith-distance one.  The tables are
+ * only rebuilt when the model coefficients change.
+ */
+typedef struct skybrightness_lut
+{
+    skybrightness_t model;  // The model the tables were built for.
+    float sun_zen[SB_LUT_N][SB_LUT_N];
+    float moon[SB_LUT_N];
+    float zen[SB_LUT_N];
+} skybrightness_lut_t;
+
+/*
+ * Function: skybrightness_lut_prepare
+ * Rebuild the lookup tables if the model coefficients changed.
+ *
+ * The lut must be zeroed before the first call.
+ */
+void skybrightness_lut_prepare(skybrightness_lut_t *lut,
+                               const skybrightness_t *sb);
+
+/*
+ * Function: skybrightness_lut_get_luminance
+ * Same as <skybrightness_get_luminance> but bilinearly sampled from the
+ * tables.  The analytic version stays as the reference.
+ */
+float skybrightness_lut_get_luminance(
+        const skybrightness_lut_t *lut,
+        float cos_moon_dist, float cos_sun_dist, float cos_zenith_dist);
+
 #endif // SKYBRIGHTNESS_H
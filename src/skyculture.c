@@ -200,6 +200,163 @@ error:
     return -1;
 }
 
+/*
+ * Binary skyculture pack parsing, see tools/make-skyculture-pack.py for
+ * the generator.  Format (everything little endian):
+ *
+ *   char     magic[4]   "SKPK"
+ *   u32      version    1
+ *   u32      strings_size
+ *   char[]   strings    nul terminated strings; offset zero is reserved
+ *                       so that a zero offset means 'no value'.
+ *   u32 x 10 string offsets: id, name, region, introduction,
+ *            description, references, authors, licence, tour (raw json),
+ *            langs_use_native_names ('\0' separated list, double '\0'
+ *            terminated).
+ *   u32      flags      bit 0: fallback_to_international_names.
+ *   u32      nb_names
+ *            nb_names x u32 x 6: main_id, english, native, pronounce,
+ *            description, alt (1 if the entry is an alternative name of
+ *            the previous one).
+ *   u32      nb_constellations
+ *            for each: u32 x 4 (id, iau, img, description), then
+ *            3 x (double uv[2], i32 hip) anchors, then
+ *            u32 nb_lines + nb_lines x (i32, i32), then
+ *            u32 nb_edges + nb_edges x (double ra1, de1, ra2, de2).
+ */
+
+static bool pack_read(const uint8_t *data, int size, int *pos,
+                      void *out, int nb)
+{
+    if (*pos + nb > size) return false;
+    memcpy(out, data + *pos, nb);
+    *pos += nb;
+    return true;
+}
+
+static bool pack_read_u32(const uint8_t *data, int size, int *pos,
+                          uint32_t *out)
+{
+    return pack_read(data, size, pos, out, 4);
+}
+
+// Return a string of the retained block from its offset, NULL if none.
+static const char *pack_str(const char *blk, uint32_t blk_size, uint32_t ofs)
+{
+    if (ofs == 0 || ofs >= blk_size) return NULL;
+    return blk + ofs;
+}
+
+int skyculture_parse_pack(const void *data_, int size,
+                          skyculture_pack_info_t *info)
+{
+    const uint8_t *data = data_;
+    char *blk = NULL;
+    const char *str;
+    uint32_t version, blk_size, ofs[10], flags, nb, nb2, alt, hip;
+    uint32_t strs[6];
+    int pos = 0, i, j;
+    double v[4];
+    skyculture_name_t *entry, *prev_entry = NULL;
+    constellation_infos_t *cst;
+
+    memset(info, 0, sizeof(*info));
+    if (size < 12 || memcmp(data, "SKPK", 4) != 0) goto error;
+    pos = 4;
+    if (!pack_read_u32(data, size, &pos, &version)) goto error;
+    if (version != 1) goto error;
+    if (!pack_read_u32(data, size, &pos, &blk_size)) goto error;
+    if (pos + (int)blk_size > size) goto error;
+
+    // Single allocation retaining all the strings of the culture.
+    blk = malloc(blk_size);
+    memcpy(blk, data + pos, blk_size);
+    pos += blk_size;
+
+    for (i = 0; i < 10; i++)
+        if (!pack_read_u32(data, size, &pos, &ofs[i])) goto error;
+    info->id = pack_str(blk, blk_size, ofs[0]);
+    info->name = pack_str(blk, blk_size, ofs[1]);
+    info->region = pack_str(blk, blk_size, ofs[2]);
+    info->introduction = pack_str(blk, blk_size, ofs[3]);
+    info->description = pack_str(blk, blk_size, ofs[4]);
+    info->references = pack_str(blk, blk_size, ofs[5]);
+    info->authors = pack_str(blk, blk_size, ofs[6]);
+    info->licence = pack_str(blk, blk_size, ofs[7]);
+    info->tour_json = pack_str(blk, blk_size, ofs[8]);
+    info->langs_use_native_names = pack_str(blk, blk_size, ofs[9]);
+    if (!info->id) goto error;
+
+    if (!pack_read_u32(data, size, &pos, &flags)) goto error;
+    info->fallback_to_international_names = flags & 1;
+
+    if (!pack_read_u32(data, size, &pos, &nb)) goto error;
+    for (i = 0; i < nb; i++) {
+        for (j = 0; j < 5; j++)
+            if (!pack_read_u32(data, size, &pos, &strs[j])) goto error;
+        if (!pack_read_u32(data, size, &pos, &alt)) goto error;
+        str = pack_str(blk, blk_size, strs[0]);
+        if (!str) goto error;
+        entry = calloc(1, sizeof(*entry));
+        entry->main_id = (char*)str;
+        entry->name_english = (char*)pack_str(blk, blk_size, strs[1]);
+        entry->name_native = (char*)pack_str(blk, blk_size, strs[2]);
+        entry->name_pronounce = (char*)pack_str(blk, blk_size, strs[3]);
+        entry->name_description = (char*)pack_str(blk, blk_size, strs[4]);
+        if (alt && prev_entry) {
+            prev_entry->alternative = entry;
+        } else {
+            HASH_ADD_KEYPTR(hh, info->names, entry->main_id,
+                            strlen(entry->main_id), entry);
+        }
+        prev_entry = entry;
+    }
+
+    if (!pack_read_u32(data, size, &pos, &nb)) goto error;
+    info->constellations = calloc(nb, sizeof(*info->constellations));
+    for (i = 0; i < nb; i++) {
+        cst = &info->constellations[i];
+        for (j = 0; j < 4; j++)
+            if (!pack_read_u32(data, size, &pos, &strs[j])) goto error;
+        str = pack_str(blk, blk_size, strs[0]);
+        if (!str) goto error;
+        snprintf(cst->id, sizeof(cst->id), "%s", str);
+        str = pack_str(blk, blk_size, strs[1]);
+        if (str) snprintf(cst->iau, sizeof(cst->iau), "%s", str);
+        str = pack_str(blk, blk_size, strs[2]);
+        if (str) snprintf(cst->img, sizeof(cst->img), "%s", str);
+        cst->description = (char*)pack_str(blk, blk_size, strs[3]);
+        for (j = 0; j < 3; j++) {
+            if (!pack_read(data, size, &pos, v, 2 * sizeof(double)))
+                goto error;
+            if (!pack_read_u32(data, size, &pos, &hip)) goto error;
+            vec2_copy(v, cst->anchors[j].uv);
+            cst->anchors[j].hip = hip;
+        }
+        if (!pack_read_u32(data, size, &pos, &nb2)) goto error;
+        if (nb2 > ARRAY_SIZE(cst->lines)) goto error;
+        cst->nb_lines = nb2;
+        for (j = 0; j < nb2; j++)
+            if (!pack_read(data, size, &pos, cst->lines[j], 2 * 4))
+                goto error;
+        if (!pack_read_u32(data, size, &pos, &nb2)) goto error;
+        if (nb2 > ARRAY_SIZE(cst->edges)) goto error;
+        cst->nb_edges = nb2;
+        for (j = 0; j < nb2; j++)
+            if (!pack_read(data, size, &pos, cst->edges[j],
+                           4 * sizeof(double))) goto error;
+        info->nb_constellations++;
+    }
+    return 0;
+
+error:
+    LOG_E("Cannot parse skyculture pack");
+    free(info->constellations);
+    free(blk);
+    memset(info, 0, sizeof(*info));
+    return -1;
+}
+
 skyculture_name_t *skyculture_parse_names_json(const json_value *v)
 {
     int i, j, r;
@@ -94,4 +94,46 @@ int skyculture_parse_feature_json(skyculture_name_t **names_hash,
 
 skyculture_name_t *skyculture_parse_names_json(const json_value *v);
 
+/*
+ * Type: skyculture_pack_info_t
+ * Result of parsing a binary skyculture pack (index.skp file).
+ *
+ * All the strings point into a retained block allocated by
+ * <skyculture_parse_pack>: they stay valid for the life of the program
+ * and must not be freed individually.
+ */
+typedef struct skyculture_pack_info
+{
+    const char *id;
+    const char *name;
+    const char *region;
+    const char *introduction;
+    const char *description;
+    const char *references;
+    const char *authors;
+    const char *licence;
+    const char *tour_json; // Raw json of the tour, or NULL.
+    // '\0' separated list of languages, terminated by a double '\0'.
+    const char *langs_use_native_names;
+    bool fallback_to_international_names;
+    skyculture_name_t *names;
+    constellation_infos_t *constellations;
+    int nb_constellations;
+} skyculture_pack_info_t;
+
+/*
+ * Function: skyculture_parse_pack
+ * Parse a binary skyculture pack, as generated at data build time by
+ * tools/make-skyculture-pack.py.
+ *
+ * The pack is a compiled version of the index.json and description.md
+ * files: loading it is mostly a single copy of the string table, so
+ * that switching skycultures doesn't pay any json or markdown parsing.
+ *
+ * Return:
+ *   0 in case of success, -1 otherwise.
+ */
+int skyculture_parse_pack(const void *data, int size,
+                          skyculture_pack_info_t *info);
+
 #endif // SKYCULTURE_H
@@ -10,6 +10,17 @@
 #include "swe.h"
 #include <sys/time.h>
 
+// The log ring is fed from the worker threads too.
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+static pthread_mutex_t g_log_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOG_LOCK() pthread_mutex_lock(&g_log_mutex)
+#define LOG_UNLOCK() pthread_mutex_unlock(&g_log_mutex)
+#else
+#define LOG_LOCK()
+#define LOG_UNLOCK()
+#endif
+
 #ifndef LOG_TIME
 #   define LOG_TIME 1
 #endif
@@ -32,34 +43,164 @@ static double get_log_time()
     return time - origin;
 }
 
-void dolog(int level, const char *msg,
-           const char *func, const char *file, int line, ...)
+/*
+ * Async logging sink: <dolog> only formats the message body into a slot
+ * of a fixed ring and applies per-site rate limiting; the decoration
+ * (timestamp, colors, padding) and the sys_log call, which crosses into
+ * the js console under emscripten, happen on <log_flush>, called once
+ * per frame from core_update.  This keeps diagnostic logging in hot
+ * paths (e.g. a data source warning per tile) off the frame budget.
+ */
+
+#define LOG_RING_SIZE 128
+#define LOG_MSG_SIZE 224
+// Max messages per emitting site (file:line) per second; errors are
+// never throttled.
+#define LOG_SITE_MAX_PER_SEC 8
+
+typedef struct {
+    int         level;
+    const char  *func, *file;   // Literals from the LOG_X expansion.
+    int         line;
+    double      time;           // Emission time (get_log_time).
+    int         suppressed;     // Site messages throttled before this one.
+    char        msg[LOG_MSG_SIZE];
+} log_entry_t;
+
+static struct {
+    log_entry_t entries[LOG_RING_SIZE];
+    int         read, write;    // Monotonic, wrap with modulo.
+    int         dropped;        // Messages lost to ring overflow.
+    bool        flush_at_exit;  // Set once atexit(log_flush) is in.
+} g_log;
+
+static struct {
+    const char  *file;
+    int         line;
+    double      window;         // Start of the current one second window.
+    int         count;          // Messages emitted in the window.
+    int         suppressed;     // Messages throttled in the window.
+} g_log_sites[64];
+
+/*
+ * Apply the per-site rate limiting.  Return false if the message must be
+ * dropped, else set *suppressed to the number of messages the site
+ * dropped since it last got through.
+ */
+static bool log_site_pass(const char *file, int line, double now,
+                          int *suppressed)
+{
+    typeof(&g_log_sites[0]) site = NULL;
+    int i;
+
+    *suppressed = 0;
+    for (i = 0; i < (int)ARRAY_SIZE(g_log_sites); i++) {
+        if (g_log_sites[i].file == file && g_log_sites[i].line == line) {
+            site = &g_log_sites[i];
+            break;
+        }
+        if (!g_log_sites[i].file) {
+            site = &g_log_sites[i];
+            site->file = file;
+            site->line = line;
+            site->window = now;
+            break;
+        }
+    }
+    if (!site) return true; // Table full: don't throttle.
+    if (now - site->window >= 1.0) {
+        site->window = now;
+        site->count = 0;
+        *suppressed = site->suppressed;
+        site->suppressed = 0;
+    }
+    if (site->count >= LOG_SITE_MAX_PER_SEC) {
+        site->suppressed++;
+        return false;
+    }
+    site->count++;
+    return true;
+}
+
+void log_flush(void)
 {
     const bool use_colors = !DEFINED(__APPLE__) && !DEFINED(__EMSCRIPTEN__);
-    char *msg_formatted, *full_msg;
-    const char *format;
+    const log_entry_t *e;
+    const char *format, *file;
+    char *full_msg;
     char time_str[32] = "";
-    va_list args;
-
-    va_start(args, line);
-    vasprintf(&msg_formatted, msg, args);
-    va_end(args);
+    char suffix[64] = "";
+
+    LOG_LOCK();
+    if (g_log.dropped) {
+        asprintf(&full_msg, "log: %d messages dropped (ring overflow)",
+                 g_log.dropped);
+        sys_log(full_msg);
+        free(full_msg);
+        g_log.dropped = 0;
+    }
 
-    if (use_colors && level >= NOC_LOG_WARN) {
-        format = "\e[33;31m%s%-60s\e[m %s (%s:%d)";
-    } else {
-        format = "%s%-60s %s (%s:%d)";
+    for (; g_log.read != g_log.write; g_log.read++) {
+        e = &g_log.entries[g_log.read % LOG_RING_SIZE];
+        if (use_colors && e->level >= NOC_LOG_WARN) {
+            format = "\e[33;31m%s%-60s\e[m %s (%s:%d)%s";
+        } else {
+            format = "%s%-60s %s (%s:%d)%s";
+        }
+        if (DEFINED(LOG_TIME))
+            snprintf(time_str, sizeof(time_str), "%f: ", e->time);
+        // Truncate file path.
+        file = e->file + max(0, (int)strlen(e->file) - 20);
+        if (e->suppressed)
+            snprintf(suffix, sizeof(suffix), " (%d similar suppressed)",
+                     e->suppressed);
+        else
+            suffix[0] = '\0';
+        asprintf(&full_msg, format, time_str, e->msg, e->func, file,
+                 e->line, suffix);
+        sys_log(full_msg);
+        free(full_msg);
     }
+    LOG_UNLOCK();
+}
+
+void dolog(int level, const char *msg,
+           const char *func, const char *file, int line, ...)
+{
+    log_entry_t *e;
+    double now = get_log_time();
+    int suppressed = 0;
+    va_list args;
 
-    if (DEFINED(LOG_TIME))
-        snprintf(time_str, sizeof(time_str), "%f: ", get_log_time());
+    LOG_LOCK();
+    if (level < NOC_LOG_ERROR &&
+            !log_site_pass(file, line, now, &suppressed)) {
+        LOG_UNLOCK();
+        return;
+    }
 
-    file = file + max(0, (int)strlen(file) - 20); // Truncate file path.
-    asprintf(&full_msg, format, time_str, msg_formatted, func, file, line);
-    sys_log(full_msg);
+    // Cover the binaries without a frame loop (tools, tests).
+    if (!g_log.flush_at_exit) {
+        g_log.flush_at_exit = true;
+        atexit(log_flush);
+    }
 
-    free(msg_formatted);
-    free(full_msg);
+    if (g_log.write - g_log.read == LOG_RING_SIZE) {
+        g_log.read++; // Drop the oldest message.
+        g_log.dropped++;
+    }
+    e = &g_log.entries[g_log.write % LOG_RING_SIZE];
+    e->level = level;
+    e->func = func;
+    e->file = file;
+    e->line = line;
+    e->time = now;
+    e->suppressed = suppressed;
+    va_start(args, line);
+    vsnprintf(e->msg, sizeof(e->msg), msg, args);
+    va_end(args);
+    g_log.write++;
+    LOG_UNLOCK();
 }
 
 /*
@@ -38,6 +38,7 @@
 #include "utils/color.h"
 #include "utils/fader.h"
 #include "utils/gesture.h"
+#include "utils/mem.h"
 #include "utils/progressbar.h"
 #include "utils/texture.h"
 #include "utils/utils.h"
@@ -90,12 +91,22 @@ const char *get_compiler_str(void);
  */
 void swe_gen_doc(void);
 
+/*
+ * Function: swe_bench_ephemeris
+ * Run the ephemeris accuracy-versus-speed benchmark matrix (ns/call and
+ * max error per algorithm and precision setting, over representative
+ * epochs) and return the report as a newly allocated json string.
+ */
+char *swe_bench_ephemeris(void);
+
 
 
 /**************************************************************************/
 
 #include "painter.h"
 #include "oid.h"
+#include "replay.h"
+#include "search.h"
 #include "obj.h"
 #include "core.h"
 #include "gui.h"
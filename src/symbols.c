@@ -11,32 +11,28 @@
 
 static texture_t *g_tex = NULL;
 
-static void glc_paint(const painter_t *painter, const double transf[3][3]);
-static void opc_paint(const painter_t *painter, const double transf[3][3]);
-static void cls_paint(const painter_t *painter, const double transf[3][3]);
-static void   g_paint(const painter_t *painter, const double transf[3][3]);
-static void  pn_paint(const painter_t *painter, const double transf[3][3]);
-static void ism_paint(const painter_t *painter, const double transf[3][3]);
-static void bne_paint(const painter_t *painter, const double transf[3][3]);
-
-// Match the list of svg files in tool/makedata.py.
-// We can probably do better than that.
+// All the symbols live in a single mipmapped 4x4 atlas generated by
+// tools/make-symbols.py, one 64px cell per symbol, indexed by the symbol
+// value minus one.  Each cell covers twice the nominal symbol size, so
+// that the shapes extending past the symbol radius (e.g. the planetary
+// nebula ticks) fit in their cell.  Rendering a symbol is then a single
+// textured quad, and consecutive symbols of the same color batch into
+// one draw call.
 static const struct {
     const char  *id;
     uint32_t    color;
-    void        (*paint)(const painter_t *painter, const double transf[3][3]);
 } ENTRIES[] = {
     [SYMBOL_ARTIFICIAL_SATELLITE]   = {"Ast",  0xff00ffff},
-    [SYMBOL_OPEN_GALACTIC_CLUSTER]  = {"OpC" , 0xF2E9267F, opc_paint},
-    [SYMBOL_GLOBULAR_CLUSTER]       = {"GlC" , 0xF2E9267F, glc_paint},
-    [SYMBOL_GALAXY]                 = {"G"   , 0xFF930E7F,   g_paint},
-    [SYMBOL_INTERACTING_GALAXIES]   = {"IG"  , 0xFF930E7F,   g_paint},
-    [SYMBOL_PLANETARY_NEBULA]       = {"PN"  , 0xF2E9267F,  pn_paint},
-    [SYMBOL_INTERSTELLAR_MATTER]    = {"ISM" , 0xF2E9267F, ism_paint},
-    [SYMBOL_UNKNOWN]                = {"?"   , 0xF2E9267F, ism_paint},
-    [SYMBOL_BRIGHT_NEBULA]          = {"BNe" , 0x89ff5f7f, bne_paint},
-    [SYMBOL_CLUSTER_OF_STARS]       = {"Cl*" , 0x89ff5f7f, cls_paint},
-    [SYMBOL_MULTIPLE_DEFAULT]       = {"mul" , 0x89ff5f7f, opc_paint},
+    [SYMBOL_OPEN_GALACTIC_CLUSTER]  = {"OpC" , 0xF2E9267F},
+    [SYMBOL_GLOBULAR_CLUSTER]       = {"GlC" , 0xF2E9267F},
+    [SYMBOL_GALAXY]                 = {"G"   , 0xFF930E7F},
+    [SYMBOL_INTERACTING_GALAXIES]   = {"IG"  , 0xFF930E7F},
+    [SYMBOL_PLANETARY_NEBULA]       = {"PN"  , 0xF2E9267F},
+    [SYMBOL_INTERSTELLAR_MATTER]    = {"ISM" , 0xF2E9267F},
+    [SYMBOL_UNKNOWN]                = {"?"   , 0xF2E9267F},
+    [SYMBOL_BRIGHT_NEBULA]          = {"BNe" , 0x89ff5f7f},
+    [SYMBOL_CLUSTER_OF_STARS]       = {"Cl*" , 0x89ff5f7f},
+    [SYMBOL_MULTIPLE_DEFAULT]       = {"mul" , 0x89ff5f7f},
 };
 
 static texture_t *get_texture(void)
@@ -72,63 +68,13 @@ int symbols_get_for_otype(const char *type)
     return 0;
 }
 
-static void opc_paint(const painter_t *painter, const double transf[3][3])
-{
-    double dashes = M_PI * 12 / 8;
-    paint_2d_ellipse(painter, transf, dashes, NULL, NULL, NULL);
-}
-
-static void cls_paint(const painter_t *painter, const double transf_[3][3])
-{
-    double transf[3][3];
-    double dashes = M_PI * 12 * 0.8 / 8;
-    mat3_copy(transf_, transf);
-    paint_2d_rect(painter, transf, NULL, NULL);
-    mat3_iscale(transf, 0.8, 0.8, 1);
-    paint_2d_ellipse(painter, transf, dashes, NULL, NULL, NULL);
-}
-
-static void g_paint(const painter_t *painter, const double transf[3][3])
-{
-    // double transf[3][3];
-    // mat4_copy(transf_, transf);
-    // mat4_iscale(transf, 0.5, 1, 1);
-    paint_2d_ellipse(painter, transf, 0, NULL, NULL, NULL);
-}
-
-static void pn_paint(const painter_t *painter, const double transf[3][3])
-{
-    paint_2d_line(painter, transf, VEC(-1.75, 0), VEC(-1, 0));
-    paint_2d_line(painter, transf, VEC(+1, 0), VEC(+1.75, 0));
-    paint_2d_line(painter, transf, VEC(0, -1), VEC(0, -1.75));
-    paint_2d_line(painter, transf, VEC(0, +1), VEC(0, +1.75));
-    paint_2d_ellipse(painter, transf, 0, NULL, NULL, NULL);
-}
-
-static void ism_paint(const painter_t *painter, const double transf[3][3])
-{
-    paint_2d_ellipse(painter, transf, 0, NULL, NULL, NULL);
-}
-
-static void bne_paint(const painter_t *painter, const double transf[3][3])
-{
-    paint_2d_rect(painter, transf, NULL, NULL);
-}
-
-static void glc_paint(const painter_t *painter, const double transf[3][3])
-{
-    paint_2d_ellipse(painter, transf, 0, NULL, NULL, NULL);
-    paint_2d_line(painter, transf, VEC(-1, 0), VEC(1, 0));
-    paint_2d_line(painter, transf, VEC(0, -1), VEC(0, 1));
-}
-
 int symbols_paint(const painter_t *painter_, int symbol,
                   const double pos[2], const double size[2],
                   const double color[4],
                   double angle)
 {
     int i;
-    double uv[4][2], c[4], transf[3][3];
+    double uv[4][2], c[4];
     painter_t painter = *painter_;
     assert(symbol >= 0);
     if (!symbol) return 0;
@@ -136,22 +82,12 @@ int symbols_paint(const painter_t *painter_, int symbol,
         hex_to_rgba(ENTRIES[symbol].color, c);
         color = c;
     }
-    // Procedural symbol.
-    if (ENTRIES[symbol].paint) {
-        vec4_copy(color, painter.color);
-        mat3_set_identity(transf);
-        mat3_itranslate(transf, pos[0], pos[1]);
-        mat3_rz(angle, transf, transf);
-        mat3_iscale(transf, size[0] / 2, size[1] / 2, 1);
-        ENTRIES[symbol].paint(&painter, transf);
-        return 0;
-    }
-
-    // Png symbol.
     for (i = 0; i < 4; i++) {
         uv[i][0] = (((symbol - 1) % 4) + ((3 - i) % 2)) / 4.0;
         uv[i][1] = (((symbol - 1) / 4) + (i / 2)) / 4.0;
     }
-    return paint_texture(&painter, get_texture(), uv, pos, size[0],
+    // The atlas cells cover twice the symbol size (see the ENTRIES
+    // comment), hence the doubled quad.
+    return paint_texture(&painter, get_texture(), uv, pos, size[0] * 2,
                          color, angle);
 }
@@ -142,3 +142,42 @@ void sys_set_translate_function(
 {
     sys_callbacks.translate = callback;
 }
+
+/*
+ * Asynchronous local file reads: the actual read runs in the worker
+ * pool, the caller polls until completion, like for network requests.
+ */
+struct sys_file_req {
+    worker_t    worker;
+    char        *path;
+    void        *data;
+    int         size;
+};
+
+static int file_req_worker(worker_t *w)
+{
+    sys_file_req_t *req = (void*)w;
+    req->data = read_file(req->path, &req->size);
+    return 0;
+}
+
+sys_file_req_t *sys_read_file_async(const char *path)
+{
+    sys_file_req_t *req = calloc(1, sizeof(*req));
+    req->path = strdup(path);
+    worker_init(&req->worker, file_req_worker);
+    return req;
+}
+
+int sys_read_file_async_poll(sys_file_req_t *req, void **data, int *size)
+{
+    int code;
+    if (!worker_iter(&req->worker)) return 0;
+    code = req->data ? 200 : 404;
+    if (data) *data = req->data;
+    else free(req->data);
+    if (size) *size = req->size;
+    free(req->path);
+    free(req);
+    return code;
+}
@@ -115,6 +115,32 @@ const char *sys_get_lang();
 char *sys_render_text(const char *txt, float height, int flags,
                       int *w, int *h, int* xoffset, int* yoffset);
 
+/*
+ * Type: sys_file_req_t
+ * Handle of an asynchronous local file read (see <sys_read_file_async>).
+ */
+typedef struct sys_file_req sys_file_req_t;
+
+/*
+ * Function: sys_read_file_async
+ * Start reading a local file in the worker pool, so that local data
+ * sources don't block the caller any more than network ones.
+ */
+sys_file_req_t *sys_read_file_async(const char *path);
+
+/*
+ * Function: sys_read_file_async_poll
+ * Poll an asynchronous file read.
+ *
+ * Once the read completed the request is freed by this call, and on
+ * success the caller takes ownership of the data.
+ *
+ * Return:
+ *   0 while the read is still running, 200 on success (data and size
+ *   are set), 404 if the file could not be read.
+ */
+int sys_read_file_async_poll(sys_file_req_t *req, void **data, int *size);
+
 /*
  * Global structure that holds pointers to functions that allow to change
  * the behavior of system calls.
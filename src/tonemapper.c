@@ -20,17 +20,31 @@
 void tonemapper_update(tonemapper_t *t,
                        float p, float q, float exposure, float lwmax)
 {
-    if (lwmax != -1) t->lwmax = lwmax;
-    if (exposure != -1) t->exposure = exposure;
-    if (p != -1) t->p = p;
-    if (q != -1) t->q = q;
-    assert(t->q == 1.0);
+    if (lwmax == -1) lwmax = t->lwmax;
+    if (exposure == -1) exposure = t->exposure;
+    if (p == -1) p = t->p;
+    if (q == -1) q = t->q;
+    assert(q == 1.0);
+
+    // Skip the curve recomputation when nothing meaningfully changed
+    // (the eye adaptation feeds a slightly different lwmax every
+    // frame): below 0.1% the difference is not perceivable.
+    if (t->s && p == t->p && exposure == t->exposure &&
+            fabsf(lwmax - t->lwmax) <= 0.001f * t->lwmax)
+        return;
+
+    t->lwmax = lwmax;
+    t->exposure = exposure;
+    t->p = p;
+    t->q = q;
+    t->s = 1.0 / log(1.0 + p * lwmax);
 }
 
 double tonemapper_map(const tonemapper_t *t, double lw)
 {
-    // Assume q = 1, so that we can skip the pow call.
-    return log(1.0 + t->p * lw) / log(1.0 + t->p * t->lwmax) * t->exposure;
+    // Assume q = 1, so that we can skip the pow call.  The denominator
+    // is precomputed in tonemapper_update.
+    return log(1.0 + t->p * lw) * t->s * t->exposure;
 }
 
 double tonemapper_map_log10(const tonemapper_t *t, double log_lw)
@@ -25,7 +25,8 @@ typedef struct tonemapper
     float q;
     float exposure;
 
-    // precomputed terms.
+    // Precomputed 1 / log(1 + p * lwmax) term, so that mapping a
+    // luminance only costs a single log.
     float s;
 } tonemapper_t;
 
@@ -22,16 +22,44 @@ struct item {
 };
 
 struct cache {
+    cache_t *next;      // Global list of all the caches (for the stats).
+    const char *name;
     item_t *items;
     uint64_t clock;
     int size;
     int max_size;
+    int nb_items;
+    // Usage statistics, cumulative since creation.
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t adds;
+    uint64_t evictions;
+    uint64_t age_hist[CACHE_STATS_HIST];
+    uint64_t reuse_hist[CACHE_STATS_HIST];
 };
 
-cache_t *cache_create(int size)
+// All the created caches, so the stats can be reported per instance.
+// Caches are never destroyed.
+static cache_t *g_caches = NULL;
+
+// Index of the log2 histogram bucket for a given distance in accesses.
+static int hist_bucket(uint64_t dist)
+{
+    int b = 0;
+    while (dist > 1 && b < CACHE_STATS_HIST - 1) {
+        dist >>= 1;
+        b++;
+    }
+    return b;
+}
+
+cache_t *cache_create(const char *name, int size)
 {
     cache_t *cache = calloc(1, sizeof(*cache));
+    cache->name = name;
     cache->max_size = size;
+    cache->next = g_caches;
+    g_caches = cache;
     return cache;
 }
 
@@ -44,6 +72,9 @@ static void cleanup(cache_t *cache)
         HASH_DEL(cache->items, item);
         assert(item != cache->items);
         cache->size -= item->cost;
+        cache->nb_items--;
+        cache->evictions++;
+        cache->age_hist[hist_bucket(cache->clock - item->last_used)]++;
         free(item);
         if (cache->size < cache->max_size) return;
     }
@@ -63,13 +94,20 @@ void cache_add(cache_t *cache, const void *key, int len, void *data,
     item->last_used = cache->clock++;
     item->delfunc = delfunc;
     HASH_ADD(hh, cache->items, key, len, item);
+    cache->nb_items++;
+    cache->adds++;
 }
 
 void *cache_get(cache_t *cache, const void *key, int keylen)
 {
     item_t *item;
     HASH_FIND(hh, cache->items, key, keylen, item);
-    if (!item) return NULL;
+    if (!item) {
+        cache->misses++;
+        return NULL;
+    }
+    cache->hits++;
+    cache->reuse_hist[hist_bucket(cache->clock - item->last_used)]++;
     item->last_used = cache->clock++;
     // Reinsert item on top of the hash list so that it stays sorted.
     HASH_DEL(cache->items, item);
@@ -96,3 +134,33 @@ int cache_get_current_size(const cache_t *cache)
 {
     return cache->size;
 }
+
+/*
+ * Function: cache_get_stats
+ * Fill a <cache_stats_t> with the current statistics of a cache.
+ */
+void cache_get_stats(const cache_t *cache, cache_stats_t *stats)
+{
+    stats->name = cache->name;
+    stats->max_size = cache->max_size;
+    stats->size = cache->size;
+    stats->nb_items = cache->nb_items;
+    stats->hits = cache->hits;
+    stats->misses = cache->misses;
+    stats->adds = cache->adds;
+    stats->evictions = cache->evictions;
+    memcpy(stats->age_hist, cache->age_hist, sizeof(stats->age_hist));
+    memcpy(stats->reuse_hist, cache->reuse_hist, sizeof(stats->reuse_hist));
+}
+
+/*
+ * Function: cache_iter_
+ * Iter all the created caches.
+ */
+cache_t *cache_iter_(void **i)
+{
+    cache_t *cache = *i;
+    cache = cache ? cache->next : g_caches;
+    *i = cache;
+    return cache;
+}
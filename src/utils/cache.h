@@ -13,6 +13,8 @@
  * Utils to store values in cache.
  */
 
+#include <stdint.h>
+
 /*
  * Enum: CACHE_KEEP
  * The cache delete function callback can return this value to tell the
@@ -26,18 +28,49 @@
  */
 typedef struct cache cache_t;
 
+/*
+ * Enum: CACHE_STATS_HIST
+ * Number of log2 buckets in the cache statistics histograms.
+ */
+#define CACHE_STATS_HIST 24
+
+/*
+ * Type: cache_stats_t
+ * Usage statistics of a single cache instance, filled by cache_get_stats.
+ *
+ * The histograms are indexed by log2: age_hist counts evictions by the
+ * number of cache accesses since the evicted item was last used, and
+ * reuse_hist counts hits by the number of accesses since the previous use
+ * of the same item.  A reuse distance histogram concentrated well below
+ * the eviction ages means the cache budget can be shrunk; hits near the
+ * eviction ages mean it is too small.
+ */
+typedef struct cache_stats {
+    const char  *name;
+    int         max_size;
+    int         size;
+    int         nb_items;
+    uint64_t    hits;
+    uint64_t    misses;
+    uint64_t    adds;
+    uint64_t    evictions;
+    uint64_t    age_hist[CACHE_STATS_HIST];
+    uint64_t    reuse_hist[CACHE_STATS_HIST];
+} cache_stats_t;
+
 /*
  * Function: cache_create
  * Create a new cache with a given max size.
  *
  * Parameters:
+ *   name - Static string identifying the cache in the statistics report.
  *   size - Maximum cache size.  The unit can be anything, as long as it
  *          stays consistent with the cost argument given in cache_add.
  *
  * Return:
  *   A new cache object.
  */
-cache_t *cache_create(int size);
+cache_t *cache_create(const char *name, int size);
 
 /*
  * Function: cache_add
@@ -79,3 +112,22 @@ void cache_set_cost(cache_t *cache, const void *key, int keylen, int cost);
  */
 int cache_get_current_size(const cache_t *cache);
 
+/*
+ * Function: cache_get_stats
+ * Fill a <cache_stats_t> with the current statistics of a cache.
+ *
+ * The counters are cumulative since the cache creation and never reset:
+ * to get a rate, diff two snapshots.
+ */
+void cache_get_stats(const cache_t *cache, cache_stats_t *stats);
+
+/*
+ * Function: cache_iter_
+ * Iter all the created caches, eg:
+ *
+ *   cache_t *cache = NULL;
+ *   void *i = NULL;
+ *   while ((cache = cache_iter_(&i))) { ... }
+ */
+cache_t *cache_iter_(void **i);
+
@@ -55,12 +55,31 @@ void fader_init2(fader_t *f, bool v, double duration)
     f->duration = duration;
 }
 
+// Number of faders that changed value since the last call to
+// fader_motion_reset.  The core resets it at each frame start and uses
+// it as a global "animation in motion" signal for the frame reuse mode.
+static int g_nb_moving = 0;
+
 bool fader_update(fader_t *f, double dt)
 {
     double speed;
+    bool changed;
+    if (f->value == (f->target ? 1.0 : 0.0)) return false; // Settled.
     if (f->duration <= 0)
         speed = 1. / FADER_DEFAULT_DURATION;
     else
         speed = 1. / f->duration;
-    return move_toward(&f->value, f->target, 0, speed, dt);
+    changed = move_toward(&f->value, f->target, 0, speed, dt);
+    if (changed) g_nb_moving++;
+    return changed;
+}
+
+void fader_motion_reset(void)
+{
+    g_nb_moving = 0;
+}
+
+bool fader_all_settled(void)
+{
+    return g_nb_moving == 0;
 }
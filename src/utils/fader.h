@@ -62,3 +62,17 @@ void fader_init2(fader_t *f, bool v, double duration);
  *   true if the fader value has changed.
  */
 bool fader_update(fader_t *f, double dt);
+
+/*
+ * Function: fader_motion_reset
+ * Start a new frame for the faders motion tracking.  Called by the core
+ * before the module updates.
+ */
+void fader_motion_reset(void);
+
+/*
+ * Function: fader_all_settled
+ * Whether no fader changed value since the last <fader_motion_reset>
+ * call, in which case a static scene can reuse its last frame.
+ */
+bool fader_all_settled(void);
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -51,6 +52,49 @@ int gl_check_errors(const char *file, int line)
     return errors;
 }
 
+bool gl_has_half_float(void)
+{
+    static int has = -1;
+    if (has == -1) {
+#ifdef GLES2
+        const char *ext = (const char*)glGetString(GL_EXTENSIONS);
+        has = (ext && strstr(ext, "OES_vertex_half_float")) ? 1 : 0;
+#else
+        has = 1; // Core since OpenGL 3.0.
+#endif
+    }
+    return has;
+}
+
+static bool gl_has_debug_marker(void)
+{
+    static int has = -1;
+    if (has == -1) {
+        const char *ext = (const char*)glGetString(GL_EXTENSIONS);
+        has = (ext && strstr(ext, "EXT_debug_marker")) ? 1 : 0;
+    }
+    return has;
+}
+
+void gl_push_marker(const char *label)
+{
+#ifdef GL_EXT_debug_marker
+    if (gl_has_debug_marker())
+        glPushGroupMarkerEXT(0, label);
+#else
+    (void)label;
+    (void)gl_has_debug_marker;
+#endif
+}
+
+void gl_pop_marker(void)
+{
+#ifdef GL_EXT_debug_marker
+    if (gl_has_debug_marker())
+        glPopGroupMarkerEXT();
+#endif
+}
+
 static int compile_shader(int shader, const char *code,
                           const char *include1,
                           const char *include2)
@@ -81,6 +125,28 @@ static int compile_shader(int shader, const char *code,
     return 0;
 }
 
+// Enumerate the active uniforms of a linked program.
+static void shader_init_uniforms(gl_shader_t *shader)
+{
+    int i;
+    GLint count;
+    gl_uniform_t *uni;
+
+    GL(glGetProgramiv(shader->prog, GL_ACTIVE_UNIFORMS, &count));
+    for (i = 0; i < count; i++) {
+        uni = &shader->uniforms[i];
+        GL(glGetActiveUniform(shader->prog, i, sizeof(uni->name),
+                              NULL, &uni->size, &uni->type, uni->name));
+        // Special case for array uniforms: remove the '[0]'
+        if (uni->size > 1) {
+            assert(uni->type == GL_FLOAT);
+            if (strchr(uni->name, '['))
+                *strchr(uni->name, '[') = '\0';
+        }
+        GL(uni->loc = glGetUniformLocation(shader->prog, uni->name));
+    }
+}
+
 /*
  * Function: gl_shader_create
  * Helper function that compiles an opengl shader.
@@ -97,12 +163,11 @@ static int compile_shader(int shader, const char *code,
 gl_shader_t *gl_shader_create(const char *vert, const char *frag,
                               const char *include, const char **attr_names)
 {
-    int i, status, len, count;
+    int i, status, len;
     int vertex_shader, fragment_shader;
     char log[1024];
     gl_shader_t *shader;
     GLint prog;
-    gl_uniform_t *uni;
 
     vertex_shader = glCreateShader(GL_VERTEX_SHADER);
     include = include ? : "";
@@ -138,22 +203,53 @@ gl_shader_t *gl_shader_create(const char *vert, const char *frag,
 
     shader = calloc(1, sizeof(*shader));
     shader->prog = prog;
+    shader_init_uniforms(shader);
+    return shader;
+}
 
-    GL(glGetProgramiv(shader->prog, GL_ACTIVE_UNIFORMS, &count));
-    for (i = 0; i < count; i++) {
-        uni = &shader->uniforms[i];
-        GL(glGetActiveUniform(shader->prog, i, sizeof(uni->name),
-                              NULL, &uni->size, &uni->type, uni->name));
-        // Special case for array uniforms: remove the '[0]'
-        if (uni->size > 1) {
-            assert(uni->type == GL_FLOAT);
-            if (strchr(uni->name, '['))
-                *strchr(uni->name, '[') = '\0';
-        }
-        GL(uni->loc = glGetUniformLocation(shader->prog, uni->name));
-    }
+gl_shader_t *gl_shader_from_binary(const void *data, int size, int format)
+{
+#if !defined(GLES2) && defined(GL_PROGRAM_BINARY_LENGTH)
+    GLint status;
+    GLuint prog;
+    gl_shader_t *shader;
 
+    prog = glCreateProgram();
+    glProgramBinary(prog, format, data, size);
+    glGetProgramiv(prog, GL_LINK_STATUS, &status);
+    // The driver is free to reject a binary, e.g. after an update.
+    if (status != GL_TRUE) {
+        glDeleteProgram(prog);
+        return NULL;
+    }
+    shader = calloc(1, sizeof(*shader));
+    shader->prog = prog;
+    shader_init_uniforms(shader);
     return shader;
+#else
+    return NULL;
+#endif
+}
+
+int gl_shader_get_binary(const gl_shader_t *shader, void **data, int *size,
+                         int *format)
+{
+#if !defined(GLES2) && defined(GL_PROGRAM_BINARY_LENGTH)
+    GLint len = 0;
+    GLenum fmt = 0;
+
+    glGetProgramiv(shader->prog, GL_PROGRAM_BINARY_LENGTH, &len);
+    // Flush potential errors if the driver doesn't support it.
+    while (glGetError() != GL_NO_ERROR) {}
+    if (len <= 0) return -1;
+    *data = malloc(len);
+    GL(glGetProgramBinary(shader->prog, len, &len, &fmt, *data));
+    *size = len;
+    *format = fmt;
+    return 0;
+#else
+    return -1;
+#endif
 }
 
 void gl_shader_delete(gl_shader_t *shader)
@@ -170,16 +266,47 @@ void gl_shader_delete(gl_shader_t *shader)
     free(shader);
 }
 
+/*
+ * Pool of released buffer data blocks.  The render items allocate and
+ * release their buffers every frame with sizes taken from a small set of
+ * constants, so recycling the blocks removes almost all the malloc/free
+ * traffic of the render thread.
+ */
+static struct {
+    void *data;
+    int size;
+} g_buf_pool[64];
+
 void gl_buf_alloc(gl_buf_t *buf, const gl_buf_info_t *info, int capacity)
 {
+    int i, size = capacity * info->size;
+
     memset(buf, 0, sizeof(*buf));
     buf->info = info;
-    buf->data = malloc(capacity * info->size);
     buf->capacity = capacity;
+    for (i = 0; i < (int)(sizeof(g_buf_pool) / sizeof(g_buf_pool[0])); i++) {
+        if (g_buf_pool[i].data && g_buf_pool[i].size == size) {
+            buf->data = g_buf_pool[i].data;
+            g_buf_pool[i].data = NULL;
+            return;
+        }
+    }
+    buf->data = malloc(size);
 }
 
 void gl_buf_release(gl_buf_t *buf)
 {
+    int i;
+
+    if (!buf->data) return;
+    for (i = 0; i < (int)(sizeof(g_buf_pool) / sizeof(g_buf_pool[0])); i++) {
+        if (!g_buf_pool[i].data) {
+            g_buf_pool[i].data = buf->data;
+            g_buf_pool[i].size = buf->capacity * buf->info->size;
+            buf->data = NULL;
+            return;
+        }
+    }
     free(buf->data);
 }
 
@@ -198,16 +325,35 @@ static int gl_size_for_type(int type)
     case GL_BYTE: return sizeof(GLbyte);
     case GL_UNSIGNED_BYTE: return sizeof(GLubyte);
     case GL_UNSIGNED_SHORT: return sizeof(GLushort);
+    case GL_HALF_FLOAT: return 2;
     default: assert(false); return -1;
     }
 }
 
+/*
+ * Fast float to half-float conversion.  Denormals and underflows are
+ * flushed to zero, which is fine for the uv and normal values we store
+ * in half precision.
+ */
+static uint16_t float_to_half(float v)
+{
+    uint32_t i;
+    uint16_t h;
+    memcpy(&i, &v, 4);
+    h = ((i >> 16) & 0x8000) |
+        ((((i & 0x7f800000) - 0x38000000) >> 13) & 0x7c00) |
+        ((i >> 13) & 0x03ff);
+    if ((i & 0x7f800000) < 0x38800000) h &= 0x8000;
+    return h;
+}
+
 void *gl_buf_at(gl_buf_t *buf, int idx, int attr)
 {
     return buf->data + idx * buf->info->size + buf->info->attrs[attr].ofs;
 }
 
-static void gl_buf_set(gl_buf_t *buf, int i, int attr, void *v, int size)
+static void gl_buf_set(gl_buf_t *buf, int i, int attr,
+                       const void *v, int size)
 {
     void *dst;
     const __typeof__(buf->info->attrs[attr]) *a;
@@ -218,28 +364,43 @@ static void gl_buf_set(gl_buf_t *buf, int i, int attr, void *v, int size)
     memcpy(dst, v, size);
 }
 
+// Fill an attribute from float values, converting to the attribute
+// storage type (GL_FLOAT or GL_HALF_FLOAT).
+static void gl_buf_set_f(gl_buf_t *buf, int i, int attr,
+                         const float *v, int nb)
+{
+    uint16_t h[4];
+    int k;
+    if (buf->info->attrs[attr].type == GL_HALF_FLOAT) {
+        for (k = 0; k < nb; k++) h[k] = float_to_half(v[k]);
+        gl_buf_set(buf, i, attr, h, nb * 2);
+        return;
+    }
+    gl_buf_set(buf, i, attr, v, nb * 4);
+}
+
 void gl_buf_1f(gl_buf_t *buf, int i, int attr, float v0)
 {
-    gl_buf_set(buf, i, attr, &v0, 4);
+    gl_buf_set_f(buf, i, attr, &v0, 1);
 }
 
 void gl_buf_2f(gl_buf_t *buf, int i, int attr, float v0, float v1)
 {
     float v[2] = {v0, v1};
-    gl_buf_set(buf, i, attr, v, 8);
+    gl_buf_set_f(buf, i, attr, v, 2);
 }
 
 void gl_buf_3f(gl_buf_t *buf, int i, int attr, float v0, float v1, float v2)
 {
     float v[3] = {v0, v1, v2};
-    gl_buf_set(buf, i, attr, v, 12);
+    gl_buf_set_f(buf, i, attr, v, 3);
 }
 
 void gl_buf_4f(gl_buf_t *buf, int i, int attr,
                float v0, float v1, float v2, float v3)
 {
     float v[4] = {v0, v1, v2, v3};
-    gl_buf_set(buf, i, attr, v, 16);
+    gl_buf_set_f(buf, i, attr, v, 4);
 }
 
 void gl_buf_1i(gl_buf_t *buf, int i, int attr, int v0)
@@ -343,3 +504,102 @@ void gl_update_uniform(gl_shader_t *shader, const char *name, ...)
     }
     va_end(args);
 }
+
+/*
+ * Shadow copy of the GL state touched by the render flush loop (see
+ * gl.h).  Unknown entries are re-issued unconditionally.
+ */
+static struct {
+    GLuint  prog;
+    bool    prog_known;
+    GLuint  tex[3];
+    bool    tex_known[3];
+    int     active_unit;
+    bool    active_known;
+    int     caps;       // Bitmask of the enabled tracked caps.
+    int     caps_known; // Bitmask of the caps with a known state.
+    GLenum  blend[4];
+    bool    blend_known;
+    GLenum  cull;
+    bool    cull_known;
+} g_state;
+
+static int gl_state_cap_index(GLenum cap)
+{
+    switch (cap) {
+    case GL_BLEND:      return 0;
+    case GL_DEPTH_TEST: return 1;
+    case GL_CULL_FACE:  return 2;
+    default:            return -1;
+    }
+}
+
+void gl_state_reset(void)
+{
+    memset(&g_state, 0, sizeof(g_state));
+}
+
+void gl_state_use_program(GLuint prog)
+{
+    if (g_state.prog_known && g_state.prog == prog) return;
+    GL(glUseProgram(prog));
+    g_state.prog = prog;
+    g_state.prog_known = true;
+}
+
+void gl_state_bind_texture(int unit, GLuint tex)
+{
+    assert(unit >= 0 &&
+           unit < (int)(sizeof(g_state.tex) / sizeof(g_state.tex[0])));
+    if (g_state.tex_known[unit] && g_state.tex[unit] == tex) return;
+    if (!g_state.active_known || g_state.active_unit != unit) {
+        GL(glActiveTexture(GL_TEXTURE0 + unit));
+        g_state.active_unit = unit;
+        g_state.active_known = true;
+    }
+    GL(glBindTexture(GL_TEXTURE_2D, tex));
+    g_state.tex[unit] = tex;
+    g_state.tex_known[unit] = true;
+}
+
+void gl_state_enable(GLenum cap, bool on)
+{
+    int i = gl_state_cap_index(cap);
+
+    if (i == -1) { // Untracked cap.
+        if (on) GL(glEnable(cap));
+        else    GL(glDisable(cap));
+        return;
+    }
+    if ((g_state.caps_known & (1 << i)) &&
+            !!(g_state.caps & (1 << i)) == on)
+        return;
+    if (on) GL(glEnable(cap));
+    else    GL(glDisable(cap));
+    g_state.caps_known |= 1 << i;
+    if (on) g_state.caps |=  1 << i;
+    else    g_state.caps &= ~(1 << i);
+}
+
+void gl_state_blend_func(GLenum src_rgb, GLenum dst_rgb,
+                         GLenum src_alpha, GLenum dst_alpha)
+{
+    if (    g_state.blend_known &&
+            g_state.blend[0] == src_rgb && g_state.blend[1] == dst_rgb &&
+            g_state.blend[2] == src_alpha && g_state.blend[3] == dst_alpha)
+        return;
+    GL(glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha));
+    g_state.blend[0] = src_rgb;
+    g_state.blend[1] = dst_rgb;
+    g_state.blend[2] = src_alpha;
+    g_state.blend[3] = dst_alpha;
+    g_state.blend_known = true;
+}
+
+void gl_state_cull_face(GLenum mode)
+{
+    if (g_state.cull_known && g_state.cull == mode) return;
+    GL(glCullFace(mode));
+    g_state.cull = mode;
+    g_state.cull_known = true;
+}
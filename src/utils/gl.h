@@ -39,6 +39,16 @@
 #  endif
 #endif
 
+// Half-float vertex attribute type: GL_HALF_FLOAT_OES on GLES2 (from the
+// OES_vertex_half_float extension), core value on desktop.
+#ifndef GL_HALF_FLOAT
+#  ifdef GL_HALF_FLOAT_OES
+#    define GL_HALF_FLOAT GL_HALF_FLOAT_OES
+#  else
+#    define GL_HALF_FLOAT 0x140B
+#  endif
+#endif
+
 #if DEBUG
 #  define GL(line) do {                                 \
        line;                                            \
@@ -51,6 +61,26 @@
 
 int gl_check_errors(const char *file, int line);
 
+/*
+ * Function: gl_has_half_float
+ * Whether GL_HALF_FLOAT vertex attributes can be used.
+ *
+ * Always true on desktop GL; on GLES2 this checks for the
+ * OES_vertex_half_float extension (universally supported on mobile and
+ * WebGL, but better safe).
+ */
+bool gl_has_half_float(void);
+
+/*
+ * Function: gl_push_marker / gl_pop_marker
+ * Emit an EXT_debug_marker group around a batch of gl calls, so that
+ * frame captures (RenderDoc, Spector.js) show labeled groups instead of
+ * an undifferentiated stream of draws.  No-op when the extension is not
+ * available.
+ */
+void gl_push_marker(const char *label);
+void gl_pop_marker(void);
+
 /*
  * Struct: gl_buf_info
  * Describe an OpenGL attribute.
@@ -177,7 +207,53 @@ gl_shader_t *gl_shader_create(const char *vert, const char *frag,
 
 void gl_shader_delete(gl_shader_t *shader);
 
+/*
+ * Function: gl_shader_from_binary
+ * Create a shader from a program binary previously saved with
+ * <gl_shader_get_binary>.
+ *
+ * The attribute bindings of the original link are part of the binary, so
+ * they don't have to be given again.
+ *
+ * Return:
+ *   A new gl_shader_t instance, or NULL if program binaries are not
+ *   supported or if the driver rejects the binary (after a driver update
+ *   typically).
+ */
+gl_shader_t *gl_shader_from_binary(const void *data, int size, int format);
+
+/*
+ * Function: gl_shader_get_binary
+ * Get the compiled program binary of a shader.
+ *
+ * The returned data is allocated with malloc and owned by the caller.
+ *
+ * Return:
+ *   0 in case of success, -1 if program binaries are not supported.
+ */
+int gl_shader_get_binary(const gl_shader_t *shader, void **data, int *size,
+                         int *format);
+
 bool gl_has_uniform(gl_shader_t *shader, const char *name);
 void gl_update_uniform(gl_shader_t *shader, const char *name, ...);
 
+/*
+ * Cached GL state helpers.
+ *
+ * The render flush loop re-issues the same program, texture and blend
+ * state for many consecutive items; these wrappers keep a shadow copy
+ * of the current state and drop the no-op changes, which are a large
+ * part of the driver overhead on some platforms (ANGLE notably).  Code
+ * that changes the state with direct GL calls (nanovg, offscreen
+ * passes) must call <gl_state_reset> afterwards so that the shadow
+ * copy is no longer trusted.
+ */
+void gl_state_reset(void);
+void gl_state_use_program(GLuint prog);
+void gl_state_bind_texture(int unit, GLuint tex);
+void gl_state_enable(GLenum cap, bool on);
+void gl_state_blend_func(GLenum src_rgb, GLenum dst_rgb,
+                         GLenum src_alpha, GLenum dst_alpha);
+void gl_state_cull_face(GLenum mode);
+
 #endif // GL_H
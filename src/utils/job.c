@@ -0,0 +1,303 @@
+/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+#include "job.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+struct job {
+    int     (*fn)(void *user);
+    void    *user;
+    int     ret;
+    int     state;      // 0: pending, 1: running, 2: done.
+    bool    detached;   // Freed by the system on completion.
+    job_t   *next;      // Queue link.
+    job_t   *cont;      // Continuations, scheduled on completion.
+};
+
+#ifdef HAVE_PTHREAD
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_THREADS 16
+
+/*
+ * Per thread queue.  The owner pushes and pops at the head; when its
+ * queue is empty a thread steals from the tail of the other queues.
+ * Everything is protected by one lock per queue, which is enough at our
+ * job granularity (tile decode, inflate, tessellation).
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    job_t           *head, *tail;
+} queue_t;
+
+static queue_t          g_queues[MAX_THREADS];
+static int              g_nb_threads = 0;
+static pthread_mutex_t  g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   g_cond = PTHREAD_COND_INITIALIZER;
+static int              g_next_queue = 0; // Round robin submission.
+static int              g_pending = 0; // Jobs queued, not yet popped.
+
+static int nb_threads(void)
+{
+#ifdef __EMSCRIPTEN__
+    // Match the preallocated pthread pool (PTHREAD_POOL_SIZE): creating
+    // more threads than the pool holds would block the main thread.
+    return 4;
+#else
+    int nb = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nb < 2) nb = 2;
+    if (nb > MAX_THREADS) nb = MAX_THREADS;
+    return nb;
+#endif
+}
+
+static void queue_push(queue_t *q, job_t *job)
+{
+    pthread_mutex_lock(&q->mutex);
+    job->next = q->head;
+    q->head = job;
+    if (!q->tail) q->tail = job;
+    pthread_mutex_unlock(&q->mutex);
+}
+
+// Pop from the head (owner side) or the tail (stealing).
+static job_t *queue_pop(queue_t *q, bool steal)
+{
+    job_t *job, **p;
+    pthread_mutex_lock(&q->mutex);
+    job = steal ? q->tail : q->head;
+    if (job) {
+        for (p = &q->head; *p != job; p = &(*p)->next) {}
+        *p = job->next;
+        if (q->tail == job)
+            for (q->tail = q->head; q->tail && q->tail->next;
+                 q->tail = q->tail->next) {}
+        if (!q->head) q->tail = NULL;
+        job->next = NULL;
+    }
+    pthread_mutex_unlock(&q->mutex);
+    return job;
+}
+
+static void job_schedule(job_t *job)
+{
+    /* The push and the pending count increment happen under g_mutex so
+     * that a worker cannot check the count, miss the broadcast, and go
+     * to sleep on a non empty pool. */
+    pthread_mutex_lock(&g_mutex);
+    g_next_queue = (g_next_queue + 1) % g_nb_threads;
+    queue_push(&g_queues[g_next_queue], job);
+    g_pending++;
+    pthread_cond_broadcast(&g_cond);
+    pthread_mutex_unlock(&g_mutex);
+}
+
+// Run one pending job, stolen from any queue.  Return false if all the
+// queues were empty.
+static bool job_run_one(int self)
+{
+    job_t *job = NULL, *cont, *tmp;
+    int i;
+    bool done;
+
+    job = queue_pop(&g_queues[self % g_nb_threads], false);
+    for (i = 0; !job && i < g_nb_threads; i++)
+        job = queue_pop(&g_queues[i], true);
+    if (!job) return false;
+
+    pthread_mutex_lock(&g_mutex);
+    g_pending--;
+    pthread_mutex_unlock(&g_mutex);
+
+    job->state = 1;
+    job->ret = job->fn(job->user);
+
+    pthread_mutex_lock(&g_mutex);
+    job->state = 2;
+    cont = job->cont;
+    job->cont = NULL;
+    done = job->detached;
+    pthread_mutex_unlock(&g_mutex);
+
+    // Schedule the continuations.
+    while (cont) {
+        tmp = cont->next;
+        cont->next = NULL;
+        job_schedule(cont);
+        cont = tmp;
+    }
+    if (done) free(job);
+    pthread_cond_broadcast(&g_cond);
+    return true;
+}
+
+static void *thread_fn(void *arg)
+{
+    int self = (int)(long)arg;
+    while (true) {
+        if (job_run_one(self)) continue;
+        pthread_mutex_lock(&g_mutex);
+        while (!g_pending)
+            pthread_cond_wait(&g_cond, &g_mutex);
+        pthread_mutex_unlock(&g_mutex);
+    }
+    return NULL;
+}
+
+static void start_threads(void)
+{
+    int i;
+    pthread_t thread;
+    pthread_mutex_lock(&g_mutex);
+    if (!g_nb_threads) {
+        g_nb_threads = nb_threads();
+        for (i = 0; i < g_nb_threads; i++) {
+            pthread_mutex_init(&g_queues[i].mutex, NULL);
+            pthread_create(&thread, NULL, thread_fn, (void*)(long)i);
+            pthread_detach(thread);
+        }
+    }
+    pthread_mutex_unlock(&g_mutex);
+}
+
+job_t *job_submit(int (*fn)(void *user), void *user)
+{
+    job_t *job = calloc(1, sizeof(*job));
+    job->fn = fn;
+    job->user = user;
+    start_threads();
+    job_schedule(job);
+    return job;
+}
+
+job_t *job_submit_then(job_t *dep, int (*fn)(void *user), void *user)
+{
+    job_t *job;
+
+    if (!dep) return job_submit(fn, user);
+    job = calloc(1, sizeof(*job));
+    job->fn = fn;
+    job->user = user;
+    start_threads();
+    pthread_mutex_lock(&g_mutex);
+    if (dep->state != 2) {
+        // Chain on the dependency; scheduled at its completion.
+        job->next = dep->cont;
+        dep->cont = job;
+        pthread_mutex_unlock(&g_mutex);
+        return job;
+    }
+    pthread_mutex_unlock(&g_mutex);
+    job_schedule(job);
+    return job;
+}
+
+bool job_is_done(job_t *job)
+{
+    bool ret;
+    pthread_mutex_lock(&g_mutex);
+    ret = job->state == 2;
+    pthread_mutex_unlock(&g_mutex);
+    return ret;
+}
+
+int job_wait(job_t *job)
+{
+    // Contribute to the pool instead of idling.
+    while (!job_is_done(job)) {
+        if (job_run_one(0)) continue;
+        pthread_mutex_lock(&g_mutex);
+        while (job->state != 2 && !g_pending)
+            pthread_cond_wait(&g_cond, &g_mutex);
+        pthread_mutex_unlock(&g_mutex);
+    }
+    return job->ret;
+}
+
+void job_release(job_t *job)
+{
+    bool done;
+    if (!job) return;
+    pthread_mutex_lock(&g_mutex);
+    done = job->state == 2;
+    if (!done) job->detached = true;
+    pthread_mutex_unlock(&g_mutex);
+    if (done) free(job);
+}
+
+#else // No pthread: everything runs inline at submission.
+
+job_t *job_submit(int (*fn)(void *user), void *user)
+{
+    job_t *job = calloc(1, sizeof(*job));
+    job->ret = fn(user);
+    job->state = 2;
+    return job;
+}
+
+job_t *job_submit_then(job_t *dep, int (*fn)(void *user), void *user)
+{
+    (void)dep; // Always done already.
+    return job_submit(fn, user);
+}
+
+bool job_is_done(job_t *job)
+{
+    return true;
+}
+
+int job_wait(job_t *job)
+{
+    return job->ret;
+}
+
+void job_release(job_t *job)
+{
+    free(job);
+}
+
+#endif
+
+typedef struct {
+    void    (*fn)(int i, void *user);
+    void    *user;
+    int     i;
+} pfor_task_t;
+
+static int pfor_fn(void *user)
+{
+    pfor_task_t *task = user;
+    task->fn(task->i, task->user);
+    return 0;
+}
+
+void job_parallel_for(int n, void (*fn)(int i, void *user), void *user)
+{
+    job_t **jobs;
+    pfor_task_t *tasks;
+    int i;
+
+    if (n <= 0) return;
+    jobs = calloc(n, sizeof(*jobs));
+    tasks = calloc(n, sizeof(*tasks));
+    for (i = 0; i < n; i++) {
+        tasks[i] = (pfor_task_t){.fn = fn, .user = user, .i = i};
+        jobs[i] = job_submit(pfor_fn, &tasks[i]);
+    }
+    for (i = 0; i < n; i++) {
+        job_wait(jobs[i]);
+        job_release(jobs[i]);
+    }
+    free(jobs);
+    free(tasks);
+}
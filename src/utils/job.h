@@ -0,0 +1,76 @@
+/* Stellarium Web Engine - Copyright (c) 2018 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+/*
+ * File: job.h
+ * Small job system with work stealing.
+ *
+ * Jobs are submitted to per thread queues and run on a pool sized to the
+ * hardware threads; idle threads steal from the other queues, so load
+ * storms (tile decode, eph inflate, tessellation) spread over all the
+ * cores instead of piling up behind one.  Without pthread support the
+ * jobs simply run inline at submission.
+ *
+ * The <worker.h> API is implemented on top of this.
+ */
+
+#ifndef JOB_H
+#define JOB_H
+
+#include <stdbool.h>
+
+typedef struct job job_t;
+
+/*
+ * Function: job_submit
+ * Submit a function to be run by the job system.
+ *
+ * Return a handle that must be released with <job_release> once we are
+ * done with it (the job still runs to completion if released early).
+ */
+job_t *job_submit(int (*fn)(void *user), void *user);
+
+/*
+ * Function: job_submit_then
+ * Same as <job_submit>, but the job only starts after an other job
+ * completed (a continuation).  dep can be NULL, in which case this is
+ * the same as <job_submit>.
+ */
+job_t *job_submit_then(job_t *dep, int (*fn)(void *user), void *user);
+
+/*
+ * Function: job_is_done
+ * Return whether a job has completed.
+ */
+bool job_is_done(job_t *job);
+
+/*
+ * Function: job_wait
+ * Block until a job completed, running other pending jobs meanwhile so
+ * that the caller thread contributes instead of idling.
+ *
+ * Return the job function return value.
+ */
+int job_wait(job_t *job);
+
+/*
+ * Function: job_release
+ * Release a job handle.  If the job has not completed yet it is
+ * detached and freed by the system on completion.
+ */
+void job_release(job_t *job);
+
+/*
+ * Function: job_parallel_for
+ * Run fn(i, user) for all i in [0, n), spread over the pool, and wait
+ * for completion (the caller thread participates).
+ */
+void job_parallel_for(int n, void (*fn)(int i, void *user), void *user);
+
+#endif // JOB_H
@@ -0,0 +1,116 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+#include "mem.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK() pthread_mutex_lock(&g_mutex)
+#define UNLOCK() pthread_mutex_unlock(&g_mutex)
+#else
+#define LOCK()
+#define UNLOCK()
+#endif
+
+// Header in front of each tracked block.  16 bytes so that the returned
+// pointer keeps the malloc alignment.
+typedef struct {
+    uint32_t tag;
+    uint32_t pad;
+    uint64_t size;
+} header_t;
+
+static struct {
+    int64_t total;
+    int64_t peak;
+} g_tags[MEM_TAG_COUNT] = {};
+
+static const char *TAG_NAMES[MEM_TAG_COUNT] = {
+    [MEM_TAG_STARS]     = "stars",
+    [MEM_TAG_DSO]       = "dso",
+    [MEM_TAG_HIPS]      = "hips",
+    [MEM_TAG_GEOJSON]   = "geojson",
+    [MEM_TAG_RENDER]    = "render",
+    [MEM_TAG_OTHER]     = "other",
+};
+
+static void account(int tag, int64_t delta)
+{
+    LOCK();
+    g_tags[tag].total += delta;
+    assert(g_tags[tag].total >= 0);
+    if (g_tags[tag].total > g_tags[tag].peak)
+        g_tags[tag].peak = g_tags[tag].total;
+    UNLOCK();
+}
+
+void *mem_alloc(int tag, size_t size)
+{
+    header_t *h;
+    assert(tag >= 0 && tag < MEM_TAG_COUNT);
+    h = malloc(sizeof(*h) + size);
+    if (!h) return NULL;
+    h->tag = tag;
+    h->size = size;
+    account(tag, size);
+    return h + 1;
+}
+
+void *mem_calloc(int tag, size_t nmemb, size_t size)
+{
+    void *ret = mem_alloc(tag, nmemb * size);
+    if (ret) memset(ret, 0, nmemb * size);
+    return ret;
+}
+
+void *mem_realloc(int tag, void *ptr, size_t size)
+{
+    header_t *h;
+
+    if (!ptr) return mem_alloc(tag, size);
+    h = (header_t*)ptr - 1;
+    assert((int)h->tag == tag);
+    account(tag, (int64_t)size - (int64_t)h->size);
+    h = realloc(h, sizeof(*h) + size);
+    if (!h) return NULL;
+    h->size = size;
+    return h + 1;
+}
+
+void mem_free(void *ptr)
+{
+    header_t *h;
+    if (!ptr) return;
+    h = (header_t*)ptr - 1;
+    account(h->tag, -(int64_t)h->size);
+    free(h);
+}
+
+int64_t mem_get_total(int tag)
+{
+    assert(tag >= 0 && tag < MEM_TAG_COUNT);
+    return g_tags[tag].total;
+}
+
+int64_t mem_get_peak(int tag)
+{
+    assert(tag >= 0 && tag < MEM_TAG_COUNT);
+    return g_tags[tag].peak;
+}
+
+const char *mem_tag_name(int tag)
+{
+    assert(tag >= 0 && tag < MEM_TAG_COUNT);
+    return TAG_NAMES[tag];
+}
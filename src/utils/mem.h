@@ -0,0 +1,86 @@
+/* Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+ *
+ * This program is licensed under the terms of the GNU AGPL v3, or
+ * alternatively under a commercial licence.
+ *
+ * The terms of the AGPL v3 license can be found in the main directory of this
+ * repository.
+ */
+
+/*
+ * File: mem.h
+ * Tagged allocation wrappers.
+ *
+ * Subsystems that allocate a lot of memory (tile caches, meshes...) can
+ * go through these wrappers instead of the libc functions, so that their
+ * current usage and high water mark can be read per tag, instead of
+ * watching the process RSS grow opaquely.  The tag and size are stored
+ * in a small header in front of each block, so a block allocated with
+ * <mem_alloc> must be released with <mem_free>.
+ */
+
+#ifndef MEM_H
+#define MEM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Enum: MEM_TAG_*
+ * The tracked subsystems.
+ */
+enum {
+    MEM_TAG_STARS = 0,
+    MEM_TAG_DSO,
+    MEM_TAG_HIPS,
+    MEM_TAG_GEOJSON,
+    MEM_TAG_RENDER,
+    MEM_TAG_OTHER,
+    MEM_TAG_COUNT,
+};
+
+/*
+ * Function: mem_alloc
+ * Same as malloc, with the allocated size accounted to the given tag.
+ */
+void *mem_alloc(int tag, size_t size);
+
+/*
+ * Function: mem_calloc
+ * Same as calloc, with the allocated size accounted to the given tag.
+ */
+void *mem_calloc(int tag, size_t nmemb, size_t size);
+
+/*
+ * Function: mem_realloc
+ * Same as realloc, for a block allocated with <mem_alloc>.  Accepts a
+ * NULL pointer, so growing arrays can start unallocated; the tag must
+ * match the one of the original block.
+ */
+void *mem_realloc(int tag, void *ptr, size_t size);
+
+/*
+ * Function: mem_free
+ * Release a block allocated with one of the wrappers.  Accepts NULL.
+ */
+void mem_free(void *ptr);
+
+/*
+ * Function: mem_get_total
+ * Return the number of bytes currently allocated under a tag.
+ */
+int64_t mem_get_total(int tag);
+
+/*
+ * Function: mem_get_peak
+ * Return the high water mark of a tag, in bytes.
+ */
+int64_t mem_get_peak(int tag);
+
+/*
+ * Function: mem_tag_name
+ * Return the printable name of a tag.
+ */
+const char *mem_tag_name(int tag);
+
+#endif // MEM_H
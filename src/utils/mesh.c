@@ -8,12 +8,16 @@
  */
 
 #include "mesh.h"
+#include "cache.h"
+#include "mem.h"
 #include "earcut.h" // XXX: move into utils.
 #include "vec.h"
 #include "erfa.h" // XXX: to remove, we barely use it here.
 
 #include <float.h>
 #include <stdlib.h>
+#include <string.h>
+#include <zlib.h> // For crc32.
 
 /* Radians to degrees */
 #define DR2D (57.29577951308232087679815)
@@ -25,33 +29,68 @@ static double min(double x, double y)
     return x < y ? x : y;
 }
 
+/*
+ * Bounding cap hierarchy over the triangles, so that the containment
+ * tests used for picking don't walk the whole mesh.  Built lazily on
+ * the first query (see <mesh_contains_vec3>) and dropped on any
+ * geometry change.
+ */
+
+// Don't split a node with that many triangles or less.
+#define BVH_LEAF_SIZE 8
+
+typedef struct bvh_node {
+    double  cap[4];
+    int     children[2]; // Nodes indices, or -1 for a leaf.
+    int     ofs, count;  // Triangle range (in the tris permutation).
+} bvh_node_t;
+
+struct mesh_bvh {
+    bvh_node_t  *nodes;
+    int         nb;
+    int         *tris; // Permutation of the triangle indices.
+};
+
 mesh_t *mesh_create(void)
 {
-    return calloc(1, sizeof(mesh_t));
+    return mem_calloc(MEM_TAG_GEOJSON, 1, sizeof(mesh_t));
+}
+
+static void bvh_delete(struct mesh_bvh *bvh)
+{
+    if (!bvh) return;
+    mem_free(bvh->nodes);
+    mem_free(bvh->tris);
+    mem_free(bvh);
 }
 
 void mesh_delete(mesh_t *mesh)
 {
-    free(mesh->vertices);
-    free(mesh->triangles);
-    free(mesh->lines);
-    free(mesh);
+    if (mesh->refined) mesh_delete(mesh->refined);
+    bvh_delete(mesh->bvh);
+    mem_free(mesh->vertices);
+    mem_free(mesh->triangles);
+    mem_free(mesh->lines);
+    mem_free(mesh);
 }
 
 mesh_t *mesh_copy(const mesh_t *mesh)
 {
-    mesh_t *ret = calloc(1, sizeof(*ret));
+    mesh_t *ret = mem_calloc(MEM_TAG_GEOJSON, 1, sizeof(*ret));
     memcpy(ret->bounding_cap, mesh->bounding_cap, sizeof(mesh->bounding_cap));
     ret->vertices_count = mesh->vertices_count;
     ret->triangles_count = mesh->triangles_count;
     ret->lines_count = mesh->lines_count;
-    ret->vertices = malloc(ret->vertices_count * sizeof(*ret->vertices));
+    ret->vertices = mem_alloc(MEM_TAG_GEOJSON,
+            ret->vertices_count * sizeof(*ret->vertices));
     memcpy(ret->vertices, mesh->vertices,
            ret->vertices_count * sizeof(*ret->vertices));
-    ret->triangles = malloc(ret->triangles_count * sizeof(*ret->triangles));
+    ret->triangles = mem_alloc(MEM_TAG_GEOJSON,
+            ret->triangles_count * sizeof(*ret->triangles));
     memcpy(ret->triangles, mesh->triangles,
            ret->triangles_count * sizeof(*ret->triangles));
-    ret->lines = malloc(ret->lines_count * sizeof(*ret->lines));
+    ret->lines = mem_alloc(MEM_TAG_GEOJSON,
+            ret->lines_count * sizeof(*ret->lines));
     memcpy(ret->lines, mesh->lines, ret->lines_count * sizeof(*ret->lines));
     return ret;
 }
@@ -86,11 +125,28 @@ static void lonlat2c(const double lonlat[2], double c[3])
 }
 
 
+// Record a geometry modification: assign the stable id on the first one,
+// and bump the generation so that renderer side caches get invalidated.
+static void mesh_changed(mesh_t *mesh)
+{
+    static uint64_t g_id = 0;
+    if (!mesh->id) mesh->id = ++g_id;
+    mesh->gen++;
+    // The base geometry changed: drop the refinement cache.
+    if (mesh->refined) {
+        mesh_delete(mesh->refined);
+        mesh->refined = NULL;
+    }
+    bvh_delete(mesh->bvh);
+    mesh->bvh = NULL;
+}
+
 int mesh_add_vertices_lonlat(mesh_t *mesh, int count, double (*verts)[2])
 {
     int i, ofs;
+    mesh_changed(mesh);
     ofs = mesh->vertices_count;
-    mesh->vertices = realloc(mesh->vertices,
+    mesh->vertices = mem_realloc(MEM_TAG_GEOJSON, mesh->vertices,
             (mesh->vertices_count + count) * sizeof(*mesh->vertices));
     for (i = 0; i < count; i++) {
         assert(!isnan(verts[i][0]));
@@ -107,8 +163,9 @@ int mesh_add_vertices_lonlat(mesh_t *mesh, int count, double (*verts)[2])
 int mesh_add_vertices(mesh_t *mesh, int count, double (*verts)[3])
 {
     int ofs;
+    mesh_changed(mesh);
     ofs = mesh->vertices_count;
-    mesh->vertices = realloc(mesh->vertices,
+    mesh->vertices = mem_realloc(MEM_TAG_GEOJSON, mesh->vertices,
             (mesh->vertices_count + count) * sizeof(*mesh->vertices));
     memcpy(mesh->vertices + mesh->vertices_count, verts,
            count * sizeof(*mesh->vertices));
@@ -122,8 +179,9 @@ int mesh_add_vertices(mesh_t *mesh, int count, double (*verts)[3])
 void mesh_add_line(mesh_t *mesh, int ofs, int size)
 {
     int i;
-    mesh->lines = realloc(mesh->lines, (mesh->lines_count + (size - 1) * 2) *
-                          sizeof(*mesh->lines));
+    mesh_changed(mesh);
+    mesh->lines = mem_realloc(MEM_TAG_GEOJSON, mesh->lines,
+            (mesh->lines_count + (size - 1) * 2) * sizeof(*mesh->lines));
     for (i = 0; i < size - 1; i++) {
         mesh->lines[mesh->lines_count + i * 2 + 0] = ofs + i;
         mesh->lines[mesh->lines_count + i * 2 + 1] = ofs + i + 1;
@@ -131,6 +189,28 @@ void mesh_add_line(mesh_t *mesh, int ofs, int size)
     mesh->lines_count += (size - 1) * 2;
 }
 
+void mesh_add_triangles(mesh_t *mesh, int count, const uint16_t *indices)
+{
+    assert(count % 3 == 0);
+    mesh_changed(mesh);
+    mesh->triangles = mem_realloc(MEM_TAG_GEOJSON, mesh->triangles,
+            (mesh->triangles_count + count) * sizeof(*mesh->triangles));
+    memcpy(mesh->triangles + mesh->triangles_count, indices,
+           count * sizeof(*mesh->triangles));
+    mesh->triangles_count += count;
+}
+
+void mesh_add_segments(mesh_t *mesh, int count, const uint16_t *indices)
+{
+    assert(count % 2 == 0);
+    mesh_changed(mesh);
+    mesh->lines = mem_realloc(MEM_TAG_GEOJSON, mesh->lines,
+            (mesh->lines_count + count) * sizeof(*mesh->lines));
+    memcpy(mesh->lines + mesh->lines_count, indices,
+           count * sizeof(*mesh->lines));
+    mesh->lines_count += count;
+}
+
 // Should be in vec.h I guess, but we use eraSepp, so it's not conveniant.
 static void create_rotation_between_vecs(
         double rot[3][3], const double a[3], const double b[3])
@@ -152,39 +232,88 @@ static void create_rotation_between_vecs(
 }
 
 
+/*
+ * Cache of the triangulation results, keyed by a hash of the rings
+ * geometry, so that reloading the same polygons (e.g. a geojson layer)
+ * skips earcut entirely.
+ */
+typedef struct {
+    uint32_t    crc;
+    int         nb_rings;
+    int         nb_verts;
+} tri_cache_key_t;
+
+typedef struct {
+    int         size;
+    uint16_t    indices[];
+} tri_cache_value_t;
+
+static cache_t *g_tri_cache = NULL;
+
+static int tri_cache_del(void *data)
+{
+    free(data);
+    return 0;
+}
+
 void mesh_add_poly(mesh_t *mesh, int nb_rings, const int ofs, const int *size)
 {
-    int r, i, j = 0, triangles_size;
+    int r, i, j = 0, nb_verts = 0, triangles_size;
     double rot[3][3], p[3];
     double (*centered_lonlat)[2];
     const uint16_t *triangles;
     earcut_t *earcut;
-
-    earcut = earcut_new();
-    // Triangulate the shape.
-    // First we rotate the points so that they are centered around the
-    // origin.
-    create_rotation_between_vecs(rot, mesh->bounding_cap, VEC(1, 0, 0));
-
-    for (r = 0; r < nb_rings; r++) {
-        centered_lonlat = calloc(size[r], sizeof(*centered_lonlat));
-        for (i = 0; i < size[r]; i++) {
-            mat3_mul_vec3(rot, mesh->vertices[ofs + j++], p);
-            c2lonlat(p, centered_lonlat[i]);
+    tri_cache_key_t key = {};
+    tri_cache_value_t *value;
+
+    mesh_changed(mesh);
+
+    // Check the triangulation cache first.
+    for (r = 0; r < nb_rings; r++) nb_verts += size[r];
+    key.crc = crc32(0, (const void*)size, nb_rings * sizeof(*size));
+    key.crc = crc32(key.crc, (const void*)&mesh->vertices[ofs],
+                    nb_verts * sizeof(*mesh->vertices));
+    key.nb_rings = nb_rings;
+    key.nb_verts = nb_verts;
+    if (!g_tri_cache) g_tri_cache = cache_create("triangulation", 8 * 1024 * 1024);
+    value = cache_get(g_tri_cache, &key, sizeof(key));
+
+    if (!value) {
+        earcut = earcut_new();
+        // Triangulate the shape.
+        // First we rotate the points so that they are centered around the
+        // origin.
+        create_rotation_between_vecs(rot, mesh->bounding_cap, VEC(1, 0, 0));
+
+        for (r = 0; r < nb_rings; r++) {
+            centered_lonlat = calloc(size[r], sizeof(*centered_lonlat));
+            for (i = 0; i < size[r]; i++) {
+                mat3_mul_vec3(rot, mesh->vertices[ofs + j++], p);
+                c2lonlat(p, centered_lonlat[i]);
+            }
+            earcut_add_poly(earcut, size[r], centered_lonlat);
+            free(centered_lonlat);
         }
-        earcut_add_poly(earcut, size[r], centered_lonlat);
-        free(centered_lonlat);
+
+        triangles = earcut_triangulate(earcut, &triangles_size);
+        value = malloc(sizeof(*value) +
+                       triangles_size * sizeof(*value->indices));
+        value->size = triangles_size;
+        memcpy(value->indices, triangles,
+               triangles_size * sizeof(*value->indices));
+        earcut_delete(earcut);
+        cache_add(g_tri_cache, &key, sizeof(key), value,
+                  sizeof(*value) + triangles_size * sizeof(*value->indices),
+                  tri_cache_del);
     }
 
-    triangles = earcut_triangulate(earcut, &triangles_size);
-    mesh->triangles = realloc(mesh->triangles,
-            (mesh->triangles_count + triangles_size) *
+    mesh->triangles = mem_realloc(MEM_TAG_GEOJSON, mesh->triangles,
+            (mesh->triangles_count + value->size) *
             sizeof(*mesh->triangles));
-    for (i = 0; i < triangles_size; i++) {
-        mesh->triangles[mesh->triangles_count + i] = ofs + triangles[i];
+    for (i = 0; i < value->size; i++) {
+        mesh->triangles[mesh->triangles_count + i] = ofs + value->indices[i];
     }
-    mesh->triangles_count += triangles_size;
-    earcut_delete(earcut);
+    mesh->triangles_count += value->size;
 }
 
 
@@ -202,6 +331,123 @@ static bool triangle_contains_vec3(const double verts[][3],
     return true;
 }
 
+static void bvh_triangle_centroid(const mesh_t *mesh, int tri, double out[3])
+{
+    int i;
+    vec3_set(out, 0, 0, 0);
+    for (i = 0; i < 3; i++)
+        vec3_add(out, mesh->vertices[mesh->triangles[tri * 3 + i]], out);
+    vec3_normalize(out, out);
+}
+
+// Bounding cap of a range of triangles of the permutation.
+static void bvh_compute_cap(const mesh_t *mesh, const struct mesh_bvh *bvh,
+                            int ofs, int count, double cap[4])
+{
+    int i, j;
+    const double *v;
+
+    vec4_set(cap, 0, 0, 0, 1);
+    for (i = 0; i < count; i++)
+        for (j = 0; j < 3; j++)
+            vec3_add(cap, mesh->vertices[
+                     mesh->triangles[bvh->tris[ofs + i] * 3 + j]], cap);
+    vec3_normalize(cap, cap);
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < 3; j++) {
+            v = mesh->vertices[mesh->triangles[bvh->tris[ofs + i] * 3 + j]];
+            cap[3] = min(cap[3], vec3_dot(cap, v));
+        }
+    }
+}
+
+// Build one node over a triangle range, return its index.
+static int bvh_build_node(const mesh_t *mesh, struct mesh_bvh *bvh,
+                          int ofs, int count)
+{
+    int idx, axis, i, j, left, tmp;
+    double c[3], mean, extent, best_extent;
+    double mins[3] = {DBL_MAX, DBL_MAX, DBL_MAX};
+    double maxs[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+
+    idx = bvh->nb++;
+    bvh->nodes = mem_realloc(MEM_TAG_GEOJSON, bvh->nodes,
+                             bvh->nb * sizeof(*bvh->nodes));
+    bvh_compute_cap(mesh, bvh, ofs, count, bvh->nodes[idx].cap);
+    bvh->nodes[idx].ofs = ofs;
+    bvh->nodes[idx].count = count;
+    bvh->nodes[idx].children[0] = bvh->nodes[idx].children[1] = -1;
+    if (count <= BVH_LEAF_SIZE) return idx;
+
+    // Split along the axis of largest centroid extent, at the mean.
+    for (i = 0; i < count; i++) {
+        bvh_triangle_centroid(mesh, bvh->tris[ofs + i], c);
+        for (j = 0; j < 3; j++) {
+            mins[j] = min(mins[j], c[j]);
+            if (c[j] > maxs[j]) maxs[j] = c[j];
+        }
+    }
+    axis = 0;
+    best_extent = -1;
+    for (j = 0; j < 3; j++) {
+        extent = maxs[j] - mins[j];
+        if (extent > best_extent) {
+            best_extent = extent;
+            axis = j;
+        }
+    }
+    mean = (mins[axis] + maxs[axis]) / 2;
+    for (i = 0, left = 0; i < count; i++) {
+        bvh_triangle_centroid(mesh, bvh->tris[ofs + i], c);
+        if (c[axis] < mean) {
+            tmp = bvh->tris[ofs + left];
+            bvh->tris[ofs + left] = bvh->tris[ofs + i];
+            bvh->tris[ofs + i] = tmp;
+            left++;
+        }
+    }
+    // Degenerate split (all the centroids on one side): cut in half.
+    if (left == 0 || left == count) left = count / 2;
+
+    // The children realloc the nodes array: don't keep a pointer.
+    i = bvh_build_node(mesh, bvh, ofs, left);
+    j = bvh_build_node(mesh, bvh, ofs + left, count - left);
+    bvh->nodes[idx].children[0] = i;
+    bvh->nodes[idx].children[1] = j;
+    return idx;
+}
+
+static struct mesh_bvh *bvh_build(const mesh_t *mesh)
+{
+    struct mesh_bvh *bvh;
+    int i, count = mesh->triangles_count / 3;
+
+    bvh = mem_calloc(MEM_TAG_GEOJSON, 1, sizeof(*bvh));
+    bvh->tris = mem_alloc(MEM_TAG_GEOJSON, count * sizeof(*bvh->tris));
+    for (i = 0; i < count; i++) bvh->tris[i] = i;
+    bvh_build_node(mesh, bvh, 0, count);
+    return bvh;
+}
+
+static bool bvh_contains_vec3(const mesh_t *mesh, const struct mesh_bvh *bvh,
+                              int node, const double pos[3])
+{
+    const bvh_node_t *n = &bvh->nodes[node];
+    int i;
+
+    if (!cap_contains_vec3(n->cap, pos)) return false;
+    if (n->children[0] == -1) {
+        for (i = 0; i < n->count; i++) {
+            if (triangle_contains_vec3(mesh->vertices,
+                    mesh->triangles + bvh->tris[n->ofs + i] * 3, pos))
+                return true;
+        }
+        return false;
+    }
+    return bvh_contains_vec3(mesh, bvh, n->children[0], pos) ||
+           bvh_contains_vec3(mesh, bvh, n->children[1], pos);
+}
+
 /*
  * Function: mesh_contains_vec3
  * Test if a 3d direction vector intersects a 3d mesh.
@@ -211,6 +457,13 @@ bool mesh_contains_vec3(const mesh_t *mesh, const double pos[3])
     int i;
     if (!cap_contains_vec3(mesh->bounding_cap, pos))
         return false;
+    // Go through the bvh for the large meshes, so that hover picking
+    // over a dense layer stays logarithmic.
+    if (mesh->triangles_count / 3 > 2 * BVH_LEAF_SIZE) {
+        if (!mesh->bvh)
+            ((mesh_t*)mesh)->bvh = bvh_build(mesh);
+        return bvh_contains_vec3(mesh, mesh->bvh, 0, pos);
+    }
     for (i = 0; i < mesh->triangles_count; i += 3) {
         if (triangle_contains_vec3(mesh->vertices, mesh->triangles + i, pos))
             return true;
@@ -220,7 +473,7 @@ bool mesh_contains_vec3(const mesh_t *mesh, const double pos[3])
 
 static void mesh_add_triangle(mesh_t *mesh, int a, int b, int c)
 {
-    mesh->triangles = realloc(mesh->triangles,
+    mesh->triangles = mem_realloc(MEM_TAG_GEOJSON, mesh->triangles,
                                 (mesh->triangles_count + 3) *
                                 sizeof(*mesh->triangles));
     mesh->triangles[mesh->triangles_count + 0] = a;
@@ -282,6 +535,7 @@ static void mesh_cut_triangle_antimeridian(mesh_t *mesh, int idx)
 void mesh_cut_antimeridian(mesh_t *mesh)
 {
     int i, count;
+    mesh_changed(mesh);
     count = mesh->triangles_count;
     for (i = 0; i < count; i += 3) {
         mesh_cut_triangle_antimeridian(mesh, i);
@@ -350,7 +604,24 @@ static void mesh_subdivide_triangle(mesh_t *mesh, int idx, double max_length)
 void mesh_subdivide(mesh_t *mesh, double max_length)
 {
     int i;
+    mesh_changed(mesh);
     for (i = 0; i < mesh->triangles_count; i += 3) {
         mesh_subdivide_triangle(mesh, i, max_length);
     }
 }
+
+const mesh_t *mesh_get_refined(mesh_t *mesh, double max_length)
+{
+    // Snap to a power of two, so that small view changes keep hitting
+    // the cached refinement.
+    max_length = pow(2, floor(log2(max_length)));
+    if (mesh->refined && mesh->refined_max_length <= max_length)
+        return mesh->refined;
+    if (!mesh->refined)
+        mesh->refined = mesh_copy(mesh);
+    // Refine the current copy further: midpoint subdivision is
+    // incremental, so we never restart from the base.
+    mesh_subdivide(mesh->refined, max_length);
+    mesh->refined_max_length = max_length;
+    return mesh->refined;
+}
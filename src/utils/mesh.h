@@ -20,6 +20,11 @@
 typedef struct mesh mesh_t;
 struct mesh {
     mesh_t      *next, *prev; // Can be used to put mesh inside geojson.
+    // Stable identity, for renderer side buffer retention: id is assigned
+    // on the first mutation and never changes, gen is bumped every time
+    // the geometry is modified.  Copies get a new id.
+    uint64_t    id;
+    uint32_t    gen;
     double      bounding_cap[4];
     int         vertices_count;
     double      (*vertices)[3];
@@ -27,6 +32,16 @@ struct mesh {
     uint16_t    *triangles;
     int         lines_count; // Number of lines * 2.
     uint16_t    *lines;
+
+    // Refinement cache used by <mesh_get_refined>: a subdivided copy of
+    // the mesh, kept across frames, and the max edge length it was
+    // built for.  Dropped when the base geometry changes.
+    mesh_t      *refined;
+    double      refined_max_length;
+
+    // Triangle bvh used by <mesh_contains_vec3>, built lazily on the
+    // first containment test and dropped when the geometry changes.
+    struct mesh_bvh *bvh;
 };
 
 mesh_t *mesh_create(void);
@@ -38,6 +53,21 @@ int mesh_add_vertices_lonlat(mesh_t *mesh, int count, double (*verts)[2]);
 void mesh_add_line(mesh_t *mesh, int ofs, int size);
 void mesh_add_poly(mesh_t *mesh, int nb_rings, const int ofs, const int *size);
 
+/*
+ * Function: mesh_add_triangles
+ * Append precomputed triangle indices (3 per triangle).
+ *
+ * Used when loading pre-tessellated meshes, so that no triangulation
+ * runs on the client.
+ */
+void mesh_add_triangles(mesh_t *mesh, int count, const uint16_t *indices);
+
+/*
+ * Function: mesh_add_segments
+ * Append precomputed line segment indices (2 per segment).
+ */
+void mesh_add_segments(mesh_t *mesh, int count, const uint16_t *indices);
+
 /*
  * Function: mesh_contains_vec3
  * Test if a 3d direction vector intersects a 3d mesh.
@@ -58,4 +88,23 @@ void mesh_cut_antimeridian(mesh_t *mesh);
  */
 void mesh_subdivide(mesh_t *mesh, double max_length);
 
+/*
+ * Function: mesh_get_refined
+ * Return a subdivided version of the mesh, for rendering.
+ *
+ * The refinement is incremental and cached: the max length is snapped
+ * to a power of two, the subdivided copy is kept across frames, and it
+ * is only refined further when a smaller max length is requested, so
+ * the per frame cost is zero once the view settles.  The base mesh is
+ * never modified.
+ *
+ * Parameters:
+ *   mesh       - The base mesh.
+ *   max_length - Max edge length (rad) tolerated this frame.
+ *
+ * Return:
+ *   The subdivided mesh, owned by the base mesh.
+ */
+const mesh_t *mesh_get_refined(mesh_t *mesh, double max_length);
+
 #endif // MESH_H
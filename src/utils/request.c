@@ -10,16 +10,20 @@
 #ifndef NO_LIBCURL
 
 #include "request.h"
+#include "utlist.h"
 #include "utstring.h"
 
 #include <assert.h>
 #include <curl/curl.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <regex.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 #ifndef LOG_E
 #   define LOG_E
@@ -29,13 +33,15 @@
 #   define PATH_MAX 1024
 #endif
 
-#define MAX_NB  16
+#define MAX_NB  16          // Max number of parallel transfers.
+#define MAX_PER_HOST 6      // Max number of parallel connections per host.
 
 // static data.
 static struct {
     CURLM        *curlm;
     char         *cache_dir;
     int          nb; // Number of current running handles.
+    struct request *pending; // Requests waiting for a transfer slot.
 } g = {};
 
 struct request
@@ -47,12 +53,18 @@ struct request
     long        status_code;    // HTTP status code
     void        *data;          // Actual data.
     int         size;
+    bool        mapped;         // Set if data is memory-mapped.
     bool        done;           // Request finished
     char        *local_path;    // Data saved to this file
 
     struct curl_slist *headers;
     char        *etag;
     double      expiration;     // Unix time expiration date.
+
+    int         priority;       // One of REQUEST_PRIORITY.
+    double      last_polled;    // Unix time of the last get call.
+    bool        queued;         // Set while in the pending list.
+    struct request *next, *prev;
 };
 
 static const char *request_get_file(request_t *req, int *status_code);
@@ -79,6 +91,34 @@ static void *read_file(const char *path, int *size)
     return ret;
 }
 
+/*
+ * Serve a disk cache hit with mmap, so that cached tiles reach the create
+ * tile callbacks without any copy.  We rely on the kernel zero-filling the
+ * last page past the end of the file to get the trailing NUL byte that
+ * text consumers expect, so we decline files whose size is an exact
+ * multiple of the page size (the caller then falls back to read_file).
+ */
+static void *map_file(const char *path, int *size)
+{
+    int fd;
+    struct stat st;
+    long page_size = sysconf(_SC_PAGESIZE);
+    void *ptr;
+
+    fd = open(path, O_RDONLY);
+    if (fd == -1) return NULL;
+    if (fstat(fd, &st) != 0 || st.st_size == 0 ||
+            st.st_size % page_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    ptr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) return NULL;
+    *size = st.st_size;
+    return ptr;
+}
+
 static double get_unix_time(void)
 {
     struct timeval tv;
@@ -130,7 +170,20 @@ static char *create_local_path(const char *url, const char *suffix)
 void request_init(const char *cache_dir)
 {
     assert(cache_dir);
-    if (!g.curlm) g.curlm = curl_multi_init();
+    if (!g.curlm) {
+        g.curlm = curl_multi_init();
+        // Reuse connections as much as possible: multiplex requests over
+        // a bounded number of connections per host (HTTP/2 when the
+        // server supports it), so that hundreds of small tile fetches
+        // don't each pay a connection setup.
+#ifdef CURLPIPE_MULTIPLEX
+        curl_multi_setopt(g.curlm, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071e00 // 7.30.0
+        curl_multi_setopt(g.curlm, CURLMOPT_MAX_HOST_CONNECTIONS,
+                          (long)MAX_PER_HOST);
+#endif
+    }
     free(g.cache_dir);
     g.cache_dir = strdup(cache_dir);
 }
@@ -144,6 +197,7 @@ request_t *request_create(const char *url)
     int r;
     request_t *req = calloc(1, sizeof(*req));
     req->url = strdup(url);
+    req->priority = REQUEST_PRIORITY_NORMAL;
 
     assert(strchr(url, ':')); // Make sure we have a protocol.
 
@@ -174,8 +228,17 @@ request_t *request_create(const char *url)
 void request_delete(request_t *req)
 {
     if (!req) return;
-    if (req->handle) LOG_E("Aborting request not implemented yet!");
-    if (req->data != utstring_body(&req->data_buf)) free(req->data);
+    if (req->queued) DL_DELETE(g.pending, req);
+    // Abort the transfer if it is still in flight, so deleting the
+    // request (e.g. a tile evicted from the cache) frees the slot and
+    // the bandwidth immediately.
+    if (req->handle) {
+        curl_multi_remove_handle(g.curlm, req->handle);
+        curl_easy_cleanup(req->handle);
+        g.nb--;
+    }
+    if (req->mapped) munmap(req->data, req->size);
+    else if (req->data != utstring_body(&req->data_buf)) free(req->data);
     utstring_done(&req->data_buf);
     utstring_done(&req->header_buf);
     free(req->url);
@@ -194,7 +257,7 @@ static void save_cache(const char *url, const char *path, const char *etag,
     r = asprintf(&info_path, "%s.info", path);
     if (r == -1) LOG_E("Error");
     file = fopen(info_path, "w");
-    fprintf(file, "etag: %s\n", etag);
+    if (etag) fprintf(file, "etag: %s\n", etag);
     fprintf(file, "expiration: %.0f\n", expiration);
     fclose(file);
     free(info_path);
@@ -250,8 +313,8 @@ static void on_done(request_t *req)
         req->expiration = get_unix_time() + atof(buf);
     }
     // For the moment we save all the files in the cache as long as they
-    // have an etag.  We also never clean the cache!
-    if (req->etag) {
+    // have an etag or an expiration date.  We also never clean the cache!
+    if (req->etag || req->expiration) {
         path = request_get_file(req, NULL);
         save_cache(req->url, path, req->etag, req->expiration);
     }
@@ -260,6 +323,81 @@ end:
     return;
 }
 
+static size_t write_callback(
+        char *ptr, size_t size, size_t nmemb, void *userdata)
+{
+    UT_string *buf = userdata;
+    size_t len = size * nmemb;
+    utstring_bincpy(buf, ptr, len);
+    return len;
+}
+
+static void start_transfer(request_t *req)
+{
+    int r;
+    char *tmp;
+
+    req->handle = curl_easy_init();
+    utstring_init(&req->data_buf);
+    utstring_init(&req->header_buf);
+    curl_easy_setopt(req->handle, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(req->handle, CURLOPT_WRITEDATA, &req->data_buf);
+    curl_easy_setopt(req->handle, CURLOPT_HEADERDATA, &req->header_buf);
+    curl_easy_setopt(req->handle, CURLOPT_URL, req->url);
+    curl_easy_setopt(req->handle, CURLOPT_FAILONERROR, 1);
+    curl_easy_setopt(req->handle, CURLOPT_PRIVATE, req);
+    curl_easy_setopt(req->handle, CURLOPT_FOLLOWLOCATION, 1);
+    curl_easy_setopt(req->handle, CURLOPT_SSL_VERIFYPEER, 0);
+    curl_easy_setopt(req->handle, CURLOPT_SSL_VERIFYHOST, 0);
+    // curl_easy_setopt(req->handle, CURLOPT_VERBOSE, 1);
+    if (req->etag) {
+        r = asprintf(&tmp, "If-None-Match: \"%s\"", req->etag);
+        if (r == -1) LOG_E("Error");
+        req->headers = curl_slist_append(req->headers, tmp);
+        free(tmp);
+    }
+    if (req->headers)
+        curl_easy_setopt(req->handle, CURLOPT_HTTPHEADER, req->headers);
+
+    curl_multi_add_handle(g.curlm, req->handle);
+    g.nb++;
+}
+
+/*
+ * Effective priority of a pending request.  A request that nobody polled
+ * recently (e.g. a tile that left the visible set during navigation)
+ * sinks below every live one, so bandwidth goes to the tiles that will
+ * actually be shown.  The caller keeps polling visible tiles every
+ * frame, so this only needs the last get time.
+ */
+static int effective_priority(const request_t *req, double now)
+{
+    if (now - req->last_polled > 0.5) return REQUEST_PRIORITY_LOW - 1;
+    return req->priority;
+}
+
+/*
+ * Fill the free transfer slots from the pending list, highest priority
+ * first.  The priority is re-read at each slot fill, so changing the
+ * priority of a queued request takes effect immediately.
+ */
+static void start_pending(void)
+{
+    request_t *req, *best;
+    double now = get_unix_time();
+
+    while (g.nb < MAX_NB && g.pending) {
+        best = g.pending;
+        DL_FOREACH(g.pending, req) {
+            if (effective_priority(req, now) > effective_priority(best, now))
+                best = req;
+        }
+        DL_DELETE(g.pending, best);
+        best->queued = false;
+        start_transfer(best);
+    }
+}
+
 static void update(void)
 {
     int nb, msgs_in_queue;
@@ -268,10 +406,12 @@ static void update(void)
     request_t *req;
     static double last = 0;
 
+    assert(g.curlm);
+    start_pending();
+
     // Avoid loading too many resources too fast to keep a good framerate.
     if ((get_unix_time() - last) < 16.0 / 1000) return;
 
-    assert(g.curlm);
     curl_multi_perform(g.curlm, &nb);
     if (nb == g.nb) return;
     while ((msg = curl_multi_info_read(g.curlm, &msgs_in_queue))) {
@@ -302,51 +442,23 @@ static void update(void)
     }
 }
 
-static size_t write_callback(
-        char *ptr, size_t size, size_t nmemb, void *userdata)
-{
-    UT_string *buf = userdata;
-    size_t len = size * nmemb;
-    utstring_bincpy(buf, ptr, len);
-    return len;
-}
-
 static void req_update(request_t *req)
 {
-    int r;
-    char *tmp;
     assert(g.curlm); // Check that request_init was called!
+    req->last_polled = get_unix_time();
     if (req->done) return;
-    if (!req->handle && g.nb < MAX_NB) {
-        req->handle = curl_easy_init();
-        utstring_init(&req->data_buf);
-        utstring_init(&req->header_buf);
-        curl_easy_setopt(req->handle, CURLOPT_WRITEFUNCTION, write_callback);
-        curl_easy_setopt(req->handle, CURLOPT_WRITEDATA, &req->data_buf);
-        curl_easy_setopt(req->handle, CURLOPT_HEADERDATA, &req->header_buf);
-        curl_easy_setopt(req->handle, CURLOPT_URL, req->url);
-        curl_easy_setopt(req->handle, CURLOPT_FAILONERROR, 1);
-        curl_easy_setopt(req->handle, CURLOPT_PRIVATE, req);
-        curl_easy_setopt(req->handle, CURLOPT_FOLLOWLOCATION, 1);
-        curl_easy_setopt(req->handle, CURLOPT_SSL_VERIFYPEER, 0);
-        curl_easy_setopt(req->handle, CURLOPT_SSL_VERIFYHOST, 0);
-        // curl_easy_setopt(req->handle, CURLOPT_VERBOSE, 1);
-        if (req->etag) {
-            r = asprintf(&tmp, "If-None-Match: \"%s\"", req->etag);
-            if (r == -1) LOG_E("Error");
-            req->headers = curl_slist_append(req->headers, tmp);
-            free(tmp);
-        }
-        if (req->headers)
-            curl_easy_setopt(req->handle, CURLOPT_HTTPHEADER, req->headers);
-
-        curl_multi_add_handle(g.curlm, req->handle);
-        g.nb++;
+    if (!req->handle && !req->queued) {
+        DL_APPEND(g.pending, req);
+        req->queued = true;
     }
-
     update();
 }
 
+void request_set_priority(request_t *req, int priority)
+{
+    req->priority = priority;
+}
+
 static const char *request_get_file(request_t *req, int *status_code)
 {
     FILE *file;
@@ -373,14 +485,27 @@ const void *request_get_data(request_t *req, int *size, int *status_code)
         if (size) *size = 0;
         return NULL;
     }
-    // Local file, copy it into the data buffer.
+    // Local file: serve it with mmap when possible, else copy it.
     if (!req->data && req->local_path) {
-        req->data = read_file(req->local_path, &req->size);
+        req->data = map_file(req->local_path, &req->size);
+        if (req->data) req->mapped = true;
+        else req->data = read_file(req->local_path, &req->size);
     }
     if (size) *size = req->size;
     return req->data;
 }
 
+const void *request_get_partial_data(request_t *req, int *size)
+{
+    req_update(req);
+    if (req->done || !req->handle) {
+        if (size) *size = 0;
+        return NULL;
+    }
+    if (size) *size = utstring_len(&req->data_buf);
+    return utstring_body(&req->data_buf);
+}
+
 void request_make_fresh(request_t *req)
 {
     free(req->etag);
@@ -418,6 +543,16 @@ const void *request_get_data(request_t *req, int *size, int *status_code)
     return NULL;
 }
 
+void request_set_priority(request_t *req, int priority)
+{
+}
+
+const void *request_get_partial_data(request_t *req, int *size)
+{
+    *size = 0;
+    return NULL;
+}
+
 #endif // REQUEST_DUMMY
 
 #endif // NO_LIBCURL
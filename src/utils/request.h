@@ -10,9 +10,33 @@
 
 typedef struct request request_t;
 
+/*
+ * Enum: REQUEST_PRIORITY
+ * Priority lanes of the download manager: pending requests are started
+ * highest priority first when a transfer slot becomes free.  Useful to
+ * keep speculative prefetches behind on-screen tiles.
+ */
+enum {
+    REQUEST_PRIORITY_LOW    = 0,
+    REQUEST_PRIORITY_NORMAL = 1,
+    REQUEST_PRIORITY_HIGH   = 2,
+};
+
 void request_init(const char *cache_dir);
 request_t *request_create(const char *url);
 void request_delete(request_t *req);
 const void *request_get_data(request_t *req, int *size, int *status_code);
+// Get the bytes received so far of a transfer still in flight, so that
+// decoders supporting streams can overlap decode and download.  Returns
+// NULL once the request is done (use request_get_data) or before the
+// transfer started.  The returned buffer grows in place between calls.
+const void *request_get_partial_data(request_t *req, int *size);
 // Don't use cache even if we have a local copy.
 void request_make_fresh(request_t *req);
+// Set the priority lane of a request (default REQUEST_PRIORITY_NORMAL).
+// Can be called again at any time to repriorize a queued request; it has
+// no effect once the transfer started.  Queued requests that stop being
+// polled sink below every lane until they are polled again, and deleting
+// a request aborts its transfer, so the visible set effectively drives
+// the download queue.
+void request_set_priority(request_t *req, int priority);
@@ -134,8 +134,20 @@ const void *request_get_data(request_t *req, int *size, int *status_code)
     return req->data;
 }
 
+const void *request_get_partial_data(request_t *req, int *size)
+{
+    // emscripten_async_wget2_data only hands us the data on completion.
+    if (size) *size = 0;
+    return NULL;
+}
+
 void request_make_fresh(request_t *req)
 {
 }
 
+void request_set_priority(request_t *req, int priority)
+{
+    // With emscripten the browser owns the scheduling of the fetches.
+}
+
 #endif
@@ -86,6 +86,61 @@ uint8_t *img_read_from_mem(const void *data, int size,
     return stbi_load_from_memory(data, size, w, h, bpp, *bpp);
 }
 
+/*
+ * Incremental image decoder, so that the decode of a tile can overlap
+ * its download.  Only webp streams (the format of the imagery surveys)
+ * decode incrementally; for other formats the first update fails and
+ * the caller falls back to a full decode once the transfer is done.
+ */
+struct img_decoder {
+    WebPIDecoder    *idec;
+    int             fed;    // Number of bytes already appended.
+    bool            failed;
+};
+
+img_decoder_t *img_decoder_create(void)
+{
+    img_decoder_t *dec = calloc(1, sizeof(*dec));
+    dec->idec = WebPINewRGB(MODE_RGBA, NULL, 0, 0);
+    return dec;
+}
+
+int img_decoder_update(img_decoder_t *dec, const void *data, int size)
+{
+    VP8StatusCode status;
+
+    if (dec->failed) return -1;
+    if (size <= dec->fed) return 0;
+    status = WebPIAppend(dec->idec, data + dec->fed, size - dec->fed);
+    dec->fed = size;
+    if (status != VP8_STATUS_OK && status != VP8_STATUS_SUSPENDED) {
+        dec->failed = true;
+        return -1;
+    }
+    return 0;
+}
+
+uint8_t *img_decoder_finish(img_decoder_t *dec, int *w, int *h, int *bpp)
+{
+    uint8_t *buf, *ret;
+    int last_y = 0, stride = 0;
+
+    if (dec->failed) return NULL;
+    buf = WebPIDecGetRGB(dec->idec, &last_y, w, h, &stride);
+    if (!buf || last_y != *h) return NULL;
+    *bpp = 4;
+    ret = malloc((*h) * stride);
+    memcpy(ret, buf, (*h) * stride);
+    return ret;
+}
+
+void img_decoder_delete(img_decoder_t *dec)
+{
+    if (!dec) return;
+    WebPIDelete(dec->idec);
+    free(dec);
+}
+
 void img_write(const uint8_t *img, int w, int h, int bpp, const char *path)
 {
     stbi_write_png(path, w, h, bpp, img, 0);
@@ -9,6 +9,9 @@
 
 #include "texture.h"
 #include "gl.h"
+#include "mem.h"
+#include "utils.h" // For img_read_from_mem.
+#include "worker.h"
 
 #include <assert.h>
 #include <math.h>
@@ -17,10 +20,41 @@
 
 static struct {
     void *user;
-    uint8_t *(*load)(void *user, const char *url, int *code,
-                     int *w, int *h, int *bpp);
+    const void *(*load_data)(void *user, const char *url, int *code,
+                             int *size);
+    const void *(*partial_data)(void *user, const char *url, int *size);
 } g_callback = {};
 
+/*
+ * Type: texture_loader_t
+ * Decode the image of an async texture in the worker pool, so that only
+ * the GL upload runs on the render thread.
+ */
+typedef struct texture_loader {
+    worker_t    worker;
+    uint8_t     *data;      // Encoded image data (copied).
+    int         size;
+    uint8_t     *img;       // Decoded pixels, set by the worker.
+    int         w, h, bpp;
+    int         rows_done;  // For the staged GL upload.
+    bool        failed;
+} texture_loader_t;
+
+// Max number of pixels a single texture_load call uploads to the GPU:
+// bigger images (survey tiles) are streamed a slice per frame, so that a
+// single upload cannot stall the render thread.
+#define UPLOAD_BUDGET_PX (512 * 512)
+
+static int texture_load_worker(worker_t *w)
+{
+    texture_loader_t *loader = (void*)w;
+    loader->img = img_read_from_mem(loader->data, loader->size,
+                                    &loader->w, &loader->h, &loader->bpp);
+    mem_free(loader->data);
+    loader->data = NULL;
+    return 0;
+}
+
 static inline bool is_pow2(int n) {return (n & (n - 1)) == 0;}
 static inline int next_pow2(int x) {return pow(2, ceil(log(x) / log(2)));}
 
@@ -39,11 +73,17 @@ static void blit(const uint8_t *src, int src_w, int src_h, int bpp,
 }
 
 void texture_set_load_callback(void *user,
-        uint8_t *(*load)(void *user, const char *url, int *code,
-                         int *w, int *h, int *bpp))
+        const void *(*load_data)(void *user, const char *url, int *code,
+                                 int *size))
 {
     g_callback.user = user;
-    g_callback.load = load;
+    g_callback.load_data = load_data;
+}
+
+void texture_set_partial_load_callback(void *user,
+        const void *(*partial_data)(void *user, const char *url, int *size))
+{
+    g_callback.partial_data = partial_data;
 }
 
 void texture_set_data(texture_t *tex, const void *data, int w, int h, int bpp)
@@ -81,6 +121,48 @@ void texture_set_data(texture_t *tex, const void *data, int w, int h, int bpp)
         GL(glGenerateMipmap(GL_TEXTURE_2D));
 }
 
+/*
+ * Allocate the GL storage and set the sampling parameters of a texture
+ * without uploading any pixel, so that the data can then be streamed in
+ * slices with texture_set_sub_data.  Only for pow2 sizes (no padding).
+ */
+static void texture_alloc(texture_t *tex, int w, int h, int bpp)
+{
+    assert(is_pow2(w) && is_pow2(h));
+    tex->w = w;
+    tex->h = h;
+    tex->tex_w = w;
+    tex->tex_h = h;
+    tex->format = (int[]){
+        0, GL_LUMINANCE, GL_LUMINANCE_ALPHA, GL_RGB, GL_RGBA
+    }[bpp];
+    assert(tex->format);
+    GL(glActiveTexture(GL_TEXTURE0));
+    GL(glBindTexture(GL_TEXTURE_2D, tex->id));
+    GL(glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+    GL(glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+            (tex->flags & TF_MIPMAP)? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR));
+    GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL(glTexImage2D(GL_TEXTURE_2D, 0, tex->format, tex->tex_w, tex->tex_h,
+                0, tex->format, GL_UNSIGNED_BYTE, NULL));
+}
+
+void texture_set_sub_data(texture_t *tex, int x, int y,
+                          const void *data, int w, int h, int bpp)
+{
+    assert(tex->id);
+    assert(x >= 0 && y >= 0 && x + w <= tex->tex_w && y + h <= tex->tex_h);
+    assert(tex->format == ((int[]){
+        0, GL_LUMINANCE, GL_LUMINANCE_ALPHA, GL_RGB, GL_RGBA})[bpp]);
+    GL(glActiveTexture(GL_TEXTURE0));
+    GL(glBindTexture(GL_TEXTURE_2D, tex->id));
+    GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    GL(glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, tex->format,
+                       GL_UNSIGNED_BYTE, data));
+    GL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+}
+
 texture_t *texture_create(int w, int h, int bpp)
 {
     texture_t *tex;
@@ -100,6 +182,18 @@ void texture_release(texture_t *tex)
     if (!tex) return;
     tex->ref--;
     if (tex->ref) return;
+    if (tex->loader) {
+        // If the decode is still running we cannot free the loader; better
+        // leak it than crash the worker.
+        if (worker_is_running(&tex->loader->worker)) {
+            tex->loader = NULL;
+        } else {
+            mem_free(tex->loader->data);
+            free(tex->loader->img);
+            free(tex->loader);
+        }
+    }
+    img_decoder_delete(tex->idec);
     free(tex->url);
     if (tex->id) GL(glDeleteTextures(1, &tex->id));
     free(tex);
@@ -142,15 +236,111 @@ texture_t *texture_from_url(const char *url, int flags)
 
 bool texture_load(texture_t *tex, int *code)
 {
-    int w, h, bpp = 0;
-    void *img;
-    if (tex->id) return true;
+    int code_, size, rows, w, h, bpp;
+    const void *data;
+    uint8_t *img;
+    texture_loader_t *loader;
+
+    if (!code) code = &code_;
+    *code = 200;
+    if (tex->id && !tex->loader) return true;
     assert(tex->url);
-    assert(g_callback.load);
-    img = g_callback.load(g_callback.user, tex->url, code, &w, &h, &bpp);
-    if (!img) return false;
-    GL(glGenTextures(1, &tex->id));
-    texture_set_data(tex, img, w, h, bpp);
-    free(img);
+    assert(g_callback.load_data);
+
+    if (!tex->loader) {
+        data = g_callback.load_data(g_callback.user, tex->url, code, &size);
+        if (!data) {
+            // While the download is in flight, feed the bytes received
+            // so far to the incremental decoder (webp only), so that
+            // decode and download overlap.
+            if (*code == 0 && g_callback.partial_data) {
+                data = g_callback.partial_data(g_callback.user, tex->url,
+                                               &size);
+                if (data) {
+                    if (!tex->idec) tex->idec = img_decoder_create();
+                    img_decoder_update(tex->idec, data, size);
+                }
+            }
+            return false;
+        }
+        if (tex->idec) {
+            // Finish the incremental decode with the final bytes.
+            img = NULL;
+            if (img_decoder_update(tex->idec, data, size) == 0)
+                img = img_decoder_finish(tex->idec, &w, &h, &bpp);
+            img_decoder_delete(tex->idec);
+            tex->idec = NULL;
+            if (img) {
+                // Already fully decoded during the download: create the
+                // loader in the finished state, only the (possibly
+                // staged) upload is left to do.
+                loader = calloc(1, sizeof(*loader));
+                loader->worker.state = 2; // Nothing to run.
+                loader->img = img;
+                loader->w = w;
+                loader->h = h;
+                loader->bpp = bpp;
+                tex->loader = loader;
+            }
+            // On failure (not a webp), fall through to the worker path.
+        }
+        if (!tex->loader) {
+            // Hand the image decoding to the worker pool.
+            loader = calloc(1, sizeof(*loader));
+            worker_init(&loader->worker, texture_load_worker);
+            loader->data = mem_alloc(MEM_TAG_RENDER, size);
+            memcpy(loader->data, data, size);
+            loader->size = size;
+            tex->loader = loader;
+        }
+    }
+    loader = tex->loader;
+    if (loader->failed) {
+        *code = 500;
+        return false;
+    }
+    if (!worker_iter(&loader->worker)) {
+        *code = 0;
+        return false;
+    }
+    if (!loader->img) {
+        // Keep the failed loader so that we don't retry the decode on
+        // every call.
+        loader->failed = true;
+        *code = 500;
+        return false;
+    }
+    // Only the GL upload happens on the render thread.  Images over the
+    // upload budget are streamed a slice per call, so a large survey
+    // tile never stalls a frame with a single glTexImage2D.
+    if (!tex->id) {
+        GL(glGenTextures(1, &tex->id));
+        if (!is_pow2(loader->w) || !is_pow2(loader->h) ||
+                loader->w * loader->h <= UPLOAD_BUDGET_PX) {
+            texture_set_data(tex, loader->img, loader->w, loader->h,
+                             loader->bpp);
+            goto done;
+        }
+        texture_alloc(tex, loader->w, loader->h, loader->bpp);
+    }
+    rows = max(1, UPLOAD_BUDGET_PX / loader->w);
+    rows = min(rows, loader->h - loader->rows_done);
+    texture_set_sub_data(tex, 0, loader->rows_done,
+                         loader->img + loader->rows_done * loader->w *
+                         loader->bpp, loader->w, rows, loader->bpp);
+    loader->rows_done += rows;
+    if (loader->rows_done < loader->h) {
+        *code = 0;
+        return false;
+    }
+    if (tex->flags & TF_MIPMAP) {
+        GL(glActiveTexture(GL_TEXTURE0));
+        GL(glBindTexture(GL_TEXTURE_2D, tex->id));
+        GL(glGenerateMipmap(GL_TEXTURE_2D));
+    }
+done:
+    free(loader->img);
+    free(loader);
+    tex->loader = NULL;
     return true;
 }
@@ -43,25 +43,42 @@ typedef struct texture {
     int             format;
     int             flags;
     char            *url;
+    // Set while the image is being decoded in the worker pool.
+    struct texture_loader *loader;
+    // Set while the image is being decoded incrementally during its
+    // download.
+    struct img_decoder *idec;
 } texture_t;
 
 /*
  * Function: texture_set_load_callback
  * Set the callback function that will be used for asynchronous textures.
  *
+ * The actual image decoding then runs in the worker pool: the callback only
+ * has to return the encoded file data.
+ *
  * Parameters:
- *   user - User data data will be passed to the callback.  Can be NULL.
- *   load - The callback function.  The function takes an url as input and
- *          should return the image data or NULL if the image is not ready
- *          yet.  We also set the following values:
- *            code  - Http code that will be passed back by <texture_load>.
- *            w     - The width of the image.
- *            h     - The height of the image.
- *            bpp   - Number of bytes per pixel of the image (1, 2, 3 or 4).
+ *   user      - User data data will be passed to the callback.  Can be NULL.
+ *   load_data - The callback function.  The function takes an url as input
+ *               and should return the encoded image file data (still owned
+ *               by the callee) or NULL if the data is not ready yet.  We
+ *               also set the following values:
+ *                 code  - Http code that will be passed back by
+ *                         <texture_load>.
+ *                 size  - The size of the returned data in bytes.
  */
 void texture_set_load_callback(void *user,
-        uint8_t *(*load)(void *user, const char *url, int *code,
-                         int *w, int *h, int *bpp));
+        const void *(*load_data)(void *user, const char *url, int *code,
+                                 int *size));
+
+/*
+ * Function: texture_set_partial_load_callback
+ * Set an optional callback returning the bytes received so far of an
+ * url whose download is still in flight, so that the decode of stream
+ * capable formats (webp) overlaps the download.
+ */
+void texture_set_partial_load_callback(void *user,
+        const void *(*partial_data)(void *user, const char *url, int *size));
 
 texture_t *texture_create(int w, int h, int bpp);
 texture_t *texture_from_data(const void *data, int img_w, int img_h, int bpp,
@@ -69,4 +86,13 @@ texture_t *texture_from_data(const void *data, int img_w, int img_h, int bpp,
 texture_t *texture_from_url(const char *url, int flags);
 bool texture_load(texture_t *tex, int *code);
 void texture_set_data(texture_t *tex, const void *data, int w, int h, int bpp);
+/*
+ * Function: texture_set_sub_data
+ * Update a sub rectangle of an already allocated texture.
+ *
+ * The data rows must be tightly packed, and the bpp must match the one
+ * the texture was created with.
+ */
+void texture_set_sub_data(texture_t *tex, int x, int y,
+                          const void *data, int w, int h, int bpp);
 void texture_release(texture_t *tex);
@@ -108,6 +108,23 @@ uint8_t *img_read(const char *path, int *w, int *h, int *bpp);
 uint8_t *img_read_from_mem(const void *data, int size,
                            int *w, int *h, int *bpp);
 
+/*
+ * Type: img_decoder_t
+ * Incremental image decoder, to overlap the decode of an image with its
+ * download.  Feed it the bytes received so far with <img_decoder_update>
+ * (always the full buffer from the start: only the new tail is decoded),
+ * and get the pixels with <img_decoder_finish> once the transfer is
+ * complete.  Only webp streams decode incrementally: for other formats
+ * <img_decoder_update> returns -1 and the caller should fall back to
+ * <img_read_from_mem> on the complete data.
+ */
+typedef struct img_decoder img_decoder_t;
+
+img_decoder_t *img_decoder_create(void);
+int img_decoder_update(img_decoder_t *dec, const void *data, int size);
+uint8_t *img_decoder_finish(img_decoder_t *dec, int *w, int *h, int *bpp);
+void img_decoder_delete(img_decoder_t *dec);
+
 /*
  * Function: img_write
  * Write an image to file.
@@ -12,8 +12,108 @@
 
 #include <assert.h>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 
+/*
+ * Arena allocator for the transient json doms.  A parse makes thousands
+ * of small allocations that are all freed together: serve them by
+ * bumping a pointer in large blocks, so a load storm doesn't hammer the
+ * allocator, and release the whole dom in one go.
+ */
+
+#define JSON_ARENA_BLOCK_SIZE (64 * 1024)
+
+typedef struct json_arena_block json_arena_block_t;
+struct json_arena_block {
+    json_arena_block_t *next;
+    size_t  size, used;
+    // The served memory follows.
+};
+
+typedef struct json_arena json_arena_t;
+struct json_arena {
+    json_arena_t        *next;   // Global list of the live arenas.
+    json_value          *root;   // To find the arena in json_arena_free.
+    json_arena_block_t  *blocks;
+};
+
+static json_arena_t *g_json_arenas = NULL;
+
+static void *json_arena_alloc(size_t size, int zero, void *user)
+{
+    json_arena_t *arena = user;
+    json_arena_block_t *block = arena->blocks;
+    size_t block_size;
+    void *ret;
+
+    size = (size + 15) & ~(size_t)15;
+    if (!block || block->used + size > block->size) {
+        block_size = size > JSON_ARENA_BLOCK_SIZE ?
+                        size : JSON_ARENA_BLOCK_SIZE;
+        block = malloc(sizeof(*block) + block_size);
+        block->size = block_size;
+        block->used = 0;
+        block->next = arena->blocks;
+        arena->blocks = block;
+    }
+    ret = (char*)(block + 1) + block->used;
+    block->used += size;
+    if (zero) memset(ret, 0, size);
+    return ret;
+}
+
+// The individual values are only released with the arena.
+static void json_arena_noop_free(void *ptr, void *user)
+{
+    (void)ptr;
+    (void)user;
+}
+
+static void json_arena_delete(json_arena_t *arena)
+{
+    json_arena_block_t *block;
+    while ((block = arena->blocks)) {
+        arena->blocks = block->next;
+        free(block);
+    }
+    free(arena);
+}
+
+json_value *json_parse_arena(const char *str, int len)
+{
+    json_arena_t *arena;
+    json_settings settings = {0};
+    json_value *ret;
+
+    arena = calloc(1, sizeof(*arena));
+    settings.mem_alloc = json_arena_alloc;
+    settings.mem_free = json_arena_noop_free;
+    settings.user_data = arena;
+    ret = json_parse_ex(&settings, str, len, NULL);
+    if (!ret) {
+        json_arena_delete(arena);
+        return NULL;
+    }
+    arena->root = ret;
+    arena->next = g_json_arenas;
+    g_json_arenas = arena;
+    return ret;
+}
+
+void json_arena_free(json_value *value)
+{
+    json_arena_t *arena, **prev;
+
+    if (!value) return;
+    for (prev = &g_json_arenas; (arena = *prev); prev = &arena->next) {
+        if (arena->root == value) break;
+    }
+    assert(arena);
+    *prev = arena->next;
+    json_arena_delete(arena);
+}
+
 json_value *json_get_attr(const json_value *val, const char *attr, int type)
 {
     int i;
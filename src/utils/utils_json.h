@@ -42,6 +42,23 @@ char *json_to_string(const json_value *val);
  */
 json_value *json_copy(const json_value *val);
 
+/*
+ * Function: json_parse_arena
+ * Same as json_parse, but allocates the whole dom from a single arena.
+ *
+ * To use for the transient doms (tile headers, skycultures, geojson):
+ * the thousands of small allocations of a parse get served by bumping a
+ * pointer, and the dom is released wholesale.  The returned value must
+ * be freed with <json_arena_free>, not json_value_free.
+ */
+json_value *json_parse_arena(const char *str, int len);
+
+/*
+ * Function: json_arena_free
+ * Release a dom returned by <json_parse_arena> and its arena.
+ */
+void json_arena_free(json_value *value);
+
 /*
  * Special interface to parse json document using a syntax similar to bson
  * C Object notation.
@@ -29,6 +29,20 @@
 #define S
 #endif
 
+/*
+ * Macro: VEC_ALIGN_16
+ * Align a matrix or vector member on 16 bytes, so that the compiler can
+ * use aligned vector loads in the kernels below (SSE2 and wasm simd128
+ * both work on 16 bytes lanes).
+ */
+#ifndef VEC_ALIGN_16
+#   if defined(__GNUC__) || defined(__clang__)
+#       define VEC_ALIGN_16 __attribute__((aligned(16)))
+#   else
+#       define VEC_ALIGN_16
+#   endif
+#endif
+
 #ifndef VEC_IMPLEMENTATION
 
 #define VEC(...) ((const double[]){__VA_ARGS__})
@@ -193,6 +207,8 @@ DEF void quat_normalize(const double q[S 4], double out[S 4]);
 DEF bool cap_contains_vec3(const double cap[S 4], const double v[S 3]);
 DEF bool cap_contains_cap(const double cap[S 4], const double c[S 4]);
 DEF bool cap_intersects_cap(const double cap[S 4], const double c[S 4]);
+DEF void cap_union(const double a[S 4], const double b[S 4],
+                   double out[S 4]);
 
 #endif
 
@@ -472,10 +488,12 @@ DEF void mat3_mul_vec2(const double mat[S 3][3], const double v[S 2],
 DEF void mat4_mul_vec4(const double mat[S 4][4], const double v[S 4],
                        double out[S 4])
 {
-    double ret[4] = {};
+    double ret[4] VEC_ALIGN_16 = {};
     int i, j;
-    for (i = 0; i < 4; i++) {
-        for (j = 0; j < 4; j++) {
+    // Accumulate column by column: the inner loop walks contiguous
+    // memory, which lets the compiler vectorize it.
+    for (j = 0; j < 4; j++) {
+        for (i = 0; i < 4; i++) {
             ret[i] += mat[j][i] * v[j];
         }
     }
@@ -581,9 +599,11 @@ DEF void mat3_mul(const double a[S 3][3], const double b[S 3][3],
 {
     int i, j, k;
     double ret[3][3] = {{0}};
-    for (i = 0; i < 3; i++) {
-        for (j = 0; j < 3; j++) {
-            for (k = 0; k < 3; ++k) {
+    // Innermost loop walks a column of a contiguously so that the
+    // compiler can vectorize the accumulation.
+    for (j = 0; j < 3; j++) {
+        for (k = 0; k < 3; ++k) {
+            for (i = 0; i < 3; i++) {
                 ret[j][i] += a[k][i] * b[j][k];
             }
         }
@@ -595,10 +615,11 @@ DEF void mat4_mul(const double a[S 4][4], const double b[S 4][4],
                   double out[S 4][4])
 {
     int i, j, k;
-    double ret[4][4] = {{0}};
-    for (i = 0; i < 4; i++) {
-        for (j = 0; j < 4; j++) {
-            for (k = 0; k < 4; ++k) {
+    double ret[4][4] VEC_ALIGN_16 = {{0}};
+    // Same loop order as mat3_mul: contiguous inner accumulation.
+    for (j = 0; j < 4; j++) {
+        for (k = 0; k < 4; ++k) {
+            for (i = 0; i < 4; i++) {
                 ret[j][i] += a[k][i] * b[j][k];
             }
         }
@@ -1003,6 +1024,43 @@ DEF bool cap_intersects_cap(const double cap[S 4], const double c[S 4])
       (a <= 1.0 && a * a <= (1.0 - d1 * d1) * (1.0 - d2 * d2));
 }
 
+/*
+ * Compute a cap containing both a and b.  The result is conservative:
+ * it always contains the two input caps, but is not necessarily the
+ * smallest such cap.
+ */
+DEF void cap_union(const double a[S 4], const double b[S 4], double out[S 4])
+{
+    double dot, d, ra, rb, r, t, dir[3];
+    dot = vec3_dot(a, b);
+    if (dot > +1.0) dot = +1.0;
+    if (dot < -1.0) dot = -1.0;
+    d = acos(dot);
+    ra = acos(a[3] > 1.0 ? 1.0 : a[3] < -1.0 ? -1.0 : a[3]);
+    rb = acos(b[3] > 1.0 ? 1.0 : b[3] < -1.0 ? -1.0 : b[3]);
+    if (ra >= d + rb) { // a already contains b.
+        vec4_copy(a, out);
+        return;
+    }
+    if (rb >= d + ra) { // b already contains a.
+        vec4_copy(b, out);
+        return;
+    }
+    r = (d + ra + rb) / 2;
+    if (r >= M_PI / 2) { // Just use the whole sphere.
+        vec3_copy(a, out);
+        out[3] = -1.0;
+        return;
+    }
+    // Move the direction from a towards b so that both sides are covered.
+    t = d > 0.0 ? (r - ra) / d : 0.5;
+    vec3_mix(a, b, t, dir);
+    vec3_normalize(dir, dir);
+    vec3_copy(dir, out);
+    // Small margin because the direction interpolation is approximate.
+    out[3] = cos(r * 1.01);
+}
+
 DEF void cap_great_circle_closest_point(const double cap[S 4],
                                         const double u[S 3], double out[S 3])
 {
@@ -8,9 +8,21 @@
  */
 
 #include "worker.h"
+#include "job.h"
+
 #include <string.h>
 
-#ifndef HAVE_PTHREAD
+/*
+ * The workers are now a thin wrapper on top of the job system (job.h),
+ * so that all the background work shares the same work stealing pool.
+ */
+
+static int worker_job_fn(void *user)
+{
+    worker_t *w = user;
+    w->ret = w->fn(w);
+    return 0;
+}
 
 void worker_init(worker_t *w, int (*fn)(worker_t *w))
 {
@@ -20,15 +32,16 @@ void worker_init(worker_t *w, int (*fn)(worker_t *w))
 
 int worker_iter(worker_t *w)
 {
-    if (w->state) return 1;
-    w->fn(w);
-    w->state = 1;
+    if (w->state == 2) return 1;
+    if (!w->job) w->job = job_submit(worker_job_fn, w);
+    if (!job_is_done(w->job)) return 0;
+    job_release(w->job);
+    w->job = NULL;
+    w->state = 2;
     return 1;
 }
 
 bool worker_is_running(worker_t *w)
 {
-    return false;
+    return w->job && !job_is_done(w->job);
 }
-
-#endif
@@ -26,6 +26,7 @@ struct worker
     void *user;
     int ret;
     int state;
+    void *job; // Underlying job handle (see job.h).
 };
 
 /*
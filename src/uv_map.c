@@ -11,9 +11,34 @@
 #include "uv_map.h"
 
 #include "algos/algos.h"
+#include "utils/cache.h"
 #include "utils/vec.h"
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Cache of the healpix grid directions: the unit sphere positions of a
+ * healpix tile grid only depend on (order, pix, swapped, grid size), so
+ * the tiles rendered every frame reuse the same precomputed vectors and
+ * only pay the transform, instead of redoing the healpix projection.
+ */
+static cache_t *g_grid_cache = NULL;
+#define GRID_CACHE_SIZE (2 * (1 << 20)) // 2 MiB of cached directions.
+
+typedef struct {
+    int     order;
+    int     pix;
+    int     swapped;
+    int     size;
+} grid_key_t;
+
+static int del_grid(void *data)
+{
+    free(data);
+    return 0;
+}
 
 void uv_map(const uv_map_t *map, const double v[2], double out[4],
             double normal[3])
@@ -38,12 +63,73 @@ void uv_map(const uv_map_t *map, const double v[2], double out[4],
  *   out        - Output of all the mapped vertices.
  *   normals    - If set, output of all the mapped vertices normals.
  */
+/*
+ * Healpix fast path of uv_map_grid: the healpix mat is a 2d affine
+ * transform, so we can compute all the xy coordinates inline and convert
+ * them with the batch kernel, instead of paying one indirect uv_map call
+ * (and one healpix_xy2vec call) per vertex.  This is the hot path: the
+ * tile tessellation grids and the traversal clipping tests (through
+ * uv_map_get_bounding_cap) all come through here.
+ */
+static void uv_map_grid_healpix(const uv_map_t *map, int size,
+                                double (*out)[4], double (*normals)[3])
+{
+    int i, j, k, n = (size + 1) * (size + 1);
+    double u, v, p[4], normal[3];
+    double (*xy)[2];
+    double (*v3)[3];
+    const double w = map->at_infinity ? 0.0 : 1.0;
+    const grid_key_t key = {map->order, map->pix, map->swapped, size};
+
+    // The unit sphere directions are static for a given tile and grid
+    // size: get them from the cache, computing them on first use.
+    if (!g_grid_cache)
+        g_grid_cache = cache_create("uv_grid", GRID_CACHE_SIZE);
+    v3 = cache_get(g_grid_cache, &key, sizeof(key));
+    if (!v3) {
+        xy = malloc(n * sizeof(*xy));
+        v3 = malloc(n * sizeof(*v3));
+        for (i = 0, k = 0; i < size + 1; i++)
+        for (j = 0; j < size + 1; j++, k++) {
+            u = (double)j / size;
+            v = (double)i / size;
+            xy[k][0] = map->mat[0][0] * u + map->mat[1][0] * v +
+                       map->mat[2][0];
+            xy[k][1] = map->mat[0][1] * u + map->mat[1][1] * v +
+                       map->mat[2][1];
+        }
+        healpix_xy2vec_n(n, (const double (*)[2])xy, v3);
+        free(xy);
+        cache_add(g_grid_cache, &key, sizeof(key), v3, n * sizeof(*v3),
+                  del_grid);
+    }
+
+    for (k = 0; k < n; k++) {
+        vec3_copy(v3[k], p);
+        p[3] = w;
+        if (map->transf) mat4_mul_vec4(*map->transf, p, p);
+        vec4_copy(p, out[k]);
+        if (normals) {
+            vec3_copy(v3[k], normal);
+            if (map->transf)
+                mat4_mul_vec3(*map->transf, normal, true, normal);
+            vec3_normalize(normal, normal);
+            vec3_copy(normal, normals[k]);
+        }
+    }
+}
+
 void uv_map_grid(const uv_map_t *map, int size,
                  double (*out)[4], double (*normals)[3])
 {
     int i, j;
     double uv[2];
 
+    if (map->type == UV_MAP_HEALPIX) {
+        uv_map_grid_healpix(map, size, out, normals);
+        return;
+    }
+
     for (i = 0; i < size + 1; i++)
     for (j = 0; j < size + 1; j++) {
         uv[0] = (double)j / size;
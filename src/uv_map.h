@@ -24,6 +24,7 @@
  */
 
 #include <stdbool.h>
+#include <stdint.h>
 
 enum {
     UV_MAP_HEALPIX = 1,
@@ -39,6 +40,11 @@ struct uv_map
     const double (*transf)[4][4];
     void *user;
 
+    /* Optional value identifying the map parameters (typically a crc of
+     * the user data).  Custom maps should set it if they want the lines
+     * they paint to be cached (see paint_line). */
+    uint32_t cache_key;
+
     // Healpix specific attributes.
     int order;
     int pix;
@@ -19,6 +19,7 @@ import zlib
 ROOT = "data"
 SOURCES = [
     "font/",
+    "hip.dat",
     "planets.ini",
     "shaders/",
     "symbols.png",
@@ -26,7 +27,8 @@ SOURCES = [
 ]
 DEST = "src/assets/"
 
-if os.path.dirname(__file__) != "./tools":
+# Note: __file__ is absolute with recent python versions.
+if os.path.abspath(os.path.dirname(__file__)) != os.path.abspath("./tools"):
     print("Should be run from root directory")
     sys.exit(-1)
 
@@ -62,6 +64,64 @@ def list_data_files():
                     yield os.path.relpath(p, ROOT)
             dirs[:] = sorted(dirs)
 
+def load_entry(f):
+    """Return (data, compressed) for a data file, using the same blob
+    layout as the compiled-in arrays (uint32 raw size + zlib stream for
+    the compressed ones)."""
+    data = open(os.path.join(ROOT, f), 'rb').read()
+    data_type = TYPES[os.path.basename(f).split(".")[-1]]
+    if data_type["compress"]:
+        data = struct.pack('I', len(data)) + zlib.compress(data, 9)
+        return data, True
+    return data, False
+
+
+def write_pack(path):
+    """Write all the data files into a single packed file, served by
+    asset_load_pack() (src/assets.c): a magic + entry count header, an
+    index of (url, offset, size, flags) records, the url string table,
+    then the 4 bytes aligned blobs.  Each blob is followed by a NUL byte
+    so that text entries are terminated in place."""
+    entries = []
+    for f in list_data_files():
+        data, compressed = load_entry(f)
+        entries.append((f, data, 1 if compressed else 0))
+
+    header_size = 12  # 8 bytes magic + uint32 entry count.
+    index_size = 16 * len(entries)
+    strings = b''
+    str_ofs = []
+    for f, _, _ in entries:
+        str_ofs.append(header_size + index_size + len(strings))
+        strings += f.encode() + b'\0'
+    pad = b'\0' * (-(header_size + index_size + len(strings)) % 4)
+
+    blobs = b''
+    data_ofs = []
+    base = header_size + index_size + len(strings) + len(pad)
+    for _, data, _ in entries:
+        data_ofs.append(base + len(blobs))
+        blobs += data + b'\0'
+        blobs += b'\0' * (-len(blobs) % 4)
+
+    out = io.BytesIO()
+    out.write(b'SWEPACK1')
+    out.write(struct.pack('I', len(entries)))
+    for i, (f, data, flags) in enumerate(entries):
+        out.write(struct.pack('IIII', str_ofs[i], data_ofs[i],
+                              len(data), flags))
+    out.write(strings)
+    out.write(pad)
+    out.write(blobs)
+    open(path, 'wb').write(out.getvalue())
+    print("Wrote %s (%d entries)" % (path, len(entries)))
+
+
+if len(sys.argv) == 3 and sys.argv[1] == '--pack':
+    write_pack(sys.argv[2])
+    sys.exit(0)
+
+
 def encode_str(data):
     assert isinstance(data, bytes)
     ret = '    "'
@@ -126,5 +186,5 @@ for group in groups:
     # Only write the data if it has changed, so that we don't change the
     # timestamp of the files unnecessarily.
     path = os.path.join(DEST, "%s.inl" % group)
-    if open(path).read() != out.getvalue():
+    if not os.path.exists(path) or open(path).read() != out.getvalue():
         open(path, 'w').write(out.getvalue())
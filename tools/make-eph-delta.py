@@ -0,0 +1,97 @@
+#!/usr/bin/python3
+# coding: utf-8
+
+# Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd
+#
+# This program is licensed under the terms of the GNU AGPL v3, or
+# alternatively under a commercial licence.
+#
+# The terms of the AGPL v3 license can be found in the main directory of this
+# repository.
+
+# Generate a delta release for an eph tile survey.
+#
+# Given the previously published survey directory and the corrected one,
+# write under <out>/delta/ one delta eph file per changed tile plus a
+# manifest.json listing the changed [order, pix] pairs.  A delta file is
+# a regular eph file whose first chunk ('DBAS') holds the CRC32 of the
+# base tile; its other chunks replace the base chunks of the same type
+# (see src/eph-file.c).
+#
+# The survey should then be served with the base tiles unchanged, the
+# delta directory added, and 'hips_delta_release_date' set in the
+# properties file, so that clients only re-fetch the patched rows.
+#
+# Usage: make-eph-delta.py <base-survey-dir> <new-survey-dir> <out-dir>
+
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+def read_chunks(data):
+    '''Return the list of (type, chunk) with chunk the full raw chunk'''
+    assert data[:4] == b'EPHE'
+    chunks = []
+    i = 8
+    while i + 12 <= len(data):
+        ctype = data[i:i + 4]
+        size = struct.unpack('<i', data[i + 4:i + 8])[0]
+        chunks.append((ctype, data[i:i + 12 + size]))
+        i += 12 + size
+    return chunks
+
+
+def make_delta(base, new):
+    '''Return the delta eph file data, or None if the tiles are equal'''
+    if base == new:
+        return None
+    base_chunks = dict(read_chunks(base))
+    out = new[:8]
+    out += b'DBAS' + struct.pack('<iIi', 4, zlib.crc32(base) & 0xffffffff, 0)
+    for ctype, chunk in read_chunks(new):
+        if base_chunks.get(ctype) == chunk:
+            continue
+        out += chunk
+    return out
+
+
+def list_tiles(path):
+    '''Iter the (order, pix, relative path) of all the tiles of a survey'''
+    for root, _, files in os.walk(path):
+        for f in files:
+            m = re.match(r'Npix(\d+)\.eph$', f)
+            if m is None:
+                continue
+            rel = os.path.relpath(os.path.join(root, f), path)
+            order = int(re.search(r'Norder(\d+)', rel).group(1))
+            yield order, int(m.group(1)), rel
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        print(__doc__)
+        sys.exit(-1)
+    base_dir, new_dir, out_dir = sys.argv[1:4]
+    manifest = []
+    for order, pix, rel in sorted(list_tiles(new_dir)):
+        base_path = os.path.join(base_dir, rel)
+        if not os.path.exists(base_path):
+            continue  # New tiles are fetched in full anyway.
+        base = open(base_path, 'rb').read()
+        new = open(os.path.join(new_dir, rel), 'rb').read()
+        delta = make_delta(base, new)
+        if delta is None:
+            continue
+        out_path = os.path.join(out_dir, 'delta', rel)
+        os.makedirs(os.path.dirname(out_path), exist_ok=True)
+        open(out_path, 'wb').write(delta)
+        manifest.append([order, pix])
+        print('%s: %d -> %d bytes' % (rel, len(new), len(delta)))
+    os.makedirs(os.path.join(out_dir, 'delta'), exist_ok=True)
+    with open(os.path.join(out_dir, 'delta', 'manifest.json'), 'w') as out:
+        json.dump({'tiles': manifest}, out)
+    print('%d patched tiles' % len(manifest))
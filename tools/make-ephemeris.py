@@ -0,0 +1,120 @@
+#!/usr/bin/python3
+
+# Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd
+#
+# This program is licensed under the terms of the GNU AGPL v3, or
+# alternatively under a commercial licence.
+#
+# The terms of the AGPL v3 license can be found in the main directory of this
+# repository.
+
+# Generate a precomputed planetary ephemeris eph file made of Chebyshev
+# segments, that the planets module uses in place of the analytic series
+# when the requested time falls inside the covered period.
+#
+# The positions are heliocentric ICRF (AU), sampled from a JPL kernel with
+# skyfield, then fitted on each segment as pos(x) = Σ cⱼTⱼ(x), with x the
+# time mapped to [-1, 1] over the segment.
+#
+# Example, cover the whole year 2020 with the default bodies:
+#
+#   ./tools/make-ephemeris.py --start 58849 --days 366 -o ephemeris.eph
+
+import argparse
+import struct
+import zlib
+from math import pi, cos
+
+import skyfield.api as sf
+
+# Bodies to include: JPL HORIZONS id used by the engine -> kernel name.
+BODIES = {
+    199: 'mercury',
+    299: 'venus',
+    301: 'moon',
+    499: 'mars barycenter',
+    599: 'jupiter barycenter',
+    699: 'saturn barycenter',
+    799: 'uranus barycenter',
+    899: 'neptune barycenter',
+}
+
+# Duration (day) of one segment for the bodies that need a finer split
+# than the default.
+SEGMENT_DAYS = {
+    199: 8.0,   # Mercury.
+    301: 4.0,   # Moon.
+}
+
+
+def fit_segment(f, deg):
+    '''Fit deg Chebyshev coefficients over f: [-1, 1] -> float'''
+    nodes = [cos(pi * (k + 0.5) / deg) for k in range(deg)]
+    vals = [f(x) for x in nodes]
+    coefs = []
+    for j in range(deg):
+        c = 2.0 / deg * sum(vals[k] * cos(pi * j * (k + 0.5) / deg)
+                            for k in range(deg))
+        coefs.append(c)
+    coefs[0] /= 2  # The engine evaluates Σ cⱼTⱼ with a plain c₀ term.
+    return coefs
+
+
+def make_chunk(type, data):
+    return (type + struct.pack('<i', len(data)) + data +
+            struct.pack('<I', zlib.crc32(data)))
+
+
+def make_body_chunk(kernel, ts, id, name, start, days, seg_days, deg):
+    sun = kernel['sun']
+    target = kernel[name]
+
+    def pos(tt):
+        t = ts.tt_jd(2400000.5 + tt)
+        return target.at(t).position.au - sun.at(t).position.au
+
+    nb = int(round(days / seg_days))
+    coefs = []
+    for k in range(nb):
+        t0 = start + k * seg_days
+        for i in range(3):
+            coefs += fit_segment(
+                lambda x: pos(t0 + (x + 1) / 2 * seg_days)[i], deg)
+    blob = struct.pack('<%dd' % len(coefs), *coefs)
+    comp = zlib.compress(blob, 9)
+    data = struct.pack('<iiii', 1, id, nb, deg)
+    data += struct.pack('<dd', start, seg_days)
+    data += struct.pack('<ii', len(blob), len(comp)) + comp
+    return make_chunk(b'CHEB', data)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description='Generate a precomputed planetary ephemeris eph file')
+    parser.add_argument('--start', type=float, required=True,
+                        help='start of the covered period (TT, MJD)')
+    parser.add_argument('--days', type=float, required=True,
+                        help='duration of the covered period (day)')
+    parser.add_argument('--seg-days', type=float, default=16.0,
+                        help='duration of one segment (day)')
+    parser.add_argument('--deg', type=int, default=12,
+                        help='number of coefficients per coordinate')
+    parser.add_argument('--kernel', default='de421.bsp',
+                        help='JPL kernel to sample')
+    parser.add_argument('-o', '--out', default='ephemeris.eph')
+    args = parser.parse_args()
+
+    loader = sf.Loader('./tmp')
+    kernel = loader(args.kernel)
+    ts = sf.load.timescale()
+
+    out = b'EPHE' + struct.pack('<i', 2)
+    for id, name in sorted(BODIES.items()):
+        seg_days = SEGMENT_DAYS.get(id, args.seg_days)
+        print('%s: %d segments of %g days' %
+              (name, int(round(args.days / seg_days)), seg_days))
+        out += make_body_chunk(kernel, ts, id, name, args.start, args.days,
+                               seg_days, args.deg)
+    with open(args.out, 'wb') as f:
+        f.write(out)
+    print('wrote %s (%d bytes)' % (args.out, len(out)))
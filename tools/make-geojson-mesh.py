@@ -0,0 +1,254 @@
+#!/usr/bin/python3
+
+# Stellarium Web Engine - Copyright (c) 2019 - Noctua Software Ltd
+#
+# This program is licensed under the terms of the GNU AGPL v3, or
+# alternatively under a commercial licence.
+#
+# The terms of the AGPL v3 license can be found in the main directory of this
+# repository.
+
+# Convert a geojson file into a binary pre-tessellated mesh file ('MESH'
+# eph chunks), that the geojson module loads with geojson_set_mesh_data
+# without any parsing or triangulation on the client.
+#
+# The polygons are triangulated offline (earcut) and all the edges are
+# subdivided down to --max-edge, so the client renders the meshes as
+# they are.  The vertices are quantized as int32 lon/lat (1e-7 degree)
+# and the blocks are zlib compressed.
+#
+# With --split-order the features are grouped by the healpix tile of
+# their centroid and one file per tile is written using the usual
+# Norder/Dir/Npix layout, so an app only has to feed the tiles covering
+# the view.
+#
+# Example:
+#
+#   ./tools/make-geojson-mesh.py survey-footprint.geojson -o footprint.mesh
+
+import argparse
+import json
+import math
+import os
+import struct
+import sys
+import zlib
+
+DD2R = math.pi / 180
+DR2D = 180 / math.pi
+
+try:
+    import numpy as np
+    import mapbox_earcut
+except ImportError:
+    print('This tool requires numpy and mapbox_earcut')
+    sys.exit(-1)
+
+
+def lonlat2c(lon, lat):
+    return (math.cos(lat) * math.cos(lon),
+            math.cos(lat) * math.sin(lon),
+            math.sin(lat))
+
+
+def c2lonlat(v):
+    return (math.atan2(v[1], v[0]), math.asin(max(-1, min(1, v[2]))))
+
+
+def parse_color(s, default):
+    if not s: return default
+    s = s.lstrip('#')
+    return tuple(int(s[i:i + 2], 16) / 255.0 for i in (0, 2, 4))
+
+
+def feature_style(props):
+    fill = parse_color(props.get('fill'), (0.33, 0.33, 0.33))
+    stroke = parse_color(props.get('stroke'), (0.33, 0.33, 0.33))
+    return (fill + (props.get('fill-opacity', 0.5),) +
+            stroke + (props.get('stroke-opacity', 1.0),) +
+            (props.get('stroke-width', 1.0),))
+
+
+class Mesh:
+    '''A 3d mesh under construction, vertices as unit vectors'''
+
+    def __init__(self):
+        self.verts = []
+        self.tris = []
+        self.lines = []
+
+    def add_ring(self, ring):
+        ofs = len(self.verts)
+        self.verts += [lonlat2c(p[0] * DD2R, p[1] * DD2R) for p in ring]
+        self.lines += [(ofs + i, ofs + i + 1) for i in range(len(ring) - 1)]
+        return ofs
+
+    def add_polygon(self, rings):
+        ofs = len(self.verts)
+        flat = []
+        ends = []
+        for ring in rings:
+            self.add_ring(ring)
+            flat += [(p[0], p[1]) for p in ring]
+            ends.append(len(flat))
+        verts = np.array(flat, dtype=np.float64).reshape(-1, 2)
+        indices = mapbox_earcut.triangulate_float64(verts, ends)
+        self.tris += [(ofs + indices[i], ofs + indices[i + 1],
+                       ofs + indices[i + 2])
+                      for i in range(0, len(indices), 3)]
+
+    def subdivide_segment(self, kind, idx, max_length):
+        '''Split one triangle edge or line segment at its midpoint'''
+        a, b = idx
+        va, vb = self.verts[a], self.verts[b]
+        m = tuple((va[i] + vb[i]) / 2 for i in range(3))
+        n = math.sqrt(sum(x * x for x in m))
+        m = tuple(x / n for x in m)
+        o = len(self.verts)
+        self.verts.append(m)
+        if kind == 'line':
+            self.lines.append((a, o))
+            self.lines.append((o, b))
+        else:
+            for i, tri in enumerate(list(self.tris)):
+                for j in range(3):
+                    t = (tri[j], tri[(j + 1) % 3], tri[(j + 2) % 3])
+                    if {t[1], t[2]} == {a, b}:
+                        self.tris[i] = (t[0], t[1], o)
+                        self.tris.append((t[0], o, t[2]))
+                        break
+
+    def subdivide(self, max_length):
+        '''Split the edges larger than max_length (rad), like the engine'''
+        def length2(a, b):
+            va, vb = self.verts[a], self.verts[b]
+            return sum((va[i] - vb[i]) ** 2 for i in range(3))
+        max2 = max_length * max_length
+        again = True
+        while again:
+            again = False
+            for tri in list(self.tris):
+                edges = [(tri[i], tri[(i + 1) % 3]) for i in range(3)]
+                edge = max(edges, key=lambda e: length2(*e))
+                if length2(*edge) >= max2:
+                    self.subdivide_segment('tri', edge, max_length)
+                    again = True
+        lines = self.lines
+        self.lines = []
+        for line in lines:
+            stack = [line]
+            while stack:
+                a, b = stack.pop()
+                if length2(a, b) < max2:
+                    self.lines.append((a, b))
+                    continue
+                va, vb = self.verts[a], self.verts[b]
+                m = tuple((va[i] + vb[i]) / 2 for i in range(3))
+                n = math.sqrt(sum(x * x for x in m))
+                o = len(self.verts)
+                self.verts.append(tuple(x / n for x in m))
+                stack += [(a, o), (o, b)]
+
+    def centroid(self):
+        c = [sum(v[i] for v in self.verts) for i in range(3)]
+        n = math.sqrt(sum(x * x for x in c)) or 1
+        return tuple(x / n for x in c)
+
+
+def make_chunk(type, data):
+    return (type + struct.pack('<i', len(data)) + data +
+            struct.pack('<I', zlib.crc32(data)))
+
+
+def make_mesh_chunk(mesh, style, title, nuniq):
+    assert len(mesh.verts) < 0x10000, 'too many vertices in one feature'
+    data = struct.pack('<iq', 1, nuniq)
+    data += struct.pack('<9f', *style)
+    title = (title or '').encode('utf-8')
+    data += struct.pack('<i', len(title)) + title
+    blob = struct.pack('<iii', len(mesh.verts), len(mesh.tris) * 3,
+                       len(mesh.lines) * 2)
+    quant = []
+    for v in mesh.verts:
+        lon, lat = c2lonlat(v)
+        quant += [int(round(lon * DR2D * 1e7)), int(round(lat * DR2D * 1e7))]
+    blob += struct.pack('<%di' % len(quant), *quant)
+    indices = [i for tri in mesh.tris for i in tri]
+    indices += [i for line in mesh.lines for i in line]
+    blob += struct.pack('<%dH' % len(indices), *indices)
+    comp = zlib.compress(blob, 9)
+    data += struct.pack('<ii', len(blob), len(comp)) + comp
+    return make_chunk(b'MESH', data)
+
+
+def make_feature_meshes(feature, max_edge):
+    geo = feature['geometry']
+    meshes = []
+    if geo['type'] == 'Polygon':
+        mesh = Mesh()
+        mesh.add_polygon(geo['coordinates'])
+        meshes.append(mesh)
+    elif geo['type'] == 'MultiPolygon':
+        for rings in geo['coordinates']:
+            mesh = Mesh()
+            mesh.add_polygon(rings)
+            meshes.append(mesh)
+    elif geo['type'] == 'LineString':
+        mesh = Mesh()
+        mesh.add_ring(geo['coordinates'])
+        meshes.append(mesh)
+    else:
+        print('Skip unsupported geometry: %s' % geo['type'])
+        return []
+    for mesh in meshes:
+        mesh.subdivide(max_edge * DD2R)
+    return meshes
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description='Convert a geojson file into a binary mesh file')
+    parser.add_argument('input', help='geojson file to convert')
+    parser.add_argument('--max-edge', type=float, default=5.0,
+                        help='max edge length after subdivision (degree)')
+    parser.add_argument('--split-order', type=int, default=None,
+                        help='write one file per healpix tile of this order')
+    parser.add_argument('-o', '--out', default='out.mesh')
+    args = parser.parse_args()
+
+    if args.split_order is not None:
+        import healpy
+
+    geojson = json.load(open(args.input))
+    tiles = {}  # nuniq -> list of chunks.
+    nb = 0
+    for feature in geojson['features']:
+        props = feature.get('properties') or {}
+        style = feature_style(props)
+        title = props.get('title')
+        for mesh in make_feature_meshes(feature, args.max_edge):
+            order = args.split_order or 0
+            pix = healpy.vec2pix(1 << order, *mesh.centroid(), nest=True) \
+                    if args.split_order is not None else 0
+            nuniq = pix + 4 * (1 << (2 * order))
+            tiles.setdefault(nuniq, []).append(
+                    make_mesh_chunk(mesh, style, title, nuniq))
+            nb += 1
+
+    header = b'EPHE' + struct.pack('<i', 2)
+    if args.split_order is None:
+        out = header + b''.join(c for chunks in tiles.values() for c in chunks)
+        with open(args.out, 'wb') as f:
+            f.write(out)
+        print('wrote %s (%d meshes, %d bytes)' % (args.out, nb, len(out)))
+    else:
+        for nuniq, chunks in sorted(tiles.items()):
+            order = args.split_order
+            pix = nuniq - 4 * (1 << (2 * order))
+            path = os.path.join(args.out, 'Norder%d' % order,
+                                'Dir%d' % ((pix // 10000) * 10000),
+                                'Npix%d.mesh' % pix)
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            with open(path, 'wb') as f:
+                f.write(header + b''.join(chunks))
+            print('wrote %s (%d meshes)' % (path, len(chunks)))
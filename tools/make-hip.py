@@ -93,14 +93,10 @@ def run():
 
     data = [htable.get(x, 255) for x in range(max(htable.keys()))]
 
-    out = open('src/hip.inl', 'w')
-    print('// HIP -> pix pos at order 2.', file=out)
-    print('// Generated by tools/make-hip.py', file=out)
-
-    for i, v in enumerate(data):
-        if (i % 15): print(' ', file=out, end='')
-        print('%3d,' % v, file=out, end='')
-        if (i + 1) % 15 == 0: print(file=out)
+    # Write the table as a binary asset: one byte per HIP number, served
+    # as-is at runtime without any parsing.
+    out = open('data/hip.dat', 'wb')
+    out.write(bytes(data))
 
 if __name__ == '__main__':
     run()
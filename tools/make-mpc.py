@@ -9,13 +9,94 @@
 # The terms of the AGPL v3 license can be found in the main directory of this
 # repository.
 
+import argparse
 import gzip
+import struct
+
+from datetime import date
 
 from utils import download
 
 URL = 'https://minorplanetcenter.net/Extended_Files/mpcorb_extended.dat.gz'
 
-def run():
+DD2R = 1.745329251994329576923691e-2
+
+MJD0 = date(1858, 11, 17).toordinal()
+
+
+def unpack_char(c):
+    if '0' <= c <= '9': return ord(c) - ord('0')
+    if 'A' <= c <= 'Z': return 10 + ord(c) - ord('A')
+    return 36 + ord(c) - ord('a')
+
+
+def unpack_epoch(s):
+    '''Unpack a 5 char packed epoch to MJD'''
+    year = (ord(s[0]) - ord('I') + 18) * 100 + int(s[1:3])
+    month = unpack_char(s[3])
+    day = unpack_char(s[4])
+    return date(year, month, day).toordinal() - MJD0
+
+
+def parse_line(line):
+    '''Parse an MPCORB line, mirroring src/mpc.c mpc_parse_line'''
+    number = 0
+    if line[5] == ' ' and line[0:5].strip():
+        number = int(line[1:5]) + 10000 * unpack_char(line[0])
+    h = float(line[8:14].strip() or 'nan')
+    g = float(line[14:20].strip() or 'nan')
+    epoch = unpack_epoch(line[20:25])
+    m = float(line[26:36])
+    w = float(line[37:47])
+    o = float(line[48:58])
+    i = float(line[59:69])
+    e = float(line[70:80])
+    n = float(line[80:92])
+    a = float(line[92:104])
+    flags = int(line[161:165], 16)
+    readable = line[175:194].rstrip()
+    name, desig = '', ''
+    if readable and not readable[0].isdigit():
+        name = readable
+    else:
+        desig = readable
+    if not desig and len(line) >= 227:
+        desig = line[217:227].rstrip()
+    return (number, name, desig, h, g, epoch, m, w, o, i, e, n, a, flags)
+
+
+def write_binary(lines, path):
+    '''Write the preprocessed binary catalog read by
+    src/modules/minorplanets.c: a small header followed by
+    structure-of-arrays columns, with the angles already in radians so
+    that the engine loads it without any parsing or conversion.'''
+    rows = [parse_line(x) for x in lines]
+    nb = len(rows)
+    out = open(path, 'wb')
+    out.write(b'MPCB' + struct.pack('<ii', 1, nb))
+    cols = [
+        [x[5] for x in rows],           # epoch (MJD)
+        [x[6] * DD2R for x in rows],    # mean anomaly (rad)
+        [x[7] * DD2R for x in rows],    # argument of perihelion (rad)
+        [x[8] * DD2R for x in rows],    # longitude of ascending node (rad)
+        [x[9] * DD2R for x in rows],    # inclination (rad)
+        [x[10] for x in rows],          # eccentricity
+        [x[11] * DD2R for x in rows],   # mean daily motion (rad/day)
+        [x[12] for x in rows],          # semimajor axis (AU)
+        [x[3] for x in rows],           # H
+        [x[4] for x in rows],           # G
+    ]
+    for col in cols:
+        out.write(struct.pack('<%df' % nb, *col))
+    out.write(struct.pack('<%di' % nb, *[x[0] for x in rows]))
+    out.write(struct.pack('<%di' % nb, *[x[13] for x in rows]))
+    for idx in (1, 2):
+        for x in rows:
+            out.write(struct.pack('24s', x[idx].encode()))
+    out.close()
+
+
+def run(nb, binary):
     path = download(URL)
     lines = gzip.open(path, 'rt').readlines()
     lines = [x for x in lines if len(x) > 162]
@@ -23,13 +104,21 @@ def run():
     lines = [x for x in lines if x[175:180] != 'Pluto']
     # Sort by magnitude.
     lines = sorted(lines, key=lambda x: float(x[8:14].strip() or 'inf'))
-    # Keep only 500 first.
-    lines = lines[:500]
-    out = open("data/skydata/mpcorb.dat", "w")
-    for line in lines:
-        print(line, file=out)
-    out.close()
+    lines = lines[:nb]
+    if binary:
+        write_binary(lines, "data/skydata/mpcorb.bin")
+    else:
+        out = open("data/skydata/mpcorb.dat", "w")
+        for line in lines:
+            print(line, file=out)
+        out.close()
 
 
 if __name__ == '__main__':
-    run()
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--nb', type=int, default=500,
+                        help='number of objects to keep')
+    parser.add_argument('--binary', action='store_true',
+                        help='write the preprocessed binary catalog')
+    args = parser.parse_args()
+    run(args.nb, args.binary)
@@ -0,0 +1,228 @@
+#!/usr/bin/python3
+
+# Stellarium Web Engine - Copyright (c) 2021 - Noctua Software Ltd
+#
+# This program is licensed under the terms of the GNU AGPL v3, or
+# alternatively under a commercial licence.
+#
+# The terms of the AGPL v3 license can be found in the main directory of this
+# repository.
+
+# Compile the skyculture index.json and description.md files into binary
+# packs (index.skp) that the engine can load with near-zero parsing, so
+# that switching skycultures is effectively instant.
+#
+# The pack format is documented in src/skyculture.c
+# (skyculture_parse_pack).  Run from the root directory:
+#
+#   ./tools/make-skyculture-pack.py
+
+import json
+import math
+import os
+import re
+import struct
+import sys
+
+ROOT = "data/skydata/skycultures"
+
+# Note: __file__ is absolute with recent python versions.
+if os.path.abspath(os.path.dirname(__file__)) != os.path.abspath("./tools"):
+    print("Should be run from root directory")
+    sys.exit(-1)
+
+
+class StringTable:
+    """String block builder; offset 0 is reserved to mean 'no value'."""
+    def __init__(self):
+        self.data = bytearray(b'\x00')
+        self.offsets = {}
+
+    def add(self, txt):
+        if txt is None:
+            return 0
+        data = txt.encode('utf-8') + b'\x00'
+        if data in self.offsets:
+            return self.offsets[data]
+        ofs = len(self.data)
+        self.data += data
+        self.offsets[data] = ofs
+        return ofs
+
+
+def parse_markdown(md):
+    """Split a description.md into its sections, like add_markdown in
+    src/modules/skycultures.c does."""
+    out = {}
+    m = re.search(r'^# +(.+)$', md, re.M)
+    out['name'] = m.group(1) if m else 'Unknown'
+    sections = list(re.finditer(r'^## +(.+)$', md, re.M))
+    for i, m in enumerate(sections):
+        end = sections[i + 1].start() if i + 1 < len(sections) else len(md)
+        out[m.group(1)] = md[m.end() + 1:end].lstrip('\n').rstrip('\n')
+    return out
+
+
+def parse_constellation_descriptions(md):
+    """Split the 'Constellations' section per constellation name, like
+    load_constellation_md_data."""
+    out = {}
+    sections = list(re.finditer(r'^##### +(.+)$', md, re.M))
+    for i, m in enumerate(sections):
+        end = sections[i + 1].start() if i + 1 < len(sections) else len(md)
+        out[m.group(1)] = md[m.end() + 1:end].lstrip('\n').rstrip('\n')
+    return out
+
+
+def parse_edge(line):
+    """Parse an edge line into (ra1, de1, ra2, de2) radians and the two
+    constellation iau names."""
+    m = re.match(r'^\S+ \S+ +'
+                 r'(\d+):(\d+):(\d+) ([-+])(\d+):(\d+):(\d+) +'
+                 r'(\d+):(\d+):(\d+) ([-+])(\d+):(\d+):(\d+) +'
+                 r'(\S+) (\S+)', line)
+    if not m:
+        print('Cannot parse edge line: %s' % line)
+        return None
+    def ra(h, mn, s):
+        return math.radians((int(h) + int(mn) / 60 + int(s) / 3600) * 15)
+    def de(sign, d, mn, s):
+        v = math.radians(int(d) + int(mn) / 60 + int(s) / 3600)
+        return -v if sign == '-' else v
+    g = m.groups()
+    return (ra(*g[0:3]), de(*g[3:7]), ra(*g[7:10]), de(*g[10:14]),
+            g[14], g[15])
+
+
+def make_names(index, features):
+    """Flatten the common names into a list of
+    (main_id, english, native, pronounce, description, alt) tuples."""
+    names = []
+    for key, values in index.get('common_names', {}).items():
+        for i, v in enumerate(values):
+            names.append((key, v.get('english'), v.get('native'),
+                          v.get('pronounce'), None, 1 if i else 0))
+    for feature in features:
+        v = feature.get('common_name')
+        if not v:
+            continue
+        names.append((feature['id'], v.get('english'), v.get('native'),
+                      v.get('pronounce'), v.get('description'), 0))
+    return names
+
+
+def cst_id_for_name(names, name):
+    """Map a constellation display name to its id, like
+    skyculture_cst_id_for_name."""
+    for main_id, english, native, pronounce, _, _ in names:
+        if name in (english, native, pronounce):
+            return main_id
+    return None
+
+
+def make_pack(path):
+    index = json.load(open(os.path.join(path, 'index.json')))
+    md_path = os.path.join(path, 'description.md')
+    md = {}
+    if os.path.exists(md_path):
+        md = parse_markdown(open(md_path).read())
+
+    features = index.get('constellations', [])
+    names = make_names(index, features)
+
+    # Per constellation descriptions, from the json features and the
+    # markdown 'Constellations' section.
+    descriptions = {}
+    for feature in features:
+        if feature.get('description'):
+            descriptions[feature['id']] = feature['description']
+    for name, txt in parse_constellation_descriptions(
+            md.get('Constellations', '')).items():
+        cst_id = cst_id_for_name(names, name)
+        if cst_id:
+            descriptions[cst_id] = txt
+
+    # Per constellation edges.
+    edges = {}
+    for line in index.get('edges', []):
+        edge = parse_edge(line)
+        if edge is None:
+            continue
+        for iau in edge[4:6]:
+            # Small fix for SER1 and SER2!
+            if iau in ('SER1', 'SER2'):
+                iau = 'SER'
+            edges.setdefault(iau.upper(), []).append(edge[0:4])
+
+    strings = StringTable()
+    body = b''
+
+    langs = index.get('langs_use_native_names', [])
+    ofs = [
+        strings.add(index['id']),
+        strings.add(md.get('name', index.get('name'))),
+        strings.add(index.get('region')),
+        strings.add(md.get('Introduction', index.get('introduction'))),
+        strings.add(md.get('Description', index.get('description'))),
+        strings.add(md.get('References', index.get('references'))),
+        strings.add(md.get('Authors', index.get('authors'))),
+        strings.add(md.get('Licence', index.get('licence'))),
+        strings.add(json.dumps(index['tour']) if 'tour' in index else None),
+        strings.add('\x00'.join(langs) + '\x00' if langs else None),
+    ]
+    flags = 1 if index.get('fallback_to_international_names') else 0
+
+    body += struct.pack('<11I', *(ofs + [flags]))
+
+    body += struct.pack('<I', len(names))
+    for main_id, english, native, pronounce, description, alt in names:
+        body += struct.pack('<6I', strings.add(main_id),
+                            strings.add(english), strings.add(native),
+                            strings.add(pronounce), strings.add(description),
+                            alt)
+
+    csts = b''
+    nb_csts = 0
+    for feature in features:
+        iau = feature.get('iau')
+        lines = []
+        for seg in feature.get('lines', []):
+            for i in range(len(seg) - 1):
+                lines.append((seg[i], seg[i + 1]))
+        image = feature.get('image')
+        cst = struct.pack('<4I', strings.add(feature['id']),
+                          strings.add(iau),
+                          strings.add(image['file'] if image else None),
+                          strings.add(descriptions.get(feature['id'])))
+        for i in range(3):
+            if image:
+                anchor = image['anchors'][i]
+                w, h = image['size']
+                cst += struct.pack('<2di', anchor['pos'][0] / w,
+                                   anchor['pos'][1] / h, anchor['hip'])
+            else:
+                cst += struct.pack('<2di', 0, 0, 0)
+        cst += struct.pack('<I', len(lines))
+        for a, b in lines:
+            cst += struct.pack('<2i', a, b)
+        cst_edges = edges.get(iau.upper(), []) if iau else []
+        cst += struct.pack('<I', len(cst_edges))
+        for edge in cst_edges:
+            cst += struct.pack('<4d', *edge)
+        csts += cst
+        nb_csts += 1
+    body += struct.pack('<I', nb_csts) + csts
+
+    out = b'SKPK' + struct.pack('<2I', 1, len(strings.data))
+    out += bytes(strings.data) + body
+    dest = os.path.join(path, 'index.skp')
+    with open(dest, 'wb') as f:
+        f.write(out)
+    print('%s: %d bytes' % (dest, len(out)))
+
+
+if __name__ == '__main__':
+    for name in sorted(os.listdir(ROOT)):
+        path = os.path.join(ROOT, name)
+        if os.path.exists(os.path.join(path, 'index.json')):
+            make_pack(path)
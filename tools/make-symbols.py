@@ -8,7 +8,16 @@
 # The terms of the AGPL v3 license can be found in the main directory of this
 # repository.
 
-# Generates the symbols png image from the svg sources.
+# Generates the symbols png atlas: a 4x4 grid of 64px cells, indexed by
+# the SYMBOL enum value minus one (see src/symbols.c).  The svg based
+# symbols are rasterized with inkscape, the other ones are rendered here
+# from the same shape definitions as the old per-frame vector code, so
+# that the engine can paint every symbol as a textured quad.
+#
+# Each cell covers twice the nominal symbol size (the planetary nebula
+# ticks extend to 1.75 times the symbol radius), so a symbol of radius
+# one is drawn with a radius of CELL / 4 pixels, and the engine renders
+# a quad of twice the requested size.
 
 from math import *
 import os
@@ -22,6 +31,39 @@ if os.path.dirname(__file__) != "./tools":
     print("Should be run from root directory")
     sys.exit(-1)
 
+CELL = 64          # Atlas cell size in pixels.
+R = CELL / 4.0     # Pixel radius of a symbol of radius one.
+STROKE = 2.0       # Stroke width in atlas pixels.
+SUB = 4            # Antialiasing sub samples per pixel (in x and y).
+
+# Same dash count as the vg shader used: <dashes> periods of 50% duty
+# over the angular coordinate.
+DASHES = pi * 12 / 8
+
+# Procedural cells: atlas cell index -> list of shapes, in symbol units
+# (radius one = nominal symbol radius).
+SYMBOLS = {
+    1: [('circle', 1.0, DASHES)],                                     # OpC
+    2: [('circle', 1.0, 0), ('line', -1, 0, 1, 0),
+        ('line', 0, -1, 0, 1)],                                       # GlC
+    3: [('circle', 1.0, 0)],                                          # G
+    4: [('circle', 1.0, 0)],                                          # IG
+    5: [('circle', 1.0, 0),
+        ('line', -1.75, 0, -1, 0), ('line', 1, 0, 1.75, 0),
+        ('line', 0, -1, 0, -1.75), ('line', 0, 1, 0, 1.75)],          # PN
+    6: [('circle', 1.0, 0)],                                          # ISM
+    7: [('rect', 1.0)],                                               # BNe
+    8: [('rect', 1.0), ('circle', 0.8, DASHES * 0.8)],                # Cl*
+    9: [('circle', 1.0, DASHES)],                                     # mul
+    10: [('circle', 1.0, 0)],                                         # ?
+}
+
+# Svg cells: atlas cell index -> file in data/symbols.  Rendered at half
+# the cell size, centered, to match the procedural cells coverage.
+SVGS = {
+    0: 'artificial-satellite.svg',
+}
+
 def check_uptodate(src, dst):
     """Check if any file in dst is older than any file file in src"""
     if isinstance(src, str): src = [src]
@@ -33,23 +75,65 @@ def check_uptodate(src, dst):
                 return False
     return True
 
+def shape_alpha(shape, x, y):
+    """Whether the sub sample at (x, y) (pixels from the cell center) is
+    inside the stroke of the given shape."""
+    if shape[0] == 'circle':
+        _, scale, dashes = shape
+        d = hypot(x, y) - scale * R
+        if abs(d) > STROKE / 2: return False
+        if dashes > 0:
+            theta = atan2(y, x)
+            if (theta / (2 * pi) * dashes) % 1.0 < 0.5: return False
+        return True
+    if shape[0] == 'rect':
+        _, scale = shape
+        qx, qy = abs(x) - scale * R, abs(y) - scale * R
+        d = hypot(max(qx, 0), max(qy, 0)) + min(max(qx, qy), 0)
+        return abs(d) <= STROKE / 2
+    # Line segment.
+    _, ax, ay, bx, by = shape
+    ax, ay, bx, by = ax * R, ay * R, bx * R, by * R
+    px, py = x - ax, y - ay
+    dx, dy = bx - ax, by - ay
+    t = max(0.0, min(1.0, (px * dx + py * dy) / (dx * dx + dy * dy)))
+    return hypot(px - t * dx, py - t * dy) <= STROKE / 2
+
+def draw_symbol(shapes):
+    cell = bytearray(CELL * CELL)
+    for j in range(CELL):
+        for i in range(CELL):
+            hits = 0
+            for sj in range(SUB):
+                for si in range(SUB):
+                    x = i + (si + 0.5) / SUB - CELL / 2.0
+                    y = j + (sj + 0.5) / SUB - CELL / 2.0
+                    if any(shape_alpha(s, x, y) for s in shapes):
+                        hits += 1
+            cell[j * CELL + i] = round(hits * 255.0 / (SUB * SUB))
+    return PIL.Image.frombytes('L', (CELL, CELL), bytes(cell))
+
 def make_symbols():
-    files = [
-        'artificial-satellite.svg',
-    ]
     dst = 'data/symbols.png'
-    if check_uptodate(['data/symbols/{}'.format(x) for x in files], dst):
+    srcs = ['data/symbols/{}'.format(x) for x in SVGS.values()]
+    srcs.append(__file__)  # The procedural shapes are defined here.
+    if check_uptodate(srcs, dst):
         return
-    ret_img = PIL.Image.new('L', (128, 128))
-    for i, src in enumerate(files):
+    ret_img = PIL.Image.new('L', (4 * CELL, 4 * CELL))
+    for i, src in SVGS.items():
         path = 'data/symbols/{}'.format(src)
         subprocess.check_output([
             'inkscape', path, '--export-area-page',
-            '--export-width=32', '--export-height=32',
+            '--export-width={}'.format(CELL // 2),
+            '--export-height={}'.format(CELL // 2),
             '--export-png=/tmp/symbols.png'])
         img = PIL.Image.open('/tmp/symbols.png')
         img = img.split()[3]
-        ret_img.paste(img, (32 * (i % 4), 32 * (i / 4)))
+        ret_img.paste(img, (CELL * (i % 4) + CELL // 4,
+                            CELL * (i // 4) + CELL // 4))
+    for i, shapes in SYMBOLS.items():
+        ret_img.paste(draw_symbol(shapes),
+                      (CELL * (i % 4), CELL * (i // 4)))
     ret_img.save(dst)
 
 make_symbols()